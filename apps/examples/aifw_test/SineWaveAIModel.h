@@ -53,7 +53,8 @@ static const AIModelAttribute gSineWaveModelAttribute = {
 	1,			/* postProcessResultCount */
 	1,			/* inferenceResultCount */
 	NULL,			/* MeanVals */
-	NULL			/* STDVals */
+	NULL,			/* STDVals */
+	AIFW_ENGINE_CPU		/* engine */
 };
 
 const unsigned char sine_wave_model[] = {
@@ -187,9 +187,49 @@ static int ai_helper_push_data(uint32_t modelCode, void *data, uint16_t len)
 	return ret == AIFW_OK ? 0 : -1;
 }
 
+#ifdef CONFIG_AIFW_PROFILE
+/**
+ * @brief Prints the time and memory used by each operator of the models of a modelSet.
+ * @param [in] modelCode: modelCode for the modelSet.
+ */
+static void ai_helper_print_profile(uint32_t modelCode)
+{
+	int index = findModelSetInfoIndex(modelCode);
+	if (index == -1) {
+		AIFW_LOGE("no model registered with modelcode %d", modelCode);
+		return;
+	}
+	std::shared_ptr<AIInferenceHandler> handler = gModelSetList.get()[index].aiInferenceHandler;
+	AIOperatorProfile operators[CONFIG_AIFW_PROFILE_MAX_OPERATORS];
+	for (uint16_t i = 0; i < handler->getModelCount(); i++) {
+		AIModelProfile profile;
+		if (handler->getProfile(i, &profile, operators, CONFIG_AIFW_PROFILE_MAX_OPERATORS) != AIFW_OK) {
+			continue;
+		}
+		printf("model %d: %u invokes, arena %u bytes, %u ticks per second\n", i, profile.invokes, profile.arenaBytes, profile.ticksPerSecond);
+		if (profile.invokes == 0) {
+			continue;
+		}
+		uint64_t total = 0;
+		uint16_t count = profile.operatorCount < CONFIG_AIFW_PROFILE_MAX_OPERATORS ? profile.operatorCount : CONFIG_AIFW_PROFILE_MAX_OPERATORS;
+		for (uint16_t j = 0; j < count; j++) {
+			total += operators[j].ticks;
+		}
+		printf("%4s %-24s %10s %10s %5s %10s\n", "op", "type", "avg ticks", "max ticks", "%", "memory");
+		for (uint16_t j = 0; j < count; j++) {
+			printf("%4d %-24s %10llu %10u %5llu %10u\n", j, operators[j].name, (unsigned long long)(operators[j].ticks / profile.invokes), operators[j].maxTicks,
+				(unsigned long long)(total ? operators[j].ticks * 100 / total : 0), operators[j].memory);
+		}
+	}
+}
+#endif
+
 static void *stopAndDeinitHelperModule(void *arg)
 {
 	AIFW_LOGV("Started thread");
+#ifdef CONFIG_AIFW_PROFILE
+	ai_helper_print_profile(gSineWaveCode);
+#endif
 	if (ai_helper_stop(gSineWaveCode) != AIFW_OK) {
 		AIFW_LOGE("AI helper stop failed");
 		return NULL;
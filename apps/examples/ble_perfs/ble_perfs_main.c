@@ -48,6 +48,10 @@
 #define NEXT_PACKET 55
 #define LAST_PACKET 99
 #define USLEEP_USEC 100 * 1000
+#define NOTI_PACKET_SIZE (BLE_MAX_MTU - 3)
+#define NOTI_BATCH_MAX 16
+#define NOTI_RETRY_USEC 1000
+#define NOTI_RETRY_MAX 1000
 
 struct perfs_data_t
 {
@@ -55,9 +59,16 @@ struct perfs_data_t
 	int packet_size;
 	struct timeval start_time;
 	struct timeval end_time;
+	/* gaps between two received packets in usec */
+	struct timeval last_time;
+	long gap_min;
+	long gap_max;
+	long long gap_sum;
 };
 
-static struct perfs_data_t g_perf_data = {0, 0, {0, 0}, {0, 0} };
+static struct perfs_data_t g_perf_data = {0, 0, {0, 0}, {0, 0}, {0, 0}, 0, 0, 0};
+static ble_conn_handle g_conn_handle;
+static int g_is_connected = 0;
 
 static wifi_manager_cb_s g_wifi_callbacks = { 0, };
 static int g_is_ble_serv_init = 0;
@@ -141,10 +152,18 @@ static void utc_cb_desc_b_1(ble_server_attr_cb_type_e type, ble_conn_handle conn
 }
 
 
+static long perfs_elapsed_usec(struct timeval *from, struct timeval *to)
+{
+	return (to->tv_sec - from->tv_sec) * 1000000L + (to->tv_usec - from->tv_usec);
+}
+
 static void perfs_ble_reset_data(void)
 {
 	g_perf_data.packet_size = 0;
 	g_perf_data.packet_count = 0;
+	g_perf_data.gap_min = 0;
+	g_perf_data.gap_max = 0;
+	g_perf_data.gap_sum = 0;
 
 	g_perf_data.start_time.tv_sec = 0;
 	g_perf_data.start_time.tv_usec = 0;
@@ -180,6 +199,10 @@ static int perfs_ble_get_result(void)
 	BLE_LOGD( "Total time    : %.2lf ms \n", total_time * 1000);
 	BLE_LOGD( "data received : %ld byte \n", g_perf_data.packet_size * g_perf_data.packet_count);
 	BLE_LOGD( "Bandwidth     : %.2lf Kbps \n", speed / 1024);
+	if (g_perf_data.packet_count > 1) {
+		BLE_LOGD( "Packet gap    : min %ld / avg %lld / max %ld usec \n", g_perf_data.gap_min,
+				  g_perf_data.gap_sum / (g_perf_data.packet_count - 1), g_perf_data.gap_max);
+	}
 	BLE_LOGD( "=================================================\n");
 	
 	return 0;
@@ -206,6 +229,21 @@ static void ble_peri_cb_charact_rmc_sync(ble_server_attr_cb_type_e type, ble_con
 
 	p_data->packet_count ++;
 
+	/* latency seen by the application: time between two packets */
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	if (p_data->packet_count > 1) {
+		long gap = perfs_elapsed_usec(&p_data->last_time, &now);
+		if (p_data->gap_min == 0 || gap < p_data->gap_min) {
+			p_data->gap_min = gap;
+		}
+		if (gap > p_data->gap_max) {
+			p_data->gap_max = gap;
+		}
+		p_data->gap_sum += gap;
+	}
+	p_data->last_time = now;
+
 	if (type == BLE_SERVER_ATTR_CB_WRITING_NO_RSP || type == BLE_SERVER_ATTR_CB_WRITING) {
 		if (blue_data.data[0] == blue_data.data[p_data->packet_size - 1]) {
 			BLE_LOGD( "[WRITE] Success [%d] : %d \n" , blue_data.length, p_data->packet_count);
@@ -271,6 +309,10 @@ static void ble_server_connected_cb(ble_conn_handle con_handle, ble_server_conne
 
 	if (conn_type == BLE_SERVER_DISCONNECTED) {
 		perfs_ble_reset_data();
+		g_is_connected = 0;
+	} else {
+		g_conn_handle = con_handle;
+		g_is_connected = 1;
 	}
 
 	return;
@@ -288,7 +330,105 @@ static void perfs_ble_usage(void)
 		 " ble_perfs start \n" \
 		 " ble_perfs adv \n" \
 		 " ble_perfs stop \n" \
-		 " ble_perfs result \n");
+		 " ble_perfs result \n" \
+		 " ble_perfs tput \n" \
+		 " ble_perfs notify <count> [batch] \n");
+}
+
+/* Tune the connection of the client for bulk transfers */
+static int perfs_ble_throughput_mode(void)
+{
+	ble_result_e ret;
+
+	if (!g_is_connected) {
+		BLE_LOGD( "no client connected \n");
+		return -1;
+	}
+
+	ret = ble_manager_set_throughput_mode(g_conn_handle, BLE_SLAVE_CONN_PARAM_UPDATE);
+	if (ret != BLE_MANAGER_SUCCESS) {
+		BLE_LOGD( "Fail to set throughput mode ret:[%d]\n", ret);
+		return -1;
+	}
+	BLE_LOGD( "Throughput mode ... ok\n");
+
+	return 0;
+}
+
+/* Send count notifications to the client, batch of them per request */
+static int perfs_ble_notify(int count, int batch)
+{
+	static uint8_t buf[NOTI_BATCH_MAX][NOTI_PACKET_SIZE];
+	ble_data data[NOTI_BATCH_MAX];
+	struct timeval start, end, req_start, req_end;
+	long lat, lat_min = 0, lat_max = 0;
+	long long lat_sum = 0;
+	int requests = 0;
+	int stalls = 0;
+	int done = 0;
+	uint16_t sent;
+	ble_result_e ret;
+	double total_time;
+	int i;
+
+	if (!g_is_connected) {
+		BLE_LOGD( "no client connected \n");
+		return -1;
+	}
+	if (count <= 0 || batch <= 0 || batch > NOTI_BATCH_MAX) {
+		BLE_LOGD( "count > 0 and 0 < batch <= %d \n", NOTI_BATCH_MAX);
+		return -1;
+	}
+
+	gettimeofday(&start, NULL);
+	while (done < count) {
+		int n = count - done < batch ? count - done : batch;
+		for (i = 0; i < n; i++) {
+			/* first and last bytes carry the sequence as the client writes do */
+			buf[i][0] = buf[i][NOTI_PACKET_SIZE - 1] = (uint8_t)(done + i);
+			data[i].data = buf[i];
+			data[i].length = NOTI_PACKET_SIZE;
+		}
+
+		sent = 0;
+		gettimeofday(&req_start, NULL);
+		ret = ble_server_charact_notify_multi(BLE_APP_HANDLE_CHAR_RMC_SYNC, g_conn_handle, data, n, &sent);
+		gettimeofday(&req_end, NULL);
+
+		lat = perfs_elapsed_usec(&req_start, &req_end);
+		if (requests == 0 || lat < lat_min) {
+			lat_min = lat;
+		}
+		if (lat > lat_max) {
+			lat_max = lat;
+		}
+		lat_sum += lat;
+		requests++;
+
+		done += sent;
+		if (ret != BLE_MANAGER_SUCCESS) {
+			stalls = sent ? 0 : stalls + 1;
+			if (!g_is_connected || stalls > NOTI_RETRY_MAX) {
+				BLE_LOGD( "stopped after %d notifications ret:[%d]\n", done, ret);
+				return -1;
+			}
+			/* the driver is out of buffers, let the link drain */
+			usleep(NOTI_RETRY_USEC);
+		}
+	}
+	gettimeofday(&end, NULL);
+
+	total_time = (double)perfs_elapsed_usec(&start, &end) / 1000000;
+
+	BLE_LOGD( "=================================================\n");
+	BLE_LOGD( "Notifications : %d x %d byte, %d per request \n", count, NOTI_PACKET_SIZE, batch);
+	BLE_LOGD( "Total time    : %.2lf ms \n", total_time * 1000);
+	BLE_LOGD( "Throughput    : %.2lf Kbps \n", (double)count * NOTI_PACKET_SIZE * 8 / total_time / 1024);
+	BLE_LOGD( "Request time  : min %ld / avg %lld / max %ld usec (%d requests) \n",
+			  lat_min, lat_sum / requests, lat_max, requests);
+	BLE_LOGD( "=================================================\n");
+
+	return 0;
 }
 
 static int perfs_ble_server_init(void)
@@ -419,6 +559,20 @@ static int perfs_ble_parse_arguments(int argc, char **argv)
 			BLE_LOGD( "Fail to get performance result \n");
 			return -1;
 		}
+	} else if (strncmp(argv[1], "tput", 5) == 0) {
+		ret = perfs_ble_throughput_mode();
+		if (ret < 0) {
+			return -1;
+		}
+	} else if (strncmp(argv[1], "notify", 7) == 0) {
+		if (argc < 3) {
+			return -1;
+		}
+		ret = perfs_ble_notify(atoi(argv[2]), argc > 3 ? atoi(argv[3]) : 1);
+		if (ret < 0) {
+			BLE_LOGD( "Fail to send notifications \n");
+			return -1;
+		}
 	} else if (strncmp(argv[1], "stop", 4) == 0 ) {
 		BLE_LOGD( "GATT server deinit \n");	
 		ret = perfs_ble_deinit();
@@ -0,0 +1,240 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * examples/grpc/grpc_perf/grpc_perf.cc
+ *
+ * Latency and throughput of unary calls to a helloworld.Greeter server,
+ * which answers "Hello " and the name of the request.
+ *
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <memory>
+#include <string>
+
+#include <grpc++/grpc++.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "helloworld.grpc.pb.h"
+
+using grpc::Channel;
+using grpc::ClientContext;
+using grpc::Status;
+using helloworld::HelloRequest;
+using helloworld::HelloReply;
+using helloworld::Greeter;
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define GRPC_PERF_PRIORITY     100
+#define GRPC_PERF_STACK_SIZE   16384
+#define GRPC_PERF_SCHED_POLICY SCHED_RR
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define GRPC_PERF_CLOCK        CLOCK_MONOTONIC
+#else
+#define GRPC_PERF_CLOCK        CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct grpc_perf_arg_s {
+	const char *addr;
+	int calls;
+	int result;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Sizes of the names of the requests */
+
+static const size_t g_sizes[] = { 16, 256, 1024, 4096 };
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t grpc_perf_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(GRPC_PERF_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int grpc_perf_size(Greeter::Stub *stub, size_t size, int calls)
+{
+	HelloRequest request;
+	HelloReply reply;
+	uint64_t start;
+	uint64_t elapsed;
+	uint64_t total = 0;
+	uint64_t min = UINT64_MAX;
+	uint64_t max = 0;
+	int errors = 0;
+	int i;
+
+	request.set_name(std::string(size, 'x'));
+
+	for (i = 0; i < calls; i++) {
+		ClientContext context;
+
+		start = grpc_perf_now();
+		Status status = stub->SayHello(&context, request, &reply);
+		elapsed = grpc_perf_now() - start;
+
+		if (!status.ok()) {
+			printf("Call failed, %d: %s\n", status.error_code(), status.error_message().c_str());
+			return -1;
+		}
+
+		if (reply.message().size() != size + 6) {
+			errors++;
+		}
+
+		total += elapsed;
+		min = elapsed < min ? elapsed : min;
+		max = elapsed > max ? elapsed : max;
+	}
+
+	printf("GRPCPERF,unary,%lu,latency_avg,%lu,us\n", (unsigned long)size, (unsigned long)(total / calls));
+	printf("GRPCPERF,unary,%lu,latency_min,%lu,us\n", (unsigned long)size, (unsigned long)min);
+	printf("GRPCPERF,unary,%lu,latency_max,%lu,us\n", (unsigned long)size, (unsigned long)max);
+	printf("GRPCPERF,unary,%lu,calls,%lu,calls/s\n", (unsigned long)size, total ? (unsigned long)((uint64_t)calls * 1000000 / total) : 0);
+	printf("GRPCPERF,unary,%lu,throughput,%lu,KB/s\n", (unsigned long)size, total ? (unsigned long)((uint64_t)calls * (2 * size + 6) * 1000000 / 1024 / total) : 0);
+	printf("GRPCPERF,check,%lu,errors,%d,count\n", (unsigned long)size, errors);
+	return errors;
+}
+
+static void *grpc_perf_run(void *arg)
+{
+	struct grpc_perf_arg_s *perf = (struct grpc_perf_arg_s *)arg;
+	std::shared_ptr<Channel> channel = grpc::CreateChannel(perf->addr, grpc::InsecureChannelCredentials());
+	std::unique_ptr<Greeter::Stub> stub(Greeter::NewStub(channel));
+	HelloRequest request;
+	HelloReply reply;
+	ClientContext context;
+	uint64_t start;
+	size_t i;
+	int ret;
+
+	/* The first call connects, and is timed apart */
+
+	request.set_name("connect");
+	start = grpc_perf_now();
+	Status status = stub->SayHello(&context, request, &reply);
+	if (!status.ok()) {
+		printf("Cannot call %s, %d: %s\n", perf->addr, status.error_code(), status.error_message().c_str());
+		perf->result = -1;
+		return NULL;
+	}
+	printf("GRPCPERF,connect,0,latency,%lu,us\n", (unsigned long)(grpc_perf_now() - start));
+
+	perf->result = 0;
+	for (i = 0; i < sizeof(g_sizes) / sizeof(g_sizes[0]); i++) {
+		ret = grpc_perf_size(stub.get(), g_sizes[i], perf->calls);
+		if (ret < 0) {
+			perf->result = -1;
+			break;
+		}
+		perf->result += ret;
+	}
+
+	return NULL;
+}
+
+static void show_usage(const char *prog)
+{
+	printf("\nUsage: %s [-n CALLS] [IP:PORT]\n", prog);
+	printf("\nOptions:\n");
+	printf(" -n CALLS   Calls for each request size (default %d)\n", CONFIG_EXAMPLES_GRPC_PERF_CALLS);
+	printf(" IP:PORT    helloworld.Greeter server (default %s)\n", CONFIG_EXAMPLES_GRPC_PERF_SERVER);
+	printf("\nResults are printed as lines of comma separated values starting with GRPCPERF.\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+extern "C" {
+int grpc_perf_main(int argc, char *argv[])
+{
+	struct grpc_perf_arg_s perf;
+	struct sched_param sparam;
+	pthread_attr_t attr;
+	pthread_t tid;
+	int opt;
+	int r;
+
+	perf.addr = CONFIG_EXAMPLES_GRPC_PERF_SERVER;
+	perf.calls = CONFIG_EXAMPLES_GRPC_PERF_CALLS;
+
+	while ((opt = getopt(argc, argv, "n:")) != -1) {
+		switch (opt) {
+		case 'n':
+			perf.calls = (int)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			show_usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if (optind < argc) {
+		perf.addr = argv[optind];
+	}
+
+	if (perf.calls < 1) {
+		show_usage(argv[0]);
+		return -1;
+	}
+
+	/* The calls need a larger stack than the shell's */
+
+	pthread_attr_init(&attr);
+	sparam.sched_priority = GRPC_PERF_PRIORITY;
+	pthread_attr_setschedparam(&attr, &sparam);
+	pthread_attr_setschedpolicy(&attr, GRPC_PERF_SCHED_POLICY);
+	pthread_attr_setstacksize(&attr, GRPC_PERF_STACK_SIZE);
+
+	r = pthread_create(&tid, &attr, grpc_perf_run, &perf);
+	if (r != 0) {
+		printf("%s: pthread_create failed, status=%d\n", __func__, r);
+		return -1;
+	}
+
+	pthread_join(tid, NULL);
+
+	printf("\ngRPC performance test done, %d errors.\n", perf.result);
+	return perf.result == 0 ? 0 : -1;
+}
+}
@@ -0,0 +1,71 @@
+#!/bin/bash
+###########################################################################
+#
+# Copyright 2025 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+#
+# File : mkjssnapshot.sh
+#
+# Usage : mkjssnapshot.sh <jerry> <dir>
+#
+# Saves next to each JS module under <dir> the JerryScript snapshot
+# <module>.js.snapshot, which IoT.js executes instead of parsing the
+# source.  The source is wrapped as IoT.js wraps it in process.compile(),
+# so that the snapshot evaluates to the module function.
+#
+# <jerry> is the JerryScript shell of the host, built from the same
+# JerryScript sources and configuration as the target with the snapshot
+# saving enabled (--snapshot-save=on), and with 32 bit compressed pointers
+# for a 32 bit target.
+
+JERRY=$1
+DIR=$2
+
+if [ -z "${JERRY}" ] || [ -z "${DIR}" ]; then
+	echo "Usage: $0 <jerry> <dir>"
+	exit 1
+fi
+
+if [ ! -x "${JERRY}" ]; then
+	echo "Error: ${JERRY} is not an executable JerryScript shell"
+	exit 1
+fi
+
+if [ ! -d "${DIR}" ]; then
+	exit 0
+fi
+
+TMPFILE=`mktemp`
+trap "rm -f ${TMPFILE}" EXIT
+
+for JSFILE in `find "${DIR}" -name "*.js"`; do
+	SNAPSHOT="${JSFILE}.snapshot"
+	if [ "${SNAPSHOT}" -nt "${JSFILE}" ]; then
+		continue
+	fi
+
+	printf "(function(exports, require, module) {" > ${TMPFILE}
+	cat "${JSFILE}" >> ${TMPFILE}
+	printf "\n});\n" >> ${TMPFILE}
+
+	echo "SNAPSHOT: ${JSFILE}"
+	${JERRY} --save-snapshot-for-eval "${SNAPSHOT}" ${TMPFILE} > /dev/null
+	if [ $? -ne 0 ] || [ ! -s "${SNAPSHOT}" ]; then
+		echo "Error: no snapshot of ${JSFILE}"
+		rm -f "${SNAPSHOT}"
+		exit 1
+	fi
+done
@@ -81,6 +81,14 @@ method_t method = 1;			/* the method we are using in our requests */
 
 coap_block_t block = {.num = 0, .m = 0, .szx = 6 };
 
+static unsigned int block_window = 1;	/* Block2 requests in flight (-W) */
+static coap_block_window_t block2_window;
+
+#define BLOCK2_IDLE    0
+#define BLOCK2_RUNNING 1
+#define BLOCK2_DONE    2
+static int block2_state = BLOCK2_IDLE;
+
 unsigned int wait_seconds = 10;	/* default timeout in seconds */
 coap_tick_t max_wait;			/* global timeout (changed by set_timeout()) */
 
@@ -384,13 +392,141 @@ int check_token_by_value(unsigned char *token, size_t len)
 	return 0;
 }
 
+/* Sends the request for block num of the resource */
+static coap_tid_t request_block(coap_context_t *ctx, const coap_address_t *remote, unsigned short blktype, unsigned int num, unsigned char szx, int confirmable, coap_transport_t transport)
+{
+	coap_pdu_t *pdu;
+	coap_list_t *option;
+	unsigned char buf[4];
+	coap_tid_t tid = COAP_INVALID_TID;
+
+	pdu = coap_new_request(ctx, method, NULL);	/* first, create bare PDU w/o any option  */
+	if (!pdu) {
+		return COAP_INVALID_TID;
+	}
+
+	/* add URI components from optlist */
+	for (option = optlist; option; option = option->next) {
+		switch (COAP_OPTION_KEY(*(coap_option *) option->data)) {
+		case COAP_OPTION_URI_HOST:
+		case COAP_OPTION_URI_PORT:
+		case COAP_OPTION_URI_PATH:
+		case COAP_OPTION_URI_QUERY:
+			coap_add_option2(pdu, COAP_OPTION_KEY(*(coap_option *) option->data),
+					COAP_OPTION_LENGTH(*(coap_option *) option->data),
+					COAP_OPTION_DATA(*(coap_option *) option->data), transport);
+			break;
+		default:
+			break;	/* skip other options */
+		}
+	}
+
+	/* finally add the block option, M bit cleared */
+	coap_add_option2(pdu, blktype, coap_encode_var_bytes(buf, (num << 4) | szx), buf, transport);
+
+	switch (ctx->protocol) {
+	case COAP_PROTO_UDP:
+	case COAP_PROTO_DTLS:
+		if (confirmable) {
+			tid = coap_send_confirmed(ctx, remote, pdu);
+		} else {
+			tid = coap_send(ctx, remote, pdu);
+		}
+
+		if (tid == COAP_INVALID_TID) {
+			debug("message_handler: error sending new request");
+			coap_delete_pdu(pdu);
+		} else {
+			set_timeout(&max_wait, wait_seconds);
+			if (!confirmable) {
+				coap_delete_pdu(pdu);
+			}
+		}
+		break;
+	case COAP_PROTO_TCP:
+	case COAP_PROTO_TLS:
+		tid = coap_send(ctx, remote, pdu);
+		set_timeout(&max_wait, wait_seconds);
+		coap_delete_pdu(pdu);
+		break;
+	default: /* should not be entered here */
+		coap_delete_pdu(pdu);
+		break;
+	}
+
+	return tid;
+}
+
+static void output_block(void *arg, unsigned int num, const unsigned char *data, size_t length)
+{
+	append_to_output(data, length);
+}
+
+/* Pipelined Block2 transfer: returns 0 while blocks are missing */
+static int receive_block_window(coap_context_t *ctx, const coap_address_t *remote, coap_opt_t *block_opt, coap_pdu_t *received, coap_transport_t transport)
+{
+	coap_block_t blk;
+	size_t len = 0;
+	unsigned char *databuf = NULL;
+	unsigned int num;
+	int res;
+
+	if (block2_state != BLOCK2_RUNNING) {
+		coap_block_window_init(&block2_window, COAP_OPT_BLOCK_SZX(block_opt), block_window);
+		block2_state = BLOCK2_RUNNING;
+	}
+
+	blk.num = coap_opt_block_num(block_opt);
+	blk.m = COAP_OPT_BLOCK_MORE(block_opt) ? 1 : 0;
+	blk.szx = COAP_OPT_BLOCK_SZX(block_opt);
+	coap_get_data(received, &len, &databuf);
+
+	res = coap_block_window_recv(&block2_window, &blk, databuf, len, output_block, NULL);
+	if (res == 0) {
+		while (coap_block_window_next(&block2_window, &num)) {
+			debug("query block %u\n", num);
+			if (request_block(ctx, remote, COAP_OPTION_BLOCK2, num, block2_window.szx, msgtype == COAP_MESSAGE_CON, transport) == COAP_INVALID_TID) {
+				break;
+			}
+		}
+		return 0;
+	}
+
+	if (res < 0) {
+		warn("receive_block_window : transfer of block %u failed\n", blk.num);
+	}
+
+	coap_block_window_free(&block2_window);
+	block2_state = BLOCK2_DONE;
+	return 1;
+}
+
+/* An error to a request past the end of a pipelined Block2 transfer:
+ * returns 0 while blocks are missing, 1 when it ends the transfer, or -1
+ * for the other errors */
+static int end_block_window(coap_pdu_t *sent)
+{
+	coap_block_t blk;
+	int res;
+
+	if (block2_state == BLOCK2_IDLE || !sent || !coap_get_block(sent, COAP_OPTION_BLOCK2, &blk)) {
+		return -1;
+	}
+
+	res = coap_block_window_end(&block2_window, blk.num);
+	if (res > 0 && block2_state == BLOCK2_RUNNING) {
+		coap_block_window_free(&block2_window);
+		block2_state = BLOCK2_DONE;
+	}
+
+	return res;
+}
+
 void message_handler(struct coap_context_t *ctx, const coap_address_t *remote, coap_pdu_t *sent, coap_pdu_t *received, const coap_tid_t id)
 {
 	coap_pdu_t *pdu = NULL;
 	coap_opt_t *block_opt;
 	coap_opt_iterator_t opt_iter;
-	unsigned char buf[4];
-	coap_list_t *option;
 	size_t len;
 	unsigned char *databuf;
 	coap_tid_t tid;
@@ -479,67 +615,27 @@ void message_handler(struct coap_context_t *ctx, const coap_address_t *remote, c
 		} else {
 			unsigned short blktype = opt_iter.type;
 
-			/* TODO: check if we are looking at the correct block number */
-			if (coap_get_data(received, &len, &databuf)) {
-				append_to_output(databuf, len);
+			if (block_window > 1 && blktype == COAP_OPTION_BLOCK2 && transport == COAP_UDP
+				&& (block2_state == BLOCK2_RUNNING || coap_opt_block_num(block_opt) == 0)) {
+				if (receive_block_window(ctx, remote, block_opt, received, transport) == 0) {
+					return;
+				}
+			} else {
+				/* TODO: check if we are looking at the correct block number */
+				if (coap_get_data(received, &len, &databuf)) {
+					append_to_output(databuf, len);
+				}
 			}
 
-			if (COAP_OPT_BLOCK_MORE(block_opt)) {
+			if (block2_state == BLOCK2_IDLE && COAP_OPT_BLOCK_MORE(block_opt)) {
 				/* more bit is set */
 				debug("found the M bit, block size is %u, block nr. %u\n", COAP_OPT_BLOCK_SZX(block_opt), coap_opt_block_num(block_opt));
 
 				/* create pdu with request for next block */
-				pdu = coap_new_request(ctx, method, NULL);	/* first, create bare PDU w/o any option  */
-				if (pdu) {
-					/* add URI components from optlist */
-					for (option = optlist; option; option = option->next) {
-						switch (COAP_OPTION_KEY(*(coap_option *) option->data)) {
-						case COAP_OPTION_URI_HOST:
-						case COAP_OPTION_URI_PORT:
-						case COAP_OPTION_URI_PATH:
-						case COAP_OPTION_URI_QUERY:
-							coap_add_option2(pdu, COAP_OPTION_KEY(*(coap_option *) option->data),
-									COAP_OPTION_LENGTH(*(coap_option *) option->data),
-									COAP_OPTION_DATA(*(coap_option *) option->data), transport);
-							break;
-						default:
-							break;	/* skip other options */
-						}
-					}
-
-					/* finally add updated block option from response, clear M bit */
-					/* blocknr = (blocknr & 0xfffffff7) + 0x10; */
-					debug("query block %d\n", (coap_opt_block_num(block_opt) + 1));
-					coap_add_option2(pdu, blktype, coap_encode_var_bytes(buf, ((coap_opt_block_num(block_opt) + 1) << 4) | COAP_OPT_BLOCK_SZX(block_opt)), buf, transport);
-
-					switch (ctx->protocol) {
-					case COAP_PROTO_UDP:
-					case COAP_PROTO_DTLS:
-						if (received->hdr->type == COAP_MESSAGE_CON) {
-							tid = coap_send_confirmed(ctx, remote, pdu);
-						} else {
-							tid = coap_send(ctx, remote, pdu);
-						}
-
-						if (tid == COAP_INVALID_TID) {
-							debug("message_handler: error sending new request");
-							coap_delete_pdu(pdu);
-						} else {
-							set_timeout(&max_wait, wait_seconds);
-							if (received->hdr->type != COAP_MESSAGE_CON) {
-								coap_delete_pdu(pdu);
-							}
-						}
-						break;
-					case COAP_PROTO_TCP:
-					case COAP_PROTO_TLS:
-						tid = coap_send(ctx, remote, pdu);
-						set_timeout(&max_wait, wait_seconds);
-						coap_delete_pdu(pdu);
-						break;
-					default: /* should not be entered here */
-						break;
-					}
+				debug("query block %d\n", (coap_opt_block_num(block_opt) + 1));
+				tid = request_block(ctx, remote, blktype, coap_opt_block_num(block_opt) + 1, COAP_OPT_BLOCK_SZX(block_opt),
+						received->hdr->type == COAP_MESSAGE_CON, transport);
+				if (tid != COAP_INVALID_TID) {
 					return;
 				}
 			}
@@ -547,6 +643,16 @@ void message_handler(struct coap_context_t *ctx, const coap_address_t *remote, c
 	} else {					/* no 2.05 */
 
 		debug("message_handler : response class %d\n", COAP_RESPONSE_CLASS(code));
+		switch (transport == COAP_UDP ? end_block_window(sent) : -1) {
+		case 0:
+			return;
+		case 1:
+			code = 0;		/* not an error, the resource has no more blocks */
+			break;
+		default:
+			break;
+		}
+
 		/* check if an error was signaled and output payload if so */
 		if (COAP_RESPONSE_CLASS(code) >= 4) {
 			fprintf(stderr, "%d.%02d", (code >> 5), code & 0x1F);
@@ -588,7 +694,7 @@ void usage(const char *program, const char *version)
 			"(c) 2010-2013 Olaf Bergmann <bergmann@tzi.org>\n\n"
 #if defined(__TINYARA__)
 			"usage: %s [-A type...] [-t type] [-B seconds] [-e text]\n"
-			"\t\t[-m method] [-N] [-p port] [-T string] [-v num] URI\n\n"
+			"\t\t[-m method] [-N] [-p port] [-T string] [-v num] [-W num] URI\n\n"
 			"\tURI can be an absolute or relative coap URI,\n"
 			"\t-A type...\taccepted media types as comma-separated list of\n" "\t\t\tsymbolic or numeric values\n"
 			"\t-B seconds\tbreak operation after waiting given seconds\n" "\t\t\t(default is %d)\n"
@@ -597,7 +703,8 @@ void usage(const char *program, const char *version)
 			"\t-N\t\tsend NON-confirmable message\n"
 			"\t-p port\t\tlisten on specified port\n" "\t-s duration\tsubscribe for given duration [s]\n"
 			"\t-v num\t\tverbosity level (default: 3)\n"
-			"\t-T token\tinclude specified token\n" "\n"
+			"\t-T token\tinclude specified token\n"
+			"\t-W num\t\tnumber of Block2 requests in flight (default: 1)\n" "\n"
 #ifdef WITH_MBEDTLS
 			"\t-I identity\tPre-Shared Key identity used to security session\n"
 			"\t-S pre-shared key\tPre-Shared Key. Input length MUST be even (e.g, 11, 1111.)\n"
@@ -605,7 +712,7 @@ void usage(const char *program, const char *version)
 #else
 			"usage: %s [-A type...] [-t type] [-b [num,]size] [-B seconds] [-e text]\n"
 			"\t\t[-g group] [-m method] [-N] [-o file] [-P addr[:port]] [-p port]\n"
-			"\t\t[-s duration] [-O num,text] [-T string] [-v num] URI\n\n"
+			"\t\t[-s duration] [-O num,text] [-T string] [-v num] [-W num] URI\n\n"
 			"\tURI can be an absolute or relative coap URI,\n"
 			"\t-A type...\taccepted media types as comma-separated list of\n" "\t\t\tsymbolic or numeric values\n"
 			"\t-t type\t\tcontent type for given resource for PUT/POST\n"
@@ -623,7 +730,8 @@ void usage(const char *program, const char *version)
 			"\t-O num,text\tadd option num with contents text to request\n"
 			"\t-P addr[:port]\tuse proxy (automatically adds Proxy-Uri option to\n"
 			"\t\t\trequest)\n"
-			"\t-T token\tinclude specified token\n" "\n"
+			"\t-T token\tinclude specified token\n"
+			"\t-W num\t\tnumber of Block2 requests in flight (default: 1)\n" "\n"
 #endif
 			"examples:\n" "\tlibcoap-client -m get coap://[::1]/\n"
 			"\tlibcoap-client -m get coap://[::1]/.well-known/core\n"
@@ -1097,7 +1205,7 @@ int main(int argc, char **argv)
 	tls_option.force_ciphersuites[1] = 0;
 #endif
 
-	while ((opt = getopt(argc, argv, "Nb:e:f:g:m:p:s:t:o:v:A:B:O:P:T:I:S:")) != -1) {
+	while ((opt = getopt(argc, argv, "Nb:e:f:g:m:p:s:t:o:v:A:B:O:P:T:I:S:W:")) != -1) {
 		switch (opt) {
 		case 'b':
 			cmdline_blocksize(optarg);
@@ -1105,6 +1213,9 @@ int main(int argc, char **argv)
 		case 'B':
 			wait_seconds = atoi(optarg);
 			break;
+		case 'W':
+			block_window = atoi(optarg);
+			break;
 		case 'e':
 			if (!cmdline_input(optarg, &payload)) {
 				payload.length = 0;
@@ -1461,6 +1572,10 @@ error_exit:
 	optlist = NULL;
 	ready = 0;
 
+	coap_block_window_free(&block2_window);
+	block2_state = BLOCK2_IDLE;
+	block_window = 1;
+
 	printf("coap-client : good bye\n");
 
 	return 0;
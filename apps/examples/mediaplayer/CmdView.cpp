@@ -88,7 +88,8 @@ int CmdView::selectCommand(void)
 	cout << " 5. GET_MAX_VOLUME  " << endl;
 	cout << " 6. VOLUME_UP       " << endl;
 	cout << " 7. VOLUME_DOWN     " << endl;
+	cout << " 8. GET_PROFILE     " << endl;
 	cout << "====================" << endl;
-	return getUserInput(0, 7);
+	return getUserInput(0, 8);
 }
 }
@@ -63,7 +63,8 @@ enum test_command_e {
 	PLAYER_STOP,
 	GET_MAX_VOLUME,
 	VOLUME_UP,
-	VOLUME_DOWN
+	VOLUME_DOWN,
+	GET_PROFILE
 };
 
 class MyMediaPlayer : public MediaPlayerObserverInterface,
@@ -230,6 +231,20 @@ void MyMediaPlayer::doCommand(int command)
 			cout << "Now, Volume is " << (int)volume << endl;
 		}
 		break;
+	case GET_PROFILE: {
+		media_profile_t profile;
+		cout << "GET_PROFILE is selected" << endl;
+		if (mp.getProfile(&profile) != PLAYER_OK) {
+			cout << "MediaPlayer::getProfile failed" << endl;
+			break;
+		}
+		cout << "decoder : " << profile.codecCalls << " calls, " << profile.codecTime << " us, longest " << profile.codecMaxTime << " us" << endl;
+		cout << "source  : " << profile.sourceTime << " us, longest " << profile.sourceMaxTime << " us" << endl;
+		cout << "device  : " << profile.deviceTime << " us, longest " << profile.deviceMaxTime << " us, resampling " << profile.resampleTime << " us" << endl;
+		cout << "buffer  : " << profile.bufferLevel << " bytes, fewest " << profile.bufferMinLevel << " bytes" << endl;
+		cout << "xruns   : buffer " << profile.bufferXruns << ", device " << profile.deviceXruns << endl;
+		break;
+	}
 	default:
 		break;
 	}
@@ -0,0 +1,148 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <messaging/messaging.h>
+#include "messaging_sample_internal.h"
+
+#define BENCH_PORT "bench_port"
+#define BENCH_MSG_SIZE 64
+
+#define MSG_PRIO 10
+#define TASK_PRIO 100
+#define STACKSIZE 2048
+
+extern int fail_cnt;
+static volatile bool bench_done;
+
+/* The receiver replies from the callback of a non-block receive, so its
+ * queue stays between the round trips.
+ */
+static void bench_recv_callback(msg_reply_type_t msg_type, msg_recv_buf_t *recv_data, void *cb_data)
+{
+	msg_send_data_t reply_data;
+
+	if (msg_type != MSG_REPLY_REQUIRED) {
+		return;
+	}
+
+	reply_data.msg = recv_data->buf;
+	reply_data.msglen = BENCH_MSG_SIZE;
+	reply_data.priority = MSG_PRIO;
+	if (messaging_reply(BENCH_PORT, recv_data->sender_pid, &reply_data) != OK) {
+		printf("Fail to reply in the benchmark.\n");
+	}
+}
+
+static int bench_recv(int argc, FAR char *argv[])
+{
+	char buf[BENCH_MSG_SIZE];
+	msg_recv_buf_t recv_data;
+	msg_callback_info_t cb_info;
+
+	recv_data.buf = buf;
+	recv_data.buflen = BENCH_MSG_SIZE;
+	cb_info.cb_func = bench_recv_callback;
+	cb_info.cb_data = NULL;
+
+	if (messaging_recv_nonblock(BENCH_PORT, &recv_data, &cb_info) != OK) {
+		printf("Fail to receive in the benchmark.\n");
+		return ERROR;
+	}
+
+	while (!bench_done) {
+		usleep(100000);
+	}
+
+	messaging_cleanup(BENCH_PORT);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: sync_messaging_benchmark
+ *
+ * Description:
+ *   Time 'count' round trips of messaging_send_sync() and messaging_reply()
+ *   with messages of BENCH_MSG_SIZE bytes. Build with and without
+ *   CONFIG_MESSAGING_SYNC_DIRECT to compare the two paths.
+ ****************************************************************************/
+void sync_messaging_benchmark(int count)
+{
+	int idx;
+	int ret;
+	int receiver_pid;
+	char msg[BENCH_MSG_SIZE];
+	char reply[BENCH_MSG_SIZE];
+	msg_send_data_t send_data;
+	msg_recv_buf_t reply_data;
+	struct timespec stime;
+	struct timespec etime;
+	long long usec;
+
+#ifdef CONFIG_MESSAGING_SYNC_DIRECT
+	printf("\n--- Sync messaging benchmark : direct handoff, %d round trips. ---\n", count);
+#else
+	printf("\n--- Sync messaging benchmark : reply queue, %d round trips. ---\n", count);
+#endif
+
+	bench_done = false;
+	receiver_pid = task_create("bench_recv", TASK_PRIO, STACKSIZE, bench_recv, NULL);
+	if (receiver_pid < 0) {
+		fail_cnt++;
+		printf("Fail to create bench_recv task.\n");
+		return;
+	}
+
+	/* Wait for the receiver to register the port. */
+	sleep(1);
+
+	memset(msg, 'm', BENCH_MSG_SIZE);
+	send_data.msg = msg;
+	send_data.msglen = BENCH_MSG_SIZE;
+	send_data.priority = MSG_PRIO;
+	reply_data.buf = reply;
+	reply_data.buflen = BENCH_MSG_SIZE;
+
+	clock_gettime(CLOCK_REALTIME, &stime);
+	for (idx = 0; idx < count; idx++) {
+		ret = messaging_send_sync(BENCH_PORT, &send_data, &reply_data);
+		if (ret != OK) {
+			fail_cnt++;
+			printf("Fail to sync send at %d-th round trip.\n", idx);
+			break;
+		}
+	}
+	clock_gettime(CLOCK_REALTIME, &etime);
+
+	bench_done = true;
+	messaging_cleanup(BENCH_PORT);
+
+	if (idx > 0) {
+		usec = (long long)(etime.tv_sec - stime.tv_sec) * 1000000 + (etime.tv_nsec - stime.tv_nsec) / 1000;
+		printf("- %d round trips in %lld usec, %lld usec each.\n", idx, usec, usec / idx);
+	}
+}
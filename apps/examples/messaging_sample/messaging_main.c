@@ -138,8 +138,21 @@ int messaging_main(int argc, char *argv[])
 		goto usage;
 	}
 
-	while ((option = getopt(argc, argv, "r:n:")) != ERROR) {
+	while ((option = getopt(argc, argv, "r:n:b:")) != ERROR) {
 		switch (option) {
+		case 'b':
+			repetition_num = atoi(optarg);
+			if (repetition_num <= 0) {
+				goto usage;
+			}
+			if (is_running) {
+				goto already_running;
+			}
+			is_running = true;
+			fail_cnt = 0;
+			sync_messaging_benchmark(repetition_num);
+			is_running = false;
+			return 0;
 		case 'r':
 			execution_type = EXEC_INFINITE;
 			cmd_arg = optarg;
@@ -196,6 +209,7 @@ usage:
 	printf(" -r start : Execute messaging sample infinitely until stop cmd.\n");
 	printf("    stop  : Stop the messaging sample infinite execution.\n");
 	printf(" -n COUNT : Execute messaging sample COUNT-iterations.\n");
+	printf(" -b COUNT : Time COUNT round trips of sync messages.\n");
 	return -1;
 already_running:
 	printf("There is already running Messaging Sample.\n");
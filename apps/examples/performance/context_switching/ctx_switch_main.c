@@ -22,12 +22,21 @@
 
 #include <tinyara/config.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <sched.h>
 #include <time.h>
 #include <sys/types.h>
 
 #define SWITCHING_ITERATIONS 1000000
 
+/* Every extra task is one more ready task of the same priority, which the
+ * scheduler has to pass when it requeues the yielding task.
+ */
+
+#define SWITCHING_MAX_TASKS 64
+
+static int g_ntasks = 2;
+
 static int yield_task_1(int a, char *b[])
 {
 	int cnt = SWITCHING_ITERATIONS;
@@ -45,7 +54,7 @@ static int yield_task_1(int a, char *b[])
 
 	diff_time = ((double)end.tv_sec + 1.0e-9 * end.tv_nsec) - ((double)start.tv_sec + 1.0e-9 * start.tv_nsec);
 
-	printf("%d-th Average Context Switching Time is %.10f seconds\n", SWITCHING_ITERATIONS, (double)diff_time / (2 * SWITCHING_ITERATIONS));
+	printf("%d-th Average Context Switching Time with %d tasks is %.10f seconds\n", SWITCHING_ITERATIONS, g_ntasks, (double)diff_time / ((double)g_ntasks * SWITCHING_ITERATIONS));
 
 	return 0;
 }
@@ -67,13 +76,30 @@ int main(int argc, FAR char *argv[])
 int ctx_switch_main(int argc, char *argv[])
 #endif
 {
+	int i;
+
+	if (argc > 1) {
+		g_ntasks = atoi(argv[1]);
+		if (g_ntasks < 2 || g_ntasks > SWITCHING_MAX_TASKS) {
+			printf("Usage: %s [number of tasks, 2 - %d]\n", argv[0], SWITCHING_MAX_TASKS);
+			return -1;
+		}
+	}
+
 	printf("Context Switching Performance Measurement\n");
+#ifdef CONFIG_SCHED_READYTORUN_INDEX
+	printf("Ready-to-run list : indexed by priority\n");
+#else
+	printf("Ready-to-run list : sorted list\n");
+#endif
 
-	/* Do not context switching until making two tasks */
+	/* Do not context switching until making all tasks */
 	sched_lock();
 
 	task_create("A_Task", SCHED_PRIORITY_MAX, 1024, yield_task_1, NULL);
-	task_create("B_Task", SCHED_PRIORITY_MAX, 1024, yield_task_2, NULL);
+	for (i = 1; i < g_ntasks; i++) {
+		task_create("B_Task", SCHED_PRIORITY_MAX, 1024, yield_task_2, NULL);
+	}
 
 	sched_unlock();
 
@@ -0,0 +1,126 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_EXAMPLES_PERFORMANCE_FS_FS_PERF_H
+#define __APPS_EXAMPLES_PERFORMANCE_FS_FS_PERF_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_FS_PERFORMANCE_DIR
+#define CONFIG_EXAMPLES_FS_PERFORMANCE_DIR "/mnt"
+#endif
+
+#ifndef CONFIG_EXAMPLES_FS_PERFORMANCE_FILESIZE
+#define CONFIG_EXAMPLES_FS_PERFORMANCE_FILESIZE 65536
+#endif
+
+#ifndef CONFIG_EXAMPLES_FS_PERFORMANCE_NOPS
+#define CONFIG_EXAMPLES_FS_PERFORMANCE_NOPS 100
+#endif
+
+#define FS_PERF_MAX_TARGETS    4
+#define FS_PERF_MAX_BSIZES     8
+#define FS_PERF_PATHLEN        64
+
+/* Name of the data file created in each directory under test */
+
+#define FS_PERF_DATAFILE       "fsperf.dat"
+
+/* Latency histograms have one bucket per power of two: bucket n holds the
+ * samples in [2^(n-1), 2^n - 1] microseconds, bucket 0 holds zero.
+ */
+
+#define FS_PERF_HIST_NBUCKETS  32
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct fs_perf_hist_s {
+	uint32_t bucket[FS_PERF_HIST_NBUCKETS];
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+};
+
+/* A mounted directory or a block device under test */
+
+struct fs_perf_target_s {
+	const char *path;
+	char name[24];				/* Label of the results, e.g. "smartfs" */
+	bool blockdev;				/* Accessed as a raw block device */
+	bool readonly;				/* Only the read tests are run */
+};
+
+struct fs_perf_config_s {
+	struct fs_perf_target_s targets[FS_PERF_MAX_TARGETS];
+	int ntargets;
+	size_t bsizes[FS_PERF_MAX_BSIZES];
+	int nbsizes;
+	size_t filesize;			/* Bytes written and read by the throughput runs */
+	uint32_t nops;				/* Operations of the random, metadata and fsync runs */
+	uint32_t seed;				/* Seed of the random offsets */
+	const char *readfile;		/* Existing file read on read-only targets */
+	const char *mounttype;		/* File system type of the mount run */
+	const char *mountsrc;		/* Source of the mount run, NULL if none */
+	const char *mountpoint;		/* Mount point of the mount run */
+	uint8_t *buffer;			/* I/O buffer of the largest block size */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/* fs_perf_common.c */
+
+uint64_t fs_perf_now(void);
+uint32_t fs_perf_elapsed(uint64_t start);
+uint32_t fs_perf_rand(uint32_t *state);
+uint32_t fs_perf_kbps(uint64_t bytes, uint32_t usec);
+uint32_t fs_perf_rate(uint32_t nops, uint32_t usec);
+
+void fs_perf_hist_init(struct fs_perf_hist_s *hist);
+void fs_perf_hist_add(struct fs_perf_hist_s *hist, uint32_t value);
+
+void fs_perf_print_header(const struct fs_perf_config_s *config);
+void fs_perf_result(const struct fs_perf_target_s *target, const char *test, size_t bsize, const char *metric, uint32_t value, const char *unit);
+void fs_perf_result_hist(const struct fs_perf_target_s *target, const char *test, size_t bsize, const struct fs_perf_hist_s *hist);
+int fs_perf_target_init(struct fs_perf_target_s *target, const char *path);
+void fs_perf_target_file(const struct fs_perf_target_s *target, char *path, const char *name);
+
+/* Benchmarks */
+
+int fs_perf_seq(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target, size_t bsize);
+int fs_perf_rand_io(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target, size_t bsize);
+int fs_perf_meta(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target);
+int fs_perf_fsync(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target, size_t bsize);
+int fs_perf_mount(const struct fs_perf_config_s *config);
+
+#endif							/* __APPS_EXAMPLES_PERFORMANCE_FS_FS_PERF_H */
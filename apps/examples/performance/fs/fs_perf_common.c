@@ -0,0 +1,322 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file fs_perf_common.c
+
+/// @brief Timer, histograms and result output shared by the file system benchmarks.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sys/stat.h>
+#include <sys/statfs.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "fs_perf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define FS_PERF_CLOCK CLOCK_MONOTONIC
+#else
+#define FS_PERF_CLOCK CLOCK_REALTIME
+#endif
+
+#ifdef CONFIG_ARCH_BOARD
+#define FS_PERF_BOARD CONFIG_ARCH_BOARD
+#else
+#define FS_PERF_BOARD "unknown"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct fs_perf_fstype_s {
+	uint32_t magic;
+	const char *name;
+	bool readonly;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct fs_perf_fstype_s g_fstypes[] = {
+	{ SMARTFS_MAGIC, "smartfs", false },
+	{ TMPFS_MAGIC, "tmpfs", false },
+	{ ROMFS_MAGIC, "romfs", true },
+	{ PROCFS_MAGIC, "procfs", true },
+};
+
+#define NFSTYPES (int)(sizeof(g_fstypes) / sizeof(g_fstypes[0]))
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Return the upper bound of the bucket holding the given percentile */
+
+static uint32_t fs_perf_hist_percentile(const struct fs_perf_hist_s *hist, int percent)
+{
+	uint32_t target = (uint32_t)(((uint64_t)hist->count * percent + 99) / 100);
+	uint32_t seen = 0;
+	int ndx;
+
+	for (ndx = 0; ndx < FS_PERF_HIST_NBUCKETS; ndx++) {
+		seen += hist->bucket[ndx];
+		if (seen >= target) {
+			break;
+		}
+	}
+
+	if (ndx == 0) {
+		return 0;
+	}
+
+	return ndx >= 32 ? UINT32_MAX : (uint32_t)((1ull << ndx) - 1);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fs_perf_now
+ *
+ * Description:
+ *   Return the current time in microseconds.
+ *
+ ****************************************************************************/
+
+uint64_t fs_perf_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(FS_PERF_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: fs_perf_elapsed
+ *
+ * Description:
+ *   Return the microseconds elapsed since 'start', at least one so that
+ *   rates can always be computed.
+ *
+ ****************************************************************************/
+
+uint32_t fs_perf_elapsed(uint64_t start)
+{
+	uint64_t elapsed = fs_perf_now() - start;
+
+	if (elapsed == 0) {
+		return 1;
+	}
+
+	return elapsed > UINT32_MAX ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+/****************************************************************************
+ * Name: fs_perf_rand
+ *
+ * Description:
+ *   xorshift32.  The benchmarks keep their own state, so that the random
+ *   offsets of a run are reproduced exactly from its seed.
+ *
+ ****************************************************************************/
+
+uint32_t fs_perf_rand(uint32_t *state)
+{
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+uint32_t fs_perf_kbps(uint64_t bytes, uint32_t usec)
+{
+	return (uint32_t)(bytes * 1000000 / 1024 / usec);
+}
+
+uint32_t fs_perf_rate(uint32_t nops, uint32_t usec)
+{
+	return (uint32_t)((uint64_t)nops * 1000000 / usec);
+}
+
+void fs_perf_hist_init(struct fs_perf_hist_s *hist)
+{
+	memset(hist, 0, sizeof(struct fs_perf_hist_s));
+	hist->min = UINT32_MAX;
+}
+
+void fs_perf_hist_add(struct fs_perf_hist_s *hist, uint32_t value)
+{
+	int ndx = value ? 32 - __builtin_clz(value) : 0;
+
+	if (ndx >= FS_PERF_HIST_NBUCKETS) {
+		ndx = FS_PERF_HIST_NBUCKETS - 1;
+	}
+
+	hist->bucket[ndx]++;
+	hist->count++;
+	hist->sum += value;
+	if (value < hist->min) {
+		hist->min = value;
+	}
+	if (value > hist->max) {
+		hist->max = value;
+	}
+}
+
+/****************************************************************************
+ * Name: fs_perf_print_header
+ *
+ * Description:
+ *   Print the parameters of the run and the columns of the result lines.
+ *   Every result is one comma separated line starting with "FSPERF,", so
+ *   that the results can be extracted from a console log with grep and
+ *   compared between builds and boards.
+ *
+ ****************************************************************************/
+
+void fs_perf_print_header(const struct fs_perf_config_s *config)
+{
+	printf("FSPERF-INFO,board=%s,filesize=%lu,nops=%lu,seed=0x%lx,options=", FS_PERF_BOARD, (unsigned long)config->filesize, (unsigned long)config->nops, (unsigned long)config->seed);
+#ifdef CONFIG_FS_BCACHE
+	printf("FS_BCACHE ");
+#endif
+#ifdef CONFIG_SMARTFS_READAHEAD
+	printf("SMARTFS_READAHEAD ");
+#endif
+#ifdef CONFIG_MTD_SMART_ENABLE_CRC
+	printf("SMART_CRC ");
+#endif
+#ifdef CONFIG_MTD_SMART_MINIMIZE_RAM
+	printf("SMART_MINIMIZE_RAM ");
+#endif
+#ifdef CONFIG_FS_TMPFS
+	printf("TMPFS_CHUNKSIZE(%d) ", CONFIG_FS_TMPFS_CHUNKSIZE);
+#endif
+	printf("\n");
+	printf("FSPERF,target,test,bsize,metric,value,unit\n");
+}
+
+void fs_perf_result(const struct fs_perf_target_s *target, const char *test, size_t bsize, const char *metric, uint32_t value, const char *unit)
+{
+	printf("FSPERF,%s,%s,%lu,%s,%lu,%s\n", target->name, test, (unsigned long)bsize, metric, (unsigned long)value, unit);
+}
+
+/* A latency histogram is reported as its summary followed by one line per
+ * non-empty bucket, named after the upper bound of the bucket.
+ */
+
+void fs_perf_result_hist(const struct fs_perf_target_s *target, const char *test, size_t bsize, const struct fs_perf_hist_s *hist)
+{
+	char metric[16];
+	int ndx;
+
+	fs_perf_result(target, test, bsize, "samples", hist->count, "count");
+	if (hist->count == 0) {
+		return;
+	}
+
+	fs_perf_result(target, test, bsize, "min", hist->min, "us");
+	fs_perf_result(target, test, bsize, "avg", (uint32_t)(hist->sum / hist->count), "us");
+	fs_perf_result(target, test, bsize, "max", hist->max, "us");
+	fs_perf_result(target, test, bsize, "p50", fs_perf_hist_percentile(hist, 50), "us");
+	fs_perf_result(target, test, bsize, "p90", fs_perf_hist_percentile(hist, 90), "us");
+	fs_perf_result(target, test, bsize, "p99", fs_perf_hist_percentile(hist, 99), "us");
+
+	for (ndx = 0; ndx < FS_PERF_HIST_NBUCKETS; ndx++) {
+		if (hist->bucket[ndx] == 0) {
+			continue;
+		}
+
+		snprintf(metric, sizeof(metric), "le%lu", ndx > 0 ? (unsigned long)((1ull << ndx) - 1) : 0ul);
+		fs_perf_result(target, test, bsize, metric, hist->bucket[ndx], "count");
+	}
+}
+
+/****************************************************************************
+ * Name: fs_perf_target_init
+ *
+ * Description:
+ *   Identify the target at 'path': a block device, or a directory whose
+ *   file system type names the results.  Read-only file systems only get
+ *   the read tests.
+ *
+ ****************************************************************************/
+
+int fs_perf_target_init(struct fs_perf_target_s *target, const char *path)
+{
+	struct statfs fsbuf;
+	struct stat buf;
+	int i;
+
+	memset(target, 0, sizeof(struct fs_perf_target_s));
+	target->path = path;
+
+	if (stat(path, &buf) < 0) {
+		printf("Cannot stat %s, errno %d\n", path, get_errno());
+		return ERROR;
+	}
+
+	if (S_ISBLK(buf.st_mode)) {
+		target->blockdev = true;
+		snprintf(target->name, sizeof(target->name), "blk:%s", path);
+		return OK;
+	}
+
+	if (!S_ISDIR(buf.st_mode)) {
+		printf("%s is neither a directory nor a block device\n", path);
+		return ERROR;
+	}
+
+	if (statfs(path, &fsbuf) < 0) {
+		printf("Cannot statfs %s, errno %d\n", path, get_errno());
+		return ERROR;
+	}
+
+	for (i = 0; i < NFSTYPES; i++) {
+		if (fsbuf.f_type == g_fstypes[i].magic) {
+			snprintf(target->name, sizeof(target->name), "%s", g_fstypes[i].name);
+			target->readonly = g_fstypes[i].readonly;
+			return OK;
+		}
+	}
+
+	snprintf(target->name, sizeof(target->name), "fs%lx", (unsigned long)fsbuf.f_type);
+	return OK;
+}
+
+/* Build the path of a file in the directory under test */
+
+void fs_perf_target_file(const struct fs_perf_target_s *target, char *path, const char *name)
+{
+	snprintf(path, FS_PERF_PATHLEN, "%s/%s", target->path, name);
+}
@@ -0,0 +1,265 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file fs_perf_io.c
+
+/// @brief Sequential and random throughput of files and block devices.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sys/stat.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "fs_perf.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Return the file the throughput runs access on a target: the device
+ * itself, the given file on a read-only file system, or the data file in
+ * the directory under test.
+ */
+
+static const char *fs_perf_io_path(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target, char *path)
+{
+	if (target->blockdev) {
+		return target->path;
+	}
+
+	if (target->readonly) {
+		return config->readfile;
+	}
+
+	fs_perf_target_file(target, path, FS_PERF_DATAFILE);
+	return path;
+}
+
+/* Write 'size' bytes sequentially in blocks of 'bsize', then fsync() */
+
+static int fs_perf_write_seq(const char *path, int oflags, const uint8_t *buffer, size_t bsize, size_t size)
+{
+	size_t done;
+	size_t n;
+	ssize_t ret;
+	int fd;
+
+	fd = open(path, oflags, 0666);
+	if (fd < 0) {
+		printf("Cannot open %s, errno %d\n", path, get_errno());
+		return ERROR;
+	}
+
+	for (done = 0; done < size; done += n) {
+		n = size - done < bsize ? size - done : bsize;
+		ret = write(fd, buffer, n);
+		if (ret != (ssize_t)n) {
+			printf("Write to %s failed at %lu, errno %d\n", path, (unsigned long)done, get_errno());
+			close(fd);
+			return ERROR;
+		}
+	}
+
+	fsync(fd);
+	close(fd);
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fs_perf_seq
+ *
+ * Description:
+ *   Write the data file sequentially, then read it back.  The write time
+ *   includes the final fsync() and close(), so that data only cached in RAM
+ *   is not counted as written.
+ *
+ ****************************************************************************/
+
+int fs_perf_seq(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target, size_t bsize)
+{
+	char name[FS_PERF_PATHLEN];
+	const char *path;
+	uint64_t start;
+	uint64_t total;
+	uint32_t usec;
+	ssize_t nread;
+	int fd;
+
+	path = fs_perf_io_path(config, target, name);
+	if (path == NULL) {
+		printf("%s is read-only, skip: no file given with -f\n", target->name);
+		return OK;
+	}
+
+	if (!target->readonly) {
+		start = fs_perf_now();
+		if (fs_perf_write_seq(path, target->blockdev ? O_WRONLY : O_WRONLY | O_CREAT | O_TRUNC, config->buffer, bsize, config->filesize) < 0) {
+			return ERROR;
+		}
+
+		usec = fs_perf_elapsed(start);
+		fs_perf_result(target, "seqwrite", bsize, "throughput", fs_perf_kbps(config->filesize, usec), "KB/s");
+	}
+
+	/* Read until the end of the file, or 'filesize' bytes of a device */
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		printf("Cannot open %s, errno %d\n", path, get_errno());
+		return ERROR;
+	}
+
+	total = 0;
+	start = fs_perf_now();
+	while (!target->blockdev || total < config->filesize) {
+		nread = read(fd, config->buffer, bsize);
+		if (nread < 0) {
+			printf("Read from %s failed at %lu, errno %d\n", path, (unsigned long)total, get_errno());
+			close(fd);
+			return ERROR;
+		}
+
+		if (nread == 0) {
+			break;
+		}
+
+		total += nread;
+	}
+
+	usec = fs_perf_elapsed(start);
+	close(fd);
+
+	fs_perf_result(target, "seqread", bsize, "throughput", fs_perf_kbps(total, usec), "KB/s");
+	return OK;
+}
+
+/****************************************************************************
+ * Name: fs_perf_rand_io
+ *
+ * Description:
+ *   Read, then overwrite, 'nops' blocks at random block aligned offsets of
+ *   the data file.  The file is created first if it is too small.
+ *
+ ****************************************************************************/
+
+int fs_perf_rand_io(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target, size_t bsize)
+{
+	char name[FS_PERF_PATHLEN];
+	const char *path;
+	struct stat buf;
+	uint64_t start;
+	uint32_t nblocks;
+	uint32_t state;
+	uint32_t usec;
+	uint32_t i;
+	off_t offset;
+	size_t size;
+	int fd;
+
+	path = fs_perf_io_path(config, target, name);
+	if (path == NULL) {
+		printf("%s is read-only, skip: no file given with -f\n", target->name);
+		return OK;
+	}
+
+	size = config->filesize;
+	if (!target->blockdev) {
+		if (stat(path, &buf) < 0 || (!target->readonly && (size_t)buf.st_size < size)) {
+			if (target->readonly) {
+				printf("Cannot stat %s, errno %d\n", path, get_errno());
+				return ERROR;
+			}
+
+			if (fs_perf_write_seq(path, O_WRONLY | O_CREAT | O_TRUNC, config->buffer, bsize, size) < 0) {
+				return ERROR;
+			}
+		} else if (target->readonly) {
+			size = buf.st_size;
+		}
+	}
+
+	nblocks = size / bsize;
+	if (nblocks == 0) {
+		printf("%s is smaller than one block of %lu bytes, skip\n", path, (unsigned long)bsize);
+		return OK;
+	}
+
+	/* Random reads */
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		printf("Cannot open %s, errno %d\n", path, get_errno());
+		return ERROR;
+	}
+
+	state = config->seed;
+	start = fs_perf_now();
+	for (i = 0; i < config->nops; i++) {
+		offset = (off_t)(fs_perf_rand(&state) % nblocks) * bsize;
+		if (lseek(fd, offset, SEEK_SET) != offset || read(fd, config->buffer, bsize) != (ssize_t)bsize) {
+			printf("Random read of %s failed at %ld, errno %d\n", path, (long)offset, get_errno());
+			close(fd);
+			return ERROR;
+		}
+	}
+
+	usec = fs_perf_elapsed(start);
+	close(fd);
+
+	fs_perf_result(target, "randread", bsize, "iops", fs_perf_rate(config->nops, usec), "op/s");
+	fs_perf_result(target, "randread", bsize, "throughput", fs_perf_kbps((uint64_t)config->nops * bsize, usec), "KB/s");
+
+	if (target->readonly) {
+		return OK;
+	}
+
+	/* Random overwrites, followed by one fsync() */
+
+	fd = open(path, O_WRONLY);
+	if (fd < 0) {
+		printf("Cannot open %s, errno %d\n", path, get_errno());
+		return ERROR;
+	}
+
+	start = fs_perf_now();
+	for (i = 0; i < config->nops; i++) {
+		offset = (off_t)(fs_perf_rand(&state) % nblocks) * bsize;
+		if (lseek(fd, offset, SEEK_SET) != offset || write(fd, config->buffer, bsize) != (ssize_t)bsize) {
+			printf("Random write of %s failed at %ld, errno %d\n", path, (long)offset, get_errno());
+			close(fd);
+			return ERROR;
+		}
+	}
+
+	fsync(fd);
+	usec = fs_perf_elapsed(start);
+	close(fd);
+
+	fs_perf_result(target, "randwrite", bsize, "iops", fs_perf_rate(config->nops, usec), "op/s");
+	fs_perf_result(target, "randwrite", bsize, "throughput", fs_perf_kbps((uint64_t)config->nops * bsize, usec), "KB/s");
+	return OK;
+}
@@ -0,0 +1,305 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file fs_perf_meta.c
+
+/// @brief Metadata operations, fsync() latency and mount time.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sys/stat.h>
+#include <sys/mount.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "fs_perf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The mount run remounts the file system this many times at most */
+
+#define FS_PERF_MAX_MOUNTS 20
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void fs_perf_meta_name(const struct fs_perf_target_s *target, char *path, uint32_t ndx)
+{
+	char name[16];
+
+	snprintf(name, sizeof(name), "fsperf_%lu", (unsigned long)ndx);
+	fs_perf_target_file(target, path, name);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fs_perf_meta
+ *
+ * Description:
+ *   Create 'nops' empty files, then open, stat and unlink each of them, and
+ *   report the rate of each kind of operation.  On a read-only file system
+ *   only the given file is opened and stat'ed repeatedly.
+ *
+ ****************************************************************************/
+
+int fs_perf_meta(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target)
+{
+	char path[FS_PERF_PATHLEN];
+	struct stat buf;
+	uint64_t start;
+	uint32_t usec;
+	uint32_t i;
+	int fd;
+
+	if (target->blockdev) {
+		return OK;
+	}
+
+	if (target->readonly) {
+		if (config->readfile == NULL) {
+			printf("%s is read-only, skip: no file given with -f\n", target->name);
+			return OK;
+		}
+
+		snprintf(path, sizeof(path), "%s", config->readfile);
+	}
+
+	/* create */
+
+	if (!target->readonly) {
+		start = fs_perf_now();
+		for (i = 0; i < config->nops; i++) {
+			fs_perf_meta_name(target, path, i);
+			fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+			if (fd < 0) {
+				printf("Cannot create %s, errno %d\n", path, get_errno());
+				goto errout_with_files;
+			}
+
+			close(fd);
+		}
+
+		usec = fs_perf_elapsed(start);
+		fs_perf_result(target, "meta", 0, "create", fs_perf_rate(config->nops, usec), "op/s");
+	}
+
+	/* open and close */
+
+	start = fs_perf_now();
+	for (i = 0; i < config->nops; i++) {
+		if (!target->readonly) {
+			fs_perf_meta_name(target, path, i);
+		}
+
+		fd = open(path, O_RDONLY);
+		if (fd < 0) {
+			printf("Cannot open %s, errno %d\n", path, get_errno());
+			goto errout_with_files;
+		}
+
+		close(fd);
+	}
+
+	usec = fs_perf_elapsed(start);
+	fs_perf_result(target, "meta", 0, "open", fs_perf_rate(config->nops, usec), "op/s");
+
+	/* stat */
+
+	start = fs_perf_now();
+	for (i = 0; i < config->nops; i++) {
+		if (!target->readonly) {
+			fs_perf_meta_name(target, path, i);
+		}
+
+		if (stat(path, &buf) < 0) {
+			printf("Cannot stat %s, errno %d\n", path, get_errno());
+			goto errout_with_files;
+		}
+	}
+
+	usec = fs_perf_elapsed(start);
+	fs_perf_result(target, "meta", 0, "stat", fs_perf_rate(config->nops, usec), "op/s");
+
+	if (target->readonly) {
+		return OK;
+	}
+
+	/* unlink */
+
+	start = fs_perf_now();
+	for (i = 0; i < config->nops; i++) {
+		fs_perf_meta_name(target, path, i);
+		if (unlink(path) < 0) {
+			printf("Cannot unlink %s, errno %d\n", path, get_errno());
+			goto errout_with_files;
+		}
+	}
+
+	usec = fs_perf_elapsed(start);
+	fs_perf_result(target, "meta", 0, "unlink", fs_perf_rate(config->nops, usec), "op/s");
+	return OK;
+
+errout_with_files:
+	if (!target->readonly) {
+		for (i = 0; i < config->nops; i++) {
+			fs_perf_meta_name(target, path, i);
+			(void)unlink(path);
+		}
+	}
+
+	return ERROR;
+}
+
+/****************************************************************************
+ * Name: fs_perf_fsync
+ *
+ * Description:
+ *   Append one block and fsync() it, 'nops' times, and report the
+ *   distribution of the fsync() latency.
+ *
+ ****************************************************************************/
+
+int fs_perf_fsync(const struct fs_perf_config_s *config, const struct fs_perf_target_s *target, size_t bsize)
+{
+	struct fs_perf_hist_s hist;
+	char path[FS_PERF_PATHLEN];
+	const char *file;
+	uint64_t start;
+	uint32_t i;
+	int ret = OK;
+	int fd;
+
+	if (target->readonly) {
+		return OK;
+	}
+
+	if (target->blockdev) {
+		file = target->path;
+		fd = open(file, O_WRONLY);
+	} else {
+		fs_perf_target_file(target, path, FS_PERF_DATAFILE);
+		file = path;
+		fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	}
+
+	if (fd < 0) {
+		printf("Cannot open %s, errno %d\n", file, get_errno());
+		return ERROR;
+	}
+
+	fs_perf_hist_init(&hist);
+	for (i = 0; i < config->nops; i++) {
+		/* Do not run past the end of a device */
+
+		if (target->blockdev && (uint64_t)(i + 1) * bsize > config->filesize) {
+			break;
+		}
+
+		if (write(fd, config->buffer, bsize) != (ssize_t)bsize) {
+			printf("Write to %s failed, errno %d\n", file, get_errno());
+			ret = ERROR;
+			break;
+		}
+
+		start = fs_perf_now();
+		if (fsync(fd) < 0) {
+			printf("fsync of %s failed, errno %d\n", file, get_errno());
+			ret = ERROR;
+			break;
+		}
+
+		fs_perf_hist_add(&hist, fs_perf_elapsed(start));
+	}
+
+	close(fd);
+	fs_perf_result_hist(target, "fsync", bsize, &hist);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: fs_perf_mount
+ *
+ * Description:
+ *   Unmount and mount the file system at the mount point repeatedly and
+ *   report the distribution of both times.  The file system is left
+ *   mounted.
+ *
+ ****************************************************************************/
+
+int fs_perf_mount(const struct fs_perf_config_s *config)
+{
+	struct fs_perf_target_s target;
+	struct fs_perf_hist_s mounthist;
+	struct fs_perf_hist_s umounthist;
+	uint64_t start;
+	uint32_t nmounts;
+	uint32_t i;
+	int ret;
+
+	memset(&target, 0, sizeof(target));
+	target.path = config->mountpoint;
+	snprintf(target.name, sizeof(target.name), "%s", config->mounttype);
+
+	nmounts = config->nops < FS_PERF_MAX_MOUNTS ? config->nops : FS_PERF_MAX_MOUNTS;
+
+	fs_perf_hist_init(&mounthist);
+	fs_perf_hist_init(&umounthist);
+
+	/* The first unmount is not timed: the file system may not be mounted */
+
+	(void)umount(config->mountpoint);
+
+	for (i = 0; i < nmounts; i++) {
+		start = fs_perf_now();
+		ret = mount(config->mountsrc, config->mountpoint, config->mounttype, 0, NULL);
+		if (ret < 0) {
+			printf("Cannot mount %s on %s, errno %d\n", config->mounttype, config->mountpoint, get_errno());
+			return ERROR;
+		}
+
+		fs_perf_hist_add(&mounthist, fs_perf_elapsed(start));
+
+		if (i == nmounts - 1) {
+			break;
+		}
+
+		start = fs_perf_now();
+		ret = umount(config->mountpoint);
+		if (ret < 0) {
+			printf("Cannot unmount %s, errno %d\n", config->mountpoint, get_errno());
+			return ERROR;
+		}
+
+		fs_perf_hist_add(&umounthist, fs_perf_elapsed(start));
+	}
+
+	fs_perf_result_hist(&target, "mount", 0, &mounthist);
+	fs_perf_result_hist(&target, "umount", 0, &umounthist);
+	return OK;
+}
@@ -0,0 +1,463 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file fs_performance_test.c
+
+/// @brief Benchmark of the file systems and block devices.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/mount.h>
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMDISK)
+#include <tinyara/fs/ramdisk.h>
+#endif
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMMTD) && defined(CONFIG_MTD_SMART) && defined(CONFIG_FS_SMARTFS)
+#include <tinyara/fs/mtd.h>
+#include <tinyara/fs/mksmartfs.h>
+#endif
+
+#include "fs_perf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define FS_PERF_DEFAULT_SEED   0x12345678
+
+#define FS_PERF_TEST_SEQ       (1 << 0)
+#define FS_PERF_TEST_RAND      (1 << 1)
+#define FS_PERF_TEST_META      (1 << 2)
+#define FS_PERF_TEST_FSYNC     (1 << 3)
+#define FS_PERF_TEST_MOUNT     (1 << 4)
+#define FS_PERF_TEST_ALL       (FS_PERF_TEST_SEQ | FS_PERF_TEST_RAND | FS_PERF_TEST_META | FS_PERF_TEST_FSYNC | FS_PERF_TEST_MOUNT)
+
+/* RAM disk created with -R, registered as /dev/ram<minor> */
+
+#define FS_PERF_RAMDISK_MINOR  7
+#define FS_PERF_RAMDISK_SECTSIZE 512
+
+/* smartfs on a RAM MTD created with -T, mounted on FS_PERF_SMARTRAM_DIR */
+
+#define FS_PERF_SMARTRAM_MINOR 7
+#define FS_PERF_SMARTRAM_DIR   "/smartram"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const size_t g_default_bsizes[] = { 256, 1024, 4096 };
+
+static const struct {
+	const char *name;
+	int test;
+} g_tests[] = {
+	{ "seq", FS_PERF_TEST_SEQ },
+	{ "rand", FS_PERF_TEST_RAND },
+	{ "meta", FS_PERF_TEST_META },
+	{ "fsync", FS_PERF_TEST_FSYNC },
+	{ "mount", FS_PERF_TEST_MOUNT },
+	{ "all", FS_PERF_TEST_ALL },
+};
+
+#define NTESTS (int)(sizeof(g_tests) / sizeof(g_tests[0]))
+
+static struct fs_perf_config_s g_config;
+static const char *g_paths[FS_PERF_MAX_TARGETS];
+static int g_npaths;
+
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMDISK)
+static char g_ramdisk_path[16];
+static uint8_t *g_ramdisk_buffer;
+#endif
+
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMMTD) && defined(CONFIG_MTD_SMART) && defined(CONFIG_FS_SMARTFS)
+/* The RAM MTD cannot be released, so it is kept for the next runs */
+
+static uint8_t *g_smartram_buffer;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Parse a comma separated list of block sizes */
+
+static int fs_perf_parse_bsizes(char *list)
+{
+	char *saveptr;
+	char *token;
+	long bsize;
+
+	g_config.nbsizes = 0;
+	for (token = strtok_r(list, ",", &saveptr); token != NULL; token = strtok_r(NULL, ",", &saveptr)) {
+		bsize = strtol(token, NULL, 0);
+		if (bsize <= 0 || g_config.nbsizes >= FS_PERF_MAX_BSIZES) {
+			printf("Invalid block size list\n");
+			return ERROR;
+		}
+
+		g_config.bsizes[g_config.nbsizes++] = bsize;
+	}
+
+	return g_config.nbsizes > 0 ? OK : ERROR;
+}
+
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMDISK)
+/* Create a RAM disk of 'nsectors' sectors to be benchmarked as a block
+ * device.  The driver is reached through the BCH proxy of open().
+ */
+
+static const char *fs_perf_ramdisk_create(uint32_t nsectors)
+{
+	int ret;
+
+	g_ramdisk_buffer = (uint8_t *)malloc(nsectors * FS_PERF_RAMDISK_SECTSIZE);
+	if (g_ramdisk_buffer == NULL) {
+		printf("Cannot allocate a RAM disk of %lu sectors\n", (unsigned long)nsectors);
+		return NULL;
+	}
+
+	ret = ramdisk_register(FS_PERF_RAMDISK_MINOR, g_ramdisk_buffer, nsectors, FS_PERF_RAMDISK_SECTSIZE, RDFLAG_WRENABLED);
+	if (ret < 0) {
+		printf("Cannot register the RAM disk, error %d\n", ret);
+		free(g_ramdisk_buffer);
+		g_ramdisk_buffer = NULL;
+		return NULL;
+	}
+
+	snprintf(g_ramdisk_path, sizeof(g_ramdisk_path), "/dev/ram%d", FS_PERF_RAMDISK_MINOR);
+
+	/* Do not run past the end of the disk */
+
+	if (g_config.filesize > nsectors * FS_PERF_RAMDISK_SECTSIZE) {
+		g_config.filesize = nsectors * FS_PERF_RAMDISK_SECTSIZE;
+	}
+
+	return g_ramdisk_path;
+}
+
+static void fs_perf_ramdisk_destroy(void)
+{
+	if (g_ramdisk_buffer != NULL) {
+		(void)unlink(g_ramdisk_path);
+		free(g_ramdisk_buffer);
+		g_ramdisk_buffer = NULL;
+	}
+}
+#endif
+
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMMTD) && defined(CONFIG_MTD_SMART) && defined(CONFIG_FS_SMARTFS)
+/* Create smartfs on a RAM MTD of 'size' bytes, to compare the cost of the
+ * file system alone with tmpfs and the RAM disk.  The first run formats
+ * it, the next ones reuse it with its first size.
+ */
+
+static const char *fs_perf_smartram_create(size_t size)
+{
+	FAR struct mtd_dev_s *mtd;
+	char devname[16];
+	int ret;
+
+#ifdef CONFIG_SMARTFS_MULTI_ROOT_DIRS
+	snprintf(devname, sizeof(devname), "/dev/smart%dd1", FS_PERF_SMARTRAM_MINOR);
+#else
+	snprintf(devname, sizeof(devname), "/dev/smart%d", FS_PERF_SMARTRAM_MINOR);
+#endif
+
+	if (g_smartram_buffer == NULL) {
+		g_smartram_buffer = (uint8_t *)malloc(size);
+		if (g_smartram_buffer == NULL) {
+			printf("Cannot allocate a RAM MTD of %lu bytes\n", (unsigned long)size);
+			return NULL;
+		}
+
+		mtd = rammtd_initialize(g_smartram_buffer, size);
+		if (mtd == NULL) {
+			printf("Cannot create the RAM MTD\n");
+			goto errout_with_buffer;
+		}
+
+		ret = smart_initialize(FS_PERF_SMARTRAM_MINOR, mtd, NULL);
+		if (ret < 0) {
+			printf("Cannot create the SMART device, error %d\n", ret);
+			goto errout_with_buffer;
+		}
+
+#ifdef CONFIG_SMARTFS_MULTI_ROOT_DIRS
+		ret = mksmartfs(devname, 1, true);
+#else
+		ret = mksmartfs(devname, true);
+#endif
+		if (ret < 0) {
+			printf("Cannot format %s, error %d\n", devname, errno);
+			return NULL;
+		}
+	} else {
+		printf("Reusing the smartfs RAM MTD of the previous run\n");
+	}
+
+	ret = mount(devname, FS_PERF_SMARTRAM_DIR, "smartfs", 0, NULL);
+	if (ret < 0 && errno != EBUSY) {
+		printf("Cannot mount %s, error %d\n", devname, errno);
+		return NULL;
+	}
+
+	return FS_PERF_SMARTRAM_DIR;
+
+errout_with_buffer:
+	free(g_smartram_buffer);
+	g_smartram_buffer = NULL;
+	return NULL;
+}
+#endif
+
+static void fs_perf_run_target(const struct fs_perf_target_s *target, int tests)
+{
+	char path[FS_PERF_PATHLEN];
+	int i;
+
+	for (i = 0; i < g_config.nbsizes; i++) {
+		if (tests & FS_PERF_TEST_SEQ) {
+			fs_perf_seq(&g_config, target, g_config.bsizes[i]);
+		}
+
+		if (tests & FS_PERF_TEST_RAND) {
+			fs_perf_rand_io(&g_config, target, g_config.bsizes[i]);
+		}
+
+		if (tests & FS_PERF_TEST_FSYNC) {
+			fs_perf_fsync(&g_config, target, g_config.bsizes[i]);
+		}
+	}
+
+	if (tests & FS_PERF_TEST_META) {
+		fs_perf_meta(&g_config, target);
+	}
+
+	/* Leave the directory as it was found */
+
+	if (!target->blockdev && !target->readonly) {
+		fs_perf_target_file(target, path, FS_PERF_DATAFILE);
+		(void)unlink(path);
+	}
+}
+
+static void show_usage(const char *prog)
+{
+	printf("\nUsage: %s [OPTIONS] [seq|rand|meta|fsync|mount|all]\n", prog);
+	printf("\nOptions:\n");
+	printf(" -d PATH       Directory or block device to test, up to %d (default %s)\n", FS_PERF_MAX_TARGETS, CONFIG_EXAMPLES_FS_PERFORMANCE_DIR);
+	printf(" -b LIST       Comma separated block sizes (default 256,1024,4096)\n");
+	printf(" -l LENGTH     Bytes of the throughput runs (default %d)\n", CONFIG_EXAMPLES_FS_PERFORMANCE_FILESIZE);
+	printf(" -n NOPS       Operations of the random, metadata and fsync runs (default %d)\n", CONFIG_EXAMPLES_FS_PERFORMANCE_NOPS);
+	printf(" -s SEED       Seed of the random offsets (default 0x%x)\n", FS_PERF_DEFAULT_SEED);
+	printf(" -f FILE       Existing file read on read-only file systems such as romfs\n");
+	printf(" -m TYPE       File system type of the mount run, which needs -M\n");
+	printf(" -M DIR        Mount point of the mount run\n");
+	printf(" -S SOURCE     Block device mounted by the mount run, none for tmpfs\n");
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMDISK)
+	printf(" -R NSECTORS   Also test a RAM disk of NSECTORS %d-byte sectors\n", FS_PERF_RAMDISK_SECTSIZE);
+#endif
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMMTD) && defined(CONFIG_MTD_SMART) && defined(CONFIG_FS_SMARTFS)
+	printf(" -T SIZE       Also test smartfs on a RAM MTD of SIZE bytes, mounted on %s\n", FS_PERF_SMARTRAM_DIR);
+#endif
+	printf("\nResults are printed as lines of comma separated values starting with FSPERF.\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int fsperf_main(int argc, char *argv[])
+#endif
+{
+	struct fs_perf_target_s *target;
+	size_t maxbsize;
+	int tests;
+	int opt;
+	int i;
+
+	memset(&g_config, 0, sizeof(g_config));
+	memcpy(g_config.bsizes, g_default_bsizes, sizeof(g_default_bsizes));
+	g_config.nbsizes = sizeof(g_default_bsizes) / sizeof(g_default_bsizes[0]);
+	g_config.filesize = CONFIG_EXAMPLES_FS_PERFORMANCE_FILESIZE;
+	g_config.nops = CONFIG_EXAMPLES_FS_PERFORMANCE_NOPS;
+	g_config.seed = FS_PERF_DEFAULT_SEED;
+	g_npaths = 0;
+	tests = FS_PERF_TEST_ALL;
+
+	while ((opt = getopt(argc, argv, "d:b:l:n:s:f:m:M:S:R:T:")) != ERROR) {
+		switch (opt) {
+		case 'd':
+			if (g_npaths >= FS_PERF_MAX_TARGETS) {
+				printf("At most %d targets\n", FS_PERF_MAX_TARGETS);
+				goto usage;
+			}
+			g_paths[g_npaths++] = optarg;
+			break;
+		case 'b':
+			if (fs_perf_parse_bsizes(optarg) < 0) {
+				goto usage;
+			}
+			break;
+		case 'l':
+			g_config.filesize = strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			g_config.nops = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			g_config.seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'f':
+			g_config.readfile = optarg;
+			break;
+		case 'm':
+			g_config.mounttype = optarg;
+			break;
+		case 'M':
+			g_config.mountpoint = optarg;
+			break;
+		case 'S':
+			g_config.mountsrc = optarg;
+			break;
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMDISK)
+		case 'R':
+			if (g_npaths >= FS_PERF_MAX_TARGETS) {
+				printf("At most %d targets\n", FS_PERF_MAX_TARGETS);
+				goto usage;
+			}
+			g_paths[g_npaths] = fs_perf_ramdisk_create(strtoul(optarg, NULL, 0));
+			if (g_paths[g_npaths] == NULL) {
+				return ERROR;
+			}
+			g_npaths++;
+			break;
+#endif
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMMTD) && defined(CONFIG_MTD_SMART) && defined(CONFIG_FS_SMARTFS)
+		case 'T':
+			if (g_npaths >= FS_PERF_MAX_TARGETS) {
+				printf("At most %d targets\n", FS_PERF_MAX_TARGETS);
+				goto usage;
+			}
+			g_paths[g_npaths] = fs_perf_smartram_create(strtoul(optarg, NULL, 0));
+			if (g_paths[g_npaths] == NULL) {
+				goto errout;
+			}
+			g_npaths++;
+			break;
+#endif
+		default:
+			goto usage;
+		}
+	}
+
+	if (optind < argc) {
+		for (i = 0; i < NTESTS; i++) {
+			if (strcmp(argv[optind], g_tests[i].name) == 0) {
+				tests = g_tests[i].test;
+				break;
+			}
+		}
+
+		if (i == NTESTS) {
+			printf("Unknown test %s\n", argv[optind]);
+			goto usage;
+		}
+	}
+
+	if (g_config.mounttype == NULL || g_config.mountpoint == NULL) {
+		if (tests == FS_PERF_TEST_MOUNT) {
+			printf("The mount run needs -m and -M\n");
+			goto usage;
+		}
+
+		tests &= ~FS_PERF_TEST_MOUNT;
+	}
+
+	if (g_npaths == 0) {
+		g_paths[g_npaths++] = CONFIG_EXAMPLES_FS_PERFORMANCE_DIR;
+	}
+
+	if (g_config.nops == 0 || g_config.filesize == 0) {
+		printf("NOPS and LENGTH must not be zero\n");
+		goto usage;
+	}
+
+	maxbsize = 0;
+	for (i = 0; i < g_config.nbsizes; i++) {
+		if (g_config.bsizes[i] > maxbsize) {
+			maxbsize = g_config.bsizes[i];
+		}
+	}
+
+	g_config.buffer = (uint8_t *)malloc(maxbsize);
+	if (g_config.buffer == NULL) {
+		printf("Cannot allocate a buffer of %lu bytes\n", (unsigned long)maxbsize);
+		goto errout;
+	}
+
+	for (i = 0; i < (int)maxbsize; i++) {
+		g_config.buffer[i] = (uint8_t)i;
+	}
+
+	fs_perf_print_header(&g_config);
+
+	/* The mount run comes first, so that a file system mounted by it can
+	 * also be one of the targets.
+	 */
+
+	if (tests & FS_PERF_TEST_MOUNT) {
+		fs_perf_mount(&g_config);
+	}
+
+	for (i = 0; i < g_npaths; i++) {
+		target = &g_config.targets[g_config.ntargets];
+		if (fs_perf_target_init(target, g_paths[i]) < 0) {
+			continue;
+		}
+
+		g_config.ntargets++;
+		fs_perf_run_target(target, tests);
+	}
+
+	free(g_config.buffer);
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMDISK)
+	fs_perf_ramdisk_destroy();
+#endif
+	printf("\nFile system performance test done.\n");
+	return OK;
+
+usage:
+	show_usage(argv[0]);
+errout:
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_RAMDISK)
+	fs_perf_ramdisk_destroy();
+#endif
+	return ERROR;
+}
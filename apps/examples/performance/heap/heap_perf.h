@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_EXAMPLES_PERFORMANCE_HEAP_HEAP_PERF_H
+#define __APPS_EXAMPLES_PERFORMANCE_HEAP_HEAP_PERF_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_HEAP_PERFORMANCE_NOPS
+#define CONFIG_EXAMPLES_HEAP_PERFORMANCE_NOPS 20000
+#endif
+
+#ifndef CONFIG_EXAMPLES_HEAP_PERFORMANCE_NTHREADS
+#define CONFIG_EXAMPLES_HEAP_PERFORMANCE_NTHREADS 4
+#endif
+
+#define HEAP_PERF_MAX_THREADS  8
+
+/* Number of live objects kept by one run, and by one contention thread */
+
+#define HEAP_PERF_NSLOTS       256
+#define HEAP_PERF_THREAD_NSLOTS 64
+
+/* Latency histograms have one bucket per power of two: bucket n holds the
+ * samples in [2^(n-1), 2^n - 1], bucket 0 holds zero.
+ */
+
+#define HEAP_PERF_HIST_NBUCKETS 32
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct heap_perf_hist_s {
+	uint32_t bucket[HEAP_PERF_HIST_NBUCKETS];
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+};
+
+/* One class of a size distribution: sizes in [min, max] drawn uniformly,
+ * with a relative weight among the classes of the workload.
+ */
+
+struct heap_perf_sizeclass_s {
+	uint16_t min;
+	uint16_t max;
+	uint16_t weight;
+};
+
+struct heap_perf_workload_s {
+	const char *name;
+	const char *desc;
+	const struct heap_perf_sizeclass_s *classes;
+	int nclasses;
+};
+
+/* Allocator under test */
+
+struct heap_perf_allocator_s {
+	const char *name;
+	void *(*malloc)(size_t size);
+	void (*free)(void *mem);
+	void (*mallinfo)(struct mallinfo *info);
+};
+
+struct heap_perf_config_s {
+	const struct heap_perf_allocator_s *allocator;
+	const struct heap_perf_workload_s *workload;	/* NULL for all workloads */
+	uint32_t nops;				/* Number of alloc/free operations per run */
+	uint32_t seed;				/* Seed of the random sequence */
+	int nthreads;				/* Number of threads of the contention run */
+	int interval;				/* Operations between two fragmentation samples */
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+extern const struct heap_perf_workload_s g_heap_perf_workloads[];
+extern const int g_heap_perf_nworkloads;
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/* heap_perf_common.c */
+
+void heap_perf_timer_init(void);
+uint32_t heap_perf_now(void);
+const char *heap_perf_timer_unit(void);
+
+uint32_t heap_perf_rand(uint32_t *state);
+size_t heap_perf_pick_size(const struct heap_perf_workload_s *workload, uint32_t *state);
+const struct heap_perf_workload_s *heap_perf_find_workload(const char *name);
+
+void heap_perf_hist_init(struct heap_perf_hist_s *hist);
+void heap_perf_hist_add(struct heap_perf_hist_s *hist, uint32_t value);
+void heap_perf_hist_merge(struct heap_perf_hist_s *dst, const struct heap_perf_hist_s *src);
+void heap_perf_hist_print(const char *title, const struct heap_perf_hist_s *hist);
+
+/* Benchmarks */
+
+int heap_perf_latency(const struct heap_perf_config_s *config);
+int heap_perf_contention(const struct heap_perf_config_s *config);
+int heap_perf_frag(const struct heap_perf_config_s *config);
+
+#endif							/* __APPS_EXAMPLES_PERFORMANCE_HEAP_HEAP_PERF_H */
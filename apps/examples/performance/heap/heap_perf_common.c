@@ -0,0 +1,332 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file heap_perf_common.c
+
+/// @brief Cycle counter, size distributions and histograms shared by the heap benchmarks.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "heap_perf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Cycles are counted by the core when the benchmark can reach the counter,
+ * which requires a privileged (flat) build.  Otherwise clock_gettime() is
+ * used, whose resolution depends on the board.
+ */
+
+#if defined(CONFIG_BUILD_FLAT) && (defined(CONFIG_ARCH_CORTEXM3) || defined(CONFIG_ARCH_CORTEXM4) || \
+	defined(CONFIG_ARCH_CORTEXM7) || defined(CONFIG_ARCH_CORTEXM33) || defined(CONFIG_ARCH_CORTEXM55))
+/* DWT cycle counter, see arch/arm/src/armv7-m/dwt.h */
+
+#define HEAP_PERF_DWT_CYCLES
+#define HEAP_PERF_DEMCR        (*(volatile uint32_t *)0xe000edfc)
+#define HEAP_PERF_DEMCR_TRCENA (1 << 24)
+#define HEAP_PERF_DWT_CTRL     (*(volatile uint32_t *)0xe0001000)
+#define HEAP_PERF_DWT_CYCCNT   (*(volatile uint32_t *)0xe0001004)
+#define HEAP_PERF_DWT_CYCCNTENA (1 << 0)
+
+#elif defined(CONFIG_BUILD_FLAT) && defined(CONFIG_ARCH_ARMV7A_FAMILY)
+/* PMU cycle counter, see arch/arm/src/armv7-a/arm_perf.c */
+
+#define HEAP_PERF_PMU_CYCLES
+#define HEAP_PERF_PMCR_E       (1 << 0)
+#define HEAP_PERF_PMCNTEN_C    (1u << 31)
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Size distributions modelled on typical TizenRT workloads.  A distribution
+ * captured on the target with "heapinfo -c" can be added here to replay it.
+ */
+
+static const struct heap_perf_sizeclass_s g_small_classes[] = {
+	{ 8, 32, 40 },
+	{ 33, 64, 30 },
+	{ 65, 128, 20 },
+	{ 129, 256, 10 },
+};
+
+static const struct heap_perf_sizeclass_s g_net_classes[] = {
+	{ 16, 48, 35 },				/* pbuf and socket control blocks */
+	{ 49, 128, 15 },			/* TCP segments, ARP and DNS entries */
+	{ 129, 512, 15 },
+	{ 513, 1600, 35 },			/* Ethernet and Wi-Fi frames */
+};
+
+static const struct heap_perf_sizeclass_s g_media_classes[] = {
+	{ 256, 1024, 30 },
+	{ 1025, 4096, 50 },			/* Audio PCM periods */
+	{ 4097, 16384, 20 },		/* Decoder and tensor buffers */
+};
+
+static const struct heap_perf_sizeclass_s g_mixed_classes[] = {
+	{ 8, 64, 50 },
+	{ 65, 512, 30 },
+	{ 513, 4096, 15 },
+	{ 4097, 32768, 5 },
+};
+
+#define HEAP_PERF_WORKLOAD(name, desc, classes) \
+	{ name, desc, classes, sizeof(classes) / sizeof(classes[0]) }
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+const struct heap_perf_workload_s g_heap_perf_workloads[] = {
+	HEAP_PERF_WORKLOAD("small", "kernel objects, 8 - 256 bytes", g_small_classes),
+	HEAP_PERF_WORKLOAD("net", "network buffers, 16 - 1600 bytes", g_net_classes),
+	HEAP_PERF_WORKLOAD("media", "audio and ML buffers, 256 - 16K bytes", g_media_classes),
+	HEAP_PERF_WORKLOAD("mixed", "all of the above, 8 - 32K bytes", g_mixed_classes),
+};
+
+const int g_heap_perf_nworkloads = sizeof(g_heap_perf_workloads) / sizeof(g_heap_perf_workloads[0]);
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: heap_perf_timer_init
+ *
+ * Description:
+ *   Start the counter read by heap_perf_now().
+ *
+ ****************************************************************************/
+
+void heap_perf_timer_init(void)
+{
+#if defined(HEAP_PERF_DWT_CYCLES)
+	HEAP_PERF_DEMCR |= HEAP_PERF_DEMCR_TRCENA;
+	HEAP_PERF_DWT_CYCCNT = 0;
+	HEAP_PERF_DWT_CTRL |= HEAP_PERF_DWT_CYCCNTENA;
+#elif defined(HEAP_PERF_PMU_CYCLES)
+	uint32_t pmcr;
+
+	__asm__ __volatile__("mrc p15, 0, %0, c9, c12, 0" : "=r"(pmcr));
+	pmcr |= HEAP_PERF_PMCR_E;
+	__asm__ __volatile__("mcr p15, 0, %0, c9, c12, 0" : : "r"(pmcr));
+	__asm__ __volatile__("mcr p15, 0, %0, c9, c12, 1" : : "r"(HEAP_PERF_PMCNTEN_C));
+#endif
+}
+
+/****************************************************************************
+ * Name: heap_perf_now
+ *
+ * Description:
+ *   Return a free running 32-bit counter in heap_perf_timer_unit() units.
+ *   Differences of two readings are valid across a wrap around.
+ *
+ ****************************************************************************/
+
+uint32_t heap_perf_now(void)
+{
+#if defined(HEAP_PERF_DWT_CYCLES)
+	return HEAP_PERF_DWT_CYCCNT;
+#elif defined(HEAP_PERF_PMU_CYCLES)
+	uint32_t cycles;
+
+	__asm__ __volatile__("mrc p15, 0, %0, c9, c13, 0" : "=r"(cycles));
+	return cycles;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (uint32_t)ts.tv_sec * 1000000000u + (uint32_t)ts.tv_nsec;
+#endif
+}
+
+const char *heap_perf_timer_unit(void)
+{
+#if defined(HEAP_PERF_DWT_CYCLES) || defined(HEAP_PERF_PMU_CYCLES)
+	return "cycles";
+#else
+	return "ns";
+#endif
+}
+
+/****************************************************************************
+ * Name: heap_perf_rand
+ *
+ * Description:
+ *   xorshift32.  The benchmarks keep their own state, so that a run is
+ *   reproduced exactly from its seed whatever else uses rand().
+ *
+ ****************************************************************************/
+
+uint32_t heap_perf_rand(uint32_t *state)
+{
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/****************************************************************************
+ * Name: heap_perf_pick_size
+ ****************************************************************************/
+
+size_t heap_perf_pick_size(const struct heap_perf_workload_s *workload, uint32_t *state)
+{
+	const struct heap_perf_sizeclass_s *class;
+	uint32_t totalweight = 0;
+	uint32_t pick;
+	int i;
+
+	for (i = 0; i < workload->nclasses; i++) {
+		totalweight += workload->classes[i].weight;
+	}
+
+	pick = heap_perf_rand(state) % totalweight;
+	for (i = 0; i < workload->nclasses - 1; i++) {
+		if (pick < workload->classes[i].weight) {
+			break;
+		}
+		pick -= workload->classes[i].weight;
+	}
+
+	class = &workload->classes[i];
+	return class->min + heap_perf_rand(state) % (class->max - class->min + 1);
+}
+
+/****************************************************************************
+ * Name: heap_perf_find_workload
+ ****************************************************************************/
+
+const struct heap_perf_workload_s *heap_perf_find_workload(const char *name)
+{
+	int i;
+
+	for (i = 0; i < g_heap_perf_nworkloads; i++) {
+		if (strcmp(g_heap_perf_workloads[i].name, name) == 0) {
+			return &g_heap_perf_workloads[i];
+		}
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: heap_perf_hist_*
+ ****************************************************************************/
+
+void heap_perf_hist_init(struct heap_perf_hist_s *hist)
+{
+	memset(hist, 0, sizeof(struct heap_perf_hist_s));
+	hist->min = UINT32_MAX;
+}
+
+void heap_perf_hist_add(struct heap_perf_hist_s *hist, uint32_t value)
+{
+	int ndx = value ? 32 - __builtin_clz(value) : 0;
+
+	if (ndx >= HEAP_PERF_HIST_NBUCKETS) {
+		ndx = HEAP_PERF_HIST_NBUCKETS - 1;
+	}
+
+	hist->bucket[ndx]++;
+	hist->count++;
+	hist->sum += value;
+	if (value < hist->min) {
+		hist->min = value;
+	}
+	if (value > hist->max) {
+		hist->max = value;
+	}
+}
+
+void heap_perf_hist_merge(struct heap_perf_hist_s *dst, const struct heap_perf_hist_s *src)
+{
+	int ndx;
+
+	for (ndx = 0; ndx < HEAP_PERF_HIST_NBUCKETS; ndx++) {
+		dst->bucket[ndx] += src->bucket[ndx];
+	}
+
+	dst->count += src->count;
+	dst->sum += src->sum;
+	if (src->min < dst->min) {
+		dst->min = src->min;
+	}
+	if (src->max > dst->max) {
+		dst->max = src->max;
+	}
+}
+
+/* Return the upper bound of the bucket holding the given percentile */
+
+static uint32_t heap_perf_hist_percentile(const struct heap_perf_hist_s *hist, int percent)
+{
+	uint32_t target = (uint32_t)(((uint64_t)hist->count * percent + 99) / 100);
+	uint32_t seen = 0;
+	int ndx;
+
+	for (ndx = 0; ndx < HEAP_PERF_HIST_NBUCKETS; ndx++) {
+		seen += hist->bucket[ndx];
+		if (seen >= target) {
+			break;
+		}
+	}
+
+	if (ndx == 0) {
+		return 0;
+	}
+
+	return ndx >= 32 ? UINT32_MAX : (uint32_t)((1ull << ndx) - 1);
+}
+
+void heap_perf_hist_print(const char *title, const struct heap_perf_hist_s *hist)
+{
+	int ndx;
+
+	printf("  %s latency (%s), %u samples\n", title, heap_perf_timer_unit(), hist->count);
+	if (hist->count == 0) {
+		return;
+	}
+
+	printf("    min %u, avg %u, max %u, p50 <= %u, p90 <= %u, p99 <= %u\n",
+		hist->min, (uint32_t)(hist->sum / hist->count), hist->max,
+		heap_perf_hist_percentile(hist, 50), heap_perf_hist_percentile(hist, 90),
+		heap_perf_hist_percentile(hist, 99));
+
+	for (ndx = 0; ndx < HEAP_PERF_HIST_NBUCKETS; ndx++) {
+		if (hist->bucket[ndx] == 0) {
+			continue;
+		}
+
+		printf("    %10u - %10u : %8u (%3u%%)\n",
+			ndx > 0 ? (uint32_t)(1ull << (ndx - 1)) : 0,
+			ndx > 0 ? (uint32_t)((1ull << ndx) - 1) : 0,
+			hist->bucket[ndx], (uint32_t)((uint64_t)hist->bucket[ndx] * 100 / hist->count));
+	}
+}
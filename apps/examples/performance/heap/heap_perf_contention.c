@@ -0,0 +1,220 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file heap_perf_contention.c
+
+/// @brief Measure the heap throughput and latency with several threads allocating at once.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+#include "heap_perf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define HEAP_PERF_THREAD_STACKSIZE 4096
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct heap_perf_thread_s {
+	const struct heap_perf_config_s *config;
+	const struct heap_perf_workload_s *workload;
+	uint32_t seed;
+	uint32_t nfail;
+	struct heap_perf_hist_s malloc_hist;
+	struct heap_perf_hist_s free_hist;
+	void *slots[HEAP_PERF_THREAD_NSLOTS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct heap_perf_thread_s g_threads[HEAP_PERF_MAX_THREADS];
+static sem_t g_start;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void *heap_perf_thread(void *arg)
+{
+	struct heap_perf_thread_s *thread = (struct heap_perf_thread_s *)arg;
+	const struct heap_perf_allocator_s *allocator = thread->config->allocator;
+	uint32_t start;
+	uint32_t end;
+	uint32_t op;
+	void *mem;
+	int slot;
+
+	/* Wait until all threads are created so that they really run together */
+
+	while (sem_wait(&g_start) != OK && errno == EINTR);
+
+	for (op = 0; op < thread->config->nops; op++) {
+		slot = heap_perf_rand(&thread->seed) % HEAP_PERF_THREAD_NSLOTS;
+
+		if (thread->slots[slot] == NULL) {
+			size_t size = heap_perf_pick_size(thread->workload, &thread->seed);
+
+			start = heap_perf_now();
+			mem = allocator->malloc(size);
+			end = heap_perf_now();
+
+			if (mem == NULL) {
+				thread->nfail++;
+				continue;
+			}
+
+			heap_perf_hist_add(&thread->malloc_hist, end - start);
+			*(volatile uint8_t *)mem = (uint8_t)op;
+			thread->slots[slot] = mem;
+		} else {
+			mem = thread->slots[slot];
+			thread->slots[slot] = NULL;
+
+			start = heap_perf_now();
+			allocator->free(mem);
+			end = heap_perf_now();
+
+			heap_perf_hist_add(&thread->free_hist, end - start);
+		}
+	}
+
+	for (slot = 0; slot < HEAP_PERF_THREAD_NSLOTS; slot++) {
+		allocator->free(thread->slots[slot]);
+		thread->slots[slot] = NULL;
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: heap_perf_contention
+ *
+ * Description:
+ *   Run 'nthreads' round-robin threads of equal priority, each doing
+ *   'nops' operations on its own objects with the configured workload.
+ *   The latencies include the time spent waiting for the heap lock, so
+ *   comparing them with a single-thread run shows the cost of contention.
+ *
+ ****************************************************************************/
+
+int heap_perf_contention(const struct heap_perf_config_s *config)
+{
+	pthread_t tids[HEAP_PERF_MAX_THREADS];
+	struct heap_perf_hist_s malloc_hist;
+	struct heap_perf_hist_s free_hist;
+	const struct heap_perf_workload_s *workload;
+	struct sched_param param;
+	struct timespec ts1;
+	struct timespec ts2;
+	pthread_attr_t attr;
+	uint32_t elapsed;
+	uint32_t nops = 0;
+	uint32_t nfail = 0;
+	int nthreads = config->nthreads;
+	int ret;
+	int i;
+
+	workload = config->workload ? config->workload : heap_perf_find_workload("small");
+
+	printf("\n==== Contention ====\n");
+	printf("\n[%s] %s, %d threads, %u operations each, seed %u\n", workload->name, workload->desc,
+		nthreads, config->nops, config->seed);
+
+	sem_init(&g_start, 0, 0);
+
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, HEAP_PERF_THREAD_STACKSIZE);
+	pthread_attr_setschedpolicy(&attr, SCHED_RR);
+	param.sched_priority = SCHED_PRIORITY_DEFAULT;
+	pthread_attr_setschedparam(&attr, &param);
+
+	for (i = 0; i < nthreads; i++) {
+		memset(&g_threads[i], 0, sizeof(struct heap_perf_thread_s));
+		g_threads[i].config = config;
+		g_threads[i].workload = workload;
+		g_threads[i].seed = config->seed + i;
+		heap_perf_hist_init(&g_threads[i].malloc_hist);
+		heap_perf_hist_init(&g_threads[i].free_hist);
+
+		ret = pthread_create(&tids[i], &attr, heap_perf_thread, &g_threads[i]);
+		if (ret != OK) {
+			printf("  failed to create thread %d, errno %d\n", i, ret);
+			nthreads = i;
+			break;
+		}
+	}
+
+	pthread_attr_destroy(&attr);
+
+	clock_gettime(CLOCK_REALTIME, &ts1);
+	for (i = 0; i < nthreads; i++) {
+		sem_post(&g_start);
+	}
+
+	for (i = 0; i < nthreads; i++) {
+		pthread_join(tids[i], NULL);
+	}
+	clock_gettime(CLOCK_REALTIME, &ts2);
+
+	sem_destroy(&g_start);
+
+	if (nthreads == 0) {
+		return ERROR;
+	}
+
+	heap_perf_hist_init(&malloc_hist);
+	heap_perf_hist_init(&free_hist);
+	for (i = 0; i < nthreads; i++) {
+		heap_perf_hist_merge(&malloc_hist, &g_threads[i].malloc_hist);
+		heap_perf_hist_merge(&free_hist, &g_threads[i].free_hist);
+		nops += g_threads[i].malloc_hist.count + g_threads[i].free_hist.count;
+		nfail += g_threads[i].nfail;
+	}
+
+	heap_perf_hist_print("malloc", &malloc_hist);
+	heap_perf_hist_print("free", &free_hist);
+
+	elapsed = (ts2.tv_sec - ts1.tv_sec) * 1000 + (ts2.tv_nsec - ts1.tv_nsec) / 1000000;
+	printf("  %u operations in %u mseconds", nops, elapsed);
+	if (elapsed > 0) {
+		printf(", %u operations per second", (uint32_t)((uint64_t)nops * 1000 / elapsed));
+	}
+	printf(", %u allocations failed\n", nfail);
+
+	return OK;
+}
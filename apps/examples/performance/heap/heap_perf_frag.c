@@ -0,0 +1,154 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file heap_perf_frag.c
+
+/// @brief Follow the fragmentation of the heap over a long mixed-lifetime run.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "heap_perf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Objects are short-lived, replaced on nearly every operation, or
+ * long-lived, replaced once in HEAP_PERF_LONG_RATE operations.  Long-lived
+ * objects pin the heap between short-lived ones, which is what fragments it.
+ */
+
+#define HEAP_PERF_NSHORT       32
+#define HEAP_PERF_NLONG        (HEAP_PERF_NSLOTS - HEAP_PERF_NSHORT)
+#define HEAP_PERF_LONG_RATE    16
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static void *g_short[HEAP_PERF_NSHORT];
+static void *g_long[HEAP_PERF_NLONG];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void heap_perf_frag_sample(const struct heap_perf_config_s *config, uint32_t op, uint32_t nfail)
+{
+	struct mallinfo info;
+
+	config->allocator->mallinfo(&info);
+	printf(" %8u | %8d | %8d | %8d | %6d | %3d%% | %6u\n", op, info.uordblks, info.fordblks,
+		info.mxordblk, info.ordblks, info.fragratio, nfail);
+}
+
+/* Replace the object of a slot, returning false if the allocation failed */
+
+static bool heap_perf_frag_replace(const struct heap_perf_config_s *config, void **slot, uint32_t *seed)
+{
+	if (*slot != NULL) {
+		config->allocator->free(*slot);
+	}
+
+	*slot = config->allocator->malloc(heap_perf_pick_size(config->workload, seed));
+	return *slot != NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: heap_perf_frag
+ *
+ * Description:
+ *   Print the heap usage every 'interval' operations.  At the end all the
+ *   objects are freed and the free space must be back to the initial one,
+ *   otherwise the allocator leaked or failed to coalesce.
+ *
+ ****************************************************************************/
+
+int heap_perf_frag(const struct heap_perf_config_s *config)
+{
+	struct heap_perf_config_s run = *config;
+	struct mallinfo before;
+	struct mallinfo after;
+	uint32_t seed = config->seed;
+	uint32_t nfail = 0;
+	uint32_t op;
+	int i;
+
+	if (run.workload == NULL) {
+		run.workload = heap_perf_find_workload("mixed");
+	}
+
+	printf("\n==== Fragmentation ====\n");
+	printf("\n[%s] %s, %u operations, seed %u\n", run.workload->name, run.workload->desc, run.nops, run.seed);
+	printf("       Op |   Used   |   Free   | Largest  | Chunks | Frag | Failed\n");
+	printf("----------|----------|----------|----------|--------|------|-------\n");
+
+	memset(g_short, 0, sizeof(g_short));
+	memset(g_long, 0, sizeof(g_long));
+	run.allocator->mallinfo(&before);
+
+	for (op = 0; op < run.nops; op++) {
+		if (op % run.interval == 0) {
+			heap_perf_frag_sample(&run, op, nfail);
+		}
+
+		if (heap_perf_rand(&seed) % HEAP_PERF_LONG_RATE == 0) {
+			i = heap_perf_rand(&seed) % HEAP_PERF_NLONG;
+			if (!heap_perf_frag_replace(&run, &g_long[i], &seed)) {
+				nfail++;
+			}
+		} else {
+			i = heap_perf_rand(&seed) % HEAP_PERF_NSHORT;
+			if (!heap_perf_frag_replace(&run, &g_short[i], &seed)) {
+				nfail++;
+			}
+		}
+	}
+
+	heap_perf_frag_sample(&run, op, nfail);
+
+	for (i = 0; i < HEAP_PERF_NSHORT; i++) {
+		run.allocator->free(g_short[i]);
+		g_short[i] = NULL;
+	}
+
+	for (i = 0; i < HEAP_PERF_NLONG; i++) {
+		run.allocator->free(g_long[i]);
+		g_long[i] = NULL;
+	}
+
+	run.allocator->mallinfo(&after);
+	printf("  free space before %d, after %d, largest free chunk before %d, after %d\n",
+		before.fordblks, after.fordblks, before.mxordblk, after.mxordblk);
+
+	if (after.fordblks != before.fordblks) {
+		printf("  WARNING: free space not recovered, leak or other tasks allocating\n");
+	}
+
+	return OK;
+}
@@ -0,0 +1,151 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file heap_perf_latency.c
+
+/// @brief Measure the latency of each malloc() and free() under a size distribution.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "heap_perf.h"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static void *g_slots[HEAP_PERF_NSLOTS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* A run works on a table of live objects.  Each operation picks a random
+ * slot: an empty slot gets a new object of a size drawn from the workload,
+ * a used slot is freed.  The heap thus settles around half of the slots in
+ * use, with random lifetimes, which is closer to a real system than
+ * allocating and freeing in batches.
+ */
+
+static int heap_perf_latency_run(const struct heap_perf_config_s *config, const struct heap_perf_workload_s *workload)
+{
+	const struct heap_perf_allocator_s *allocator = config->allocator;
+	struct heap_perf_hist_s malloc_hist;
+	struct heap_perf_hist_s free_hist;
+	uint32_t seed = config->seed;
+	uint32_t nfail = 0;
+	uint64_t bytes = 0;
+	uint32_t start;
+	uint32_t end;
+	uint32_t op;
+	void *mem;
+	size_t size;
+	int slot;
+
+	heap_perf_hist_init(&malloc_hist);
+	heap_perf_hist_init(&free_hist);
+	memset(g_slots, 0, sizeof(g_slots));
+
+	printf("\n[%s] %s, %u operations, seed %u\n", workload->name, workload->desc, config->nops, config->seed);
+
+	for (op = 0; op < config->nops; op++) {
+		slot = heap_perf_rand(&seed) % HEAP_PERF_NSLOTS;
+
+		if (g_slots[slot] == NULL) {
+			size = heap_perf_pick_size(workload, &seed);
+
+			start = heap_perf_now();
+			mem = allocator->malloc(size);
+			end = heap_perf_now();
+
+			if (mem == NULL) {
+				nfail++;
+				continue;
+			}
+
+			heap_perf_hist_add(&malloc_hist, end - start);
+
+			/* Touch the object so that a lazy allocator cannot cheat */
+
+			*(volatile uint8_t *)mem = (uint8_t)op;
+			g_slots[slot] = mem;
+			bytes += size;
+		} else {
+			mem = g_slots[slot];
+			g_slots[slot] = NULL;
+
+			start = heap_perf_now();
+			allocator->free(mem);
+			end = heap_perf_now();
+
+			heap_perf_hist_add(&free_hist, end - start);
+		}
+	}
+
+	for (slot = 0; slot < HEAP_PERF_NSLOTS; slot++) {
+		if (g_slots[slot] != NULL) {
+			allocator->free(g_slots[slot]);
+			g_slots[slot] = NULL;
+		}
+	}
+
+	heap_perf_hist_print("malloc", &malloc_hist);
+	heap_perf_hist_print("free", &free_hist);
+	printf("  allocated %llu bytes, %u allocations failed\n", (unsigned long long)bytes, nfail);
+
+	if (malloc_hist.count + free_hist.count > 0) {
+		printf("  throughput %u %s per operation\n",
+			(uint32_t)((malloc_hist.sum + free_hist.sum) / (malloc_hist.count + free_hist.count)),
+			heap_perf_timer_unit());
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: heap_perf_latency
+ *
+ * Description:
+ *   Run the latency benchmark on the configured workload, or on all of them.
+ *
+ ****************************************************************************/
+
+int heap_perf_latency(const struct heap_perf_config_s *config)
+{
+	int i;
+
+	printf("\n==== Latency ====\n");
+
+	if (config->workload != NULL) {
+		return heap_perf_latency_run(config, config->workload);
+	}
+
+	for (i = 0; i < g_heap_perf_nworkloads; i++) {
+		heap_perf_latency_run(config, &g_heap_perf_workloads[i]);
+	}
+
+	return OK;
+}
@@ -18,7 +18,7 @@
 
 /// @file heap_performance_test.c
 
-/// @brief Measure the elapsed time while simply repeating memory allocation and release.
+/// @brief Benchmark suite of the heap allocator: latency, contention and fragmentation.
 
 /****************************************************************************
  * Included Files
@@ -26,44 +26,129 @@
 #include <tinyara/config.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <tinyara/mm/mm.h>
+
+#include "heap_perf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
 
 #define NUM_ALLOC 100
 
-static int heap_performance_test(int argc, char *argv[])
+#define HEAP_PERF_DEFAULT_SEED     0x12345678
+#define HEAP_PERF_DEFAULT_INTERVAL 1000
+
+#define HEAP_PERF_TEST_BASIC       (1 << 0)
+#define HEAP_PERF_TEST_LATENCY     (1 << 1)
+#define HEAP_PERF_TEST_CONTENTION  (1 << 2)
+#define HEAP_PERF_TEST_FRAG        (1 << 3)
+#define HEAP_PERF_TEST_ALL         (HEAP_PERF_TEST_LATENCY | HEAP_PERF_TEST_CONTENTION | HEAP_PERF_TEST_FRAG)
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void heap_perf_umm_mallinfo(struct mallinfo *info);
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_MM_KERNEL_HEAP)
+static void heap_perf_kmm_mallinfo(struct mallinfo *info);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct heap_perf_allocator_s g_allocators[] = {
+	{ "umm", malloc, free, heap_perf_umm_mallinfo },
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_MM_KERNEL_HEAP)
+	/* The kernel heap is only reachable from an application in a flat build */
+
+	{ "kmm", kmm_malloc, kmm_free, heap_perf_kmm_mallinfo },
+#endif
+};
+
+#define NALLOCATORS (int)(sizeof(g_allocators) / sizeof(g_allocators[0]))
+
+static struct heap_perf_config_s g_config;
+static int g_tests;
+static int g_interval = 1;
+static int g_repeat = NUM_ALLOC;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void heap_perf_umm_mallinfo(struct mallinfo *info)
+{
+#ifdef CONFIG_CAN_PASS_STRUCTS
+	*info = mallinfo();
+#else
+	(void)mallinfo(info);
+#endif
+}
+
+#if defined(CONFIG_BUILD_FLAT) && defined(CONFIG_MM_KERNEL_HEAP)
+static void heap_perf_kmm_mallinfo(struct mallinfo *info)
+{
+#ifdef CONFIG_CAN_PASS_STRUCTS
+	*info = kmm_mallinfo();
+#else
+	(void)kmm_mallinfo(info);
+#endif
+}
+#endif
+
+/* Print the allocator options, so that results of different builds can be
+ * told apart and compared.
+ */
+
+static void heap_perf_print_config(void)
+{
+	printf("Allocator %s, timer unit %s, options:", g_config.allocator->name, heap_perf_timer_unit());
+#ifdef CONFIG_MM_SMALL
+	printf(" MM_SMALL");
+#endif
+#ifdef CONFIG_MM_TLSF_INDEX
+	printf(" MM_TLSF_INDEX");
+#endif
+#ifdef CONFIG_MM_PERCPU_CACHE
+	printf(" MM_PERCPU_CACHE");
+#endif
+#ifdef CONFIG_MM_PROFILER
+	printf(" MM_PROFILER");
+#endif
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	printf(" DEBUG_MM_HEAPINFO");
+#endif
+#ifdef CONFIG_SMP
+	printf(" SMP(%d)", CONFIG_SMP_NCPUS);
+#endif
+	printf(" KMM_NHEAPS(%d)\n", CONFIG_KMM_NHEAPS);
+}
+
+/* Measure the elapsed time while simply repeating memory allocation and
+ * release.  This is the original test of this example.
+ */
+
+static int heap_perf_basic(int interval, int repeat)
 {
 	struct timespec ts1, ts2;
-	int repeat = NUM_ALLOC;
 	int size = 32;
 	int i, j, k;
-	char *data[100];
+	char *data[NUM_ALLOC];
 	int test_repeat = 11;
 	uint32_t elapsed = 0;
 	uint32_t total_elapsed = 0;
 	int sizes[11] = {16, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192};
-	int interval = 1;
 
 	for (j = 0; j < NUM_ALLOC; ++j) {
 		data[j] = NULL;
 	}
 
-	if (argc == 4) {
-		int in = strtol(argv[2], (char **)NULL, 10);
-		if (in > 0) {
-			interval = in;
-		}
-		in = strtol(argv[3], (char **)NULL, 10);
-		if (in > 0) {
-			repeat = in;
-		}
-	} else {
-		printf("Usage:	%s param1 param2\n", argv[1]);
-		printf("	param1 is the interval between tests each of which handles a different size.\n");
-		printf("	param2 is the number of repetition of one experiment.\n");
-		printf("	In one experiment, param1-sized memory is allocated a hundred times and then released.\n\n");
-		printf("At this time, %s will be performed with default values.\n\n", argv[1]);
-	}
-
+	printf("\n==== Basic ====\n");
 	printf("\nTest with interval %d, repetition %d.\n", interval, repeat);
 	printf("Elapsed time doing a cycle of malloc() and free() %u times:\n", NUM_ALLOC * repeat);
 
@@ -76,17 +161,17 @@ static int heap_performance_test(int argc, char *argv[])
 
 		for (i = 0; i < repeat; ++i) {
 			for (j = 0; j < NUM_ALLOC; ++j) {
-				data[j] = (char *)malloc(size);
+				data[j] = (char *)g_config.allocator->malloc(size);
 				if (data[j] == NULL) {
 					printf("With size %d, %d-th, Test failed due to malloc failure.\n", size, j);
 					for (i = 0; i < j; ++i) {
-						free(data[i]);
+						g_config.allocator->free(data[i]);
 					}
 					return 0;
 				}
 			}
 			for (j = 0; j < NUM_ALLOC; ++j) {
-				free(data[j]);
+				g_config.allocator->free(data[j]);
 			}
 		}
 		if (clock_gettime(CLOCK_REALTIME, &ts2) == -1) {
@@ -108,16 +193,158 @@ static int heap_performance_test(int argc, char *argv[])
 	return 0;
 }
 
+static int heap_performance_test(int argc, char *argv[])
+{
+	heap_perf_timer_init();
+	heap_perf_print_config();
+
+	if (g_tests & HEAP_PERF_TEST_BASIC) {
+		heap_perf_basic(g_interval, g_repeat);
+	}
+
+	if (g_tests & HEAP_PERF_TEST_LATENCY) {
+		heap_perf_latency(&g_config);
+	}
+
+	if (g_tests & HEAP_PERF_TEST_CONTENTION) {
+		heap_perf_contention(&g_config);
+	}
+
+	if (g_tests & HEAP_PERF_TEST_FRAG) {
+		heap_perf_frag(&g_config);
+	}
+
+	printf("\nHeap performance test done.\n");
+	return 0;
+}
+
+static void show_usage(const char *prog)
+{
+	int i;
+
+	printf("\nUsage: %s [OPTIONS] [basic|latency|contention|frag|all] [interval repeat]\n", prog);
+	printf("\nOptions:\n");
+	printf(" -a ALLOCATOR  Allocator to test, umm (default)");
+	for (i = 1; i < NALLOCATORS; i++) {
+		printf(" or %s", g_allocators[i].name);
+	}
+	printf("\n");
+	printf(" -w WORKLOAD   Size distribution, all of them by default:\n");
+	for (i = 0; i < g_heap_perf_nworkloads; i++) {
+		printf("               %-6s %s\n", g_heap_perf_workloads[i].name, g_heap_perf_workloads[i].desc);
+	}
+	printf(" -n NOPS       Operations per run (default %d)\n", CONFIG_EXAMPLES_HEAP_PERFORMANCE_NOPS);
+	printf(" -t NTHREADS   Threads of the contention run, at most %d (default %d)\n", HEAP_PERF_MAX_THREADS, CONFIG_EXAMPLES_HEAP_PERFORMANCE_NTHREADS);
+	printf(" -s SEED       Seed of the random sequence (default 0x%x)\n", HEAP_PERF_DEFAULT_SEED);
+	printf(" -i INTERVAL   Operations between fragmentation samples (default %d)\n", HEAP_PERF_DEFAULT_INTERVAL);
+	printf("\nbasic repeats the allocation and release of a hundred objects of each size,\n");
+	printf("'repeat' times, sleeping 'interval' seconds between sizes.\n");
+	printf("With the same seed and build, two runs do the same sequence of operations.\n");
+}
+
 #ifdef CONFIG_BUILD_KERNEL
 int main(int argc, FAR char *argv[])
 #else
 int heaptest_main(int argc, char *argv[])
 #endif
 {
+	int opt;
+	int i;
+
 	printf("Heap Performance Test!!\n");
-	task_create("Heap performance test", 100, 6144, heap_performance_test, argv);
+
+	g_config.allocator = &g_allocators[0];
+	g_config.workload = NULL;
+	g_config.nops = CONFIG_EXAMPLES_HEAP_PERFORMANCE_NOPS;
+	g_config.nthreads = CONFIG_EXAMPLES_HEAP_PERFORMANCE_NTHREADS;
+	g_config.seed = HEAP_PERF_DEFAULT_SEED;
+	g_config.interval = HEAP_PERF_DEFAULT_INTERVAL;
+	g_tests = HEAP_PERF_TEST_ALL;
+	g_interval = 1;
+	g_repeat = NUM_ALLOC;
+
+	while ((opt = getopt(argc, argv, "a:w:n:t:s:i:")) != ERROR) {
+		switch (opt) {
+		case 'a':
+			for (i = 0; i < NALLOCATORS; i++) {
+				if (strcmp(optarg, g_allocators[i].name) == 0) {
+					g_config.allocator = &g_allocators[i];
+					break;
+				}
+			}
+			if (i == NALLOCATORS) {
+				printf("Unknown allocator %s\n", optarg);
+				goto usage;
+			}
+			break;
+		case 'w':
+			g_config.workload = heap_perf_find_workload(optarg);
+			if (g_config.workload == NULL) {
+				printf("Unknown workload %s\n", optarg);
+				goto usage;
+			}
+			break;
+		case 'n':
+			g_config.nops = strtoul(optarg, NULL, 10);
+			break;
+		case 't':
+			g_config.nthreads = atoi(optarg);
+			break;
+		case 's':
+			g_config.seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'i':
+			g_config.interval = atoi(optarg);
+			break;
+		default:
+			goto usage;
+		}
+	}
+
+	if (g_config.nops == 0 || g_config.nthreads <= 0 || g_config.nthreads > HEAP_PERF_MAX_THREADS || g_config.interval <= 0) {
+		printf("Invalid option value\n");
+		goto usage;
+	}
+
+	/* xorshift never leaves zero */
+
+	if (g_config.seed == 0) {
+		g_config.seed = HEAP_PERF_DEFAULT_SEED;
+	}
+
+	if (optind < argc) {
+		if (strcmp(argv[optind], "basic") == 0) {
+			g_tests = HEAP_PERF_TEST_BASIC;
+			if (argc - optind == 3) {
+				int in = strtol(argv[optind + 1], (char **)NULL, 10);
+				if (in > 0) {
+					g_interval = in;
+				}
+				in = strtol(argv[optind + 2], (char **)NULL, 10);
+				if (in > 0) {
+					g_repeat = in;
+				}
+			}
+		} else if (strcmp(argv[optind], "latency") == 0) {
+			g_tests = HEAP_PERF_TEST_LATENCY;
+		} else if (strcmp(argv[optind], "contention") == 0) {
+			g_tests = HEAP_PERF_TEST_CONTENTION;
+		} else if (strcmp(argv[optind], "frag") == 0) {
+			g_tests = HEAP_PERF_TEST_FRAG;
+		} else if (strcmp(argv[optind], "all") == 0) {
+			g_tests = HEAP_PERF_TEST_ALL;
+		} else {
+			goto usage;
+		}
+	}
+
+	task_create("Heap performance test", 100, 6144, heap_performance_test, NULL);
 
 	sleep(1);
 
 	return 0;
+
+usage:
+	show_usage(argv[0]);
+	return -1;
 }
@@ -0,0 +1,362 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file json_performance_test.c
+
+/// @brief Benchmark of the JSON parsers and writers.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <json/cJSON.h>
+#include <json/json_stream.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define JSON_PERF_CLOCK        CLOCK_MONOTONIC
+#else
+#define JSON_PERF_CLOCK        CLOCK_REALTIME
+#endif
+
+#define JSON_PERF_STRBUF       128	/* Longest string of the streaming parser */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* What the streaming parser counts of the document, to check it */
+
+struct json_perf_count_s {
+	int tokens;
+	int strings;
+	double sum;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *g_genres[] = {
+	"pop", "rock", "jazz", "classical", "k-pop", "ambient"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t json_perf_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(JSON_PERF_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void json_perf_print(const char *func, const char *impl, int tracks, int iterations, uint64_t elapsed, size_t bytes)
+{
+	unsigned long us = (unsigned long)(elapsed / iterations);
+
+	printf("JSONPERF,%s,%s,%d,time,%lu,us\n", func, impl, tracks, us);
+	printf("JSONPERF,%s,%s,%d,throughput,%lu,KB/s\n", func, impl, tracks, us ? (unsigned long)((uint64_t)bytes * 1000000 / 1024 / us) : 0);
+}
+
+/* The metadata of an audio playlist, as the media framework and the cloud
+ * payloads hold them.
+ */
+
+static cJSON *json_perf_cjson_build(int tracks)
+{
+	cJSON *root = cJSON_CreateObject();
+	cJSON *list = cJSON_CreateArray();
+	cJSON *track;
+	char title[32];
+	int i;
+
+	cJSON_AddStringToObject(root, "playlist", "Benchmark \"mix\"");
+	cJSON_AddNumberToObject(root, "version", 3);
+	cJSON_AddItemToObject(root, "tracks", list);
+
+	for (i = 0; i < tracks; i++) {
+		snprintf(title, sizeof(title), "Track %d\tlive", i);
+		track = cJSON_CreateObject();
+		cJSON_AddNumberToObject(track, "id", 100000 + i);
+		cJSON_AddStringToObject(track, "title", title);
+		cJSON_AddStringToObject(track, "artist", "Various Artists");
+		cJSON_AddStringToObject(track, "genre", g_genres[i % 6]);
+		cJSON_AddNumberToObject(track, "duration", 180000 + i * 1000);
+		cJSON_AddNumberToObject(track, "samplerate", 48000);
+		cJSON_AddNumberToObject(track, "gain", -6.5 + i * 0.25);
+		cJSON_AddBoolToObject(track, "explicit", i % 5 == 0);
+		cJSON_AddNullToObject(track, "artwork");
+		cJSON_AddItemToArray(list, track);
+	}
+
+	return root;
+}
+
+static int json_perf_stream_build(struct json_writer_s *w, int tracks)
+{
+	char title[32];
+	int i;
+
+	json_writer_object_start(w);
+	json_writer_key(w, "playlist");
+	json_writer_string(w, "Benchmark \"mix\"");
+	json_writer_key(w, "version");
+	json_writer_int(w, 3);
+	json_writer_key(w, "tracks");
+	json_writer_array_start(w);
+
+	for (i = 0; i < tracks; i++) {
+		snprintf(title, sizeof(title), "Track %d\tlive", i);
+		json_writer_object_start(w);
+		json_writer_key(w, "id");
+		json_writer_int(w, 100000 + i);
+		json_writer_key(w, "title");
+		json_writer_string(w, title);
+		json_writer_key(w, "artist");
+		json_writer_string(w, "Various Artists");
+		json_writer_key(w, "genre");
+		json_writer_string(w, g_genres[i % 6]);
+		json_writer_key(w, "duration");
+		json_writer_int(w, 180000 + i * 1000);
+		json_writer_key(w, "samplerate");
+		json_writer_int(w, 48000);
+		json_writer_key(w, "gain");
+		json_writer_double(w, -6.5 + i * 0.25);
+		json_writer_key(w, "explicit");
+		json_writer_bool(w, i % 5 == 0);
+		json_writer_key(w, "artwork");
+		json_writer_null(w);
+		json_writer_object_end(w);
+	}
+
+	json_writer_array_end(w);
+	json_writer_object_end(w);
+	return json_writer_finish(w);
+}
+
+static int json_perf_token(void *arg)
+{
+	((struct json_perf_count_s *)arg)->tokens++;
+	return 0;
+}
+
+static int json_perf_string(void *arg, const char *str, size_t len)
+{
+	((struct json_perf_count_s *)arg)->tokens++;
+	((struct json_perf_count_s *)arg)->strings++;
+	return 0;
+}
+
+static int json_perf_number(void *arg, double value, const char *text)
+{
+	((struct json_perf_count_s *)arg)->tokens++;
+	((struct json_perf_count_s *)arg)->sum += value;
+	return 0;
+}
+
+static int json_perf_bool(void *arg, bool value)
+{
+	((struct json_perf_count_s *)arg)->tokens++;
+	return 0;
+}
+
+static const struct json_sax_s g_json_perf_sax = {
+	json_perf_token, json_perf_token, json_perf_token, json_perf_token,
+	json_perf_string, json_perf_string, json_perf_number, json_perf_bool,
+	json_perf_token
+};
+
+/* The sum of the numbers of a tree */
+
+static double json_perf_cjson_sum(const cJSON *item)
+{
+	double sum = 0;
+
+	for (; item != NULL; item = item->next) {
+		if (cJSON_IsNumber(item)) {
+			sum += item->valuedouble;
+		}
+		sum += json_perf_cjson_sum(item->child);
+	}
+
+	return sum;
+}
+
+static int json_perf_run(int tracks, int iterations)
+{
+	struct json_perf_count_s count;
+	struct json_writer_s writer;
+	cJSON *root;
+	char *reference;
+	char *text;
+	char *buf;
+	char strbuf[JSON_PERF_STRBUF];
+	uint64_t start;
+	double sum;
+	size_t len;
+	size_t size;
+	int errors = 0;
+	int ret;
+	int i;
+
+	/* The reference text, from cJSON */
+
+	root = json_perf_cjson_build(tracks);
+	reference = cJSON_PrintUnformatted(root);
+	sum = json_perf_cjson_sum(root);
+	cJSON_Delete(root);
+	if (reference == NULL) {
+		printf("Cannot build the document of %d tracks\n", tracks);
+		return 1;
+	}
+
+	len = strlen(reference);
+	size = len + 1;
+	buf = (char *)malloc(size);
+	if (buf == NULL) {
+		printf("Cannot allocate %lu bytes\n", (unsigned long)size);
+		cJSON_free(reference);
+		return 1;
+	}
+
+	printf("JSONPERF,document,all,%d,size,%lu,bytes\n", tracks, (unsigned long)len);
+
+	/* Serialization: tree and print, against the writer */
+
+	start = json_perf_now();
+	for (i = 0; i < iterations; i++) {
+		root = json_perf_cjson_build(tracks);
+		text = cJSON_PrintUnformatted(root);
+		cJSON_Delete(root);
+		if (text == NULL || strcmp(text, reference) != 0) {
+			errors++;
+		}
+		cJSON_free(text);
+	}
+	json_perf_print("serialize", "cjson", tracks, iterations, json_perf_now() - start, len);
+
+	start = json_perf_now();
+	for (i = 0; i < iterations; i++) {
+		json_writer_init(&writer, buf, size, NULL, NULL);
+		ret = json_perf_stream_build(&writer, tracks);
+		if (ret != (int)len || strcmp(buf, reference) != 0) {
+			errors++;
+		}
+	}
+	json_perf_print("serialize", "writer", tracks, iterations, json_perf_now() - start, len);
+
+	/* Parse: cJSON, cJSON in an arena, and the streaming parser */
+
+	start = json_perf_now();
+	for (i = 0; i < iterations; i++) {
+		root = cJSON_Parse(reference);
+		if (root == NULL || json_perf_cjson_sum(root) != sum) {
+			errors++;
+		}
+		cJSON_Delete(root);
+	}
+	json_perf_print("parse", "cjson", tracks, iterations, json_perf_now() - start, len);
+
+	start = json_perf_now();
+	for (i = 0; i < iterations; i++) {
+		root = cJSON_ParseWithArena(reference);
+		if (root == NULL || json_perf_cjson_sum(root) != sum) {
+			errors++;
+		}
+		cJSON_Delete(root);
+	}
+	json_perf_print("parse", "cjson_arena", tracks, iterations, json_perf_now() - start, len);
+
+	start = json_perf_now();
+	for (i = 0; i < iterations; i++) {
+		memset(&count, 0, sizeof(count));
+		ret = json_parse(reference, len, &g_json_perf_sax, &count, strbuf, sizeof(strbuf));
+		if (ret != 0 || count.sum != sum || count.strings != 4 + tracks * 12) {
+			errors++;
+		}
+	}
+	json_perf_print("parse", "stream", tracks, iterations, json_perf_now() - start, len);
+
+	printf("JSONPERF,check,all,%d,errors,%d,count\n", tracks, errors);
+
+	free(buf);
+	cJSON_free(reference);
+	return errors;
+}
+
+static void show_usage(const char *prog)
+{
+	printf("\nUsage: %s [-t TRACKS] [-i ITERATIONS]\n", prog);
+	printf("\nOptions:\n");
+	printf(" -t TRACKS       Tracks of the document (default %d)\n", CONFIG_EXAMPLES_JSON_PERFORMANCE_TRACKS);
+	printf(" -i ITERATIONS   Times each operation is timed (default %d)\n", CONFIG_EXAMPLES_JSON_PERFORMANCE_ITERATIONS);
+	printf("\nResults are printed as lines of comma separated values starting with JSONPERF.\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int jsonperf_main(int argc, char *argv[])
+#endif
+{
+	int tracks = CONFIG_EXAMPLES_JSON_PERFORMANCE_TRACKS;
+	int iterations = CONFIG_EXAMPLES_JSON_PERFORMANCE_ITERATIONS;
+	int errors;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "t:i:")) != ERROR) {
+		switch (opt) {
+		case 't':
+			tracks = (int)strtoul(optarg, NULL, 0);
+			break;
+		case 'i':
+			iterations = (int)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			show_usage(argv[0]);
+			return ERROR;
+		}
+	}
+
+	if (tracks < 1 || iterations < 1) {
+		show_usage(argv[0]);
+		return ERROR;
+	}
+
+	errors = json_perf_run(tracks, iterations);
+	printf("\nJSON performance test done, %d errors.\n", errors);
+	return errors == 0 ? OK : ERROR;
+}
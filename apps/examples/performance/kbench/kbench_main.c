@@ -0,0 +1,706 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file kbench_main.c
+
+/// @brief Measure the cost of the kernel primitives, printed as CSV.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sched.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <mqueue.h>
+#ifdef CONFIG_BUILD_FLAT
+#include <tinyara/wdog.h>
+#endif
+#include <tinyara/wqueue.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define KBENCH_NLOOPS    1000
+#define KBENCH_NRUNS     5
+
+/* The threads of the tests.  The work queue threads are higher. */
+
+#define KBENCH_PRIORITY  200
+#define KBENCH_STACKSIZE 2048
+
+#define KBENCH_MQ_MSGSIZE 16
+#define KBENCH_MQ_NAME1  "kbench1"
+#define KBENCH_MQ_NAME2  "kbench2"
+
+/* Long enough for no watchdog to expire */
+
+#define KBENCH_WDOG_DELAY (10 * CLOCKS_PER_SEC)
+
+#if defined(CONFIG_SCHED_WORKQUEUE) && (defined(CONFIG_BUILD_FLAT) || defined(CONFIG_SCHED_USRWORK))
+#define KBENCH_WORKQUEUE
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A test runs 'nloops' rounds and returns the time they took, in ns, or 0
+ * on a failure.  The operations of a round are counted by 'nops'.  A test
+ * of two threads runs the second one on 'cpu', and the first one on CPU 0.
+ */
+
+struct kbench_s {
+	const char *name;
+	uint64_t (*run)(int nloops, int cpu);
+	int nops;
+	bool pair;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static sem_t g_sem1;
+static sem_t g_sem2;
+static pthread_mutex_t g_mutex;
+static mqd_t g_mq1;
+static mqd_t g_mq2;
+static volatile int g_nsignals;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t kbench_nsec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static int kbench_thread(FAR pthread_t *thread, pthread_startroutine_t entry, int nloops, int cpu)
+{
+	pthread_attr_t attr;
+	struct sched_param param;
+	int ret;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, KBENCH_STACKSIZE);
+	param.sched_priority = KBENCH_PRIORITY;
+	pthread_attr_setschedparam(&attr, &param);
+	pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+#ifdef CONFIG_SMP
+	if (cpu >= 0) {
+		cpu_set_t cpuset;
+
+		CPU_ZERO(&cpuset);
+		CPU_SET(cpu, &cpuset);
+		pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpuset);
+	}
+#endif
+
+	ret = pthread_create(thread, &attr, entry, (pthread_addr_t)nloops);
+	pthread_attr_destroy(&attr);
+	if (ret != OK) {
+		printf("# Failed to create a thread, errno %d\n", ret);
+	}
+
+	return ret;
+}
+
+static void kbench_sem_init(void)
+{
+	/* The semaphores are used for signaling, without priority inheritance */
+
+	sem_init(&g_sem1, 0, 0);
+	sem_setprotocol(&g_sem1, SEM_PRIO_NONE);
+	sem_init(&g_sem2, 0, 0);
+	sem_setprotocol(&g_sem2, SEM_PRIO_NONE);
+}
+
+static void kbench_sem_destroy(void)
+{
+	sem_destroy(&g_sem1);
+	sem_destroy(&g_sem2);
+}
+
+/* sem_post() then sem_wait() of the same thread, which does not block */
+
+static uint64_t kbench_sem_post_wait(int nloops, int cpu)
+{
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	kbench_sem_init();
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		sem_post(&g_sem1);
+		sem_wait(&g_sem1);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	kbench_sem_destroy();
+	return elapsed;
+}
+
+/* Two threads waking each other: an operation is a post to the wake-up of
+ * the waiter.
+ */
+
+static pthread_addr_t kbench_sem_peer(pthread_addr_t arg)
+{
+	int nloops = (int)arg;
+	int i;
+
+	for (i = 0; i < nloops; i++) {
+		sem_wait(&g_sem1);
+		sem_post(&g_sem2);
+	}
+
+	return NULL;
+}
+
+static uint64_t kbench_sem_wake(int nloops, int cpu)
+{
+	pthread_t peer;
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	kbench_sem_init();
+	if (kbench_thread(&peer, kbench_sem_peer, nloops, cpu) != OK) {
+		kbench_sem_destroy();
+		return 0;
+	}
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		sem_post(&g_sem1);
+		sem_wait(&g_sem2);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	pthread_join(peer, NULL);
+	kbench_sem_destroy();
+	return elapsed;
+}
+
+static uint64_t kbench_mutex(int nloops, int cpu)
+{
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	pthread_mutex_init(&g_mutex, NULL);
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		pthread_mutex_lock(&g_mutex);
+		pthread_mutex_unlock(&g_mutex);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	pthread_mutex_destroy(&g_mutex);
+	return elapsed;
+}
+
+/* Two threads taking turns at a mutex: each holds it across a yield, so
+ * that the other finds it locked and is handed it at the unlock.
+ */
+
+static pthread_addr_t kbench_mutex_peer(pthread_addr_t arg)
+{
+	int nloops = (int)arg;
+	int i;
+
+	for (i = 0; i < nloops; i++) {
+		pthread_mutex_lock(&g_mutex);
+		sched_yield();
+		pthread_mutex_unlock(&g_mutex);
+	}
+
+	return NULL;
+}
+
+static uint64_t kbench_mutex_contended(int nloops, int cpu)
+{
+	pthread_t peer;
+	uint64_t t0;
+	uint64_t elapsed;
+
+	pthread_mutex_init(&g_mutex, NULL);
+	if (kbench_thread(&peer, kbench_mutex_peer, nloops, cpu) != OK) {
+		pthread_mutex_destroy(&g_mutex);
+		return 0;
+	}
+
+	t0 = kbench_nsec();
+	kbench_mutex_peer((pthread_addr_t)nloops);
+	pthread_join(peer, NULL);
+	elapsed = kbench_nsec() - t0;
+
+	pthread_mutex_destroy(&g_mutex);
+	return elapsed;
+}
+
+static int kbench_mq_open(void)
+{
+	struct mq_attr attr;
+
+	attr.mq_maxmsg = 1;
+	attr.mq_msgsize = KBENCH_MQ_MSGSIZE;
+	attr.mq_flags = 0;
+
+	g_mq1 = mq_open(KBENCH_MQ_NAME1, O_RDWR | O_CREAT, 0666, &attr);
+	if (g_mq1 == (mqd_t)ERROR) {
+		printf("# Failed to open a message queue\n");
+		return ERROR;
+	}
+
+	g_mq2 = mq_open(KBENCH_MQ_NAME2, O_RDWR | O_CREAT, 0666, &attr);
+	if (g_mq2 == (mqd_t)ERROR) {
+		printf("# Failed to open a message queue\n");
+		mq_close(g_mq1);
+		mq_unlink(KBENCH_MQ_NAME1);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+static void kbench_mq_close(void)
+{
+	mq_close(g_mq1);
+	mq_close(g_mq2);
+	mq_unlink(KBENCH_MQ_NAME1);
+	mq_unlink(KBENCH_MQ_NAME2);
+}
+
+/* mq_send() then mq_receive() of the same thread, which does not block */
+
+static uint64_t kbench_mq_send_receive(int nloops, int cpu)
+{
+	char msg[KBENCH_MQ_MSGSIZE];
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	if (kbench_mq_open() != OK) {
+		return 0;
+	}
+
+	memset(msg, 0, sizeof(msg));
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		mq_send(g_mq1, msg, sizeof(msg), 0);
+		mq_receive(g_mq1, msg, sizeof(msg), NULL);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	kbench_mq_close();
+	return elapsed;
+}
+
+/* Two threads sending messages to each other: an operation is a send to
+ * the reception by the waiter.
+ */
+
+static pthread_addr_t kbench_mq_peer(pthread_addr_t arg)
+{
+	char msg[KBENCH_MQ_MSGSIZE];
+	int nloops = (int)arg;
+	int i;
+
+	for (i = 0; i < nloops; i++) {
+		mq_receive(g_mq1, msg, sizeof(msg), NULL);
+		mq_send(g_mq2, msg, sizeof(msg), 0);
+	}
+
+	return NULL;
+}
+
+static uint64_t kbench_mq_wake(int nloops, int cpu)
+{
+	char msg[KBENCH_MQ_MSGSIZE];
+	pthread_t peer;
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	if (kbench_mq_open() != OK) {
+		return 0;
+	}
+
+	if (kbench_thread(&peer, kbench_mq_peer, nloops, cpu) != OK) {
+		kbench_mq_close();
+		return 0;
+	}
+
+	memset(msg, 0, sizeof(msg));
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		mq_send(g_mq1, msg, sizeof(msg), 0);
+		mq_receive(g_mq2, msg, sizeof(msg), NULL);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	pthread_join(peer, NULL);
+	kbench_mq_close();
+	return elapsed;
+}
+
+#ifndef CONFIG_DISABLE_SIGNALS
+static void kbench_signal_handler(int signo)
+{
+	g_nsignals++;
+}
+
+/* A signal to the running thread, delivered to its handler at once */
+
+static uint64_t kbench_signal_self(int nloops, int cpu)
+{
+	struct sigaction act;
+	struct sigaction oact;
+	pthread_t self = pthread_self();
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	memset(&act, 0, sizeof(act));
+	act.sa_handler = kbench_signal_handler;
+	sigemptyset(&act.sa_mask);
+	sigaction(SIGUSR2, &act, &oact);
+	g_nsignals = 0;
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		pthread_kill(self, SIGUSR2);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	sigaction(SIGUSR2, &oact, NULL);
+	if (g_nsignals != nloops) {
+		printf("# %d signals of %d delivered\n", g_nsignals, nloops);
+		return 0;
+	}
+
+	return elapsed;
+}
+
+/* A signal to a thread waiting in sigwaitinfo(), which answers with a
+ * post: an operation is a signal to the wake-up of the waiter and the post
+ * back.
+ */
+
+static pthread_addr_t kbench_signal_peer(pthread_addr_t arg)
+{
+	sigset_t set;
+	int nloops = (int)arg;
+	int i;
+
+	sigemptyset(&set);
+	sigaddset(&set, SIGUSR1);
+	pthread_sigmask(SIG_BLOCK, &set, NULL);
+	sem_post(&g_sem2);
+
+	for (i = 0; i < nloops; i++) {
+		sigwaitinfo(&set, NULL);
+		sem_post(&g_sem2);
+	}
+
+	return NULL;
+}
+
+static uint64_t kbench_signal_wake(int nloops, int cpu)
+{
+	pthread_t peer;
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	kbench_sem_init();
+	if (kbench_thread(&peer, kbench_signal_peer, nloops, cpu) != OK) {
+		kbench_sem_destroy();
+		return 0;
+	}
+
+	/* Wait for the signal to be blocked in the peer */
+
+	sem_wait(&g_sem2);
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		pthread_kill(peer, SIGUSR1);
+		sem_wait(&g_sem2);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	pthread_join(peer, NULL);
+	kbench_sem_destroy();
+	return elapsed;
+}
+#endif
+
+static pthread_addr_t kbench_pthread_entry(pthread_addr_t arg)
+{
+	return NULL;
+}
+
+static uint64_t kbench_pthread_create_join(int nloops, int cpu)
+{
+	pthread_t thread;
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		if (kbench_thread(&thread, kbench_pthread_entry, 0, cpu) != OK) {
+			return 0;
+		}
+
+		pthread_join(thread, NULL);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	return elapsed;
+}
+
+#ifdef CONFIG_BUILD_FLAT
+static void kbench_wdog_expired(int argc, uint32_t arg)
+{
+}
+
+static uint64_t kbench_wdog_start_cancel(int nloops, int cpu)
+{
+	WDOG_ID wdog;
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	wdog = wd_create();
+	if (wdog == NULL) {
+		printf("# Failed to create a watchdog\n");
+		return 0;
+	}
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		wd_start(wdog, KBENCH_WDOG_DELAY, (wdentry_t)kbench_wdog_expired, 1, (uint32_t)i);
+		wd_cancel(wdog);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	wd_delete(wdog);
+	return elapsed;
+}
+#endif
+
+#ifdef KBENCH_WORKQUEUE
+static void kbench_worker(FAR void *arg)
+{
+	sem_post(&g_sem1);
+}
+
+/* A work queued, run by the worker thread and posting back */
+
+static uint64_t kbench_work_wake(int nloops, int cpu)
+{
+	struct work_s work;
+	uint64_t t0;
+	uint64_t elapsed;
+	int i;
+
+	memset(&work, 0, sizeof(work));
+	kbench_sem_init();
+
+	t0 = kbench_nsec();
+	for (i = 0; i < nloops; i++) {
+		work_queue(HPWORK, &work, kbench_worker, NULL, 0);
+		sem_wait(&g_sem1);
+	}
+	elapsed = kbench_nsec() - t0;
+
+	kbench_sem_destroy();
+	return elapsed;
+}
+#endif
+
+static const struct kbench_s g_kbench[] = {
+	{"sem_post_wait", kbench_sem_post_wait, 1, false},
+	{"sem_wake", kbench_sem_wake, 2, true},
+	{"mutex_lock_unlock", kbench_mutex, 1, false},
+	{"mutex_contended", kbench_mutex_contended, 2, true},
+	{"mq_send_receive", kbench_mq_send_receive, 1, false},
+	{"mq_wake", kbench_mq_wake, 2, true},
+#ifndef CONFIG_DISABLE_SIGNALS
+	{"signal_self", kbench_signal_self, 1, false},
+	{"signal_wake", kbench_signal_wake, 1, true},
+#endif
+	{"pthread_create_join", kbench_pthread_create_join, 1, true},
+#ifdef CONFIG_BUILD_FLAT
+	{"wdog_start_cancel", kbench_wdog_start_cancel, 1, false},
+#endif
+#ifdef KBENCH_WORKQUEUE
+	{"work_wake", kbench_work_wake, 1, false},
+#endif
+};
+
+#define KBENCH_NTESTS (sizeof(g_kbench) / sizeof(g_kbench[0]))
+
+/* One CSV line: the ns per operation of the fastest, the mean and the
+ * slowest of the runs.
+ */
+
+static void kbench_run(FAR const struct kbench_s *test, int ncpus, int cpu, int nloops, int nruns)
+{
+	uint64_t elapsed;
+	uint64_t min = UINT64_MAX;
+	uint64_t max = 0;
+	uint64_t total = 0;
+	uint64_t nops = (uint64_t)nloops * test->nops;
+	int run;
+
+	for (run = 0; run < nruns; run++) {
+		elapsed = test->run(nloops, cpu);
+		if (elapsed == 0) {
+			printf("# %s failed\n", test->name);
+			return;
+		}
+
+		elapsed /= nops;
+		total += elapsed;
+		if (elapsed < min) {
+			min = elapsed;
+		}
+
+		if (elapsed > max) {
+			max = elapsed;
+		}
+	}
+
+	printf("%s,%d,%llu,%llu,%llu,%llu\n", test->name, ncpus, (unsigned long long)nops,
+		(unsigned long long)min, (unsigned long long)(total / nruns), (unsigned long long)max);
+}
+
+static void kbench_usage(const char *name)
+{
+	printf("Usage: %s [-l loops] [-r runs] [test]\n", name);
+	printf("  -l : rounds of each run (default %d)\n", KBENCH_NLOOPS);
+	printf("  -r : runs of each test (default %d)\n", KBENCH_NRUNS);
+	printf("  test : only the tests whose name starts with it\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int kbench_main(int argc, char *argv[])
+#endif
+{
+	struct sched_param param;
+	struct sched_param saved;
+	FAR const char *filter = NULL;
+	int nloops = KBENCH_NLOOPS;
+	int nruns = KBENCH_NRUNS;
+	int opt;
+	int i;
+#ifdef CONFIG_SMP
+	cpu_set_t cpuset;
+	cpu_set_t savedset;
+#endif
+
+	optind = 0;
+	while ((opt = getopt(argc, argv, "l:r:")) != ERROR) {
+		switch (opt) {
+		case 'l':
+			nloops = atoi(optarg);
+			break;
+		case 'r':
+			nruns = atoi(optarg);
+			break;
+		default:
+			kbench_usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if (optind < argc) {
+		filter = argv[optind];
+	}
+
+	if (nloops < 1 || nruns < 1) {
+		kbench_usage(argv[0]);
+		return -1;
+	}
+
+	sched_getparam(0, &saved);
+	param.sched_priority = KBENCH_PRIORITY;
+	sched_setparam(0, &param);
+
+#ifdef CONFIG_SMP
+	/* The first thread of the tests stays on CPU 0 */
+
+	sched_getaffinity(0, sizeof(cpu_set_t), &savedset);
+	CPU_ZERO(&cpuset);
+	CPU_SET(0, &cpuset);
+	sched_setaffinity(0, sizeof(cpu_set_t), &cpuset);
+#endif
+
+	/* Lines starting with '#' are comments */
+
+	printf("# kbench loops=%d runs=%d\n", nloops, nruns);
+	printf("test,cpus,ops,min_ns,avg_ns,max_ns\n");
+
+	for (i = 0; i < KBENCH_NTESTS; i++) {
+		if (filter != NULL && strncmp(g_kbench[i].name, filter, strlen(filter)) != 0) {
+			continue;
+		}
+
+		kbench_run(&g_kbench[i], 1, 0, nloops, nruns);
+#ifdef CONFIG_SMP
+		if (g_kbench[i].pair) {
+			kbench_run(&g_kbench[i], 2, 1, nloops, nruns);
+		}
+#endif
+	}
+
+#ifdef CONFIG_SMP
+	sched_setaffinity(0, sizeof(cpu_set_t), &savedset);
+#endif
+	sched_setparam(0, &saved);
+	return 0;
+}
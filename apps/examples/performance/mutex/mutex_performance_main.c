@@ -0,0 +1,197 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file mutex_performance_main.c
+
+/// @brief Measure the cost of uncontended pthread mutex lock and unlock.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MUTEX_PERF_MAX_NESTED  16
+#define MUTEX_PERF_NLOOPS      10000
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static pthread_mutex_t g_mutex[MUTEX_PERF_MAX_NESTED];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t mutex_perf_nsec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static int mutex_perf_init(int nmutex, int protocol)
+{
+	pthread_mutexattr_t attr;
+	int ret = OK;
+	int i;
+
+	pthread_mutexattr_init(&attr);
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	pthread_mutexattr_setprotocol(&attr, protocol);
+#endif
+#ifdef CONFIG_PTHREAD_MUTEX_BOTH
+	pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_STALLED);
+#endif
+
+	for (i = 0; i < nmutex; i++) {
+		ret = pthread_mutex_init(&g_mutex[i], &attr);
+		if (ret != OK) {
+			printf("Failed to init mutex %d, errno %d\n", i, ret);
+			break;
+		}
+	}
+
+	pthread_mutexattr_destroy(&attr);
+	return ret;
+}
+
+/* Lock 'nested' mutexes and unlock them in the reverse order, 'nloops'
+ * times.  With priority inheritance each lock records a holder for the
+ * mutex, which is what the holder tracking pays for.
+ */
+
+static void mutex_perf_run(const char *name, int protocol, int nested, int nloops)
+{
+	uint64_t tlock = 0;
+	uint64_t tunlock = 0;
+	uint64_t t0;
+	int loop;
+	int i;
+
+	if (mutex_perf_init(nested, protocol) != OK) {
+		return;
+	}
+
+	for (loop = 0; loop < nloops; loop++) {
+		t0 = mutex_perf_nsec();
+		for (i = 0; i < nested; i++) {
+			pthread_mutex_lock(&g_mutex[i]);
+		}
+		tlock += mutex_perf_nsec() - t0;
+
+		t0 = mutex_perf_nsec();
+		for (i = nested - 1; i >= 0; i--) {
+			pthread_mutex_unlock(&g_mutex[i]);
+		}
+		tunlock += mutex_perf_nsec() - t0;
+	}
+
+	for (i = 0; i < nested; i++) {
+		pthread_mutex_destroy(&g_mutex[i]);
+	}
+
+	printf(" %-8s | %6d | %10llu | %10llu\n", name, nested,
+		(unsigned long long)(tlock / ((uint64_t)nested * nloops)),
+		(unsigned long long)(tunlock / ((uint64_t)nested * nloops)));
+}
+
+static void mutex_perf_usage(const char *name)
+{
+	printf("Usage: %s [-l loops]\n", name);
+	printf("  -l : lock and unlock rounds of each run (default %d)\n", MUTEX_PERF_NLOOPS);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int mutexperf_main(int argc, char *argv[])
+#endif
+{
+	struct sched_param param;
+	struct sched_param saved;
+	int nloops = MUTEX_PERF_NLOOPS;
+	int opt;
+	int n;
+
+	optind = 0;
+	while ((opt = getopt(argc, argv, "l:")) != ERROR) {
+		switch (opt) {
+		case 'l':
+			nloops = atoi(optarg);
+			break;
+		default:
+			mutex_perf_usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if (nloops < 1) {
+		mutex_perf_usage(argv[0]);
+		return -1;
+	}
+
+	printf("Mutex Performance Measurement\n");
+#if defined(CONFIG_SEM_INLINE_HOLDER) && CONFIG_SEM_PREALLOCHOLDERS > 0
+	printf("Holders     : in the semaphore, then %d preallocated\n", CONFIG_SEM_PREALLOCHOLDERS);
+#elif CONFIG_SEM_PREALLOCHOLDERS > 0
+	printf("Holders     : %d preallocated\n", CONFIG_SEM_PREALLOCHOLDERS);
+#else
+	printf("Holders     : in the semaphore\n");
+#endif
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+	printf("Fast path   : user space\n");
+#endif
+
+	/* Nothing else must run during the measurements */
+
+	sched_getparam(0, &saved);
+	param.sched_priority = SCHED_PRIORITY_MAX;
+	sched_setparam(0, &param);
+
+	printf("\n==== Uncontended lock and unlock, ns per operation ====\n");
+	printf(" Protocol | Nested |       lock |     unlock\n");
+	printf("----------|--------|------------|-----------\n");
+	for (n = 1; n <= MUTEX_PERF_MAX_NESTED; n *= 4) {
+#ifdef CONFIG_PRIORITY_INHERITANCE
+		mutex_perf_run("none", PTHREAD_PRIO_NONE, n, nloops);
+		mutex_perf_run("inherit", PTHREAD_PRIO_INHERIT, n, nloops);
+#else
+		mutex_perf_run("none", 0, n, nloops);
+#endif
+	}
+
+	sched_setparam(0, &saved);
+	return 0;
+}
@@ -0,0 +1,269 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file printf_performance_test.c
+
+/// @brief Benchmark and check of the formatting of the printf family.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define PRINTF_PERF_CLOCK      CLOCK_MONOTONIC
+#else
+#define PRINTF_PERF_CLOCK      CLOCK_REALTIME
+#endif
+
+#define PRINTF_PERF_BUFSIZE    128
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct printf_perf_case_s {
+	const char *name;			/* Name in the results */
+	const char *expected;		/* Expected output */
+};
+
+enum printf_perf_case_e {
+	PRINTF_PERF_INT,
+	PRINTF_PERF_UNSIGNED,
+	PRINTF_PERF_HEX,
+	PRINTF_PERF_STRING,
+	PRINTF_PERF_PADDED,
+	PRINTF_PERF_LOGLINE,
+#ifdef CONFIG_LIBC_LONG_LONG
+	PRINTF_PERF_LONGLONG,
+#endif
+#ifdef CONFIG_LIBC_FLOATINGPOINT
+	PRINTF_PERF_FLOAT,
+	PRINTF_PERF_FIXED,
+	PRINTF_PERF_EXP,
+	PRINTF_PERF_GENERAL,
+	PRINTF_PERF_JSON,
+#endif
+	PRINTF_PERF_NCASES
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct printf_perf_case_s g_cases[PRINTF_PERF_NCASES] = {
+	{ "int", "-123456" },
+	{ "unsigned", "4000000000" },
+	{ "hex", "deadbeef" },
+	{ "string", "sensor" },
+	{ "padded", "[   -42|00001f|left  ]" },
+	{ "logline", "[net] id=42 len=1500 addr=0x2000a5f0" },
+#ifdef CONFIG_LIBC_LONG_LONG
+	{ "longlong", "-1234567890123456789" },
+#endif
+#ifdef CONFIG_LIBC_FLOATINGPOINT
+	{ "float", "3.141593" },
+	{ "fixed", "1234.568" },
+	{ "exp", "1.234560e-04" },
+	{ "general", "100000 0.0001 1e+07" },
+	{ "json", "{\"temp\":21.50,\"hum\":48}" },
+#endif
+};
+
+static volatile int g_sink;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t printf_perf_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(PRINTF_PERF_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* Format one case into buffer and return the snprintf() result */
+
+static int printf_perf_format(int id, char *buffer)
+{
+	switch (id) {
+	case PRINTF_PERF_INT:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%d", -123456);
+	case PRINTF_PERF_UNSIGNED:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%u", 4000000000u);
+	case PRINTF_PERF_HEX:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%x", 0xdeadbeefu);
+	case PRINTF_PERF_STRING:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%s", "sensor");
+	case PRINTF_PERF_PADDED:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "[%6d|%06x|%-6s]", -42, 0x1f, "left");
+	case PRINTF_PERF_LOGLINE:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "[%s] id=%d len=%u addr=0x%08x", "net", 42, 1500u, 0x2000a5f0u);
+#ifdef CONFIG_LIBC_LONG_LONG
+	case PRINTF_PERF_LONGLONG:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%lld", -1234567890123456789LL);
+#endif
+#ifdef CONFIG_LIBC_FLOATINGPOINT
+	case PRINTF_PERF_FLOAT:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%f", 3.14159265);
+	case PRINTF_PERF_FIXED:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%.3f", 1234.5678);
+	case PRINTF_PERF_EXP:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%e", 0.000123456);
+	case PRINTF_PERF_GENERAL:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "%g %g %g", 100000.0, 0.0001, 1e7);
+	case PRINTF_PERF_JSON:
+		return snprintf(buffer, PRINTF_PERF_BUFSIZE, "{\"temp\":%.2f,\"hum\":%d}", 21.5, 48);
+#endif
+	default:
+		return 0;
+	}
+}
+
+static int printf_perf_check(int id)
+{
+	char buffer[PRINTF_PERF_BUFSIZE];
+	int ret;
+
+	memset(buffer, 0x5a, sizeof(buffer));
+	ret = printf_perf_format(id, buffer);
+	if (ret != (int)strlen(g_cases[id].expected) || strcmp(buffer, g_cases[id].expected) != 0) {
+		printf("%s failed: \"%s\" (%d), expected \"%s\"\n", g_cases[id].name, buffer, ret, g_cases[id].expected);
+		printf("PRINTFPERF,%s,check,errors,1,count\n", g_cases[id].name);
+		return 1;
+	}
+
+	printf("PRINTFPERF,%s,check,errors,0,count\n", g_cases[id].name);
+	return 0;
+}
+
+/* Format the case 'loops' times and print the calls per second and the
+ * average time of a call.
+ */
+
+static void printf_perf_measure(int id, uint32_t loops)
+{
+	char buffer[PRINTF_PERF_BUFSIZE];
+	uint64_t start;
+	uint64_t elapsed;
+	uint32_t i;
+	int sink = 0;
+
+	start = printf_perf_now();
+	for (i = 0; i < loops; i++) {
+		sink += printf_perf_format(id, buffer);
+	}
+	elapsed = printf_perf_now() - start;
+	g_sink = sink;
+
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("PRINTFPERF,%s,throughput,%lu,calls/s\n", g_cases[id].name, (unsigned long)((uint64_t)loops * 1000000 / elapsed));
+	printf("PRINTFPERF,%s,latency,%lu,ns\n", g_cases[id].name, (unsigned long)(elapsed * 1000 / loops));
+}
+
+static void show_usage(const char *prog)
+{
+	printf("\nUsage: %s [-c] [-n LOOPS] [FORMAT|all]\n", prog);
+	printf("\nOptions:\n");
+	printf(" -c            Only check the results of the formats\n");
+	printf(" -n LOOPS      Calls per measure (default %d)\n", CONFIG_EXAMPLES_PRINTF_PERFORMANCE_LOOPS);
+	printf("\nFormats:");
+	for (int i = 0; i < PRINTF_PERF_NCASES; i++) {
+		printf(" %s", g_cases[i].name);
+	}
+	printf("\n\nResults are printed as lines of comma separated values starting with PRINTFPERF.\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int printfperf_main(int argc, char *argv[])
+#endif
+{
+	uint32_t loops = CONFIG_EXAMPLES_PRINTF_PERFORMANCE_LOOPS;
+	bool checkonly = false;
+	int first = 0;
+	int last = PRINTF_PERF_NCASES - 1;
+	int errors = 0;
+	int id;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "cn:")) != ERROR) {
+		switch (opt) {
+		case 'c':
+			checkonly = true;
+			break;
+		case 'n':
+			loops = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			show_usage(argv[0]);
+			return ERROR;
+		}
+	}
+
+	if (loops == 0) {
+		loops = 1;
+	}
+
+	if (optind < argc && strcmp(argv[optind], "all") != 0) {
+		for (id = 0; id < PRINTF_PERF_NCASES; id++) {
+			if (strcmp(argv[optind], g_cases[id].name) == 0) {
+				break;
+			}
+		}
+
+		if (id == PRINTF_PERF_NCASES) {
+			printf("Unknown format %s\n", argv[optind]);
+			show_usage(argv[0]);
+			return ERROR;
+		}
+
+		first = last = id;
+	}
+
+	for (id = first; id <= last; id++) {
+		errors += printf_perf_check(id);
+		if (!checkonly) {
+			printf_perf_measure(id, loops);
+		}
+	}
+
+	printf("\nprintf performance test done, %d errors.\n", errors);
+	return errors == 0 ? OK : ERROR;
+}
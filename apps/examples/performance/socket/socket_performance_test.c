@@ -0,0 +1,903 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file socket_performance_test.c
+
+/// @brief Small-packet socket operations per second, round trip latency,
+/// connection setup rate, concurrent connections and packets per second.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_SOCKET_PERFORMANCE_NOPS
+#define CONFIG_EXAMPLES_SOCKET_PERFORMANCE_NOPS 10000
+#endif
+
+#ifndef CONFIG_EXAMPLES_SOCKET_PERFORMANCE_PORT
+#define CONFIG_EXAMPLES_SOCKET_PERFORMANCE_PORT 5001
+#endif
+
+#ifndef CONFIG_EXAMPLES_SOCKET_PERFORMANCE_MAXCONN
+#define CONFIG_EXAMPLES_SOCKET_PERFORMANCE_MAXCONN 4
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define SOCK_PERF_CLOCK CLOCK_MONOTONIC
+#else
+#define SOCK_PERF_CLOCK CLOCK_REALTIME
+#endif
+
+#ifdef CONFIG_ARCH_BOARD
+#define SOCK_PERF_BOARD CONFIG_ARCH_BOARD
+#else
+#define SOCK_PERF_BOARD "unknown"
+#endif
+
+#define SOCK_PERF_DEFAULT_ADDR "127.0.0.1"
+#define SOCK_PERF_DEFAULT_SIZE 32
+#define SOCK_PERF_MAX_SIZE     1024
+#define SOCK_PERF_MAX_CONN     16
+
+/* A connection setup costs about as much as ten round trips */
+
+#define SOCK_PERF_CONNECT_DIV  10
+
+/* Round trip latencies are counted in bins of 10 us up to 10 ms, the last
+ * bin takes the longer ones.
+ */
+
+#define SOCK_PERF_LAT_BINS     1000
+#define SOCK_PERF_LAT_USEC     10
+
+/* A packet lost on the way aborts the run instead of blocking forever */
+
+#define SOCK_PERF_TIMEOUT_SEC  2
+
+#define SOCK_PERF_TEST_UDP     (1 << 0)
+#define SOCK_PERF_TEST_TCP     (1 << 1)
+#define SOCK_PERF_TEST_SOCKOPT (1 << 2)
+#define SOCK_PERF_TEST_CONNECT (1 << 3)
+#define SOCK_PERF_TEST_CONC    (1 << 4)
+#define SOCK_PERF_TEST_PPS     (1 << 5)
+#define SOCK_PERF_TEST_ALL     (SOCK_PERF_TEST_UDP | SOCK_PERF_TEST_TCP | SOCK_PERF_TEST_SOCKOPT | \
+								SOCK_PERF_TEST_CONNECT | SOCK_PERF_TEST_CONC | SOCK_PERF_TEST_PPS)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct sock_perf_config_s {
+	struct in_addr addr;
+	uint32_t nops;
+	size_t size;
+	int port;
+	int maxconn;
+	uint8_t buffer[SOCK_PERF_MAX_SIZE];
+};
+
+struct sock_perf_lat_s {
+	uint32_t bins[SOCK_PERF_LAT_BINS];
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+};
+
+struct sock_perf_pps_s {
+	int sd;
+	uint32_t nrecv;
+	uint64_t last;
+	uint8_t buffer[SOCK_PERF_MAX_SIZE];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct {
+	const char *name;
+	int test;
+} g_tests[] = {
+	{ "udp", SOCK_PERF_TEST_UDP },
+	{ "tcp", SOCK_PERF_TEST_TCP },
+	{ "sockopt", SOCK_PERF_TEST_SOCKOPT },
+	{ "connect", SOCK_PERF_TEST_CONNECT },
+	{ "conc", SOCK_PERF_TEST_CONC },
+	{ "pps", SOCK_PERF_TEST_PPS },
+	{ "all", SOCK_PERF_TEST_ALL },
+};
+
+#define NTESTS (int)(sizeof(g_tests) / sizeof(g_tests[0]))
+
+static struct sock_perf_config_s g_config;
+static struct sock_perf_lat_s g_lat;
+static struct sock_perf_pps_s g_pps;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t sock_perf_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(SOCK_PERF_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint32_t sock_perf_elapsed(uint64_t start)
+{
+	uint64_t elapsed = sock_perf_now() - start;
+
+	if (elapsed == 0) {
+		return 1;
+	}
+
+	return elapsed > UINT32_MAX ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+static void sock_perf_result(const char *test, const char *metric, uint32_t value, const char *unit)
+{
+	printf("SOCKPERF,%s,%lu,%s,%lu,%s\n", test, (unsigned long)g_config.size, metric, (unsigned long)value, unit);
+}
+
+/* Report a run of 'nops' operations, each made of 'ncalls' socket calls */
+
+static void sock_perf_report(const char *test, uint32_t nops, int ncalls, uint32_t usec)
+{
+	sock_perf_result(test, "ops", nops, "count");
+	sock_perf_result(test, "rate", (uint32_t)((uint64_t)nops * 1000000 / usec), "ops/s");
+	sock_perf_result(test, "calls", (uint32_t)((uint64_t)nops * ncalls * 1000000 / usec), "calls/s");
+	sock_perf_result(test, "avg", nops ? usec / nops : 0, "us");
+}
+
+static void sock_perf_lat_reset(void)
+{
+	memset(&g_lat, 0, sizeof(g_lat));
+	g_lat.min = UINT32_MAX;
+}
+
+static void sock_perf_lat_add(uint32_t usec)
+{
+	uint32_t bin = usec / SOCK_PERF_LAT_USEC;
+
+	g_lat.bins[bin < SOCK_PERF_LAT_BINS ? bin : SOCK_PERF_LAT_BINS - 1]++;
+	g_lat.count++;
+	if (usec < g_lat.min) {
+		g_lat.min = usec;
+	}
+	if (usec > g_lat.max) {
+		g_lat.max = usec;
+	}
+}
+
+/* Upper bound of the bin holding the 'pct' percentile */
+
+static uint32_t sock_perf_lat_pct(int pct)
+{
+	uint32_t rank = (uint32_t)(((uint64_t)g_lat.count * pct + 99) / 100);
+	uint32_t seen = 0;
+	int i;
+
+	for (i = 0; i < SOCK_PERF_LAT_BINS - 1; i++) {
+		seen += g_lat.bins[i];
+		if (seen >= rank) {
+			return (i + 1) * SOCK_PERF_LAT_USEC;
+		}
+	}
+
+	return g_lat.max;
+}
+
+static void sock_perf_lat_report(const char *test)
+{
+	if (g_lat.count == 0) {
+		return;
+	}
+
+	sock_perf_result(test, "min", g_lat.min, "us");
+	sock_perf_result(test, "p50", sock_perf_lat_pct(50), "us");
+	sock_perf_result(test, "p90", sock_perf_lat_pct(90), "us");
+	sock_perf_result(test, "p99", sock_perf_lat_pct(99), "us");
+	sock_perf_result(test, "max", g_lat.max, "us");
+}
+
+static void sock_perf_print_header(void)
+{
+	printf("SOCKPERF-INFO,board=%s,addr=%s,nops=%lu,maxconn=%d,options=", SOCK_PERF_BOARD, inet_ntoa(g_config.addr), (unsigned long)g_config.nops, g_config.maxconn);
+#ifdef CONFIG_NET_TCPIP_CORE_LOCKING
+	printf("TCPIP_CORE_LOCKING ");
+#endif
+#ifdef CONFIG_NET_TCPIP_CORE_LOCKING_INPUT
+	printf("TCPIP_CORE_LOCKING_INPUT ");
+#endif
+#ifdef CONFIG_NET_LOOPBACK_INTERFACE
+	printf("LOOPBACK_INTERFACE ");
+#endif
+	printf("\n");
+	printf("SOCKPERF,test,size,metric,value,unit\n");
+}
+
+static int sock_perf_settimeout(int sd)
+{
+	struct timeval tv;
+
+	tv.tv_sec = SOCK_PERF_TIMEOUT_SEC;
+	tv.tv_usec = 0;
+	if (setsockopt(sd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) < 0) {
+		printf("Cannot set the receive timeout, errno %d\n", errno);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+static int sock_perf_bind(int sd, int port)
+{
+	struct sockaddr_in addr;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	addr.sin_addr = g_config.addr;
+	if (bind(sd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printf("Cannot bind port %d, errno %d\n", port, errno);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+/* Read exactly 'len' bytes from a stream socket */
+
+static int sock_perf_recvall(int sd, uint8_t *buf, size_t len)
+{
+	ssize_t nbytes;
+	size_t done = 0;
+
+	while (done < len) {
+		nbytes = recv(sd, buf + done, len - done, 0);
+		if (nbytes <= 0) {
+			return ERROR;
+		}
+		done += nbytes;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: sock_perf_udp
+ *
+ * Description:
+ *   Ping-pong a datagram between two UDP sockets of this task.  One
+ *   operation is a round trip: two sendto() and two recvfrom().  The
+ *   latency of each round trip is reported as percentiles (UDP_RR).
+ *
+ ****************************************************************************/
+
+static void sock_perf_udp(void)
+{
+	struct sockaddr_in srvaddr;
+	struct sockaddr_in cliaddr;
+	uint64_t start;
+	uint32_t i;
+	int srv;
+	int cli;
+
+	srv = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	cli = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (srv < 0 || cli < 0) {
+		printf("Cannot create the UDP sockets, errno %d\n", errno);
+		goto errout;
+	}
+
+	if (sock_perf_bind(srv, g_config.port) < 0 || sock_perf_bind(cli, g_config.port + 1) < 0) {
+		goto errout;
+	}
+
+	if (sock_perf_settimeout(srv) < 0 || sock_perf_settimeout(cli) < 0) {
+		goto errout;
+	}
+
+	memset(&srvaddr, 0, sizeof(srvaddr));
+	srvaddr.sin_family = AF_INET;
+	srvaddr.sin_port = htons(g_config.port);
+	srvaddr.sin_addr = g_config.addr;
+	cliaddr = srvaddr;
+	cliaddr.sin_port = htons(g_config.port + 1);
+
+	sock_perf_lat_reset();
+	start = sock_perf_now();
+	for (i = 0; i < g_config.nops; i++) {
+		uint64_t op = sock_perf_now();
+
+		if (sendto(cli, g_config.buffer, g_config.size, 0, (struct sockaddr *)&srvaddr, sizeof(srvaddr)) < 0 ||
+			recvfrom(srv, g_config.buffer, g_config.size, 0, NULL, NULL) < 0 ||
+			sendto(srv, g_config.buffer, g_config.size, 0, (struct sockaddr *)&cliaddr, sizeof(cliaddr)) < 0 ||
+			recvfrom(cli, g_config.buffer, g_config.size, 0, NULL, NULL) < 0) {
+			printf("UDP round trip %lu failed, errno %d\n", (unsigned long)i, errno);
+			break;
+		}
+		sock_perf_lat_add(sock_perf_elapsed(op));
+	}
+
+	sock_perf_report("udp", i, 4, sock_perf_elapsed(start));
+	sock_perf_lat_report("udp");
+
+errout:
+	if (cli >= 0) {
+		close(cli);
+	}
+	if (srv >= 0) {
+		close(srv);
+	}
+}
+
+static int sock_perf_listen(int port, int backlog)
+{
+	int listener;
+	int one = 1;
+
+	listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (listener < 0) {
+		printf("Cannot create the TCP listener, errno %d\n", errno);
+		return ERROR;
+	}
+
+	if (setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) < 0 || sock_perf_bind(listener, port) < 0) {
+		close(listener);
+		return ERROR;
+	}
+
+	if (listen(listener, backlog) < 0) {
+		printf("Cannot listen, errno %d\n", errno);
+		close(listener);
+		return ERROR;
+	}
+
+	return listener;
+}
+
+/* Connect a new client to 'listener' and accept it. With 'setup' the two
+ * ends get TCP_NODELAY and the receive timeout, which the connection setup
+ * test leaves out to count only the calls of a connection.
+ */
+
+static int sock_perf_connect(int listener, int *cli, int *srv, bool setup)
+{
+	struct sockaddr_in addr;
+	int one = 1;
+
+	*srv = -1;
+	*cli = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (*cli < 0) {
+		printf("Cannot create the TCP client, errno %d\n", errno);
+		return ERROR;
+	}
+
+	/* The stack completes the handshake on its own, so the connection is
+	 * made before accept() is called.
+	 */
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(g_config.port);
+	addr.sin_addr = g_config.addr;
+	if (connect(*cli, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printf("Cannot connect, errno %d\n", errno);
+		goto errout;
+	}
+
+	*srv = accept(listener, NULL, NULL);
+	if (*srv < 0) {
+		printf("Cannot accept, errno %d\n", errno);
+		goto errout;
+	}
+
+	if (!setup) {
+		return OK;
+	}
+
+	if (setsockopt(*cli, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)) < 0 || setsockopt(*srv, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)) < 0) {
+		printf("Cannot disable Nagle, errno %d\n", errno);
+		goto errout;
+	}
+
+	if (sock_perf_settimeout(*srv) < 0 || sock_perf_settimeout(*cli) < 0) {
+		goto errout;
+	}
+
+	return OK;
+
+errout:
+	if (*srv >= 0) {
+		close(*srv);
+		*srv = -1;
+	}
+	close(*cli);
+	*cli = -1;
+	return ERROR;
+}
+
+/* One request from 'cli' to 'srv' and the response back */
+
+static int sock_perf_tcp_rr(int cli, int srv)
+{
+	if (send(cli, g_config.buffer, g_config.size, 0) != (ssize_t)g_config.size ||
+		sock_perf_recvall(srv, g_config.buffer, g_config.size) < 0 ||
+		send(srv, g_config.buffer, g_config.size, 0) != (ssize_t)g_config.size ||
+		sock_perf_recvall(cli, g_config.buffer, g_config.size) < 0) {
+		return ERROR;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: sock_perf_tcp
+ *
+ * Description:
+ *   Ping-pong a message over a connection between two TCP sockets of this
+ *   task.  One operation is a round trip: two send() and two recv().
+ *   Nagle is disabled, so every send() is a segment.  The latency of each
+ *   round trip is reported as percentiles (TCP_RR).
+ *
+ ****************************************************************************/
+
+static void sock_perf_tcp(void)
+{
+	uint64_t start;
+	uint32_t i;
+	int listener;
+	int srv;
+	int cli;
+
+	listener = sock_perf_listen(g_config.port, 1);
+	if (listener < 0) {
+		return;
+	}
+
+	if (sock_perf_connect(listener, &cli, &srv, true) < 0) {
+		close(listener);
+		return;
+	}
+
+	sock_perf_lat_reset();
+	start = sock_perf_now();
+	for (i = 0; i < g_config.nops; i++) {
+		uint64_t op = sock_perf_now();
+
+		if (sock_perf_tcp_rr(cli, srv) < 0) {
+			printf("TCP round trip %lu failed, errno %d\n", (unsigned long)i, errno);
+			break;
+		}
+		sock_perf_lat_add(sock_perf_elapsed(op));
+	}
+
+	sock_perf_report("tcp", i, 4, sock_perf_elapsed(start));
+	sock_perf_lat_report("tcp");
+
+	close(srv);
+	close(cli);
+	close(listener);
+}
+
+/****************************************************************************
+ * Name: sock_perf_conn
+ *
+ * Description:
+ *   Set up a TCP connection, make one round trip over it and close it
+ *   (TCP_CRR).  One operation is socket(), connect(), accept(), the four
+ *   calls of the round trip and two close().  The client closes first, so
+ *   its PCB stays in TIME_WAIT, which lwIP recycles when it runs out of
+ *   PCBs.  NOPS / 10 connections are made.
+ *
+ ****************************************************************************/
+
+static void sock_perf_conn(void)
+{
+	uint32_t nconn = g_config.nops / SOCK_PERF_CONNECT_DIV;
+	uint64_t start;
+	uint32_t i;
+	int listener;
+	int srv;
+	int cli;
+
+	if (nconn == 0) {
+		nconn = 1;
+	}
+
+	listener = sock_perf_listen(g_config.port, 1);
+	if (listener < 0) {
+		return;
+	}
+
+	sock_perf_lat_reset();
+	start = sock_perf_now();
+	for (i = 0; i < nconn; i++) {
+		uint64_t op = sock_perf_now();
+		int ret;
+
+		if (sock_perf_connect(listener, &cli, &srv, false) < 0) {
+			printf("Connection %lu failed\n", (unsigned long)i);
+			break;
+		}
+
+		ret = sock_perf_tcp_rr(cli, srv);
+		close(cli);
+		close(srv);
+		if (ret < 0) {
+			printf("Round trip of connection %lu failed, errno %d\n", (unsigned long)i, errno);
+			break;
+		}
+		sock_perf_lat_add(sock_perf_elapsed(op));
+	}
+
+	sock_perf_report("connect", i, 9, sock_perf_elapsed(start));
+	sock_perf_lat_report("connect");
+
+	close(listener);
+}
+
+/****************************************************************************
+ * Name: sock_perf_conc
+ *
+ * Description:
+ *   Keep 1, 2, 4 .. MAXCONN TCP connections open and make NOPS round trips
+ *   over them.  Each round sends a request on every connection before the
+ *   responses are read, so all the connections have a segment in flight
+ *   at once.  The rate at each step shows how the stack scales with the
+ *   number of PCBs and sockets.
+ *
+ ****************************************************************************/
+
+static void sock_perf_conc(void)
+{
+	int cli[SOCK_PERF_MAX_CONN];
+	int srv[SOCK_PERF_MAX_CONN];
+	char name[16];
+	uint64_t start;
+	uint32_t nrounds;
+	uint32_t r;
+	int listener;
+	int nconn = 0;
+	int k;
+	int j;
+
+	listener = sock_perf_listen(g_config.port, g_config.maxconn);
+	if (listener < 0) {
+		return;
+	}
+
+	for (k = 1; k <= g_config.maxconn; k *= 2) {
+		for (; nconn < k; nconn++) {
+			if (sock_perf_connect(listener, &cli[nconn], &srv[nconn], true) < 0) {
+				printf("Cannot open connection %d\n", nconn + 1);
+				goto out;
+			}
+		}
+
+		nrounds = g_config.nops / k;
+		if (nrounds == 0) {
+			nrounds = 1;
+		}
+
+		start = sock_perf_now();
+		for (r = 0; r < nrounds; r++) {
+			for (j = 0; j < k; j++) {
+				if (send(cli[j], g_config.buffer, g_config.size, 0) != (ssize_t)g_config.size) {
+					goto fail;
+				}
+			}
+			for (j = 0; j < k; j++) {
+				if (sock_perf_recvall(srv[j], g_config.buffer, g_config.size) < 0 ||
+					send(srv[j], g_config.buffer, g_config.size, 0) != (ssize_t)g_config.size) {
+					goto fail;
+				}
+			}
+			for (j = 0; j < k; j++) {
+				if (sock_perf_recvall(cli[j], g_config.buffer, g_config.size) < 0) {
+					goto fail;
+				}
+			}
+		}
+
+		snprintf(name, sizeof(name), "conc%d", k);
+		sock_perf_report(name, r * k, 4, sock_perf_elapsed(start));
+	}
+
+	goto out;
+
+fail:
+	printf("Round %lu over %d connections failed, errno %d\n", (unsigned long)r, k, errno);
+
+out:
+	for (j = 0; j < nconn; j++) {
+		close(cli[j]);
+		close(srv[j]);
+	}
+	close(listener);
+}
+
+/****************************************************************************
+ * Name: sock_perf_sockopt
+ *
+ * Description:
+ *   getsockopt() does no network I/O, so its rate is the cost of reaching
+ *   the stack: a message to tcpip_thread and back, or the core lock.
+ *
+ ****************************************************************************/
+
+static void sock_perf_sockopt(void)
+{
+	socklen_t len;
+	uint64_t start;
+	uint32_t i;
+	int type;
+	int sd;
+
+	sd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (sd < 0) {
+		printf("Cannot create the UDP socket, errno %d\n", errno);
+		return;
+	}
+
+	start = sock_perf_now();
+	for (i = 0; i < g_config.nops; i++) {
+		len = sizeof(type);
+		if (getsockopt(sd, SOL_SOCKET, SO_TYPE, &type, &len) < 0) {
+			printf("getsockopt %lu failed, errno %d\n", (unsigned long)i, errno);
+			break;
+		}
+	}
+
+	sock_perf_report("sockopt", i, 1, sock_perf_elapsed(start));
+	close(sd);
+}
+
+static void *sock_perf_pps_recv(void *arg)
+{
+	while (g_pps.nrecv < g_config.nops) {
+		if (recv(g_pps.sd, g_pps.buffer, g_config.size, 0) < 0) {
+			break;
+		}
+		g_pps.nrecv++;
+		g_pps.last = sock_perf_now();
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: sock_perf_pps
+ *
+ * Description:
+ *   Send NOPS datagrams one way as fast as possible while a thread counts
+ *   them at the receiving socket.  "tx" is the rate of sendto(), "rx" the
+ *   rate of the datagrams received until the last one, and "lost" the
+ *   datagrams dropped on the way, because a buffer or the receive mailbox
+ *   of the socket was full.  The receiver stops after the receive timeout.
+ *
+ ****************************************************************************/
+
+static void sock_perf_pps(void)
+{
+	struct sockaddr_in srvaddr;
+	pthread_t thread;
+	uint64_t start;
+	uint32_t txusec;
+	uint32_t nfail = 0;
+	uint32_t i;
+	int cli;
+	int ret;
+
+	memset(&g_pps, 0, sizeof(g_pps));
+	g_pps.sd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	cli = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (g_pps.sd < 0 || cli < 0) {
+		printf("Cannot create the UDP sockets, errno %d\n", errno);
+		goto errout;
+	}
+
+	if (sock_perf_bind(g_pps.sd, g_config.port) < 0 || sock_perf_settimeout(g_pps.sd) < 0) {
+		goto errout;
+	}
+
+	memset(&srvaddr, 0, sizeof(srvaddr));
+	srvaddr.sin_family = AF_INET;
+	srvaddr.sin_port = htons(g_config.port);
+	srvaddr.sin_addr = g_config.addr;
+
+	start = sock_perf_now();
+	ret = pthread_create(&thread, NULL, sock_perf_pps_recv, NULL);
+	if (ret != 0) {
+		printf("Cannot create the receiver, error %d\n", ret);
+		goto errout;
+	}
+
+	for (i = 0; i < g_config.nops; i++) {
+		if (sendto(cli, g_config.buffer, g_config.size, 0, (struct sockaddr *)&srvaddr, sizeof(srvaddr)) < 0) {
+			nfail++;
+		}
+	}
+	txusec = sock_perf_elapsed(start);
+
+	pthread_join(thread, NULL);
+
+	sock_perf_result("pps", "tx", (uint32_t)((uint64_t)(g_config.nops - nfail) * 1000000 / txusec), "pkt/s");
+	sock_perf_result("pps", "txfail", nfail, "count");
+	if (g_pps.nrecv > 0) {
+		uint32_t rxusec = g_pps.last > start ? (uint32_t)(g_pps.last - start) : 1;
+		sock_perf_result("pps", "rx", (uint32_t)((uint64_t)g_pps.nrecv * 1000000 / rxusec), "pkt/s");
+	}
+	sock_perf_result("pps", "lost", g_config.nops - nfail - g_pps.nrecv, "count");
+
+errout:
+	if (cli >= 0) {
+		close(cli);
+	}
+	if (g_pps.sd >= 0) {
+		close(g_pps.sd);
+	}
+}
+
+static void show_usage(const char *prog)
+{
+	printf("\nUsage: %s [OPTIONS] [udp|tcp|sockopt|connect|conc|pps|all]\n", prog);
+	printf("\nOptions:\n");
+	printf(" -a ADDR       Local IPv4 address of the socket pairs (default %s)\n", SOCK_PERF_DEFAULT_ADDR);
+	printf(" -n NOPS       Operations per run (default %d)\n", CONFIG_EXAMPLES_SOCKET_PERFORMANCE_NOPS);
+	printf(" -s SIZE       Bytes per packet, at most %d (default %d)\n", SOCK_PERF_MAX_SIZE, SOCK_PERF_DEFAULT_SIZE);
+	printf(" -p PORT       First port number (default %d)\n", CONFIG_EXAMPLES_SOCKET_PERFORMANCE_PORT);
+	printf(" -c MAXCONN    Most connections of the conc test, at most %d (default %d)\n", SOCK_PERF_MAX_CONN, CONFIG_EXAMPLES_SOCKET_PERFORMANCE_MAXCONN);
+	printf("\nResults are printed as lines of comma separated values starting with SOCKPERF.\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int sockperf_main(int argc, char *argv[])
+#endif
+{
+	const char *addr = SOCK_PERF_DEFAULT_ADDR;
+	int tests;
+	int opt;
+	int i;
+
+	memset(&g_config, 0, sizeof(g_config));
+	g_config.nops = CONFIG_EXAMPLES_SOCKET_PERFORMANCE_NOPS;
+	g_config.size = SOCK_PERF_DEFAULT_SIZE;
+	g_config.port = CONFIG_EXAMPLES_SOCKET_PERFORMANCE_PORT;
+	g_config.maxconn = CONFIG_EXAMPLES_SOCKET_PERFORMANCE_MAXCONN;
+	tests = SOCK_PERF_TEST_ALL;
+
+	while ((opt = getopt(argc, argv, "a:n:s:p:c:")) != ERROR) {
+		switch (opt) {
+		case 'a':
+			addr = optarg;
+			break;
+		case 'n':
+			g_config.nops = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			g_config.size = strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			g_config.port = atoi(optarg);
+			break;
+		case 'c':
+			g_config.maxconn = atoi(optarg);
+			break;
+		default:
+			goto usage;
+		}
+	}
+
+	if (optind < argc) {
+		for (i = 0; i < NTESTS; i++) {
+			if (strcmp(argv[optind], g_tests[i].name) == 0) {
+				tests = g_tests[i].test;
+				break;
+			}
+		}
+
+		if (i == NTESTS) {
+			printf("Unknown test %s\n", argv[optind]);
+			goto usage;
+		}
+	}
+
+	if (inet_aton(addr, &g_config.addr) == 0) {
+		printf("Invalid address %s\n", addr);
+		goto usage;
+	}
+
+	if (g_config.nops == 0 || g_config.size == 0 || g_config.size > SOCK_PERF_MAX_SIZE) {
+		printf("NOPS must not be zero and SIZE must be within 1..%d\n", SOCK_PERF_MAX_SIZE);
+		goto usage;
+	}
+
+	if (g_config.port <= 0 || g_config.port >= 65535) {
+		printf("Invalid port %d\n", g_config.port);
+		goto usage;
+	}
+
+	if (g_config.maxconn <= 0 || g_config.maxconn > SOCK_PERF_MAX_CONN) {
+		printf("MAXCONN must be within 1..%d\n", SOCK_PERF_MAX_CONN);
+		goto usage;
+	}
+
+	for (i = 0; i < (int)g_config.size; i++) {
+		g_config.buffer[i] = (uint8_t)i;
+	}
+
+	sock_perf_print_header();
+
+	if (tests & SOCK_PERF_TEST_SOCKOPT) {
+		sock_perf_sockopt();
+	}
+
+	if (tests & SOCK_PERF_TEST_UDP) {
+		sock_perf_udp();
+	}
+
+	if (tests & SOCK_PERF_TEST_TCP) {
+		sock_perf_tcp();
+	}
+
+	if (tests & SOCK_PERF_TEST_CONNECT) {
+		sock_perf_conn();
+	}
+
+	if (tests & SOCK_PERF_TEST_CONC) {
+		sock_perf_conc();
+	}
+
+	if (tests & SOCK_PERF_TEST_PPS) {
+		sock_perf_pps();
+	}
+
+	printf("\nSocket performance test done.\n");
+	return OK;
+
+usage:
+	show_usage(argv[0]);
+	return ERROR;
+}
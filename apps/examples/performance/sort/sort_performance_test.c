@@ -0,0 +1,290 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file sort_performance_test.c
+
+/// @brief Benchmark and check of qsort() and bsearch().
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define SORT_PERF_CLOCK        CLOCK_MONOTONIC
+#else
+#define SORT_PERF_CLOCK        CLOCK_REALTIME
+#endif
+
+#define SORT_PERF_RECPAD       28	/* 32 byte records */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum sort_perf_order_e {
+	SORT_PERF_RANDOM,
+	SORT_PERF_SORTED,
+	SORT_PERF_REVERSED,
+	SORT_PERF_ORGANPIPE,
+	SORT_PERF_NEARSORTED,
+	SORT_PERF_FEWUNIQUE,
+	SORT_PERF_NORDERS
+};
+
+struct sort_perf_rec_s {
+	int32_t key;
+	uint8_t payload[SORT_PERF_RECPAD];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *g_order_names[SORT_PERF_NORDERS] = {
+	"random", "sorted", "reversed", "organpipe", "nearsorted", "fewunique"
+};
+
+static uint32_t g_seed;
+static uint32_t g_ncompars;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t sort_perf_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(SORT_PERF_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* The same pseudo random sequence on every run and every platform */
+
+static uint32_t sort_perf_rand(void)
+{
+	g_seed = g_seed * 1103515245 + 12345;
+	return g_seed >> 1;
+}
+
+static int sort_perf_intcmp(const void *a, const void *b)
+{
+	int32_t x = *(const int32_t *)a;
+	int32_t y = *(const int32_t *)b;
+
+	g_ncompars++;
+	return (x > y) - (x < y);
+}
+
+static int sort_perf_reccmp(const void *a, const void *b)
+{
+	int32_t x = ((const struct sort_perf_rec_s *)a)->key;
+	int32_t y = ((const struct sort_perf_rec_s *)b)->key;
+
+	g_ncompars++;
+	return (x > y) - (x < y);
+}
+
+static void sort_perf_keys(int32_t *keys, int n, int order)
+{
+	int i;
+
+	g_seed = 1;
+	for (i = 0; i < n; i++) {
+		switch (order) {
+		case SORT_PERF_RANDOM:
+			keys[i] = (int32_t)sort_perf_rand();
+			break;
+		case SORT_PERF_SORTED:
+			keys[i] = i;
+			break;
+		case SORT_PERF_REVERSED:
+			keys[i] = n - i;
+			break;
+		case SORT_PERF_ORGANPIPE:
+			keys[i] = i < n / 2 ? i : n - i;
+			break;
+		case SORT_PERF_NEARSORTED:
+			keys[i] = (i % 100 == 0) ? (int32_t)(sort_perf_rand() % n) : i;
+			break;
+		case SORT_PERF_FEWUNIQUE:
+		default:
+			keys[i] = sort_perf_rand() % 16;
+			break;
+		}
+	}
+}
+
+/* Sort the keys, or records made of them, check the order and the content
+ * and search every key.  Return the number of errors.
+ */
+
+static int sort_perf_run(int32_t *keys, struct sort_perf_rec_s *recs, int n, int order, bool records)
+{
+	const char *type = records ? "rec32" : "int";
+	uint64_t start;
+	uint64_t elapsed;
+	uint32_t sum = 0;
+	uint32_t check = 0;
+	int errors = 0;
+	int i;
+
+	sort_perf_keys(keys, n, order);
+	for (i = 0; i < n; i++) {
+		sum += (uint32_t)keys[i];
+		if (records) {
+			recs[i].key = keys[i];
+			memset(recs[i].payload, (uint8_t)keys[i], SORT_PERF_RECPAD);
+		}
+	}
+
+	g_ncompars = 0;
+	start = sort_perf_now();
+	if (records) {
+		qsort(recs, n, sizeof(recs[0]), sort_perf_reccmp);
+	} else {
+		qsort(keys, n, sizeof(keys[0]), sort_perf_intcmp);
+	}
+	elapsed = sort_perf_now() - start;
+
+	printf("SORTPERF,qsort,%s,%s,%d,time,%lu,us\n", type, g_order_names[order], n, (unsigned long)elapsed);
+	printf("SORTPERF,qsort,%s,%s,%d,compares,%lu,count\n", type, g_order_names[order], n, (unsigned long)g_ncompars);
+
+	/* Sorted, and the same elements */
+
+	for (i = 0; i < n; i++) {
+		if (records) {
+			keys[i] = recs[i].key;
+			if (recs[i].payload[0] != (uint8_t)keys[i] || recs[i].payload[SORT_PERF_RECPAD - 1] != (uint8_t)keys[i]) {
+				errors++;
+			}
+		}
+
+		check += (uint32_t)keys[i];
+		if (i > 0 && keys[i - 1] > keys[i]) {
+			errors++;
+		}
+	}
+
+	if (check != sum) {
+		errors++;
+	}
+
+	/* Every key is found, and the neighbours of the keys are found only
+	 * when they are in the array.
+	 */
+
+	g_ncompars = 0;
+	start = sort_perf_now();
+	for (i = 0; i < n; i++) {
+		int32_t key = keys[i];
+		int32_t *found = (int32_t *)bsearch(&key, keys, n, sizeof(keys[0]), sort_perf_intcmp);
+
+		if (found == NULL || *found != key) {
+			errors++;
+		}
+
+		key++;
+		found = (int32_t *)bsearch(&key, keys, n, sizeof(keys[0]), sort_perf_intcmp);
+		if (found != NULL ? *found != key : (i + 1 < n && keys[i + 1] == key)) {
+			errors++;
+		}
+	}
+	elapsed = sort_perf_now() - start;
+
+	if (!records) {
+		printf("SORTPERF,bsearch,int,%s,%d,time,%lu,ns/search\n", g_order_names[order], n, (unsigned long)(elapsed * 1000 / (2 * n)));
+		printf("SORTPERF,bsearch,int,%s,%d,compares,%lu,count\n", g_order_names[order], n, (unsigned long)g_ncompars);
+	}
+
+	printf("SORTPERF,check,%s,%s,%d,errors,%d,count\n", type, g_order_names[order], n, errors);
+	return errors;
+}
+
+static void show_usage(const char *prog)
+{
+	printf("\nUsage: %s [-n ELEMENTS]\n", prog);
+	printf("\nOptions:\n");
+	printf(" -n ELEMENTS   Elements of the arrays (default %d)\n", CONFIG_EXAMPLES_SORT_PERFORMANCE_ELEMENTS);
+	printf("\nResults are printed as lines of comma separated values starting with SORTPERF.\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int sortperf_main(int argc, char *argv[])
+#endif
+{
+	struct sort_perf_rec_s *recs;
+	int32_t *keys;
+	int n = CONFIG_EXAMPLES_SORT_PERFORMANCE_ELEMENTS;
+	int errors = 0;
+	int order;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:")) != ERROR) {
+		switch (opt) {
+		case 'n':
+			n = (int)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			show_usage(argv[0]);
+			return ERROR;
+		}
+	}
+
+	if (n < 2) {
+		show_usage(argv[0]);
+		return ERROR;
+	}
+
+	keys = (int32_t *)malloc(n * sizeof(int32_t));
+	recs = (struct sort_perf_rec_s *)malloc(n * sizeof(struct sort_perf_rec_s));
+	if (keys == NULL || recs == NULL) {
+		printf("Cannot allocate %d elements\n", n);
+		free(keys);
+		free(recs);
+		return ERROR;
+	}
+
+	for (order = 0; order < SORT_PERF_NORDERS; order++) {
+		errors += sort_perf_run(keys, recs, n, order, false);
+		errors += sort_perf_run(keys, recs, n, order, true);
+	}
+
+	free(keys);
+	free(recs);
+	printf("\nSort performance test done, %d errors.\n", errors);
+	return errors == 0 ? OK : ERROR;
+}
@@ -0,0 +1,440 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file string_performance_test.c
+
+/// @brief Benchmark and check of the string and memory routines of libc.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define STR_PERF_CLOCK         CLOCK_MONOTONIC
+#else
+#define STR_PERF_CLOCK         CLOCK_REALTIME
+#endif
+
+#define STR_PERF_MAXSIZE       4096
+#define STR_PERF_SLACK         16	/* Room for the misalignment and the overlap */
+#define STR_PERF_BUFSIZE       (STR_PERF_MAXSIZE + 2 * STR_PERF_SLACK)
+#define STR_PERF_CHECK_ALIGN   8
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum str_perf_func_e {
+	STR_PERF_MEMCPY,
+	STR_PERF_MEMMOVE,
+	STR_PERF_MEMSET,
+	STR_PERF_MEMCMP,
+	STR_PERF_STRLEN,
+	STR_PERF_STRCMP,
+	STR_PERF_NFUNCS
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *g_func_names[STR_PERF_NFUNCS] = {
+	"memcpy", "memmove", "memset", "memcmp", "strlen", "strcmp"
+};
+
+static const size_t g_sizes[] = { 8, 32, 128, 512, 1500, 4096 };
+
+/* Destination and source offsets from a word boundary */
+
+static const struct {
+	uint8_t dst;
+	uint8_t src;
+} g_aligns[] = {
+	{ 0, 0 }, { 1, 1 }, { 0, 1 }, { 3, 2 },
+};
+
+#define NSIZES  (int)(sizeof(g_sizes) / sizeof(g_sizes[0]))
+#define NALIGNS (int)(sizeof(g_aligns) / sizeof(g_aligns[0]))
+
+static uint8_t *g_dst;
+static uint8_t *g_src;
+static volatile int g_sink;
+
+/* Called through pointers, so that the compiler cannot drop or inline the
+ * repeated calls of the measures.
+ */
+
+static void *(*volatile g_memcpy)(void *, const void *, size_t) = memcpy;
+static void *(*volatile g_memmove)(void *, const void *, size_t) = memmove;
+static void *(*volatile g_memset)(void *, int, size_t) = memset;
+static int (*volatile g_memcmp)(const void *, const void *, size_t) = memcmp;
+static size_t (*volatile g_strlen)(const char *) = strlen;
+static int (*volatile g_strcmp)(const char *, const char *) = strcmp;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t str_perf_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(STR_PERF_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* Byte by byte references of the checks */
+
+static int str_perf_refcmp(const uint8_t *s1, const uint8_t *s2, size_t n)
+{
+	while (n-- > 0) {
+		if (*s1 != *s2) {
+			return *s1 - *s2;
+		}
+		s1++;
+		s2++;
+	}
+
+	return 0;
+}
+
+static int str_perf_sign(int value)
+{
+	return value > 0 ? 1 : (value < 0 ? -1 : 0);
+}
+
+static void str_perf_pattern(uint8_t *buffer, size_t size, uint8_t seed)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		buffer[i] = (uint8_t)(seed + i * 7 + 1);
+		if (buffer[i] == 0) {
+			buffer[i] = 0x5a;
+		}
+	}
+}
+
+/* Check one routine at one size and alignment, guard bytes included.
+ * Return the number of errors.
+ */
+
+static int str_perf_check_one(int func, size_t size, int dalign, int salign)
+{
+	uint8_t *dst = g_dst + STR_PERF_SLACK + dalign;
+	uint8_t *src = g_src + STR_PERF_SLACK + salign;
+	uint8_t *ref = g_src;
+	int ret;
+	size_t i;
+
+	str_perf_pattern(g_dst, STR_PERF_BUFSIZE, 0x11);
+	str_perf_pattern(g_src, STR_PERF_BUFSIZE, 0x22);
+
+	switch (func) {
+	case STR_PERF_MEMCPY:
+		if (memcpy(dst, src, size) != dst || str_perf_refcmp(dst, src, size) != 0) {
+			return 1;
+		}
+		break;
+
+	case STR_PERF_MEMMOVE:
+		/* Overlapping moves both ways inside the destination buffer */
+
+		src = g_dst + STR_PERF_SLACK + salign;
+		dst = src + dalign + 1;
+		memcpy(g_src, src, size);
+		if (memmove(dst, src, size) != dst || str_perf_refcmp(dst, g_src, size) != 0) {
+			return 1;
+		}
+
+		str_perf_pattern(g_dst, STR_PERF_BUFSIZE, 0x11);
+		dst = g_dst + STR_PERF_SLACK + salign;
+		src = dst + dalign + 1;
+		memcpy(g_src, src, size);
+		if (memmove(dst, src, size) != dst || str_perf_refcmp(dst, g_src, size) != 0) {
+			return 1;
+		}
+		return 0;
+
+	case STR_PERF_MEMSET:
+		if (memset(dst, 0x1a5, size) != dst) {
+			return 1;
+		}
+		for (i = 0; i < size; i++) {
+			if (dst[i] != 0xa5) {
+				return 1;
+			}
+		}
+		break;
+
+	case STR_PERF_MEMCMP:
+		memcpy(dst, src, size);
+		if (memcmp(dst, src, size) != 0) {
+			return 1;
+		}
+		if (size > 0) {
+			dst[size - 1 - (size / 3)] ^= 0x80;
+			ret = memcmp(dst, src, size);
+			if (ret == 0 || str_perf_sign(ret) != str_perf_sign(str_perf_refcmp(dst, src, size))) {
+				return 1;
+			}
+		}
+		return 0;
+
+	case STR_PERF_STRLEN:
+		src[size] = '\0';
+		return strlen((const char *)src) != size;
+
+	case STR_PERF_STRCMP:
+		src[size] = '\0';
+		memcpy(dst, src, size + 1);
+		if (strcmp((const char *)dst, (const char *)src) != 0) {
+			return 1;
+		}
+		if (size > 0) {
+			dst[size / 2] ^= 0x80;
+			ret = strcmp((const char *)dst, (const char *)src);
+			if (ret == 0 || str_perf_sign(ret) != str_perf_sign(dst[size / 2] - src[size / 2])) {
+				return 1;
+			}
+		}
+		return 0;
+
+	default:
+		return 0;
+	}
+
+	/* The bytes around the destination are untouched */
+
+	str_perf_pattern(ref, STR_PERF_BUFSIZE, 0x11);
+	return str_perf_refcmp(g_dst, ref, STR_PERF_SLACK + dalign) != 0 ||
+		   str_perf_refcmp(dst + size, ref + (dst + size - g_dst), STR_PERF_SLACK) != 0;
+}
+
+/* Check every routine from 0 to 80 bytes and around the block sizes of the
+ * optimized routines, at every alignment.
+ */
+
+static int str_perf_check(int func)
+{
+	static const size_t extra[] = { 127, 128, 129, 255, 256, 257, 1023, 1024, 1025 };
+	size_t size;
+	int errors = 0;
+	int dalign;
+	int salign;
+	int i;
+
+	for (i = 0; i <= 80 + (int)(sizeof(extra) / sizeof(extra[0])); i++) {
+		size = i <= 80 ? i : extra[i - 81];
+		for (dalign = 0; dalign < STR_PERF_CHECK_ALIGN; dalign++) {
+			for (salign = 0; salign < STR_PERF_CHECK_ALIGN; salign++) {
+				if (str_perf_check_one(func, size, dalign, salign) != 0) {
+					if (errors++ < 4) {
+						printf("%s failed: size %lu, dst +%d, src +%d\n", g_func_names[func], (unsigned long)size, dalign, salign);
+					}
+				}
+			}
+		}
+	}
+
+	printf("STRPERF,%s,check,0,errors,%d,count\n", g_func_names[func], errors);
+	return errors;
+}
+
+/* Call the routine on 'size' bytes until about 'nbytes' were processed and
+ * return the throughput in KB/s.
+ */
+
+static uint32_t str_perf_measure(int func, size_t size, int dalign, int salign, uint32_t nbytes)
+{
+	uint8_t *dst = g_dst + STR_PERF_SLACK + dalign;
+	uint8_t *src = g_src + STR_PERF_SLACK + salign;
+	uint32_t loops = nbytes / size;
+	uint32_t i;
+	uint64_t start;
+	uint64_t elapsed;
+	int sink = 0;
+
+	if (loops == 0) {
+		loops = 1;
+	}
+
+	str_perf_pattern(g_src, STR_PERF_BUFSIZE, 0x22);
+	memcpy(dst, src, size);
+	src[size] = '\0';
+	dst[size] = '\0';
+
+	start = str_perf_now();
+	switch (func) {
+	case STR_PERF_MEMCPY:
+		for (i = 0; i < loops; i++) {
+			g_memcpy(dst, src, size);
+		}
+		break;
+	case STR_PERF_MEMMOVE:
+		/* Overlapping, from the end */
+		for (i = 0; i < loops; i++) {
+			g_memmove(src + STR_PERF_SLACK / 2, src, size);
+		}
+		break;
+	case STR_PERF_MEMSET:
+		for (i = 0; i < loops; i++) {
+			g_memset(dst, (int)i, size);
+		}
+		break;
+	case STR_PERF_MEMCMP:
+		for (i = 0; i < loops; i++) {
+			sink += g_memcmp(dst, src, size);
+		}
+		break;
+	case STR_PERF_STRLEN:
+		for (i = 0; i < loops; i++) {
+			sink += g_strlen((const char *)src);
+		}
+		break;
+	case STR_PERF_STRCMP:
+		for (i = 0; i < loops; i++) {
+			sink += g_strcmp((const char *)dst, (const char *)src);
+		}
+		break;
+	default:
+		break;
+	}
+	elapsed = str_perf_now() - start;
+	g_sink = sink;
+
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	return (uint32_t)(((uint64_t)loops * size * 1000000 / 1024) / elapsed);
+}
+
+static void str_perf_run(int func, uint32_t nbytes)
+{
+	int i;
+	int j;
+
+	for (i = 0; i < NSIZES; i++) {
+		for (j = 0; j < NALIGNS; j++) {
+			printf("STRPERF,%s,%lu,d%ds%d,throughput,%lu,KB/s\n", g_func_names[func], (unsigned long)g_sizes[i], g_aligns[j].dst, g_aligns[j].src,
+				   (unsigned long)str_perf_measure(func, g_sizes[i], g_aligns[j].dst, g_aligns[j].src, nbytes));
+		}
+	}
+}
+
+static void show_usage(const char *prog)
+{
+	printf("\nUsage: %s [-c] [-n BYTES] [memcpy|memmove|memset|memcmp|strlen|strcmp|all]\n", prog);
+	printf("\nOptions:\n");
+	printf(" -c            Only check the results of the routines\n");
+	printf(" -n BYTES      Bytes processed per measure (default %d)\n", CONFIG_EXAMPLES_STRING_PERFORMANCE_BYTES);
+	printf("\nResults are printed as lines of comma separated values starting with STRPERF.\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int strperf_main(int argc, char *argv[])
+#endif
+{
+	uint32_t nbytes = CONFIG_EXAMPLES_STRING_PERFORMANCE_BYTES;
+	bool checkonly = false;
+	int first = 0;
+	int last = STR_PERF_NFUNCS - 1;
+	int errors = 0;
+	int func;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "cn:")) != ERROR) {
+		switch (opt) {
+		case 'c':
+			checkonly = true;
+			break;
+		case 'n':
+			nbytes = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			show_usage(argv[0]);
+			return ERROR;
+		}
+	}
+
+	if (optind < argc && strcmp(argv[optind], "all") != 0) {
+		for (func = 0; func < STR_PERF_NFUNCS; func++) {
+			if (strcmp(argv[optind], g_func_names[func]) == 0) {
+				break;
+			}
+		}
+
+		if (func == STR_PERF_NFUNCS) {
+			printf("Unknown routine %s\n", argv[optind]);
+			show_usage(argv[0]);
+			return ERROR;
+		}
+
+		first = last = func;
+	}
+
+	g_dst = (uint8_t *)malloc(STR_PERF_BUFSIZE);
+	g_src = (uint8_t *)malloc(STR_PERF_BUFSIZE);
+	if (g_dst == NULL || g_src == NULL) {
+		printf("Cannot allocate the buffers\n");
+		free(g_dst);
+		free(g_src);
+		return ERROR;
+	}
+
+	printf("STRPERF,config,memcpy,%s\n",
+#if defined(CONFIG_ARCH_MEMCPY)
+		   "arch"
+#elif defined(CONFIG_MEMCPY_VIK)
+		   "vik"
+#else
+		   "c"
+#endif
+		  );
+
+	for (func = first; func <= last; func++) {
+		errors += str_perf_check(func);
+		if (!checkonly) {
+			str_perf_run(func, nbytes);
+		}
+	}
+
+	free(g_dst);
+	free(g_src);
+	printf("\nString performance test done, %d errors.\n", errors);
+	return errors == 0 ? OK : ERROR;
+}
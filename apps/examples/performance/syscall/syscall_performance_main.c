@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sched.h>
 #include <errno.h>
 #include <time.h>
@@ -28,12 +29,19 @@
 #include <sys/ioctl.h>
 #include <sys/types.h>
 #include <fcntl.h>
+#include <unistd.h>
+#include <semaphore.h>
+#ifdef CONFIG_LIB_SYSCALL_BATCH
+#include <syscall.h>
+#include <tinyara/syscall_batch.h>
+#endif
 
 #define NUM_LOOPS	1000000
 #define SEC_10	10
 #define TEST_MSGLEN	31
 #define TEST_TIMEDSEND_NMSGS	3
 #define SIGEV_SIGNAL	1		/* Notify via signal */
+#define BATCH_NPAIRS	4		/* sem_post()/sem_trywait() pairs of a batch */
 
 static int sig_no = SIGRTMIN;
 
@@ -173,6 +181,105 @@ static void syscall_perf_timer_settime(void)
 	measure_performance(timer_settime, 4, timer_id, 0, NULL, NULL);
 }
 
+/*
+ * @fn                   :syscall_perf_getpid
+ * @description          :Measuring performance for getpid, which reads the
+ *                        vDSO page with CONFIG_LIB_SYSCALL_VDSO
+ * @return               :void
+ */
+static void syscall_perf_getpid(void)
+{
+	measure_performance(getpid, 0);
+}
+
+/*
+ * @fn                   :syscall_perf_clock_gettime
+ * @description          :Measuring performance for clock_gettime, which reads
+ *                        the vDSO page with CONFIG_LIB_SYSCALL_VDSO
+ * @return               :void
+ */
+static void syscall_perf_clock_gettime(void)
+{
+	struct timespec st_ts;
+
+	measure_performance(clock_gettime, 2, CLOCK_MONOTONIC, &st_ts);
+}
+
+/*
+ * @fn                   :syscall_perf_sched_yield
+ * @description          :Measuring performance for sched_yield
+ * @return               :void
+ */
+static void syscall_perf_sched_yield(void)
+{
+	measure_performance(sched_yield, 0);
+}
+
+/*
+ * @fn                   :sem_post_trywait
+ * @description          :One sem_post and one sem_trywait, so that the count
+ *                        of the semaphore does not overflow
+ * @return               :int
+ */
+static int sem_post_trywait(sem_t *sem)
+{
+	sem_post(sem);
+	return sem_trywait(sem);
+}
+
+/*
+ * @fn                   :syscall_perf_sem_post
+ * @description          :Measuring performance for sem_post and sem_trywait
+ * @return               :void
+ */
+static void syscall_perf_sem_post(void)
+{
+	sem_t sem;
+
+	sem_init(&sem, 0, 0);
+	measure_performance(sem_post_trywait, 1, &sem);
+	sem_destroy(&sem);
+}
+
+#ifdef CONFIG_LIB_SYSCALL_BATCH
+/*
+ * @fn                   :sem_post_trywait_batch
+ * @description          :BATCH_NPAIRS sem_post and sem_trywait pairs in one
+ *                        syscall_batch trap
+ * @return               :int
+ */
+static int sem_post_trywait_batch(struct syscall_op_s *ops)
+{
+	return syscall_batch(ops, 2 * BATCH_NPAIRS, 0);
+}
+
+/*
+ * @fn                   :syscall_perf_sem_post_batch
+ * @description          :Measuring performance for the same calls as
+ *                        syscall_perf_sem_post, batched.  Each pass runs
+ *                        BATCH_NPAIRS pairs.
+ * @return               :void
+ */
+static void syscall_perf_sem_post_batch(void)
+{
+	struct syscall_op_s ops[2 * BATCH_NPAIRS];
+	sem_t sem;
+	int i;
+
+	sem_init(&sem, 0, 0);
+	memset(ops, 0, sizeof(ops));
+	for (i = 0; i < 2 * BATCH_NPAIRS; i += 2) {
+		ops[i].nbr = SYS_sem_post;
+		ops[i].parm[0] = (uintptr_t)&sem;
+		ops[i + 1].nbr = SYS_sem_trywait;
+		ops[i + 1].parm[0] = (uintptr_t)&sem;
+	}
+
+	measure_performance(sem_post_trywait_batch, 3, ops);
+	sem_destroy(&sem);
+}
+#endif
+
 /****************************************************************************
  * Name: Syscall Performance
  ****************************************************************************/
@@ -213,5 +320,16 @@ int syscall_performance_main(void)
 	syscall_perf_mq_open();
 	sched_unlock();
 
+	/* Hot system calls */
+	sched_lock();
+	syscall_perf_getpid();
+	syscall_perf_clock_gettime();
+	syscall_perf_sched_yield();
+	syscall_perf_sem_post();
+#ifdef CONFIG_LIB_SYSCALL_BATCH
+	syscall_perf_sem_post_batch();
+#endif
+	sched_unlock();
+
 	return 0;
 }
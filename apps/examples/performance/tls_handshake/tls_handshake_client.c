@@ -16,6 +16,9 @@
  *
  ****************************************************************************/
 #include <tinyara/config.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <time.h>
 
 #include "mbedtls/config.h"
@@ -26,6 +29,9 @@
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/error.h"
 #include "mbedtls/test/certs.h"
+#ifdef CONFIG_TLS_SESSION_CACHE
+#include "mbedtls/tls_session_cache.h"
+#endif
 
 #include <string.h>
 
@@ -35,6 +41,12 @@ static char *SERVER_ADDR = NULL;
 
 #define DEBUG_LEVEL 0
 
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define TLS_HANDSHAKE_CLOCK CLOCK_MONOTONIC
+#else
+#define TLS_HANDSHAKE_CLOCK CLOCK_REALTIME
+#endif
+
 #define mbedtls_printf printf
 
 static void my_debug(void *ctx, int level,
@@ -48,6 +60,21 @@ static void my_debug(void *ctx, int level,
 	fflush((FILE *)ctx);
 }
 
+static uint64_t tls_handshake_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(TLS_HANDSHAKE_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* Same line format as sockperf, so both can be collected together */
+
+static void tls_handshake_result(const char *metric, uint64_t usec)
+{
+	printf("SOCKPERF,tls,0,%s,%lu,us\n", metric, (unsigned long)usec);
+}
+
 static unsigned char rootca[] =
 	"-----BEGIN CERTIFICATE-----\r\n"
 	"MIICLTCCAdOgAwIBAgIBATAKBggqhkjOPQQDAjCBjTELMAkGA1UEBhMCS1IxLjAs\r\n"
@@ -80,6 +107,8 @@ int tls_handshake_client(char *ipaddr)
 	mbedtls_x509_crt cacert;
 	int ret = 1;
 	int len = 0;
+	uint64_t start;
+	uint64_t connect_usec;
 	struct timespec ts;
 	SERVER_ADDR = ipaddr;
 	ts.tv_sec = 1633074152; // 2021-10-01
@@ -134,11 +163,13 @@ int tls_handshake_client(char *ipaddr)
 	mbedtls_printf("	. Connecting to tcp/%s/%s...", SERVER_ADDR, SERVER_PORT);
 	fflush(stdout);
 
+	start = tls_handshake_now();
 	if ((ret = mbedtls_net_connect(&server_fd, SERVER_ADDR,
 								   SERVER_PORT, MBEDTLS_NET_PROTO_TCP)) != 0) {
 		mbedtls_printf(" failed\n	 ! mbedtls_net_connect returned %d\n\n", ret);
 		goto exit;
 	}
+	connect_usec = tls_handshake_now() - start;
 
 	mbedtls_printf(" ok\n");
 
@@ -178,14 +209,28 @@ int tls_handshake_client(char *ipaddr)
 	mbedtls_printf("	. Performing the SSL/TLS handshake...");
 	fflush(stdout);
 
+#ifdef CONFIG_TLS_SESSION_CACHE
+	/* The handshakes after the first one resume the session */
+	tls_session_cache_set(&ssl, SERVER_ADDR, atoi(SERVER_PORT));
+#endif
+
+	start = tls_handshake_now();
 	while ((ret = mbedtls_ssl_handshake(&ssl)) != 0) {
 		if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
 			mbedtls_printf(" failed\n	 ! mbedtls_ssl_handshake returned -0x%x\n\n", (unsigned int)-ret);
+#ifdef CONFIG_TLS_SESSION_CACHE
+			tls_session_cache_remove(SERVER_ADDR, atoi(SERVER_PORT));
+#endif
 			goto exit;
 		}
 	}
 
 	mbedtls_printf(" ok\n");
+	tls_handshake_result("connect", connect_usec);
+	tls_handshake_result("handshake", tls_handshake_now() - start);
+#ifdef CONFIG_TLS_SESSION_CACHE
+	tls_session_cache_update(&ssl, SERVER_ADDR, atoi(SERVER_PORT));
+#endif
 
 	/*
 		 * 5. Verify the server certificate
@@ -24,16 +24,40 @@
 #include <pthread.h>
 #include "tls_handshake_usage.h"
 
+#ifdef CONFIG_TLS_SESSION_CACHE
+#include "mbedtls/tls_session_cache.h"
+#endif
+
 extern int tls_handshake_server(void);
 extern int tls_handshake_client(char *ipaddr);
 
+#ifdef CONFIG_TLS_SESSION_CACHE
+static void tls_handshake_print_cache(void)
+{
+	struct tls_session_cache_stats st;
+
+	tls_session_cache_get_stats(&st);
+	printf("SOCKPERF,tls,0,offered,%lu,count\n", (unsigned long)st.offered);
+	printf("SOCKPERF,tls,0,resumed,%lu,count\n", (unsigned long)st.resumed);
+}
+#endif
+
 int tls_handshake_main(int argc, char **argv)
 {
+	int count;
+	int i;
+
 	if (argc == 2 && !strncmp("-s", argv[1], 3)) {
 		tls_handshake_server();
 		return 0;
-	} else if (argc == 3 && !strncmp("-c", argv[1], 3)) {
-		tls_handshake_client(argv[2]);
+	} else if ((argc == 3 || argc == 4) && !strncmp("-c", argv[1], 3)) {
+		count = argc == 4 ? atoi(argv[3]) : 1;
+		for (i = 0; i < count; i++) {
+			tls_handshake_client(argv[2]);
+		}
+#ifdef CONFIG_TLS_SESSION_CACHE
+		tls_handshake_print_cache();
+#endif
 		return 0;
 	}
 
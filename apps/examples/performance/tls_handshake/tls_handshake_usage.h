@@ -21,8 +21,8 @@
 	"example: tls_handshake -s\n"
 
 #define TLS_HANDSHAKE_CLIENT_USAGE    \
-	"\ntls_handshake -c <target_address>\n" \
-	"example: tls_handshake -c 127.0.0.1\n"
+	"\ntls_handshake -c <target_address> [count]\n" \
+	"example: tls_handshake -c 127.0.0.1 5\n"
 
 #define TLS_HANDSHAKE_USAGE        \
 	"usage: tls_handshake <mode>\n" \
@@ -0,0 +1,206 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file usb_performance_main.c
+
+/// @brief Measure the sustained bulk throughput of the CDC-ACM serial port.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define USB_PERF_DEVPATH   "/dev/ttyACM0"
+#define USB_PERF_BUFSIZE   4096
+#define USB_PERF_MAXBUF    65536
+#define USB_PERF_SECONDS   10
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t usb_perf_usec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void usb_perf_print(int second, uint64_t nbytes, uint64_t usec)
+{
+	printf(" %6d | %12llu | %10llu\n", second, (unsigned long long)nbytes,
+		   (unsigned long long)(usec ? nbytes * 1000000 / usec / 1024 : 0));
+}
+
+/* Write or read the buffer until the run time has elapsed. The time of a
+ * read run starts with the first data from the host.
+ */
+
+static int usb_perf_run(int fd, FAR uint8_t *buf, int bufsize, int seconds, bool rx)
+{
+	uint64_t start = 0;
+	uint64_t last = 0;
+	uint64_t now;
+	uint64_t total = 0;
+	uint64_t interval = 0;
+	uint64_t maxlat = 0;
+	uint64_t before;
+	ssize_t n;
+	int second = 0;
+
+	printf(" Second |        Bytes |     KiB/s\n");
+	printf("--------|--------------|-----------\n");
+
+	while (second < seconds) {
+		before = usb_perf_usec();
+		if (rx) {
+			n = read(fd, buf, bufsize);
+		} else {
+			n = write(fd, buf, bufsize);
+		}
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			printf("%s failed: %d\n", rx ? "read" : "write", errno);
+			return -1;
+		}
+
+		now = usb_perf_usec();
+		if (start == 0) {
+			start = rx ? now : before;
+			last = start;
+		} else if (now - before > maxlat) {
+			maxlat = now - before;
+		}
+
+		total += n;
+		interval += n;
+		if (now - last >= 1000000) {
+			usb_perf_print(++second, interval, now - last);
+			last = now;
+			interval = 0;
+		}
+	}
+
+	printf("--------|--------------|-----------\n");
+	usb_perf_print(seconds, total, now - start);
+	printf("Longest %s() call : %llu us\n", rx ? "read" : "write", (unsigned long long)maxlat);
+	return 0;
+}
+
+static void usb_perf_usage(const char *name)
+{
+	printf("Usage: %s [-r] [-s size] [-t seconds] [device]\n", name);
+	printf("  -r : read what the host sends instead of writing to it\n");
+	printf("  -s : bytes per read() or write(), 1 - %d (default %d)\n", USB_PERF_MAXBUF, USB_PERF_BUFSIZE);
+	printf("  -t : duration of the run in seconds (default %d)\n", USB_PERF_SECONDS);
+	printf("  device : serial device (default %s)\n", USB_PERF_DEVPATH);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int usbperf_main(int argc, char *argv[])
+#endif
+{
+	const char *devpath = USB_PERF_DEVPATH;
+	FAR uint8_t *buf;
+	int bufsize = USB_PERF_BUFSIZE;
+	int seconds = USB_PERF_SECONDS;
+	bool rx = false;
+	int ret;
+	int opt;
+	int fd;
+	int i;
+
+	optind = 0;
+	while ((opt = getopt(argc, argv, "rs:t:")) != ERROR) {
+		switch (opt) {
+		case 'r':
+			rx = true;
+			break;
+		case 's':
+			bufsize = atoi(optarg);
+			break;
+		case 't':
+			seconds = atoi(optarg);
+			break;
+		default:
+			usb_perf_usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if (optind < argc) {
+		devpath = argv[optind];
+	}
+
+	if (bufsize < 1 || bufsize > USB_PERF_MAXBUF || seconds < 1) {
+		usb_perf_usage(argv[0]);
+		return -1;
+	}
+
+	buf = (FAR uint8_t *)malloc(bufsize);
+	if (buf == NULL) {
+		printf("Failed to allocate %d bytes\n", bufsize);
+		return -1;
+	}
+
+	/* A counting pattern, so that the host can check the stream */
+
+	for (i = 0; i < bufsize; i++) {
+		buf[i] = (uint8_t)i;
+	}
+
+	fd = open(devpath, rx ? O_RDONLY : O_WRONLY);
+	if (fd < 0) {
+		printf("Failed to open %s: %d\n", devpath, errno);
+		free(buf);
+		return -1;
+	}
+
+	printf("USB Bulk Throughput Measurement\n");
+	printf("Device : %s, %s, %d bytes per call\n", devpath, rx ? "host to device" : "device to host", bufsize);
+	if (rx) {
+		printf("Waiting for data from the host...\n");
+	}
+
+	ret = usb_perf_run(fd, buf, bufsize, seconds, rx);
+
+	close(fd);
+	free(buf);
+	return ret;
+}
@@ -0,0 +1,276 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file wdog_performance_main.c
+
+/// @brief Measure the cost of starting, cancelling and expiring watchdog timers.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <tinyara/clock.h>
+#include <tinyara/wdog.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define WDOG_PERF_MAX_TIMERS   1024
+#define WDOG_PERF_NTIMERS      256
+#define WDOG_PERF_NROUNDS      100
+
+/* Delays of the start/cancel runs, long enough for no timer to expire */
+
+#define WDOG_PERF_MIN_DELAY    (10 * CLOCKS_PER_SEC)
+#define WDOG_PERF_MAX_DELAY    (1000 * CLOCKS_PER_SEC)
+
+/* The expirations are spread over this number of ticks */
+
+#define WDOG_PERF_EXPIRE_TICKS 100
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static WDOG_ID g_wdogs[WDOG_PERF_MAX_TIMERS];
+static int g_delays[WDOG_PERF_MAX_TIMERS];
+static int g_order[WDOG_PERF_MAX_TIMERS];
+static volatile int g_nexpired;
+static uint32_t g_seed = 1;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* xorshift32, so that the runs are the same with both timer queues */
+
+static uint32_t wdog_perf_rand(void)
+{
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t wdog_perf_nsec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void wdog_perf_expired(int argc, uint32_t arg)
+{
+	g_nexpired++;
+}
+
+/* Start 'ntimers' watchdogs with random delays, then cancel them in a
+ * random order, 'nrounds' times.  The latter timers of a round are started
+ * with all the former ones active, which is what a sorted queue pays for.
+ */
+
+static void wdog_perf_startcancel(int ntimers, int nrounds)
+{
+	uint64_t tstart = 0;
+	uint64_t tcancel = 0;
+	uint64_t t0;
+	int round;
+	int tmp;
+	int i;
+	int j;
+
+	for (round = 0; round < nrounds; round++) {
+		for (i = 0; i < ntimers; i++) {
+			g_delays[i] = WDOG_PERF_MIN_DELAY + wdog_perf_rand() % (WDOG_PERF_MAX_DELAY - WDOG_PERF_MIN_DELAY);
+			g_order[i] = i;
+		}
+
+		for (i = ntimers - 1; i > 0; i--) {
+			j = wdog_perf_rand() % (i + 1);
+			tmp = g_order[i];
+			g_order[i] = g_order[j];
+			g_order[j] = tmp;
+		}
+
+		t0 = wdog_perf_nsec();
+		for (i = 0; i < ntimers; i++) {
+			wd_start(g_wdogs[i], g_delays[i], (wdentry_t)wdog_perf_expired, 1, (uint32_t)i);
+		}
+		tstart += wdog_perf_nsec() - t0;
+
+		t0 = wdog_perf_nsec();
+		for (i = 0; i < ntimers; i++) {
+			wd_cancel(g_wdogs[g_order[i]]);
+		}
+		tcancel += wdog_perf_nsec() - t0;
+	}
+
+	printf(" %8d | %10llu | %10llu\n", ntimers,
+		(unsigned long long)(tstart / ((uint64_t)ntimers * nrounds)),
+		(unsigned long long)(tcancel / ((uint64_t)ntimers * nrounds)));
+}
+
+/* Count the iterations of a busy loop during 'ticks' ticks */
+
+static uint32_t wdog_perf_spin(clock_t ticks)
+{
+	volatile uint32_t count = 0;
+	clock_t start;
+
+	/* Begin on a tick boundary */
+
+	start = clock_systimer();
+	while (clock_systimer() == start);
+
+	start = clock_systimer();
+	while (clock_systimer() - start < ticks) {
+		count++;
+	}
+
+	return count;
+}
+
+/* The time taken by the expirations is measured by what they steal from a
+ * busy loop of the highest priority, spread over WDOG_PERF_EXPIRE_TICKS.
+ */
+
+static void wdog_perf_expire(int ntimers)
+{
+	uint32_t idle;
+	uint32_t busy;
+	uint64_t lost;
+	int i;
+
+	idle = wdog_perf_spin(WDOG_PERF_EXPIRE_TICKS);
+
+	g_nexpired = 0;
+	for (i = 0; i < ntimers; i++) {
+		wd_start(g_wdogs[i], 2 + wdog_perf_rand() % (WDOG_PERF_EXPIRE_TICKS - 2), (wdentry_t)wdog_perf_expired, 1, (uint32_t)i);
+	}
+
+	busy = wdog_perf_spin(WDOG_PERF_EXPIRE_TICKS);
+
+	/* The loop may have run less than the timers, wait for all of them */
+
+	while (g_nexpired < ntimers) {
+		usleep(USEC_PER_TICK);
+	}
+
+	lost = busy < idle ? (uint64_t)(idle - busy) * WDOG_PERF_EXPIRE_TICKS * USEC_PER_TICK * 1000 / idle : 0;
+	printf(" %8d | %10llu\n", ntimers, (unsigned long long)(lost / ntimers));
+}
+
+static void wdog_perf_usage(const char *name)
+{
+	printf("Usage: %s [-n timers] [-r rounds]\n", name);
+	printf("  -n : largest number of active timers, 1 - %d (default %d)\n", WDOG_PERF_MAX_TIMERS, WDOG_PERF_NTIMERS);
+	printf("  -r : rounds of the start/cancel runs (default %d)\n", WDOG_PERF_NROUNDS);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int wdogperf_main(int argc, char *argv[])
+#endif
+{
+	struct sched_param param;
+	struct sched_param saved;
+	int ntimers = WDOG_PERF_NTIMERS;
+	int nrounds = WDOG_PERF_NROUNDS;
+	int ncreated;
+	int opt;
+	int n;
+
+	optind = 0;
+	while ((opt = getopt(argc, argv, "n:r:")) != ERROR) {
+		switch (opt) {
+		case 'n':
+			ntimers = atoi(optarg);
+			break;
+		case 'r':
+			nrounds = atoi(optarg);
+			break;
+		default:
+			wdog_perf_usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if (ntimers < 1 || ntimers > WDOG_PERF_MAX_TIMERS || nrounds < 1) {
+		wdog_perf_usage(argv[0]);
+		return -1;
+	}
+
+	for (ncreated = 0; ncreated < ntimers; ncreated++) {
+		g_wdogs[ncreated] = wd_create();
+		if (g_wdogs[ncreated] == NULL) {
+			printf("Failed to create watchdog %d\n", ncreated);
+			goto errout;
+		}
+	}
+
+	printf("Watchdog Timer Performance Measurement\n");
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+	printf("Timer queue : hierarchical timer wheel\n");
+#else
+	printf("Timer queue : sorted list\n");
+#endif
+
+	/* Nothing but the timer interrupt must run during the measurements */
+
+	sched_getparam(0, &saved);
+	param.sched_priority = SCHED_PRIORITY_MAX;
+	sched_setparam(0, &param);
+
+	printf("\n==== Start and cancel, ns per operation ====\n");
+	printf("   Timers |   wd_start |  wd_cancel\n");
+	printf("----------|------------|-----------\n");
+	for (n = 4; n < ntimers; n *= 4) {
+		wdog_perf_startcancel(n, nrounds);
+	}
+	wdog_perf_startcancel(ntimers, nrounds);
+
+	printf("\n==== Expiration, ns per timer ====\n");
+	printf("   Timers |     expire\n");
+	printf("----------|-----------\n");
+	for (n = 4; n < ntimers; n *= 4) {
+		wdog_perf_expire(n);
+	}
+	wdog_perf_expire(ntimers);
+
+	sched_setparam(0, &saved);
+
+errout:
+	while (ncreated > 0) {
+		wd_delete(g_wdogs[--ncreated]);
+	}
+
+	return 0;
+}
@@ -49,6 +49,10 @@
 #include <tinyara/streams.h>
 #include <tinyara/fs/ioctl.h>
 #include <tinyara/fs/fs_utils.h>
+#ifdef CONFIG_FS_BCACHE
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/bcache.h>
+#endif
 #include <tinyara/configdata.h>
 #include <time.h>
 #include "tc_common.h"
@@ -128,6 +132,7 @@ static char *TMP_MOUNT_DEV_DIR;
 #define LONG_FILE_CONTENTS "Yesterday all my trouble seemed so far away. Now it looks as though they're here to stay. Oh, I believe in yesterday."
 
 #define DEV_RAMDISK_PATH "/dev/ram2"
+#define DEV_BCACHE_PATH "/dev/bcachetc"
 
 #define LONG_FILE_LOOP_COUNT 24
 
@@ -6120,6 +6125,134 @@ static void tc_fs_driver_ramdisk_ops_p(void)
 }
 #endif
 
+#if defined(CONFIG_FS_BCACHE) && !defined(CONFIG_BUILD_PROTECTED)
+/* A block driver in memory which bcache accepts, as it has no
+ * BIOC_DIRECTMAP.  Sector 2 is written, the window read ahead over it while
+ * its page is dirty, then the page is written back and evicted.
+ */
+
+#define BCACHE_TC_SECTSIZE  64
+#define BCACHE_TC_SECTOR    2
+#define BCACHE_TC_FAR       (BCACHE_TC_SECTOR + CONFIG_FS_BCACHE_READAHEAD + 2)
+#define BCACHE_TC_NSECTORS  (BCACHE_TC_FAR + 2 * CONFIG_FS_BCACHE_NPAGES + 2)
+
+static uint8_t *g_bcache_tc_disk;
+
+static ssize_t bcache_tc_read(FAR struct inode *inode, FAR unsigned char *buffer, size_t start_sector, unsigned int nsectors)
+{
+	if (start_sector + nsectors > BCACHE_TC_NSECTORS) {
+		nsectors = BCACHE_TC_NSECTORS - start_sector;
+	}
+
+	memcpy(buffer, &g_bcache_tc_disk[start_sector * BCACHE_TC_SECTSIZE], nsectors * BCACHE_TC_SECTSIZE);
+	return nsectors;
+}
+
+static ssize_t bcache_tc_write(FAR struct inode *inode, FAR const unsigned char *buffer, size_t start_sector, unsigned int nsectors)
+{
+	if (start_sector + nsectors > BCACHE_TC_NSECTORS) {
+		nsectors = BCACHE_TC_NSECTORS - start_sector;
+	}
+
+	memcpy(&g_bcache_tc_disk[start_sector * BCACHE_TC_SECTSIZE], buffer, nsectors * BCACHE_TC_SECTSIZE);
+	return nsectors;
+}
+
+static int bcache_tc_geometry(FAR struct inode *inode, FAR struct geometry *geometry)
+{
+	geometry->geo_available = true;
+	geometry->geo_mediachanged = false;
+	geometry->geo_writeenabled = true;
+	geometry->geo_nsectors = BCACHE_TC_NSECTORS;
+	geometry->geo_sectorsize = BCACHE_TC_SECTSIZE;
+	return OK;
+}
+
+static const struct block_operations g_bcache_tc_bops = {
+	NULL,						/* open */
+	NULL,						/* close */
+	bcache_tc_read,				/* read */
+	bcache_tc_write,			/* write */
+	bcache_tc_geometry,			/* geometry */
+	NULL,						/* ioctl */
+	NULL						/* unlink */
+};
+
+/**
+ * @testcase         tc_fs_bcache_readahead_writeback_p
+ * @brief            read ahead over a dirty page does not serve stale data
+ * @scenario         Writes a sector, reads ahead over it while its page is dirty,
+ *                   flushes and evicts the page, then reads the sector again
+ * @apicovered       bcache_attach, bcache_write, bcache_read, bcache_flush, bcache_detach
+ * @precondition     NA
+ * @postcondition    NA
+ */
+static void tc_fs_bcache_readahead_writeback_p(void)
+{
+	FAR struct inode *inode;
+	uint8_t sector[BCACHE_TC_SECTSIZE];
+	int ret;
+	int i;
+
+	g_bcache_tc_disk = (uint8_t *)malloc(BCACHE_TC_NSECTORS * BCACHE_TC_SECTSIZE);
+	TC_ASSERT_NEQ("malloc", g_bcache_tc_disk, NULL);
+	memset(g_bcache_tc_disk, 'A', BCACHE_TC_NSECTORS * BCACHE_TC_SECTSIZE);
+
+	ret = register_blockdriver(DEV_BCACHE_PATH, &g_bcache_tc_bops, 0666, NULL);
+	TC_ASSERT_EQ_CLEANUP("register_blockdriver", ret, OK, free(g_bcache_tc_disk));
+
+	ret = open_blockdriver(DEV_BCACHE_PATH, 0, &inode);
+	TC_ASSERT_EQ_CLEANUP("open_blockdriver", ret, OK, unregister_blockdriver(DEV_BCACHE_PATH); free(g_bcache_tc_disk));
+
+	ret = bcache_attach(inode);
+	TC_ASSERT_EQ_CLEANUP("bcache_attach", ret, OK, close_blockdriver(inode); unregister_blockdriver(DEV_BCACHE_PATH); free(g_bcache_tc_disk));
+
+	/* Dirty the page of the sector, then read up to it sequentially so that
+	 * the window is read ahead over it.
+	 */
+
+	memset(sector, 'B', BCACHE_TC_SECTSIZE);
+	ret = bcache_write(inode, sector, BCACHE_TC_SECTOR, 1);
+	TC_ASSERT_EQ_CLEANUP("bcache_write", ret, 1, goto errout);
+
+	ret = bcache_read(inode, sector, 0, 1);
+	TC_ASSERT_EQ_CLEANUP("bcache_read", ret, 1, goto errout);
+	ret = bcache_read(inode, sector, 1, 1);
+	TC_ASSERT_EQ_CLEANUP("bcache_read", ret, 1, goto errout);
+
+	/* Write the page back, and evict it with reads which do not move the
+	 * window: they are never sequential.
+	 */
+
+	ret = bcache_flush(inode);
+	TC_ASSERT_EQ_CLEANUP("bcache_flush", ret, OK, goto errout);
+
+	for (i = 0; i < CONFIG_FS_BCACHE_NPAGES; i++) {
+		ret = bcache_read(inode, sector, BCACHE_TC_FAR + 2 * i, 1);
+		TC_ASSERT_EQ_CLEANUP("bcache_read", ret, 1, goto errout);
+	}
+
+	ret = bcache_read(inode, sector, BCACHE_TC_SECTOR, 1);
+	TC_ASSERT_EQ_CLEANUP("bcache_read", ret, 1, goto errout);
+	TC_ASSERT_EQ_CLEANUP("bcache_read", sector[0], 'B', goto errout);
+	TC_ASSERT_EQ_CLEANUP("bcache_read", sector[BCACHE_TC_SECTSIZE - 1], 'B', goto errout);
+
+	bcache_detach(inode);
+	close_blockdriver(inode);
+	unregister_blockdriver(DEV_BCACHE_PATH);
+	free(g_bcache_tc_disk);
+
+	TC_SUCCESS_RESULT();
+	return;
+
+errout:
+	bcache_detach(inode);
+	close_blockdriver(inode);
+	unregister_blockdriver(DEV_BCACHE_PATH);
+	free(g_bcache_tc_disk);
+}
+#endif
+
 #ifdef CONFIG_AUTOMOUNT_USERFS
 char *get_fs_mount_devname(void)
 {
@@ -6319,6 +6452,9 @@ int tc_filesystem_main(int argc, char *argv[])
 	tc_fs_mqueue_ops_invalid_param_n();
 #if defined(CONFIG_BCH) && !defined(CONFIG_BUILD_PROTECTED)
 	tc_fs_driver_ramdisk_ops_p();
+#endif
+#if defined(CONFIG_FS_BCACHE) && !defined(CONFIG_BUILD_PROTECTED)
+	tc_fs_bcache_readahead_writeback_p();
 #endif
 	tc_libc_stdio_meminstream_p();
 	tc_libc_stdio_memoutstream_p();
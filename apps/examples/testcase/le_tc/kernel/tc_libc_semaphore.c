@@ -72,6 +72,10 @@ static void tc_libc_semaphore_sem_init(void)
 	TC_ASSERT_EQ("sem_init", sem.flags, sem_flag);
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
 	TC_ASSERT_EQ("sem_init", sem.hhead, NULL);
+#ifdef SEM_INLINE_HOLDER
+	TC_ASSERT_EQ("sem_init", sem.holder.htcb, NULL);
+	TC_ASSERT_EQ("sem_init", sem.holder.counts, 0);
+#endif
 #else
 	TC_ASSERT_EQ("sem_init", sem.holder.htcb, NULL);
 	TC_ASSERT_EQ("sem_init", sem.holder.counts, 0);
@@ -471,6 +471,42 @@ static void tc_umm_heap_zalloc(void)
 	}
 	TC_SUCCESS_RESULT();
 }
+#ifdef CONFIG_MM_PERCPU_CACHE
+/**
+* @fn                   :tc_umm_heap_cache_double_free
+* @brief                :Free a small chunk twice and allocate it back.
+* @scenario             :Allocate a chunk of a per-CPU cache size class and free it twice\n
+*                        allocate two chunks of the same size
+* @API's covered        :malloc, free
+* @passcase             :When the two allocations return different memory.
+* @failcase             :When the double free parks the chunk twice and both allocations return it.
+* @Preconditions        :NA
+*/
+static void tc_umm_heap_cache_double_free(void)
+{
+	void *mem_ptr;
+	void *mem_ptr1;
+	void *mem_ptr2;
+
+	mem_ptr = malloc(MM_CACHE_CLASS_SIZE(0));
+	TC_ASSERT_NEQ("malloc", mem_ptr, NULL);
+
+	free(mem_ptr);
+	free(mem_ptr);
+
+	mem_ptr1 = malloc(MM_CACHE_CLASS_SIZE(0));
+	TC_ASSERT_NEQ("malloc", mem_ptr1, NULL);
+	mem_ptr2 = malloc(MM_CACHE_CLASS_SIZE(0));
+	TC_ASSERT_NEQ_CLEANUP("malloc", mem_ptr2, NULL, free(mem_ptr1));
+
+	TC_ASSERT_NEQ_CLEANUP("free", mem_ptr1, mem_ptr2, free(mem_ptr1));
+
+	free(mem_ptr1);
+	free(mem_ptr2);
+	TC_SUCCESS_RESULT();
+}
+#endif
+
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 static void tc_umm_heap_get_heap_free_size(void)
 {
@@ -512,6 +548,9 @@ static int umm_test(int argc, char *argv[])
 	tc_umm_heap_memalign();
 	tc_umm_heap_mallinfo();
 	tc_umm_heap_zalloc();
+#ifdef CONFIG_MM_PERCPU_CACHE
+	tc_umm_heap_cache_double_free();
+#endif
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 	tc_umm_heap_get_heap_free_size();
 	tc_umm_heap_get_largest_freenode_size();
@@ -0,0 +1,146 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <semaphore.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <messaging/messaging.h>
+#include "tc_common.h"
+
+#define TASK_PRIO 101
+#define STACKSIZE 2048
+
+#define TC_BUF_PORT "buf_port"
+#define TC_BUF_SIZE 4096
+
+#define TC_OK   0
+#define TC_FAIL 1
+
+static sem_t buf_sem;
+static bool tc_buf_chk = TC_OK;
+
+static void buf_recv(int argc, FAR char *argv[])
+{
+	int ret;
+	int idx;
+	size_t size;
+	unsigned char *payload;
+	msg_recv_buf_t recv_buf;
+
+	recv_buf.buflen = sizeof(msg_buf_handle_t);
+	recv_buf.buf = (char *)malloc(recv_buf.buflen);
+	if (recv_buf.buf == NULL) {
+		tc_buf_chk = TC_FAIL;
+		(void)sem_post(&buf_sem);
+		return;
+	}
+
+	ret = messaging_recv_block(TC_BUF_PORT, &recv_buf);
+	if (ret == ERROR) {
+		tc_buf_chk = TC_FAIL;
+		goto cleanup_return;
+	}
+
+	payload = (unsigned char *)messaging_buf_open(&recv_buf, &size);
+	if (payload == NULL || size != TC_BUF_SIZE) {
+		tc_buf_chk = TC_FAIL;
+		goto cleanup_return;
+	}
+
+	for (idx = 0; idx < TC_BUF_SIZE; idx++) {
+		if (payload[idx] != (unsigned char)idx) {
+			tc_buf_chk = TC_FAIL;
+			break;
+		}
+	}
+	messaging_buf_release(payload);
+
+cleanup_return:
+	free(recv_buf.buf);
+	(void)sem_post(&buf_sem);
+}
+
+static void utc_messaging_buf_n(void)
+{
+	void *buf;
+	char not_handle[sizeof(msg_buf_handle_t)];
+	msg_recv_buf_t recv_buf;
+
+	buf = messaging_buf_alloc(0);
+	TC_ASSERT_EQ("messaging_buf_alloc", buf, NULL);
+
+	TC_ASSERT_EQ("messaging_buf_open", messaging_buf_open(NULL, NULL), NULL);
+
+	memset(not_handle, 0, sizeof(not_handle));
+	recv_buf.buf = not_handle;
+	recv_buf.buflen = sizeof(not_handle);
+	TC_ASSERT_EQ("messaging_buf_open", messaging_buf_open(&recv_buf, NULL), NULL);
+
+	recv_buf.buflen = sizeof(not_handle) - 1;
+	TC_ASSERT_EQ("messaging_buf_open", messaging_buf_open(&recv_buf, NULL), NULL);
+
+	TC_SUCCESS_RESULT();
+}
+
+static void utc_messaging_buf_p(void)
+{
+	int ret;
+	int idx;
+	unsigned char *payload;
+	msg_send_data_t send_data;
+
+	tc_buf_chk = TC_OK;
+	sem_init(&buf_sem, 0, 0);
+
+	payload = (unsigned char *)messaging_buf_alloc(TC_BUF_SIZE);
+	TC_ASSERT_NEQ_CLEANUP("messaging_buf_alloc", payload, NULL, sem_destroy(&buf_sem));
+	for (idx = 0; idx < TC_BUF_SIZE; idx++) {
+		payload[idx] = (unsigned char)idx;
+	}
+
+	ret = task_create("buf_recv", TASK_PRIO, STACKSIZE, (main_t)buf_recv, (FAR char * const *)NULL);
+	TC_ASSERT_GEQ_CLEANUP("messaging_buf_alloc", ret, 0, messaging_buf_release(payload); sem_destroy(&buf_sem));
+
+	/* wait for the receiver to block on the port. */
+	sleep(1);
+
+	send_data.msg = messaging_buf_handle(payload);
+	send_data.msglen = sizeof(msg_buf_handle_t);
+	send_data.priority = 100;
+	ret = messaging_send(TC_BUF_PORT, &send_data);
+
+	/* The receiver holds its own reference, so the sender can drop its one now. */
+	messaging_buf_release(payload);
+	TC_ASSERT_EQ_CLEANUP("messaging_buf_handle", ret, OK, sem_destroy(&buf_sem));
+
+	ret = sem_wait(&buf_sem);
+	TC_ASSERT_EQ_CLEANUP("messaging_buf_open", tc_buf_chk, TC_OK, sem_destroy(&buf_sem));
+	TC_ASSERT_EQ_CLEANUP("messaging_buf_open", ret, OK, sem_destroy(&buf_sem));
+
+	sem_destroy(&buf_sem);
+	TC_SUCCESS_RESULT();
+}
+
+void utc_messaging_buf_main(void)
+{
+	utc_messaging_buf_n();
+	utc_messaging_buf_p();
+}
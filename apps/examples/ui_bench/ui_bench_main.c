@@ -0,0 +1,427 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * examples/ui_bench/ui_bench_main.c
+ *
+ * Draws standard AraUI scenes, each of them once redrawing the areas which
+ * changed and once the whole screen, and prints the time of the stages of
+ * their frames and the fill rate.
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <semaphore.h>
+#include <araui/ui_core.h>
+#include <araui/ui_window.h>
+#include <araui/ui_widget.h>
+#include <araui/ui_asset.h>
+#include <araui/ui_animation.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_UI_DISPLAY_WIDTH
+#define CONFIG_UI_DISPLAY_WIDTH          320
+#endif
+
+#ifndef CONFIG_UI_DISPLAY_HEIGHT
+#define CONFIG_UI_DISPLAY_HEIGHT         240
+#endif
+
+#ifndef CONFIG_EXAMPLES_UI_BENCH_DURATION
+#define CONFIG_EXAMPLES_UI_BENCH_DURATION 5000
+#endif
+
+#ifndef CONFIG_EXAMPLES_UI_BENCH_FONT_PATH
+#define CONFIG_EXAMPLES_UI_BENCH_FONT_PATH "/res/font.ttf"
+#endif
+
+#define UI_BENCH_WIDTH        CONFIG_UI_DISPLAY_WIDTH
+#define UI_BENCH_HEIGHT       CONFIG_UI_DISPLAY_HEIGHT
+
+/* Frames of the scene setup are not measured */
+#define UI_BENCH_WARMUP_MS    300
+
+#define UI_BENCH_TEXT_COUNT   40
+#define UI_BENCH_TEXT_SIZE    16
+#define UI_BENCH_ROW_HEIGHT   32
+#define UI_BENCH_ROW_COUNT    40
+#define UI_BENCH_ICON_SIZE    24
+#define UI_BENCH_ROTATE_SIZE  128
+
+/* Layout of an AraUI bitmap buffer, as png2c writes it */
+#define UI_BENCH_PF_RGBA8888  10
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef struct {
+	uint32_t id;
+	int32_t width;
+	int32_t height;
+	uint32_t pf;
+	uint32_t header_size;
+	uint32_t data_size;
+	uint32_t compression;
+	int32_t reserved[7];
+} ui_bench_bitmap_t;
+
+typedef struct {
+	const char *name;
+	bool (*setup)(ui_window_t window);
+	bool needs_font;
+} ui_bench_scene_t;
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static bool ui_bench_image_scene(ui_window_t window);
+static bool ui_bench_text_scene(ui_window_t window);
+static bool ui_bench_list_scene(ui_window_t window);
+static bool ui_bench_rotate_scene(ui_window_t window);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const ui_bench_scene_t g_scenes[] = {
+	{ "image",  ui_bench_image_scene,  false },
+	{ "text",   ui_bench_text_scene,   true  },
+	{ "list",   ui_bench_list_scene,   true  },
+	{ "rotate", ui_bench_rotate_scene, false },
+};
+
+static sem_t g_destroyed;
+static ui_asset_t g_font;
+static ui_asset_t g_screen_image;
+static ui_asset_t g_icon_image;
+static ui_asset_t g_rotate_image;
+static uint8_t *g_bitmaps[3];
+static uint32_t g_text_count;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* An RGBA8888 gradient, opaque, in a buffer of the layout of png2c */
+static ui_asset_t ui_bench_create_image(int32_t width, int32_t height, uint8_t **bitmap)
+{
+	ui_bench_bitmap_t *header;
+	uint8_t *pixel;
+	ui_asset_t image;
+	int32_t x;
+	int32_t y;
+
+	*bitmap = (uint8_t *)malloc(sizeof(ui_bench_bitmap_t) + width * height * 4);
+	if (!*bitmap) {
+		return UI_NULL;
+	}
+
+	header = (ui_bench_bitmap_t *)*bitmap;
+	memset(header, 0, sizeof(ui_bench_bitmap_t));
+	header->width = width;
+	header->height = height;
+	header->pf = UI_BENCH_PF_RGBA8888;
+	header->header_size = sizeof(ui_bench_bitmap_t);
+	header->data_size = width * height * 4;
+
+	pixel = *bitmap + sizeof(ui_bench_bitmap_t);
+	for (y = 0; y < height; y++) {
+		for (x = 0; x < width; x++) {
+			*pixel++ = x * 255 / width;
+			*pixel++ = y * 255 / height;
+			*pixel++ = (x ^ y) & 0xff;
+			*pixel++ = 0xff;
+		}
+	}
+
+	image = ui_image_asset_create_from_buffer(*bitmap);
+	if (image == UI_NULL) {
+		free(*bitmap);
+		*bitmap = NULL;
+	}
+
+	return image;
+}
+
+/* A full screen image moved by a few pixels back and forth, so all of it changes every frame */
+static bool ui_bench_image_scene(ui_window_t window)
+{
+	ui_widget_t widget;
+	ui_anim_t anim;
+
+	widget = ui_image_widget_create(g_screen_image);
+	if (widget == UI_NULL || ui_window_add_widget(window, widget, 0, 0) != UI_OK) {
+		return false;
+	}
+
+	anim = ui_sequence_anim_create(ui_move_anim_create(0, 0, 4, 0, 500, UI_INTRP_LINEAR),
+								   ui_move_anim_create(4, 0, 0, 0, 500, UI_INTRP_LINEAR), (ui_anim_t)UI_NULL);
+	return ui_widget_play_anim(widget, anim, NULL, true) == UI_OK;
+}
+
+static void ui_bench_text_tick(ui_widget_t widget, uint32_t dt)
+{
+	ui_text_widget_set_text_format(widget, "%u", g_text_count++);
+}
+
+/* Many small texts, all of them changed every frame */
+static bool ui_bench_text_scene(ui_window_t window)
+{
+	ui_widget_t widget;
+	int32_t columns = 4;
+	int32_t width = UI_BENCH_WIDTH / columns;
+	int32_t height = UI_BENCH_HEIGHT / (UI_BENCH_TEXT_COUNT / columns);
+	int i;
+
+	for (i = 0; i < UI_BENCH_TEXT_COUNT; i++) {
+		widget = ui_text_widget_create(width, height, g_font, "0", UI_BENCH_TEXT_SIZE);
+		if (widget == UI_NULL || ui_window_add_widget(window, widget, (i % columns) * width, (i / columns) * height) != UI_OK) {
+			return false;
+		}
+		if (ui_widget_set_tick_callback(widget, ui_bench_text_tick) != UI_OK) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Rows of an icon and a text scrolled up and down, as a list under a flick */
+static bool ui_bench_list_scene(ui_window_t window)
+{
+	ui_widget_t list;
+	ui_widget_t widget;
+	ui_anim_t anim;
+	int32_t range = UI_BENCH_ROW_COUNT * UI_BENCH_ROW_HEIGHT - UI_BENCH_HEIGHT;
+	int i;
+
+	list = ui_widget_create(UI_BENCH_WIDTH, UI_BENCH_ROW_COUNT * UI_BENCH_ROW_HEIGHT);
+	if (list == UI_NULL || ui_window_add_widget(window, list, 0, 0) != UI_OK) {
+		return false;
+	}
+
+	for (i = 0; i < UI_BENCH_ROW_COUNT; i++) {
+		widget = ui_image_widget_create(g_icon_image);
+		if (widget == UI_NULL || ui_widget_add_child(list, widget, 4, i * UI_BENCH_ROW_HEIGHT + (UI_BENCH_ROW_HEIGHT - UI_BENCH_ICON_SIZE) / 2) != UI_OK) {
+			return false;
+		}
+
+		widget = ui_text_widget_create(UI_BENCH_WIDTH - UI_BENCH_ICON_SIZE - 12, UI_BENCH_ROW_HEIGHT, g_font, "List item", UI_BENCH_TEXT_SIZE);
+		if (widget == UI_NULL || ui_widget_add_child(list, widget, UI_BENCH_ICON_SIZE + 12, i * UI_BENCH_ROW_HEIGHT) != UI_OK) {
+			return false;
+		}
+		ui_text_widget_set_text_format(widget, "List item %d", i);
+	}
+
+	anim = ui_sequence_anim_create(ui_move_anim_create(0, 0, 0, -range, 2000, UI_INTRP_EASE_INOUT_QUAD),
+								   ui_move_anim_create(0, -range, 0, 0, 2000, UI_INTRP_EASE_INOUT_QUAD), (ui_anim_t)UI_NULL);
+	return ui_widget_play_anim(list, anim, NULL, true) == UI_OK;
+}
+
+/* An image turning around its center, drawn by triangles instead of rows */
+static bool ui_bench_rotate_scene(ui_window_t window)
+{
+	ui_widget_t widget;
+
+	widget = ui_image_widget_create(g_rotate_image);
+	if (widget == UI_NULL) {
+		return false;
+	}
+	if (ui_window_add_widget(window, widget, (UI_BENCH_WIDTH - UI_BENCH_ROTATE_SIZE) / 2, (UI_BENCH_HEIGHT - UI_BENCH_ROTATE_SIZE) / 2) != UI_OK) {
+		return false;
+	}
+	ui_widget_set_pivot_point(widget, UI_BENCH_ROTATE_SIZE / 2, UI_BENCH_ROTATE_SIZE / 2);
+
+	return ui_widget_play_anim(widget, ui_rotate_anim_create(0, 360, 2000, UI_INTRP_LINEAR), NULL, true) == UI_OK;
+}
+
+static void ui_bench_window_cb(ui_window_t window)
+{
+}
+
+static void ui_bench_destroyed_cb(ui_window_t window)
+{
+	sem_post(&g_destroyed);
+}
+
+/* Destroy a window and wait for it, the requests made before it are done then */
+static void ui_bench_destroy_window(ui_window_t window)
+{
+	ui_window_destroy(window);
+	while (sem_wait(&g_destroyed) != OK);
+}
+
+static void ui_bench_print(const char *name, bool full, ui_frame_stats_t *stats, uint32_t duration)
+{
+	uint64_t busy_us = stats->render_us + stats->flush_us;
+	uint64_t fill;
+
+	if (stats->frames == 0) {
+		printf("%-8s %-7s no frame drawn\n", name, full ? "full" : "partial");
+		return;
+	}
+
+	/* Pixels per microsecond are MPixel/s, printed with 2 decimals */
+	fill = busy_us ? stats->pixels * 100 / busy_us : 0;
+
+	printf("%-8s %-7s %5lu %4lu.%lu %8lu %8lu %8lu %8lu %5lu.%02lu\n", name, full ? "full" : "partial",
+		   (unsigned long)stats->frames,
+		   (unsigned long)(stats->frames * 1000 / duration), (unsigned long)((stats->frames * 10000 / duration) % 10),
+		   (unsigned long)(stats->process_us / stats->frames),
+		   (unsigned long)(stats->render_us / stats->frames),
+		   (unsigned long)(stats->flush_us / stats->frames),
+		   (unsigned long)stats->max_frame_us,
+		   (unsigned long)(fill / 100), (unsigned long)(fill % 100));
+}
+
+static int ui_bench_run_scene(const ui_bench_scene_t *scene, bool full)
+{
+	ui_frame_stats_t stats;
+	ui_window_t window;
+	bool ready;
+
+	if (ui_core_set_full_update(full) != UI_OK) {
+		printf("%-8s %-7s not supported\n", scene->name, full ? "full" : "partial");
+		return OK;
+	}
+
+	window = ui_window_create(ui_bench_window_cb, ui_bench_destroyed_cb, ui_bench_window_cb, ui_bench_window_cb);
+	if (window == UI_NULL) {
+		printf("Failed to create the window of %s\n", scene->name);
+		return ERROR;
+	}
+
+	ready = scene->setup(window);
+
+	if (ready) {
+		usleep(UI_BENCH_WARMUP_MS * 1000);
+		ui_core_reset_frame_stats();
+		usleep(CONFIG_EXAMPLES_UI_BENCH_DURATION * 1000);
+		ui_core_get_frame_stats(&stats);
+	}
+
+	/* The widgets are destroyed with the window, the assets are not drawn once it is gone */
+	ui_bench_destroy_window(window);
+
+	if (!ready) {
+		printf("Failed to set up %s\n", scene->name);
+		return ERROR;
+	}
+
+	ui_bench_print(scene->name, full, &stats, CONFIG_EXAMPLES_UI_BENCH_DURATION);
+	return OK;
+}
+
+static void ui_bench_destroy_assets(void)
+{
+	ui_window_t window;
+	int i;
+
+	if (g_font != UI_NULL) {
+		ui_font_asset_destroy(g_font);
+		g_font = UI_NULL;
+	}
+	if (g_screen_image != UI_NULL) {
+		ui_image_asset_destroy(g_screen_image);
+		g_screen_image = UI_NULL;
+	}
+	if (g_icon_image != UI_NULL) {
+		ui_image_asset_destroy(g_icon_image);
+		g_icon_image = UI_NULL;
+	}
+	if (g_rotate_image != UI_NULL) {
+		ui_image_asset_destroy(g_rotate_image);
+		g_rotate_image = UI_NULL;
+	}
+
+	/* ui_stop() drops the requests not handled yet, the buffers are freed once the images are */
+	window = ui_window_create(ui_bench_window_cb, ui_bench_destroyed_cb, ui_bench_window_cb, ui_bench_window_cb);
+	if (window != UI_NULL) {
+		ui_bench_destroy_window(window);
+	}
+	ui_stop();
+
+	for (i = 0; i < 3; i++) {
+		free(g_bitmaps[i]);
+		g_bitmaps[i] = NULL;
+	}
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int ui_bench_main(int argc, char *argv[])
+#endif
+{
+	int ret = OK;
+	int i;
+
+	if (ui_start() != UI_OK) {
+		printf("Failed to start the UI\n");
+		return ERROR;
+	}
+
+	sem_init(&g_destroyed, 0, 0);
+
+	g_screen_image = ui_bench_create_image(UI_BENCH_WIDTH, UI_BENCH_HEIGHT, &g_bitmaps[0]);
+	g_icon_image = ui_bench_create_image(UI_BENCH_ICON_SIZE, UI_BENCH_ICON_SIZE, &g_bitmaps[1]);
+	g_rotate_image = ui_bench_create_image(UI_BENCH_ROTATE_SIZE, UI_BENCH_ROTATE_SIZE, &g_bitmaps[2]);
+	if (g_screen_image == UI_NULL || g_icon_image == UI_NULL || g_rotate_image == UI_NULL) {
+		printf("Failed to create the images\n");
+		ui_bench_destroy_assets();
+		sem_destroy(&g_destroyed);
+		return ERROR;
+	}
+
+	g_font = ui_font_asset_create_from_file(CONFIG_EXAMPLES_UI_BENCH_FONT_PATH);
+	if (g_font == UI_NULL) {
+		printf("No font at %s, the text scenes are skipped\n", CONFIG_EXAMPLES_UI_BENCH_FONT_PATH);
+	}
+
+	printf("AraUI benchmark, %dx%d, %d ms per scene\n", UI_BENCH_WIDTH, UI_BENCH_HEIGHT, CONFIG_EXAMPLES_UI_BENCH_DURATION);
+	printf("Times are averages per frame in microseconds, fill rate in MPixel/s\n");
+	printf("%-8s %-7s %5s %6s %8s %8s %8s %8s %8s\n", "scene", "update", "frames", "fps", "process", "render", "flush", "max", "fill");
+
+	for (i = 0; i < sizeof(g_scenes) / sizeof(g_scenes[0]); i++) {
+		if (g_scenes[i].needs_font && g_font == UI_NULL) {
+			continue;
+		}
+		if (ui_bench_run_scene(&g_scenes[i], false) != OK || ui_bench_run_scene(&g_scenes[i], true) != OK) {
+			ret = ERROR;
+			break;
+		}
+	}
+
+	ui_bench_destroy_assets();
+	sem_destroy(&g_destroyed);
+
+	return ret;
+}
@@ -77,6 +77,10 @@ int utils_prodconfig(int argc, char **args);
 int utils_irqinfo(int argc, char **args);
 #endif
 
+#if defined(CONFIG_ENABLE_LATENCY)
+int utils_latency(int argc, char **args);
+#endif
+
 #if defined(CONFIG_ENABLE_KILL)
 int utils_kill(int argc, char **args);
 #endif
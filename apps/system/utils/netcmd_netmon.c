@@ -33,6 +33,12 @@
 #include <netinet/in.h>
 #include <net/if.h>
 #include <netutils/netlib.h>
+#if defined(CONFIG_NET_STATS) && defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_NETSTATS)
+#include <fcntl.h>
+#include <sys/mount.h>
+#include <tinyara/fs/fs.h>
+#define NETMON_NETSTATS 1
+#endif
 #ifdef CONFIG_WIFI_MANAGER
 #include <wifi_manager/wifi_manager.h>
 #endif
@@ -42,13 +48,15 @@
  * Preprocessor Definitions
  ****************************************************************************/
 #define NTAG "[NETCMD]"
-#define USAGE                      \
-	"\n usage: netmon [options]\n" \
-	"\n socket information:\n"     \
-	"       netmon sock\n"         \
-	"\n WiFi Manager stats:\n"     \
-	"       netmon wifi\n"         \
-	"\n Net device stats:\n"       \
+#define USAGE                        \
+	"\n usage: netmon [options]\n"   \
+	"\n socket information:\n"       \
+	"       netmon sock\n"           \
+	"\n WiFi Manager stats:\n"       \
+	"       netmon wifi\n"           \
+	"\n Network stack stats:\n"      \
+	"       netmon netstats\n"       \
+	"\n Net device stats:\n"         \
 	"       netmon [devname]\n\n"
 
 /**
@@ -63,7 +71,7 @@ static inline void _print_help(void)
 static inline void _print_sock(char *buf)
 {
 	NETCMD_LOG(NTAG, "\n==============================================\n");
-	NETCMD_LOG(NTAG, "TCP\tfd\tpname:pid\tconn state\tIP type\tTCP state\tlocal IP\tlocal port\tremote IP\tremote port\n");
+	NETCMD_LOG(NTAG, "TCP\tfd\tpname:pid\tconn state\tIP type\tTCP state\tlocal IP\tlocal port\tremote IP\tremote port\tsrtt(ms)\trto(ms)\tcwnd\tssthresh\tretrans\n");
 	NETCMD_LOG(NTAG, "UDP\tfd\tpname:pid\tconn state\tIP type\tUDP flag\tlocal IP\tlocal port\tremote IP\tremote port\n");
 	NETCMD_LOG(NTAG, "RAW\tfd\tpname:pid\tconn state\tIP type\tprotocol\tlocal IP\tremote IP\n");
 	NETCMD_LOG(NTAG, "----------------------------------------------\n");
@@ -82,11 +90,130 @@ static void _print_devstats(char *buf)
 	return;
 }
 
+#ifdef CONFIG_WIFI_MANAGER
+#ifdef CONFIG_WIFIMGR_LINK_STATS
+static void _print_wifi_link(void)
+{
+	static const char *retry_bins[WIFI_MANAGER_LINK_RETRY_BINS] = {"0", "1-3", "4-15", "16-63", "64-255", "256-"};
+	static const char *rate_bins[WIFI_MANAGER_LINK_RATE_BINS] = {"0-5", "6-11", "12-23", "24-53", "54-71", "72-149", "150-299", "300-"};
+	wifi_manager_link_stats_s link;
+	int i;
+
+	memset(&link, 0, sizeof(link));
+	link.max_samples = CONFIG_WIFIMGR_LINK_STATS_SAMPLES;
+	link.samples = (wifi_manager_link_sample_s *)malloc(sizeof(wifi_manager_link_sample_s) * link.max_samples);
+	if (link.samples == NULL) {
+		link.max_samples = 0;
+	}
+	if (wifi_manager_get_link_stats(&link) != WIFI_MANAGER_SUCCESS) {
+		NETCMD_LOGE(NTAG, "Failed to get link stats\n");
+		free(link.samples);
+		return;
+	}
+
+	NETCMD_LOG(NTAG, "----------------------------------------------\n");
+	NETCMD_LOG(NTAG, "connected %u ms, power save %u ms\n", link.connected_time, link.powersave_time);
+	NETCMD_LOG(NTAG, "tx retries per %u ms:", link.interval);
+	for (i = 0; i < WIFI_MANAGER_LINK_RETRY_BINS; i++) {
+		NETCMD_LOG(NTAG, " %s:%u", retry_bins[i], link.retry_hist[i]);
+	}
+	NETCMD_LOG(NTAG, "\nphy rate (Mbps):");
+	for (i = 0; i < WIFI_MANAGER_LINK_RATE_BINS; i++) {
+		NETCMD_LOG(NTAG, " %s:%u", rate_bins[i], link.rate_hist[i]);
+	}
+	NETCMD_LOG(NTAG, "\ntime(ms)\trssi\tsnr\tretry\trate\n");
+	for (i = 0; i < link.nsamples; i++) {
+		wifi_manager_link_sample_s *s = &link.samples[i];
+		NETCMD_LOG(NTAG, "%u\t%d\t%d\t%u\t%u\n", s->time, s->rssi, s->snr, s->tx_retry, s->rate);
+	}
+	free(link.samples);
+}
+#else
+static inline void _print_wifi_link(void)
+{
+}
+#endif
+
+/**
+ * Print the stats of Wi-Fi Manager and the telemetry of the link.
+ */
+static int _print_wifi_info(void)
+{
+	wifi_manager_stats_s stats;
+
+	/* The counters of Wi-Fi Manager are filled even if the driver has no stats */
+	if (wifi_manager_get_stats(&stats) != WIFI_MANAGER_SUCCESS) {
+		NETCMD_LOGE(NTAG, "Failed to get the stats of the driver\n");
+	}
+
+	NETCMD_LOG(NTAG, "\n==============================================\n");
+	NETCMD_LOG(NTAG, "connect %u fail %u disconnect %u reconnect %u scan %u\n",
+			   stats.connect, stats.connectfail, stats.disconnect, stats.reconnect, stats.scan);
+	NETCMD_LOG(NTAG, "tx try %u retransmit %u drop %u, rx %u drop %u\n",
+			   stats.tx_try, stats.tx_retransmit, stats.tx_drop, stats.rx_cnt, stats.rx_drop);
+	NETCMD_LOG(NTAG, "rssi avg %d min %d max %d, beacon miss %u\n",
+			   (int)stats.rssi_avg, (int)stats.rssi_min, (int)stats.rssi_max, stats.beacon_miss_cnt);
+	_print_wifi_link();
+	NETCMD_LOG(NTAG, "==============================================\n");
+
+	return OK;
+}
+#else
 static inline int _print_wifi_info(void)
 {
 	NETCMD_LOGE(NTAG, "Wi-Fi Manager is not enabled\n");
 	return ERROR;
 }
+#endif
+
+#ifdef NETMON_NETSTATS
+/**
+ * Print the network statistics of /proc/netstats.
+ */
+static int _print_netstats(void)
+{
+	char buf[64];
+	ssize_t nread;
+	int fd;
+	int ret;
+	int mounted = 0;
+
+	ret = mount(NULL, PROCFS_MOUNT_POINT, PROCFS_FSTYPE, 0, NULL);
+	if (ret == OK) {
+		mounted = 1;
+	} else if (errno != EEXIST) {
+		NETCMD_LOGE(NTAG, "Failed to mount procfs %d\n", errno);
+		return ERROR;
+	}
+
+	fd = open(PROCFS_MOUNT_POINT "/netstats", O_RDONLY);
+	if (fd < 0) {
+		NETCMD_LOGE(NTAG, "Failed to open netstats %d\n", errno);
+		ret = ERROR;
+	} else {
+		NETCMD_LOG(NTAG, "\n==============================================\n");
+		while ((nread = read(fd, buf, sizeof(buf) - 1)) > 0) {
+			buf[nread] = '\0';
+			NETCMD_LOG(NTAG, "%s", buf);
+		}
+		NETCMD_LOG(NTAG, "==============================================\n");
+		close(fd);
+		ret = OK;
+	}
+
+	if (mounted) {
+		(void)umount(PROCFS_MOUNT_POINT);
+	}
+
+	return ret;
+}
+#else
+static inline int _print_netstats(void)
+{
+	NETCMD_LOGE(NTAG, "Network statistics are not enabled\n");
+	return ERROR;
+}
+#endif
 
 /****************************************************************************
  * Public Functions
@@ -110,7 +237,7 @@ int cmd_netmon(int argc, char **argv)
 	} else if (!(strncmp(argv[1], "wifi", strlen("wifi") + 1))) {
 		return _print_wifi_info();
 	} else if (!(strncmp(argv[1], "netstats", strlen("netstats") + 1))) {
-		return -1;
+		return _print_netstats();
 	} else {
 		char *buf = NULL;
 		ret = netlib_netmon_devstats(argv[1], (void **)&buf);
@@ -46,6 +46,9 @@ const static tash_cmdlist_t system_cmds[] = {
 #if defined(CONFIG_ENABLE_IRQINFO)
 	{"irqinfo",   utils_irqinfo,      TASH_EXECMD_SYNC},
 #endif
+#if defined(CONFIG_ENABLE_LATENCY)
+	{"latency",  utils_latency,      TASH_EXECMD_SYNC},
+#endif
 #if defined(CONFIG_ENABLE_KILL)
 	{"kill",     utils_kill,         TASH_EXECMD_SYNC},
 #endif
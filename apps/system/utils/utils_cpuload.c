@@ -74,6 +74,7 @@ struct cpuload_pidhash_s {
 enum cpuload_mode {
 	CPULOAD_NORMAL,
 	CPULOAD_SNAPSHOT,
+	CPULOAD_CYCLES,
 };
 
 static volatile bool is_started = false;
@@ -87,6 +88,9 @@ static pid_t *cpuload_snaparr;
 static int cpuload_snaparr_size;
 struct cpuload_pidhash_s cpuload_pidhash[CONFIG_MAX_TASKS + 1];
 static unsigned int cpu;
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+static struct cpuload_cycles_s *cpuload_cycles;
+#endif
 
 /* The last index is for dead threads */
 #define CPULOAD_INACTIVE_IDX CONFIG_MAX_TASKS
@@ -102,6 +106,13 @@ static void cpuload_stop(void)
 			(void)ioctl(cpuload_snapfd, CPULOADIOC_STOP, (unsigned long)NULL);
 			free(cpuload_snaparr);
 		}
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+		if (cpuload_cycles != NULL) {
+			close(cpuload_snapfd);
+			free(cpuload_cycles);
+			cpuload_cycles = NULL;
+		}
+#endif
 		is_started = false;
 		printf(CPULOADMON_PREFIX "CPU load Monitor Stopped\n");
 		pthread_cancel(cpuloadmon);
@@ -140,6 +151,34 @@ static bool has_cpuload(char *load_info)
 	}
 }
 
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+static double cpuload_cycles_ratio(uint64_t cycles)
+{
+	return cpuload_cycles->total ? (double)cycles * 100 / cpuload_cycles->total : 0;
+}
+
+static void cpuload_print_cycles_value(stat_data *stat_info)
+{
+	int pid = atoi(stat_info[PROC_STAT_PID]);
+	int pid_hash = PIDHASH(pid);
+	uint64_t cycles;
+
+	if (cpuload_cycles->pid[pid_hash] != pid || cpuload_cycles->task[pid_hash] == 0) {
+		return;
+	}
+
+	cycles = cpuload_cycles->task[pid_hash];
+	cpuload_pidhash[pid_hash].active_flag = true;
+	printf("%3s | %3s | %12llu | %6.2f |", stat_info[PROC_STAT_PID], stat_info[PROC_STAT_PRIORITY],
+		(unsigned long long)cycles, cpuload_cycles_ratio(cycles));
+#if (CONFIG_TASK_NAME_SIZE > 0)
+	printf(" %s\n", stat_info[PROC_STAT_NAME]);
+#else
+	printf(" NA\n");
+#endif
+}
+#endif
+
 static void cpuload_print_pid_value(char *buf, void *arg)
 {
 	int i;
@@ -155,6 +194,13 @@ static void cpuload_print_pid_value(char *buf, void *arg)
 		stat_info[i] = strtok_r(stat_info[i], " ", &stat_info[i + 1]);
 	}
 
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	if (cpuload_mode == CPULOAD_CYCLES) {
+		cpuload_print_cycles_value(stat_info);
+		return;
+	}
+#endif
+
 #ifdef CONFIG_SCHED_MULTI_CPULOAD
 	if (!(has_cpuload(stat_info[PROC_STAT_CPULOAD_SHORT]) || has_cpuload(stat_info[PROC_STAT_CPULOAD_MID]) || has_cpuload(stat_info[PROC_STAT_CPULOAD_LONG]))) {
 #else 
@@ -296,6 +342,59 @@ static void cpuload_print_snapshot(void)
 	printf("--------------------------------------------------\n");
 }
 
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+static void cpuload_print_cycles(void)
+{
+	uint64_t shown = 0;
+	int pid_idx;
+	int irq;
+
+	/* Get the cycles of the last interval and start the next one */
+	if (ioctl(cpuload_snapfd, CPULOADIOC_GETCYCLES, (unsigned long)cpuload_cycles) < 0 ||
+		ioctl(cpuload_snapfd, CPULOADIOC_RESETCYCLES, 0) < 0) {
+		printf(CPULOADMON_PREFIX "Failed to get cycles, errno %d\n", errno);
+		return;
+	}
+
+	printf("\n--------------------------------------------------\n");
+	printf("Exact CPU time over the last %ds: %llu cycles", cpuload_interval, (unsigned long long)cpuload_cycles->total);
+	if (cpuload_cycles->freq > 0) {
+		printf(" at %u Hz", cpuload_cycles->freq);
+	}
+	printf("\nPID | Pri |    Cycles    |   %%    | Task Name");
+	printf("\n--------------------------------------------------\n");
+
+	for (pid_idx = 0; pid_idx < CONFIG_MAX_TASKS; pid_idx++) {
+		cpuload_pidhash[pid_idx].active_flag = false;
+	}
+
+	utils_proc_pid_foreach(cpuload_read_proc, NULL);
+
+	for (pid_idx = 0; pid_idx < CONFIG_MAX_TASKS; pid_idx++) {
+		if (cpuload_pidhash[pid_idx].active_flag) {
+			shown += cpuload_cycles->task[pid_idx];
+		}
+	}
+
+	printf("--------------------------------------------------\n");
+	printf("IRQ |    Cycles    |   %%\n");
+	printf("--------------------------------------------------\n");
+	for (irq = 0; irq < NR_IRQS; irq++) {
+		if (cpuload_cycles->irqs[irq] > 0) {
+			printf("%3d | %12llu | %6.2f\n", irq, (unsigned long long)cpuload_cycles->irqs[irq],
+				cpuload_cycles_ratio(cpuload_cycles->irqs[irq]));
+		}
+	}
+	printf("--------------------------------------------------\n");
+	printf(" * Interrupts : %6.2f%%\n", cpuload_cycles_ratio(cpuload_cycles->irq));
+	if (cpuload_cycles->total > shown + cpuload_cycles->irq) {
+		printf(" * Dead threads : %6.2f%%\n", cpuload_cycles_ratio(cpuload_cycles->total - shown - cpuload_cycles->irq));
+	}
+	printf(" * The cycle counter stops while the CPU sleeps, the shares are of busy time\n");
+	printf("--------------------------------------------------\n");
+}
+#endif
+
 static void *cpuload_monitor(void *args)
 {
 #if !defined(CONFIG_FS_AUTOMOUNT_PROCFS)
@@ -318,12 +417,18 @@ static void *cpuload_monitor(void *args)
 	/* Start to print data after snapshot interval(s) when snapshot mode. */
 	if (cpuload_mode == CPULOAD_SNAPSHOT) {
 		sleep(cpuload_snapintval);
+	} else if (cpuload_mode == CPULOAD_CYCLES) {
+		sleep(cpuload_interval);
 	}
 
 	/* Loop until we detect that there is a request to stop. */
 	while (is_started) {
 		if (cpuload_mode == CPULOAD_SNAPSHOT) {
 			cpuload_print_snapshot();
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+		} else if (cpuload_mode == CPULOAD_CYCLES) {
+			cpuload_print_cycles();
+#endif
 		} else {
 			cpuload_print_normal();
 		}
@@ -377,6 +482,23 @@ static int cpuload_start(void)
 		}
 	}
 
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	if (cpuload_mode == CPULOAD_CYCLES) {
+		cpuload_cycles = (struct cpuload_cycles_s *)malloc(sizeof(struct cpuload_cycles_s));
+		if (cpuload_cycles == NULL) {
+			printf("Fail to allocate buffer for cycles, errno %d\n", errno);
+			return ERROR;
+		}
+		cpuload_snapfd = open(CPULOAD_DRVPATH, O_RDWR);
+		if (cpuload_snapfd < 0) {
+			printf("Fail to open cpuload driver. errno %d\n", errno);
+			goto errout_with_free;
+		}
+		/* Count from now on */
+		(void)ioctl(cpuload_snapfd, CPULOADIOC_RESETCYCLES, 0);
+	}
+#endif
+
 	/* Create cpuload moniter thread */
 	pthread_attr_init(&attr);
 	attr.stacksize = CPULOADMONITOR_STACKSIZE;
@@ -412,12 +534,22 @@ errout_with_free:
 		free(cpuload_snaparr);
 		cpuload_snaparr = NULL;
 	}
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	if (cpuload_cycles != NULL) {
+		free(cpuload_cycles);
+		cpuload_cycles = NULL;
+	}
+#endif
 	return ERROR;
 }
 
 static void cpuload_show_usage(void)
 {
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	printf("\nUsage: cpuload [-s <snapshot interval(s)> | -x] [-i <print interval(s)>] [-n <iterations>] [-c <cpu idx>]\n");
+#else
 	printf("\nUsage: cpuload [-s <snapshot interval(s)>] [-i <print interval(s)>] [-n <iterations>] [-c <cpu idx>]\n");
+#endif
 	printf("    Or, cpuload stop\n");
 	printf("Start/Stop CPU load monitor daemon\n");
 }
@@ -459,12 +591,13 @@ int utils_cpuload(int argc, char **args)
 		 * -s [snapshot interval] : set snapshot interval (s)
 		 * -i [interval] : set interval of cpuload daemon (s)
 		 * -n [iterations] : set count of iterations
+		 * -x : show the exact cycles of each thread and interrupt
 		 *
 		 * For example,
 		 *  TASH >> cpuload -s 60 -i 10
 		 *  CPU monitor starts with snapshot mode and shows measured values every 10 seconds.
 		 */
-		while ((opt = getopt(argc, args, "s:i:n:c:")) != ERROR) {
+		while ((opt = getopt(argc, args, "s:i:n:c:x")) != ERROR) {
 			switch (opt) {
 			case 's':
 				/* set snapshot interval */
@@ -502,6 +635,11 @@ int utils_cpuload(int argc, char **args)
 				}
 				cpu = value;
 				break;
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+			case 'x':
+				cpuload_mode = CPULOAD_CYCLES;
+				break;
+#endif
 			default:
 				printf("Invalid input");
 				goto show_usage;
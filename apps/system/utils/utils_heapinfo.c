@@ -215,7 +215,7 @@ int utils_heapinfo(int argc, char **args)
 		goto usage;
 	}
 
-	while ((opt = getopt(argc, args, "ikb:d:ap:fgr")) != ERROR) {
+	while ((opt = getopt(argc, args, "ikb:d:ap:fgrc")) != ERROR) {
 		switch (opt) {
 		/* i : initialize the peak allocated memory size. */
 		case 'i':
@@ -247,7 +247,7 @@ int utils_heapinfo(int argc, char **args)
 			}
 #endif
 			break;
-		/* a, p, f, g, e : select heapinfo display options */
+		/* a, p, f, g, c : select heapinfo display options */
 		case 'a':
 			options.mode = HEAPINFO_DETAIL_ALL;
 			heapinfo_display_flag = HEAPINFO_DISPLAY_ALL;
@@ -270,6 +270,15 @@ int utils_heapinfo(int argc, char **args)
 			options.mode = HEAPINFO_SIMPLE;
 			heapinfo_display_flag = HEAPINFO_DISPLAY_GROUP;
 			break;
+		case 'c':
+#ifdef CONFIG_MM_PROFILER
+			options.mode = HEAPINFO_PROFILE;
+			heapinfo_display_flag = HEAPINFO_DISPLAY_ALL;
+#else
+			printf("NOT supported!! Please enable CONFIG_MM_PROFILER\n");
+			return ERROR;
+#endif
+			break;
 		case 'r':
 #if CONFIG_KMM_REGIONS > 1
 			heapinfo_print_regions();
@@ -304,7 +313,7 @@ int utils_heapinfo(int argc, char **args)
 	}
 	close(heapinfo_fd);
 
-	if (options.mode != HEAPINFO_DUMP_HEAP) {
+	if (options.mode != HEAPINFO_DUMP_HEAP && options.mode != HEAPINFO_PROFILE) {
 		if (init_flag == true) {
 #ifdef CONFIG_BUILD_PROTECTED
 			printf("[%s]", heap_name);
@@ -340,6 +349,9 @@ usage:
 	printf(" -a             Show the all allocation details\n");
 	printf(" -p PID         Show the specific PID allocation details \n");
 	printf(" -f             Show the free list \n");
+#ifdef CONFIG_MM_PROFILER
+	printf(" -c             Show the call sites which allocate the most\n");
+#endif
 #ifdef CONFIG_HEAPINFO_USER_GROUP
 	printf(" -g             Show the User defined group allocation details \n");
 #endif
@@ -26,7 +26,9 @@
 
 #include "utils_proc.h"
 
-#define IRQ_BUFLEN 64
+/* Fits a histogram line of CONFIG_DEBUG_IRQ_TIMING */
+
+#define IRQ_BUFLEN 128
 
 int utils_irqinfo(int argc, char **args)
 {
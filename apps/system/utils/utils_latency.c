@@ -0,0 +1,305 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#if !defined(CONFIG_FS_AUTOMOUNT_PROCFS)
+#include <sys/mount.h>
+#endif
+#include <tinyara/sched.h>
+#include <tinyara/fs/fs.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LATENCY_FILEPATH PROCFS_MOUNT_POINT "/latency"
+
+/* Longest line of /proc/latency, see fs/procfs/fs_procfslatency.c */
+
+#define LATENCY_BUFLEN (48 + 11 * SCHED_LATENCY_NBUCKETS + CONFIG_TASK_NAME_SIZE + 2)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct latency_line_s {
+	int pid;
+	uint32_t count;
+	uint64_t total;
+	uint32_t max;
+	uint32_t bucket[SCHED_LATENCY_NBUCKETS];
+	char *name;
+};
+
+struct latency_option_s {
+	bool verbose;
+	int pid;					/* Only this thread, or -1 for all */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void latency_show_usage(void)
+{
+	printf("\nUsage: latency [-v] [PID]\n");
+	printf("   or: latency -r\n");
+	printf("Show the wakeup-to-run latency of threads, in microseconds\n");
+	printf("\nOptions:\n");
+	printf(" -v     Show the histogram of each thread\n");
+	printf(" -r     Reset the latency of all threads\n");
+}
+
+static bool latency_parse(char *buf, struct latency_line_s *line)
+{
+	char *save;
+	char *tok;
+	int ndx;
+
+	tok = strtok_r(buf, " \n", &save);
+	if (tok == NULL) {
+		return false;
+	}
+	line->pid = atoi(tok);
+
+	if ((tok = strtok_r(NULL, " \n", &save)) == NULL) {
+		return false;
+	}
+	line->count = strtoul(tok, NULL, 10);
+
+	if ((tok = strtok_r(NULL, " \n", &save)) == NULL) {
+		return false;
+	}
+	line->total = strtoull(tok, NULL, 10);
+
+	if ((tok = strtok_r(NULL, " \n", &save)) == NULL) {
+		return false;
+	}
+	line->max = strtoul(tok, NULL, 10);
+
+	for (ndx = 0; ndx < SCHED_LATENCY_NBUCKETS; ndx++) {
+		if ((tok = strtok_r(NULL, " \n", &save)) == NULL) {
+			return false;
+		}
+		line->bucket[ndx] = strtoul(tok, NULL, 10);
+	}
+
+	line->name = strtok_r(NULL, "\n", &save);
+	if (line->name == NULL) {
+		line->name = "";
+	}
+
+	return true;
+}
+
+/* Return the upper bound of the bucket holding the given percentile */
+
+static uint32_t latency_percentile(const struct latency_line_s *line, int percent)
+{
+	uint32_t target = (uint32_t)(((uint64_t)line->count * percent + 99) / 100);
+	uint32_t seen = 0;
+	int ndx;
+
+	for (ndx = 0; ndx < SCHED_LATENCY_NBUCKETS - 1; ndx++) {
+		seen += line->bucket[ndx];
+		if (seen >= target) {
+			break;
+		}
+	}
+
+	return ndx == 0 ? 0 : (1u << ndx) - 1;
+}
+
+static void latency_print_line(char *buf, struct latency_option_s *option)
+{
+	struct latency_line_s line;
+	int ndx;
+
+	if (!latency_parse(buf, &line)) {
+		return;
+	}
+
+	if ((option->pid >= 0 && line.pid != option->pid) || (option->pid < 0 && line.count == 0)) {
+		return;
+	}
+
+	printf("%5d | %8u | %7u | %7u | %7u | %7u | %s\n", line.pid, line.count,
+		line.count ? (uint32_t)(line.total / line.count) : 0, line.max,
+		latency_percentile(&line, 50), latency_percentile(&line, 99), line.name);
+
+	if (!option->verbose) {
+		return;
+	}
+
+	for (ndx = 0; ndx < SCHED_LATENCY_NBUCKETS; ndx++) {
+		if (line.bucket[ndx] == 0) {
+			continue;
+		}
+
+		if (ndx == SCHED_LATENCY_NBUCKETS - 1) {
+			printf("      %7u -         : %8u\n", 1u << (ndx - 1), line.bucket[ndx]);
+		} else {
+			printf("      %7u - %7u : %8u\n", ndx ? 1u << (ndx - 1) : 0, ndx ? (1u << ndx) - 1 : 0, line.bucket[ndx]);
+		}
+	}
+}
+
+static int latency_reset(void)
+{
+	int fd;
+
+	fd = open(LATENCY_FILEPATH, O_WRONLY);
+	if (fd < 0) {
+		printf("Failed to open %s, errno : %d\n", LATENCY_FILEPATH, errno);
+		return ERROR;
+	}
+
+	if (write(fd, "0", 1) != 1) {
+		printf("Failed to reset latency, errno : %d\n", errno);
+		close(fd);
+		return ERROR;
+	}
+
+	close(fd);
+	printf("Latency of all threads cleared\n");
+	return OK;
+}
+
+/* /proc/latency is read in chunks: rebuild each line before parsing it */
+
+static int latency_show(struct latency_option_s *option)
+{
+	char buf[LATENCY_BUFLEN];
+	ssize_t nread;
+	size_t len = 0;
+	char *eol;
+	int fd;
+
+	fd = open(LATENCY_FILEPATH, O_RDONLY);
+	if (fd < 0) {
+		printf("Failed to open %s, errno : %d\n", LATENCY_FILEPATH, errno);
+		return ERROR;
+	}
+
+	printf("\n  PID |  Count   |   Avg   |   Max   |  p50 <= |  p99 <= | Name\n");
+	printf("------|----------|---------|---------|---------|---------|------\n");
+
+	for (;;) {
+		nread = read(fd, buf + len, LATENCY_BUFLEN - 1 - len);
+		if (nread < 0) {
+			printf("Failed to read %s, errno : %d\n", LATENCY_FILEPATH, errno);
+			close(fd);
+			return ERROR;
+		}
+
+		if (nread == 0) {
+			break;
+		}
+
+		len += nread;
+		buf[len] = '\0';
+
+		while ((eol = strchr(buf, '\n')) != NULL) {
+			*eol = '\0';
+			latency_print_line(buf, option);
+			len -= eol + 1 - buf;
+			memmove(buf, eol + 1, len + 1);
+		}
+
+		if (len == LATENCY_BUFLEN - 1) {
+			/* Line too long, cannot happen with a matching kernel */
+
+			len = 0;
+		}
+	}
+
+	close(fd);
+	printf("\n");
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int utils_latency(int argc, char **args)
+{
+	struct latency_option_s option;
+	bool reset = false;
+	int ret;
+	int i;
+#if !defined(CONFIG_FS_AUTOMOUNT_PROCFS)
+	bool is_mounted;
+#endif
+
+	option.verbose = false;
+	option.pid = -1;
+
+	for (i = 1; i < argc; i++) {
+		if (strcmp(args[i], "-v") == 0) {
+			option.verbose = true;
+		} else if (strcmp(args[i], "-r") == 0) {
+			reset = true;
+		} else if (args[i][0] >= '0' && args[i][0] <= '9') {
+			option.pid = atoi(args[i]);
+		} else {
+			latency_show_usage();
+			return OK;
+		}
+	}
+
+#if !defined(CONFIG_FS_AUTOMOUNT_PROCFS)
+	is_mounted = false;
+
+	/* Mount Procfs to use */
+	ret = mount(NULL, PROCFS_MOUNT_POINT, PROCFS_FSTYPE, 0, NULL);
+	if (ret == ERROR) {
+		if (errno == EEXIST) {
+			is_mounted = true;
+		} else {
+			printf("Failed to mount procfs : %d\n", errno);
+			return ERROR;
+		}
+	}
+#endif
+
+	if (reset) {
+		ret = latency_reset();
+	} else {
+		ret = latency_show(&option);
+	}
+
+#if !defined(CONFIG_FS_AUTOMOUNT_PROCFS)
+	if (!is_mounted) {
+		/* Detach mounted Procfs */
+		(void)umount(PROCFS_MOUNT_POINT);
+	}
+#endif
+
+	return ret;
+}
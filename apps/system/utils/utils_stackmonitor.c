@@ -101,6 +101,13 @@
 #define CONFIG_STACKMONITOR_INTERVAL 5
 #endif
 
+#if defined(CONFIG_STACK_WATERMARK) && !defined(CONFIG_FS_PROCFS_EXCLUDE_STACKWM) && \
+	defined(CONFIG_STACKMONITOR_WATERMARK_FILE)
+#define STKMON_WATERMARK
+#define STKMON_WATERMARK_PROC PROCFS_MOUNT_POINT "/stackwm"
+#define STKMON_WATERMARK_MAX  (CONFIG_STACK_WATERMARK_NENTRIES * 2)
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -110,6 +117,14 @@
  ****************************************************************************/
 static volatile bool stkmon_started;
 
+#ifdef STKMON_WATERMARK
+/* The marks of /proc/stackwm merged with those of the file, whose format
+ * is the same, so that the file keeps the highest marks across the boots.
+ */
+static struct stack_watermark_s *stkmon_marks;
+static int stkmon_nmarks;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -219,6 +234,110 @@ static int stkmon_read_proc(FAR struct dirent *entryp, FAR void *arg)
 	return OK;
 }
 
+#ifdef STKMON_WATERMARK
+/* Merge the marks of a file, returns true if one of them is higher */
+
+static bool stkmon_merge_watermarks(const char *path)
+{
+	struct stack_watermark_s *mark;
+	char buf[CONFIG_TASK_NAME_SIZE + 40];
+	unsigned int stacksize;
+	unsigned int peak;
+	unsigned int count;
+	bool changed = false;
+	FILE *fp;
+	int pos;
+	int i;
+
+	fp = fopen(path, "r");
+	if (fp == NULL) {
+		return false;
+	}
+
+	while (fgets(buf, sizeof(buf), fp) != NULL) {
+		/* The heading does not scan */
+
+		if (sscanf(buf, "%u %u %u %n", &stacksize, &peak, &count, &pos) != 3) {
+			continue;
+		}
+
+		buf[strcspn(buf, "\n")] = '\0';
+
+		for (i = 0; i < stkmon_nmarks; i++) {
+			if (strncmp(stkmon_marks[i].name, &buf[pos], CONFIG_TASK_NAME_SIZE) == 0) {
+				break;
+			}
+		}
+
+		if (i == stkmon_nmarks) {
+			if (stkmon_nmarks == STKMON_WATERMARK_MAX) {
+				continue;
+			}
+
+			stkmon_nmarks++;
+			strncpy(stkmon_marks[i].name, &buf[pos], CONFIG_TASK_NAME_SIZE);
+		}
+
+		mark = &stkmon_marks[i];
+		if (stacksize > mark->stacksize) {
+			mark->stacksize = stacksize;
+			changed = true;
+		}
+
+		if (peak > mark->peak) {
+			mark->peak = peak;
+			changed = true;
+		}
+
+		if (count > mark->count) {
+			mark->count = count;
+		}
+	}
+
+	fclose(fp);
+	return changed;
+}
+
+/* The file is written only when a mark rose, to spare the flash */
+
+static void stkmon_save_watermarks(void)
+{
+	FILE *fp;
+	int i;
+
+	if (CONFIG_STACKMONITOR_WATERMARK_FILE[0] == '\0') {
+		return;
+	}
+
+	if (stkmon_marks == NULL) {
+		stkmon_marks = (struct stack_watermark_s *)zalloc(sizeof(struct stack_watermark_s) * STKMON_WATERMARK_MAX);
+		if (stkmon_marks == NULL) {
+			printf(STKMON_PREFIX "Failed to allocate the watermarks\n");
+			return;
+		}
+
+		(void)stkmon_merge_watermarks(CONFIG_STACKMONITOR_WATERMARK_FILE);
+	}
+
+	if (!stkmon_merge_watermarks(STKMON_WATERMARK_PROC)) {
+		return;
+	}
+
+	fp = fopen(CONFIG_STACKMONITOR_WATERMARK_FILE, "w");
+	if (fp == NULL) {
+		printf(STKMON_PREFIX "Failed to open %s : %d\n", CONFIG_STACKMONITOR_WATERMARK_FILE, errno);
+		return;
+	}
+
+	fprintf(fp, "%8s %8s %8s %s\n", "STACK", "PEAK", "COUNT", "NAME");
+	for (i = 0; i < stkmon_nmarks; i++) {
+		fprintf(fp, "%8u %8u %8u %s\n", (unsigned int)stkmon_marks[i].stacksize, (unsigned int)stkmon_marks[i].peak, (unsigned int)stkmon_marks[i].count, stkmon_marks[i].name);
+	}
+
+	fclose(fp);
+}
+#endif
+
 static void *stackmonitor_daemon(void *arg)
 {
 #if !defined(CONFIG_FS_AUTOMOUNT_PROCFS)
@@ -273,6 +392,9 @@ static void *stackmonitor_daemon(void *arg)
 #endif
 		printf("\n");
 		utils_proc_pid_foreach(stkmon_read_proc, NULL);
+#ifdef STKMON_WATERMARK
+		stkmon_save_watermarks();
+#endif
 #ifndef CONFIG_DISABLE_SIGNALS
 		sleep(CONFIG_STACKMONITOR_INTERVAL);
 	}
@@ -284,6 +406,12 @@ static void *stackmonitor_daemon(void *arg)
 	}
 #endif
 
+#ifdef STKMON_WATERMARK
+	free(stkmon_marks);
+	stkmon_marks = NULL;
+	stkmon_nmarks = 0;
+#endif
+
 	/* Stopped */
 	printf(STKMON_PREFIX "Stopped well\n");
 #endif
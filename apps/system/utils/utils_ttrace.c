@@ -43,6 +43,8 @@ static const struct tag_list ttrace_tags[] = {
 	{"lock",    "Lock",          TTRACE_TAG_LOCK},
 	{"task",    "TASK",          TTRACE_TAG_TASK},
 	{"ipc",     "IPC",           TTRACE_TAG_IPC},
+	{"media",   "Media",         TTRACE_TAG_MEDIA},
+	{"irq",     "Interrupts",    TTRACE_TAG_IRQ},
 };
 
 int param = 0;
@@ -112,6 +114,9 @@ static void show_help()
 	printf("    -i     Show information(state, available/selected/TP used tags, bufsize)\r\n");
 	printf("    -d     Dump trace buffer, It should be run after finish\r\n");
 	printf("    -p     Print trace buffer, It should be run after finish\r\n");
+#ifdef CONFIG_TTRACE_FAST
+	printf("    -e     Print events of the fast path, It should be run after finish\r\n");
+#endif
 }
 
 static int assign_tag(char *name)
@@ -143,10 +148,11 @@ static int parse_args(int argc, char **args)
 	 * -g : TTRACE_FUNC_TAG, TP's tag(hidden to user)
 	 * -d : TTRACE_DUMP, dump mode(hang), It should be run after finish.
 	 * -p : TTRACE_PRINT, print traces, It should be run after finish.
+	 * -e : TTRACE_EVENTS, print events of the fast path, after finish.
 	 */
 	while (1) {
 		optarg = NULL;
-		ret = getopt(argc, args, "sofidpb:");
+		ret = getopt(argc, args, "sofidpeb:");
 		if (ret == '?') {
 			show_help();
 			return TTRACE_INVALID;
@@ -255,6 +261,43 @@ static int read_tracebuffer(FILE *file, int bufsize)
 	return TTRACE_VALID;
 }
 
+#ifdef CONFIG_TTRACE_FAST
+/* One header line per CPU then one line per event, the input of
+ * tools/ttrace_parser/scripts/ttrace_chrome.py
+ */
+static int print_events(FILE *file)
+{
+	struct ttrace_events_s events;
+	struct ttrace_event_s *ev;
+	int cpu;
+	int i;
+
+	events.events = (struct ttrace_event_s *)malloc(CONFIG_TTRACE_FAST_EVENTS * sizeof(struct ttrace_event_s));
+	if (events.events == NULL) {
+		printf("Failed to allocate event buffer in ttrace\r\n");
+		return TTRACE_INVALID;
+	}
+
+	for (cpu = 0; ; cpu++) {
+		events.cpu = cpu;
+		events.count = CONFIG_TTRACE_FAST_EVENTS;
+		if (ioctl(file->fs_fd, TTRACE_EVENTS, (unsigned long)&events) < 0) {
+			break;
+		}
+		printf("ttrace_events cpu=%d freq=%u start=%u dropped=%u count=%d\r\n",
+			   cpu, events.freq, events.start, events.dropped, events.count);
+		for (i = 0; i < events.count; i++) {
+			ev = &events.events[i];
+			printf("%u %d %d %d %u\r\n", ev->delta, TTRACE_EVENT_TYPE(ev->idtype),
+				   TTRACE_EVENT_ID(ev->idtype), ev->pid, ev->arg);
+		}
+	}
+
+	free(events.events);
+	return cpu > 0 ? TTRACE_VALID : TTRACE_NODATA;
+}
+#endif
+
 void wait_ttrace_dump()
 {
 	int i = 0;
@@ -286,6 +329,10 @@ static int send_cmds(FILE *file, int cmd)
 		}
 		ret = read_tracebuffer(file, bufsize);
 		return ret;
+#ifdef CONFIG_TTRACE_FAST
+	} else if (cmd == TTRACE_EVENTS) {
+		return print_events(file);
+#endif
 	}
 
 	if (run_cmd(file, cmd, param) == TTRACE_INVALID) {
@@ -735,6 +735,15 @@ int dhcp_client_start(const char *intf)
 	return OK;
 }
 
+/****************************************************************************
+ * Name: dhcp_client_reboot
+ ****************************************************************************/
+int dhcp_client_reboot(const char *intf, struct in_addr addr)
+{
+	/* This client always discovers the servers */
+	return dhcp_client_start(intf);
+}
+
 /****************************************************************************
  * Name: dhcp_client_stop
  ****************************************************************************/
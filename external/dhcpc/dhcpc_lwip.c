@@ -85,12 +85,9 @@
  * Private Functions
  ****************************************************************************/
 /****************************************************************************
- * Public Functions
+ * Name: dhcp_client_start_addr
  ****************************************************************************/
-/****************************************************************************
- * Name: dhcp_client_start
- ****************************************************************************/
-int dhcp_client_start(const char *intf)
+static int dhcp_client_start_addr(const char *intf, struct in_addr addr)
 {
 	int ret = -1;
 	struct req_lwip_data req;
@@ -104,6 +101,7 @@ int dhcp_client_start(const char *intf)
 	memset(&req, 0, sizeof(req));
 	req.type = DHCPCSTART;
 	req.msg.dhcp.intf = intf;
+	req.msg.dhcp.addr = addr;
 
 	ret = ioctl(sockfd, SIOCLWIP, (unsigned long)&req);
 	if (ret == ERROR) {
@@ -117,6 +115,26 @@ int dhcp_client_start(const char *intf)
 	return ret;
 }
 
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+/****************************************************************************
+ * Name: dhcp_client_start
+ ****************************************************************************/
+int dhcp_client_start(const char *intf)
+{
+	struct in_addr addr = { .s_addr = INADDR_ANY };
+	return dhcp_client_start_addr(intf, addr);
+}
+
+/****************************************************************************
+ * Name: dhcp_client_reboot
+ ****************************************************************************/
+int dhcp_client_reboot(const char *intf, struct in_addr addr)
+{
+	return dhcp_client_start_addr(intf, addr);
+}
+
 /****************************************************************************
  * Name: dhcp_client_stop
  ****************************************************************************/
@@ -333,6 +333,18 @@ static void init_transport(grpc_chttp2_transport* t,
                        DEFAULT_MAX_HEADER_LIST_SIZE);
   queue_setting_update(t, GRPC_CHTTP2_SETTINGS_GRPC_ALLOW_TRUE_BINARY_METADATA,
                        1);
+#ifdef CONFIG_GRPC_TIZENRT_PROFILE
+  /* small RAM profile: smaller HPACK tables in both directions, and windows
+     which bound what the peer may send ahead of the application. The
+     channel args below still override these. */
+  queue_setting_update(t, GRPC_CHTTP2_SETTINGS_HEADER_TABLE_SIZE,
+                       CONFIG_GRPC_HPACK_TABLE_SIZE);
+  grpc_chttp2_hpack_compressor_set_max_usable_size(
+      &t->hpack_compressor, CONFIG_GRPC_HPACK_TABLE_SIZE);
+  queue_setting_update(t, GRPC_CHTTP2_SETTINGS_INITIAL_WINDOW_SIZE,
+                       CONFIG_GRPC_FLOW_CONTROL_WINDOW);
+  t->write_buffer_size = CONFIG_GRPC_WRITE_BUFFER_SIZE;
+#endif
 
   t->ping_policy.max_pings_without_data = g_default_max_pings_without_data;
   t->ping_policy.min_sent_ping_interval_without_data =
@@ -364,7 +376,12 @@ static void init_transport(grpc_chttp2_transport* t,
 
   t->opt_target = GRPC_CHTTP2_OPTIMIZE_FOR_LATENCY;
 
+#ifdef CONFIG_GRPC_TIZENRT_PROFILE
+  /* the bdp probe grows the windows up to megabytes */
+  bool enable_bdp = false;
+#else
   bool enable_bdp = true;
+#endif
 
   if (channel_args) {
     for (i = 0; i < channel_args->num_args; i++) {
@@ -426,7 +443,8 @@ static void init_transport(grpc_chttp2_transport* t,
             &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE});
       } else if (0 ==
                  strcmp(channel_args->args[i].key, GRPC_ARG_HTTP2_BDP_PROBE)) {
-        enable_bdp = grpc_channel_arg_get_bool(&channel_args->args[i], true);
+        enable_bdp =
+            grpc_channel_arg_get_bool(&channel_args->args[i], enable_bdp);
       } else if (0 == strcmp(channel_args->args[i].key,
                              GRPC_ARG_KEEPALIVE_TIME_MS)) {
         const int value = grpc_channel_arg_get_integer(
@@ -181,7 +181,13 @@ TransportFlowControl::TransportFlowControl(const grpc_chttp2_transport* t,
                           .set_min_control_value(-1)
                           .set_max_control_value(25)
                           .set_integral_range(10)),
-      last_pid_update_(grpc_core::ExecCtx::Get()->Now()) {}
+      last_pid_update_(grpc_core::ExecCtx::Get()->Now()) {
+#ifdef CONFIG_GRPC_TIZENRT_PROFILE
+  if (!enable_bdp_probe_) {
+    target_initial_window_size_ = CONFIG_GRPC_FLOW_CONTROL_WINDOW;
+  }
+#endif
+}
 
 uint32_t TransportFlowControl::MaybeSendUpdate(bool writing_anyway) {
   FlowControlTrace trace("t updt sent", this, nullptr);
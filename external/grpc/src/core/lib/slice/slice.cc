@@ -21,6 +21,7 @@
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/sync.h>
 
 #include <string.h>
 
@@ -220,9 +221,77 @@ static const grpc_slice_refcount_vtable malloc_vtable = {
     malloc_ref, malloc_unref, grpc_slice_default_eq_impl,
     grpc_slice_default_hash_impl};
 
+#ifdef CONFIG_GRPC_TIZENRT_PROFILE
+/* Pool of the slices up to CONFIG_GRPC_SLICE_POOL_BLOCK bytes: frames,
+   metadata and small messages reuse a static block instead of going to the
+   heap for each of them. When the pool is empty, the slice is allocated as
+   usual. */
+#define SLICE_POOL_BLOCK                                                     \
+  ((sizeof(malloc_refcount) + CONFIG_GRPC_SLICE_POOL_BLOCK + 7) & ~(size_t)7)
+
+static uint64_t g_slice_pool[CONFIG_GRPC_SLICE_POOL_BLOCKS * SLICE_POOL_BLOCK /
+                             sizeof(uint64_t)];
+static void* g_slice_pool_free;
+static gpr_mu g_slice_pool_mu;
+static gpr_once g_slice_pool_once = GPR_ONCE_INIT;
+
+static void slice_pool_init(void) {
+  size_t i;
+
+  gpr_mu_init(&g_slice_pool_mu);
+  for (i = 0; i < CONFIG_GRPC_SLICE_POOL_BLOCKS; i++) {
+    void* block = (char*)g_slice_pool + i * SLICE_POOL_BLOCK;
+    *(void**)block = g_slice_pool_free;
+    g_slice_pool_free = block;
+  }
+}
+
+static void pool_unref(void* p) {
+  malloc_refcount* r = (malloc_refcount*)p;
+  if (gpr_unref(&r->refs)) {
+    gpr_mu_lock(&g_slice_pool_mu);
+    *(void**)r = g_slice_pool_free;
+    g_slice_pool_free = r;
+    gpr_mu_unlock(&g_slice_pool_mu);
+  }
+}
+
+static const grpc_slice_refcount_vtable pool_vtable = {
+    malloc_ref, pool_unref, grpc_slice_default_eq_impl,
+    grpc_slice_default_hash_impl};
+
+static malloc_refcount* slice_pool_alloc(void) {
+  malloc_refcount* rc;
+
+  gpr_once_init(&g_slice_pool_once, slice_pool_init);
+  gpr_mu_lock(&g_slice_pool_mu);
+  rc = (malloc_refcount*)g_slice_pool_free;
+  if (rc != nullptr) {
+    g_slice_pool_free = *(void**)rc;
+  }
+  gpr_mu_unlock(&g_slice_pool_mu);
+  return rc;
+}
+#endif
+
 grpc_slice grpc_slice_malloc_large(size_t length) {
   grpc_slice slice;
 
+#ifdef CONFIG_GRPC_TIZENRT_PROFILE
+  if (length <= CONFIG_GRPC_SLICE_POOL_BLOCK) {
+    malloc_refcount* rc = slice_pool_alloc();
+    if (rc != nullptr) {
+      gpr_ref_init(&rc->refs, 1);
+      rc->base.vtable = &pool_vtable;
+      rc->base.sub_refcount = &rc->base;
+      slice.refcount = &rc->base;
+      slice.data.refcounted.bytes = (uint8_t*)(rc + 1);
+      slice.data.refcounted.length = length;
+      return slice;
+    }
+  }
+#endif
+
   /* Memory layout used by the slice created here:
 
      +-----------+----------------------------------------------------------+
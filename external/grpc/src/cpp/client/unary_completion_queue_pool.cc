@@ -0,0 +1,63 @@
+/*
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc++/impl/codegen/client_unary_call.h>
+#include <grpc++/impl/codegen/completion_queue.h>
+
+#include <mutex>
+
+#ifdef CONFIG_GRPC_TIZENRT_PROFILE
+
+namespace grpc {
+namespace internal {
+
+namespace {
+std::mutex g_mu;
+CompletionQueue* g_free[CONFIG_GRPC_UNARY_CQ_POOL];
+int g_num_free;
+}  // namespace
+
+CompletionQueue* UnaryCompletionQueuePool::Get() {
+  {
+    std::lock_guard<std::mutex> lock(g_mu);
+    if (g_num_free > 0) {
+      return g_free[--g_num_free];
+    }
+  }
+
+  // More calls at once than queues kept: one more, for this call only
+  return new CompletionQueue(grpc_completion_queue_attributes{
+      GRPC_CQ_CURRENT_VERSION, GRPC_CQ_PLUCK, GRPC_CQ_DEFAULT_POLLING});
+}
+
+void UnaryCompletionQueuePool::Put(CompletionQueue* cq) {
+  {
+    std::lock_guard<std::mutex> lock(g_mu);
+    if (g_num_free < CONFIG_GRPC_UNARY_CQ_POOL) {
+      g_free[g_num_free++] = cq;
+      return;
+    }
+  }
+
+  delete cq;
+}
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // CONFIG_GRPC_TIZENRT_PROFILE
@@ -267,6 +267,16 @@ struct pb_bytes_array_s {
 };
 typedef struct pb_bytes_array_s pb_bytes_array_t;
 
+/* This structure is used for 'bytes' and 'string' fields decoded without
+ * copying, see pb_decode_bytes_view(). It points into the input buffer and
+ * is valid as long as that buffer. A string is not null-terminated.
+ */
+struct pb_bytes_view_s {
+    const pb_byte_t *bytes;
+    size_t size;
+};
+typedef struct pb_bytes_view_s pb_bytes_view_t;
+
 /* This structure is used for giving the callback function.
  * It is stored in the message structure and filled in by the method that
  * calls pb_decode.
@@ -121,6 +121,22 @@ bool checkreturn pb_read(pb_istream_t *stream, pb_byte_t *buf, size_t count)
     return true;
 }
 
+bool checkreturn pb_read_view(pb_istream_t *stream, const pb_byte_t **buf, size_t count)
+{
+#ifndef PB_BUFFER_ONLY
+    if (stream->callback != buf_read)
+        PB_RETURN_ERROR(stream, "not a buffer stream");
+#endif
+
+    if (stream->bytes_left < count)
+        PB_RETURN_ERROR(stream, "end-of-stream");
+
+    *buf = (const pb_byte_t*)stream->state;
+    stream->state = (pb_byte_t*)stream->state + count;
+    stream->bytes_left -= count;
+    return true;
+}
+
 /* Read a single byte from input stream. buf may not be NULL.
  * This is an optimization for the varint decoding. */
 static bool checkreturn pb_readbyte(pb_istream_t *stream, pb_byte_t *buf)
@@ -342,6 +358,23 @@ void pb_close_string_substream(pb_istream_t *stream, pb_istream_t *substream)
 #endif
 }
 
+#ifndef PB_OLD_CALLBACK_STYLE
+bool checkreturn pb_decode_bytes_view(pb_istream_t *stream, const pb_field_t *field, void **arg)
+{
+    pb_bytes_view_t *view = (pb_bytes_view_t*)*arg;
+
+    /* The scalar fields come from a copy on the stack */
+    if (PB_LTYPE(field->type) != PB_LTYPE_BYTES && PB_LTYPE(field->type) != PB_LTYPE_STRING)
+        PB_RETURN_ERROR(stream, "invalid field type");
+
+    if (view == NULL)
+        PB_RETURN_ERROR(stream, "no bytes view");
+
+    view->size = stream->bytes_left;
+    return pb_read_view(stream, &view->bytes, stream->bytes_left);
+}
+#endif
+
 /*************************
  * Decode a single field *
  *************************/
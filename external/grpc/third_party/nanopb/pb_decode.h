@@ -110,6 +110,12 @@ pb_istream_t pb_istream_from_buffer(const pb_byte_t *buf, size_t bufsize);
  */
 bool pb_read(pb_istream_t *stream, pb_byte_t *buf, size_t count);
 
+/* Read from a stream made by pb_istream_from_buffer() without copying:
+ * *buf is set to the next count bytes of the input buffer. Fails on the
+ * other streams.
+ */
+bool pb_read_view(pb_istream_t *stream, const pb_byte_t **buf, size_t count);
+
 
 /************************************************
  * Helper functions for writing field callbacks *
@@ -142,6 +148,16 @@ bool pb_decode_fixed64(pb_istream_t *stream, void *dest);
 bool pb_make_string_substream(pb_istream_t *stream, pb_istream_t *substream);
 void pb_close_string_substream(pb_istream_t *stream, pb_istream_t *substream);
 
+#ifndef PB_OLD_CALLBACK_STYLE
+/* Decoding callback of a 'bytes' or 'string' field, which sets the
+ * pb_bytes_view_t given as the callback arg to the field data in the input
+ * buffer instead of copying it. The message must be decoded from a
+ * pb_istream_from_buffer() stream. A repeated field keeps its last value;
+ * other callbacks can use pb_read_view() for each value.
+ */
+bool pb_decode_bytes_view(pb_istream_t *stream, const pb_field_t *field, void **arg);
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
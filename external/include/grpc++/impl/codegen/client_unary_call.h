@@ -33,6 +33,25 @@ class CompletionQueue;
 
 namespace internal {
 class RpcMethod;
+
+#ifdef CONFIG_GRPC_TIZENRT_PROFILE
+/// Pluckable completion queues of the blocking unary calls. A call takes one
+/// from the pool and gives it back when done, so that the next calls reuse
+/// it instead of creating and destroying a completion queue each.
+class UnaryCompletionQueuePool {
+ public:
+  UnaryCompletionQueuePool() : cq_(Get()) {}
+  ~UnaryCompletionQueuePool() { Put(cq_); }
+  CompletionQueue* cq() { return cq_; }
+
+ private:
+  static CompletionQueue* Get();
+  static void Put(CompletionQueue* cq);
+
+  CompletionQueue* cq_;
+};
+#endif
+
 /// Wrapper that performs a blocking unary call
 template <class InputMessage, class OutputMessage>
 Status BlockingUnaryCall(ChannelInterface* channel, const RpcMethod& method,
@@ -49,9 +68,14 @@ class BlockingUnaryCallImpl {
   BlockingUnaryCallImpl(ChannelInterface* channel, const RpcMethod& method,
                         ClientContext* context, const InputMessage& request,
                         OutputMessage* result) {
+#ifdef CONFIG_GRPC_TIZENRT_PROFILE
+    UnaryCompletionQueuePool pooled;
+    CompletionQueue& cq = *pooled.cq();
+#else
     CompletionQueue cq(grpc_completion_queue_attributes{
         GRPC_CQ_CURRENT_VERSION, GRPC_CQ_PLUCK,
         GRPC_CQ_DEFAULT_POLLING});  // Pluckable completion queue
+#endif
     Call call(channel->CreateCall(method, context, &cq));
     CallOpSet<CallOpSendInitialMetadata, CallOpSendMessage,
               CallOpRecvInitialMetadata, CallOpRecvMessage<OutputMessage>,
@@ -83,6 +83,7 @@ template <class Streamer, bool WriteNeeded>
 class TemplatedBidiStreamingHandler;
 template <class InputMessage, class OutputMessage>
 class BlockingUnaryCallImpl;
+class UnaryCompletionQueuePool;
 }  // namespace internal
 
 extern CoreCodegenInterface* g_core_codegen_interface;
@@ -227,6 +228,7 @@ class CompletionQueue : private GrpcLibraryCodegen {
   friend class ::grpc::ServerInterface;
   template <class InputMessage, class OutputMessage>
   friend class ::grpc::internal::BlockingUnaryCallImpl;
+  friend class ::grpc::internal::UnaryCompletionQueuePool;
 
   /// EXPERIMENTAL
   /// Creates a Thread Local cache to store the first event
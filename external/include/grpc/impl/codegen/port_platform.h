@@ -308,6 +308,7 @@
 #define GPR_ARCH_32 1
 #endif /* _LP64 */
 #elif defined(__TizenRT__)
+#include <tinyara/config.h>
 #include <tinyara/features.h>
 #define GPR_PLATFORM_STRING "tizenrt"
 #define GPR_TIZENRT 1
@@ -84,6 +84,10 @@ extern "C"
 
 #define cJSON_IsReference 256
 #define cJSON_StringIsConst 512
+/* The node, its strings and its children are in the arena of a document
+ * parsed by cJSON_ParseWithArena(), which the root owns. */
+#define cJSON_InArena 1024
+#define cJSON_ArenaOwner 2048
 
 /* The cJSON structure: */
 typedef struct cJSON
@@ -177,6 +181,9 @@ CJSON_PUBLIC(cJSON *) cJSON_Parse(const char *value);
 /* ParseWithOpts allows you to require (and check) that the JSON is null terminated, and to retrieve the pointer to the final byte parsed. */
 /* If you supply a ptr in return_parse_end and parsing fails, then return_parse_end will contain a pointer to the error. If not, then cJSON_GetErrorPtr() does the job. */
 CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated);
+/* Like cJSON_Parse, with all the nodes and strings of the document in one block, measured before the parse. cJSON_Delete of the root frees it at once.
+ * The document can be read, printed, duplicated and extended with new items; its own items must not be given other strings or moved to another document. */
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithArena(const char *value);
 
 /* Render a cJSON entity to text for transfer/storage. */
 CJSON_PUBLIC(char *) cJSON_Print(const cJSON *item);
@@ -0,0 +1,203 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * external/include/json/json_stream.h
+ *
+ * Streaming JSON parser, which calls back for each token of a text fed in
+ * pieces of any size, and JSON writer into a buffer, which is flushed
+ * when full.  Neither of them allocates memory, for the payloads which do
+ * not need the tree of cJSON.
+ *
+ ****************************************************************************/
+
+#ifndef __EXTERNAL_INCLUDE_JSON_JSON_STREAM_H
+#define __EXTERNAL_INCLUDE_JSON_JSON_STREAM_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Deepest nesting of arrays and objects */
+
+#define JSON_STREAM_MAX_DEPTH	32
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Callbacks of the parser, any of which may be NULL.  A callback returns 0
+ * to go on; another value stops the parse, and json_parser_feed() or
+ * json_parser_finish() returns it.
+ *
+ * The strings and keys are decoded, NUL terminated, and valid until the
+ * callback returns.  A number comes with its text, for the integers larger
+ * than a double holds.
+ */
+
+struct json_sax_s {
+	int (*object_start)(void *arg);
+	int (*object_end)(void *arg);
+	int (*array_start)(void *arg);
+	int (*array_end)(void *arg);
+	int (*key)(void *arg, const char *key, size_t len);
+	int (*string)(void *arg, const char *str, size_t len);
+	int (*number)(void *arg, double value, const char *text);
+	int (*boolean)(void *arg, bool value);
+	int (*null)(void *arg);
+};
+
+struct json_parser_s {
+	const struct json_sax_s *sax;
+	void *arg;
+	char *buf;					/* Text of the current string or number */
+	size_t bufsize;
+	size_t len;
+	uint32_t objects;			/* Bit of each nesting level, set for the objects */
+	uint32_t code;				/* Code point of a \u escape */
+	uint32_t surrogate;			/* High surrogate waiting for the low one */
+	uint8_t depth;
+	uint8_t state;
+	uint8_t token;
+	uint8_t count;				/* Progress of an escape or of a literal */
+	int error;
+};
+
+/* Flush of the writer, which returns 0 or a negated errno */
+
+typedef int (*json_flush_t)(void *arg, const char *data, size_t len);
+
+struct json_writer_s {
+	char *buf;
+	size_t size;
+	size_t len;
+	size_t total;				/* Bytes flushed */
+	json_flush_t flush;
+	void *arg;
+	uint8_t depth;
+	bool comma;					/* A value is written at this level */
+	bool key;					/* A key waits for its value */
+	int error;
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/**
+ * @brief Initialize a parser
+ *
+ * @param[in] parser parser to initialize
+ * @param[in] sax callbacks of the tokens
+ * @param[in] arg argument of the callbacks
+ * @param[in] buf buffer of the strings and numbers, which bounds their length
+ * @param[in] bufsize size of buf
+ * @return none
+ * @since TizenRT v5.0
+ */
+void json_parser_init(struct json_parser_s *parser, const struct json_sax_s *sax, void *arg, char *buf, size_t bufsize);
+
+/**
+ * @brief Parse the next piece of the text
+ *
+ * @param[in] parser parser of the text
+ * @param[in] data next bytes of the text
+ * @param[in] len number of bytes
+ * @return 0 on success, the value of a callback which stopped the parse,
+ *         -EINVAL on a syntax error, or -E2BIG for a string or a number
+ *         longer than the buffer or a nesting deeper than
+ *         JSON_STREAM_MAX_DEPTH.  The errors are sticky.
+ * @since TizenRT v5.0
+ */
+int json_parser_feed(struct json_parser_s *parser, const char *data, size_t len);
+
+/**
+ * @brief End the text, which must hold one complete value
+ *
+ * @param[in] parser parser of the text
+ * @return 0 on success, or as json_parser_feed()
+ * @since TizenRT v5.0
+ */
+int json_parser_finish(struct json_parser_s *parser);
+
+/**
+ * @brief Parse a complete text
+ *
+ * @return as json_parser_finish()
+ * @since TizenRT v5.0
+ */
+int json_parse(const char *json, size_t len, const struct json_sax_s *sax, void *arg, char *buf, size_t bufsize);
+
+/**
+ * @brief Initialize a writer
+ *
+ * @param[in] writer writer to initialize
+ * @param[in] buf buffer of the text
+ * @param[in] size size of buf
+ * @param[in] flush called with the text when the buffer is full and at
+ *            json_writer_finish(), or NULL to write the whole text in buf
+ * @param[in] arg argument of flush
+ * @return none
+ * @since TizenRT v5.0
+ */
+void json_writer_init(struct json_writer_s *writer, char *buf, size_t size, json_flush_t flush, void *arg);
+
+/**
+ * @brief Write a token.  Commas and colons are put as needed.
+ *
+ * @return 0 on success, -ENOSPC when the text does not fit in the buffer
+ *         without flush, or the error of flush.  The errors are sticky.
+ * @since TizenRT v5.0
+ */
+int json_writer_object_start(struct json_writer_s *writer);
+int json_writer_object_end(struct json_writer_s *writer);
+int json_writer_array_start(struct json_writer_s *writer);
+int json_writer_array_end(struct json_writer_s *writer);
+int json_writer_key(struct json_writer_s *writer, const char *key);
+int json_writer_string(struct json_writer_s *writer, const char *str);
+int json_writer_int(struct json_writer_s *writer, int64_t value);
+int json_writer_double(struct json_writer_s *writer, double value);
+int json_writer_bool(struct json_writer_s *writer, bool value);
+int json_writer_null(struct json_writer_s *writer);
+
+/**
+ * @brief End the text.  Without flush, the text in the buffer is NUL
+ *        terminated.
+ *
+ * @param[in] writer writer of the text
+ * @return the length of the text, or a negated errno
+ * @since TizenRT v5.0
+ */
+int json_writer_finish(struct json_writer_s *writer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EXTERNAL_INCLUDE_JSON_JSON_STREAM_H */
@@ -0,0 +1,55 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file mbedtls/alt/offload_alt.h
+// @brief Offload of the bulk operations of gcm.c and sha256.c to seclink
+
+#pragma once
+
+#include <stddef.h>
+
+/*
+ * Unlike the other ALT modules, these do not replace the software
+ * implementation. gcm.c and sha256.c call them first and go on in software
+ * when they return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED: for inputs
+ * shorter than the threshold, where a seclink request costs more than the
+ * software, and when the hardware does not support the request.
+ */
+
+#if defined(MBEDTLS_GCM_HW_OFFLOAD)
+struct mbedtls_gcm_context;
+
+void mbedtls_gcm_hw_setkey(struct mbedtls_gcm_context *ctx, int cipher,
+						   const unsigned char *key, unsigned int keybits);
+int mbedtls_gcm_hw_encrypt(struct mbedtls_gcm_context *ctx, size_t length,
+						   const unsigned char *iv, size_t iv_len,
+						   const unsigned char *add, size_t add_len,
+						   const unsigned char *input, unsigned char *output,
+						   size_t tag_len, unsigned char *tag);
+int mbedtls_gcm_hw_decrypt(struct mbedtls_gcm_context *ctx, size_t length,
+						   const unsigned char *iv, size_t iv_len,
+						   const unsigned char *add, size_t add_len,
+						   const unsigned char *tag, size_t tag_len,
+						   const unsigned char *input, unsigned char *output);
+void mbedtls_gcm_hw_free(struct mbedtls_gcm_context *ctx);
+#endif
+
+#if defined(MBEDTLS_SHA256_HW_OFFLOAD)
+int mbedtls_sha256_hw(const unsigned char *input, size_t ilen,
+					  unsigned char *output, int is224);
+#endif
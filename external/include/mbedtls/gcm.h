@@ -86,6 +86,9 @@ typedef struct mbedtls_gcm_context {
     int MBEDTLS_PRIVATE(mode);                             /*!< The operation to perform:
                                                             #MBEDTLS_GCM_ENCRYPT or
                                                             #MBEDTLS_GCM_DECRYPT. */
+#if defined(MBEDTLS_GCM_HW_OFFLOAD)
+    void *MBEDTLS_PRIVATE(hw);                             /*!< The key in the secure element, or NULL. */
+#endif
 }
 mbedtls_gcm_context;
 
@@ -204,6 +204,14 @@
 #endif
 #endif /* CONFIG_TLS_HW_AES_ENC */
 
+#if defined(CONFIG_TLS_HW_GCM)
+#define MBEDTLS_GCM_HW_OFFLOAD
+#endif
+
+#if defined(CONFIG_TLS_HW_SHA256)
+#define MBEDTLS_SHA256_HW_OFFLOAD
+#endif
+
 #endif /* CONFIG_SE */
 
 #if defined(CONFIG_MBEDTLS_PKCS5_C)
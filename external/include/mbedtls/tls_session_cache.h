@@ -0,0 +1,91 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * \file tls_session_cache.h
+ *
+ * \brief Client session cache shared by the TLS clients of TizenRT
+ *
+ * The sessions of the servers a device connects to are kept by host and
+ * port, so that a reconnection resumes the session, by session ID or by
+ * session ticket, instead of doing a full handshake. Every client using
+ * this cache shares it, and with CONFIG_TLS_SESSION_CACHE_PERSIST the
+ * sessions are also kept in the shared preference and survive a reboot.
+ *
+ * A client calls tls_session_cache_set() after mbedtls_ssl_setup() and
+ * before the handshake, then tls_session_cache_update() once the
+ * handshake succeeded, or tls_session_cache_remove() if it failed.
+ */
+#pragma once
+
+#include <tinyara/config.h>
+#include <stdint.h>
+#include "mbedtls/ssl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CONFIG_TLS_SESSION_CACHE
+
+struct tls_session_cache_stats {
+	uint32_t lookups;    /* tls_session_cache_set() calls */
+	uint32_t offered;    /* handshakes started with a cached session */
+	uint32_t resumed;    /* handshakes which resumed the session */
+	uint32_t stored;     /* sessions stored after a handshake */
+	uint32_t evicted;    /* sessions dropped to make room */
+	uint32_t expired;    /* sessions dropped after their lifetime */
+};
+
+/**
+ * \brief Offer the cached session of host:port in the next handshake of ssl
+ *
+ * \return 1 if a session is offered, 0 if none is cached, or a negative
+ *         mbedtls error code
+ */
+int tls_session_cache_set(mbedtls_ssl_context *ssl, const char *host, int port);
+
+/**
+ * \brief Store the session of ssl after a successful handshake
+ *
+ * Counts the handshake as resumed if it reused the session offered by
+ * tls_session_cache_set().
+ *
+ * \return 0 on success, or a negative mbedtls error code
+ */
+int tls_session_cache_update(mbedtls_ssl_context *ssl, const char *host, int port);
+
+/**
+ * \brief Drop the session of host:port, after a failed handshake
+ */
+void tls_session_cache_remove(const char *host, int port);
+
+/**
+ * \brief Drop all the sessions
+ */
+void tls_session_cache_clear(void);
+
+/**
+ * \brief Copy the counters of the cache to stats
+ */
+void tls_session_cache_get_stats(struct tls_session_cache_stats *stats);
+
+#endif /* CONFIG_TLS_SESSION_CACHE */
+
+#ifdef __cplusplus
+}
+#endif
@@ -98,6 +98,21 @@ extern "C" {
  */
 int dhcp_client_start(const char *intf);
 
+/**
+ * @brief Starts DHCP client with the address of a previous lease
+ *
+ * @param[in] intf name of interface to run dhcpc
+ * @param[in] addr address of a previous lease. It is requested from the
+ *            server without discovering it first (INIT-REBOOT), and the
+ *            client falls back to discovering if the server refuses it.
+ * @return On success, 0. On failure, returns negative
+ * @since TizenRT v4.1
+ *
+ * @note The previous lease is only reused by lwIP dhcpc. The other
+ *       client discovers the servers as dhcp_client_start() does.
+ */
+int dhcp_client_reboot(const char *intf, struct in_addr addr);
+
 /**
  * @brief Stop DHCP client
  *
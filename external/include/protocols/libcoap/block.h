@@ -163,6 +163,86 @@ int coap_write_block_opt(coap_block_t *block, unsigned short type, coap_pdu_t *p
  * @return @c 1 on success, @c 0 otherwise.
  */
 int coap_add_block(coap_pdu_t *pdu, unsigned int len, const unsigned char *data, unsigned int block_num, unsigned char block_szx);
+
+/** Largest number of Block2 requests a client keeps in flight */
+#define COAP_BLOCK_WINDOW_MAX 8
+
+/**
+ * Window of a Block2 transfer where the client asks for the next blocks
+ * before the previous ones arrive, instead of one block per round trip.
+ * The blocks which arrive out of order are kept until the missing ones
+ * come, and all of them are handed to the application in order.
+ *
+ * The first block is asked alone, as the server may choose a smaller
+ * block size than the one requested. The last block is only known when
+ * it arrives, so up to window - 1 requests go past the end of the
+ * resource; their error responses are given to
+ * coap_block_window_end().
+ */
+typedef struct {
+	unsigned int next_out;	/**< next block to hand to the application */
+	unsigned int next_req;	/**< next block to request */
+	unsigned int last;	/**< last block, or UINT_MAX while unknown */
+	unsigned char szx;	/**< block size of the transfer */
+	unsigned char window;	/**< number of requests in flight */
+	unsigned char *data[COAP_BLOCK_WINDOW_MAX]; /**< blocks out of order */
+	size_t length[COAP_BLOCK_WINDOW_MAX];
+} coap_block_window_t;
+
+/** Called with the blocks of a window, in order */
+typedef void (*coap_block_handler_t)(void *arg, unsigned int num, const unsigned char *data, size_t length);
+
+/**
+ * Initializes a window of @p window requests, clamped to
+ * COAP_BLOCK_WINDOW_MAX; 1 is the stop-and-wait transfer. The request
+ * of block 0 counts as sent.
+ *
+ * @param w      The window.
+ * @param szx    The block size of the first request.
+ * @param window The number of requests in flight.
+ */
+void coap_block_window_init(coap_block_window_t *w, unsigned char szx, unsigned int window);
+
+/**
+ * Gives the number of the next block to request, as long as the window
+ * is not full. The caller sends requests while it returns @c 1.
+ *
+ * @param w   The window.
+ * @param num The number of the block to request.
+ * @return @c 1 if a block has to be requested, @c 0 otherwise.
+ */
+int coap_block_window_next(coap_block_window_t *w, unsigned int *num);
+
+/**
+ * Handles a received block, and hands it and the ones which were kept
+ * after it to @p handler once all the blocks before it have arrived.
+ * Duplicates and blocks outside of the window are ignored.
+ *
+ * @param w       The window.
+ * @param block   The Block2 option of the response.
+ * @param data    The payload of the response.
+ * @param length  The length of @p data.
+ * @param handler Called with each block in order.
+ * @param arg     The argument of @p handler.
+ * @return @c 1 when the transfer is complete, @c 0 while blocks are
+ *         missing, @c -1 when a block cannot be kept or the server
+ *         changed the block size.
+ */
+int coap_block_window_recv(coap_block_window_t *w, const coap_block_t *block, const unsigned char *data, size_t length, coap_block_handler_t handler, void *arg);
+
+/**
+ * Handles an error response to the request of block @p num, which marks
+ * the end of the resource when the transfer has begun.
+ *
+ * @param w   The window.
+ * @param num The number of the block which was requested.
+ * @return @c 1 when the transfer is complete, @c 0 while blocks are
+ *         missing, @c -1 if the error is not about the end.
+ */
+int coap_block_window_end(coap_block_window_t *w, unsigned int num);
+
+/** Releases the blocks kept by the window @p w */
+void coap_block_window_free(coap_block_window_t *w);
 /**@}*/
 
 #endif							/* _COAP_BLOCK_H_ */
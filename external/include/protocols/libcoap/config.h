@@ -46,6 +46,15 @@
 /* #undef WITH_MBEDTLS */
 /* #endif */
 
+#if defined(CONFIG_NETUTILS_LIBCOAP_RESPONSE_CACHE) && CONFIG_NETUTILS_LIBCOAP_RESPONSE_CACHE > 0
+#define COAP_RESPONSE_CACHE CONFIG_NETUTILS_LIBCOAP_RESPONSE_CACHE
+#define COAP_RESPONSE_CACHE_AGE CONFIG_NETUTILS_LIBCOAP_RESPONSE_CACHE_AGE
+#endif
+
+#ifdef CONFIG_NETUTILS_LIBCOAP_OBSERVE_COALESCE
+#define COAP_OBSERVE_COALESCE
+#endif
+
 /********************************************************
  *  User defined configuration (via Kconfig)
  *********************************************************/
@@ -118,6 +118,23 @@ typedef struct {
 	coap_key_t item[COAP_MID_CACHE_SIZE];
 } coap_mid_cache_t;
 
+#ifdef COAP_RESPONSE_CACHE
+/**
+ * A response to a GET on a cacheable resource, without its header and
+ * token, which differ at each request.
+ */
+typedef struct {
+	coap_key_t resource; /**< key of the resource */
+	coap_key_t request;	/**< key of the options of the request */
+	coap_tick_t stored;	/**< when the response was stored */
+	unsigned char code;
+	unsigned short max_delta;
+	unsigned int data_offset; /**< offset of the payload in bytes, or 0 */
+	unsigned int length;	/**< number of bytes */
+	unsigned char *bytes;	/**< options and payload, or NULL if unused */
+} coap_cache_entry_t;
+#endif
+
 /** The CoAP stack's global state is stored in a coap_context_t object */
 typedef struct coap_context_t {
 	coap_opt_filter_t known_options;
@@ -190,6 +207,11 @@ typedef struct coap_context_t {
 #endif
 
 	coap_response_handler_t response_handler;
+
+#ifdef COAP_RESPONSE_CACHE
+	coap_cache_entry_t cache[COAP_RESPONSE_CACHE];
+	unsigned int cache_next; /**< entry to replace when all are used */
+#endif
 } coap_context_t;
 
 /**
@@ -271,6 +293,21 @@ coap_new_message_id(coap_context_t *context)
 /* CoAP stack context must be released with coap_free_context() */
 void coap_free_context(coap_context_t *context);
 
+#ifdef COAP_RESPONSE_CACHE
+/**
+ * Drops the cached responses of the resource with the given @p key. The
+ * stack does it when another method than GET is handled on the resource
+ * or when it becomes dirty; an application which changes a cacheable
+ * resource otherwise has to call it.
+ *
+ * @param context The CoAP context.
+ * @param key     The key of the resource.
+ */
+void coap_cache_invalidate(coap_context_t *context, const coap_key_t key);
+#else
+#define coap_cache_invalidate(context, key)
+#endif
+
 /**
  * Sends a confirmed CoAP message to given destination. The memory
  * that is allocated by pdu will not be released by
@@ -131,6 +131,37 @@ int mdnsd_get_hostname(char *hostname_result);
 int mdnsd_register_service(const char *instance, const char *type,
 				uint16_t port, const char *hostname, const char *txt[]);
 
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+/**
+ * @brief mdnsd_browse_start() starts browsing the services of a type in the background.
+ *
+ * @param[in] service_type mdns service type string
+ * @return On success, 0 is returned. On failure, a negative value is returned.
+ *
+ */
+int mdnsd_browse_start(const char *service_type);
+
+/**
+ * @brief mdnsd_browse_get() gets the services of a browsed type from the cache, without waiting.
+ *
+ * @param[in] service_type mdns service type string
+ * @param[out] service_list the array of service list
+ * @param[out] num_of_services number of services, 0 if none is known yet
+ * @return On success, 0 is returned. On failure, a negative value is returned.
+ *
+ */
+int mdnsd_browse_get(const char *service_type, struct mdns_service_info **service_list, int *num_of_services);
+
+/**
+ * @brief mdnsd_browse_stop() stops browsing the services of a type.
+ *
+ * @param[in] service_type mdns service type string
+ * @return On success, 0 is returned. On failure, a negative value is returned.
+ *
+ */
+int mdnsd_browse_stop(const char *service_type);
+#endif /* CONFIG_NETUTILS_MDNS_CACHE */
+
 #endif /* CONFIG_NETUTILS_MDNS_RESPONDER_SUPPORT */
 
 /**
@@ -89,6 +89,15 @@
 typedef struct http_client_response_t *httprsp;
 typedef void (*wget_callback_t)(httprsp);
 
+struct http_client_request_t;
+
+/**
+ * @brief Called once when a request sent through the connection pool is
+ *        finished, with OK(0) or a negative value. The request may be
+ *        released from then on.
+ */
+typedef void (*wget_done_callback_t)(struct http_client_request_t *request, int result);
+
 #ifdef CONFIG_NET_SECURITY_TLS
 /**
  * @brief HTTP client TLS structure.
@@ -217,6 +226,42 @@ int http_client_response_init(struct http_client_response_t *response);
 
 void http_client_response_release(struct http_client_response_t *response);
 
+#ifdef CONFIG_WEBCLIENT_POOL
+/**
+ * @brief http_client_send_request_pool() queues the HTTP request to be sent
+ *                                        over a connection of the pool.
+ *
+ * Connections are kept open per origin (scheme, host and port) after the
+ * request, and later requests to the same origin reuse them instead of
+ * connecting and handshaking again. Over TLS, HTTP/2 is negotiated with
+ * ALPN when CONFIG_WEBCLIENT_POOL_HTTP2 is enabled, and concurrent requests
+ * to the origin then share one connection. Otherwise HTTP/1.1 keep-alive
+ * connections carry one request at a time.
+ * The TLS configuration of the request which opened a connection is used
+ * for the connection. The entity is sent with a Content-Length, whatever
+ * the encoding of the request.
+ *
+ * @param[in] request a structure pointer of information of request. It must
+ *                    be kept until done is called.
+ * @param[in] ssl_config a structure pointer of information of TLS config.
+ * @param[in] cb a function pointer called with each part of the entity of
+ *               the response, as with http_client_send_request_async().
+ * @param[in] done a function pointer called when the request is finished.
+ * @return On success, OK(0) is returned.
+ *         On failure, negative value is returned.
+ * @since TizenRT v4.1
+ */
+int http_client_send_request_pool(struct http_client_request_t *request, void *ssl_config, wget_callback_t cb, wget_done_callback_t done);
+
+/**
+ * @brief http_client_pool_close() closes the connections of the pool which
+ *                                 have no request in progress.
+ * @return N/A.
+ * @since TizenRT v4.1
+ */
+void http_client_pool_close(void);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -182,6 +182,20 @@
  */
 #define websocket_frame_t                            struct wslay_event_msg
 
+/**
+ * @brief Websocket structure wrapper to send a message from several buffers.
+ *
+@verbatim
+	The original structure of websocket_frame_vec_t :
+		struct wslay_event_msgv {
+			uint8_t opcode;                 //operation code
+			const struct iovec *iov;        //buffers of the message
+			int iovcnt;                     //number of buffers
+		};
+@endverbatim
+ */
+#define websocket_frame_vec_t                        struct wslay_event_msgv
+
 /**
  * @brief Websocket structure wrapper to send a fragmented frame.
  *
@@ -386,6 +400,8 @@ typedef struct {
 ///< Websocket event handler thread ID
 	pthread_attr_t thread_attr;
 ///< Websocket event handler thread attribute
+	int no_buffering;
+///< If set, the payloads of the data frames are only given to recv_chunk callback, from the receive buffer
 } websocket_t;
 
 /**
@@ -504,6 +520,17 @@ websocket_return_t websocket_register_cb(websocket_t *websocket, websocket_cb_t
  */
 websocket_return_t websocket_queue_msg(websocket_t *websocket, websocket_frame_t *tx_frame);
 
+/**
+ * @brief websocket_queue_msgv() queues a message made of several buffers into websocket context.
+ *
+ *        The buffers are copied once into the queued message, so they may be reused at return.
+ * @param[in] websocket websocket structure manages websocket context.
+ * @param[in] tx_frame opcode and buffers of the message to be sent
+ * @return On success return WEBSOCKET_SUCCESS, On failure return values defined in websocket_return_t
+ * @since TizenRT v5.0
+ */
+websocket_return_t websocket_queue_msgv(websocket_t *websocket, websocket_frame_vec_t *tx_frame);
+
 /**
  * @brief websocket_queue_ping() is used to send a websocket ping message.
  *
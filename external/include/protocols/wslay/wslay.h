@@ -45,6 +45,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 
 #ifdef __cplusplus
 #define EXTERN extern "C"
@@ -552,6 +553,23 @@ int wslay_event_queue_msg(wslay_event_context_ptr ctx, const struct wslay_event_
  */
 int wslay_event_queue_msg_ex(wslay_event_context_ptr ctx, const struct wslay_event_msg *arg, uint8_t rsv);
 
+struct wslay_event_msgv {
+	uint8_t opcode;
+	const struct iovec *iov;
+	int iovcnt;
+};
+
+/*
+ * Queues the message made of the iovcnt buffers of iov, as
+ * wslay_event_queue_msg() does. The buffers are copied once, straight
+ * into the queued message, so the application does not need to join
+ * them first.
+ *
+ * wslay_event_queue_msgv() returns 0 if it succeeds, or the negative
+ * error codes of wslay_event_queue_msg().
+ */
+int wslay_event_queue_msgv(wslay_event_context_ptr ctx, const struct wslay_event_msgv *arg);
+
 /*
  * Specify "source" to generate message.
  */
@@ -557,9 +557,11 @@ iotjs_jval_t iotjs_jhelper_eval(const char* name, size_t name_len,
 
 #ifdef ENABLE_SNAPSHOT
 iotjs_jval_t iotjs_jhelper_exec_snapshot(const void* snapshot_p,
-                                         size_t snapshot_size, bool* throws) {
-  jerry_value_t res = jerry_exec_snapshot(snapshot_p, snapshot_size, false);
-  /* the snapshot buffer can be referenced
+                                         size_t snapshot_size,
+                                         bool copy_bytecode, bool* throws) {
+  jerry_value_t res =
+      jerry_exec_snapshot(snapshot_p, snapshot_size, copy_bytecode);
+  /* without copy_bytecode, the snapshot buffer can be referenced
    * until jerry_cleanup is not called */
 
   *throws = jerry_value_has_error_flag(res);
@@ -193,9 +193,11 @@ iotjs_jval_t iotjs_jhelper_eval(const char* name, size_t name_len,
                                 const uint8_t* data, size_t size,
                                 bool strict_mode, bool* throws);
 #ifdef ENABLE_SNAPSHOT
-// Evaluates javascript snapshot.
+// Evaluates javascript snapshot.  Without copy_bytecode, the snapshot must
+// stay in place until the engine is cleaned up.
 iotjs_jval_t iotjs_jhelper_exec_snapshot(const void* snapshot_p,
-                                         size_t snapshot_size, bool* throws);
+                                         size_t snapshot_size,
+                                         bool copy_bytecode, bool* throws);
 #endif
 
 
@@ -19,6 +19,20 @@
 
 #include <stdlib.h>
 
+#ifdef ENABLE_SNAPSHOT
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__TIZENRT__)
+#include <sys/mman.h>
+#endif
+
+// A module 'path' may come with a snapshot 'path.snapshot', made at build
+// time from the wrapped source by the snapshot tool of JerryScript.
+#define IOTJS_SNAPSHOT_SUFFIX ".snapshot"
+#endif
+
 
 JHANDLER_FUNCTION(Binding) {
   DJHANDLER_CHECK_ARGS(1, number);
@@ -55,6 +69,75 @@ static iotjs_jval_t WrapEval(const char* name, size_t name_len,
 }
 
 
+#ifdef ENABLE_SNAPSHOT
+static int OpenModuleSnapshot(const char* filename, size_t* size) {
+  char path[IOTJS_MAX_PATH_SIZE];
+  struct stat st;
+
+  int len = snprintf(path, sizeof(path), "%s" IOTJS_SNAPSHOT_SUFFIX, filename);
+  if (len < 0 || (size_t)len >= sizeof(path)) {
+    return -1;
+  }
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return -1;
+  }
+
+  if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+    close(fd);
+    return -1;
+  }
+
+  *size = (size_t)st.st_size;
+  return fd;
+}
+
+
+// Runs the snapshot of a module, which evaluates to the same wrapper
+// function as WrapEval() would give.  A snapshot in romfs on XIP flash is
+// executed in place: its bytecode is neither copied nor kept in the heap.
+// Otherwise it is read into a buffer, whose bytecode the engine copies.
+static bool ExecModuleSnapshot(const char* filename, iotjs_jval_t* jres,
+                               bool* throws) {
+  size_t size;
+  int fd = OpenModuleSnapshot(filename, &size);
+  if (fd < 0) {
+    return false;
+  }
+
+#if defined(__TIZENRT__)
+  void* addr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (addr != MAP_FAILED && ((uintptr_t)addr & 3) == 0) {
+    close(fd);
+    *jres = iotjs_jhelper_exec_snapshot(addr, size, false, throws);
+    return true;
+  }
+#endif
+
+  char* buffer = iotjs_buffer_allocate(size);
+  size_t nread = 0;
+  while (nread < size) {
+    ssize_t ret = read(fd, buffer + nread, size - nread);
+    if (ret <= 0) {
+      break;
+    }
+    nread += (size_t)ret;
+  }
+  close(fd);
+
+  if (nread != size) {
+    iotjs_buffer_release(buffer);
+    return false;
+  }
+
+  *jres = iotjs_jhelper_exec_snapshot(buffer, size, true, throws);
+  iotjs_buffer_release(buffer);
+  return true;
+}
+#endif
+
+
 JHANDLER_FUNCTION(Compile) {
   DJHANDLER_CHECK_ARGS(2, string, string);
 
@@ -69,9 +152,14 @@ JHANDLER_FUNCTION(Compile) {
   }
 
   bool throws;
-  iotjs_jval_t jres =
-      WrapEval(filename, strlen(filename), iotjs_string_data(&source),
-               iotjs_string_size(&source), &throws);
+  iotjs_jval_t jres;
+#ifdef ENABLE_SNAPSHOT
+  if (!ExecModuleSnapshot(filename, &jres, &throws))
+#endif
+  {
+    jres = WrapEval(filename, strlen(filename), iotjs_string_data(&source),
+                    iotjs_string_size(&source), &throws);
+  }
 
   if (!throws) {
     iotjs_jhandler_return_jval(jhandler, &jres);
@@ -104,7 +192,8 @@ JHANDLER_FUNCTION(CompileNativePtr) {
     bool throws;
 #ifdef ENABLE_SNAPSHOT
     iotjs_jval_t jres = iotjs_jhelper_exec_snapshot(natives[i].code,
-                                                    natives[i].length, &throws);
+                                                    natives[i].length, false,
+                                                    &throws);
 #else
     iotjs_jval_t jres =
         WrapEval(name, iotjs_string_size(&id), (const char*)natives[i].code,
@@ -131,7 +220,21 @@ JHANDLER_FUNCTION(ReadSource) {
   DJHANDLER_CHECK_ARGS(1, string);
 
   iotjs_string_t path = JHANDLER_GET_ARG(0, string);
-  iotjs_string_t code = iotjs_file_read(iotjs_string_data(&path));
+  iotjs_string_t code;
+
+#ifdef ENABLE_SNAPSHOT
+  // The source of a module with a snapshot is not needed by Compile, so it
+  // is not read into the heap.
+  size_t size;
+  int fd = OpenModuleSnapshot(iotjs_string_data(&path), &size);
+  if (fd >= 0) {
+    close(fd);
+    code = iotjs_string_create();
+  } else
+#endif
+  {
+    code = iotjs_file_read(iotjs_string_data(&path));
+  }
 
   iotjs_jhandler_return_string(jhandler, &code);
 
@@ -192,6 +192,8 @@ static cJSON *cJSON_New_Item(const internal_hooks * const hooks)
     return node;
 }
 
+static void delete_arena(cJSON *item);
+
 /* Delete a cJSON structure. */
 CJSON_PUBLIC(void) cJSON_Delete(cJSON *item)
 {
@@ -199,6 +201,20 @@ CJSON_PUBLIC(void) cJSON_Delete(cJSON *item)
     while (item != NULL)
     {
         next = item->next;
+        if (item->type & cJSON_InArena)
+        {
+            /* Only the items added to the document are freed one by one */
+            if (!(item->type & cJSON_IsReference) && (item->child != NULL))
+            {
+                delete_arena(item->child);
+            }
+            if (item->type & cJSON_ArenaOwner)
+            {
+                global_hooks.deallocate(item);
+            }
+            item = next;
+            continue;
+        }
         if (!(item->type & cJSON_IsReference) && (item->child != NULL))
         {
             cJSON_Delete(item->child);
@@ -216,6 +232,25 @@ CJSON_PUBLIC(void) cJSON_Delete(cJSON *item)
     }
 }
 
+/* The items of a document in an arena, which cJSON_Delete frees with the items added to it */
+static void delete_arena(cJSON *item)
+{
+    cJSON *next = NULL;
+    while (item != NULL)
+    {
+        next = item->next;
+        if (!(item->type & cJSON_InArena))
+        {
+            item->next = NULL;
+            cJSON_Delete(item);
+        }
+        else if (!(item->type & cJSON_IsReference) && (item->child != NULL))
+        {
+            delete_arena(item->child);
+        }
+        item = next;
+    }
+}
 
 typedef struct
 {
@@ -224,8 +259,62 @@ typedef struct
     size_t offset;
     size_t depth; /* How deeply nested (in arrays/objects) is the input at the current offset. */
     internal_hooks hooks;
+    unsigned char *arena; /* Block of the document for cJSON_ParseWithArena, or NULL */
+    size_t arena_size;
+    size_t arena_offset;
 } parse_buffer;
 
+/* Arena allocations are aligned for the doubles of the nodes. */
+#define arena_align(size) (((size) + 7) & ~(size_t)7)
+
+/* Allocations of the parser, from the arena of the document when it has one. */
+static void *parse_allocate(parse_buffer * const buffer, size_t size)
+{
+    void *pointer = NULL;
+
+    if (buffer->arena == NULL)
+    {
+        return buffer->hooks.allocate(size);
+    }
+
+    size = arena_align(size);
+    if (size > buffer->arena_size - buffer->arena_offset)
+    {
+        return NULL;
+    }
+
+    pointer = buffer->arena + buffer->arena_offset;
+    buffer->arena_offset += size;
+    return pointer;
+}
+
+static void parse_deallocate(parse_buffer * const buffer, void *pointer)
+{
+    if (buffer->arena == NULL)
+    {
+        buffer->hooks.deallocate(pointer);
+    }
+}
+
+static cJSON *parse_new_item(parse_buffer * const buffer)
+{
+    cJSON *node = (cJSON*)parse_allocate(buffer, sizeof(cJSON));
+    if (node)
+    {
+        memset(node, '\0', sizeof(cJSON));
+    }
+
+    return node;
+}
+
+static void parse_delete(parse_buffer * const buffer, cJSON *item)
+{
+    if (buffer->arena == NULL)
+    {
+        cJSON_Delete(item);
+    }
+}
+
 /* check if the given size is left to read in a given parse buffer (starting with 1) */
 #define can_read(buffer, size) ((buffer != NULL) && (((buffer)->offset + size) <= (buffer)->length))
 #define cannot_read(buffer, size) (!can_read(buffer, size))
@@ -707,7 +796,7 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
 
         /* This is at most how much we need for the output */
         allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
-        output = (unsigned char*)input_buffer->hooks.allocate(allocation_length + sizeof(""));
+        output = (unsigned char*)parse_allocate(input_buffer, allocation_length + sizeof(""));
         if (output == NULL)
         {
             goto fail; /* allocation failure */
@@ -785,7 +874,7 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
 fail:
     if (output != NULL)
     {
-        input_buffer->hooks.deallocate(output);
+        parse_deallocate(input_buffer, output);
     }
 
     if (input_pointer != NULL)
@@ -1041,6 +1130,129 @@ CJSON_PUBLIC(cJSON *) cJSON_Parse(const char *value)
     return cJSON_ParseWithOpts(value, 0, 0);
 }
 
+/* Size of the arena of a document, from the allocations the parser will do:
+ * a node for the root and for each element of the arrays and objects, and
+ * the strings and keys as parse_string sizes them. */
+static size_t arena_measure(const unsigned char *json)
+{
+    const unsigned char *start = NULL;
+    size_t nodes = 1;
+    size_t strings = 0;
+    size_t escapes = 0;
+    unsigned char last = '\0';
+
+    for (; *json != '\0'; json++)
+    {
+        switch (*json)
+        {
+            case '\"':
+                start = json;
+                escapes = 0;
+                for (json++; (*json != '\0') && (*json != '\"'); json++)
+                {
+                    if (*json == '\\')
+                    {
+                        if (json[1] == '\0')
+                        {
+                            return 0;
+                        }
+                        escapes++;
+                        json++;
+                    }
+                }
+                if (*json == '\0')
+                {
+                    return 0;
+                }
+                strings += arena_align((size_t)(json - start) - escapes + sizeof(""));
+                break;
+
+            case ',':
+                nodes++;
+                break;
+
+            case ']':
+            case '}':
+                /* the first element of a non empty array or object */
+                if ((last != '[') && (last != '{'))
+                {
+                    nodes++;
+                }
+                break;
+
+            default:
+                if (*json <= 32)
+                {
+                    continue;
+                }
+                break;
+        }
+        last = *json;
+    }
+
+    return nodes * arena_align(sizeof(cJSON)) + strings;
+}
+
+/* Flag the items of a document in an arena */
+static void arena_mark(cJSON *item)
+{
+    while (item != NULL)
+    {
+        item->type |= cJSON_InArena | cJSON_StringIsConst;
+        arena_mark(item->child);
+        item = item->next;
+    }
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithArena(const char *value)
+{
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, 0, 0, 0 };
+    cJSON *item = NULL;
+
+    /* reset error position */
+    global_error.json = NULL;
+    global_error.position = 0;
+
+    if (value == NULL)
+    {
+        return NULL;
+    }
+
+    buffer.content = (const unsigned char*)value;
+    buffer.length = strlen((const char*)value) + sizeof("");
+    buffer.offset = 0;
+    buffer.hooks = global_hooks;
+
+    buffer.arena_size = arena_measure(buffer.content);
+    if (buffer.arena_size == 0)
+    {
+        goto fail;
+    }
+
+    buffer.arena = (unsigned char*)global_hooks.allocate(buffer.arena_size);
+    if (buffer.arena == NULL)
+    {
+        return NULL;
+    }
+
+    /* the root is first, so that freeing it frees the arena */
+    item = parse_new_item(&buffer);
+    if (!parse_value(item, buffer_skip_whitespace(&buffer)))
+    {
+        global_hooks.deallocate(buffer.arena);
+        goto fail;
+    }
+
+    arena_mark(item);
+    item->type |= cJSON_ArenaOwner;
+    return item;
+
+fail:
+    global_error.json = (const unsigned char*)value;
+    global_error.position = (buffer.offset < buffer.length) ? buffer.offset : buffer.length - 1;
+    return NULL;
+}
+
 #define cjson_min(a, b) ((a < b) ? a : b)
 
 static unsigned char *print(const cJSON * const item, cJSON_bool format, const internal_hooks * const hooks)
@@ -1338,7 +1550,7 @@ static cJSON_bool parse_array(cJSON * const item, parse_buffer * const input_buf
     do
     {
         /* allocate next item */
-        cJSON *new_item = cJSON_New_Item(&(input_buffer->hooks));
+        cJSON *new_item = parse_new_item(input_buffer);
         if (new_item == NULL)
         {
             goto fail; /* allocation failure */
@@ -1387,7 +1599,7 @@ success:
 fail:
     if (head != NULL)
     {
-        cJSON_Delete(head);
+        parse_delete(input_buffer, head);
     }
 
     return false;
@@ -1492,7 +1704,7 @@ static cJSON_bool parse_object(cJSON * const item, parse_buffer * const input_bu
     do
     {
         /* allocate next item */
-        cJSON *new_item = cJSON_New_Item(&(input_buffer->hooks));
+        cJSON *new_item = parse_new_item(input_buffer);
         if (new_item == NULL)
         {
             goto fail; /* allocation failure */
@@ -1558,7 +1770,7 @@ success:
 fail:
     if (head != NULL)
     {
-        cJSON_Delete(head);
+        parse_delete(input_buffer, head);
     }
 
     return false;
@@ -1803,6 +2015,7 @@ static cJSON *create_reference(const cJSON *item, const internal_hooks * const h
     memcpy(reference, item, sizeof(cJSON));
     reference->string = NULL;
     reference->type |= cJSON_IsReference;
+    reference->type &= ~(cJSON_InArena | cJSON_ArenaOwner);
     reference->next = reference->prev = NULL;
     return reference;
 }
@@ -2359,7 +2572,12 @@ CJSON_PUBLIC(cJSON *) cJSON_Duplicate(const cJSON *item, cJSON_bool recurse)
         goto fail;
     }
     /* Copy over all vars */
-    newitem->type = item->type & (~cJSON_IsReference);
+    newitem->type = item->type & (~(cJSON_IsReference | cJSON_InArena | cJSON_ArenaOwner));
+    if (item->type & cJSON_InArena)
+    {
+        /* the key is in the arena of the original */
+        newitem->type &= ~cJSON_StringIsConst;
+    }
     newitem->valueint = item->valueint;
     newitem->valuedouble = item->valuedouble;
     if (item->valuestring)
@@ -2372,7 +2590,7 @@ CJSON_PUBLIC(cJSON *) cJSON_Duplicate(const cJSON *item, cJSON_bool recurse)
     }
     if (item->string)
     {
-        newitem->string = (item->type&cJSON_StringIsConst) ? item->string : (char*)cJSON_strdup((unsigned char*)item->string, &global_hooks);
+        newitem->string = (newitem->type&cJSON_StringIsConst) ? item->string : (char*)cJSON_strdup((unsigned char*)item->string, &global_hooks);
         if (!newitem->string)
         {
             goto fail;
@@ -0,0 +1,816 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * external/json/json_stream.c
+ *
+ * The parser is a state machine fed with bytes: the syntax state tells
+ * what may come next between the tokens, and the token state follows a
+ * string, a number or a literal across the pieces of the text.  The runs
+ * of plain characters of the strings are copied at once.
+ *
+ * The writer puts the tokens in its buffer and keeps track of the commas.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+#include <json/json_stream.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* What may come next, between the tokens */
+
+#define JSON_EXPECT_VALUE			0	/* The document, after ':', after ',' in an array */
+#define JSON_EXPECT_VALUE_OR_END	1	/* After '[' */
+#define JSON_EXPECT_KEY				2	/* After ',' in an object */
+#define JSON_EXPECT_KEY_OR_END		3	/* After '{' */
+#define JSON_EXPECT_COLON			4
+#define JSON_EXPECT_COMMA_OR_END	5
+#define JSON_EXPECT_NOTHING			6	/* After the document */
+
+/* Token in progress */
+
+#define JSON_TOKEN_NONE				0
+#define JSON_TOKEN_STRING			1
+#define JSON_TOKEN_KEY				2
+#define JSON_TOKEN_NUMBER			3
+#define JSON_TOKEN_TRUE				4
+#define JSON_TOKEN_FALSE			5
+#define JSON_TOKEN_NULL				6
+
+/* Progress of an escape in a string: none, after '\', then 4 hex digits */
+
+#define JSON_ESCAPE_NONE			0
+#define JSON_ESCAPE_START			1
+#define JSON_ESCAPE_HEX_END			6
+
+#define JSON_CALLBACK(p, cb, ...)	((p)->sax->cb ? (p)->sax->cb((p)->arg, ##__VA_ARGS__) : 0)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *const g_json_literals[] = {
+	"true", "false", "null"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static int json_append(struct json_parser_s *p, const char *data, size_t len)
+{
+	/* One byte is left for the terminator */
+
+	if (len >= p->bufsize - p->len) {
+		return -E2BIG;
+	}
+
+	memcpy(p->buf + p->len, data, len);
+	p->len += len;
+	return 0;
+}
+
+static int json_append_utf8(struct json_parser_s *p, uint32_t code)
+{
+	char utf8[4];
+	size_t len;
+
+	if (code < 0x80) {
+		utf8[0] = (char)code;
+		len = 1;
+	} else if (code < 0x800) {
+		utf8[0] = (char)(0xc0 | (code >> 6));
+		utf8[1] = (char)(0x80 | (code & 0x3f));
+		len = 2;
+	} else if (code < 0x10000) {
+		utf8[0] = (char)(0xe0 | (code >> 12));
+		utf8[1] = (char)(0x80 | ((code >> 6) & 0x3f));
+		utf8[2] = (char)(0x80 | (code & 0x3f));
+		len = 3;
+	} else {
+		utf8[0] = (char)(0xf0 | (code >> 18));
+		utf8[1] = (char)(0x80 | ((code >> 12) & 0x3f));
+		utf8[2] = (char)(0x80 | ((code >> 6) & 0x3f));
+		utf8[3] = (char)(0x80 | (code & 0x3f));
+		len = 4;
+	}
+
+	return json_append(p, utf8, len);
+}
+
+/* The value which ended is followed by a comma or the end of its array or
+ * object, or by nothing at the top.
+ */
+
+static void json_value_end(struct json_parser_s *p)
+{
+	p->state = p->depth == 0 ? JSON_EXPECT_NOTHING : JSON_EXPECT_COMMA_OR_END;
+}
+
+static int json_push(struct json_parser_s *p, bool object)
+{
+	if (p->depth >= JSON_STREAM_MAX_DEPTH) {
+		return -E2BIG;
+	}
+
+	if (object) {
+		p->objects |= (uint32_t)1 << p->depth;
+	} else {
+		p->objects &= ~((uint32_t)1 << p->depth);
+	}
+	p->depth++;
+
+	if (object) {
+		p->state = JSON_EXPECT_KEY_OR_END;
+		return JSON_CALLBACK(p, object_start);
+	}
+
+	p->state = JSON_EXPECT_VALUE_OR_END;
+	return JSON_CALLBACK(p, array_start);
+}
+
+static int json_pop(struct json_parser_s *p, char c)
+{
+	bool object = (p->objects >> (p->depth - 1)) & 1;
+
+	if (object != (c == '}')) {
+		return -EINVAL;
+	}
+
+	p->depth--;
+	json_value_end(p);
+
+	if (object) {
+		return JSON_CALLBACK(p, object_end);
+	}
+
+	return JSON_CALLBACK(p, array_end);
+}
+
+static int json_value_start(struct json_parser_s *p, char c)
+{
+	switch (c) {
+	case '{':
+		return json_push(p, true);
+	case '[':
+		return json_push(p, false);
+	case '"':
+		p->token = JSON_TOKEN_STRING;
+		p->count = JSON_ESCAPE_NONE;
+		p->len = 0;
+		return 0;
+	case 't':
+		p->token = JSON_TOKEN_TRUE;
+		p->count = 1;
+		return 0;
+	case 'f':
+		p->token = JSON_TOKEN_FALSE;
+		p->count = 1;
+		return 0;
+	case 'n':
+		p->token = JSON_TOKEN_NULL;
+		p->count = 1;
+		return 0;
+	default:
+		if (c == '-' || (c >= '0' && c <= '9')) {
+			p->token = JSON_TOKEN_NUMBER;
+			p->len = 0;
+			return json_append(p, &c, 1);
+		}
+		return -EINVAL;
+	}
+}
+
+static int json_string_end(struct json_parser_s *p)
+{
+	bool key = p->token == JSON_TOKEN_KEY;
+
+	if (p->surrogate) {
+		return -EINVAL;
+	}
+
+	p->buf[p->len] = '\0';
+	p->token = JSON_TOKEN_NONE;
+
+	if (key) {
+		p->state = JSON_EXPECT_COLON;
+		return JSON_CALLBACK(p, key, p->buf, p->len);
+	}
+
+	json_value_end(p);
+	return JSON_CALLBACK(p, string, p->buf, p->len);
+}
+
+static int json_number_end(struct json_parser_s *p)
+{
+	char *end;
+	double value;
+
+	p->buf[p->len] = '\0';
+	p->token = JSON_TOKEN_NONE;
+
+	value = strtod(p->buf, &end);
+	if (end != p->buf + p->len) {
+		return -EINVAL;
+	}
+
+	json_value_end(p);
+	return JSON_CALLBACK(p, number, value, p->buf);
+}
+
+static int json_hex(char c)
+{
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	} else if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	} else if (c >= 'A' && c <= 'F') {
+		return c - 'A' + 10;
+	}
+
+	return -1;
+}
+
+/* One character of an escape sequence of a string */
+
+static int json_escape(struct json_parser_s *p, char c)
+{
+	static const char escapes[] = "\"\"\\\\//b\bf\fn\nr\rt\t";
+	const char *e;
+	int hex;
+
+	if (p->count == JSON_ESCAPE_START) {
+		if (c == 'u') {
+			p->count++;
+			p->code = 0;
+			return 0;
+		}
+
+		if (p->surrogate) {
+			return -EINVAL;
+		}
+
+		for (e = escapes; *e; e += 2) {
+			if (*e == c) {
+				p->count = JSON_ESCAPE_NONE;
+				return json_append(p, e + 1, 1);
+			}
+		}
+
+		return -EINVAL;
+	}
+
+	hex = json_hex(c);
+	if (hex < 0) {
+		return -EINVAL;
+	}
+
+	p->code = (p->code << 4) | hex;
+	if (++p->count < JSON_ESCAPE_HEX_END) {
+		return 0;
+	}
+	p->count = JSON_ESCAPE_NONE;
+
+	/* The UTF-16 surrogate pairs make one code point */
+
+	if (p->code >= 0xdc00 && p->code <= 0xdfff) {
+		if (!p->surrogate) {
+			return -EINVAL;
+		}
+		p->code = 0x10000 + ((p->surrogate - 0xd800) << 10) + (p->code - 0xdc00);
+		p->surrogate = 0;
+	} else if (p->surrogate) {
+		return -EINVAL;
+	} else if (p->code >= 0xd800 && p->code <= 0xdbff) {
+		p->surrogate = p->code;
+		return 0;
+	}
+
+	return json_append_utf8(p, p->code);
+}
+
+/* A character between the tokens */
+
+static int json_syntax(struct json_parser_s *p, char c)
+{
+	switch (p->state) {
+	case JSON_EXPECT_VALUE_OR_END:
+		if (c == ']') {
+			return json_pop(p, c);
+		}
+		/* Fall through */
+
+	case JSON_EXPECT_VALUE:
+		return json_value_start(p, c);
+
+	case JSON_EXPECT_KEY_OR_END:
+		if (c == '}') {
+			return json_pop(p, c);
+		}
+		/* Fall through */
+
+	case JSON_EXPECT_KEY:
+		if (c != '"') {
+			return -EINVAL;
+		}
+		p->token = JSON_TOKEN_KEY;
+		p->count = JSON_ESCAPE_NONE;
+		p->len = 0;
+		return 0;
+
+	case JSON_EXPECT_COLON:
+		if (c != ':') {
+			return -EINVAL;
+		}
+		p->state = JSON_EXPECT_VALUE;
+		return 0;
+
+	case JSON_EXPECT_COMMA_OR_END:
+		if (c == ',') {
+			p->state = (p->objects >> (p->depth - 1)) & 1 ? JSON_EXPECT_KEY : JSON_EXPECT_VALUE;
+			return 0;
+		}
+
+		if (c == '}' || c == ']') {
+			return json_pop(p, c);
+		}
+		return -EINVAL;
+
+	default:
+		return -EINVAL;
+	}
+}
+
+/* Writer */
+
+static int json_put(struct json_writer_s *w, const char *data, size_t len)
+{
+	size_t n;
+	int ret;
+
+	if (w->error) {
+		return w->error;
+	}
+
+	while (len > 0) {
+		/* Without flush, a byte is left for the terminator */
+
+		n = w->size - w->len - (w->flush ? 0 : 1);
+		if (n == 0) {
+			if (!w->flush) {
+				w->error = -ENOSPC;
+				return w->error;
+			}
+
+			ret = w->flush(w->arg, w->buf, w->len);
+			if (ret < 0) {
+				w->error = ret;
+				return ret;
+			}
+			w->total += w->len;
+			w->len = 0;
+			continue;
+		}
+
+		if (n > len) {
+			n = len;
+		}
+
+		memcpy(w->buf + w->len, data, n);
+		w->len += n;
+		data += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+/* Separator before a value or a key */
+
+static int json_separate(struct json_writer_s *w)
+{
+	if (w->key) {
+		w->key = false;
+		return 0;
+	}
+
+	if (w->comma) {
+		return json_put(w, ",", 1);
+	}
+
+	return 0;
+}
+
+static int json_put_string(struct json_writer_s *w, const char *str)
+{
+	static const char hex[] = "0123456789abcdef";
+	const char *run;
+	char escape[6];
+	unsigned char c;
+	int ret;
+
+	ret = json_put(w, "\"", 1);
+
+	while (ret == 0 && *str != '\0') {
+		/* The run of characters which need no escape */
+
+		for (run = str; (unsigned char)*run >= 0x20 && *run != '"' && *run != '\\'; run++) {
+		}
+
+		if (run > str) {
+			ret = json_put(w, str, run - str);
+			str = run;
+			continue;
+		}
+
+		c = (unsigned char)*str++;
+		escape[0] = '\\';
+		switch (c) {
+		case '"':
+		case '\\':
+			escape[1] = c;
+			break;
+		case '\b':
+			escape[1] = 'b';
+			break;
+		case '\f':
+			escape[1] = 'f';
+			break;
+		case '\n':
+			escape[1] = 'n';
+			break;
+		case '\r':
+			escape[1] = 'r';
+			break;
+		case '\t':
+			escape[1] = 't';
+			break;
+		default:
+			memcpy(escape + 1, "u00", 3);
+			escape[4] = hex[c >> 4];
+			escape[5] = hex[c & 0xf];
+			ret = json_put(w, escape, 6);
+			continue;
+		}
+
+		ret = json_put(w, escape, 2);
+	}
+
+	if (ret == 0) {
+		ret = json_put(w, "\"", 1);
+	}
+
+	return ret;
+}
+
+static int json_open(struct json_writer_s *w, char c)
+{
+	int ret = json_separate(w);
+
+	if (ret == 0) {
+		ret = json_put(w, &c, 1);
+	}
+
+	w->depth++;
+	w->comma = false;
+	return ret;
+}
+
+static int json_close(struct json_writer_s *w, char c)
+{
+	if (w->depth == 0 || w->key) {
+		w->error = -EINVAL;
+		return w->error;
+	}
+
+	w->depth--;
+	w->comma = true;
+	return json_put(w, &c, 1);
+}
+
+static int json_scalar(struct json_writer_s *w, const char *text, size_t len)
+{
+	int ret = json_separate(w);
+
+	if (ret == 0) {
+		ret = json_put(w, text, len);
+	}
+
+	w->comma = true;
+	return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+void json_parser_init(struct json_parser_s *parser, const struct json_sax_s *sax, void *arg, char *buf, size_t bufsize)
+{
+	memset(parser, 0, sizeof(struct json_parser_s));
+	parser->sax = sax;
+	parser->arg = arg;
+	parser->buf = buf;
+	parser->bufsize = bufsize;
+	parser->state = JSON_EXPECT_VALUE;
+}
+
+int json_parser_feed(struct json_parser_s *parser, const char *data, size_t len)
+{
+	struct json_parser_s *p = parser;
+	const char *end = data + len;
+	const char *run;
+	const char *literal;
+	char c;
+	int ret = 0;
+
+	if (p->error) {
+		return p->error;
+	}
+
+	while (ret == 0 && data < end) {
+		c = *data;
+
+		switch (p->token) {
+		case JSON_TOKEN_STRING:
+		case JSON_TOKEN_KEY:
+			if (p->count != JSON_ESCAPE_NONE) {
+				ret = json_escape(p, c);
+				data++;
+				continue;
+			}
+
+			for (run = data; run < end && (unsigned char)*run >= 0x20 && *run != '"' && *run != '\\'; run++) {
+			}
+
+			if (run > data) {
+				ret = p->surrogate ? -EINVAL : json_append(p, data, run - data);
+				data = run;
+			} else if (c == '"') {
+				ret = json_string_end(p);
+				data++;
+			} else if (c == '\\') {
+				p->count = JSON_ESCAPE_START;
+				data++;
+			} else {
+				/* Control characters must be escaped */
+
+				ret = -EINVAL;
+			}
+			continue;
+
+		case JSON_TOKEN_NUMBER:
+			if ((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+				ret = json_append(p, &c, 1);
+				data++;
+				continue;
+			}
+
+			/* The character after the number is between the tokens */
+
+			ret = json_number_end(p);
+			if (ret != 0) {
+				continue;
+			}
+			break;
+
+		case JSON_TOKEN_TRUE:
+		case JSON_TOKEN_FALSE:
+		case JSON_TOKEN_NULL:
+			literal = g_json_literals[p->token - JSON_TOKEN_TRUE];
+			if (c != literal[p->count]) {
+				ret = -EINVAL;
+				continue;
+			}
+
+			data++;
+			if (literal[++p->count] == '\0') {
+				json_value_end(p);
+				if (p->token == JSON_TOKEN_NULL) {
+					ret = JSON_CALLBACK(p, null);
+				} else {
+					ret = JSON_CALLBACK(p, boolean, p->token == JSON_TOKEN_TRUE);
+				}
+				p->token = JSON_TOKEN_NONE;
+			}
+			continue;
+
+		default:
+			break;
+		}
+
+		data++;
+		if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+			continue;
+		}
+
+		ret = json_syntax(p, c);
+	}
+
+	p->error = ret;
+	return ret;
+}
+
+int json_parser_finish(struct json_parser_s *parser)
+{
+	if (parser->error) {
+		return parser->error;
+	}
+
+	if (parser->token == JSON_TOKEN_NUMBER) {
+		parser->error = json_number_end(parser);
+		if (parser->error) {
+			return parser->error;
+		}
+	}
+
+	if (parser->token != JSON_TOKEN_NONE || parser->state != JSON_EXPECT_NOTHING) {
+		parser->error = -EINVAL;
+	}
+
+	return parser->error;
+}
+
+int json_parse(const char *json, size_t len, const struct json_sax_s *sax, void *arg, char *buf, size_t bufsize)
+{
+	struct json_parser_s parser;
+	int ret;
+
+	json_parser_init(&parser, sax, arg, buf, bufsize);
+	ret = json_parser_feed(&parser, json, len);
+	if (ret != 0) {
+		return ret;
+	}
+
+	return json_parser_finish(&parser);
+}
+
+void json_writer_init(struct json_writer_s *writer, char *buf, size_t size, json_flush_t flush, void *arg)
+{
+	memset(writer, 0, sizeof(struct json_writer_s));
+	writer->buf = buf;
+	writer->size = size;
+	writer->flush = flush;
+	writer->arg = arg;
+	if (size == 0) {
+		writer->error = -ENOSPC;
+	}
+}
+
+int json_writer_object_start(struct json_writer_s *writer)
+{
+	return json_open(writer, '{');
+}
+
+int json_writer_object_end(struct json_writer_s *writer)
+{
+	return json_close(writer, '}');
+}
+
+int json_writer_array_start(struct json_writer_s *writer)
+{
+	return json_open(writer, '[');
+}
+
+int json_writer_array_end(struct json_writer_s *writer)
+{
+	return json_close(writer, ']');
+}
+
+int json_writer_key(struct json_writer_s *writer, const char *key)
+{
+	int ret;
+
+	if (writer->key || writer->depth == 0) {
+		writer->error = -EINVAL;
+		return writer->error;
+	}
+
+	ret = json_separate(writer);
+	if (ret == 0) {
+		ret = json_put_string(writer, key);
+	}
+	if (ret == 0) {
+		ret = json_put(writer, ":", 1);
+	}
+
+	writer->key = true;
+	return ret;
+}
+
+int json_writer_string(struct json_writer_s *writer, const char *str)
+{
+	int ret = json_separate(writer);
+
+	if (ret == 0) {
+		ret = json_put_string(writer, str);
+	}
+
+	writer->comma = true;
+	return ret;
+}
+
+int json_writer_int(struct json_writer_s *writer, int64_t value)
+{
+	char text[21];
+	char *digit = text + sizeof(text);
+	uint64_t magnitude = value < 0 ? -(uint64_t)value : (uint64_t)value;
+
+	do {
+		*--digit = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while (magnitude > 0);
+
+	if (value < 0) {
+		*--digit = '-';
+	}
+
+	return json_scalar(writer, digit, text + sizeof(text) - digit);
+}
+
+int json_writer_double(struct json_writer_s *writer, double value)
+{
+	char text[26];
+	int len;
+
+	/* JSON has no NaN and infinity */
+
+	if (isnan(value) || isinf(value)) {
+		return json_scalar(writer, "null", 4);
+	}
+
+	/* 15 digits when they give the value back, else 17 */
+
+	len = snprintf(text, sizeof(text), "%1.15g", value);
+	if (strtod(text, NULL) != value) {
+		len = snprintf(text, sizeof(text), "%1.17g", value);
+	}
+
+	return json_scalar(writer, text, len);
+}
+
+int json_writer_bool(struct json_writer_s *writer, bool value)
+{
+	return value ? json_scalar(writer, "true", 4) : json_scalar(writer, "false", 5);
+}
+
+int json_writer_null(struct json_writer_s *writer)
+{
+	return json_scalar(writer, "null", 4);
+}
+
+int json_writer_finish(struct json_writer_s *writer)
+{
+	int ret;
+
+	if (writer->error) {
+		return writer->error;
+	}
+
+	if (writer->depth != 0 || writer->key) {
+		writer->error = -EINVAL;
+		return writer->error;
+	}
+
+	if (!writer->flush) {
+		writer->buf[writer->len] = '\0';
+		return (int)writer->len;
+	}
+
+	if (writer->len > 0) {
+		ret = writer->flush(writer->arg, writer->buf, writer->len);
+		if (ret < 0) {
+			writer->error = ret;
+			return ret;
+		}
+		writer->total += writer->len;
+		writer->len = 0;
+	}
+
+	return (int)writer->total;
+}
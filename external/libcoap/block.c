@@ -29,7 +29,11 @@
 #include <assert.h>
 #endif
 
+#include <limits.h>
+#include <string.h>
+
 #include <protocols/libcoap/debug.h>
+#include <protocols/libcoap/mem.h>
 #include <protocols/libcoap/block.h>
 
 #define min(a,b) ((a) < (b) ? (a) : (b))
@@ -153,4 +157,109 @@ int coap_add_block(coap_pdu_t *pdu, unsigned int len, const unsigned char *data,
 
 	return coap_add_data(pdu, min(len - start, (unsigned int)(1 << (block_szx + 4))), data + start);
 }
+
+void coap_block_window_init(coap_block_window_t *w, unsigned char szx, unsigned int window)
+{
+	memset(w, 0, sizeof(coap_block_window_t));
+	w->next_req = 1;
+	w->last = UINT_MAX;
+	w->szx = szx;
+	w->window = window < 1 ? 1 : min(window, COAP_BLOCK_WINDOW_MAX);
+}
+
+int coap_block_window_next(coap_block_window_t *w, unsigned int *num)
+{
+	/* one request until the first block gives the size of the blocks */
+	unsigned int window = w->next_out ? w->window : 1;
+
+	if (w->next_req > w->last || w->next_req - w->next_out >= window) {
+		return 0;
+	}
+
+	*num = w->next_req++;
+	return 1;
+}
+
+/* Hands the blocks which are now in order to the handler */
+static int coap_block_window_flush(coap_block_window_t *w, coap_block_handler_t handler, void *arg)
+{
+	unsigned int slot;
+
+	for (;;) {
+		slot = w->next_out % COAP_BLOCK_WINDOW_MAX;
+		if (w->next_out > w->last || !w->data[slot]) {
+			break;
+		}
+
+		handler(arg, w->next_out, w->data[slot], w->length[slot]);
+		coap_free(w->data[slot]);
+		w->data[slot] = NULL;
+		w->next_out++;
+	}
+
+	return w->next_out > w->last;
+}
+
+int coap_block_window_recv(coap_block_window_t *w, const coap_block_t *block, const unsigned char *data, size_t length, coap_block_handler_t handler, void *arg)
+{
+	unsigned int slot;
+
+	if (w->next_out == 0 && w->next_req <= 1) {
+		/* the server may answer the first request with smaller blocks */
+		w->szx = block->szx;
+	} else if (block->szx != w->szx) {
+		debug("coap_block_window_recv: block size changed to %u\n", block->szx);
+		return -1;
+	}
+
+	if (block->num < w->next_out || block->num >= w->next_req || block->num > w->last) {
+		return w->next_out > w->last;
+	}
+
+	if (!block->m) {
+		w->last = block->num;
+	}
+
+	if (block->num == w->next_out) {
+		handler(arg, block->num, data, length);
+		w->next_out++;
+		return coap_block_window_flush(w, handler, arg);
+	}
+
+	slot = block->num % COAP_BLOCK_WINDOW_MAX;
+	if (!w->data[slot]) {
+		w->data[slot] = coap_malloc(length ? length : 1);
+		if (!w->data[slot]) {
+			return -1;
+		}
+
+		memcpy(w->data[slot], data, length);
+		w->length[slot] = length;
+	}
+
+	return 0;
+}
+
+int coap_block_window_end(coap_block_window_t *w, unsigned int num)
+{
+	if (num == 0 || num < w->next_out) {
+		return -1;
+	}
+
+	if (num <= w->last) {
+		w->last = num - 1;
+	}
+
+	return w->next_out > w->last;
+}
+
+void coap_block_window_free(coap_block_window_t *w)
+{
+	int i;
+
+	for (i = 0; i < COAP_BLOCK_WINDOW_MAX; i++) {
+		coap_free(w->data[i]);
+		w->data[i] = NULL;
+	}
+}
 #endif							/* WITHOUT_BLOCK  */
@@ -492,6 +492,9 @@ void coap_free_context(coap_context_t *context)
 	coap_resource_t *rtmp;
 #endif
 #endif							/* WITH_POSIX || WITH_LWIP */
+#ifdef COAP_RESPONSE_CACHE
+	int i;
+#endif
 	if (!context) {
 		return;
 	}
@@ -499,6 +502,12 @@ void coap_free_context(coap_context_t *context)
 	coap_delete_all(context->recvqueue);
 	coap_delete_all(context->sendqueue);
 
+#ifdef COAP_RESPONSE_CACHE
+	for (i = 0; i < COAP_RESPONSE_CACHE; i++) {
+		coap_free(context->cache[i].bytes);
+	}
+#endif
+
 #ifdef WITH_LWIP
 	context->sendqueue = NULL;
 	coap_retransmittimer_restart(context);
@@ -1568,6 +1577,120 @@ error:
 #define WANT_WKC(Pdu,Key)                   \
 	(((Pdu)->transport_hdr->udp.code == COAP_REQUEST_GET) && is_wkc(Key))
 
+#ifdef COAP_RESPONSE_CACHE
+/* The key of a request to a cacheable resource: its options, which hold
+ * the URI, the query, Accept and Block2 among others */
+static int coap_cache_request_key(coap_pdu_t *request, coap_key_t key)
+{
+	coap_opt_iterator_t opt_iter;
+	coap_opt_t *option;
+	unsigned char type;
+
+	memset(key, 0, sizeof(coap_key_t));
+
+	coap_option_iterator_init2(request, &opt_iter, COAP_OPT_ALL, COAP_UDP);
+	while ((option = coap_option_next(&opt_iter))) {
+		/* a registration has to reach the handler */
+		if (opt_iter.type == COAP_OPTION_OBSERVE) {
+			return 0;
+		}
+
+		type = (unsigned char)opt_iter.type;
+		coap_hash(&type, 1, key);
+		coap_hash(COAP_OPT_VALUE(option), COAP_OPT_LENGTH(option), key);
+	}
+
+	return 1;
+}
+
+static void coap_cache_drop(coap_cache_entry_t *entry)
+{
+	coap_free(entry->bytes);
+	entry->bytes = NULL;
+}
+
+/* Fills the response, which holds its header and token, from the cache */
+static int coap_cache_lookup(coap_context_t *context, coap_resource_t *resource, const coap_key_t request, coap_pdu_t *response)
+{
+	coap_cache_entry_t *entry;
+	coap_tick_t now;
+	unsigned char *start;
+	int i;
+
+	coap_ticks(&now);
+	for (i = 0; i < COAP_RESPONSE_CACHE; i++) {
+		entry = &context->cache[i];
+		if (!entry->bytes || memcmp(entry->request, request, sizeof(coap_key_t)) || memcmp(entry->resource, resource->key, sizeof(coap_key_t))) {
+			continue;
+		}
+
+		if (now - entry->stored >= COAP_RESPONSE_CACHE_AGE * COAP_TICKS_PER_SECOND) {
+			coap_cache_drop(entry);
+			return 0;
+		}
+
+		if (response->length + entry->length > response->max_size) {
+			return 0;
+		}
+
+		start = (unsigned char *)response->transport_hdr + response->length;
+		memcpy(start, entry->bytes, entry->length);
+		response->transport_hdr->udp.code = entry->code;
+		response->length += entry->length;
+		response->max_delta = entry->max_delta;
+		response->data = entry->data_offset ? start + entry->data_offset : NULL;
+		return 1;
+	}
+
+	return 0;
+}
+
+static void coap_cache_store(coap_context_t *context, coap_resource_t *resource, const coap_key_t request, coap_pdu_t *response, size_t header_length)
+{
+	coap_cache_entry_t *entry = NULL;
+	unsigned char *start = (unsigned char *)response->transport_hdr + header_length;
+	int i;
+
+	for (i = 0; i < COAP_RESPONSE_CACHE; i++) {
+		if (!context->cache[i].bytes) {
+			entry = &context->cache[i];
+			break;
+		}
+	}
+
+	if (!entry) {
+		entry = &context->cache[context->cache_next];
+		context->cache_next = (context->cache_next + 1) % COAP_RESPONSE_CACHE;
+		coap_cache_drop(entry);
+	}
+
+	entry->length = response->length - header_length;
+	entry->bytes = coap_malloc(entry->length ? entry->length : 1);
+	if (!entry->bytes) {
+		return;
+	}
+
+	memcpy(entry->bytes, start, entry->length);
+	memcpy(entry->resource, resource->key, sizeof(coap_key_t));
+	memcpy(entry->request, request, sizeof(coap_key_t));
+	entry->code = response->transport_hdr->udp.code;
+	entry->max_delta = response->max_delta;
+	entry->data_offset = response->data ? response->data - start : 0;
+	coap_ticks(&entry->stored);
+}
+
+void coap_cache_invalidate(coap_context_t *context, const coap_key_t key)
+{
+	int i;
+
+	for (i = 0; i < COAP_RESPONSE_CACHE; i++) {
+		if (context->cache[i].bytes && !memcmp(context->cache[i].resource, key, sizeof(coap_key_t))) {
+			coap_cache_drop(&context->cache[i]);
+		}
+	}
+}
+#endif							/* COAP_RESPONSE_CACHE */
+
 void handle_request(coap_context_t *context, coap_queue_t *node)
 {
 	coap_method_handler_t h = NULL;
@@ -1660,8 +1783,33 @@ void handle_request(coap_context_t *context, coap_queue_t *node)
 		   if response == NULL */
 		if (coap_add_token(response, tokenLen, tokenStr)) {
 			str token = { tokenLen, tokenStr };
+#ifdef COAP_RESPONSE_CACHE
+			coap_key_t request_key;
+			int cache = 0;
+
+			if (context->protocol == COAP_PROTO_UDP || context->protocol == COAP_PROTO_DTLS) {
+				if (code != COAP_REQUEST_GET) {
+					coap_cache_invalidate(context, resource->key);
+				} else if (resource->cacheable && coap_cache_request_key(node->pdu, request_key)) {
+					cache = 1;
+				}
+			}
+
+			if (cache && coap_cache_lookup(context, resource, request_key, response)) {
+				debug("handle_request : response of resource 0x%02x%02x%02x%02x from the cache\n", key[0], key[1], key[2], key[3]);
+			} else {
+				size_t header_length = response->length;
+
+				h(context, resource, &node->remote, node->pdu, &token, response);
 
+				/* only a complete piggybacked or NON content response */
+				if (cache && response->transport_hdr->udp.code == COAP_RESPONSE_CODE(205)) {
+					coap_cache_store(context, resource, request_key, response, header_length);
+				}
+			}
+#else
 			h(context, resource, &node->remote, node->pdu, &token, response);
+#endif
 
 			switch(context->protocol) {
 			case COAP_PROTO_UDP:
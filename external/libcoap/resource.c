@@ -489,6 +489,8 @@ int coap_delete_resource(coap_context_t *context, coap_key_t key)
 		return 0;
 	}
 
+	coap_cache_invalidate(context, key);
+
 #if defined(WITH_POSIX) || defined(WITH_LWIP)
 #ifdef COAP_RESOURCES_NOHASH
 	LL_DELETE(context->resources, resource);
@@ -705,6 +707,30 @@ void coap_delete_observer(coap_resource_t *resource, const coap_address_t *obser
 	}
 }
 
+#ifdef COAP_OBSERVE_COALESCE
+/**
+ * Checks if a confirmable notification to the observer @p obs still
+ * waits for its ACK. A later one would only queue behind it, so the
+ * observer is left dirty and gets the latest state once it is acked.
+ */
+static int coap_notification_pending(coap_context_t *context, coap_subscription_t *obs)
+{
+	coap_queue_t *node;
+	coap_hdr_t *hdr;
+
+	for (node = context->sendqueue; node; node = node->next) {
+		hdr = node->pdu->hdr;
+		if (hdr->type == COAP_MESSAGE_CON && hdr->token_length == obs->token_length
+			&& memcmp(hdr->token, obs->token, obs->token_length) == 0
+			&& coap_address_equals(&node->remote, &obs->subscriber)) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+#endif							/* COAP_OBSERVE_COALESCE */
+
 static void coap_notify_observers(coap_context_t *context, coap_resource_t *r)
 {
 	coap_method_handler_t h;
@@ -713,6 +739,10 @@ static void coap_notify_observers(coap_context_t *context, coap_resource_t *r)
 	coap_pdu_t *response = NULL;
 	coap_pdu_t *tcp_resp = NULL;
 
+	if (r->dirty) {
+		coap_cache_invalidate(context, r->key);
+	}
+
 	if (r->observable && (r->dirty || r->partiallydirty)) {
 		r->partiallydirty = 0;
 
@@ -728,6 +758,15 @@ static void coap_notify_observers(coap_context_t *context, coap_resource_t *r)
 				continue;
 			}
 
+#ifdef COAP_OBSERVE_COALESCE
+			if ((context->protocol == COAP_PROTO_UDP || context->protocol == COAP_PROTO_DTLS)
+				&& coap_notification_pending(context, obs)) {
+				obs->dirty = 1;
+				r->partiallydirty = 1;
+				continue;
+			}
+#endif
+
 			coap_tid_t tid = COAP_INVALID_TID;
 			obs->dirty = 0;
 			/* initialize response */
@@ -38,6 +38,9 @@
 #include <string.h>
 
 #include <uv.h>
+#ifdef CONFIG_NET_EPOLL
+#include <sys/epoll.h>
+#endif
 
 //-----------------------------------------------------------------------------
 
@@ -51,6 +54,12 @@ void uv__platform_invalidate_fd(uv_loop_t *loop, int fd)
 			pfd->fd = -1;
 		}
 	}
+
+#ifdef CONFIG_NET_EPOLL
+	if (loop->backend_fd >= 0 && fd >= CONFIG_NFILE_DESCRIPTORS) {
+		epoll_ctl(loop->backend_fd, EPOLL_CTL_DEL, fd, NULL);
+	}
+#endif
 }
 
 int uv__nonblock(int fd, int set)
@@ -40,6 +40,9 @@
 #include <signal.h>
 #include <stdio.h>
 #include <sys/select.h>
+#ifdef CONFIG_NET_EPOLL
+#include <sys/epoll.h>
+#endif
 
 #include <uv.h>
 
@@ -78,6 +81,70 @@ static void uv__rem_pollfd(uv_loop_t *loop, struct pollfd *pe)
 	}
 }
 
+#ifdef CONFIG_NET_EPOLL
+/* Sockets are watched through the epoll instance of the loop, so that the
+ * stack queues the ready ones instead of poll() walking all of them. The
+ * epoll descriptor is polled along with the other descriptors.
+ */
+
+#define UV__EPOLL_NEVENTS 8
+
+static int uv__epoll_add(uv_loop_t *loop, uv__io_t *w)
+{
+	struct epoll_event e;
+	int op;
+
+	if (loop->backend_fd < 0 || w->fd < CONFIG_NFILE_DESCRIPTORS) {
+		return -1;
+	}
+
+	e.events = w->pevents;
+	e.data.fd = w->fd;
+	op = w->events == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+	if (epoll_ctl(loop->backend_fd, op, w->fd, &e) == 0) {
+		return 0;
+	}
+
+	/* The watcher was stopped and started again before its socket was
+	 * removed from the interest list.
+	 */
+
+	if (op == EPOLL_CTL_ADD && get_errno() == EEXIST) {
+		return epoll_ctl(loop->backend_fd, EPOLL_CTL_MOD, w->fd, &e);
+	}
+
+	return -1;
+}
+
+static int uv__epoll_dispatch(uv_loop_t *loop)
+{
+	struct epoll_event events[UV__EPOLL_NEVENTS];
+	uv__io_t *w;
+	int nevents = 0;
+	int nfd;
+	int fd;
+	int i;
+
+	nfd = epoll_wait(loop->backend_fd, events, UV__EPOLL_NEVENTS, 0);
+	for (i = 0; i < nfd; ++i) {
+		fd = events[i].data.fd;
+		w = (fd < (int)loop->nwatchers) ? loop->watchers[fd] : NULL;
+
+		/* Stopped watchers are removed lazily, as with the pollfds */
+
+		if (w == NULL) {
+			epoll_ctl(loop->backend_fd, EPOLL_CTL_DEL, fd, NULL);
+			continue;
+		}
+
+		w->cb(loop, w, events[i].events & (POLLIN | POLLOUT | POLLERR | POLLHUP));
+		++nevents;
+	}
+
+	return nevents;
+}
+#endif
+
 void uv__io_poll(uv_loop_t *loop, int timeout)
 {
 	struct pollfd pfd;
@@ -106,6 +173,13 @@ void uv__io_poll(uv_loop_t *loop, int timeout)
 		assert(w->fd >= 0);
 		assert(w->fd < (int)loop->nwatchers);
 
+#ifdef CONFIG_NET_EPOLL
+		if (uv__epoll_add(loop, w) == 0) {
+			w->events = w->pevents;
+			continue;
+		}
+#endif
+
 		pfd.fd = w->fd;
 		pfd.events = w->pevents;
 		uv__add_pollfd(loop, &pfd);
@@ -150,6 +224,16 @@ handle_poll:
 
 		for (i = 0; i < loop->npollfds; ++i) {
 			pe = &loop->pollfds[i];
+
+#ifdef CONFIG_NET_EPOLL
+			if (pe->fd >= 0 && pe->fd == loop->backend_fd) {
+				if (pe->revents & POLLIN) {
+					nevents += uv__epoll_dispatch(loop);
+				}
+				continue;
+			}
+#endif
+
 			w = loop->watchers[pe->fd];
 
 			if (w == NULL) {
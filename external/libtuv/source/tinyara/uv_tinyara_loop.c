@@ -35,10 +35,30 @@
  */
 
 #include <uv.h>
+#ifdef CONFIG_NET_EPOLL
+#include <sys/epoll.h>
+#endif
 
 int uv__platform_loop_init(uv_loop_t *loop)
 {
 	loop->npollfds = 0;
+
+#ifdef CONFIG_NET_EPOLL
+	/* Sockets are watched through epoll when it is available, poll() is
+	 * used for all descriptors otherwise.
+	 */
+
+	loop->backend_fd = epoll_create1(0);
+	if (loop->backend_fd >= 0) {
+		struct pollfd *pfd = &loop->pollfds[loop->npollfds++];
+		pfd->fd = loop->backend_fd;
+		pfd->events = POLLIN;
+		pfd->revents = 0;
+		pfd->sem = 0;
+		pfd->priv = 0;
+	}
+#endif
+
 	return 0;
 }
 
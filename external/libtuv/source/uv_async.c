@@ -102,11 +102,15 @@ int uv_async_send(uv_async_t *handle)
 
 int uv_async_deinit(uv_loop_t *loop, uv_async_t *handle)
 {
-	uv__async_stop(loop, &loop->async_watcher);
 	uv__handle_stop(handle);
 	QUEUE_REMOVE(&handle->queue);
 	QUEUE_INIT(&handle->queue);
 	uv__handle_deinit(handle);
 
+	/* Other async handles of the loop are woken up by the same watcher. */
+	if (QUEUE_EMPTY(&loop->async_handles)) {
+		uv__async_stop(loop, &loop->async_watcher);
+	}
+
 	return 0;
 }
@@ -0,0 +1,205 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <tinyara/seclink.h>
+#include <tinyara/security_hal.h>
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include <string.h>
+#include "mbedtls/platform.h"
+#include "mbedtls/platform_util.h"
+#include "mbedtls/error.h"
+#include "mbedtls/ecp.h"
+#include "mbedtls/alt/common.h"
+#include "mbedtls/alt/offload_alt.h"
+#include "alt_utils.h"
+
+#if defined(MBEDTLS_GCM_HW_OFFLOAD)
+#include "mbedtls/gcm.h"
+
+/*
+ * The key is put in the secure element once by mbedtls_gcm_setkey(), and
+ * a TLS record is then one seclink request, where the software path
+ * through the AES ALT module would make one request per block.
+ */
+struct gcm_hw_key {
+	sl_ctx shnd;
+	hal_key_type key_type;
+	uint32_t key_idx;
+};
+
+/* Errors returned before the hardware touched the data */
+static int _gcm_hw_unsupported(int ret)
+{
+	return ret == SECLINK_NOT_SUPPORTED || ret == SECLINK_NOT_IMPLEMENTED ||
+		   ret == SECLINK_NOT_INITIALIZED || ret == SECLINK_INVALID_ARGS ||
+		   ret == SECLINK_INVALID_REQUEST;
+}
+
+void mbedtls_gcm_hw_free(mbedtls_gcm_context *ctx)
+{
+	struct gcm_hw_key *hw = (struct gcm_hw_key *)ctx->MBEDTLS_PRIVATE(hw);
+
+	if (hw == NULL) {
+		return;
+	}
+
+	sl_remove_key(hw->shnd, hw->key_type, hw->key_idx);
+	sl_deinit(hw->shnd);
+	mbedtls_free(hw);
+	ctx->MBEDTLS_PRIVATE(hw) = NULL;
+}
+
+void mbedtls_gcm_hw_setkey(mbedtls_gcm_context *ctx, int cipher,
+						   const unsigned char *key, unsigned int keybits)
+{
+	hal_data aeskey = HAL_DATA_INITIALIZER;
+	struct gcm_hw_key *hw;
+	int key_idx;
+
+	mbedtls_gcm_hw_free(ctx);
+
+	if (cipher != MBEDTLS_CIPHER_ID_AES) {
+		return;
+	}
+
+	hw = mbedtls_calloc(1, sizeof(struct gcm_hw_key));
+	if (hw == NULL) {
+		return;
+	}
+
+	if (sl_init(&hw->shnd) != SECLINK_OK) {
+		mbedtls_free(hw);
+		return;
+	}
+
+	hw->key_type = keybits == 128 ? HAL_KEY_AES_128 : keybits == 192 ? HAL_KEY_AES_192 : HAL_KEY_AES_256;
+	aeskey.data = (void *)key;
+	aeskey.data_len = keybits >> 3;
+
+	key_idx = alt_set_key(hw->shnd, hw->key_type, &aeskey, NULL, 32);
+	if (key_idx < 0) {
+		sl_deinit(hw->shnd);
+		mbedtls_free(hw);
+		return;
+	}
+	hw->key_idx = key_idx;
+
+	ctx->MBEDTLS_PRIVATE(hw) = hw;
+}
+
+int mbedtls_gcm_hw_encrypt(mbedtls_gcm_context *ctx, size_t length,
+						   const unsigned char *iv, size_t iv_len,
+						   const unsigned char *add, size_t add_len,
+						   const unsigned char *input, unsigned char *output,
+						   size_t tag_len, unsigned char *tag)
+{
+	struct gcm_hw_key *hw = (struct gcm_hw_key *)ctx->MBEDTLS_PRIVATE(hw);
+	hal_data in = {(void *)input, length, NULL, 0};
+	hal_data out = {(void *)output, length, NULL, 0};
+	hal_gcm_param param = {HAL_GCM_AES, (unsigned char *)iv, iv_len, (unsigned char *)add, add_len, tag, tag_len};
+	int ret;
+
+	if (hw == NULL || length < CONFIG_TLS_HW_GCM_MIN_LEN) {
+		return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+	}
+
+	ret = sl_gcm_encrypt(hw->shnd, &in, &param, hw->key_idx, &out);
+	if (ret == SECLINK_OK) {
+		return 0;
+	}
+
+	if (_gcm_hw_unsupported(ret)) {
+		mbedtls_gcm_hw_free(ctx);
+		return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+	}
+
+	return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+}
+
+int mbedtls_gcm_hw_decrypt(mbedtls_gcm_context *ctx, size_t length,
+						   const unsigned char *iv, size_t iv_len,
+						   const unsigned char *add, size_t add_len,
+						   const unsigned char *tag, size_t tag_len,
+						   const unsigned char *input, unsigned char *output)
+{
+	struct gcm_hw_key *hw = (struct gcm_hw_key *)ctx->MBEDTLS_PRIVATE(hw);
+	hal_data in = {(void *)input, length, NULL, 0};
+	hal_data out = {(void *)output, length, NULL, 0};
+	hal_gcm_param param = {HAL_GCM_AES, (unsigned char *)iv, iv_len, (unsigned char *)add, add_len, (unsigned char *)tag, tag_len};
+	int ret;
+
+	if (hw == NULL || length < CONFIG_TLS_HW_GCM_MIN_LEN) {
+		return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+	}
+
+	ret = sl_gcm_decrypt(hw->shnd, &in, &param, hw->key_idx, &out);
+	if (ret == SECLINK_OK) {
+		return 0;
+	}
+
+	if (_gcm_hw_unsupported(ret)) {
+		mbedtls_gcm_hw_free(ctx);
+		return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+	}
+
+	/* TLS decrypts in place, so the input may be gone: fail the record as
+	 * the software does for a wrong tag.
+	 */
+	mbedtls_platform_zeroize(output, length);
+	return MBEDTLS_ERR_GCM_AUTH_FAILED;
+}
+#endif /* MBEDTLS_GCM_HW_OFFLOAD */
+
+#if defined(MBEDTLS_SHA256_HW_OFFLOAD)
+/*
+ * Only the one-shot mbedtls_sha256() is offloaded: seclink hashes a whole
+ * buffer, and the streaming API would need the state of the hardware to be
+ * kept between calls. A seclink handle is opened per call, since its file
+ * descriptor belongs to the calling task.
+ */
+int mbedtls_sha256_hw(const unsigned char *input, size_t ilen,
+					  unsigned char *output, int is224)
+{
+	hal_data in = {(void *)input, ilen, NULL, 0};
+	hal_data out = {(void *)output, is224 ? 28 : 32, NULL, 0};
+	sl_ctx shnd;
+	int ret;
+
+	if (ilen < CONFIG_TLS_HW_SHA256_MIN_LEN) {
+		return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+	}
+
+	if (sl_init(&shnd) != SECLINK_OK) {
+		return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+	}
+
+	ret = sl_get_hash(shnd, is224 ? HAL_HASH_SHA224 : HAL_HASH_SHA256, &in, &out);
+	sl_deinit(shnd);
+
+	if (ret != SECLINK_OK) {
+		return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+	}
+
+	return 0;
+}
+#endif /* MBEDTLS_SHA256_HW_OFFLOAD */
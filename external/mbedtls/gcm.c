@@ -63,6 +63,10 @@
 #include "aesce.h"
 #endif
 
+#if defined(MBEDTLS_GCM_HW_OFFLOAD)
+#include "mbedtls/alt/offload_alt.h"
+#endif
+
 #if !defined(MBEDTLS_GCM_ALT)
 
 /*
@@ -183,6 +187,10 @@ int mbedtls_gcm_setkey(mbedtls_gcm_context *ctx,
         return ret;
     }
 
+#if defined(MBEDTLS_GCM_HW_OFFLOAD)
+    mbedtls_gcm_hw_setkey(ctx, cipher, key, keybits);
+#endif
+
     return 0;
 }
 
@@ -585,6 +593,16 @@ int mbedtls_gcm_crypt_and_tag(mbedtls_gcm_context *ctx,
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
     size_t olen;
 
+#if defined(MBEDTLS_GCM_HW_OFFLOAD)
+    if (mode == MBEDTLS_GCM_ENCRYPT) {
+        ret = mbedtls_gcm_hw_encrypt(ctx, length, iv, iv_len, add, add_len,
+                                     input, output, tag_len, tag);
+        if (ret != MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED) {
+            return ret;
+        }
+    }
+#endif
+
     if ((ret = mbedtls_gcm_starts(ctx, mode, iv, iv_len)) != 0) {
         return ret;
     }
@@ -621,6 +639,14 @@ int mbedtls_gcm_auth_decrypt(mbedtls_gcm_context *ctx,
     size_t i;
     int diff;
 
+#if defined(MBEDTLS_GCM_HW_OFFLOAD)
+    ret = mbedtls_gcm_hw_decrypt(ctx, length, iv, iv_len, add, add_len,
+                                 tag, tag_len, input, output);
+    if (ret != MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED) {
+        return ret;
+    }
+#endif
+
     if ((ret = mbedtls_gcm_crypt_and_tag(ctx, MBEDTLS_GCM_DECRYPT, length,
                                          iv, iv_len, add, add_len,
                                          input, output, tag_len, check_tag)) != 0) {
@@ -645,6 +671,9 @@ void mbedtls_gcm_free(mbedtls_gcm_context *ctx)
     if (ctx == NULL) {
         return;
     }
+#if defined(MBEDTLS_GCM_HW_OFFLOAD)
+    mbedtls_gcm_hw_free(ctx);
+#endif
     mbedtls_cipher_free(&ctx->cipher_ctx);
     mbedtls_platform_zeroize(ctx, sizeof(mbedtls_gcm_context));
 }
@@ -0,0 +1,404 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/*
+ * Client session cache
+ *
+ * A session is kept serialized by mbedtls_ssl_session_save(), with the
+ * session ticket if the server sent one, so the same record is kept in
+ * RAM and in the preference. When the cache is full, the least recently
+ * used session is dropped. The master secret of the session is kept
+ * aside: a resumed handshake keeps it, a full handshake makes a new one.
+ */
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "mbedtls/platform.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/tls_session_cache.h"
+
+#ifdef CONFIG_TLS_SESSION_CACHE_PERSIST
+#include <preference/preference.h>
+#endif
+
+#ifdef CONFIG_TLS_SESSION_CACHE
+
+#define TLS_SESSION_HOST_MAX 64
+#define TLS_SESSION_MASTER_LEN 48
+#define TLS_SESSION_MAGIC 0x544c5353 /* "TLSS" */
+
+struct tls_session_entry {
+	char host[TLS_SESSION_HOST_MAX];
+	int port;
+	time_t stored;
+	uint32_t used;
+	unsigned char master[TLS_SESSION_MASTER_LEN];
+	size_t len;
+	unsigned char *blob;
+};
+
+#ifdef CONFIG_TLS_SESSION_CACHE_PERSIST
+/* Header of a session in the preference, followed by the session */
+struct tls_session_record {
+	uint32_t magic;
+	int32_t port;
+	int64_t stored;
+	char host[TLS_SESSION_HOST_MAX];
+};
+#endif
+
+static struct tls_session_entry g_entries[CONFIG_TLS_SESSION_CACHE_SIZE];
+static struct tls_session_cache_stats g_stats;
+static uint32_t g_clock;
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void _entry_free(struct tls_session_entry *e)
+{
+	if (e->blob) {
+		mbedtls_platform_zeroize(e->blob, e->len);
+		mbedtls_free(e->blob);
+	}
+	mbedtls_platform_zeroize(e, sizeof(*e));
+}
+
+static int _entry_expired(struct tls_session_entry *e, time_t now)
+{
+	return now < e->stored || now - e->stored > CONFIG_TLS_SESSION_CACHE_TIMEOUT;
+}
+
+static struct tls_session_entry *_entry_find(const char *host, int port)
+{
+	time_t now = time(NULL);
+	int i;
+
+	for (i = 0; i < CONFIG_TLS_SESSION_CACHE_SIZE; i++) {
+		struct tls_session_entry *e = &g_entries[i];
+		if (!e->blob || e->port != port || strcmp(e->host, host) != 0) {
+			continue;
+		}
+		if (_entry_expired(e, now)) {
+			_entry_free(e);
+			g_stats.expired++;
+			return NULL;
+		}
+		return e;
+	}
+
+	return NULL;
+}
+
+/* An empty entry, or the least recently used one */
+static struct tls_session_entry *_entry_alloc(void)
+{
+	struct tls_session_entry *lru = &g_entries[0];
+	int i;
+
+	for (i = 0; i < CONFIG_TLS_SESSION_CACHE_SIZE; i++) {
+		if (!g_entries[i].blob) {
+			return &g_entries[i];
+		}
+		if (g_entries[i].used < lru->used) {
+			lru = &g_entries[i];
+		}
+	}
+
+	_entry_free(lru);
+	g_stats.evicted++;
+
+	return lru;
+}
+
+static void _entry_fill(struct tls_session_entry *e, const char *host, int port, time_t stored,
+						const mbedtls_ssl_session *session, unsigned char *blob, size_t len)
+{
+	strncpy(e->host, host, TLS_SESSION_HOST_MAX - 1);
+	e->port = port;
+	e->stored = stored;
+	e->used = ++g_clock;
+	memcpy(e->master, session->MBEDTLS_PRIVATE(master), TLS_SESSION_MASTER_LEN);
+	e->blob = blob;
+	e->len = len;
+}
+
+#ifdef CONFIG_TLS_SESSION_CACHE_PERSIST
+/* The names of the preference are short, so the key is a hash of the
+ * host and the port, and the record holds them to tell collisions apart.
+ */
+static void _persist_key(const char *host, int port, char *key, size_t size)
+{
+	uint32_t h = 2166136261u;
+
+	while (*host) {
+		h = (h ^ (uint8_t)*host++) * 16777619u;
+	}
+	h = (h ^ (uint32_t)port) * 16777619u;
+
+	snprintf(key, size, "tls%08lx", (unsigned long)h);
+}
+
+static void _persist_save(const char *host, int port, time_t stored, const unsigned char *blob, size_t len)
+{
+	struct tls_session_record *rec;
+	char key[16];
+
+	rec = mbedtls_calloc(1, sizeof(*rec) + len);
+	if (!rec) {
+		return;
+	}
+
+	rec->magic = TLS_SESSION_MAGIC;
+	rec->port = port;
+	rec->stored = stored;
+	strncpy(rec->host, host, TLS_SESSION_HOST_MAX - 1);
+	memcpy(rec + 1, blob, len);
+
+	_persist_key(host, port, key, sizeof(key));
+	preference_shared_set_binary(key, rec, sizeof(*rec) + len);
+
+	mbedtls_platform_zeroize(rec, sizeof(*rec) + len);
+	mbedtls_free(rec);
+}
+
+static void _persist_remove(const char *host, int port)
+{
+	char key[16];
+
+	_persist_key(host, port, key, sizeof(key));
+	preference_shared_remove(key);
+}
+
+/* Called with g_lock held, when host:port is not in RAM */
+static struct tls_session_entry *_persist_load(const char *host, int port)
+{
+	struct tls_session_record *rec = NULL;
+	struct tls_session_entry *e = NULL;
+	mbedtls_ssl_session session;
+	unsigned char *blob = NULL;
+	char key[16];
+	size_t len;
+	int size;
+
+	_persist_key(host, port, key, sizeof(key));
+	if (preference_shared_get_binary(key, (void **)&rec, &size) != OK || !rec) {
+		return NULL;
+	}
+
+	if (size <= (int)sizeof(*rec) || rec->magic != TLS_SESSION_MAGIC ||
+		rec->port != port || strncmp(rec->host, host, TLS_SESSION_HOST_MAX) != 0) {
+		goto out;
+	}
+
+	len = size - sizeof(*rec);
+	blob = mbedtls_calloc(1, len);
+	if (!blob) {
+		goto out;
+	}
+	memcpy(blob, rec + 1, len);
+
+	mbedtls_ssl_session_init(&session);
+	if (mbedtls_ssl_session_load(&session, blob, len) == 0) {
+		e = _entry_alloc();
+		_entry_fill(e, host, port, (time_t)rec->stored, &session, blob, len);
+		blob = NULL;
+	}
+	mbedtls_ssl_session_free(&session);
+
+	if (e && _entry_expired(e, time(NULL))) {
+		_entry_free(e);
+		g_stats.expired++;
+		e = NULL;
+		preference_shared_remove(key);
+	}
+
+out:
+	if (blob) {
+		mbedtls_free(blob);
+	}
+	mbedtls_platform_zeroize(rec, size);
+	free(rec);
+
+	return e;
+}
+#endif /* CONFIG_TLS_SESSION_CACHE_PERSIST */
+
+int tls_session_cache_set(mbedtls_ssl_context *ssl, const char *host, int port)
+{
+	struct tls_session_entry *e;
+	mbedtls_ssl_session session;
+	int ret = 0;
+
+	if (!ssl || !host || strlen(host) >= TLS_SESSION_HOST_MAX) {
+		return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+	}
+
+	pthread_mutex_lock(&g_lock);
+	g_stats.lookups++;
+
+	e = _entry_find(host, port);
+#ifdef CONFIG_TLS_SESSION_CACHE_PERSIST
+	if (!e) {
+		e = _persist_load(host, port);
+	}
+#endif
+	if (!e) {
+		goto out;
+	}
+
+	mbedtls_ssl_session_init(&session);
+	ret = mbedtls_ssl_session_load(&session, e->blob, e->len);
+	if (ret == 0) {
+		ret = mbedtls_ssl_set_session(ssl, &session);
+	}
+	mbedtls_ssl_session_free(&session);
+
+	if (ret != 0) {
+		/* not usable by this build of mbedtls, do a full handshake */
+		_entry_free(e);
+		ret = 0;
+		goto out;
+	}
+
+	e->used = ++g_clock;
+	g_stats.offered++;
+	ret = 1;
+
+out:
+	pthread_mutex_unlock(&g_lock);
+	return ret;
+}
+
+int tls_session_cache_update(mbedtls_ssl_context *ssl, const char *host, int port)
+{
+	struct tls_session_entry *e;
+	mbedtls_ssl_session session;
+	unsigned char *blob = NULL;
+	time_t now = time(NULL);
+	size_t len = 0;
+	int ret;
+
+	if (!ssl || !host || strlen(host) >= TLS_SESSION_HOST_MAX) {
+		return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+	}
+
+	mbedtls_ssl_session_init(&session);
+	ret = mbedtls_ssl_get_session(ssl, &session);
+	if (ret != 0) {
+		goto out;
+	}
+
+	ret = mbedtls_ssl_session_save(&session, NULL, 0, &len);
+	if (ret != MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL) {
+		goto out;
+	}
+
+	blob = mbedtls_calloc(1, len);
+	if (!blob) {
+		ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+		goto out;
+	}
+
+	ret = mbedtls_ssl_session_save(&session, blob, len, &len);
+	if (ret != 0) {
+		goto out;
+	}
+
+#ifdef CONFIG_TLS_SESSION_CACHE_PERSIST
+	_persist_save(host, port, now, blob, len);
+#endif
+
+	pthread_mutex_lock(&g_lock);
+	e = _entry_find(host, port);
+	if (e) {
+		if (memcmp(e->master, session.MBEDTLS_PRIVATE(master), TLS_SESSION_MASTER_LEN) == 0) {
+			g_stats.resumed++;
+		}
+		_entry_free(e);
+	} else {
+		e = _entry_alloc();
+	}
+	_entry_fill(e, host, port, now, &session, blob, len);
+	blob = NULL;
+	g_stats.stored++;
+	pthread_mutex_unlock(&g_lock);
+
+out:
+	if (blob) {
+		mbedtls_platform_zeroize(blob, len);
+		mbedtls_free(blob);
+	}
+	mbedtls_ssl_session_free(&session);
+
+	return ret;
+}
+
+void tls_session_cache_remove(const char *host, int port)
+{
+	struct tls_session_entry *e;
+
+	if (!host) {
+		return;
+	}
+
+	pthread_mutex_lock(&g_lock);
+	e = _entry_find(host, port);
+	if (e) {
+		_entry_free(e);
+	}
+	pthread_mutex_unlock(&g_lock);
+
+#ifdef CONFIG_TLS_SESSION_CACHE_PERSIST
+	_persist_remove(host, port);
+#endif
+}
+
+void tls_session_cache_clear(void)
+{
+	int i;
+
+	pthread_mutex_lock(&g_lock);
+	for (i = 0; i < CONFIG_TLS_SESSION_CACHE_SIZE; i++) {
+		if (!g_entries[i].blob) {
+			continue;
+		}
+#ifdef CONFIG_TLS_SESSION_CACHE_PERSIST
+		_persist_remove(g_entries[i].host, g_entries[i].port);
+#endif
+		_entry_free(&g_entries[i]);
+	}
+	memset(&g_stats, 0, sizeof(g_stats));
+	pthread_mutex_unlock(&g_lock);
+}
+
+void tls_session_cache_get_stats(struct tls_session_cache_stats *stats)
+{
+	if (!stats) {
+		return;
+	}
+
+	pthread_mutex_lock(&g_lock);
+	*stats = g_stats;
+	pthread_mutex_unlock(&g_lock);
+}
+
+#endif /* CONFIG_TLS_SESSION_CACHE */
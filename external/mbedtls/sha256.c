@@ -73,6 +73,10 @@
 
 #include "mbedtls/platform.h"
 
+#if defined(MBEDTLS_SHA256_HW_OFFLOAD)
+#include "mbedtls/alt/offload_alt.h"
+#endif
+
 #if defined(__aarch64__)
 #  if defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT) || \
     defined(MBEDTLS_SHA256_USE_A64_CRYPTO_ONLY)
@@ -768,6 +772,13 @@ int mbedtls_sha256(const unsigned char *input,
     }
 #endif
 
+#if defined(MBEDTLS_SHA256_HW_OFFLOAD)
+    ret = mbedtls_sha256_hw(input, ilen, output, is224);
+    if (ret != MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED) {
+        return ret;
+    }
+#endif
+
     mbedtls_sha256_init(&ctx);
 
     if ((ret = mbedtls_sha256_starts(&ctx, is224)) != 0) {
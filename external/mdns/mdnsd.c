@@ -121,6 +121,17 @@
 
 #define MAX_ECONNRESET_COUNT	5
 
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+/* RFC 6762 5.2: the first query of a browse goes after a random delay of
+ * 20 to 120 msec, the next ones at intervals doubling from 1 sec up to
+ * 60 min
+ */
+#define MDNS_BROWSE_INITIAL_DELAY_MSEC	20
+#define MDNS_BROWSE_RANDOM_DELAY_MSEC	100
+#define MDNS_BROWSE_FIRST_INTERVAL_MSEC	1000
+#define MDNS_BROWSE_MAX_INTERVAL_MSEC	(3600 * 1000)
+#endif
+
 enum mdns_cache_status {
 	CACHE_SLEEP = 0,
 	CACHE_NORMAL = 1,
@@ -136,6 +147,15 @@ enum mdns_domain {
 #endif
 };
 
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+struct mdns_browse {
+	uint8_t *name;				/* service type, NULL if the slot is free */
+	uint32_t next_query;		/* msec */
+	uint32_t interval;			/* msec */
+	int suppressed;				/* asked by another host since our last query */
+};
+#endif
+
 struct mdnsd {
 	pthread_mutex_t data_lock;
 	sem_t sendmsg_sem;
@@ -157,6 +177,9 @@ struct mdnsd {
 	uint8_t *hostname;			/* hostname can be changed if name collision occur */
 	uint8_t *hostname_org;
 #endif
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+	struct mdns_browse browse[CONFIG_NETUTILS_MDNS_MAX_BROWSE];
+#endif
 };
 
 #if defined(CONFIG_NETUTILS_MDNS_RESPONDER_SUPPORT)
@@ -724,12 +747,223 @@ static void process_for_probe(struct mdnsd *svr, struct mdns_pkt *mdns_packet)
 
 #endif							/* CONFIG_NETUTILS_MDNS_RESPONDER_SUPPORT */
 
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+
+static uint32_t mdns_now_msec(void)
+{
+	struct timeval now;
+
+	TIME_GET(now);
+	return (uint32_t)(now.tv_sec * 1000 + now.tv_usec / 1000);
+}
+
+// seconds left before a cached record expires
+static uint32_t cache_remaining_ttl(struct rr_entry *entry, time_t now)
+{
+	time_t elapsed = now - entry->update_time;
+
+	if (elapsed < 0) {
+		elapsed = 0;
+	}
+
+	if ((uint32_t)elapsed >= entry->ttl) {
+		return 0;
+	}
+
+	return entry->ttl - (uint32_t)elapsed;
+}
+
+// RFC 6762 7.1: the cached PTR records of a question go in the answers of
+// the query, with their remaining TTL, while more than half of it is left
+static int populate_known_answers(struct mdnsd *svr, struct rr_list **rr_head, uint8_t *name)
+{
+	int num_ans = 0;
+	time_t now = time(NULL);
+	struct rr_group *group;
+	struct rr_list *n;
+	struct rr_entry *known;
+	uint32_t ttl;
+
+	pthread_mutex_lock(&svr->data_lock);
+
+	group = rr_group_find(svr->cache, name);
+	if (group) {
+		for (n = group->rr; n; n = n->next) {
+			if (n->e->type != RR_PTR || cmp_nlabel(name, n->e->name) != 0) {
+				continue;
+			}
+
+			ttl = cache_remaining_ttl(n->e, now);
+			if (ttl <= n->e->ttl / 2) {
+				continue;
+			}
+
+			known = rr_duplicate(n->e);
+			known->ttl = ttl;
+			known->cache_flush = 0;
+			num_ans += rr_list_append(rr_head, known);
+		}
+	}
+
+	pthread_mutex_unlock(&svr->data_lock);
+
+	return num_ans;
+}
+
+// finds the browse of a service type, with data_lock held
+static struct mdns_browse *browse_find(struct mdnsd *svr, uint8_t *name)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_NETUTILS_MDNS_MAX_BROWSE; i++) {
+		if (svr->browse[i].name && cmp_nlabel(svr->browse[i].name, name) == 0) {
+			return &svr->browse[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int browse_active(struct mdnsd *svr)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_NETUTILS_MDNS_MAX_BROWSE; i++) {
+		if (svr->browse[i].name) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+// RFC 6762 7.3: a query of another host for the PTR records of a browsed
+// type counts as ours, if it knows all the answers we know
+static void browse_seen_question(struct mdnsd *svr, struct mdns_pkt *pkt, uint8_t *name)
+{
+	time_t now = time(NULL);
+	struct mdns_browse *browse;
+	struct rr_group *group;
+	struct rr_list *n;
+
+	pthread_mutex_lock(&svr->data_lock);
+
+	browse = browse_find(svr, name);
+	if (browse == NULL) {
+		goto out_with_mutex;
+	}
+
+	group = rr_group_find(svr->cache, name);
+	if (group) {
+		for (n = group->rr; n; n = n->next) {
+			if (n->e->type != RR_PTR || cmp_nlabel(name, n->e->name) != 0) {
+				continue;
+			}
+
+			if (cache_remaining_ttl(n->e, now) > n->e->ttl / 2 && rr_entry_match(pkt->rr_ans, n->e) == NULL) {
+				goto out_with_mutex;
+			}
+		}
+	}
+
+	browse->suppressed = 1;
+
+out_with_mutex:
+	pthread_mutex_unlock(&svr->data_lock);
+}
+
+// queues the queries of the browses which are due, and returns the msec
+// until the next one, or -1 without browse
+static int browse_schedule(struct mdnsd *svr)
+{
+	uint32_t now = mdns_now_msec();
+	struct mdns_browse *browse;
+	int32_t left;
+	int wait = -1;
+	int i;
+
+	pthread_mutex_lock(&svr->data_lock);
+
+	for (i = 0; i < CONFIG_NETUTILS_MDNS_MAX_BROWSE; i++) {
+		browse = &svr->browse[i];
+		if (browse->name == NULL) {
+			continue;
+		}
+
+		left = (int32_t)(browse->next_query - now);
+		if (left <= 0) {
+			if (browse->suppressed) {
+				DEBUG_PRINTF("browse query suppressed\n");
+			} else {
+				rr_list_append(&svr->query, qn_create(dup_nlabel(browse->name), RR_PTR, 0));
+			}
+
+			browse->suppressed = 0;
+			browse->next_query = now + browse->interval;
+			left = (int32_t)browse->interval;
+
+			browse->interval *= 2;
+			if (browse->interval > MDNS_BROWSE_MAX_INTERVAL_MSEC) {
+				browse->interval = MDNS_BROWSE_MAX_INTERVAL_MSEC;
+			}
+		}
+
+		if (wait < 0 || left < wait) {
+			wait = left;
+		}
+	}
+
+	pthread_mutex_unlock(&svr->data_lock);
+
+	return wait;
+}
+
+// drops the cached record closest to expiry when the cache is full, with
+// data_lock held
+static void cache_make_room(struct mdnsd *svr)
+{
+	time_t now = time(NULL);
+	struct rr_group *group;
+	struct rr_list *list;
+	struct rr_entry *victim = NULL;
+	uint32_t victim_ttl = 0;
+	uint32_t ttl;
+	int count = 0;
+
+	for (group = svr->cache; group; group = group->next) {
+		for (list = group->rr; list; list = list->next) {
+			count++;
+			ttl = cache_remaining_ttl(list->e, now);
+			if (victim == NULL || ttl < victim_ttl) {
+				victim = list->e;
+				victim_ttl = ttl;
+			}
+		}
+	}
+
+	if (count >= CONFIG_NETUTILS_MDNS_CACHE_SIZE && victim) {
+		rr_group_del(&svr->cache, victim);
+	}
+}
+
+#endif							/* CONFIG_NETUTILS_MDNS_CACHE */
+
 static void process_for_query(struct mdnsd *svr, struct mdns_pkt *mdns_packet)
 {
 	mdns_init_query(mdns_packet, 0);
 
 	mdns_packet->num_qn += populate_query(svr, &mdns_packet->rr_qn);
 
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+	struct rr_list *qn;
+
+	for (qn = mdns_packet->rr_qn; qn; qn = qn->next) {
+		if (qn->e->type == RR_PTR) {
+			mdns_packet->num_ans_rr += populate_known_answers(svr, &mdns_packet->rr_ans, qn->e->name);
+		}
+	}
+#endif
+
 #if defined(CONFIG_NETUTILS_MDNS_RESPONDER_SUPPORT)
 	// advertisement my address to mdns neighbor
 	mdns_packet->num_ans_rr += populate_answers(svr, &mdns_packet->rr_add, svr->hostname, RR_A);
@@ -750,8 +984,13 @@ static void update_cache(struct mdnsd *svr)
 		for (; list; list = list->next) {
 			entry = list->e;
 			if (entry) {
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+				/* if ttl is expired, remove rr from cache */
+				if ((time(NULL) - entry->update_time) > entry->ttl) {
+#else
 				/* if ttl is expired or rr is RR_PTR or RR_SRV, remove rr from cache */
 				if (((time(NULL) - entry->update_time) > entry->ttl) || (svr->c_status != CACHE_SERVICE_DISCOVERY && (entry->type == RR_PTR || entry->type == RR_SRV))) {
+#endif
 					rr_list_append(&remove_list, entry);
 				}
 			}
@@ -828,10 +1067,21 @@ static void add_rr_to_cache(struct mdnsd *svr, struct mdns_pkt *pkt)
 							MDNS_FREE(name);
 						}
 					}
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+					if (browse_find(svr, rr_e->name)) {
+						b_found = 1;
+						rr_list_append(&filtered_rr_list, rr_e);
+					}
+#endif
 				} else if (rr_e->type == RR_SRV) {
 					if (svr->c_status == CACHE_SERVICE_DISCOVERY) {
 						rr_list_append(&filtered_rr_list, rr_e);
 					}
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+					else if (browse_active(svr)) {
+						rr_list_append(&filtered_rr_list, rr_e);
+					}
+#endif
 				}
 			}
 		}
@@ -862,10 +1112,16 @@ static void add_rr_to_cache(struct mdnsd *svr, struct mdns_pkt *pkt)
 						rr_group_add(&svr->cache, cached_rr_e);
 					}
 				} else {
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+					cache_make_room(svr);
+#endif
 					cached_rr_e = rr_duplicate(rr_e);
 					rr_group_add(&svr->cache, cached_rr_e);
 				}
 			} else {
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+				cache_make_room(svr);
+#endif
 				cached_rr_e = rr_duplicate(rr_e);
 				rr_group_add(&svr->cache, cached_rr_e);
 			}
@@ -933,6 +1189,12 @@ static int process_mdns_pkt(struct mdnsd *svr, struct mdns_pkt *pkt, struct mdns
 			DEBUG_PRINTF("qn #%d: type %s (%02x) %s - ", i, rr_get_type_name(qn->type), qn->type, namestr);
 			MDNS_FREE(namestr);
 
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+			if (qn->type == RR_PTR && !qn->unicast_query) {
+				browse_seen_question(svr, pkt, qn->name);
+			}
+#endif
+
 			// check if it's a unicast query - we ignore those
 			if (qn->unicast_query) {
 				DEBUG_PRINTF("skipping unicast query\n");
@@ -1160,6 +1422,10 @@ static void main_loop(struct mdnsd *svr)
 	void *pkt_buffer = NULL;
 	struct mdns_pkt *mdns_packet = NULL;
 	int econnreset_count = 0;
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+	struct timeval timeout;
+	int wait_msec = -1;
+#endif
 
 	pkt_buffer = MDNS_MALLOC(PACKET_SIZE);
 	if (pkt_buffer == NULL) {
@@ -1185,7 +1451,16 @@ static void main_loop(struct mdnsd *svr)
 		FD_ZERO(&sockfd_set);
 		FD_SET(svr->sockfd, &sockfd_set);
 		FD_SET(svr->notify_pipe[0], &sockfd_set);
-		ret = select(max_fd + 1, &sockfd_set, NULL, NULL, NULL);
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+		if (wait_msec >= 0) {
+			timeout.tv_sec = wait_msec / 1000;
+			timeout.tv_usec = (wait_msec % 1000) * 1000;
+			ret = select(max_fd + 1, &sockfd_set, NULL, NULL, &timeout);
+		} else
+#endif
+		{
+			ret = select(max_fd + 1, &sockfd_set, NULL, NULL, NULL);
+		}
 
 		if (ret > 0) {
 			if (FD_ISSET(svr->notify_pipe[0], &sockfd_set)) {
@@ -1253,11 +1528,15 @@ static void main_loop(struct mdnsd *svr)
 					mdns_pkt_destroy(mdns);
 				}
 			}
-		} else {
+		} else if (ret < 0) {
 			printf("ERROR: select() failed (ret: %d)\n", ret);
 			continue;
 		}
 
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+		wait_msec = browse_schedule(svr);
+#endif
+
 		// send out query
 		while (1) {
 			if (!svr->query) {
@@ -1278,6 +1557,13 @@ static void main_loop(struct mdnsd *svr)
 					rr_list_destroy(mdns_packet->rr_qn, 1);
 					mdns_packet->rr_qn = NULL;
 				}
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+				// known answers are copies of the cached records
+				if (mdns_packet->rr_ans) {
+					rr_list_destroy(mdns_packet->rr_ans, 1);
+					mdns_packet->rr_ans = NULL;
+				}
+#endif
 			}
 		}
 
@@ -1839,6 +2125,16 @@ static void release_mdns_context_resource(void)
 	}
 #endif							/* CONFIG_NETUTILS_MDNS_RESPONDER_SUPPORT */
 
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+	int i;
+	for (i = 0; i < CONFIG_NETUTILS_MDNS_MAX_BROWSE; i++) {
+		if (g_svr->browse[i].name) {
+			MDNS_FREE(g_svr->browse[i].name);
+			g_svr->browse[i].name = NULL;
+		}
+	}
+#endif
+
 	g_svr->domain = MDNS_DOMAIN_UNKNOWN;
 
 	MDNS_FREE(g_svr);
@@ -2405,3 +2701,209 @@ out_with_mutex:
 out:
 	return result;
 }
+
+#if defined(CONFIG_NETUTILS_MDNS_CACHE)
+static int browse_service_type(const char *service_type, char *buf, size_t size)
+{
+	if (g_svr == NULL) {
+		printf("ERROR: mdnsd is not running.\n");
+		return -1;
+	}
+
+	if (check_mdns_domain(service_type) != MDNS_DOMAIN_UNKNOWN) {
+		snprintf(buf, size, "%s", service_type);
+		return 0;
+	}
+
+	switch (g_svr->domain) {
+	case MDNS_DOMAIN_LOCAL:
+		snprintf(buf, size, "%s%s", service_type, MDNS_SUFFIX_LOCAL);
+		break;
+#if defined(CONFIG_NETUTILS_MDNS_XMDNS)
+	case MDNS_DOMAIN_SITE:
+		snprintf(buf, size, "%s%s", service_type, MDNS_SUFFIX_SITE);
+		break;
+#endif
+	default:
+		printf("ERROR: current mdns domain is invalid.\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+/****************************************************************************
+ * Name: mdnsd_browse_start
+ *
+ * Description:
+ *   Start browsing the services of a type in the background. The daemon
+ *   queries them with intervals doubling from 1 sec up to 60 min, leaves
+ *   out the answers it already knows and skips a query which another host
+ *   asked, while their records are kept in the cache.
+ *
+ * Parameters:
+ *       service_type : mdns service type string
+ *
+ * Returned Value:
+ *       On success, 0 is returned. On failure, a negative value is returned.
+ *
+ ****************************************************************************/
+int mdnsd_browse_start(const char *service_type)
+{
+	int result = -1;
+	int i;
+	char service_type_str[128];
+	struct mdns_browse *browse = NULL;
+	uint8_t *name;
+
+	mdns_cmd_mutex_lock();
+
+	if (browse_service_type(service_type, service_type_str, sizeof(service_type_str)) != 0) {
+		goto out_with_mutex;
+	}
+
+	name = create_nlabel(service_type_str);
+
+	pthread_mutex_lock(&g_svr->data_lock);
+	if (browse_find(g_svr, name)) {
+		printf("ERROR: %s is already browsed.\n", service_type_str);
+		MDNS_FREE(name);
+		goto out_with_lock;
+	}
+
+	for (i = 0; i < CONFIG_NETUTILS_MDNS_MAX_BROWSE; i++) {
+		if (g_svr->browse[i].name == NULL) {
+			browse = &g_svr->browse[i];
+			break;
+		}
+	}
+
+	if (browse == NULL) {
+		printf("ERROR: too many browses (max: %d)\n", CONFIG_NETUTILS_MDNS_MAX_BROWSE);
+		MDNS_FREE(name);
+		goto out_with_lock;
+	}
+
+	browse->name = name;
+	browse->next_query = mdns_now_msec() + MDNS_BROWSE_INITIAL_DELAY_MSEC + (rand() % MDNS_BROWSE_RANDOM_DELAY_MSEC);
+	browse->interval = MDNS_BROWSE_FIRST_INTERVAL_MSEC;
+	browse->suppressed = 0;
+	result = 0;
+
+out_with_lock:
+	pthread_mutex_unlock(&g_svr->data_lock);
+
+	if (result == 0) {
+		/* wake up main_loop to schedule the first query */
+		request_sendmsg(g_svr);
+	}
+
+out_with_mutex:
+	mdns_cmd_mutex_unlock();
+
+	return result;
+}
+
+/****************************************************************************
+ * Name: mdnsd_browse_get
+ *
+ * Description:
+ *   Get the services of a browsed type from the cache, without waiting.
+ *
+ * Parameters:
+ *       service_type : mdns service type string
+ *       service_list : the array of service list
+ *       num_of_services : number of services, 0 if none is known yet
+ *
+ * Returned Value:
+ *       On success, 0 is returned. On failure, a negative value is returned.
+ *
+ ****************************************************************************/
+int mdnsd_browse_get(const char *service_type, struct mdns_service_info **service_list, int *num_of_services)
+{
+	int result = -1;
+	char service_type_str[128];
+	uint8_t *name;
+	int browsed;
+
+	if (service_list == NULL || num_of_services == NULL) {
+		return -1;
+	}
+
+	*service_list = NULL;
+	*num_of_services = 0;
+
+	mdns_cmd_mutex_lock();
+
+	if (browse_service_type(service_type, service_type_str, sizeof(service_type_str)) != 0) {
+		goto out_with_mutex;
+	}
+
+	name = create_nlabel(service_type_str);
+	pthread_mutex_lock(&g_svr->data_lock);
+	browsed = browse_find(g_svr, name) != NULL;
+	pthread_mutex_unlock(&g_svr->data_lock);
+	MDNS_FREE(name);
+
+	if (!browsed) {
+		printf("ERROR: %s is not browsed.\n", service_type_str);
+		goto out_with_mutex;
+	}
+
+	if (lookup_service(g_svr, service_type_str, g_service_list, num_of_services) == 0) {
+		*service_list = g_service_list;
+	}
+
+	result = 0;
+
+out_with_mutex:
+	mdns_cmd_mutex_unlock();
+
+	return result;
+}
+
+/****************************************************************************
+ * Name: mdnsd_browse_stop
+ *
+ * Description:
+ *   Stop browsing the services of a type.
+ *
+ * Parameters:
+ *       service_type : mdns service type string
+ *
+ * Returned Value:
+ *       On success, 0 is returned. On failure, a negative value is returned.
+ *
+ ****************************************************************************/
+int mdnsd_browse_stop(const char *service_type)
+{
+	int result = -1;
+	char service_type_str[128];
+	struct mdns_browse *browse;
+	uint8_t *name;
+
+	mdns_cmd_mutex_lock();
+
+	if (browse_service_type(service_type, service_type_str, sizeof(service_type_str)) != 0) {
+		goto out_with_mutex;
+	}
+
+	name = create_nlabel(service_type_str);
+
+	pthread_mutex_lock(&g_svr->data_lock);
+	browse = browse_find(g_svr, name);
+	if (browse) {
+		MDNS_FREE(browse->name);
+		browse->name = NULL;
+		result = 0;
+	}
+	pthread_mutex_unlock(&g_svr->data_lock);
+
+	MDNS_FREE(name);
+
+out_with_mutex:
+	mdns_cmd_mutex_unlock();
+
+	return result;
+}
+#endif							/* CONFIG_NETUTILS_MDNS_CACHE */
@@ -95,6 +95,9 @@
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/ssl_cache.h"
 #include "mbedtls/entropy.h"
+#ifdef CONFIG_TLS_SESSION_CACHE
+#include "mbedtls/tls_session_cache.h"
+#endif
 #endif
 
 #endif
\ No newline at end of file
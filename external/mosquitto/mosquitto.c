@@ -302,6 +302,10 @@ void mosquitto__destroy(struct mosquitto *mosq)
 	}
 	message__cleanup_all(mosq);
 	will__clear(mosq);
+#if defined(__TINYARA__) && defined(CONFIG_NETUTILS_MQTT_WRITE_COALESCE)
+	mosquitto__free(mosq->out_batch);
+	mosq->out_batch = NULL;
+#endif
 #ifdef WITH_TLS
 	if(mosq->ssl){
 		SSL_free(mosq->ssl);
@@ -175,6 +175,9 @@ struct mosquitto__packet{
 	uint16_t mid;
 	uint8_t command;
 	int8_t remaining_count;
+#ifdef CONFIG_NETUTILS_MQTT_PACKET_POOL
+	bool pooled;
+#endif
 };
 
 struct mosquitto_message_all{
@@ -399,6 +402,9 @@ struct mosquitto {
 	bool in_select;
 	struct addrinfo *connect_ainfo;
 	struct addrinfo *connect_ainfo_bind;
+#ifdef CONFIG_NETUTILS_MQTT_WRITE_COALESCE
+	uint8_t *out_batch;
+#endif
 #endif
 };
 
@@ -982,10 +982,19 @@ int net__socket_connect_step3(struct mosquitto *mosq, const char *host)
 		((mbedtls_net_context *)mosq->net)->fd = (int)mosq->sock;
 		mbedtls_ssl_set_bio(mosq->ssl_ctx, mosq->net, mbedtls_net_send, mbedtls_net_recv, NULL);
 
+#ifdef CONFIG_TLS_SESSION_CACHE
+		tls_session_cache_set(mosq->ssl_ctx, host, mosq->port);
+#endif
 		if (net__socket_connect_tls(mosq)) {
+#ifdef CONFIG_TLS_SESSION_CACHE
+			tls_session_cache_remove(host, mosq->port);
+#endif
 			net__socket_close(mosq);
 			return MOSQ_ERR_TLS;
 		}
+#ifdef CONFIG_TLS_SESSION_CACHE
+		tls_session_cache_update(mosq->ssl_ctx, host, mosq->port);
+#endif
 	}
 #else
 	UNUSED(mosq);
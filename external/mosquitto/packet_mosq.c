@@ -47,6 +47,54 @@ Contributors:
 #  define G_PUB_MSGS_SENT_INC(A)
 #endif
 
+#ifdef CONFIG_NETUTILS_MQTT_PACKET_POOL
+/* Payloads of small packets, PUBACKs and short publishes, are taken from
+ * buffers shared by the clients instead of the heap. */
+static uint8_t packet__pool[CONFIG_NETUTILS_MQTT_PACKET_POOL_NUM][CONFIG_NETUTILS_MQTT_PACKET_POOL_BUFSIZE];
+static uint32_t packet__pool_used;
+static pthread_mutex_t packet__pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint8_t *packet__payload_alloc(struct mosquitto__packet *packet, uint32_t len)
+{
+	int i;
+
+	packet->pooled = false;
+	if(len <= CONFIG_NETUTILS_MQTT_PACKET_POOL_BUFSIZE){
+		pthread_mutex_lock(&packet__pool_mutex);
+		for(i=0; i<CONFIG_NETUTILS_MQTT_PACKET_POOL_NUM; i++){
+			if(!(packet__pool_used & (1U << i))){
+				packet__pool_used |= (1U << i);
+				pthread_mutex_unlock(&packet__pool_mutex);
+				packet->pooled = true;
+				return packet__pool[i];
+			}
+		}
+		pthread_mutex_unlock(&packet__pool_mutex);
+	}
+
+	return mosquitto__malloc(len);
+}
+
+static void packet__payload_free(struct mosquitto__packet *packet)
+{
+	int i;
+
+	if(!packet->pooled){
+		mosquitto__free(packet->payload);
+		return;
+	}
+
+	i = (int)((packet->payload - packet__pool[0]) / CONFIG_NETUTILS_MQTT_PACKET_POOL_BUFSIZE);
+	pthread_mutex_lock(&packet__pool_mutex);
+	packet__pool_used &= ~(1U << i);
+	pthread_mutex_unlock(&packet__pool_mutex);
+	packet->pooled = false;
+}
+#else
+#  define packet__payload_alloc(packet, len) mosquitto__malloc(len)
+#  define packet__payload_free(packet) mosquitto__free((packet)->payload)
+#endif
+
 int packet__alloc(struct mosquitto__packet *packet)
 {
 	uint8_t remaining_bytes[5], byte;
@@ -73,7 +121,7 @@ int packet__alloc(struct mosquitto__packet *packet)
 #ifdef WITH_WEBSOCKETS
 	packet->payload = mosquitto__malloc(sizeof(uint8_t)*packet->packet_length + LWS_PRE);
 #else
-	packet->payload = mosquitto__malloc(sizeof(uint8_t)*packet->packet_length);
+	packet->payload = packet__payload_alloc(packet, sizeof(uint8_t)*packet->packet_length);
 #endif
 	if(!packet->payload) return MOSQ_ERR_NOMEM;
 
@@ -95,7 +143,9 @@ void packet__cleanup(struct mosquitto__packet *packet)
 	packet->remaining_count = 0;
 	packet->remaining_mult = 1;
 	packet->remaining_length = 0;
-	mosquitto__free(packet->payload);
+	if(packet->payload){
+		packet__payload_free(packet);
+	}
 	packet->payload = NULL;
 	packet->to_process = 0;
 	packet->pos = 0;
@@ -208,6 +258,73 @@ int packet__check_oversize(struct mosquitto *mosq, uint32_t remaining_length)
 }
 
 
+#ifdef CONFIG_NETUTILS_MQTT_WRITE_COALESCE
+/* Write the rest of the current packet together with the whole packets
+ * queued after it which fit, so that a burst of small publishes goes out as
+ * one TCP segment, or one TLS record, instead of one per packet.
+ * current_out_packet_mutex is held: the queued packets are only taken from
+ * the head of the list by this thread, other threads append to the tail. */
+static ssize_t packet__write_batch(struct mosquitto *mosq, struct mosquitto__packet *packet)
+{
+	struct mosquitto__packet *next;
+	uint32_t len;
+
+	if(packet->to_process >= CONFIG_NETUTILS_MQTT_WRITE_COALESCE_SIZE || !mosq->out_packet){
+		return net__write(mosq, &(packet->payload[packet->pos]), packet->to_process);
+	}
+	if(!mosq->out_batch){
+		mosq->out_batch = mosquitto__malloc(CONFIG_NETUTILS_MQTT_WRITE_COALESCE_SIZE);
+		if(!mosq->out_batch){
+			return net__write(mosq, &(packet->payload[packet->pos]), packet->to_process);
+		}
+	}
+
+	memcpy(mosq->out_batch, &(packet->payload[packet->pos]), packet->to_process);
+	len = packet->to_process;
+
+	pthread_mutex_lock(&mosq->out_packet_mutex);
+	for(next = mosq->out_packet; next; next = next->next){
+		if(len + next->to_process > CONFIG_NETUTILS_MQTT_WRITE_COALESCE_SIZE){
+			break;
+		}
+		memcpy(&mosq->out_batch[len], &(next->payload[next->pos]), next->to_process);
+		len += next->to_process;
+		if(((next->command)&0xF0) == CMD_DISCONNECT){
+			break;
+		}
+	}
+	pthread_mutex_unlock(&mosq->out_packet_mutex);
+
+	return net__write(mosq, mosq->out_batch, len);
+}
+
+/* Account the bytes written by packet__write_batch() to the packets they
+ * came from. Queued packets written whole are completed by packet__write()
+ * when they become the current packet. */
+static void packet__write_consume(struct mosquitto *mosq, struct mosquitto__packet *packet, uint32_t len)
+{
+	struct mosquitto__packet *next;
+	uint32_t n;
+
+	n = len < packet->to_process ? len : packet->to_process;
+	packet->to_process -= n;
+	packet->pos += n;
+	len -= n;
+	if(len == 0){
+		return;
+	}
+
+	pthread_mutex_lock(&mosq->out_packet_mutex);
+	for(next = mosq->out_packet; next && len > 0; next = next->next){
+		n = len < next->to_process ? len : next->to_process;
+		next->to_process -= n;
+		next->pos += n;
+		len -= n;
+	}
+	pthread_mutex_unlock(&mosq->out_packet_mutex);
+}
+#endif
+
 int packet__write(struct mosquitto *mosq)
 {
 	ssize_t write_length;
@@ -249,11 +366,19 @@ int packet__write(struct mosquitto *mosq)
 		packet = mosq->current_out_packet;
 
 		while(packet->to_process > 0){
+#ifdef CONFIG_NETUTILS_MQTT_WRITE_COALESCE
+			write_length = packet__write_batch(mosq, packet);
+#else
 			write_length = net__write(mosq, &(packet->payload[packet->pos]), packet->to_process);
+#endif
 			if(write_length > 0){
 				G_BYTES_SENT_INC(write_length);
+#ifdef CONFIG_NETUTILS_MQTT_WRITE_COALESCE
+				packet__write_consume(mosq, packet, (uint32_t)write_length);
+#else
 				packet->to_process -= (uint32_t)write_length;
 				packet->pos += (uint32_t)write_length;
+#endif
 			}else{
 #ifdef WIN32
 				errno = WSAGetLastError();
@@ -496,7 +621,7 @@ int packet__read(struct mosquitto *mosq)
 		/* FIXME - client case for incoming message received from broker too large */
 #endif
 		if(mosq->in_packet.remaining_length > 0){
-			mosq->in_packet.payload = mosquitto__malloc(mosq->in_packet.remaining_length*sizeof(uint8_t));
+			mosq->in_packet.payload = packet__payload_alloc(&mosq->in_packet, mosq->in_packet.remaining_length*sizeof(uint8_t));
 			if(!mosq->in_packet.payload){
 				return MOSQ_ERR_NOMEM;
 			}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_PROFILER_H
+#define LUCI_INTERPRETER_CORE_PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace luci_interpreter
+{
+
+/**
+ * @brief Hooks called around each operator executed by the interpreter, like
+ *        tflite::MicroProfilerInterface for TFLM.
+ */
+class IProfiler
+{
+public:
+  virtual ~IProfiler() = default;
+
+  // Called before an operator runs, with its circle::BuiltinOperator code.
+  // Returns a handle given back to endOperator.
+  virtual uint32_t beginOperator(int32_t builtin_code) = 0;
+
+  // Called after the operator ran. allocated_bytes is the size of the tensors
+  // allocated by the graph at that point of the execution, inputs excluded.
+  virtual void endOperator(uint32_t handle, size_t allocated_bytes) = 0;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_PROFILER_H
@@ -63,6 +63,8 @@ Interpreter::~Interpreter() = default;
 
 void Interpreter::interpret() { _runtime_module.execute(); }
 
+void Interpreter::setProfiler(IProfiler *profiler) { _runtime_module.setProfiler(profiler); }
+
 int32_t Interpreter::getNumOfInputTensors()
 {
   auto *runtime_graph = _runtime_module.getMainGraph();
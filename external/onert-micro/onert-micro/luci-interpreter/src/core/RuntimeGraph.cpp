@@ -15,6 +15,7 @@
  */
 
 #include "core/RuntimeGraph.h"
+#include "core/RuntimeModule.h"
 #include "kernels/KernelBuilder.h"
 
 #include <algorithm>
@@ -425,6 +426,9 @@ void RuntimeGraph::execute()
   const auto operators_size = _reader->operators().size();
   const auto operators = _reader->operators();
 
+  IProfiler *profiler = _runtime_module->getProfiler();
+  size_t allocated_bytes = 0;
+
   for (uint32_t i = 0; i < operators_size; ++i)
   {
     const auto op = operators.at(i);
@@ -434,10 +438,35 @@ void RuntimeGraph::execute()
 
     allocate(i);
 
+    uint32_t profile_handle = 0;
+    if (profiler != nullptr)
+    {
+      allocated_bytes += getTensorsSize(_alloc_plan[i]);
+      profile_handle = profiler->beginOperator(static_cast<int32_t>(opcode));
+    }
+
     kernel_executor.execute_kernel(op, opcode, this);
 
+    if (profiler != nullptr)
+    {
+      profiler->endOperator(profile_handle, allocated_bytes);
+      // Graph inputs are freed without having been counted
+      const auto freed_bytes = getTensorsSize(_dealloc_plan[i]);
+      allocated_bytes = freed_bytes < allocated_bytes ? allocated_bytes - freed_bytes : 0;
+    }
+
     deallocate(i);
   }
 }
 
+size_t RuntimeGraph::getTensorsSize(const std::vector<const circle::Tensor *> &tensors)
+{
+  size_t size = 0;
+  for (const circle::Tensor *tensor : tensors)
+  {
+    size += getDataTypeSize(Tensor::element_type(tensor)) * Tensor::num_elements(tensor);
+  }
+  return size;
+}
+
 } // namespace luci_interpreter
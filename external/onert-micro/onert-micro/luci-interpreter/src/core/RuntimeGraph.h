@@ -122,6 +122,7 @@ private:
   void buildAllocDeallocPlan(bool dealloc_input);
   void allocate(size_t kernel_index);
   void deallocate(size_t kernel_index);
+  static size_t getTensorsSize(const std::vector<const circle::Tensor *> &tensors);
 
 private:
   SimpleMemoryManager *_memory_manager;
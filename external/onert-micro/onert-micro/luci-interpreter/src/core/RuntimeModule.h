@@ -18,6 +18,7 @@
 #define LUCI_INTERPRETER_CORE_RUNTIMEMODULE_H
 
 #include "core/RuntimeGraph.h"
+#include "luci_interpreter/core/Profiler.h"
 #include "luci_interpreter/core/reader/CircleMicroReader.h"
 
 #include <memory>
@@ -55,8 +56,12 @@ public:
 
   void selectSubgraph(uint32_t index) { _circle_reader.select_subgraph(index); }
 
+  void setProfiler(IProfiler *profiler) { _profiler = profiler; }
+  IProfiler *getProfiler() const { return _profiler; }
+
 private:
   std::vector<BaseRuntimeGraph> _graphs;
+  IProfiler *_profiler = nullptr;
 
   CircleReader _circle_reader;
 };
@@ -122,4 +122,10 @@ GOOGLE_PROTOBUF_PLATFORM_ERROR
 #define GOOGLE_PROTOBUF_NO_THREADLOCAL
 #endif
 
+#if defined(__TIZENRT__) || defined(__TizenRT__)
+// TizenRT tasks have no __thread storage, so the thread cache of the
+// arenas is kept with pthread_key_create() as on android.
+#define GOOGLE_PROTOBUF_NO_THREADLOCAL
+#endif
+
 #endif  // GOOGLE_PROTOBUF_PLATFORM_MACROS_H_
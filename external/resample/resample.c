@@ -122,6 +122,10 @@ static void speex_free(void *ptr) {free(ptr);}
 #include "resample_neon.h"
 #endif
 
+#ifdef USE_ARM_SIMD
+#include "resample_arm.h"
+#endif
+
 /* Number of elements to allocate on the stack */
 #ifdef VAR_ARRAYS
 #define FIXED_STACK_ALLOC 8192
@@ -0,0 +1,141 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/* Fixed-point kernels of the resampler for ARM: NEON on Cortex-A, Helium
+ * (MVE) on Armv8.1-M and the DSP extension on other Cortex-M. They compute
+ * the same 32-bit sums as the generic C loops of resample.c, which are used
+ * when none of these is available.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(FIXED_POINT) && defined(__ARM_NEON)
+#include <arm_neon.h>
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline spx_word32_t inner_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len)
+{
+	int32x4_t acc = vdupq_n_s32(0);
+	int32x2_t acc2;
+	spx_word32_t sum;
+	unsigned int i;
+
+	for (i = 0; i + 8 <= len; i += 8) {
+		int16x8_t x = vld1q_s16(a + i);
+		int16x8_t y = vld1q_s16(b + i);
+		acc = vmlal_s16(acc, vget_low_s16(x), vget_low_s16(y));
+		acc = vmlal_s16(acc, vget_high_s16(x), vget_high_s16(y));
+	}
+	acc2 = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+	sum = vget_lane_s32(vpadd_s32(acc2, acc2), 0);
+	for (; i < len; i++) {
+		sum += MULT16_16(a[i], b[i]);
+	}
+
+	return SATURATE32PSHR(sum, 15, 32767);
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline spx_word32_t interpolate_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len, const spx_uint32_t oversample, spx_word16_t *frac)
+{
+	int32x4_t acc = vdupq_n_s32(0);
+	int32_t accum[4];
+	spx_word32_t sum;
+	unsigned int i;
+
+	/* the 4 taps around the position are contiguous in the table */
+	for (i = 0; i < len; i++) {
+		acc = vmlal_n_s16(acc, vld1_s16(b + i * oversample), a[i]);
+	}
+	vst1q_s32(accum, acc);
+
+	sum = MULT16_32_Q15(frac[0], accum[0]) + MULT16_32_Q15(frac[1], accum[1]) + MULT16_32_Q15(frac[2], accum[2]) + MULT16_32_Q15(frac[3], accum[3]);
+	return SATURATE32PSHR(sum, 15, 32767);
+}
+
+#elif defined(FIXED_POINT) && defined(__ARM_FEATURE_MVE)
+#include <arm_mve.h>
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline spx_word32_t inner_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len)
+{
+	int32_t sum = 0;
+	unsigned int i;
+
+	for (i = 0; i + 8 <= len; i += 8) {
+		sum = vmladavaq_s16(sum, vld1q_s16(a + i), vld1q_s16(b + i));
+	}
+	for (; i < len; i++) {
+		sum += MULT16_16(a[i], b[i]);
+	}
+
+	return SATURATE32PSHR(sum, 15, 32767);
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline spx_word32_t interpolate_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len, const spx_uint32_t oversample, spx_word16_t *frac)
+{
+	int32x4_t acc = vdupq_n_s32(0);
+	int32_t accum[4];
+	spx_word32_t sum;
+	unsigned int i;
+
+	/* the 4 taps around the position are contiguous in the table */
+	for (i = 0; i < len; i++) {
+		acc = vmlaq_n_s32(acc, vldrhq_s32(b + i * oversample), a[i]);
+	}
+	vst1q_s32(accum, acc);
+
+	sum = MULT16_32_Q15(frac[0], accum[0]) + MULT16_32_Q15(frac[1], accum[1]) + MULT16_32_Q15(frac[2], accum[2]) + MULT16_32_Q15(frac[3], accum[3]);
+	return SATURATE32PSHR(sum, 15, 32767);
+}
+
+#elif defined(FIXED_POINT) && defined(__ARM_FEATURE_DSP)
+
+/* two samples at a time, the buffers are only 2 bytes aligned */
+static inline int32_t smlad_pair(const spx_word16_t *a, const spx_word16_t *b, int32_t acc)
+{
+	int32_t x;
+	int32_t y;
+
+	memcpy(&x, a, sizeof(x));
+	memcpy(&y, b, sizeof(y));
+	__asm__("smlad %0, %1, %2, %0" : "+r"(acc) : "r"(x), "r"(y));
+
+	return acc;
+}
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline spx_word32_t inner_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len)
+{
+	int32_t sum = 0;
+	unsigned int i;
+
+	for (i = 0; i + 4 <= len; i += 4) {
+		sum = smlad_pair(a + i, b + i, sum);
+		sum = smlad_pair(a + i + 2, b + i + 2, sum);
+	}
+	for (; i < len; i++) {
+		sum += MULT16_16(a[i], b[i]);
+	}
+
+	return SATURATE32PSHR(sum, 15, 32767);
+}
+
+#endif
@@ -94,6 +94,9 @@
 #include "../webserver/http_client.h"
 #include <protocols/webserver/http_err.h>
 #include <protocols/webclient.h>
+#ifdef CONFIG_TLS_SESSION_CACHE
+#include "mbedtls/tls_session_cache.h"
+#endif
 #if defined(CONFIG_NETUTILS_CODECS)
 #  if defined(CONFIG_CODECS_URLCODE)
 #    define WGET_USE_URLENCODE 1
@@ -220,7 +223,7 @@ const char *tlsname = "araweb_tls_client";
  ****************************************************************************/
 
 #ifdef CONFIG_NET_SECURITY_TLS
-static void wget_tls_release(struct http_client_tls_t *client);
+void wget_tls_release(struct http_client_tls_t *client);
 #endif
 
 /****************************************************************************
@@ -576,7 +579,7 @@ TLS_INIT_EXIT:
 	return result;
 }
 
-static void wget_tls_release(struct http_client_tls_t *client)
+void wget_tls_release(struct http_client_tls_t *client)
 {
 	if (client == NULL) {
 		return;
@@ -602,7 +605,7 @@ void wget_tls_ssl_release(struct http_client_tls_t *client)
 	mbedtls_ssl_free(&(client->tls_ssl));
 }
 
-int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname)
+int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname, int port)
 {
 	int result = 0;
 
@@ -641,15 +644,26 @@ int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname)
 	mbedtls_ssl_set_bio(&(client->tls_ssl), &(client->tls_client_fd),
 						mbedtls_net_send, mbedtls_net_recv, NULL);
 
+#ifdef CONFIG_TLS_SESSION_CACHE
+	tls_session_cache_set(&(client->tls_ssl), hostname, port);
+#endif
+
 	/* Handshake */
 	while ((result = mbedtls_ssl_handshake(&(client->tls_ssl))) != 0) {
 		if (result != MBEDTLS_ERR_SSL_WANT_READ &&
 			result != MBEDTLS_ERR_SSL_WANT_WRITE) {
 			printf("Error: TLS Handshake fail returned -%4x\n", -result);
+#ifdef CONFIG_TLS_SESSION_CACHE
+			tls_session_cache_remove(hostname, port);
+#endif
 			goto HANDSHAKE_FAIL;
 		}
 	}
 
+#ifdef CONFIG_TLS_SESSION_CACHE
+	tls_session_cache_update(&(client->tls_ssl), hostname, port);
+#endif
+
 	printf("TLS Handshake Success\n");
 
 	return 0;
@@ -992,7 +1006,7 @@ retry:
 	}
 
 	client_tls->client_fd = sockfd;
-	if (param->tls && (ret = wget_tls_handshake(client_tls, ws.hostname))) {
+	if (param->tls && (ret = wget_tls_handshake(client_tls, ws.hostname, ws.port))) {
 		if (handshake_retry-- > 0) {
 			if (ret == MBEDTLS_ERR_NET_SEND_FAILED ||
 				ret == MBEDTLS_ERR_NET_RECV_FAILED ||
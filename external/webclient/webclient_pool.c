@@ -0,0 +1,1313 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/* Connection pool of the HTTP client.
+ *
+ * One task owns the connections and sends the queued requests over them.
+ * A connection is kept after its requests per origin, until it has been
+ * idle for CONFIG_WEBCLIENT_POOL_IDLE_TIMEOUT seconds or the server closes
+ * it. An HTTP/1.1 connection carries one request at a time, an HTTP/2 one
+ * carries concurrent requests as streams.
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+#ifdef CONFIG_NET_LWIP_NETDB
+#include <netdb.h>
+#endif
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <netutils/netlib.h>
+#include <protocols/webclient.h>
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+#include <nghttp2/nghttp2.h>
+#endif
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+
+#define WGET_OK                    0
+#define WGET_ERR                   -1
+#define WGET_MSG_CONSTRUCT_ERR     -2
+#define WGET_SOCKET_CONNECT_ERR    -3
+
+#define POOL_TICK_MSEC             50
+#define POOL_RXBUF_SIZE            WEBCLIENT_CONF_MAX_MESSAGE_SIZE
+
+#define POOL_PROTO_HTTP1           0
+#define POOL_PROTO_HTTP2           1
+
+#define POOL_BUSY                  1
+
+/* States of the HTTP/1.1 response */
+#define H1_STATUS                  0
+#define H1_HEADERS                 1
+#define H1_BODY                    2	/* up to Content-Length */
+#define H1_BODY_EOF                3	/* up to the end of the connection */
+#define H1_CHUNK_SIZE              4
+#define H1_CHUNK_DATA              5
+#define H1_CHUNK_END               6	/* CRLF after the data of a chunk */
+#define H1_TRAILER                 7
+#define H1_DONE                    8
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct pool_req_s {
+	struct pool_req_s *next;
+	struct http_client_request_t *request;
+	struct http_client_response_t response;
+	wget_callback_t cb;
+	wget_done_callback_t done;
+	uint16_t port;
+	bool tls;
+	bool retried;
+	bool received;	/* part of the response came */
+	char hostname[CONFIG_WEBCLIENT_MAXHOSTNAME];
+	char filename[CONFIG_WEBCLIENT_MAXFILENAME];
+#ifdef CONFIG_NET_SECURITY_TLS
+	struct http_client_ssl_config_t ssl_config;
+#endif
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+	size_t sent;
+#endif
+};
+
+struct pool_conn_s {
+	int fd;	/* -1 when the slot is free */
+	int proto;
+	bool tls;
+	bool reused;
+	bool keepalive;
+	bool chunked;
+	uint16_t port;
+	char hostname[CONFIG_WEBCLIENT_MAXHOSTNAME];
+	clock_t idle_since;
+	struct pool_req_s *reqs;	/* requests in progress */
+	int nreqs;
+	char *rx;
+	int rxlen;
+	int state;	/* of the HTTP/1.1 response */
+	long remain;
+#ifdef CONFIG_NET_SECURITY_TLS
+	struct http_client_tls_t *tls_ctx;
+#endif
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+	nghttp2_session *h2;
+#endif
+};
+
+struct pool_s {
+	pthread_mutex_t lock;
+	sem_t wake;
+	bool started;
+	bool close_idle;
+	struct pool_req_s *head;
+	struct pool_req_s *tail;
+	struct pool_conn_s conns[CONFIG_WEBCLIENT_POOL_MAX_CONN];
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_SECURITY_TLS
+int webclient_tls_init(struct http_client_tls_t *client, struct http_client_ssl_config_t *ssl_config);
+int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname, int port);
+void wget_tls_ssl_release(struct http_client_tls_t *client);
+void wget_tls_release(struct http_client_tls_t *client);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct pool_s g_pool = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static const char *g_pool_methods[] = {"GET", "POST", "PUT", "DELETE"};
+
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+static const char *g_pool_alpn[] = {"h2", "http/1.1", NULL};
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void pool_enqueue(struct pool_req_s *preq, bool front)
+{
+	pthread_mutex_lock(&g_pool.lock);
+	if (front) {
+		preq->next = g_pool.head;
+		g_pool.head = preq;
+		if (g_pool.tail == NULL) {
+			g_pool.tail = preq;
+		}
+	} else {
+		preq->next = NULL;
+		if (g_pool.tail) {
+			g_pool.tail->next = preq;
+		} else {
+			g_pool.head = preq;
+		}
+		g_pool.tail = preq;
+	}
+	pthread_mutex_unlock(&g_pool.lock);
+}
+
+static struct pool_req_s *pool_dequeue(void)
+{
+	struct pool_req_s *preq;
+
+	pthread_mutex_lock(&g_pool.lock);
+	preq = g_pool.head;
+	if (preq) {
+		g_pool.head = preq->next;
+		if (g_pool.head == NULL) {
+			g_pool.tail = NULL;
+		}
+		preq->next = NULL;
+	}
+	pthread_mutex_unlock(&g_pool.lock);
+
+	return preq;
+}
+
+static void pool_req_finish(struct pool_req_s *preq, int result)
+{
+	struct http_client_request_t *request = preq->request;
+
+	http_client_response_release(&preq->response);
+	request->response = NULL;
+	request->async_flag = result;
+	preq->done(request, result);
+	free(preq);
+}
+
+static void pool_conn_detach(struct pool_conn_s *conn, struct pool_req_s *preq)
+{
+	struct pool_req_s **prev;
+
+	for (prev = &conn->reqs; *prev; prev = &(*prev)->next) {
+		if (*prev == preq) {
+			*prev = preq->next;
+			preq->next = NULL;
+			conn->nreqs--;
+			break;
+		}
+	}
+
+	if (conn->nreqs == 0) {
+		conn->reused = true;
+		conn->idle_since = clock();
+	}
+}
+
+/* A request which found a reused connection closed by the server before
+ * the response is sent again on a new one, once.
+ */
+static void pool_req_fail(struct pool_conn_s *conn, struct pool_req_s *preq)
+{
+	if (conn->reused && !preq->received && !preq->retried) {
+		preq->retried = true;
+		pool_enqueue(preq, true);
+		return;
+	}
+
+	pool_req_finish(preq, WGET_ERR);
+}
+
+static void pool_conn_close(struct pool_conn_s *conn)
+{
+	struct pool_req_s *preq;
+
+	while ((preq = conn->reqs) != NULL) {
+		conn->reqs = preq->next;
+		pool_req_fail(conn, preq);
+	}
+
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+	if (conn->h2) {
+		nghttp2_session_del(conn->h2);
+	}
+#endif
+#ifdef CONFIG_NET_SECURITY_TLS
+	if (conn->tls_ctx) {
+		wget_tls_ssl_release(conn->tls_ctx);
+		wget_tls_release(conn->tls_ctx);
+		free(conn->tls_ctx);
+	} else
+#endif
+	{
+		close(conn->fd);
+	}
+	free(conn->rx);
+
+	memset(conn, 0, sizeof(struct pool_conn_s));
+	conn->fd = -1;
+}
+
+static int pool_send(struct pool_conn_s *conn, const char *buf, int len)
+{
+#ifdef CONFIG_NET_SECURITY_TLS
+	if (conn->tls) {
+		return mbedtls_ssl_write(&conn->tls_ctx->tls_ssl, (const unsigned char *)buf, len);
+	}
+#endif
+	return send(conn->fd, buf, len, 0);
+}
+
+static int pool_send_all(struct pool_conn_s *conn, const char *buf, int len)
+{
+	int ret;
+
+	while (len > 0) {
+		ret = pool_send(conn, buf, len);
+		if (ret <= 0) {
+			return WGET_ERR;
+		}
+		buf += ret;
+		len -= ret;
+	}
+
+	return WGET_OK;
+}
+
+static int pool_recv(struct pool_conn_s *conn, char *buf, int len)
+{
+#ifdef CONFIG_NET_SECURITY_TLS
+	int ret;
+
+	if (conn->tls) {
+		ret = mbedtls_ssl_read(&conn->tls_ctx->tls_ssl, (unsigned char *)buf, len);
+		if (ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+			return 0;
+		}
+		return ret;
+	}
+#endif
+	return recv(conn->fd, buf, len, 0);
+}
+
+/* Records already decrypted by mbedtls are not seen by select() */
+static bool pool_pending(struct pool_conn_s *conn)
+{
+#ifdef CONFIG_NET_SECURITY_TLS
+	if (conn->tls) {
+		return mbedtls_ssl_get_bytes_avail(&conn->tls_ctx->tls_ssl) > 0;
+	}
+#endif
+	return false;
+}
+
+static bool pool_has_header(struct http_keyvalue_list_t *headers, const char *key)
+{
+	struct http_keyvalue_t *cur;
+
+	if (headers == NULL) {
+		return false;
+	}
+
+	for (cur = headers->head->next; cur != headers->tail; cur = cur->next) {
+		if (strcasecmp(cur->key, key) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void pool_deliver(struct pool_req_s *preq, const char *data, int len)
+{
+	preq->response.entity = (char *)data;
+	preq->response.entity_len = len;
+	if (preq->cb && len > 0) {
+		preq->cb(&preq->response);
+	}
+}
+
+/****************************************************************************
+ * HTTP/1.1
+ ****************************************************************************/
+
+static int pool_h1_construct(struct pool_req_s *preq, char *buf, int size)
+{
+	struct http_client_request_t *request = preq->request;
+	struct http_keyvalue_t *cur;
+	int entity_len = request->entity ? strlen(request->entity) : 0;
+	bool body = request->method == WGET_MODE_POST || request->method == WGET_MODE_PUT;
+	int len;
+
+	len = snprintf(buf, size, "%s %s HTTP/1.1\r\nHost: %s\r\n",
+				   g_pool_methods[request->method], preq->filename, preq->hostname);
+
+	if (body) {
+		if (!pool_has_header(request->headers, "Content-Type")) {
+			len += snprintf(buf + len, len < size ? size - len : 0, "Content-Type: application/x-www-form-urlencoded\r\n");
+		}
+		len += snprintf(buf + len, len < size ? size - len : 0, "Content-Length: %d\r\n", entity_len);
+	}
+
+	if (request->headers) {
+		for (cur = request->headers->head->next; cur != request->headers->tail; cur = cur->next) {
+			len += snprintf(buf + len, len < size ? size - len : 0, "%s: %s\r\n", cur->key, cur->value);
+		}
+	}
+	len += snprintf(buf + len, len < size ? size - len : 0, "\r\n");
+
+	if (body && entity_len > 0) {
+		if (len + entity_len < size) {
+			memcpy(buf + len, request->entity, entity_len);
+		}
+		len += entity_len;
+	}
+
+	if (len >= size) {
+		printf("Error: buffer is too small\n");
+		return WGET_MSG_CONSTRUCT_ERR;
+	}
+
+	return len;
+}
+
+static int pool_h1_send(struct pool_conn_s *conn, struct pool_req_s *preq)
+{
+	char *buf;
+	int len;
+	int ret;
+
+	buf = (char *)malloc(preq->request->buflen);
+	if (buf == NULL) {
+		printf("Error: Fail to malloc buffer\n");
+		return WGET_ERR;
+	}
+
+	len = pool_h1_construct(preq, buf, preq->request->buflen);
+	if (len < 0) {
+		free(buf);
+		return WGET_MSG_CONSTRUCT_ERR;
+	}
+
+	ret = pool_send_all(conn, buf, len);
+	free(buf);
+
+	return ret;
+}
+
+static int pool_h1_line(struct pool_conn_s *conn, struct pool_req_s *preq, char *line)
+{
+	struct http_client_response_t *response = &preq->response;
+	char *value;
+
+	switch (conn->state) {
+	case H1_STATUS:
+		if (strncmp(line, "HTTP/1.", 7) != 0 || strlen(line) < 12) {
+			return WGET_ERR;
+		}
+		response->status = atoi(line + 9);
+		strncpy(response->phrase, line + 12 + (line[12] == ' '), WEBCLIENT_CONF_MAX_PHRASE_SIZE - 1);
+		response->phrase[WEBCLIENT_CONF_MAX_PHRASE_SIZE - 1] = '\0';
+		conn->keepalive = line[7] != '0';
+		conn->chunked = false;
+		conn->remain = -1;
+		conn->state = H1_HEADERS;
+		break;
+
+	case H1_HEADERS:
+		if (*line != '\0') {
+			value = strchr(line, ':');
+			if (value == NULL) {
+				return WGET_ERR;
+			}
+			*value++ = '\0';
+			while (*value == ' ') {
+				value++;
+			}
+			http_keyvalue_list_add(response->headers, line, value);
+
+			if (strcasecmp(line, "Content-Length") == 0) {
+				conn->remain = strtol(value, NULL, 10);
+				response->total_len = conn->remain;
+			} else if (strcasecmp(line, "Transfer-Encoding") == 0 && strstr(value, "chunked")) {
+				conn->chunked = true;
+			} else if (strcasecmp(line, "Connection") == 0) {
+				conn->keepalive = strcasecmp(value, "close") != 0;
+			}
+			break;
+		}
+
+		/* End of the headers */
+		if (response->status / 100 == 1) {
+			conn->state = H1_STATUS;
+		} else if (response->status == 204 || response->status == 304) {
+			conn->state = H1_DONE;
+		} else if (conn->chunked) {
+			conn->state = H1_CHUNK_SIZE;
+		} else if (conn->remain > 0) {
+			conn->state = H1_BODY;
+		} else if (conn->remain == 0) {
+			conn->state = H1_DONE;
+		} else {
+			conn->keepalive = false;
+			conn->state = H1_BODY_EOF;
+		}
+		break;
+
+	case H1_CHUNK_SIZE:
+		conn->remain = strtol(line, NULL, 16);
+		conn->state = conn->remain > 0 ? H1_CHUNK_DATA : H1_TRAILER;
+		break;
+
+	case H1_CHUNK_END:
+		conn->state = H1_CHUNK_SIZE;
+		break;
+
+	case H1_TRAILER:
+		if (*line == '\0') {
+			conn->state = H1_DONE;
+		}
+		break;
+	}
+
+	return WGET_OK;
+}
+
+static int pool_h1_parse(struct pool_conn_s *conn, struct pool_req_s *preq)
+{
+	char *eol;
+	int pos = 0;
+	int len;
+
+	while (pos < conn->rxlen && conn->state != H1_DONE) {
+		len = conn->rxlen - pos;
+
+		switch (conn->state) {
+		case H1_BODY:
+		case H1_CHUNK_DATA:
+			if (len > conn->remain) {
+				len = conn->remain;
+			}
+			pool_deliver(preq, conn->rx + pos, len);
+			pos += len;
+			conn->remain -= len;
+			if (conn->remain == 0) {
+				conn->state = conn->state == H1_BODY ? H1_DONE : H1_CHUNK_END;
+			}
+			break;
+
+		case H1_BODY_EOF:
+			pool_deliver(preq, conn->rx + pos, len);
+			pos += len;
+			break;
+
+		default:
+			eol = memchr(conn->rx + pos, '\n', len);
+			if (eol == NULL) {
+				goto out;
+			}
+			*eol = '\0';
+			if (eol > conn->rx + pos && eol[-1] == '\r') {
+				eol[-1] = '\0';
+			}
+			if (pool_h1_line(conn, preq, conn->rx + pos) < 0) {
+				printf("Error: Parse message Fail\n");
+				return WGET_ERR;
+			}
+			pos = eol - conn->rx + 1;
+			break;
+		}
+	}
+
+out:
+	if (pos == 0 && conn->rxlen == POOL_RXBUF_SIZE) {
+		printf("Error: Too long header line\n");
+		return WGET_ERR;
+	}
+
+	/* A server does not send before the next request */
+	if (conn->state == H1_DONE && pos < conn->rxlen) {
+		conn->keepalive = false;
+	}
+
+	conn->rxlen -= pos;
+	memmove(conn->rx, conn->rx + pos, conn->rxlen);
+
+	return WGET_OK;
+}
+
+static void pool_h1_input(struct pool_conn_s *conn)
+{
+	struct pool_req_s *preq = conn->reqs;
+	int len;
+
+	len = pool_recv(conn, conn->rx + conn->rxlen, POOL_RXBUF_SIZE - conn->rxlen);
+	if (len <= 0 || preq == NULL) {
+		/* The end of the response, or an idle connection closed by the server */
+		if (len == 0 && preq && conn->state == H1_BODY_EOF) {
+			pool_conn_detach(conn, preq);
+			pool_req_finish(preq, WGET_OK);
+		}
+		pool_conn_close(conn);
+		return;
+	}
+
+	preq->received = true;
+	conn->rxlen += len;
+	if (pool_h1_parse(conn, preq) < 0) {
+		pool_conn_close(conn);
+		return;
+	}
+
+	if (conn->state == H1_DONE) {
+		pool_conn_detach(conn, preq);
+		pool_req_finish(preq, WGET_OK);
+		if (!conn->keepalive) {
+			pool_conn_close(conn);
+		}
+	}
+}
+
+static int pool_h1_submit(struct pool_conn_s *conn, struct pool_req_s *preq)
+{
+	int ret;
+
+	ret = pool_h1_send(conn, preq);
+	if (ret == WGET_MSG_CONSTRUCT_ERR) {
+		pool_req_finish(preq, WGET_ERR);
+		return WGET_OK;
+	}
+
+	preq->next = NULL;
+	conn->reqs = preq;
+	conn->nreqs = 1;
+	conn->rxlen = 0;
+	conn->state = H1_STATUS;
+
+	if (ret < 0) {
+		pool_conn_close(conn);
+	}
+
+	return WGET_OK;
+}
+
+/****************************************************************************
+ * HTTP/2
+ ****************************************************************************/
+
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+static ssize_t pool_h2_send_cb(nghttp2_session *session, const uint8_t *data, size_t length, int flags, void *user_data)
+{
+	struct pool_conn_s *conn = (struct pool_conn_s *)user_data;
+	int ret;
+
+	ret = pool_send(conn, (const char *)data, length);
+	if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+		return NGHTTP2_ERR_WOULDBLOCK;
+	} else if (ret <= 0) {
+		return NGHTTP2_ERR_CALLBACK_FAILURE;
+	}
+
+	return ret;
+}
+
+static int pool_h2_header_cb(nghttp2_session *session, const nghttp2_frame *frame,
+							 const uint8_t *name, size_t namelen,
+							 const uint8_t *value, size_t valuelen,
+							 uint8_t flags, void *user_data)
+{
+	struct pool_req_s *preq;
+
+	if (frame->hd.type != NGHTTP2_HEADERS) {
+		return 0;
+	}
+
+	preq = nghttp2_session_get_stream_user_data(session, frame->hd.stream_id);
+	if (preq == NULL) {
+		return 0;
+	}
+
+	preq->received = true;
+	if (strcmp((const char *)name, ":status") == 0) {
+		preq->response.status = atoi((const char *)value);
+	} else {
+		if (strcmp((const char *)name, "content-length") == 0) {
+			preq->response.total_len = strtol((const char *)value, NULL, 10);
+		}
+		http_keyvalue_list_add(preq->response.headers, (const char *)name, (const char *)value);
+	}
+
+	return 0;
+}
+
+static int pool_h2_data_cb(nghttp2_session *session, uint8_t flags, int32_t stream_id,
+						   const uint8_t *data, size_t len, void *user_data)
+{
+	struct pool_req_s *preq;
+
+	preq = nghttp2_session_get_stream_user_data(session, stream_id);
+	if (preq) {
+		pool_deliver(preq, (const char *)data, len);
+	}
+
+	return 0;
+}
+
+static int pool_h2_close_cb(nghttp2_session *session, int32_t stream_id,
+							uint32_t error_code, void *user_data)
+{
+	struct pool_conn_s *conn = (struct pool_conn_s *)user_data;
+	struct pool_req_s *preq;
+
+	preq = nghttp2_session_get_stream_user_data(session, stream_id);
+	if (preq == NULL) {
+		return 0;
+	}
+
+	pool_conn_detach(conn, preq);
+	if (error_code == NGHTTP2_REFUSED_STREAM && !preq->received && !preq->retried) {
+		/* Refused by a GOAWAY or the limit of streams: send again */
+		preq->retried = true;
+		pool_enqueue(preq, true);
+		return 0;
+	}
+
+	pool_req_finish(preq, error_code == NGHTTP2_NO_ERROR ? WGET_OK : WGET_ERR);
+
+	return 0;
+}
+
+static ssize_t pool_h2_read_cb(nghttp2_session *session, int32_t stream_id, uint8_t *buf,
+							   size_t length, uint32_t *data_flags,
+							   nghttp2_data_source *source, void *user_data)
+{
+	struct pool_req_s *preq = (struct pool_req_s *)source->ptr;
+	size_t total = strlen(preq->request->entity);
+	size_t len = total - preq->sent;
+
+	if (len > length) {
+		len = length;
+	}
+	memcpy(buf, preq->request->entity + preq->sent, len);
+	preq->sent += len;
+	if (preq->sent == total) {
+		*data_flags |= NGHTTP2_DATA_FLAG_EOF;
+	}
+
+	return len;
+}
+
+static int pool_h2_init(struct pool_conn_s *conn)
+{
+	nghttp2_session_callbacks *callbacks;
+	nghttp2_settings_entry iv[] = {
+		{NGHTTP2_SETTINGS_ENABLE_PUSH, 0},
+	};
+	int ret;
+
+	if (nghttp2_session_callbacks_new(&callbacks) != 0) {
+		return WGET_ERR;
+	}
+	nghttp2_session_callbacks_set_send_callback(callbacks, pool_h2_send_cb);
+	nghttp2_session_callbacks_set_on_header_callback(callbacks, pool_h2_header_cb);
+	nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks, pool_h2_data_cb);
+	nghttp2_session_callbacks_set_on_stream_close_callback(callbacks, pool_h2_close_cb);
+
+	ret = nghttp2_session_client_new(&conn->h2, callbacks, conn);
+	nghttp2_session_callbacks_del(callbacks);
+	if (ret != 0) {
+		conn->h2 = NULL;
+		return WGET_ERR;
+	}
+
+	if (nghttp2_submit_settings(conn->h2, NGHTTP2_FLAG_NONE, iv, sizeof(iv) / sizeof(iv[0])) != 0 ||
+		nghttp2_session_send(conn->h2) != 0) {
+		return WGET_ERR;
+	}
+
+	return WGET_OK;
+}
+
+static bool pool_h2_available(struct pool_conn_s *conn)
+{
+	uint32_t max = nghttp2_session_get_remote_settings(conn->h2, NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS);
+
+	if (max > CONFIG_WEBCLIENT_POOL_MAX_STREAMS) {
+		max = CONFIG_WEBCLIENT_POOL_MAX_STREAMS;
+	}
+
+	return conn->nreqs < max && nghttp2_session_check_request_allowed(conn->h2);
+}
+
+#define POOL_NV(nv, n, v, vlen) \
+	do { \
+		(nv)->name = (uint8_t *)(n); \
+		(nv)->value = (uint8_t *)(v); \
+		(nv)->namelen = strlen(n); \
+		(nv)->valuelen = (vlen); \
+		(nv)->flags = NGHTTP2_NV_FLAG_NONE; \
+	} while (0)
+
+static int pool_h2_submit(struct pool_conn_s *conn, struct pool_req_s *preq)
+{
+	struct http_client_request_t *request = preq->request;
+	struct http_keyvalue_t *cur;
+	nghttp2_data_provider data_prd;
+	nghttp2_nv *nva;
+	char authority[CONFIG_WEBCLIENT_MAXHOSTNAME + 8];
+	char length[12];
+	char *names = NULL;
+	char *name;
+	int nheaders = 0;
+	int namelen = 0;
+	int nv = 0;
+	int32_t stream_id;
+	bool body = request->method == WGET_MODE_POST || request->method == WGET_MODE_PUT;
+	int entity_len = body && request->entity ? strlen(request->entity) : 0;
+
+	if (request->headers) {
+		for (cur = request->headers->head->next; cur != request->headers->tail; cur = cur->next) {
+			nheaders++;
+			namelen += strlen(cur->key) + 1;
+		}
+	}
+
+	/* Pseudo headers, content-type and content-length */
+	nva = (nghttp2_nv *)malloc(sizeof(nghttp2_nv) * (nheaders + 6));
+	if (namelen > 0) {
+		names = (char *)malloc(namelen);
+	}
+	if (nva == NULL || (namelen > 0 && names == NULL)) {
+		free(nva);
+		free(names);
+		pool_req_finish(preq, WGET_ERR);
+		return WGET_OK;
+	}
+
+	if (preq->port == 443) {
+		snprintf(authority, sizeof(authority), "%s", preq->hostname);
+	} else {
+		snprintf(authority, sizeof(authority), "%s:%u", preq->hostname, preq->port);
+	}
+
+	POOL_NV(&nva[nv++], ":method", g_pool_methods[request->method], strlen(g_pool_methods[request->method]));
+	POOL_NV(&nva[nv++], ":scheme", "https", 5);
+	POOL_NV(&nva[nv++], ":authority", authority, strlen(authority));
+	POOL_NV(&nva[nv++], ":path", preq->filename, strlen(preq->filename));
+
+	if (body) {
+		if (!pool_has_header(request->headers, "Content-Type")) {
+			POOL_NV(&nva[nv++], "content-type", "application/x-www-form-urlencoded", 33);
+		}
+		snprintf(length, sizeof(length), "%d", entity_len);
+		POOL_NV(&nva[nv++], "content-length", length, strlen(length));
+	}
+
+	/* Header names are lowercase in HTTP/2 */
+	name = names;
+	if (request->headers) {
+		for (cur = request->headers->head->next; cur != request->headers->tail; cur = cur->next) {
+			int i;
+
+			for (i = 0; cur->key[i]; i++) {
+				name[i] = tolower((unsigned char)cur->key[i]);
+			}
+			name[i] = '\0';
+			POOL_NV(&nva[nv++], name, cur->value, strlen(cur->value));
+			name += i + 1;
+		}
+	}
+
+	preq->sent = 0;
+	data_prd.source.ptr = preq;
+	data_prd.read_callback = pool_h2_read_cb;
+
+	stream_id = nghttp2_submit_request(conn->h2, NULL, nva, nv, entity_len > 0 ? &data_prd : NULL, preq);
+	free(nva);
+	free(names);
+	if (stream_id < 0) {
+		printf("Error: nghttp2_submit_request returned %d\n", stream_id);
+		pool_req_finish(preq, WGET_ERR);
+		return WGET_OK;
+	}
+
+	preq->next = conn->reqs;
+	conn->reqs = preq;
+	conn->nreqs++;
+
+	if (nghttp2_session_send(conn->h2) != 0) {
+		pool_conn_close(conn);
+	}
+
+	return WGET_OK;
+}
+
+static void pool_h2_input(struct pool_conn_s *conn)
+{
+	int len;
+
+	len = pool_recv(conn, conn->rx, POOL_RXBUF_SIZE);
+	if (len <= 0) {
+		pool_conn_close(conn);
+		return;
+	}
+
+	if (nghttp2_session_mem_recv(conn->h2, (const uint8_t *)conn->rx, len) < 0 ||
+		nghttp2_session_send(conn->h2) != 0 ||
+		(!nghttp2_session_want_read(conn->h2) && !nghttp2_session_want_write(conn->h2))) {
+		pool_conn_close(conn);
+	}
+}
+#endif /* CONFIG_WEBCLIENT_POOL_HTTP2 */
+
+/****************************************************************************
+ * Connections
+ ****************************************************************************/
+
+static int pool_gethostip(const char *hostname, in_addr_t *ipv4addr)
+{
+#ifdef CONFIG_NET_LWIP_NETDB
+	struct hostent *he;
+
+	he = gethostbyname(hostname);
+	if (he == NULL || he->h_addrtype != AF_INET) {
+		return -ENOENT;
+	}
+
+	memcpy(ipv4addr, he->h_addr, sizeof(in_addr_t));
+	return OK;
+#else
+	*ipv4addr = inet_addr(hostname);
+	return *ipv4addr == INADDR_NONE ? -ENOENT : OK;
+#endif
+}
+
+static int pool_conn_open(struct pool_conn_s *conn, struct pool_req_s *preq)
+{
+	struct sockaddr_in server;
+	struct timeval tv;
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+	const char *alpn;
+#endif
+	int fd;
+
+	server.sin_family = AF_INET;
+	server.sin_port = htons(preq->port);
+	if (pool_gethostip(preq->hostname, &server.sin_addr.s_addr) < 0) {
+		printf("ERROR: Failed to resolve hostname\n");
+		return WGET_SOCKET_CONNECT_ERR;
+	}
+
+	fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (fd < 0) {
+		return WGET_SOCKET_CONNECT_ERR;
+	}
+
+	tv.tv_sec = WEBCLIENT_CONF_TIMEOUT_MSEC / 1000;
+	tv.tv_usec = (WEBCLIENT_CONF_TIMEOUT_MSEC % 1000) * 1000;
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(struct timeval));
+
+	if (connect(fd, (struct sockaddr *)&server, sizeof(struct sockaddr_in)) < 0) {
+		printf("ERROR: connect failed: errno: %d\n", errno);
+		close(fd);
+		return WGET_SOCKET_CONNECT_ERR;
+	}
+
+	conn->fd = fd;
+	conn->proto = POOL_PROTO_HTTP1;
+	conn->tls = preq->tls;
+	conn->port = preq->port;
+	strncpy(conn->hostname, preq->hostname, CONFIG_WEBCLIENT_MAXHOSTNAME);
+
+	conn->rx = (char *)malloc(POOL_RXBUF_SIZE);
+	if (conn->rx == NULL) {
+		goto errout;
+	}
+
+#ifdef CONFIG_NET_SECURITY_TLS
+	if (conn->tls) {
+		conn->tls_ctx = (struct http_client_tls_t *)malloc(sizeof(struct http_client_tls_t));
+		if (conn->tls_ctx == NULL) {
+			goto errout;
+		}
+		if (webclient_tls_init(conn->tls_ctx, &preq->ssl_config) != 0) {
+			free(conn->tls_ctx);
+			conn->tls_ctx = NULL;
+			goto errout;
+		}
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+		mbedtls_ssl_conf_alpn_protocols(&conn->tls_ctx->tls_conf, g_pool_alpn);
+#endif
+		conn->tls_ctx->client_fd = fd;
+		if (wget_tls_handshake(conn->tls_ctx, preq->hostname, preq->port) != 0) {
+			goto errout;
+		}
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+		alpn = mbedtls_ssl_get_alpn_protocol(&conn->tls_ctx->tls_ssl);
+		if (alpn && strcmp(alpn, "h2") == 0) {
+			conn->proto = POOL_PROTO_HTTP2;
+			if (pool_h2_init(conn) < 0) {
+				goto errout;
+			}
+		}
+#endif
+	}
+#endif
+
+	return WGET_OK;
+
+errout:
+	pool_conn_close(conn);
+	return WGET_ERR;
+}
+
+static void pool_conn_input(struct pool_conn_s *conn)
+{
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+	if (conn->proto == POOL_PROTO_HTTP2) {
+		pool_h2_input(conn);
+		return;
+	}
+#endif
+	pool_h1_input(conn);
+}
+
+static int pool_conn_submit(struct pool_conn_s *conn, struct pool_req_s *preq)
+{
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+	if (conn->proto == POOL_PROTO_HTTP2) {
+		return pool_h2_submit(conn, preq);
+	}
+#endif
+	return pool_h1_submit(conn, preq);
+}
+
+static bool pool_conn_available(struct pool_conn_s *conn)
+{
+#ifdef CONFIG_WEBCLIENT_POOL_HTTP2
+	if (conn->proto == POOL_PROTO_HTTP2) {
+		return pool_h2_available(conn);
+	}
+#endif
+	return conn->nreqs == 0;
+}
+
+/* Send on a connection of the origin, or open one. POOL_BUSY when all
+ * connections are in use.
+ */
+static int pool_dispatch(struct pool_req_s *preq)
+{
+	struct pool_conn_s *conn;
+	struct pool_conn_s *slot = NULL;
+	struct pool_conn_s *idle = NULL;
+	int i;
+
+	for (i = 0; i < CONFIG_WEBCLIENT_POOL_MAX_CONN; i++) {
+		conn = &g_pool.conns[i];
+		if (conn->fd < 0) {
+			if (slot == NULL) {
+				slot = conn;
+			}
+			continue;
+		}
+		if (conn->tls == preq->tls && conn->port == preq->port &&
+			strcmp(conn->hostname, preq->hostname) == 0) {
+			if (pool_conn_available(conn)) {
+				return pool_conn_submit(conn, preq);
+			}
+			/* An HTTP/2 connection going away */
+			if (conn->nreqs == 0) {
+				pool_conn_close(conn);
+				if (slot == NULL) {
+					slot = conn;
+				}
+			}
+		} else if (conn->nreqs == 0 && idle == NULL) {
+			idle = conn;
+		}
+	}
+
+	/* An idle connection to another origin makes room */
+	if (slot == NULL && idle != NULL) {
+		pool_conn_close(idle);
+		slot = idle;
+	}
+	if (slot == NULL) {
+		return POOL_BUSY;
+	}
+
+	if (pool_conn_open(slot, preq) < 0) {
+		pool_req_finish(preq, WGET_ERR);
+		return WGET_OK;
+	}
+
+	return pool_conn_submit(slot, preq);
+}
+
+static void pool_close_idle(bool all)
+{
+	struct pool_conn_s *conn;
+	clock_t now = clock();
+	int i;
+
+	for (i = 0; i < CONFIG_WEBCLIENT_POOL_MAX_CONN; i++) {
+		conn = &g_pool.conns[i];
+		if (conn->fd >= 0 && conn->nreqs == 0 &&
+			(all || now - conn->idle_since >= CONFIG_WEBCLIENT_POOL_IDLE_TIMEOUT * CLOCKS_PER_SEC)) {
+			pool_conn_close(conn);
+		}
+	}
+}
+
+static void pool_wait(void)
+{
+	struct pool_conn_s *conn;
+	struct timespec abstime;
+	fd_set rfds;
+	struct timeval tv = {0, POOL_TICK_MSEC * 1000};
+	bool busy = false;
+	bool open = false;
+	int maxfd = -1;
+	int i;
+
+	FD_ZERO(&rfds);
+	for (i = 0; i < CONFIG_WEBCLIENT_POOL_MAX_CONN; i++) {
+		conn = &g_pool.conns[i];
+		if (conn->fd < 0) {
+			continue;
+		}
+		open = true;
+		if (conn->nreqs > 0) {
+			busy = true;
+		}
+		if (pool_pending(conn)) {
+			tv.tv_usec = 0;
+		}
+		FD_SET(conn->fd, &rfds);
+		if (conn->fd > maxfd) {
+			maxfd = conn->fd;
+		}
+	}
+
+	if (!busy) {
+		/* Nothing to receive: sleep until a request comes or the idle
+		 * connections expire.
+		 */
+		if (!open) {
+			sem_wait(&g_pool.wake);
+		} else {
+			clock_gettime(CLOCK_REALTIME, &abstime);
+			abstime.tv_sec += CONFIG_WEBCLIENT_POOL_IDLE_TIMEOUT;
+			sem_timedwait(&g_pool.wake, &abstime);
+		}
+		return;
+	}
+
+	if (select(maxfd + 1, &rfds, NULL, NULL, &tv) < 0) {
+		FD_ZERO(&rfds);
+	}
+
+	for (i = 0; i < CONFIG_WEBCLIENT_POOL_MAX_CONN; i++) {
+		conn = &g_pool.conns[i];
+		if (conn->fd >= 0 && (FD_ISSET(conn->fd, &rfds) || pool_pending(conn))) {
+			pool_conn_input(conn);
+		}
+	}
+
+	while (sem_trywait(&g_pool.wake) == 0) {
+	}
+}
+
+static pthread_addr_t pool_task(void *arg)
+{
+	struct pool_req_s *preq;
+	bool close_idle;
+
+	while (1) {
+		while ((preq = pool_dequeue()) != NULL) {
+			if (pool_dispatch(preq) == POOL_BUSY) {
+				pool_enqueue(preq, true);
+				break;
+			}
+		}
+
+		pthread_mutex_lock(&g_pool.lock);
+		close_idle = g_pool.close_idle;
+		g_pool.close_idle = false;
+		pthread_mutex_unlock(&g_pool.lock);
+		pool_close_idle(close_idle);
+
+		pool_wait();
+	}
+
+	return NULL;
+}
+
+/* Called with the lock held */
+static int pool_start(void)
+{
+	pthread_attr_t attr;
+	pthread_t tid;
+	int i;
+
+	if (g_pool.started) {
+		return WGET_OK;
+	}
+
+	for (i = 0; i < CONFIG_WEBCLIENT_POOL_MAX_CONN; i++) {
+		g_pool.conns[i].fd = -1;
+	}
+	sem_init(&g_pool.wake, 0, 0);
+
+	if (pthread_attr_init(&attr) != 0) {
+		goto errout;
+	}
+	pthread_attr_setstacksize(&attr, CONFIG_WEBCLIENT_POOL_STACKSIZE);
+	if (pthread_create(&tid, &attr, pool_task, NULL) != 0) {
+		goto errout;
+	}
+	pthread_setname_np(tid, "webclient pool");
+	pthread_detach(tid);
+
+	g_pool.started = true;
+	return WGET_OK;
+
+errout:
+	printf("Error: Cannot create thread!!\n");
+	sem_destroy(&g_pool.wake);
+	return WGET_ERR;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int http_client_send_request_pool(struct http_client_request_t *request,
+								  void *ssl_config,
+								  wget_callback_t cb,
+								  wget_done_callback_t done)
+{
+	struct pool_req_s *preq;
+	int ret;
+
+	if (request == NULL || request->url == NULL || done == NULL) {
+		printf("Error: Request is null\n");
+		return WGET_ERR;
+	}
+
+	if (request->method < WGET_MODE_GET || request->method > WGET_MODE_DELETE) {
+		printf("Error: Incorrect method value!!\n");
+		return WGET_ERR;
+	}
+
+	if (request->buflen <= 0) {
+		printf("Error: Buffer length must be bigger than 0!!\n");
+		return WGET_ERR;
+	}
+
+	if (request->entity && WEBCLIENT_CONF_MAX_ENTITY_SIZE < strlen(request->entity)) {
+		printf("Error: Too small buffer size\n");
+		return WGET_ERR;
+	}
+
+	preq = (struct pool_req_s *)calloc(1, sizeof(struct pool_req_s));
+	if (preq == NULL) {
+		return WGET_ERR;
+	}
+
+	if (netlib_parsehttpurl(request->url, &preq->port, preq->hostname, CONFIG_WEBCLIENT_MAXHOSTNAME,
+							preq->filename, CONFIG_WEBCLIENT_MAXFILENAME) != 0) {
+		printf("ERROR: Malformed HTTP URL: %s\n", request->url);
+		free(preq);
+		return WGET_ERR;
+	}
+
+#ifdef CONFIG_NET_SECURITY_TLS
+	if (ssl_config) {
+		preq->tls = true;
+		memcpy(&preq->ssl_config, ssl_config, sizeof(struct http_client_ssl_config_t));
+	}
+#endif
+
+	if (http_client_response_init(&preq->response) < 0) {
+		free(preq);
+		return WGET_ERR;
+	}
+	preq->response.method = request->method;
+	preq->response.url = request->url;
+	preq->request = request;
+	preq->cb = cb;
+	preq->done = done;
+
+	request->callback = cb;
+	request->tls = preq->tls;
+	request->response = &preq->response;
+	request->async_flag = 1;
+
+	pthread_mutex_lock(&g_pool.lock);
+	ret = pool_start();
+	pthread_mutex_unlock(&g_pool.lock);
+	if (ret < 0) {
+		request->response = NULL;
+		http_client_response_release(&preq->response);
+		free(preq);
+		return WGET_ERR;
+	}
+
+	pool_enqueue(preq, false);
+	sem_post(&g_pool.wake);
+
+	return WGET_OK;
+}
+
+void http_client_pool_close(void)
+{
+	pthread_mutex_lock(&g_pool.lock);
+	if (!g_pool.started) {
+		pthread_mutex_unlock(&g_pool.lock);
+		return;
+	}
+	g_pool.close_idle = true;
+	pthread_mutex_unlock(&g_pool.lock);
+
+	sem_post(&g_pool.wake);
+}
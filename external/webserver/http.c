@@ -33,6 +33,7 @@
 #define HTTP_LISTENING_HANDLER_STACKSIZE (1024 * 4)
 #define HTTP_CLIENT_HANDLER_STACKSIZE    (1024 * 4)
 #define HTTPS_CLIENT_HANDLER_STACKSIZE    (1024 * 8)
+#define HTTP_EVENT_HANDLER_STACKSIZE     (1024 * 6)
 
 int http_server_mq_flush(mqd_t msg_q)
 {
@@ -85,19 +86,8 @@ int http_server_mq_close(int port)
 	return mq_unlink(msg_name);
 }
 
-pthread_addr_t http_server_handler(pthread_addr_t arg)
+int http_server_listen(struct http_server_t *server)
 {
-	fd_set readfds;
-	int fdcnt = 0;
-	int fdarr[MAX_ACCEPTED_FD] = {0,};
-	mqd_t msg_q;
-	struct http_msg_t msg;
-	socklen_t addrlen;
-	int sock_fd, ret, cnt, i, maxfd = 0;
-	struct timeval tv, accept_to;
-	struct sockaddr_in client_addr;
-	struct mq_attr mqattr;
-	struct http_server_t *server = (struct http_server_t *)arg;
 	int reuse = 1;
 
 	/*
@@ -107,7 +97,7 @@ pthread_addr_t http_server_handler(pthread_addr_t arg)
 	server->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
 	if (server->listen_fd < 0) {
 		HTTP_LOGE("Error: Cannot create socket!!\n");
-		return NULL;
+		return HTTP_ERROR;
 	}
 
 	if (setsockopt(server->listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) < 0) {
@@ -121,15 +111,38 @@ pthread_addr_t http_server_handler(pthread_addr_t arg)
 	if (bind(server->listen_fd, (struct sockaddr *)&(server->servaddr), sizeof(struct sockaddr_in)) < 0) {
 		HTTP_LOGE("Error: Cannot socket bind!!\n");
 		close(server->listen_fd);
-		return NULL;
+		server->listen_fd = -1;
+		return HTTP_ERROR;
 	}
 
 	if (listen(server->listen_fd, HTTP_CONF_MAX_CLIENT) < 0) {
 		HTTP_LOGE("Error: Cannot listen!!\n");
 		close(server->listen_fd);
-		return NULL;
+		server->listen_fd = -1;
+		return HTTP_ERROR;
 	}
 
+	return HTTP_OK;
+}
+
+#ifndef CONFIG_NETUTILS_WEBSERVER_EVENT
+pthread_addr_t http_server_handler(pthread_addr_t arg)
+{
+	fd_set readfds;
+	int fdcnt = 0;
+	int fdarr[MAX_ACCEPTED_FD] = {0,};
+	mqd_t msg_q;
+	struct http_msg_t msg;
+	socklen_t addrlen;
+	int sock_fd, ret, cnt, i, maxfd = 0;
+	struct timeval tv, accept_to;
+	struct sockaddr_in client_addr;
+	struct mq_attr mqattr;
+	struct http_server_t *server = (struct http_server_t *)arg;
+
+	if (http_server_listen(server) != HTTP_OK) {
+		return NULL;
+	}
 
 	if ((msg_q = http_server_mq_open(server->port)) == NULL) {
 		HTTP_LOGE("msg queue open fail in http_server_handler %d\n" , server->port);
@@ -268,13 +281,16 @@ stop:
 	server->state = HTTP_SERVER_STOP;
 	return NULL;
 }
+#endif
 
 
 int http_server_start(struct http_server_t *server)
 {
 	pthread_attr_t attr;
+#ifndef CONFIG_NETUTILS_WEBSERVER_EVENT
 	unsigned int cli_handle_stack = HTTP_CLIENT_HANDLER_STACKSIZE;
 	int i;
+#endif
 
 	if (server == NULL) {
 		HTTP_LOGE("Error: Server must be initialized before start");
@@ -286,6 +302,19 @@ int http_server_start(struct http_server_t *server)
 		return HTTP_ERROR;
 	}
 	pthread_attr_setschedpolicy(&attr, SCHED_RR);
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT
+	/* One thread accepts and serves all the clients */
+
+	pthread_attr_setstacksize(&attr, HTTP_EVENT_HANDLER_STACKSIZE);
+
+	if (pthread_create(&server->tid, &attr, http_server_event_handler, (void *)server) != 0) {
+		HTTP_LOGE("Error: Cannot create server thread!!\n");
+		return HTTP_ERROR;
+	}
+	pthread_setname_np(server->tid, "event webserver");
+	pthread_detach(server->tid);
+#else
 	pthread_attr_setstacksize(&attr, HTTP_LISTENING_HANDLER_STACKSIZE);
 
 	if (pthread_create(&server->tid, &attr, http_server_handler, (void *)server) != 0) {
@@ -315,6 +344,7 @@ int http_server_start(struct http_server_t *server)
 		pthread_setname_np(server->c_tid[i], "client handler");
 		pthread_detach(server->c_tid[i]);
 	}
+#endif
 
 	return HTTP_OK;
 }
@@ -19,6 +19,7 @@
 #ifndef __http_h__
 #define __http_h__
 
+#include <pthread.h>
 #include <mqueue.h>
 
 #ifdef CONFIG_ENDIAN_BIG
@@ -47,4 +48,11 @@ struct http_msg_t {
 int http_server_mq_flush(mqd_t msg_q);
 mqd_t http_server_mq_open(int port);
 int http_server_mq_close(int port);
+
+struct http_server_t;
+
+int http_server_listen(struct http_server_t *server);
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT
+pthread_addr_t http_server_event_handler(pthread_addr_t arg);
+#endif
 #endif
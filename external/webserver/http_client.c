@@ -16,7 +16,9 @@
  *
  ****************************************************************************/
 
+#include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <protocols/webserver/http_err.h>
 #include <protocols/webserver/http_keyvalue_list.h>
 #include <protocols/webclient.h>
@@ -921,6 +923,30 @@ static int prepare_chunk_body(char *buf, unsigned int len, const char *body, uns
 	return buflen;
 }
 
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT
+/* The sockets of the event mode are non-blocking.  A full send buffer waits
+ * for the socket to be writable, so that the callbacks still send their
+ * responses in one call.
+ */
+static int http_wait_writable(struct http_client_t *client)
+{
+	struct pollfd fds;
+
+	if (errno != EWOULDBLOCK && errno != EAGAIN) {
+		return -1;
+	}
+
+	memset(&fds, 0, sizeof(fds));
+	fds.fd = client->client_fd;
+	fds.events = POLLOUT;
+	if (poll(&fds, 1, HTTP_CONF_SOCKET_TIMEOUT_MSEC) <= 0) {
+		return -1;
+	}
+
+	return 0;
+}
+#endif
+
 static int http_send_chunk_buffer(struct http_client_t *client, char *buf, int len)
 {
 	int ret = 0;
@@ -945,6 +971,11 @@ static int http_send_chunk_buffer(struct http_client_t *client, char *buf, int l
 		}
 
 		if (ret < 1) {
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT
+			if (ret < 0 && http_wait_writable(client) == 0) {
+				continue;
+			}
+#endif
 			HTTP_LOGE("Fail to send buffer ret[%d] \n", ret);
 			return -1;
 		} else {
@@ -1096,6 +1127,11 @@ static int http_send_buffer(struct http_client_t *client, const char *buf, int l
 		}
 
 		if (send_byte < 1) {
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT
+			if (send_byte < 0 && http_wait_writable(client) == 0) {
+				continue;
+			}
+#endif
 			HTTP_LOGE("Fail to send buffer send_byte[%d] errno[%d] \n", send_byte, errno);
 			return -1;
 		} else {
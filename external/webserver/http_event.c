@@ -0,0 +1,693 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * external/webserver/http_event.c
+ *
+ * Event driven mode of the webserver.  One thread serves all the clients of
+ * a server with non-blocking sockets and poll(), in place of the listening
+ * thread and the pool of client handler threads:
+ *
+ *   - Each connection has a receive buffer, where the requests are framed
+ *     by the end of their header and their Content-Length.  The complete
+ *     requests are parsed and dispatched in order, so pipelined requests
+ *     are served from one read.
+ *   - The connections are persistent with HTTP/1.1 unless the client asks
+ *     "Connection: close", and with "Connection: Keep-Alive" on HTTP/1.0.
+ *     They are closed after their keep-alive timeout without activity.
+ *   - With CONFIG_NETUTILS_WEBSERVER_EVENT_DOCROOT, a GET of a regular file
+ *     under the document root is answered from the file, a window at a time
+ *     when the socket is writable, without loading the file in memory.
+ *
+ * The callbacks send their responses with http_send_response() as in the
+ * threaded mode, which waits for the socket when its send buffer is full.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include <protocols/webserver/http_err.h>
+#include <protocols/webserver/http_server.h>
+#include <protocols/webserver/http_keyvalue_list.h>
+
+#include "http.h"
+#include "http_client.h"
+#include "http_query.h"
+#include "http_string_util.h"
+#include "http_arch.h"
+#include "http_log.h"
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define HTTP_EVENT_MAX_CONN     CONFIG_NETUTILS_WEBSERVER_EVENT_MAX_CONN
+#define HTTP_EVENT_RXBUF_LEN    HTTP_CONF_MAX_REQUEST_LENGTH
+#define HTTP_EVENT_WINDOW_LEN   1024
+#define HTTP_EVENT_HEADER_LEN   160
+
+/* Poll timeout, which is also the latency of http_server_stop() */
+
+#define HTTP_EVENT_POLL_MSEC    100
+
+/* Framing errors of a request */
+
+#define HTTP_EVENT_TOO_LARGE    (-1)
+#define HTTP_EVENT_CHUNKED      (-2)
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define HTTP_EVENT_CLOCK        CLOCK_MONOTONIC
+#else
+#define HTTP_EVENT_CLOCK        CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum http_conn_state_e {
+	HTTP_CONN_RECV,				/* Reading and serving the requests */
+	HTTP_CONN_FILE,				/* Sending a file response */
+};
+
+struct http_conn_s {
+	struct http_client_t *client;	/* NULL for a free slot */
+	enum http_conn_state_e state;
+	uint32_t client_ip;
+	time_t last;				/* Time of the last activity */
+
+	char *rxbuf;				/* Received bytes, not served yet */
+	int rxlen;
+
+	int file_fd;				/* File of the response in HTTP_CONN_FILE */
+	off_t file_off;
+	off_t file_len;
+	char header[HTTP_EVENT_HEADER_LEN];	/* Header of the file response */
+	int header_len;
+	int header_off;
+};
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_DOCROOT
+struct http_mime_s {
+	const char *ext;
+	const char *type;
+};
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_DOCROOT
+static const struct http_mime_s g_http_mime[] = {
+	{ "html", "text/html" },
+	{ "htm",  "text/html" },
+	{ "css",  "text/css" },
+	{ "js",   "application/javascript" },
+	{ "json", "application/json" },
+	{ "txt",  "text/plain" },
+	{ "png",  "image/png" },
+	{ "jpg",  "image/jpeg" },
+	{ "gif",  "image/gif" },
+	{ "svg",  "image/svg+xml" },
+	{ "ico",  "image/x-icon" },
+};
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static time_t http_event_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(HTTP_EVENT_CLOCK, &ts);
+	return ts.tv_sec;
+}
+
+static int http_event_nonblock(int fd)
+{
+	int flags = fcntl(fd, F_GETFL, 0);
+
+	if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+		return HTTP_ERROR;
+	}
+
+	return HTTP_OK;
+}
+
+static bool http_event_again(void)
+{
+	return errno == EWOULDBLOCK || errno == EAGAIN;
+}
+
+static void http_event_close(struct http_conn_s *conn)
+{
+	HTTP_LOGD("Client %d closing.\n", conn->client->client_fd);
+
+	if (conn->file_fd >= 0) {
+		close(conn->file_fd);
+		conn->file_fd = -1;
+	}
+
+	HTTP_FREE(conn->rxbuf);
+	conn->rxbuf = NULL;
+	http_close_client(conn->client);
+	conn->client = NULL;
+}
+
+static void http_event_accept(struct http_server_t *server, struct http_conn_s *conns)
+{
+	struct sockaddr_in client_addr;
+	socklen_t addrlen;
+	struct http_conn_s *conn;
+	int sock_fd;
+	int i;
+
+	while (1) {
+		addrlen = sizeof(struct sockaddr_in);
+		sock_fd = accept(server->listen_fd, (struct sockaddr *)&client_addr, &addrlen);
+		if (sock_fd < 0) {
+			if (!http_event_again()) {
+				HTTP_LOGE("Error: Accept client error!!\n");
+			}
+			return;
+		}
+
+		conn = NULL;
+		for (i = 0; i < HTTP_EVENT_MAX_CONN; i++) {
+			if (conns[i].client == NULL) {
+				conn = &conns[i];
+				break;
+			}
+		}
+
+		if (conn == NULL) {
+			HTTP_LOGE("Error: Too many clients\n");
+			close(sock_fd);
+			continue;
+		}
+
+		if (http_event_nonblock(sock_fd) != HTTP_OK) {
+			HTTP_LOGE("Error: Fail to set non-blocking\n");
+			close(sock_fd);
+			continue;
+		}
+
+		conn->rxbuf = HTTP_MALLOC(HTTP_EVENT_RXBUF_LEN + 1);
+		conn->client = conn->rxbuf ? http_client_init(server, sock_fd) : NULL;
+		if (conn->client == NULL) {
+			HTTP_LOGE("Error: Cannot init client!!\n");
+			HTTP_FREE(conn->rxbuf);
+			conn->rxbuf = NULL;
+			close(sock_fd);
+			continue;
+		}
+
+		conn->state = HTTP_CONN_RECV;
+		conn->client_ip = client_addr.sin_addr.s_addr;
+		conn->last = http_event_now();
+		conn->rxlen = 0;
+		conn->file_fd = -1;
+
+		HTTP_LOGD("Client %d is accepted\n", sock_fd);
+	}
+}
+
+/****************************************************************************
+ * Name: http_event_frame
+ *
+ * Description:
+ *   The length of the first request in the buffer, its header and its body,
+ *   or 0 when it is not complete yet.
+ *
+ ****************************************************************************/
+static int http_event_frame(const char *buf, int len)
+{
+	long content_len = 0;
+	int end;
+	int i;
+
+	for (end = 0; end + 3 < len; end++) {
+		if (buf[end] == '\r' && buf[end + 1] == '\n' && buf[end + 2] == '\r' && buf[end + 3] == '\n') {
+			break;
+		}
+	}
+
+	if (end + 3 >= len) {
+		return len < HTTP_EVENT_RXBUF_LEN ? 0 : HTTP_EVENT_TOO_LARGE;
+	}
+	end += 4;
+
+	/* The header lines which give the length of the body */
+
+	for (i = 0; i < end; i++) {
+		if (i > 0 && buf[i - 1] != '\n') {
+			continue;
+		}
+
+		if (strncasecmp(buf + i, "Content-Length:", 15) == 0) {
+			content_len = strtol(buf + i + 15, NULL, 10);
+		} else if (strncasecmp(buf + i, "Transfer-Encoding:", 18) == 0) {
+			return HTTP_EVENT_CHUNKED;
+		}
+	}
+
+	if (content_len < 0 || content_len > HTTP_EVENT_RXBUF_LEN - end) {
+		return HTTP_EVENT_TOO_LARGE;
+	}
+
+	return len < end + content_len ? 0 : end + content_len;
+}
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_DOCROOT
+static const char *http_event_mime(const char *path)
+{
+	const char *ext = strrchr(path, '.');
+	int i;
+
+	if (ext != NULL && strchr(ext, '/') == NULL) {
+		for (i = 0; i < sizeof(g_http_mime) / sizeof(g_http_mime[0]); i++) {
+			if (strcasecmp(ext + 1, g_http_mime[i].ext) == 0) {
+				return g_http_mime[i].type;
+			}
+		}
+	}
+
+	return "application/octet-stream";
+}
+
+/****************************************************************************
+ * Name: http_event_open_file
+ *
+ * Description:
+ *   Start the response of a GET from the document root.  Returns false
+ *   when the URL is not a regular file there, for the callbacks.
+ *
+ ****************************************************************************/
+static bool http_event_open_file(struct http_conn_s *conn, const char *url)
+{
+	char path[sizeof(CONFIG_NETUTILS_WEBSERVER_EVENT_DOCROOT) + HTTP_CONF_MAX_REQUEST_HEADER_URL_LENGTH + 10];
+	struct stat st;
+	int urllen;
+	int len;
+	int fd;
+
+	if (CONFIG_NETUTILS_WEBSERVER_EVENT_DOCROOT[0] == '\0' || url[0] != '/' || strstr(url, "..") != NULL) {
+		return false;
+	}
+
+	urllen = strcspn(url, "?");
+	len = snprintf(path, sizeof(path), "%s%.*s", CONFIG_NETUTILS_WEBSERVER_EVENT_DOCROOT, urllen, url);
+	if (path[len - 1] == '/') {
+		strncat(path, "index.html", sizeof(path) - len - 1);
+	}
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)) {
+		close(fd);
+		return false;
+	}
+
+	conn->header_len = snprintf(conn->header, HTTP_EVENT_HEADER_LEN,
+								"HTTP/1.1 200 OK\r\n"
+								"Content-Type: %s\r\n"
+								"Content-Length: %lu\r\n"
+								"Connection: %s\r\n\r\n",
+								http_event_mime(path), (unsigned long)st.st_size,
+								conn->client->keep_alive ? "Keep-Alive" : "close");
+	conn->header_off = 0;
+	conn->file_fd = fd;
+	conn->file_off = 0;
+	conn->file_len = st.st_size;
+	conn->state = HTTP_CONN_FILE;
+
+	HTTP_LOGD("Client %d file %s, %lu bytes\n", conn->client->client_fd, path, (unsigned long)st.st_size);
+	return true;
+}
+#endif
+
+/****************************************************************************
+ * Name: http_event_send_file
+ *
+ * Description:
+ *   Send what the socket takes of the file response.  The file is read a
+ *   window at a time at the offset reached, so a short send costs no copy.
+ *
+ ****************************************************************************/
+static int http_event_send_file(struct http_conn_s *conn, char *window)
+{
+	int fd = conn->client->client_fd;
+	ssize_t nread;
+	ssize_t nsent;
+
+	while (conn->header_off < conn->header_len) {
+		nsent = send(fd, conn->header + conn->header_off, conn->header_len - conn->header_off, 0);
+		if (nsent < 0) {
+			return http_event_again() ? HTTP_OK : HTTP_ERROR;
+		}
+		conn->header_off += nsent;
+	}
+
+	while (conn->file_off < conn->file_len) {
+		nread = conn->file_len - conn->file_off;
+		if (nread > HTTP_EVENT_WINDOW_LEN) {
+			nread = HTTP_EVENT_WINDOW_LEN;
+		}
+
+		if (lseek(conn->file_fd, conn->file_off, SEEK_SET) == (off_t)-1) {
+			return HTTP_ERROR;
+		}
+
+		nread = read(conn->file_fd, window, nread);
+		if (nread <= 0) {
+			HTTP_LOGE("Error: Fail to read file\n");
+			return HTTP_ERROR;
+		}
+
+		nsent = send(fd, window, nread, 0);
+		if (nsent < 0) {
+			return http_event_again() ? HTTP_OK : HTTP_ERROR;
+		}
+		conn->file_off += nsent;
+	}
+
+	close(conn->file_fd);
+	conn->file_fd = -1;
+	conn->state = HTTP_CONN_RECV;
+	return HTTP_OK;
+}
+
+/****************************************************************************
+ * Name: http_event_request
+ *
+ * Description:
+ *   Parse and serve the request of len bytes at the start of the receive
+ *   buffer.
+ *
+ ****************************************************************************/
+static int http_event_request(struct http_conn_s *conn, int len)
+{
+	struct http_client_t *client = conn->client;
+	struct http_keyvalue_list_t request_params;
+	struct http_message_len_t mlen = {0, };
+	struct http_req_message req = {0, };
+	char url[HTTP_CONF_MAX_REQUEST_HEADER_URL_LENGTH] = {0, };
+	char *buf = conn->rxbuf;
+	char *body = NULL;
+	char *conn_type;
+	char next;
+	int method = HTTP_METHOD_UNKNOWN;
+	int enc = HTTP_CONTENT_LENGTH;
+	int state = HTTP_REQUEST_HEADER;
+	int chunk_processed = 0;
+	int line_end;
+	bool http11;
+	int ret;
+
+	/* The version, before the parser cuts the request line */
+
+	line_end = http_find_first_crlf(buf, len, 0);
+	http11 = line_end >= 8 && strncmp(buf + line_end - 8, "HTTP/1.1", 8) == 0;
+
+	/* The parser terminates the body over the first byte of the next
+	 * request, which is put back after.
+	 */
+
+	next = buf[len];
+
+	req.req_msg = buf;
+	req.url = url;
+	req.headers = &request_params;
+	req.client_ip = conn->client_ip;
+	req.encoding = HTTP_CONTENT_LENGTH;
+	client->ws_state = 0;
+
+	http_keyvalue_list_init(&request_params);
+	ret = http_parse_message(buf, len, &method, url, &body, &enc, &state, &mlen, &request_params, client, NULL, &req, &chunk_processed);
+	if (ret != true || method == HTTP_METHOD_UNKNOWN) {
+		http_keyvalue_list_release(&request_params);
+		buf[len] = next;
+		http_send_response(client, 400, HTTP_ERROR_400, NULL);
+		return HTTP_ERROR;
+	}
+
+	conn_type = http_keyvalue_list_find(&request_params, "Connection");
+	if (http11) {
+		client->keep_alive = strncasecmp(conn_type, "close", strlen("close") + 1) != 0;
+	} else {
+		client->keep_alive = strncasecmp(conn_type, "Keep-Alive", strlen("Keep-Alive") + 1) == 0;
+	}
+
+	if (--client->remaining_request == 0) {
+		client->keep_alive = 0;
+	}
+
+	HTTP_LOGD("Client %d in keep-alive %d.\n", client->client_fd, client->keep_alive);
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_DOCROOT
+	if (method != HTTP_METHOD_GET || !http_event_open_file(conn, url))
+#endif
+	{
+		req.entity = body;
+		req.entity_len = mlen.content_len;
+		http_dispatch_url(client, &req);
+	}
+
+	http_keyvalue_list_release(&request_params);
+	buf[len] = next;
+	return HTTP_OK;
+}
+
+/****************************************************************************
+ * Name: http_event_serve
+ *
+ * Description:
+ *   Serve the complete requests of the receive buffer, until one of them
+ *   answers from a file.  Returns HTTP_ERROR when the connection is to be
+ *   closed.
+ *
+ ****************************************************************************/
+static int http_event_serve(struct http_conn_s *conn)
+{
+	int len;
+
+	while (conn->state == HTTP_CONN_RECV && conn->rxlen > 0) {
+		len = http_event_frame(conn->rxbuf, conn->rxlen);
+		if (len == 0) {
+			break;
+		}
+
+		if (len == HTTP_EVENT_TOO_LARGE) {
+			HTTP_LOGE("Error: Request size is too large!!\n");
+			http_send_response(conn->client, 413, "Payload Too Large", NULL);
+			return HTTP_ERROR;
+		} else if (len == HTTP_EVENT_CHUNKED) {
+			HTTP_LOGE("Error: Chunked request in event mode\n");
+			http_send_response(conn->client, 411, "Length Required", NULL);
+			return HTTP_ERROR;
+		}
+
+		if (http_event_request(conn, len) != HTTP_OK) {
+			return HTTP_ERROR;
+		}
+
+		conn->rxlen -= len;
+		memmove(conn->rxbuf, conn->rxbuf + len, conn->rxlen);
+
+		if (conn->state == HTTP_CONN_RECV && !conn->client->keep_alive) {
+			return HTTP_ERROR;
+		}
+	}
+
+	return HTTP_OK;
+}
+
+static int http_event_recv(struct http_conn_s *conn)
+{
+	ssize_t len;
+
+	len = recv(conn->client->client_fd, conn->rxbuf + conn->rxlen, HTTP_EVENT_RXBUF_LEN - conn->rxlen, 0);
+	if (len < 0) {
+		return http_event_again() ? HTTP_OK : HTTP_ERROR;
+	} else if (len == 0) {
+		HTTP_LOGD("Finish read\n");
+		return HTTP_ERROR;
+	}
+
+	conn->rxlen += len;
+	return http_event_serve(conn);
+}
+
+static int http_event_send(struct http_conn_s *conn, char *window)
+{
+	if (http_event_send_file(conn, window) != HTTP_OK) {
+		return HTTP_ERROR;
+	}
+
+	if (conn->state == HTTP_CONN_RECV) {
+		/* The file is sent, the pipelined requests are next */
+
+		if (!conn->client->keep_alive) {
+			return HTTP_ERROR;
+		}
+
+		return http_event_serve(conn);
+	}
+
+	return HTTP_OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+pthread_addr_t http_server_event_handler(pthread_addr_t arg)
+{
+	struct http_server_t *server = (struct http_server_t *)arg;
+	struct pollfd fds[HTTP_EVENT_MAX_CONN + 1];
+	struct http_conn_s *polled[HTTP_EVENT_MAX_CONN + 1];
+	struct http_conn_s *conns = NULL;
+	struct http_conn_s *conn;
+	char *window = NULL;
+	time_t now;
+	int nfds;
+	int ret;
+	int i;
+
+	if (http_server_listen(server) != HTTP_OK) {
+		goto stop;
+	}
+
+	if (http_event_nonblock(server->listen_fd) != HTTP_OK) {
+		HTTP_LOGE("Error: Fail to set non-blocking\n");
+		goto stop;
+	}
+
+	conns = (struct http_conn_s *)HTTP_MALLOC(sizeof(struct http_conn_s) * HTTP_EVENT_MAX_CONN);
+	window = HTTP_MALLOC(HTTP_EVENT_WINDOW_LEN);
+	if (conns == NULL || window == NULL) {
+		HTTP_LOGE("Error: Fail to malloc connections\n");
+		goto stop;
+	}
+	HTTP_MEMSET(conns, 0, sizeof(struct http_conn_s) * HTTP_EVENT_MAX_CONN);
+
+	HTTP_LOGD("Accepting connections on port %d began.\n", server->port);
+
+	server->state = HTTP_SERVER_RUN;
+
+	while (server->state == HTTP_SERVER_RUN) {
+		HTTP_MEMSET(fds, 0, sizeof(fds));
+		fds[0].fd = server->listen_fd;
+		fds[0].events = POLLIN;
+		nfds = 1;
+
+		for (i = 0; i < HTTP_EVENT_MAX_CONN; i++) {
+			if (conns[i].client) {
+				fds[nfds].fd = conns[i].client->client_fd;
+				fds[nfds].events = conns[i].state == HTTP_CONN_FILE ? POLLOUT : POLLIN;
+				polled[nfds++] = &conns[i];
+			}
+		}
+
+		ret = poll(fds, nfds, HTTP_EVENT_POLL_MSEC);
+		if (ret < 0) {
+			if (errno != EINTR) {
+				HTTP_LOGE("Error: poll fail errno:[%d]\n", errno);
+			}
+			continue;
+		}
+
+		now = http_event_now();
+
+		for (i = 1; i < nfds; i++) {
+			conn = polled[i];
+
+			if (fds[i].revents & (POLLERR | POLLNVAL)) {
+				ret = HTTP_ERROR;
+			} else if (fds[i].revents & POLLIN) {
+				ret = http_event_recv(conn);
+			} else if (fds[i].revents & POLLOUT) {
+				ret = http_event_send(conn, window);
+			} else if (fds[i].revents & POLLHUP) {
+				ret = HTTP_ERROR;
+			} else {
+				if (now - conn->last >= conn->client->keep_alive_timeout) {
+					HTTP_LOGD("Client %d keep-alive timeout\n", conn->client->client_fd);
+					http_event_close(conn);
+				}
+				continue;
+			}
+
+			if (ret != HTTP_OK) {
+				http_event_close(conn);
+			} else {
+				conn->last = now;
+			}
+		}
+
+		if (fds[0].revents & POLLIN) {
+			http_event_accept(server, conns);
+		}
+	}
+
+stop:
+	if (conns) {
+		for (i = 0; i < HTTP_EVENT_MAX_CONN; i++) {
+			if (conns[i].client) {
+				http_event_close(&conns[i]);
+			}
+		}
+		HTTP_FREE(conns);
+	}
+
+	if (window) {
+		HTTP_FREE(window);
+	}
+
+	HTTP_LOGD("http_server_event_handler stop :%d\n", server->port);
+
+	server->state = HTTP_SERVER_STOP;
+	return NULL;
+}
+
+#endif /* CONFIG_NETUTILS_WEBSERVER_EVENT */
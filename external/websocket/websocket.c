@@ -40,6 +40,9 @@
 #include <sys/time.h>
 #include "mbedtls/sha1.h"
 #include "mbedtls/base64.h"
+#ifdef CONFIG_TLS_SESSION_CACHE
+#include "mbedtls/tls_session_cache.h"
+#endif
 #include <netutils/netlib.h>
 #include <protocols/websocket.h>
 #include <protocols/wslay/wslay.h>
@@ -67,7 +70,7 @@ websocket_t ws_srv_table[WEBSOCKET_MAX_CLIENT];
 
 /****** websocket common functions *****/
 
-int websocket_tls_handshake(websocket_t *data, char *hostname, int auth_mode)
+int websocket_tls_handshake(websocket_t *data, char *hostname, int port, int auth_mode)
 {
 	int r;
 
@@ -98,16 +101,34 @@ int websocket_tls_handshake(websocket_t *data, char *hostname, int auth_mode)
 
 	mbedtls_ssl_set_bio(data->tls_ssl, &(data->tls_net), mbedtls_net_send, mbedtls_net_recv, NULL);
 
+#ifdef CONFIG_TLS_SESSION_CACHE
+	/* hostname is NULL on the server side */
+	if (hostname != NULL) {
+		tls_session_cache_set(data->tls_ssl, hostname, port);
+	}
+#endif
+
 	/* Handshake */
 	WEBSOCKET_DEBUG("  . Performing the SSL/TLS handshake...");
 
 	while ((r = mbedtls_ssl_handshake(data->tls_ssl)) != 0) {
 		if (r != MBEDTLS_ERR_SSL_WANT_READ && r != MBEDTLS_ERR_SSL_WANT_WRITE) {
 			WEBSOCKET_DEBUG("Error: mbedtls_ssl_handshake returned -%4x\n", -r);
+#ifdef CONFIG_TLS_SESSION_CACHE
+			if (hostname != NULL) {
+				tls_session_cache_remove(hostname, port);
+			}
+#endif
 			return r;
 		}
 	}
 
+#ifdef CONFIG_TLS_SESSION_CACHE
+	if (hostname != NULL) {
+		tls_session_cache_update(data->tls_ssl, hostname, port);
+	}
+#endif
+
 	WEBSOCKET_DEBUG("OK\n");
 	return WEBSOCKET_SUCCESS;
 }
@@ -413,7 +434,7 @@ TLS_HS_RETRY:
 	}
 
 	if (client->tls_enabled) {
-		if ((r = websocket_tls_handshake(client, host, client->auth_mode)) != WEBSOCKET_SUCCESS) {
+		if ((r = websocket_tls_handshake(client, host, atoi(port), client->auth_mode)) != WEBSOCKET_SUCCESS) {
 			if (r == MBEDTLS_ERR_NET_SEND_FAILED || r == MBEDTLS_ERR_NET_RECV_FAILED || r == MBEDTLS_ERR_SSL_CONN_EOF) {
 				if (tls_hs_retry-- > 0) {
 					WEBSOCKET_DEBUG("Handshake again.... \n");
@@ -536,7 +557,7 @@ int websocket_server_authenticate(websocket_t *server)
 		mbedtls_ssl_init(server->tls_ssl);
 		mbedtls_net_init(&(server->tls_net));
 
-		if ((r = websocket_tls_handshake(server, NULL, server->auth_mode)) != WEBSOCKET_SUCCESS) {
+		if ((r = websocket_tls_handshake(server, NULL, 0, server->auth_mode)) != WEBSOCKET_SUCCESS) {
 			WEBSOCKET_DEBUG("fail to tls handshake\n");
 			r = WEBSOCKET_TLS_HANDSHAKE_ERROR;
 			goto EXIT_SERVER_START;
@@ -840,6 +861,7 @@ websocket_return_t websocket_client_open(websocket_t *client, char *host, char *
 		r = WEBSOCKET_INIT_ERROR;
 		goto EXIT_CLIENT_OPEN;
 	}
+	wslay_event_config_set_no_buffering(client->ctx, client->no_buffering);
 
 	WEBSOCKET_DEBUG("start websocket client handling thread\n");
 
@@ -963,6 +985,7 @@ websocket_return_t websocket_server_init(websocket_t *server)
 		r = WEBSOCKET_INIT_ERROR;
 		goto EXIT_SERVER_INIT;
 	}
+	wslay_event_config_set_no_buffering(server->ctx, server->no_buffering);
 
 	if (websocket_config_socket(server->fd) != WEBSOCKET_SUCCESS) {
 		r = WEBSOCKET_SOCKET_ERROR;
@@ -1018,6 +1041,21 @@ websocket_return_t websocket_queue_msg(websocket_t *websocket, websocket_frame_t
 	return wslay_event_queue_msg(websocket->ctx, tx_frame);
 }
 
+websocket_return_t websocket_queue_msgv(websocket_t *websocket, websocket_frame_vec_t *tx_frame)
+{
+	if (websocket == NULL || tx_frame == NULL) {
+		WEBSOCKET_DEBUG("NULL parameter\n");
+		return WEBSOCKET_ALLOCATION_ERROR;
+	}
+
+	if (websocket->state == WEBSOCKET_STOP) {
+		WEBSOCKET_DEBUG("websocket is not running state.\n");
+		return WEBSOCKET_INIT_ERROR;
+	}
+
+	return wslay_event_queue_msgv(websocket->ctx, tx_frame);
+}
+
 websocket_return_t websocket_queue_ping(websocket_t *websocket)
 {
 	websocket_frame_t tx_frame;
@@ -264,7 +264,18 @@ static uint8_t *wslay_event_flatten_queue(struct wslay_queue *queue, size_t len)
 		return NULL;
 	} else {
 		size_t off = 0;
-		uint8_t *buf = (uint8_t *)malloc(len);
+		uint8_t *buf;
+		struct wslay_event_byte_chunk *chunk = wslay_queue_top(queue);
+		/* a message of one frame takes the buffer of its chunk */
+		if (chunk->data_length == len) {
+			buf = chunk->data;
+			chunk->data = NULL;
+			wslay_event_byte_chunk_free(chunk);
+			wslay_queue_pop(queue);
+			assert(wslay_queue_empty(queue));
+			return buf;
+		}
+		buf = (uint8_t *)malloc(len);
 		if (!buf) {
 			return NULL;
 		}
@@ -366,6 +377,50 @@ int wslay_event_queue_msg_ex(wslay_event_context_ptr ctx, const struct wslay_eve
 	return 0;
 }
 
+int wslay_event_queue_msgv(wslay_event_context_ptr ctx, const struct wslay_event_msgv *arg)
+{
+	int r;
+	int i;
+	size_t off = 0;
+	struct wslay_event_omsg *omsg;
+	size_t msg_length = 0;
+	if (!wslay_event_is_msg_queueable(ctx)) {
+		return WSLAY_ERR_NO_MORE_MSG;
+	}
+	if (arg->iovcnt < 0 || (arg->iovcnt > 0 && !arg->iov)) {
+		return WSLAY_ERR_INVALID_ARGUMENT;
+	}
+	for (i = 0; i < arg->iovcnt; ++i) {
+		msg_length += arg->iov[i].iov_len;
+	}
+	if (wslay_is_ctrl_frame(arg->opcode) && msg_length > 125) {
+		return WSLAY_ERR_INVALID_ARGUMENT;
+	}
+	/* the buffers are gathered straight into the queued message */
+	if ((r = wslay_event_omsg_non_fragmented_init(&omsg, arg->opcode, WSLAY_RSV_NONE, NULL, 0)) != 0) {
+		return r;
+	}
+	if (msg_length) {
+		omsg->data = (uint8_t *)malloc(msg_length);
+		if (!omsg->data) {
+			wslay_event_omsg_free(omsg);
+			return WSLAY_ERR_NOMEM;
+		}
+		for (i = 0; i < arg->iovcnt; ++i) {
+			memcpy(omsg->data + off, arg->iov[i].iov_base, arg->iov[i].iov_len);
+			off += arg->iov[i].iov_len;
+		}
+		omsg->data_length = msg_length;
+	}
+	if ((r = wslay_queue_push(wslay_is_ctrl_frame(arg->opcode) ? ctx->send_ctrl_queue : ctx->send_queue, omsg)) != 0) {
+		wslay_event_omsg_free(omsg);
+		return r;
+	}
+	++ctx->queued_msg_count;
+	ctx->queued_msg_length += msg_length;
+	return 0;
+}
+
 int wslay_event_queue_fragmented_msg(wslay_event_context_ptr ctx, const struct wslay_event_fragmented_msg *arg)
 {
 	return wslay_event_queue_fragmented_msg_ex(ctx, arg, WSLAY_RSV_NONE);
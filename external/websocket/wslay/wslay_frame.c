@@ -49,6 +49,39 @@
 
 #define wslay_min(A, B) (((A) < (B)) ? (A) : (B))
 
+/*
+ * XORs len bytes of src with the mask key, starting at the offset off of
+ * the payload, into dst, which may be src.  The bytes go by 32 bit words
+ * once dst is aligned; the key is rotated to the offset and loaded in
+ * memory order, so the words need no byte swap.
+ */
+static void wslay_mask(uint8_t *dst, const uint8_t *src, size_t len, const uint8_t *key, uint64_t off)
+{
+	uint8_t rkey[4];
+	uint32_t kword;
+	uint32_t word;
+	size_t i;
+
+	for (; len > 0 && ((uintptr_t)dst & 3) != 0; --len, ++off) {
+		*dst++ = *src++ ^ key[off % 4];
+	}
+
+	for (i = 0; i < 4; ++i) {
+		rkey[i] = key[(off + i) % 4];
+	}
+	memcpy(&kword, rkey, 4);
+
+	for (; len >= 4; len -= 4, dst += 4, src += 4) {
+		memcpy(&word, src, 4);
+		word ^= kword;
+		memcpy(dst, &word, 4);
+	}
+
+	for (i = 0; i < len; ++i) {
+		dst[i] = src[i] ^ rkey[i];
+	}
+}
+
 int wslay_frame_context_init(wslay_frame_context_ptr *ctx, const struct wslay_frame_callbacks *callbacks, void *user_data)
 {
 	*ctx = (wslay_frame_context_ptr)malloc(sizeof(struct wslay_frame_context));
@@ -154,10 +187,7 @@ ssize_t wslay_frame_send(wslay_frame_context_ptr ctx, struct wslay_frame_iocb *i
 					const uint8_t *writelimit = datamark + wslay_min(sizeof(temp), datalen);
 					size_t writelen = writelimit - datamark;
 					ssize_t r;
-					size_t i;
-					for (i = 0; i < writelen; ++i) {
-						temp[i] = datamark[i] ^ ctx->omaskkey[(ctx->opayloadoff + i) % 4];
-					}
+					wslay_mask(temp, datamark, writelen, ctx->omaskkey, ctx->opayloadoff);
 					r = ctx->callbacks.send_callback(temp, writelen, 0, ctx->user_data);
 					if (r > 0) {
 						if ((size_t)r > writelen) {
@@ -318,13 +348,10 @@ ssize_t wslay_frame_recv(wslay_frame_context_ptr ctx, struct wslay_frame_iocb *i
 		readmark = ctx->ibufmark;
 		readlimit = WSLAY_AVAIL_IBUF(ctx) < rempayloadlen ? ctx->ibuflimit : ctx->ibufmark + rempayloadlen;
 		if (ctx->imask) {
-			for (; ctx->ibufmark != readlimit; ++ctx->ibufmark, ++ctx->ipayloadoff) {
-				ctx->ibufmark[0] ^= ctx->imaskkey[ctx->ipayloadoff % 4];
-			}
-		} else {
-			ctx->ibufmark = readlimit;
-			ctx->ipayloadoff += readlimit - readmark;
+			wslay_mask(readmark, readmark, readlimit - readmark, ctx->imaskkey, ctx->ipayloadoff);
 		}
+		ctx->ibufmark = readlimit;
+		ctx->ipayloadoff += readlimit - readmark;
 		iocb->fin = ctx->iom.fin;
 		iocb->rsv = ctx->iom.rsv;
 		iocb->opcode = ctx->iom.opcode;
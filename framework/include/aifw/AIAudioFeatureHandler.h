@@ -0,0 +1,131 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/**
+ * @file aifw/AIAudioFeatureHandler.h
+ * @brief Log-mel and MFCC front end for audio models
+ */
+
+#pragma once
+
+#include "tinyara/config.h"
+#include <memory>
+#include "aifw/aifw.h"
+#include "aifw/AIProcessHandler.h"
+
+namespace aifw {
+
+/**
+ * @brief Parameters of the audio features.
+ * sampleRate: Sample rate of the PCM data, in Hz
+ * frameLength: Samples of one analysis frame, which is the FFT size. Power of 2 from 32 to 4096.
+ * frameShift: Samples between two frames, pushed at a time. At most frameLength.
+ * melBands: Number of mel filters
+ * mfccCount: Number of cepstral coefficients per frame, 0 to output the log-mel energies
+ * lowFrequency: Lower edge of the first mel filter, in Hz
+ * highFrequency: Upper edge of the last mel filter, in Hz. 0 for sampleRate / 2.
+ * inferenceStride: Frames between two inferences, 1 to infer on every frame
+ */
+struct AIAudioFeatureConfig {
+	uint32_t sampleRate;
+	uint16_t frameLength;
+	uint16_t frameShift;
+	uint16_t melBands;
+	uint16_t mfccCount;
+	float lowFrequency;
+	float highFrequency;
+	uint16_t inferenceStride;
+};
+
+struct AIAudioFeatureState;
+
+/**
+ * @class AIAudioFeatureHandler
+ * @brief Process handler computing log-mel energies or MFCCs of 16 bit mono PCM with CMSIS-DSP.
+ * Each pushData() gives frameShift new samples, which are appended to the previous frame to
+ * make the next one, so overlapping samples are converted only once. The features of the frame
+ * are one row of AIDataBuffer: rawDataCount must be mfccCount, or melBands for log-mel.
+ * The model input is the windowSize latest frames, oldest first, so invokeInputCount must be
+ * windowSize * rawDataCount. Inference is skipped until windowSize frames were received, then
+ * happens every inferenceStride frames.
+ * postProcessData() copies the invoke output; models needing more post-processing derive from this class.
+ */
+class AIAudioFeatureHandler : public AIProcessHandler
+{
+public:
+	/**
+	 * @brief AIAudioFeatureHandler constructor.
+	 */
+	AIAudioFeatureHandler();
+
+	/**
+	 * @brief AIAudioFeatureHandler destructor.
+	 */
+	virtual ~AIAudioFeatureHandler();
+
+	/**
+	 * @brief Allocates the buffers and computes the window, filterbank and DCT tables.
+	 * @param [in] config: Parameters of the features.
+	 * @return: AIFW_RESULT enum object. On success, AIFW_OK is returned.
+	 */
+	AIFW_RESULT init(const AIAudioFeatureConfig &config);
+
+	/**
+	 * @brief Forgets the previous samples, to start on a new stream.
+	 */
+	void reset(void);
+
+	/**
+	 * @brief Number of features of one frame.
+	 */
+	uint16_t getFeatureCount(void) const;
+
+	/**
+	 *! @copydoc AIProcessHandler::parseData()
+	 * data holds count samples of 16 bit PCM, count being frameShift.
+	 */
+	AIFW_RESULT parseData(void *data, uint16_t count, float *parsedData, AIModelAttribute *modelAttribute) override;
+
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	/**
+	 *! @copydoc AIProcessHandler::preProcessData()
+	 */
+	AIFW_RESULT preProcessData(std::shared_ptr<AIDataBuffer> buffer, float *invokeInput, AIModelAttribute *modelAttribute) override;
+#else
+	/**
+	 *! @copydoc AIProcessHandler::preProcessData()
+	 */
+	AIFW_RESULT preProcessData(std::shared_ptr<AIDataBuffer> buffer, uint16_t countInputSets, float **invokeInput, AIModelAttribute *modelAttribute) override;
+#endif
+
+	/**
+	 *! @copydoc AIProcessHandler::postProcessData()
+	 */
+	AIFW_RESULT postProcessData(std::shared_ptr<AIDataBuffer> buffer, float *resultData, AIModelAttribute *modelAttribute) override;
+
+private:
+	void deinit(void);
+	AIFW_RESULT initMelFilters(void);
+	AIFW_RESULT copyFrames(std::shared_ptr<AIDataBuffer> buffer, float *invokeInput, AIModelAttribute *modelAttribute);
+
+	AIAudioFeatureConfig mConfig;
+	AIAudioFeatureState *mState;
+	uint32_t mFrames;
+};
+
+} /* namespace aifw */
@@ -27,11 +27,11 @@
 namespace aifw {
 
 class AIModel;
-class AIDataBufferNode;
 
 /**
  * @class AIDataBuffer
- * @brief This class creates a doubly linked list and provides API to perform operations on that list.
+ * @brief This class keeps the latest rows of data in a single circular buffer and provides API to perform operations on them.
+ * Rows are stored newest first, so a range of rows is contiguous in memory unless it wraps around the end of the buffer.
  */
 class AIDataBuffer
 {
@@ -71,13 +71,33 @@ public:
 	uint16_t getRowCount();
 
 	/**
-	 * @brief Marks all nodes empty and sets number of filled nodes to 0 in AIDataBuffer
+	 * @brief Gives number of values in a row.
+	 * @return: Row size.
+	 */
+	uint16_t getRowSize();
+
+	/**
+	 * @brief Gives rows of the data buffer in place, without copying them.
+	 * Rows from row to row + count - 1 are stored one after the other, getRowSize() values each, newest first.
+	 * If they wrap around the end of the buffer, the first firstCount rows are at first and the rest at second.
+	 * The values stay valid until the buffer is written or cleared.
+	 * @param [in] row: Index of first row, 0 being latest row.
+	 * @param [in] count: Number of rows.
+	 * @param [out] first: Values of the first rows.
+	 * @param [out] firstCount: Number of rows at first.
+	 * @param [out] second: Values of the remaining rows, or NULL if all rows are at first.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	AIFW_RESULT getRows(uint16_t row, uint16_t count, const float **first, uint16_t *firstCount, const float **second);
+
+	/**
+	 * @brief Clears all rows and sets number of filled rows to 0 in AIDataBuffer
 	 * @return: AIFW_RESULT enum object.
 	 */
 	AIFW_RESULT clear(void);
 
 	/**
-	 * @brief Marks specific nodes empty, move them to the end of AIDataBuffer, and decrement number of filled nodes in AIDataBuffer
+	 * @brief Deletes specific rows, moves older rows up, and decrement number of filled rows in AIDataBuffer
 	 * @param [IN] offset: Offset of row to start clearing.
 	 * @param [IN] count: Count of rows to clear.
 	 * @return: AIFW_RESULT enum object.
@@ -87,16 +107,16 @@ public:
 	friend class AIModel;
 private:
 	/**
-	 * @brief Creates a doubly linked list with node count equal to row and node size equal to size.
-	 * @param [in] row: Number of rows/nodes needed in streaming buffer.
-	 * @param [in] size: Number of values in a single row/node.
-	 * @return: AIFW_RESULT enum object. Before returning any error, it releases all the memory allocated.
+	 * @brief Allocates the streaming buffer for row rows of size values, in a single allocation.
+	 * @param [in] row: Number of rows needed in streaming buffer.
+	 * @param [in] size: Number of values in a single row.
+	 * @return: AIFW_RESULT enum object.
 	 */
 	AIFW_RESULT init(uint16_t row, uint16_t size);
 
 	/**
 	 * @brief Modifies the streaming buffer.
-	 * It compares row and size with previous set value of row and size and according to that it modifies the existing nodes or create more nodes or both.
+	 * It compares row and size with previous set value of row and size and according to that it moves the filled rows to a buffer of the new size. The number of rows is never reduced.
 	 * @param [in] row: Number of rows needed in the streaming buffer.
 	 * @param [in] size: Number of values in a single row.
 	 * @return: AIFW_RESULT enum object. In case of any error, previously allocated memory is not released.
@@ -105,13 +125,13 @@ private:
 
 	/**
 	 * @brief Deinitializes the streaming buffer.
-	 * It clears the memory allocated to doubly linked list and resets class member variables.
+	 * It releases the memory of the buffer and resets class member variables.
 	 */
 	void deinit(void);
 
 	/**
 	 * @brief Writes a row into streaming buffer.
-	 * Last node is detached and attached at the starting of the linked list. Values are then written in that node.
+	 * The new row takes the place of the oldest row and becomes row 0.
 	 * @param [in] buffer: Input buffer from which data values are copied.
 	 * @param [in] size: Number of values in input buffer.
 	 * @return: AIFW_RESULT enum object.
@@ -128,28 +148,28 @@ private:
 	AIFW_RESULT writeData(float *buffer, uint16_t size, uint16_t offset);
 
 	/**
-	 * @brief Deletes a row data, marks that row empty and puts it at the end of the streaming buffer.
+	 * @brief Deletes a row data. Older rows move up by one and the last row is emptied.
 	 * @param [in] row: Index of row whose data needs to be deleted, 0 being latest row.
 	 * @return: AIFW_RESULT enum object.
 	 */
 	AIFW_RESULT deleteData(uint16_t row);
 
 	/**
-	 * @brief Clears the memory allocated to the list with head pointer equal to ptr.
-	 * @param [in] ptr: Pointer to the head of list.
+	 * @brief Gives the values of a row.
+	 * @param [in] row: Index of row, 0 being latest row.
+	 * @return: Pointer to the first value of the row.
 	 */
-	void clearMemory(AIDataBufferNode *ptr);
+	float *getRow(uint16_t row);
 
 	/**
-	 * @brief Insert count number of nodes in a doubly linked list.
-	 * @param [in] count: Number of nodes in the list.
-	 * @param [in] size: Number of values in a single node.
-	 * @return: AIFW_RESULT enum object.
+	 * @brief Deletes count rows from row offset. Older rows move up and the last count rows are emptied.
+	 * @param [in] offset: Index of first row to delete.
+	 * @param [in] count: Number of rows to delete.
 	 */
-	AIFW_RESULT createList(uint16_t count, uint16_t size);
+	void removeRows(uint16_t offset, uint16_t count);
 
-	AIDataBufferNode *mStart;
-	AIDataBufferNode *mEnd;
+	float *mData;
+	uint16_t mStart;
 	uint16_t mMaxRows;
 	uint16_t mRowSize;
 	uint16_t mRowCount;
@@ -93,6 +93,20 @@ public:
 	 */
 	virtual AIFW_RESULT resetInferenceState(void);
 
+#ifdef CONFIG_AIFW_PROFILE
+	/**
+	 * @brief Gives the number of models attached.
+	 */
+	uint16_t getModelCount(void);
+
+	/**
+	 * @brief Gives the per operator profile of an attached model.
+	 * @param [in] idx: Index of the model, in attach order.
+	 *! @copydoc AIModel::getProfile()
+	 */
+	AIFW_RESULT getProfile(uint16_t idx, AIModelProfile *profile, AIOperatorProfile *operators, uint16_t maxOperators);
+#endif
+
 protected:
 	/**
 	 * @brief Performs operations on post processed(or invoke output) results of attached models in the model set.
@@ -127,6 +127,42 @@ public:
 	 */
 	uint32_t getModelCode(void);
 
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	/**
+	 * @brief Gives the element type and quantization of an input set of the loaded model.
+	 * @param [in] idx: Index of the input set.
+	 * @param [out] info: Type, quantization and count of elements of the set.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	AIFW_RESULT getInputInfo(uint16_t idx, AITensorInfo *info);
+
+	/**
+	 * @brief Gives the element type and quantization of an output set of the loaded model.
+	 * Quantized outputs are dequantized to float before they are written in AIDataBuffer.
+	 * @param [in] idx: Index of the output set.
+	 * @param [out] info: Type, quantization and count of elements of the set.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	AIFW_RESULT getOutputInfo(uint16_t idx, AITensorInfo *info);
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+
+#ifdef CONFIG_AIFW_PROFILE
+	/**
+	 * @brief Gives the time and memory used by each operator of the model over its invokes.
+	 * @param [out] profile: Summary of the profile.
+	 * @param [out] operators: Buffer of maxOperators operator profiles, in execution order. May be NULL.
+	 * @param [in] maxOperators: Number of operator profiles to copy at most. profile->operatorCount tells how many the model has.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	AIFW_RESULT getProfile(AIModelProfile *profile, AIOperatorProfile *operators, uint16_t maxOperators);
+
+	/**
+	 * @brief Clears the profile of the model.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	AIFW_RESULT resetProfile(void);
+#endif
+
 private:
 	/**
 	 * @brief It constructs AIDataBuffer object and initializes it.
@@ -158,6 +194,22 @@ private:
 	 */
 	AIFW_RESULT allocateMemory(void);
 
+	/**
+	 * @brief Loads the model on the engine of the manifest, the NPU if it is asked for and can run the model, else on the CPU engine.
+	 * @param [in] file: Path of the model file, or NULL for an array model.
+	 * @param [in] model: Array model, used if file is NULL.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	AIFW_RESULT loadEngineModel(const char *file, const unsigned char *model);
+
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	/**
+	 * @brief Invokes the engine, quantizing float inputs and dequantizing outputs where the model needs it.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	AIFW_RESULT invokeEngine(void);
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+
 	/**
 	 * @brief It fills model attributes information into mModelAttribute's member variables from input param modelAttribute.
 	 * @param [in] modelAttribute: AIModelAttribute structure variable containing model attributes.
@@ -174,12 +226,15 @@ private:
 #else
 	float **mInvokeInput;
 	float **mInvokeOutput;
-	float **mInvokeResult;
 	uint16_t *mInputSizeList;
 	uint16_t *mOutputSizeList;
 	uint16_t mInputSetCount;
 	uint16_t mOutputSetCount;
-
+	AITensorInfo *mInputInfo;
+	AITensorInfo *mOutputInfo;
+	/* Per input set: mInvokeInput, or a quantized copy of it. Per output set: the output tensor of the engine. */
+	void **mEngineInput;
+	void **mEngineOutput;
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 	float *mParsedData;
 	float *mPostProcessedData;
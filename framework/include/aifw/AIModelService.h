@@ -24,6 +24,7 @@
 #pragma once
 
 #include <memory>
+#include <pthread.h>
 #include <aifw/aifw_timer.h>
 #include "aifw/aifw.h"
 #include "aifw/AIInferenceHandler.h"
@@ -75,8 +76,21 @@ public:
 	 */
 	AIFW_RESULT stop(void);
 
+	/**
+	 * @brief Runs the inference on a thread of its own, so that the next raw data is collected while the previous one is inferred.
+	 * On SMP the thread runs on CPU CONFIG_AIFW_PIPELINE_CPU. pushData() then copies the raw data into a queue and returns.
+	 * When the queue is full, pushData() waits for the oldest raw data to be inferred. The thread infers all the queued raw data before it waits again.
+	 * It should be called before start().
+	 * @param [in] depth: Number of raw data the queue holds.
+	 * @param [in] elementSize: Size in bytes of one element of raw data, the count of pushData() being in elements.
+	 * @param [in] maxCount: Largest count of raw data elements pushed at once.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	AIFW_RESULT enablePipeline(uint16_t depth, size_t elementSize, uint16_t maxCount);
+
 	/**
 	 * @brief Pushes the incoming raw data to AIInferenceHandler for pre-processing, invoke, post processing and finally ensembling.
+	 * With enablePipeline(), the raw data is queued for the inference thread instead.
 	 * @param [in] data: Incoming sensor data to be passed for inference.
 	 * @param [in] count: Length of incoming sensor data array.
 	 * @return: AIFW_RESULT enum object.
@@ -125,11 +139,33 @@ private:
 	 */
 	AIFW_RESULT freeTimer(void);
 
+	/**
+	 * @brief Waits for the queued raw data to be inferred, and with exit, stops the inference thread.
+	 */
+	void flushPipeline(bool exit);
+
+	/**
+	 * @brief Inference thread of enablePipeline().
+	 */
+	static void *pipelineThread(void *args);
+
 	uint16_t mInterval;
 	bool mServiceRunning;
 	std::shared_ptr<AIInferenceHandler> mInferenceHandler;
 	CollectRawDataListener mCollectRawDataCallback;
 	aifw_timer *mTimer;
+	/* Queue of raw data of enablePipeline(), mPipelineCount entries from mPipelineHead */
+	char *mPipelineData;
+	uint16_t *mPipelineDataCount;
+	uint16_t mPipelineDepth;
+	uint16_t mPipelineHead;
+	uint16_t mPipelineCount;
+	size_t mPipelineElementSize;
+	uint16_t mPipelineMaxCount;
+	bool mPipelineExit;
+	pthread_t mPipelineThread;
+	pthread_mutex_t mPipelineLock;
+	pthread_cond_t mPipelineCond;
 };
 
 } /* namespace aifw */
@@ -73,12 +73,24 @@ public:
 	 * @brief Performs preprocessing on data stored in AIDataBuffer before it is sent for invoke. Preprocessed data will not be updated on AIDataBuffer.
 	 * @param [in] buffer: Pointer of AIDataBuffer. One row of AIDataBuffer includes parsed raw data and model invoke output. However, latest row only includes parsed raw data at this point of time.
 	 * @param [in] countInputSets : Number of inputs to model
-	 * @param [out] invokeInput: Pointer of buffer to store preprocessed data. This buffer is later sent for invoke by AIFW.
+	 * @param [out] invokeInput: Pointer of buffer to store preprocessed data. This buffer is later sent for invoke by AIFW. It is not cleared between invokes, so every input set is to be written in full.
 	 * @param [in] modelAttribute: Contains AIModelAttribute value of current AI Model.
 	 * @return: AIFW_RESULT enum object. On success, AIFW_OK is returned.
 	 * 			On failure, a negative value is returned.
 	 */
 	virtual AIFW_RESULT preProcessData(std::shared_ptr<AIDataBuffer> buffer, uint16_t countInputSets, float **invokeInput, AIModelAttribute *modelAttribute) = 0;
+
+	/**
+	 * @brief Tells the element type and quantization of the input sets of the model once it is loaded, before any preProcessData().
+	 * @param [in] countInputSets: Number of inputs to model
+	 * @param [in] info: Type, quantization and count of elements of each input set.
+	 * @return: true if preProcessData() writes input sets quantized, in their own type (e.g. int8_t through (int8_t *)invokeInput[i]).
+	 * 			false if it writes float values, which AIFW then quantizes. Input sets of type AIFW_TENSOR_FLOAT32 are float either way.
+	 */
+	virtual bool setInputInfo(uint16_t countInputSets, const AITensorInfo *info)
+	{
+		return false;
+	}
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
 	/**
@@ -56,6 +56,63 @@ typedef enum _AIFW_RESULT {
 	AIFW_SOURCE_EOF = -14,	/* End Of File or End of Source data */
 } AIFW_RESULT;
 
+/**
+ * Element types of model inputs and outputs.
+ */
+typedef enum _AIFW_TENSOR_TYPE {
+	AIFW_TENSOR_FLOAT32 = 0,	/* float */
+	AIFW_TENSOR_INT8 = 1,		/* int8_t, quantized */
+	AIFW_TENSOR_INT16 = 2,		/* int16_t, quantized */
+} AIFW_TENSOR_TYPE;
+
+/**
+ * @brief Element type of a model input or output set, and its quantization.
+ * A quantized value q stands for scale * (q - zeroPoint). scale and zeroPoint are 1 and 0 for AIFW_TENSOR_FLOAT32.
+ * count: Number of elements of the set
+ */
+struct AITensorInfo {
+	AIFW_TENSOR_TYPE type;
+	float scale;
+	int32_t zeroPoint;
+	uint16_t count;
+};
+
+/**
+ * Engines a model may run on.
+ */
+typedef enum _AIFW_ENGINE {
+	AIFW_ENGINE_CPU = 0,	/* Runtime chosen in Kconfig, TFLM or ONERT-micro */
+	AIFW_ENGINE_NPU = 1,	/* Accelerator of CONFIG_AIFW_NPU_DEVPATH, or the CPU if it can't run the model */
+} AIFW_ENGINE;
+
+/**
+ * @brief Time spent in one operator of a model, measured with CONFIG_AIFW_PROFILE.
+ * name: Type of the operator, e.g. "FULLY_CONNECTED"
+ * ticks: Ticks spent in the operator, over all the invokes profiled
+ * maxTicks: Ticks of its longest run
+ * memory: Bytes of tensors allocated while it runs, 0 if the engine plans all tensors in one arena (TFLM)
+ */
+struct AIOperatorProfile {
+	const char *name;
+	uint64_t ticks;
+	uint32_t maxTicks;
+	uint32_t memory;
+};
+
+/**
+ * @brief Profile of a model, measured with CONFIG_AIFW_PROFILE.
+ * invokes: Number of invokes profiled
+ * ticksPerSecond: Frequency of the ticks, 0 if unknown (cycle counter of a core of unknown clock)
+ * arenaBytes: Bytes of the tensor arena used (TFLM), or peak bytes of tensors allocated during an invoke (ONERT-micro)
+ * operatorCount: Number of operators of the model
+ */
+struct AIModelProfile {
+	uint32_t invokes;
+	uint32_t ticksPerSecond;
+	uint32_t arenaBytes;
+	uint16_t operatorCount;
+};
+
 /**
  * @brief: AI Framework calls this function to collect the raw data and pass it for inference.
  * This callback is called when timer expires. Time interval is set in 'inferenceInterval' field of AIModelAttribute structure.
@@ -92,6 +149,7 @@ typedef void (*InferenceResultListener)(AIFW_RESULT res, void *values, uint16_t
  * inferenceResultCount: Number of primitive data values sent to application after inference of a modelset
  * MeanVals: List of mean values used in normalization
  * STDVals: List of standard deviation values used in normalization
+ * engine: Engine to run the model on
  */
 struct AIModelAttribute {
 	uint32_t crc32;
@@ -111,6 +169,7 @@ struct AIModelAttribute {
 	uint16_t inferenceResultCount;
 	float *meanVals;
 	float *stdVals;
+	AIFW_ENGINE engine;
 };
 
 #ifdef __cplusplus
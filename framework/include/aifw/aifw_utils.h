@@ -35,6 +35,22 @@
  */
 void normalizeData(float dataValues[], float meanVals[], float stdValues[], uint16_t countOfValues);
 
+/**
+ * @brief: Utility function to quantize float values to the type of a model input set
+ * @param [in] dataValues: info->count values to quantize
+ * @param [out] quantizedValues: Buffer of info->count elements of info->type
+ * @param [in] info: Type and quantization of the input set
+ */
+AIFW_RESULT quantizeData(const float *dataValues, void *quantizedValues, const struct AITensorInfo *info);
+
+/**
+ * @brief: Utility function to dequantize values of a model output set to float
+ * @param [in] quantizedValues: info->count elements of info->type
+ * @param [out] dataValues: Buffer of info->count values
+ * @param [in] info: Type and quantization of the output set
+ */
+AIFW_RESULT dequantizeData(const void *quantizedValues, float *dataValues, const struct AITensorInfo *info);
+
 /**
  * @brief: Utility function to get mse value from the predicted value
  * @param [in] realValues: Actual values
@@ -172,6 +172,9 @@ typedef struct _db_handle_s db_handle_t;
 struct _db_cursor_s;
 typedef struct _db_cursor_s db_cursor_t;
 
+struct _db_stmt_s;
+typedef struct _db_stmt_s db_stmt_t;
+
 typedef int db_storage_id_t;
 
 typedef uint32_t cursor_row_t;
@@ -222,6 +225,21 @@ db_result_t db_deinit(void);
 */
 db_result_t db_exec(char *format);
 
+/**
+* @brief insert many tuples into a relation in one pass
+*
+* @details @b #include <arastorage/arastorage.h>
+* The relation and its indexes are loaded once for all the queries instead of once per query.
+* Tuples are appended to storage CONFIG_ARASTORAGE_BULK_INSERT_ROWS at a time in one write,
+* and added to the indexes in increasing order of key.
+* @param[in] queries array of insert queries, all into the same relation
+* @param[in] count number of queries
+* @return On success, DB_OK is returned. On failure, a negative value is returned and the tuples
+*         of the chunks stored before the failure stay inserted.
+* @since TizenRT v5.0
+*/
+db_result_t db_bulk_insert(char **queries, int count);
+
 /**
 * @brief process query of arastorage
 *
@@ -232,6 +250,21 @@ db_result_t db_exec(char *format);
 */
 db_cursor_t *db_query(char *format);
 
+/**
+* @brief process a selection of arastorage a row at a time
+*
+* @details @b #include <arastorage/arastorage.h>
+* The cursor evaluates the condition as it moves, through the index when one applies, and holds
+* the current row only. So it takes the same memory for any number of rows, and is not bounded by
+* the DB_TUPLE_LIMIT rows of a db_query() cursor. It moves forward only, with cursor_move_first()
+* then cursor_move_next(), and cursor_get_count() gives the rows read so far. The relation stays
+* loaded until db_cursor_free(). Aggregations are not streamed.
+* @param[in] format query sentence
+* @return On success, a pointer to db_cursor_t is returned. On failure, a NULL is returned.
+* @since TizenRT v5.0
+*/
+db_cursor_t *db_query_stream(char *format);
+
 /**
 * @brief free allocated cursor data, it should be called before application terminated
 *
@@ -242,6 +275,75 @@ db_cursor_t *db_query(char *format);
 */
 db_result_t db_cursor_free(db_cursor_t *cursor);
 
+/**
+* @brief parse a query once to run it many times
+*
+* @details @b #include <arastorage/arastorage.h>
+* Each '?' in the values of an insert or in the condition of a select or remove is a parameter,
+* numbered from 1 in the order of the query, to bind before running the statement.
+* @param[in] format query sentence
+* @return On success, a pointer to db_stmt_t is returned. On failure, a NULL is returned.
+* @since TizenRT v5.0
+*/
+db_stmt_t *db_prepare(char *format);
+
+/**
+* @brief bind an integer to a parameter of a prepared statement
+*
+* @details @b #include <arastorage/arastorage.h>
+* @param[in] stmt a pointer to prepared statement
+* @param[in] index number of the parameter, from 1
+* @param[in] value value of the parameter
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_bind_long(db_stmt_t *stmt, int index, long value);
+
+/**
+* @brief bind a string to a parameter of a prepared insert
+*
+* @details @b #include <arastorage/arastorage.h>
+* Conditions compare integers only, so binding a string to a parameter of a condition fails.
+* @param[in] stmt a pointer to prepared statement
+* @param[in] index number of the parameter, from 1
+* @param[in] value value of the parameter, copied by the statement
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_bind_string(db_stmt_t *stmt, int index, char *value);
+
+/**
+* @brief run a prepared statement the way db_exec() runs a query
+*
+* @details @b #include <arastorage/arastorage.h>
+* @param[in] stmt a pointer to prepared statement
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_stmt_exec(db_stmt_t *stmt);
+
+/**
+* @brief run a prepared statement the way db_query() runs a query
+*
+* @details @b #include <arastorage/arastorage.h>
+* The cursor belongs to the statement and is reused by each run. It is valid until the next run
+* or db_finalize(), and must not be given to db_cursor_free().
+* @param[in] stmt a pointer to prepared statement
+* @return On success, a pointer to db_cursor_t is returned. On failure, a NULL is returned.
+* @since TizenRT v5.0
+*/
+db_cursor_t *db_stmt_query(db_stmt_t *stmt);
+
+/**
+* @brief free a prepared statement and its cursor
+*
+* @details @b #include <arastorage/arastorage.h>
+* @param[in] stmt a pointer to prepared statement
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_finalize(db_stmt_t *stmt);
+
 /**
 * @brief get string corresponding to each result value of API
 *
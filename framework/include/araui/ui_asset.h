@@ -39,6 +39,18 @@
  */
 typedef long ui_asset_t;
 
+/**
+ * @brief Counters of the glyphs drawn with a font asset.
+ *
+ * @see ui_font_asset_get_glyph_stats()
+ */
+typedef struct {
+	uint32_t atlas_hits;   //!< Glyphs taken from the atlas
+	uint32_t cache_hits;   //!< Glyphs taken from the glyph cache
+	uint32_t cache_misses; //!< Glyphs rasterized from the font
+	uint32_t cached;       //!< Glyphs in the glyph cache now
+} ui_font_glyph_stats_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -56,6 +68,22 @@ extern "C" {
  */
 ui_asset_t ui_image_asset_create_from_buffer(const uint8_t *buf);
 
+/**
+ * @brief Create Image Asset drawing the pixels given, without copying them.
+ *
+ * The pixels, such as a camera frame dequeued with VIDIOC_DQFRAME in RGB24, must stay valid
+ * until the image asset is destroyed via the @ref ui_image_asset_destroy().
+ *
+ * @param[in] pixels Pixels of the image, rows one after the other
+ * @param[in] width Width of the image
+ * @param[in] height Height of the image
+ * @param[in] pf Pixel format of the pixels
+ * @return On success, the image asset handle is returned. On failure, UI_NULL is returned.
+ *
+ * @see ui_image_asset_destroy()
+ */
+ui_asset_t ui_image_asset_create_from_pixels(const uint8_t *pixels, int32_t width, int32_t height, ui_pixel_format_t pf);
+
 /**
  * @brief Destroy the generated image asset and free the allocated memory.
  *
@@ -130,6 +158,33 @@ ui_asset_t ui_font_asset_create_from_buffer(const uint8_t *buf);
  */
 ui_error_t ui_font_asset_destroy(ui_asset_t font);
 
+/**
+ * @brief Set a pre-rasterized atlas of glyphs to the font asset.
+ *
+ * The atlas is made from the font by tools/araui/ttf2atlas for one font size.
+ * Text widgets of that size take the glyphs in the atlas from it instead of rasterizing them.
+ * The atlas is used in place, so the buffer must be valid until the font asset is destroyed.
+ *
+ * @param[in] font Handle of the font asset
+ * @param[in] atlas Pointer address of the buffer containing the atlas, UI_NULL to remove it
+ * @return On success, UI_OK is returned. On failure, the defined error type is returned.
+ *
+ * @see ui_font_asset_get_glyph_stats()
+ */
+ui_error_t ui_font_asset_set_atlas(ui_asset_t font, const uint8_t *atlas);
+
+/**
+ * @brief Get the counters of the glyphs drawn with the font asset.
+ *
+ * Glyphs not in the atlas are kept in a cache of the CONFIG_UI_GLYPH_CACHE_SIZE last used ones,
+ * so the hits and misses show whether the cache fits the text on the screen.
+ *
+ * @param[in] font Handle of the font asset
+ * @param[out] stats Counters since the font asset was created
+ * @return On success, UI_OK is returned. On failure, the defined error type is returned.
+ */
+ui_error_t ui_font_asset_get_glyph_stats(ui_asset_t font, ui_font_glyph_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,21 @@
 #include <araui/ui_commons.h>
 #include <araui/ui_widget.h>
 
+/**
+ * @brief Time spent by the frames drawn since the last reset, by stage.
+ *
+ * The times are of the system clock, so a stage shorter than its tick is only right on average
+ * over many frames.
+ */
+typedef struct {
+	uint32_t frames;          //!< Frames which drew something
+	uint64_t process_us;      //!< Animations, widget callbacks and the layout of the moved widgets
+	uint64_t render_us;       //!< Drawing the widgets in the redraw areas
+	uint64_t flush_us;        //!< Sending the redraw areas to the display, ui_dal_redraw()
+	uint32_t max_frame_us;    //!< Longest frame, all stages
+	uint64_t pixels;          //!< Pixels of the redraw areas, drawn and sent
+} ui_frame_stats_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -91,6 +106,33 @@ ui_error_t ui_core_quick_panel_appear(ui_quick_panel_event_type_t event_type);
  */
 ui_error_t ui_core_quick_panel_disappear(ui_quick_panel_event_type_t event_type);
 
+/**
+ * @brief Get the frame statistics since the last reset.
+ *
+ * They are read while the UI Core Service draws, the stages may be of frames one apart.
+ *
+ * @param[out] stats Frame statistics
+ * @return On success, UI_OK is returned. On failure, the defined error type is returned.
+ */
+ui_error_t ui_core_get_frame_stats(ui_frame_stats_t *stats);
+
+/**
+ * @brief Reset the frame statistics, from the next frame.
+ *
+ * @return On success, UI_OK is returned. On failure, the defined error type is returned.
+ */
+ui_error_t ui_core_reset_frame_stats(void);
+
+/**
+ * @brief Redraw the whole screen every frame instead of the areas which changed.
+ *
+ * Without CONFIG_UI_PARTIAL_UPDATE the whole screen is always redrawn.
+ *
+ * @param[in] full True to redraw the whole screen, false to redraw the changed areas
+ * @return On success, UI_OK is returned. On failure, the defined error type is returned.
+ */
+ui_error_t ui_core_set_full_update(bool full);
+
 #ifdef __cplusplus
 }
 #endif
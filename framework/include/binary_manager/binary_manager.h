@@ -69,6 +69,53 @@ binmgr_result_type_e binary_manager_get_update_info(char *binary_name, binary_up
  * @since TizenRT v3.0
  */
 binmgr_result_type_e binary_manager_get_update_info_all(binary_update_info_list_t *binary_info_list);
+
+#ifdef CONFIG_BINMGR_DELTA_UPDATE
+/**
+ * @brief Delta update in progress, made by binary_manager_patch_open()
+ */
+typedef struct binmgr_patch_s binmgr_patch_t;
+
+/**
+ * @brief Start a delta update of a binary
+ * @details @b #include <binary_manager/binary_manager.h>\n
+ *  It opens the running partition of the binary to read and its inactive partition to write.
+ *  The patch made by os/tools/mkbindelta.py is then given in parts with binary_manager_patch_write(),
+ *  as it is downloaded. The new binary is set to boot with binary_manager_set_bootparam() as after a full download.
+ * @param[in] binary_name The binary name to update
+ * @param[out] patch The delta update, until binary_manager_patch_close()
+ * @return A defined value of binmgr_result_type_e in <tinyara/binary_manager.h>
+ *         0 (BINMGR_OK) On success. On failure, negative value is returned.
+ * @since TizenRT v5.0
+ */
+binmgr_result_type_e binary_manager_patch_open(char *binary_name, binmgr_patch_t **patch);
+
+/**
+ * @brief Apply the next part of a patch
+ * @details @b #include <binary_manager/binary_manager.h>\n
+ *  The new binary is written to the inactive partition as the patch is applied, with a buffer of
+ *  CONFIG_BINMGR_DELTA_BUFSIZE bytes. The first part checks that the patch is made from the running binary.
+ * @param[in] patch The delta update
+ * @param[in] data The next bytes of the patch
+ * @param[in] len The number of bytes in data
+ * @return A defined value of binmgr_result_type_e in <tinyara/binary_manager.h>
+ *         0 (BINMGR_OK) On success. On failure, negative value is returned.
+ * @since TizenRT v5.0
+ */
+binmgr_result_type_e binary_manager_patch_write(binmgr_patch_t *patch, const uint8_t *data, size_t len);
+
+/**
+ * @brief Finish a delta update
+ * @details @b #include <binary_manager/binary_manager.h>\n
+ *  It checks that the whole patch is applied and the CRC of the new binary, and frees the delta update.
+ *  It is also called to abort a delta update.
+ * @param[in] patch The delta update
+ * @return A defined value of binmgr_result_type_e in <tinyara/binary_manager.h>
+ *         0 (BINMGR_OK) when the new binary is complete. On failure, negative value is returned.
+ * @since TizenRT v5.0
+ */
+binmgr_result_type_e binary_manager_patch_close(binmgr_patch_t *patch);
+#endif
 #endif
 
 /**
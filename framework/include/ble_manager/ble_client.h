@@ -216,3 +216,26 @@ ble_result_e ble_client_operation_enable_notification_and_indication(ble_client_
 ble_result_e ble_client_operation_read(ble_client_ctx *ctx, ble_attr_handle attr_handle, ble_data* data);
 ble_result_e ble_client_operation_write(ble_client_ctx *ctx, ble_attr_handle attr_handle, ble_data* data);
 ble_result_e ble_client_operation_write_no_response(ble_client_ctx *ctx, ble_attr_handle attr_handle, ble_data* data);
+
+/****************************************************************************
+ * Name: ble_client_operation_write_no_response_multi
+ *
+ * Description:
+ *   Write count buffers without response in one request, in the order of
+ *   data. The buffers are given to the driver without copy and can be
+ *   reused when it returns.
+ *
+ * Input Parameters:
+ *   ctx          - The context of client.
+ *   attr_handle  - attribute handle.
+ *   data         - array of count buffers.
+ *   count        - number of buffers.
+ *   sent         - set to the number of writes queued, less than count when
+ *                  the driver ran out of buffers. It can be NULL.
+ *
+ * Returned Value
+ *   Zero (BLE_RESULT_SUCCESS) is returned on success; a positive value is returned on
+ *   failure.
+ *
+ ****************************************************************************/
+ble_result_e ble_client_operation_write_no_response_multi(ble_client_ctx *ctx, ble_attr_handle attr_handle, ble_data *data, uint16_t count, uint16_t *sent);
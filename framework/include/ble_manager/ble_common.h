@@ -43,6 +43,20 @@
 #define BLE_MAX_BONDED_DEVICE 10
 #define BLE_DEFAULT_CONN_TIMEOUT 10000 /* 10 seconds */
 
+/* PHYs of ble_manager_set_phy(), which can be combined */
+#define BLE_PHY_1M 0x01
+#define BLE_PHY_2M 0x02
+#define BLE_PHY_CODED 0x04
+
+/* Largest link layer payload (bytes) and time to send it (us) of LE 2M */
+#define BLE_DATA_LEN_MAX_OCTETS 251
+#define BLE_DATA_LEN_MAX_TIME 2120
+
+/* Connection parameters of ble_manager_set_throughput_mode() */
+#define BLE_THROUGHPUT_CONN_INTERVAL_MIN 6 /* 7.5 ms */
+#define BLE_THROUGHPUT_CONN_INTERVAL_MAX 12 /* 15 ms */
+#define BLE_THROUGHPUT_SUPERVISION_TIMEOUT 200 /* 2 seconds */
+
 typedef struct _ble_data {
 	uint8_t *data;
 	uint16_t length;
@@ -176,4 +176,62 @@ ble_result_e ble_manager_get_version(uint8_t version[3]);
  ****************************************************************************/
 ble_result_e ble_manager_conn_param_update(ble_conn_handle *con_handle, ble_conn_param *conn_param);
 
+/****************************************************************************
+ * Name: ble_manager_set_data_len
+ *
+ * Description:
+ *   Request the controller to send link layer packets of up to tx_octets
+ *   bytes (data length extension), so that a notification or a write of
+ *   up to the MTU is not fragmented.
+ *
+ * Input Parameters:
+ *   con_handle : con handle for request
+ *   tx_octets  : 27 ~ BLE_DATA_LEN_MAX_OCTETS
+ *   tx_time    : 328 ~ 17040 us
+ *
+ * Returned Value
+ *   Zero (BLE_RESULT_SUCCESS) is returned on success; a positive value is returned on
+ *   failure. BLE_MANAGER_UNSUPPORTED if the driver can't change it.
+ *
+ ****************************************************************************/
+ble_result_e ble_manager_set_data_len(ble_conn_handle con_handle, uint16_t tx_octets, uint16_t tx_time);
+
+/****************************************************************************
+ * Name: ble_manager_set_phy
+ *
+ * Description:
+ *   Request the PHYs of the connection.
+ *
+ * Input Parameters:
+ *   con_handle : con handle for request
+ *   tx_phys    : preferred BLE_PHY_XXX to send
+ *   rx_phys    : preferred BLE_PHY_XXX to receive
+ *
+ * Returned Value
+ *   Zero (BLE_RESULT_SUCCESS) is returned on success; a positive value is returned on
+ *   failure. BLE_MANAGER_UNSUPPORTED if the driver can't change it.
+ *
+ ****************************************************************************/
+ble_result_e ble_manager_set_phy(ble_conn_handle con_handle, uint8_t tx_phys, uint8_t rx_phys);
+
+/****************************************************************************
+ * Name: ble_manager_set_throughput_mode
+ *
+ * Description:
+ *   Tune the connection for bulk transfers: the shortest connection
+ *   interval (BLE_THROUGHPUT_CONN_INTERVAL_XXX) without slave latency,
+ *   the largest data length and LE 2M. The data length and the PHY are
+ *   skipped if the driver doesn't support them.
+ *
+ * Input Parameters:
+ *   con_handle : con handle for request
+ *   role       : role of the connection parameter update
+ *
+ * Returned Value
+ *   Zero (BLE_RESULT_SUCCESS) is returned on success; a positive value is returned on
+ *   failure.
+ *
+ ****************************************************************************/
+ble_result_e ble_manager_set_throughput_mode(ble_conn_handle con_handle, ble_conn_param_role role);
+
 ble_result_e ble_manager_set_gap_device_name(char name[BLE_GAP_DEVICE_NAME_LEN]);
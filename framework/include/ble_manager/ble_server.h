@@ -132,6 +132,12 @@ ble_result_e ble_server_get_profile_count(uint16_t *count);
 // API for sending a characteristic value notification to the selected target(s). (notify to all clients conn_handle (notify all = 0x99))
 ble_result_e ble_server_charact_notify(ble_attr_handle attr_handle, ble_conn_handle con_handle, ble_data *data);
 
+// API for sending count notifications in one request, in the order of data.
+// The buffers are given to the driver without copy and can be reused when it returns.
+// sent is set to the number of notifications queued, which is less than count
+// when the driver ran out of buffers. sent can be NULL.
+ble_result_e ble_server_charact_notify_multi(ble_attr_handle attr_handle, ble_conn_handle con_handle, ble_data *data, uint16_t count, uint16_t *sent);
+
 // API for sending a characteristic value indication to the selected target(s). (notify to all clients conn_handle (notify all = 0x99))
 ble_result_e ble_server_charact_indicate(ble_attr_handle attr_handle, ble_conn_handle con_handle, ble_data *data);
 
@@ -27,6 +27,7 @@
 #ifndef __EVENTLOOP_H__
 #define __EVENTLOOP_H__
 
+#include <tinyara/config.h>
 #include <libtuv/uv.h>
 #include <stdbool.h>
 
@@ -93,6 +94,25 @@ typedef uv_loop_t el_loop_t;
  */
 typedef uv_signal_t el_event_t;
 
+/**
+ * @brief EventLoop File Descriptor structure
+ */
+typedef uv_poll_t el_fd_t;
+
+/**
+ * @brief EventLoop Source structure
+ */
+typedef uv_async_t el_source_t;
+
+/**
+ * @brief Events of a file descriptor watched by Event Loop
+ * @details These values are used in eventloop_add_fd_handler and passed to fd_callback. \n
+ * EVENTLOOP_FD_ERROR is only passed to fd_callback, the handler is deleted after it.
+ */
+#define EVENTLOOP_FD_READABLE UV_READABLE
+#define EVENTLOOP_FD_WRITABLE UV_WRITABLE
+#define EVENTLOOP_FD_ERROR    (1 << 7)
+
 /**
  * @brief EventLoop Timeout Callback
  */
@@ -112,6 +132,33 @@ typedef void (*thread_safe_callback)(void *data);
  */
 typedef bool (*event_callback)(void *registered_cb_data, void *received_event_data);
 
+/**
+ * @brief EventLoop File Descriptor Callback
+ * This is specific type for callback function used in eventloop_add_fd_handler. \n
+ * It is called with the descriptor, the events which occurred on it and the data registered with it. \n
+ */
+typedef bool (*fd_callback)(int fd, int events, void *cb_data);
+
+/**
+ * @brief EventLoop Source Callback
+ * This is specific type for callback function used in eventloop_add_source. \n
+ * It is called with each event posted to the source, its size and the data registered with it. \n
+ * The event is valid only until the callback function returns. \n
+ */
+typedef bool (*source_callback)(void *event, int size, void *cb_data);
+
+#ifdef CONFIG_NET_LWIP_NETDB
+struct addrinfo;
+
+/**
+ * @brief EventLoop Name Resolution Callback
+ * This is specific type for callback function used in eventloop_getaddrinfo. \n
+ * It is called with 0 and the addresses, which should be freed by freeaddrinfo(), \n
+ * or with an EAI_XXX error of getaddrinfo() and NULL. \n
+ */
+typedef void (*getaddrinfo_callback)(int result, struct addrinfo *res, void *cb_data);
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -205,6 +252,81 @@ el_event_t *eventloop_add_event_handler(int type, event_callback func, void *cb_
  */
 int eventloop_del_event_handler(el_event_t *handle);
 
+/**
+ * @brief Set callback which will be called when a file descriptor is ready
+ * @details @b #include <eventloop/eventloop.h> \n
+ * The descriptor is watched in the loop of its own task, so you should run loop by calling eventloop_loop_run. \n
+ * Sockets are watched with epoll when CONFIG_NET_EPOLL is enabled, so the cost of each loop iteration \n
+ * does not grow with the number of sockets. \n
+ * The descriptor is set to non-blocking mode. \n
+ * The handler is deleted when the callback function returns EVENTLOOP_CALLBACK_STOP or is called with EVENTLOOP_FD_ERROR. \n
+ * Otherwise, call eventloop_del_fd_handler before closing the descriptor.
+ * @param[in] fd the file descriptor to watch
+ * @param[in] events EVENTLOOP_FD_READABLE, EVENTLOOP_FD_WRITABLE or both
+ * @param[in] func the callback function to be called \n
+ *            It should return EVENTLOOP_CALLBACK_STOP(false) or EVENTLOOP_CALLBACK_CONTINUE(true).
+ * @param[in] cb_data data to pass to func when func is called
+ * @return On success, A pointer of created fd handle is returned. On failure, NULL is returned
+ * @since TizenRT v4.1
+ */
+el_fd_t *eventloop_add_fd_handler(int fd, int events, fd_callback func, void *cb_data);
+
+/**
+ * @brief Delete registered handler for file descriptor
+ * @details @b #include <eventloop/eventloop.h> \n
+ * The descriptor is not watched anymore and all used resources for the handler are freed. \n
+ * The descriptor is not closed.
+ * @param[in] handle a pointer of fd handle to be deleted
+ * @return On success, OK is returned. On failure, defined negative value is returned
+ * @since TizenRT v4.1
+ */
+int eventloop_del_fd_handler(el_fd_t *handle);
+
+/**
+ * @brief Add a source of events which other tasks post to the loop
+ * @details @b #include <eventloop/eventloop.h> \n
+ * Callbacks of frameworks such as Wi-Fi Manager, BLE Manager, Messaging or Task Manager run in their own \n
+ * tasks. Posting their events to a source from those callbacks dispatches them in the loop of the task \n
+ * which added the source, so you should run loop by calling eventloop_loop_run. \n
+ * The source has a ring of nevents events of up to event_size bytes, allocated here. Events are copied \n
+ * into the ring, so posting does not allocate, and the events pending when the loop wakes up are \n
+ * dispatched in a batch, in the order they were posted. \n
+ * The source is deleted when the callback function returns EVENTLOOP_CALLBACK_STOP, pending events are dropped.
+ * @param[in] event_size the maximum size of an event
+ * @param[in] nevents the number of events which can be pending
+ * @param[in] func the callback function to be called with each event \n
+ *            It should return EVENTLOOP_CALLBACK_STOP(false) or EVENTLOOP_CALLBACK_CONTINUE(true).
+ * @param[in] cb_data data to pass to func when func is called
+ * @return On success, A pointer of created source handle is returned. On failure, NULL is returned
+ * @since TizenRT v4.1
+ */
+el_source_t *eventloop_add_source(int event_size, int nevents, source_callback func, void *cb_data);
+
+/**
+ * @brief Post an event to a source
+ * @details @b #include <eventloop/eventloop.h> \n
+ * It can be called from any task, but not from an interrupt handler. \n
+ * The event is copied, so it can be on the stack of the caller.
+ * @param[in] handle a pointer of source handle from eventloop_add_source
+ * @param[in] event the event to post
+ * @param[in] size size of the event, up to the event_size of the source
+ * @return On success, OK is returned. If nevents events are already pending, EVENTLOOP_BUSY is returned. \n
+ *         On failure, defined negative value is returned
+ * @since TizenRT v4.1
+ */
+int eventloop_post_source(el_source_t *handle, const void *event, int size);
+
+/**
+ * @brief Delete a source
+ * @details @b #include <eventloop/eventloop.h> \n
+ * The pending events are dropped and all used resources for the source are freed. \n
+ * It should be called in the loop of the source, after the tasks posting to it stopped.
+ * @param[in] handle a pointer of source handle to be deleted
+ * @return On success, OK is returned. On failure, defined negative value is returned
+ * @since TizenRT v4.1
+ */
+int eventloop_del_source(el_source_t *handle);
+
 /**
  * @brief Send an event
  * @details @b #include <eventloop/eventloop.h> \n
@@ -250,6 +372,26 @@ int eventloop_loop_stop(void);
  */
 int eventloop_thread_safe_function_call(thread_safe_callback func, void *cb_data);
 
+#ifdef CONFIG_NET_LWIP_NETDB
+/**
+ * @brief Resolve a name without blocking the loop
+ * @details @b #include <eventloop/eventloop.h> \n
+ * The parameters are the same as getaddrinfo(), but the loop of its own task goes on while \n
+ * the DNS server is asked, so you should run loop by calling eventloop_loop_run. \n
+ * func is called once from the loop, even if the name is already cached. \n
+ * The resolver is polled every CONFIG_EVENTLOOP_DNS_POLL_INTERVAL milliseconds, and EAI_FAIL \n
+ * is passed to func if there is no answer after CONFIG_EVENTLOOP_DNS_TIMEOUT milliseconds.
+ * @param[in] node the host name or address string
+ * @param[in] service the port number as a string, or NULL
+ * @param[in] hints the family, socket type and protocol wanted, or NULL
+ * @param[in] func the callback function to be called with the result
+ * @param[in] cb_data data to pass to func when func is called
+ * @return On success, OK is returned. On failure, defined negative value is returned
+ * @since TizenRT v4.1
+ */
+int eventloop_getaddrinfo(const char *node, const char *service, const struct addrinfo *hints, getaddrinfo_callback func, void *cb_data);
+#endif
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
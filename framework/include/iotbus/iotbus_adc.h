@@ -31,6 +31,7 @@
 #ifndef IOTBUS_ADC_H_
 #define IOTBUS_ADC_H_
 
+#include <tinyara/config.h>
 #include <stdint.h>
 #include <sys/types.h>
 
@@ -63,6 +64,17 @@ extern "C" {
 
 typedef void (*adc_read_cb)(int channel, uint32_t data);
 
+#ifdef CONFIG_ADC_SCAN
+/**
+ * @brief callback of a continuous scan, called for each block of samples.
+ * @details data holds nsamples samples, nchannels consecutive samples per scan
+ * in the order of the scanned channels. timestamp is the time of the first scan
+ * in microseconds and period the time between two scans. overrun is the number
+ * of blocks lost just before this one.
+ */
+typedef void (*adc_scan_cb)(uint64_t timestamp, uint32_t period, int nchannels, const uint16_t *data, int nsamples, int overrun);
+#endif
+
 /**
  * @brief initializes adc_context.
  *
@@ -147,6 +159,25 @@ int iotbus_adc_stop(iotbus_adc_context_h hnd);
  */
 int32_t iotbus_adc_get_sample(iotbus_adc_context_h hnd, int timeout);
 
+#ifdef CONFIG_ADC_SCAN
+/**
+ * @brief start a continuous scan of several channels in blocks.
+ *
+ * @details @b #include <iotbus/iotbus_adc.h>
+ * The driver converts the channels continuously into a double buffer and
+ * scan_cb is called with each block of CONFIG_ADC_SCAN_BLOCKSIZE samples or
+ * less. It runs until iotbus_adc_stop().
+ * @param[in] hnd handle of adc_context
+ * @param[in] channels channels converted in each scan
+ * @param[in] nchannels number of channels, 1 to CONFIG_ADC_SCAN_NCHANNELS
+ * @param[in] rate scans per second, 0 for as fast as the device goes
+ * @param[in] scan_cb callback function called for each block.
+ * @return On success, 0 is returned. On failure, a negative value is returned.
+ * @since TizenRT v4.0
+ */
+int iotbus_adc_start_scan(iotbus_adc_context_h hnd, const uint8_t *channels, int nchannels, uint32_t rate, const adc_scan_cb scan_cb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
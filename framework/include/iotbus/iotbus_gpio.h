@@ -104,6 +104,9 @@ extern "C" {
 
 typedef void (*gpio_isr_cb)(void *user_data);
 typedef void (*iotbus_gpio_cb)(iotbus_gpio_context_h);
+#ifdef CONFIG_GPIO_EVENTS
+typedef void (*gpio_event_cb)(void *user_data, uint64_t timestamp, int value);
+#endif
 
 /**
  * @brief initializes gpio_context based on gpio pin.
@@ -185,6 +188,27 @@ int iotbus_gpio_register_cb(iotbus_gpio_context_h dev, iotbus_gpio_edge_e edge,
  */
 int iotbus_gpio_unregister_cb(iotbus_gpio_context_h dev);
 
+#ifdef CONFIG_GPIO_EVENTS
+/**
+ * @brief registers event handler callback for interrupt with the time of each edge.
+ *
+ * @details @b #include <iotbus/iotbus_gpio.h>\n
+ * event_cb is called once for each edge of the edge mode, in order, with the
+ * time in microseconds taken by the driver in the interrupt and the value of
+ * the gpio after the edge. Edges which come before the previous ones were
+ * handled are not lost, up to CONFIG_GPIO_NEVENTS of them.
+ * It is unregistered with iotbus_gpio_unregister_cb().
+ *
+ * @param[in] dev handle of gpio_context
+ * @param[in] edge gpio edge type
+ * @param[in] event_cb the pointer of event callback function
+ * @param[in] user_data event function parameter
+ * @return On success, 0 is returned. On failure, a negative value is returned.
+ * @since TizenRT v4.0
+ */
+int iotbus_gpio_register_event_cb(iotbus_gpio_context_h dev, iotbus_gpio_edge_e edge, gpio_event_cb event_cb, void *user_data);
+#endif
+
 #ifdef CONFIG_IOTDEV
 /**
  * @brief register interrupt callback.
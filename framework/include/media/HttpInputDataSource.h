@@ -34,6 +34,8 @@
 #include <curl/curl.h>
 #include <curl/easy.h>
 #include <pthread.h>
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -119,6 +121,14 @@ public:
 	 * @since TizenRT v2.0
 	 */
 	ssize_t read(unsigned char *buf, size_t size) override;
+	/**
+	 * @brief Gets the health of the download buffer
+	 * @details @b #include <media/HttpInputDataSource.h>
+	 * param[out] health filled once per CONFIG_HTTPSOURCE_HEALTH_INTERVAL
+	 * @return True if health was filled, False if there is nothing to report
+	 * @since TizenRT v5.0
+	 */
+	bool getBufferHealth(buffer_health_t *health) override;
 
 public:
 	/**
@@ -132,6 +142,8 @@ private:
 	static size_t HeaderCallback(char *data, size_t size, size_t nmemb, void *userp);
 	static size_t WriteCallback(char *data, size_t size, size_t nmemb, void *userp);
 	static void *workerMain(void *arg);
+	void updateRates();
+	void stopRebuffering();
 
 private:
 	std::string mContentType;
@@ -141,6 +153,22 @@ private:
 	std::condition_variable mCondv;
 	bool mIsHeaderReceived;
 	bool mIsDataReceived;
+	size_t mContentLength;
+	std::atomic<size_t> mOffset;
+	size_t mResumeOffset;
+	size_t mSkip;
+	bool mDownloadFinished;
+	std::atomic<bool> mRebuffering;
+	size_t mRebufferThreshold;
+	size_t mConsumed;
+	std::atomic<unsigned int> mUnderruns;
+	std::atomic<unsigned int> mReconnects;
+	std::chrono::steady_clock::time_point mWindowStart;
+	size_t mWindowOffset;
+	size_t mWindowConsumed;
+	unsigned int mWindowUnderruns;
+	buffer_health_t mHealth;
+	bool mHealthReported;
 	std::shared_ptr<HttpStream> mHttpStream;
 	std::shared_ptr<StreamBuffer> mStreamBuffer;
 	std::shared_ptr<StreamBufferReader> mBufferReader;
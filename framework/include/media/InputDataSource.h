@@ -84,6 +84,15 @@ public:
 	 */
 	virtual int seekTo(off_t offset) { return -1; }
 
+	/**
+	 * @brief Gets the health of the download buffer of a network source
+	 * @details @b #include <media/InputDataSource.h>
+	 * param[out] health filled when a new report is due
+	 * @return True if health was filled, False if there is nothing to report
+	 * @since TizenRT v5.0
+	 */
+	virtual bool getBufferHealth(buffer_health_t *health) { return false; }
+
 };
 
 } // namespace stream
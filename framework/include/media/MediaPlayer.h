@@ -209,6 +209,22 @@ public:
 	 */
 	player_result_t setDataSource(std::unique_ptr<stream::InputDataSource>);
 
+	/**
+	 * @brief Queue a DataSource to be played after the current one
+	 * @details @b #include <media/MediaPlayer.h>
+	 * This function is a synchronous API
+	 * It can be called from the configured state until the playback finished.
+	 * A source with the channels, sample rate and pcm format of the one before
+	 * is opened and decoded while that one plays, and follows it without a gap.
+	 * Otherwise the audio stream is set up again between them.
+	 * onPlaybackFinished() is called once the last queued source finished.
+	 * The queue is dropped by unprepare() and reset().
+	 * @param[in] dataSource The dataSource to be played next
+	 * @return The result of the queueDataSource operation
+	 * @since TizenRT v5.0
+	 */
+	player_result_t queueDataSource(std::unique_ptr<stream::InputDataSource>);
+
 	/**
 	 * @brief Set the observer of MediaPlayer
 	 * @details @b #include <media/MediaPlayer.h>
@@ -257,6 +273,41 @@ public:
 	 */
 	player_result_t setLooping(bool loop);
 
+	/**
+	 * @brief Set the player to play with a low latency
+	 * @details @b #include <media/MediaPlayer.h>
+	 * This function is a synchronous API
+	 * It is applied at the next prepare(), with short periods of the audio card.
+	 * Suited to short sounds like voice prompts and notifications.
+	 * @param[in] enable true for a low latency
+	 * @return The result of the setLowLatency operation,
+	 *         PLAYER_ERROR_DEVICE_NOT_SUPPORTED without CONFIG_MEDIA_LOW_LATENCY
+	 * @since TizenRT v5.0
+	 */
+	player_result_t setLowLatency(bool enable);
+
+	/**
+	 * @brief Get the latency of the last start
+	 * @details @b #include <media/MediaPlayer.h>
+	 * This function is a synchronous API
+	 * @param[out] usec Time in microseconds from start() to the first frames given to the audio card
+	 * @return The result of the getStartLatency operation,
+	 *         PLAYER_ERROR_INVALID_STATE if no frame was played since start()
+	 * @since TizenRT v5.0
+	 */
+	player_result_t getStartLatency(unsigned int *usec);
+
+	/**
+	 * @brief Get where the player spent its time since it was prepared
+	 * @details @b #include <media/MediaPlayer.h>
+	 * This function is a synchronous API
+	 * @param[out] profile Time in the decoder, the data source and the audio device, with buffer levels and xruns
+	 * @return The result of the getProfile operation,
+	 *         PLAYER_ERROR_DEVICE_NOT_SUPPORTED without CONFIG_MEDIA_PROFILE
+	 * @since TizenRT v5.0
+	 */
+	player_result_t getProfile(media_profile_t *profile);
+
 private:
 	std::shared_ptr<MediaPlayerImpl> mPMpImpl;
 	uint64_t mId;
@@ -35,6 +35,8 @@ enum player_error_e : int;
 typedef enum player_error_e player_error_t;
 enum buffer_state_e : int;
 typedef enum buffer_state_e buffer_state_t;
+struct buffer_health_s;
+typedef struct buffer_health_s buffer_health_t;
 
 /**
  * @class
@@ -129,6 +131,13 @@ public:
 	 * @since TizenRT v2.0
 	 */
 	virtual void onPlaybackBufferStateChanged(MediaPlayer &mediaPlayer, buffer_state_t state) {}
+	/**
+	 * @brief informs the user of the health of the download buffer of a network source
+	 * @details @b #include <media/MediaPlayerObserverInterface.h>
+	 * Reported periodically while the source is read.
+	 * @since TizenRT v5.0
+	 */
+	virtual void onPlaybackBufferHealth(MediaPlayer &mediaPlayer, const buffer_health_t &health) {}
 	/**
 	 * @brief informs the user of the player has been prepared
 	 * @details @b #include <media/MediaPlayerObserverInterface.h>
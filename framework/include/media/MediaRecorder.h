@@ -253,6 +253,17 @@ public:
 	 */
 	bool isRecording();
 
+	/**
+	 * @brief Get where the recorder spent its time since it was prepared
+	 * @details @b #include <media/MediaRecorder.h>
+	 * This function is a synchronous API
+	 * @param[out] profile Time in the encoder, the data source and the audio device, with buffer levels and xruns
+	 * @return The result of the getProfile operation,
+	 *         RECORDER_ERROR_DEVICE_NOT_SUPPORTED without CONFIG_MEDIA_PROFILE
+	 * @since TizenRT v5.0
+	 */
+	recorder_result_t getProfile(media_profile_t *profile);
+
 private:
 	std::shared_ptr<MediaRecorderImpl> mPMrImpl;
 	uint64_t mId;
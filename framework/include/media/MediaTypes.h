@@ -29,6 +29,7 @@
 #ifndef __MEDIA_TYPES_H
 #define __MEDIA_TYPES_H
 
+#include <stdint.h>
 #include <tinyalsa/tinyalsa.h>
 
 #define AAC_HEADER_LENGTH         7
@@ -123,6 +124,55 @@ typedef enum audio_format_type_e {
 	AUDIO_FORMAT_TYPE_S32_LE = PCM_FORMAT_S32_LE
 } audio_format_type_t;
 
+/**
+ * @brief Health of the download buffer of a network source.
+ * @details Rates are in bytes per second.
+ * @since TizenRT v5.0
+ */
+typedef struct buffer_health_s {
+	/* Bytes waiting in the download buffer */
+	unsigned int level;
+	/* Bytes buffered again before reading goes on after an underrun */
+	unsigned int threshold;
+	/* Estimated download rate */
+	unsigned int downloadRate;
+	/* Estimated rate the player reads at */
+	unsigned int consumeRate;
+	/* Underruns since the source was opened */
+	unsigned int underruns;
+	/* Reconnections since the source was opened */
+	unsigned int reconnects;
+} buffer_health_t;
+
+/**
+ * @brief Where a player or a recorder spent its time since it was prepared.
+ * @details Times are in microseconds. The codec is the decoder of a player or
+ * the encoder of a recorder, the source is the data source read by a player or
+ * written by a recorder.
+ * @since TizenRT v5.0
+ */
+typedef struct media_profile_s {
+	/* Calls into the codec, with their total and longest time */
+	uint32_t codecCalls;
+	uint64_t codecTime;
+	uint32_t codecMaxTime;
+	/* Time blocked on the audio device, or the mixer, and the longest call */
+	uint64_t deviceTime;
+	uint32_t deviceMaxTime;
+	/* Part of deviceTime spent resampling, not counted for mixed streams */
+	uint64_t resampleTime;
+	/* Time in the data source, and the longest call */
+	uint64_t sourceTime;
+	uint32_t sourceMaxTime;
+	/* Bytes left in the stream buffer after the last read from it, and the fewest */
+	uint32_t bufferLevel;
+	uint32_t bufferMinLevel;
+	/* Underruns of the stream buffer of a player, overruns of a recorder's */
+	uint32_t bufferXruns;
+	/* Xruns of the audio device, not counted for mixed streams */
+	uint32_t deviceXruns;
+} media_profile_t;
+
 } // namespace media
 
 #endif
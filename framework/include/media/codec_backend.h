@@ -0,0 +1,103 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/**
+ * @ingroup MEDIA
+ * @{
+ */
+
+/**
+ * @file media/codec_backend.h
+ * @brief Registry of hardware and DSP codec backends
+ * @details The decoder and encoder of the media framework try the registered
+ * backends by priority before falling back on the software codecs.
+ */
+
+#ifndef __MEDIA_CODEC_BACKEND_H
+#define __MEDIA_CODEC_BACKEND_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <sys/types.h>
+
+/**
+ * @brief Whether a backend decodes or encodes.
+ */
+enum codec_backend_kind_e {
+	CODEC_BACKEND_DECODER, /**< Compressed data in, PCM out */
+	CODEC_BACKEND_ENCODER, /**< PCM in, compressed data out */
+};
+
+typedef enum codec_backend_kind_e codec_backend_kind_t;
+
+/**
+ * @brief Operations of a codec backend.
+ * @details audio_type follows audio_type_t of the media framework. A handle is
+ * used by a single stream, from a single thread at a time.
+ */
+struct codec_backend_ops_s {
+	/* Whether the backend takes this stream now, e.g. the DSP is not busy */
+	bool (*probe)(int audio_type, unsigned int sample_rate, unsigned short channels);
+	/* Returns the handle of a new stream, or NULL */
+	void *(*open)(int audio_type, unsigned int sample_rate, unsigned short channels);
+	/* Takes up to len bytes of input. data is the buffer of the caller, not
+	 * a copy: the device may read it in place until push() returns.
+	 */
+	size_t (*push)(void *handle, const void *data, size_t len);
+	/* Bytes push() takes now */
+	size_t (*space)(void *handle);
+	/* Whether all the input was processed */
+	bool (*empty)(void *handle);
+	/* Gets up to max bytes of output, 0 when more input is needed. sample_rate
+	 * and channels of the PCM are set by decoders, and may be NULL for encoders.
+	 */
+	size_t (*pull)(void *handle, void *buf, size_t max, unsigned int *sample_rate, unsigned short *channels);
+	void (*close)(void *handle);
+};
+
+typedef struct codec_backend_ops_s codec_backend_ops_t;
+
+/**
+ * @brief Registers a codec backend.
+ * @details ops is kept, not copied. Backends of higher priority are tried first.
+ * @return OK on success, -EINVAL, -EEXIST if name is registered or -ENOMEM if
+ * CONFIG_AUDIO_CODEC_BACKEND_MAX backends are registered.
+ */
+int codec_backend_register(const char *name, codec_backend_kind_t kind, int priority, const codec_backend_ops_t *ops);
+
+/**
+ * @brief Unregisters a codec backend.
+ * @details Streams already opened with the backend keep using it until closed.
+ * @return OK on success, -EINVAL or -ENOENT.
+ */
+int codec_backend_unregister(const char *name);
+
+/**
+ * @brief Opens a stream with the first registered backend taking it.
+ * @return OK with *ops and *handle set, or -ENOENT when software has to be used.
+ */
+int codec_backend_open(codec_backend_kind_t kind, int audio_type, unsigned int sample_rate, unsigned short channels, const codec_backend_ops_t **ops, void **handle);
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif
+#endif
+/** @} */ // end of MEDIA group
@@ -28,6 +28,9 @@
 #ifndef __MESSAGING_H__
 #define __MESSAGING_H__
 
+#include <stdint.h>
+#include <sys/types.h>
+
 /**
  * @brief These configs are used internally for getting receivers information before send.
  * @details MSG_READ_YET : There are more than CONFIG_MESSAGING_RECV_LIST_SIZE receivers, messaging f/w tries to read information again.\n
@@ -67,6 +70,25 @@ struct msg_recv_buf_s {
 };
 typedef struct msg_recv_buf_s msg_recv_buf_t;
 
+/**
+ * @brief The handle of a shared buffer, which is sent instead of the payload
+ * @details A buffer from messaging_buf_alloc() is sent by giving its handle,
+ * messaging_buf_handle(buf), as msg with msglen sizeof(msg_buf_handle_t).
+ * Only the handle is copied through the message queue.
+ */
+struct msg_buf_handle_s {
+	uint32_t magic;
+	int shmid;
+	void *self;
+	uint32_t size;
+};
+typedef struct msg_buf_handle_s msg_buf_handle_t;
+
+/**
+ * @brief The handle of a port from messaging_connect()
+ */
+typedef struct msg_port_s msg_port_t;
+
 /**
  * @brief Called when a message is received
  */
@@ -203,6 +225,100 @@ int messaging_recv_nonblock(const char *port_name, msg_recv_buf_t *recv_buf, msg
  */
 int messaging_cleanup(const char *port_name);
 
+/**
+ * @brief Allocate a reference-counted buffer which can be sent without copy.
+ * @details @b #include <messaging/messaging.h>\n
+ * The caller holds one reference. Each receiver of the handle gets one more,
+ * which it must drop with messaging_buf_release() after messaging_buf_open().\n
+ * With CONFIG_MM_SHM, the buffer is a shared memory region which is visible
+ * from other binaries. Otherwise it is taken from the heap, and the sender and
+ * the receivers must share the address space (flat build or same binary).
+ * @param[in] size The size of the payload
+ * @return On success, the payload is returned. On failure, NULL is returned.
+ * @since TizenRT v5.0
+ */
+void *messaging_buf_alloc(size_t size);
+/**
+ * @brief Get the handle to send instead of a buffer from messaging_buf_alloc().
+ * @details @b #include <messaging/messaging.h>\n
+ * Set msg of msg_send_data_t to the handle and msglen to sizeof(msg_buf_handle_t).
+ * The messaging APIs then give one reference to each receiver.
+ * @param[in] buf The payload returned by messaging_buf_alloc()
+ * @return The handle of the buffer.
+ * @since TizenRT v5.0
+ */
+char *messaging_buf_handle(void *buf);
+/**
+ * @brief Get the payload of a shared buffer received as a message.
+ * @details @b #include <messaging/messaging.h>\n
+ * recv_buf must have room for a msg_buf_handle_t. The receiver owns one
+ * reference to the buffer and must call messaging_buf_release() when done.
+ * @param[in] recv_buf The received message
+ * @param[out] size The size of the payload, if not NULL
+ * @return On success, the payload is returned. If the message is not a handle, NULL is returned.
+ * @since TizenRT v5.0
+ */
+void *messaging_buf_open(msg_recv_buf_t *recv_buf, size_t *size);
+/**
+ * @brief Drop one reference to a shared buffer.
+ * @details @b #include <messaging/messaging.h>\n
+ * The buffer is freed when the sender and all the receivers released it.
+ * @param[in] buf The payload returned by messaging_buf_alloc() or messaging_buf_open()
+ * @since TizenRT v5.0
+ */
+void messaging_buf_release(void *buf);
+
+/**
+ * @brief Connect to the receiver of a message port.
+ * @details @b #include <messaging/messaging.h>\n
+ * The receiver is looked up once and its message queue is kept open, so the
+ * sends through the handle skip the lookup and the open of each message.\n
+ * There must be one receiver on the port. The handle is used by the task which
+ * connected, and is valid until the receiver calls messaging_cleanup().\n
+ * Available with CONFIG_MESSAGING_PORT_CACHE.
+ * @param[in] port_name The message port name to send.
+ * @return On success, the handle is returned. On failure, NULL is returned.
+ * @since TizenRT v5.0
+ */
+msg_port_t *messaging_connect(const char *port_name);
+/**
+ * @brief Send(unicast) message through a handle, like messaging_send().
+ * @details @b #include <messaging/messaging.h>\n
+ * @param[in] port The handle from messaging_connect()
+ * @param[in] send_data\n
+ *		  msg          : The message to be sent.\n
+ *		  msglen       : The length of message to be sent.\n
+ *		  priority     : A non-negative integer that specifies the priority of this message.
+ * @return On success, OK is returned. On failure, ERROR is returned.
+ * @since TizenRT v5.0
+ */
+int messaging_port_send(msg_port_t *port, msg_send_data_t *send_data);
+/**
+ * @brief Send(unicast) message through a handle with sync mode, like messaging_send_sync().
+ * @details @b #include <messaging/messaging.h>\n
+ * The reply queue of the task is kept until messaging_cleanup() of the port name.
+ * @param[in] port The handle from messaging_connect()
+ * @param[in] send_data\n
+ *		  msg          : The message to be sent.\n
+ *		  msglen       : The length of message to be sent.\n
+ *		  priority     : A non-negative integer that specifies the priority of this message.
+ * @param reply_buf\n
+ *		  [out] buf          : A message buffer to receive the reply message\n
+ *		  [in] buflen        : A message size for reply message\n
+ *		  [out] sender_pid   : The pid who replies this message
+ * @return On success, OK is returned. On failure, ERROR is returned.
+ * @since TizenRT v5.0
+ */
+int messaging_port_send_sync(msg_port_t *port, msg_send_data_t *send_data, msg_recv_buf_t *reply_buf);
+/**
+ * @brief Close a handle from messaging_connect().
+ * @details @b #include <messaging/messaging.h>\n
+ * @param[in] port The handle from messaging_connect()
+ * @return On success, OK is returned. On failure, ERROR is returned.
+ * @since TizenRT v5.0
+ */
+int messaging_disconnect(msg_port_t *port);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
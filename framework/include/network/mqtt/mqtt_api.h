@@ -117,6 +117,7 @@ struct _mqtt_client_config_s {
 	int protocol_version;	/**< mqtt protocol version */
 	bool debug;	/**< mqtt debug flag */
 	mqtt_tls_param_t *tls; /**< mqtt tls parameter */
+	int max_inflight; /**< QoS 1 and 2 publishes sent before their acknowledgement, 0 for CONFIG_NETUTILS_MQTT_MAX_INFLIGHT */
 
 	void (*on_connect)(void *client, int result);
 	/**< on_connect call back function */
@@ -209,6 +210,22 @@ int mqtt_disconnect(mqtt_client_t *handle);
  */
 int mqtt_publish(mqtt_client_t *handle, char *topic, char *data, uint32_t data_len, uint8_t qos, uint8_t retain);
 
+/**
+ * @brief mqtt_get_inflight() gets the number of QoS 1 and 2 publishes
+ *        waiting for their acknowledgement and the number of those queued
+ *        because the inflight window is full
+ * @details @b #include <network/mqtt/mqtt_api.h>\n
+ * mqtt_publish() does not wait for the acknowledgement of a publish. A
+ * publisher can keep the queue short with this instead of waiting for
+ * on_publish of each publish.
+ * @param[in] handle the handle of MQTT client object
+ * @param[out] inflight the number of publishes sent and not acknowledged
+ * @param[out] queued the number of publishes waiting to be sent
+ * @return On success, 0 is returned. On failure, a negative value is returned.
+ * @since TizenRT v4.1
+ */
+int mqtt_get_inflight(mqtt_client_t *handle, int *inflight, int *queued);
+
 /**
  * @brief mqtt_subscribe() subscribes for the specified topic with MQTT broker
  *
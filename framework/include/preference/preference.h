@@ -353,6 +353,34 @@ int preference_shared_set_changed_cb(const char *key, preference_changed_cb call
  */
 int preference_shared_unset_changed_cb(const char *key);
 
+/**
+ * @brief Start a transaction of the calling thread
+ * @details @b #include <preference/preference.h>
+ * Values set from now on, private or shared, are kept until preference_commit() writes them together.
+ * A key set twice is written with its last value.
+ * @return On success, OK is returned. On failure, a negative value defined in preference_result_error_e is returned.
+ * @since TizenRT v5.0
+ */
+int preference_begin(void);
+
+/**
+ * @brief Write the values set since preference_begin() and end the transaction
+ * @details @b #include <preference/preference.h>
+ * With CONFIG_PREFERENCE_LOG, the values of one namespace are written at once and a power loss keeps all or none of them.
+ * The changed callbacks of the keys are notified once, after the write, with one signal per registering task.
+ * @return On success, OK is returned. On failure, a negative value defined in preference_result_error_e is returned.
+ * @since TizenRT v5.0
+ */
+int preference_commit(void);
+
+/**
+ * @brief Drop the values set since preference_begin() and end the transaction
+ * @details @b #include <preference/preference.h>
+ * @return On success, OK is returned. On failure, a negative value defined in preference_result_error_e is returned.
+ * @since TizenRT v5.0
+ */
+int preference_discard(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -321,6 +321,48 @@ int st_things_register_things_status_change_cb(st_things_status_change_cb status
  */
 int st_things_notify_observers(const char *resource_uri);
 
+/**
+ * @brief Notify the observers of a specific resource, within a time window.
+ *        The updates of a resource in the window are sent as one notification,
+ *        which reads the latest values. Without CONFIG_ST_THINGS_NOTIFY_BATCH,
+ *        this is st_things_notify_observers().
+ *
+ * @details @b #include <st_things/st_things.h>
+ * @param[in] resource_uri Resource URI of the resource which will be notified to observers.
+ * @return @c 0 on success, otherwise a negative error value
+ * @retval #ST_THINGS_ERROR_NONE Successful
+ * @retval #ST_THINGS_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #ST_THINGS_ERROR_OPERATION_FAILED Operation failed
+ * @retval #ST_THINGS_ERROR_STACK_NOT_INITIALIZED Stack is not intialized.
+ * @retval #ST_THINGS_ERROR_STACK_NOT_STARTED Stack is not started.
+ * @since TizenRT v5.0
+ */
+int st_things_notify_observers_batched(const char *resource_uri);
+
+/**
+ * @brief Send the pending notifications of st_things_notify_observers_batched() now.
+ *
+ * @details @b #include <st_things/st_things.h>
+ * @return @c 0 on success, otherwise a negative error value
+ * @retval #ST_THINGS_ERROR_NONE Successful
+ * @retval #ST_THINGS_ERROR_OPERATION_FAILED A notification failed
+ * @since TizenRT v5.0
+ */
+int st_things_flush_notifications(void);
+
+/**
+ * @brief Get the statistics of the batched notifications.
+ *
+ * @details @b #include <st_things/st_things.h>
+ * @param[out] stats Statistics since the start, or since the last reset.
+ * @param[in] reset Whether to clear the statistics after reading them.
+ * @return @c 0 on success, otherwise a negative error value
+ * @retval #ST_THINGS_ERROR_NONE Successful
+ * @retval #ST_THINGS_ERROR_INVALID_PARAMETER Invalid parameter
+ * @since TizenRT v5.0
+ */
+int st_things_get_notify_stats(st_things_notify_stats_s *stats, bool reset);
+
 /**
  * @brief Create an instance of representation.
  *
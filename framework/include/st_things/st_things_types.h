@@ -395,5 +395,18 @@ typedef struct _st_things_set_request_message {
 
 } st_things_set_request_message_s;
 
+/**
+ * @brief Structure for the statistics of the batched notifications.
+ * @since TizenRT v5.0
+ */
+typedef struct _st_things_notify_stats {
+	uint32_t updates;									/**< Calls of st_things_notify_observers_batched() */
+	uint32_t coalesced;									/**< Updates merged into a pending notification */
+	uint32_t overflows;								/**< Updates sent at once as the batch was full */
+	uint32_t notifications;								/**< Notifications sent to the observers */
+	uint32_t failures;									/**< Notifications which failed */
+	uint32_t notify_usec;								/**< Time spent sending the notifications */
+} st_things_notify_stats_s;
+
 #endif							/* __ST_THINGS_TYPES_H__ */
 /** @} */// end of SmartThings group
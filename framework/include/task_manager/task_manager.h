@@ -97,6 +97,9 @@ enum tm_result_error_e {
 enum tm_defined_broadcast_msg {
 	TM_BROADCAST_WIFI_ON = 1,
 	TM_BROADCAST_WIFI_OFF = 2,
+	TM_BROADCAST_TASK_DEADLINE_MISS = 3,	/* From the task monitor, with a struct task_monitor_event_s */
+	TM_BROADCAST_TASK_OVERRUN = 4,		/* From the task monitor, with a struct task_monitor_event_s */
+	TM_BROADCAST_SYSTEM_OVERLOAD = 5,	/* From the task monitor, with a struct task_monitor_event_s */
 	TM_BROADCAST_SYSTEM_MSG_MAX,
 #ifndef CONFIG_TASK_MANAGER_USER_SPECIFIC_BROADCAST
 	TM_BROADCAST_MSG_MAX = TM_BROADCAST_SYSTEM_MSG_MAX,
@@ -138,7 +141,9 @@ typedef void (*tm_unicast_callback_t)(tm_msg_t *unicast_data);
  * @brief Broadcast callback function type
  * The broadcast callback gets 'broadcast_data' argument through the input variable of task_manager_broadcast().\n
  * The 'cb_data' is set through the task_manager_set_broadcast_cb() and the broadcast callback function will get\n
- * this argument when the task_manager_broadcast() is called from the task manager.
+ * this argument when the task_manager_broadcast() is called from the task manager.\n
+ * The 'broadcast_data->msg' is shared by all the receivers of the broadcast and is freed after the callback returns.\n
+ * The callback must not modify it, and should copy what it needs to keep.
  */
 typedef void (*tm_broadcast_callback_t)(tm_msg_t *broadcast_data, tm_msg_t *cb_data);
 
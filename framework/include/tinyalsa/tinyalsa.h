@@ -106,6 +106,13 @@ extern "C" {
  */
 #define PCM_NORESTART 0x00000004
 
+/** Specifies that the period size and count of the config are used
+ * when the driver reports larger buffers, to lower the latency.
+ * Used in @ref pcm_open.
+ * @ingroup libtinyalsa-pcm
+ */
+#define PCM_LOW_LATENCY 0x00000008
+
 /** For inputs, this means the PCM is recording audio samples.
  * For outputs, this means the PCM is playing audio samples.
  * @ingroup libtinyalsa-pcm
@@ -378,6 +385,18 @@ int pcm_drain(struct pcm *pcm);
  */
 int pcm_prepare(struct pcm *pcm);
 
+/**
+ * @brief Starts a PCM, preparing it if needed. It does nothing if the PCM runs.
+ *
+ * @details @b #include <tinyalsa/tinyalsa.h>
+ * A playback PCM needs a buffer committed first, pcm_mmap_commit() does not
+ * start it as pcm_mmap_write() does.
+ * @param[in] pcm A PCM handle.
+ * @return On success, 0 returned. On failure, a negative number returned.
+ * @since TizenRT v5.0
+ */
+int pcm_start(struct pcm *pcm);
+
 /**
  * @brief Determines the number of bits occupied by a @ref pcm_format.
  *
@@ -247,6 +247,25 @@ typedef struct {
 	bool scan_all;											/**<  Flag to enable scanning specific AP + other APs responding to NULL probe req  */
 } wifi_manager_scan_multi_configs_s;
 
+/**
+ * @brief Select the access points of the scan result cache
+ */
+typedef struct {
+	char ssid[WIFIMGR_SSID_LEN + 1];          /**<  SSID of the APs, "" for any SSID              */
+	char bssid[WIFIMGR_MACADDR_STR_LEN + 1];  /**<  BSSID (xx:xx:xx:xx:xx:xx), "" for any BSSID  */
+	int8_t rssi_threshold;                    /**<  minimum RSSI, INT8_MIN for any RSSI         */
+	unsigned int max_age;                     /**<  seconds since the AP was last found, 0 for any age */
+	uint32_t changed_since;                   /**<  only the APs added or changed after this generation, 0 for all */
+} wifi_manager_scan_filter_s;
+
+/**
+ * @brief What scan_ap_done reports
+ */
+typedef enum {
+	WIFI_MANAGER_SCAN_REPORT_ALL,     /**<  all APs the scan found                          */
+	WIFI_MANAGER_SCAN_REPORT_CHANGES, /**<  only APs the scan added or changed in the cache */
+} wifi_manager_scan_report_e;
+
 /**
  * @brief Specify Wi-Fi Manager internal stats information
  */
@@ -284,6 +303,40 @@ typedef enum {
 	WIFI_MANAGER_POWERMODE_ENABLE,
 } wifi_manager_powermode_e;
 
+#define WIFI_MANAGER_LINK_RETRY_BINS 6
+#define WIFI_MANAGER_LINK_RATE_BINS 8
+
+/**
+ * @brief A sample of the link taken every interval while connected
+ */
+typedef struct {
+	uint32_t time;     /**<  ms since the connection                   */
+	int8_t rssi;       /**<  RSSI in dBm                               */
+	int8_t snr;        /**<  signal to noise ratio in dB               */
+	uint16_t tx_retry; /**<  TX retries since the previous sample      */
+	uint32_t rate;     /**<  PHY rate reported by the driver in Mbps   */
+} wifi_manager_link_sample_s;
+
+/**
+ * @brief Specify Wi-Fi link telemetry of the current or last connection
+ */
+typedef struct {
+	wifi_manager_link_sample_s *samples; /**<  [in] buffer of max_samples, NULL for no sample  */
+	uint16_t max_samples;                /**<  [in] size of samples                             */
+	uint16_t nsamples;                   /**<  [out] samples copied, the oldest first           */
+	uint32_t interval;                   /**<  ms between two samples                           */
+	uint32_t connected_time;             /**<  ms connected                                     */
+	uint32_t powersave_time;             /**<  ms connected with the power save mode enabled    */
+	/* Samples by TX retries since the previous sample:
+	 * 0, 1-3, 4-15, 16-63, 64-255, 256 and more
+	 */
+	uint32_t retry_hist[WIFI_MANAGER_LINK_RETRY_BINS];
+	/* Samples by PHY rate in Mbps:
+	 * below 6, 6-11, 12-23, 24-53, 54-71, 72-149, 150-299, 300 and more
+	 */
+	uint32_t rate_hist[WIFI_MANAGER_LINK_RATE_BINS];
+} wifi_manager_link_stats_s;
+
 /**
  * @brief Initialize Wi-Fi Manager including starting Wi-Fi interface.
  * @details @b #include <wifi_manager/wifi_manager.h>
@@ -423,6 +476,54 @@ wifi_manager_result_e wifi_manager_scan_specific_ap(wifi_manager_ap_config_s *co
  */
 wifi_manager_result_e wifi_manager_scan_multi_aps(wifi_manager_scan_multi_configs_s *configs);
 
+/**
+ * @brief Get the access points of the scan result cache
+ * @details @b #include <wifi_manager/wifi_manager.h>
+ * @param[in] filter APs to get, NULL for all of them. See wifi_manager_scan_filter_s
+ * @param[out] list The APs, which the caller has to free with wifi_manager_free_scan_result()
+ * @param[out] generation The generation of the last scan, to pass as changed_since
+ *             to get only the APs changed by the next scans. It can be NULL.
+ * @return On success, WIFI_MANAGER_SUCCESS (i.e., 0) is returned. On failure, non-zero value is returned.
+ * @API type: synchronous
+ * @callback: none
+ * @since TizenRT v4.1
+ */
+/* The cache keeps the APs found by the scans with their time, so that
+ * reconnecting or roaming can use the last result instead of a new scan,
+ * and a scan with a specific channel only updates the APs of the channel.
+ * An AP is changed if its RSSI moved by CONFIG_WIFIMGR_SCAN_CACHE_RSSI_DELTA
+ * or more, or if its SSID, channel or security changed. It is removed when
+ * a scan of all SSIDs on its channel doesn't find it.
+ * It returns WIFI_MANAGER_NO_API if CONFIG_WIFIMGR_SCAN_CACHE is disabled.
+ */
+wifi_manager_result_e wifi_manager_get_scan_result(wifi_manager_scan_filter_s *filter, wifi_manager_scan_info_s **list, uint32_t *generation);
+
+/**
+ * @brief Free the list returned by wifi_manager_get_scan_result()
+ * @details @b #include <wifi_manager/wifi_manager.h>
+ * @param[in] list The APs
+ * @return On success, WIFI_MANAGER_SUCCESS (i.e., 0) is returned. On failure, non-zero value is returned.
+ * @API type: synchronous
+ * @callback: none
+ * @since TizenRT v4.1
+ */
+wifi_manager_result_e wifi_manager_free_scan_result(wifi_manager_scan_info_s *list);
+
+/**
+ * @brief Set what scan_ap_done reports
+ * @details @b #include <wifi_manager/wifi_manager.h>
+ * @param[in] mode WIFI_MANAGER_SCAN_REPORT_ALL (default) or WIFI_MANAGER_SCAN_REPORT_CHANGES
+ * @return On success, WIFI_MANAGER_SUCCESS (i.e., 0) is returned. On failure, non-zero value is returned.
+ * @API type: synchronous
+ * @callback: none
+ * @since TizenRT v4.1
+ */
+/* With WIFI_MANAGER_SCAN_REPORT_CHANGES, scan_ap_done gets the APs which the
+ * scan added to the cache or changed, and the removed APs are not reported:
+ * wifi_manager_get_scan_result() returns the whole cache.
+ */
+wifi_manager_result_e wifi_manager_set_scan_report(wifi_manager_scan_report_e mode);
+
 /**
  * @brief Save the AP configuration at persistent storage
  * @details @b #include <wifi_manager/wifi_manager.h>
@@ -487,6 +588,24 @@ wifi_manager_result_e wifi_manager_get_stats(wifi_manager_stats_s *stats);
  * @since TizenRT v3.1
  */
 wifi_manager_result_e wifi_manager_set_powermode(wifi_manager_powermode_e mode);
+
+/**
+ * @brief Obtain Wi-Fi link telemetry
+ * @details @b #include <wifi_manager/wifi_manager.h>
+ * @param[in,out] stats The pointer of link telemetry which will be filled.
+ *                samples and max_samples are set by the caller.
+ * @return On success, WIFI_MANAGER_SUCCESS (i.e., 0) is returned. On failure, non-zero value is returned.
+ * @API type: synchronous
+ * @callback: none
+ * @since TizenRT v4.1
+ */
+/* The RSSI, SNR, TX retries and rate of the driver are sampled every
+ * CONFIG_WIFIMGR_LINK_STATS_INTERVAL ms from the connection to the
+ * disconnection, and the last CONFIG_WIFIMGR_LINK_STATS_SAMPLES samples
+ * are kept. They are reset by the next connection.
+ * It returns WIFI_MANAGER_NO_API if CONFIG_WIFIMGR_LINK_STATS is disabled.
+ */
+wifi_manager_result_e wifi_manager_get_link_stats(wifi_manager_link_stats_s *stats);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,340 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include "tinyara/config.h"
+#include <math.h>
+#include <string.h>
+#include <cmsis_dsp/Include/arm_math.h>
+#include "aifw/aifw_log.h"
+#include "aifw/AIDataBuffer.h"
+#include "aifw/AIAudioFeatureHandler.h"
+
+/* Added to the mel energies before log, for silent frames */
+#define AIFW_AUDIO_LOG_FLOOR 1e-6f
+
+namespace aifw {
+
+struct AIAudioFeatureState {
+	arm_rfft_fast_instance_f32 fft;
+	arm_matrix_instance_f32 dct;
+	float *samples;		/* Latest frame, as float */
+	float *window;		/* Hann window */
+	float *frame;		/* Windowed frame, destroyed by the FFT */
+	float *spectrum;	/* Packed FFT output */
+	float *power;		/* frameLength / 2 + 1 power bins */
+	float *mel;		/* Mel energies, then log-mel */
+	uint16_t *melFirst;	/* First power bin of each filter */
+	uint16_t *melCount;	/* Number of power bins of each filter */
+	float *melWeights;	/* Weights of all the filters, one after the other */
+	float *dctCoefs;	/* mfccCount x melBands DCT-II matrix */
+};
+
+static inline float hzToMel(float hz)
+{
+	return 1127.0f * logf(1.0f + hz / 700.0f);
+}
+
+static inline float melToHz(float mel)
+{
+	return 700.0f * (expf(mel / 1127.0f) - 1.0f);
+}
+
+AIAudioFeatureHandler::AIAudioFeatureHandler() :
+	mState(NULL), mFrames(0)
+{
+	memset(&mConfig, 0, sizeof(mConfig));
+}
+
+AIAudioFeatureHandler::~AIAudioFeatureHandler()
+{
+	deinit();
+}
+
+void AIAudioFeatureHandler::deinit(void)
+{
+	if (!mState) {
+		return;
+	}
+	delete[] mState->samples;
+	delete[] mState->window;
+	delete[] mState->frame;
+	delete[] mState->spectrum;
+	delete[] mState->power;
+	delete[] mState->mel;
+	delete[] mState->melFirst;
+	delete[] mState->melCount;
+	delete[] mState->melWeights;
+	delete[] mState->dctCoefs;
+	delete mState;
+	mState = NULL;
+}
+
+AIFW_RESULT AIAudioFeatureHandler::init(const AIAudioFeatureConfig &config)
+{
+	uint16_t length = config.frameLength;
+	if (config.sampleRate == 0 || config.melBands == 0 || config.mfccCount > config.melBands) {
+		AIFW_LOGE("Invalid argument - sample rate %d, mel bands %d, mfcc count %d", config.sampleRate, config.melBands, config.mfccCount);
+		return AIFW_INVALID_ARG;
+	}
+	if (length < 32 || length > 4096 || (length & (length - 1)) || config.frameShift == 0 || config.frameShift > length) {
+		AIFW_LOGE("Invalid argument - frame length %d, frame shift %d", length, config.frameShift);
+		return AIFW_INVALID_ARG;
+	}
+	deinit();
+	mConfig = config;
+	if (mConfig.highFrequency <= 0.0f || mConfig.highFrequency > mConfig.sampleRate / 2.0f) {
+		mConfig.highFrequency = mConfig.sampleRate / 2.0f;
+	}
+	if (mConfig.lowFrequency < 0.0f || mConfig.lowFrequency >= mConfig.highFrequency) {
+		mConfig.lowFrequency = 0.0f;
+	}
+	if (mConfig.inferenceStride == 0) {
+		mConfig.inferenceStride = 1;
+	}
+
+	mState = new AIAudioFeatureState;
+	if (!mState) {
+		AIFW_LOGE("Memory allocation failed - audio feature state");
+		return AIFW_NO_MEM;
+	}
+	memset(mState, 0, sizeof(AIAudioFeatureState));
+	mState->samples = new float[length];
+	mState->window = new float[length];
+	mState->frame = new float[length];
+	mState->spectrum = new float[length];
+	mState->power = new float[length / 2 + 1];
+	mState->mel = new float[mConfig.melBands];
+	if (!mState->samples || !mState->window || !mState->frame || !mState->spectrum || !mState->power || !mState->mel) {
+		AIFW_LOGE("Memory allocation failed - audio feature buffers");
+		deinit();
+		return AIFW_NO_MEM;
+	}
+	if (arm_rfft_fast_init_f32(&mState->fft, length) != ARM_MATH_SUCCESS) {
+		AIFW_LOGE("FFT of %d samples not supported", length);
+		deinit();
+		return AIFW_INVALID_ARG;
+	}
+	arm_hanning_f32(mState->window, length);
+
+	AIFW_RESULT res = initMelFilters();
+	if (res != AIFW_OK) {
+		deinit();
+		return res;
+	}
+
+	if (mConfig.mfccCount > 0) {
+		mState->dctCoefs = new float[mConfig.mfccCount * mConfig.melBands];
+		if (!mState->dctCoefs) {
+			AIFW_LOGE("Memory allocation failed - DCT matrix");
+			deinit();
+			return AIFW_NO_MEM;
+		}
+		/* Orthonormal DCT-II, as in librosa and TensorFlow */
+		float bands = mConfig.melBands;
+		for (uint16_t i = 0; i < mConfig.mfccCount; i++) {
+			float scale = sqrtf((i == 0 ? 1.0f : 2.0f) / bands);
+			for (uint16_t j = 0; j < mConfig.melBands; j++) {
+				mState->dctCoefs[i * mConfig.melBands + j] = scale * cosf((float)M_PI / bands * (j + 0.5f) * i);
+			}
+		}
+		arm_mat_init_f32(&mState->dct, mConfig.mfccCount, mConfig.melBands, mState->dctCoefs);
+	}
+
+	reset();
+	AIFW_LOGV("audio features: %d Hz, frame %d, shift %d, %d mel bands, %d mfcc", mConfig.sampleRate, length, mConfig.frameShift, mConfig.melBands, mConfig.mfccCount);
+	return AIFW_OK;
+}
+
+AIFW_RESULT AIAudioFeatureHandler::initMelFilters(void)
+{
+	uint16_t bands = mConfig.melBands;
+	uint16_t lastBin = mConfig.frameLength / 2;
+	float binHz = (float)mConfig.sampleRate / mConfig.frameLength;
+	float melLow = hzToMel(mConfig.lowFrequency);
+	float melStep = (hzToMel(mConfig.highFrequency) - melLow) / (bands + 1);
+
+	mState->melFirst = new uint16_t[bands];
+	mState->melCount = new uint16_t[bands];
+	if (!mState->melFirst || !mState->melCount) {
+		AIFW_LOGE("Memory allocation failed - mel filters");
+		return AIFW_NO_MEM;
+	}
+
+	/* Filter b rises from edge b to edge b + 1 and falls to edge b + 2 */
+	uint32_t weights = 0;
+	for (uint16_t b = 0; b < bands; b++) {
+		float left = melToHz(melLow + b * melStep);
+		float right = melToHz(melLow + (b + 2) * melStep);
+		uint16_t first = (uint16_t)floorf(left / binHz) + 1;
+		uint16_t last = (uint16_t)ceilf(right / binHz) - 1;
+		if (last > lastBin) {
+			last = lastBin;
+		}
+		mState->melFirst[b] = first;
+		mState->melCount[b] = last >= first ? last - first + 1 : 0;
+		if (mState->melCount[b] == 0) {
+			AIFW_LOGE("mel filter %d has no FFT bin, frame length %d is too short for %d bands", b, mConfig.frameLength, bands);
+		}
+		weights += mState->melCount[b];
+	}
+
+	mState->melWeights = new float[weights > 0 ? weights : 1];
+	if (!mState->melWeights) {
+		AIFW_LOGE("Memory allocation failed - mel filter weights");
+		return AIFW_NO_MEM;
+	}
+	float *weight = mState->melWeights;
+	for (uint16_t b = 0; b < bands; b++) {
+		float left = melToHz(melLow + b * melStep);
+		float center = melToHz(melLow + (b + 1) * melStep);
+		float right = melToHz(melLow + (b + 2) * melStep);
+		for (uint16_t k = 0; k < mState->melCount[b]; k++) {
+			float hz = (mState->melFirst[b] + k) * binHz;
+			*weight++ = hz <= center ? (hz - left) / (center - left) : (right - hz) / (right - center);
+		}
+	}
+	return AIFW_OK;
+}
+
+void AIAudioFeatureHandler::reset(void)
+{
+	mFrames = 0;
+	if (mState) {
+		memset(mState->samples, 0, mConfig.frameLength * sizeof(float));
+	}
+}
+
+uint16_t AIAudioFeatureHandler::getFeatureCount(void) const
+{
+	return mConfig.mfccCount > 0 ? mConfig.mfccCount : mConfig.melBands;
+}
+
+AIFW_RESULT AIAudioFeatureHandler::parseData(void *data, uint16_t count, float *parsedData, AIModelAttribute *modelAttribute)
+{
+	if (!mState) {
+		AIFW_LOGE("audio features are not initialized");
+		return AIFW_ERROR;
+	}
+	if (!data || !parsedData || !modelAttribute) {
+		AIFW_LOGE("Invalid argument - data %p, parsed data %p, model attribute %p", data, parsedData, modelAttribute);
+		return AIFW_INVALID_ARG;
+	}
+	if (count != mConfig.frameShift) {
+		AIFW_LOGE("Invalid argument - %d samples pushed, frame shift %d", count, mConfig.frameShift);
+		return AIFW_INVALID_ARG;
+	}
+	if (modelAttribute->rawDataCount != getFeatureCount()) {
+		AIFW_LOGE("raw data count %d does not match %d features", modelAttribute->rawDataCount, getFeatureCount());
+		return AIFW_INVALID_ATTRIBUTE;
+	}
+
+	/* The new samples follow the overlapping part of the previous frame */
+	uint16_t length = mConfig.frameLength;
+	uint16_t overlap = length - count;
+	memmove(mState->samples, mState->samples + count, overlap * sizeof(float));
+	arm_q15_to_float((const q15_t *)data, mState->samples + overlap, count);
+
+	arm_mult_f32(mState->samples, mState->window, mState->frame, length);
+	arm_rfft_fast_f32(&mState->fft, mState->frame, mState->spectrum, 0);
+
+	/* spectrum[0] and spectrum[1] are the real DC and Nyquist bins, then complex bins follow */
+	uint16_t half = length / 2;
+	mState->power[0] = mState->spectrum[0] * mState->spectrum[0];
+	mState->power[half] = mState->spectrum[1] * mState->spectrum[1];
+	arm_cmplx_mag_squared_f32(mState->spectrum + 2, mState->power + 1, half - 1);
+
+	const float *weight = mState->melWeights;
+	for (uint16_t b = 0; b < mConfig.melBands; b++) {
+		arm_dot_prod_f32(mState->power + mState->melFirst[b], weight, mState->melCount[b], &mState->mel[b]);
+		weight += mState->melCount[b];
+	}
+	arm_offset_f32(mState->mel, AIFW_AUDIO_LOG_FLOOR, mState->mel, mConfig.melBands);
+	arm_vlog_f32(mState->mel, mState->mel, mConfig.melBands);
+
+	if (mConfig.mfccCount > 0) {
+		arm_mat_vec_mult_f32(&mState->dct, mState->mel, parsedData);
+	} else {
+		arm_copy_f32(mState->mel, parsedData, mConfig.melBands);
+	}
+
+	/* Infer once windowSize frames are buffered, then every inferenceStride frames */
+	uint16_t windowSize = modelAttribute->windowSize > 0 ? modelAttribute->windowSize : 1;
+	mFrames++;
+	if (mFrames < windowSize || (mFrames - windowSize) % mConfig.inferenceStride != 0) {
+		return AIFW_INFERENCE_PROCEEDING;
+	}
+	return AIFW_OK;
+}
+
+AIFW_RESULT AIAudioFeatureHandler::copyFrames(std::shared_ptr<AIDataBuffer> buffer, float *invokeInput, AIModelAttribute *modelAttribute)
+{
+	if (!buffer || !invokeInput || !modelAttribute) {
+		AIFW_LOGE("Invalid argument - buffer, invoke input or model attribute is NULL");
+		return AIFW_INVALID_ARG;
+	}
+	uint16_t windowSize = modelAttribute->windowSize > 0 ? modelAttribute->windowSize : 1;
+	uint16_t features = modelAttribute->rawDataCount;
+	const float *first;
+	const float *second;
+	uint16_t firstCount;
+	AIFW_RESULT res = buffer->getRows(0, windowSize, &first, &firstCount, &second);
+	if (res != AIFW_OK) {
+		AIFW_LOGE("Getting %d frames from the buffer failed, error: %d", windowSize, res);
+		return res;
+	}
+
+	/* Rows are newest first, the model takes frames oldest first */
+	uint16_t rowSize = buffer->getRowSize();
+	for (uint16_t row = 0; row < windowSize; row++) {
+		const float *values = row < firstCount ? first + row * rowSize : second + (row - firstCount) * rowSize;
+		memcpy(invokeInput + (windowSize - 1 - row) * features, values, features * sizeof(float));
+	}
+	return AIFW_OK;
+}
+
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+AIFW_RESULT AIAudioFeatureHandler::preProcessData(std::shared_ptr<AIDataBuffer> buffer, float *invokeInput, AIModelAttribute *modelAttribute)
+{
+	if (modelAttribute && modelAttribute->invokeInputCount != modelAttribute->windowSize * modelAttribute->rawDataCount) {
+		AIFW_LOGE("invoke input count %d is not window size %d x %d features", modelAttribute->invokeInputCount, modelAttribute->windowSize, modelAttribute->rawDataCount);
+		return AIFW_INVALID_ATTRIBUTE;
+	}
+	return copyFrames(buffer, invokeInput, modelAttribute);
+}
+#else
+AIFW_RESULT AIAudioFeatureHandler::preProcessData(std::shared_ptr<AIDataBuffer> buffer, uint16_t countInputSets, float **invokeInput, AIModelAttribute *modelAttribute)
+{
+	if (countInputSets != 1 || !invokeInput) {
+		AIFW_LOGE("Invalid argument - %d input sets, audio features are one input set", countInputSets);
+		return AIFW_INVALID_ARG;
+	}
+	return copyFrames(buffer, invokeInput[0], modelAttribute);
+}
+#endif
+
+AIFW_RESULT AIAudioFeatureHandler::postProcessData(std::shared_ptr<AIDataBuffer> buffer, float *resultData, AIModelAttribute *modelAttribute)
+{
+	if (!buffer || !resultData || !modelAttribute) {
+		AIFW_LOGE("Invalid argument - buffer, result data or model attribute is NULL");
+		return AIFW_INVALID_ARG;
+	}
+	/* The latest row holds the features of the last frame, then the invoke output */
+	return buffer->readData(resultData, modelAttribute->rawDataCount, modelAttribute->rawDataCount + modelAttribute->postProcessResultCount, 0);
+}
+
+} /* namespace aifw */
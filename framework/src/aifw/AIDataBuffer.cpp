@@ -18,7 +18,6 @@
 
 #include "aifw/aifw_log.h"
 #include "aifw/AIDataBuffer.h"
-#include "include/AIDataBufferNode.h"
 #define _UNLOCK                                    \
 	{                                              \
 		int status = pthread_mutex_unlock(&mLock); \
@@ -55,7 +54,7 @@
 namespace aifw {
 
 AIDataBuffer::AIDataBuffer() :
-	mStart(NULL), mEnd(NULL), mMaxRows(0), mRowSize(0), mRowCount(0), mLock(PTHREAD_MUTEX_INITIALIZER)
+	mData(NULL), mStart(0), mMaxRows(0), mRowSize(0), mRowCount(0), mLock(PTHREAD_MUTEX_INITIALIZER)
 {
 	AIFW_LOGV("AIDataBuffer Constructor");
 }
@@ -66,16 +65,32 @@ AIDataBuffer::~AIDataBuffer()
 	deinit();
 }
 
+float *AIDataBuffer::getRow(uint16_t row)
+{
+	return mData + ((mStart + row) % mMaxRows) * mRowSize;
+}
+
 AIFW_RESULT AIDataBuffer::init(uint16_t row, uint16_t size)
 {
+	if (row == 0 || size == 0) {
+		AIFW_LOGE("Invalid argument - row %d size %d", row, size);
+		return AIFW_INVALID_ARG;
+	}
 	_LOCK
-	AIFW_RESULT ret = createList(row, size);
-	if (ret == AIFW_OK) {
-		mMaxRows = row;
-		mRowSize = size;
+	float *data = (float *)calloc(row * size, sizeof(float));
+	if (!data) {
+		AIFW_LOGE("buffer creation failed with errno %d, error message: %s", errno, strerror(errno));
+		_UNLOCK
+		return AIFW_NO_MEM;
 	}
+	free(mData);
+	mData = data;
+	mStart = 0;
+	mMaxRows = row;
+	mRowSize = size;
+	mRowCount = 0;
 	_UNLOCK
-	return ret;
+	return AIFW_OK;
 }
 
 AIFW_RESULT AIDataBuffer::reinit(uint16_t row, uint16_t size)
@@ -83,30 +98,26 @@ AIFW_RESULT AIDataBuffer::reinit(uint16_t row, uint16_t size)
 	if (row == mMaxRows && size == mRowSize) {
 		return AIFW_OK;
 	}
-	_LOCK
-	if (size != mRowSize) {
-		AIDataBufferNode *tempNode = mStart;
-		float *tempPtr = nullptr;
-		while (tempNode) {
-			tempPtr = (float *)realloc(tempNode->mData, size * sizeof(float));
-			if (!tempPtr) {
-				AIFW_LOGE("node creation failed with errno %d, error message: %s", errno, strerror(errno));
-				_UNLOCK
-				return AIFW_NO_MEM;
-			}
-			tempNode->mData = tempPtr;
-			tempNode = tempNode->mNext;
-		}
+	if (row < mMaxRows) {
+		/* Rows are kept, as they were with a list */
+		row = mMaxRows;
 	}
-	if (row > mMaxRows) {
-		AIFW_RESULT ret = createList(row - mMaxRows, size);
-		if (ret == AIFW_OK) {
-			mMaxRows = row;
-			mRowSize = size;
-		}
+	_LOCK
+	float *data = (float *)calloc(row * size, sizeof(float));
+	if (!data) {
+		AIFW_LOGE("buffer creation failed with errno %d, error message: %s", errno, strerror(errno));
 		_UNLOCK
-		return ret;
+		return AIFW_NO_MEM;
 	}
+	/* Copy the filled rows newest first from row 0, which is where mStart is then */
+	uint16_t copySize = (size < mRowSize) ? size : mRowSize;
+	for (uint16_t i = 0; i < mRowCount; i++) {
+		memcpy(data + i * size, getRow(i), copySize * sizeof(float));
+	}
+	free(mData);
+	mData = data;
+	mStart = 0;
+	mMaxRows = row;
 	mRowSize = size;
 	_UNLOCK
 	return AIFW_OK;
@@ -114,34 +125,18 @@ AIFW_RESULT AIDataBuffer::reinit(uint16_t row, uint16_t size)
 
 void AIDataBuffer::deinit(void)
 {
-	clearMemory(mStart);
-	mStart = NULL;
-	mEnd = NULL;
+	free(mData);
+	mData = NULL;
+	mStart = 0;
 	mRowSize = 0;
 	mMaxRows = 0;
 	mRowCount = 0;
 }
 
-void AIDataBuffer::clearMemory(AIDataBufferNode *ptr)
-{
-	AIDataBufferNode *current = ptr;
-	AIDataBufferNode *temp = ptr;
-	while (current) {
-		temp = current->mNext;
-		delete current;
-		current = temp;
-	}
-}
-
 AIFW_RESULT AIDataBuffer::clear(void)
 {
 	_LOCK
-	AIDataBufferNode *current = mStart;
-	while (current) {
-		current->mIsEmpty = true;
-		memset(current->mData, '\0', mRowSize * sizeof(float));
-		current = current->mNext;
-	}
+	memset(mData, '\0', mMaxRows * mRowSize * sizeof(float));
 	mRowCount = 0;
 	_UNLOCK
 	return AIFW_OK;
@@ -158,80 +153,21 @@ AIFW_RESULT AIDataBuffer::clear(uint16_t offset, uint16_t count)
 		return AIFW_INVALID_ARG;
 	}
 	_LOCK
-	AIDataBufferNode *current = mStart;
-	uint16_t i = 0;
-	while (i < offset) {
-		current = current->mNext;
-		i++;
-	}
-	AIDataBufferNode *firstNode = current;
-	AIDataBufferNode *prevToFirstNode = firstNode->mPrev;
-
-	i = 0;
-	while (i < count - 1) {
-		current->mIsEmpty = true;
-		memset(current->mData, '\0', mRowSize * sizeof(float));
-		current = current->mNext;
-		i++;
-	}
-	current->mIsEmpty = true;
-	memset(current->mData, '\0', mRowSize * sizeof(float));
-	mRowCount -= count;
-	AIDataBufferNode *lastNode = current;
-	AIDataBufferNode *nextToLastNode = lastNode->mNext;
-
-	if (!nextToLastNode) {
-		_UNLOCK;
-		return AIFW_OK;
-	} else if (!prevToFirstNode) {
-		mStart = nextToLastNode;
-	} else {
-		prevToFirstNode->mNext = nextToLastNode;
-	}
-	nextToLastNode->mPrev = prevToFirstNode;
-	lastNode->mNext = NULL;
-	firstNode->mPrev = mEnd;
-	mEnd->mNext = firstNode;
-	mEnd = lastNode;
+	removeRows(offset, count);
 	_UNLOCK
 	return AIFW_OK;
 }
 
-AIFW_RESULT AIDataBuffer::createList(uint16_t count, uint16_t size)
+void AIDataBuffer::removeRows(uint16_t offset, uint16_t count)
 {
-	AIDataBufferNode *newNode = nullptr;
-	AIDataBufferNode *firstNode = nullptr;
-	AIDataBufferNode *lastNode = nullptr;
-	for (uint16_t i = 0; i < count; i++) {
-		newNode = new AIDataBufferNode(size);
-		if (!newNode || !newNode->mData) {
-			AIFW_LOGE("node creation failed with errno %d, error message: %s", errno, strerror(errno));
-			if (newNode) {
-				delete newNode;
-			}
-			clearMemory(firstNode);
-			return AIFW_NO_MEM;
-		}
-		if (firstNode == NULL) {
-			firstNode = newNode;
-			lastNode = newNode;
-		} else {
-			lastNode->mNext = newNode;
-			newNode->mPrev = lastNode;
-			lastNode = newNode;
-		}
-	}
-	if (!mStart) {
-		mStart = firstNode;
-		mEnd = lastNode;
-		return AIFW_OK;
+	/* Older rows move up to fill the gap, and the emptied rows are at the end */
+	for (uint16_t i = offset; i + count < mRowCount; i++) {
+		memcpy(getRow(i), getRow(i + count), mRowSize * sizeof(float));
 	}
-	mEnd->mNext = firstNode;
-	if (firstNode) {
-		firstNode->mPrev = mEnd;
-		mEnd = lastNode;
+	mRowCount -= count;
+	for (uint16_t i = mRowCount; i < mRowCount + count; i++) {
+		memset(getRow(i), '\0', mRowSize * sizeof(float));
 	}
-	return AIFW_OK;
 }
 
 AIFW_RESULT AIDataBuffer::readData(float *buffer, uint16_t row)
@@ -245,13 +181,7 @@ AIFW_RESULT AIDataBuffer::readData(float *buffer, uint16_t row)
 		return AIFW_INVALID_ARG;
 	}
 	_LOCK
-	uint16_t temp = 0;
-	AIDataBufferNode *tempNode = mStart;
-	while (temp < row) {
-		tempNode = tempNode->mNext;
-		++temp;
-	}
-	memcpy(buffer, tempNode->mData, mRowSize * sizeof(float));
+	memcpy(buffer, getRow(row), mRowSize * sizeof(float));
 	DUMP_BUFFER("buffer read done, values: ", mRowSize, buffer, 0)
 	_UNLOCK;
 	return AIFW_OK;
@@ -276,18 +206,37 @@ AIFW_RESULT AIDataBuffer::readData(float *buffer, uint16_t startCol, uint16_t en
 		return AIFW_INVALID_ARG;
 	}
 	_LOCK
-	uint16_t temp = 0;
-	AIDataBufferNode *tempNode = mStart;
-	while (temp < row) {
-		tempNode = tempNode->mNext;
-		++temp;
-	}
-	memcpy(buffer, (tempNode->mData + startCol), (endCol - startCol) * sizeof(float));
+	memcpy(buffer, (getRow(row) + startCol), (endCol - startCol) * sizeof(float));
 	DUMP_BUFFER("buffer read done, values: ", endCol - startCol, buffer, 0)
 	_UNLOCK;
 	return AIFW_OK;
 }
 
+AIFW_RESULT AIDataBuffer::getRows(uint16_t row, uint16_t count, const float **first, uint16_t *firstCount, const float **second)
+{
+	if (first == NULL || firstCount == NULL || second == NULL) {
+		AIFW_LOGE("Invalid argument - output pointer");
+		return AIFW_INVALID_ARG;
+	}
+	if (count == 0 || row + count > mRowCount) {
+		AIFW_LOGE("Invalid argument - rows %d to %d, row count %d", row, row + count - 1, mRowCount);
+		return AIFW_INVALID_ARG;
+	}
+	_LOCK
+	uint16_t index = (mStart + row) % mMaxRows;
+	uint16_t contiguous = mMaxRows - index;
+	*first = mData + index * mRowSize;
+	if (count <= contiguous) {
+		*firstCount = count;
+		*second = NULL;
+	} else {
+		*firstCount = contiguous;
+		*second = mData;
+	}
+	_UNLOCK
+	return AIFW_OK;
+}
+
 AIFW_RESULT AIDataBuffer::writeData(float *buffer, uint16_t size)
 {
 	if (buffer == NULL) {
@@ -300,18 +249,11 @@ AIFW_RESULT AIDataBuffer::writeData(float *buffer, uint16_t size)
 	}
 	DUMP_BUFFER("buffer write operation, values: ", size, buffer, 0)
 	_LOCK
-	if (mStart != mEnd) {
-		AIDataBufferNode *last = mEnd;
-		mEnd = last->mPrev;
-		mEnd->mNext = NULL;
-		last->mPrev = NULL;
-		last->mNext = mStart;
-		mStart->mPrev = last;
-		mStart = last;
-	}
-	memcpy(mStart->mData, buffer, size * sizeof(float));
-	DUMP_BUFFER("buffer write operation done, values: ", size, mStart->mData, 0)
-	mStart->mIsEmpty = false;
+	/* The new row takes the place of the oldest one, just before the latest */
+	mStart = (mStart + mMaxRows - 1) % mMaxRows;
+	float *start = getRow(0);
+	memcpy(start, buffer, size * sizeof(float));
+	DUMP_BUFFER("buffer write operation done, values: ", size, start, 0)
 	if (mRowCount < mMaxRows) {
 		++mRowCount;
 	}
@@ -332,8 +274,9 @@ AIFW_RESULT AIDataBuffer::writeData(float *buffer, uint16_t size, uint16_t offse
 	}
 	DUMP_BUFFER("buffer write operation, values: ", size, buffer, 0)
 	_LOCK
-	memcpy((mStart->mData + offset), buffer, size * sizeof(float));
-	DUMP_BUFFER("buffer write operation done, values: ", size, mStart->mData, offset)
+	float *start = getRow(0);
+	memcpy((start + offset), buffer, size * sizeof(float));
+	DUMP_BUFFER("buffer write operation done, values: ", size, start, offset)
 	AIFW_LOGI("resultData Written");
 	_UNLOCK
 	return AIFW_OK;
@@ -346,30 +289,7 @@ AIFW_RESULT AIDataBuffer::deleteData(uint16_t row)
 		return AIFW_INVALID_ARG;
 	}
 	_LOCK
-	AIDataBufferNode *current = mStart;
-	uint16_t i = 0;
-	while (i < row) {
-		current = current->mNext;
-		i++;
-	}
-	memset(current->mData, 0, mRowSize * sizeof(float));
-	current->mIsEmpty = true;
-	mRowCount--;
-	AIDataBufferNode *nextToCurrent = current->mNext;
-	AIDataBufferNode *prevToCurrent = current->mPrev;
-	if (nextToCurrent == NULL) {
-		_UNLOCK
-		return AIFW_OK;
-	} else if (prevToCurrent == NULL) {
-		mStart = nextToCurrent;
-	} else {
-		prevToCurrent->mNext = nextToCurrent;
-	}
-	nextToCurrent->mPrev = prevToCurrent;
-	current->mNext = NULL;
-	current->mPrev = mEnd;
-	mEnd->mNext = current;
-	mEnd = current;
+	removeRows(row, 1);
 	_UNLOCK
 	return AIFW_OK;
 }
@@ -379,5 +299,9 @@ uint16_t AIDataBuffer::getRowCount()
 	return mRowCount;
 }
 
-} // namespace aifw
+uint16_t AIDataBuffer::getRowSize()
+{
+	return mRowSize;
+}
 
+} // namespace aifw
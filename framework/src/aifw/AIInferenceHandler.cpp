@@ -142,5 +142,21 @@ AIFW_RESULT AIInferenceHandler::resetInferenceState(void)
 	return res;
 }
 
+#ifdef CONFIG_AIFW_PROFILE
+uint16_t AIInferenceHandler::getModelCount(void)
+{
+	return mModelIndex;
+}
+
+AIFW_RESULT AIInferenceHandler::getProfile(uint16_t idx, AIModelProfile *profile, AIOperatorProfile *operators, uint16_t maxOperators)
+{
+	if (idx >= mModelIndex) {
+		AIFW_LOGE("Invalid model index %d, %d models attached", idx, mModelIndex);
+		return AIFW_INVALID_ARG;
+	}
+	return mModels.get()[idx]->getProfile(profile, operators, maxOperators);
+}
+#endif
+
 } /* namespace aifw */
 
@@ -40,6 +40,8 @@
 #define MANIFEST_KEY_MODELS "models"
 #define MANIFEST_KEY_INFERENCE_INTERVAL "inferenceinterval"
 #define MANIFEST_KEY_MODEL_CODE "modelcode"
+#define MANIFEST_KEY_ENGINE "engine"
+#define MANIFEST_ENGINE_NPU "npu"
 
 #define NULL_STRING "(null)"
 
@@ -85,9 +87,10 @@ AIFW_RESULT AIManifestParser::readData(AIModelAttribute *modelAttribute)
 	modelAttribute->features = NULL;
 	modelAttribute->meanVals = NULL;
 	modelAttribute->stdVals = NULL;
+	modelAttribute->engine = AIFW_ENGINE_CPU;
 
 	AIFW_RESULT ret = AIFW_OK;
-	cJSON *version, *modelfile, *features, *maxrowsdatabuffer, *rawdatacount, *windowsize, *invokeinputcount, *invokeoutputcount, *postprocessresultcount, *inferenceresultcount, *crc, *preprocess, *meanVals, *stdVals, *inferenceinterval, *modelcode;
+	cJSON *version, *modelfile, *features, *maxrowsdatabuffer, *rawdatacount, *windowsize, *invokeinputcount, *invokeoutputcount, *postprocessresultcount, *inferenceresultcount, *crc, *preprocess, *meanVals, *stdVals, *inferenceinterval, *modelcode, *engine;
 	uint16_t len;
 	char *file;
 	//	Get AI version
@@ -289,6 +292,12 @@ AIFW_RESULT AIManifestParser::readData(AIModelAttribute *modelAttribute)
 	}
 	modelAttribute->modelCode = modelcode->valueint;
 
+	// get engine, the CPU if not given
+	engine = cJSON_GetObjectItem(this->mJSON.get(), MANIFEST_KEY_ENGINE);
+	if (engine && engine->valuestring && !strcmp(engine->valuestring, MANIFEST_ENGINE_NPU)) {
+		modelAttribute->engine = AIFW_ENGINE_NPU;
+	}
+
 	return ret;
 
 /* TODO Let's consider removing duplicated code here & AIModel */
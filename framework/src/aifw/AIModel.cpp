@@ -19,11 +19,15 @@
 #include "tinyara/config.h"
 #include "aifw/aifw.h"
 #include "aifw/aifw_log.h"
+#include "aifw/aifw_utils.h"
 #ifdef CONFIG_AIFW_USE_ONERT_MICRO
 #include "include/ONERTM.h"
 #elif CONFIG_AIFW_USE_TFMICRO
 #include "include/TFLM.h"
 #endif
+#ifdef CONFIG_AIFW_USE_NPU
+#include "include/NPU.h"
+#endif
 #include "include/AIManifestParser.h"
 #include "aifw/AIDataBuffer.h"
 #include "aifw/AIProcessHandler.h"
@@ -33,7 +37,8 @@ namespace aifw {
 
 AIModel::AIModel(void) :
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
-	mInvokeResult(NULL), mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0),
+	mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0),
+	mInputInfo(NULL), mOutputInfo(NULL), mEngineInput(NULL), mEngineOutput(NULL),
 #endif
 	mInvokeInput(NULL), mInvokeOutput(NULL), mParsedData(NULL), mPostProcessedData(NULL), mDataProcessor(nullptr), mBuffer(nullptr)
 {
@@ -52,7 +57,8 @@ AIModel::AIModel(void) :
 
 AIModel::AIModel(std::shared_ptr<AIProcessHandler> dataProcessor) :
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
-	mInvokeResult(NULL), mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0),
+	mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0),
+	mInputInfo(NULL), mOutputInfo(NULL), mEngineInput(NULL), mEngineOutput(NULL),
 #endif
 	mInvokeInput(NULL), mInvokeOutput(NULL), mParsedData(NULL), mPostProcessedData(NULL), mDataProcessor(dataProcessor), mBuffer(nullptr)
 {
@@ -103,6 +109,22 @@ AIModel::~AIModel()
 		mInvokeOutput = NULL;
 	}
 #else
+	if (mEngineInput) {
+		for (uint16_t i = 0; i < mInputSetCount; i++) {
+			/* Quantized copy of the input set */
+			if (mEngineInput[i] && mEngineInput[i] != mInvokeInput[i]) {
+				delete[] (int16_t *)mEngineInput[i];
+			}
+		}
+		delete[] mEngineInput;
+		mEngineInput = NULL;
+	}
+
+	if (mEngineOutput) {
+		delete[] mEngineOutput;
+		mEngineOutput = NULL;
+	}
+
 	if (mInvokeInput) {
 		for (uint16_t i = 0; i < mInputSetCount; i++) {
 			if (mInvokeInput[i]) {
@@ -115,18 +137,24 @@ AIModel::~AIModel()
 	}
 
 	if (mInvokeOutput) {
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			if (mInvokeOutput[i]) {
+		for (uint16_t i = 0; mOutputInfo && i < mOutputSetCount; i++) {
+			/* Dequantized copy of the output set, others point to the engine */
+			if (mOutputInfo[i].type != AIFW_TENSOR_FLOAT32) {
 				delete[] mInvokeOutput[i];
-				mInvokeOutput[i] = NULL;
 			}
 		}
 		delete[] mInvokeOutput;
 		mInvokeOutput = NULL;
 	}
-	if(mInvokeResult) {
-		delete[] mInvokeResult;
-		mInvokeResult = NULL;
+
+	if (mInputInfo) {
+		delete[] mInputInfo;
+		mInputInfo = NULL;
+	}
+
+	if (mOutputInfo) {
+		delete[] mOutputInfo;
+		mOutputInfo = NULL;
 	}
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
@@ -178,37 +206,67 @@ AIFW_RESULT AIModel::allocateMemory(void)
 #else
 	mAIEngine->getModelDimensions(&mInputSetCount, &mInputSizeList, &mOutputSetCount, &mOutputSizeList);
 	AIFW_LOGD("Model dimensions extracted");
-	mInvokeResult = new float *[mOutputSetCount];
-	if (!mInvokeResult) {
-		AIFW_LOGE("Memory Allocation failed - inference result buffer");
-		return AIFW_NO_MEM;
-	}
-	mInvokeOutput = new float *[mOutputSetCount];
+	/* Set by the engine on invoke to its output tensors, which stay valid until the next invoke. */
+	mInvokeOutput = new float *[mOutputSetCount]();
 	if (!mInvokeOutput) {
 		AIFW_LOGE("Memory Allocation failed - model output buffer");
 		return AIFW_NO_MEM;
 	}
-	for (uint16_t i = 0; i < mOutputSetCount; i++) {
-		mInvokeOutput[i] = new float[mOutputSizeList[i]];
-		if (!mInvokeOutput[i]) {
-			AIFW_LOGE("Memory Allocation failed - model output buffer");
-			return AIFW_NO_MEM;
-		}
-	}
 	AIFW_LOGD("model output memory allocated");
-	mInvokeInput = new float *[mInputSetCount];
+	mInvokeInput = new float *[mInputSetCount]();
 	if (!mInvokeInput) {
 		AIFW_LOGE("Memory Allocation failed - model input buffer");
 		return AIFW_NO_MEM;
 	}
 	for (uint16_t i = 0; i < mInputSetCount; i++) {
-		mInvokeInput[i] = new float[mInputSizeList[i]];
+		mInvokeInput[i] = new float[mInputSizeList[i]]();
 		if (!mInvokeInput[i]) {
 			AIFW_LOGE("Memory Allocation failed - model input buffer");
 			return AIFW_NO_MEM;
 		}
 	}
 	AIFW_LOGD("model input memory allocated");
+
+	mInputInfo = new AITensorInfo[mInputSetCount];
+	mOutputInfo = new AITensorInfo[mOutputSetCount];
+	mEngineInput = new void *[mInputSetCount]();
+	mEngineOutput = new void *[mOutputSetCount]();
+	if (!mInputInfo || !mOutputInfo || !mEngineInput || !mEngineOutput) {
+		AIFW_LOGE("Memory Allocation failed - model tensor info");
+		return AIFW_NO_MEM;
+	}
+	for (uint16_t i = 0; i < mOutputSetCount; i++) {
+		if (mAIEngine->getOutputInfo(i, &mOutputInfo[i]) != AIFW_OK) {
+			AIFW_LOGE("Output set %d of the model is not supported", i);
+			return AIFW_ERROR;
+		}
+		/* Quantized outputs are dequantized for AIDataBuffer */
+		if (mOutputInfo[i].type != AIFW_TENSOR_FLOAT32) {
+			mInvokeOutput[i] = new float[mOutputSizeList[i]];
+			if (!mInvokeOutput[i]) {
+				AIFW_LOGE("Memory Allocation failed - model output buffer");
+				return AIFW_NO_MEM;
+			}
+		}
+	}
+	for (uint16_t i = 0; i < mInputSetCount; i++) {
+		if (mAIEngine->getInputInfo(i, &mInputInfo[i]) != AIFW_OK) {
+			AIFW_LOGE("Input set %d of the model is not supported", i);
+			return AIFW_ERROR;
+		}
+	}
+	/* Quantized inputs are written by the data processor if it can, else quantized here from float */
+	bool quantizedInput = mDataProcessor && mDataProcessor->setInputInfo(mInputSetCount, mInputInfo);
+	for (uint16_t i = 0; i < mInputSetCount; i++) {
+		mEngineInput[i] = mInvokeInput[i];
+		if (mInputInfo[i].type != AIFW_TENSOR_FLOAT32 && !quantizedInput) {
+			mEngineInput[i] = new int16_t[mInputSizeList[i]];
+			if (!mEngineInput[i]) {
+				AIFW_LOGE("Memory Allocation failed - model input buffer");
+				return AIFW_NO_MEM;
+			}
+		}
+	}
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 	if (mDataProcessor) {
 		mParsedData = new float[mModelAttribute.rawDataCount];
@@ -246,7 +304,8 @@ AIFW_RESULT AIModel::fillModelAttribute(const AIModelAttribute &modelAttribute)
 		modelAttribute.postProcessResultCount,
 		modelAttribute.inferenceResultCount,
 		NULL,
-		NULL
+		NULL,
+		modelAttribute.engine
 	};
 
 	if (!modelAttribute.version) {
@@ -294,6 +353,23 @@ AIFW_RESULT AIModel::fillModelAttribute(const AIModelAttribute &modelAttribute)
 	return AIFW_OK;
 }
 
+AIFW_RESULT AIModel::loadEngineModel(const char *file, const unsigned char *model)
+{
+#ifdef CONFIG_AIFW_USE_NPU
+	if (mModelAttribute.engine == AIFW_ENGINE_NPU) {
+		std::shared_ptr<AIEngine> npu = std::make_shared<NPU>();
+		AIFW_RESULT res = file ? npu->loadModel(file) : npu->loadModel(model);
+		if (res == AIFW_OK) {
+			mAIEngine = npu;
+			AIFW_LOGI("Model Engine is NPU");
+			return AIFW_OK;
+		}
+		AIFW_LOGE("NPU can't run the model, error: %d, running it on the CPU", res);
+	}
+#endif
+	return file ? mAIEngine->loadModel(file) : mAIEngine->loadModel(model);
+}
+
 AIFW_RESULT AIModel::loadModel(const char *scriptPath)
 {
 	AIFW_LOGV("Lets try loading file based model");
@@ -309,7 +385,7 @@ AIFW_RESULT AIModel::loadModel(const char *scriptPath)
 	AIFW_LOGV("json file parsed, filename: %s", scriptPath);
 	const char *file = mModelAttribute.modelPath;
 	if (strlen(file) > 0) {
-		res = mAIEngine->loadModel(file);
+		res = loadEngineModel(file, NULL);
 		if (res != AIFW_OK) {
 			AIFW_LOGE("Load model failed, model file: %s, error: %d", file, res);
 			return res;
@@ -346,7 +422,7 @@ AIFW_RESULT AIModel::loadModel(const AIModelAttribute &modelAttribute)
 		AIFW_LOGE("Array model is NULL.");
 		return AIFW_INVALID_ATTRIBUTE;
 	}
-	res = mAIEngine->loadModel(mModelAttribute.model);
+	res = loadEngineModel(NULL, mModelAttribute.model);
 	if (res != AIFW_OK) {
 		AIFW_LOGE("Load model failed, error %d", res);
 		return res;
@@ -367,17 +443,42 @@ AIFW_RESULT AIModel::loadModel(const AIModelAttribute &modelAttribute)
 }
 
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
-AIFW_RESULT AIModel::invoke(void)
+AIFW_RESULT AIModel::invokeEngine(void)
 {
 	AIFW_RESULT res;
-	int outputOffset = 0; /* to write 2d output in 1d buffer. */
-	float **invokeResult = new float *[mOutputSetCount];
 	for (uint16_t i = 0; i < mInputSetCount; i++) {
-		memset(mInvokeInput[i], '\0', mInputSizeList[i] * sizeof(float));
+		if (mEngineInput[i] != mInvokeInput[i]) {
+			res = quantizeData(mInvokeInput[i], mEngineInput[i], &mInputInfo[i]);
+			if (res != AIFW_OK) {
+				AIFW_LOGE("Quantizing input set %d failed", i);
+				return res;
+			}
+		}
+	}
+	res = mAIEngine->invoke(mEngineInput, mEngineOutput);
+	if (res != AIFW_OK) {
+		AIFW_LOGE("Engine Invoke failed.");
+		return AIFW_ERROR;
 	}
 	for (uint16_t i = 0; i < mOutputSetCount; i++) {
-		memset(mInvokeOutput[i], '\0', mOutputSizeList[i] * sizeof(float));
+		if (mOutputInfo[i].type == AIFW_TENSOR_FLOAT32) {
+			mInvokeOutput[i] = (float *)mEngineOutput[i];
+			continue;
+		}
+		res = dequantizeData(mEngineOutput[i], mInvokeOutput[i], &mOutputInfo[i]);
+		if (res != AIFW_OK) {
+			AIFW_LOGE("Dequantizing output set %d failed", i);
+			return res;
+		}
 	}
+	return AIFW_OK;
+}
+
+AIFW_RESULT AIModel::invoke(void)
+{
+	AIFW_RESULT res;
+	int outputOffset = 0; /* to write 2d output in 1d buffer. */
+	/* Inputs are overwritten and mInvokeOutput points to the output tensors of the engine or their dequantized copies, nothing to allocate or clear. */
 	if (mDataProcessor) {
 		AIFW_LOGV("data processor is set");
 		memset(mPostProcessedData, '\0', mModelAttribute.postProcessResultCount * sizeof(float));
@@ -396,17 +497,11 @@ AIFW_RESULT AIModel::invoke(void)
 			printf("\n");
 		}
 #endif
-		res = mAIEngine->invoke(mInvokeInput, invokeResult);
+		res = invokeEngine();
 		if (res != AIFW_OK) {
-			AIFW_LOGE("Engine Invoke failed.");
-			return AIFW_ERROR;
+			return res;
 		}
 		AIFW_LOGV("invoke completed fine");
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			for (uint16_t j = 0; j < mOutputSizeList[i]; j++) {
-				mInvokeOutput[i][j] = invokeResult[i][j];
-			}
-		}
 #ifdef CONFIG_AIFW_LOGV
 		printf("invoke Output\n");
 		for (uint16_t i = 0; i < mOutputSetCount; i++) {
@@ -452,17 +547,11 @@ AIFW_RESULT AIModel::invoke(void)
 			printf("\n");
 		}
 #endif
-		res = mAIEngine->invoke(mInvokeInput, invokeResult);
+		res = invokeEngine();
 		if (res != AIFW_OK) {
-			AIFW_LOGE("Engine Invoke failed.");
-			return AIFW_ERROR;
+			return res;
 		}
 		AIFW_LOGV("invoke completed fine");
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			for (uint16_t j = 0; j < mOutputSizeList[i]; j++) {
-				mInvokeOutput[i][j] = invokeResult[i][j];
-			}
-		}
 #ifdef CONFIG_AIFW_LOGV
 		printf("invoke Output\n");
 		for (uint16_t i = 0; i < mOutputSetCount; i++) {
@@ -668,7 +757,12 @@ AIFW_RESULT AIModel::getResultData(float *data, uint16_t count)
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	int outputOffset = 0;
 	for (uint16_t i = 0; i < mOutputSetCount; i++) {
-		memcpy(data+outputOffset, mInvokeOutput[i], mOutputSizeList[i] * sizeof(float));
+		if (mInvokeOutput[i]) {
+			memcpy(data+outputOffset, mInvokeOutput[i], mOutputSizeList[i] * sizeof(float));
+		} else {
+			/* Not invoked yet */
+			memset(data+outputOffset, '\0', mOutputSizeList[i] * sizeof(float));
+		}
 		outputOffset += mOutputSizeList[i];
 	}
 #else
@@ -715,10 +809,58 @@ AIFW_RESULT AIModel::resetInferenceState(void)
 	return mAIEngine->resetInferenceState();
 }
 
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+AIFW_RESULT AIModel::getInputInfo(uint16_t idx, AITensorInfo *info)
+{
+	if (!info || !mInputInfo || idx >= mInputSetCount) {
+		AIFW_LOGE("Invalid input set %d", idx);
+		return AIFW_INVALID_ARG;
+	}
+	*info = mInputInfo[idx];
+	return AIFW_OK;
+}
+
+AIFW_RESULT AIModel::getOutputInfo(uint16_t idx, AITensorInfo *info)
+{
+	if (!info || !mOutputInfo || idx >= mOutputSetCount) {
+		AIFW_LOGE("Invalid output set %d", idx);
+		return AIFW_INVALID_ARG;
+	}
+	*info = mOutputInfo[idx];
+	return AIFW_OK;
+}
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+
 uint32_t AIModel::getModelCode()
 {
 	return mModelAttribute.modelCode;
 }
 
+#ifdef CONFIG_AIFW_PROFILE
+AIFW_RESULT AIModel::getProfile(AIModelProfile *profile, AIOperatorProfile *operators, uint16_t maxOperators)
+{
+	if (!profile) {
+		AIFW_LOGE("Invalid argument - profile is NULL");
+		return AIFW_INVALID_ARG;
+	}
+	if (!mAIEngine) {
+		AIFW_LOGE("Model is not loaded");
+		return AIFW_ERROR;
+	}
+	mAIEngine->getProfile(profile, operators, maxOperators);
+	return AIFW_OK;
+}
+
+AIFW_RESULT AIModel::resetProfile(void)
+{
+	if (!mAIEngine) {
+		AIFW_LOGE("Model is not loaded");
+		return AIFW_ERROR;
+	}
+	mAIEngine->resetProfile();
+	return AIFW_OK;
+}
+#endif
+
 } /* namespace aifw */
 
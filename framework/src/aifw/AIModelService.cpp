@@ -18,6 +18,8 @@
 
 #include "aifw/aifw_timer.h"
 #include <stdlib.h>
+#include <string.h>
+#include <sched.h>
 #include <memory>
 #include "aifw/aifw.h"
 #include "aifw/aifw_log.h"
@@ -27,16 +29,120 @@
 namespace aifw {
 
 AIModelService::AIModelService(CollectRawDataListener collectRawDataCallback, std::shared_ptr<AIInferenceHandler> inferenceHandler) :
-	mInterval(0), mServiceRunning(false), mInferenceHandler(inferenceHandler), mCollectRawDataCallback(collectRawDataCallback), mTimer(NULL)
+	mInterval(0), mServiceRunning(false), mInferenceHandler(inferenceHandler), mCollectRawDataCallback(collectRawDataCallback), mTimer(NULL),
+	mPipelineData(NULL), mPipelineDataCount(NULL), mPipelineDepth(0), mPipelineHead(0), mPipelineCount(0),
+	mPipelineElementSize(0), mPipelineMaxCount(0), mPipelineExit(false)
 {
+	pthread_mutex_init(&mPipelineLock, NULL);
+	pthread_cond_init(&mPipelineCond, NULL);
 }
 
 AIModelService::~AIModelService()
 {
 	freeTimer();
+	if (mPipelineDepth > 0) {
+		flushPipeline(true);
+		pthread_join(mPipelineThread, NULL);
+		delete[] mPipelineData;
+		delete[] mPipelineDataCount;
+	}
+	pthread_cond_destroy(&mPipelineCond);
+	pthread_mutex_destroy(&mPipelineLock);
 	AIFW_LOGV("model service object destoyed");
 }
 
+AIFW_RESULT AIModelService::enablePipeline(uint16_t depth, size_t elementSize, uint16_t maxCount)
+{
+	if (depth == 0 || elementSize == 0 || maxCount == 0) {
+		AIFW_LOGE("Invalid pipeline depth %d, element size %d or count %d", depth, elementSize, maxCount);
+		return AIFW_INVALID_ARG;
+	}
+	if (mPipelineDepth > 0 || mServiceRunning) {
+		AIFW_LOGE("Pipeline already enabled or service running");
+		return AIFW_ERROR;
+	}
+	mPipelineData = new char[depth * elementSize * maxCount];
+	mPipelineDataCount = new uint16_t[depth];
+	if (!mPipelineData || !mPipelineDataCount) {
+		AIFW_LOGE("Memory allocation failed for pipeline queue");
+		delete[] mPipelineData;
+		mPipelineData = NULL;
+		delete[] mPipelineDataCount;
+		mPipelineDataCount = NULL;
+		return AIFW_NO_MEM;
+	}
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+#ifdef CONFIG_SMP
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	CPU_SET(CONFIG_AIFW_PIPELINE_CPU, &cpuset);
+	pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpuset);
+#endif
+	int status = pthread_create(&mPipelineThread, &attr, pipelineThread, (void *)this);
+	pthread_attr_destroy(&attr);
+	if (status != 0) {
+		AIFW_LOGE("Failed to create pipeline thread, error: %d", status);
+		delete[] mPipelineData;
+		mPipelineData = NULL;
+		delete[] mPipelineDataCount;
+		mPipelineDataCount = NULL;
+		return AIFW_ERROR;
+	}
+	pthread_setname_np(mPipelineThread, "aifw_pipeline");
+
+	mPipelineDepth = depth;
+	mPipelineElementSize = elementSize;
+	mPipelineMaxCount = maxCount;
+	AIFW_LOGV("Pipeline enabled, depth %d", depth);
+	return AIFW_OK;
+}
+
+void AIModelService::flushPipeline(bool exit)
+{
+	pthread_mutex_lock(&mPipelineLock);
+	while (mPipelineCount > 0) {
+		pthread_cond_wait(&mPipelineCond, &mPipelineLock);
+	}
+	if (exit) {
+		mPipelineExit = true;
+		pthread_cond_broadcast(&mPipelineCond);
+	}
+	pthread_mutex_unlock(&mPipelineLock);
+}
+
+void *AIModelService::pipelineThread(void *args)
+{
+	AIModelService *modelService = (AIModelService *)args;
+	size_t entrySize = modelService->mPipelineElementSize * modelService->mPipelineMaxCount;
+
+	pthread_mutex_lock(&modelService->mPipelineLock);
+	while (true) {
+		while (modelService->mPipelineCount == 0 && !modelService->mPipelineExit) {
+			pthread_cond_wait(&modelService->mPipelineCond, &modelService->mPipelineLock);
+		}
+		if (modelService->mPipelineCount == 0) {
+			break;
+		}
+		/* The entry stays queued while it is inferred, so that pushData() does not overwrite it */
+		uint16_t head = modelService->mPipelineHead;
+		pthread_mutex_unlock(&modelService->mPipelineLock);
+
+		AIFW_RESULT res = modelService->mInferenceHandler->pushData(modelService->mPipelineData + head * entrySize, modelService->mPipelineDataCount[head]);
+		if (res != AIFW_OK) {
+			AIFW_LOGE("Inference of queued data failed, error: %d", res);
+		}
+
+		pthread_mutex_lock(&modelService->mPipelineLock);
+		modelService->mPipelineHead = (head + 1) % modelService->mPipelineDepth;
+		modelService->mPipelineCount--;
+		pthread_cond_broadcast(&modelService->mPipelineCond);
+	}
+	pthread_mutex_unlock(&modelService->mPipelineLock);
+	return NULL;
+}
+
 AIFW_RESULT AIModelService::freeTimer(void)
 {
 	if (mTimer) {
@@ -83,6 +189,9 @@ AIFW_RESULT AIModelService::stop(void)
 		AIFW_LOGV("Service already stopped.");
 		return AIFW_OK;
 	}
+	if (mPipelineDepth > 0) {
+		flushPipeline(false);
+	}
 	AIFW_RESULT ret = clearData();
 	if (ret != AIFW_OK) {
 		AIFW_LOGE("Failed to clear data. ret: %d", ret);
@@ -130,7 +239,30 @@ AIFW_RESULT AIModelService::pushData(void *data, uint16_t count)
 		AIFW_LOGE("Service not running");
 		return AIFW_SERVICE_NOT_RUNNING;
 	}
-	return mInferenceHandler->pushData(data, count);
+	if (mPipelineDepth == 0) {
+		return mInferenceHandler->pushData(data, count);
+	}
+	if (!data) {
+		AIFW_LOGE("raw data argument is null");
+		return AIFW_INVALID_ARG;
+	}
+	if (count > mPipelineMaxCount) {
+		AIFW_LOGE("raw data count %d is more than %d", count, mPipelineMaxCount);
+		return AIFW_NOT_ENOUGH_SPACE;
+	}
+
+	pthread_mutex_lock(&mPipelineLock);
+	/* Backpressure: wait for the inference thread to free an entry */
+	while (mPipelineCount == mPipelineDepth) {
+		pthread_cond_wait(&mPipelineCond, &mPipelineLock);
+	}
+	uint16_t tail = (mPipelineHead + mPipelineCount) % mPipelineDepth;
+	memcpy(mPipelineData + tail * mPipelineElementSize * mPipelineMaxCount, data, count * mPipelineElementSize);
+	mPipelineDataCount[tail] = count;
+	mPipelineCount++;
+	pthread_cond_broadcast(&mPipelineCond);
+	pthread_mutex_unlock(&mPipelineLock);
+	return AIFW_OK;
 }
 
 AIFW_RESULT AIModelService::prepare(void)
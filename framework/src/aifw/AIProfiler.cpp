@@ -0,0 +1,137 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include "tinyara/config.h"
+#include <string.h>
+#include <time.h>
+#if defined(CONFIG_SCHED_CPULOAD_CYCLES) && defined(CONFIG_BUILD_FLAT)
+#include <tinyara/arch.h>
+/* Core cycle counter, started by the OS for the CPU load accounting */
+#define AIFW_PROFILE_CYCLES
+#endif
+
+#include "aifw/aifw_log.h"
+#include "include/AIProfiler.h"
+
+namespace aifw {
+
+AIProfiler::AIProfiler() :
+	mOperatorCount(0), mNext(0), mInvokes(0), mArenaBytes(0)
+{
+	pthread_mutex_init(&mLock, NULL);
+	memset(mOperators, 0, sizeof(mOperators));
+}
+
+AIProfiler::~AIProfiler()
+{
+	pthread_mutex_destroy(&mLock);
+}
+
+uint32_t AIProfiler::now(void)
+{
+#ifdef AIFW_PROFILE_CYCLES
+	return up_perf_gettime();
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#endif
+}
+
+void AIProfiler::startInvoke(void)
+{
+	pthread_mutex_lock(&mLock);
+	mNext = 0;
+	mInvokes++;
+	pthread_mutex_unlock(&mLock);
+}
+
+uint32_t AIProfiler::begin(const char *name)
+{
+	uint32_t handle = mNext++;
+	if (handle >= CONFIG_AIFW_PROFILE_MAX_OPERATORS) {
+		return handle;
+	}
+	mOperators[handle].name = name;
+	mBegin[handle] = now();
+	return handle;
+}
+
+void AIProfiler::end(uint32_t handle, uint32_t memory)
+{
+	uint32_t end = now();
+	if (handle >= CONFIG_AIFW_PROFILE_MAX_OPERATORS) {
+		return;
+	}
+	/* Differences of the 32 bit counter stay right across a wrap around */
+	uint32_t ticks = end - mBegin[handle];
+	AIOperatorProfile *op = &mOperators[handle];
+
+	pthread_mutex_lock(&mLock);
+	op->ticks += ticks;
+	if (ticks > op->maxTicks) {
+		op->maxTicks = ticks;
+	}
+	if (memory > op->memory) {
+		op->memory = memory;
+	}
+	if (handle >= mOperatorCount) {
+		mOperatorCount = handle + 1;
+	}
+	pthread_mutex_unlock(&mLock);
+}
+
+void AIProfiler::setArenaBytes(uint32_t bytes)
+{
+	mArenaBytes = bytes;
+}
+
+void AIProfiler::get(AIModelProfile *profile, AIOperatorProfile *operators, uint16_t maxOperators)
+{
+	pthread_mutex_lock(&mLock);
+	profile->invokes = mInvokes;
+#ifdef AIFW_PROFILE_CYCLES
+	profile->ticksPerSecond = up_perf_getfreq();
+#else
+	profile->ticksPerSecond = 1000000;
+#endif
+	profile->arenaBytes = mArenaBytes;
+	profile->operatorCount = mOperatorCount;
+	for (uint16_t i = 0; i < mOperatorCount; i++) {
+		if (mOperators[i].memory > profile->arenaBytes) {
+			profile->arenaBytes = mOperators[i].memory;
+		}
+	}
+	if (operators) {
+		uint16_t count = maxOperators < mOperatorCount ? maxOperators : mOperatorCount;
+		memcpy(operators, mOperators, count * sizeof(AIOperatorProfile));
+	}
+	pthread_mutex_unlock(&mLock);
+}
+
+void AIProfiler::reset(void)
+{
+	pthread_mutex_lock(&mLock);
+	memset(mOperators, 0, sizeof(mOperators));
+	mOperatorCount = 0;
+	mInvokes = 0;
+	pthread_mutex_unlock(&mLock);
+}
+
+} /* namespace aifw */
@@ -0,0 +1,352 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include "tinyara/config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <tinyara/npu.h>
+
+#include "aifw/aifw_log.h"
+#include "include/NPU.h"
+
+namespace aifw {
+
+/* Flatbuffers keep the identifier of their schema at offset 4 */
+static uint8_t getModelFormat(const void *model)
+{
+	const char *id = (const char *)model + 4;
+	if (!memcmp(id, "TFL3", 4)) {
+		return NPU_FORMAT_TFLITE;
+	}
+	if (!memcmp(id, "CIR0", 4)) {
+		return NPU_FORMAT_CIRCLE;
+	}
+	return NPU_FORMAT_VENDOR;
+}
+
+static size_t getElementSize(AIFW_TENSOR_TYPE type)
+{
+	switch (type) {
+	case AIFW_TENSOR_INT8:
+		return sizeof(int8_t);
+	case AIFW_TENSOR_INT16:
+		return sizeof(int16_t);
+	default:
+		return sizeof(float);
+	}
+}
+
+NPU::NPU() :
+	mHandle(-1), mBuf(NULL), mInputSetCount(0), mOutputSetCount(0), mInputSizeList(NULL), mOutputSizeList(NULL),
+	mInputInfo(NULL), mOutputInfo(NULL), mOutputs(NULL)
+{
+	mFd = open(CONFIG_AIFW_NPU_DEVPATH, O_RDWR);
+	if (mFd < 0) {
+		AIFW_LOGE("%s open failed errno : %d", CONFIG_AIFW_NPU_DEVPATH, errno);
+	}
+}
+
+NPU::~NPU()
+{
+	AIFW_LOGV(":DEINIT:");
+	unloadModel();
+	if (mFd >= 0) {
+		close(mFd);
+		mFd = -1;
+	}
+}
+
+void NPU::unloadModel(void)
+{
+	if (mHandle >= 0) {
+		ioctl(mFd, NPUIOC_UNLOAD, (unsigned long)mHandle);
+		mHandle = -1;
+	}
+	if (mOutputs) {
+		for (uint16_t i = 0; i < mOutputSetCount; i++) {
+			free(mOutputs[i]);
+		}
+		delete[] mOutputs;
+		mOutputs = NULL;
+	}
+	delete[] mInputSizeList;
+	mInputSizeList = NULL;
+	delete[] mOutputSizeList;
+	mOutputSizeList = NULL;
+	delete[] mInputInfo;
+	mInputInfo = NULL;
+	delete[] mOutputInfo;
+	mOutputInfo = NULL;
+	mInputSetCount = 0;
+	mOutputSetCount = 0;
+	if (mBuf) {
+		free(mBuf);
+		mBuf = NULL;
+	}
+}
+
+AIFW_RESULT NPU::readTensors(void)
+{
+	struct npu_tensor_s tensor;
+	uint16_t count;
+	uint16_t *sizeList;
+	AITensorInfo *info;
+
+	for (int output = 0; output < 2; output++) {
+		count = output ? mOutputSetCount : mInputSetCount;
+		sizeList = new uint16_t[count];
+		info = new AITensorInfo[count];
+		if (output) {
+			mOutputSizeList = sizeList;
+			mOutputInfo = info;
+		} else {
+			mInputSizeList = sizeList;
+			mInputInfo = info;
+		}
+		if (!sizeList || !info) {
+			AIFW_LOGE("Memory Allocation failed - model tensor list");
+			return AIFW_NO_MEM;
+		}
+		for (uint16_t i = 0; i < count; i++) {
+			tensor.handle = mHandle;
+			tensor.output = output;
+			tensor.index = i;
+			if (ioctl(mFd, NPUIOC_GETTENSOR, (unsigned long)&tensor) < 0) {
+				AIFW_LOGE("Getting %s %d failed errno : %d", output ? "output" : "input", i, errno);
+				return AIFW_ERROR;
+			}
+			switch (tensor.type) {
+			case NPU_TENSOR_FLOAT32:
+				info[i].type = AIFW_TENSOR_FLOAT32;
+				break;
+			case NPU_TENSOR_INT8:
+				info[i].type = AIFW_TENSOR_INT8;
+				break;
+			case NPU_TENSOR_INT16:
+				info[i].type = AIFW_TENSOR_INT16;
+				break;
+			default:
+				AIFW_LOGE("Unsupported tensor type %d", tensor.type);
+				return AIFW_ERROR;
+			}
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+			/* AIModel gives and takes floats only */
+			if (info[i].type != AIFW_TENSOR_FLOAT32) {
+				AIFW_LOGE("Quantized models need CONFIG_AIFW_MULTI_INOUT_SUPPORT");
+				return AIFW_ERROR;
+			}
+#endif
+			info[i].scale = tensor.type == NPU_TENSOR_FLOAT32 ? 1.0f : tensor.scale;
+			info[i].zeroPoint = tensor.type == NPU_TENSOR_FLOAT32 ? 0 : tensor.zeropoint;
+			info[i].count = tensor.count;
+			sizeList[i] = tensor.count;
+			AIFW_LOGV("%s %d: type %d, %d elements", output ? "output" : "input", i, info[i].type, info[i].count);
+		}
+	}
+
+	mOutputs = new void *[mOutputSetCount];
+	if (!mOutputs) {
+		AIFW_LOGE("Memory Allocation failed - model output buffer");
+		return AIFW_NO_MEM;
+	}
+	memset(mOutputs, 0, mOutputSetCount * sizeof(void *));
+	for (uint16_t i = 0; i < mOutputSetCount; i++) {
+		/* Written by the accelerator, possibly by DMA */
+		mOutputs[i] = malloc(mOutputInfo[i].count * getElementSize(mOutputInfo[i].type));
+		if (!mOutputs[i]) {
+			AIFW_LOGE("Memory Allocation failed - model output %d", i);
+			return AIFW_NO_MEM;
+		}
+	}
+	return AIFW_OK;
+}
+
+AIFW_RESULT NPU::_loadModel(const void *model, size_t size)
+{
+	struct npu_info_s info;
+	struct npu_model_s npuModel;
+
+	if (mFd < 0) {
+		return AIFW_ERROR;
+	}
+	if (ioctl(mFd, NPUIOC_GETINFO, (unsigned long)&info) < 0) {
+		AIFW_LOGE("Getting NPU info failed errno : %d", errno);
+		return AIFW_ERROR;
+	}
+	npuModel.data = model;
+	npuModel.size = size;
+	npuModel.format = getModelFormat(model);
+	if (!(info.formats & npuModel.format)) {
+		AIFW_LOGE("%s does not support model format 0x%x", info.name, npuModel.format);
+		return AIFW_ERROR;
+	}
+	if (ioctl(mFd, NPUIOC_LOAD, (unsigned long)&npuModel) < 0) {
+		AIFW_LOGE("Loading model on %s failed errno : %d", info.name, errno);
+		return AIFW_ERROR;
+	}
+	mHandle = npuModel.handle;
+	mInputSetCount = npuModel.ninputs;
+	mOutputSetCount = npuModel.noutputs;
+	AIFW_RESULT res = readTensors();
+	if (res != AIFW_OK) {
+		unloadModel();
+		return res;
+	}
+	AIFW_LOGI("Model loaded on %s, %d inputs, %d outputs", info.name, mInputSetCount, mOutputSetCount);
+	return AIFW_OK;
+}
+
+AIFW_RESULT NPU::loadModel(const char *file)
+{
+	AIFW_LOGV("GetModel from File:%s", file);
+	unloadModel();
+	FILE *fp = fopen(file, "r");
+	if (fp == NULL) {
+		AIFW_LOGE("File %s open operation failed errno : %d", file, errno);
+		return AIFW_ERROR_FILE_ACCESS;
+	}
+	fseek(fp, 0, SEEK_END);
+	int size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (size < 8) {
+		fclose(fp);
+		AIFW_LOGE("File %s size read as %d is invalid, errno %d", file, size, errno);
+		return AIFW_ERROR_FILE_ACCESS;
+	}
+	void *mapped = mmap(NULL, size, PROT_READ, MAP_SHARED, fileno(fp), 0);
+	if (mapped != MAP_FAILED) {
+		fclose(fp);
+		AIFW_LOGV("Model File mapped at %p", mapped);
+		return _loadModel(mapped, size);
+	}
+	mBuf = (char *)malloc(size);
+	if (!mBuf) {
+		fclose(fp);
+		AIFW_LOGE("Memory not enough to allocate %d", size);
+		return AIFW_NO_MEM;
+	}
+	fread(mBuf, 1, size, fp);
+	fclose(fp);
+	AIFW_RESULT res = _loadModel(mBuf, size);
+	if (res != AIFW_OK) {
+		free(mBuf);
+		mBuf = NULL;
+	}
+	return res;
+}
+
+AIFW_RESULT NPU::loadModel(const unsigned char *model)
+{
+	unloadModel();
+	return _loadModel(model, 0);
+}
+
+AIFW_RESULT NPU::run(void **inputs)
+{
+	struct npu_invoke_s invoke;
+
+	invoke.handle = mHandle;
+	invoke.inputs = inputs;
+	invoke.outputs = mOutputs;
+#ifdef CONFIG_AIFW_PROFILE
+	this->mProfiler.startInvoke();
+	uint32_t handle = this->mProfiler.begin("NPU");
+#endif
+	AIFW_START_TIMER
+	if (ioctl(mFd, NPUIOC_INVOKE, (unsigned long)&invoke) < 0) {
+		AIFW_LOGE("Invoke failed errno : %d", errno);
+		return AIFW_INFERENCE_ERROR;
+	}
+	/* Sleeps until the completion callback of the driver */
+	int ret = ioctl(mFd, NPUIOC_WAIT, 0);
+	AIFW_END_TIMER
+#ifdef CONFIG_AIFW_PROFILE
+	this->mProfiler.end(handle);
+#endif
+	if (ret < 0) {
+		AIFW_LOGE("Inference failed errno : %d", errno);
+		return AIFW_INFERENCE_ERROR;
+	}
+	return AIFW_OK;
+}
+
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+void *NPU::invoke(void *inputData)
+{
+	if (mHandle < 0 || run(&inputData) != AIFW_OK) {
+		return NULL;
+	}
+	return mOutputs[0];
+}
+#else
+AIFW_RESULT NPU::invoke(void *inputData, void *outputData)
+{
+	if (mHandle < 0) {
+		return AIFW_ERROR;
+	}
+	AIFW_RESULT res = run((void **)inputData);
+	if (res != AIFW_OK) {
+		return res;
+	}
+	memcpy(outputData, mOutputs, mOutputSetCount * sizeof(void *));
+	return AIFW_OK;
+}
+
+void NPU::getModelDimensions(uint16_t *inputSetCount, uint16_t **inputSizeList, uint16_t *outputSetCount, uint16_t **outputSizeList)
+{
+	*inputSetCount = mInputSetCount;
+	*inputSizeList = mInputSizeList;
+	*outputSetCount = mOutputSetCount;
+	*outputSizeList = mOutputSizeList;
+}
+
+AIFW_RESULT NPU::getInputInfo(uint16_t idx, AITensorInfo *info)
+{
+	if (idx >= mInputSetCount) {
+		return AIFW_INVALID_ARG;
+	}
+	*info = mInputInfo[idx];
+	return AIFW_OK;
+}
+
+AIFW_RESULT NPU::getOutputInfo(uint16_t idx, AITensorInfo *info)
+{
+	if (idx >= mOutputSetCount) {
+		return AIFW_INVALID_ARG;
+	}
+	*info = mOutputInfo[idx];
+	return AIFW_OK;
+}
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+
+AIFW_RESULT NPU::resetInferenceState(void)
+{
+	if (ioctl(mFd, NPUIOC_RESET, (unsigned long)mHandle) < 0) {
+		AIFW_LOGE("Failed to reset model state. errno: %d", errno);
+		return AIFW_ERROR;
+	}
+	return AIFW_OK;
+}
+
+} /* namespace aifw */
@@ -17,6 +17,7 @@
  ****************************************************************************/
 
 #include <iostream>
+#include <sys/mman.h>
 
 #include "tinyara/config.h"
 #include "aifw/aifw_log.h"
@@ -25,14 +26,42 @@
 
 namespace aifw {
 
+#ifdef CONFIG_AIFW_PROFILE
+/* Gives the operators run by the interpreter to the profiler of the engine */
+class ONERTMProfiler : public luci_interpreter::IProfiler
+{
+public:
+	ONERTMProfiler(AIProfiler &profiler) :
+		mProfiler(profiler)
+	{
+	}
+
+	uint32_t beginOperator(int32_t builtinCode) override
+	{
+		return mProfiler.begin(circle::EnumNameBuiltinOperator((circle::BuiltinOperator)builtinCode));
+	}
+
+	void endOperator(uint32_t handle, size_t allocatedBytes) override
+	{
+		mProfiler.end(handle, allocatedBytes);
+	}
+
+private:
+	AIProfiler &mProfiler;
+};
+#endif
+
 ONERTM::ONERTM() :
-	mBuf(NULL), mInterpreter(NULL),
+	mBuf(NULL), mModel(NULL), mInterpreter(NULL),
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	mModelInputSize(0), mModelOutputSize(0)
 #else
 	mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0)
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 {
+#ifdef CONFIG_AIFW_PROFILE
+	this->mOpProfiler = new ONERTMProfiler(this->mProfiler);
+#endif
 }
 
 ONERTM::~ONERTM()
@@ -43,6 +72,10 @@ ONERTM::~ONERTM()
 		mBuf = NULL;
 	}
 	mInterpreter.reset();
+#ifdef CONFIG_AIFW_PROFILE
+	delete mOpProfiler;
+	mOpProfiler = NULL;
+#endif
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	if (this->mInputSizeList) {
 		delete[] this->mInputSizeList;
@@ -58,7 +91,10 @@ ONERTM::~ONERTM()
 AIFW_RESULT ONERTM::resetInferenceState(void)
 {
 	this->mInterpreter.reset();
-	this->mInterpreter = std::make_shared<luci_interpreter::Interpreter>(this->mBuf, true);
+	this->mInterpreter = std::make_shared<luci_interpreter::Interpreter>(this->mModel, true);
+#ifdef CONFIG_AIFW_PROFILE
+	this->mInterpreter->setProfiler(this->mOpProfiler);
+#endif
 	return AIFW_OK;
 }
 
@@ -66,9 +102,12 @@ AIFW_RESULT ONERTM::_loadModel(void)
 {
 	AIFW_LOGV("luci_interpreter::Interpreter _loadModel\n");
 	this->mInterpreter = std::make_shared<luci_interpreter::Interpreter>(
-		this->mBuf,
+		this->mModel,
 		true);
 	AIFW_LOGV("luci_interpreter::Interpreter created\n");
+#ifdef CONFIG_AIFW_PROFILE
+	this->mInterpreter->setProfiler(this->mOpProfiler);
+#endif
 	sleep(2);
 
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
@@ -126,6 +165,15 @@ AIFW_RESULT ONERTM::loadModel(const char *file)
 		return AIFW_ERROR_FILE_ACCESS;
 	}
 	AIFW_LOGV("Model File Size: %d", size);
+	/* Use the model in place if the file resides in directly addressable
+	 * memory (e.g. a romfs image on XIP flash).
+	 */
+	void *mapped = mmap(NULL, size, PROT_READ, MAP_SHARED, fileno(fp), 0);
+	if (mapped != MAP_FAILED) {
+		fclose(fp);
+		AIFW_LOGV("Model File mapped at %p", mapped);
+		return loadModel((const unsigned char *)mapped);
+	}
 	this->mBuf = (char *)malloc(size);
 	if (!this->mBuf) {
 		fclose(fp);
@@ -134,17 +182,16 @@ AIFW_RESULT ONERTM::loadModel(const char *file)
 	}
 	fread(this->mBuf, 1, size, fp);
 	fclose(fp);
-
-	AIFW_LOGV("GetModel from Model file");
+	this->mModel = this->mBuf;
 
 	AIFW_LOGV("Model read from file %s", file);
-	
 	return _loadModel();
 }
 
 AIFW_RESULT ONERTM::loadModel(const unsigned char *model)
 {
-	this->mBuf = reinterpret_cast<char*>(const_cast<unsigned char *>(model));
+	/* The model is used in place and belongs to the caller */
+	this->mModel = reinterpret_cast<const char *>(model);
 	return _loadModel();
 }
 
@@ -159,6 +206,33 @@ void ONERTM::getModelDimensions(uint16_t *inputSetCount, uint16_t **inputSizeLis
 }
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+/* Inputs and outputs are exchanged as float */
+AIFW_RESULT ONERTM::getInputInfo(uint16_t idx, AITensorInfo *info)
+{
+	if (idx >= this->mInputSetCount) {
+		return AIFW_INVALID_ARG;
+	}
+	info->type = AIFW_TENSOR_FLOAT32;
+	info->scale = 1.0f;
+	info->zeroPoint = 0;
+	info->count = this->mInputSizeList[idx];
+	return AIFW_OK;
+}
+
+AIFW_RESULT ONERTM::getOutputInfo(uint16_t idx, AITensorInfo *info)
+{
+	if (idx >= this->mOutputSetCount) {
+		return AIFW_INVALID_ARG;
+	}
+	info->type = AIFW_TENSOR_FLOAT32;
+	info->scale = 1.0f;
+	info->zeroPoint = 0;
+	info->count = this->mOutputSizeList[idx];
+	return AIFW_OK;
+}
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 /* Run inference : with input data "features" and return output data ptr(Use output dimension to parse it) */
 void *ONERTM::invoke(void *inputData)
@@ -168,6 +242,9 @@ void *ONERTM::invoke(void *inputData)
 	for (uint32_t i = 0; i < this->mModelInputSize/sizeof(float); ++i) {
 		reinterpret_cast<float *>(data)[i] = value[i];
 	}
+#ifdef CONFIG_AIFW_PROFILE
+	this->mProfiler.startInvoke();
+#endif
 	AIFW_START_TIMER
 	this->mInterpreter->interpret();
 	AIFW_END_TIMER
@@ -186,6 +263,9 @@ AIFW_RESULT ONERTM::invoke(void *inputData, void *outputData)
 		}
 	}
 
+#ifdef CONFIG_AIFW_PROFILE
+	this->mProfiler.startInvoke();
+#endif
 	AIFW_START_TIMER
 	this->mInterpreter->interpret();
 	AIFW_END_TIMER
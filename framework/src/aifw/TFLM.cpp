@@ -18,15 +18,26 @@
 
 #include "tinyara/config.h"
 #include <iostream>
+#include <string.h>
+#include <sys/mman.h>
 #include <tensorflow/lite/c/common.h>
 #include <tensorflow/lite/schema/schema_generated.h>
+#ifdef CONFIG_AIFW_TFLM_OP_RESOLVER
+#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+#include "include/aifw_tflm_ops.h"
+#else
 #include <tensorflow/lite/micro/all_ops_resolver.h>
+#endif
 #include <tensorflow/lite/micro/tflite_bridge/micro_error_reporter.h>
 #include <tensorflow/lite/micro/micro_interpreter.h>
-#include <tensorflow/lite/micro/micro_profiler.h>
+#include <tensorflow/lite/micro/micro_profiler_interface.h>
 
 #include "aifw/aifw_log.h"
 #include "include/TFLM.h"
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+#include <tensorflow/lite/micro/micro_arena_constants.h>
+#include "include/TFLMArena.h"
+#endif
 
 #ifndef CONFIG_TFLM_MEM_POOL_SIZE
 #define AIFW_TFLM_POOL_SIZE 8192
@@ -34,11 +45,65 @@
 #define AIFW_TFLM_POOL_SIZE CONFIG_TFLM_MEM_POOL_SIZE
 #endif
 
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+/* Held while the tensors of the shared scratch arena are used */
+#define TFLM_ARENA_LOCK() TFLMArena::lock()
+#define TFLM_ARENA_UNLOCK() TFLMArena::unlock()
+#else
+#define TFLM_ARENA_LOCK()
+#define TFLM_ARENA_UNLOCK()
+#endif
+
 namespace aifw {
 
+#ifdef CONFIG_AIFW_TFLM_OP_RESOLVER
+/* Only the operators of CONFIG_AIFW_TFLM_MODELS, generated by mktflmresolver.py */
+class TFLMOpResolver : public tflite::MicroMutableOpResolver<AIFW_TFLM_OP_COUNT>
+{
+public:
+	TFLMOpResolver()
+	{
+		AIFW_TFLM_ADD_OPS(*this);
+	}
+};
+
+TFLMOpResolver g_Resolver;
+#else
 tflite::AllOpsResolver g_Resolver;
-tflite::MicroProfiler g_Profiler;
+#endif
+#ifdef CONFIG_AIFW_PROFILE
+/* Gives the operator events of the interpreter to the profiler of the engine */
+class TFLMProfiler : public tflite::MicroProfilerInterface
+{
+public:
+	TFLMProfiler(AIProfiler &profiler) :
+		mProfiler(profiler)
+	{
+	}
+
+	uint32_t BeginEvent(const char *tag) override
+	{
+		return mProfiler.begin(tag);
+	}
+
+	void EndEvent(uint32_t handle) override
+	{
+		mProfiler.end(handle);
+	}
+
+private:
+	AIProfiler &mProfiler;
+};
+
+#define TFLM_OP_PROFILER this->mOpProfiler
+#else
+#define TFLM_OP_PROFILER nullptr
+#endif
+
 TFLM::TFLM() :
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+	mOutputCopy(NULL),
+#endif
 	mModel(NULL), mBuf(NULL), mInterpreter(NULL), mErrorReporter(NULL),
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	mInput(NULL), mOutput(NULL), mModelInputSize(0), mModelOutputSize(0)
@@ -47,12 +112,17 @@ TFLM::TFLM() :
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 {
 	this->mTensorArenaSize = AIFW_TFLM_POOL_SIZE;
+#ifndef CONFIG_AIFW_TFLM_SHARED_ARENA
 	AIFW_LOGV("Tensor Arena size: %d", this->mTensorArenaSize);
 	std::shared_ptr<uint8_t> tensorArena(new uint8_t[this->mTensorArenaSize], std::default_delete<uint8_t[]>());
 	if (tensorArena.get() == NULL) {
 		AIFW_LOGE("tensor arena memory allocation failed");
 	}
 	this->mTensorArena = tensorArena;
+#endif
+#ifdef CONFIG_AIFW_PROFILE
+	this->mOpProfiler = new TFLMProfiler(this->mProfiler);
+#endif
 }
 
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
@@ -85,14 +155,24 @@ TFLM::~TFLM()
 	}
 	mErrorReporter.reset();
 	mInterpreter.reset();
+#ifdef CONFIG_AIFW_PROFILE
+	delete mOpProfiler;
+	mOpProfiler = NULL;
+#endif
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	clearMemory();
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+	delete[] mOutputCopy;
+	mOutputCopy = NULL;
+#endif
 }
 
 AIFW_RESULT TFLM::resetInferenceState(void)
 {
+	TFLM_ARENA_LOCK();
 	TfLiteStatus res = this->mInterpreter->Reset();
+	TFLM_ARENA_UNLOCK();
 	if (res != kTfLiteOk) {
 		AIFW_LOGE("Failed to reset model state. ret: %d", res);
 		return AIFW_ERROR;
@@ -175,17 +255,72 @@ mem_alloc_error:
 }
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+/* Allocates the tensors with a persistent arena of AIFW_TFLM_POOL_SIZE first,
+ * then again with one of the size the model used.
+ */
+AIFW_RESULT TFLM::allocateSharedArena(void)
+{
+	size_t size = this->mTensorArenaSize;
+	for (int pass = 0; pass < 2; pass++) {
+		this->mInterpreter.reset();
+		tflite::MicroAllocator *allocator = this->mArena.allocate(size);
+		if (!allocator) {
+			AIFW_LOGE("tensor arena memory allocation failed");
+			return AIFW_NO_MEM;
+		}
+		this->mInterpreter = std::make_shared<tflite::MicroInterpreter>(
+			this->mModel,
+			g_Resolver,
+			allocator,
+			nullptr,
+			TFLM_OP_PROFILER);
+
+		TFLM_ARENA_LOCK();
+		TfLiteStatus allocate_status = this->mInterpreter->AllocateTensors();
+		TFLM_ARENA_UNLOCK();
+		if (allocate_status != kTfLiteOk) {
+			this->mErrorReporter->Report("AllocateTensors() failed");
+			AIFW_LOGE("AllocateTensors() failed, persistent arena %d bytes, scratch arena %d bytes", size, CONFIG_AIFW_TFLM_SCRATCH_ARENA_SIZE);
+			return AIFW_ERROR;
+		}
+		/* Slack for the alignment of the tail of the new arena */
+		size = this->mArena.getPersistentUsedBytes() + tflite::MicroArenaBufferAlignment();
+	}
+	AIFW_LOGI("Persistent arena %d bytes, scratch arena %d of %d bytes used", this->mArena.getPersistentUsedBytes(), this->mArena.getScratchUsedBytes(), CONFIG_AIFW_TFLM_SCRATCH_ARENA_SIZE);
+
+	/* The outputs are in the scratch arena, overwritten by the next model invoked */
+	size = 0;
+	for (size_t i = 0; i < this->mInterpreter->outputs_size(); i++) {
+		size += this->mInterpreter->output(i)->bytes;
+	}
+	delete[] this->mOutputCopy;
+	this->mOutputCopy = new uint8_t[size];
+	if (!this->mOutputCopy) {
+		AIFW_LOGE("Memory Allocation failed - model output copy");
+		return AIFW_NO_MEM;
+	}
+	return AIFW_OK;
+}
+#endif /* CONFIG_AIFW_TFLM_SHARED_ARENA */
+
 AIFW_RESULT TFLM::_loadModel(void)
 {
 	AIFW_RESULT res;
 	mErrorReporter = std::make_shared<tflite::MicroErrorReporter>();
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+	res = allocateSharedArena();
+	if (res != AIFW_OK) {
+		return res;
+	}
+#else
 	this->mInterpreter = std::make_shared<tflite::MicroInterpreter>(
 		this->mModel,
 		g_Resolver,
 		this->mTensorArena.get(),
 		this->mTensorArenaSize,
 		nullptr,
-		&g_Profiler);
+		TFLM_OP_PROFILER);
 
 	TfLiteStatus allocate_status = this->mInterpreter->AllocateTensors();
 	if (allocate_status != kTfLiteOk) {
@@ -193,7 +328,11 @@ AIFW_RESULT TFLM::_loadModel(void)
 		AIFW_LOGE("AllocateTensors() failed");
 		return AIFW_ERROR;
 	}
+#endif /* CONFIG_AIFW_TFLM_SHARED_ARENA */
 	AIFW_LOGV("AllocateTensors success.");
+#ifdef CONFIG_AIFW_PROFILE
+	this->mProfiler.setArenaBytes(this->mInterpreter->arena_used_bytes());
+#endif
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	this->mInput = this->mInterpreter->input(0);
 	this->mOutput = this->mInterpreter->output(0);
@@ -250,6 +389,15 @@ AIFW_RESULT TFLM::loadModel(const char *file)
 		return AIFW_ERROR_FILE_ACCESS;
 	}
 	AIFW_LOGV("Model File Size: %d", size);
+	/* Use the model in place if the file resides in directly addressable
+	 * memory (e.g. a romfs image on XIP flash).
+	 */
+	void *mapped = mmap(NULL, size, PROT_READ, MAP_SHARED, fileno(fp), 0);
+	if (mapped != MAP_FAILED) {
+		fclose(fp);
+		AIFW_LOGV("Model File mapped at %p", mapped);
+		return loadModel((const unsigned char *)mapped);
+	}
 	this->mBuf = (char *)malloc(size);
 	if (!this->mBuf) {
 		fclose(fp);
@@ -293,46 +441,115 @@ void TFLM::getModelDimensions(uint16_t *inputSetCount, uint16_t **inputSizeList,
 }
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+static AIFW_RESULT getTensorInfo(const TfLiteTensor *tensor, uint16_t count, AITensorInfo *info)
+{
+	switch (tensor->type) {
+	case kTfLiteFloat32:
+		info->type = AIFW_TENSOR_FLOAT32;
+		info->scale = 1.0f;
+		info->zeroPoint = 0;
+		break;
+	case kTfLiteInt8:
+		info->type = AIFW_TENSOR_INT8;
+		info->scale = tensor->params.scale;
+		info->zeroPoint = tensor->params.zero_point;
+		break;
+	case kTfLiteInt16:
+		info->type = AIFW_TENSOR_INT16;
+		info->scale = tensor->params.scale;
+		info->zeroPoint = tensor->params.zero_point;
+		break;
+	default:
+		AIFW_LOGE("Unsupported tensor type %d", tensor->type);
+		return AIFW_ERROR;
+	}
+	info->count = count;
+	return AIFW_OK;
+}
+
+AIFW_RESULT TFLM::getInputInfo(uint16_t idx, AITensorInfo *info)
+{
+	if (idx >= this->mInputSetCount) {
+		return AIFW_INVALID_ARG;
+	}
+	return getTensorInfo(this->mInputList[idx], this->mInputSizeList[idx], info);
+}
+
+AIFW_RESULT TFLM::getOutputInfo(uint16_t idx, AITensorInfo *info)
+{
+	if (idx >= this->mOutputSetCount) {
+		return AIFW_INVALID_ARG;
+	}
+	return getTensorInfo(this->mOutputList[idx], this->mOutputSizeList[idx], info);
+}
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 /* Run inference : with input data "features" and return output data ptr(Use output dimension to parse it) */
 void *TFLM::invoke(void *inputData)
 {
 	float *value = (float *)(inputData);
+	TFLM_ARENA_LOCK();
 	for (int i = 0; i < this->mModelInputSize; i++) {
 		this->mInput->data.f[i] = value[i];
 	}
+#ifdef CONFIG_AIFW_PROFILE
+	this->mProfiler.startInvoke();
+#endif
 	AIFW_START_TIMER
 	TfLiteStatus invokeStatus = this->mInterpreter->Invoke();
 	AIFW_END_TIMER
 	if (invokeStatus != kTfLiteOk) {
+		TFLM_ARENA_UNLOCK();
 		this->mErrorReporter->Report("Invoke failed");
 		AIFW_LOGE("Invoke failed");
 		return NULL;
 	}
-	return this->mOutput->data.data;
+	void *output = this->mOutput->data.data;
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+	memcpy(this->mOutputCopy, output, this->mOutput->bytes);
+	output = this->mOutputCopy;
+#endif
+	TFLM_ARENA_UNLOCK();
+	return output;
 }
 #else
 /* Run inference : with input data "features", store output data in outputData parameter and return AIFW_OK on success */
 AIFW_RESULT TFLM::invoke(void *inputData, void *outputData)
 {
-	float **value = (float **)(inputData);
+	void **value = (void **)(inputData);
+	TFLM_ARENA_LOCK();
+	/* Inputs are given in the type of their tensor */
 	for (uint16_t i = 0; i < this->mInputSetCount; i++) {
-		for (uint16_t j = 0; j < this->mInputSizeList[i]; j++) {
-			this->mInputList[i]->data.f[j] = value[i][j];
-		}
+		memcpy(this->mInputList[i]->data.raw, value[i], this->mInputList[i]->bytes);
 	}
+#ifdef CONFIG_AIFW_PROFILE
+	this->mProfiler.startInvoke();
+#endif
 	AIFW_START_TIMER
 	TfLiteStatus invokeStatus = this->mInterpreter->Invoke();
 	AIFW_END_TIMER
 	if (invokeStatus != kTfLiteOk) {
+		TFLM_ARENA_UNLOCK();
 		this->mErrorReporter->Report("Invoke failed");
 		AIFW_LOGE("Invoke failed");
 		return AIFW_ERROR;
 	}
 	float **outputRef = (float **)(outputData);
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+	uint8_t *copy = this->mOutputCopy;
+	for (uint16_t i = 0; i < this->mOutputSetCount; i++) {
+		memcpy(copy, this->mOutputList[i]->data.data, this->mOutputList[i]->bytes);
+		outputRef[i] = (float *)copy;
+		copy += this->mOutputList[i]->bytes;
+	}
+#else
 	for (uint16_t i = 0; i < this->mOutputSetCount; i++) {
 		outputRef[i] = (float *)this->mOutputList[i]->data.data;
 	}
+#endif
+	TFLM_ARENA_UNLOCK();
 	return AIFW_OK;
 }
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
@@ -0,0 +1,159 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include "tinyara/config.h"
+#include <new>
+#include <pthread.h>
+#include <tensorflow/lite/micro/micro_allocator.h>
+#include <tensorflow/lite/micro/micro_arena_constants.h>
+#include <tensorflow/lite/micro/memory_helpers.h>
+#include <tensorflow/lite/micro/arena_allocator/persistent_arena_buffer_allocator.h>
+#include <tensorflow/lite/micro/arena_allocator/non_persistent_arena_buffer_allocator.h>
+#include <tensorflow/lite/micro/memory_planner/greedy_memory_planner.h>
+
+#include "aifw/aifw_log.h"
+#include "include/TFLMArena.h"
+
+#ifndef CONFIG_AIFW_TFLM_SCRATCH_ARENA_SIZE
+#define CONFIG_AIFW_TFLM_SCRATCH_ARENA_SIZE 8192
+#endif
+
+namespace aifw {
+
+/* MicroAllocator keeping its buffer allocators, to tell how much of each arena is used */
+class TFLMAllocator : public tflite::MicroAllocator
+{
+public:
+	TFLMAllocator(tflite::PersistentArenaBufferAllocator *persistent, tflite::NonPersistentArenaBufferAllocator *scratch, tflite::MicroMemoryPlanner *planner) :
+		tflite::MicroAllocator(persistent, scratch, planner), mPersistent(persistent), mScratch(scratch)
+	{
+	}
+
+	tflite::PersistentArenaBufferAllocator *mPersistent;
+	tflite::NonPersistentArenaBufferAllocator *mScratch;
+};
+
+static pthread_mutex_t g_arenaLock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t *g_scratch;
+static int g_scratchUsers;
+
+TFLMArena::TFLMArena() :
+	mPersistent(NULL), mAllocator(NULL), mHasScratch(false)
+{
+	lock();
+	if (g_scratchUsers == 0) {
+		g_scratch = new uint8_t[CONFIG_AIFW_TFLM_SCRATCH_ARENA_SIZE];
+		if (!g_scratch) {
+			AIFW_LOGE("scratch arena memory allocation failed");
+		}
+	}
+	if (g_scratch) {
+		g_scratchUsers++;
+		mHasScratch = true;
+	}
+	unlock();
+}
+
+TFLMArena::~TFLMArena()
+{
+	free();
+	if (!mHasScratch) {
+		return;
+	}
+	lock();
+	if (--g_scratchUsers == 0) {
+		delete[] g_scratch;
+		g_scratch = NULL;
+	}
+	unlock();
+}
+
+void TFLMArena::free(void)
+{
+	/* The allocators were constructed in the persistent arena */
+	delete[] mPersistent;
+	mPersistent = NULL;
+	mAllocator = NULL;
+}
+
+tflite::MicroAllocator *TFLMArena::allocate(size_t persistentSize)
+{
+	free();
+	if (!mHasScratch) {
+		return NULL;
+	}
+	mPersistent = new uint8_t[persistentSize];
+	if (!mPersistent) {
+		AIFW_LOGE("persistent arena memory allocation failed, size %d", persistentSize);
+		return NULL;
+	}
+
+	/* Same layout as MicroAllocator::Create() with two arenas: the allocators
+	 * are at the tail of the persistent arena, which grows down.
+	 */
+	const size_t alignment = tflite::MicroArenaBufferAlignment();
+	uint8_t *tail = tflite::AlignPointerDown(mPersistent + persistentSize, alignment);
+	tflite::PersistentArenaBufferAllocator tmp(mPersistent, tail - mPersistent);
+	uint8_t *buffer = tmp.AllocatePersistentBuffer(sizeof(tflite::PersistentArenaBufferAllocator), alignof(tflite::PersistentArenaBufferAllocator));
+	if (!buffer) {
+		return NULL;
+	}
+	tflite::PersistentArenaBufferAllocator *persistent = new (buffer) tflite::PersistentArenaBufferAllocator(tmp);
+
+	buffer = persistent->AllocatePersistentBuffer(sizeof(tflite::NonPersistentArenaBufferAllocator), alignof(tflite::NonPersistentArenaBufferAllocator));
+	if (!buffer) {
+		return NULL;
+	}
+	uint8_t *head = tflite::AlignPointerUp(g_scratch, alignment);
+	tflite::NonPersistentArenaBufferAllocator *scratch = new (buffer) tflite::NonPersistentArenaBufferAllocator(head, g_scratch + CONFIG_AIFW_TFLM_SCRATCH_ARENA_SIZE - head);
+
+	buffer = persistent->AllocatePersistentBuffer(sizeof(tflite::GreedyMemoryPlanner), alignof(tflite::GreedyMemoryPlanner));
+	if (!buffer) {
+		return NULL;
+	}
+	tflite::GreedyMemoryPlanner *planner = new (buffer) tflite::GreedyMemoryPlanner();
+
+	buffer = persistent->AllocatePersistentBuffer(sizeof(TFLMAllocator), alignof(TFLMAllocator));
+	if (!buffer) {
+		return NULL;
+	}
+	mAllocator = new (buffer) TFLMAllocator(persistent, scratch, planner);
+	return mAllocator;
+}
+
+size_t TFLMArena::getPersistentUsedBytes(void) const
+{
+	return mAllocator ? mAllocator->mPersistent->GetPersistentUsedBytes() : 0;
+}
+
+size_t TFLMArena::getScratchUsedBytes(void) const
+{
+	return mAllocator ? mAllocator->mScratch->GetNonPersistentUsedBytes() : 0;
+}
+
+void TFLMArena::lock(void)
+{
+	pthread_mutex_lock(&g_arenaLock);
+}
+
+void TFLMArena::unlock(void)
+{
+	pthread_mutex_unlock(&g_arenaLock);
+}
+
+} /* namespace aifw */
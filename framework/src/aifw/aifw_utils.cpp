@@ -17,6 +17,7 @@
  ****************************************************************************/
 
 #include <math.h>
+#include <string.h>
 #include "aifw/aifw_utils.h"
 #include "aifw/aifw_log.h"
 #include "aifw/aifw.h"
@@ -29,6 +30,60 @@ void normalizeData(float dataValues[], float meanVals[], float stdValues[], uint
 	}
 }
 
+template <typename T>
+static void quantize(const float *dataValues, T *quantizedValues, const struct AITensorInfo *info, int32_t min, int32_t max)
+{
+	float inverseScale = 1.0f / info->scale;
+	for (uint16_t i = 0; i < info->count; i++) {
+		int32_t value = (int32_t)lroundf(dataValues[i] * inverseScale) + info->zeroPoint;
+		quantizedValues[i] = (T)(value < min ? min : (value > max ? max : value));
+	}
+}
+
+template <typename T>
+static void dequantize(const T *quantizedValues, float *dataValues, const struct AITensorInfo *info)
+{
+	for (uint16_t i = 0; i < info->count; i++) {
+		dataValues[i] = info->scale * (float)((int32_t)quantizedValues[i] - info->zeroPoint);
+	}
+}
+
+AIFW_RESULT quantizeData(const float *dataValues, void *quantizedValues, const struct AITensorInfo *info)
+{
+	switch (info->type) {
+	case AIFW_TENSOR_FLOAT32:
+		memcpy(quantizedValues, dataValues, info->count * sizeof(float));
+		return AIFW_OK;
+	case AIFW_TENSOR_INT8:
+		quantize(dataValues, (int8_t *)quantizedValues, info, INT8_MIN, INT8_MAX);
+		return AIFW_OK;
+	case AIFW_TENSOR_INT16:
+		quantize(dataValues, (int16_t *)quantizedValues, info, INT16_MIN, INT16_MAX);
+		return AIFW_OK;
+	default:
+		AIFW_LOGE("Unknown tensor type %d", info->type);
+		return AIFW_INVALID_ARG;
+	}
+}
+
+AIFW_RESULT dequantizeData(const void *quantizedValues, float *dataValues, const struct AITensorInfo *info)
+{
+	switch (info->type) {
+	case AIFW_TENSOR_FLOAT32:
+		memcpy(dataValues, quantizedValues, info->count * sizeof(float));
+		return AIFW_OK;
+	case AIFW_TENSOR_INT8:
+		dequantize((const int8_t *)quantizedValues, dataValues, info);
+		return AIFW_OK;
+	case AIFW_TENSOR_INT16:
+		dequantize((const int16_t *)quantizedValues, dataValues, info);
+		return AIFW_OK;
+	default:
+		AIFW_LOGE("Unknown tensor type %d", info->type);
+		return AIFW_INVALID_ARG;
+	}
+}
+
 AIFW_RESULT getMSE(float *realValues, float *predValues, int count, float *result)
 {
 	if (realValues == NULL) {
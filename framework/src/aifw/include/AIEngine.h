@@ -25,6 +25,9 @@
 
 #include "tinyara/config.h"
 #include "aifw/aifw.h"
+#ifdef CONFIG_AIFW_PROFILE
+#include "AIProfiler.h"
+#endif
 //#define AIFW_PRINT_INFERENCE_TIME /* Default disabled */
 #ifdef AIFW_PRINT_INFERENCE_TIME
 #include <time.h>
@@ -90,12 +93,28 @@ public:
 #else
 	/**
 	 * @brief Run the inference with the given inputData.
-	 * @param [in] inputData: Input data for model invoke.
-	 * @param [out] outputData: Pointer to Output Data for storing output of invoke.
+	 * @param [in] inputData: Array of one pointer per input set, to elements of the type given by getInputInfo().
+	 * @param [out] outputData: Array of one pointer per output set, set to the output tensors of the engine, of the type given by getOutputInfo(). They stay valid until the next invoke.
 	 * @return: AIFW_RESULT enum object.
 	 */
 	virtual AIFW_RESULT invoke(void *inputData, void *outputData) = 0;
 
+	/**
+	 * @brief Gives the element type and quantization of an input set of the model.
+	 * @param [in] idx: Index of the input set.
+	 * @param [out] info: Type, quantization and count of elements of the set.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	virtual AIFW_RESULT getInputInfo(uint16_t idx, AITensorInfo *info) = 0;
+
+	/**
+	 * @brief Gives the element type and quantization of an output set of the model.
+	 * @param [in] idx: Index of the output set.
+	 * @param [out] info: Type, quantization and count of elements of the set.
+	 * @return: AIFW_RESULT enum object.
+	 */
+	virtual AIFW_RESULT getOutputInfo(uint16_t idx, AITensorInfo *info) = 0;
+
 	/**
 	 * @brief Pass model dimensions to AIModel to allocate memory.
 	 * @param [in] inputSetCount: Number of Input sets for model invoke.
@@ -112,6 +131,31 @@ public:
 	 * @return: AIFW_RESULT enum object.
 	 */
 	virtual AIFW_RESULT resetInferenceState(void) = 0;
+
+#ifdef CONFIG_AIFW_PROFILE
+	/**
+	 * @brief Gives the time and memory used by each operator over the invokes.
+	 * @param [out] profile: Summary of the profile.
+	 * @param [out] operators: Buffer of maxOperators operator profiles, may be NULL.
+	 * @param [in] maxOperators: Number of operator profiles to copy at most.
+	 */
+	void getProfile(AIModelProfile *profile, AIOperatorProfile *operators, uint16_t maxOperators)
+	{
+		mProfiler.get(profile, operators, maxOperators);
+	}
+
+	/**
+	 * @brief Clears the profile.
+	 */
+	void resetProfile(void)
+	{
+		mProfiler.reset();
+	}
+
+protected:
+	/* Filled by the engine around each operator it runs */
+	AIProfiler mProfiler;
+#endif
 };
 
 } /* namespace aifw */
@@ -0,0 +1,88 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/**
+ * @file AIProfiler.h
+ * @brief Per operator profile of the invokes of an engine
+ */
+
+#pragma once
+
+#include "tinyara/config.h"
+#include <pthread.h>
+#include "aifw/aifw.h"
+
+namespace aifw {
+
+/**
+ * @class AIProfiler
+ * @brief Accumulates the time and memory of each operator of a model over its invokes.
+ * Engines call startInvoke() before running the model, then begin() and end() around each
+ * operator, in execution order. The n-th operator run in an invoke is the n-th operator of the
+ * profile. Operators beyond CONFIG_AIFW_PROFILE_MAX_OPERATORS are not profiled.
+ */
+class AIProfiler
+{
+public:
+	AIProfiler();
+	~AIProfiler();
+
+	void startInvoke(void);
+
+	/**
+	 * @brief Marks the start of an operator.
+	 * @param [in] name: Type of the operator, which must outlive the profiler.
+	 * @return: Handle to give to end().
+	 */
+	uint32_t begin(const char *name);
+
+	/**
+	 * @brief Marks the end of an operator.
+	 * @param [in] handle: Value returned by begin().
+	 * @param [in] memory: Bytes of tensors allocated while the operator ran.
+	 */
+	void end(uint32_t handle, uint32_t memory = 0);
+
+	void setArenaBytes(uint32_t bytes);
+
+	/**
+	 * @brief Copies the profile.
+	 * @param [out] profile: Summary of the profile.
+	 * @param [out] operators: Buffer of maxOperators operator profiles, may be NULL.
+	 * @param [in] maxOperators: Number of operator profiles to copy at most.
+	 */
+	void get(AIModelProfile *profile, AIOperatorProfile *operators, uint16_t maxOperators);
+
+	/**
+	 * @brief Clears the profile, keeping the arena size.
+	 */
+	void reset(void);
+
+private:
+	static uint32_t now(void);
+
+	pthread_mutex_t mLock;
+	AIOperatorProfile mOperators[CONFIG_AIFW_PROFILE_MAX_OPERATORS];
+	uint32_t mBegin[CONFIG_AIFW_PROFILE_MAX_OPERATORS];
+	uint16_t mOperatorCount;
+	uint16_t mNext;
+	uint32_t mInvokes;
+	uint32_t mArenaBytes;
+};
+
+} /* namespace aifw */
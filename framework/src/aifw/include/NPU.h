@@ -0,0 +1,77 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/**
+ * @file NPU.h
+ * @brief AIEngine implementation for the neural network accelerators of tinyara/npu.h
+ */
+
+#pragma once
+
+#include "tinyara/config.h"
+#include "aifw/aifw.h"
+#include "AIEngine.h"
+
+namespace aifw {
+
+/**
+ * @class NPU
+ * @brief Runs models on the accelerator registered as CONFIG_AIFW_NPU_DEVPATH.
+ * invoke() starts the inference and sleeps until the completion callback of the driver wakes it up,
+ * so the CPU runs other threads, e.g. the pre processing of the next window, in the meantime.
+ */
+class NPU : public AIEngine
+{
+public:
+	NPU();
+	~NPU();
+	AIFW_RESULT loadModel(const char *file);
+
+	/**
+	 * @brief Load array model, a TFLITE or CIRCLE flatbuffer the driver finds the size of itself.
+	 */
+	AIFW_RESULT loadModel(const unsigned char *model);
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	void *invoke(void *inputData);
+#else
+	AIFW_RESULT invoke(void *inputData, void *outputData);
+	void getModelDimensions(uint16_t *inputSetCount, uint16_t **inputSizeList, uint16_t *outputSetCount, uint16_t **outputSizeList);
+	AIFW_RESULT getInputInfo(uint16_t idx, AITensorInfo *info);
+	AIFW_RESULT getOutputInfo(uint16_t idx, AITensorInfo *info);
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+	AIFW_RESULT resetInferenceState(void);
+
+private:
+	AIFW_RESULT _loadModel(const void *model, size_t size);
+	AIFW_RESULT readTensors(void);
+	AIFW_RESULT run(void **inputs);
+	void unloadModel(void);
+	int mFd;
+	int mHandle;
+	char *mBuf;
+	uint16_t mInputSetCount;
+	uint16_t mOutputSetCount;
+	uint16_t *mInputSizeList;
+	uint16_t *mOutputSizeList;
+	AITensorInfo *mInputInfo;
+	AITensorInfo *mOutputInfo;
+	/* Output buffers written by the accelerator */
+	void **mOutputs;
+};
+
+} /* namespace aifw */
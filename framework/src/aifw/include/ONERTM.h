@@ -40,6 +40,10 @@ namespace luci_interpreter
 }
 namespace aifw {
 
+#ifdef CONFIG_AIFW_PROFILE
+class ONERTMProfiler;
+#endif
+
 /**
  * @class ONERTM
  * @brief Class to perform AI operations using ONERT for Microcontroller
@@ -56,14 +60,22 @@ public:
 #else
 	AIFW_RESULT invoke(void *inputData, void *outputData);
 	void getModelDimensions(uint16_t *inputSetCount, uint16_t **inputSizeList, uint16_t *outputSetCount, uint16_t **outputSizeList);
+	AIFW_RESULT getInputInfo(uint16_t idx, AITensorInfo *info);
+	AIFW_RESULT getOutputInfo(uint16_t idx, AITensorInfo *info);
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 	AIFW_RESULT resetInferenceState(void);
 
 private:
 	AIFW_RESULT _loadModel(void);
 
+	/* Copy of a model file which could not be mapped, freed with the engine */
 	char *mBuf;
+	/* Model used by the interpreter: mBuf, a mapped file or an array */
+	const char *mModel;
 	std::shared_ptr<luci_interpreter::Interpreter> mInterpreter;
+#ifdef CONFIG_AIFW_PROFILE
+	ONERTMProfiler *mOpProfiler;
+#endif
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	uint16_t mModelInputSize;
 	uint16_t mModelOutputSize;
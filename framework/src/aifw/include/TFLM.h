@@ -27,6 +27,9 @@
 #include <memory>
 #include "aifw/aifw.h"
 #include "AIEngine.h"
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+#include "TFLMArena.h"
+#endif
 
 /* Tensorflow structure declaration */
 struct TfLiteTensor;
@@ -43,6 +46,10 @@ class ErrorReporter;
 
 namespace aifw {
 
+#ifdef CONFIG_AIFW_PROFILE
+class TFLMProfiler;
+#endif
+
 /**
  * @class TFLM
  * @brief Class to perform AI operations using Tensor Flow
@@ -59,6 +66,8 @@ public:
 #else
 	AIFW_RESULT invoke(void *inputData, void *outputData);
 	void getModelDimensions(uint16_t *inputSetCount, uint16_t **inputSizeList, uint16_t *outputSetCount, uint16_t **outputSizeList);
+	AIFW_RESULT getInputInfo(uint16_t idx, AITensorInfo *info);
+	AIFW_RESULT getOutputInfo(uint16_t idx, AITensorInfo *info);
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 	AIFW_RESULT resetInferenceState(void);
 
@@ -67,11 +76,21 @@ private:
 	void clearMemory(void);
 	AIFW_RESULT allocateMemory(void);
 	size_t mTensorArenaSize;
+#ifdef CONFIG_AIFW_TFLM_SHARED_ARENA
+	AIFW_RESULT allocateSharedArena(void);
+	TFLMArena mArena;
+	/* Outputs copied out of the shared scratch arena by invoke() */
+	uint8_t *mOutputCopy;
+#else
 	std::shared_ptr<uint8_t> mTensorArena;
+#endif
 	const tflite::Model *mModel;
 	char *mBuf;
 	std::shared_ptr<tflite::MicroInterpreter> mInterpreter;
 	std::shared_ptr<tflite::ErrorReporter> mErrorReporter;
+#ifdef CONFIG_AIFW_PROFILE
+	TFLMProfiler *mOpProfiler;
+#endif
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	TfLiteTensor *mInput;
 	TfLiteTensor *mOutput;
@@ -0,0 +1,79 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/**
+ * @file TFLMArena.h
+ * @brief Tensor arenas of the TFLM engines, sharing their scratch part
+ */
+
+#pragma once
+
+#include "tinyara/config.h"
+#include <stddef.h>
+#include <stdint.h>
+
+namespace tflite {
+class MicroAllocator;
+} /* namespace tflite */
+
+namespace aifw {
+
+class TFLMAllocator;
+
+/**
+ * @class TFLMArena
+ * @brief Tensor arena of one TFLM engine
+ * @details Buffers kept between invocations (tensor and node structures,
+ * variable tensors, kernel data) are in a persistent arena of the engine.
+ * Activations and scratch buffers, only used during an invocation, are in a
+ * scratch arena of CONFIG_AIFW_TFLM_SCRATCH_ARENA_SIZE shared by all the
+ * engines. Users of the scratch arena hold lock() while allocating tensors,
+ * filling the inputs, invoking and reading the outputs of a model.
+ */
+class TFLMArena
+{
+public:
+	TFLMArena();
+	~TFLMArena();
+
+	/**
+	 * @brief Creates an allocator with a persistent arena of persistentSize
+	 * bytes, freeing the previous one, whose interpreter must be destroyed.
+	 * @return The allocator, NULL if out of memory.
+	 */
+	tflite::MicroAllocator *allocate(size_t persistentSize);
+
+	/**
+	 * @brief Bytes of the persistent and scratch arenas used by the model,
+	 * after its tensors were allocated.
+	 */
+	size_t getPersistentUsedBytes(void) const;
+	size_t getScratchUsedBytes(void) const;
+
+	static void lock(void);
+	static void unlock(void);
+
+private:
+	void free(void);
+
+	uint8_t *mPersistent;
+	TFLMAllocator *mAllocator;
+	bool mHasScratch;
+};
+
+} /* namespace aifw */
@@ -126,6 +126,7 @@
 #define AQL_SET_CONDITION(adt, cond)    ((adt)->lvm_instance = (cond))
 #define AQL_ADD_VALUE(adt, domain, value)                               \
 	aql_add_value((adt), (domain), (value))
+#define AQL_ADD_PARAMETER(adt)          aql_add_parameter(adt)
 
 /****************************************************************************
 * Public Type Definitions
@@ -194,6 +195,7 @@ enum token_e {
 	ATTRIBUTE,
 	BPLUSTREE,					/* 48 */
 
+	PARAMETER = 250,
 	INTEGER_VALUE = 251,
 	FLOAT_VALUE = 252,
 	STRING_VALUE = 253,
@@ -242,12 +244,20 @@ struct aql_adt_s {
 	uint8_t relation_count;
 	uint8_t attribute_count;
 	uint8_t value_count;
+	uint8_t parameter_count;
+	uint8_t parameters[LVM_MAX_PARAMETER_ID];	/* Index in values of each parameter of an insert */
 	uint32_t optype;
 	uint8_t flags;
 	void *lvm_instance;
 };
 typedef struct aql_adt_s aql_adt_t;
 
+/* A query parsed once by db_prepare and run many times */
+struct _db_stmt_s {
+	aql_adt_t adt;				/* Parsed query, its condition compiled in adt.lvm_instance */
+	db_cursor_t *cursor;		/* Cursor of the last run, reused by the next one */
+};
+
 /****************************************************************************
 * Global Function Prototypes
 ****************************************************************************/
@@ -260,5 +270,7 @@ void aql_add_relation(aql_adt_t *adt, char *rel);
 aql_status_t aql_parse(aql_adt_t *adt, char *query_string);
 db_result_t aql_add_attribute(aql_adt_t *adt, char *name, domain_t domain, unsigned element_size, int processed_only);
 db_result_t aql_add_value(aql_adt_t *adt, domain_t domain, void *value);
+db_result_t aql_add_parameter(aql_adt_t *adt);
+db_result_t aql_deinit_handle(db_handle_t **handle);
 
 #endif							/* !AQL_H */
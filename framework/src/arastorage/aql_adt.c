@@ -84,6 +84,7 @@ void aql_clear(aql_adt_t *adt)
 	adt->relation_count = 0;
 	adt->attribute_count = 0;
 	adt->value_count = 0;
+	adt->parameter_count = 0;
 	adt->flags = 0;
 	memset(adt->aggregators, 0, sizeof(adt->aggregators));
 }
@@ -160,3 +161,16 @@ db_result_t aql_add_value(aql_adt_t *adt, domain_t domain, void *value_ptr)
 
 	return DB_OK;
 }
+
+/* A '?' in the values of an insert, set by db_bind_* before each run */
+db_result_t aql_add_parameter(aql_adt_t *adt)
+{
+	if (adt->value_count == AQL_ATTRIBUTE_LIMIT || adt->parameter_count == LVM_MAX_PARAMETER_ID) {
+		return DB_LIMIT_ERROR;
+	}
+
+	adt->parameters[adt->parameter_count++] = adt->value_count;
+	adt->values[adt->value_count++].domain = DOMAIN_UNSPECIFIED;
+
+	return DB_OK;
+}
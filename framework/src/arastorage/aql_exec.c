@@ -68,6 +68,7 @@
 #include "relation.h"
 #include "result.h"
 #include "aql.h"
+#include "lvm.h"
 
 /****************************************************************************
 * Private Functions
@@ -146,30 +147,23 @@ relation_t *aql_get_relation(aql_adt_t *adt)
 	return relation_load(adt->relations[first_rel_arg]);
 }
 
-db_result_t db_exec(char *format)
+static db_result_t aql_exec(aql_adt_t *adt)
 {
 	db_result_t res;
-	aql_adt_t adt;
 	relation_t *rel = NULL;
 	aql_attribute_t *attr;
 	attribute_t *relattr = NULL;
 	uint32_t optype;
-	res = aql_get_parse_result(format, &adt);
-
-	if (DB_ERROR(res)) {
-		DB_LOG_E("DB : Parsing Error in db_create : %d\n", res);
-		return DB_PARSING_ERROR;
-	}
 
-	optype = AQL_GET_OP_TYPE(AQL_GET_TYPE(&adt));
+	optype = AQL_GET_OP_TYPE(AQL_GET_TYPE(adt));
 	if (optype == AQL_OP_TYPE_QUERY) {
 		DB_LOG_E("DB : AQL OP TYPE Error \n");
 		return DB_ARGUMENT_ERROR;
 	}
 
-	optype = AQL_GET_EXEC_TYPE(AQL_GET_TYPE(&adt));
+	optype = AQL_GET_EXEC_TYPE(AQL_GET_TYPE(adt));
 	if (optype != AQL_TYPE_CREATE_RELATION) {
-		rel = aql_get_relation(&adt);
+		rel = aql_get_relation(adt);
 		if (rel == NULL) {
 			DB_LOG_E("DB : get relation Failed\n");
 			return DB_RELATIONAL_ERROR;
@@ -180,27 +174,27 @@ db_result_t db_exec(char *format)
 
 	switch (optype) {
 	case AQL_TYPE_CREATE_ATTRIBUTE:
-		attr = &(adt.attributes[0]);
+		attr = &(adt->attributes[0]);
 		if (relation_attribute_add(rel, DB_STORAGE, attr->name, attr->domain, attr->element_size) != NULL) {
 			res = DB_OK;
 		}
 		break;
 	case AQL_TYPE_CREATE_INDEX:
-		relattr = relation_attribute_get(rel, adt.attributes[0].name);
+		relattr = relation_attribute_get(rel, adt->attributes[0].name);
 		if (relattr == NULL) {
 			res = DB_NAME_ERROR;
 			break;
 		}
-		res = index_create(AQL_GET_INDEX_TYPE(&adt), rel, relattr);
+		res = index_create(AQL_GET_INDEX_TYPE(adt), rel, relattr);
 		break;
 	case AQL_TYPE_CREATE_RELATION:
-		if (relation_create(adt.relations[0], DB_STORAGE) != NULL) {
+		if (relation_create(adt->relations[0], DB_STORAGE) != NULL) {
 			res = DB_OK;
 		}
 		break;
 	case AQL_TYPE_INSERT:
 		if (relation_cardinality(rel) < DB_TUPLE_LIMIT) {
-			res = relation_insert(rel, adt.values);
+			res = relation_insert(rel, adt->values);
 			if (DB_SUCCESS(res)) {
 				res = DB_OK;
 			}
@@ -209,10 +203,10 @@ db_result_t db_exec(char *format)
 		}
 		break;
 	case AQL_TYPE_REMOVE_ATTRIBUTE:
-		res = relation_attribute_remove(rel, adt.attributes[0].name);
+		res = relation_attribute_remove(rel, adt->attributes[0].name);
 		break;
 	case AQL_TYPE_REMOVE_INDEX:
-		relattr = relation_attribute_get(rel, adt.attributes[0].name);
+		relattr = relation_attribute_get(rel, adt->attributes[0].name);
 		if (relattr != NULL) {
 			index_load(rel, relattr);
 			if (relattr->index != NULL) {
@@ -236,9 +230,112 @@ db_result_t db_exec(char *format)
 	return res;
 }
 
-db_cursor_t *db_query(char *format)
+db_result_t db_exec(char *format)
 {
+	db_result_t res;
+	aql_adt_t adt;
+
+	res = aql_get_parse_result(format, &adt);
+	if (DB_ERROR(res)) {
+		DB_LOG_E("DB : Parsing Error in db_create : %d\n", res);
+		return DB_PARSING_ERROR;
+	}
+
+	return aql_exec(&adt);
+}
+
+db_result_t db_bulk_insert(char **queries, int count)
+{
+	db_result_t res;
 	aql_adt_t adt;
+	relation_t *rel = NULL;
+	attribute_value_t *values;
+	char name[RELATION_NAME_LENGTH + 1];
+	int rows;
+	int i;
+	int j;
+
+	if (queries == NULL || count <= 0) {
+		return DB_ARGUMENT_ERROR;
+	}
+
+	values = NULL;
+	rows = 0;
+	res = DB_OK;
+	for (i = 0; i < count && DB_SUCCESS(res); i++) {
+		res = aql_get_parse_result(queries[i], &adt);
+		if (DB_ERROR(res)) {
+			DB_LOG_E("DB : Parsing Error in db_bulk_insert : %d\n", res);
+			break;
+		}
+		if (AQL_GET_EXEC_TYPE(AQL_GET_TYPE(&adt)) != AQL_TYPE_INSERT) {
+			DB_LOG_E("DB : query %d is not an insert\n", i);
+			res = DB_ARGUMENT_ERROR;
+			break;
+		}
+
+		/* The relation and its indexes are loaded once for all the tuples */
+		if (rel == NULL) {
+			rel = aql_get_relation(&adt);
+			if (rel == NULL) {
+				DB_LOG_E("DB : get relation Failed\n");
+				res = DB_RELATIONAL_ERROR;
+				break;
+			}
+			if (relation_cardinality(rel) + count > DB_TUPLE_LIMIT) {
+				res = DB_LIMIT_ERROR;
+				break;
+			}
+			strncpy(name, rel->name, sizeof(name));
+			values = (attribute_value_t *)malloc(sizeof(attribute_value_t) * rel->attribute_count * DB_BULK_INSERT_ROWS);
+			if (values == NULL) {
+				res = DB_ALLOCATION_ERROR;
+				break;
+			}
+		} else if (strncmp(adt.relations[0], name, sizeof(name)) != 0) {
+			DB_LOG_E("DB : query %d inserts into %s, not %s\n", i, adt.relations[0], name);
+			res = DB_ARGUMENT_ERROR;
+			break;
+		}
+		if (adt.value_count != rel->attribute_count) {
+			res = DB_RELATIONAL_ERROR;
+			break;
+		}
+
+		memcpy(&values[rows * rel->attribute_count], adt.values, sizeof(attribute_value_t) * rel->attribute_count);
+		rows++;
+		if (rows == DB_BULK_INSERT_ROWS || i == count - 1) {
+			res = relation_insert_bulk(rel, values, rows);
+			for (j = 0; j < rows * rel->attribute_count; j++) {
+				if (values[j].domain == DOMAIN_STRING) {
+					free(VALUE_STRING(&values[j]));
+				}
+			}
+			rows = 0;
+		}
+	}
+
+	/* Strings of the tuples not inserted because of an error */
+	if (values != NULL) {
+		for (j = 0; j < rows * rel->attribute_count; j++) {
+			if (values[j].domain == DOMAIN_STRING) {
+				free(VALUE_STRING(&values[j]));
+			}
+		}
+		free(values);
+	}
+	if (rel != NULL) {
+		relation_release(rel);
+	}
+	return res;
+}
+
+/*
+ * Run a parsed query. The result is put in reuse if given, else in a new
+ * cursor.
+ */
+static db_cursor_t *aql_query(aql_adt_t *adt, db_cursor_t *reuse)
+{
 	relation_t *rel;
 	uint32_t optype;
 	db_handle_t *handler;
@@ -248,11 +345,7 @@ db_cursor_t *db_query(char *format)
 	handler = NULL;
 	cursor = NULL;
 
-	if (DB_ERROR(aql_get_parse_result(format, &adt))) {
-		DB_LOG_E("DB : Parsing Error in db_create\n");
-		return NULL;
-	}
-	optype = AQL_GET_OP_TYPE(AQL_GET_TYPE(&adt));
+	optype = AQL_GET_OP_TYPE(AQL_GET_TYPE(adt));
 	if (optype != AQL_OP_TYPE_QUERY) {
 		DB_LOG_E("DB : AQL OP TYPE Error \n");
 		return NULL;
@@ -263,19 +356,19 @@ db_cursor_t *db_query(char *format)
 	}
 #endif
 
-	rel = aql_get_relation(&adt);
+	rel = aql_get_relation(adt);
 	if (rel == NULL) {
 		return NULL;
 	}
 
-	optype = AQL_GET_EXEC_TYPE(AQL_GET_TYPE(&adt));
+	optype = AQL_GET_EXEC_TYPE(AQL_GET_TYPE(adt));
 	switch (optype) {
 	case AQL_TYPE_REMOVE_TUPLES:
 		/* Overwrite the attribute array with a full copy of the original
 		   relation's attributes. */
-		adt.attribute_count = 0;
+		adt->attribute_count = 0;
 		for (attr_ptr = list_head(rel->attributes); attr_ptr != NULL; attr_ptr = attr_ptr->next) {
-			AQL_ADD_ATTRIBUTE(&adt, attr_ptr->name, DOMAIN_UNSPECIFIED, 0);
+			AQL_ADD_ATTRIBUTE(adt, attr_ptr->name, DOMAIN_UNSPECIFIED, 0);
 		}
 	/* FALLTHROUGH */
 	case AQL_TYPE_SELECT:
@@ -283,11 +376,15 @@ db_cursor_t *db_query(char *format)
 			DB_LOG_E("DB: Init handle failed\n");
 			goto errout;
 		}
-		if (DB_ERROR(relation_select(&handler, rel, &adt))) {
+		if (DB_ERROR(relation_select(&handler, rel, adt))) {
 			DB_LOG_E("DB: Failed relation_select\n");
 			goto errout;
 		}
-		cursor = relation_process_result(handler);
+		if (reuse != NULL) {
+			cursor = DB_SUCCESS(relation_process_cursor(handler, reuse)) ? reuse : NULL;
+		} else {
+			cursor = relation_process_result(handler);
+		}
 		if (cursor == NULL) {
 			DB_LOG_E("DB: Failed to process cursor tuples\n");
 			goto errout;
@@ -317,3 +414,215 @@ errout:
 
 	return NULL;
 }
+
+db_cursor_t *db_query(char *format)
+{
+	aql_adt_t adt;
+
+	if (DB_ERROR(aql_get_parse_result(format, &adt))) {
+		DB_LOG_E("DB : Parsing Error in db_create\n");
+		return NULL;
+	}
+
+	return aql_query(&adt, NULL);
+}
+
+db_cursor_t *db_query_stream(char *format)
+{
+	aql_adt_t adt;
+	relation_t *rel;
+	db_handle_t *handler;
+	db_cursor_t *cursor;
+
+	if (DB_ERROR(aql_get_parse_result(format, &adt))) {
+		DB_LOG_E("DB : Parsing Error in db_query_stream\n");
+		return NULL;
+	}
+
+	/* Aggregates and assignments need all the rows before the first one */
+	if (AQL_GET_EXEC_TYPE(AQL_GET_TYPE(&adt)) != AQL_TYPE_SELECT || (AQL_GET_FLAGS(&adt) & (AQL_FLAG_AGGREGATE | AQL_FLAG_ASSIGN))) {
+		DB_LOG_E("DB : Only plain selections are streamed\n");
+		free(adt.lvm_instance);
+		return NULL;
+	}
+#ifdef CONFIG_ARASTORAGE_ENABLE_WRITE_BUFFER
+	if (DB_SUCCESS(storage_flush_insert_buffer())) {
+		DB_LOG_D("DB : flush insert buffer!!\n");
+	}
+#endif
+
+	rel = aql_get_relation(&adt);
+	if (rel == NULL) {
+		free(adt.lvm_instance);
+		return NULL;
+	}
+
+	cursor = (db_cursor_t *)malloc(sizeof(db_cursor_t));
+	if (cursor == NULL) {
+		DB_LOG_E("DB: Failed to allocate cursor\n");
+		relation_release(rel);
+		free(adt.lvm_instance);
+		return NULL;
+	}
+	memset(cursor, 0, sizeof(db_cursor_t));
+
+	if (DB_ERROR(aql_init_handle(&handler))) {
+		DB_LOG_E("DB: Init handle failed\n");
+		goto errout;
+	}
+	if (DB_ERROR(relation_select(&handler, rel, &adt))) {
+		DB_LOG_E("DB: Failed relation_select\n");
+		goto errout;
+	}
+
+	/* The cursor keeps the handle, and the relation in it, until freed */
+	if (DB_ERROR(cursor_init_stream(cursor, handler))) {
+		DB_LOG_E("DB: Failed to init streaming cursor\n");
+		goto errout;
+	}
+	return cursor;
+
+errout:
+	if (handler == NULL || handler->rel == NULL) {
+		relation_release(rel);
+		free(adt.lvm_instance);
+	}
+	aql_deinit_handle(&handler);
+	free(cursor);
+	return NULL;
+}
+
+db_stmt_t *db_prepare(char *format)
+{
+	db_stmt_t *stmt;
+
+	stmt = (db_stmt_t *)malloc(sizeof(db_stmt_t));
+	if (stmt == NULL) {
+		return NULL;
+	}
+	memset(stmt, 0, sizeof(db_stmt_t));
+
+	if (DB_ERROR(aql_get_parse_result(format, &stmt->adt))) {
+		DB_LOG_E("DB : Parsing Error in db_prepare\n");
+		free(stmt);
+		return NULL;
+	}
+	return stmt;
+}
+
+static db_result_t aql_bind(db_stmt_t *stmt, int index, domain_t domain, long value, char *string)
+{
+	attribute_value_t *param;
+	size_t length;
+
+	if (stmt == NULL || index < 1 || index > stmt->adt.parameter_count) {
+		return DB_ARGUMENT_ERROR;
+	}
+	index--;
+
+	/* Parameters of a condition are constants of its LVM code */
+	if (AQL_GET_EXEC_TYPE(AQL_GET_TYPE(&stmt->adt)) != AQL_TYPE_INSERT) {
+		if (domain != DOMAIN_INT || stmt->adt.lvm_instance == NULL) {
+			return DB_TYPE_ERROR;
+		}
+		lvm_set_parameter_value((lvm_instance_t *)stmt->adt.lvm_instance, index, value);
+		return DB_OK;
+	}
+
+	param = &stmt->adt.values[stmt->adt.parameters[index]];
+	if (param->domain == DOMAIN_STRING) {
+		free(VALUE_STRING(param));
+		param->domain = DOMAIN_UNSPECIFIED;
+	}
+	if (domain == DOMAIN_STRING) {
+		length = strlen(string);
+		VALUE_STRING(param) = (unsigned char *)malloc(length + 1);
+		if (VALUE_STRING(param) == NULL) {
+			return DB_ALLOCATION_ERROR;
+		}
+		memcpy(VALUE_STRING(param), string, length + 1);
+	} else {
+		VALUE_LONG(param) = value;
+	}
+	param->domain = domain;
+	return DB_OK;
+}
+
+db_result_t db_bind_long(db_stmt_t *stmt, int index, long value)
+{
+	return aql_bind(stmt, index, DOMAIN_INT, value, NULL);
+}
+
+db_result_t db_bind_string(db_stmt_t *stmt, int index, char *value)
+{
+	if (value == NULL) {
+		return DB_ARGUMENT_ERROR;
+	}
+	return aql_bind(stmt, index, DOMAIN_STRING, 0, value);
+}
+
+db_result_t db_stmt_exec(db_stmt_t *stmt)
+{
+	if (stmt == NULL) {
+		return DB_ARGUMENT_ERROR;
+	}
+	return aql_exec(&stmt->adt);
+}
+
+db_cursor_t *db_stmt_query(db_stmt_t *stmt)
+{
+	aql_adt_t adt;
+	lvm_instance_t *lvm;
+	db_cursor_t *cursor;
+
+	if (stmt == NULL) {
+		return NULL;
+	}
+
+	/* A run frees the condition it was given, so it gets a copy */
+	memcpy(&adt, &stmt->adt, sizeof(aql_adt_t));
+	if (stmt->adt.lvm_instance != NULL) {
+		lvm = (lvm_instance_t *)malloc(sizeof(lvm_instance_t));
+		if (lvm == NULL) {
+			return NULL;
+		}
+		memcpy(lvm, stmt->adt.lvm_instance, sizeof(lvm_instance_t));
+		adt.lvm_instance = lvm;
+	}
+
+	if (stmt->cursor == NULL) {
+		stmt->cursor = (db_cursor_t *)malloc(sizeof(db_cursor_t));
+		if (stmt->cursor == NULL) {
+			free(adt.lvm_instance);
+			return NULL;
+		}
+	} else if (stmt->cursor->row_arr != NULL) {
+		free(stmt->cursor->row_arr);
+	}
+	memset(stmt->cursor, 0, sizeof(db_cursor_t));
+
+	cursor = aql_query(&adt, stmt->cursor);
+	return cursor;
+}
+
+db_result_t db_finalize(db_stmt_t *stmt)
+{
+	int i;
+
+	if (stmt == NULL) {
+		return DB_ARGUMENT_ERROR;
+	}
+	for (i = 0; i < stmt->adt.value_count; i++) {
+		if (stmt->adt.values[i].domain == DOMAIN_STRING) {
+			free(VALUE_STRING(&stmt->adt.values[i]));
+		}
+	}
+	if (stmt->adt.lvm_instance != NULL) {
+		free(stmt->adt.lvm_instance);
+	}
+	if (stmt->cursor != NULL) {
+		cursor_deinit(stmt->cursor);
+	}
+	free(stmt);
+	return DB_OK;
+}
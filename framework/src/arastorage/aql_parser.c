@@ -261,6 +261,11 @@ PARSER(values)
 	case INTEGER_VALUE:
 		AQL_ADD_VALUE(adt, DOMAIN_INT, VALUE);
 		break;
+	case PARAMETER:
+		if (DB_ERROR(AQL_ADD_PARAMETER(adt))) {
+			RETURN(SYNTAX_ERROR);
+		}
+		break;
 	default:
 		RETURN(SYNTAX_ERROR);
 	}
@@ -298,6 +303,12 @@ PARSER(operand)
 			RETURN(SYNTAX_ERROR);
 		}
 		break;
+	case PARAMETER:
+		if (adt->parameter_count == LVM_MAX_PARAMETER_ID || LVM_ERROR(lvm_set_parameter(p, adt->parameter_count))) {
+			RETURN(SYNTAX_ERROR);
+		}
+		adt->parameter_count++;
+		break;
 	default:
 		RETURN(SYNTAX_ERROR);
 	}
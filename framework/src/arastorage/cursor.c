@@ -28,6 +28,38 @@
 #include "db_debug.h"
 #include "storage.h"
 #include "relation.h"
+#include "aql.h"
+
+/****************************************************************************
+* Private Functions
+****************************************************************************/
+
+/* Evaluate the query of a streaming cursor up to its next row. */
+static db_result_t cursor_stream_next(db_cursor_t *cursor)
+{
+	db_result_t res;
+
+	if (!db_processing_status(cursor->stream)) {
+		return DB_CURSOR_ERROR;
+	}
+
+	do {
+		res = relation_process_select(&cursor->stream, cursor);
+	} while (res == DB_OK);
+
+	if (res != DB_GOT_ROW) {
+		if (DB_ERROR(res)) {
+			DB_LOG_E("DB: Failed to process tuples : %d\n", res);
+		}
+		/* The rows are read once, the end is not moved past again */
+		cursor->stream->flags &= ~DB_HANDLE_FLAG_PROCESSING;
+		return DB_CURSOR_ERROR;
+	}
+
+	cursor->current_cursor_row++;
+	cursor->cursor_rows = cursor->current_cursor_row + 1;
+	return DB_OK;
+}
 
 /****************************************************************************
 * Public Functions
@@ -36,6 +68,15 @@
 /* Update current cursor id and storage id. */
 db_result_t cursor_move_to(db_cursor_t *cursor, tuple_id_t row_id)
 {
+	if (cursor != NULL && cursor->stream != NULL) {
+		/* Rows of a streaming cursor are not kept, it only moves forward */
+		if (row_id != cursor->current_cursor_row + 1) {
+			DB_LOG_E("streaming cursor moves to the next row only\n");
+			return DB_CURSOR_ERROR;
+		}
+		return cursor_stream_next(cursor);
+	}
+
 	if (IS_EMPTY_CURSOR(cursor)) {
 		DB_LOG_E("Empty Cursor\n");
 		return DB_CURSOR_ERROR;
@@ -90,6 +131,10 @@ db_result_t cursor_move_next(db_cursor_t *cursor)
 		return DB_CURSOR_ERROR;
 	}
 
+	if (cursor->stream != NULL) {
+		return cursor_stream_next(cursor);
+	}
+
 	return cursor_move_to(cursor, cursor->current_cursor_row + 1);
 }
 
@@ -124,6 +169,9 @@ bool cursor_is_first_row(db_cursor_t *cursor)
 	if (cursor->current_cursor_row != 0) {
 		return false;
 	}
+	if (cursor->stream != NULL) {
+		return true;
+	}
 	//check whether pointing storage row id is true
 	for (i = 0; i < cursor->total_rows; i++) {
 		index = GET_INDEX(i);
@@ -149,6 +197,10 @@ bool cursor_is_last_row(db_cursor_t *cursor)
 	if (cursor->current_cursor_row != cursor->cursor_rows - 1) {
 		return false;
 	}
+	//a streaming cursor knows its last row once it failed to move past it
+	if (cursor->stream != NULL) {
+		return !db_processing_status(cursor->stream);
+	}
 	//check whether pointing storage row id is true
 	int i, index, pos;
 
@@ -441,11 +493,42 @@ db_result_t cursor_init(db_cursor_t **cursor, relation_t *rel)
 	return DB_OK;
 }
 
+/*
+ * Set up a cursor which evaluates the query of handle a row at a time as it
+ * moves, instead of holding a bitmap of all the rows of the relation. It
+ * takes the handle, which is released with the cursor.
+ */
+db_result_t cursor_init_stream(db_cursor_t *cursor, db_handle_t *handle)
+{
+	relation_t *rel;
+
+	if (cursor == NULL || handle == NULL) {
+		return DB_CURSOR_ERROR;
+	}
+
+	cursor_clean_data(cursor);
+
+	rel = handle->rel;
+	if (DB_ERROR(cursor_data_set(cursor, handle->attr_map, handle->result_rel->attribute_count))) {
+		return DB_CURSOR_ERROR;
+	}
+	cursor->total_rows = relation_cardinality(rel);
+	cursor->storage_row_length = rel->row_length;
+	memcpy(cursor->name, rel->tuple_filename, sizeof(rel->tuple_filename));
+	memcpy(cursor->rel_name, rel->name, sizeof(rel->name));
+	cursor->stream = handle;
+
+	return DB_OK;
+}
+
 db_result_t cursor_deinit(db_cursor_t *cursor)
 {
 	if (cursor == NULL) {
 		return DB_CURSOR_ERROR;
 	}
+	if (cursor->stream != NULL) {
+		aql_deinit_handle(&cursor->stream);
+	}
 	if (cursor->row_arr) {
 		free(cursor->row_arr);
 		cursor->row_arr = NULL;
@@ -216,6 +216,15 @@
 #define DB_INDEX_COST                   64
 #endif							/* DB_INDEX_COST */
 
+/* The number of tuples of db_bulk_insert stored in one write. */
+#ifndef DB_BULK_INSERT_ROWS
+#ifdef CONFIG_ARASTORAGE_BULK_INSERT_ROWS
+#define DB_BULK_INSERT_ROWS             CONFIG_ARASTORAGE_BULK_INSERT_ROWS
+#else
+#define DB_BULK_INSERT_ROWS             64
+#endif
+#endif							/* DB_BULK_INSERT_ROWS */
+
 /* The maximum number of Maxheap indexes. */
 #ifndef DB_HEAP_INDEX_LIMIT
 #define DB_HEAP_INDEX_LIMIT             1
@@ -223,12 +232,21 @@
 
 /* The maximum number of buckets cached in the MaxHeap index. */
 #ifndef DB_HEAP_CACHE_LIMIT
+#ifdef CONFIG_ARASTORAGE_BUCKET_CACHE_SIZE
+#define DB_HEAP_CACHE_LIMIT             CONFIG_ARASTORAGE_BUCKET_CACHE_SIZE
+#else
 #define DB_HEAP_CACHE_LIMIT             6
+#endif
 #endif							/* DB_HEAP_CACHE_LIMIT */
 
+/* The maximum number of nodes cached in the Bplustree index. */
 #ifndef DB_TREE_CACHE_LIMIT
+#ifdef CONFIG_ARASTORAGE_NODE_CACHE_SIZE
+#define DB_TREE_CACHE_LIMIT             CONFIG_ARASTORAGE_NODE_CACHE_SIZE
+#else
 #define DB_TREE_CACHE_LIMIT             10
 #endif
+#endif
 
 #ifdef DB_WIP
 #undef DB_WIP						/* DB WORK IN PROGRESS */
@@ -249,6 +267,11 @@
 #define LVM_MAX_VARIABLE_ID             AQL_ATTRIBUTE_LIMIT - 1
 #endif							/* LVM_MAX_VARIABLE_ID */
 
+/* The maximum number of '?' parameters of a prepared query. */
+#ifndef LVM_MAX_PARAMETER_ID
+#define LVM_MAX_PARAMETER_ID            AQL_ATTRIBUTE_LIMIT
+#endif							/* LVM_MAX_PARAMETER_ID */
+
 /* Specify whether floats should be used or not inside the LVM. */
 #ifndef LVM_USE_FLOATS
 #define LVM_USE_FLOATS                  DB_FEATURE_FLOATS
@@ -172,18 +172,34 @@ struct tree_cache_s {
 	tree_node_t node;
 };
 
-/* Bucket Cache Structure */
+/* Cache Statistics, logged when the index is released */
+struct cache_stats_s {
+	uint32_t hits;				/*  Reads served from the cache  */
+	uint32_t misses;			/*  Reads which went to flash  */
+	uint32_t writebacks;		/*  Dirty entries written to flash  */
+};
+
+/* Bucket Cache Structure
+ * entries[pos] keeps the LRU state of cache_t[pos], the entries being
+ * linked in in_cache from the least to the most recently used one.
+ */
 typedef struct {
 	struct bucket_cache_s cache_t[DB_HEAP_CACHE_LIMIT];
+	qnode_t entries[DB_HEAP_CACHE_LIMIT];
+	qnode_t ends[2];
 	queue_t in_cache;
 	uint8_t num;
+	struct cache_stats_s stats;
 } bucket_cache_t;
 
 /* Tree Cache Structure */
 typedef struct {
 	struct tree_cache_s cache_t[DB_TREE_CACHE_LIMIT];
+	qnode_t entries[DB_TREE_CACHE_LIMIT];
+	qnode_t ends[2];
 	queue_t in_cache;
 	uint8_t num;
+	struct cache_stats_s stats;
 } tree_cache_t;
 
 typedef enum {
@@ -258,6 +274,7 @@ static int base_offset = 0;
  * Private Function Prototypes
  ****************************************************************************/
 static int transform_key(int);
+static tree_node_t *tree_fetch(tree_t *, int, bool);
 static tree_node_t *tree_read(tree_t *, int);
 static int tree_write(tree_t *, int, tree_node_t *);
 static tree_result_t tree_insert(tree_t *, int);
@@ -270,6 +287,15 @@ static bsplit_status_t bucket_split(tree_t *, int, int, pair_t *);
 static cache_result_t cache_bucket_append(tree_t *, int, pair_t *);
 static cache_result_t cache_write_bucket(tree_t *, int, bucket_t *);
 
+static void cache_init(tree_t *, cache_type_t);
+static qnode_t *cache_get_slot(tree_t *, cache_type_t);
+static void cache_write_back(tree_t *, cache_type_t, qnode_t *);
+static void cache_flush(tree_t *, cache_type_t);
+#if (DEBUG & DEBUG_VERBOSE) || (DEBUG & DEBUG_ENABLE)
+static void cache_print_stats(tree_t *);
+#else
+#define cache_print_stats(tree)
+#endif
 static cache_result_t modify_cache(tree_t *, int, cache_type_t, op_type_t);
 static cache_result_t cache_write_node(tree_t *, int, tree_node_t *);
 static cache_result_t cache_replace_node(tree_t *, int, tree_node_t *);
@@ -350,7 +376,6 @@ static db_result_t create(index_t *index)
 	size_t buck_size = 0;
 	int offset = 0;
 	db_result_t result;
-	uint8_t success = 0;
 	int curtime;
 
 	curtime = time(NULL);
@@ -439,77 +464,26 @@ static db_result_t create(index_t *index)
 
 	/* Allocating node cache and initialising it */
 	tree->node_cache = bptree_malloc(sizeof(tree_cache_t));
-	if (tree->node_cache != NULL) {
-		success |= 1;
-		qnode_t *head = (qnode_t *)bptree_malloc(sizeof(qnode_t));
-		if (head != NULL) {
-			success |= 2;
-			tree->node_cache->in_cache.head = head;
-			qnode_t *end = (qnode_t *)bptree_malloc(sizeof(qnode_t));
-			if (end != NULL) {
-				success |= 4;
-				head->prev = NULL;
-				end->next = NULL;
-				head->next = end;
-				end->prev = head;
-				tree->node_cache->in_cache.tail = end;
-				tree->node_cache->num = 0;
-			}
-		}
-	}
-	if (success != 7) {
+	if (tree->node_cache == NULL) {
 		DB_LOG_E("FAILED TO ALLOCATE NODE CACHE\n");
-		result = DB_ALLOCATION_ERROR;
 		storage_remove(tree_filename);
 		storage_remove(bucket_filename);
-		if (success & 1) {
-			if (success & 2) {
-				free(tree->node_cache->in_cache.head);
-			}
-			free(tree->node_cache);
-		}
 		free(tree);
-		return result;
+		return DB_ALLOCATION_ERROR;
 	}
+	cache_init(tree, NODE);
 
 	/* Allocating bucket cache and initialising it */
 	tree->buck_cache = bptree_malloc(sizeof(bucket_cache_t));
-	success = 0;
-	if (tree->buck_cache != NULL) {
-		success |= 1;
-		qnode_t *head = (qnode_t *)bptree_malloc(sizeof(qnode_t));
-		if (head != NULL) {
-			success |= 2;
-			tree->buck_cache->in_cache.head = head;
-			qnode_t *end = (qnode_t *)bptree_malloc(sizeof(qnode_t));
-			if (end != NULL) {
-				success |= 4;
-				head->prev = NULL;
-				end->next = NULL;
-				head->next = end;
-				end->prev = head;
-				tree->buck_cache->in_cache.tail = end;
-				tree->buck_cache->num = 0;
-			}
-		}
-	}
-	if (success != 7) {
+	if (tree->buck_cache == NULL) {
 		DB_LOG_E("FAILED TO ALLOCATE BUCKET CACHE\n");
-		result = DB_ALLOCATION_ERROR;
-		free(tree->node_cache->in_cache.tail);
-		free(tree->node_cache->in_cache.head);
 		free(tree->node_cache);
 		storage_remove(tree_filename);
 		storage_remove(bucket_filename);
-		if (success & 1) {
-			if (success & 2) {
-				free(tree->buck_cache->in_cache.head);
-			}
-			free(tree->buck_cache);
-		}
 		free(tree);
-		return result;
+		return DB_ALLOCATION_ERROR;
 	}
+	cache_init(tree, BUCKET);
 
 	tree->inserted = 0;
 	tree->deleted = 0;
@@ -562,8 +536,6 @@ static db_result_t load(index_t *index)
 	tree_t *tree;
 	db_storage_id_t fd;
 	char bucket_file[DB_MAX_FILENAME_LENGTH];
-	db_result_t result;
-	uint8_t success = 0;
 
 	index->opaque_data = tree = bptree_malloc(sizeof(tree_t));
 	if (tree == NULL) {
@@ -593,73 +565,22 @@ static db_result_t load(index_t *index)
 	storage_close(fd);
 
 	tree->node_cache = bptree_malloc(sizeof(tree_cache_t));
-	if (tree->node_cache != NULL) {
-		success |= 1;
-		qnode_t *head = (qnode_t *)bptree_malloc(sizeof(qnode_t));
-		if (head != NULL) {
-			success |= 2;
-			tree->node_cache->in_cache.head = head;
-			qnode_t *end = (qnode_t *)bptree_malloc(sizeof(qnode_t));
-			if (end != NULL) {
-				success |= 4;
-				head->prev = NULL;
-				end->next = NULL;
-				head->next = end;
-				end->prev = head;
-				tree->node_cache->in_cache.tail = end;
-				tree->node_cache->num = 0;
-			}
-		}
-	}
-	if (success != 7) {
+	if (tree->node_cache == NULL) {
 		DB_LOG_E("FAILED TO ALLOCATE NODE CACHE\n");
-		result = DB_ALLOCATION_ERROR;
-		if (success & 1) {
-			if (success & 2) {
-				free(tree->node_cache->in_cache.head);
-			}
-			free(tree->node_cache);
-		}
 		free(tree);
-		return result;
+		return DB_ALLOCATION_ERROR;
 	}
+	cache_init(tree, NODE);
 
 	/* Allocating bucket cache and initialising it  */
 	tree->buck_cache = bptree_malloc(sizeof(bucket_cache_t));
-	success = 0;
-	if (tree->buck_cache != NULL) {
-		success |= 1;
-		qnode_t *head = (qnode_t *)bptree_malloc(sizeof(qnode_t));
-		if (head != NULL) {
-			success |= 2;
-			tree->buck_cache->in_cache.head = head;
-			qnode_t *end = (qnode_t *)bptree_malloc(sizeof(qnode_t));
-			if (end != NULL) {
-				success |= 4;
-				head->prev = NULL;
-				end->next = NULL;
-				head->next = end;
-				end->prev = head;
-				tree->buck_cache->in_cache.tail = end;
-				tree->buck_cache->num = 0;
-			}
-		}
-	}
-	if (success != 7) {
+	if (tree->buck_cache == NULL) {
 		DB_LOG_E("FAILED TO ALLOCATE BUCKET CACHE\n");
-		result = DB_ALLOCATION_ERROR;
-		free(tree->node_cache->in_cache.tail);
-		free(tree->node_cache->in_cache.head);
 		free(tree->node_cache);
-		if (success & 1) {
-			if (success & 2) {
-				free(tree->buck_cache->in_cache.head);
-			}
-			free(tree->buck_cache);
-		}
 		free(tree);
-		return result;
+		return DB_ALLOCATION_ERROR;
 	}
+	cache_init(tree, BUCKET);
 
 	base_offset = sizeof(tree_t) + sizeof(bucket_file);
 	tree->tree_storage = storage_open(index->descriptor_file, O_RDWR);
@@ -674,7 +595,6 @@ static db_result_t load(index_t *index)
 static db_result_t release(index_t *index)
 {
 	tree_t *tree;
-	qnode_t *tmp_node;
 
 	tree = index->opaque_data;
 	if (tree == NULL) {
@@ -683,38 +603,11 @@ static db_result_t release(index_t *index)
 	if (tree->node_cache == NULL || tree->buck_cache == NULL) {
 		return DB_ALLOCATION_ERROR;
 	}
-	if ((tree->node_cache->in_cache.tail == NULL) || (tree->node_cache->in_cache.head == NULL)) {
-		return DB_ALLOCATION_ERROR;
-	}
-	if ((tree->buck_cache->in_cache.tail == NULL) || (tree->buck_cache->in_cache.head == NULL)) {
-		return DB_ALLOCATION_ERROR;
-	}
 	storage_write_to(tree->tree_storage, tree, 0, sizeof(tree_t));
-	/* Bucket Cache being flushed */
-	tmp_node = tree->buck_cache->in_cache.head->next;
-	free(tmp_node->prev);
-	while (tmp_node != tree->buck_cache->in_cache.tail) {
-		if ((tmp_node->node_state & NODE_STATE_DIRTY) && (tmp_node->node_state & NODE_STATE_VALID)) {
-			bucket_write(tree, tmp_node->id, &(tree->buck_cache->cache_t[tmp_node->pos].bucket));
-		}
-		tmp_node = tmp_node->next;
-		if (tmp_node->prev) {
-			free(tmp_node->prev);
-		}
-	}
-	free(tree->buck_cache->in_cache.tail);
-	tmp_node = tree->node_cache->in_cache.head->next;
-	free(tmp_node->prev);
-	while (tmp_node != tree->node_cache->in_cache.tail) {
-		if ((tmp_node->node_state & NODE_STATE_DIRTY) && (tmp_node->node_state & NODE_STATE_VALID)) {
-			tree_write(tree, tmp_node->id, &(tree->node_cache->cache_t[tmp_node->pos].node));
-		}
-		tmp_node = tmp_node->next;
-		if (tmp_node->prev) {
-			free(tmp_node->prev);
-		}
-	}
-	free(tree->node_cache->in_cache.tail);
+	/* Bucket Cache and Node Cache being flushed */
+	cache_flush(tree, BUCKET);
+	cache_flush(tree, NODE);
+	cache_print_stats(tree);
 	storage_close(tree->bucket_storage);
 	storage_close(tree->tree_storage);
 
@@ -757,27 +650,11 @@ static db_result_t insert(index_t *index, attribute_value_t *key, tuple_id_t val
 	 *	and write back is preferred.
 	 ***************************************************************************************/
 #ifdef DB_WIP
-	qnode_t *tmp_node;
 	storage_write_to(tree->tree_storage, tree, 0, sizeof(tree_t));
 
 	/* Bucket Cache being flushed */
-
-	tmp_node = tree->buck_cache->in_cache.head->next;
-	while (tmp_node != tree->buck_cache->in_cache.tail) {
-		if ((tmp_node->node_state & NODE_STATE_DIRTY) && (tmp_node->node_state & NODE_STATE_VALID)) {
-			bucket_write(tree, tmp_node->id, &(tree->buck_cache->cache_t[tmp_node->pos].bucket));
-			UNSET_NODE_STATE(tmp_node, NODE_STATE_DIRTY);
-		}
-		tmp_node = tmp_node->next;
-	}
-	tmp_node = tree->node_cache->in_cache.head->next;
-	while (tmp_node != tree->node_cache->in_cache.tail) {
-		if ((tmp_node->node_state & NODE_STATE_DIRTY) && (tmp_node->node_state & NODE_STATE_VALID)) {
-			tree_write(tree, tmp_node->id, &(tree->node_cache->cache_t[tmp_node->pos].node));
-			UNSET_NODE_STATE(tmp_node, NODE_STATE_DIRTY);
-		}
-		tmp_node = tmp_node->next;
-	}
+	cache_flush(tree, BUCKET);
+	cache_flush(tree, NODE);
 #endif
 	return DB_OK;
 }
@@ -1041,6 +918,165 @@ static db_result_t vacuum(tree_t *tree, relation_t *rel)
 }
 #endif
 
+/****************************************************************************
+ * Name: cache_init
+ *
+ * Description: Links the sentinels of an empty cache. The cache itself is
+ *              allocated zeroed, with no entry in use and no statistics
+ *
+ ****************************************************************************/
+static void cache_init(tree_t *tree, cache_type_t cache)
+{
+	qnode_t *ends;
+	queue_t *queue;
+
+	if (cache == NODE) {
+		ends = tree->node_cache->ends;
+		queue = &(tree->node_cache->in_cache);
+	} else {
+		ends = tree->buck_cache->ends;
+		queue = &(tree->buck_cache->in_cache);
+	}
+	ends[0].prev = NULL;
+	ends[0].next = &ends[1];
+	ends[1].prev = &ends[0];
+	ends[1].next = NULL;
+	queue->head = &ends[0];
+	queue->tail = &ends[1];
+}
+
+/****************************************************************************
+ * Name: cache_get_slot
+ *
+ * Description: Returns an entry of the cache for a new node or bucket.
+ *              Entries never used are handed out first, then the least
+ *              recently used entry which is not locked is written back if
+ *              dirty and taken out of the LRU queue. The caller holds the
+ *              cache lock and places the entry in the queue.
+ *
+ ****************************************************************************/
+static qnode_t *cache_get_slot(tree_t *tree, cache_type_t cache)
+{
+	qnode_t *slot;
+	queue_t *queue;
+
+	if (cache == NODE) {
+		if (tree->node_cache->num < DB_TREE_CACHE_LIMIT) {
+			slot = &(tree->node_cache->entries[tree->node_cache->num]);
+			slot->pos = tree->node_cache->num++;
+			return slot;
+		}
+		queue = &(tree->node_cache->in_cache);
+	} else {
+		if (tree->buck_cache->num < DB_HEAP_CACHE_LIMIT) {
+			slot = &(tree->buck_cache->entries[tree->buck_cache->num]);
+			slot->pos = tree->buck_cache->num++;
+			return slot;
+		}
+		queue = &(tree->buck_cache->in_cache);
+	}
+
+	slot = queue->head->next;
+	while ((slot->node_state & NODE_STATE_LOCK) && slot != queue->tail) {
+		slot = slot->next;
+	}
+	if (slot == queue->tail) {
+		return NULL;
+	}
+	if ((slot->node_state & NODE_STATE_DIRTY) && (slot->node_state & NODE_STATE_VALID)) {
+		cache_write_back(tree, cache, slot);
+	}
+	REMOVE_ENTRY(slot);
+	return slot;
+}
+
+/****************************************************************************
+ * Name: cache_write_back
+ *
+ * Description: Writes a dirty cache entry to flash and marks it clean
+ *
+ ****************************************************************************/
+static void cache_write_back(tree_t *tree, cache_type_t cache, qnode_t *entry)
+{
+	if (cache == NODE) {
+		tree_write(tree, entry->id, &(tree->node_cache->cache_t[entry->pos].node));
+		tree->node_cache->stats.writebacks++;
+	} else {
+		bucket_write(tree, entry->id, &(tree->buck_cache->cache_t[entry->pos].bucket));
+		tree->buck_cache->stats.writebacks++;
+	}
+	UNSET_NODE_STATE(entry, NODE_STATE_DIRTY);
+}
+
+/****************************************************************************
+ * Name: cache_flush
+ *
+ * Description: Writes back all the dirty entries of a cache in one batch,
+ *              in increasing order of id so that the writes go through the
+ *              storage file from its start to its end. The entries stay
+ *              cached, clean.
+ *
+ ****************************************************************************/
+static void cache_flush(tree_t *tree, cache_type_t cache)
+{
+	pthread_mutex_t *lock;
+	qnode_t *entries;
+	qnode_t *next;
+	uint8_t num;
+	int last = -1;
+	int i;
+
+	if (cache == NODE) {
+		lock = &(tree->node_cache_lock);
+		entries = tree->node_cache->entries;
+		num = tree->node_cache->num;
+	} else {
+		lock = &(tree->buck_cache_lock);
+		entries = tree->buck_cache->entries;
+		num = tree->buck_cache->num;
+	}
+
+	pthread_mutex_lock(lock);
+	while (true) {
+		next = NULL;
+		for (i = 0; i < num; i++) {
+			if ((entries[i].node_state & NODE_STATE_DIRTY) && (entries[i].node_state & NODE_STATE_VALID) && entries[i].id > last && (next == NULL || entries[i].id < next->id)) {
+				next = &entries[i];
+			}
+		}
+		if (next == NULL) {
+			break;
+		}
+		cache_write_back(tree, cache, next);
+		last = next->id;
+	}
+	pthread_mutex_unlock(lock);
+}
+
+#if (DEBUG & DEBUG_VERBOSE) || (DEBUG & DEBUG_ENABLE)
+/****************************************************************************
+ * Name: cache_print_stats
+ *
+ * Description: Logs the hit rate of the node and bucket caches, to size
+ *              them with CONFIG_ARASTORAGE_NODE_CACHE_SIZE and
+ *              CONFIG_ARASTORAGE_BUCKET_CACHE_SIZE
+ *
+ ****************************************************************************/
+static void cache_print_stats(tree_t *tree)
+{
+	struct cache_stats_s *stats;
+	uint32_t reads;
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		stats = (i == 0) ? &(tree->node_cache->stats) : &(tree->buck_cache->stats);
+		reads = stats->hits + stats->misses;
+		DB_LOG_D("DB: %s cache hits %u, misses %u (hit rate %u%%), writebacks %u\n", (i == 0) ? "Node" : "Bucket",
+			(unsigned)stats->hits, (unsigned)stats->misses, reads ? (unsigned)((unsigned long long)stats->hits * 100 / reads) : 0, (unsigned)stats->writebacks);
+	}
+}
+#endif
+
 /****************************************************************************
  * Name: modify_cache
  *
@@ -1106,36 +1142,11 @@ static cache_result_t cache_write_node(tree_t *tree, int id, tree_node_t *node)
 {
 	pthread_mutex_lock(&(tree->node_cache_lock));
 
-	qnode_t *new_node = (qnode_t *)bptree_malloc(sizeof(qnode_t));
+	qnode_t *new_node = cache_get_slot(tree, NODE);
 	if (new_node == NULL) {
-		DB_LOG_E("Failed allocation of node\n");
+		DB_LOG_E("NO SLOT AVAIABLE IN CACHE\n");
 		pthread_mutex_unlock(&(tree->node_cache_lock));
-		return CACHE_ALLOCATION_ERROR;
-	}
-
-	if (tree->node_cache->num < DB_TREE_CACHE_LIMIT) {
-		new_node->pos = tree->node_cache->num++;
-	} else {
-		qnode_t *iter_node;
-		iter_node = tree->node_cache->in_cache.head->next;
-		while ((iter_node->node_state & NODE_STATE_LOCK) && iter_node != tree->node_cache->in_cache.tail) {
-			iter_node = iter_node->next;
-		}
-		if (iter_node == tree->node_cache->in_cache.tail) {
-			free(new_node);
-			DB_LOG_E("NO SLOT AVAIABLE IN CACHE\n");
-			pthread_mutex_unlock(&(tree->node_cache_lock));
-			return CACHE_FULL;
-		}
-		if ((iter_node->node_state & NODE_STATE_DIRTY) && (iter_node->node_state & NODE_STATE_DIRTY)) {
-			tree_write(tree, iter_node->id, &(tree->node_cache->cache_t[iter_node->pos].node));
-		}
-		new_node->pos = iter_node->pos;
-		/* iter_node is the node which has to be evicted from cache.
-		 * It is removed the queue maintaining the LRU status.
-		 */
-		REMOVE_ENTRY(iter_node);
-		free(iter_node);
+		return CACHE_FULL;
 	}
 
 	PLACE_AT_TAIL(new_node, tree->node_cache);
@@ -1194,33 +1205,11 @@ static cache_result_t cache_write_bucket(tree_t *tree, int id, bucket_t *bucket)
 {
 	pthread_mutex_lock(&(tree->buck_cache_lock));
 
-	qnode_t *new_node = (qnode_t *)bptree_malloc(sizeof(qnode_t));
+	qnode_t *new_node = cache_get_slot(tree, BUCKET);
 	if (new_node == NULL) {
+		DB_LOG_E("NO SLOT AVAILABLE IN CACHE bucket\n");
 		pthread_mutex_unlock(&(tree->buck_cache_lock));
-		return CACHE_ALLOCATION_ERROR;
-	}
-
-	if (tree->buck_cache->num < DB_HEAP_CACHE_LIMIT) {
-		new_node->pos = tree->buck_cache->num++;
-	} else {
-		qnode_t *iter_node;
-		iter_node = tree->buck_cache->in_cache.head->next;
-		while ((iter_node->node_state & NODE_STATE_LOCK) && (iter_node != tree->buck_cache->in_cache.tail)) {
-			iter_node = iter_node->next;
-		}
-		if (iter_node == tree->buck_cache->in_cache.tail) {
-			free(new_node);
-			DB_LOG_E("NO SLOT AVAILABLE IN CACHE bucket\n");
-			pthread_mutex_unlock(&(tree->buck_cache_lock));
-			return CACHE_FULL;
-		}
-
-		if ((iter_node->node_state & NODE_STATE_DIRTY) && (iter_node->node_state & NODE_STATE_VALID)) {
-			bucket_write(tree, iter_node->id, &(tree->buck_cache->cache_t[iter_node->pos].bucket));
-		}
-		new_node->pos = iter_node->pos;
-		REMOVE_ENTRY(iter_node);
-		free(iter_node);
+		return CACHE_FULL;
 	}
 	PLACE_AT_TAIL(new_node, tree->buck_cache);
 	new_node->id = id;
@@ -1248,13 +1237,16 @@ static int transform_key(int key)
 }
 
 /****************************************************************************
- * Name: tree_read
+ * Name: tree_fetch
  *
  * Description: Fetches nodes from the flash and suitably evicts the nodes
- *              from cache, in case the cache is full
+ *              from cache, in case the cache is full. Nodes are edited in
+ *              place by the callers of tree_read, so those are marked dirty,
+ *              while the nodes only looked up keep a clean copy which is
+ *              not written back when evicted.
  *
  ****************************************************************************/
-static tree_node_t *tree_read(tree_t *tree, int bucket_id)
+static tree_node_t *tree_fetch(tree_t *tree, int bucket_id, bool modify)
 {
 	pthread_mutex_lock(&(tree->node_cache_lock));
 
@@ -1275,40 +1267,31 @@ static tree_node_t *tree_read(tree_t *tree, int bucket_id)
 			return NULL;
 		}
 		SET_NODE_STATE(iter, NODE_STATE_LOCK);
+		if (modify) {
+			SET_NODE_STATE(iter, NODE_STATE_DIRTY);
+		}
 		REMOVE_ENTRY(iter);
 		PLACE_AT_TAIL(iter, tree->node_cache);
+		tree->node_cache->stats.hits++;
 		pthread_mutex_unlock(&(tree->node_cache_lock));
 		return &(tree->node_cache->cache_t[iter->pos].node);
 	} else {
-		qnode_t *new_node = (qnode_t *)bptree_malloc(sizeof(qnode_t));
+		/* Case when the least recently used node needs to be evicted to make place for new node */
+		qnode_t *new_node = cache_get_slot(tree, NODE);
 		if (new_node == NULL) {
 			pthread_mutex_unlock(&(tree->node_cache_lock));
 			return NULL;
 		}
-		if (tree->node_cache->num < DB_TREE_CACHE_LIMIT) {
-			new_node->pos = tree->node_cache->num++;
-		} else {
-			/* Case when the least recently used node needs to be evicted to make place for new node */
-			qnode_t *replace_node = tree->node_cache->in_cache.head->next;
-			while ((replace_node->node_state & NODE_STATE_LOCK) && replace_node != tree->node_cache->in_cache.tail) {
-				replace_node = replace_node->next;
-			}
-			if (replace_node == tree->node_cache->in_cache.tail) {
-				free(new_node);
-				pthread_mutex_unlock(&(tree->node_cache_lock));
-				return NULL;
-			}
-			if ((replace_node->node_state & NODE_STATE_DIRTY) && (replace_node->node_state & NODE_STATE_VALID)) {
-				tree_write(tree, replace_node->id, &(tree->node_cache->cache_t[replace_node->pos].node));
-			}
-			new_node->pos = replace_node->pos;
-			REMOVE_ENTRY(replace_node);
-			free(replace_node);
-		}
 		/* Adjusting the pointers */
 		PLACE_AT_TAIL(new_node, tree->node_cache);
 		new_node->id = bucket_id;
-		SET_NODE_STATE(new_node, NODE_STATE_LOCK | NODE_STATE_VALID | NODE_STATE_DIRTY);
+		SET_NODE_STATE(new_node, NODE_STATE_LOCK | NODE_STATE_VALID);
+		if (modify) {
+			SET_NODE_STATE(new_node, NODE_STATE_DIRTY);
+		} else {
+			UNSET_NODE_STATE(new_node, NODE_STATE_DIRTY);
+		}
+		tree->node_cache->stats.misses++;
 
 		/* Reading from flash */
 		if (DB_ERROR(storage_read_from(tree->tree_storage, &(tree->node_cache->cache_t[new_node->pos].node), base_offset + (unsigned long)bucket_id * sizeof(tree_node_t), sizeof(tree_node_t)))) {
@@ -1324,6 +1307,17 @@ static tree_node_t *tree_read(tree_t *tree, int bucket_id)
 	}
 }
 
+/****************************************************************************
+ * Name: tree_read
+ *
+ * Description: Fetches a node to be edited in place
+ *
+ ****************************************************************************/
+static tree_node_t *tree_read(tree_t *tree, int bucket_id)
+{
+	return tree_fetch(tree, bucket_id, true);
+}
+
 /****************************************************************************
  * Name: tree_write
  *
@@ -1418,7 +1412,7 @@ static pair_t *tree_find(tree_t *tree, int key)
 		/* TODO
 		 * Absent of noncast return handling, should be taken care in the definition
 		 */
-		node = tree_read(tree, id);
+		node = tree_fetch(tree, id, false);
 		if (node == NULL) {
 			free(path);
 			return NULL;
@@ -1550,41 +1544,23 @@ static bucket_t *bucket_read(tree_t *tree, int bucket_id)
 		SET_NODE_STATE(iter, NODE_STATE_LOCK);
 		REMOVE_ENTRY(iter);
 		PLACE_AT_TAIL(iter, tree->buck_cache);
+		tree->buck_cache->stats.hits++;
 		pthread_mutex_unlock(&(tree->buck_cache_lock));
 		return &(tree->buck_cache->cache_t[iter->pos].bucket);
 	} else {
-		/* Bucket has to be read from flash into the cache */
-		qnode_t *new_node = (qnode_t *)bptree_malloc(sizeof(qnode_t));
+		/* Bucket has to be read from flash into the cache, evicting the least recently used bucket when full */
+		qnode_t *new_node = cache_get_slot(tree, BUCKET);
 		if (new_node == NULL) {
 			pthread_mutex_unlock(&(tree->buck_cache_lock));
 			return NULL;
 		}
-		if (tree->buck_cache->num < DB_HEAP_CACHE_LIMIT) {
-			new_node->pos = tree->buck_cache->num++;
-		} else {
-			/* Cache doesn't have enough space and the least recently used bucket needs to be evicted */
-			qnode_t *replace_node = tree->buck_cache->in_cache.head->next;
-			while ((replace_node->node_state & NODE_STATE_LOCK) && (replace_node != tree->buck_cache->in_cache.tail)) {
-				replace_node = replace_node->next;
-			}
-			if (replace_node == tree->buck_cache->in_cache.tail) {
-				free(new_node);
-				pthread_mutex_unlock(&(tree->buck_cache_lock));
-				return NULL;
-			}
-			if ((replace_node->node_state & NODE_STATE_DIRTY) && (replace_node->node_state & NODE_STATE_VALID)) {
-				bucket_write(tree, replace_node->id, &(tree->buck_cache->cache_t[replace_node->pos].bucket));
-			}
-			new_node->pos = replace_node->pos;
-			REMOVE_ENTRY(replace_node);
-			free(replace_node);
-		}
 
 		/* Adjust the pointers */
 		PLACE_AT_TAIL(new_node, tree->buck_cache);
 		new_node->id = bucket_id;
 		SET_NODE_STATE(new_node, NODE_STATE_LOCK | NODE_STATE_VALID);
 		UNSET_NODE_STATE(new_node, NODE_STATE_DIRTY);
+		tree->buck_cache->stats.misses++;
 
 		/* Read from flash */
 		if (DB_ERROR(storage_read_from(tree->bucket_storage, (void *)&(tree->buck_cache->cache_t[new_node->pos].bucket), (unsigned long)bucket_id * sizeof(bucket_t), sizeof(bucket_t)))) {
@@ -2032,6 +2008,12 @@ static int db_flush(tree_t *tree, relation_t *rel)
 	tree->inserted -= tree->deleted;
 	tree->deleted = 0;
 	storage_remove(old_rel.tuple_filename);
+
+	/* The rewritten buckets go to flash in one pass instead of on eviction */
+	storage_write_to(tree->tree_storage, tree, 0, sizeof(tree_t));
+	cache_flush(tree, BUCKET);
+	cache_flush(tree, NODE);
+	cache_print_stats(tree);
 	DB_LOG_D("Flushed the database.\n");
 	return DB_OK;
 }
@@ -137,6 +137,8 @@ static long operand_to_long(lvm_instance_t *p, operand_t *operand)
 #endif							/* LVM_USE_FLOATS */
 	case LVM_VARIABLE:
 		return p->variables[operand->value.id].value.l;
+	case LVM_PARAMETER:
+		return p->parameters[operand->value.id].l;
 	default:
 		return 0;
 	}
@@ -283,6 +285,7 @@ void lvm_reset(lvm_instance_t *p)
 	memset(p->code, 0, sizeof(p->code));
 	memset(p->variables, 0, sizeof(p->variables));
 	memset(p->derivations, 0, sizeof(p->derivations));
+	memset(p->parameters, 0, sizeof(p->parameters));
 }
 
 lvm_ip_t lvm_jump_to_operand(lvm_instance_t *p)
@@ -453,6 +456,33 @@ lvm_status_t lvm_set_long(lvm_instance_t *p, long l)
 	return lvm_set_operand(p, &op);
 }
 
+/*
+ * A parameter is a constant whose value is set after the code is built,
+ * so that the code of a prepared query is run with other values.
+ */
+lvm_status_t lvm_set_parameter(lvm_instance_t *p, variable_id_t id)
+{
+	operand_t op;
+
+	if (id >= LVM_MAX_PARAMETER_ID) {
+		return INVALID_IDENTIFIER;
+	}
+
+	op.type = LVM_PARAMETER;
+	op.value.id = id;
+
+	return lvm_set_operand(p, &op);
+}
+
+lvm_status_t lvm_set_parameter_value(lvm_instance_t *p, variable_id_t id, long l)
+{
+	if (id >= LVM_MAX_PARAMETER_ID) {
+		return INVALID_IDENTIFIER;
+	}
+	p->parameters[id].l = l;
+	return LVM_TRUE;
+}
+
 lvm_status_t lvm_register_variable(lvm_instance_t *p, char *name, operand_type_t type)
 {
 	variable_id_t id;
@@ -624,6 +654,12 @@ static int derive_relation(lvm_instance_t *p, derivation_t *local_derivations)
 		default:
 			return DERIVATION_ERROR;
 		}
+
+		/* Parameters bound so far are constants for the derivation */
+		if (operand[i].type == LVM_PARAMETER) {
+			operand[i].type = LVM_LONG;
+			operand[i].value.l = p->parameters[operand[i].value.id].l;
+		}
 	}
 
 	if (operand[0].type == LVM_VARIABLE && operand[1].type == LVM_VARIABLE) {
@@ -756,6 +792,9 @@ static lvm_ip_t print_operand(lvm_instance_t *p, lvm_ip_t index)
 	case LVM_LONG:
 		DB_LOG_D("long:%ld ", operand.value.l);
 		break;
+	case LVM_PARAMETER:
+		DB_LOG_D("param(%d):%ld ", operand.value.id, p->parameters[operand.value.id].l);
+		break;
 	default:
 		DB_LOG_D("?? ");
 		break;
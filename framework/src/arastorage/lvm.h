@@ -118,7 +118,8 @@ typedef enum lvm_operator_e operator_t;
 enum operand_type_e {
 	LVM_VARIABLE,
 	LVM_FLOAT,
-	LVM_LONG
+	LVM_LONG,
+	LVM_PARAMETER
 };
 typedef enum operand_type_e operand_type_t;
 
@@ -156,6 +157,7 @@ struct lvm_instance_s {
 	unsigned char code[DB_VM_BYTECODE_SIZE];
 	variable_t variables[LVM_MAX_VARIABLE_ID];
 	derivation_t derivations[LVM_MAX_VARIABLE_ID];
+	operand_value_t parameters[LVM_MAX_PARAMETER_ID];
 	lvm_ip_t end;
 	lvm_ip_t ip;
 	unsigned error;
@@ -184,4 +186,6 @@ lvm_status_t lvm_set_operand_value(lvm_instance_t *p, attribute_t *attr, unsigne
 lvm_status_t lvm_set_long(lvm_instance_t *p, long l);
 lvm_status_t lvm_set_variable(lvm_instance_t *p, char *name);
 lvm_status_t lvm_set_variable_value(lvm_instance_t *p, char *name, operand_value_t value);
+lvm_status_t lvm_set_parameter(lvm_instance_t *p, variable_id_t id);
+lvm_status_t lvm_set_parameter_value(lvm_instance_t *p, variable_id_t id, long l);
 #endif							/* LVM_H */
@@ -581,6 +581,128 @@ db_result_t relation_insert(relation_t *rel, attribute_value_t *values)
 	return storage_put_row(rel, record, FALSE);
 }
 
+/*
+ * Index entries of the tuples given to relation_insert_bulk, added to the
+ * index in increasing order of key.
+ */
+struct bulk_key_s {
+	long key;
+	tuple_id_t tuple_id;
+};
+
+static int bulk_key_compare(const void *p1, const void *p2)
+{
+	const struct bulk_key_s *k1 = (const struct bulk_key_s *)p1;
+	const struct bulk_key_s *k2 = (const struct bulk_key_s *)p2;
+
+	if (k1->key != k2->key) {
+		return k1->key < k2->key ? -1 : 1;
+	}
+	return k1->tuple_id < k2->tuple_id ? -1 : 1;
+}
+
+/*
+ * Insert count tuples of rel->attribute_count values each. The rows are
+ * appended to the tuple file in one write, then the keys of each index are
+ * sorted and inserted in order, so that consecutive inserts land in the
+ * same cached nodes and buckets of the index instead of random ones.
+ * Nothing is stored if a value does not match its attribute.
+ */
+db_result_t relation_insert_bulk(relation_t *rel, attribute_value_t *values, int count)
+{
+	attribute_t *attr;
+	attribute_value_t *value;
+	attribute_value_t key_value;
+	unsigned char *records;
+	unsigned char *ptr;
+	struct bulk_key_s *keys;
+	tuple_id_t first_row;
+	db_result_t result;
+	int column;
+	int i;
+
+	if (count <= 0) {
+		return DB_ARGUMENT_ERROR;
+	}
+
+	records = (unsigned char *)malloc(rel->row_length * count);
+	if (records == NULL) {
+		return DB_ALLOCATION_ERROR;
+	}
+
+	ptr = records;
+	for (i = 0; i < count; i++) {
+		value = &values[i * rel->attribute_count];
+		for (attr = list_head(rel->attributes); attr != NULL; attr = attr->next, value++) {
+			if (attr->flags & ATTRIBUTE_FLAG_INVALID) {
+				memset(ptr, 0, attr->element_size);
+			} else {
+				if (attr->domain != value->domain && !(attr->domain == DOMAIN_LONG && value->domain == DOMAIN_INT)) {
+					DB_LOG_E("DB: The value domain %d does not match the domain %d of attribute %s\n", value->domain, attr->domain, attr->name);
+					free(records);
+					return DB_RELATIONAL_ERROR;
+				}
+				result = db_value_to_phy(ptr, attr, value);
+				if (DB_ERROR(result)) {
+					free(records);
+					return result;
+				}
+			}
+			ptr += attr->element_size;
+		}
+	}
+
+	first_row = rel->next_row;
+	result = storage_put_rows(rel, records, count);
+	free(records);
+	if (DB_ERROR(result)) {
+		return result;
+	}
+	DB_LOG_D("DB: Stored %d rows in relation %s\n", count, rel->name);
+
+	keys = NULL;
+	column = 0;
+	for (attr = list_head(rel->attributes); attr != NULL; attr = attr->next, column++) {
+		if (attr->index == NULL) {
+			index_load(rel, attr);
+		}
+		if (attr->index == NULL || (attr->flags & ATTRIBUTE_FLAG_INVALID)) {
+			continue;
+		}
+		if (attr->domain != DOMAIN_INT && attr->domain != DOMAIN_LONG) {
+			for (i = 0; i < count; i++) {
+				if (DB_ERROR(index_insert(attr->index, &values[i * rel->attribute_count + column], first_row + i))) {
+					return DB_INDEX_ERROR;
+				}
+			}
+			continue;
+		}
+		if (keys == NULL) {
+			keys = (struct bulk_key_s *)malloc(sizeof(struct bulk_key_s) * count);
+			if (keys == NULL) {
+				return DB_ALLOCATION_ERROR;
+			}
+		}
+		for (i = 0; i < count; i++) {
+			keys[i].key = db_value_to_long(&values[i * rel->attribute_count + column]);
+			keys[i].tuple_id = first_row + i;
+		}
+		qsort(keys, count, sizeof(struct bulk_key_s), bulk_key_compare);
+
+		key_value.domain = DOMAIN_LONG;
+		for (i = 0; i < count; i++) {
+			VALUE_LONG(&key_value) = keys[i].key;
+			if (DB_ERROR(index_insert(attr->index, &key_value, keys[i].tuple_id))) {
+				free(keys);
+				return DB_INDEX_ERROR;
+			}
+		}
+	}
+	free(keys);
+
+	return DB_OK;
+}
+
 /*
  * Update aggregation value whenever each tuple is read.
  */
@@ -942,6 +1064,11 @@ db_result_t relation_process_select(db_handle_t **handle, db_cursor_t *cursor)
 					goto errout;
 				}
 			}
+		} else if (cursor->stream != NULL) {
+			/* A streaming cursor is given the rows one by one */
+			cursor->current_storage_row = (*handle)->tuple_id;
+			free(row);
+			return DB_GOT_ROW;
 		} else {
 			result = cursor_data_add(cursor, (*handle)->tuple_id);
 			if (DB_ERROR(result)) {
@@ -1121,7 +1248,6 @@ errout:
 
 db_cursor_t *relation_process_result(db_handle_t *handler)
 {
-	db_result_t res;
 	db_cursor_t *cursor;
 
 	cursor = (db_cursor_t *)malloc(sizeof(db_cursor_t));
@@ -1131,13 +1257,27 @@ db_cursor_t *relation_process_result(db_handle_t *handler)
 	}
 	memset(cursor, 0, sizeof(db_cursor_t));
 
+	if (DB_ERROR(relation_process_cursor(handler, cursor))) {
+		cursor_deinit(cursor);
+		return NULL;
+	}
+	return cursor;
+}
+
+/*
+ * Fill a cursor, new or reused from a previous query, with the result of
+ * the query of handler.
+ */
+db_result_t relation_process_cursor(db_handle_t *handler, db_cursor_t *cursor)
+{
+	db_result_t res;
+
 	/* when SELECT, cursor row data is set in processing tuple by tuple.
 	   So we need to initialize cursor and make cursor data before processing tuples */
 	if (handler->optype == AQL_TYPE_SELECT) {
 		if (DB_ERROR(cursor_init(&cursor, handler->rel)) || DB_ERROR(cursor_data_set(cursor, handler->attr_map, handler->result_rel->attribute_count))) {
 			DB_LOG_E("DB: Failed to init cursor and set cursor data\n");
-			cursor_deinit(cursor);
-			return NULL;
+			return DB_CURSOR_ERROR;
 		}
 	}
 
@@ -1146,13 +1286,12 @@ db_cursor_t *relation_process_result(db_handle_t *handler)
 		res = relation_process(&handler, cursor);
 		if (DB_ERROR(res)) {
 			DB_LOG_E("DB: Failed to process tuples : %d\n", res);
-			cursor_deinit(cursor);
-			return NULL;
+			return res;
 		}
 		switch (res) {
 		case DB_FINISHED:
 			DB_LOG_V("DB: Processing tuples is done!\n");
-			return cursor;
+			return DB_OK;
 		case DB_OK:
 			continue;
 		case DB_GOT_ROW:
@@ -1162,8 +1301,7 @@ db_cursor_t *relation_process_result(db_handle_t *handler)
 			break;
 		}
 	}
-	cursor_deinit(cursor);
-	return NULL;
+	return DB_ARGUMENT_ERROR;
 }
 
 db_result_t relation_select(db_handle_t **handle, relation_t *rel, void *adt_ptr)
@@ -97,7 +97,7 @@
 #define IS_INVALID_CURSOR_ROW(a) ((a) == NULL || ((a)->current_cursor_row >= (a)->cursor_rows))
 
 /* check current storage row is valid or invalid*/
-#define IS_INVALID_STORAGE_ROW(a) ((a) == NULL || ((a)->current_storage_row >= (a)->total_rows) || (a)->current_storage_row >= DB_CURSOR_RESULT_ENTRY)
+#define IS_INVALID_STORAGE_ROW(a) ((a) == NULL || ((a)->current_storage_row >= (a)->total_rows) || ((a)->stream == NULL && (a)->current_storage_row >= DB_CURSOR_RESULT_ENTRY))
 
 #define RELATION_HAS_TUPLES(rel) ((rel)->tuple_storage >= 0)
 
@@ -163,6 +163,7 @@ struct _db_cursor_s {
 	char name[TUPLE_NAME_LENGTH + 1];
 	char rel_name[RELATION_NAME_LENGTH + 1];
 	cursor_data_map_t attr_map[AQL_ATTRIBUTE_LIMIT];
+	db_handle_t *stream;			/* Query evaluated a row at a time, NULL for a bitmap of rows */
 };
 
 /****************************************************************************
@@ -170,6 +171,7 @@ struct _db_cursor_s {
  ****************************************************************************/
 /* Operations for cursor processing */
 db_result_t cursor_init(db_cursor_t **cursor, relation_t *rel);
+db_result_t cursor_init_stream(db_cursor_t *cursor, db_handle_t *handle);
 db_result_t cursor_load(db_cursor_t **target, db_cursor_t *src);
 db_result_t cursor_data_add(db_cursor_t *cursor, tuple_id_t tuple_id);
 db_result_t cursor_deinit(db_cursor_t *cursor);
@@ -181,6 +183,8 @@ db_result_t relation_deinit(void);
 db_result_t relation_process_remove(db_handle_t **, db_cursor_t *);
 db_result_t relation_process_select(db_handle_t **, db_cursor_t *);
 db_cursor_t *relation_process_result(db_handle_t *);
+db_result_t relation_process_cursor(db_handle_t *, db_cursor_t *);
+int db_processing_status(db_handle_t *);
 relation_t *relation_load(char *);
 db_result_t relation_release(relation_t *);
 relation_t *relation_create(char *, db_direction_t);
@@ -192,6 +196,7 @@ db_result_t relation_attribute_remove(relation_t *, char *);
 db_result_t relation_set_primary_key(relation_t *, char *);
 db_result_t relation_remove(relation_t *, int);
 db_result_t relation_insert(relation_t *, attribute_value_t *);
+db_result_t relation_insert_bulk(relation_t *, attribute_value_t *, int);
 db_result_t relation_select(db_handle_t **, relation_t *, void *);
 tuple_id_t relation_cardinality(relation_t *);
 
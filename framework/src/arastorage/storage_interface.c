@@ -555,6 +555,34 @@ db_result_t storage_put_row(relation_t *rel, storage_row_t row, uint8_t flag)
 	return result;
 }
 
+/****************************************************************************
+ * Name: storage_put_rows
+ *
+ * Desciption: Append count rows laid out one after the other in a single
+ *   write, after the rows still pending in the insert buffer.
+ *
+ ****************************************************************************/
+db_result_t storage_put_rows(relation_t *rel, storage_row_t rows, int count)
+{
+	unsigned length;
+
+	length = rel->row_length * count;
+#ifdef CONFIG_ARASTORAGE_ENABLE_WRITE_BUFFER
+	if (DB_ERROR(storage_flush_insert_buffer())) {
+		return DB_STORAGE_ERROR;
+	}
+#endif
+	if (storage_write(rel->tuple_storage, rows, length) != length) {
+		DB_LOG_E("DB: Failed to store %u bytes\n", length);
+		return DB_STORAGE_ERROR;
+	}
+	DB_LOG_D("DB: Stored %d rows of %u bytes\n", count, (unsigned)rel->row_length);
+
+	rel->cardinality += count;
+	rel->next_row += count;
+	return DB_OK;
+}
+
 db_result_t storage_write_row(db_storage_id_t fd, storage_row_t row, unsigned length, char *filename)
 {
 #ifdef CONFIG_ARASTORAGE_ENABLE_WRITE_BUFFER
@@ -425,8 +425,8 @@ static bool _ui_anim_move_func(ui_widget_t widget, ui_anim_t anim, uint32_t *dt)
 	anim_body->t += remain_time;
 	*dt -= remain_time;
 
-	intrp_x = (int32_t)move_anim_body->intrp_func(anim_body->t, move_anim_body->from_coord.x, move_anim_body->to_coord.x - move_anim_body->from_coord.x, anim_body->d);
-	intrp_y = (int32_t)move_anim_body->intrp_func(anim_body->t, move_anim_body->from_coord.y, move_anim_body->to_coord.y - move_anim_body->from_coord.y, anim_body->d);
+	intrp_x = move_anim_body->intrp_func(anim_body->t, move_anim_body->from_coord.x, move_anim_body->to_coord.x - move_anim_body->from_coord.x, anim_body->d);
+	intrp_y = move_anim_body->intrp_func(anim_body->t, move_anim_body->from_coord.y, move_anim_body->to_coord.y - move_anim_body->from_coord.y, anim_body->d);
 
 	if (ui_widget_set_position_sync((ui_widget_body_t *)widget, intrp_x, intrp_y) != UI_OK) {
 		UI_LOGE("Failed to set widget position!\n");
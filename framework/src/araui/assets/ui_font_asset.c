@@ -20,12 +20,14 @@
 #include <string.h>
 #include <stdint.h>
 #include <sys/types.h>
+#include <sys/mman.h>
 #include <araui/ui_commons.h>
 #include <araui/ui_asset.h>
 #include "ui_core_internal.h"
 #include "ui_asset_internal.h"
 #include "ui_commons_internal.h"
 #include "ui_request_callback.h"
+#include "ui_renderer.h"
 #include "ui_debug.h"
 
 #define STB_TRUETYPE_IMPLEMENTATION 
@@ -33,7 +35,19 @@
 
 #define DEFAULT_GLYPH_MAP_CAPACITY 256
 
+// Number of rasterized glyphs kept for each font
+#ifndef CONFIG_UI_GLYPH_CACHE_SIZE
+#define CONFIG_UI_GLYPH_CACHE_SIZE 32
+#endif
+
+typedef struct {
+	ui_font_asset_body_t *body;
+	const ui_font_atlas_t *atlas;
+} ui_set_atlas_info_t;
+
 static void _ui_font_asset_destroy_func(void *userdata);
+static void _ui_font_asset_set_atlas_func(void *userdata);
+static bool _ui_font_asset_get_atlas_glyph(ui_font_asset_body_t *body, uint32_t code, int32_t font_size, ui_glyph_t *glyph);
 
 ui_asset_t ui_font_asset_create_from_file(const char *filename)
 {
@@ -42,6 +56,7 @@ ui_asset_t ui_font_asset_create_from_file(const char *filename)
 	size_t file_size;
 	size_t read;
 	char *extension;
+	void *mapped;
 
 	if (!ui_is_running()) {
 		UI_LOGE("error: UI framework is not running!\n");
@@ -91,6 +106,23 @@ ui_asset_t ui_font_asset_create_from_file(const char *filename)
 		return UI_NULL;
 	}
 
+	/* If the font resides in directly addressable memory (e.g. a romfs image
+	 * on XIP flash), use it in place rather than copying it into the heap.
+	 */
+	mapped = mmap(NULL, file_size, PROT_READ, MAP_SHARED, fileno(file), 0);
+	if (mapped != MAP_FAILED) {
+		(void)fclose(file);
+		body->from_buf = true;
+
+		if (!stbtt_InitFont(&body->ttf_info, (const uint8_t *)mapped, 0)) {
+			UI_LOGE("error: stbtt_InitFont\n");
+			UI_FREE(body);
+			return UI_OPERATION_FAIL;
+		}
+
+		return (ui_asset_t)body;
+	}
+
 	body->ttf_buf = UI_ALLOC(file_size);
 	if (!body->ttf_buf) {
 		(void)fclose(file);
@@ -169,12 +201,215 @@ ui_error_t ui_font_asset_destroy(ui_asset_t font)
 	return UI_OK;
 }
 
+ui_error_t ui_font_asset_set_atlas(ui_asset_t font, const uint8_t *atlas)
+{
+	ui_set_atlas_info_t *info;
+	const ui_font_atlas_t *header;
+
+	if (!ui_is_running()) {
+		return UI_NOT_RUNNING;
+	}
+
+	if (!font || !ui_asset_check_type(font, UI_FONT_ASSET)) {
+		return UI_INVALID_PARAM;
+	}
+
+	header = (const ui_font_atlas_t *)atlas;
+	if (header && (header->magic != UI_FONT_ATLAS_MAGIC || header->font_size <= 0 ||
+		header->width <= 0 || header->height <= 0)) {
+		UI_LOGE("error: invalid font atlas!\n");
+		return UI_INVALID_PARAM;
+	}
+
+	info = (ui_set_atlas_info_t *)UI_ALLOC(sizeof(ui_set_atlas_info_t));
+	if (!info) {
+		return UI_NOT_ENOUGH_MEMORY;
+	}
+
+	info->body = (ui_font_asset_body_t *)font;
+	info->atlas = header;
+
+	if (ui_request_callback(_ui_font_asset_set_atlas_func, info) != UI_OK) {
+		UI_FREE(info);
+		return UI_OPERATION_FAIL;
+	}
+
+	return UI_OK;
+}
+
+ui_error_t ui_font_asset_get_glyph_stats(ui_asset_t font, ui_font_glyph_stats_t *stats)
+{
+	if (!font || !stats || !ui_asset_check_type(font, UI_FONT_ASSET)) {
+		return UI_INVALID_PARAM;
+	}
+
+	*stats = ((ui_font_asset_body_t *)font)->glyph_stats;
+
+	return UI_OK;
+}
+
+/**
+ * @brief Get a glyph of the font at a size, from the atlas or the glyph cache.
+ *
+ * A glyph in neither is rasterized into the cache, in place of the least recently used one.
+ * The glyph stays valid until the next call.
+ */
+ui_error_t ui_font_asset_get_glyph(ui_font_asset_body_t *body, uint32_t code, int32_t font_size, ui_glyph_t *glyph)
+{
+	ui_glyph_cache_entry_t *entry;
+	ui_glyph_cache_entry_t *victim;
+	float scale;
+	int c_x1;
+	int c_y1;
+	int c_x2;
+	int c_y2;
+	int i;
+
+	if (!body || !glyph) {
+		return UI_INVALID_PARAM;
+	}
+
+	if (_ui_font_asset_get_atlas_glyph(body, code, font_size, glyph)) {
+		body->glyph_stats.atlas_hits++;
+		return UI_OK;
+	}
+
+	if (!body->glyph_cache) {
+		body->glyph_cache = (ui_glyph_cache_entry_t *)UI_ALLOC(sizeof(ui_glyph_cache_entry_t) * CONFIG_UI_GLYPH_CACHE_SIZE);
+		if (!body->glyph_cache) {
+			return UI_NOT_ENOUGH_MEMORY;
+		}
+		memset(body->glyph_cache, 0, sizeof(ui_glyph_cache_entry_t) * CONFIG_UI_GLYPH_CACHE_SIZE);
+	}
+
+	body->glyph_uses++;
+
+	victim = &body->glyph_cache[0];
+	for (i = 0; i < CONFIG_UI_GLYPH_CACHE_SIZE; i++) {
+		entry = &body->glyph_cache[i];
+		if (entry->last_used && entry->code == code && entry->font_size == font_size) {
+			entry->last_used = body->glyph_uses;
+			body->glyph_stats.cache_hits++;
+			goto found;
+		}
+		if (entry->last_used < victim->last_used) {
+			victim = entry;
+		}
+	}
+
+	body->glyph_stats.cache_misses++;
+	entry = victim;
+	if (entry->last_used) {
+		// The glyph may have been drawn by the 2D engine in this frame
+		ui_renderer_sync();
+		UI_FREE(entry->bitmap);
+		entry->bitmap = NULL;
+		entry->last_used = 0;
+		body->glyph_stats.cached--;
+	}
+
+	scale = stbtt_ScaleForPixelHeight(&body->ttf_info, font_size);
+	stbtt_GetCodepointBitmapBox(&body->ttf_info, code, scale, scale, &c_x1, &c_y1, &c_x2, &c_y2);
+
+	entry->width = c_x2 - c_x1;
+	entry->height = c_y2 - c_y1;
+	if (entry->width > 0 && entry->height > 0) {
+		entry->bitmap = (uint8_t *)UI_ALLOC(entry->width * entry->height);
+		if (!entry->bitmap) {
+			return UI_NOT_ENOUGH_MEMORY;
+		}
+		stbtt_MakeCodepointBitmap(&body->ttf_info, entry->bitmap, entry->width, entry->height, entry->width, scale, scale, code);
+	}
+	entry->code = code;
+	entry->font_size = font_size;
+	entry->y_offset = c_y1;
+	entry->last_used = body->glyph_uses;
+	body->glyph_stats.cached++;
+
+found:
+	glyph->texture = entry->bitmap;
+	glyph->tex_width = entry->width;
+	glyph->tex_height = entry->height;
+	glyph->x = 0;
+	glyph->y = 0;
+	glyph->width = entry->width;
+	glyph->height = entry->height;
+	glyph->y_offset = entry->y_offset;
+
+	return UI_OK;
+}
+
+static bool _ui_font_asset_get_atlas_glyph(ui_font_asset_body_t *body, uint32_t code, int32_t font_size, ui_glyph_t *glyph)
+{
+	const ui_font_atlas_glyph_t *glyphs;
+	const ui_font_atlas_glyph_t *found;
+	int32_t low;
+	int32_t high;
+	int32_t mid;
+
+	if (!body->atlas || body->atlas->font_size != font_size) {
+		return false;
+	}
+
+	glyphs = (const ui_font_atlas_glyph_t *)(body->atlas + 1);
+	found = NULL;
+	low = 0;
+	high = (int32_t)body->atlas->glyph_count - 1;
+	while (low <= high) {
+		mid = (low + high) >> 1;
+		if (glyphs[mid].code == code) {
+			found = &glyphs[mid];
+			break;
+		} else if (glyphs[mid].code < code) {
+			low = mid + 1;
+		} else {
+			high = mid - 1;
+		}
+	}
+
+	if (!found) {
+		return false;
+	}
+
+	glyph->texture = (const uint8_t *)(glyphs + body->atlas->glyph_count);
+	glyph->tex_width = body->atlas->width;
+	glyph->tex_height = body->atlas->height;
+	glyph->x = found->x;
+	glyph->y = found->y;
+	glyph->width = found->width;
+	glyph->height = found->height;
+	glyph->y_offset = found->y_offset;
+
+	return true;
+}
+
+static void _ui_font_asset_set_atlas_func(void *userdata)
+{
+	ui_set_atlas_info_t *info;
+
+	info = (ui_set_atlas_info_t *)userdata;
+	info->body->atlas = info->atlas;
+
+	UI_FREE(info);
+}
+
 static void _ui_font_asset_destroy_func(void *userdata)
 {
 	ui_font_asset_body_t *body;
+	int i;
 
 	body = (ui_font_asset_body_t *)userdata;
 
+	UI_LOGD("glyphs: %u from atlas, %u cache hits, %u misses\n",
+		body->glyph_stats.atlas_hits, body->glyph_stats.cache_hits, body->glyph_stats.cache_misses);
+
+	if (body->glyph_cache) {
+		for (i = 0; i < CONFIG_UI_GLYPH_CACHE_SIZE; i++) {
+			UI_FREE(body->glyph_cache[i].bitmap);
+		}
+		UI_FREE(body->glyph_cache);
+	}
+
 	UI_FREE(body->ttf_buf);
 	UI_FREE(body);
 }
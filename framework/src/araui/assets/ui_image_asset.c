@@ -20,17 +20,34 @@
 #include <string.h>
 #include <stdint.h>
 #include <sys/types.h>
+#include <vec/vec.h>
 #include <araui/ui_commons.h>
 #include <araui/ui_asset.h>
 #include "ui_core_internal.h"
 #include "ui_asset_internal.h"
 #include "ui_request_callback.h"
+#include "ui_renderer.h"
 #include "ui_debug.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
 
+// Bytes of the decoded compressed images kept in RAM
+#ifndef CONFIG_UI_IMAGE_CACHE_SIZE
+#define CONFIG_UI_IMAGE_CACHE_SIZE       (64 * 1024)
+#endif
+
+// Draws of a compressed image, decoded by rows meanwhile, before it is kept decoded
+#ifndef CONFIG_UI_IMAGE_CACHE_HOT_DRAWS
+#define CONFIG_UI_IMAGE_CACHE_HOT_DRAWS  2
+#endif
+
+static vec_void_t g_image_cache;         //!< Images decoded in the cache, zeroed as by vec_init()
+static size_t g_image_cache_used;
+static uint32_t g_image_cache_draws;
+
 static void              _ui_image_asset_destroy_func(void *userdata);
+static void              _ui_image_cache_remove(ui_image_asset_body_t *image);
 static ui_pixel_format_t _ui_get_pixel_format_from_channels(int channels);
 static size_t            _ui_get_bpp_from_pf(ui_pixel_format_t type);
 
@@ -69,6 +86,53 @@ ui_asset_t ui_image_asset_create_from_buffer(const uint8_t *buf)
 	body->bytes_per_line = body->width * body->bits_per_pixel / 8;
 	body->from_buf = true;
 
+	body->compression = (ui_image_compression_t)bitmap->compression;
+	if (body->compression != UI_IMAGE_COMPRESSION_NONE) {
+		if (body->compression > UI_IMAGE_COMPRESSION_PALETTE || (body->bits_per_pixel & 7) || body->bits_per_pixel == 0) {
+			UI_LOGE("error: Not supported compression %d of pixel format %d\n", body->compression, body->pixel_format);
+			UI_FREE(body);
+			return UI_NULL;
+		}
+		body->data = body->buf;
+		body->buf = NULL;
+	}
+
+	return (ui_asset_t)body;
+}
+
+ui_asset_t ui_image_asset_create_from_pixels(const uint8_t *pixels, int32_t width, int32_t height, ui_pixel_format_t pf)
+{
+	ui_image_asset_body_t *body;
+
+	if (!ui_is_running()) {
+		UI_LOGE("error: UI framework is not running!\n");
+		return UI_NULL;
+	}
+
+	if (!pixels || width <= 0 || height <= 0 || !_ui_get_bpp_from_pf(pf)) {
+		UI_LOGE("error: invalid parameter!\n");
+		return UI_NULL;
+	}
+
+	body = (ui_image_asset_body_t *)UI_ALLOC(sizeof(ui_image_asset_body_t));
+	if (!body) {
+		UI_LOGE("error: out of memory!\n");
+		return UI_NULL;
+	}
+
+	memset(body, 0, sizeof(ui_image_asset_body_t));
+	((ui_asset_body_t *)body)->type = UI_IMAGE_ASSET;
+
+	// The pixels are drawn where they are, such as in a camera buffer
+	body->width = width;
+	body->height = height;
+	body->buf = (uint8_t *)pixels;
+	body->pixel_format = pf;
+	body->bits_per_pixel = _ui_get_bpp_from_pf(pf);
+	body->bytes_per_line = body->width * body->bits_per_pixel / 8;
+	body->from_buf = true;
+	body->compression = UI_IMAGE_COMPRESSION_NONE;
+
 	return (ui_asset_t)body;
 }
 
@@ -98,9 +162,250 @@ static void _ui_image_asset_destroy_func(void *userdata)
 	if (!body->from_buf) {
 		stbi_image_free(body->buf);
 	}
+	if (body->compression != UI_IMAGE_COMPRESSION_NONE && body->buf) {
+		_ui_image_cache_remove(body);
+	}
 	UI_FREE(body);
 }
 
+static uint32_t _ui_read_u32(const uint8_t *p)
+{
+	// Image buffers are byte arrays, not aligned for uint32_t
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool _ui_rle_decode(const uint8_t *src, const uint8_t *src_end, uint8_t *dst, uint8_t *dst_end, uint32_t bytes_per_pixel)
+{
+	uint32_t count;
+	uint32_t len;
+
+	while (dst < dst_end) {
+		if (src >= src_end) {
+			return false;
+		}
+		count = (*src & 0x7f) + 1;
+		len = count * bytes_per_pixel;
+		if (len > (uint32_t)(dst_end - dst)) {
+			return false;
+		}
+
+		if (*src++ & 0x80) {
+			if (bytes_per_pixel > (uint32_t)(src_end - src)) {
+				return false;
+			}
+			while (count--) {
+				memcpy(dst, src, bytes_per_pixel);
+				dst += bytes_per_pixel;
+			}
+			src += bytes_per_pixel;
+		} else {
+			if (len > (uint32_t)(src_end - src)) {
+				return false;
+			}
+			memcpy(dst, src, len);
+			dst += len;
+			src += len;
+		}
+	}
+
+	return true;
+}
+
+static bool _ui_lz4_decode(const uint8_t *src, const uint8_t *src_end, uint8_t *dst, uint8_t *dst_end)
+{
+	uint8_t *out = dst;
+	const uint8_t *match;
+	uint32_t token;
+	uint32_t len;
+	uint32_t offset;
+
+	while (src < src_end) {
+		token = *src++;
+
+		// Literals
+		len = token >> 4;
+		if (len == 15) {
+			do {
+				if (src >= src_end) {
+					return false;
+				}
+				len += *src;
+			} while (*src++ == 255);
+		}
+		if (len > (uint32_t)(src_end - src) || len > (uint32_t)(dst_end - out)) {
+			return false;
+		}
+		memcpy(out, src, len);
+		out += len;
+		src += len;
+
+		// The last sequence has literals only
+		if (src >= src_end) {
+			break;
+		}
+
+		// Match, which may overlap the bytes it produces
+		if (src_end - src < 2) {
+			return false;
+		}
+		offset = src[0] | (src[1] << 8);
+		src += 2;
+		if (offset == 0 || offset > (uint32_t)(out - dst)) {
+			return false;
+		}
+		len = token & 0x0f;
+		if (len == 15) {
+			do {
+				if (src >= src_end) {
+					return false;
+				}
+				len += *src;
+			} while (*src++ == 255);
+		}
+		len += 4;
+		if (len > (uint32_t)(dst_end - out)) {
+			return false;
+		}
+		match = out - offset;
+		while (len--) {
+			*out++ = *match++;
+		}
+	}
+
+	return out == dst_end;
+}
+
+bool ui_image_asset_decode_row(void *image, int32_t y, uint8_t *row)
+{
+	ui_image_asset_body_t *body = (ui_image_asset_body_t *)image;
+	const uint8_t *rows;
+	const uint8_t *palette;
+	const uint8_t *index;
+	uint32_t bytes_per_pixel;
+	uint32_t colors;
+	uint32_t start;
+	uint32_t end;
+	int32_t x;
+
+	if (!body || !row || y < 0 || y >= body->height) {
+		return false;
+	}
+
+	bytes_per_pixel = body->bits_per_pixel >> 3;
+
+	switch (body->compression) {
+	case UI_IMAGE_COMPRESSION_NONE:
+		memcpy(row, body->buf + y * body->bytes_per_line, body->bytes_per_line);
+		return true;
+
+	case UI_IMAGE_COMPRESSION_RLE:
+	case UI_IMAGE_COMPRESSION_LZ4:
+		rows = body->data + (body->height + 1) * sizeof(uint32_t);
+		start = _ui_read_u32(body->data + y * sizeof(uint32_t));
+		end = _ui_read_u32(body->data + (y + 1) * sizeof(uint32_t));
+		if (start > end) {
+			return false;
+		}
+		if (body->compression == UI_IMAGE_COMPRESSION_RLE) {
+			return _ui_rle_decode(rows + start, rows + end, row, row + body->bytes_per_line, bytes_per_pixel);
+		}
+		return _ui_lz4_decode(rows + start, rows + end, row, row + body->bytes_per_line);
+
+	case UI_IMAGE_COMPRESSION_PALETTE:
+		colors = _ui_read_u32(body->data);
+		palette = body->data + sizeof(uint32_t);
+		index = palette + colors * bytes_per_pixel + y * body->width;
+		for (x = 0; x < body->width; x++) {
+			if (index[x] >= colors) {
+				return false;
+			}
+			memcpy(row, palette + index[x] * bytes_per_pixel, bytes_per_pixel);
+			row += bytes_per_pixel;
+		}
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+static void _ui_image_cache_remove(ui_image_asset_body_t *image)
+{
+	vec_remove(&g_image_cache, image);
+	g_image_cache_used -= image->bytes_per_line * image->height;
+	// The image may have been drawn by the 2D engine in this frame
+	ui_renderer_sync();
+	UI_FREE(image->buf);
+	image->draws = 0;
+}
+
+/**
+ * @brief Decode an image in the cache, making room by evicting the least recently drawn ones.
+ */
+static void _ui_image_cache_add(ui_image_asset_body_t *image)
+{
+	ui_image_asset_body_t *lru;
+	ui_image_asset_body_t *iter_image;
+	size_t size;
+	int32_t y;
+	int iter;
+
+	size = image->bytes_per_line * image->height;
+	if (size > CONFIG_UI_IMAGE_CACHE_SIZE) {
+		return;
+	}
+
+	while (g_image_cache_used + size > CONFIG_UI_IMAGE_CACHE_SIZE) {
+		lru = NULL;
+		vec_foreach(&g_image_cache, iter_image, iter) {
+			if (!lru || iter_image->last_used < lru->last_used) {
+				lru = iter_image;
+			}
+		}
+		if (!lru) {
+			return;
+		}
+		_ui_image_cache_remove(lru);
+	}
+
+	image->buf = (uint8_t *)UI_ALLOC(size);
+	if (!image->buf) {
+		return;
+	}
+
+	for (y = 0; y < image->height; y++) {
+		if (!ui_image_asset_decode_row(image, y, image->buf + y * image->bytes_per_line)) {
+			UI_LOGE("error: corrupted image data at row %d!\n", y);
+			UI_FREE(image->buf);
+			return;
+		}
+	}
+
+	if (vec_push(&g_image_cache, image) != UI_OK) {
+		UI_FREE(image->buf);
+		return;
+	}
+	g_image_cache_used += size;
+}
+
+uint8_t *ui_image_asset_get_pixels(ui_image_asset_body_t *image)
+{
+	if (!image) {
+		return NULL;
+	}
+
+	if (image->compression == UI_IMAGE_COMPRESSION_NONE) {
+		return image->buf;
+	}
+
+	image->last_used = ++g_image_cache_draws;
+	if (!image->buf && ++image->draws >= CONFIG_UI_IMAGE_CACHE_HOT_DRAWS) {
+		_ui_image_cache_add(image);
+	}
+
+	return image->buf;
+}
+
 ui_asset_t ui_image_asset_create_from_file(const char *filename)
 {
 	ui_image_asset_body_t *body;
@@ -31,6 +31,7 @@
 #include <vec/vec.h>
 #include <araui/ui_commons.h>
 #include <araui/ui_animation.h>
+#include <araui/ui_core.h>
 #include "ui_renderer.h"
 #include "ui_request_callback.h"
 #include "ui_debug.h"
@@ -50,14 +51,40 @@
 #define CONFIG_UI_GLOBAL_X_THRESHOLD     20
 #define CONFIG_UI_GLOBAL_Y_THRESHOLD     20
 
+// Rows drawn and sent to the display at once, 0 draws each redraw area at once
+#ifndef CONFIG_UI_TILE_HEIGHT
+#define CONFIG_UI_TILE_HEIGHT            0
+#endif
+
+// Longest wait of an idle frame for touch events, which are polled
+#ifndef CONFIG_UI_TOUCH_POLL_TIME
+#define CONFIG_UI_TOUCH_POLL_TIME        20
+#endif
+
+// Touch samples before the release giving the velocity of a fling
+#ifndef CONFIG_UI_TOUCH_VELOCITY_TIME
+#define CONFIG_UI_TOUCH_VELOCITY_TIME    100
+#endif
+
+#define UI_TOUCH_BATCH_SIZE              8
+#define UI_TOUCH_HISTORY_SIZE            8
+
 typedef struct {
 	ui_core_state_t state;
 	pthread_t pid;
 	pid_t caller_pid;
 	ui_quick_panel_event_type_t visible_event_type;
+	vec_void_t active_widgets;	//!< Widgets with an animation or a tick, interval or update callback
+	ui_frame_stats_t stats;
+	bool full_update;			//!< The whole screen is redrawn every frame, with CONFIG_UI_PARTIAL_UPDATE
 
 #if defined(CONFIG_UI_ENABLE_TOUCH)
 	ui_widget_body_t *locked_target;
+	ui_touch_sample_t history[UI_TOUCH_HISTORY_SIZE];	//!< Latest samples of the pressed touch
+	int32_t history_head;
+	int32_t history_count;
+	float velocity_x;
+	float velocity_y;
 #endif // CONFIG_UI_ENABLE_TOUCH
 } ui_core_t;
 
@@ -69,13 +96,21 @@ typedef struct {
 static ui_core_t g_core;
 static ui_widget_body_t *g_quick_panel_info[UI_QUICK_PANEL_TYPE_NUM];
 
-static ui_error_t _ui_process_widget(ui_widget_body_t *widget, uint32_t dt);
+static bool _ui_process_active_widgets(uint32_t dt, int32_t *deadline);
+static void _ui_core_activate_widget_func(void *userdata);
 static void _ui_call_anim_finished_cb(void *userdata);
 static void *_ui_core_thread_loop(void *param);
 static bool _ui_core_quick_panel_visible(void);
+static uint32_t _ui_core_get_time_us(void);
+static void _ui_core_reset_frame_stats_func(void *userdata);
+#if defined(CONFIG_UI_PARTIAL_UPDATE)
+static void _ui_core_set_full_update_func(void *userdata);
+#endif
 
 #if defined(CONFIG_UI_ENABLE_TOUCH)
-static void _ui_core_dispatch_touch_event(void);
+static bool _ui_core_dispatch_touch_event(void);
+static void _ui_core_add_touch_history(ui_touch_sample_t *sample);
+static void _ui_core_update_touch_velocity(void);
 static void _ui_core_handle_touch_event(ui_touch_event_t touch_event, ui_coord_t coord);
 static bool _ui_core_quick_panel_touch_down(ui_touch_event_t touch_event, ui_coord_t coord);
 #endif
@@ -113,6 +148,10 @@ ui_error_t ui_start(void)
 		g_quick_panel_info[idx] = NULL;
 	}
 
+	vec_init(&g_core.active_widgets);
+	memset(&g_core.stats, 0, sizeof(ui_frame_stats_t));
+	g_core.full_update = false;
+
 	if (pthread_attr_init(&attr)) {
 		ui_dal_deinit();
 		ui_window_list_deinit();
@@ -175,12 +214,15 @@ ui_error_t ui_stop(void)
 	}
 
 	g_core.state = UI_CORE_STATE_STOPPING;
+	ui_request_callback_wakeup();
 
 	if (pthread_join(g_core.pid, NULL) != OK) {
 		UI_LOGE("pthread_join failed.\n");
 		return UI_OPERATION_FAIL;
 	}
 
+	vec_deinit(&g_core.active_widgets);
+
 	if (ui_request_callback_deinit() != UI_OK) {
 		UI_LOGE("ui_request_callback_deinit failed.\n");
 		return UI_OPERATION_FAIL;
@@ -201,27 +243,83 @@ ui_error_t ui_stop(void)
 	return UI_OK;
 }
 
-static ui_error_t _ui_process_widget(ui_widget_body_t *widget, uint32_t dt)
+void ui_core_activate_widget(ui_widget_body_t *widget)
+{
+	if (widget && !widget->active) {
+		if (vec_push(&g_core.active_widgets, widget) != UI_OK) {
+			UI_LOGE("error: failed to add an active widget!\n");
+			return;
+		}
+		widget->active = true;
+	}
+}
+
+static void _ui_core_activate_widget_func(void *userdata)
+{
+	ui_core_activate_widget((ui_widget_body_t *)userdata);
+}
+
+ui_error_t ui_core_request_activate_widget(ui_widget_body_t *widget)
+{
+	if (!widget) {
+		return UI_INVALID_PARAM;
+	}
+
+	return ui_request_callback(_ui_core_activate_widget_func, widget);
+}
+
+void ui_core_deactivate_widget(ui_widget_body_t *widget)
+{
+	if (widget && widget->active) {
+		vec_remove(&g_core.active_widgets, widget);
+		widget->active = false;
+	}
+}
+
+static bool _ui_core_widget_shown(ui_widget_body_t *widget)
+{
+	ui_window_body_t *window;
+
+	while (widget->parent) {
+		widget = widget->parent;
+	}
+
+	window = ui_window_get_current();
+	if (window && window->root == widget) {
+		return true;
+	}
+
+	return _ui_core_quick_panel_visible() && g_quick_panel_info[g_core.visible_event_type] == widget;
+}
+
+/**
+ * @brief Run the animations and callbacks of the active widgets of the screen.
+ *
+ * Only the widgets which have any are visited, so a frame without them costs nothing. Widgets
+ * with nothing left to run leave the list. Returns whether one of them needs the next frame,
+ * and sets *deadline to the milliseconds before the nearest interval callback if it is sooner.
+ */
+static bool _ui_process_active_widgets(uint32_t dt, int32_t *deadline)
 {
 	int iter;
 	uint32_t temp;
 	ui_widget_body_t *curr_widget;
-	ui_widget_body_t *child;
 	ui_anim_body_t *anim;
+	bool busy = false;
 
-	if (!widget) {
-		UI_LOGE("Error: widget is null!\n");
-		return UI_INVALID_PARAM;
-	}
+	iter = 0;
+	while (iter < g_core.active_widgets.length) {
+		curr_widget = (ui_widget_body_t *)g_core.active_widgets.data[iter];
 
-	ui_widget_queue_init();
-	ui_widget_queue_enqueue(widget);
+		if (!curr_widget->anim && !curr_widget->tick_cb && !curr_widget->interval_cb && !curr_widget->update_cb) {
+			curr_widget->active = false;
+			vec_splice(&g_core.active_widgets, iter, 1);
+			continue;
+		}
+		iter++;
 
-	while (!ui_widget_is_queue_empty()) {
-		curr_widget = ui_widget_queue_dequeue();
-		if (!curr_widget) {
-			UI_LOGE("error: curr widget is NULL!\n");
-			return UI_OPERATION_FAIL;
+		if (!_ui_core_widget_shown(curr_widget)) {
+			continue;
 		}
 
 		anim = (ui_anim_body_t *)curr_widget->anim;
@@ -237,10 +335,12 @@ static ui_error_t _ui_process_widget(ui_widget_body_t *widget, uint32_t dt)
 					curr_widget->anim = UI_NULL;
 				}
 			}
+			busy = true;
 		}
 
 		if (curr_widget->tick_cb) {
 			curr_widget->tick_cb((ui_widget_t)curr_widget, dt);
+			busy = true;
 		}
 
 		if (curr_widget->interval_cb) {
@@ -249,20 +349,39 @@ static ui_error_t _ui_process_widget(ui_widget_body_t *widget, uint32_t dt)
 				curr_widget->interval_info.current -= curr_widget->interval_info.timeout;
 				curr_widget->interval_cb((ui_widget_t)curr_widget);
 			}
+			temp = 0;
+			if (curr_widget->interval_info.current < curr_widget->interval_info.timeout) {
+				temp = curr_widget->interval_info.timeout - curr_widget->interval_info.current;
+			}
+			if (*deadline < 0 || temp < (uint32_t)*deadline) {
+				*deadline = (int32_t)temp;
+			}
 		}
 
 		if (curr_widget->visible) {
 			if (curr_widget->update_cb) {
 				curr_widget->update_cb((ui_widget_t)curr_widget, dt);
+				busy = true;
 			}
 		}
+	}
 
-		vec_foreach(&curr_widget->children, child, iter) {
-			ui_widget_queue_enqueue(child);
+	return busy;
+}
+
+/**
+ * @brief Count the time the core thread slept in the interval callbacks of the screen.
+ */
+static void _ui_core_advance_intervals(uint32_t elapsed)
+{
+	ui_widget_body_t *curr_widget;
+	int iter;
+
+	vec_foreach(&g_core.active_widgets, curr_widget, iter) {
+		if (curr_widget->interval_cb && _ui_core_widget_shown(curr_widget)) {
+			curr_widget->interval_info.current += elapsed;
 		}
 	}
-
-	return UI_OK;
 }
 
 static ui_error_t _ui_render_widget(ui_widget_body_t *widget, ui_rect_t draw_area, uint32_t dt)
@@ -270,9 +389,7 @@ static ui_error_t _ui_render_widget(ui_widget_body_t *widget, ui_rect_t draw_are
 	int iter;
 	ui_widget_body_t *curr_widget;
 	ui_widget_body_t *child;
-#if defined(CONFIG_UI_PARTIAL_UPDATE)
 	ui_rect_t new_vp;
-#endif
 
 	if (!widget) {
 		UI_LOGE("Error: widget is null!\n");
@@ -290,9 +407,10 @@ static ui_error_t _ui_render_widget(ui_widget_body_t *widget, ui_rect_t draw_are
 		}
 
 		if (curr_widget->visible) {
-			if (curr_widget->render_cb) {
+			// Children are not clipped to their parent, so only the widget itself is culled
+			new_vp = ui_rect_intersect(draw_area, curr_widget->global_rect);
+			if (curr_widget->render_cb && new_vp.width > 0 && new_vp.height > 0) {
 #if defined(CONFIG_UI_PARTIAL_UPDATE)
-				new_vp = ui_rect_intersect(draw_area, curr_widget->global_rect);
 				ui_dal_set_viewport(new_vp.x, new_vp.y, new_vp.width, new_vp.height);
 				curr_widget->render_cb((ui_widget_t)curr_widget, dt);
 				ui_dal_set_viewport(draw_area.x, draw_area.y, draw_area.width, draw_area.height);
@@ -327,53 +445,82 @@ static void _ui_call_anim_finished_cb(void *userdata)
 	}
 }
 
-static void _ui_redraw(uint32_t dt)
+/**
+ * @brief Draw an area of the screen and send it to the display.
+ *
+ * With CONFIG_UI_TILE_HEIGHT, the area is drawn by bands of that many rows, each of them cleared,
+ * drawn and sent before the next one. The viewport is the band, so a DAL without a framebuffer
+ * for the whole screen can draw into a buffer of one band.
+ */
+static void _ui_redraw_area(ui_window_body_t *window, ui_rect_t area, uint32_t dt)
 {
-#if defined(CONFIG_UI_PARTIAL_UPDATE)
-	ui_rect_t *redraw_rect;
-	int iter;
+	ui_rect_t tile;
+	uint32_t flush_start;
+#if (CONFIG_UI_TILE_HEIGHT > 0)
+	const int32_t tile_height = CONFIG_UI_TILE_HEIGHT;
 #else
-	ui_rect_t redraw_rect;
+	const int32_t tile_height = area.height;
+#endif
+
+	tile = area;
+	for (tile.y = area.y; tile.y < area.y + area.height; tile.y += tile_height) {
+		tile.height = UI_MIN(tile_height, area.y + area.height - tile.y);
+		ui_dal_set_viewport(tile.x, tile.y, tile.width, tile.height);
+#if (CONFIG_UI_TILE_HEIGHT > 0)
+		ui_dal_clear();
 #endif
-	ui_window_body_t *window;
 
-#if defined(CONFIG_UI_PARTIAL_UPDATE)
-	vec_foreach(ui_window_get_redraw_list(), redraw_rect, iter) {
-		window = ui_window_get_current();
 		if (window) {
-			_ui_render_widget(window->root, *redraw_rect, dt);
+			_ui_render_widget(window->root, tile, dt);
 		}
 
 		if (_ui_core_quick_panel_visible()) {
-			_ui_render_widget(g_quick_panel_info[g_core.visible_event_type], *redraw_rect, dt);
+			_ui_render_widget(g_quick_panel_info[g_core.visible_event_type], tile, dt);
 		}
 
 		if (window || _ui_core_quick_panel_visible()) {
-			ui_dal_redraw(redraw_rect->x, redraw_rect->y, redraw_rect->width, redraw_rect->height);
+			flush_start = _ui_core_get_time_us();
+			// The 2D engine finishes the area before it is sent or its buffer is swapped
+			ui_renderer_sync();
+			ui_dal_redraw(tile.x, tile.y, tile.width, tile.height);
+			g_core.stats.flush_us += _ui_core_get_time_us() - flush_start;
+			g_core.stats.pixels += tile.width * tile.height;
 		}
 	}
+}
 
-	ui_window_redraw_list_clear();
+static void _ui_redraw(uint32_t dt)
+{
+#if defined(CONFIG_UI_PARTIAL_UPDATE)
+	ui_rect_t *redraw_rect;
+	int iter;
 #else
-	redraw_rect.x = 0;
-	redraw_rect.y = 0;
-	redraw_rect.width = CONFIG_UI_DISPLAY_WIDTH;
-	redraw_rect.height = CONFIG_UI_DISPLAY_HEIGHT;
-
-	ui_dal_set_viewport(redraw_rect.x, redraw_rect.y, redraw_rect.width, redraw_rect.height);
+	ui_rect_t redraw_rect;
+#endif
+	ui_window_body_t *window;
 
 	window = ui_window_get_current();
-	if (window) {
-		_ui_render_widget(window->root, redraw_rect, dt);
-	}
 
-	if (_ui_core_quick_panel_visible()) {
-		_ui_render_widget(g_quick_panel_info[g_core.visible_event_type], redraw_rect, dt);
+#if defined(CONFIG_UI_PARTIAL_UPDATE)
+	if (g_core.full_update) {
+		ui_window_redraw_list_clear();
+		_ui_redraw_area(window, (ui_rect_t){0, 0, CONFIG_UI_DISPLAY_WIDTH, CONFIG_UI_DISPLAY_HEIGHT}, dt);
+		return;
 	}
 
-	if (window || _ui_core_quick_panel_visible()) {
-		ui_dal_redraw(redraw_rect.x, redraw_rect.y, redraw_rect.width, redraw_rect.height);
+	// The rects were merged as they were added, so each pixel is drawn once
+	vec_foreach(ui_window_get_redraw_list(), redraw_rect, iter) {
+		_ui_redraw_area(window, *redraw_rect, dt);
 	}
+
+	ui_window_redraw_list_clear();
+#else
+	redraw_rect.x = 0;
+	redraw_rect.y = 0;
+	redraw_rect.width = CONFIG_UI_DISPLAY_WIDTH;
+	redraw_rect.height = CONFIG_UI_DISPLAY_HEIGHT;
+
+	_ui_redraw_area(window, redraw_rect, dt);
 #endif // CONFIG_UI_PARTIAL_UPDATE
 }
 
@@ -438,6 +585,13 @@ static void _ui_update_redraw_list(ui_widget_body_t *widget)
 	}
 }
 
+/**
+ * @brief The loop drawing the frames.
+ *
+ * When nothing on the screen animates or ticks and no request or touch event came, the loop
+ * sleeps until a request, the nearest interval callback or the next touch poll instead of
+ * drawing identical frames.
+ */
 static void *_ui_core_thread_loop(void *param)
 {
 	ui_widget_body_t *root;
@@ -445,6 +599,13 @@ static void *_ui_core_thread_loop(void *param)
 	struct timespec before;
 	struct timespec now;
 	uint32_t dt;
+	int32_t deadline = -1;
+	bool busy = true;
+	uint32_t frame_start;
+	uint32_t render_start;
+	uint32_t frame_end;
+	uint64_t flush_us;
+	uint64_t pixels;
 
 #if (CONFIG_UI_MAXIMUM_FPS > 0)
 	const uint32_t ms_per_frame = 1000 / CONFIG_UI_MAXIMUM_FPS;
@@ -456,8 +617,28 @@ static void *_ui_core_thread_loop(void *param)
 	clock_gettime(CLOCK_MONOTONIC, &before);
 
 	while (g_core.state == UI_CORE_STATE_RUNNING) {
+		if (!busy) {
+#if defined(CONFIG_UI_ENABLE_TOUCH)
+			if (deadline < 0 || deadline > CONFIG_UI_TOUCH_POLL_TIME) {
+				deadline = CONFIG_UI_TOUCH_POLL_TIME;
+			}
+#endif
+			ui_request_callback_wait(deadline);
+
+			// The sleep is not a frame, an animation started by a request begins from the wake up
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			_ui_core_advance_intervals(((now.tv_sec - before.tv_sec) * 1000) + ((now.tv_nsec - before.tv_nsec) / 1000000));
+			before = now;
+		}
+
+		render_start = _ui_core_get_time_us();
+		flush_us = g_core.stats.flush_us;
+		pixels = g_core.stats.pixels;
+
 		ui_dal_clear();
 
+		g_core.stats.render_us += _ui_core_get_time_us() - render_start;
+
 		clock_gettime(CLOCK_MONOTONIC, &now);
 
 		dt = ((now.tv_sec - before.tv_sec) * 1000) + ((now.tv_nsec - before.tv_nsec) / 1000000);
@@ -469,28 +650,44 @@ static void *_ui_core_thread_loop(void *param)
 		}
 #endif
 
+		frame_start = _ui_core_get_time_us();
+
+		deadline = -1;
+		busy = _ui_process_active_widgets(dt, &deadline);
+
 		window = ui_window_get_current();
 		if (window) {
 			root = window->root;
-
-			if (_ui_process_widget(root, dt) != UI_OK) {
-				UI_LOGE("error: processing widget recursively failed!\n");
-			}
 			_ui_update_redraw_list(root);
 		}
 
 		if (_ui_core_quick_panel_visible()) {
-			_ui_process_widget(g_quick_panel_info[g_core.visible_event_type], dt);
 			_ui_update_redraw_list(g_quick_panel_info[g_core.visible_event_type]);
 		}
 
+		render_start = _ui_core_get_time_us();
+		g_core.stats.process_us += render_start - frame_start;
+
 		_ui_redraw(dt);
 
+		frame_end = _ui_core_get_time_us();
+		g_core.stats.render_us += (frame_end - render_start) - (uint32_t)(g_core.stats.flush_us - flush_us);
+		if (g_core.stats.pixels != pixels) {
+			g_core.stats.frames++;
+			if (frame_end - frame_start > g_core.stats.max_frame_us) {
+				g_core.stats.max_frame_us = frame_end - frame_start;
+			}
+		}
+
 #if defined(CONFIG_UI_ENABLE_TOUCH)
-		_ui_core_dispatch_touch_event();
+		if (_ui_core_dispatch_touch_event()) {
+			busy = true;
+		}
 #endif
 
-		ui_process_all_requests();
+		if (ui_process_all_requests()) {
+			busy = true;
+		}
 	}
 
 	g_core.state = UI_CORE_STATE_STOP;
@@ -500,6 +697,64 @@ static void *_ui_core_thread_loop(void *param)
 	return NULL;
 }
 
+static uint32_t _ui_core_get_time_us(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec * 1000000) + (now.tv_nsec / 1000);
+}
+
+ui_error_t ui_core_get_frame_stats(ui_frame_stats_t *stats)
+{
+	if (!ui_is_running()) {
+		return UI_NOT_RUNNING;
+	}
+
+	if (!stats) {
+		return UI_INVALID_PARAM;
+	}
+
+	*stats = g_core.stats;
+
+	return UI_OK;
+}
+
+static void _ui_core_reset_frame_stats_func(void *userdata)
+{
+	memset(&g_core.stats, 0, sizeof(ui_frame_stats_t));
+}
+
+ui_error_t ui_core_reset_frame_stats(void)
+{
+	if (!ui_is_running()) {
+		return UI_NOT_RUNNING;
+	}
+
+	return ui_request_callback(_ui_core_reset_frame_stats_func, NULL);
+}
+
+#if defined(CONFIG_UI_PARTIAL_UPDATE)
+static void _ui_core_set_full_update_func(void *userdata)
+{
+	g_core.full_update = (userdata != NULL);
+}
+#endif
+
+ui_error_t ui_core_set_full_update(bool full)
+{
+	if (!ui_is_running()) {
+		return UI_NOT_RUNNING;
+	}
+
+#if defined(CONFIG_UI_PARTIAL_UPDATE)
+	return ui_request_callback(_ui_core_set_full_update_func, full ? (void *)&g_core : NULL);
+#else
+	return full ? UI_OK : UI_OPERATION_FAIL;
+#endif
+}
+
 bool ui_is_running(void)
 {
 	return (g_core.state != UI_CORE_STATE_STOP);
@@ -646,24 +901,119 @@ static void _ui_core_handle_touch_event(ui_touch_event_t touch_event, ui_coord_t
 	}
 }
 
-static void _ui_core_dispatch_touch_event(void)
+static void _ui_core_add_touch_history(ui_touch_sample_t *sample)
+{
+	g_core.history[g_core.history_head] = *sample;
+	g_core.history_head = (g_core.history_head + 1) % UI_TOUCH_HISTORY_SIZE;
+	if (g_core.history_count < UI_TOUCH_HISTORY_SIZE) {
+		g_core.history_count++;
+	}
+}
+
+/**
+ * @brief Compute the velocity from the oldest sample of the history recent enough to the newest one.
+ */
+static void _ui_core_update_touch_velocity(void)
+{
+	ui_touch_sample_t *newest;
+	ui_touch_sample_t *oldest;
+	ui_touch_sample_t *sample;
+	int32_t idx;
+	int32_t i;
+
+	g_core.velocity_x = 0.0f;
+	g_core.velocity_y = 0.0f;
+
+	if (g_core.history_count < 2) {
+		return;
+	}
+
+	newest = &g_core.history[(g_core.history_head + UI_TOUCH_HISTORY_SIZE - 1) % UI_TOUCH_HISTORY_SIZE];
+	oldest = newest;
+	for (i = 1; i < g_core.history_count; i++) {
+		idx = (g_core.history_head + UI_TOUCH_HISTORY_SIZE - 1 - i) % UI_TOUCH_HISTORY_SIZE;
+		sample = &g_core.history[idx];
+		if (newest->time - sample->time > CONFIG_UI_TOUCH_VELOCITY_TIME) {
+			break;
+		}
+		oldest = sample;
+	}
+
+	if (newest->time == oldest->time) {
+		return;
+	}
+
+	g_core.velocity_x = (float)(newest->coord.x - oldest->coord.x) / (newest->time - oldest->time);
+	g_core.velocity_y = (float)(newest->coord.y - oldest->coord.y) / (newest->time - oldest->time);
+}
+
+void ui_core_get_touch_velocity(float *x, float *y)
+{
+	if (x) {
+		*x = g_core.velocity_x;
+	}
+	if (y) {
+		*y = g_core.velocity_y;
+	}
+}
+
+/**
+ * @brief Read the touch samples queued since the last frame and deliver them.
+ *
+ * Moves in between are coalesced in one, at the latest position, presses and releases are all
+ * delivered in order. All samples go in the history giving the velocity at the release.
+ */
+static bool _ui_core_dispatch_touch_event(void)
 {
 	static ui_touch_state_t before = {false, };
-	static ui_touch_state_t cur = {false, };
+	ui_touch_sample_t samples[UI_TOUCH_BATCH_SIZE];
+	struct timespec now;
+	bool touched = false;
+	bool moved = false;
+	int32_t count;
+	int32_t i;
+
+	do {
+		count = ui_dal_get_touch_samples(samples, UI_TOUCH_BATCH_SIZE);
+		for (i = 0; i < count; i++) {
+			touched = true;
+			if (!samples[i].time) {
+				clock_gettime(CLOCK_MONOTONIC, &now);
+				samples[i].time = (now.tv_sec * 1000) + (now.tv_nsec / 1000000);
+			}
 
-	while (ui_dal_get_touch(&cur.pressed, &cur.coord)) {
-		if (cur.pressed != before.pressed) {
-			if (cur.pressed) {
-				_ui_core_handle_touch_event(UI_TOUCH_EVENT_DOWN, cur.coord);
-			} else {
-				_ui_core_handle_touch_event(UI_TOUCH_EVENT_UP, cur.coord);
+			if (samples[i].pressed != before.pressed) {
+				if (moved) {
+					_ui_core_handle_touch_event(UI_TOUCH_EVENT_MOVE, before.coord);
+					moved = false;
+				}
+				if (samples[i].pressed) {
+					g_core.history_count = 0;
+					_ui_core_add_touch_history(&samples[i]);
+					_ui_core_handle_touch_event(UI_TOUCH_EVENT_DOWN, samples[i].coord);
+				} else {
+					_ui_core_add_touch_history(&samples[i]);
+					_ui_core_update_touch_velocity();
+					_ui_core_handle_touch_event(UI_TOUCH_EVENT_UP, samples[i].coord);
+				}
+			} else if ((samples[i].coord.x != before.coord.x) || (samples[i].coord.y != before.coord.y)) {
+				if (samples[i].pressed) {
+					_ui_core_add_touch_history(&samples[i]);
+				}
+				moved = true;
 			}
-		} else if ((cur.coord.x != before.coord.x) || (cur.coord.y != before.coord.y)) {
-			_ui_core_handle_touch_event(UI_TOUCH_EVENT_MOVE, cur.coord);
+
+			before.pressed = samples[i].pressed;
+			before.coord = samples[i].coord;
 		}
+	} while (count == UI_TOUCH_BATCH_SIZE);
 
-		before = cur;
+	if (moved) {
+		_ui_core_handle_touch_event(UI_TOUCH_EVENT_MOVE, before.coord);
 	}
+
+	// A pressed touch keeps the frames going, for the widgets following it
+	return touched || before.pressed;
 }
 
 void ui_core_lock_touch_event_target(ui_widget_body_t *target)
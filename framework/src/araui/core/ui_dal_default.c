@@ -49,6 +49,21 @@ UI_DAL void ui_dal_put_pixel_rgb888(int32_t x, int32_t y, ui_color_t color)
 
 }
 
+UI_DAL void ui_dal_put_span_rgba8888(int32_t x, int32_t y, const uint8_t *pixels, int32_t count)
+{
+
+}
+
+UI_DAL void ui_dal_put_span_rgb888(int32_t x, int32_t y, const uint8_t *pixels, int32_t count)
+{
+
+}
+
+UI_DAL void ui_dal_put_span_a8(int32_t x, int32_t y, const uint8_t *alpha, int32_t count, ui_color_t color)
+{
+
+}
+
 UI_DAL ui_error_t ui_dal_set_viewport(int32_t x, int32_t y, int32_t width, int32_t height)
 {
 	return UI_OK;
@@ -61,9 +76,29 @@ UI_DAL ui_rect_t ui_dal_get_viewport(void)
 
 #if defined(CONFIG_UI_ENABLE_TOUCH)
 
-UI_DAL bool ui_dal_get_touch(bool *pressed, ui_coord_t *coord)
+UI_DAL int32_t ui_dal_get_touch_samples(ui_touch_sample_t *samples, int32_t count)
 {
-	return false;
+	return 0;
 }
 
 #endif // CONFIG_UI_ENABLE_TOUCH
+
+#if defined(CONFIG_UI_ENABLE_HW_ACC)
+
+UI_DAL bool ui_dal_hw_fill_rect(int32_t x, int32_t y, int32_t width, int32_t height, ui_color_t color)
+{
+	return false;
+}
+
+UI_DAL bool ui_dal_hw_blit(int32_t x, int32_t y, const uint8_t *bitmap, int32_t stride,
+	int32_t width, int32_t height, ui_pixel_format_t pf, ui_color_t color)
+{
+	return false;
+}
+
+UI_DAL void ui_dal_hw_sync(void)
+{
+
+}
+
+#endif // CONFIG_UI_ENABLE_HW_ACC
@@ -373,6 +373,10 @@ ui_widget_t ui_quick_panel_create(ui_transition_type_t transition_type)
 	body->base.update_cb = ui_quick_panel_update_func;
 	body->transition_type = transition_type;
 
+	if (ui_core_request_activate_widget((ui_widget_body_t *)body) != UI_OK) {
+		UI_LOGE("error: failed to activate the quick panel!\n");
+	}
+
 	return (ui_widget_t)body;
 }
 
@@ -18,6 +18,8 @@
 
 
 #include <pthread.h>
+#include <time.h>
+#include <errno.h>
 #include <vec/vec.h>
 #include <araui/ui_commons.h>
 #include "ui_request_callback.h"
@@ -29,6 +31,8 @@ typedef struct {
 
 static vec_void_t g_reqcb_list;
 static pthread_mutex_t g_mutex;
+static pthread_cond_t g_cond;
+static bool g_wakeup;
 
 ui_error_t ui_request_callback_init(void)
 {
@@ -36,6 +40,12 @@ ui_error_t ui_request_callback_init(void)
 		return UI_INIT_FAILURE;
 	}
 
+	if (pthread_cond_init(&g_cond, NULL)) {
+		pthread_mutex_destroy(&g_mutex);
+		return UI_INIT_FAILURE;
+	}
+	g_wakeup = false;
+
 	pthread_mutex_lock(&g_mutex);
 	vec_init(&g_reqcb_list);
 	pthread_mutex_unlock(&g_mutex);
@@ -48,6 +58,7 @@ ui_error_t ui_request_callback_deinit(void)
 	pthread_mutex_lock(&g_mutex);
 	vec_deinit(&g_reqcb_list);
 	pthread_mutex_unlock(&g_mutex);
+	pthread_cond_destroy(&g_cond);
 	pthread_mutex_destroy(&g_mutex);
 
 	return UI_OK;
@@ -76,18 +87,61 @@ ui_error_t ui_request_callback(request_callback request_cb, void *userdata)
 		return UI_OPERATION_FAIL;
 	}
 
+	pthread_cond_signal(&g_cond);
 	pthread_mutex_unlock(&g_mutex);
 
 	return UI_OK;
 }
 
-void ui_process_all_requests(void)
+ui_error_t ui_request_callback_wait(int32_t timeout_ms)
+{
+	struct timespec abstime;
+	int ret = 0;
+
+	if (timeout_ms >= 0) {
+		clock_gettime(CLOCK_REALTIME, &abstime);
+		abstime.tv_sec += timeout_ms / 1000;
+		abstime.tv_nsec += (timeout_ms % 1000) * 1000000;
+		if (abstime.tv_nsec >= 1000000000) {
+			abstime.tv_sec++;
+			abstime.tv_nsec -= 1000000000;
+		}
+	}
+
+	pthread_mutex_lock(&g_mutex);
+
+	while (g_reqcb_list.length == 0 && !g_wakeup && ret != ETIMEDOUT) {
+		if (timeout_ms >= 0) {
+			ret = pthread_cond_timedwait(&g_cond, &g_mutex, &abstime);
+		} else {
+			pthread_cond_wait(&g_cond, &g_mutex);
+		}
+	}
+	g_wakeup = false;
+
+	pthread_mutex_unlock(&g_mutex);
+
+	return (ret == ETIMEDOUT) ? UI_OPERATION_FAIL : UI_OK;
+}
+
+void ui_request_callback_wakeup(void)
+{
+	pthread_mutex_lock(&g_mutex);
+	g_wakeup = true;
+	pthread_cond_signal(&g_cond);
+	pthread_mutex_unlock(&g_mutex);
+}
+
+bool ui_process_all_requests(void)
 {
 	request_item_t *item;
+	bool processed;
 	int iter;
 
 	pthread_mutex_lock(&g_mutex);
 
+	processed = (g_reqcb_list.length > 0);
+
 	// Below logic will work correctly.
 	// Actually, in the request_cb function, a new request callback can be added.
 	// But it will be added only at the end of the vector.
@@ -101,4 +155,6 @@ void ui_process_all_requests(void)
 
 	vec_clear(&g_reqcb_list);
 	pthread_mutex_unlock(&g_mutex);
+
+	return processed;
 }
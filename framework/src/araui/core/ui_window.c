@@ -40,6 +40,7 @@ static void _ui_window_create_func(void *userdata);
 static void _ui_window_destroy_func(void *userdata);
 #if defined(CONFIG_UI_PARTIAL_UPDATE)
 static ui_rect_t *_ui_window_get_mempool_rect(void);
+static bool _ui_window_rect_mergeable(ui_rect_t r1, ui_rect_t r2);
 #endif
 
 ui_error_t ui_window_list_init(void)
@@ -254,12 +255,33 @@ vec_void_t *ui_window_get_redraw_list(void)
 	return &g_window_redraw_list;
 }
 
+/**
+ * @brief Whether drawing the bounding box of two rects costs about as much as drawing both.
+ *
+ * Overlapping and touching rects are always merged, the others when the box wastes
+ * at most a quarter of its area.
+ */
+static bool _ui_window_rect_mergeable(ui_rect_t r1, ui_rect_t r2)
+{
+	ui_rect_t ret;
+	int32_t area;
+
+	ret = ui_rect_intersect(r1, r2);
+	if (ret.x != 0 || ret.y != 0 || ret.width != 0 || ret.height != 0) {
+		return true;
+	}
+
+	ret = ui_get_contain_rect(r1, r2);
+	area = (r1.width * r1.height) + (r2.width * r2.height);
+
+	return (area * 4) >= (ret.width * ret.height * 3);
+}
+
 ui_error_t ui_window_add_redraw_list(ui_rect_t redraw_rect)
 {
 	ui_rect_t *window;
 	ui_rect_t *new_area;
-	ui_rect_t previous;
-	ui_rect_t ret;
+	bool merged;
 	int iter;
 
 	if (redraw_rect.x < 0) {
@@ -280,48 +302,43 @@ ui_error_t ui_window_add_redraw_list(ui_rect_t redraw_rect)
 		return UI_OK;
 	}
 
-	new_area = _ui_window_get_mempool_rect();
-
-	new_area->x = redraw_rect.x;
-	new_area->y = redraw_rect.y;
-	new_area->width = redraw_rect.width;
-	new_area->height = redraw_rect.height;
-
-	if (new_area->x + new_area->width >= CONFIG_UI_DISPLAY_WIDTH) {
-		new_area->width = CONFIG_UI_DISPLAY_WIDTH - new_area->x;
+	if (redraw_rect.x + redraw_rect.width >= CONFIG_UI_DISPLAY_WIDTH) {
+		redraw_rect.width = CONFIG_UI_DISPLAY_WIDTH - redraw_rect.x;
 	}
-	if (new_area->y + new_area->height >= CONFIG_UI_DISPLAY_HEIGHT) {
-		new_area->height = CONFIG_UI_DISPLAY_HEIGHT - new_area->y;
+	if (redraw_rect.y + redraw_rect.height >= CONFIG_UI_DISPLAY_HEIGHT) {
+		redraw_rect.height = CONFIG_UI_DISPLAY_HEIGHT - redraw_rect.y;
 	}
 
-	vec_foreach(&g_window_redraw_list, window, iter) {
-		// window is whole screen case
-		if ((window->x == 0) && (window->y == 0) &&
-			(window->width == CONFIG_UI_DISPLAY_WIDTH) &&
-			(window->height == CONFIG_UI_DISPLAY_HEIGHT)) {
-			return UI_OK;
+	// A merged rect is larger and may now reach rects checked before, so scan again after each merge
+	do {
+		merged = false;
+		vec_foreach(&g_window_redraw_list, window, iter) {
+			// window is whole screen case
+			if ((window->x == 0) && (window->y == 0) &&
+				(window->width == CONFIG_UI_DISPLAY_WIDTH) &&
+				(window->height == CONFIG_UI_DISPLAY_HEIGHT)) {
+				return UI_OK;
+			}
+
+			if (_ui_window_rect_mergeable(*window, redraw_rect)) {
+				redraw_rect = ui_get_contain_rect(*window, redraw_rect);
+				vec_splice(&g_window_redraw_list, iter, 1);
+				merged = true;
+				break;
+			}
 		}
+	} while (merged);
 
-		previous.x = window->x;
-		previous.y = window->y;
-		previous.width = window->width;
-		previous.height = window->height;
-
-		ret = ui_rect_intersect(previous, *new_area);
-		if (ret.x == 0 && ret.y == 0 && ret.width == 0 && ret.height == 0) {
-			continue;
+	// The list holds one rect of the pool each, so a full list becomes its bounding box
+	if (g_window_redraw_list.length >= CONFIG_UI_UPDATE_MEMPOOL_SIZE) {
+		vec_foreach(&g_window_redraw_list, window, iter) {
+			redraw_rect = ui_get_contain_rect(*window, redraw_rect);
 		}
-
-		ret = ui_get_contain_rect(previous, *new_area);
-		new_area->x = ret.x;
-		new_area->y = ret.y;
-		new_area->width = ret.width;
-		new_area->height = ret.height;
-
-		vec_remove(&g_window_redraw_list, window);
-		iter--;
+		vec_clear(&g_window_redraw_list);
 	}
 
+	new_area = _ui_window_get_mempool_rect();
+	*new_area = redraw_rect;
 	vec_push(&g_window_redraw_list, new_area);
 
 	return UI_OK;
@@ -334,14 +351,32 @@ ui_error_t ui_window_redraw_list_clear(void)
 	return UI_OK;
 }
 
+/**
+ * @brief Get a rect of the pool which is not in the redraw list.
+ *
+ * The list is kept shorter than the pool, so there is always one.
+ */
 static ui_rect_t *_ui_window_get_mempool_rect(void)
 {
-	int alloc_idx = g_rect_mempool_idx;
+	ui_rect_t *rect;
+	int alloc_idx;
+	int iter;
 
-	g_rect_mempool_idx++;
-	if (g_rect_mempool_idx >= CONFIG_UI_UPDATE_MEMPOOL_SIZE) {
-		g_rect_mempool_idx = 0;
-	}
+	do {
+		alloc_idx = g_rect_mempool_idx;
+
+		g_rect_mempool_idx++;
+		if (g_rect_mempool_idx >= CONFIG_UI_UPDATE_MEMPOOL_SIZE) {
+			g_rect_mempool_idx = 0;
+		}
+
+		iter = 0;
+		vec_foreach(&g_window_redraw_list, rect, iter) {
+			if (rect == &g_rect_mempool[alloc_idx]) {
+				break;
+			}
+		}
+	} while (iter < g_window_redraw_list.length);
 
 	return &g_rect_mempool[alloc_idx];
 }
@@ -67,6 +67,8 @@ UI_DAL void ui_dal_redraw(int32_t x, int32_t y, int32_t width, int32_t height);
  * @brief ui_dal_clear()
  *
  * Clear the screen with zero value
+ * With CONFIG_UI_TILE_HEIGHT, it is also called before each band is drawn, right after
+ * ui_dal_set_viewport() with the band, so a DAL drawing into a buffer of one band clears that buffer.
  *
  */
 UI_DAL void ui_dal_clear(void);
@@ -95,6 +97,49 @@ UI_DAL void ui_dal_put_pixel_rgba8888(int32_t x, int32_t y, ui_color_t color);
  */
 UI_DAL void ui_dal_put_pixel_rgb888(int32_t x, int32_t y, ui_color_t color);
 
+/**
+ * @brief ui_dal_put_span_rgba8888()
+ *
+ * Blend a horizontal run of RGBA8888 pixels from (x, y) to the right.
+ * The result is the same as ui_dal_put_pixel_rgba8888() called for each pixel.
+ *
+ * @param[in] x x coordinate of the first pixel
+ * @param[in] y y coordinate of the pixels
+ * @param[in] pixels Pixels, 4 bytes in R, G, B, A order each
+ * @param[in] count Number of the pixels
+ *
+ */
+UI_DAL void ui_dal_put_span_rgba8888(int32_t x, int32_t y, const uint8_t *pixels, int32_t count);
+
+/**
+ * @brief ui_dal_put_span_rgb888()
+ *
+ * Copy a horizontal run of RGB888 pixels from (x, y) to the right.
+ * The result is the same as ui_dal_put_pixel_rgb888() called for each pixel.
+ *
+ * @param[in] x x coordinate of the first pixel
+ * @param[in] y y coordinate of the pixels
+ * @param[in] pixels Pixels, 3 bytes in R, G, B order each
+ * @param[in] count Number of the pixels
+ *
+ */
+UI_DAL void ui_dal_put_span_rgb888(int32_t x, int32_t y, const uint8_t *pixels, int32_t count);
+
+/**
+ * @brief ui_dal_put_span_a8()
+ *
+ * Blend a horizontal run of one color from (x, y) to the right, with an alpha value for each pixel.
+ * The result is the same as ui_dal_put_pixel_rgba8888() called with the color and each alpha value.
+ *
+ * @param[in] x x coordinate of the first pixel
+ * @param[in] y y coordinate of the pixels
+ * @param[in] alpha Alpha values, 1 byte each
+ * @param[in] count Number of the pixels
+ * @param[in] color Color of the pixels as the renderer fill color, 0xRRGGBB
+ *
+ */
+UI_DAL void ui_dal_put_span_a8(int32_t x, int32_t y, const uint8_t *alpha, int32_t count, ui_color_t color);
+
 /**
  * @brief ui_dal_set_viewport()
  *
@@ -123,44 +168,80 @@ UI_DAL ui_rect_t ui_dal_get_viewport(void);
 
 #if defined(CONFIG_UI_ENABLE_TOUCH)
 
+typedef struct {
+	bool pressed;      //!< True if the touchscreen is pressed
+	ui_coord_t coord;  //!< Coordinate of touch position
+	uint32_t time;     //!< Time of the sample in milliseconds of the system timer, 0 if not known
+} ui_touch_sample_t;
+
 /**
- * @brief ui_dal_get_touch()
+ * @brief ui_dal_get_touch_samples()
  *
- * Get current touch status.
+ * Get the touch samples queued since the last call, oldest first.
+ * The UI core reads them once a frame, moves in between presses and releases may be coalesced
+ * by the touchscreen driver, the time of the samples gives the velocity of a fling.
  *
- * @param[out] pressed True if the touchscreen is pressed
- * @param[out] coord Coordinate of touch position
+ * @param[out] samples Array of count samples
+ * @param[in] count Maximum number of samples to get
  *
- * @return After get the touch event, if the touch event queue is empty, false is returned. Otherwise, true is returned.
+ * @return The number of samples got, 0 if the touch event queue is empty.
  *
  */
-UI_DAL bool ui_dal_get_touch(bool *pressed, ui_coord_t *coord);
+UI_DAL int32_t ui_dal_get_touch_samples(ui_touch_sample_t *samples, int32_t count);
 
 #endif // CONFIG_UI_ENABLE_TOUCH
 
 #if defined(CONFIG_UI_ENABLE_HW_ACC)
 
-#if defined(CONFIG_UI_ENABLE_HW_ACC_CHROM_ART)
-
 /**
- * @brief ui_dal_draw_bitmap_dma2d()
+ * @brief ui_dal_hw_fill_rect()
+ *
+ * Fill a rectangle with one color on the 2D engine of the display, such as DMA2D or the PPE.
+ * The rectangle is clipped to the viewport, as the CPU drawing is.
+ * The hardware functions may return before the engine is done, the renderer calls ui_dal_hw_sync()
+ * before it draws with the CPU, and the core before ui_dal_redraw() sends the area.
  *
- * Draw the original image with the given information via DMA2D acceleration.
- * This function is called when the image has no any transform such as translation, rotation, scaling.
- * If the image has transform, the image is drew by renderer via ui_dal_put_pixel function.
+ * @param[in] x x coordinate of the rectangle
+ * @param[in] y y coordinate of the rectangle
+ * @param[in] width Width of the rectangle
+ * @param[in] height Height of the rectangle
+ * @param[in] color Color of the rectangle as the renderer fill color, 0xRRGGBB
  *
- * @param[in] x x coordinate of the origin point
- * @param[in] y y coordinate of the origin point
- * @param[in] bitmap Bitmap buffer pointer
- * @param[in] width Width of the bitmap
- * @param[in] height Height of the bitmap
+ * @return true if the engine took the operation, false to have it drawn by the CPU.
+ *
+ */
+UI_DAL bool ui_dal_hw_fill_rect(int32_t x, int32_t y, int32_t width, int32_t height, ui_color_t color);
+
+/**
+ * @brief ui_dal_hw_blit()
+ *
+ * Draw a rectangle of a bitmap to (x, y) on the 2D engine, converted to the pixel format of the display.
+ * RGB888 pixels are copied, RGBA8888 pixels are blended, and A8 pixels blend the color with their alpha.
+ * The result is the same as the ui_dal_put_span functions called for each row.
+ * The bitmap must stay valid until ui_dal_hw_sync() returns.
+ *
+ * @param[in] x x coordinate of the first pixel
+ * @param[in] y y coordinate of the first pixel
+ * @param[in] bitmap First pixel of the rectangle in the bitmap
+ * @param[in] stride Bytes from a row of the bitmap to the next one
+ * @param[in] width Width of the rectangle
+ * @param[in] height Height of the rectangle
  * @param[in] pf Pixel format of the bitmap
+ * @param[in] color Color of A8 pixels as the renderer fill color, 0xRRGGBB
+ *
+ * @return true if the engine took the operation, false to have it drawn by the CPU.
  *
  */
-UI_DAL void ui_dal_draw_bitmap_dma2d(int32_t x, int32_t y,
-    uint8_t *bitmap, int32_t width, int32_t height, ui_pixel_format_t pf);
+UI_DAL bool ui_dal_hw_blit(int32_t x, int32_t y, const uint8_t *bitmap, int32_t stride,
+    int32_t width, int32_t height, ui_pixel_format_t pf, ui_color_t color);
 
-#endif // CONFIG_UI_ENABLE_HW_ACC_CHROM_ART
+/**
+ * @brief ui_dal_hw_sync()
+ *
+ * Wait until the 2D engine has done all of the operations it took.
+ *
+ */
+UI_DAL void ui_dal_hw_sync(void);
 
 #endif // CONFIG_UI_ENABLE_HW_ACC
 
@@ -27,7 +27,7 @@
 
 typedef struct ui_anim_body_s ui_anim_body_t;
 typedef bool (*ui_anim_func)(ui_widget_t widget, ui_anim_t anim, uint32_t *dt);
-typedef float (*ui_intrp_func)(float t, float b, float c, float d);
+typedef int32_t (*ui_intrp_func)(uint32_t t, int32_t b, int32_t c, uint32_t d);
 
 typedef enum {
 	UI_MOVE_ANIM,
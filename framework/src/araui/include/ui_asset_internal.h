@@ -32,6 +32,23 @@ typedef struct {
 	ui_asset_type_t type;
 } ui_asset_body_t;
 
+/**
+ * @brief Encoding of the pixels of an image asset buffer.
+ *
+ * RLE and LZ4 data start with the offsets of the (height + 1) rows in the data following them,
+ * as uint32_t, and each row is compressed on its own, so any row is decoded alone.
+ * A RLE row is packets of a byte n then n + 1 pixels if n < 128, or a pixel repeated n - 127 times.
+ * A LZ4 row is a LZ4 block.
+ * Palette data is the number of colors as uint32_t, the colors in the pixel format of the image,
+ * then an 8 bit index per pixel.
+ */
+typedef enum {
+	UI_IMAGE_COMPRESSION_NONE,
+	UI_IMAGE_COMPRESSION_RLE,
+	UI_IMAGE_COMPRESSION_LZ4,
+	UI_IMAGE_COMPRESSION_PALETTE
+} ui_image_compression_t;
+
 typedef struct {
 	ui_asset_body_t base;
 
@@ -41,8 +58,13 @@ typedef struct {
 	ui_pixel_format_t pixel_format;
 	uint32_t bytes_per_line;
 	uint16_t bits_per_pixel;
-	uint8_t *buf;
+	uint8_t *buf;            //!< Pixels, or the decoded ones in the image cache, NULL when not cached
 	bool from_buf;
+
+	ui_image_compression_t compression;
+	const uint8_t *data;     //!< Compressed pixels
+	uint32_t draws;          //!< Draws since it was last cached
+	uint32_t last_used;      //!< Value of the draw counter of the cache at the last draw
 } ui_image_asset_body_t;
 
 typedef struct {
@@ -52,14 +74,66 @@ typedef struct {
 	ui_pixel_format_t pf;
 	uint32_t header_size;
 	uint32_t data_size;
-	int32_t reserved[8];
+	uint32_t compression;  //!< ui_image_compression_t
+	int32_t reserved[7];
 } ui_bitmap_data_t;
 
+#define UI_FONT_ATLAS_MAGIC 0x41464955 //!< "UIFA"
+
+/**
+ * @brief Header of a font atlas, followed by its glyphs sorted by code and its A8 texture.
+ */
+typedef struct {
+	uint32_t magic;
+	int32_t font_size;     //!< Pixel height the glyphs are rasterized at
+	int32_t width;         //!< Width of the texture
+	int32_t height;        //!< Height of the texture
+	uint32_t glyph_count;
+	uint32_t reserved;
+} ui_font_atlas_t;
+
+typedef struct {
+	uint32_t code;
+	uint16_t x;            //!< Position of the glyph in the texture
+	uint16_t y;
+	uint16_t width;
+	uint16_t height;
+	int32_t y_offset;      //!< Top of the glyph from the baseline
+} ui_font_atlas_glyph_t;
+
+/**
+ * @brief A glyph to draw, a rect of a A8 texture.
+ */
+typedef struct {
+	const uint8_t *texture;
+	int32_t tex_width;
+	int32_t tex_height;
+	int32_t x;
+	int32_t y;
+	int32_t width;
+	int32_t height;
+	int32_t y_offset;
+} ui_glyph_t;
+
+typedef struct {
+	uint32_t code;
+	int32_t font_size;
+	uint32_t last_used;    //!< Value of the use counter of the font at the last use, 0 if empty
+	int32_t width;
+	int32_t height;
+	int32_t y_offset;
+	uint8_t *bitmap;
+} ui_glyph_cache_entry_t;
+
 typedef struct {
 	ui_asset_body_t base;
 	bool from_buf;
 	stbtt_fontinfo ttf_info;
 	uint8_t *ttf_buf;
+	const ui_font_atlas_t *atlas;
+	ui_glyph_cache_entry_t *glyph_cache;
+	uint32_t glyph_uses;
+	ui_font_glyph_stats_t glyph_stats;
 } ui_font_asset_body_t;
 
 #ifdef __cplusplus
@@ -69,6 +143,18 @@ extern "C" {
 bool ui_asset_check_type(ui_asset_t asset, ui_asset_type_t type);
 bool ui_image_asset_has_alpha(ui_pixel_format_t format);
 
+/**
+ * @brief Get the pixels of an image, NULL if it is compressed and not decoded in the cache.
+ * An image drawn CONFIG_UI_IMAGE_CACHE_HOT_DRAWS times is decoded in the cache if it fits in it.
+ */
+uint8_t *ui_image_asset_get_pixels(ui_image_asset_body_t *image);
+
+/**
+ * @brief Decode the row y of an image to row, bytes_per_line long.
+ */
+bool ui_image_asset_decode_row(void *image, int32_t y, uint8_t *row);
+ui_error_t ui_font_asset_get_glyph(ui_font_asset_body_t *font, uint32_t code, int32_t font_size, ui_glyph_t *glyph);
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,6 +36,16 @@ extern "C" {
 
 bool ui_is_running(void);
 
+/**
+ * @brief A widget with an animation or a tick, interval or update callback must be activated to
+ * have them run. It is deactivated by itself once it has none of them anymore.
+ * ui_core_activate_widget() and ui_core_deactivate_widget() must be called in the UI thread,
+ * ui_core_request_activate_widget() from any thread.
+ */
+void ui_core_activate_widget(ui_widget_body_t *widget);
+ui_error_t ui_core_request_activate_widget(ui_widget_body_t *widget);
+void ui_core_deactivate_widget(ui_widget_body_t *widget);
+
 #if defined(CONFIG_UI_ENABLE_TOUCH)
 
 /**
@@ -48,6 +58,13 @@ void ui_core_unlock_touch_event_target(void);
 
 void ui_core_unlock_and_deliver_touch(ui_widget_body_t *body,ui_touch_event_t touch_event, ui_coord_t touch);
 
+/**
+ * @brief Get the velocity of the touch at its last release, in pixels per millisecond.
+ * Only the samples of the last CONFIG_UI_TOUCH_VELOCITY_TIME milliseconds before the release count,
+ * so a touch held still before its release has no velocity.
+ */
+void ui_core_get_touch_velocity(float *x, float *y);
+
 #endif // CONFIG_UI_ENABLE_TOUCH
 
 #ifdef __cplusplus
@@ -19,6 +19,7 @@
 #define __UI_RENDERER_H__
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <araui/ui_commons.h>
 
 /**
@@ -56,6 +57,11 @@ typedef struct {
 	float m[3][3];
 } ui_mat3_t;
 
+/**
+ * @brief Decode the row y of a texture source to row.
+ */
+typedef bool (*ui_texture_row_func)(void *source, int32_t y, uint8_t *row);
+
 /**
  * @brief Graphics common functions
  */
@@ -74,8 +80,27 @@ void ui_renderer_translate(ui_mat3_t *parent_mat, ui_mat3_t *mat, float x, float
 void ui_renderer_rotate(ui_mat3_t *mat, int32_t deg);
 void ui_renderer_scale(ui_mat3_t *mat, float x, float y);
 void ui_renderer_set_texture(uint8_t *bitmap, int32_t width, int32_t height, ui_pixel_format_t pf);
+
+/**
+ * @brief Set a texture decoded by rows as it is drawn, instead of pixels in memory.
+ * Quads drawn one texel per pixel get each row decoded straight into the display, others get
+ * the whole texture decoded in a temporary buffer.
+ */
+void ui_renderer_set_texture_rows(ui_texture_row_func row_func, void *source, int32_t width, int32_t height, ui_pixel_format_t pf);
 void ui_renderer_set_fill_color(ui_color_t color);
 
+/**
+ * @brief Wait for the drawing left to the 2D engine of the display with CONFIG_UI_ENABLE_HW_ACC.
+ * It must be called before a texture drawn in this frame is freed or overwritten,
+ * the core calls it before an area is sent to the display.
+ */
+void ui_renderer_sync(void);
+
+/**
+ * @brief Fill a rectangle of the screen with the fill color.
+ */
+void ui_render_fill_rect(int32_t x, int32_t y, int32_t width, int32_t height);
+
 /**
  * @brief Rendering geometry functions
  * 
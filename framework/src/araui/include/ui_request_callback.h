@@ -19,6 +19,8 @@
 #ifndef __UI_REQUEST_CALLBACK_INTERNAL_H__
 #define __UI_REQUEST_CALLBACK_INTERNAL_H__
 
+#include <stdint.h>
+#include <stdbool.h>
 #include <araui/ui_commons.h>
 
 typedef void (*request_callback)(void *userdata);
@@ -30,7 +32,18 @@ extern "C" {
 ui_error_t ui_request_callback_init(void);
 ui_error_t ui_request_callback_deinit(void);
 ui_error_t ui_request_callback(request_callback request_cb, void *userdata);
-void ui_process_all_requests(void);
+
+/**
+ * @brief Wait until a request is made, ui_request_callback_wakeup() is called or timeout_ms
+ * milliseconds passed. A negative timeout_ms waits without limit.
+ */
+ui_error_t ui_request_callback_wait(int32_t timeout_ms);
+void ui_request_callback_wakeup(void);
+
+/**
+ * @brief Call the requested callbacks, and return whether there were any.
+ */
+bool ui_process_all_requests(void);
 
 #ifdef __cplusplus
 }
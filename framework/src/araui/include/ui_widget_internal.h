@@ -88,6 +88,7 @@ struct ui_widget_body_s {
 	int32_t pivot_y;
 	ui_mat3_t trans_mat;
 	bool update_flag;
+	bool active;	//!< In the active widget list of the core
 
 	struct ui_widget_body_s *parent;
 	vec_void_t children;
@@ -172,7 +173,7 @@ typedef struct {
 	ui_reach_offset_action_type_t max_offset_reach;
 #if defined(CONFIG_UI_ENABLE_TOUCH)
 	ui_coord_t prev_touch;
-	//!< This variables are updated when every frame by using touch delta value and the delta time
+	//!< Velocity of the fling in pixels per millisecond, the velocity of the touch at its release
 	float scroll_velocity_x;
 	float scroll_velocity_y;
 #endif // CONFIG_UI_ENABLE_TOUCH
@@ -19,9 +19,12 @@
 #ifndef __EASING_FN_H__
 #define __EASING_FN_H__
 
-float ease_linear(float t, float b, float c, float d);
-float ease_in_quad(float t, float b, float c, float d);
-float ease_out_quad(float t, float b, float c, float d);
-float ease_inout_quad(float t, float b, float c, float d);
+#include <stdint.h>
+
+// Value at time t of d of a change c from b, computed in fixed point with CONFIG_UI_FIXED_POINT_EASING
+int32_t ease_linear(uint32_t t, int32_t b, int32_t c, uint32_t d);
+int32_t ease_in_quad(uint32_t t, int32_t b, int32_t c, uint32_t d);
+int32_t ease_out_quad(uint32_t t, int32_t b, int32_t c, uint32_t d);
+int32_t ease_inout_quad(uint32_t t, int32_t b, int32_t c, uint32_t d);
 
 #endif
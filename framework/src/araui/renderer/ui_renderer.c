@@ -40,29 +40,42 @@
 
 #define CONFIG_UI_DEFAULT_FILL_COLOR 0x000000
 
+#define UI_BLIT_EPSILON (0.001f)
+#define UI_BLIT_EQUAL(a, b) (fabsf((a) - (b)) < UI_BLIT_EPSILON)
+
 /****************************************************************************
  * Private function declaration
  ****************************************************************************/
 static void ui_draw_triangle_segment(int32_t y1, int32_t y2);
+static int32_t _ui_renderer_texel_size(ui_pixel_format_t pf);
+static bool ui_render_quad_blit(ui_mat3_t *trans_mat,
+	ui_vec3_t *v1, ui_vec3_t *v2, ui_vec3_t *v3, ui_vec3_t *v4,
+	ui_uv_t *uv1, ui_uv_t *uv2, ui_uv_t *uv3, ui_uv_t *uv4);
 
 /****************************************************************************
  * Private types
  ****************************************************************************/
 typedef struct {
 	uint8_t          *texture;
+	ui_texture_row_func tex_row_func;
+	void             *tex_source;
 	int32_t           tex_width;
 	int32_t           tex_height;
 	ui_pixel_format_t tex_pf;
 	ui_color_t        fill_color;
+	bool              hw_pending;
 } ui_render_context_t;
 
 //!< Render context (global instance)
 ui_render_context_t g_rc = {
 	.texture = NULL,
+	.tex_row_func = NULL,
+	.tex_source = NULL,
 	.tex_width = 0,
 	.tex_height = 0,
 	.tex_pf = UI_PIXEL_FORMAT_UNKNOWN,
-	.fill_color = CONFIG_UI_DEFAULT_FILL_COLOR
+	.fill_color = CONFIG_UI_DEFAULT_FILL_COLOR,
+	.hw_pending = false
 };
 
 float g_left_dxdy;
@@ -173,6 +186,8 @@ void ui_renderer_scale(ui_mat3_t *mat, float x, float y)
 void ui_renderer_set_texture(uint8_t *bitmap, int32_t width, int32_t height, ui_pixel_format_t pf)
 {
 	g_rc.texture = bitmap;
+	g_rc.tex_row_func = NULL;
+	g_rc.tex_source = NULL;
 
 	if (bitmap) {
 		g_rc.tex_width = width;
@@ -185,11 +200,62 @@ void ui_renderer_set_texture(uint8_t *bitmap, int32_t width, int32_t height, ui_
 	}
 }
 
+void ui_renderer_set_texture_rows(ui_texture_row_func row_func, void *source, int32_t width, int32_t height, ui_pixel_format_t pf)
+{
+	ui_renderer_set_texture(NULL, 0, 0, UI_PIXEL_FORMAT_UNKNOWN);
+
+	if (row_func) {
+		g_rc.tex_row_func = row_func;
+		g_rc.tex_source = source;
+		g_rc.tex_width = width;
+		g_rc.tex_height = height;
+		g_rc.tex_pf = pf;
+	}
+}
+
 void ui_renderer_set_fill_color(ui_color_t color)
 {
 	g_rc.fill_color = color;
 }
 
+void ui_renderer_sync(void)
+{
+#if defined(CONFIG_UI_ENABLE_HW_ACC)
+	if (g_rc.hw_pending) {
+		ui_dal_hw_sync();
+		g_rc.hw_pending = false;
+	}
+#endif
+}
+
+void ui_render_fill_rect(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	int32_t i;
+	int32_t j;
+
+	if (width <= 0 || height <= 0) {
+		return;
+	}
+
+#if defined(CONFIG_UI_ENABLE_HW_ACC)
+	if (ui_dal_hw_fill_rect(x, y, width, height, g_rc.fill_color)) {
+		g_rc.hw_pending = true;
+		return;
+	}
+#endif
+
+	ui_renderer_sync();
+	for (j = y; j < y + height; j++) {
+		for (i = x; i < x + width; i++) {
+			ui_dal_put_pixel_rgb888(i, j, UI_COLOR_RGB888(
+				(g_rc.fill_color & 0xff0000) >> 16,
+				(g_rc.fill_color & 0x00ff00) >> 8,
+				(g_rc.fill_color & 0x0000ff) >> 0
+			));
+		}
+	}
+}
+
 void ui_render_triangle_uv(ui_mat3_t *trans_mat,
 	ui_vec3_t v1, ui_vec3_t v2, ui_vec3_t v3,
 	ui_uv_t uv1, ui_uv_t uv2, ui_uv_t uv3)
@@ -246,6 +312,9 @@ void ui_render_triangle_uv(ui_mat3_t *trans_mat,
 		return;
 	}
 
+	// The pixels are blended with the ones the 2D engine draws
+	ui_renderer_sync();
+
 	u_a = uv1.u;
 	u_b = uv2.u;
 	u_c = uv3.u;
@@ -395,6 +464,41 @@ void ui_render_quad_uv(ui_mat3_t *trans_mat,
 	ui_vec3_t v1, ui_vec3_t v2, ui_vec3_t v3, ui_vec3_t v4,
 	ui_uv_t uv1, ui_uv_t uv2, ui_uv_t uv3, ui_uv_t uv4)
 {
+	uint8_t *texture;
+	size_t bytes_per_line;
+	int32_t y;
+
+	if (ui_render_quad_blit(trans_mat, &v1, &v2, &v3, &v4, &uv1, &uv2, &uv3, &uv4)) {
+		return;
+	}
+
+	if (!g_rc.texture && g_rc.tex_row_func) {
+		// The triangles sample anywhere, so they get the whole texture for this draw
+		bytes_per_line = g_rc.tex_width * _ui_renderer_texel_size(g_rc.tex_pf);
+		if (!bytes_per_line) {
+			return;
+		}
+		texture = (uint8_t *)UI_ALLOC(bytes_per_line * g_rc.tex_height);
+		if (!texture) {
+			UI_LOGE("error: out of memory!\n");
+			return;
+		}
+		for (y = 0; y < g_rc.tex_height; y++) {
+			if (!g_rc.tex_row_func(g_rc.tex_source, y, texture + y * bytes_per_line)) {
+				UI_LOGE("error: failed to decode texture row %d!\n", y);
+				UI_FREE(texture);
+				return;
+			}
+		}
+
+		g_rc.texture = texture;
+		ui_render_triangle_uv(trans_mat, v1, v2, v3, uv1, uv2, uv3);
+		ui_render_triangle_uv(trans_mat, v1, v3, v4, uv1, uv3, uv4);
+		g_rc.texture = NULL;
+		UI_FREE(texture);
+		return;
+	}
+
 	ui_render_triangle_uv(trans_mat, v1, v2, v3, uv1, uv2, uv3);
 	ui_render_triangle_uv(trans_mat, v1, v3, v4, uv1, uv3, uv4);
 }
@@ -402,6 +506,136 @@ void ui_render_quad_uv(ui_mat3_t *trans_mat,
 /****************************************************************************
  * Private function implementation
  ****************************************************************************/
+
+/**
+ * @brief Draw a quad as rows of texels when it needs no sampling.
+ *
+ * The quad must be translated only, with its vertices and uvs in the order of the widgets
+ * (top-left, bottom-left, bottom-right, top-right), and one texel for each pixel.
+ * The pixels covered are the ones the triangles would cover.
+ *
+ * @return true if the quad is drawn, false if it is left to the triangles.
+ */
+static int32_t _ui_renderer_texel_size(ui_pixel_format_t pf)
+{
+	switch (pf) {
+	case UI_PIXEL_FORMAT_RGBA8888:
+		return 4;
+	case UI_PIXEL_FORMAT_RGB888:
+		return 3;
+	case UI_PIXEL_FORMAT_A8:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static bool ui_render_quad_blit(ui_mat3_t *trans_mat,
+	ui_vec3_t *v1, ui_vec3_t *v2, ui_vec3_t *v3, ui_vec3_t *v4,
+	ui_uv_t *uv1, ui_uv_t *uv2, ui_uv_t *uv3, ui_uv_t *uv4)
+{
+	float tex_xf;
+	float tex_yf;
+	int32_t x;
+	int32_t y;
+	int32_t width;
+	int32_t height;
+	int32_t tex_x;
+	int32_t tex_y;
+	int32_t bpp;
+	int32_t row;
+	uint8_t *src;
+	uint8_t *row_buf = NULL;
+
+	if (!g_rc.texture && !g_rc.tex_row_func) {
+		return false;
+	}
+
+	bpp = _ui_renderer_texel_size(g_rc.tex_pf);
+	if (!bpp) {
+		return false;
+	}
+
+	// Rotation and scale are exact 0 and 1 in the matrix when not used
+	if (trans_mat->m[0][0] != 1.0f || trans_mat->m[0][1] != 0.0f ||
+		trans_mat->m[1][0] != 0.0f || trans_mat->m[1][1] != 1.0f ||
+		trans_mat->m[2][0] != 0.0f || trans_mat->m[2][1] != 0.0f || trans_mat->m[2][2] != 1.0f ||
+		v1->w != 1.0f || v2->w != 1.0f || v3->w != 1.0f || v4->w != 1.0f) {
+		return false;
+	}
+
+	if (v1->x != v2->x || v3->x != v4->x || v1->y != v4->y || v2->y != v3->y ||
+		v1->x >= v3->x || v1->y >= v3->y ||
+		uv1->u != uv2->u || uv3->u != uv4->u || uv1->v != uv4->v || uv2->v != uv3->v ||
+		uv1->u >= uv3->u || uv1->v >= uv3->v) {
+		return false;
+	}
+
+	// Same pixel coverage as the triangle rasterizer, which starts at ceil()
+	x = ceilf(v1->x + trans_mat->m[0][2]);
+	y = ceilf(v1->y + trans_mat->m[1][2]);
+	width = (int32_t)ceilf(v3->x + trans_mat->m[0][2]) - x;
+	height = (int32_t)ceilf(v3->y + trans_mat->m[1][2]) - y;
+
+	tex_xf = uv1->u * g_rc.tex_width;
+	tex_yf = uv1->v * g_rc.tex_height;
+	tex_x = (int32_t)(tex_xf + 0.5f);
+	tex_y = (int32_t)(tex_yf + 0.5f);
+	if (!UI_BLIT_EQUAL(tex_xf, tex_x) || !UI_BLIT_EQUAL(tex_yf, tex_y) ||
+		!UI_BLIT_EQUAL((uv3->u - uv1->u) * g_rc.tex_width, width) ||
+		!UI_BLIT_EQUAL((uv3->v - uv1->v) * g_rc.tex_height, height) ||
+		tex_x < 0 || tex_y < 0 || tex_x + width > g_rc.tex_width || tex_y + height > g_rc.tex_height) {
+		return false;
+	}
+
+#if defined(CONFIG_UI_ENABLE_HW_ACC)
+	// A texture decoded by rows has its row buffer reused, so only one in memory goes to the engine
+	if (g_rc.texture && ui_dal_hw_blit(x, y, g_rc.texture + ((tex_y * g_rc.tex_width) + tex_x) * bpp,
+		g_rc.tex_width * bpp, width, height, g_rc.tex_pf, g_rc.fill_color)) {
+		g_rc.hw_pending = true;
+		return true;
+	}
+#endif
+
+	ui_renderer_sync();
+
+	if (!g_rc.texture) {
+		// Each row is decoded right before it is sent
+		row_buf = (uint8_t *)UI_ALLOC(g_rc.tex_width * bpp);
+		if (!row_buf) {
+			UI_LOGE("error: out of memory!\n");
+			return true;
+		}
+	} else {
+		src = g_rc.texture + ((tex_y * g_rc.tex_width) + tex_x) * bpp;
+	}
+
+	for (row = 0; row < height; row++) {
+		if (row_buf) {
+			if (!g_rc.tex_row_func(g_rc.tex_source, tex_y + row, row_buf)) {
+				UI_LOGE("error: failed to decode texture row %d!\n", tex_y + row);
+				break;
+			}
+			src = row_buf + tex_x * bpp;
+		}
+
+		if (g_rc.tex_pf == UI_PIXEL_FORMAT_RGBA8888) {
+			ui_dal_put_span_rgba8888(x, y + row, src, width);
+		} else if (g_rc.tex_pf == UI_PIXEL_FORMAT_RGB888) {
+			ui_dal_put_span_rgb888(x, y + row, src, width);
+		} else {
+			ui_dal_put_span_a8(x, y + row, src, width, g_rc.fill_color);
+		}
+		src += g_rc.tex_width * bpp;
+	}
+
+	if (row_buf) {
+		UI_FREE(row_buf);
+	}
+
+	return true;
+}
+
 static void ui_draw_triangle_segment(int32_t y1, int32_t y2)
 {
 	float u;
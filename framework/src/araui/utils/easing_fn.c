@@ -16,29 +16,144 @@
  *
  ****************************************************************************/
 
-float ease_linear(float t, float b, float c, float d)
+#include <tinyara/config.h>
+#include <stdint.h>
+#include "utils/easing_fn.h"
+
+// The easing functions return b + c * curve(t / d) for 0 <= t <= d.
+// With CONFIG_UI_FIXED_POINT_EASING, for MCUs without an FPU, the curves are tables of
+// UI_EASE_TABLE_SIZE segments in Q15, linearly interpolated, so a step costs a few integer
+// multiplies instead of emulated float operations.
+
+#if defined(CONFIG_UI_FIXED_POINT_EASING)
+
+#define UI_EASE_TABLE_SHIFT 6
+#define UI_EASE_TABLE_SIZE  (1 << UI_EASE_TABLE_SHIFT)
+#define UI_EASE_ONE_SHIFT   15
+
+static const uint16_t g_ease_in_quad[UI_EASE_TABLE_SIZE + 1] = {
+	0, 8, 32, 72, 128, 200, 288, 392,
+	512, 648, 800, 968, 1152, 1352, 1568, 1800,
+	2048, 2312, 2592, 2888, 3200, 3528, 3872, 4232,
+	4608, 5000, 5408, 5832, 6272, 6728, 7200, 7688,
+	8192, 8712, 9248, 9800, 10368, 10952, 11552, 12168,
+	12800, 13448, 14112, 14792, 15488, 16200, 16928, 17672,
+	18432, 19208, 20000, 20808, 21632, 22472, 23328, 24200,
+	25088, 25992, 26912, 27848, 28800, 29768, 30752, 31752,
+	32768,
+};
+
+static const uint16_t g_ease_out_quad[UI_EASE_TABLE_SIZE + 1] = {
+	0, 1016, 2016, 3000, 3968, 4920, 5856, 6776,
+	7680, 8568, 9440, 10296, 11136, 11960, 12768, 13560,
+	14336, 15096, 15840, 16568, 17280, 17976, 18656, 19320,
+	19968, 20600, 21216, 21816, 22400, 22968, 23520, 24056,
+	24576, 25080, 25568, 26040, 26496, 26936, 27360, 27768,
+	28160, 28536, 28896, 29240, 29568, 29880, 30176, 30456,
+	30720, 30968, 31200, 31416, 31616, 31800, 31968, 32120,
+	32256, 32376, 32480, 32568, 32640, 32696, 32736, 32760,
+	32768,
+};
+
+static const uint16_t g_ease_inout_quad[UI_EASE_TABLE_SIZE + 1] = {
+	0, 16, 64, 144, 256, 400, 576, 784,
+	1024, 1296, 1600, 1936, 2304, 2704, 3136, 3600,
+	4096, 4624, 5184, 5776, 6400, 7056, 7744, 8464,
+	9216, 10000, 10816, 11664, 12544, 13456, 14400, 15376,
+	16384, 17392, 18368, 19312, 20224, 21104, 21952, 22768,
+	23552, 24304, 25024, 25712, 26368, 26992, 27584, 28144,
+	28672, 29168, 29632, 30064, 30464, 30832, 31168, 31472,
+	31744, 31984, 32192, 32368, 32512, 32624, 32704, 32752,
+	32768,
+};
+static int32_t _ease_table(const uint16_t *table, uint32_t t, int32_t b, int32_t c, uint32_t d)
+{
+	uint32_t pos;
+	uint32_t idx;
+	uint32_t frac;
+	int32_t curve;
+
+	if (d == 0 || t >= d) {
+		return b + c;
+	}
+
+	// Position in the table, in 1 / 2^UI_EASE_ONE_SHIFT of a segment
+	pos = (uint32_t)(((uint64_t)t << (UI_EASE_TABLE_SHIFT + UI_EASE_ONE_SHIFT)) / d);
+	idx = pos >> UI_EASE_ONE_SHIFT;
+	frac = pos & ((1 << UI_EASE_ONE_SHIFT) - 1);
+	curve = table[idx] + (int32_t)((((int32_t)table[idx + 1] - table[idx]) * (int32_t)frac) >> UI_EASE_ONE_SHIFT);
+
+	return b + (int32_t)(((int64_t)c * curve) >> UI_EASE_ONE_SHIFT);
+}
+
+int32_t ease_linear(uint32_t t, int32_t b, int32_t c, uint32_t d)
 {
-	return c * t / d + b;
+	if (d == 0 || t >= d) {
+		return b + c;
+	}
+	return b + (int32_t)((int64_t)c * t / d);
 }
 
-float ease_in_quad(float t, float b, float c, float d)
+int32_t ease_in_quad(uint32_t t, int32_t b, int32_t c, uint32_t d)
 {
-	t /= d;
-	return c * t * t + b;
+	return _ease_table(g_ease_in_quad, t, b, c, d);
 }
 
-float ease_out_quad(float t, float b, float c, float d)
+int32_t ease_out_quad(uint32_t t, int32_t b, int32_t c, uint32_t d)
 {
-	t /= d;
-	return -c * t * (t - 2) + b;
+	return _ease_table(g_ease_out_quad, t, b, c, d);
 }
 
-float ease_inout_quad(float t, float b, float c, float d)
+int32_t ease_inout_quad(uint32_t t, int32_t b, int32_t c, uint32_t d)
+{
+	return _ease_table(g_ease_inout_quad, t, b, c, d);
+}
+
+#else
+
+int32_t ease_linear(uint32_t t, int32_t b, int32_t c, uint32_t d)
 {
-	t /= d / 2;
-	if (t < 1) {
-		return c / 2 * t * t + b;
+	if (d == 0) {
+		return b + c;
 	}
-	t--;
-	return -c / 2 * (t * (t - 2) - 1) + b;
+	return (int32_t)((float)c * t / d + b);
 }
+
+int32_t ease_in_quad(uint32_t t, int32_t b, int32_t c, uint32_t d)
+{
+	float p;
+
+	if (d == 0) {
+		return b + c;
+	}
+	p = (float)t / d;
+	return (int32_t)(c * p * p + b);
+}
+
+int32_t ease_out_quad(uint32_t t, int32_t b, int32_t c, uint32_t d)
+{
+	float p;
+
+	if (d == 0) {
+		return b + c;
+	}
+	p = (float)t / d;
+	return (int32_t)(-c * p * (p - 2) + b);
+}
+
+int32_t ease_inout_quad(uint32_t t, int32_t b, int32_t c, uint32_t d)
+{
+	float p;
+
+	if (d == 0) {
+		return b + c;
+	}
+	p = (float)t / (d / 2.0f);
+	if (p < 1) {
+		return (int32_t)((float)c / 2 * p * p + b);
+	}
+	p--;
+	return (int32_t)(-(float)c / 2 * (p * (p - 2) - 1) + b);
+}
+
+#endif
@@ -116,6 +116,7 @@ static void ui_image_widget_render_func(ui_widget_t widget, uint32_t dt)
 	ui_vec3_t v2;
 	ui_vec3_t v3;
 	ui_vec3_t v4;
+	uint8_t *pixels;
 
 	if (!widget) {
 		UI_LOGE("error: Invalid Parameter!\n");
@@ -124,7 +125,12 @@ static void ui_image_widget_render_func(ui_widget_t widget, uint32_t dt)
 
 	body = (ui_image_widget_body_t *)widget;
 	if (body->image) {
-		ui_renderer_set_texture(body->image->buf, body->image->width, body->image->height, body->image->pixel_format);
+		pixels = ui_image_asset_get_pixels(body->image);
+		if (pixels) {
+			ui_renderer_set_texture(pixels, body->image->width, body->image->height, body->image->pixel_format);
+		} else {
+			ui_renderer_set_texture_rows(ui_image_asset_decode_row, body->image, body->image->width, body->image->height, body->image->pixel_format);
+		}
 
 		v1 = (ui_vec3_t){
 			.x = -body->base.pivot_x,
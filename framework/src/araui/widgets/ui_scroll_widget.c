@@ -27,7 +27,13 @@
 #include "ui_asset_internal.h"
 #include "ui_commons_internal.h"
 
-#define CONFIG_UI_SCROLL_DAMPING 10.0f
+// Time constant of the slowdown of a fling, in milliseconds
+#ifndef CONFIG_UI_SCROLL_FLING_TIME
+#define CONFIG_UI_SCROLL_FLING_TIME      250
+#endif
+
+// A fling slower than this, in pixels per millisecond, stops
+#define UI_SCROLL_MIN_VELOCITY           0.02f
 
 typedef struct {
 	ui_scroll_widget_body_t *body;
@@ -309,10 +315,6 @@ void ui_scroll_widget_touch_func(ui_widget_body_t *widget, ui_touch_event_t even
 				delta.x = body->offset.x - body->prev_offset.x;
 				delta.y = body->offset.y - body->prev_offset.y;
 
-				// Update scroll velocity
-				body->scroll_velocity_x += delta.x;
-				body->scroll_velocity_y += delta.y;
-
 				// update position of all children (sync)
 				_apply_delta_to_all_children(body, delta);
 				break;
@@ -324,6 +326,15 @@ void ui_scroll_widget_touch_func(ui_widget_body_t *widget, ui_touch_event_t even
 		break;
 
 	case UI_TOUCH_EVENT_UP:
+		if (body->state == UI_SCROLL_STATE_SCROLLING) {
+			// The samples of the touch are coalesced once a frame, its velocity comes from their time
+			ui_core_get_touch_velocity(&body->scroll_velocity_x, &body->scroll_velocity_y);
+			if (body->direction == UI_DIRECTION_VERTICAL) {
+				body->scroll_velocity_x = 0.0f;
+			} else if (body->direction == UI_DIRECTION_HORIZONTAL) {
+				body->scroll_velocity_y = 0.0f;
+			}
+		}
 		body->state = UI_SCROLL_STATE_NONE;
 		break;
 
@@ -353,8 +364,14 @@ static void ui_scroll_widget_update_func(ui_widget_t widget, uint32_t dt)
 	// Apply scroll velocity on the touch interface environment
 	// If CONFIG_UI_ENABLE_TOUCH is disabled, this part is not needed.
 	if (body->state == UI_SCROLL_STATE_NONE) {
-		delta.x = body->scroll_velocity_x;
-		delta.y = body->scroll_velocity_y;
+		if (UI_ABS(body->scroll_velocity_x) < UI_SCROLL_MIN_VELOCITY && UI_ABS(body->scroll_velocity_y) < UI_SCROLL_MIN_VELOCITY) {
+			body->scroll_velocity_x = 0.0f;
+			body->scroll_velocity_y = 0.0f;
+			return;
+		}
+
+		delta.x = body->scroll_velocity_x * dt;
+		delta.y = body->scroll_velocity_y * dt;
 
 		body->prev_offset.x = body->offset.x;
 		body->prev_offset.y = body->offset.y;
@@ -386,16 +403,15 @@ static void ui_scroll_widget_update_func(ui_widget_t widget, uint32_t dt)
 			ui_widget_update_position_info((ui_widget_body_t *)body);
 		}
 
-		body->scroll_velocity_x *= CONFIG_UI_SCROLL_DAMPING * (dt / 400.0f);
-		body->scroll_velocity_y *= CONFIG_UI_SCROLL_DAMPING * (dt / 400.0f);
+		if (dt >= CONFIG_UI_SCROLL_FLING_TIME) {
+			body->scroll_velocity_x = 0.0f;
+			body->scroll_velocity_y = 0.0f;
+		} else {
+			body->scroll_velocity_x -= body->scroll_velocity_x * dt / CONFIG_UI_SCROLL_FLING_TIME;
+			body->scroll_velocity_y -= body->scroll_velocity_y * dt / CONFIG_UI_SCROLL_FLING_TIME;
+		}
 
 	} else if (body->state == UI_SCROLL_STATE_SCROLLING) {
-
-		// If the scroll widget is scrolling now,
-		// velocity must be decreased faster than touch up case.
-		// If not, although the user stops the finger for some time, velocity will be applied when touch up.
-		body->scroll_velocity_x *= CONFIG_UI_SCROLL_DAMPING * (dt / 600.0f);
-		body->scroll_velocity_y *= CONFIG_UI_SCROLL_DAMPING * (dt / 600.0f);
 		ui_widget_update_position_info((ui_widget_body_t *)body);
 	}
 
@@ -430,6 +446,11 @@ ui_widget_t ui_scroll_widget_create(int32_t width, int32_t height)
 	body->base.touchable = true;
 	body->base.is_hooker = true;
 	body->base.touch_cb = ui_scroll_widget_touch_func;
+
+	// The scroll velocity is applied by the update callback, which does nothing without touch
+	if (ui_core_request_activate_widget((ui_widget_body_t *)body) != UI_OK) {
+		UI_LOGE("error: failed to activate the scroll widget!\n");
+	}
 #endif
 
 	return (ui_widget_t)body;
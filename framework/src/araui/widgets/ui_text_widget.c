@@ -64,8 +64,6 @@ typedef struct {
 } ui_set_font_size_info_t;
 
 #define CONFIG_UI_TEXT_FORMAT_MAX_LENGTH  512
-#define CONFIG_UI_GLYPH_BITMAP_WIDTH      256
-#define CONFIG_UI_GLYPH_BITMAP_HEIGHT     256
 #define CONFIG_UI_DEFAULT_FILL_COLOR      0x000000
 
 static ui_error_t _ui_text_widget_text2utf(ui_text_widget_body_t *body, const char *text);
@@ -78,8 +76,6 @@ static void _ui_text_widget_set_word_wrap_func(void *userdata);
 static void _ui_text_widget_set_font_size_func(void *userdata);
 static void _ui_text_widget_calculate_line_num(ui_text_widget_body_t *body);
 
-static uint8_t g_glyph_bitmap[CONFIG_UI_GLYPH_BITMAP_WIDTH * CONFIG_UI_GLYPH_BITMAP_HEIGHT];
-
 ui_widget_t ui_text_widget_create(int32_t width, int32_t height, ui_asset_t font, const char *text, size_t font_size)
 {
 	ui_text_widget_body_t *body;
@@ -432,12 +428,9 @@ static void _ui_text_widget_render_func(ui_widget_t widget, uint32_t dt)
 	float scale;
 	int ascent;
 	int i;
-	int c_x1;
-	int c_y1;
-	int c_x2;
-	int c_y2;
-	int out_w;
-	int out_h;
+	ui_glyph_t glyph;
+	float tex_w;
+	float tex_h;
 	int x;
 	int y;
 	int32_t text_width;
@@ -475,8 +468,6 @@ static void _ui_text_widget_render_func(ui_widget_t widget, uint32_t dt)
 		return;
 	}
 
-	memset(g_glyph_bitmap, 0, CONFIG_UI_GLYPH_BITMAP_WIDTH * CONFIG_UI_GLYPH_BITMAP_HEIGHT);
-
 	scale = stbtt_ScaleForPixelHeight(&(body->font->ttf_info), body->font_size);
 
 	stbtt_GetFontVMetrics(&(body->font->ttf_info), &ascent, NULL, NULL);
@@ -565,54 +556,46 @@ static void _ui_text_widget_render_func(ui_widget_t widget, uint32_t dt)
 				x += body->font_size;
 			} else {
 #endif
-				/* get bounding box for character (may be offset to account for chars that dip above or below the line */
-				stbtt_GetCodepointBitmapBox(&(body->font->ttf_info), body->utf_code[draw_idx],
-					scale, scale, &c_x1, &c_y1, &c_x2, &c_y2);
-
-				out_w = c_x2 - c_x1;
-				out_h = c_y2 - c_y1;
-
-				/* render character (stride and offset is important here) */
-				stbtt_MakeCodepointBitmap(&(body->font->ttf_info), g_glyph_bitmap,
-					out_w, out_h,
-					out_w,
-					scale, scale,
-					body->utf_code[draw_idx]);
-
-				ui_renderer_translate(&body->base.trans_mat, &text_mat, (float)x, (float)(y + ascent + c_y1));
-				ui_renderer_set_texture(g_glyph_bitmap, out_w, out_h, UI_PIXEL_FORMAT_A8);
-				ui_renderer_set_fill_color(body->font_color);
-
-				v1 = (ui_vec3_t){
-					.x = 0.0f,
-					.y = 0.0f,
-					1.0f
-				};
-				v2 = (ui_vec3_t){
-					.x = 0.0f,
-					.y = out_h,
-					1.0f
-				};
-				v3 = (ui_vec3_t){
-					.x = out_w,
-					.y = out_h,
-					1.0f
-				};
-				v4 = (ui_vec3_t){
-					.x = out_w,
-					.y = 0.0f,
-					1.0f
-				};
-
-				ui_render_quad_uv(&text_mat, v1, v2, v3, v4,
-							(ui_uv_t){ 0.0f, 0.0f },
-							(ui_uv_t){ 0.0f, 1.0f },
-							(ui_uv_t){ 1.0f, 1.0f },
-							(ui_uv_t){ 1.0f, 0.0f });
-
-				ui_renderer_set_texture(NULL, 0, 0, UI_PIXEL_FORMAT_UNKNOWN);
-				ui_renderer_set_fill_color(CONFIG_UI_DEFAULT_FILL_COLOR);
-				memset(g_glyph_bitmap, 0, out_w * out_h);
+				/* the glyph comes from the atlas or the glyph cache of the font, and is rasterized only on a miss */
+				if (ui_font_asset_get_glyph(body->font, body->utf_code[draw_idx], body->font_size, &glyph) != UI_OK) {
+					UI_LOGE("error: failed to get glyph!\n");
+				} else if (glyph.width > 0 && glyph.height > 0) {
+					ui_renderer_translate(&body->base.trans_mat, &text_mat, (float)x, (float)(y + ascent + glyph.y_offset));
+					ui_renderer_set_texture((uint8_t *)glyph.texture, glyph.tex_width, glyph.tex_height, UI_PIXEL_FORMAT_A8);
+					ui_renderer_set_fill_color(body->font_color);
+
+					v1 = (ui_vec3_t){
+						.x = 0.0f,
+						.y = 0.0f,
+						1.0f
+					};
+					v2 = (ui_vec3_t){
+						.x = 0.0f,
+						.y = glyph.height,
+						1.0f
+					};
+					v3 = (ui_vec3_t){
+						.x = glyph.width,
+						.y = glyph.height,
+						1.0f
+					};
+					v4 = (ui_vec3_t){
+						.x = glyph.width,
+						.y = 0.0f,
+						1.0f
+					};
+
+					tex_w = (float)glyph.tex_width;
+					tex_h = (float)glyph.tex_height;
+					ui_render_quad_uv(&text_mat, v1, v2, v3, v4,
+								(ui_uv_t){ glyph.x / tex_w, glyph.y / tex_h },
+								(ui_uv_t){ glyph.x / tex_w, (glyph.y + glyph.height) / tex_h },
+								(ui_uv_t){ (glyph.x + glyph.width) / tex_w, (glyph.y + glyph.height) / tex_h },
+								(ui_uv_t){ (glyph.x + glyph.width) / tex_w, glyph.y / tex_h });
+
+					ui_renderer_set_texture(NULL, 0, 0, UI_PIXEL_FORMAT_UNKNOWN);
+					ui_renderer_set_fill_color(CONFIG_UI_DEFAULT_FILL_COLOR);
+				}
 
 				x += body->width_array[draw_idx];
 #if defined(CONFIG_UI_ENABLE_EMOJI)
@@ -324,6 +324,10 @@ ui_error_t ui_widget_set_tick_callback(ui_widget_t widget, tick_callback tick_cb
 	body = (ui_widget_body_t *)widget;
 	body->tick_cb = tick_cb;
 
+	if (tick_cb) {
+		return ui_core_request_activate_widget(body);
+	}
+
 	return UI_OK;
 }
 
@@ -345,6 +349,10 @@ ui_error_t ui_widget_set_interval_callback(ui_widget_t widget, interval_callback
 	body->interval_info.timeout = timeout;
 	body->interval_info.current = 0;
 
+	if (interval_cb) {
+		return ui_core_request_activate_widget(body);
+	}
+
 	return UI_OK;
 }
 
@@ -517,6 +525,7 @@ static void _ui_widget_destroy_func(void *userdata)
 			ui_widget_queue_enqueue(child);
 		}
 
+		ui_core_deactivate_widget(widget);
 		ui_widget_deinit(widget);
 
 		UI_FREE(widget);
@@ -920,6 +929,7 @@ static void _ui_widget_play_anim(void *userdata)
 
 	body->anim_finished_cb = info->anim_finished_cb;
 	body->anim = info->anim;
+	ui_core_activate_widget(body);
 }
 
 void ui_widget_update_global_rect(ui_widget_body_t *widget)
@@ -0,0 +1,433 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/***************************************************************************
+ * Included Files
+ ***************************************************************************/
+
+#include <unistd.h>
+#include <errno.h>
+#include <debug.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <crc32.h>
+#include <tinyara/binary_manager.h>
+#include <binary_manager/binary_manager.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* A patch made by os/tools/mkbindelta.py, little endian:
+ *
+ *   "BMDF", version, 3 reserved bytes
+ *   size and CRC32 of the current binary, size and CRC32 of the new binary
+ *   records until the new binary is complete:
+ *     varint diff length, varint extra length, zigzag varint seek
+ *     diff  : pairs of varint zeros and varint n followed by n bytes, added
+ *             to the bytes of the current binary, up to the diff length
+ *     extra : bytes of the new binary
+ *     seek  : moves the position in the current binary
+ *
+ * The current binary is the image in the running partition, header
+ * included, and the new one is written to the inactive partition.
+ */
+#define BINMGR_PATCH_MAGIC       "BMDF"
+#define BINMGR_PATCH_VERSION     1
+#define BINMGR_PATCH_HEADER_SIZE 24
+
+enum binmgr_patch_state_e {
+	PATCH_HEADER,
+	PATCH_DIFF_LEN,
+	PATCH_EXTRA_LEN,
+	PATCH_SEEK,
+	PATCH_ZEROS,
+	PATCH_LITERAL_LEN,
+	PATCH_LITERAL,
+	PATCH_EXTRA,
+	PATCH_DONE,
+};
+
+struct binmgr_patch_s {
+	int old_fd;
+	int new_fd;
+	int state;
+	uint32_t old_size;
+	uint32_t new_size;
+	uint32_t new_crc;
+	uint32_t old_pos;
+	uint32_t new_pos;			/* Bytes of the new binary written to outbuf */
+	uint32_t crc;				/* CRC of the new binary up to new_pos */
+	uint32_t diff_len;			/* Diff bytes left in the record */
+	uint32_t extra_len;			/* Extra bytes left in the record */
+	uint32_t seek;				/* Seek of the record, zigzag encoded */
+	uint32_t count;				/* Bytes of the header or of the literal left */
+	uint32_t value;				/* Varint being read */
+	int shift;
+	uint8_t header[BINMGR_PATCH_HEADER_SIZE];
+	uint8_t *outbuf;
+	uint32_t outlen;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static uint32_t patch_get32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static binmgr_result_type_e patch_flush(binmgr_patch_t *patch)
+{
+	int ret;
+
+	if (patch->outlen == 0) {
+		return BINMGR_OK;
+	}
+
+	ret = write(patch->new_fd, patch->outbuf, patch->outlen);
+	if (ret != patch->outlen) {
+		bmdbg("Fail to write new binary, ret %d, errno %d\n", ret, errno);
+		return BINMGR_OPERATION_FAIL;
+	}
+	patch->crc = crc32part(patch->outbuf, patch->outlen, patch->crc);
+	patch->outlen = 0;
+	return BINMGR_OK;
+}
+
+/* Read 'len' bytes of the current binary at old_pos to the end of outbuf */
+static binmgr_result_type_e patch_read_old(binmgr_patch_t *patch, uint32_t len)
+{
+	int ret;
+
+	if (len > patch->old_size - patch->old_pos || patch->old_pos > patch->old_size) {
+		bmdbg("Patch reads out of the current binary at %u\n", patch->old_pos);
+		return BINMGR_INVALID_PARAM;
+	}
+	if (lseek(patch->old_fd, patch->old_pos, SEEK_SET) != patch->old_pos) {
+		bmdbg("Fail to seek current binary, errno %d\n", errno);
+		return BINMGR_OPERATION_FAIL;
+	}
+	ret = read(patch->old_fd, patch->outbuf + patch->outlen, len);
+	if (ret != len) {
+		bmdbg("Fail to read current binary, ret %d, errno %d\n", ret, errno);
+		return BINMGR_OPERATION_FAIL;
+	}
+	patch->old_pos += len;
+	return BINMGR_OK;
+}
+
+/* Add 'len' bytes to the new binary, from the current binary plus 'diff',
+ * or from 'extra' when it is not NULL.  'diff' NULL is a run of zeros.
+ */
+static binmgr_result_type_e patch_output(binmgr_patch_t *patch, const uint8_t *diff, const uint8_t *extra, uint32_t len)
+{
+	binmgr_result_type_e ret;
+	uint32_t chunk;
+	uint32_t i;
+
+	if (len > patch->new_size - patch->new_pos) {
+		bmdbg("Patch writes past the new binary size %u\n", patch->new_size);
+		return BINMGR_INVALID_PARAM;
+	}
+
+	while (len > 0) {
+		chunk = CONFIG_BINMGR_DELTA_BUFSIZE - patch->outlen;
+		chunk = len < chunk ? len : chunk;
+		if (extra) {
+			memcpy(patch->outbuf + patch->outlen, extra, chunk);
+			extra += chunk;
+		} else {
+			ret = patch_read_old(patch, chunk);
+			if (ret != BINMGR_OK) {
+				return ret;
+			}
+			if (diff) {
+				for (i = 0; i < chunk; i++) {
+					patch->outbuf[patch->outlen + i] += diff[i];
+				}
+				diff += chunk;
+			}
+		}
+		patch->outlen += chunk;
+		patch->new_pos += chunk;
+		len -= chunk;
+
+		if (patch->outlen == CONFIG_BINMGR_DELTA_BUFSIZE) {
+			ret = patch_flush(patch);
+			if (ret != BINMGR_OK) {
+				return ret;
+			}
+		}
+	}
+
+	return BINMGR_OK;
+}
+
+/* Check the header and that the running binary is the one the patch is made from */
+static binmgr_result_type_e patch_check_header(binmgr_patch_t *patch)
+{
+	uint32_t old_crc;
+	uint32_t pos;
+	uint32_t len;
+	int ret;
+
+	if (memcmp(patch->header, BINMGR_PATCH_MAGIC, 4) != 0 || patch->header[4] != BINMGR_PATCH_VERSION) {
+		bmdbg("Not a binary patch\n");
+		return BINMGR_INVALID_PARAM;
+	}
+	patch->old_size = patch_get32(&patch->header[8]);
+	patch->new_size = patch_get32(&patch->header[16]);
+	patch->new_crc = patch_get32(&patch->header[20]);
+
+	old_crc = 0;
+	for (pos = 0; pos < patch->old_size; pos += len) {
+		len = patch->old_size - pos < CONFIG_BINMGR_DELTA_BUFSIZE ? patch->old_size - pos : CONFIG_BINMGR_DELTA_BUFSIZE;
+		ret = read(patch->old_fd, patch->outbuf, len);
+		if (ret != len) {
+			bmdbg("Fail to read current binary, ret %d, errno %d\n", ret, errno);
+			return BINMGR_OPERATION_FAIL;
+		}
+		old_crc = crc32part(patch->outbuf, len, old_crc);
+	}
+	if (old_crc != patch_get32(&patch->header[12])) {
+		bmdbg("Patch is not made from the running binary\n");
+		return BINMGR_NOT_FOUND;
+	}
+
+	return BINMGR_OK;
+}
+
+/* Take a complete varint of the record in the current state */
+static binmgr_result_type_e patch_field(binmgr_patch_t *patch, uint32_t value)
+{
+	binmgr_result_type_e ret = BINMGR_OK;
+
+	switch (patch->state) {
+	case PATCH_DIFF_LEN:
+		patch->diff_len = value;
+		patch->state = PATCH_EXTRA_LEN;
+		break;
+	case PATCH_EXTRA_LEN:
+		patch->extra_len = value;
+		patch->state = PATCH_SEEK;
+		break;
+	case PATCH_SEEK:
+		patch->seek = value;
+		patch->state = patch->diff_len > 0 ? PATCH_ZEROS : PATCH_EXTRA;
+		break;
+	case PATCH_ZEROS:
+		if (value > patch->diff_len) {
+			return BINMGR_INVALID_PARAM;
+		}
+		ret = patch_output(patch, NULL, NULL, value);
+		patch->diff_len -= value;
+		patch->state = PATCH_LITERAL_LEN;
+		break;
+	default:
+		if (value > patch->diff_len) {
+			return BINMGR_INVALID_PARAM;
+		}
+		patch->count = value;
+		if (value > 0) {
+			patch->state = PATCH_LITERAL;
+		} else {
+			patch->state = patch->diff_len > 0 ? PATCH_ZEROS : PATCH_EXTRA;
+		}
+		break;
+	}
+
+	return ret;
+}
+
+/* Read a varint from the patch data and take it when it is complete */
+static binmgr_result_type_e patch_varint(binmgr_patch_t *patch, const uint8_t **data, size_t *len)
+{
+	uint8_t byte;
+	uint32_t value;
+
+	while (*len > 0) {
+		if (patch->shift > 28) {
+			bmdbg("Invalid varint in patch\n");
+			return BINMGR_INVALID_PARAM;
+		}
+		byte = *(*data)++;
+		(*len)--;
+		patch->value |= (uint32_t)(byte & 0x7f) << patch->shift;
+		patch->shift += 7;
+		if (!(byte & 0x80)) {
+			value = patch->value;
+			patch->value = 0;
+			patch->shift = 0;
+			return patch_field(patch, value);
+		}
+	}
+	return BINMGR_OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+binmgr_result_type_e binary_manager_patch_open(char *binary_name, binmgr_patch_t **patch)
+{
+	binmgr_result_type_e ret;
+	binmgr_patch_t *p;
+	char path[BINARY_PATH_LEN];
+
+	if (binary_name == NULL || patch == NULL) {
+		bmdbg("Invalid parameter\n");
+		return BINMGR_INVALID_PARAM;
+	}
+
+	p = (binmgr_patch_t *)zalloc(sizeof(binmgr_patch_t));
+	if (!p) {
+		return BINMGR_OUT_OF_MEMORY;
+	}
+	p->old_fd = -1;
+	p->new_fd = -1;
+
+	p->outbuf = (uint8_t *)malloc(CONFIG_BINMGR_DELTA_BUFSIZE);
+	if (!p->outbuf) {
+		ret = BINMGR_OUT_OF_MEMORY;
+		goto errout;
+	}
+
+	ret = binary_manager_get_current_path(binary_name, path);
+	if (ret != BINMGR_OK) {
+		goto errout;
+	}
+	p->old_fd = open(path, O_RDONLY);
+	if (p->old_fd < 0) {
+		bmdbg("Fail to open %s, errno %d\n", path, errno);
+		ret = BINMGR_OPERATION_FAIL;
+		goto errout;
+	}
+
+	ret = binary_manager_get_download_path(binary_name, path);
+	if (ret != BINMGR_OK) {
+		goto errout;
+	}
+	p->new_fd = open(path, O_WRONLY);
+	if (p->new_fd < 0) {
+		bmdbg("Fail to open %s, errno %d\n", path, errno);
+		ret = BINMGR_OPERATION_FAIL;
+		goto errout;
+	}
+
+	*patch = p;
+	return BINMGR_OK;
+
+errout:
+	p->state = PATCH_DONE;
+	binary_manager_patch_close(p);
+	return ret;
+}
+
+binmgr_result_type_e binary_manager_patch_write(binmgr_patch_t *patch, const uint8_t *data, size_t len)
+{
+	binmgr_result_type_e ret = BINMGR_OK;
+	uint32_t chunk;
+
+	if (patch == NULL || (data == NULL && len > 0)) {
+		return BINMGR_INVALID_PARAM;
+	}
+
+	while (len > 0 && ret == BINMGR_OK) {
+		switch (patch->state) {
+		case PATCH_HEADER:
+			chunk = BINMGR_PATCH_HEADER_SIZE - patch->count;
+			chunk = len < chunk ? len : chunk;
+			memcpy(&patch->header[patch->count], data, chunk);
+			patch->count += chunk;
+			data += chunk;
+			len -= chunk;
+			if (patch->count == BINMGR_PATCH_HEADER_SIZE) {
+				ret = patch_check_header(patch);
+				patch->count = 0;
+				patch->state = patch->new_size > 0 ? PATCH_DIFF_LEN : PATCH_DONE;
+			}
+			break;
+		case PATCH_DIFF_LEN:
+		case PATCH_EXTRA_LEN:
+		case PATCH_SEEK:
+		case PATCH_ZEROS:
+		case PATCH_LITERAL_LEN:
+			ret = patch_varint(patch, &data, &len);
+			break;
+		case PATCH_LITERAL:
+			chunk = len < patch->count ? len : patch->count;
+			ret = patch_output(patch, data, NULL, chunk);
+			patch->count -= chunk;
+			patch->diff_len -= chunk;
+			data += chunk;
+			len -= chunk;
+			if (patch->count == 0) {
+				patch->state = patch->diff_len > 0 ? PATCH_ZEROS : PATCH_EXTRA;
+			}
+			break;
+		case PATCH_EXTRA:
+			chunk = len < patch->extra_len ? len : patch->extra_len;
+			ret = patch_output(patch, NULL, data, chunk);
+			patch->extra_len -= chunk;
+			data += chunk;
+			len -= chunk;
+			break;
+		default:
+			bmdbg("Data after the end of the patch\n");
+			ret = BINMGR_INVALID_PARAM;
+			break;
+		}
+
+		/* End of a record: move in the current binary, then the next record */
+		if (ret == BINMGR_OK && patch->state == PATCH_EXTRA && patch->extra_len == 0) {
+			patch->old_pos += (patch->seek >> 1) ^ -(patch->seek & 1);
+			patch->state = patch->new_pos == patch->new_size ? PATCH_DONE : PATCH_DIFF_LEN;
+		}
+	}
+
+	return ret;
+}
+
+binmgr_result_type_e binary_manager_patch_close(binmgr_patch_t *patch)
+{
+	binmgr_result_type_e ret = BINMGR_OK;
+
+	if (patch == NULL) {
+		return BINMGR_INVALID_PARAM;
+	}
+
+	if (patch->state != PATCH_DONE) {
+		bmdbg("Patch is incomplete, %u of %u bytes\n", patch->new_pos, patch->new_size);
+		ret = BINMGR_INVALID_PARAM;
+	} else if (patch->new_fd >= 0) {
+		ret = patch_flush(patch);
+		if (ret == BINMGR_OK && patch->crc != patch->new_crc) {
+			bmdbg("CRC of the new binary %u != %u\n", patch->crc, patch->new_crc);
+			ret = BINMGR_INVALID_PARAM;
+		}
+	}
+
+	if (patch->old_fd >= 0) {
+		close(patch->old_fd);
+	}
+	if (patch->new_fd >= 0) {
+		close(patch->new_fd);
+	}
+	free(patch->outbuf);
+	free(patch);
+	return ret;
+}
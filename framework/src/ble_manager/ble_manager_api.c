@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <ble_manager/ble_manager.h>
+#include <tinyara/net/if/ble.h>
 #include "ble_manager_event.h"
 #include "ble_manager_msghandler.h"
 
@@ -136,6 +137,52 @@ ble_result_e ble_manager_conn_param_update(ble_conn_handle *con_handle, ble_conn
 	RETURN_RESULT(res, msg);
 }
 
+ble_result_e ble_manager_set_data_len(ble_conn_handle con_handle, uint16_t tx_octets, uint16_t tx_time)
+{
+	trble_data_len data_len = {con_handle, tx_octets, tx_time};
+	blemgr_msg_s msg = {BLE_CMD_SET_DATA_LEN, BLE_MANAGER_FAIL, (void *)(&data_len), NULL};
+	int res = blemgr_post_message(&msg);
+
+	RETURN_RESULT(res, msg);
+}
+
+ble_result_e ble_manager_set_phy(ble_conn_handle con_handle, uint8_t tx_phys, uint8_t rx_phys)
+{
+	trble_phy phy = {con_handle, tx_phys, rx_phys};
+	blemgr_msg_s msg = {BLE_CMD_SET_PHY, BLE_MANAGER_FAIL, (void *)(&phy), NULL};
+	int res = blemgr_post_message(&msg);
+
+	RETURN_RESULT(res, msg);
+}
+
+ble_result_e ble_manager_set_throughput_mode(ble_conn_handle con_handle, ble_conn_param_role role)
+{
+	ble_conn_param conn_param = {
+		BLE_THROUGHPUT_CONN_INTERVAL_MIN, BLE_THROUGHPUT_CONN_INTERVAL_MAX, 0,
+		BLE_THROUGHPUT_SUPERVISION_TIMEOUT, role};
+	ble_result_e ret;
+
+	ret = ble_manager_conn_param_update(&con_handle, &conn_param);
+	if (ret != BLE_MANAGER_SUCCESS) {
+		return ret;
+	}
+
+	/* Controllers without data length extension or LE 2M keep the link
+	 * as it is, which isn't an error of the mode.
+	 */
+	ret = ble_manager_set_data_len(con_handle, BLE_DATA_LEN_MAX_OCTETS, BLE_DATA_LEN_MAX_TIME);
+	if (ret != BLE_MANAGER_SUCCESS && ret != BLE_MANAGER_UNSUPPORTED) {
+		return ret;
+	}
+
+	ret = ble_manager_set_phy(con_handle, BLE_PHY_2M, BLE_PHY_2M);
+	if (ret != BLE_MANAGER_SUCCESS && ret != BLE_MANAGER_UNSUPPORTED) {
+		return ret;
+	}
+
+	return BLE_MANAGER_SUCCESS;
+}
+
 /* Scanner */
 ble_result_e ble_client_set_scan(uint16_t scan_interval, uint16_t scan_window, uint8_t scan_type)
 {
@@ -346,6 +393,24 @@ ble_result_e ble_client_operation_write_no_response(ble_client_ctx *ctx, ble_att
 	RETURN_RESULT(res, msg);
 }
 
+ble_result_e ble_client_operation_write_no_response_multi(ble_client_ctx *ctx, ble_attr_handle attr_handle, ble_data *data, uint16_t count, uint16_t *sent)
+{
+	uint16_t done = 0;
+
+	if (data == NULL || count == 0) {
+		return BLE_MANAGER_INVALID_ARGS;
+	}
+	if (sent == NULL) {
+		sent = &done;
+	}
+
+	blemgr_msg_params param = {5, {(void *)ctx, (void *)&attr_handle, (void *)data, (void *)&count, (void *)sent}};
+	blemgr_msg_s msg = {BLE_CMD_OP_WRITE_NO_RESP_MULTI, BLE_MANAGER_FAIL, (void *)(&param), NULL};
+	int res = blemgr_post_message(&msg);
+
+	RETURN_RESULT(res, msg);
+}
+
 ble_result_e ble_client_get_write_read_pending_count(ble_client_ctx *ctx, uint8_t *count)
 {
 	blemgr_msg_params param = {2, {(void *)ctx, (void *)count}};
@@ -381,6 +446,24 @@ ble_result_e ble_server_charact_notify(ble_attr_handle attr_handle, ble_conn_han
 	RETURN_RESULT(res, msg);
 }
 
+ble_result_e ble_server_charact_notify_multi(ble_attr_handle attr_handle, ble_conn_handle con_handle, ble_data *data, uint16_t count, uint16_t *sent)
+{
+	uint16_t done = 0;
+
+	if (data == NULL || count == 0) {
+		return BLE_MANAGER_INVALID_ARGS;
+	}
+	if (sent == NULL) {
+		sent = &done;
+	}
+
+	blemgr_msg_params param = {5, {(void *)&attr_handle, (void *)&con_handle, (void *)data, (void *)&count, (void *)sent}};
+	blemgr_msg_s msg = {BLE_CMD_CHARACT_NOTI_MULTI, BLE_MANAGER_FAIL, (void *)(&param), NULL};
+	int res = blemgr_post_message(&msg);
+
+	RETURN_RESULT(res, msg);
+}
+
 ble_result_e ble_server_charact_indicate(ble_attr_handle attr_handle, ble_conn_handle con_handle, ble_data *data)
 {
 	blemgr_msg_params param = {3, {(void *)&attr_handle, (void *)&con_handle, (void *)data}};
@@ -33,6 +33,8 @@ typedef enum {
 	BLE_CMD_CONN_IS_ANY_ACTIVE,
 	BLE_CMD_CONN_PARAM_UPDATE,
 	BLE_CMD_GET_VERSION,
+	BLE_CMD_SET_DATA_LEN,
+	BLE_CMD_SET_PHY,
 
 	// Scanner
 	BLE_CMD_SET_SCAN,
@@ -61,12 +63,14 @@ typedef enum {
 	BLE_CMD_OP_READ,
 	BLE_CMD_OP_WRITE,
 	BLE_CMD_OP_WRITE_NO_RESP,
+	BLE_CMD_OP_WRITE_NO_RESP_MULTI,
 	BLE_CMD_GET_WRITE_READ_PENDING_CNT,
 
 	// Server
 	BLE_CMD_SET_SERVER_CONFIG,
 	BLE_CMD_GET_PROFILE_COUNT,
 	BLE_CMD_CHARACT_NOTI,
+	BLE_CMD_CHARACT_NOTI_MULTI,
 	BLE_CMD_CHARACT_INDI,
 	BLE_CMD_GET_INDICATE_PENDING_CNT,
 	BLE_CMD_ATTR_SET_DATA,
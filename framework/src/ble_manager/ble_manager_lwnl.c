@@ -356,6 +356,17 @@ trble_result_e ble_drv_operation_write_no_response(trble_operation_handle *handl
 	return res;
 }
 
+trble_result_e ble_drv_operation_write_no_response_multi(trble_operation_handle *handle, trble_data *in_data, uint16_t count, uint16_t *sent)
+{
+	trble_result_e res = TRBLE_SUCCESS;
+	lwnl_msg_params msg_data = { 4, {(void *)handle, (void *)in_data, (void *)&count, (void *)sent} };
+	lwnl_msg msg = {BLE_INTF_NAME, {LWNL_REQ_BLE_OP_WRITE_NO_RESP_MULTI}, sizeof(msg_data), (void *)&msg_data, (void *)&res};
+	if (_send_msg(&msg) < 0) {
+		res = TRBLE_FILE_ERROR;
+	}
+	return res;
+}
+
 trble_result_e ble_drv_get_write_read_pending_cnt(trble_conn_handle *handle, uint8_t *count)
 {
 	trble_result_e res = TRBLE_SUCCESS;
@@ -399,6 +410,17 @@ trble_result_e ble_drv_charact_notify(trble_attr_handle attr_handle, trble_conn_
 	return res;
 }
 
+trble_result_e ble_drv_charact_notify_multi(trble_attr_handle attr_handle, trble_conn_handle con_handle, trble_data *data, uint16_t count, uint16_t *sent)
+{
+	trble_result_e res = TRBLE_SUCCESS;
+	lwnl_msg_params msg_data = { 5, {(void *)&attr_handle, (void *)&con_handle, (void *)data, (void *)&count, (void *)sent} };
+	lwnl_msg msg = {BLE_INTF_NAME, {LWNL_REQ_BLE_CHARACT_NOTI_MULTI}, sizeof(msg_data), (void *)&msg_data, (void *)&res};
+	if (_send_msg(&msg) < 0) {
+		res = TRBLE_FILE_ERROR;
+	}
+	return res;
+}
+
 trble_result_e ble_drv_charact_indicate(trble_attr_handle attr_handle, trble_conn_handle con_handle, trble_data *data)
 {
 	trble_result_e res = TRBLE_SUCCESS;
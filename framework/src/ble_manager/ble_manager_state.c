@@ -328,6 +328,20 @@ ble_result_e blemgr_handle_request(blemgr_msg_s *msg)
 		ret = ble_drv_ioctl(&tmsg);
 	} break;
 
+	case BLE_CMD_SET_DATA_LEN: {
+		BLE_STATE_CHECK;
+
+		trble_msg_s tmsg = { TRBLE_MSG_SET_DATA_LEN, msg->param };
+		ret = ble_drv_ioctl(&tmsg);
+	} break;
+
+	case BLE_CMD_SET_PHY: {
+		BLE_STATE_CHECK;
+
+		trble_msg_s tmsg = { TRBLE_MSG_SET_PHY, msg->param };
+		ret = ble_drv_ioctl(&tmsg);
+	} break;
+
 	// Scanner
 	case BLE_CMD_SET_SCAN: {
 		BLE_STATE_CHECK;
@@ -880,6 +894,33 @@ ble_result_e blemgr_handle_request(blemgr_msg_s *msg)
 		ret = ble_drv_operation_write_no_response(handle, data);
 	} break;
 
+	case BLE_CMD_OP_WRITE_NO_RESP_MULTI: {
+		BLE_STATE_CHECK;
+
+		blemgr_msg_params *param = (blemgr_msg_params *)msg->param;
+		ble_client_ctx *ctx = (ble_client_ctx *)param->param[0];
+		ble_attr_handle attr_handle = *(ble_attr_handle *)param->param[1];
+		trble_data *data = (trble_data *)param->param[2];
+		uint16_t count = *(uint16_t *)param->param[3];
+		uint16_t *sent = (uint16_t *)param->param[4];
+
+		if (ctx == NULL) {
+			ret = TRBLE_INVALID_ARGS;
+			break;
+		}
+
+		if (ctx->state != BLE_CLIENT_CONNECTED) {
+			ret = TRBLE_INVALID_STATE;
+			break;
+		}
+
+		trble_operation_handle handle[1] = { 0, };
+		handle->conn_handle = ctx->conn_handle;
+		handle->attr_handle = attr_handle;
+
+		ret = ble_drv_operation_write_no_response_multi(handle, data, count, sent);
+	} break;
+
 	case BLE_CMD_GET_WRITE_READ_PENDING_CNT: {
 		BLE_STATE_CHECK;
 
@@ -926,6 +967,19 @@ ble_result_e blemgr_handle_request(blemgr_msg_s *msg)
 		ret = ble_drv_charact_notify(attr_handle, con_handle, data);
 	} break;
 
+	case BLE_CMD_CHARACT_NOTI_MULTI: {
+		BLE_STATE_CHECK;
+
+		blemgr_msg_params *param = (blemgr_msg_params *)msg->param;
+		trble_attr_handle attr_handle = *(trble_attr_handle *)param->param[0];
+		trble_conn_handle con_handle = *(trble_conn_handle *)param->param[1];
+		trble_data *data = (trble_data *)param->param[2];
+		uint16_t count = *(uint16_t *)param->param[3];
+		uint16_t *sent = (uint16_t *)param->param[4];
+
+		ret = ble_drv_charact_notify_multi(attr_handle, con_handle, data, count, sent);
+	} break;
+
 	case BLE_CMD_CHARACT_INDI: {
 		BLE_STATE_CHECK;
 
@@ -0,0 +1,155 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <debug.h>
+#include <unistd.h>
+#include <string.h>
+#include <stdbool.h>
+#include <netdb.h>
+#include <eventloop/eventloop.h>
+
+#include "eventloop_internal.h"
+
+/* A name being resolved. The resolver is asked with AI_NONBLOCK, and
+ * asked again by a timer of the loop until the answer is cached.
+ */
+struct dns_req_s {
+	char *node;
+	char *service;
+	struct addrinfo hints;
+	getaddrinfo_callback func;
+	void *cb_data;
+	int result;
+	struct addrinfo *res;
+	unsigned int elapsed;
+};
+typedef struct dns_req_s dns_req_t;
+
+static char *dns_strdup(const char *str)
+{
+	char *dup;
+
+	if (str == NULL) {
+		return NULL;
+	}
+
+	dup = (char *)EL_ALLOC(strlen(str) + 1);
+	if (dup != NULL) {
+		strcpy(dup, str);
+	}
+
+	return dup;
+}
+
+static void dns_req_free(dns_req_t *req)
+{
+	EL_FREE(req->node);
+	EL_FREE(req->service);
+	EL_FREE(req);
+}
+
+static bool dns_deliver(void *data)
+{
+	dns_req_t *req = (dns_req_t *)data;
+
+	elvdbg("[%d] %s resolved : %d\n", getpid(), req->node ? req->node : "", req->result);
+
+	req->func(req->result, req->res, req->cb_data);
+	dns_req_free(req);
+
+	return EVENTLOOP_CALLBACK_STOP;
+}
+
+static bool dns_poll(void *data)
+{
+	dns_req_t *req = (dns_req_t *)data;
+
+	req->result = getaddrinfo(req->node, req->service, &req->hints, &req->res);
+	if (req->result == EAI_AGAIN) {
+		req->elapsed += CONFIG_EVENTLOOP_DNS_POLL_INTERVAL;
+		if (req->elapsed < CONFIG_EVENTLOOP_DNS_TIMEOUT) {
+			return EVENTLOOP_CALLBACK_CONTINUE;
+		}
+		req->result = EAI_FAIL;
+	}
+	if (req->result != 0) {
+		req->res = NULL;
+	}
+
+	return dns_deliver(req);
+}
+
+int eventloop_getaddrinfo(const char *node, const char *service, const struct addrinfo *hints, getaddrinfo_callback func, void *cb_data)
+{
+	dns_req_t *req;
+	el_timer_t *timer;
+
+	if (func == NULL || (node == NULL && service == NULL)) {
+		eldbg("Invalid Parameter\n");
+		return EVENTLOOP_INVALID_PARAM;
+	}
+
+	req = (dns_req_t *)EL_ALLOC(sizeof(dns_req_t));
+	if (req == NULL) {
+		eldbg("Failed to allocate request\n");
+		return EVENTLOOP_OUT_OF_MEMORY;
+	}
+	memset(req, 0, sizeof(dns_req_t));
+
+	req->node = dns_strdup(node);
+	req->service = dns_strdup(service);
+	if ((node != NULL && req->node == NULL) || (service != NULL && req->service == NULL)) {
+		eldbg("Failed to allocate names\n");
+		dns_req_free(req);
+		return EVENTLOOP_OUT_OF_MEMORY;
+	}
+	if (hints != NULL) {
+		req->hints.ai_flags = hints->ai_flags;
+		req->hints.ai_family = hints->ai_family;
+		req->hints.ai_socktype = hints->ai_socktype;
+		req->hints.ai_protocol = hints->ai_protocol;
+	}
+	req->hints.ai_flags |= AI_NONBLOCK;
+	req->func = func;
+	req->cb_data = cb_data;
+
+	/* A cached name is answered at once, but func is always called from the loop */
+	req->result = getaddrinfo(req->node, req->service, &req->hints, &req->res);
+	if (req->result == EAI_AGAIN) {
+		timer = eventloop_add_timer(CONFIG_EVENTLOOP_DNS_POLL_INTERVAL, true, dns_poll, req);
+	} else {
+		if (req->result != 0) {
+			req->res = NULL;
+		}
+		timer = eventloop_add_timer(0, false, dns_deliver, req);
+	}
+
+	if (timer == NULL) {
+		eldbg("Failed to add timer\n");
+		if (req->res != NULL) {
+			freeaddrinfo(req->res);
+		}
+		dns_req_free(req);
+		return EVENTLOOP_OUT_OF_MEMORY;
+	}
+
+	return OK;
+}
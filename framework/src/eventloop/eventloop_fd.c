@@ -0,0 +1,216 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <debug.h>
+#include <unistd.h>
+#include <queue.h>
+#include <stdbool.h>
+#include <libtuv/uv.h>
+#include <libtuv/uv__handle.h>
+#include <eventloop/eventloop.h>
+
+#include "eventloop_internal.h"
+
+struct fd_cb_s {
+	int fd;
+	fd_callback func;
+	void *cb_data;
+};
+typedef struct fd_cb_s fd_cb_t;
+
+/* The structure for wrapping of fd handle to be kept in a list internally. */
+struct fd_node_s {
+	struct fd_node_s *flink;
+	el_fd_t *handle;
+};
+typedef struct fd_node_s fd_node_t;
+
+sq_queue_t g_fd_list;  // list node type : fd_node_t
+
+static bool is_registered_fd_cb(el_fd_t *handle)
+{
+	fd_node_t *node_ptr;
+
+	if (handle == NULL) {
+		return false;
+	}
+
+	node_ptr = (fd_node_t *)sq_peek(&g_fd_list);
+	while (node_ptr != NULL && node_ptr->handle != NULL) {
+		if (node_ptr->handle == handle) {
+			return true;
+		}
+		node_ptr = (fd_node_t *)sq_next(node_ptr);
+	}
+
+	return false;
+}
+
+static int eventloop_register_fd_cb(el_fd_t *handle)
+{
+	fd_node_t *fd_node;
+
+	if (handle == NULL) {
+		eldbg("Invalid Parameter\n");
+		return ERROR;
+	}
+
+	fd_node = (fd_node_t *)EL_ALLOC(sizeof(fd_node_t));
+	if (fd_node == NULL) {
+		eldbg("Failed to allocate fd node\n");
+		return ERROR;
+	}
+	fd_node->flink = NULL;
+	fd_node->handle = handle;
+	sq_addlast((FAR sq_entry_t *)fd_node, &g_fd_list);
+
+	return OK;
+}
+
+void eventloop_unregister_fd_cb(el_fd_t *handle)
+{
+	fd_node_t *ptr;
+
+	if (handle == NULL || handle->data == NULL) {
+		return;
+	}
+
+	ptr = (fd_node_t *)sq_peek(&g_fd_list);
+	while (ptr != NULL && ptr->handle != NULL) {
+		if (ptr->handle == handle) {
+			sq_rem((FAR sq_entry_t *)ptr, &g_fd_list);
+			EL_FREE(handle->data);
+			EL_FREE(handle);
+			EL_FREE(ptr);
+			break;
+		}
+		ptr = (fd_node_t *)sq_next(ptr);
+	}
+}
+
+/* Eventloop calls this function when the descriptor is ready.
+ * A descriptor in error is reported once with EVENTLOOP_FD_ERROR and the handler is deleted.
+ */
+static void fd_callback_func(el_fd_t *handle, int status, int events)
+{
+	int ret;
+	fd_cb_t *callback = NULL;
+
+	if (handle == NULL || handle->data == NULL) {
+		eldbg("Invalid fd callback\n");
+		return;
+	}
+
+	callback = (fd_cb_t *)handle->data;
+
+	elvdbg("[%d] fd callback!! fd : %d\n", getpid(), callback->fd);
+
+	if (status < 0) {
+		events = EVENTLOOP_FD_ERROR;
+	}
+
+	ret = callback->func(callback->fd, events, callback->cb_data);
+	/* It is true if eventloop_loop_stop is called in callback function. */
+	if (LOOP_IS_STOPPED(handle->loop)) {
+		return;
+	}
+	/* If callback function returns EVENTLOOP_CALLBACK_STOP, close and unregister the fd handler. */
+	if (status < 0 || ret == EVENTLOOP_CALLBACK_STOP) {
+		uv_close((uv_handle_t *)handle, (uv_close_cb)eventloop_unregister_fd_cb);
+	}
+}
+
+el_fd_t *eventloop_add_fd_handler(int fd, int events, fd_callback func, void *data)
+{
+	int ret;
+	el_loop_t *loop;
+	el_fd_t *handle;
+	fd_cb_t *callback;
+
+	if (fd < 0 || func == NULL || events == 0 || (events & ~(EVENTLOOP_FD_READABLE | EVENTLOOP_FD_WRITABLE)) != 0) {
+		eldbg("Invalid Parameter\n");
+		return NULL;
+	}
+
+	loop = get_app_loop();
+	if (loop == NULL) {
+		eldbg("Failed to get loop\n");
+		return NULL;
+	}
+
+	handle = (el_fd_t *)EL_ALLOC(sizeof(el_fd_t));
+	if (handle == NULL) {
+		eldbg("Failed to allocate fd handle\n");
+		return NULL;
+	}
+
+	callback = (fd_cb_t *)EL_ALLOC(sizeof(fd_cb_t));
+	if (callback == NULL) {
+		eldbg("Failed to allocate callback\n");
+		EL_FREE(handle);
+		return NULL;
+	}
+	callback->fd = fd;
+	callback->func = func;
+	callback->cb_data = data;
+	handle->data = (void *)callback;
+
+	/* Add fd handle to a list of handles */
+	ret = eventloop_register_fd_cb(handle);
+	if (ret != OK) {
+		eldbg("Failed to register fd handle\n");
+		EL_FREE(callback);
+		EL_FREE(handle);
+		return NULL;
+	}
+
+	ret = uv_poll_init(loop, handle, fd);
+	if (ret != 0) {
+		eldbg("Failed to initialize fd handle\n");
+		eventloop_unregister_fd_cb(handle);
+		return NULL;
+	}
+
+	ret = uv_poll_start(handle, events, (uv_poll_cb)fd_callback_func);
+	if (ret != 0) {
+		eldbg("Failed to start fd handle\n");
+		uv_close((uv_handle_t *)handle, (uv_close_cb)eventloop_unregister_fd_cb);
+		return NULL;
+	}
+	elvdbg("created fd handle %p, fd = %d\n", handle, fd);
+
+	return handle;
+}
+
+int eventloop_del_fd_handler(el_fd_t *handle)
+{
+	if (handle == NULL) {
+		eldbg("Invalid Parameter\n");
+		return EVENTLOOP_INVALID_PARAM;
+	}
+
+	if (!is_registered_fd_cb(handle) || uv__is_closing(handle)) {
+		return EVENTLOOP_INVALID_HANDLE;
+	}
+
+	uv_close((uv_handle_t *)handle, (uv_close_cb)eventloop_unregister_fd_cb);
+
+	return OK;
+}
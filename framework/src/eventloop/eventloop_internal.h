@@ -19,6 +19,7 @@
 #ifndef __EVENTLOOP_INTERNAL_H__
 #define __EVENTLOOP_INTERNAL_H__
 
+#include <stdbool.h>
 #include <stdlib.h>
 
 /* Wrapper of allocation APIs */
@@ -40,5 +41,10 @@ int get_async_task(void);
 void eventloop_unregister_timer(el_timer_t *timer);
 void eventloop_unregister_event_cb(el_event_t *handle);
 void eventloop_unregister_thread_safe_cb(el_async_t *handle);
+void eventloop_unregister_fd_cb(el_fd_t *handle);
+void eventloop_unregister_source(el_source_t *handle);
+
+/* An async handle is either the thread-safe call handle of a task or a source */
+bool eventloop_is_source(el_async_t *handle);
 
 #endif
@@ -107,7 +107,14 @@ static void eventloop_close_handle(uv_handle_t *handle, void *data)
 		uv_close(handle, (uv_close_cb)eventloop_unregister_event_cb);
 		break;
 	case UV_ASYNC:
-		uv_close(handle, (uv_close_cb)eventloop_unregister_thread_safe_cb);
+		if (eventloop_is_source((el_async_t *)handle)) {
+			uv_close(handle, (uv_close_cb)eventloop_unregister_source);
+		} else {
+			uv_close(handle, (uv_close_cb)eventloop_unregister_thread_safe_cb);
+		}
+		break;
+	case UV_POLL:
+		uv_close(handle, (uv_close_cb)eventloop_unregister_fd_cb);
 		break;
 	default:
 		break;
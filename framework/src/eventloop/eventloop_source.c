@@ -0,0 +1,292 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <debug.h>
+#include <errno.h>
+#include <unistd.h>
+#include <queue.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <string.h>
+#include <libtuv/uv.h>
+#include <libtuv/uv__handle.h>
+#include <eventloop/eventloop.h>
+
+#include "eventloop_internal.h"
+
+/* A slot of the ring keeps the size of the event before its data. */
+#define SOURCE_SLOT_ALIGN(size)  (((size) + sizeof(int) - 1) & ~(sizeof(int) - 1))
+#define SOURCE_SLOT_SIZE(ring)   (sizeof(int) + SOURCE_SLOT_ALIGN((ring)->event_size))
+#define SOURCE_SLOT(ring, idx)   ((int *)((ring)->slots + SOURCE_SLOT_SIZE(ring) * ((idx) % (ring)->nevents)))
+
+/* The ring of a source. It is allocated with the source and its events are copied
+ * in and out of the slots, so posting an event does not allocate.
+ * head and tail only grow, the number of pending events is tail - head.
+ */
+struct source_ring_s {
+	source_callback func;
+	void *cb_data;
+	int event_size;
+	int nevents;
+	unsigned int head;
+	unsigned int tail;
+	sem_t ring_sem;
+	char slots[];
+};
+typedef struct source_ring_s source_ring_t;
+
+/* The structure for wrapping of source handle to be kept in a list internally. */
+struct source_node_s {
+	struct source_node_s *flink;
+	el_source_t *handle;
+};
+typedef struct source_node_s source_node_t;
+
+sq_queue_t g_source_list;  // list node type : source_node_t
+
+static void source_ring_lock(source_ring_t *ring)
+{
+	while (sem_wait(&ring->ring_sem) != OK) {
+		if (errno != EINTR) {
+			return;
+		}
+	}
+}
+
+static void source_ring_unlock(source_ring_t *ring)
+{
+	sem_post(&ring->ring_sem);
+}
+
+bool eventloop_is_source(el_async_t *handle)
+{
+	source_node_t *node_ptr;
+
+	if (handle == NULL) {
+		return false;
+	}
+
+	node_ptr = (source_node_t *)sq_peek(&g_source_list);
+	while (node_ptr != NULL && node_ptr->handle != NULL) {
+		if (node_ptr->handle == handle) {
+			return true;
+		}
+		node_ptr = (source_node_t *)sq_next(node_ptr);
+	}
+
+	return false;
+}
+
+static int eventloop_register_source(el_source_t *handle)
+{
+	source_node_t *source_node;
+
+	if (handle == NULL) {
+		eldbg("Invalid Parameter\n");
+		return ERROR;
+	}
+
+	source_node = (source_node_t *)EL_ALLOC(sizeof(source_node_t));
+	if (source_node == NULL) {
+		eldbg("Failed to allocate source node\n");
+		return ERROR;
+	}
+	source_node->flink = NULL;
+	source_node->handle = handle;
+	sq_addlast((FAR sq_entry_t *)source_node, &g_source_list);
+
+	return OK;
+}
+
+void eventloop_unregister_source(el_source_t *handle)
+{
+	source_node_t *ptr;
+
+	if (handle == NULL || handle->data == NULL) {
+		return;
+	}
+
+	ptr = (source_node_t *)sq_peek(&g_source_list);
+	while (ptr != NULL && ptr->handle != NULL) {
+		if (ptr->handle == handle) {
+			sq_rem((FAR sq_entry_t *)ptr, &g_source_list);
+			sem_destroy(&((source_ring_t *)handle->data)->ring_sem);
+			EL_FREE(handle->data);
+			EL_FREE(handle);
+			EL_FREE(ptr);
+			break;
+		}
+		ptr = (source_node_t *)sq_next(ptr);
+	}
+}
+
+/* Eventloop calls this function when events were posted to the source.
+ * Posts are coalesced into one wake-up, so all events pending at this time are
+ * dispatched in a batch. An event is taken out of the ring after its callback,
+ * so the slot is not reused while the callback reads it.
+ */
+static void source_callback_func(el_source_t *handle)
+{
+	int ret;
+	int *slot;
+	unsigned int pending;
+	source_ring_t *ring;
+
+	if (handle == NULL || handle->data == NULL) {
+		eldbg("Invalid source callback\n");
+		return;
+	}
+
+	ring = (source_ring_t *)handle->data;
+
+	source_ring_lock(ring);
+	pending = ring->tail - ring->head;
+	source_ring_unlock(ring);
+
+	elvdbg("[%d] source callback!! %u events\n", getpid(), pending);
+
+	while (pending-- > 0) {
+		slot = SOURCE_SLOT(ring, ring->head);
+		ret = ring->func((void *)(slot + 1), *slot, ring->cb_data);
+		/* It is true if eventloop_loop_stop is called in callback function. */
+		if (LOOP_IS_STOPPED(handle->loop)) {
+			return;
+		}
+		/* If callback function returns EVENTLOOP_CALLBACK_STOP, close and unregister the source. */
+		if (ret == EVENTLOOP_CALLBACK_STOP) {
+			uv_close((uv_handle_t *)handle, (uv_close_cb)eventloop_unregister_source);
+			return;
+		}
+
+		source_ring_lock(ring);
+		ring->head++;
+		source_ring_unlock(ring);
+	}
+}
+
+el_source_t *eventloop_add_source(int event_size, int nevents, source_callback func, void *cb_data)
+{
+	int ret;
+	el_loop_t *loop;
+	el_source_t *handle;
+	source_ring_t *ring;
+
+	if (event_size < 0 || nevents <= 0 || func == NULL) {
+		eldbg("Invalid Parameter\n");
+		return NULL;
+	}
+
+	loop = get_app_loop();
+	if (loop == NULL) {
+		eldbg("Failed to get loop\n");
+		return NULL;
+	}
+
+	handle = (el_source_t *)EL_ALLOC(sizeof(el_source_t));
+	if (handle == NULL) {
+		eldbg("Failed to allocate source handle\n");
+		return NULL;
+	}
+
+	ring = (source_ring_t *)EL_ALLOC(sizeof(source_ring_t) + (sizeof(int) + SOURCE_SLOT_ALIGN(event_size)) * nevents);
+	if (ring == NULL) {
+		eldbg("Failed to allocate source ring\n");
+		EL_FREE(handle);
+		return NULL;
+	}
+	ring->func = func;
+	ring->cb_data = cb_data;
+	ring->event_size = event_size;
+	ring->nevents = nevents;
+	ring->head = 0;
+	ring->tail = 0;
+	sem_init(&ring->ring_sem, 0, 1);
+	handle->data = (void *)ring;
+
+	/* Add source handle to a list of handles */
+	ret = eventloop_register_source(handle);
+	if (ret != OK) {
+		eldbg("Failed to register source handle\n");
+		sem_destroy(&ring->ring_sem);
+		EL_FREE(ring);
+		EL_FREE(handle);
+		return NULL;
+	}
+
+	ret = uv_async_init(loop, handle, (uv_async_cb)source_callback_func);
+	if (ret != 0) {
+		eldbg("Failed to initialize source handle\n");
+		eventloop_unregister_source(handle);
+		return NULL;
+	}
+	elvdbg("created source handle %p, %d events of %d bytes\n", handle, nevents, event_size);
+
+	return handle;
+}
+
+int eventloop_post_source(el_source_t *handle, const void *event, int size)
+{
+	int *slot;
+	source_ring_t *ring;
+
+	if (handle == NULL || handle->data == NULL || size < 0 || (size > 0 && event == NULL)) {
+		eldbg("Invalid Parameter\n");
+		return EVENTLOOP_INVALID_PARAM;
+	}
+
+	ring = (source_ring_t *)handle->data;
+	if (size > ring->event_size) {
+		eldbg("Too big event, %d > %d\n", size, ring->event_size);
+		return EVENTLOOP_INVALID_PARAM;
+	}
+
+	source_ring_lock(ring);
+	if (ring->tail - ring->head == (unsigned int)ring->nevents) {
+		source_ring_unlock(ring);
+		return EVENTLOOP_BUSY;
+	}
+	slot = SOURCE_SLOT(ring, ring->tail);
+	*slot = size;
+	if (size > 0) {
+		memcpy((void *)(slot + 1), event, size);
+	}
+	ring->tail++;
+	source_ring_unlock(ring);
+
+	uv_async_send(handle);
+
+	return OK;
+}
+
+int eventloop_del_source(el_source_t *handle)
+{
+	if (handle == NULL) {
+		eldbg("Invalid Parameter\n");
+		return EVENTLOOP_INVALID_PARAM;
+	}
+
+	if (!eventloop_is_source(handle) || uv__is_closing(handle)) {
+		return EVENTLOOP_INVALID_HANDLE;
+	}
+
+	uv_close((uv_handle_t *)handle, (uv_close_cb)eventloop_unregister_source);
+
+	return OK;
+}
@@ -82,7 +82,8 @@ void *iotapi_handler(void *data)
 	pthread_mutex_unlock(&g_ia_lock);
 
 	for (;;) {
-		int timeout = 10;
+		/* The pipe wakes the handler up for a new element or to stop */
+		int timeout = -1;
 		int size = _iotapi_alloc_event();
 		ibdbg("[iotcom] Wait sysio events(%d)\n", size);
 		int ret = poll(g_ia_evtlist, size, timeout);
@@ -27,9 +27,11 @@
 #include <string.h>
 #include <fcntl.h>
 #include <poll.h>
+#include <errno.h>
 #include <sys/ioctl.h>
 #include <sys/types.h>
 #include <tinyara/analog/adc.h>
+#include <tinyara/analog/ioctl.h>
 #include <iotbus/iotbus_error.h>
 #include <iotbus/iotbus_adc.h>
 
@@ -40,6 +42,9 @@ struct _iotbus_adc_s {
 	iotbus_adc_state_e state;
 	sem_t state_sem;
 	adc_read_cb callback;
+#ifdef CONFIG_ADC_SCAN
+	adc_scan_cb scan_callback;
+#endif
 };
 
 struct _iotbus_adc_wrapper_s {
@@ -116,6 +121,57 @@ static void *iotbus_adc_handler(void *hnd)
 	return 0;
 }
 
+#ifdef CONFIG_ADC_SCAN
+static void *iotbus_adc_scan_handler(void *hnd)
+{
+	struct _iotbus_adc_s *handle;
+	struct adc_block_s *block;
+	ssize_t nbytes;
+	int ret;
+	int timeout = 100;
+
+	struct pollfd fds[1];
+
+	handle = (struct _iotbus_adc_s *)hnd;
+
+	memset(fds, 0, sizeof(fds));
+	fds[0].fd = handle->fd;
+	fds[0].events = POLLIN | POLLERR;
+
+	block = (struct adc_block_s *)malloc(sizeof(struct adc_block_s));
+	if (!block) {
+		ibdbg("[ADC] scan: out of memory\n");
+		goto errout;
+	}
+
+	while (handle->state != IOTBUS_ADC_STOP) {
+		ret = poll(fds, 1, timeout);
+		if (ret <= 0) {
+			continue;
+		}
+
+		if (fds[0].revents & POLLIN) {
+			nbytes = read(handle->fd, (char *)block, sizeof(struct adc_block_s));
+			if (nbytes < 0) {
+				ibdbg("[ADC] scan: Fail to read...\n");
+				break;
+			} else if (nbytes == sizeof(struct adc_block_s)) {
+				handle->scan_callback(block->ab_timestamp, block->ab_period, block->ab_nchannels, block->ab_data, block->ab_nsamples, block->ab_overrun);
+			}
+		}
+	}
+	free(block);
+
+errout:
+	ioctl(handle->fd, ANIOC_SCAN_STOP, 0);
+	handle->state = IOTBUS_ADC_RDY;
+	sem_post(&handle->state_sem);
+	ibdbg("[ADC] exit iotbus_adc scan handler\n");
+
+	return 0;
+}
+#endif
+
 iotbus_adc_context_h iotbus_adc_init(int bus, uint8_t channel)
 {
 	int fd;
@@ -144,6 +200,9 @@ iotbus_adc_context_h iotbus_adc_init(int bus, uint8_t channel)
 
 	handle->fd = fd;
 	handle->callback = NULL;
+#ifdef CONFIG_ADC_SCAN
+	handle->scan_callback = NULL;
+#endif
 	handle->bus = bus;
 	handle->channel = channel;
 	handle->state = IOTBUS_ADC_RDY;
@@ -244,6 +303,50 @@ int iotbus_adc_start(iotbus_adc_context_h hnd, const adc_read_cb read_cb)
 	return IOTBUS_ERROR_NONE;
 }
 
+#ifdef CONFIG_ADC_SCAN
+int iotbus_adc_start_scan(iotbus_adc_context_h hnd, const uint8_t *channels, int nchannels, uint32_t rate, const adc_scan_cb scan_cb)
+{
+	struct _iotbus_adc_s *handle;
+	struct adc_scan_s scan;
+	pthread_t tid;
+	int ret;
+
+	if (!hnd || !hnd->handle || !channels || !scan_cb || nchannels <= 0 || nchannels > CONFIG_ADC_SCAN_NCHANNELS) {
+		return IOTBUS_ERROR_INVALID_PARAMETER;
+	}
+
+	handle = (struct _iotbus_adc_s *)hnd->handle;
+
+	if (handle->state != IOTBUS_ADC_RDY) {
+		return IOTBUS_ERROR_DEVICE_NOT_READY;
+	}
+
+	scan.as_rate = rate;
+	scan.as_nchannels = nchannels;
+	memcpy(scan.as_channels, channels, nchannels);
+
+	ret = ioctl(handle->fd, ANIOC_SCAN_START, (unsigned long)((uintptr_t)&scan));
+	if (ret < 0) {
+		ibdbg("[ADC] scan start error(%d)\n", errno);
+		return errno == ENOSYS ? IOTBUS_ERROR_NOT_SUPPORTED : IOTBUS_ERROR_INVALID_PARAMETER;
+	}
+
+	handle->scan_callback = scan_cb;
+	handle->state = IOTBUS_ADC_BUSY;
+
+	ret = pthread_create(&tid, NULL, iotbus_adc_scan_handler, (void *)handle);
+	if (ret != 0) {
+		ibdbg("[ADC] create scan handler fail(%d)\n", ret);
+		ioctl(handle->fd, ANIOC_SCAN_STOP, 0);
+		handle->state = IOTBUS_ADC_RDY;
+		return IOTBUS_ERROR_UNKNOWN;
+	}
+	pthread_detach(tid);
+
+	return IOTBUS_ERROR_NONE;
+}
+#endif
+
 int iotbus_adc_stop(iotbus_adc_context_h hnd)
 {
 	struct _iotbus_adc_s *handle;
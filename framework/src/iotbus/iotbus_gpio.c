@@ -49,6 +49,9 @@ struct _iotbus_gpio_s {
 	int fd;
 	gpio_isr_cb isr_cb;
 	iotbus_gpio_cb cb;
+#ifdef CONFIG_GPIO_EVENTS
+	gpio_event_cb event_cb;
+#endif
 	void *ud;
 };
 
@@ -83,6 +86,32 @@ void gpio_async_handler(void *data)
 	return;
 }
 
+#ifdef CONFIG_GPIO_EVENTS
+void gpio_event_handler(void *data)
+{
+	struct _iotbus_gpio_s *handle = (struct _iotbus_gpio_s *)data;
+	struct gpio_event_s event[CONFIG_GPIO_NEVENTS];
+	struct gpio_events_s events;
+	int ret;
+	int i;
+
+	events.events = event;
+	events.nevents = CONFIG_GPIO_NEVENTS;
+	ret = ioctl(handle->fd, GPIOIOC_GET_EVENTS, (unsigned long)((uintptr_t)&events));
+	if (ret < 0) {
+		ibdbg("get events failed(%d)\n", errno);
+		return;
+	}
+	if (events.ndropped > 0) {
+		ibdbg("%d gpio events dropped\n", events.ndropped);
+	}
+
+	for (i = 0; i < ret && handle->event_cb != NULL; i++) {
+		handle->event_cb(handle->ud, event[i].timestamp, event[i].value);
+	}
+}
+#endif
+
 /**
  * @brief Initializes gpio_context, based on Gpio pin.
  */
@@ -119,6 +148,9 @@ iotbus_gpio_context_h iotbus_gpio_open(int gpiopin)
 	handle->fd = fd;
 	handle->isr_cb = NULL;
 	handle->cb = NULL;
+#ifdef CONFIG_GPIO_EVENTS
+	handle->event_cb = NULL;
+#endif
 
 	dev->handle = handle;
 
@@ -142,7 +174,11 @@ int iotbus_gpio_close(iotbus_gpio_context_h dev)
 
 	handle = (struct _iotbus_gpio_s *)dev->handle;
 
+#ifdef CONFIG_GPIO_EVENTS
+	if (handle->isr_cb != NULL || handle->event_cb != NULL) {
+#else
 	if (handle->isr_cb != NULL) {
+#endif
 		int ret = iotbus_gpio_unregister_cb(dev);
 		if (ret != IOTBUS_ERROR_NONE) {
 			return ret;
@@ -370,11 +406,47 @@ int iotbus_gpio_unregister_cb(iotbus_gpio_context_h dev)
 	iotapi_remove(&elm);
 
 	handle->isr_cb = NULL;
+#ifdef CONFIG_GPIO_EVENTS
+	handle->event_cb = NULL;
+#endif
 	handle->ud = NULL;
 
 	return IOTBUS_ERROR_NONE;
 }
 
+#ifdef CONFIG_GPIO_EVENTS
+/**
+ * @brief Registers event handler callback for interrupt with the time of each edge.
+ */
+int iotbus_gpio_register_event_cb(iotbus_gpio_context_h dev, iotbus_gpio_edge_e edge, gpio_event_cb event_cb, void *user_data)
+{
+	int ret;
+	iotapi_elem elm;
+	struct _iotbus_gpio_s *handle;
+
+	if (event_cb == NULL) {
+		return IOTBUS_ERROR_INVALID_PARAMETER;
+	}
+
+	ret = iotbus_gpio_set_edge_mode(dev, edge);
+	if (ret != IOTBUS_ERROR_NONE) {
+		return ret;
+	}
+
+	handle = (struct _iotbus_gpio_s *)dev->handle;
+
+	handle->ud = user_data;
+	handle->event_cb = event_cb;
+	elm.fd = handle->fd;
+	elm.data = handle;
+	elm.func = gpio_event_handler;
+
+	iotapi_insert(&elm);
+
+	return IOTBUS_ERROR_NONE;
+}
+#endif
+
 #ifdef CONFIG_IOTDEV
 int iotbus_gpio_set_interrupt(iotbus_gpio_context_h dev, iotbus_int_type_e int_type, iotbus_gpio_cb cb)
 {
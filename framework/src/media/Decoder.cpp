@@ -29,6 +29,9 @@ Decoder::Decoder(audio_type_t audioType, unsigned short channels, unsigned int s
 	mAudioType(audioType),
 	mChannels(channels),
 	mSampleRate(sampleRate)
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	, mBackend(nullptr), mBackendHandle(nullptr)
+#endif
 #endif
 {
 #ifdef CONFIG_AUDIO_CODEC
@@ -39,6 +42,12 @@ Decoder::Decoder(audio_type_t audioType, unsigned short channels, unsigned int s
 Decoder::~Decoder()
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		mBackend->close(mBackendHandle);
+		return;
+	}
+#endif
 	if (audio_decoder_finish(&mDecoder) != AUDIO_DECODER_OK) {
 		meddbg("Error! audio_decoder_finish failed!\n");
 	}
@@ -71,6 +80,12 @@ std::shared_ptr<Decoder> Decoder::create(audio_type_t audioType, unsigned short
 bool Decoder::init(void)
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (codec_backend_open(CODEC_BACKEND_DECODER, mAudioType, mSampleRate, mChannels, &mBackend, &mBackendHandle) == OK) {
+		medvdbg("audio type %d is decoded by a codec backend\n", mAudioType);
+		return true;
+	}
+#endif
 	if (audio_decoder_init(&mDecoder, CONFIG_AUDIO_CODEC_RINGBUFFER_SIZE) != AUDIO_DECODER_OK) {
 		meddbg("%s[line : %d] Fail : audio_decoder_init is failed\n", __func__, __LINE__);
 		return false;
@@ -97,6 +112,12 @@ size_t Decoder::pushData(unsigned char *buf, size_t size)
 		size = rmax;
 	}
 
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		// Handed over as is, the backend reads the caller's buffer
+		return mBackend->push(mBackendHandle, buf, size);
+	}
+#endif
 	return audio_decoder_pushdata(&mDecoder, buf, size);
 #else
 	return 0;
@@ -119,6 +140,11 @@ size_t Decoder::pushData(unsigned char *buf, size_t size)
 bool Decoder::getFrame(unsigned char *buf, size_t *size, unsigned int *sampleRate, unsigned short *channels)
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		*size = mBackend->pull(mBackendHandle, buf, *size, sampleRate, channels);
+	} else
+#endif
 	*size = audio_decoder_get_frames(&mDecoder, buf, *size, sampleRate, channels);
 	if (*size == 0) {
 		return false;
@@ -138,6 +164,11 @@ bool Decoder::getFrame(unsigned char *buf, size_t *size, unsigned int *sampleRat
 bool Decoder::empty()
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		return mBackend->empty(mBackendHandle);
+	}
+#endif
 	return audio_decoder_dataspace_is_empty(&mDecoder);
 #else
 	return false;
@@ -147,6 +178,11 @@ bool Decoder::empty()
 size_t Decoder::getAvailSpace()
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		return mBackend->space(mBackendHandle);
+	}
+#endif
 	return rb_avail(mDecoder.rbsp->rbp);
 #else
 	return 0;
@@ -27,6 +27,9 @@
 #ifdef CONFIG_AUDIO_CODEC
 #include "codec/audio_decoder.h"
 #endif
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+#include <media/codec_backend.h>
+#endif
 
 namespace media {
 
@@ -57,6 +60,11 @@ private:
 	unsigned short mChannels;
 	/* Sample rate of the input audio data. */
 	unsigned int mSampleRate;
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	/* Hardware or DSP decoder taking the stream, software decodes when null */
+	const codec_backend_ops_t *mBackend;
+	void *mBackendHandle;
+#endif
 #endif
 };
 } // namespace media
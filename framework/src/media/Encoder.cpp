@@ -34,6 +34,9 @@ Encoder::Encoder(audio_type_t audioType, unsigned short channels, unsigned int s
 	mSampleRate(sampleRate),
 	inputBuf(nullptr),
 	outputBuf(nullptr)
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	, mBackend(nullptr), mBackendHandle(nullptr)
+#endif
 #endif
 {
 #ifdef CONFIG_AUDIO_CODEC
@@ -67,6 +70,12 @@ std::shared_ptr<Encoder> Encoder::create(audio_type_t audioType, unsigned short
 bool Encoder::init(void)
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (codec_backend_open(CODEC_BACKEND_ENCODER, mAudioType, mSampleRate, mChannels, &mBackend, &mBackendHandle) == OK) {
+		medvdbg("audio type %d is encoded by a codec backend\n", mAudioType);
+		return true;
+	}
+#endif
 	switch (mAudioType) {
 #ifdef CONFIG_CODEC_LIBOPUS
 	case AUDIO_TYPE_OPUS: {
@@ -121,6 +130,12 @@ bool Encoder::init(void)
 Encoder::~Encoder()
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		mBackend->close(mBackendHandle);
+		return;
+	}
+#endif
 	if (audio_encoder_finish(&mEncoder) != AUDIO_ENCODER_OK) {
 		meddbg("Error! audio_encoder_finish failed!\n");
 	}
@@ -137,6 +152,12 @@ Encoder::~Encoder()
 size_t Encoder::pushData(unsigned char *buf, size_t size)
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		// Handed over as is, the backend reads the caller's buffer
+		return mBackend->push(mBackendHandle, buf, size);
+	}
+#endif
 	return audio_encoder_pushdata(&mEncoder, buf, size);
 #else
 	return 0;
@@ -147,6 +168,11 @@ bool Encoder::getFrame(unsigned char *buf, size_t *size)
 {
 #ifdef CONFIG_AUDIO_CODEC
 	int len = *size;
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		len = (int)mBackend->pull(mBackendHandle, buf, *size, NULL, NULL);
+	} else
+#endif
 	len = audio_encoder_getframe(&mEncoder, (void *)buf, len);
 
 	if (len <= 0) {
@@ -164,6 +190,11 @@ bool Encoder::getFrame(unsigned char *buf, size_t *size)
 bool Encoder::empty()
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		return mBackend->empty(mBackendHandle);
+	}
+#endif
 	return audio_encoder_dataspace_is_empty(&mEncoder);
 #else
 	return false;
@@ -173,6 +204,11 @@ bool Encoder::empty()
 size_t Encoder::getAvailSpace()
 {
 #ifdef CONFIG_AUDIO_CODEC
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	if (mBackend) {
+		return mBackend->space(mBackendHandle);
+	}
+#endif
 	return audio_encoder_dataspace(&mEncoder);
 #else
 	return 0;
@@ -27,6 +27,9 @@
 #ifdef CONFIG_AUDIO_CODEC
 #include "codec/audio_encoder.h"
 #endif
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+#include <media/codec_backend.h>
+#endif
 
 namespace media {
 
@@ -52,6 +55,11 @@ private:
 	unsigned int mSampleRate;
 	signed short *inputBuf;
 	unsigned char *outputBuf;
+#ifdef CONFIG_AUDIO_CODEC_BACKEND
+	/* Hardware or DSP encoder taking the stream, software encodes when null */
+	const codec_backend_ops_t *mBackend;
+	void *mBackendHandle;
+#endif
 #endif
 };
 } // namespace media
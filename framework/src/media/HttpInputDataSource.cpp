@@ -24,6 +24,7 @@
 #include <unistd.h>
 #include <assert.h>
 #include <media/HttpInputDataSource.h>
+#include <algorithm>
 #include <chrono>
 
 #include <media/MediaUtils.h>
@@ -45,23 +46,43 @@
 #define CONFIG_HTTPSOURCE_DOWNLOAD_STACKSIZE 8192
 #endif
 
+#ifndef CONFIG_HTTPSOURCE_RECONNECT_COUNT
+#define CONFIG_HTTPSOURCE_RECONNECT_COUNT 3
+#endif
+
+#ifndef CONFIG_HTTPSOURCE_RECONNECT_DELAY
+#define CONFIG_HTTPSOURCE_RECONNECT_DELAY 500
+#endif
+
+#ifndef CONFIG_HTTPSOURCE_HEALTH_INTERVAL
+#define CONFIG_HTTPSOURCE_HEALTH_INTERVAL 1000
+#endif
+
 namespace media {
 namespace stream {
 
 // Content-Type tag
 static const std::string TAG_CONTENT_TYPE = "Content-Type:";
+// Content-Length tag
+static const std::string TAG_CONTENT_LENGTH = "Content-Length:";
 
 static const std::chrono::seconds WAIT_HEADER_TIMEOUT = std::chrono::seconds(3);
 static const std::chrono::seconds WAIT_DATA_TIMEOUT = std::chrono::seconds(3);
 
 HttpInputDataSource::HttpInputDataSource(const std::string &url)
 	: InputDataSource(), mUrl(url), mThread((pthread_t)0), mIsHeaderReceived(false), mIsDataReceived(false)
+	, mContentLength(0), mOffset(0), mResumeOffset(0), mSkip(0), mDownloadFinished(false), mRebuffering(false)
+	, mRebufferThreshold(CONFIG_HTTPSOURCE_DOWNLOAD_BUFFER_THRESHOLD), mConsumed(0), mUnderruns(0), mReconnects(0)
+	, mWindowOffset(0), mWindowConsumed(0), mWindowUnderruns(0), mHealth(), mHealthReported(true)
 {
 	medvdbg("url: %s\n", mUrl.c_str());
 }
 
 HttpInputDataSource::HttpInputDataSource(const HttpInputDataSource &source)
 	: InputDataSource(source), mUrl(source.mUrl), mThread((pthread_t)0), mIsHeaderReceived(source.mIsHeaderReceived), mIsDataReceived(source.mIsDataReceived)
+	, mContentLength(0), mOffset(0), mResumeOffset(0), mSkip(0), mDownloadFinished(false), mRebuffering(false)
+	, mRebufferThreshold(CONFIG_HTTPSOURCE_DOWNLOAD_BUFFER_THRESHOLD), mConsumed(0), mUnderruns(0), mReconnects(0)
+	, mWindowOffset(0), mWindowConsumed(0), mWindowUnderruns(0), mHealth(), mHealthReported(true)
 {
 }
 
@@ -107,6 +128,20 @@ bool HttpInputDataSource::open()
 	std::unique_lock<std::mutex> lock(mMutex);
 	mIsHeaderReceived = false;
 	mIsDataReceived = false;
+	mContentLength = 0;
+	mOffset = 0;
+	mDownloadFinished = false;
+	mRebuffering = false;
+	mRebufferThreshold = mStreamBuffer->getThreshold();
+	mConsumed = 0;
+	mUnderruns = 0;
+	mReconnects = 0;
+	mWindowStart = std::chrono::steady_clock::now();
+	mWindowOffset = 0;
+	mWindowConsumed = 0;
+	mWindowUnderruns = 0;
+	mHealth = buffer_health_t();
+	mHealthReported = true;
 
 	pthread_attr_t attr;
 	pthread_attr_init(&attr);
@@ -217,21 +252,104 @@ ssize_t HttpInputDataSource::read(unsigned char *buf, size_t size)
 		return EOF;
 	}
 
+	{
+		// After an underrun, let the download get ahead again before reading on
+		std::unique_lock<std::mutex> lock(mMutex);
+		if (mRebuffering) {
+			medvdbg("rebuffering up to %u bytes\n", mRebufferThreshold);
+			mCondv.wait(lock, [this] { return !mRebuffering; });
+		}
+	}
+
 	size_t rlen = 0;
 	if (mBufferReader) {
 		rlen = mBufferReader->read(buf, size);
 	}
+	mConsumed += rlen;
+	updateRates();
 
 	medvdbg("read size: %d\n", rlen);
 	return rlen;
 }
 
+bool HttpInputDataSource::getBufferHealth(buffer_health_t *health)
+{
+	if (health == nullptr || mHealthReported) {
+		return false;
+	}
+
+	*health = mHealth;
+	mHealthReported = true;
+	return true;
+}
+
+void HttpInputDataSource::updateRates()
+{
+	auto now = std::chrono::steady_clock::now();
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - mWindowStart).count();
+	if (elapsed < CONFIG_HTTPSOURCE_HEALTH_INTERVAL) {
+		return;
+	}
+
+	size_t offset = mOffset;
+	unsigned int downloadRate = (unsigned int)((uint64_t)(offset - mWindowOffset) * 1000 / elapsed);
+	unsigned int consumeRate = (unsigned int)((uint64_t)(mConsumed - mWindowConsumed) * 1000 / elapsed);
+	unsigned int underruns = mUnderruns;
+
+	// Rates are smoothed over a few intervals, a first estimate is taken as is
+	if (mHealth.downloadRate == 0 && mHealth.consumeRate == 0) {
+		mHealth.downloadRate = downloadRate;
+		mHealth.consumeRate = consumeRate;
+	} else {
+		mHealth.downloadRate = (mHealth.downloadRate * 3 + downloadRate) / 4;
+		mHealth.consumeRate = (mHealth.consumeRate * 3 + consumeRate) / 4;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		// A whole interval without underrun: give back some of the extra threshold
+		if (underruns == mWindowUnderruns && mRebufferThreshold > mStreamBuffer->getThreshold()) {
+			mRebufferThreshold = std::max(mRebufferThreshold - mRebufferThreshold / 4, mStreamBuffer->getThreshold());
+		}
+		mHealth.threshold = mRebufferThreshold;
+	}
+
+	mHealth.level = mBufferReader->sizeOfData();
+	mHealth.underruns = underruns;
+	mHealth.reconnects = mReconnects;
+	mHealthReported = false;
+
+	medvdbg("level %u threshold %u download %u/s read %u/s underruns %u reconnects %u\n", mHealth.level, mHealth.threshold,
+			mHealth.downloadRate, mHealth.consumeRate, mHealth.underruns, mHealth.reconnects);
+
+	mWindowStart = now;
+	mWindowOffset = offset;
+	mWindowConsumed = mConsumed;
+	mWindowUnderruns = underruns;
+}
+
+void HttpInputDataSource::stopRebuffering()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mDownloadFinished = true;
+	mRebuffering = false;
+	mCondv.notify_all();
+}
+
 void HttpInputDataSource::onBufferOverrun()
 {
 }
 
 void HttpInputDataSource::onBufferUnderrun()
 {
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (!mRebuffering && mIsDataReceived && !mDownloadFinished) {
+		// Data came later than it was read: keep more of it before reading again
+		mRebuffering = true;
+		mUnderruns++;
+		mRebufferThreshold = std::min(mRebufferThreshold * 2, mStreamBuffer->getBufferSize() * 3 / 4);
+		medwdbg("underrun, rebuffering threshold %u\n", mRebufferThreshold);
+	}
 }
 
 void HttpInputDataSource::onBufferUpdated(ssize_t change, size_t current)
@@ -241,7 +359,17 @@ void HttpInputDataSource::onBufferUpdated(ssize_t change, size_t current)
 			medvdbg("Enough data received!\n");
 			std::lock_guard<std::mutex> lock(mMutex);
 			mIsDataReceived = true;
-			mCondv.notify_one();
+			mCondv.notify_all();
+		}
+	}
+
+	// mMutex is taken only while rebuffering, open() holds it while copying from the buffer
+	if (change > 0 && mRebuffering) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mRebuffering && current >= mRebufferThreshold) {
+			medvdbg("rebuffered %u bytes\n", current);
+			mRebuffering = false;
+			mCondv.notify_all();
 		}
 	}
 }
@@ -257,7 +385,26 @@ size_t HttpInputDataSource::HeaderCallback(char *data, size_t size, size_t nmemb
 	size_t totalsize = size * nmemb;
 	std::string header(data, totalsize);
 	medvdbg("%s\n", header.c_str());
-	auto pos = header.find(TAG_CONTENT_TYPE);
+
+	if (header.compare(0, 5, "HTTP/") == 0) {
+		// Status line of each response, redirections included
+		auto pos = header.find(' ');
+		long status = (pos != std::string::npos) ? strtol(header.c_str() + pos, NULL, 10) : 0;
+		// A server ignoring the range sends the whole resource again
+		source->mSkip = (status == 200) ? source->mResumeOffset : 0;
+		return totalsize;
+	}
+
+	auto pos = header.find(TAG_CONTENT_LENGTH);
+	if (pos != std::string::npos) {
+		// The length of a resumed response is what is left of the resource
+		if (source->mResumeOffset == 0) {
+			source->mContentLength = strtoul(header.c_str() + pos + TAG_CONTENT_LENGTH.length(), NULL, 10);
+		}
+		return totalsize;
+	}
+
+	pos = header.find(TAG_CONTENT_TYPE);
 	if (pos != std::string::npos) {
 		pos = header.find_first_not_of(' ', pos + TAG_CONTENT_TYPE.length());
 		auto end = header.find((char)0x0d, pos); // CR: 0x0d
@@ -265,7 +412,7 @@ size_t HttpInputDataSource::HeaderCallback(char *data, size_t size, size_t nmemb
 		if (!source->mIsHeaderReceived) {
 			std::lock_guard<std::mutex> lock(source->mMutex);
 			source->mIsHeaderReceived = true;
-			source->mCondv.notify_one();
+			source->mCondv.notify_all();
 		}
 	}
 
@@ -276,7 +423,19 @@ size_t HttpInputDataSource::WriteCallback(char *data, size_t size, size_t nmemb,
 {
 	auto source = static_cast<HttpInputDataSource *>(userp);
 	size_t totalsize = size * nmemb;
-	return source->mBufferWriter->write((unsigned char *)data, totalsize);
+
+	// Drop what was received before a reconnection
+	size_t skip = std::min(source->mSkip, totalsize);
+	source->mSkip -= skip;
+	if (skip == totalsize) {
+		return totalsize;
+	}
+
+	size_t len = totalsize - skip;
+	size_t written = source->mBufferWriter->write((unsigned char *)data + skip, len);
+	source->mOffset += written;
+	// Less than len aborts the transfer at end-of-stream
+	return (written == len) ? totalsize : written;
 }
 
 void *HttpInputDataSource::workerMain(void *arg)
@@ -287,12 +446,45 @@ void *HttpInputDataSource::workerMain(void *arg)
 	//mHttpStream->addHeader("Icy-MetaData:1"); // not support now
 	source->mHttpStream->setHeaderCallback(HeaderCallback, arg);
 	source->mHttpStream->setWriteCallback(WriteCallback, arg);
-	if (!source->mHttpStream->download(source->mUrl)) {
-		medwdbg("download failed or terminated!\n");
-		// TODO: send network error code to upper layer later
+
+	int retries = 0;
+	while (true) {
+		size_t offset = source->mOffset;
+		// Streams of unknown length are live, they go on from where the server is
+		source->mResumeOffset = (source->mContentLength > 0) ? offset : 0;
+		source->mSkip = 0;
+		if (source->mHttpStream->download(source->mUrl, source->mResumeOffset)) {
+			if (source->mContentLength == 0 || source->mOffset >= source->mContentLength) {
+				break;
+			}
+			medwdbg("connection closed at %u/%u\n", (size_t)source->mOffset, source->mContentLength);
+		}
+
+		if (source->mBufferReader->isEndOfStream()) {
+			// Closed by the reader
+			break;
+		}
+
+		if (source->mOffset > offset) {
+			retries = 0;
+		}
+
+		if (++retries > CONFIG_HTTPSOURCE_RECONNECT_COUNT) {
+			medwdbg("download failed or terminated!\n");
+			// TODO: send network error code to upper layer later
+			break;
+		}
+
+		for (int delay = 0; delay < CONFIG_HTTPSOURCE_RECONNECT_DELAY * retries && !source->mBufferReader->isEndOfStream(); delay += 100) {
+			usleep(100 * 1000);
+		}
+		source->mReconnects++;
+		medvdbg("reconnect %d at offset %u\n", retries, (size_t)source->mOffset);
 	}
 
 	source->mBufferWriter->setEndOfStream();
+	// Reading goes on with what is left
+	source->stopRebuffering();
 	medvdbg("download thread exit!\n");
 	return NULL;
 }
@@ -16,12 +16,18 @@
  *
  ******************************************************************/
 
+#include <tinyara/config.h>
 #include <curl/curl.h>
 #include <curl/easy.h>
 #include <debug.h>
 #include <memory>
+#include <stdio.h>
 #include "HttpStream.h"
 
+#ifndef CONFIG_HTTPSOURCE_CONNECT_TIMEOUT
+#define CONFIG_HTTPSOURCE_CONNECT_TIMEOUT 10
+#endif
+
 namespace media {
 namespace stream {
 
@@ -151,7 +157,7 @@ bool HttpStream::perform()
 	return true;
 }
 
-bool HttpStream::download(const std::string &url)
+bool HttpStream::download(const std::string &url, size_t offset)
 {
 	SET_OPTION(mCurl, CURLOPT_HTTPGET, 1L);
 
@@ -161,6 +167,22 @@ bool HttpStream::download(const std::string &url)
 
 	SET_OPTION(mCurl, CURLOPT_SSL_VERIFYHOST, 0L);
 
+	SET_OPTION(mCurl, CURLOPT_CONNECTTIMEOUT, (long)CONFIG_HTTPSOURCE_CONNECT_TIMEOUT);
+
+	// Error pages must not be fed to the decoder
+	SET_OPTION(mCurl, CURLOPT_FAILONERROR, 1L);
+
+	/* CURLOPT_RANGE rather than CURLOPT_RESUME_FROM, which fails when the
+	 * server ignores the range: the caller skips the bytes it already has.
+	 */
+	char range[24];
+	if (offset > 0) {
+		snprintf(range, sizeof(range), "%lu-", (unsigned long)offset);
+		SET_OPTION(mCurl, CURLOPT_RANGE, range);
+	} else {
+		SET_OPTION(mCurl, CURLOPT_RANGE, (char *)NULL);
+	}
+
 	if (!perform()) {
 		meddbg("http get failed!\n");
 		return false;
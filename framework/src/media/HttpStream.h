@@ -66,9 +66,9 @@ public:
 	bool setReadCallback(CallbackFunc callback, void *userdata);
 
 	/*
-	 * Sets the callback for uploading local data
+	 * Downloads from url, starting at offset with a Range request when offset is not 0
 	 */
-	bool download(const std::string &url);
+	bool download(const std::string &url, size_t offset = 0);
 
 	/*
 	 * Sets the callback for uploading local data
@@ -35,7 +35,8 @@ InputHandler::InputHandler() :
 	mDecoder(nullptr),
 	mIsLooping(0),
 	mState(BUFFER_STATE_EMPTY),
-	mTotalBytes(0)
+	mTotalBytes(0),
+	mSourceBytes(0)
 {
 	mWorkerStackSize = CONFIG_INPUT_DATASOURCE_STACKSIZE;
 }
@@ -96,12 +97,121 @@ bool InputHandler::open()
 bool InputHandler::close()
 {
 	bool ret = StreamHandler::close();
+	clearQueue();
 	// Terminate buffering
 	std::unique_lock<std::mutex> lock(mMutex);
 	mCondv.notify_one();
 	return ret;
 }
 
+void InputHandler::queueDataSource(std::shared_ptr<InputDataSource> source)
+{
+	std::lock_guard<std::mutex> lock(mQueueMutex);
+	mQueue.push_back(source);
+	medvdbg("queued sources : %u\n", mQueue.size());
+}
+
+void InputHandler::clearQueue()
+{
+	std::lock_guard<std::mutex> lock(mQueueMutex);
+	for (auto &source : mQueue) {
+		if (source->isPrepared()) {
+			source->close();
+		}
+	}
+	mQueue.clear();
+}
+
+/* Called by the player once the stream buffer is read through, for a source
+ * which could not follow the current one in it.
+ */
+bool InputHandler::openNextDataSource()
+{
+	std::shared_ptr<InputDataSource> next;
+
+	while (true) {
+		{
+			std::lock_guard<std::mutex> lock(mQueueMutex);
+			if (mQueue.empty()) {
+				return false;
+			}
+			next = mQueue.front();
+			mQueue.pop_front();
+		}
+
+		StreamHandler::close();
+		mDemuxer = nullptr;
+		mPreloadBuffer = nullptr;
+		setInputDataSource(next);
+		if (open()) {
+			return true;
+		}
+		meddbg("open queued source failed, skip it\n");
+	}
+}
+
+/* Called by the worker at the end of the current source */
+bool InputHandler::switchDataSource()
+{
+	std::shared_ptr<InputDataSource> next;
+	std::shared_ptr<StreamBuffer> preload;
+
+	{
+		std::lock_guard<std::mutex> lock(mQueueMutex);
+		if (mQueue.empty()) {
+			return false;
+		}
+		next = mQueue.front();
+	}
+
+	if (!(next->isPrepared() || next->open()) || !probeSource(next, preload)) {
+		/* Left to openNextDataSource(), which skips it */
+		meddbg("open queued source failed\n");
+		next->close();
+		return false;
+	}
+
+	/* Decoders give at most 2 channels, see registerCodec() */
+	unsigned int channels = next->getChannels() > 2 ? 2 : next->getChannels();
+	if (channels != mInputDataSource->getChannels() || next->getSampleRate() != mInputDataSource->getSampleRate() ||
+		next->getPcmFormat() != mInputDataSource->getPcmFormat()) {
+		/* The audio stream is set up again by the player for this one. It
+		 * is opened again from the start, the probed data is dropped.
+		 */
+		medvdbg("queued source has another format\n");
+		next->close();
+		return false;
+	}
+
+	/* The next source begins on a frame, even if this one was cut in the middle of one */
+	size_t frameBytes = channels * (pcm_format_to_bits((enum pcm_format)next->getPcmFormat()) >> 3);
+	if (frameBytes > 0 && mSourceBytes % frameBytes != 0) {
+		unsigned char pad[8] = {0, };
+		size_t padBytes = frameBytes - mSourceBytes % frameBytes;
+		if (padBytes <= sizeof(pad)) {
+			mBufferWriter->write(pad, padBytes);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mQueueMutex);
+		if (mQueue.empty() || mQueue.front() != next) {
+			return false;
+		}
+		mQueue.pop_front();
+	}
+
+	medvdbg("switch to the queued source, %u bytes played\n", mSourceBytes);
+	unregisterCodec();
+	mDemuxer = nullptr;
+	mInputDataSource->close();
+	setInputDataSource(next);
+	mPreloadBuffer = preload;
+	mSourceBytes = 0;
+
+	return registerCodec(next->getAudioType(), next->getChannels(), next->getSampleRate());
+}
+
 int InputHandler::seekTo(off_t offset)
 {
 	return mInputDataSource->seekTo(offset);
@@ -126,6 +236,7 @@ void InputHandler::resetWorker()
 {
 	mState = BUFFER_STATE_EMPTY;
 	mTotalBytes = 0;
+	mSourceBytes = 0;
 }
 
 bool InputHandler::processWorker()
@@ -142,6 +253,11 @@ bool InputHandler::processWorker()
 		if (readLen <= 0) {
 			// Error occurred, or inputting finished
 			if (!mIsLooping) {
+				// Go on with a queued source in the same stream buffer
+				if (switchDataSource()) {
+					delete[] buf;
+					return true;
+				}
 				mBufferWriter->setEndOfStream();
 				delete[] buf;
 				return false;
@@ -209,6 +325,9 @@ void InputHandler::onBufferOverrun()
 
 void InputHandler::onBufferUnderrun()
 {
+#ifdef CONFIG_MEDIA_PROFILE
+	mProfiler.addBufferXrun();
+#endif
 	auto mp = getPlayer();
 	if (mp) {
 		mp->notifyObserver(PLAYER_OBSERVER_COMMAND_BUFFER_UNDERRUN);
@@ -220,6 +339,9 @@ void InputHandler::onBufferUpdated(ssize_t change, size_t current)
 	if (change < 0) {
 		// Reading wake worker up
 		wakenWorker();
+#ifdef CONFIG_MEDIA_PROFILE
+		mProfiler.updateBufferLevel(current);
+#endif
 	}
 
 	if (current == 0) {
@@ -292,6 +414,7 @@ ssize_t InputHandler::writeToStreamBuffer(unsigned char *buf, size_t size)
 
 			// write PCM data to stream buffer
 			size_t written = mBufferWriter->write(buffPCM, sizePCM);
+			mSourceBytes += written;
 			if (written != sizePCM) {
 				meddbg("End of writting!\n");
 				return EOF;
@@ -391,6 +514,7 @@ size_t InputHandler::getDecodeFrames(unsigned char *buf, size_t *size)
 	unsigned int sampleRate = 0;
 	unsigned short channels = 0;
 
+	MEDIA_PROFILE_SCOPE(mProfiler, STAGE_CODEC, "decode");
 	if (mDecoder->getFrame(buf, size, &sampleRate, &channels)) {
 		medvdbg("size : %u samplerate : %d channels : %d\n", *size, sampleRate, channels);
 		return *size;
@@ -502,16 +626,36 @@ ssize_t InputHandler::readFromSource(unsigned char *buf, size_t size)
 		return (ssize_t)size;
 	}
 	// Read from data source
-	return mInputDataSource->read(buf, size);
+	ssize_t len;
+	{
+		MEDIA_PROFILE_SCOPE(mProfiler, STAGE_SOURCE, "source read");
+		len = mInputDataSource->read(buf, size);
+	}
+
+	// Network sources report the health of their download buffer
+	buffer_health_t health;
+	if (mInputDataSource->getBufferHealth(&health)) {
+		auto mp = getPlayer();
+		if (mp) {
+			mp->notifyObserver(PLAYER_OBSERVER_COMMAND_BUFFER_HEALTH, &health);
+		}
+	}
+
+	return len;
 }
 
 bool InputHandler::probeDataSource()
+{
+	return probeSource(mInputDataSource, mPreloadBuffer);
+}
+
+bool InputHandler::probeSource(std::shared_ptr<InputDataSource> source, std::shared_ptr<StreamBuffer> &preload)
 {
 	// Identify audio type and other informations if unspecified
-	audio_type_t audioType = mInputDataSource->getAudioType();
-	unsigned int channels = mInputDataSource->getChannels();
-	unsigned int sampleRate = mInputDataSource->getSampleRate();
-	audio_format_type_t pcmFormat = mInputDataSource->getPcmFormat();
+	audio_type_t audioType = source->getAudioType();
+	unsigned int channels = source->getChannels();
+	unsigned int sampleRate = source->getSampleRate();
+	audio_format_type_t pcmFormat = source->getPcmFormat();
 	if (audioType == AUDIO_TYPE_UNKNOWN || channels == 0 || sampleRate == 0) {
 		// Preload data from data source
 		ssize_t threshold = CONFIG_DATASOURCE_PREPARSE_BUFFER_SIZE;
@@ -533,7 +677,7 @@ bool InputHandler::probeDataSource()
 			if (stepBytes > threshold - totalBytes) {
 				stepBytes = threshold - totalBytes;
 			}
-			ssize_t readBytes = mInputDataSource->read(bufptr + totalBytes, stepBytes);
+			ssize_t readBytes = source->read(bufptr + totalBytes, stepBytes);
 			if (readBytes <= 0) {
 				meddbg("Read data source failed, readBytes : %d totalBytes : %d threshold : %d\n", readBytes, totalBytes, threshold);
 				delete[] bufptr;
@@ -559,27 +703,27 @@ bool InputHandler::probeDataSource()
 		// Header parsing succeed, or pre-loading data reach threshold
 		if (bSuccess) {
 			// Update data source attributes
-			mInputDataSource->setAudioType(audioType);
-			mInputDataSource->setChannels(channels);
-			mInputDataSource->setSampleRate(sampleRate);
-			mInputDataSource->setPcmFormat(pcmFormat);
+			source->setAudioType(audioType);
+			source->setChannels(channels);
+			source->setSampleRate(sampleRate);
+			source->setPcmFormat(pcmFormat);
 			medvdbg("channels %u sampleRate %u pcmFormat %d\n", channels, sampleRate, pcmFormat);
 		} else {
 			// Regard as PCM data
-			mInputDataSource->setAudioType(AUDIO_TYPE_PCM);
+			source->setAudioType(AUDIO_TYPE_PCM);
 			medvdbg("Pre-loaded data reached the threshold, maybe it is PCM data!\n");
 		}
 		// Write data to preload-buffer for later use
-		mPreloadBuffer = StreamBuffer::Builder()
+		preload = StreamBuffer::Builder()
 						.setBufferSize(totalBytes)
 						.setThreshold(totalBytes)
 						.build();
-		if (!mPreloadBuffer) {
+		if (!preload) {
 			meddbg("Out of memory\n");
 			delete[] bufptr;
 			return false;
 		}
-		mPreloadBuffer->write(bufptr, totalBytes);
+		preload->write(bufptr, totalBytes);
 		delete[] bufptr;
 		return true;
 	}
@@ -19,6 +19,7 @@
 #define __MEDIA_INPUTHANDLER_H
 
 #include <memory>
+#include <list>
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
@@ -64,6 +65,13 @@ public:
 	size_t getAvailSpace();
 	ssize_t writeToStreamBuffer(unsigned char *buf, size_t size);
 
+	/* Sources played after the current one. A source with the format of
+	 * the current one is opened by the worker at the end of the current
+	 * one and decoded into the same stream buffer, without a gap.
+	 */
+	void queueDataSource(std::shared_ptr<InputDataSource> source);
+	bool openNextDataSource();
+
 private:
 	bool probeDataSource() override;
 	bool registerCodec(audio_type_t audioType, unsigned int channels, unsigned int sampleRate) override;
@@ -78,6 +86,9 @@ private:
 	ssize_t getPCM(unsigned char *buf, size_t size, size_t *used, unsigned char **out, size_t *expect);
 	size_t fetchData(unsigned char *buf, size_t size, size_t *used, unsigned char **out, size_t *expect);
 	ssize_t readFromSource(unsigned char *buf, size_t size);
+	bool probeSource(std::shared_ptr<InputDataSource> source, std::shared_ptr<StreamBuffer> &preload);
+	bool switchDataSource();
+	void clearQueue();
 
 	std::mutex mMutex;
 	std::condition_variable mCondv;
@@ -89,6 +100,9 @@ private:
 	std::atomic<bool> mIsLooping;
 	buffer_state_t mState;
 	size_t mTotalBytes;
+	size_t mSourceBytes;
+	std::mutex mQueueMutex;
+	std::list<std::shared_ptr<InputDataSource>> mQueue;
 };
 } // namespace stream
 } // namespace media
@@ -92,6 +92,11 @@ player_result_t MediaPlayer::setDataSource(std::unique_ptr<stream::InputDataSour
 	return mPMpImpl->setDataSource(std::move(source));
 }
 
+player_result_t MediaPlayer::queueDataSource(std::unique_ptr<stream::InputDataSource> source)
+{
+	return mPMpImpl->queueDataSource(std::move(source));
+}
+
 player_result_t MediaPlayer::setObserver(std::shared_ptr<MediaPlayerObserverInterface> observer)
 {
 	return mPMpImpl->setObserver(observer);
@@ -117,6 +122,21 @@ player_result_t MediaPlayer::setLooping(bool loop)
 	return mPMpImpl->setLooping(loop);
 }
 
+player_result_t MediaPlayer::setLowLatency(bool enable)
+{
+	return mPMpImpl->setLowLatency(enable);
+}
+
+player_result_t MediaPlayer::getStartLatency(unsigned int *usec)
+{
+	return mPMpImpl->getStartLatency(usec);
+}
+
+player_result_t MediaPlayer::getProfile(media_profile_t *profile)
+{
+	return mPMpImpl->getProfile(profile);
+}
+
 MediaPlayer::~MediaPlayer()
 {
 }
@@ -16,6 +16,7 @@
  *
  ******************************************************************/
 
+#include <tinyara/config.h>
 #include <media/MediaPlayer.h>
 #include <media/FocusManager.h>
 #include "PlayerWorker.h"
@@ -24,6 +25,7 @@
 #include <debug.h>
 #include <errno.h>
 #include <stdarg.h>
+#include <string.h>
 #include "audio/audio_manager.h"
 
 namespace media {
@@ -31,12 +33,23 @@ namespace media {
 #define LOG_STATE_INFO(state) medvdbg("state at %s[line : %d] : %s\n", __func__, __LINE__, player_state_names[(state)])
 #define LOG_STATE_DEBUG(state) meddbg("state at %s[line : %d] : %s\n", __func__, __LINE__, player_state_names[(state)])
 
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define PLAYER_LATENCY_CLOCK CLOCK_MONOTONIC
+#else
+#define PLAYER_LATENCY_CLOCK CLOCK_REALTIME
+#endif
+
 MediaPlayerImpl::MediaPlayerImpl(MediaPlayer &player) : mPlayer(player)
 {
 	mPlayerObserver = nullptr;
 	mCurState = PLAYER_STATE_NONE;
 	mBuffer = nullptr;
 	mBufSize = 0;
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	mLowLatency = false;
+#endif
+	mStartTime = {0, 0};
+	mStartLatency = 0;
 	stream_info_t *info;
 	int ret = stream_info_create(STREAM_TYPE_MEDIA, &info);
 	if (ret != OK) {
@@ -168,6 +181,9 @@ void MediaPlayerImpl::preparePlayer(player_result_t &ret)
 		return notifySync();
 	}
 
+#ifdef CONFIG_MEDIA_PROFILE
+	mInputHandler.getProfiler().reset();
+#endif
 	if (!mInputHandler.open()) {
 		meddbg("MediaPlayer prepare fail : open fail\n");
 		ret = PLAYER_ERROR_FILE_OPEN_FAILED;
@@ -182,15 +198,35 @@ void MediaPlayerImpl::preparePlayer(player_result_t &ret)
 	}
 
 	auto source = mInputHandler.getDataSource();
+#ifdef CONFIG_AUDIO_MIXER
+	if (set_mixer_stream_out(source->getChannels(), source->getSampleRate(),
+							 source->getPcmFormat(), mStreamInfo->id, mStreamInfo->policy) != AUDIO_MANAGER_SUCCESS) {
+		meddbg("MediaPlayer prepare fail : set_mixer_stream_out fail\n");
+		ret = PLAYER_ERROR_INTERNAL_OPERATION_FAILED;
+		return notifySync();
+	}
+
+	mBufSize = get_mixer_stream_out_buffer_size(mStreamInfo->id);
+	if (mBufSize <= 0) {
+#else
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	set_audio_stream_out_low_latency(mLowLatency);
+#endif
 	if (set_audio_stream_out(source->getChannels(), source->getSampleRate(),
 							 source->getPcmFormat(), mStreamInfo->id) != AUDIO_MANAGER_SUCCESS) {
 		meddbg("MediaPlayer prepare fail : set_audio_stream_out fail\n");
 		ret = PLAYER_ERROR_INTERNAL_OPERATION_FAILED;
 		return notifySync();
 	}
+#ifdef CONFIG_MEDIA_PROFILE
+	if (get_audio_stream_out_profile(&mCardProfile) != AUDIO_MANAGER_SUCCESS) {
+		memset(&mCardProfile, 0, sizeof(mCardProfile));
+	}
+#endif
 
 	mBufSize = get_output_card_buffer_size();
 	if (mBufSize < 0) {
+#endif
 		meddbg("MediaPlayer prepare fail : get_output_frames_byte_size fail\n");
 		ret = PLAYER_ERROR_INTERNAL_OPERATION_FAILED;
 		return notifySync();
@@ -301,7 +337,11 @@ player_result_t MediaPlayerImpl::unpreparePlayback(void)
 		return PLAYER_ERROR_INVALID_STATE;
 	}
 
+#ifdef CONFIG_AUDIO_MIXER
+	if (reset_mixer_stream_out(mStreamInfo->id) != AUDIO_MANAGER_SUCCESS) {
+#else
 	if (reset_audio_stream_out(mStreamInfo->id) != AUDIO_MANAGER_SUCCESS) {
+#endif
 		meddbg("MediaPlayer unprepare fail : reset_audio_stream_out fail\n");
 		return PLAYER_ERROR_INTERNAL_OPERATION_FAILED;
 	}
@@ -324,7 +364,11 @@ player_result_t MediaPlayerImpl::reset()
 
 	if (mCurState == PLAYER_STATE_READY || mCurState == PLAYER_STATE_PLAYING || mCurState == PLAYER_STATE_PAUSED) {
 		mInputHandler.close();
+#ifdef CONFIG_AUDIO_MIXER
+		if (reset_mixer_stream_out(mStreamInfo->id) != AUDIO_MANAGER_SUCCESS) {
+#else
 		if (reset_audio_stream_out(mStreamInfo->id) != AUDIO_MANAGER_SUCCESS) {
+#endif
 			meddbg("MediaPlayer reset fail : reset_audio_stream_out fail\n");
 		}
 		
@@ -361,6 +405,8 @@ player_result_t MediaPlayerImpl::start()
 		return PLAYER_ERROR_NOT_ALIVE;
 	}
 
+	clock_gettime(PLAYER_LATENCY_CLOCK, &mStartTime);
+	mStartLatency = 0;
 	mpw.enQueue(&MediaPlayerImpl::startPlayer, shared_from_this(), std::ref(ret));
 	mSyncCv.wait(lock);
 	meddbg("%s returned. player: %x\n", __func__, &mPlayer);
@@ -391,8 +437,15 @@ void MediaPlayerImpl::startPlayer(player_result_t &ret)
 		mInputHandler.start();
 	}
 
+	/* The card may have been set up by another player while this one was
+	 * paused. A stream keeps its place in the mixer instead.
+	 */
+#ifndef CONFIG_AUDIO_MIXER
 	if (mCurState == PLAYER_STATE_PAUSED) {
 		auto source = mInputHandler.getDataSource();
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+		set_audio_stream_out_low_latency(mLowLatency);
+#endif
 		if (set_audio_stream_out(source->getChannels(), source->getSampleRate(),
 								 source->getPcmFormat(), mStreamInfo->id) != AUDIO_MANAGER_SUCCESS) {
 			meddbg("MediaPlayer startPlayer fail : set_audio_stream_out fail\n");
@@ -400,6 +453,7 @@ void MediaPlayerImpl::startPlayer(player_result_t &ret)
 			return notifySync();
 		}
 	}
+#endif
 
 	audio_manager_result_t res;
 
@@ -417,7 +471,11 @@ void MediaPlayerImpl::startPlayer(player_result_t &ret)
 		return notifySync();
 	}
 
+#ifdef CONFIG_AUDIO_MIXER
+	mpw.addPlayer(shared_from_this());
+#else
 	mpw.setPlayer(shared_from_this());
+#endif
 	mCurState = PLAYER_STATE_PLAYING;
 	return notifySync();
 }
@@ -476,14 +534,22 @@ player_result_t MediaPlayerImpl::stopPlayback(bool drain)
 		return PLAYER_OK;
 	}
 
+#ifdef CONFIG_AUDIO_MIXER
+	audio_manager_result_t result = stop_mixer_stream_out(mStreamInfo->id, drain);
+#else
 	audio_manager_result_t result = stop_audio_stream_out(drain);
+#endif
 	if (result != AUDIO_MANAGER_SUCCESS) {
 		meddbg("stop_audio_stream_out failed ret : %d\n", result);
 		return PLAYER_ERROR_INTERNAL_OPERATION_FAILED;
 	}
 
 	mCurState = PLAYER_STATE_READY;
+#ifdef CONFIG_AUDIO_MIXER
+	mpw.removePlayer(shared_from_this());
+#else
 	mpw.setPlayer(nullptr);
+#endif
 
 	return PLAYER_OK;
 }
@@ -497,9 +563,15 @@ void MediaPlayerImpl::stopPlaybackInternal(bool drain)
 	mCurState = PLAYER_STATE_READY;
 
 	PlayerWorker &mpw = PlayerWorker::getWorker();
+#ifdef CONFIG_AUDIO_MIXER
+	mpw.removePlayer(shared_from_this());
+
+	audio_manager_result_t result = stop_mixer_stream_out(mStreamInfo->id, drain);
+#else
 	mpw.setPlayer(nullptr);
 
 	audio_manager_result_t result = stop_audio_stream_out(drain);
+#endif
 	if (result != AUDIO_MANAGER_SUCCESS) {
 		meddbg("stop_audio_stream_out failed ret : %d\n", result);
 	}
@@ -538,7 +610,11 @@ void MediaPlayerImpl::pausePlayer(player_result_t &ret)
 
 	PlayerWorker &mpw = PlayerWorker::getWorker();
 	if (mCurState == PLAYER_STATE_PLAYING) {
+#ifdef CONFIG_AUDIO_MIXER
+		audio_manager_result_t result = pause_mixer_stream_out(mStreamInfo->id);
+#else
 		audio_manager_result_t result = pause_audio_stream_out();
+#endif
 		if (result != AUDIO_MANAGER_SUCCESS) {
 			meddbg("pause_audio_stream_in failed ret : %d\n", result);
 			ret = PLAYER_ERROR_INTERNAL_OPERATION_FAILED;
@@ -715,6 +791,48 @@ player_result_t MediaPlayerImpl::setDataSource(std::unique_ptr<stream::InputData
 	return ret;
 }
 
+player_result_t MediaPlayerImpl::queueDataSource(std::unique_ptr<stream::InputDataSource> source)
+{
+	meddbg("%s player: %x\n", __func__, &mPlayer);
+	player_result_t ret = PLAYER_OK;
+
+	std::unique_lock<std::mutex> lock(mCmdMtx);
+
+	PlayerWorker &mpw = PlayerWorker::getWorker();
+	if (!mpw.isAlive()) {
+		meddbg("PlayerWorker is not alive\n");
+		return PLAYER_ERROR_NOT_ALIVE;
+	}
+
+	std::shared_ptr<stream::InputDataSource> sharedDataSource = std::move(source);
+	mpw.enQueue(&MediaPlayerImpl::queuePlayerDataSource, shared_from_this(), sharedDataSource, std::ref(ret));
+	meddbg("queuePlayerDataSource enqueued. player: %x\n", &mPlayer);
+	mSyncCv.wait(lock);
+
+	meddbg("%s returned. player: %x\n", __func__, &mPlayer);
+	return ret;
+}
+
+void MediaPlayerImpl::queuePlayerDataSource(std::shared_ptr<stream::InputDataSource> source, player_result_t &ret)
+{
+	if (mCurState != PLAYER_STATE_CONFIGURED && mCurState != PLAYER_STATE_READY &&
+		mCurState != PLAYER_STATE_PLAYING && mCurState != PLAYER_STATE_PAUSED) {
+		meddbg("%s Fail : invalid state mPlayer : %x\n", __func__, &mPlayer);
+		LOG_STATE_DEBUG(mCurState);
+		ret = PLAYER_ERROR_INVALID_STATE;
+		return notifySync();
+	}
+
+	if (!source) {
+		meddbg("MediaPlayer queueDataSource fail : invalid argument. DataSource should not be nullptr\n");
+		ret = PLAYER_ERROR_INVALID_PARAMETER;
+		return notifySync();
+	}
+
+	mInputHandler.queueDataSource(source);
+	return notifySync();
+}
+
 void MediaPlayerImpl::setPlayerDataSource(std::shared_ptr<stream::InputDataSource> source, player_result_t &ret)
 {
 	if (mCurState != PLAYER_STATE_IDLE && mCurState != PLAYER_STATE_CONFIGURED &&
@@ -874,6 +992,116 @@ player_result_t MediaPlayerImpl::setLooping(bool loop)
 	return ret;
 }
 
+player_result_t MediaPlayerImpl::setLowLatency(bool enable)
+{
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	meddbg("%s enable: %d player: %x\n", __func__, enable, &mPlayer);
+	player_result_t ret = PLAYER_OK;
+
+	std::unique_lock<std::mutex> lock(mCmdMtx);
+
+	PlayerWorker &mpw = PlayerWorker::getWorker();
+
+	if (!mpw.isAlive()) {
+		meddbg("PlayerWorker is not alive\n");
+		return PLAYER_ERROR_NOT_ALIVE;
+	}
+
+	mpw.enQueue(&MediaPlayerImpl::setPlayerLowLatency, shared_from_this(), enable, std::ref(ret));
+	mSyncCv.wait(lock);
+
+	meddbg("%s returned. player: %x\n", __func__, &mPlayer);
+	return ret;
+#else
+	return PLAYER_ERROR_DEVICE_NOT_SUPPORTED;
+#endif
+}
+
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+void MediaPlayerImpl::setPlayerLowLatency(bool enable, player_result_t &ret)
+{
+	medvdbg("setPlayerLowLatency\n");
+	/* The periods of the card are chosen at prepare */
+	if (mCurState != PLAYER_STATE_IDLE && mCurState != PLAYER_STATE_CONFIGURED) {
+		meddbg("setLowLatency failed, Player is already prepared!\n");
+		LOG_STATE_DEBUG(mCurState);
+		ret = PLAYER_ERROR_INVALID_STATE;
+		return notifySync();
+	}
+	mLowLatency = enable;
+	notifySync();
+}
+#endif
+
+player_result_t MediaPlayerImpl::getStartLatency(unsigned int *usec)
+{
+	if (usec == nullptr) {
+		return PLAYER_ERROR_INVALID_PARAMETER;
+	}
+
+	unsigned int latency = mStartLatency;
+	if (latency == 0) {
+		return PLAYER_ERROR_INVALID_STATE;
+	}
+
+	*usec = latency;
+	return PLAYER_OK;
+}
+
+player_result_t MediaPlayerImpl::getProfile(media_profile_t *profile)
+{
+#ifdef CONFIG_MEDIA_PROFILE
+	meddbg("%s player: %x\n", __func__, &mPlayer);
+	player_result_t ret = PLAYER_OK;
+
+	std::unique_lock<std::mutex> lock(mCmdMtx);
+
+	if (profile == nullptr) {
+		meddbg("The given argument is invalid.\n");
+		return PLAYER_ERROR_INVALID_PARAMETER;
+	}
+
+	PlayerWorker &mpw = PlayerWorker::getWorker();
+
+	if (!mpw.isAlive()) {
+		meddbg("PlayerWorker is not alive\n");
+		return PLAYER_ERROR_NOT_ALIVE;
+	}
+
+	mpw.enQueue(&MediaPlayerImpl::getPlayerProfile, shared_from_this(), profile, std::ref(ret));
+	mSyncCv.wait(lock);
+
+	meddbg("%s returned. player: %x\n", __func__, &mPlayer);
+	return ret;
+#else
+	return PLAYER_ERROR_DEVICE_NOT_SUPPORTED;
+#endif
+}
+
+#ifdef CONFIG_MEDIA_PROFILE
+void MediaPlayerImpl::getPlayerProfile(media_profile_t *profile, player_result_t &ret)
+{
+	medvdbg("getPlayerProfile\n");
+	if (mCurState == PLAYER_STATE_NONE || mCurState == PLAYER_STATE_IDLE || mCurState == PLAYER_STATE_CONFIGURED) {
+		meddbg("getProfile failed, Player is not prepared!\n");
+		LOG_STATE_DEBUG(mCurState);
+		ret = PLAYER_ERROR_INVALID_STATE;
+		return notifySync();
+	}
+
+	mInputHandler.getProfiler().get(profile);
+#ifndef CONFIG_AUDIO_MIXER
+	/* The card is used by this player alone from prepare to unprepare */
+	audio_stream_profile_t card;
+	if (get_audio_stream_out_profile(&card) == AUDIO_MANAGER_SUCCESS) {
+		profile->resampleTime = card.resample_usec - mCardProfile.resample_usec;
+		profile->deviceXruns = card.xruns - mCardProfile.xruns;
+	}
+#endif
+	notifySync();
+}
+#endif
+
 void MediaPlayerImpl::setPlayerLooping(bool loop, player_result_t &ret)
 {
 	medvdbg("setPlayerLooping\n");
@@ -924,6 +1152,10 @@ void MediaPlayerImpl::notifyObserver(player_observer_command_t cmd, ...)
 		case PLAYER_OBSERVER_COMMAND_BUFFER_STATECHANGED:
 			pow.enQueue(&MediaPlayerObserverInterface::onPlaybackBufferStateChanged, mPlayerObserver, mPlayer, (buffer_state_t)va_arg(ap, int));
 			break;
+		case PLAYER_OBSERVER_COMMAND_BUFFER_HEALTH:
+			// The report is copied into the queued call
+			pow.enQueue(&MediaPlayerObserverInterface::onPlaybackBufferHealth, mPlayerObserver, mPlayer, *va_arg(ap, buffer_health_t *));
+			break;
 		case PLAYER_OBSERVER_COMMAND_BUFFER_DATAREACHED: {
 			medvdbg("OBSERVER_COMMAND_BUFFER_DATAREACHED\n");
 			unsigned char *data = va_arg(ap, unsigned char *);
@@ -960,6 +1192,19 @@ void MediaPlayerImpl::notifyAsync(player_event_t event)
 		// Input handler has been opened successfully by InputHandler::doStandBy().
 		// Now setup audio manager and notify player observer the result.
 		auto source = mInputHandler.getDataSource();
+#ifdef CONFIG_AUDIO_MIXER
+		if (set_mixer_stream_out(source->getChannels(), source->getSampleRate(),
+								 source->getPcmFormat(), mStreamInfo->id, mStreamInfo->policy) != AUDIO_MANAGER_SUCCESS) {
+			meddbg("MediaPlayer prepare fail : set_mixer_stream_out fail\n");
+			return notifyObserver(PLAYER_OBSERVER_COMMAND_ASYNC_PREPARED, PLAYER_ERROR_INTERNAL_OPERATION_FAILED);
+		}
+
+		mBufSize = get_mixer_stream_out_buffer_size(mStreamInfo->id);
+		if (mBufSize <= 0) {
+#else
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+		set_audio_stream_out_low_latency(mLowLatency);
+#endif
 		if (set_audio_stream_out(source->getChannels(), source->getSampleRate(),
 								 source->getPcmFormat(), mStreamInfo->id) != AUDIO_MANAGER_SUCCESS) {
 			meddbg("MediaPlayer prepare fail : set_audio_stream_out fail\n");
@@ -968,6 +1213,7 @@ void MediaPlayerImpl::notifyAsync(player_event_t event)
 
 		mBufSize = get_user_output_frames_to_byte(get_output_frame_count());
 		if (mBufSize < 0) {
+#endif
 			meddbg("MediaPlayer prepare fail : get_user_output_frames_to_byte fail\n");
 			return notifyObserver(PLAYER_OBSERVER_COMMAND_ASYNC_PREPARED, PLAYER_ERROR_INTERNAL_OPERATION_FAILED);
 		}
@@ -992,17 +1238,56 @@ void MediaPlayerImpl::notifyAsync(player_event_t event)
 	}
 }
 
+#ifdef CONFIG_AUDIO_MIXER
+bool MediaPlayerImpl::canPlayback()
+{
+	return get_mixer_stream_out_space(mStreamInfo->id) >= (unsigned int)mBufSize;
+}
+#endif
+
 void MediaPlayerImpl::playback()
 {
+#ifdef CONFIG_AUDIO_MIXER
+	/* The mixer converts the stream, a buffer holds one period of it */
+	ssize_t num_read = mInputHandler.read(mBuffer, mBufSize);
+	medvdbg("num_read : %d player : %x\n", num_read, &mPlayer);
+	if (num_read > 0) {
+		auto source = mInputHandler.getDataSource();
+		MEDIA_PROFILE_SCOPE(mInputHandler.getProfiler(), STAGE_DEVICE, "mixer write");
+		int ret = start_mixer_stream_out(mStreamInfo->id, mBuffer, num_read / (source->getChannels() * sizeof(int16_t)));
+#else
 	float outputSampleRateRatio = get_output_sample_rate_ratio();
 	outputSampleRateRatio = (outputSampleRateRatio >= 1.0f ? outputSampleRateRatio : 1);
 	unsigned int framesToRead = get_card_output_bytes_to_frame(mBufSize) / outputSampleRateRatio;
 	unsigned int bufferSize = get_user_output_frames_to_byte(framesToRead);
+	unsigned char *buffer = mBuffer;
 
-	ssize_t num_read = mInputHandler.read(mBuffer, (int)bufferSize);
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+	/* Decode straight into the buffers of the card, unless the stream is resampled */
+	void *area;
+	unsigned int areaFrames = framesToRead;
+	bool inPlace;
+	{
+		MEDIA_PROFILE_SCOPE(mInputHandler.getProfiler(), STAGE_DEVICE, "device buffer");
+		inPlace = get_audio_stream_out_buffer(&area, &areaFrames) == AUDIO_MANAGER_SUCCESS;
+	}
+	if (inPlace) {
+		buffer = (unsigned char *)area;
+		bufferSize = get_user_output_frames_to_byte(areaFrames);
+	}
+#endif
+
+	ssize_t num_read = mInputHandler.read(buffer, (int)bufferSize);
 	medvdbg("num_read : %d player : %x\n", num_read, &mPlayer);
 	if (num_read > 0) {
+		MEDIA_PROFILE_SCOPE(mInputHandler.getProfiler(), STAGE_DEVICE, "device write");
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+		int ret = inPlace ? commit_audio_stream_out_buffer(get_user_output_bytes_to_frame((unsigned int)num_read)) :
+				  start_audio_stream_out(mBuffer, get_user_output_bytes_to_frame((unsigned int)bufferSize));
+#else
 		int ret = start_audio_stream_out(mBuffer, get_user_output_bytes_to_frame((unsigned int)bufferSize));
+#endif
+#endif
 		if (ret < 0) {
 			PlayerWorker &mpw = PlayerWorker::getWorker();
 			switch (ret) {
@@ -1015,9 +1300,17 @@ void MediaPlayerImpl::playback()
 				mpw.enQueue(&MediaPlayerImpl::stopPlaybackInternal, shared_from_this(), false);
 				break;
 			}
+		} else if (mStartLatency == 0) {
+			struct timespec now;
+			clock_gettime(PLAYER_LATENCY_CLOCK, &now);
+			long usec = (now.tv_sec - mStartTime.tv_sec) * 1000000L + (now.tv_nsec - mStartTime.tv_nsec) / 1000;
+			mStartLatency = usec > 0 ? (unsigned int)usec : 1;
+			medvdbg("start latency : %u us player : %x\n", (unsigned int)mStartLatency, &mPlayer);
 		}
 	} else if (num_read == 0) {
-		playbackFinished();
+		if (!playNextSource()) {
+			playbackFinished();
+		}
 	} else {
 		/*@ToDo: It is not possible for num_read to be negative according to code in InputHandler read() API.*/
 		meddbg("InputDatasource read error\n");
@@ -1026,10 +1319,74 @@ void MediaPlayerImpl::playback()
 	}
 }
 
+/* Plays a queued source which could not follow the last one in the stream
+ * buffer: it has another format, or it was queued after the last one was
+ * read through. Returns false if there is none.
+ */
+bool MediaPlayerImpl::playNextSource(void)
+{
+	auto last = mInputHandler.getDataSource();
+	unsigned int channels = last->getChannels();
+	unsigned int sampleRate = last->getSampleRate();
+	audio_format_type_t pcmFormat = last->getPcmFormat();
+
+	if (!mInputHandler.openNextDataSource()) {
+		return false;
+	}
+
+	auto source = mInputHandler.getDataSource();
+	if (source->getChannels() == channels && source->getSampleRate() == sampleRate && source->getPcmFormat() == pcmFormat) {
+		return true;
+	}
+
+	medvdbg("set up the audio stream again for the next source\n");
+	PlayerWorker &mpw = PlayerWorker::getWorker();
+#ifdef CONFIG_AUDIO_MIXER
+	/* The last frames in the mixer are played out before the stream is set again */
+	stop_mixer_stream_out(mStreamInfo->id, true);
+	if (set_mixer_stream_out(source->getChannels(), source->getSampleRate(),
+							 source->getPcmFormat(), mStreamInfo->id, mStreamInfo->policy) != AUDIO_MANAGER_SUCCESS) {
+		meddbg("set_mixer_stream_out fail\n");
+		mpw.enQueue(&MediaPlayerImpl::stopPlaybackInternal, shared_from_this(), false);
+		return true;
+	}
+
+	int bufSize = get_mixer_stream_out_buffer_size(mStreamInfo->id);
+	if (bufSize > mBufSize) {
+		delete[] mBuffer;
+		mBuffer = new unsigned char[bufSize];
+		if (!mBuffer) {
+			meddbg("mBuffer allocation fail\n");
+			mBufSize = 0;
+			mpw.enQueue(&MediaPlayerImpl::stopPlaybackInternal, shared_from_this(), false);
+			return true;
+		}
+	}
+	if (bufSize > 0) {
+		mBufSize = bufSize;
+	}
+#else
+	stop_audio_stream_out(true);
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	set_audio_stream_out_low_latency(mLowLatency);
+#endif
+	if (set_audio_stream_out(source->getChannels(), source->getSampleRate(),
+							 source->getPcmFormat(), mStreamInfo->id) != AUDIO_MANAGER_SUCCESS) {
+		meddbg("set_audio_stream_out fail\n");
+		mpw.enQueue(&MediaPlayerImpl::stopPlaybackInternal, shared_from_this(), false);
+	}
+#endif
+	return true;
+}
+
 player_result_t MediaPlayerImpl::playbackFinished()
 {
 	mCurState = PLAYER_STATE_COMPLETED;
+#ifdef CONFIG_AUDIO_MIXER
+	audio_manager_result_t result = stop_mixer_stream_out(mStreamInfo->id, true);
+#else
 	audio_manager_result_t result = stop_audio_stream_out(true);
+#endif
 	if (result != AUDIO_MANAGER_SUCCESS) {
 		meddbg("stop_audio_stream_out failed ret : %d\n", result);
 		return PLAYER_ERROR_INTERNAL_OPERATION_FAILED;
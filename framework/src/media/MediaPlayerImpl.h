@@ -19,6 +19,8 @@
 #ifndef __MEDIA_MEDIAPLAYERIMPL_H
 #define __MEDIA_MEDIAPLAYERIMPL_H
 
+#include <tinyara/config.h>
+#include <time.h>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -29,6 +31,7 @@
 
 #include "PlayerObserverWorker.h"
 #include "InputHandler.h"
+#include "audio/audio_manager.h"
 
 namespace media {
 /**
@@ -81,6 +84,7 @@ typedef enum player_observer_command_e {
 	PLAYER_OBSERVER_COMMAND_BUFFER_UPDATED,
 	PLAYER_OBSERVER_COMMAND_BUFFER_STATECHANGED,
 	PLAYER_OBSERVER_COMMAND_BUFFER_DATAREACHED,
+	PLAYER_OBSERVER_COMMAND_BUFFER_HEALTH,
 } player_observer_command_t;
 
 typedef enum player_event_e {
@@ -109,6 +113,7 @@ public:
 	player_result_t setVolume(uint8_t vol);
 
 	player_result_t setDataSource(std::unique_ptr<stream::InputDataSource>);
+	player_result_t queueDataSource(std::unique_ptr<stream::InputDataSource>);
 	player_result_t setObserver(std::shared_ptr<MediaPlayerObserverInterface>);
 	player_result_t setStreamInfo(std::shared_ptr<stream_info_t> stream_info);
 
@@ -119,7 +124,13 @@ public:
 	void notifyObserver(player_observer_command_t cmd, ...);
 	void notifyAsync(player_event_t event);
 	void playback();
+#ifdef CONFIG_AUDIO_MIXER
+	bool canPlayback();
+#endif
 	player_result_t setLooping(bool loop);
+	player_result_t setLowLatency(bool enable);
+	player_result_t getStartLatency(unsigned int *usec);
+	player_result_t getProfile(media_profile_t *profile);
 
 private:
 	void createPlayer(player_result_t &ret);
@@ -138,9 +149,17 @@ private:
 	void setPlayerVolume(uint8_t vol, player_result_t &ret);
 	void setPlayerObserver(std::shared_ptr<MediaPlayerObserverInterface> observer);
 	void setPlayerDataSource(std::shared_ptr<stream::InputDataSource> dataSource, player_result_t &ret);
+	void queuePlayerDataSource(std::shared_ptr<stream::InputDataSource> dataSource, player_result_t &ret);
+	bool playNextSource(void);
 	void setPlayerStreamInfo(std::shared_ptr<stream_info_t> stream_info, player_result_t &ret);
 	stream_focus_state_t getStreamFocusState(void);
 	void setPlayerLooping(bool loop, player_result_t &ret);
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	void setPlayerLowLatency(bool enable, player_result_t &ret);
+#endif
+#ifdef CONFIG_MEDIA_PROFILE
+	void getPlayerProfile(media_profile_t *profile, player_result_t &ret);
+#endif
 	player_result_t playbackFinished(void);
 
 private:
@@ -153,6 +172,14 @@ private:
 	std::shared_ptr<stream_info_t> mStreamInfo;
 	std::shared_ptr<MediaPlayerObserverInterface> mPlayerObserver;
 	stream::InputHandler mInputHandler;
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	bool mLowLatency;
+#endif
+	struct timespec mStartTime;
+	std::atomic<unsigned int> mStartLatency;	// 0 until the first frames are played
+#if defined(CONFIG_MEDIA_PROFILE) && !defined(CONFIG_AUDIO_MIXER)
+	audio_stream_profile_t mCardProfile;		// counters of the card at prepare
+#endif
 };
 } // namespace media
 #endif
@@ -0,0 +1,139 @@
+/* ****************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ******************************************************************/
+
+#include <string.h>
+#include <time.h>
+#include "MediaProfiler.h"
+
+namespace media {
+
+ProfileScope::ProfileScope(const char *name, uint64_t *total, uint32_t *longest) :
+	mTotal(total),
+	mLongest(longest),
+	mBegin(now())
+{
+	trace_begin(TTRACE_TAG_MEDIA, const_cast<char *>(name));
+}
+
+ProfileScope::~ProfileScope()
+{
+	uint64_t elapsed = now() - mBegin;
+
+	trace_end(TTRACE_TAG_MEDIA);
+	if (mTotal) {
+		*mTotal += elapsed;
+	}
+	if (mLongest && elapsed > *mLongest) {
+		*mLongest = (uint32_t)elapsed;
+	}
+}
+
+uint64_t ProfileScope::now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+MediaProfiler::Scope::Scope(MediaProfiler &profiler, Stage stage, const char *name) :
+	mProfiler(profiler),
+	mStage(stage),
+	mBegin(ProfileScope::now())
+{
+	trace_begin(TTRACE_TAG_MEDIA, const_cast<char *>(name));
+}
+
+MediaProfiler::Scope::~Scope()
+{
+	trace_end(TTRACE_TAG_MEDIA);
+	mProfiler.add(mStage, ProfileScope::now() - mBegin);
+}
+
+MediaProfiler::MediaProfiler()
+{
+	reset();
+}
+
+void MediaProfiler::reset(void)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	memset(&mProfile, 0, sizeof(mProfile));
+	mProfile.bufferMinLevel = UINT32_MAX;
+}
+
+void MediaProfiler::add(Stage stage, uint64_t usec)
+{
+	uint64_t *total;
+	uint32_t *longest;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	switch (stage) {
+	case STAGE_CODEC:
+		mProfile.codecCalls++;
+		total = &mProfile.codecTime;
+		longest = &mProfile.codecMaxTime;
+		break;
+	case STAGE_DEVICE:
+		total = &mProfile.deviceTime;
+		longest = &mProfile.deviceMaxTime;
+		break;
+	default:
+		total = &mProfile.sourceTime;
+		longest = &mProfile.sourceMaxTime;
+		break;
+	}
+
+	*total += usec;
+	if (usec > *longest) {
+		*longest = (uint32_t)usec;
+	}
+}
+
+void MediaProfiler::addResample(uint64_t usec, uint32_t xruns)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mProfile.resampleTime += usec;
+	mProfile.deviceXruns += xruns;
+}
+
+void MediaProfiler::updateBufferLevel(size_t level)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mProfile.bufferLevel = (uint32_t)level;
+	if (mProfile.bufferLevel < mProfile.bufferMinLevel) {
+		mProfile.bufferMinLevel = mProfile.bufferLevel;
+	}
+}
+
+void MediaProfiler::addBufferXrun(void)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mProfile.bufferXruns++;
+}
+
+void MediaProfiler::get(media_profile_t *profile)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	*profile = mProfile;
+	if (profile->bufferMinLevel == UINT32_MAX) {
+		profile->bufferMinLevel = 0;
+	}
+}
+
+} // namespace media
@@ -0,0 +1,100 @@
+/* ****************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ******************************************************************/
+
+#ifndef __MEDIA_MEDIAPROFILER_H
+#define __MEDIA_MEDIAPROFILER_H
+
+#include <tinyara/config.h>
+#include <stdint.h>
+#include <mutex>
+#include <media/MediaTypes.h>
+
+#ifdef CONFIG_MEDIA_PROFILE
+#include <tinyara/ttrace.h>
+
+namespace media {
+
+/*
+ * Times the enclosing block into a total and a longest time, if given, and
+ * marks it as a ttrace event of TTRACE_TAG_MEDIA when CONFIG_TTRACE is enabled.
+ */
+class ProfileScope
+{
+public:
+	ProfileScope(const char *name, uint64_t *total = nullptr, uint32_t *longest = nullptr);
+	~ProfileScope();
+
+	/* Microseconds of the monotonic clock */
+	static uint64_t now(void);
+
+private:
+	uint64_t *mTotal;
+	uint32_t *mLongest;
+	uint64_t mBegin;
+};
+
+/*
+ * Counters of one player or recorder. Its threads all update them, so each
+ * update takes the lock.
+ */
+class MediaProfiler
+{
+public:
+	enum Stage {
+		STAGE_CODEC,
+		STAGE_DEVICE,
+		STAGE_SOURCE,
+	};
+
+	class Scope
+	{
+	public:
+		Scope(MediaProfiler &profiler, Stage stage, const char *name);
+		~Scope();
+
+	private:
+		MediaProfiler &mProfiler;
+		Stage mStage;
+		uint64_t mBegin;
+	};
+
+	MediaProfiler();
+	void reset(void);
+	void add(Stage stage, uint64_t usec);
+	void addResample(uint64_t usec, uint32_t xruns);
+	void updateBufferLevel(size_t level);
+	void addBufferXrun(void);
+	void get(media_profile_t *profile);
+
+private:
+	std::mutex mMutex;
+	media_profile_t mProfile;
+};
+
+} // namespace media
+
+#define MEDIA_PROFILE_SCOPE(profiler, stage, name) media::MediaProfiler::Scope profileScope(profiler, media::MediaProfiler::stage, name)
+#define MEDIA_PROFILE_TIME(name, total) media::ProfileScope profileScope(name, total)
+#define MEDIA_PROFILE_TRACE(name) media::ProfileScope profileScope(name)
+#else
+#define MEDIA_PROFILE_SCOPE(profiler, stage, name)
+#define MEDIA_PROFILE_TIME(name, total)
+#define MEDIA_PROFILE_TRACE(name)
+#endif
+
+#endif
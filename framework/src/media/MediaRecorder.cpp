@@ -102,6 +102,11 @@ recorder_result_t MediaRecorder::setFileSize(int byte)
 	return mPMrImpl->setFileSize(byte);
 }
 
+recorder_result_t MediaRecorder::getProfile(media_profile_t *profile)
+{
+	return mPMrImpl->getProfile(profile);
+}
+
 bool MediaRecorder::operator==(const MediaRecorder& rhs)
 {
 	return this->mId == rhs.mId;
@@ -16,7 +16,9 @@
  *
  ******************************************************************/
 
+#include <tinyara/config.h>
 #include <debug.h>
+#include <string.h>
 #include <media/MediaRecorder.h>
 #include <media/MediaTypes.h>
 #include "RecorderWorker.h"
@@ -154,6 +156,9 @@ void MediaRecorderImpl::prepareRecorder(recorder_result_t& ret)
 		return notifySync();
 	}
 
+#ifdef CONFIG_MEDIA_PROFILE
+	mOutputHandler.getProfiler().reset();
+#endif
 	if (!mOutputHandler.open()) {
 		meddbg("open() failed. recorder: %x\n", &mRecorder);
 		ret = RECORDER_ERROR_FILE_OPEN_FAILED;
@@ -170,6 +175,11 @@ void MediaRecorderImpl::prepareRecorder(recorder_result_t& ret)
 		ret = RECORDER_ERROR_INTERNAL_OPERATION_FAILED;
 		return notifySync();
 	}
+#ifdef CONFIG_MEDIA_PROFILE
+	if (get_audio_stream_in_profile(&mCardProfile) != AUDIO_MANAGER_SUCCESS) {
+		memset(&mCardProfile, 0, sizeof(mCardProfile));
+	}
+#endif
 
 	mBuffSize = get_user_input_frames_to_byte(get_input_frame_count());
 
@@ -735,6 +745,55 @@ void MediaRecorderImpl::setRecorderFileSize(int byte, recorder_result_t& ret)
 	notifySync();
 }
 
+recorder_result_t MediaRecorderImpl::getProfile(media_profile_t *profile)
+{
+#ifdef CONFIG_MEDIA_PROFILE
+	meddbg("%s recorder: %x\n", __func__, &mRecorder);
+	std::unique_lock<std::mutex> lock(mCmdMtx);
+
+	if (profile == nullptr) {
+		meddbg("The given argument is invalid. recorder: %x\n", &mRecorder);
+		return RECORDER_ERROR_INVALID_PARAM;
+	}
+
+	RecorderWorker& mrw = RecorderWorker::getWorker();
+	if (!mrw.isAlive()) {
+		meddbg("Worker is not alive. recorder: %x\n", &mRecorder);
+		return RECORDER_ERROR_NOT_ALIVE;
+	}
+
+	recorder_result_t ret = RECORDER_OK;
+	mrw.enQueue(&MediaRecorderImpl::getRecorderProfile, shared_from_this(), profile, std::ref(ret));
+	mSyncCv.wait(lock);
+
+	meddbg("%s returned. recorder: %x\n", __func__, &mRecorder);
+	return ret;
+#else
+	return RECORDER_ERROR_DEVICE_NOT_SUPPORTED;
+#endif
+}
+
+#ifdef CONFIG_MEDIA_PROFILE
+void MediaRecorderImpl::getRecorderProfile(media_profile_t *profile, recorder_result_t& ret)
+{
+	medvdbg("getRecorderProfile mCurState : %d\n", (recorder_state_t)mCurState);
+	if (mCurState != RECORDER_STATE_READY && mCurState != RECORDER_STATE_RECORDING && mCurState != RECORDER_STATE_PAUSED) {
+		meddbg("getRecorderProfile Failed mCurState: %d. recorder: %x\n", (recorder_state_t)mCurState, &mRecorder);
+		ret = RECORDER_ERROR_INVALID_STATE;
+		return notifySync();
+	}
+
+	mOutputHandler.getProfiler().get(profile);
+	audio_stream_profile_t card;
+	if (get_audio_stream_in_profile(&card) == AUDIO_MANAGER_SUCCESS) {
+		profile->resampleTime = card.resample_usec - mCardProfile.resample_usec;
+		profile->deviceXruns = card.xruns - mCardProfile.xruns;
+	}
+
+	notifySync();
+}
+#endif
+
 void MediaRecorderImpl::capture()
 {
 	medvdbg("MediaRecorderImpl::capture()\n");
@@ -749,7 +808,30 @@ void MediaRecorderImpl::capture()
 		}
 	}
 
-	int frames = start_audio_stream_in(mBuffer, frameSize);
+	unsigned char *buffer = mBuffer;
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+	/* Hand the captured frames to the output handler in place, unless the stream is resampled */
+	void *area;
+	unsigned int areaFrames = frameSize;
+	bool inPlace;
+	int frames;
+	{
+		MEDIA_PROFILE_SCOPE(mOutputHandler.getProfiler(), STAGE_DEVICE, "device read");
+		inPlace = get_audio_stream_in_buffer(&area, &areaFrames) == AUDIO_MANAGER_SUCCESS;
+		if (inPlace) {
+			buffer = (unsigned char *)area;
+			frames = areaFrames;
+		} else {
+			frames = start_audio_stream_in(mBuffer, frameSize);
+		}
+	}
+#else
+	int frames;
+	{
+		MEDIA_PROFILE_SCOPE(mOutputHandler.getProfiler(), STAGE_DEVICE, "device read");
+		frames = start_audio_stream_in(mBuffer, frameSize);
+	}
+#endif
 	if (frames > 0) {
 		mCapturedFrames += frames;
 		if (mCapturedFrames > INT_MAX) {
@@ -761,7 +843,7 @@ void MediaRecorderImpl::capture()
 		int size = get_user_input_frames_to_byte(frames);
 
 		while (size > 0) {
-			int written = mOutputHandler.write(mBuffer + ret, size);
+			int written = mOutputHandler.write(buffer + ret, size);
 			medvdbg("written : %d size : %d frames : %d\n", written, size, frames);
 			medvdbg("mCapturedFrames : %ld totalduration : %d mTotalFrames : %ld\n", mCapturedFrames, mDuration, mTotalFrames);
 			/* For Error case, we stop Capture */
@@ -804,6 +886,12 @@ void MediaRecorderImpl::capture()
 		res = RECORDER_ERROR_INVALID_PARAM;
 		mrw.enQueue(&MediaRecorderImpl::stopRecorderInternal, shared_from_this(), RECORDER_OBSERVER_COMMAND_STOPPED, res);
 	}
+
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+	if (inPlace) {
+		release_audio_stream_in_buffer(areaFrames);
+	}
+#endif
 }
 
 void MediaRecorderImpl::notifySync()
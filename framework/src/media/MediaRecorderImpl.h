@@ -36,6 +36,7 @@
 #include "MediaQueue.h"
 #include "RecorderObserverWorker.h"
 #include "media/stream_info.h"
+#include "audio/audio_manager.h"
 
 using namespace std;
 
@@ -107,6 +108,7 @@ public:
 	bool isRecording();
 	recorder_result_t setDuration(int second);
 	recorder_result_t setFileSize(int byte);
+	recorder_result_t getProfile(media_profile_t *profile);
 	void notifySync();
 	void notifyObserver(recorder_observer_command_t cmd, ...);
 	void capture();
@@ -127,6 +129,9 @@ private:
 	void setRecorderDataSource(std::shared_ptr<stream::OutputDataSource> dataSource, recorder_result_t& ret);
 	void setRecorderDuration(int second, recorder_result_t& ret);
 	void setRecorderFileSize(int byte, recorder_result_t& ret);
+#ifdef CONFIG_MEDIA_PROFILE
+	void getRecorderProfile(media_profile_t *profile, recorder_result_t& ret);
+#endif
 
 private:
 	std::atomic<recorder_state_t> mCurState;
@@ -143,6 +148,9 @@ private:
 	uint32_t mTotalFrames;
 	uint32_t mCapturedFrames;
 	std::shared_ptr<stream_info_t> mStreamInfo;
+#ifdef CONFIG_MEDIA_PROFILE
+	audio_stream_profile_t mCardProfile; // counters of the card at prepare
+#endif
 };
 } // namespace media
 
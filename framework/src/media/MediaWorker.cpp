@@ -26,6 +26,7 @@ namespace media {
 MediaWorker::MediaWorker() :
 	mStacksize(PTHREAD_STACK_DEFAULT),
 	mPriority(100),
+	mAffinity(1 << 0),
 	mThreadName("MediaWorker"),
 	mIsRunning(false),
 	mRefCnt(0),
@@ -64,7 +65,7 @@ void MediaWorker::startWorker()
 		pthread_attr_setstacksize(&attr, mStacksize);
 		sparam.sched_priority = mPriority;
 		pthread_attr_setschedparam(&attr, &sparam);
-		attr.affinity = 1 << 0;
+		attr.affinity = mAffinity;
 		mIsRunning = true;
 		ret = pthread_create(&mWorkerThread, &attr, MediaWorker::mediaLooper, this);
 		if (ret != OK) {
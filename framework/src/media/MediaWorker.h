@@ -46,6 +46,7 @@ public:
 protected:
 	long mStacksize;
 	int mPriority;
+	int mAffinity;
 	const char *mThreadName;
 	virtual bool processLoop();
 
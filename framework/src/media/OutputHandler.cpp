@@ -71,7 +71,19 @@ ssize_t OutputHandler::write(unsigned char *buf, size_t size)
 				// So we can reuse 'wlen' bytes free space in 'buf'.
 				// Process encoding and get encoded data.
 				size_t ret = wlen;
-				if (!encoder->getFrame(buf, &ret)) {
+
+				// Encode in place when stream buffer has as much space without wrapping around.
+				rb_span_t span[2];
+				if (mBufferWriter && mBufferWriter->reserve(span) >= ret && span[0].len >= ret) {
+					if (!getEncodeFrame(encoder, (unsigned char *)span[0].buf, &ret)) {
+						break;
+					}
+					mBufferWriter->commit(ret);
+					medvdbg("encoded in place size: %u\n", ret);
+					continue;
+				}
+
+				if (!getEncodeFrame(encoder, buf, &ret)) {
 					// Normal case, break and continue to push more PCM data
 					break;
 				}
@@ -96,6 +108,12 @@ ssize_t OutputHandler::write(unsigned char *buf, size_t size)
 	return (ssize_t)wlen;
 }
 
+bool OutputHandler::getEncodeFrame(std::shared_ptr<Encoder> &encoder, unsigned char *buf, size_t *size)
+{
+	MEDIA_PROFILE_SCOPE(mProfiler, STAGE_CODEC, "encode");
+	return encoder->getFrame(buf, size);
+}
+
 bool OutputHandler::stop()
 {
 	medvdbg("OutputHandler::stop()\n");
@@ -124,22 +142,30 @@ void OutputHandler::resetWorker()
 
 void OutputHandler::writeToSource(size_t size)
 {
-	auto buf = new unsigned char[size];
-	auto readed = mBufferReader->read(buf, size);
-	if (readed != size) {
-		meddbg("StreamBufferReader::read failed! size : %u, readed : %u\n", size, readed);
-		delete[] buf;
+	MEDIA_PROFILE_SCOPE(mProfiler, STAGE_SOURCE, "source write");
+
+	// Write to source from stream buffer in place, the part wrapping around separately.
+	rb_span_t span[2];
+	auto peeked = mBufferReader->peek(span);
+	if (peeked < size) {
+		meddbg("StreamBufferReader::peek failed! size : %u, peeked : %u\n", size, peeked);
 		return;
 	}
 
-	auto written = mOutputDataSource->write(buf, size);
-	if (written <= 0) {
-		// Error occurred, stop outputting
-		meddbg("OutputDataSource::write returned <= 0! size : %u, written : %d\n", size, written);
-		mBufferWriter->setEndOfStream();
+	size_t remained = size;
+	for (int i = 0; i < 2 && remained > 0; i++) {
+		size_t len = (span[i].len < remained) ? span[i].len : remained;
+		auto written = mOutputDataSource->write((unsigned char *)span[i].buf, len);
+		if (written <= 0) {
+			// Error occurred, stop outputting
+			meddbg("OutputDataSource::write returned <= 0! size : %u, written : %d\n", len, written);
+			mBufferWriter->setEndOfStream();
+			break;
+		}
+		remained -= len;
 	}
 
-	delete[] buf;
+	mBufferReader->consume(size);
 }
 
 bool OutputHandler::processWorker()
@@ -169,6 +195,9 @@ void OutputHandler::sleepWorker()
 
 void OutputHandler::onBufferOverrun()
 {
+#ifdef CONFIG_MEDIA_PROFILE
+	mProfiler.addBufferXrun();
+#endif
 	auto mr = getRecorder();
 	if (mr) {
 		mr->notifyObserver(RECORDER_OBSERVER_COMMAND_BUFFER_OVERRUN);
@@ -190,6 +219,11 @@ void OutputHandler::onBufferUpdated(ssize_t change, size_t current)
 		// Writing wake worker up
 		wakenWorker();
 	}
+#ifdef CONFIG_MEDIA_PROFILE
+	if (change < 0) {
+		mProfiler.updateBufferLevel(current);
+	}
+#endif
 }
 
 ssize_t OutputHandler::writeToStreamBuffer(unsigned char *buf, size_t size)
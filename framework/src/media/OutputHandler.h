@@ -55,6 +55,7 @@ private:
 	virtual bool processWorker() override;
 	const char *getWorkerName(void) const override { return "OutputHandler"; };
 	void writeToSource(size_t size);
+	bool getEncodeFrame(std::shared_ptr<Encoder> &encoder, unsigned char *buf, size_t *size);
 	std::shared_ptr<OutputDataSource> mOutputDataSource;
 	std::shared_ptr<Encoder> mEncoder;
 
@@ -21,6 +21,9 @@
 
 #include "PlayerWorker.h"
 #include "MediaPlayerImpl.h"
+#ifdef CONFIG_AUDIO_MIXER
+#include "audio/audio_manager.h"
+#endif
 
 #ifndef CONFIG_MEDIA_PLAYER_STACKSIZE
 #define CONFIG_MEDIA_PLAYER_STACKSIZE 4096
@@ -30,6 +33,10 @@
 #define CONFIG_MEDIA_PLAYER_THREAD_PRIORITY 199
 #endif
 
+#ifndef CONFIG_MEDIA_LOW_LATENCY_CPU
+#define CONFIG_MEDIA_LOW_LATENCY_CPU 0
+#endif
+
 using namespace std;
 
 namespace media {
@@ -37,7 +44,13 @@ PlayerWorker::PlayerWorker() : mCurPlayer(nullptr)
 {
 	mThreadName = "PlayerWorker";
 	mStacksize = CONFIG_MEDIA_PLAYER_STACKSIZE;
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	/* The player thread feeds the card, a low latency leaves it little time */
+	mPriority = CONFIG_MEDIA_LOW_LATENCY_THREAD_PRIORITY;
+	mAffinity = 1 << CONFIG_MEDIA_LOW_LATENCY_CPU;
+#else
 	mPriority = CONFIG_MEDIA_PLAYER_THREAD_PRIORITY;
+#endif
 }
 
 PlayerWorker::~PlayerWorker()
@@ -50,6 +63,35 @@ PlayerWorker& PlayerWorker::getWorker()
 	return worker;
 }
 
+#ifdef CONFIG_AUDIO_MIXER
+bool PlayerWorker::processLoop()
+{
+	bool playing = false;
+	bool played = false;
+
+	/* Only the players with room in the mixer are played, so that one of
+	 * them does not block the others. The list is copied since playback()
+	 * may finish a player.
+	 */
+	auto players = mPlayers;
+	for (auto &player : players) {
+		if (player->getState() != PLAYER_STATE_PLAYING) {
+			continue;
+		}
+		playing = true;
+		if (player->canPlayback()) {
+			player->playback();
+			played = true;
+		}
+	}
+
+	if (playing && !played) {
+		wait_mixer_stream_out();
+	}
+
+	return playing;
+}
+#else
 bool PlayerWorker::processLoop()
 {
 	if (mCurPlayer && (mCurPlayer->getState() == PLAYER_STATE_PLAYING)) {
@@ -59,6 +101,7 @@ bool PlayerWorker::processLoop()
 
 	return false;
 }
+#endif
 
 void PlayerWorker::setPlayer(std::shared_ptr<MediaPlayerImpl> player)
 {
@@ -70,4 +113,21 @@ std::shared_ptr<MediaPlayerImpl> PlayerWorker::getPlayer()
 	return mCurPlayer;
 }
 
+#ifdef CONFIG_AUDIO_MIXER
+void PlayerWorker::addPlayer(std::shared_ptr<MediaPlayerImpl> player)
+{
+	mPlayers.remove(player);
+	mPlayers.push_back(player);
+	mCurPlayer = player;
+}
+
+void PlayerWorker::removePlayer(std::shared_ptr<MediaPlayerImpl> player)
+{
+	mPlayers.remove(player);
+	if (mCurPlayer == player) {
+		mCurPlayer = mPlayers.empty() ? nullptr : mPlayers.back();
+	}
+}
+#endif
+
 } // namespace media
@@ -45,8 +45,16 @@
 namespace media {
 namespace stream {
 
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+#define WAITER_READER 0x01
+#define WAITER_WRITER 0x02
+#endif
+
 StreamBuffer::StreamBuffer(size_t bufferSize, size_t threshold)
 	: mObserver(nullptr), mEOS(false), mBufferSize(bufferSize), mThreshold(threshold)
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+	, mWaiters(0), mOverrun(false), mUnderrun(false)
+#endif
 {
 	mRingBuf.buf = nullptr;
 	mRingBuf.depth = 0;
@@ -84,12 +92,45 @@ size_t StreamBuffer::copy(unsigned char *buf, size_t size, size_t offset)
 
 size_t StreamBuffer::read(unsigned char *buf, size_t size)
 {
-	return rb_read(&mRingBuf, buf, size);
+	size_t len = rb_read(&mRingBuf, buf, size);
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+	if (len > 0) {
+		mOverrun = false;
+	}
+#endif
+	return len;
 }
 
 size_t StreamBuffer::write(unsigned char *buf, size_t size)
 {
-	return rb_write(&mRingBuf, buf, size);
+	size_t len = rb_write(&mRingBuf, buf, size);
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+	if (len > 0) {
+		mUnderrun = false;
+	}
+#endif
+	return len;
+}
+
+size_t StreamBuffer::peek(rb_span_t span[2], size_t offset)
+{
+	return rb_peek(&mRingBuf, span, offset);
+}
+
+size_t StreamBuffer::reserve(rb_span_t span[2])
+{
+	return rb_reserve(&mRingBuf, span);
+}
+
+size_t StreamBuffer::commit(size_t size)
+{
+	size_t len = rb_commit(&mRingBuf, size);
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+	if (len > 0) {
+		mUnderrun = false;
+	}
+#endif
+	return len;
 }
 
 size_t StreamBuffer::sizeOfSpace()
@@ -122,9 +163,21 @@ void StreamBuffer::notifyObserver(State st, ...)
 	if (mObserver) {
 		switch (st) {
 		case State::OVERRUN:
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+			// Notified once until the reader makes some space
+			if (mOverrun.exchange(true)) {
+				break;
+			}
+#endif
 			mObserver->onBufferOverrun();
 			break;
 		case State::UNDERRUN:
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+			// Notified once until the writer puts some data
+			if (mUnderrun.exchange(true)) {
+				break;
+			}
+#endif
 			mObserver->onBufferUnderrun();
 			break;
 		case State::UPDATED: {
@@ -139,6 +192,38 @@ void StreamBuffer::notifyObserver(State st, ...)
 	}
 }
 
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+/*
+ * The waiting side sets its flag before checking the indices again, and
+ * the other side checks the flags after moving its index, so that one of
+ * them always sees the other and a wakeup cannot be lost.
+ */
+void StreamBuffer::waitForData()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	mWaiters |= WAITER_READER;
+	mCondv.wait(lock, [this] { return sizeOfData() > 0 || isEndOfStream(); });
+	mWaiters &= ~WAITER_READER;
+}
+
+void StreamBuffer::waitForSpace()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	mWaiters |= WAITER_WRITER;
+	mCondv.wait(lock, [this] { return sizeOfSpace() > 0 || isEndOfStream(); });
+	mWaiters &= ~WAITER_WRITER;
+}
+
+void StreamBuffer::wakeWaiter()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (mWaiters.load() != 0) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mCondv.notify_all();
+	}
+}
+#endif
+
 StreamBuffer::Builder::Builder()
 	: mBufferSize(CONFIG_STREAM_BUFFER_SIZE_DEFAULT), mThreshold(CONFIG_STREAM_BUFFER_THRESHOLD_DEFAULT)
 {
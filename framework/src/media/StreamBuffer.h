@@ -19,8 +19,10 @@
 #ifndef __MEDIA_STREAMBUFFER_H
 #define __MEDIA_STREAMBUFFER_H
 
+#include <tinyara/config.h>
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include <condition_variable>
 #include "utils/rb.h"
 
@@ -87,6 +89,20 @@ public:
 	 * Write(push) data into stream buffer.
 	 */
 	size_t write(unsigned char *buf, size_t size);
+	/**
+	 * Get data from stream buffer in place, as up to two spans.
+	 * It stays valid until it is read(popped) with a null buf.
+	 */
+	size_t peek(rb_span_t span[2], size_t offset = 0);
+	/**
+	 * Get space of stream buffer in place, as up to two spans.
+	 * Data written there is pushed into stream buffer by commit().
+	 */
+	size_t reserve(rb_span_t span[2]);
+	/**
+	 * Push data written in place from the start of the reserved space.
+	 */
+	size_t commit(size_t size);
 	/**
 	 * Get bytes of data available in stream buffer.
 	 */
@@ -105,15 +121,37 @@ public:
 	bool isEndOfStream();
 	size_t getBufferSize() { return mBufferSize; }
 	size_t getThreshold() { return mThreshold; }
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+	/**
+	 * Block the reader until there is data or the end-of-stream flag is set.
+	 * Must be called without the mutex held.
+	 */
+	void waitForData();
+	/**
+	 * Block the writer until there is space or the end-of-stream flag is set.
+	 * Must be called without the mutex held.
+	 */
+	void waitForSpace();
+	/**
+	 * Wake up the other side if it is blocked, after data was read or written.
+	 * The mutex is only taken when the other side is waiting.
+	 */
+	void wakeWaiter();
+#endif
 
 private:
 	std::mutex mMutex;
 	std::condition_variable mCondv;
 	BufferObserverInterface *mObserver;
 	rb_t mRingBuf;
-	bool mEOS;
+	std::atomic<bool> mEOS;
 	size_t mBufferSize;
 	size_t mThreshold;
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+	std::atomic<int> mWaiters;
+	std::atomic<bool> mOverrun;
+	std::atomic<bool> mUnderrun;
+#endif
 };
 
 } // namespace stream
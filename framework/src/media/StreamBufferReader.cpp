@@ -36,12 +36,73 @@ StreamBufferReader::StreamBufferReader(std::shared_ptr<StreamBuffer> stream)
 size_t StreamBufferReader::copy(unsigned char *buf, size_t size, size_t offset)
 {
 	medvdbg("offset %lu, size %lu\n", offset, size);
+#ifndef CONFIG_STREAM_BUFFER_SPSC
 	std::lock_guard<std::mutex> lock(mStream->getMutex());
+#endif
 	size_t len = mStream->copy(buf, size, offset);
 	medvdbg("copied %lu\n", len);
 	return len;
 }
 
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+/*
+ * Reads are notified only when they move the level across an edge the
+ * observer acts on: out of full, below the threshold or to empty.
+ */
+static bool isLevelEdge(std::shared_ptr<StreamBuffer> &stream, size_t before, size_t after)
+{
+	size_t threshold = stream->getThreshold();
+
+	return before == stream->getBufferSize() || after == 0 || (before >= threshold && after < threshold);
+}
+
+size_t StreamBufferReader::read(unsigned char *buf, size_t size, bool sync)
+{
+	medvdbg("size %lu sync %c\n", size, sync ? 'Y' : 'N');
+
+	size_t rlen = 0;
+
+	while (rlen < size) {
+		// Read data from stream as much as possible
+		size_t before = mStream->sizeOfData();
+		size_t temp = mStream->read(buf + rlen, size - rlen);
+		if (temp > 0) {
+			if (isLevelEdge(mStream, before, before > temp ? before - temp : 0)) {
+				std::lock_guard<std::mutex> lock(mStream->getMutex());
+				mStream->notifyObserver(StreamBuffer::State::UPDATED, -((ssize_t) temp));
+			}
+			// Writer may be waiting for more spaces
+			mStream->wakeWaiter();
+			rlen += temp;
+		}
+
+		if (!sync || rlen == size) {
+			break;
+		}
+
+		// There's not enough data
+		if (mStream->isEndOfStream()) {
+			// End of stream, break reading
+			medvdbg("EOS break\n");
+			break;
+		}
+
+		medvdbg("read %lu/%lu\n", rlen, size);
+		{
+			// Notify observer, shouldn't be blocked.
+			std::lock_guard<std::mutex> lock(mStream->getMutex());
+			mStream->notifyObserver(StreamBuffer::State::UNDERRUN);
+		}
+		// Then wait data from writer.
+		mStream->waitForData();
+	}
+
+	assert(!sync || rlen == size || mStream->isEndOfStream());
+
+	medvdbg("read %lu\n", rlen);
+	return rlen;
+}
+#else
 size_t StreamBufferReader::read(unsigned char *buf, size_t size, bool sync)
 {
 	medvdbg("size %lu sync %c\n", size, sync ? 'Y' : 'N');
@@ -85,16 +146,35 @@ size_t StreamBufferReader::read(unsigned char *buf, size_t size, bool sync)
 	medvdbg("read %lu\n", rlen);
 	return rlen;
 }
+#endif
+
+size_t StreamBufferReader::peek(rb_span_t span[2], size_t offset)
+{
+#ifndef CONFIG_STREAM_BUFFER_SPSC
+	std::lock_guard<std::mutex> lock(mStream->getMutex());
+#endif
+	return mStream->peek(span, offset);
+}
+
+size_t StreamBufferReader::consume(size_t size)
+{
+	// Reading to a null buffer pops data out without copying
+	return read(nullptr, size, false);
+}
 
 size_t StreamBufferReader::sizeOfData()
 {
+#ifndef CONFIG_STREAM_BUFFER_SPSC
 	std::lock_guard<std::mutex> lock(mStream->getMutex());
+#endif
 	return mStream->sizeOfData();
 }
 
 bool StreamBufferReader::isEndOfStream()
 {
+#ifndef CONFIG_STREAM_BUFFER_SPSC
 	std::lock_guard<std::mutex> lock(mStream->getMutex());
+#endif
 	return mStream->isEndOfStream();
 }
 
@@ -20,6 +20,7 @@
 #define __MEDIA_STREAMBUFFERREADER_H
 
 #include <memory>
+#include "utils/rb.h"
 
 namespace media {
 namespace stream {
@@ -33,6 +34,12 @@ public:
 public:
 	virtual size_t copy(unsigned char *buf, size_t size, size_t offset = 0);
 	virtual size_t read(unsigned char *buf, size_t size, bool sync = true);
+	/**
+	 * Get data in place without copying it, as up to two spans.
+	 * It stays valid until it is dropped by consume().
+	 */
+	size_t peek(rb_span_t span[2], size_t offset = 0);
+	size_t consume(size_t size);
 	virtual size_t sizeOfData();
 
 public:
@@ -33,6 +33,53 @@ StreamBufferWriter::StreamBufferWriter(std::shared_ptr<StreamBuffer> stream)
 	assert(mStream);
 }
 
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+size_t StreamBufferWriter::write(unsigned char *buf, size_t size, bool sync)
+{
+	medvdbg("size %lu sync %c\n", size, sync ? 'Y' : 'N');
+
+	size_t wlen = 0;
+
+	while (wlen < size) {
+		// Streaming may be stopped (EOS was set)
+		if (sync && mStream->isEndOfStream()) {
+			// Don't need to write anymore
+			medvdbg("EOS break\n");
+			break;
+		}
+
+		// Write data into stream as much as possible
+		size_t temp = mStream->write(buf + wlen, size - wlen);
+		if (temp > 0) {
+			{
+				// Observers count the bytes written, so every write is notified.
+				std::lock_guard<std::mutex> lock(mStream->getMutex());
+				mStream->notifyObserver(StreamBuffer::State::UPDATED, (ssize_t) temp);
+			}
+			// Reader may be waiting for more data
+			mStream->wakeWaiter();
+			wlen += temp;
+		}
+
+		if (!sync || wlen == size) {
+			break;
+		}
+
+		medvdbg("written %lu/%lu\n", wlen, size);
+		{
+			// There's not enough space
+			// Notify observer, shouldn't be blocked.
+			std::lock_guard<std::mutex> lock(mStream->getMutex());
+			mStream->notifyObserver(StreamBuffer::State::OVERRUN);
+		}
+		// Then wait space from reader.
+		mStream->waitForSpace();
+	}
+
+	medvdbg("written %lu\n", wlen);
+	return wlen;
+}
+#else
 size_t StreamBufferWriter::write(unsigned char *buf, size_t size, bool sync)
 {
 	medvdbg("size %lu sync %c\n", size, sync ? 'Y' : 'N');
@@ -75,10 +122,42 @@ size_t StreamBufferWriter::write(unsigned char *buf, size_t size, bool sync)
 	medvdbg("written %lu\n", wlen);
 	return wlen;
 }
+#endif
+
+size_t StreamBufferWriter::reserve(rb_span_t span[2])
+{
+#ifndef CONFIG_STREAM_BUFFER_SPSC
+	std::lock_guard<std::mutex> lock(mStream->getMutex());
+#endif
+	return mStream->reserve(span);
+}
+
+size_t StreamBufferWriter::commit(size_t size)
+{
+	size_t wlen;
+
+	{
+		std::lock_guard<std::mutex> lock(mStream->getMutex());
+		wlen = mStream->commit(size);
+		mStream->notifyObserver(StreamBuffer::State::UPDATED, (ssize_t) wlen);
+#ifndef CONFIG_STREAM_BUFFER_SPSC
+		// Reader may be waiting for more data, so it's necessary to notify after writing.
+		mStream->getCondv().notify_one();
+#endif
+	}
+#ifdef CONFIG_STREAM_BUFFER_SPSC
+	mStream->wakeWaiter();
+#endif
+
+	medvdbg("committed %lu\n", wlen);
+	return wlen;
+}
 
 size_t StreamBufferWriter::sizeOfSpace()
 {
+#ifndef CONFIG_STREAM_BUFFER_SPSC
 	std::lock_guard<std::mutex> lock(mStream->getMutex());
+#endif
 	return mStream->sizeOfSpace();
 }
 
@@ -20,6 +20,7 @@
 #define __MEDIA_STREAMBUFFERWRITER_H
 
 #include <memory>
+#include "utils/rb.h"
 
 namespace media {
 namespace stream {
@@ -32,6 +33,12 @@ public:
 
 public:
 	virtual size_t write(unsigned char *buf, size_t size, bool sync = true);
+	/**
+	 * Get space in place to write data without copying it, as up to two spans.
+	 * Data written from the start of span[0] is pushed by commit().
+	 */
+	size_t reserve(rb_span_t span[2]);
+	size_t commit(size_t size);
 	virtual size_t sizeOfSpace();
 
 public:
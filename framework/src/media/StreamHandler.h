@@ -28,6 +28,7 @@
 #include "StreamBuffer.h"
 #include "StreamBufferReader.h"
 #include "StreamBufferWriter.h"
+#include "MediaProfiler.h"
 
 namespace media {
 namespace stream {
@@ -43,11 +44,20 @@ public:
 
 	std::shared_ptr<DataSource> getDataSource()
 	{
+		std::lock_guard<std::mutex> lock(mDataSourceMutex);
 		return mDataSource;
 	}
+#ifdef CONFIG_MEDIA_PROFILE
+	MediaProfiler &getProfiler()
+	{
+		return mProfiler;
+	}
+#endif
 protected:
+	/* The worker of InputHandler changes the source between queued ones */
 	void setDataSource(std::shared_ptr<DataSource> dataSource)
 	{
+		std::lock_guard<std::mutex> lock(mDataSourceMutex);
 		mDataSource = dataSource;
 	}
 	void setStreamBuffer(std::shared_ptr<StreamBuffer> streamBuffer);
@@ -73,6 +83,9 @@ protected:
 	pthread_t mWorker;
 	size_t mWorkerStackSize;
 	std::atomic<bool> mIsWorkerAlive;
+#ifdef CONFIG_MEDIA_PROFILE
+	MediaProfiler mProfiler;
+#endif
 private:
 	void createWorker();
 	void destroyWorker();
@@ -81,6 +94,7 @@ private:
 	std::mutex mMutex;
 	std::condition_variable mCondv;
 
+	std::mutex mDataSourceMutex;
 	std::shared_ptr<DataSource> mDataSource;
 };
 } // namespace stream
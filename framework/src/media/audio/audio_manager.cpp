@@ -36,6 +36,7 @@
 #include "audio_manager.h"
 #include "resample/speex_resampler.h"
 #include "../utils/remix.h"
+#include "../MediaProfiler.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -115,6 +116,18 @@
 		}	\
 	}	\
 
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+#define AUDIO_PCM_MMAP PCM_MMAP
+#else
+#define AUDIO_PCM_MMAP 0
+#endif
+
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+#define AUDIO_PCM_LOW_LATENCY(card) ((card)->low_latency ? PCM_LOW_LATENCY : 0)
+#else
+#define AUDIO_PCM_LOW_LATENCY(card) 0
+#endif
+
 #define RESAMPLING_QUALITY 5 // Resampling quality between 0 and 10, where 0 has poor quality and 10 has very high quality.
 #define MAX_RESAMPLING_QUALITY 10
 
@@ -172,6 +185,16 @@ struct audio_card_info_s {
 	struct audio_resample_s resample;
 	pthread_mutex_t card_mutex;
 	uint8_t volume[MAX_STREAM_POLICY_NUM];
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+	unsigned int mmap_offset;		// offset in frames of the area given to a user
+#endif
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	bool low_latency;			// asked for the next set_audio_stream_out()
+	bool pcm_low_latency;			// the pcm was opened with PCM_LOW_LATENCY
+#endif
+#ifdef CONFIG_MEDIA_PROFILE
+	audio_stream_profile_t profile;		// counters read by players and recorders
+#endif
 };
 
 struct audio_samprate_map_entry_s {
@@ -239,6 +262,30 @@ static inline audio_manager_result_t validate_stream_policy(stream_policy_t stre
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
+/* With mmap, the card is read and written through its buffers, which
+ * costs the same copy as pcm_readi() and pcm_writei(). The copy is saved
+ * by the users of get_audio_stream_in_buffer() and get_audio_stream_out_buffer().
+ */
+static int audio_pcm_readi(struct pcm *pcm, void *data, unsigned int frames)
+{
+	MEDIA_PROFILE_TRACE("pcm read");
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+	return pcm_mmap_read(pcm, data, pcm_frames_to_bytes(pcm, frames));
+#else
+	return pcm_readi(pcm, data, frames);
+#endif
+}
+
+static int audio_pcm_writei(struct pcm *pcm, const void *data, unsigned int frames)
+{
+	MEDIA_PROFILE_TRACE("pcm write");
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+	return pcm_mmap_write(pcm, data, pcm_frames_to_bytes(pcm, frames));
+#else
+	return pcm_writei(pcm, data, frames);
+#endif
+}
+
 static void get_card_path(char *card_path, uint8_t card_id, uint8_t device_id, audio_io_direction_t direct)
 {
 	char type_chr = (direct == INPUT) ? 'c' : 'p';
@@ -464,11 +511,13 @@ static uint32_t get_closest_samprate(unsigned int origin_samprate, audio_io_dire
  */
 static unsigned int resample_stream_in(audio_card_info_t *card, void *data, unsigned int frames)
 {
+	MEDIA_PROFILE_TIME("resample", &card->profile.resample_usec);
 	unsigned int used_frames = 0;
 	unsigned int resampled_frames = 0;
 	unsigned int rechanneled_frames;
 	unsigned int original_channel_num;
 	unsigned int original_sample_rate;
+	void *resample_in;
 	spx_int16_t *data_in;
 	spx_uint32_t input_frames;
 	spx_int16_t *data_out;
@@ -489,17 +538,28 @@ static unsigned int resample_stream_in(audio_card_info_t *card, void *data, unsi
 		return rechanneled_frames;
 	}
 
-	// Rechannel/Copy frames in resample buffer to rechannel buffer
-	rechanneled_frames = rechannel(ch2layout(original_channel_num), ch2layout(card->resample.user_channel),
-					(const int16_t *)card->resample.buffer, card->resample.frames,
-					(int16_t *)card->resample.rechannel_buffer, get_user_input_bytes_to_frame(card->resample.rechannel_buffer_size));
+	// Resample frames straight from resample buffer, and rechannel there in place when it doesn't need more space.
+	// Only upmixing goes through rechannel buffer.
+	resample_in = card->resample.buffer;
+	if (card->resample.user_channel > original_channel_num) {
+		resample_in = card->resample.rechannel_buffer;
+		rechanneled_frames = rechannel(ch2layout(original_channel_num), ch2layout(card->resample.user_channel),
+						(const int16_t *)card->resample.buffer, card->resample.frames,
+						(int16_t *)resample_in, get_user_input_bytes_to_frame(card->resample.rechannel_buffer_size));
+	} else if (card->resample.user_channel < original_channel_num) {
+		rechanneled_frames = rechannel(ch2layout(original_channel_num), ch2layout(card->resample.user_channel),
+						(const int16_t *)card->resample.buffer, card->resample.frames,
+						(int16_t *)resample_in, card->resample.frames);
+	} else {
+		rechanneled_frames = card->resample.frames;
+	}
 	if (rechanneled_frames != card->resample.frames) {
 		meddbg("Fail to rechannel each frame, %u/%u\n", rechanneled_frames, card->resample.frames);
 		return AUDIO_MANAGER_RESAMPLE_FAIL;
 	}
 
 	while (card->resample.frames > used_frames) {
-		data_in = (spx_int16_t *)((char *)(card->resample.rechannel_buffer) + get_user_input_frames_to_byte(used_frames));
+		data_in = (spx_int16_t *)((char *)resample_in + get_user_input_frames_to_byte(used_frames));
 		input_frames = card->resample.frames - used_frames;
 		data_out = (spx_int16_t *)((char *)data + get_user_input_frames_to_byte(resampled_frames));
 		output_frames = frames - resampled_frames; // set to maximum frames given output buffer can hold.
@@ -538,11 +598,13 @@ static unsigned int resample_stream_in(audio_card_info_t *card, void *data, unsi
  */
 static unsigned int resample_stream_out(audio_card_info_t *card, void *data, unsigned int frames)
 {
+	MEDIA_PROFILE_TIME("resample", &card->profile.resample_usec);
 	unsigned int used_frames = 0;
 	unsigned int resampled_frames = 0;
 	unsigned int rechanneled_frames;
 	unsigned int desired_channel_num;
 	unsigned int desired_sample_rate;
+	void *resample_in;
 	spx_int16_t *data_in;
 	spx_uint32_t input_frames;
 	spx_int16_t *data_out;
@@ -563,16 +625,20 @@ static unsigned int resample_stream_out(audio_card_info_t *card, void *data, uns
 		return rechanneled_frames;
 	}
 
-	// Rechannel/Copy input frames to rechannel buffer
-	rechanneled_frames = rechannel(ch2layout(card->resample.user_channel), ch2layout(desired_channel_num), (const int16_t *)data, frames,
-					(int16_t *)card->resample.rechannel_buffer, get_card_output_bytes_to_frame(card->resample.rechannel_buffer_size));
-	if (rechanneled_frames != frames) {
-		meddbg("Fail to rechannel each frame, %u/%u\n", rechanneled_frames, frames);
-		return AUDIO_MANAGER_RESAMPLE_FAIL;
+	// Resample input frames straight from user buffer, if they don't need to be rechanneled.
+	resample_in = data;
+	if (card->resample.user_channel != desired_channel_num) {
+		resample_in = card->resample.rechannel_buffer;
+		rechanneled_frames = rechannel(ch2layout(card->resample.user_channel), ch2layout(desired_channel_num), (const int16_t *)data, frames,
+						(int16_t *)resample_in, get_card_output_bytes_to_frame(card->resample.rechannel_buffer_size));
+		if (rechanneled_frames != frames) {
+			meddbg("Fail to rechannel each frame, %u/%u\n", rechanneled_frames, frames);
+			return AUDIO_MANAGER_RESAMPLE_FAIL;
+		}
 	}
 
 	while (frames > used_frames) {
-		data_in = (spx_int16_t *)((char *)(card->resample.rechannel_buffer) + get_card_output_frames_to_byte(used_frames));
+		data_in = (spx_int16_t *)((char *)resample_in + get_card_output_frames_to_byte(used_frames));
 		input_frames = frames - used_frames;
 		data_out = (spx_int16_t *)((char *)card->resample.buffer + get_card_output_frames_to_byte(resampled_frames));
 		output_frames = get_card_output_bytes_to_frame(card->resample.buffer_size) - resampled_frames; // set to maximum frames resample buffer can hold.
@@ -1121,7 +1187,7 @@ audio_manager_result_t set_audio_stream_in(unsigned int channels, unsigned int s
 	config.channels = channel_num;
 	medvdbg("Device samplerate: %u, User requested: %u\n", config.rate, sample_rate);
 	medvdbg("Device channel: %u User requested: %u\n", config.channels, channels);
-	card->pcm = pcm_open(g_actual_audio_in_card_id, card->device_id, PCM_IN, &config);
+	card->pcm = pcm_open(g_actual_audio_in_card_id, card->device_id, PCM_IN | AUDIO_PCM_MMAP, &config);
 	if (!pcm_is_ready(card->pcm)) {
 		meddbg("fail to pcm_is_ready() error : %s", pcm_get_error(card->pcm));
 		ret = AUDIO_MANAGER_CARD_NOT_READY;
@@ -1244,10 +1310,25 @@ audio_manager_result_t set_audio_stream_out(unsigned int channels, unsigned int
 	config.channels = channel_num;
 	medvdbg("[OUT] Device samplerate: %u, User requested: %u\n", config.rate, sample_rate);
 	medvdbg("[OUT] Device channel: %u, User requested: %u\n", config.channels, channels);
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+	if (card->low_latency) {
+		config.period_size = CONFIG_MEDIA_LOW_LATENCY_PERIOD_SIZE;
+		config.period_count = CONFIG_MEDIA_LOW_LATENCY_PERIOD_COUNT;
+	}
+	/* The periods are set when the card is opened */
+	if (pcm_is_ready(card->pcm) && card->pcm_low_latency != card->low_latency) {
+		medvdbg("reopen card for low latency %d\n", card->low_latency);
+		pcm_close(card->pcm);
+		card->pcm = NULL;
+	}
+#endif
 	if (pcm_is_ready(card->pcm)) {
 		meddbg("card is already in use, reuse it!!\n");
 	} else {
-		card->pcm = pcm_open(g_actual_audio_out_card_id, card->device_id, PCM_OUT, &config);
+		card->pcm = pcm_open(g_actual_audio_out_card_id, card->device_id, PCM_OUT | AUDIO_PCM_MMAP | AUDIO_PCM_LOW_LATENCY(card), &config);
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+		card->pcm_low_latency = card->low_latency;
+#endif
 	}
 	/* check reserve state of card again */
 	if (!pcm_is_ready(card->pcm)) {
@@ -1322,6 +1403,26 @@ error_with_pcm:
 	return ret;
 }
 
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+audio_manager_result_t set_audio_stream_out_low_latency(bool enable)
+{
+	audio_card_info_t *card;
+
+	if (g_actual_audio_out_card_id < 0) {
+		meddbg("Found no active output audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	card = &g_audio_out_cards[g_actual_audio_out_card_id];
+
+	pthread_mutex_lock(&(card->card_mutex));
+	card->low_latency = enable;
+	pthread_mutex_unlock(&(card->card_mutex));
+
+	return AUDIO_MANAGER_SUCCESS;
+}
+#endif
+
 int start_audio_stream_in(void *data, unsigned int frames)
 {
 	int ret = 0;
@@ -1364,10 +1465,13 @@ int start_audio_stream_in(void *data, unsigned int frames)
 	}
 
 	do {
-		ret = pcm_readi(card->pcm, buffer_ptr, frames_to_read);
+		ret = audio_pcm_readi(card->pcm, buffer_ptr, frames_to_read);
 		medvdbg("Read %d frames\n", ret);
 
 		if (ret == -EPIPE) {
+#ifdef CONFIG_MEDIA_PROFILE
+			card->profile.xruns++;
+#endif
 			ret = pcm_prepare(card->pcm);
 			medvdbg("PCM is reprepared\n");
 			if (ret != OK) {
@@ -1447,9 +1551,12 @@ int start_audio_stream_out(void *data, unsigned int frames)
 	card->config[card->device_id].status = AUDIO_CARD_RUNNING;
 
 	do {
-		ret = pcm_writei(card->pcm, data, frames);
+		ret = audio_pcm_writei(card->pcm, data, frames);
 		if (ret < 0) {
 			if (ret == -EPIPE) {
+#ifdef CONFIG_MEDIA_PROFILE
+				card->profile.xruns++;
+#endif
 				if (prepare_retry > 0) {
 					ret = pcm_prepare(card->pcm);
 					if (ret != OK) {
@@ -1480,6 +1587,190 @@ error_with_lock:
 	return ret;
 }
 
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+/* Called with card_mutex held. Resumes the card if it was paused. */
+static int resume_audio_stream(audio_card_info_t *card)
+{
+	if (card->config[card->device_id].status == AUDIO_CARD_PAUSE) {
+		if (ioctl(pcm_get_file_descriptor(card->pcm), AUDIOIOC_RESUME, 0UL) < 0) {
+			meddbg("Fail to ioctl AUDIOIOC_RESUME\n");
+			return AUDIO_MANAGER_DEVICE_FAIL;
+		}
+	}
+	card->config[card->device_id].status = AUDIO_CARD_RUNNING;
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+/* Called with card_mutex held. Waits for an area of the mmap buffers to be
+ * given to the user: free space for output, captured frames for input.
+ */
+static int begin_audio_stream_mmap(audio_card_info_t *card, audio_io_direction_t direct, void **buffer, unsigned int *frames)
+{
+	int prepare_retry = AUDIO_STREAM_RETRY_COUNT;
+	unsigned int offset;
+	unsigned int max_frames = *frames;
+	void *area;
+	int ret;
+
+	if (card->resample.necessary) {
+		/* The frames have to be converted through the resampling buffer */
+		return AUDIO_MANAGER_DEVICE_NOT_SUPPORT;
+	}
+
+	while (true) {
+		*frames = max_frames;
+		ret = pcm_mmap_begin(card->pcm, &area, &offset, frames);
+		if (ret < 0) {
+			meddbg("pcm_mmap_begin failed, ret = %d\n", ret);
+			return AUDIO_MANAGER_OPERATION_FAIL;
+		}
+		if (*frames > 0) {
+			break;
+		}
+
+		/* All buffers are with the driver, wait for one to come back */
+		ret = pcm_wait(card->pcm, -1);
+		if (ret == -EPIPE) {
+#ifdef CONFIG_MEDIA_PROFILE
+			card->profile.xruns++;
+#endif
+			/* The card stopped on the xrun. Take the buffers back and start
+			 * again: a capture at once, a playback with the next commit.
+			 */
+			if (prepare_retry-- == 0) {
+				meddbg("Fail to recover from xrun\n");
+				return AUDIO_MANAGER_XRUN_STATE;
+			}
+			pcm_drop(card->pcm);
+			if (direct == INPUT && pcm_start(card->pcm) < 0) {
+				meddbg("pcm_start failed\n");
+				return AUDIO_MANAGER_XRUN_STATE;
+			}
+		} else if (ret < 0) {
+			meddbg("pcm_wait failed, ret = %d\n", ret);
+			return AUDIO_MANAGER_DEVICE_FAIL;
+		}
+	}
+
+	card->mmap_offset = offset;
+	*buffer = (char *)area + pcm_frames_to_bytes(card->pcm, offset);
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+int get_audio_stream_in_buffer(void **buffer, unsigned int *frames)
+{
+	audio_card_info_t *card;
+	int ret;
+
+	if (g_actual_audio_in_card_id < 0) {
+		meddbg("Found no active input audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	card = &g_audio_in_cards[g_actual_audio_in_card_id];
+
+	pthread_mutex_lock(&(card->card_mutex));
+	ret = resume_audio_stream(card);
+	if (ret != AUDIO_MANAGER_SUCCESS) {
+		goto error_with_lock;
+	}
+
+	/* Areas of a capture are only given while it runs */
+	if (pcm_start(card->pcm) < 0) {
+		meddbg("pcm_start failed\n");
+		ret = AUDIO_MANAGER_DEVICE_FAIL;
+		goto error_with_lock;
+	}
+	ret = begin_audio_stream_mmap(card, INPUT, buffer, frames);
+
+error_with_lock:
+	pthread_mutex_unlock(&(card->card_mutex));
+
+	return ret;
+}
+
+int release_audio_stream_in_buffer(unsigned int frames)
+{
+	audio_card_info_t *card;
+	int ret;
+
+	if (g_actual_audio_in_card_id < 0) {
+		meddbg("Found no active input audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	card = &g_audio_in_cards[g_actual_audio_in_card_id];
+
+	pthread_mutex_lock(&(card->card_mutex));
+	ret = pcm_mmap_commit(card->pcm, card->mmap_offset, frames);
+	pthread_mutex_unlock(&(card->card_mutex));
+
+	if (ret < 0) {
+		meddbg("pcm_mmap_commit failed, ret = %d\n", ret);
+		return AUDIO_MANAGER_DEVICE_FAIL;
+	}
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+int get_audio_stream_out_buffer(void **buffer, unsigned int *frames)
+{
+	audio_card_info_t *card;
+	int ret;
+
+	if (g_actual_audio_out_card_id < 0) {
+		meddbg("Found no active output audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	card = &g_audio_out_cards[g_actual_audio_out_card_id];
+
+	pthread_mutex_lock(&(card->card_mutex));
+	ret = begin_audio_stream_mmap(card, OUTPUT, buffer, frames);
+	pthread_mutex_unlock(&(card->card_mutex));
+
+	return ret;
+}
+
+int commit_audio_stream_out_buffer(unsigned int frames)
+{
+	audio_card_info_t *card;
+	int ret;
+
+	if (g_actual_audio_out_card_id < 0) {
+		meddbg("Found no active output audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	card = &g_audio_out_cards[g_actual_audio_out_card_id];
+
+	pthread_mutex_lock(&(card->card_mutex));
+	ret = resume_audio_stream(card);
+	if (ret != AUDIO_MANAGER_SUCCESS) {
+		goto error_with_lock;
+	}
+
+	ret = pcm_mmap_commit(card->pcm, card->mmap_offset, frames);
+	if (ret < 0) {
+		meddbg("pcm_mmap_commit failed, ret = %d\n", ret);
+		ret = AUDIO_MANAGER_DEVICE_FAIL;
+		goto error_with_lock;
+	}
+
+	/* The card starts with the first buffer committed, pcm_start() does nothing afterwards */
+	ret = pcm_start(card->pcm);
+	if (ret < 0) {
+		meddbg("pcm_start failed, ret = %d\n", ret);
+		ret = AUDIO_MANAGER_DEVICE_FAIL;
+		goto error_with_lock;
+	}
+	ret = frames;
+
+error_with_lock:
+	pthread_mutex_unlock(&(card->card_mutex));
+	return ret;
+}
+#endif
+
 static audio_manager_result_t pause_audio_stream(audio_io_direction_t direct)
 {
 	audio_manager_result_t ret;
@@ -1821,6 +2112,12 @@ unsigned int get_card_buffer_size(audio_io_direction_t direct)
 			return 0;
 		}
 		card = &g_audio_out_cards[g_actual_audio_out_card_id];
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+		/* The periods are shorter than the driver reports */
+		if (card->pcm_low_latency && pcm_is_ready(card->pcm)) {
+			return pcm_get_buffer_size(card->pcm);
+		}
+#endif
 	}
 	get_card_path(path, card->card_id, card->device_id, direct);
 	fd = open(path, O_RDONLY);
@@ -1879,6 +2176,41 @@ audio_manager_result_t get_input_audio_gain(uint8_t *gain)
 	return ret;
 }
 
+#ifdef CONFIG_MEDIA_PROFILE
+static audio_manager_result_t get_audio_stream_profile(audio_card_info_t *card, audio_stream_profile_t *profile)
+{
+	if (profile == NULL) {
+		return AUDIO_MANAGER_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&(card->card_mutex));
+	*profile = card->profile;
+	pthread_mutex_unlock(&(card->card_mutex));
+
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+audio_manager_result_t get_audio_stream_in_profile(audio_stream_profile_t *profile)
+{
+	if (g_actual_audio_in_card_id < 0) {
+		meddbg("Found no active input audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	return get_audio_stream_profile(&g_audio_in_cards[g_actual_audio_in_card_id], profile);
+}
+
+audio_manager_result_t get_audio_stream_out_profile(audio_stream_profile_t *profile)
+{
+	if (g_actual_audio_out_card_id < 0) {
+		meddbg("Found no active output audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	return get_audio_stream_profile(&g_audio_out_cards[g_actual_audio_out_card_id], profile);
+}
+#endif
+
 audio_manager_result_t get_output_audio_volume(uint8_t *volume)
 {
 	audio_manager_result_t ret = AUDIO_MANAGER_SUCCESS;
@@ -2518,6 +2850,30 @@ audio_manager_result_t change_stream_out_device(int card_id, int device_id)
 	return change_stream_device(card_id, device_id, OUTPUT);
 }
 
+audio_manager_result_t get_stream_in_id(int *card_id, int *device_id)
+{
+	if (g_actual_audio_in_card_id < 0) {
+		meddbg("Found no active input audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	*card_id = g_actual_audio_in_card_id;
+	*device_id = g_audio_in_cards[g_actual_audio_in_card_id].device_id;
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+audio_manager_result_t get_stream_out_id(int *card_id, int *device_id)
+{
+	if (g_actual_audio_out_card_id < 0) {
+		meddbg("Found no active output audio card\n");
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	*card_id = g_actual_audio_out_card_id;
+	*device_id = g_audio_out_cards[g_actual_audio_out_card_id].device_id;
+	return AUDIO_MANAGER_SUCCESS;
+}
+
 /* TODO policy should be merged logic of focus manager */
 audio_manager_result_t set_stream_policy(stream_policy_t policy, audio_io_direction_t direct)
 {
@@ -106,6 +106,18 @@ enum audio_device_process_unit_subtype_e {
 
 typedef enum audio_device_process_unit_subtype_e device_process_subtype_t;
 
+#ifdef CONFIG_MEDIA_PROFILE
+/**
+ * @brief Counters of the active card of a direction, since audio_manager_init
+ */
+struct audio_stream_profile_s {
+	uint64_t resample_usec;		// time spent resampling
+	unsigned int xruns;		// xruns the card recovered from, or not
+};
+
+typedef struct audio_stream_profile_s audio_stream_profile_t;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -158,6 +170,25 @@ audio_manager_result_t set_audio_stream_in(unsigned int channels, unsigned int s
  ****************************************************************************/
 audio_manager_result_t set_audio_stream_out(unsigned int channels, unsigned int sample_rate, int format, stream_info_id_t stream_id);
 
+#ifdef CONFIG_MEDIA_LOW_LATENCY
+/****************************************************************************
+ * Name: set_audio_stream_out_low_latency
+ *
+ * Description:
+ *   Choose the periods of the next set_audio_stream_out(). A low latency
+ *   opens the card with CONFIG_MEDIA_LOW_LATENCY_PERIOD_SIZE and
+ *   CONFIG_MEDIA_LOW_LATENCY_PERIOD_COUNT, and the card is reopened when
+ *   it was opened with the other periods.
+ *
+ * Input parameters:
+ *   enable: true for the low latency periods
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+audio_manager_result_t set_audio_stream_out_low_latency(bool enable);
+#endif
+
 /****************************************************************************
  * Name: start_audio_stream_in
  *
@@ -192,6 +223,96 @@ int start_audio_stream_in(void *data, unsigned int frames);
  ****************************************************************************/
 int start_audio_stream_out(void *data, unsigned int frames);
 
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+/****************************************************************************
+ * Name: get_audio_stream_in_buffer
+ *
+ * Description:
+ *   Get captured frames in place in the buffers of the input card, without
+ *   copying them as start_audio_stream_in() does. The capture is started or
+ *   resumed if needed. The frames must be given back with
+ *   release_audio_stream_in_buffer() before the next call.
+ *
+ * Input parameters:
+ *   buffer: pointer to the captured frames to be returned
+ *   frames: largest number of frames wanted, and the number returned
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. AUDIO_MANAGER_DEVICE_NOT_SUPPORT if
+ *   the stream is resampled, in which case start_audio_stream_in() is to be
+ *   used. Otherwise, a negative value.
+ ****************************************************************************/
+int get_audio_stream_in_buffer(void **buffer, unsigned int *frames);
+
+/****************************************************************************
+ * Name: release_audio_stream_in_buffer
+ *
+ * Description:
+ *   Give back the frames taken with get_audio_stream_in_buffer().
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+int release_audio_stream_in_buffer(unsigned int frames);
+
+/****************************************************************************
+ * Name: get_audio_stream_out_buffer
+ *
+ * Description:
+ *   Get free space in the buffers of the output card to write frames in
+ *   place, without the copy of start_audio_stream_out(). It waits while all
+ *   buffers are played. The frames written must be committed with
+ *   commit_audio_stream_out_buffer() before the next call.
+ *
+ * Input parameters:
+ *   buffer: pointer to the space to be returned
+ *   frames: largest number of frames wanted, and the number returned
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. AUDIO_MANAGER_DEVICE_NOT_SUPPORT if
+ *   the stream is resampled, in which case start_audio_stream_out() is to be
+ *   used. Otherwise, a negative value.
+ ****************************************************************************/
+int get_audio_stream_out_buffer(void **buffer, unsigned int *frames);
+
+/****************************************************************************
+ * Name: commit_audio_stream_out_buffer
+ *
+ * Description:
+ *   Queue the frames written in the space given by get_audio_stream_out_buffer()
+ *   to the output card. If the output audio device have been paused, resume it.
+ *
+ * Return Value:
+ *   On success, the number of frames committed. Otherwise, a negative value.
+ ****************************************************************************/
+int commit_audio_stream_out_buffer(unsigned int frames);
+#endif
+
+#ifdef CONFIG_MEDIA_PROFILE
+/****************************************************************************
+ * Name: get_audio_stream_in_profile
+ *
+ * Description:
+ *   Get the counters of the active input card. They are never reset: users
+ *   take the difference between two calls.
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+audio_manager_result_t get_audio_stream_in_profile(audio_stream_profile_t *profile);
+
+/****************************************************************************
+ * Name: get_audio_stream_out_profile
+ *
+ * Description:
+ *   Get the counters of the active output card, as get_audio_stream_in_profile().
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+audio_manager_result_t get_audio_stream_out_profile(audio_stream_profile_t *profile);
+#endif
+
 /****************************************************************************
  * Name: pause_audio_stream_in
  *
@@ -898,6 +1019,130 @@ audio_manager_result_t set_audio_stream_mute_from_json(stream_policy_t stream_po
  ****************************************************************************/
 audio_manager_result_t get_audio_stream_mute_state(stream_policy_t stream_policy, bool *mute);
 
+#ifdef CONFIG_AUDIO_MIXER
+/****************************************************************************
+ * Name: set_mixer_stream_out
+ *
+ * Description:
+ *   Add an output stream to the software mixer, or set it again if the
+ *   stream is already there. The mixer opens the active output card with a
+ *   fixed configuration when its first stream is added, and each stream is
+ *   rechanneled and resampled to that configuration, so several streams can
+ *   play at once without reopening the card.
+ *
+ * Input parameters:
+ *   channels: number of channels
+ *   sample_rate: sample rate with which the stream is operated
+ *   format: audio file format to be streamed out, only PCM_FORMAT_S16_LE
+ *   stream_id: stream info id of the stream
+ *   policy: policy of the stream, which decides the ducking
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+audio_manager_result_t set_mixer_stream_out(unsigned int channels, unsigned int sample_rate, int format, stream_info_id_t stream_id, stream_policy_t policy);
+
+/****************************************************************************
+ * Name: start_mixer_stream_out
+ *
+ * Description:
+ *   Queue the specified frame data of a stream to the mixer. A paused or
+ *   stopped stream is started again. It blocks until all frames are queued.
+ *
+ * Input parameters:
+ *   stream_id: stream info id of the stream
+ *   data: buffer to transfer the frame data
+ *   frames: number of frames to be written
+ *
+ * Return Value:
+ *   On success, the number of frames written. Otherwise, a negative value.
+ ****************************************************************************/
+int start_mixer_stream_out(stream_info_id_t stream_id, void *data, unsigned int frames);
+
+/****************************************************************************
+ * Name: pause_mixer_stream_out
+ *
+ * Description:
+ *   Stop mixing a stream, keeping the frames it queued. The other streams
+ *   go on playing.
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+audio_manager_result_t pause_mixer_stream_out(stream_info_id_t stream_id);
+
+/****************************************************************************
+ * Name: stop_mixer_stream_out
+ *
+ * Description:
+ *   Stop mixing a stream. If drain is true, it returns once the frames
+ *   queued by the stream are mixed, otherwise they are dropped.
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+audio_manager_result_t stop_mixer_stream_out(stream_info_id_t stream_id, bool drain);
+
+/****************************************************************************
+ * Name: reset_mixer_stream_out
+ *
+ * Description:
+ *   Remove a stream from the mixer. The output card is closed with the last
+ *   stream.
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+audio_manager_result_t reset_mixer_stream_out(stream_info_id_t stream_id);
+
+/****************************************************************************
+ * Name: set_mixer_stream_gain
+ *
+ * Description:
+ *   Set the gain applied to a stream before it is mixed, in Q15 where
+ *   AUDIO_MIXER_GAIN_UNITY leaves the samples unchanged. Ducking lowers it
+ *   further while a stream of higher policy is playing.
+ *
+ * Return Value:
+ *   On success, AUDIO_MANAGER_SUCCESS. Otherwise, a negative value.
+ ****************************************************************************/
+#define AUDIO_MIXER_GAIN_UNITY 0x7FFF
+audio_manager_result_t set_mixer_stream_gain(stream_info_id_t stream_id, uint16_t gain);
+
+/****************************************************************************
+ * Name: get_mixer_stream_out_buffer_size
+ *
+ * Description:
+ *   Get the size in bytes of the user format data to write at a time, which
+ *   is one period of the mixer.
+ *
+ * Return Value:
+ *   On success, the size in bytes. Otherwise, 0.
+ ****************************************************************************/
+unsigned int get_mixer_stream_out_buffer_size(stream_info_id_t stream_id);
+
+/****************************************************************************
+ * Name: get_mixer_stream_out_space
+ *
+ * Description:
+ *   Get the size in bytes of the user format data which can be written to a
+ *   stream without blocking.
+ *
+ * Return Value:
+ *   The size in bytes, 0 if the stream is not in the mixer.
+ ****************************************************************************/
+unsigned int get_mixer_stream_out_space(stream_info_id_t stream_id);
+
+/****************************************************************************
+ * Name: wait_mixer_stream_out
+ *
+ * Description:
+ *   Wait until the mixer takes frames from the streams, or for a period of
+ *   the mixer at most.
+ ****************************************************************************/
+void wait_mixer_stream_out(void);
+#endif
+
 #ifdef CONFIG_DEBUG_MEDIA_INFO
 /****************************************************************************
  * Name: dump_audio_card_info
@@ -0,0 +1,879 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <debug.h>
+#include <tinyalsa/tinyalsa.h>
+
+#include "audio_manager.h"
+#include "resample/speex_resampler.h"
+#include "../utils/remix.h"
+#include "../utils/rb.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#ifndef CONFIG_AUDIO_MIXER_SAMPLE_RATE
+#define CONFIG_AUDIO_MIXER_SAMPLE_RATE 48000
+#endif
+
+#ifndef CONFIG_AUDIO_MIXER_CHANNELS
+#define CONFIG_AUDIO_MIXER_CHANNELS 2
+#endif
+
+#ifndef CONFIG_AUDIO_MIXER_PERIOD_FRAMES
+#define CONFIG_AUDIO_MIXER_PERIOD_FRAMES 256
+#endif
+
+#ifndef CONFIG_AUDIO_MIXER_PERIOD_COUNT
+#define CONFIG_AUDIO_MIXER_PERIOD_COUNT 2
+#endif
+
+#ifndef CONFIG_AUDIO_MIXER_STREAM_PERIODS
+#define CONFIG_AUDIO_MIXER_STREAM_PERIODS 4
+#endif
+
+#ifndef CONFIG_AUDIO_MIXER_MAX_STREAMS
+#define CONFIG_AUDIO_MIXER_MAX_STREAMS 4
+#endif
+
+#ifndef CONFIG_AUDIO_MIXER_DUCK_GAIN
+#define CONFIG_AUDIO_MIXER_DUCK_GAIN 30
+#endif
+
+#ifndef CONFIG_AUDIO_MIXER_STACKSIZE
+#define CONFIG_AUDIO_MIXER_STACKSIZE 2048
+#endif
+
+#ifndef CONFIG_AUDIO_MIXER_THREAD_PRIORITY
+#define CONFIG_AUDIO_MIXER_THREAD_PRIORITY 200
+#endif
+
+#define MIXER_FRAME_BYTES (CONFIG_AUDIO_MIXER_CHANNELS * sizeof(int16_t))
+#define MIXER_PERIOD_BYTES (CONFIG_AUDIO_MIXER_PERIOD_FRAMES * MIXER_FRAME_BYTES)
+#define MIXER_DUCK_GAIN(gain) ((int32_t)(gain) * CONFIG_AUDIO_MIXER_DUCK_GAIN / 100)
+#define MIXER_RETRY_COUNT 2
+
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+#define AUDIO_PCM_MMAP PCM_MMAP
+#define MIXER_PCM_WRITE(pcm, data, frames) pcm_mmap_write(pcm, data, pcm_frames_to_bytes(pcm, frames))
+#else
+#define AUDIO_PCM_MMAP 0
+#define MIXER_PCM_WRITE(pcm, data, frames) pcm_writei(pcm, data, frames)
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+enum mixer_stream_state_e {
+	MIXER_STREAM_READY = 0,
+	MIXER_STREAM_RUNNING,
+	MIXER_STREAM_PAUSED,
+	MIXER_STREAM_DRAINING
+};
+
+struct mixer_stream_s {
+	bool used;
+	stream_info_id_t id;
+	stream_policy_t policy;
+	enum mixer_stream_state_e state;
+	uint32_t channels;			// channels from a user
+	uint32_t sample_rate;			// sample rate from a user
+	uint32_t user_frames;			// frames from a user per period of the mixer
+	int16_t *rechannel_buffer;		// user_frames in the channels of the mixer
+	int16_t *resample_buffer;		// resampled frames before they are queued
+	uint32_t resample_frames;		// size of resample_buffer in frames
+	SpeexResamplerState *resampler;
+	rb_t ring;				// frames queued to the mixer, in its format
+	int32_t gain;				// gain set by a user, Q15
+	int32_t cur_gain;			// gain applied in the last period, Q15
+	bool active;				// mixed in the current period
+};
+
+struct audio_mixer_s {
+	struct mixer_stream_s streams[CONFIG_AUDIO_MIXER_MAX_STREAMS];
+	int nstreams;
+	struct pcm *pcm;
+	pthread_t thread;
+	bool running;
+	bool error;
+	int16_t *mix_buffer;
+	int16_t *src_buffer;
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+	bool in_place;				// periods are mixed in the buffers of the card
+	unsigned int mmap_offset;
+#endif
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static struct audio_mixer_s g_mixer;
+static pthread_mutex_t g_mixer_lock = PTHREAD_MUTEX_INITIALIZER;
+/* Signalled when the mixer takes frames from the streams and when a stream
+ * queues frames or changes its state.
+ */
+static pthread_cond_t g_mixer_cond = PTHREAD_COND_INITIALIZER;
+
+/****************************************************************************
+ * Mix kernels
+ ****************************************************************************/
+static inline int16_t mixer_sat16(int32_t value)
+{
+	if (value > INT16_MAX) {
+		return INT16_MAX;
+	}
+	if (value < INT16_MIN) {
+		return INT16_MIN;
+	}
+	return (int16_t)value;
+}
+
+/* dst += src * gain with saturation, rounding as vqrdmulh does */
+static void mixer_mix_scalar(int16_t *dst, const int16_t *src, uint32_t samples, int32_t gain)
+{
+	uint32_t i;
+
+	if (gain == AUDIO_MIXER_GAIN_UNITY) {
+		for (i = 0; i < samples; i++) {
+			dst[i] = mixer_sat16((int32_t)dst[i] + src[i]);
+		}
+		return;
+	}
+
+	for (i = 0; i < samples; i++) {
+		dst[i] = mixer_sat16((int32_t)dst[i] + (((int32_t)src[i] * gain + (1 << 14)) >> 15));
+	}
+}
+
+static void mixer_mix(int16_t *dst, const int16_t *src, uint32_t samples, int32_t gain)
+{
+	uint32_t i = 0;
+
+	if (gain == 0) {
+		return;
+	}
+
+#if defined(__ARM_NEON)
+	if (gain == AUDIO_MIXER_GAIN_UNITY) {
+		for (; i + 8 <= samples; i += 8) {
+			vst1q_s16(dst + i, vqaddq_s16(vld1q_s16(dst + i), vld1q_s16(src + i)));
+		}
+	} else {
+		int16x8_t vgain = vdupq_n_s16((int16_t)gain);
+		for (; i + 8 <= samples; i += 8) {
+			vst1q_s16(dst + i, vqaddq_s16(vld1q_s16(dst + i), vqrdmulhq_s16(vld1q_s16(src + i), vgain)));
+		}
+	}
+#elif defined(__ARM_FEATURE_SIMD32)
+	/* Only the unity gain has a packed kernel, the scaled samples are not
+	 * cheaper with SMULxB than in the scalar loop.
+	 */
+	if (gain == AUDIO_MIXER_GAIN_UNITY) {
+		int16x2_t d;
+		int16x2_t s;
+		for (; i + 2 <= samples; i += 2) {
+			memcpy(&d, dst + i, sizeof(d));
+			memcpy(&s, src + i, sizeof(s));
+			d = __qadd16(d, s);
+			memcpy(dst + i, &d, sizeof(d));
+		}
+	}
+#endif
+
+	mixer_mix_scalar(dst + i, src + i, samples - i, gain);
+}
+
+/* Mix with the gain going from 'from' to 'to' over the frames, so that a
+ * change of gain or ducking does not click.
+ */
+static void mixer_mix_ramp(int16_t *dst, const int16_t *src, uint32_t frames, int32_t from, int32_t to)
+{
+	uint32_t f;
+	uint32_t c;
+	int32_t gain;
+
+	for (f = 0; f < frames; f++) {
+		gain = from + (to - from) * (int32_t)(f + 1) / (int32_t)frames;
+		for (c = 0; c < CONFIG_AUDIO_MIXER_CHANNELS; c++) {
+			*dst = mixer_sat16((int32_t)*dst + (((int32_t)*src * gain + (1 << 14)) >> 15));
+			dst++;
+			src++;
+		}
+	}
+}
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static struct mixer_stream_s *mixer_find_stream(stream_info_id_t stream_id)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_AUDIO_MIXER_MAX_STREAMS; i++) {
+		if (g_mixer.streams[i].used && g_mixer.streams[i].id == stream_id) {
+			return &g_mixer.streams[i];
+		}
+	}
+	return NULL;
+}
+
+static void mixer_free_stream(struct mixer_stream_s *stream)
+{
+	if (stream->resampler) {
+		speex_resampler_destroy(stream->resampler);
+		stream->resampler = NULL;
+	}
+	free(stream->rechannel_buffer);
+	stream->rechannel_buffer = NULL;
+	free(stream->resample_buffer);
+	stream->resample_buffer = NULL;
+	rb_free(&stream->ring);
+	stream->used = false;
+}
+
+/* A stream is mixed once it queued a period, or with what is left when it drains */
+static bool mixer_stream_ready(struct mixer_stream_s *stream)
+{
+	if (stream->state == MIXER_STREAM_RUNNING) {
+		return rb_used(&stream->ring) >= MIXER_PERIOD_BYTES;
+	}
+	if (stream->state == MIXER_STREAM_DRAINING) {
+		return rb_used(&stream->ring) > 0;
+	}
+	return false;
+}
+
+/* Streams are ducked while a stream of higher policy is mixed with them */
+static int32_t mixer_target_gain(struct mixer_stream_s *stream)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_AUDIO_MIXER_MAX_STREAMS; i++) {
+		if (g_mixer.streams[i].active && g_mixer.streams[i].policy > stream->policy) {
+			return MIXER_DUCK_GAIN(stream->gain);
+		}
+	}
+	return stream->gain;
+}
+
+static int mixer_write_period(const void *data, unsigned int frames)
+{
+	int retry = MIXER_RETRY_COUNT;
+	int ret;
+
+	/* The card underruns whenever the mixer idles, so EPIPE is expected
+	 * after a pause of all streams.
+	 */
+	while ((ret = MIXER_PCM_WRITE(g_mixer.pcm, data, frames)) < 0) {
+		if (ret != -EPIPE || retry-- == 0) {
+			meddbg("pcm write failed, ret = %d\n", ret);
+			return ret;
+		}
+		ret = pcm_prepare(g_mixer.pcm);
+		if (ret != OK) {
+			meddbg("Fail to pcm_prepare(), ret = %d\n", ret);
+			return ret;
+		}
+	}
+	return ret;
+}
+
+/* Marks the streams to mix in this period, returns whether there is any */
+static bool mixer_find_active(void)
+{
+	struct mixer_stream_s *stream;
+	bool any = false;
+	int i;
+
+	for (i = 0; i < CONFIG_AUDIO_MIXER_MAX_STREAMS; i++) {
+		stream = &g_mixer.streams[i];
+		stream->active = stream->used && mixer_stream_ready(stream);
+		any |= stream->active;
+	}
+	return any;
+}
+
+/* Mixes a period of the active streams into out, returns the frames mixed */
+static uint32_t mixer_mix_period(int16_t *out)
+{
+	struct mixer_stream_s *stream;
+	uint32_t frames;
+	uint32_t mixed = 0;
+	int32_t target;
+	int i;
+
+	memset(out, 0, MIXER_PERIOD_BYTES);
+	for (i = 0; i < CONFIG_AUDIO_MIXER_MAX_STREAMS; i++) {
+		stream = &g_mixer.streams[i];
+		if (!stream->active) {
+			continue;
+		}
+		frames = rb_read(&stream->ring, g_mixer.src_buffer, MIXER_PERIOD_BYTES) / MIXER_FRAME_BYTES;
+		target = mixer_target_gain(stream);
+		if (target != stream->cur_gain) {
+			mixer_mix_ramp(out, g_mixer.src_buffer, frames, stream->cur_gain, target);
+			stream->cur_gain = target;
+		} else {
+			mixer_mix(out, g_mixer.src_buffer, frames * CONFIG_AUDIO_MIXER_CHANNELS, target);
+		}
+		if (stream->state == MIXER_STREAM_DRAINING && rb_used(&stream->ring) == 0) {
+			stream->state = MIXER_STREAM_READY;
+		}
+		if (frames > mixed) {
+			mixed = frames;
+		}
+	}
+	return mixed;
+}
+
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+/* Waits for a buffer of the card to mix the next period into */
+static int mixer_begin_period(int16_t **out)
+{
+	int retry = MIXER_RETRY_COUNT;
+	unsigned int frames;
+	void *area;
+	int ret;
+
+	while (true) {
+		frames = CONFIG_AUDIO_MIXER_PERIOD_FRAMES;
+		ret = pcm_mmap_begin(g_mixer.pcm, &area, &g_mixer.mmap_offset, &frames);
+		if (ret < 0) {
+			meddbg("pcm_mmap_begin failed, ret = %d\n", ret);
+			return ret;
+		}
+		if (frames > 0) {
+			*out = (int16_t *)area + g_mixer.mmap_offset * CONFIG_AUDIO_MIXER_CHANNELS;
+			return OK;
+		}
+		ret = pcm_wait(g_mixer.pcm, -1);
+		if (ret == -EPIPE) {
+			/* The card stopped when the mixer idled, take its buffers back
+			 * and start it again with the next commit.
+			 */
+			if (retry-- == 0) {
+				meddbg("Fail to recover from xrun\n");
+				return ret;
+			}
+			pcm_drop(g_mixer.pcm);
+		} else if (ret < 0) {
+			meddbg("pcm_wait failed, ret = %d\n", ret);
+			return ret;
+		}
+	}
+}
+
+static int mixer_commit_period(void)
+{
+	int ret;
+
+	ret = pcm_mmap_commit(g_mixer.pcm, g_mixer.mmap_offset, CONFIG_AUDIO_MIXER_PERIOD_FRAMES);
+	if (ret < 0) {
+		meddbg("pcm_mmap_commit failed, ret = %d\n", ret);
+		return ret;
+	}
+	return pcm_start(g_mixer.pcm);
+}
+#endif
+
+static void *mixer_thread(void *arg)
+{
+	int16_t *out;
+	uint32_t mixed;
+	int ret;
+
+	pthread_mutex_lock(&g_mixer_lock);
+	while (g_mixer.running) {
+		if (!mixer_find_active()) {
+			pthread_cond_wait(&g_mixer_cond, &g_mixer_lock);
+			continue;
+		}
+
+		out = g_mixer.mix_buffer;
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+		if (g_mixer.in_place) {
+			/* Mix straight into the buffer of the card. Its buffers are
+			 * waited for without the lock, so streams keep queueing.
+			 */
+			pthread_mutex_unlock(&g_mixer_lock);
+			ret = mixer_begin_period(&out);
+			pthread_mutex_lock(&g_mixer_lock);
+			if (ret < 0) {
+				g_mixer.error = true;
+				pthread_cond_broadcast(&g_mixer_cond);
+				break;
+			}
+			/* The buffer is left to the next period if the streams went away */
+			if (!g_mixer.running || !mixer_find_active()) {
+				continue;
+			}
+		}
+#endif
+		mixed = mixer_mix_period(out);
+		pthread_cond_broadcast(&g_mixer_cond);
+		pthread_mutex_unlock(&g_mixer_lock);
+
+		/* A draining stream may leave a short period, the rest is silence */
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+		if (g_mixer.in_place) {
+			ret = mixer_commit_period();
+		} else
+#endif
+		{
+			ret = mixer_write_period(out, CONFIG_AUDIO_MIXER_PERIOD_FRAMES);
+		}
+		if (ret < 0) {
+			pthread_mutex_lock(&g_mixer_lock);
+			g_mixer.error = true;
+			pthread_cond_broadcast(&g_mixer_cond);
+			break;
+		}
+		medvdbg("mixed %u frames\n", mixed);
+
+		pthread_mutex_lock(&g_mixer_lock);
+	}
+	pthread_mutex_unlock(&g_mixer_lock);
+
+	return NULL;
+}
+
+static audio_manager_result_t mixer_open(void)
+{
+	struct pcm_config config;
+	pthread_attr_t attr;
+	struct sched_param sparam;
+	int card_id;
+	int device_id;
+	int ret;
+
+	if (get_stream_out_id(&card_id, &device_id) != AUDIO_MANAGER_SUCCESS) {
+		return AUDIO_MANAGER_NO_AVAIL_CARD;
+	}
+
+	memset(&config, 0, sizeof(struct pcm_config));
+	config.channels = CONFIG_AUDIO_MIXER_CHANNELS;
+	config.rate = CONFIG_AUDIO_MIXER_SAMPLE_RATE;
+	config.format = PCM_FORMAT_S16_LE;
+	config.period_size = CONFIG_AUDIO_MIXER_PERIOD_FRAMES;
+	config.period_count = CONFIG_AUDIO_MIXER_PERIOD_COUNT;
+
+	g_mixer.pcm = pcm_open(card_id, device_id, PCM_OUT | AUDIO_PCM_MMAP, &config);
+	if (!pcm_is_ready(g_mixer.pcm)) {
+		meddbg("fail to pcm_is_ready() error : %s", pcm_get_error(g_mixer.pcm));
+		pcm_close(g_mixer.pcm);
+		g_mixer.pcm = NULL;
+		return AUDIO_MANAGER_CARD_NOT_READY;
+	}
+#ifdef CONFIG_AUDIO_STREAM_MMAP
+	/* A driver may keep buffers shorter than a period, those are copied */
+	g_mixer.in_place = pcm_bytes_to_frames(g_mixer.pcm, pcm_get_buffer_size(g_mixer.pcm)) >= CONFIG_AUDIO_MIXER_PERIOD_FRAMES;
+#endif
+
+	g_mixer.mix_buffer = (int16_t *)malloc(MIXER_PERIOD_BYTES);
+	g_mixer.src_buffer = (int16_t *)malloc(MIXER_PERIOD_BYTES);
+	if (!g_mixer.mix_buffer || !g_mixer.src_buffer) {
+		meddbg("malloc for mixer buffers failed\n");
+		goto error_with_pcm;
+	}
+
+	g_mixer.running = true;
+	g_mixer.error = false;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, CONFIG_AUDIO_MIXER_STACKSIZE);
+	sparam.sched_priority = CONFIG_AUDIO_MIXER_THREAD_PRIORITY;
+	pthread_attr_setschedparam(&attr, &sparam);
+	ret = pthread_create(&g_mixer.thread, &attr, mixer_thread, NULL);
+	if (ret != OK) {
+		meddbg("Fail to create mixer thread, ret = %d\n", ret);
+		g_mixer.running = false;
+		goto error_with_pcm;
+	}
+	pthread_setname_np(g_mixer.thread, "AudioMixer");
+
+	return AUDIO_MANAGER_SUCCESS;
+
+error_with_pcm:
+	free(g_mixer.mix_buffer);
+	g_mixer.mix_buffer = NULL;
+	free(g_mixer.src_buffer);
+	g_mixer.src_buffer = NULL;
+	pcm_close(g_mixer.pcm);
+	g_mixer.pcm = NULL;
+	return AUDIO_MANAGER_OPERATION_FAIL;
+}
+
+/* Called with g_mixer_lock held, which is released while the thread exits */
+static void mixer_close(void)
+{
+	g_mixer.running = false;
+	pthread_cond_broadcast(&g_mixer_cond);
+	pthread_mutex_unlock(&g_mixer_lock);
+	pthread_join(g_mixer.thread, NULL);
+	pthread_mutex_lock(&g_mixer_lock);
+
+	pcm_close(g_mixer.pcm);
+	g_mixer.pcm = NULL;
+	free(g_mixer.mix_buffer);
+	g_mixer.mix_buffer = NULL;
+	free(g_mixer.src_buffer);
+	g_mixer.src_buffer = NULL;
+}
+
+/* Called with g_mixer_lock held. Blocks while the ring of the stream is full. */
+static int mixer_queue(struct mixer_stream_s *stream, const void *data, size_t bytes)
+{
+	size_t written;
+
+	while (bytes > 0) {
+		while (rb_avail(&stream->ring) == 0 && !g_mixer.error) {
+			pthread_cond_wait(&g_mixer_cond, &g_mixer_lock);
+		}
+		if (g_mixer.error) {
+			return AUDIO_MANAGER_DEVICE_FAIL;
+		}
+		written = rb_write(&stream->ring, data, bytes);
+		data = (const char *)data + written;
+		bytes -= written;
+		pthread_cond_broadcast(&g_mixer_cond);
+	}
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+/* Called with g_mixer_lock held, for at most user_frames frames */
+static int mixer_convert_and_queue(struct mixer_stream_s *stream, const int16_t *data, uint32_t frames)
+{
+	const spx_int16_t *in = data;
+	spx_uint32_t in_frames;
+	spx_uint32_t out_frames;
+	uint32_t used = 0;
+	int ret;
+
+	if (stream->channels != CONFIG_AUDIO_MIXER_CHANNELS) {
+		if ((uint32_t)rechannel(ch2layout(stream->channels), ch2layout(CONFIG_AUDIO_MIXER_CHANNELS), data, frames,
+								stream->rechannel_buffer, stream->user_frames) != frames) {
+			meddbg("Fail to rechannel %u frames\n", frames);
+			return AUDIO_MANAGER_RESAMPLE_FAIL;
+		}
+		in = stream->rechannel_buffer;
+	}
+
+	if (!stream->resampler) {
+		return mixer_queue(stream, in, frames * MIXER_FRAME_BYTES);
+	}
+
+	while (used < frames) {
+		in_frames = frames - used;
+		out_frames = stream->resample_frames;
+		ret = speex_resampler_process_interleaved_int(stream->resampler, in + used * CONFIG_AUDIO_MIXER_CHANNELS, &in_frames,
+													  stream->resample_buffer, &out_frames);
+		if (ret != RESAMPLER_ERR_SUCCESS) {
+			meddbg("Fail to resample in:%u/%u, error %d\n", used, frames, ret);
+			return AUDIO_MANAGER_RESAMPLE_FAIL;
+		}
+		used += in_frames;
+		ret = mixer_queue(stream, stream->resample_buffer, out_frames * MIXER_FRAME_BYTES);
+		if (ret != AUDIO_MANAGER_SUCCESS) {
+			return ret;
+		}
+	}
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+audio_manager_result_t set_mixer_stream_out(unsigned int channels, unsigned int sample_rate, int format, stream_info_id_t stream_id, stream_policy_t policy)
+{
+	struct mixer_stream_s *stream;
+	audio_manager_result_t ret;
+	int err_code = 0;
+	int i;
+
+	if (channels == 0 || sample_rate == 0 || format != PCM_FORMAT_S16_LE) {
+		meddbg("unsupported stream channels %u rate %u format %d\n", channels, sample_rate, format);
+		return AUDIO_MANAGER_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&g_mixer_lock);
+
+	stream = mixer_find_stream(stream_id);
+	if (stream) {
+		mixer_free_stream(stream);
+		g_mixer.nstreams--;
+	} else {
+		for (i = 0; i < CONFIG_AUDIO_MIXER_MAX_STREAMS; i++) {
+			if (!g_mixer.streams[i].used) {
+				stream = &g_mixer.streams[i];
+				break;
+			}
+		}
+		if (!stream) {
+			meddbg("mixer is full, %d streams\n", g_mixer.nstreams);
+			pthread_mutex_unlock(&g_mixer_lock);
+			return AUDIO_MANAGER_DEVICE_ALREADY_IN_USE;
+		}
+	}
+
+	if (g_mixer.nstreams == 0 && !g_mixer.pcm) {
+		ret = mixer_open();
+		if (ret != AUDIO_MANAGER_SUCCESS) {
+			pthread_mutex_unlock(&g_mixer_lock);
+			return ret;
+		}
+	}
+
+	memset(stream, 0, sizeof(struct mixer_stream_s));
+	stream->id = stream_id;
+	stream->policy = policy;
+	stream->state = MIXER_STREAM_READY;
+	stream->channels = channels;
+	stream->sample_rate = sample_rate;
+	stream->gain = AUDIO_MIXER_GAIN_UNITY;
+	stream->cur_gain = AUDIO_MIXER_GAIN_UNITY;
+	stream->user_frames = (uint64_t)CONFIG_AUDIO_MIXER_PERIOD_FRAMES * sample_rate / CONFIG_AUDIO_MIXER_SAMPLE_RATE;
+	if (stream->user_frames == 0) {
+		stream->user_frames = 1;
+	}
+
+	ret = AUDIO_MANAGER_OPERATION_FAIL;
+	if (!rb_init(&stream->ring, MIXER_PERIOD_BYTES * CONFIG_AUDIO_MIXER_STREAM_PERIODS)) {
+		meddbg("malloc for a mixer ring failed\n");
+		goto error_with_lock;
+	}
+
+	if (channels != CONFIG_AUDIO_MIXER_CHANNELS) {
+		stream->rechannel_buffer = (int16_t *)malloc(stream->user_frames * MIXER_FRAME_BYTES);
+		if (!stream->rechannel_buffer) {
+			meddbg("malloc for a rechannel buffer failed\n");
+			goto error_with_stream;
+		}
+	}
+
+	if (sample_rate != CONFIG_AUDIO_MIXER_SAMPLE_RATE) {
+		stream->resampler = speex_resampler_init(CONFIG_AUDIO_MIXER_CHANNELS, sample_rate, CONFIG_AUDIO_MIXER_SAMPLE_RATE, SPEEX_RESAMPLER_QUALITY_DEFAULT, &err_code);
+		if (!stream->resampler) {
+			meddbg("Failed to create resampler. errno: %d\n", err_code);
+			ret = AUDIO_MANAGER_RESAMPLE_FAIL;
+			goto error_with_stream;
+		}
+		stream->resample_frames = CONFIG_AUDIO_MIXER_PERIOD_FRAMES;
+		stream->resample_buffer = (int16_t *)malloc(stream->resample_frames * MIXER_FRAME_BYTES);
+		if (!stream->resample_buffer) {
+			meddbg("malloc for a resampling buffer failed\n");
+			ret = AUDIO_MANAGER_RESAMPLE_FAIL;
+			goto error_with_stream;
+		}
+	}
+
+	stream->used = true;
+	g_mixer.nstreams++;
+	medvdbg("mixer stream %d added, channels %u rate %u policy %d\n", stream_id, channels, sample_rate, policy);
+	pthread_mutex_unlock(&g_mixer_lock);
+	return AUDIO_MANAGER_SUCCESS;
+
+error_with_stream:
+	mixer_free_stream(stream);
+error_with_lock:
+	if (g_mixer.nstreams == 0) {
+		mixer_close();
+	}
+	pthread_mutex_unlock(&g_mixer_lock);
+	return ret;
+}
+
+int start_mixer_stream_out(stream_info_id_t stream_id, void *data, unsigned int frames)
+{
+	struct mixer_stream_s *stream;
+	const int16_t *in = (const int16_t *)data;
+	unsigned int left = frames;
+	unsigned int chunk;
+	int ret = AUDIO_MANAGER_SUCCESS;
+
+	pthread_mutex_lock(&g_mixer_lock);
+	stream = mixer_find_stream(stream_id);
+	if (!stream) {
+		pthread_mutex_unlock(&g_mixer_lock);
+		return AUDIO_MANAGER_INVALID_PARAM;
+	}
+
+	stream->state = MIXER_STREAM_RUNNING;
+	while (left > 0) {
+		chunk = left < stream->user_frames ? left : stream->user_frames;
+		ret = mixer_convert_and_queue(stream, in, chunk);
+		if (ret != AUDIO_MANAGER_SUCCESS) {
+			break;
+		}
+		in += chunk * stream->channels;
+		left -= chunk;
+	}
+	pthread_mutex_unlock(&g_mixer_lock);
+
+	return ret == AUDIO_MANAGER_SUCCESS ? (int)frames : ret;
+}
+
+audio_manager_result_t pause_mixer_stream_out(stream_info_id_t stream_id)
+{
+	struct mixer_stream_s *stream;
+
+	pthread_mutex_lock(&g_mixer_lock);
+	stream = mixer_find_stream(stream_id);
+	if (!stream) {
+		pthread_mutex_unlock(&g_mixer_lock);
+		return AUDIO_MANAGER_INVALID_PARAM;
+	}
+	stream->state = MIXER_STREAM_PAUSED;
+	pthread_mutex_unlock(&g_mixer_lock);
+
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+audio_manager_result_t stop_mixer_stream_out(stream_info_id_t stream_id, bool drain)
+{
+	struct mixer_stream_s *stream;
+	audio_manager_result_t ret = AUDIO_MANAGER_SUCCESS;
+
+	pthread_mutex_lock(&g_mixer_lock);
+	stream = mixer_find_stream(stream_id);
+	if (!stream) {
+		pthread_mutex_unlock(&g_mixer_lock);
+		return AUDIO_MANAGER_INVALID_PARAM;
+	}
+
+	if (drain && rb_used(&stream->ring) > 0) {
+		stream->state = MIXER_STREAM_DRAINING;
+		pthread_cond_broadcast(&g_mixer_cond);
+		while (stream->state == MIXER_STREAM_DRAINING && !g_mixer.error) {
+			pthread_cond_wait(&g_mixer_cond, &g_mixer_lock);
+		}
+		if (g_mixer.error) {
+			ret = AUDIO_MANAGER_DEVICE_FAIL;
+		}
+	}
+
+	rb_reset(&stream->ring);
+	if (stream->resampler) {
+		speex_resampler_reset_mem(stream->resampler);
+	}
+	stream->state = MIXER_STREAM_READY;
+	pthread_mutex_unlock(&g_mixer_lock);
+
+	return ret;
+}
+
+audio_manager_result_t reset_mixer_stream_out(stream_info_id_t stream_id)
+{
+	struct mixer_stream_s *stream;
+
+	pthread_mutex_lock(&g_mixer_lock);
+	stream = mixer_find_stream(stream_id);
+	if (!stream) {
+		medvdbg("mixer stream %d already got reset\n", stream_id);
+		pthread_mutex_unlock(&g_mixer_lock);
+		return AUDIO_MANAGER_SUCCESS;
+	}
+
+	mixer_free_stream(stream);
+	if (--g_mixer.nstreams == 0) {
+		mixer_close();
+	}
+	pthread_mutex_unlock(&g_mixer_lock);
+
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+audio_manager_result_t set_mixer_stream_gain(stream_info_id_t stream_id, uint16_t gain)
+{
+	struct mixer_stream_s *stream;
+
+	pthread_mutex_lock(&g_mixer_lock);
+	stream = mixer_find_stream(stream_id);
+	if (!stream) {
+		pthread_mutex_unlock(&g_mixer_lock);
+		return AUDIO_MANAGER_INVALID_PARAM;
+	}
+	stream->gain = gain > AUDIO_MIXER_GAIN_UNITY ? AUDIO_MIXER_GAIN_UNITY : gain;
+	pthread_mutex_unlock(&g_mixer_lock);
+
+	return AUDIO_MANAGER_SUCCESS;
+}
+
+unsigned int get_mixer_stream_out_buffer_size(stream_info_id_t stream_id)
+{
+	struct mixer_stream_s *stream;
+	unsigned int size = 0;
+
+	pthread_mutex_lock(&g_mixer_lock);
+	stream = mixer_find_stream(stream_id);
+	if (stream) {
+		size = stream->user_frames * stream->channels * sizeof(int16_t);
+	}
+	pthread_mutex_unlock(&g_mixer_lock);
+
+	return size;
+}
+
+unsigned int get_mixer_stream_out_space(stream_info_id_t stream_id)
+{
+	struct mixer_stream_s *stream;
+	uint64_t frames;
+	unsigned int size = 0;
+
+	pthread_mutex_lock(&g_mixer_lock);
+	stream = mixer_find_stream(stream_id);
+	if (stream) {
+		/* Keep a frame for the rounding of the resampler */
+		frames = (uint64_t)(rb_avail(&stream->ring) / MIXER_FRAME_BYTES) * stream->sample_rate / CONFIG_AUDIO_MIXER_SAMPLE_RATE;
+		if (frames > 1) {
+			size = (frames - 1) * stream->channels * sizeof(int16_t);
+		}
+	}
+	pthread_mutex_unlock(&g_mixer_lock);
+
+	return size;
+}
+
+void wait_mixer_stream_out(void)
+{
+	struct timespec abstime;
+	unsigned int usec = (uint64_t)CONFIG_AUDIO_MIXER_PERIOD_FRAMES * 1000000 / CONFIG_AUDIO_MIXER_SAMPLE_RATE;
+
+	clock_gettime(CLOCK_REALTIME, &abstime);
+	abstime.tv_sec += usec / 1000000;
+	abstime.tv_nsec += (usec % 1000000) * 1000;
+	if (abstime.tv_nsec >= 1000000000) {
+		abstime.tv_sec++;
+		abstime.tv_nsec -= 1000000000;
+	}
+
+	pthread_mutex_lock(&g_mixer_lock);
+	pthread_cond_timedwait(&g_mixer_cond, &g_mixer_lock, &abstime);
+	pthread_mutex_unlock(&g_mixer_lock);
+}
@@ -143,6 +143,7 @@ typedef struct pcm_data_s *pcm_data_p;
 struct priv_data_s {
 	ssize_t mCurrentPos;        /* read position when decoding */
 	uint32_t mFixedHeader;      /* mp3 frame header */
+	void *mInputBuffer;         /* input buffer given by user, for frames wrapping around the ring-buffer */
 	pcm_data_t pcm;             /* a recorder of pcm data info */
 };
 
@@ -257,6 +258,15 @@ static ssize_t _source_read_at(rbstream_p fp, ssize_t offset, void *data, size_t
 	return rbs_read(data, 1, size, fp);
 }
 
+// Get a frame in place, it's only copied to data when wrapping around the ring-buffer.
+static void *_source_peek_at(rbstream_p fp, ssize_t offset, void *data, size_t size)
+{
+	int retVal = rbs_seek(fp, offset, SEEK_SET);
+	RETURN_VAL_IF_FAIL((retVal == OK), NULL);
+
+	return (void *)rbs_peek(data, size, fp);
+}
+
 #ifdef CONFIG_CODEC_MP3
 // Resync to next valid MP3 frame in the file.
 static bool mp3_resync(rbstream_p fp, uint32_t match_header, ssize_t *inout_pos, uint32_t *out_header)
@@ -398,6 +408,7 @@ int mp3_init(audio_decoder_p decoder, void *dec_ext)
 	RETURN_VAL_IF_FAIL((decoder->dec_mem != NULL), AUDIO_DECODER_ERROR);
 
 	*((tPVMP3DecoderExternal *) decoder->dec_ext) = *((tPVMP3DecoderExternal *) dec_ext);
+	((priv_data_p) decoder->priv_data)->mInputBuffer = ((tPVMP3DecoderExternal *) dec_ext)->pInputBuffer;
 
 	pvmp3_resetDecoder(decoder->dec_mem);
 	pvmp3_InitDecoder((tPVMP3DecoderExternal *) decoder->dec_ext, decoder->dec_mem);
@@ -406,15 +417,16 @@ int mp3_init(audio_decoder_p decoder, void *dec_ext)
 }
 
 // Get the next valid MP3 frame.
-bool mp3_get_frame(rbstream_p mFp, ssize_t *offset, uint32_t *fixed_header, void *buffer, uint32_t *size)
+// *buffer is given in place if possible, see _get_frame().
+bool mp3_get_frame(rbstream_p mFp, ssize_t *offset, uint32_t *fixed_header, void **buffer, uint32_t *size)
 {
 	size_t frame_size;
 
 	for (;;) {
-		ssize_t n = _source_read_at(mFp, *offset, buffer, U32_LEN_IN_BYTES);
+		ssize_t n = _source_read_at(mFp, *offset, *buffer, U32_LEN_IN_BYTES);
 		RETURN_VAL_IF_FAIL((n == U32_LEN_IN_BYTES), false);
 
-		uint32_t header = _u32_at((const uint8_t *)buffer);
+		uint32_t header = _u32_at((const uint8_t *)*buffer);
 
 		if ((header & MP3_FRAME_HEADER_MASK) == (*fixed_header & MP3_FRAME_HEADER_MASK)
 			&& _parse_header(header, &frame_size)) {
@@ -435,15 +447,15 @@ bool mp3_get_frame(rbstream_p mFp, ssize_t *offset, uint32_t *fixed_header, void
 		// Try again with the new position.
 	}
 
-	ssize_t n = _source_read_at(mFp, *offset, buffer, frame_size);
-	RETURN_VAL_IF_FAIL((n == (ssize_t) frame_size), false);
+	void *frame = _source_peek_at(mFp, *offset, *buffer, frame_size);
+	RETURN_VAL_IF_FAIL((frame != NULL), false);
 
 	medvdbg("[%s] Line %d, pos %#x, framesize %#x\n", __FUNCTION__, __LINE__, *offset, frame_size);
 
+	*buffer = frame;
 	*size = frame_size;
 	*offset += frame_size;
-	// Policy: Pop out data when mCurrentPos updated!
-	rbs_seek_ext(mFp, *offset, SEEK_SET);
+	// Policy: Pop out data when the frame was decoded, see _get_frame().
 
 	return true;
 }
@@ -564,6 +576,7 @@ int aac_init(audio_decoder_p decoder, void *dec_ext)
 	RETURN_VAL_IF_FAIL((decoder->dec_mem != NULL), AUDIO_DECODER_ERROR);
 
 	*((tPVMP4AudioDecoderExternal *) decoder->dec_ext) = *((tPVMP4AudioDecoderExternal *) dec_ext);
+	((priv_data_p) decoder->priv_data)->mInputBuffer = ((tPVMP4AudioDecoderExternal *) dec_ext)->pInputBuffer;
 
 	PVMP4AudioDecoderResetBuffer(decoder->dec_mem);
 	Int err = PVMP4AudioDecoderInitLibrary((tPVMP4AudioDecoderExternal *) decoder->dec_ext, decoder->dec_mem);
@@ -573,13 +586,14 @@ int aac_init(audio_decoder_p decoder, void *dec_ext)
 }
 
 // Get the next valid aac frame.
-bool aac_get_frame(rbstream_p mFp, ssize_t *offset, void *buffer, uint32_t *size)
+// *buffer is given in place if possible, see _get_frame().
+bool aac_get_frame(rbstream_p mFp, ssize_t *offset, void **buffer, uint32_t *size)
 {
 	size_t frame_size = 0;
-	uint8_t *buf = (uint8_t *) buffer;
+	uint8_t *buf = (uint8_t *) *buffer;
 
 	for (;;) {
-		ssize_t n = _source_read_at(mFp, *offset, buffer, AAC_ADTS_FRAME_HEADER_LEN);
+		ssize_t n = _source_read_at(mFp, *offset, buf, AAC_ADTS_FRAME_HEADER_LEN);
 		RETURN_VAL_IF_FAIL((n == AAC_ADTS_FRAME_HEADER_LEN), false);
 
 		if (AAC_ADTS_SYNC_VERIFY(buf)) {
@@ -596,12 +610,12 @@ bool aac_get_frame(rbstream_p mFp, ssize_t *offset, void *buffer, uint32_t *size
 		// Try again with the new position.
 	}
 
-	ssize_t n = _source_read_at(mFp, *offset, buffer, frame_size);
-	RETURN_VAL_IF_FAIL((n == (ssize_t) frame_size), false);
+	void *frame = _source_peek_at(mFp, *offset, buf, frame_size);
+	RETURN_VAL_IF_FAIL((frame != NULL), false);
 
+	*buffer = frame;
 	*size = frame_size;
 	*offset += frame_size;
-	rbs_seek_ext(mFp, *offset, SEEK_SET);
 
 	return true;
 }
@@ -721,6 +735,7 @@ int opus_init(audio_decoder_p decoder, void *dec_ext)
 	RETURN_VAL_IF_FAIL((decoder->dec_mem != NULL), AUDIO_DECODER_ERROR);
 
 	*((opus_dec_external_t *) decoder->dec_ext) = *((opus_dec_external_t *) dec_ext);
+	((priv_data_p) decoder->priv_data)->mInputBuffer = ((opus_dec_external_t *) dec_ext)->pInputBuffer;
 
 	opus_resetDecoder(decoder->dec_mem);
 	int err = opus_initDecoder((opus_dec_external_t *) decoder->dec_ext, decoder->dec_mem);
@@ -730,13 +745,14 @@ int opus_init(audio_decoder_p decoder, void *dec_ext)
 }
 
 // Get the next valid Opus frame.
-bool opus_get_frame(rbstream_p mFp, ssize_t *offset, void *buffer, uint32_t *size)
+// *buffer is given in place if possible, see _get_frame().
+bool opus_get_frame(rbstream_p mFp, ssize_t *offset, void **buffer, uint32_t *size)
 {
 	size_t frame_size = 0;
-	uint8_t *buf = (uint8_t *) buffer;
+	uint8_t *buf = (uint8_t *) *buffer;
 
 	for (;;) {
-		ssize_t n = _source_read_at(mFp, *offset, buffer, OPUS_PACKET_HEADER_LEN);
+		ssize_t n = _source_read_at(mFp, *offset, buf, OPUS_PACKET_HEADER_LEN);
 		RETURN_VAL_IF_FAIL((n == OPUS_PACKET_HEADER_LEN), false);
 
 		if (OPUS_PACKET_SYNC_VERIFY(buf)) {
@@ -753,12 +769,12 @@ bool opus_get_frame(rbstream_p mFp, ssize_t *offset, void *buffer, uint32_t *siz
 		// Try again with the new position.
 	}
 
-	ssize_t n = _source_read_at(mFp, *offset, buffer, frame_size);
-	RETURN_VAL_IF_FAIL((n == (ssize_t) frame_size), false);
+	void *frame = _source_peek_at(mFp, *offset, buf, frame_size);
+	RETURN_VAL_IF_FAIL((frame != NULL), false);
 
+	*buffer = frame;
 	*size = frame_size;
 	*offset += frame_size;
-	rbs_seek_ext(mFp, *offset, SEEK_SET);
 
 	return true;
 }
@@ -805,17 +821,27 @@ bool _get_frame(audio_decoder_p decoder)
 	priv_data_p priv = (priv_data_p) decoder->priv_data;
 	assert(priv != NULL);
 
+	// Frames are decoded in place in the ring-buffer, unless they wrap around.
+	// So the previous frame is popped out only now, after it was decoded.
+	rbs_seek_ext(decoder->rbsp, priv->mCurrentPos, SEEK_SET);
+
 	switch (decoder->audio_type) {
 #ifdef CONFIG_CODEC_MP3
 	case AUDIO_TYPE_MP3: {
 		tPVMP3DecoderExternal *mp3_ext = (tPVMP3DecoderExternal *) decoder->dec_ext;
-		return mp3_get_frame(decoder->rbsp, &priv->mCurrentPos, &priv->mFixedHeader, (void *)mp3_ext->pInputBuffer, (uint32_t *)&mp3_ext->inputBufferCurrentLength);
+		void *frame = priv->mInputBuffer;
+		bool ret = mp3_get_frame(decoder->rbsp, &priv->mCurrentPos, &priv->mFixedHeader, &frame, (uint32_t *)&mp3_ext->inputBufferCurrentLength);
+		mp3_ext->pInputBuffer = (uint8 *)frame;
+		return ret;
 	}
 #endif
 #ifdef CONFIG_CODEC_AAC
 	case AUDIO_TYPE_AAC: {
 		tPVMP4AudioDecoderExternal *aac_ext = (tPVMP4AudioDecoderExternal *) decoder->dec_ext;
-		return aac_get_frame(decoder->rbsp, &priv->mCurrentPos, (void *)aac_ext->pInputBuffer, (uint32_t *)&aac_ext->inputBufferCurrentLength);
+		void *frame = priv->mInputBuffer;
+		bool ret = aac_get_frame(decoder->rbsp, &priv->mCurrentPos, &frame, (uint32_t *)&aac_ext->inputBufferCurrentLength);
+		aac_ext->pInputBuffer = (UChar *)frame;
+		return ret;
 	}
 #endif
 	case AUDIO_TYPE_WAVE: {
@@ -827,7 +853,10 @@ bool _get_frame(audio_decoder_p decoder)
 #ifdef CONFIG_CODEC_LIBOPUS
 	case AUDIO_TYPE_OPUS: {
 		opus_dec_external_t *opus_ext = (opus_dec_external_t *) decoder->dec_ext;
-		return opus_get_frame(decoder->rbsp, &priv->mCurrentPos, (void *)opus_ext->pInputBuffer, (uint32_t *)&opus_ext->inputBufferCurrentLength);
+		void *frame = priv->mInputBuffer;
+		bool ret = opus_get_frame(decoder->rbsp, &priv->mCurrentPos, &frame, (uint32_t *)&opus_ext->inputBufferCurrentLength);
+		opus_ext->pInputBuffer = (uint8_t *)frame;
+		return ret;
 	}
 #endif
 
@@ -1104,6 +1133,7 @@ int audio_decoder_init(audio_decoder_p decoder, size_t rbuf_size)
 	// init private data
 	priv->mCurrentPos = 0;
 	priv->mFixedHeader = 0;
+	priv->mInputBuffer = NULL;
 	memset(&(priv->pcm), 0, sizeof(pcm_data_t));
 
 	// init decoder data
@@ -0,0 +1,154 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <errno.h>
+#include <string.h>
+#include <pthread.h>
+#include <debug.h>
+#include <media/codec_backend.h>
+
+#ifndef CONFIG_AUDIO_CODEC_BACKEND_MAX
+#define CONFIG_AUDIO_CODEC_BACKEND_MAX 4
+#endif
+
+#define CODEC_BACKEND_NAME_LEN 16
+
+struct codec_backend_s {
+	char name[CODEC_BACKEND_NAME_LEN];
+	codec_backend_kind_t kind;
+	int priority;
+	const codec_backend_ops_t *ops;
+};
+
+/* Sorted by priority, highest first */
+static struct codec_backend_s g_backends[CONFIG_AUDIO_CODEC_BACKEND_MAX];
+static int g_nbackends;
+static pthread_mutex_t g_backend_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int codec_backend_find(const char *name)
+{
+	int i;
+
+	for (i = 0; i < g_nbackends; i++) {
+		if (strncmp(g_backends[i].name, name, CODEC_BACKEND_NAME_LEN - 1) == 0) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+int codec_backend_register(const char *name, codec_backend_kind_t kind, int priority, const codec_backend_ops_t *ops)
+{
+	int i;
+
+	if (name == NULL || ops == NULL || ops->open == NULL || ops->push == NULL || ops->space == NULL ||
+		ops->empty == NULL || ops->pull == NULL || ops->close == NULL) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&g_backend_mutex);
+	if (codec_backend_find(name) >= 0) {
+		pthread_mutex_unlock(&g_backend_mutex);
+		return -EEXIST;
+	}
+
+	if (g_nbackends == CONFIG_AUDIO_CODEC_BACKEND_MAX) {
+		pthread_mutex_unlock(&g_backend_mutex);
+		meddbg("No room for codec backend %s\n", name);
+		return -ENOMEM;
+	}
+
+	/* Backends of the same priority are tried in the order they came */
+	for (i = g_nbackends; i > 0 && g_backends[i - 1].priority < priority; i--) {
+		g_backends[i] = g_backends[i - 1];
+	}
+	strncpy(g_backends[i].name, name, CODEC_BACKEND_NAME_LEN - 1);
+	g_backends[i].name[CODEC_BACKEND_NAME_LEN - 1] = '\0';
+	g_backends[i].kind = kind;
+	g_backends[i].priority = priority;
+	g_backends[i].ops = ops;
+	g_nbackends++;
+	pthread_mutex_unlock(&g_backend_mutex);
+
+	medvdbg("codec backend %s registered, kind %d priority %d\n", name, kind, priority);
+	return OK;
+}
+
+int codec_backend_unregister(const char *name)
+{
+	int i;
+
+	if (name == NULL) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&g_backend_mutex);
+	i = codec_backend_find(name);
+	if (i < 0) {
+		pthread_mutex_unlock(&g_backend_mutex);
+		return -ENOENT;
+	}
+
+	for (g_nbackends--; i < g_nbackends; i++) {
+		g_backends[i] = g_backends[i + 1];
+	}
+	pthread_mutex_unlock(&g_backend_mutex);
+
+	return OK;
+}
+
+int codec_backend_open(codec_backend_kind_t kind, int audio_type, unsigned int sample_rate, unsigned short channels, const codec_backend_ops_t **ops, void **handle)
+{
+	const codec_backend_ops_t *candidate;
+	void *h;
+	int i;
+
+	if (ops == NULL || handle == NULL) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&g_backend_mutex);
+	for (i = 0; i < g_nbackends; i++) {
+		if (g_backends[i].kind != kind) {
+			continue;
+		}
+
+		candidate = g_backends[i].ops;
+		if (candidate->probe != NULL && !candidate->probe(audio_type, sample_rate, channels)) {
+			continue;
+		}
+
+		/* A backend may still refuse, e.g. out of DSP memory: try the next one */
+		h = candidate->open(audio_type, sample_rate, channels);
+		if (h == NULL) {
+			medvdbg("codec backend %s failed to open type %d\n", g_backends[i].name, audio_type);
+			continue;
+		}
+
+		medvdbg("codec backend %s opened for type %d\n", g_backends[i].name, audio_type);
+		pthread_mutex_unlock(&g_backend_mutex);
+		*ops = candidate;
+		*handle = h;
+		return OK;
+	}
+	pthread_mutex_unlock(&g_backend_mutex);
+
+	return -ENOENT;
+}
@@ -27,6 +27,12 @@
 #define IS_EMPTY(rbp) (rbp->rd_idx == rbp->wr_idx)
 #define IS_FULL(rbp) ((rbp->rd_idx & IDX_MASK) == (rbp->wr_idx & IDX_MASK) && (rbp->rd_idx & MSB_MASK) != (rbp->wr_idx & MSB_MASK))
 
+/* Each index is only moved by its own side, and the data is published by
+ * storing the index: one reader and one writer may use the buffer without a lock.
+ */
+#define LOAD_IDX(p_idx) __atomic_load_n((p_idx), __ATOMIC_ACQUIRE)
+#define STORE_IDX(p_idx, val) __atomic_store_n((p_idx), (val), __ATOMIC_RELEASE)
+
 /**
  * @brief  Increase the buffer index while writing or reading the ring-buffer.
  *         This is implemented according to the 'mirroring' solution:
@@ -64,12 +70,15 @@ size_t rb_used(rb_p rbp)
 {
 	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
 
-	if (IS_EMPTY(rbp)) {
+	size_t wr = LOAD_IDX(&rbp->wr_idx);
+	size_t rd = LOAD_IDX(&rbp->rd_idx);
+
+	if (rd == wr) {
 		return SIZE_ZERO;
 	}
 
-	size_t wr_idx = (rbp->wr_idx & IDX_MASK);
-	size_t rd_idx = (rbp->rd_idx & IDX_MASK);
+	size_t wr_idx = (wr & IDX_MASK);
+	size_t rd_idx = (rd & IDX_MASK);
 
 	if (wr_idx > rd_idx) {
 		return (wr_idx - rd_idx);
@@ -92,7 +101,7 @@ size_t rb_write(rb_p rbp, const void *ptr, size_t len)
 	size_t avail = rb_avail(rbp);
 	len = MINIMUM(len, avail);
 
-	size_t wr_idx = (rbp->wr_idx & IDX_MASK);
+	size_t wr_idx = (LOAD_IDX(&rbp->wr_idx) & IDX_MASK);
 	size_t len_part = rbp->depth - wr_idx;
 
 	if (len > len_part) {
@@ -131,7 +140,7 @@ size_t rb_read_ext(rb_p rbp, void *ptr, size_t len, size_t offset)
 
 	if (ptr != NULL) {
 		// Increase temp rd_idx, to read data at the given offset.
-		size_t rd_idx = rbp->rd_idx;
+		size_t rd_idx = LOAD_IDX(&rbp->rd_idx);
 		_incr(rbp, &rd_idx, offset);
 
 		// Calculate part length can be read based on temp read index
@@ -155,20 +164,73 @@ size_t rb_read_ext(rb_p rbp, void *ptr, size_t len, size_t offset)
 	return len;
 }
 
+static void _set_spans(rb_p rbp, rb_span_t span[2], size_t idx, size_t len)
+{
+	size_t len_part = rbp->depth - idx;
+
+	span[0].buf = (void *)((uint8_t *)rbp->buf + idx);
+	span[0].len = MINIMUM(len, len_part);
+	if (len > len_part) {
+		span[1].buf = rbp->buf;
+		span[1].len = len - len_part;
+	}
+}
+
+size_t rb_peek(rb_p rbp, rb_span_t span[2], size_t offset)
+{
+	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
+	RETURN_VAL_IF_FAIL(span != NULL, SIZE_ZERO);
+
+	memset(span, 0, 2 * sizeof(rb_span_t));
+
+	size_t used = rb_used(rbp);
+	RETURN_VAL_IF_FAIL(offset < used, SIZE_ZERO);
+
+	size_t rd_idx = LOAD_IDX(&rbp->rd_idx);
+	_incr(rbp, &rd_idx, offset);
+
+	_set_spans(rbp, span, (rd_idx & IDX_MASK), (used - offset));
+	return (used - offset);
+}
+
+size_t rb_reserve(rb_p rbp, rb_span_t span[2])
+{
+	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
+	RETURN_VAL_IF_FAIL(span != NULL, SIZE_ZERO);
+
+	memset(span, 0, 2 * sizeof(rb_span_t));
+
+	size_t avail = rb_avail(rbp);
+	RETURN_VAL_IF_FAIL((avail != SIZE_ZERO), SIZE_ZERO);
+
+	_set_spans(rbp, span, (LOAD_IDX(&rbp->wr_idx) & IDX_MASK), avail);
+	return avail;
+}
+
+size_t rb_commit(rb_p rbp, size_t len)
+{
+	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
+
+	len = MINIMUM(len, rb_avail(rbp));
+	_incr(rbp, &rbp->wr_idx, len);
+	return len;
+}
+
 bool rb_reset(rb_p rbp)
 {
 	RETURN_VAL_IF_FAIL(rbp != NULL, false);
 
-	rbp->rd_idx = 0;
-	rbp->wr_idx = 0;
+	STORE_IDX(&rbp->rd_idx, 0);
+	STORE_IDX(&rbp->wr_idx, 0);
 
 	return true;
 }
 
 static void _incr(rb_p rbp, volatile size_t *p_idx, size_t len)
 {
-	size_t idx = *p_idx & IDX_MASK;
-	size_t msb = *p_idx & MSB_MASK;
+	size_t cur = LOAD_IDX(p_idx);
+	size_t idx = cur & IDX_MASK;
+	size_t msb = cur & MSB_MASK;
 
 	idx += len;
 	if (idx >= rbp->depth) {
@@ -176,5 +238,5 @@ static void _incr(rb_p rbp, volatile size_t *p_idx, size_t len)
 		idx -= rbp->depth;
 	}
 
-	*p_idx = msb | idx;
+	STORE_IDX(p_idx, msb | idx);
 }
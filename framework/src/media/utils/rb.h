@@ -41,6 +41,16 @@ struct rb_s {
 typedef struct rb_s  rb_t;
 typedef struct rb_s *rb_p;
 
+/* part of the ring buffer memory, data or free space is given as up to two
+ * spans when it wraps around the end of the buffer
+ */
+struct rb_span_s {
+	void *buf;
+	size_t len;
+};
+
+typedef struct rb_span_s rb_span_t;
+
 /**
  * @brief  Initialize the ring-buffer. Allocate necessary memory for the buffer.
  * @param  rbp : Pointer to the ring-buffer object
@@ -102,6 +112,34 @@ size_t rb_read(rb_p rbp, void *ptr, size_t len);
  */
 size_t rb_read_ext(rb_p rbp, void *ptr, size_t len, size_t offset);
 
+/**
+ * @brief  Get the data from an offset position in place, without copying it.
+ *         rd_idx will not be increased, use rb_read() with 'ptr' NULL to
+ *         drop the data once it is used.
+ * @param  rbp: Pointer to the ring-buffer object
+ * @param  span: Spans of the data, span[1] is empty unless it wraps around
+ * @param  offset: offset from rd_idx started to get.
+ * @return size of data in both spans.
+ */
+size_t rb_peek(rb_p rbp, rb_span_t span[2], size_t offset);
+
+/**
+ * @brief  Get the free space in place, to write data without copying it.
+ *         wr_idx will not be increased until rb_commit() is called.
+ * @param  rbp: Pointer to the ring-buffer object
+ * @param  span: Spans of the free space, span[1] is empty unless it wraps around
+ * @return size of free space in both spans.
+ */
+size_t rb_reserve(rb_p rbp, rb_span_t span[2]);
+
+/**
+ * @brief  Add data written in place to the space given by rb_reserve().
+ * @param  rbp: Pointer to the ring-buffer object
+ * @param  len: length of the data written from the start of span[0]
+ * @return size of data added, range[0, len]
+ */
+size_t rb_commit(rb_p rbp, size_t len);
+
 /**
  * @brief  Reset ring-buffer, data in ring-buffer will be dropped.
  * @param  rbp: Pointer to the ring-buffer object
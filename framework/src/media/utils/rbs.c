@@ -95,6 +95,25 @@ size_t rbs_read(void *ptr, size_t size, size_t nmemb, rbstream_p rbsp)
 	return read;
 }
 
+const void *rbs_peek(void *ptr, size_t size, rbstream_p rbsp)
+{
+	medvdbg("[%s] ptr %p size %lu\n", __FUNCTION__, ptr, size);
+	RETURN_VAL_IF_FAIL(ptr != NULL, NULL);
+	RETURN_VAL_IF_FAIL(rbsp != NULL, NULL);
+
+	rb_span_t span[2];
+	size_t offset = rbsp->cur_pos - rbsp->rd_size;
+	if (rb_peek(rbsp->rbp, span, offset) >= size && span[0].len >= size) {
+		// increase cur_pos
+		rbsp->cur_pos += size;
+		return span[0].buf;
+	}
+
+	// wraps around or more data wanted
+	RETURN_VAL_IF_FAIL((rbs_read(ptr, 1, size, rbsp) == size), NULL);
+	return ptr;
+}
+
 size_t rbs_write(const void *ptr, size_t size, size_t nmemb, rbstream_p rbsp)
 {
 	medvdbg("[%s] ptr %p nmemb %lu\n", __FUNCTION__, ptr, nmemb);
@@ -105,6 +105,17 @@ int rbs_close(rbstream_p stream);
  */
 size_t rbs_read(void *ptr, size_t size, size_t nmemb, rbstream_p stream);
 
+/**
+ * @brief  Reads size bytes like rbs_read(), but gives them in place when they
+ *         do not wrap around the ring-buffer, and only copies them to ptr otherwise.
+ *         Data given in place stays valid until it is popped out by rbs_seek_ext().
+ * @param  ptr : Pointer to the location to copy the data to if needed
+ * @param  size : Size in bytes of the data
+ * @param  stream : Pointer to the ring-buffer stream
+ * @return pointer to the data, NULL if there are not size bytes.
+ */
+const void *rbs_peek(void *ptr, size_t size, rbstream_p stream);
+
 /**
  * @brief  Writes nmemb items of data. Always append data to ring-buffer end,
  *         that means data can't be written to the position seeked by rbs_seek()
@@ -16,12 +16,18 @@
  *
  ****************************************************************************/
 
+#include <tinyara/config.h>
 #include <string.h>
 #include <debug.h>
 #include <media/MediaTypes.h>
 #include "internal_defs.h"
 #include "remix.h"
 
+#if defined(CONFIG_MEDIA_RESAMPLER_SIMD) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define REMIX_NEON
+#endif
+
 using namespace media;
 
 // audio channel masks
@@ -203,7 +209,15 @@ int32_t rechannel(uint32_t in_layout, uint32_t out_layout, const int16_t *input,
 		out_fl = &output[out_samples - 2];
 		out_fr = &output[out_samples - 1];
 
-		while (output <= out_fl) {
+#ifdef REMIX_NEON
+		// Frames out of whole blocks first, then blocks of 8 frames backward.
+		// Block i is written at 2 * i, so it never overwrites input still to be read.
+		uint32_t blocks = out_frames / 8;
+		int16_t *out_stop = &output[blocks * 8 * out_ch];
+#else
+		int16_t *out_stop = output;
+#endif
+		while (out_stop <= out_fl) {
 			*out_fr = *in_fc;
 			*out_fl = *in_fc;
 
@@ -211,6 +225,14 @@ int32_t rechannel(uint32_t in_layout, uint32_t out_layout, const int16_t *input,
 			out_fl -= out_ch;
 			in_fc -= in_ch;
 		}
+#ifdef REMIX_NEON
+		while (blocks-- > 0) {
+			int16x8x2_t lr;
+			lr.val[0] = vld1q_s16(&input[blocks * 8]);
+			lr.val[1] = lr.val[0];
+			vst2q_s16(&output[blocks * 8 * out_ch], lr);
+		}
+#endif
 	} break;
 
 	case CH_LAYOUT_STEREO: { // out_layout: CH_LAYOUT_MONO
@@ -218,6 +240,22 @@ int32_t rechannel(uint32_t in_layout, uint32_t out_layout, const int16_t *input,
 		in_fr = &input[1];
 		out_fc = &output[0];
 
+#ifdef REMIX_NEON
+		// Blocks of 8 frames, output never goes ahead of input.
+		// Negative odd sums are rounded toward zero like the division below.
+		while (out_fc + 8 <= out_end) {
+			int16x8x2_t lr = vld2q_s16(in_fl);
+			int32x4_t lo = vaddl_s16(vget_low_s16(lr.val[0]), vget_low_s16(lr.val[1]));
+			int32x4_t hi = vaddl_s16(vget_high_s16(lr.val[0]), vget_high_s16(lr.val[1]));
+			lo = vaddq_s32(lo, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(lo), 31)));
+			hi = vaddq_s32(hi, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(hi), 31)));
+			vst1q_s16(out_fc, vcombine_s16(vshrn_n_s32(lo, 1), vshrn_n_s32(hi, 1)));
+
+			out_fc += 8 * out_ch;
+			in_fl += 8 * in_ch;
+			in_fr += 8 * in_ch;
+		}
+#endif
 		while (out_fc < out_end) {
 			*out_fc = ((int32_t)*in_fl + *in_fr) / 2;
 
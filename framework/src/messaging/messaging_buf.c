@@ -0,0 +1,301 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <debug.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef CONFIG_MM_SHM
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#endif
+#include <messaging/messaging.h>
+#include "messaging_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define MSG_BUF_MAGIC 0x4d534742	/* "MSGB" */
+#define MSG_BUF_NO_SHM (-1)
+
+/* The payload follows the header, aligned for any type */
+#define MSG_BUF_HDR_SIZE ((sizeof(struct msg_buf_s) + 7) & ~7)
+#define MSG_BUF_HDR(buf) ((struct msg_buf_s *)((char *)(buf) - MSG_BUF_HDR_SIZE))
+#define MSG_BUF_DATA(hdr) ((void *)((char *)(hdr) + MSG_BUF_HDR_SIZE))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+/* A shared buffer is laid out like below.
+ * +-----------------------------------------------------------+
+ * | handle(msg_buf_handle_t) | refs(4bytes) | pad | payload    |
+ * +-----------------------------------------------------------+
+ * The handle is what goes through the message queue. In a heap buffer, self
+ * locates the buffer for the receivers. In a shm buffer, each holder has its
+ * own mapping, found again from shmid, and self is only used by the sender
+ * to recognize the handle.
+ */
+struct msg_buf_s {
+	msg_buf_handle_t handle;
+	uint32_t refs;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static bool messaging_buf_valid(const msg_buf_handle_t *handle)
+{
+	return handle->magic == MSG_BUF_MAGIC;
+}
+
+static void messaging_buf_destroy(struct msg_buf_s *hdr)
+{
+#ifdef CONFIG_MM_SHM
+	if (hdr->handle.shmid != MSG_BUF_NO_SHM) {
+		int shmid = hdr->handle.shmid;
+
+		hdr->handle.magic = 0;
+		shmdt(hdr);
+		shmctl(shmid, IPC_RMID, NULL);
+		return;
+	}
+#endif
+	hdr->handle.magic = 0;
+	MSG_FREE(hdr);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+/****************************************************************************
+ * Name : messaging_buf_alloc
+ *
+ * Description:
+ *  Allocate a buffer whose handle can be sent instead of its payload.
+ *  The caller holds the first reference.
+ ****************************************************************************/
+void *messaging_buf_alloc(size_t size)
+{
+	struct msg_buf_s *hdr;
+	int shmid = MSG_BUF_NO_SHM;
+
+	if (size == 0 || size > UINT32_MAX - MSG_BUF_HDR_SIZE) {
+		msgdbg("[Messaging] buf alloc fail : invalid size %u.\n", size);
+		return NULL;
+	}
+
+#ifdef CONFIG_MM_SHM
+	shmid = shmget(IPC_PRIVATE, MSG_BUF_HDR_SIZE + size, IPC_CREAT | 0666);
+	if (shmid < 0) {
+		msgdbg("[Messaging] buf alloc fail : shmget errno %d.\n", errno);
+		return NULL;
+	}
+
+	hdr = (struct msg_buf_s *)shmat(shmid, NULL, 0);
+	if (hdr == (struct msg_buf_s *)-1) {
+		msgdbg("[Messaging] buf alloc fail : shmat errno %d.\n", errno);
+		shmctl(shmid, IPC_RMID, NULL);
+		return NULL;
+	}
+#else
+	hdr = (struct msg_buf_s *)MSG_ALLOC(MSG_BUF_HDR_SIZE + size);
+	if (hdr == NULL) {
+		msgdbg("[Messaging] buf alloc fail : out of memory.\n");
+		return NULL;
+	}
+#endif
+
+	hdr->handle.magic = MSG_BUF_MAGIC;
+	hdr->handle.shmid = shmid;
+	hdr->handle.self = hdr;
+	hdr->handle.size = size;
+	hdr->refs = 1;
+
+	return MSG_BUF_DATA(hdr);
+}
+
+/****************************************************************************
+ * Name : messaging_buf_handle
+ *
+ * Description:
+ *  Return the handle to send as msg, with msglen sizeof(msg_buf_handle_t).
+ ****************************************************************************/
+char *messaging_buf_handle(void *buf)
+{
+	struct msg_buf_s *hdr;
+
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	hdr = MSG_BUF_HDR(buf);
+
+	/* A receiver which forwards a shm buffer has its own mapping of it */
+	hdr->handle.self = hdr;
+	return (char *)&hdr->handle;
+}
+
+/****************************************************************************
+ * Name : messaging_buf_open
+ *
+ * Description:
+ *  Return the payload of a received handle. The reference given by the
+ *  sender is now owned by the caller.
+ ****************************************************************************/
+void *messaging_buf_open(msg_recv_buf_t *recv_buf, size_t *size)
+{
+	msg_buf_handle_t handle;
+	struct msg_buf_s *hdr;
+
+	if (recv_buf == NULL || recv_buf->buf == NULL || recv_buf->buflen < (int)sizeof(msg_buf_handle_t)) {
+		msgdbg("[Messaging] buf open fail : invalid parameter.\n");
+		return NULL;
+	}
+
+	memcpy(&handle, recv_buf->buf, sizeof(msg_buf_handle_t));
+	if (!messaging_buf_valid(&handle)) {
+		msgdbg("[Messaging] buf open fail : not a buffer handle.\n");
+		return NULL;
+	}
+
+#ifdef CONFIG_MM_SHM
+	hdr = (struct msg_buf_s *)shmat(handle.shmid, NULL, 0);
+	if (hdr == (struct msg_buf_s *)-1) {
+		msgdbg("[Messaging] buf open fail : shmat errno %d.\n", errno);
+		return NULL;
+	}
+#else
+	hdr = (struct msg_buf_s *)handle.self;
+#endif
+
+	if (size != NULL) {
+		*size = hdr->handle.size;
+	}
+	return MSG_BUF_DATA(hdr);
+}
+
+/****************************************************************************
+ * Name : messaging_buf_release
+ *
+ * Description:
+ *  Drop the reference of the caller and free the buffer with the last one.
+ ****************************************************************************/
+void messaging_buf_release(void *buf)
+{
+	struct msg_buf_s *hdr;
+
+	if (buf == NULL) {
+		return;
+	}
+
+	hdr = MSG_BUF_HDR(buf);
+	if (!messaging_buf_valid(&hdr->handle)) {
+		msgdbg("[Messaging] buf release fail : not a shared buffer.\n");
+		return;
+	}
+
+	if (__atomic_sub_fetch(&hdr->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+		messaging_buf_destroy(hdr);
+		return;
+	}
+
+#ifdef CONFIG_MM_SHM
+	/* Others still use it, just drop the mapping of the caller */
+	shmdt(hdr);
+#endif
+}
+
+/****************************************************************************
+ * Name : messaging_buf_is_handle
+ *
+ * Description:
+ *  Check that the message to send is the handle of a shared buffer.
+ ****************************************************************************/
+bool messaging_buf_is_handle(msg_send_data_t *send_data)
+{
+	msg_buf_handle_t *handle = (msg_buf_handle_t *)send_data->msg;
+
+	if (send_data->msglen != sizeof(msg_buf_handle_t) || ((uintptr_t)handle & 3) != 0) {
+		return false;
+	}
+
+	return messaging_buf_valid(handle) && handle->self == (void *)handle;
+}
+
+/****************************************************************************
+ * Name : messaging_buf_ref
+ *
+ * Description:
+ *  If the message to send is the handle of a shared buffer, take the
+ *  reference which the receiver will own.
+ *
+ * Return Value:
+ *  true if a reference was taken, which messaging_buf_unref() gives back
+ *  if the message could not be sent.
+ ****************************************************************************/
+bool messaging_buf_ref(msg_send_data_t *send_data)
+{
+	msg_buf_handle_t *handle = (msg_buf_handle_t *)send_data->msg;
+
+	if (!messaging_buf_is_handle(send_data)) {
+		return false;
+	}
+
+	__atomic_add_fetch(&((struct msg_buf_s *)handle)->refs, 1, __ATOMIC_RELAXED);
+	return true;
+}
+
+void messaging_buf_unref(msg_send_data_t *send_data)
+{
+	struct msg_buf_s *hdr = (struct msg_buf_s *)send_data->msg;
+
+	/* The caller still holds its own reference, so this is never the last one */
+	__atomic_sub_fetch(&hdr->refs, 1, __ATOMIC_RELAXED);
+}
+
+#ifdef CONFIG_MESSAGING_MULTICAST_SHARED
+/****************************************************************************
+ * Name : messaging_parse_shared
+ *
+ * Description:
+ *  Copy the payload of a multicast sent as a shared copy to the buffer of
+ *  the receiver, and drop the reference of the receiver.
+ ****************************************************************************/
+int messaging_parse_shared(char *msg, char *buf, int buflen)
+{
+	msg_recv_buf_t handle_buf;
+	void *payload;
+	size_t size;
+
+	handle_buf.buf = msg;
+	handle_buf.buflen = sizeof(msg_buf_handle_t);
+	payload = messaging_buf_open(&handle_buf, &size);
+	if (payload == NULL) {
+		return ERROR;
+	}
+
+	memcpy(buf, payload, size < (size_t)buflen ? size : (size_t)buflen);
+	messaging_buf_release(payload);
+	return OK;
+}
+#endif
@@ -72,6 +72,7 @@ int messaging_cleanup(const char *port_name)
 	msg_port_info_t *port_info;
 	pid_t my_pid;
 	sq_queue_t *port_info_list_ptr;
+	int nclosed = 0;
 
 	if (port_name == NULL) {
 		msgdbg("[Messaging] cleanup fail : invalid param.\n");
@@ -83,6 +84,11 @@ int messaging_cleanup(const char *port_name)
 		return ERROR;
 	}
 
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	/* Close the queues which were kept open for block receives and sync replies. */
+	nclosed = messaging_mq_cleanup(port_name);
+#endif
+
 	/* Remove the receiver information by port_name from the info list. */
 	port_info_list_ptr = messaging_get_port_info_list();
 	port_info = (msg_port_info_t *)sq_peek(port_info_list_ptr);
@@ -106,6 +112,8 @@ int messaging_cleanup(const char *port_name)
 
 	if (cleanup_pid != INVALID_PID) {
 		ret = messaging_unlink_internalport(port_name, cleanup_pid);
+	} else if (nclosed > 0) {
+		ret = OK;
 	} else {
 		ret = ERROR;
 	}
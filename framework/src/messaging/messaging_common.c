@@ -141,6 +141,22 @@ int messaging_parse_packet(char *packet, char *buf, int buflen, pid_t *sender_pi
 	case 1:
 		*sender_pid = ((messaging_packet_t *)packet)->sender_pid;
 		*msg_type = ((messaging_packet_t *)packet)->msg_type;
+#ifdef CONFIG_MESSAGING_SYNC_DIRECT
+		if (*msg_type == MSG_SEND_SYNC_DIRECT) {
+			/* The receiver sees a sync message. */
+			*msg_type = MSG_REPLY_REQUIRED;
+			ret = messaging_parse_direct(packet + offset, buf, buflen, sender_pid);
+			break;
+		}
+#endif
+#ifdef CONFIG_MESSAGING_MULTICAST_SHARED
+		if (*msg_type == MSG_SEND_MULTI_SHARED) {
+			/* The receiver sees a multicast message. */
+			*msg_type = MSG_REPLY_NO_REQUIRED;
+			ret = messaging_parse_shared(packet + offset, buf, buflen);
+			break;
+		}
+#endif
 		memcpy(buf, packet + offset, buflen);
 		ret = OK;
 		break;
@@ -0,0 +1,251 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <tinyara/semaphore.h>
+#include <debug.h>
+#include <errno.h>
+#include <queue.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <messaging/messaging.h>
+#include "messaging_internal.h"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+/* A sync request handed over directly. Only its address goes through the
+ * queue of the receiver: the receiver copies the message from the sender
+ * buffer and messaging_reply() writes the reply into reply_buf of the sender,
+ * which waits on 'done'. The request is on the heap: if the sender is
+ * deleted while waiting, the receiver frees it instead.
+ */
+struct msg_sync_req_s {
+	struct msg_sync_req_s *flink;
+	char port_name[MAX_PORT_NAME_SIZE];
+	pid_t sender_pid;
+	int sender_prio;
+	pid_t recv_pid;
+	int recv_prio;				/* Priority of the receiver before it was raised */
+	char *msg;
+	int msglen;
+	msg_recv_buf_t *reply_buf;
+	sem_t done;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static sq_queue_t g_msg_sync_list;
+static sem_t g_msg_sync_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static void messaging_sync_lock(void)
+{
+	while (sem_wait(&g_msg_sync_sem) != OK) {
+		if (errno != EINTR) {
+			return;
+		}
+	}
+}
+
+static void messaging_sync_unlock(void)
+{
+	sem_post(&g_msg_sync_sem);
+}
+
+static bool messaging_sync_alive(pid_t pid)
+{
+	struct sched_param param;
+
+	return sched_getparam(pid, &param) == OK;
+}
+
+/****************************************************************************
+ * Name : messaging_sync_direct
+ *
+ * Description:
+ *  Send a sync message by handing over its address, and wait for the reply
+ *  written by messaging_reply(). The address goes through the queue of the
+ *  receiver with the priority of the message, so requests keep their order.
+ *
+ * Return Value:
+ *  On success, 0 (OK) is returned.; On failure, -1 (ERROR) is returned.
+ ****************************************************************************/
+int messaging_sync_direct(const char *port_name, msg_send_data_t *send_data, msg_recv_buf_t *reply_buf)
+{
+	int ret;
+	struct msg_sync_req_s *req;
+	struct sched_param param;
+	msg_send_data_t handoff;
+	bool buf_ref;
+
+	if (strlen(port_name) >= MAX_PORT_NAME_SIZE) {
+		msgdbg("[Messaging] sync send fail : too long port name.\n");
+		return ERROR;
+	}
+
+	req = (struct msg_sync_req_s *)MSG_ALLOC(sizeof(struct msg_sync_req_s));
+	if (req == NULL) {
+		msgdbg("[Messaging] sync send fail : out of memory for request.\n");
+		return ERROR;
+	}
+
+	strncpy(req->port_name, port_name, MAX_PORT_NAME_SIZE);
+	req->sender_pid = getpid();
+	req->sender_prio = sched_getparam(0, &param) == OK ? param.sched_priority : 0;
+	req->recv_pid = -1;
+	req->msg = send_data->msg;
+	req->msglen = send_data->msglen;
+	req->reply_buf = reply_buf;
+	sem_init(&req->done, 0, 0);
+	sem_setprotocol(&req->done, SEM_PRIO_NONE);
+
+	messaging_sync_lock();
+	sq_addlast((FAR sq_entry_t *)req, &g_msg_sync_list);
+	messaging_sync_unlock();
+
+	/* A shared buffer handle carries one reference for the receiver. */
+	buf_ref = messaging_buf_ref(send_data);
+
+	handoff.msg = (char *)&req;
+	handoff.msglen = sizeof(req);
+	handoff.priority = send_data->priority;
+	ret = messaging_send_internal(port_name, MSG_SEND_SYNC_DIRECT, &handoff, NULL, NULL);
+	if (ret == ERROR) {
+		if (buf_ref) {
+			messaging_buf_unref(send_data);
+		}
+		messaging_sync_lock();
+		sq_rem((FAR sq_entry_t *)req, &g_msg_sync_list);
+		messaging_sync_unlock();
+		sem_destroy(&req->done);
+		MSG_FREE(req);
+		return ERROR;
+	}
+
+	while (sem_wait(&req->done) != OK) {
+		if (errno != EINTR) {
+			msgdbg("[Messaging] sync send fail : wait error %d.\n", errno);
+			return ERROR;
+		}
+	}
+
+	sem_destroy(&req->done);
+	MSG_FREE(req);
+	return OK;
+}
+
+/****************************************************************************
+ * Name : messaging_parse_direct
+ *
+ * Description:
+ *  Copy the message of a request from messaging_sync_direct() to the buffer
+ *  of the receiver. Until the reply, the receiver runs at least at the
+ *  priority of the sender, as the sender waits for it.
+ *
+ * Return Value:
+ *  On success, 0 (OK) is returned.; On failure, -1 (ERROR) is returned.
+ ****************************************************************************/
+int messaging_parse_direct(char *msg, char *buf, int buflen, pid_t *sender_pid)
+{
+	struct msg_sync_req_s *req;
+	struct sched_param param;
+
+	memcpy(&req, msg, sizeof(req));
+
+	if (!messaging_sync_alive(req->sender_pid)) {
+		msgdbg("[Messaging] recv fail : sender %d is gone.\n", req->sender_pid);
+		messaging_sync_lock();
+		sq_rem((FAR sq_entry_t *)req, &g_msg_sync_list);
+		messaging_sync_unlock();
+		sem_destroy(&req->done);
+		MSG_FREE(req);
+		return ERROR;
+	}
+
+	memcpy(buf, req->msg, req->msglen < buflen ? req->msglen : buflen);
+	*sender_pid = req->sender_pid;
+
+	req->recv_pid = getpid();
+	req->recv_prio = -1;
+	if (sched_getparam(0, &param) == OK && param.sched_priority < req->sender_prio) {
+		req->recv_prio = param.sched_priority;
+		param.sched_priority = req->sender_prio;
+		sched_setparam(0, &param);
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name : messaging_reply_direct
+ *
+ * Description:
+ *  Write the reply into the buffer of a sender waiting in
+ *  messaging_sync_direct() on port_name, and wake it up.
+ *
+ * Return Value:
+ *  OK if the sender was waiting for a direct reply. Otherwise, ERROR is
+ *  returned and the reply goes through the reply queue of the sender.
+ ****************************************************************************/
+int messaging_reply_direct(const char *port_name, pid_t sender_pid, msg_send_data_t *reply_data)
+{
+	struct msg_sync_req_s *req;
+	struct sched_param param;
+	msg_recv_buf_t *reply_buf;
+
+	messaging_sync_lock();
+	for (req = (struct msg_sync_req_s *)sq_peek(&g_msg_sync_list); req != NULL; req = (struct msg_sync_req_s *)sq_next(req)) {
+		if (req->sender_pid == sender_pid && req->recv_pid == getpid() && strncmp(req->port_name, port_name, MAX_PORT_NAME_SIZE) == 0) {
+			sq_rem((FAR sq_entry_t *)req, &g_msg_sync_list);
+			break;
+		}
+	}
+	messaging_sync_unlock();
+
+	if (req == NULL) {
+		return ERROR;
+	}
+
+	if (req->recv_prio >= 0) {
+		param.sched_priority = req->recv_prio;
+		sched_setparam(0, &param);
+	}
+
+	if (!messaging_sync_alive(sender_pid)) {
+		sem_destroy(&req->done);
+		MSG_FREE(req);
+		return OK;
+	}
+
+	reply_buf = req->reply_buf;
+	memcpy(reply_buf->buf, reply_data->msg, reply_data->msglen < reply_buf->buflen ? reply_data->msglen : reply_buf->buflen);
+	reply_buf->sender_pid = getpid();
+	sem_post(&req->done);
+
+	return OK;
+}
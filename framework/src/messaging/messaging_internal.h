@@ -17,6 +17,7 @@
  ****************************************************************************/
 #include <tinyara/compiler.h>
 #include <mqueue.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <queue.h>
@@ -70,7 +71,9 @@ typedef enum msg_info_type_e msg_info_type_t;
  * @brief The type of sending message
  * @details MSG_SEND_SYNC : Unicast send message type with sync mode\n
  * MSG_SEND_ASYNC : Unicast send message type with async mode
- * MSG_SEND_MULTI : Multicast send message type
+ * MSG_SEND_MULTI : Multicast send message type\n
+ * MSG_SEND_SYNC_DIRECT : Unicast send message type with sync mode, the message is the address of the request\n
+ * MSG_SEND_MULTI_SHARED : Multicast send message type, the message is the handle of a shared copy of it
  */
 enum msg_send_type_e {
 	MSG_SEND_NOREPLY = 0,
@@ -78,6 +81,8 @@ enum msg_send_type_e {
 	MSG_SEND_ASYNC = 2,
 	MSG_SEND_MULTI = 3,
 	MSG_SEND_REPLY = 4,
+	MSG_SEND_SYNC_DIRECT = 5,
+	MSG_SEND_MULTI_SHARED = 6,
 	MSG_SEND_TYPE_MAX
 };
 typedef enum msg_send_type_e msg_send_type_t;
@@ -106,6 +111,17 @@ struct msg_port_info_s {
 };
 typedef struct msg_port_info_s msg_port_info_t;
 
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+/**
+ * @brief The internal structure of a handle from messaging_connect()
+ */
+struct msg_port_s {
+	char name[MAX_PORT_NAME_SIZE];
+	pid_t recv_pid;
+	mqd_t mqdes;
+};
+#endif
+
 /**
  * @brief Internal function for setting callback function to the messaging signal.
  */
@@ -126,6 +142,14 @@ int messaging_send_internal(const char *port_name, msg_send_type_t msg_type, msg
  * @brief Internal function for sending message packet which has header and message.
  */
 int messaging_send_packet(const char *port_name, msg_send_type_t msg_type, msg_send_data_t *send_data, msg_callback_info_t *cb_info);
+/**
+ * @brief Internal function for sending message packet to an opened message queue.
+ */
+int messaging_send_mq(mqd_t mqdes, msg_send_type_t msg_type, msg_send_data_t *send_data);
+/**
+ * @brief Internal function for waiting the reply of a sync send.
+ */
+int messaging_sync_recv(const char *port_name, msg_recv_buf_t *reply_buf);
 /**
  * @brief Internal function for receiving APIs.
  */
@@ -142,6 +166,56 @@ int messaging_parse_packet(char *packet, char *buf, int buflen, pid_t *sender_pi
  * @brief Internal function for getting g_port_info_list
  */
 sq_queue_t *messaging_get_port_info_list(void);
+/**
+ * @brief Internal function for checking that the message to send is a shared buffer handle.
+ */
+bool messaging_buf_is_handle(msg_send_data_t *send_data);
+/**
+ * @brief Internal function for taking the reference of a receiver if the message is a shared buffer handle.
+ */
+bool messaging_buf_ref(msg_send_data_t *send_data);
+/**
+ * @brief Internal function for giving back the reference of a receiver which did not get the handle.
+ */
+void messaging_buf_unref(msg_send_data_t *send_data);
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+/**
+ * @brief Internal function for getting the cached mq descriptor of this task, or opening and caching it.
+ */
+mqd_t messaging_mq_open(const char *name, int oflags);
+/**
+ * @brief Internal function for giving back a descriptor from messaging_mq_open(). It is closed if it was not cached.
+ */
+void messaging_mq_close(mqd_t mqdes);
+/**
+ * @brief Internal function for closing a descriptor from messaging_mq_open() and removing it from the cache.
+ */
+void messaging_mq_drop(mqd_t mqdes);
+/**
+ * @brief Internal function for closing and unlinking the cached message queues of this task on a port.
+ */
+int messaging_mq_cleanup(const char *port_name);
+#endif
+#ifdef CONFIG_MESSAGING_SYNC_DIRECT
+/**
+ * @brief Internal function for sending a sync message by handing over its address.
+ */
+int messaging_sync_direct(const char *port_name, msg_send_data_t *send_data, msg_recv_buf_t *reply_buf);
+/**
+ * @brief Internal function for copying the message of a request from messaging_sync_direct().
+ */
+int messaging_parse_direct(char *msg, char *buf, int buflen, pid_t *sender_pid);
+/**
+ * @brief Internal function for replying to a sender waiting in messaging_sync_direct().
+ */
+int messaging_reply_direct(const char *port_name, pid_t sender_pid, msg_send_data_t *reply_data);
+#endif
+#ifdef CONFIG_MESSAGING_MULTICAST_SHARED
+/**
+ * @brief Internal function for copying the message of a multicast from its shared copy.
+ */
+int messaging_parse_shared(char *msg, char *buf, int buflen);
+#endif
 /*
  *@endcond
  */
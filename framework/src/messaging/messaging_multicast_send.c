@@ -20,6 +20,7 @@
  ****************************************************************************/
 #include <debug.h>
 #include <errno.h>
+#include <string.h>
 #include <sys/types.h>
 #include <messaging/messaging.h>
 #include "messaging_internal.h"
@@ -27,6 +28,34 @@
 /****************************************************************************
  * private functions
  ****************************************************************************/
+#ifdef CONFIG_MESSAGING_MULTICAST_SHARED
+/* The payload is copied once to a shared buffer, and each receiver gets its
+ * handle and one reference. A receiver copies the payload out of it, so the
+ * payload goes through no message queue.
+ */
+static int messaging_multicast_shared(const char *port_name, msg_send_data_t *send_data)
+{
+	int ret;
+	void *payload;
+	msg_send_data_t handle_data;
+
+	payload = messaging_buf_alloc(send_data->msglen);
+	if (payload == NULL) {
+		return ERROR;
+	}
+	memcpy(payload, send_data->msg, send_data->msglen);
+
+	handle_data.msg = messaging_buf_handle(payload);
+	handle_data.msglen = sizeof(msg_buf_handle_t);
+	handle_data.priority = send_data->priority;
+	ret = messaging_send_internal(port_name, MSG_SEND_MULTI_SHARED, &handle_data, NULL, NULL);
+
+	/* The receivers hold their own references. */
+	messaging_buf_release(payload);
+	return ret;
+}
+#endif
+
 /****************************************************************************
  * messaging_multicast
  ****************************************************************************/
@@ -43,6 +72,13 @@ int messaging_multicast(const char *port_name, msg_send_data_t *send_data)
 		return ERROR;
 	}
 
+#ifdef CONFIG_MESSAGING_MULTICAST_SHARED
+	/* The handle must fit where the message would. A handle is sent as it is. */
+	if (send_data->msglen >= (int)sizeof(msg_buf_handle_t) && !messaging_buf_is_handle(send_data)) {
+		return messaging_multicast_shared(port_name, send_data);
+	}
+#endif
+
 	ret = messaging_send_internal(port_name, MSG_SEND_MULTI, send_data, NULL, NULL);
 	if (ret == ERROR) {
 		return ERROR;
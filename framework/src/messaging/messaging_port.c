@@ -0,0 +1,406 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <debug.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <messaging/messaging.h>
+#include "messaging_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define MSG_MQCACHE_FREE 0	/* pid of a free entry, the idle task never sends */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+/* An mq descriptor belongs to the task group which opened it, so an entry is
+ * only used by the task which made it. The entry of a task which exited is
+ * taken again without closing, its descriptors were closed with the group.
+ */
+struct msg_mqcache_s {
+	pid_t pid;
+	int oflags;
+	mqd_t mqdes;
+	uint32_t stamp;
+	char name[MAX_PORT_NAME_SIZE];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static struct msg_mqcache_s g_msg_mqcache[CONFIG_MESSAGING_PORT_CACHE_SIZE];
+static sem_t g_msg_mqcache_sem = SEM_INITIALIZER(1);
+static uint32_t g_msg_mqcache_stamp;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static void messaging_mqcache_lock(void)
+{
+	while (sem_wait(&g_msg_mqcache_sem) != OK) {
+		if (errno != EINTR) {
+			return;
+		}
+	}
+}
+
+static void messaging_mqcache_unlock(void)
+{
+	sem_post(&g_msg_mqcache_sem);
+}
+
+static struct msg_mqcache_s *messaging_mqcache_find(pid_t pid, const char *name, int oflags)
+{
+	int idx;
+
+	for (idx = 0; idx < CONFIG_MESSAGING_PORT_CACHE_SIZE; idx++) {
+		if (g_msg_mqcache[idx].pid == pid && g_msg_mqcache[idx].oflags == (oflags & O_ACCMODE) && strncmp(g_msg_mqcache[idx].name, name, MAX_PORT_NAME_SIZE) == 0) {
+			return &g_msg_mqcache[idx];
+		}
+	}
+
+	return NULL;
+}
+
+/* Take a free entry, the entry of an exited task, or the least recently used
+ * entry of this task. Entries of other tasks which are alive are never taken.
+ */
+static struct msg_mqcache_s *messaging_mqcache_alloc(pid_t pid)
+{
+	struct msg_mqcache_s *victim = NULL;
+	struct msg_mqcache_s *entry;
+	struct sched_param param;
+	int idx;
+
+	for (idx = 0; idx < CONFIG_MESSAGING_PORT_CACHE_SIZE; idx++) {
+		entry = &g_msg_mqcache[idx];
+		if (entry->pid == MSG_MQCACHE_FREE) {
+			return entry;
+		}
+		if (entry->pid != pid) {
+			if (sched_getparam(entry->pid, &param) != OK) {
+				entry->pid = MSG_MQCACHE_FREE;
+				return entry;
+			}
+			continue;
+		}
+		if (victim == NULL || (int32_t)(entry->stamp - victim->stamp) < 0) {
+			victim = entry;
+		}
+	}
+
+	if (victim != NULL) {
+		mq_close(victim->mqdes);
+		victim->pid = MSG_MQCACHE_FREE;
+	}
+	return victim;
+}
+
+/****************************************************************************
+ * Name : messaging_mq_open
+ *
+ * Description:
+ *  Get the descriptor of this task for the message queue 'name' from the
+ *  cache, or open it and cache it. A queue made by O_CREAT takes messages of
+ *  CONFIG_MQ_MAXMSGSIZE, since it stays for receives with other buffers.
+ *  The descriptor is given back with messaging_mq_close().
+ ****************************************************************************/
+mqd_t messaging_mq_open(const char *name, int oflags)
+{
+	struct msg_mqcache_s *entry;
+	struct mq_attr internal_attr;
+	pid_t pid;
+	mqd_t mqdes;
+
+	pid = getpid();
+
+	messaging_mqcache_lock();
+	entry = messaging_mqcache_find(pid, name, oflags);
+	if (entry != NULL) {
+		entry->stamp = ++g_msg_mqcache_stamp;
+		mqdes = entry->mqdes;
+		messaging_mqcache_unlock();
+		return mqdes;
+	}
+	messaging_mqcache_unlock();
+
+	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
+	internal_attr.mq_msgsize = CONFIG_MQ_MAXMSGSIZE;
+	internal_attr.mq_flags = 0;
+
+	mqdes = mq_open(name, oflags, 0666, &internal_attr);
+	if (mqdes == (mqd_t)ERROR || strlen(name) >= MAX_PORT_NAME_SIZE) {
+		return mqdes;
+	}
+
+	messaging_mqcache_lock();
+	entry = messaging_mqcache_alloc(pid);
+	if (entry != NULL) {
+		entry->pid = pid;
+		entry->oflags = oflags & O_ACCMODE;
+		entry->mqdes = mqdes;
+		entry->stamp = ++g_msg_mqcache_stamp;
+		strncpy(entry->name, name, MAX_PORT_NAME_SIZE);
+	}
+	messaging_mqcache_unlock();
+
+	return mqdes;
+}
+
+/****************************************************************************
+ * Name : messaging_mq_close
+ *
+ * Description:
+ *  Give back a descriptor from messaging_mq_open(). It stays open if it is
+ *  cached, and is closed otherwise.
+ ****************************************************************************/
+void messaging_mq_close(mqd_t mqdes)
+{
+	pid_t pid;
+	int idx;
+
+	pid = getpid();
+
+	messaging_mqcache_lock();
+	for (idx = 0; idx < CONFIG_MESSAGING_PORT_CACHE_SIZE; idx++) {
+		if (g_msg_mqcache[idx].pid == pid && g_msg_mqcache[idx].mqdes == mqdes) {
+			messaging_mqcache_unlock();
+			return;
+		}
+	}
+	messaging_mqcache_unlock();
+
+	mq_close(mqdes);
+}
+
+/****************************************************************************
+ * Name : messaging_mq_drop
+ *
+ * Description:
+ *  Close a descriptor from messaging_mq_open() after an error, so that the
+ *  next open of the queue looks it up again.
+ ****************************************************************************/
+void messaging_mq_drop(mqd_t mqdes)
+{
+	pid_t pid;
+	int idx;
+
+	pid = getpid();
+
+	messaging_mqcache_lock();
+	for (idx = 0; idx < CONFIG_MESSAGING_PORT_CACHE_SIZE; idx++) {
+		if (g_msg_mqcache[idx].pid == pid && g_msg_mqcache[idx].mqdes == mqdes) {
+			g_msg_mqcache[idx].pid = MSG_MQCACHE_FREE;
+			break;
+		}
+	}
+	messaging_mqcache_unlock();
+
+	mq_close(mqdes);
+}
+
+/****************************************************************************
+ * Name : messaging_mq_cleanup
+ *
+ * Description:
+ *  Close and unlink the queues which this task keeps for port_name: the
+ *  queue of its block receive and the queue of its sync replies.
+ *
+ * Return Value:
+ *  The number of queues which were closed.
+ ****************************************************************************/
+int messaging_mq_cleanup(const char *port_name)
+{
+	char *recv_portname;
+	char *reply_portname;
+	struct msg_mqcache_s *entry;
+	int nclosed = 0;
+	pid_t pid;
+	int idx;
+
+	pid = getpid();
+	MSG_ASPRINTF(&recv_portname, "%s%d", port_name, pid);
+	if (recv_portname == NULL) {
+		return 0;
+	}
+	MSG_ASPRINTF(&reply_portname, "%s%d%s", port_name, pid, "_r");
+	if (reply_portname == NULL) {
+		MSG_FREE(recv_portname);
+		return 0;
+	}
+
+	messaging_mqcache_lock();
+	for (idx = 0; idx < CONFIG_MESSAGING_PORT_CACHE_SIZE; idx++) {
+		entry = &g_msg_mqcache[idx];
+		if (entry->pid != pid || entry->oflags != O_RDONLY) {
+			continue;
+		}
+		if (strncmp(entry->name, recv_portname, MAX_PORT_NAME_SIZE) == 0) {
+			mq_close(entry->mqdes);
+			mq_unlink(recv_portname);
+		} else if (strncmp(entry->name, reply_portname, MAX_PORT_NAME_SIZE) == 0) {
+			mq_close(entry->mqdes);
+			mq_unlink(reply_portname);
+		} else {
+			continue;
+		}
+		entry->pid = MSG_MQCACHE_FREE;
+		nclosed++;
+	}
+	messaging_mqcache_unlock();
+
+	MSG_FREE(recv_portname);
+	MSG_FREE(reply_portname);
+	return nclosed;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+/****************************************************************************
+ * Name : messaging_connect
+ *
+ * Description:
+ *  Look up the receiver of port_name once and keep its message queue open.
+ ****************************************************************************/
+msg_port_t *messaging_connect(const char *port_name)
+{
+	int ret;
+	int recv_arr[CONFIG_MESSAGING_RECV_LIST_SIZE];
+	int recv_cnt = 0;
+	char *private_portname;
+	msg_port_t *port;
+
+	if (port_name == NULL || strlen(port_name) >= MAX_PORT_NAME_SIZE) {
+		msgdbg("[Messaging] connect fail : invalid port name.\n");
+		return NULL;
+	}
+
+	ret = READ_MSG_RECEIVER(port_name, recv_arr, recv_cnt);
+	if (ret == ERROR || recv_cnt == 0) {
+		msgdbg("[Messaging] connect fail : no receiver.\n");
+		return NULL;
+	}
+	if (recv_cnt > 1) {
+		msgdbg("[Messaging] connect fail : too many receivers(%d) are waiting.\n", recv_cnt);
+		return NULL;
+	}
+
+	port = (msg_port_t *)MSG_ALLOC(sizeof(msg_port_t));
+	if (port == NULL) {
+		msgdbg("[Messaging] connect fail : out of memory.\n");
+		return NULL;
+	}
+
+	MSG_ASPRINTF(&private_portname, "%s%d", port_name, recv_arr[0]);
+	if (private_portname == NULL) {
+		msgdbg("[Messaging] connect fail : out of memory for private portname.\n");
+		MSG_FREE(port);
+		return NULL;
+	}
+
+	port->mqdes = mq_open(private_portname, O_WRONLY);
+	MSG_FREE(private_portname);
+	if (port->mqdes == (mqd_t)ERROR) {
+		msgdbg("[Messaging] connect fail : open fail, errno %d.\n", errno);
+		MSG_FREE(port);
+		return NULL;
+	}
+
+	strncpy(port->name, port_name, MAX_PORT_NAME_SIZE);
+	port->recv_pid = recv_arr[0];
+	return port;
+}
+
+/****************************************************************************
+ * Name : messaging_port_send
+ ****************************************************************************/
+int messaging_port_send(msg_port_t *port, msg_send_data_t *send_data)
+{
+	if (port == NULL) {
+		msgdbg("[Messaging] port send fail : no port.\n");
+		return ERROR;
+	}
+
+	if (send_data == NULL || send_data->msg == NULL || send_data->msglen <= 0 || send_data->priority < 0) {
+		msgdbg("[Messaging] port send fail : invalid param of send data.\n");
+		return ERROR;
+	}
+
+	return messaging_send_mq(port->mqdes, MSG_SEND_NOREPLY, send_data);
+}
+
+/****************************************************************************
+ * Name : messaging_port_send_sync
+ ****************************************************************************/
+int messaging_port_send_sync(msg_port_t *port, msg_send_data_t *send_data, msg_recv_buf_t *reply_buf)
+{
+	int ret;
+
+	if (port == NULL) {
+		msgdbg("[Messaging] port send sync fail : no port.\n");
+		return ERROR;
+	}
+
+	if (send_data == NULL || send_data->msg == NULL || send_data->msglen <= 0 || send_data->priority < 0) {
+		msgdbg("[Messaging] port send sync fail : invalid param of send data.\n");
+		return ERROR;
+	}
+
+	if (reply_buf == NULL || reply_buf->buf == NULL || reply_buf->buflen <= 0) {
+		msgdbg("[Messaging] port send sync fail : invalid param of reply buf\n");
+		return ERROR;
+	}
+
+	ret = messaging_send_mq(port->mqdes, MSG_SEND_SYNC, send_data);
+	if (ret != OK) {
+		return ERROR;
+	}
+
+	return messaging_sync_recv(port->name, reply_buf);
+}
+
+/****************************************************************************
+ * Name : messaging_disconnect
+ ****************************************************************************/
+int messaging_disconnect(msg_port_t *port)
+{
+	int ret;
+
+	if (port == NULL) {
+		msgdbg("[Messaging] disconnect fail : no port.\n");
+		return ERROR;
+	}
+
+	ret = mq_close(port->mqdes);
+	MSG_FREE(port);
+	return ret;
+}
@@ -171,9 +171,16 @@ static int messaging_rcv_block(mqd_t mqdes, const char *port_name, msg_recv_buf_
 	int recv_size;
 	char *recv_packet;
 	int msg_type = OK;
+#ifndef CONFIG_MESSAGING_PORT_CACHE
 	char *internal_portname;
+#endif
 
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	/* The queue was made for the largest message, see messaging_recv_internal(). */
+	recv_size = CONFIG_MQ_MAXMSGSIZE;
+#else
 	recv_size = MSG_HEADER_SIZE + recv_buf->buflen;
+#endif
 	recv_packet = (char *)MSG_ALLOC(recv_size);
 	if (recv_packet == NULL) {
 		msgdbg("[Messaging] recv fail : out of memory for packet.\n");
@@ -196,10 +203,15 @@ static int messaging_rcv_block(mqd_t mqdes, const char *port_name, msg_recv_buf_
 
 cleanup_return:
 	MSG_FREE(recv_packet);
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	/* The queue stays open for the next receive, senders keep sending to it. */
+	messaging_mq_close(mqdes);
+#else
 	mq_close(mqdes);
 	MSG_ASPRINTF(&internal_portname, "%s%d", port_name, getpid());
 	mq_unlink(internal_portname);
 	MSG_FREE(internal_portname);
+#endif
 	return msg_type;
 }
 /****************************************************************************
@@ -234,7 +246,19 @@ int messaging_recv_internal(const char *port_name, msg_recv_buf_t *recv_buf, msg
 
 	if (cb_info == NULL) {
 		/* This is block receive case. */
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+		/* The queue is kept open until messaging_cleanup(). Later receives may
+		 * have larger buffers, so it takes messages of the largest size.
+		 */
+		if (internal_attr.mq_msgsize > CONFIG_MQ_MAXMSGSIZE) {
+			MSG_FREE(internal_portname);
+			msgdbg("[Messaging] recv fail : buffer is larger than a message.\n");
+			return ERROR;
+		}
+		mqdes = messaging_mq_open(internal_portname, O_RDONLY | O_CREAT);
+#else
 		mqdes = mq_open(internal_portname, O_RDONLY | O_CREAT, 0666, &internal_attr);
+#endif
 	} else {
 		/* This is non-block receive case. */
 		mqdes = mq_open(internal_portname, O_RDONLY | O_CREAT | O_NONBLOCK, 0666, &internal_attr);
@@ -249,7 +273,15 @@ int messaging_recv_internal(const char *port_name, msg_recv_buf_t *recv_buf, msg
 	/* Save the receivers information. It will be used by sender to check the receivers. */
 	ret = SAVE_MSG_RECEIVER(port_name);
 	if (ret != OK) {
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+		if (cb_info == NULL) {
+			messaging_mq_drop(mqdes);
+		} else {
+			mq_close(mqdes);
+		}
+#else
 		mq_close(mqdes);
+#endif
 		mq_unlink(internal_portname);
 		MSG_FREE(internal_portname);
 		return ERROR;
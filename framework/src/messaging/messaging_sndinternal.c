@@ -90,52 +90,34 @@ static int messaging_set_async_callback(const char *port_name, msg_recv_buf_t *r
 	return OK;
 }
 /****************************************************************************
- * Name : messaging_send_packet
- * 
+ * Name : messaging_send_mq
+ *
  * Description:
- *  This function calls receive function based on receive type.
+ *  This function adds the header to the message and sends it to mqdes.
  *
  * Input Parameters:
- *  port_name : The message port name to send
- *  msg       : The message to be sent
- *  msglen    : The length of message to be sent
- *  priority  : A non-negative integer that specifies the priority of this message
- * 
+ *  mqdes     : The message queue descriptor to send
+ *  msg_type  : The type of sending message
+ *  send_data : The message, its length and priority
+ *
  * Return Value:
  *  On success, 0 (OK) is returned.; On failure, -1 (ERROR) is returned.
  ****************************************************************************/
-int messaging_send_packet(const char *port_name, msg_send_type_t msg_type, msg_send_data_t *send_data, msg_callback_info_t *cb_info)
+int messaging_send_mq(mqd_t mqdes, msg_send_type_t msg_type, msg_send_data_t *send_data)
 {
 	int ret = OK;
-	mqd_t mqdes;
-	struct mq_attr internal_attr;
 	char *send_packet;
 	int send_size;
 	uint32_t send_type;
 	uint32_t msg_offset;
 	uint32_t msg_version;
+	bool buf_ref;
 
 	send_size = MSG_HEADER_SIZE + send_data->msglen;
 
-	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
-	internal_attr.mq_msgsize = send_size;
-	internal_attr.mq_flags = 0;
-
-	mqdes = mq_open(port_name, O_WRONLY, 0666, &internal_attr);
-	if (mqdes == (mqd_t)ERROR) {
-		if (errno == ENOENT) {
-			msgdbg("[Messagmemcpying] send fail : no receiver.\n");
-		} else {
-			msgdbg("[Messaging] send fail : open fail, errno %d.\n", errno);
-		}
-		return ERROR;
-	}
-
 	send_packet = (char *)MSG_ALLOC(send_size);
 	if (send_packet == NULL) {
 		msgdbg("[Messaging] send fail : out of memory for including header.\n");
-		mq_close(mqdes);
-		mq_unlink(port_name);
 		return ERROR;
 	}
 
@@ -157,8 +139,8 @@ int messaging_send_packet(const char *port_name, msg_send_type_t msg_type, msg_s
 	/* Add data header for send type. */
 	if (msg_type == MSG_SEND_NOREPLY || msg_type == MSG_SEND_MULTI) {
 		send_type = MSG_REPLY_NO_REQUIRED;
-	} else if (msg_type == MSG_SEND_REPLY) {
-		send_type = MSG_SEND_REPLY;
+	} else if (msg_type == MSG_SEND_REPLY || msg_type == MSG_SEND_SYNC_DIRECT || msg_type == MSG_SEND_MULTI_SHARED) {
+		send_type = msg_type;
 	} else {
 		send_type = MSG_REPLY_REQUIRED;
 	}
@@ -167,18 +149,81 @@ int messaging_send_packet(const char *port_name, msg_send_type_t msg_type, msg_s
 	/* Copy the real send message. */
 	memcpy(send_packet + msg_offset, send_data->msg, send_data->msglen);
 
+	/* A shared buffer handle carries one reference for the receiver. */
+	buf_ref = messaging_buf_ref(send_data);
+
 	ret = mq_send(mqdes, (char *)send_packet, send_size, send_data->priority);
 	if (ret != OK) {
 		msgdbg("[Messaging] send fail : errno %d.\n", errno);
+		if (buf_ref) {
+			messaging_buf_unref(send_data);
+		}
 		MSG_FREE(send_packet);
+		return ERROR;
+	}
+
+	MSG_FREE(send_packet);
+	return OK;
+}
+
+/****************************************************************************
+ * Name : messaging_send_packet
+ * 
+ * Description:
+ *  This function opens the message queue of port_name and sends the message.
+ *  With CONFIG_MESSAGING_PORT_CACHE, the descriptor is kept open for the
+ *  next sends of this task.
+ *
+ * Input Parameters:
+ *  port_name : The message port name to send
+ *  msg       : The message to be sent
+ *  msglen    : The length of message to be sent
+ *  priority  : A non-negative integer that specifies the priority of this message
+ * 
+ * Return Value:
+ *  On success, 0 (OK) is returned.; On failure, -1 (ERROR) is returned.
+ ****************************************************************************/
+int messaging_send_packet(const char *port_name, msg_send_type_t msg_type, msg_send_data_t *send_data, msg_callback_info_t *cb_info)
+{
+	int ret;
+	mqd_t mqdes;
+#ifndef CONFIG_MESSAGING_PORT_CACHE
+	struct mq_attr internal_attr;
+
+	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
+	internal_attr.mq_msgsize = MSG_HEADER_SIZE + send_data->msglen;
+	internal_attr.mq_flags = 0;
+
+	mqdes = mq_open(port_name, O_WRONLY, 0666, &internal_attr);
+#else
+	mqdes = messaging_mq_open(port_name, O_WRONLY);
+#endif
+	if (mqdes == (mqd_t)ERROR) {
+		if (errno == ENOENT) {
+			msgdbg("[Messaging] send fail : no receiver.\n");
+		} else {
+			msgdbg("[Messaging] send fail : open fail, errno %d.\n", errno);
+		}
+		return ERROR;
+	}
+
+	ret = messaging_send_mq(mqdes, msg_type, send_data);
+	if (ret != OK) {
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+		messaging_mq_drop(mqdes);
+#else
 		mq_close(mqdes);
+#endif
 		mq_unlink(port_name);
 		return ERROR;
 	}
 
-	MSG_FREE(send_packet);
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	messaging_mq_close(mqdes);
+#else
 	mq_close(mqdes);
-	return ret;
+#endif
+	return OK;
 }
 
 static void messaging_init_recv_arr(int *arr)
@@ -221,7 +266,7 @@ int messaging_send_internal(const char *port_name, msg_send_type_t msg_type, msg
 			return ERROR;
 		}
 
-		if (msg_type != MSG_SEND_MULTI && recv_cnt > 1) {
+		if (msg_type != MSG_SEND_MULTI && msg_type != MSG_SEND_MULTI_SHARED && recv_cnt > 1) {
 			msgdbg("[Messaging] send fail : too many receivers(%d)are waiting.\n", recv_cnt);
 			return ERROR;
 		}
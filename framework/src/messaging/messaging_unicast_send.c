@@ -47,21 +47,25 @@ static int messaging_send_param_validation(const char *port_name, msg_send_data_
 
 	return OK;
 }
-static int messaging_sync_recv(const char *port_name, msg_recv_buf_t *reply_buf)
+int messaging_sync_recv(const char *port_name, msg_recv_buf_t *reply_buf)
 {
 	int ret = OK;
 	mqd_t sync_mqdes;
 	char *sync_portname;
+#ifndef CONFIG_MESSAGING_PORT_CACHE
 	struct mq_attr internal_attr;
+#endif
 	char *reply_data;
 	int reply_size;
 	int msg_type;
 
 	reply_size = reply_buf->buflen + MSG_HEADER_SIZE;
 
+#ifndef CONFIG_MESSAGING_PORT_CACHE
 	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
 	internal_attr.mq_msgsize = reply_size;
 	internal_attr.mq_flags = 0;
+#endif
 
 	/* sender waits the reply with "port_name + sender_pid + _r". */
 	MSG_ASPRINTF(&sync_portname, "%s%d%s", port_name, getpid(), "_r");
@@ -69,7 +73,20 @@ static int messaging_sync_recv(const char *port_name, msg_recv_buf_t *reply_buf)
 		msgdbg("message send fail : sync portname allocation fail.\n");
 		return ERROR;
 	}
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	/* The reply queue stays until messaging_cleanup(). Its messages have the
+	 * largest size, the reply is read whole and cut to buflen.
+	 */
+	if (reply_size > CONFIG_MQ_MAXMSGSIZE) {
+		msgdbg("message send fail : reply buffer is larger than a message.\n");
+		MSG_FREE(sync_portname);
+		return ERROR;
+	}
+	sync_mqdes = messaging_mq_open(sync_portname, O_RDONLY | O_CREAT);
+	reply_size = CONFIG_MQ_MAXMSGSIZE;
+#else
 	sync_mqdes = mq_open(sync_portname, O_RDONLY | O_CREAT, 0666, &internal_attr);
+#endif
 	if (sync_mqdes == (mqd_t)ERROR) {
 		msgdbg("message send fail : sync open fail %d.\n", errno);
 		MSG_FREE(sync_portname);
@@ -79,8 +96,13 @@ static int messaging_sync_recv(const char *port_name, msg_recv_buf_t *reply_buf)
 	reply_data = (char *)MSG_ALLOC(reply_size);
 	if (reply_data == NULL) {
 		msgdbg("message send fail : out of memory for including header\n");
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+		messaging_mq_close(sync_mqdes);
+#else
 		mq_close(sync_mqdes);
 		mq_unlink(sync_portname);
+#endif
+		MSG_FREE(sync_portname);
 		return ERROR;
 	}
 
@@ -95,8 +117,12 @@ static int messaging_sync_recv(const char *port_name, msg_recv_buf_t *reply_buf)
 		}
 	}
 
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	messaging_mq_close(sync_mqdes);
+#else
 	mq_close(sync_mqdes);
 	mq_unlink(sync_portname);
+#endif
 	MSG_FREE(reply_data);
 	MSG_FREE(sync_portname);
 
@@ -123,6 +149,13 @@ int messaging_send_sync(const char *port_name, msg_send_data_t *send_data, msg_r
 		return ERROR;
 	}
 
+#ifdef CONFIG_MESSAGING_SYNC_DIRECT
+	/* The address of the request must fit where the message would. */
+	if (send_data->msglen >= (int)sizeof(void *)) {
+		return messaging_sync_direct(port_name, send_data, reply_buf);
+	}
+#endif
+
 	ret = messaging_send_internal(port_name, MSG_SEND_SYNC, send_data, NULL, NULL);
 	if (ret == ERROR) {
 		return ERROR;
@@ -211,6 +244,13 @@ int messaging_reply(const char *port_name, pid_t sender_pid, msg_send_data_t *re
 		return ERROR;
 	}
 
+#ifdef CONFIG_MESSAGING_SYNC_DIRECT
+	if (messaging_reply_direct(port_name, sender_pid, reply_data) == OK) {
+		MSG_FREE(reply_portname);
+		return OK;
+	}
+#endif
+
 	reply.msg = reply_data->msg;
 	reply.msglen = reply_data->msglen;
 	reply.priority = MSG_REPLY_PRIO;
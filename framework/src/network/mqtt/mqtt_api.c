@@ -272,6 +272,13 @@ mqtt_client_t *mqtt_init_client(mqtt_client_config_t *config)
 		ndbg("ERROR: fail to set mqtt protocol version.\n");
 		goto done;
 	}
+
+	/* set inflight window of publishes */
+	ret = mosquitto_int_option((struct mosquitto *)mqtt_client->mosq, MOSQ_OPT_SEND_MAXIMUM, config->max_inflight > 0 ? config->max_inflight : CONFIG_NETUTILS_MQTT_MAX_INFLIGHT);
+	if (ret != MOSQ_ERR_SUCCESS) {
+		ndbg("ERROR: fail to set max inflight messages.\n");
+		goto done;
+	}
 #if defined(CONFIG_NETUTILS_MQTT_SECURITY)
 	if (config->tls) {
 		struct mosquitto *tmp = (struct mosquitto *)mqtt_client->mosq;
@@ -556,6 +563,47 @@ done:
 	return result;
 }
 
+/****************************************************************************
+ * Name: mqtt_get_inflight
+ *
+ * Description:
+ *	 Get the number of publishes waiting for their acknowledgement and the
+ *	 number of publishes queued behind the inflight window.
+ *
+ * Parameters:
+ *     handle : the handle of MQTT client object
+ *     inflight : the number of publishes sent and not acknowledged
+ *     queued : the number of publishes waiting to be sent
+ *
+ * Returned Value:
+ *	 On success, 0 is returned. On failure, a negative value is returned.
+ *
+ ****************************************************************************/
+int mqtt_get_inflight(mqtt_client_t *handle, int *inflight, int *queued)
+{
+	struct mosquitto *mosq = NULL;
+	int sent;
+
+	if (handle == NULL || inflight == NULL || queued == NULL) {
+		ndbg("ERROR: invalid parameter.\n");
+		return -1;
+	}
+
+	mosq = (struct mosquitto *)handle->mosq;
+	if (mosq == NULL) {
+		ndbg("ERROR: mosquitto handle is null.\n");
+		return -1;
+	}
+
+	pthread_mutex_lock(&mosq->msgs_out.mutex);
+	sent = mosq->msgs_out.inflight_maximum - mosq->msgs_out.inflight_quota;
+	*inflight = sent;
+	*queued = mosq->msgs_out.queue_len - sent;
+	pthread_mutex_unlock(&mosq->msgs_out.mutex);
+
+	return 0;
+}
+
 /****************************************************************************
  * Name: mqtt_subscribe
  *
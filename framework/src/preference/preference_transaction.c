@@ -0,0 +1,42 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <sys/prctl.h>
+
+#include <tinyara/preference.h>
+#include <preference/preference.h>
+
+/****************************************************************************
+ * Transaction Functions
+ ****************************************************************************/
+int preference_begin(void)
+{
+	return prctl(PR_BEGIN_PREFERENCE);
+}
+
+int preference_commit(void)
+{
+	return prctl(PR_COMMIT_PREFERENCE);
+}
+
+int preference_discard(void)
+{
+	return prctl(PR_DISCARD_PREFERENCE);
+}
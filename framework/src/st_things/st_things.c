@@ -16,9 +16,15 @@
  *
  ******************************************************************/
 
+#include <tinyara/config.h>
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/time.h>
 
 #include "st_things.h"
 #include "st_things_request_handler.h"
@@ -31,6 +37,7 @@
 #include "ocpayload.h"
 #include "octypes.h"
 #include "ocstack.h"
+#include "utils/things_rtos_util.h"
 
 #define TAG "[st_things_sdk]"
 
@@ -57,6 +64,21 @@ typedef enum {
 
 static stack_status_e g_stack_status = STACK_NOT_INITIALIZED;
 
+static pthread_mutex_t g_notify_lock = PTHREAD_MUTEX_INITIALIZER;
+static st_things_notify_stats_s g_notify_stats;
+
+#ifdef CONFIG_ST_THINGS_NOTIFY_BATCH
+/* The updated resources of the window fill one of the two batches, while
+ * the flush notifies the other one.  g_flush_lock serializes the flushes.
+ */
+static pthread_mutex_t g_flush_lock = PTHREAD_MUTEX_INITIALIZER;
+static char g_notify_batch[2][CONFIG_ST_THINGS_NOTIFY_BATCH_MAX][MAX_RESOURCE_LEN];
+static int g_notify_count;
+static int g_notify_fill;
+static sem_t g_notify_sem;
+static bool g_notify_thread_started = false;
+#endif
+
 /**
  * This callback will be invoked by DA Stack with the result of reset.
  * Result will be passed to the application through its registered callback.
@@ -510,10 +532,8 @@ int st_things_register_things_status_change_cb(st_things_status_change_cb status
 	return ST_THINGS_ERROR_NONE;
 }
 
-int st_things_notify_observers(const char *resource_uri)
+static int check_stack_started(void)
 {
-	THINGS_LOG_D(TAG, THINGS_FUNC_ENTRY);
-
 	if (STACK_STARTED != g_stack_status) {
 		int ret_val = ST_THINGS_ERROR_OPERATION_FAILED;
 		switch (g_stack_status) {
@@ -530,6 +550,44 @@ int st_things_notify_observers(const char *resource_uri)
 			break;
 		}
 
+		return ret_val;
+	}
+
+	return ST_THINGS_ERROR_NONE;
+}
+
+static int notify_resource(const char *resource_uri)
+{
+	struct timeval start;
+	struct timeval end;
+	int result;
+
+	gettimeofday(&start, NULL);
+	result = things_notify_observers(resource_uri);
+	gettimeofday(&end, NULL);
+
+	pthread_mutex_lock(&g_notify_lock);
+	g_notify_stats.notifications++;
+	g_notify_stats.notify_usec += (end.tv_sec - start.tv_sec) * 1000000 + (end.tv_usec - start.tv_usec);
+	if (1 != result) {
+		g_notify_stats.failures++;
+	}
+	pthread_mutex_unlock(&g_notify_lock);
+
+	if (1 != result) {
+		THINGS_LOG_E(TAG, "things_notify_observers failed (result:%d)", result);
+		return ST_THINGS_ERROR_OPERATION_FAILED;
+	}
+
+	return ST_THINGS_ERROR_NONE;
+}
+
+int st_things_notify_observers(const char *resource_uri)
+{
+	THINGS_LOG_D(TAG, THINGS_FUNC_ENTRY);
+
+	int ret_val = check_stack_started();
+	if (ST_THINGS_ERROR_NONE != ret_val) {
 		THINGS_LOG_D(TAG, THINGS_FUNC_EXIT);
 		return ret_val;
 	}
@@ -540,14 +598,150 @@ int st_things_notify_observers(const char *resource_uri)
 		return ST_THINGS_ERROR_INVALID_PARAMETER;
 	}
 
-	int result = 0;
-	if (1 != (result = things_notify_observers(resource_uri))) {
-		THINGS_LOG_E(TAG, "things_notify_observers failed (result:%d)", result);
+	ret_val = notify_resource(resource_uri);
+
+	THINGS_LOG_D(TAG, THINGS_FUNC_EXIT);
+	return ret_val;
+}
+
+#ifdef CONFIG_ST_THINGS_NOTIFY_BATCH
+/**
+ * This thread waits for the first update of a window, and flushes the batch
+ * at the end of the window.
+ */
+static void *notify_batch_loop(void *arg)
+{
+	while (1) {
+		if (sem_wait(&g_notify_sem) != 0) {
+			continue;
+		}
+
+		usleep(CONFIG_ST_THINGS_NOTIFY_BATCH_WINDOW_MS * 1000);
+		(void)st_things_flush_notifications();
+	}
+
+	return NULL;
+}
+#endif
+
+int st_things_notify_observers_batched(const char *resource_uri)
+{
+	THINGS_LOG_D(TAG, THINGS_FUNC_ENTRY);
+
+	int ret_val = check_stack_started();
+	if (ST_THINGS_ERROR_NONE != ret_val) {
 		THINGS_LOG_D(TAG, THINGS_FUNC_EXIT);
-		return ST_THINGS_ERROR_OPERATION_FAILED;
+		return ret_val;
+	}
+
+	if (NULL == resource_uri || 1 > strlen(resource_uri) || MAX_RESOURCE_LEN <= strlen(resource_uri)) {
+		THINGS_LOG_E(TAG, "The resource URI is invalid");
+		THINGS_LOG_D(TAG, THINGS_FUNC_EXIT);
+		return ST_THINGS_ERROR_INVALID_PARAMETER;
 	}
 
+#ifdef CONFIG_ST_THINGS_NOTIFY_BATCH
+	bool wakeup = false;
+	int i;
+
+	pthread_mutex_lock(&g_notify_lock);
+	g_notify_stats.updates++;
+
+	if (!g_notify_thread_started) {
+		pthread_t thread;
+
+		sem_init(&g_notify_sem, 0, 0);
+		if (pthread_create_rtos(&thread, NULL, notify_batch_loop, NULL, THINGS_STACK_NOTIFY_BATCH_THREAD) != 0) {
+			THINGS_LOG_E(TAG, "Create thread is failed.");
+			sem_destroy(&g_notify_sem);
+			pthread_mutex_unlock(&g_notify_lock);
+			ret_val = notify_resource(resource_uri);
+			THINGS_LOG_D(TAG, THINGS_FUNC_EXIT);
+			return ret_val;
+		}
+		g_notify_thread_started = true;
+	}
+
+	for (i = 0; i < g_notify_count; i++) {
+		if (strncmp(g_notify_batch[g_notify_fill][i], resource_uri, MAX_RESOURCE_LEN) == 0) {
+			// The notification will read the latest values.
+			g_notify_stats.coalesced++;
+			pthread_mutex_unlock(&g_notify_lock);
+			THINGS_LOG_D(TAG, THINGS_FUNC_EXIT);
+			return ST_THINGS_ERROR_NONE;
+		}
+	}
+
+	if (g_notify_count < CONFIG_ST_THINGS_NOTIFY_BATCH_MAX) {
+		strncpy(g_notify_batch[g_notify_fill][g_notify_count], resource_uri, MAX_RESOURCE_LEN);
+		wakeup = (g_notify_count++ == 0);
+		pthread_mutex_unlock(&g_notify_lock);
+
+		if (wakeup) {
+			sem_post(&g_notify_sem);
+		}
+
+		THINGS_LOG_D(TAG, THINGS_FUNC_EXIT);
+		return ST_THINGS_ERROR_NONE;
+	}
+
+	g_notify_stats.overflows++;
+	pthread_mutex_unlock(&g_notify_lock);
+#else
+	pthread_mutex_lock(&g_notify_lock);
+	g_notify_stats.updates++;
+	pthread_mutex_unlock(&g_notify_lock);
+#endif
+
+	ret_val = notify_resource(resource_uri);
+
 	THINGS_LOG_D(TAG, THINGS_FUNC_EXIT);
+	return ret_val;
+}
+
+int st_things_flush_notifications(void)
+{
+	int ret_val = ST_THINGS_ERROR_NONE;
+
+#ifdef CONFIG_ST_THINGS_NOTIFY_BATCH
+	int batch;
+	int count;
+	int i;
+
+	pthread_mutex_lock(&g_flush_lock);
+
+	pthread_mutex_lock(&g_notify_lock);
+	batch = g_notify_fill;
+	count = g_notify_count;
+	g_notify_fill ^= 1;
+	g_notify_count = 0;
+	pthread_mutex_unlock(&g_notify_lock);
+
+	for (i = 0; i < count; i++) {
+		if (notify_resource(g_notify_batch[batch][i]) != ST_THINGS_ERROR_NONE) {
+			ret_val = ST_THINGS_ERROR_OPERATION_FAILED;
+		}
+	}
+
+	pthread_mutex_unlock(&g_flush_lock);
+#endif
+
+	return ret_val;
+}
+
+int st_things_get_notify_stats(st_things_notify_stats_s *stats, bool reset)
+{
+	if (NULL == stats) {
+		return ST_THINGS_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_mutex_lock(&g_notify_lock);
+	*stats = g_notify_stats;
+	if (reset) {
+		memset(&g_notify_stats, 0, sizeof(g_notify_stats));
+	}
+	pthread_mutex_unlock(&g_notify_lock);
+
 	return ST_THINGS_ERROR_NONE;
 }
 
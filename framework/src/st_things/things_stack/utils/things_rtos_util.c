@@ -46,6 +46,7 @@ static const thread_info_s things_stack_thread_name[THINGS_STACK_MAX_INDEX + 1]
 	{"THINGS_STACK_FOTA_UPDATE", 6 * 1024},	/*THINGS_STACK_FOTA_THREAD */
 	{"THINGS_STACK_AP_INFO_SET", 4 * 1024},/*THINGS_STACK_AP_INFO_SET_THREAD */
 	{"THINGS_STACK_AP_SCAN_THREAD", 1024},/*THINGS_STACK_AP_SCAN_THREAD */
+	{"THINGS_STACK_NOTIFY_BATCH", 4 * 1024},	/*THINGS_STACK_NOTIFY_BATCH_THREAD */
 	{"THINGS_STACK_MAX_INDEX", 8 * 1024}		/*THINGS_STACK_MAX_INDEX */
 };
 
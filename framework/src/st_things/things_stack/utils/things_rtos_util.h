@@ -35,6 +35,7 @@ typedef enum {
 	THGINS_STACK_FOTA_UPDATE_THREAD,
 	THINGS_STACK_AP_INFO_SET_THREAD,
 	THINGS_STACK_AP_SCAN_THREAD,
+	THINGS_STACK_NOTIFY_BATCH_THREAD,
 	THINGS_STACK_MAX_INDEX,
 } things_stack_thread_name_e;
 
@@ -39,6 +39,9 @@
 #include <tinyara/fs/ioctl.h>
 #include <tinyara/clock.h>
 #include <tinyara/task_manager_drv.h>
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+#include <tinyara/task_monitor.h>
+#endif
 #include <task_manager/task_manager.h>
 #ifdef CONFIG_TASK_MANAGER_USER_SPECIFIC_BROADCAST
 #include <task_manager/task_manager_broadcast_list.h>
@@ -60,7 +63,15 @@ static app_list_t tm_app_list[CONFIG_TASK_MANAGER_MAX_TASKS];
 static tm_task_info_t tm_task_list[CONFIG_TASK_MANAGER_MAX_TASKS];
 static bool g_handle_hash[CONFIG_TASK_MANAGER_MAX_TASKS];
 static int tm_broadcast_msg[TM_BROADCAST_MSG_MAX + CONFIG_TASK_MANAGER_MAX_TASKS];
+/* Handles which set a callback for each broadcast msg, one bit per handle */
+#define TM_BROADCAST_MASK_WORDS  ((CONFIG_TASK_MANAGER_MAX_TASKS + 31) / 32)
+static uint32_t tm_broadcast_mask[TM_BROADCAST_MSG_MAX + CONFIG_TASK_MANAGER_MAX_TASKS][TM_BROADCAST_MASK_WORDS];
 static int task_manager_pid;
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+/* The task monitor signals its events, which wakes up the main loop */
+static mqd_t g_tm_monitor_mqfd;
+static volatile bool g_tm_monitor_pending;
+#endif
 
 #define MAX_HANDLE_MASK      (CONFIG_TASK_MANAGER_MAX_TASKS - 1)
 #define HANDLE_HASH(handle)  ((handle) & MAX_HANDLE_MASK)
@@ -68,6 +79,9 @@ static int task_manager_pid;
 #define TYPE_EXIT        2
 
 #define CB_MSG_OF(X)        (X)->cb_data->msg
+
+#define BROADCAST_MASK_SET(msg, handle)  (tm_broadcast_mask[(msg) - 1][(handle) / 32] |= (1U << ((handle) % 32)))
+#define BROADCAST_MASK_CLR(msg, handle)  (tm_broadcast_mask[(msg) - 1][(handle) / 32] &= ~(1U << ((handle) % 32)))
 #define CB_MSGSIZE_OF(X)    (X)->cb_data->msg_size
 
 #define SET_REGISTER_INFO(handle, type, idx, caller_pid, permission)    \
@@ -221,6 +235,7 @@ static void taskmgr_clear_broadcast_info_list(int handle)
 	tm_broadcast_info_t *curr;
 
 	while ((curr = (tm_broadcast_info_t *)sq_remfirst(&TM_BROADCAST_INFO_LIST(handle))) != NULL) {
+		BROADCAST_MASK_CLR(curr->msg, handle);
 		TM_FREE(curr);
 	}
 }
@@ -919,6 +934,9 @@ int taskmgr_get_handle_by_pid(int pid)
 
 static int taskmgr_check_broad_msg(int msg)
 {
+	if (msg <= 0 || msg > TM_BROADCAST_MSG_MAX + CONFIG_TASK_MANAGER_MAX_TASKS) {
+		return TM_UNREGISTERED_MSG;
+	}
 	if (tm_broadcast_msg[msg - 1] == msg) {
 		return OK;
 	}
@@ -943,21 +961,44 @@ static tm_broadcast_info_t *taskmgr_search_broadcast_info(int msg, int handle)
 	return NULL;
 }
 
+/* The data is copied once into a payload shared by all the receivers, each
+ * holding a reference. Only the handles in the mask of the msg are visited.
+ */
 static int taskmgr_broadcast(tm_internal_msg_t *arg)
 {
 	int handle;
+	int word;
 	int ret;
+	uint32_t mask;
 	union sigval msg_broad;
 	tm_broadcast_info_t *broadcast_info;
 	tm_broadcast_internal_msg_t *bm;
+	tm_broadcast_payload_t *payload;
 
 	ret = taskmgr_check_broad_msg(arg->type);
 	if (ret == TM_UNREGISTERED_MSG) {
 		return ret;
 	}
 
-	for (handle = 0; handle < CONFIG_TASK_MANAGER_MAX_TASKS; handle++) {
-		if (TM_LIST_ADDR(handle) != NULL) {
+	payload = NULL;
+	if (arg->msg_size > 0) {
+		payload = (tm_broadcast_payload_t *)TM_ALLOC(sizeof(tm_broadcast_payload_t) + arg->msg_size);
+		if (payload == NULL) {
+			return TM_OUT_OF_MEMORY;
+		}
+		payload->refs = 1;
+		memcpy(payload->data, arg->msg, arg->msg_size);
+	}
+
+	for (word = 0; word < TM_BROADCAST_MASK_WORDS; word++) {
+		mask = tm_broadcast_mask[arg->type - 1][word];
+		while (mask != 0) {
+			handle = word * 32 + __builtin_ctz(mask);
+			mask &= mask - 1;
+
+			if (TM_LIST_ADDR(handle) == NULL) {
+				continue;
+			}
 			ret = taskmgr_get_task_state(handle);
 			if (ret == TM_APP_STATE_STOP || ret == TM_APP_STATE_UNREGISTERED) {
 				continue;
@@ -972,27 +1013,27 @@ static int taskmgr_broadcast(tm_internal_msg_t *arg)
 			}
 			bm = (tm_broadcast_internal_msg_t *)TM_ALLOC(sizeof(tm_broadcast_internal_msg_t));
 			if (bm == NULL) {
-				return TM_OUT_OF_MEMORY;
-			}
-			if (arg->msg_size > 0) {
-				bm->user_data = TM_ALLOC(arg->msg_size);
-				if (bm->user_data == NULL) {
-					TM_FREE(bm);
-					return TM_OUT_OF_MEMORY;
-				}
-				bm->size = arg->msg_size;
-				memcpy(bm->user_data, arg->msg, arg->msg_size);
-			} else {
-				bm->user_data = NULL;
-				bm->size = arg->msg_size;
+				ret = TM_OUT_OF_MEMORY;
+				goto out;
 			}
-
+			bm->size = arg->msg_size;
+			bm->payload = payload;
 			bm->cb_info = broadcast_info;
+			if (payload != NULL) {
+				__atomic_add_fetch(&payload->refs, 1, __ATOMIC_RELAXED);
+			}
 			msg_broad.sival_ptr = (void *)bm;
-			(void)sigqueue(TM_PID(handle), SIGTM_BROADCAST, msg_broad);
+			if (sigqueue(TM_PID(handle), SIGTM_BROADCAST, msg_broad) != OK) {
+				taskmgr_put_broadcast_payload(payload);
+				TM_FREE(bm);
+			}
 		}
 	}
-	return OK;
+	ret = OK;
+
+out:
+	taskmgr_put_broadcast_payload(payload);
+	return ret;
 }
 
 static void taskmgr_broadcast_msg_init(void)
@@ -1092,6 +1133,7 @@ static int taskmgr_set_broadcast_cb(tm_broadcast_info_t *data, int pid)
 			broadcast_info->cb_data = NULL;
 		}
 		sq_addlast((FAR sq_entry_t *)broadcast_info, &TM_BROADCAST_INFO_LIST(handle));
+		BROADCAST_MASK_SET(data->msg, handle);
 	} else {
 		if ((broadcast_info->cb == data->cb) && (CB_MSGSIZE_OF(broadcast_info) == CB_MSGSIZE_OF(data)) && (memcmp(CB_MSG_OF(broadcast_info), CB_MSG_OF(data), CB_MSGSIZE_OF(data)) == 0)) {
 			return TM_ALREADY_REGISTERED_CB;
@@ -1160,6 +1202,7 @@ static int taskmgr_unset_broadcast_cb(int msg, int pid)
 		return TM_UNREGISTERED_MSG;
 	}
 	sq_rem((FAR sq_entry_t *)broadcast_info, &TM_BROADCAST_INFO_LIST(handle));
+	BROADCAST_MASK_CLR(msg, handle);
 	if (broadcast_info->cb_data != NULL) {
 		if (CB_MSG_OF(broadcast_info) != NULL) {
 			TM_FREE(CB_MSG_OF(broadcast_info));
@@ -1435,6 +1478,86 @@ static int taskmgr_dealloc_broadcast_msg(int msg)
 	return TM_UNREGISTERED_MSG;
 }
 
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+static void taskmgr_monitor_handler(int signo, siginfo_t *info, void *extra)
+{
+	tm_request_t request_msg;
+
+	/* A full queue is noticed by the main loop, at its next request */
+
+	g_tm_monitor_pending = true;
+
+	memset(&request_msg, 0, sizeof(tm_request_t));
+	request_msg.cmd = TASKMGRCMD_MONITOR_EVENT;
+	request_msg.timeout = TM_NO_RESPONSE;
+	(void)mq_send(g_tm_monitor_mqfd, (const char *)&request_msg, sizeof(tm_request_t), TM_MQ_PRIO);
+}
+
+/* Broadcast the events queued by the task monitor */
+static void taskmgr_monitor_events(void)
+{
+	struct task_monitor_event_s event;
+	tm_internal_msg_t msg;
+
+	g_tm_monitor_pending = false;
+
+	while (taskmgr_handle_tcb(TMIOC_MONITOR_EVENT, -1, &event) == OK) {
+		switch (event.type) {
+		case TASK_MONITOR_EVENT_DEADLINE_MISS:
+			msg.type = TM_BROADCAST_TASK_DEADLINE_MISS;
+			break;
+		case TASK_MONITOR_EVENT_OVERRUN:
+			msg.type = TM_BROADCAST_TASK_OVERRUN;
+			break;
+		case TASK_MONITOR_EVENT_OVERLOAD:
+			msg.type = TM_BROADCAST_SYSTEM_OVERLOAD;
+			break;
+		default:
+			continue;
+		}
+		tmvdbg("Task monitor event %d pid %d load %d\n", event.type, event.pid, event.load);
+
+		msg.msg_size = sizeof(struct task_monitor_event_s);
+		msg.msg = &event;
+		(void)taskmgr_broadcast(&msg);
+	}
+}
+
+static int taskmgr_init_monitor(int taskmgr_fd)
+{
+	int ret;
+	struct sigaction act;
+	tm_drv_data_t data;
+
+	g_tm_monitor_mqfd = mq_open(TM_PUBLIC_MQ, O_WRONLY | O_NONBLOCK);
+	if (g_tm_monitor_mqfd == (mqd_t)ERROR) {
+		tmdbg("Failed to open task manager public queue for the monitor.\n");
+		return ERROR;
+	}
+
+	act.sa_sigaction = (_sa_sigaction_t)taskmgr_monitor_handler;
+	act.sa_flags = 0;
+	(void)sigemptyset(&act.sa_mask);
+	ret = sigaction(SIGTM_MONITOR, &act, NULL);
+	if (ret == (int)SIG_ERR) {
+		tmdbg("sigaction Failed\n");
+		mq_close(g_tm_monitor_mqfd);
+		return ERROR;
+	}
+
+	data.pid = getpid();
+	data.addr = NULL;
+	ret = ioctl(taskmgr_fd, TMIOC_MONITOR_NOTIFY, (unsigned long)&data);
+	if (ret == ERROR) {
+		tmdbg("Failed to register to the task monitor.\n");
+		mq_close(g_tm_monitor_mqfd);
+		return ERROR;
+	}
+
+	return OK;
+}
+#endif
+
 int taskmgr_get_task_manager_pid(void)
 {
 	if (task_manager_pid > 0) {
@@ -1492,6 +1615,11 @@ static int taskmgr_init_task_manager(void)
 
 	SET_TERMINATION_CB(taskmgr_update_stop_status);
 
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+	/* The task manager works without the events of the task monitor */
+	(void)taskmgr_init_monitor(taskmgr_fd);
+#endif
+
 	return OK;
 }
 
@@ -1612,6 +1740,12 @@ int task_manager(int argc, char *argv[])
 		case TASKMGRCMD_DEALLOC_BROADCAST_MSG:
 			ret = taskmgr_dealloc_broadcast_msg(*((int *)request_msg.data));
 			break;
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+		case TASKMGRCMD_MONITOR_EVENT:
+			taskmgr_monitor_events();
+			ret = OK;
+			break;
+#endif
 			
 		default:
 			break;
@@ -1620,6 +1754,12 @@ int task_manager(int argc, char *argv[])
 		taskmgr_send_response((char *)request_msg.q_name, request_msg.timeout, &response_msg, ret);
 		taskmgr_dealloc_reqmsg_data(&request_msg);
 
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+		if (g_tm_monitor_pending) {
+			taskmgr_monitor_events();
+		}
+#endif
+
 		sched_unlock();
 	}
 	tmdbg("Task manager OUT\n");
@@ -142,3 +142,10 @@ int taskmgr_receive_response(char *q_name, tm_response_t *response_msg, int time
 
 	return response_msg->status;
 }
+
+void taskmgr_put_broadcast_payload(tm_broadcast_payload_t *payload)
+{
+	if (payload != NULL && __atomic_sub_fetch(&payload->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+		TM_FREE(payload);
+	}
+}
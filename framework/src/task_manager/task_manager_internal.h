@@ -57,6 +57,7 @@
 #define TASKMGRCMD_UNSET_BROADCAST_CB      20
 #define TASKMGRCMD_DEALLOC_BROADCAST_MSG   21
 #define TASKMGRCMD_SCAN_PID                22
+#define TASKMGRCMD_MONITOR_EVENT           23
 
 /* Task Type */
 #define TM_BUILTIN_TASK                    0
@@ -179,9 +180,18 @@ struct tm_internal_msg_s {
 };
 typedef struct tm_internal_msg_s tm_internal_msg_t;
 
+/* The data of a broadcast, copied once and shared by all the receivers.
+ * Each tm_broadcast_internal_msg_t holds a reference, the last one frees it.
+ */
+struct tm_broadcast_payload_s {
+	int refs;
+	char data[];
+};
+typedef struct tm_broadcast_payload_s tm_broadcast_payload_t;
+
 struct tm_broadcast_internal_msg_s {
 	int size;
-	void *user_data;
+	tm_broadcast_payload_t *payload;
 	tm_broadcast_info_t *cb_info;
 };
 typedef struct tm_broadcast_internal_msg_s tm_broadcast_internal_msg_t;
@@ -256,6 +266,7 @@ app_list_t *taskmger_get_applist(int handle);
 int taskmgr_send_request(tm_request_t *request_msg);
 void taskmgr_send_response(char *q_name, int timeout, tm_response_t *response_msg, int ret_status);
 int taskmgr_receive_response(char *q_name, tm_response_t *response_msg, int timeout);
+void taskmgr_put_broadcast_payload(tm_broadcast_payload_t *payload);
 
 bool taskmgr_is_permitted(int handle, pid_t pid);
 int taskmgr_get_task_state(int handle);
@@ -48,11 +48,9 @@
 void taskmgr_msg_cb(int signo, siginfo_t *data)
 {
 	int handle;
-	tm_msg_t *broadcast_param;
-	void *broadcast_data = NULL;
-	void *user_data;
-	void *cb_data;
-	int user_data_size;
+	tm_broadcast_internal_msg_t *bm;
+	tm_msg_t broadcast_param;
+	tm_msg_t *cb_data;
 	tm_msg_t unicast_param;
 
 	handle = taskmgr_get_handle_by_pid(getpid());
@@ -73,48 +71,19 @@ void taskmgr_msg_cb(int signo, siginfo_t *data)
 		(*TM_UNICAST_CB(handle))(&unicast_param);
 		TM_FREE(unicast_param.msg);
 	} else {
-		user_data = ((tm_broadcast_internal_msg_t *)data->si_value.sival_ptr)->user_data;
-		user_data_size = ((tm_broadcast_internal_msg_t *)data->si_value.sival_ptr)->size;
-		cb_data = ((tm_broadcast_info_t *)((tm_broadcast_internal_msg_t *)data->si_value.sival_ptr)->cb_info)->cb_data;
-
-		if (user_data_size >= 0) {
-			broadcast_param = (tm_msg_t *)TM_ALLOC(sizeof(tm_msg_t));
-			if (broadcast_param == NULL) {
-				tmdbg("Fail to alloc broadcast param\n");
-				return;
-			}
-			if (user_data_size != 0) {
-				broadcast_data = TM_ALLOC(user_data_size);
-				if (broadcast_data == NULL) {
-					TM_FREE(broadcast_param);
-					tmdbg("Fail to alloc broadcast data\n");
-					return;
-				}
-				broadcast_param->msg = broadcast_data;
-				broadcast_param->msg_size = user_data_size;
-				memcpy(broadcast_data, user_data, user_data_size);
-			} else {
-				broadcast_param->msg = NULL;
-				broadcast_param->msg_size = 0;
-			}
+		bm = (tm_broadcast_internal_msg_t *)data->si_value.sival_ptr;
+		cb_data = bm->cb_info->cb_data;
+
+		/* The data is shared with the other receivers, it is passed as is. */
+		if (bm->size >= 0) {
+			broadcast_param.msg = (bm->payload != NULL) ? bm->payload->data : NULL;
+			broadcast_param.msg_size = bm->size;
+			(*bm->cb_info->cb)(&broadcast_param, cb_data);
 		} else {
-			broadcast_param = NULL;
+			(*bm->cb_info->cb)(NULL, cb_data);
 		}
 
-		(*((tm_broadcast_info_t *)((tm_broadcast_internal_msg_t *)data->si_value.sival_ptr)->cb_info)->cb)(broadcast_param, cb_data);
-
-		if (broadcast_param != NULL) {
-			TM_FREE(broadcast_param);
-			broadcast_param = NULL;
-		}
-		if (broadcast_data != NULL) {
-			TM_FREE(broadcast_data);
-			broadcast_data = NULL;
-		}
-		if (user_data != NULL) {
-			TM_FREE(user_data);
-			user_data = NULL;
-		}
+		taskmgr_put_broadcast_payload(bm->payload);
 	}
 	TM_FREE(data->si_value.sival_ptr);
 }
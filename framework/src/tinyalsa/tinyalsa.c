@@ -342,6 +342,15 @@ static int pcm_set_config(struct pcm *pcm, const struct pcm_config *config)
 			buf_info.nbuffers = config->period_count;
 		}
 	}
+	if ((pcm->flags & PCM_LOW_LATENCY) && config->period_size != 0 && config->period_count != 0) {
+		/* Shorter and fewer buffers than the driver would take */
+		if (pcm_frames_to_bytes(pcm, config->period_size) < buf_info.buffer_size) {
+			buf_info.buffer_size = pcm_frames_to_bytes(pcm, config->period_size);
+		}
+		if (config->period_count < buf_info.nbuffers) {
+			buf_info.nbuffers = config->period_count;
+		}
+	}
 	pcm->config.period_size = buf_info.buffer_size / (pcm_format_to_bits(pcm->config.format) >> 3);
 	pcm->config.period_count = buf_info.nbuffers;
 	pcm->buffer_size = buf_info.buffer_size;
@@ -1154,6 +1163,18 @@ int pcm_stop(struct pcm *pcm)
 	pcm->next_buf = NULL;
 	pcm->mmap_idx = 0;
 
+	/* The dequeue messages of the mmap buffers were dropped above, they
+	 * are all back to the application.
+	 */
+	if (pcm->flags & PCM_MMAP) {
+		unsigned int i;
+		for (i = 0; i < pcm->buffer_cnt; i++) {
+			pcm->pBuffers[i]->flags &= ~AUDIO_APB_MMAP_ENQUEUED;
+			pcm->pBuffers[i]->nbytes = 0;
+			pcm->pBuffers[i]->curbyte = 0;
+		}
+	}
+
 	return 0;
 }
 
@@ -1201,6 +1222,18 @@ int pcm_drain(struct pcm *pcm)
 			}
 		}
 		/* Playback case */
+		if (pcm->flags & PCM_MMAP) {
+			/* pcm_wait() takes the dequeue messages of mmap buffers without
+			 * counting them in buf_idx, count the buffers still enqueued.
+			 */
+			unsigned int i;
+			pcm->buf_idx = 0;
+			for (i = 0; i < pcm->buffer_cnt; i++) {
+				if (pcm->pBuffers[i]->flags & AUDIO_APB_MMAP_ENQUEUED) {
+					pcm->buf_idx++;
+				}
+			}
+		}
 		/* Wait for all enqueued buffers to get dequeued. */
 		while (pcm->buf_idx > 0) {
 			/* Wait for deque message from kernel */
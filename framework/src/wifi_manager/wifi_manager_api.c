@@ -32,6 +32,8 @@
 #include "wifi_manager_cb.h"
 #include "wifi_manager_info.h"
 #include "wifi_manager_profile.h"
+#include "wifi_manager_scan_cache.h"
+#include "wifi_manager_linkstats.h"
 
 /*  Check Result MACRO */
 #define WIFIMGR_CHECK_AP_CONFIG(config)                                                                                         \
@@ -236,6 +238,46 @@ wifi_manager_result_e wifi_manager_scan_specific_ap(wifi_manager_ap_config_s *co
 	return WIFI_MANAGER_NO_API;
 }
 
+wifi_manager_result_e wifi_manager_get_scan_result(wifi_manager_scan_filter_s *filter, wifi_manager_scan_info_s **list, uint32_t *generation)
+{
+	NET_LOGI(TAG, "--> %s %d\n", __FUNCTION__, __LINE__);
+#ifdef CONFIG_WIFIMGR_SCAN_CACHE
+	if (!list) {
+		WIFIADD_ERR_RECORD(ERR_WIFIMGR_INVALID_ARGUMENTS);
+		return WIFI_MANAGER_INVALID_ARGS;
+	}
+	return wifimgr_scan_cache_get(filter, list, generation);
+#else
+	return WIFI_MANAGER_NO_API;
+#endif
+}
+
+wifi_manager_result_e wifi_manager_free_scan_result(wifi_manager_scan_info_s *list)
+{
+	NET_LOGI(TAG, "--> %s %d\n", __FUNCTION__, __LINE__);
+#ifdef CONFIG_WIFIMGR_SCAN_CACHE
+	wifimgr_scan_cache_free(list);
+	return WIFI_MANAGER_SUCCESS;
+#else
+	return WIFI_MANAGER_NO_API;
+#endif
+}
+
+wifi_manager_result_e wifi_manager_set_scan_report(wifi_manager_scan_report_e mode)
+{
+	NET_LOGI(TAG, "--> %s %d\n", __FUNCTION__, __LINE__);
+#ifdef CONFIG_WIFIMGR_SCAN_CACHE
+	if (mode != WIFI_MANAGER_SCAN_REPORT_ALL && mode != WIFI_MANAGER_SCAN_REPORT_CHANGES) {
+		WIFIADD_ERR_RECORD(ERR_WIFIMGR_INVALID_ARGUMENTS);
+		return WIFI_MANAGER_INVALID_ARGS;
+	}
+	wifimgr_scan_cache_set_report(mode);
+	return WIFI_MANAGER_SUCCESS;
+#else
+	return WIFI_MANAGER_NO_API;
+#endif
+}
+
 /**
  * Wi-Fi Stats
  */
@@ -283,6 +325,20 @@ wifi_manager_result_e wifi_manager_set_powermode(wifi_manager_powermode_e mode)
 	RETURN_RESULT(wifimgr_post_message(&msg), msg);
 }
 
+wifi_manager_result_e wifi_manager_get_link_stats(wifi_manager_link_stats_s *stats)
+{
+	NET_LOGI(TAG, "--> %s %d\n", __FUNCTION__, __LINE__);
+#ifdef CONFIG_WIFIMGR_LINK_STATS
+	if (!stats || (stats->samples && stats->max_samples == 0)) {
+		WIFIADD_ERR_RECORD(ERR_WIFIMGR_INVALID_ARGUMENTS);
+		return WIFI_MANAGER_INVALID_ARGS;
+	}
+	return wifimgr_link_get_stats(stats);
+#else
+	return WIFI_MANAGER_NO_API;
+#endif
+}
+
 /**
  * Wi-Fi callback
  */
@@ -30,6 +30,7 @@
 #include "wifi_manager_utils.h"
 #include "wifi_manager_error.h"
 #include "wifi_manager_stats.h"
+#include "wifi_manager_scan_cache.h"
 
 #define WIFIMGR_NUM_CALLBACKS 3
 #define LOCK_WIFICB pthread_mutex_lock(&g_cb_handler.lock)
@@ -114,6 +115,21 @@ static void _create_cb_msg(wifi_manager_cb_msg_s *msg,
 		} else {
 			msg->scanlist = info;
 		}
+#ifdef CONFIG_WIFIMGR_SCAN_CACHE
+		if (msg->res == WIFI_MANAGER_SUCCESS) {
+			wifi_manager_scan_info_s *changes = NULL;
+			if (wifimgr_scan_cache_get_report() == WIFI_MANAGER_SCAN_REPORT_CHANGES) {
+				if (wifimgr_scan_cache_update(info, &changes) != WIFI_MANAGER_SUCCESS) {
+					NET_LOGE(TAG, "copy scan changes error\n");
+					msg->res = WIFI_MANAGER_FAIL;
+				}
+				_free_scan_info(info);
+				msg->scanlist = changes;
+			} else {
+				wifimgr_scan_cache_update(info, NULL);
+			}
+		}
+#endif
 	} else if (evt == CB_STA_CONNECT_FAILED) {
 		msg->res = WIFI_MANAGER_FAIL;
 	} else {
@@ -29,6 +29,7 @@
 #include "wifi_manager_utils.h"
 #include "wifi_manager_error.h"
 #include "wifi_manager_dhcp.h"
+#include "wifi_manager_fastconn.h"
 
 #define TAG "[WM]"
 
@@ -42,7 +43,18 @@ wifi_manager_result_e dhcpc_get_ipaddr(void)
 	struct in_addr ip;
 	wifi_manager_result_e wret = WIFI_MANAGER_FAIL;
 
+#ifdef CONFIG_WIFIMGR_FAST_CONNECT
+	/* request the lease of the last join to the AP, lwIP discovers the
+	 * servers if it is refused */
+	struct in_addr lease = wifimgr_fast_get_lease();
+	if (lease.s_addr != INADDR_ANY) {
+		ret = dhcp_client_reboot(WIFIMGR_STA_IFNAME, lease);
+	} else {
+		ret = dhcp_client_start(WIFIMGR_STA_IFNAME);
+	}
+#else
 	ret = dhcp_client_start(WIFIMGR_STA_IFNAME);
+#endif
 	if (ret != 0) {
 		WIFIADD_ERR_RECORD(ERR_WIFIMGR_CONNECT_DHCPC_FAIL);
 		NET_LOGE(TAG, "[DHCPC] get IP address fail\n");
@@ -56,6 +68,9 @@ wifi_manager_result_e dhcpc_get_ipaddr(void)
 		return wret;
 	}
 	NET_LOGV(TAG, "[DHCPC] get IP address %s\n", inet_ntoa(ip));
+#ifdef CONFIG_WIFIMGR_FAST_CONNECT
+	wifimgr_fast_set_lease(ip);
+#endif
 
 	return WIFI_MANAGER_SUCCESS;
 }
@@ -0,0 +1,215 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <arpa/inet.h>
+#include <tinyara/net/if/wifi.h>
+#include <tinyara/net/netlog.h>
+#include <wifi_manager/wifi_manager.h>
+#include "wifi_manager_lwnl.h"
+#include "wifi_manager_fastconn.h"
+
+#define TAG "[WM]"
+
+#define WIFI_FAST_PATH "/mnt/wifi_fast.conf"
+#define WIFI_FAST_BUFSIZE 96
+
+struct wifimgr_fast {
+	/* the AP joined last */
+	char ssid[WIFIMGR_SSID_LEN + 1];
+	char bssid[WIFIMGR_MACADDR_STR_LEN + 1];
+	unsigned int channel;
+	struct in_addr ip;
+	bool valid;
+	bool loaded;
+	/* the join in progress */
+	trwifi_ap_config_s config;
+	struct in_addr lease;
+	bool joining;
+	bool hinted;
+};
+
+static struct wifimgr_fast g_fast;
+
+/*
+ * Stored as: ssid length, ssid, bssid, channel and IP address separated by
+ * tabs. It is kept out of the Wi-Fi profile because it has no secret.
+ */
+static void _fast_load(void)
+{
+	char buf[WIFI_FAST_BUFSIZE] = {0,};
+	char ip[INET_ADDRSTRLEN] = {0,};
+	unsigned int len;
+	int pos;
+	FILE *fp;
+
+	g_fast.loaded = true;
+	fp = fopen(WIFI_FAST_PATH, "r");
+	if (!fp) {
+		return;
+	}
+	int ret = fread(buf, 1, WIFI_FAST_BUFSIZE - 1, fp);
+	fclose(fp);
+	if (ret <= 0) {
+		return;
+	}
+
+	if (sscanf(buf, "%u\t%n", &len, &pos) != 1 || len > WIFIMGR_SSID_LEN || pos + len >= ret) {
+		NET_LOGE(TAG, "fast connect file is corrupted\n");
+		return;
+	}
+	memcpy(g_fast.ssid, buf + pos, len);
+	g_fast.ssid[len] = '\0';
+	if (sscanf(buf + pos + len, "\t%17s\t%u\t%15s", g_fast.bssid, &g_fast.channel, ip) != 3
+		|| inet_aton(ip, &g_fast.ip) == 0) {
+		NET_LOGE(TAG, "fast connect file is corrupted\n");
+		return;
+	}
+	g_fast.valid = true;
+}
+
+static void _fast_store(void)
+{
+	char buf[WIFI_FAST_BUFSIZE];
+	FILE *fp;
+	int len;
+
+	len = snprintf(buf, WIFI_FAST_BUFSIZE, "%u\t%s\t%s\t%u\t%s\n", (unsigned int)strlen(g_fast.ssid),
+				   g_fast.ssid, g_fast.bssid, g_fast.channel, inet_ntoa(g_fast.ip));
+	fp = fopen(WIFI_FAST_PATH, "w+");
+	if (!fp) {
+		NET_LOGE(TAG, "file open error(%d)\n", errno);
+		return;
+	}
+	if (fwrite(buf, 1, len, fp) != len) {
+		NET_LOGE(TAG, "file write error(%d)\n", errno);
+	}
+	fclose(fp);
+}
+
+static trwifi_result_e _fast_get_channel(unsigned int *channel)
+{
+	trwifi_signal_quality quality;
+	trwifi_result_e res = wifi_utils_get_signal_quality(&quality);
+	if (res == TRWIFI_SUCCESS) {
+		*channel = quality.channel;
+	}
+	return res;
+}
+
+/*
+ * Public functions
+ */
+void wifimgr_fast_apply(trwifi_ap_config_s *config)
+{
+	if (!g_fast.loaded) {
+		_fast_load();
+	}
+
+	config->channel = 0;
+	memcpy(&g_fast.config, config, sizeof(trwifi_ap_config_s));
+	g_fast.lease.s_addr = INADDR_ANY;
+	g_fast.joining = true;
+	g_fast.hinted = false;
+
+	if (g_fast.valid && strcmp(g_fast.ssid, config->ssid) == 0 && g_fast.channel != 0) {
+		NET_LOGV(TAG, "fast connect to %s on channel %u\n", g_fast.bssid, g_fast.channel);
+		config->channel = g_fast.channel;
+		g_fast.hinted = true;
+	}
+}
+
+wifi_manager_result_e wifimgr_fast_retry(void)
+{
+	if (!g_fast.joining || !g_fast.hinted) {
+		return WIFI_MANAGER_FAIL;
+	}
+
+	/* the AP isn't on the channel anymore */
+	NET_LOGV(TAG, "fast connect failed, join with a full scan\n");
+	g_fast.hinted = false;
+	g_fast.channel = 0;
+	if (wifi_utils_connect_ap(&g_fast.config, NULL) != TRWIFI_SUCCESS) {
+		return WIFI_MANAGER_FAIL;
+	}
+	return WIFI_MANAGER_SUCCESS;
+}
+
+struct in_addr wifimgr_fast_get_lease(void)
+{
+	struct in_addr none = { .s_addr = INADDR_ANY };
+
+	if (g_fast.joining && g_fast.valid && strcmp(g_fast.ssid, g_fast.config.ssid) == 0) {
+		return g_fast.ip;
+	}
+	return none;
+}
+
+void wifimgr_fast_set_lease(struct in_addr ip)
+{
+	g_fast.lease = ip;
+}
+
+void wifimgr_fast_update(trwifi_cbk_msg_s *msg)
+{
+	char bssid[WIFIMGR_MACADDR_STR_LEN + 1];
+	unsigned int channel = 0;
+	uint8_t *mac = (uint8_t *)msg->bssid;
+
+	if (!g_fast.joining) {
+		return;
+	}
+
+	snprintf(bssid, sizeof(bssid), "%02x:%02x:%02x:%02x:%02x:%02x",
+			 mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+	if (_fast_get_channel(&channel) != TRWIFI_SUCCESS) {
+		/* the channel of the same AP is still good */
+		if (g_fast.valid && strcasecmp(g_fast.bssid, bssid) == 0) {
+			channel = g_fast.channel;
+		}
+	}
+
+	/* the storage is written only when something changed */
+	if (g_fast.valid && strcmp(g_fast.ssid, g_fast.config.ssid) == 0
+		&& strcasecmp(g_fast.bssid, bssid) == 0 && g_fast.channel == channel
+		&& g_fast.ip.s_addr == g_fast.lease.s_addr) {
+		return;
+	}
+
+	strncpy(g_fast.ssid, g_fast.config.ssid, WIFIMGR_SSID_LEN);
+	g_fast.ssid[WIFIMGR_SSID_LEN] = '\0';
+	strncpy(g_fast.bssid, bssid, WIFIMGR_MACADDR_STR_LEN + 1);
+	g_fast.channel = channel;
+	g_fast.ip = g_fast.lease;
+	g_fast.valid = true;
+	_fast_store();
+}
+
+void wifimgr_fast_done(void)
+{
+	/* don't keep the passphrase */
+	memset(&g_fast.config, 0, sizeof(trwifi_ap_config_s));
+	g_fast.joining = false;
+	g_fast.hinted = false;
+}
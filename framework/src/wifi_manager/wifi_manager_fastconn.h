@@ -0,0 +1,51 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#pragma once
+
+#include <netinet/in.h>
+#include <tinyara/net/if/wifi.h>
+
+#ifdef CONFIG_WIFIMGR_FAST_CONNECT
+/*
+ * Fast connect remembers the BSSID and the channel of the AP which was
+ * joined last, and the DHCP lease it got, across disconnections and
+ * reboots. Connecting to the same SSID again joins on the known channel
+ * and requests the lease again instead of discovering the DHCP servers.
+ */
+#define WIFIMGR_FAST_APPLY(config) wifimgr_fast_apply(config)
+#define WIFIMGR_FAST_RETRY() wifimgr_fast_retry()
+#define WIFIMGR_FAST_UPDATE(msg) wifimgr_fast_update(msg)
+#define WIFIMGR_FAST_DONE() wifimgr_fast_done()
+
+/* Give the channel of the AP to the join if config is the AP joined last */
+void wifimgr_fast_apply(trwifi_ap_config_s *config);
+/* Join again with a full scan if the join on the known channel failed */
+wifi_manager_result_e wifimgr_fast_retry(void);
+/* The lease of the AP being joined, INADDR_ANY if there is none */
+struct in_addr wifimgr_fast_get_lease(void);
+void wifimgr_fast_set_lease(struct in_addr ip);
+/* Remember the AP which was joined and its lease */
+void wifimgr_fast_update(trwifi_cbk_msg_s *msg);
+/* The join is over, whatever its result */
+void wifimgr_fast_done(void);
+#else
+#define WIFIMGR_FAST_APPLY(config) ((config)->channel = 0)
+#define WIFIMGR_FAST_RETRY() WIFI_MANAGER_FAIL
+#define WIFIMGR_FAST_UPDATE(msg)
+#define WIFIMGR_FAST_DONE()
+#endif
@@ -0,0 +1,260 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <tinyara/net/netlog.h>
+#include <tinyara/net/if/wifi.h>
+#include <wifi_manager/wifi_manager.h>
+#include "wifi_manager_utils.h"
+#include "wifi_manager_lwnl.h"
+#include "wifi_manager_linkstats.h"
+
+#define LOCK_LINK pthread_mutex_lock(&g_link.lock)
+#define UNLOCK_LINK pthread_mutex_unlock(&g_link.lock)
+#define TAG "[WM]"
+
+#ifdef CLOCK_MONOTONIC
+#define LINK_CLOCK CLOCK_MONOTONIC
+#else
+#define LINK_CLOCK CLOCK_REALTIME
+#endif
+
+struct wifimgr_link {
+	wifi_manager_link_sample_s sample[CONFIG_WIFIMGR_LINK_STATS_SAMPLES];
+	uint16_t head;  // next sample to write
+	uint16_t count;
+	uint32_t retry_hist[WIFI_MANAGER_LINK_RETRY_BINS];
+	uint32_t rate_hist[WIFI_MANAGER_LINK_RATE_BINS];
+	uint32_t connected;   // ms, time of the connection
+	uint32_t duration;    // ms, length of the last connection once it is over
+	uint32_t ps_start;    // ms, since when the power save time is counted
+	uint32_t ps_time;     // ms, power save time before ps_start
+	unsigned int tx_retry; // counter of the driver at the previous sample
+	bool has_retry;
+	bool powersave;
+	bool running;
+	int tid;
+	sem_t wake;
+	pthread_mutex_t lock;
+};
+
+static struct wifimgr_link g_link = {
+	.tid = -1,
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static const uint16_t g_retry_bins[WIFI_MANAGER_LINK_RETRY_BINS - 1] = {1, 4, 16, 64, 256};
+static const uint16_t g_rate_bins[WIFI_MANAGER_LINK_RATE_BINS - 1] = {6, 12, 24, 54, 72, 150, 300};
+
+static uint32_t _link_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(LINK_CLOCK, &ts);
+	return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int _link_bin(const uint16_t *bins, int nbins, uint32_t val)
+{
+	int i;
+
+	for (i = 0; i < nbins; i++) {
+		if (val < bins[i]) {
+			break;
+		}
+	}
+	return i;
+}
+
+static void _link_add_sample(trwifi_info *info, trwifi_signal_quality *quality, bool has_quality)
+{
+	wifi_manager_link_sample_s *s = &g_link.sample[g_link.head];
+	uint32_t retry = 0;
+
+	if (has_quality) {
+		/* The counter of the driver restarts when its statistics are reset */
+		if (g_link.has_retry && quality->tx_retry >= g_link.tx_retry) {
+			retry = quality->tx_retry - g_link.tx_retry;
+		}
+		g_link.tx_retry = quality->tx_retry;
+		g_link.has_retry = true;
+	}
+
+	s->time = _link_now() - g_link.connected;
+	s->rssi = (int8_t)info->rssi;
+	s->snr = has_quality ? quality->snr : 0;
+	s->tx_retry = retry > UINT16_MAX ? UINT16_MAX : (uint16_t)retry;
+	s->rate = has_quality ? quality->max_rate : 0;
+
+	g_link.retry_hist[_link_bin(g_retry_bins, WIFI_MANAGER_LINK_RETRY_BINS - 1, retry)]++;
+	if (has_quality) {
+		g_link.rate_hist[_link_bin(g_rate_bins, WIFI_MANAGER_LINK_RATE_BINS - 1, s->rate)]++;
+	}
+
+	g_link.head = (g_link.head + 1) % CONFIG_WIFIMGR_LINK_STATS_SAMPLES;
+	if (g_link.count < CONFIG_WIFIMGR_LINK_STATS_SAMPLES) {
+		g_link.count++;
+	}
+}
+
+static int _link_sampler(int argc, char *argv[])
+{
+	trwifi_info info;
+	trwifi_signal_quality quality;
+	bool has_quality;
+
+	while (1) {
+		while (!g_link.running) {
+			sem_wait(&g_link.wake);
+		}
+
+		usleep(CONFIG_WIFIMGR_LINK_STATS_INTERVAL * 1000);
+
+		/* The driver is asked out of the lock, the station may have left
+		 * meanwhile, which is checked again before the sample is kept.
+		 */
+		if (wifi_utils_get_info(&info) != TRWIFI_SUCCESS) {
+			continue;
+		}
+		has_quality = (wifi_utils_get_signal_quality(&quality) == TRWIFI_SUCCESS);
+
+		LOCK_LINK;
+		if (g_link.running) {
+			_link_add_sample(&info, &quality, has_quality);
+		}
+		UNLOCK_LINK;
+	}
+
+	return 0;
+}
+
+static void _link_start(void)
+{
+	uint32_t now = _link_now();
+
+	LOCK_LINK;
+	if (g_link.running) {
+		UNLOCK_LINK;
+		return;
+	}
+	g_link.head = 0;
+	g_link.count = 0;
+	memset(g_link.retry_hist, 0, sizeof(g_link.retry_hist));
+	memset(g_link.rate_hist, 0, sizeof(g_link.rate_hist));
+	g_link.connected = now;
+	g_link.duration = 0;
+	g_link.ps_start = now;
+	g_link.ps_time = 0;
+	g_link.has_retry = false;
+	g_link.running = true;
+	UNLOCK_LINK;
+
+	if (g_link.tid < 0) {
+		sem_init(&g_link.wake, 0, 0);
+		g_link.tid = net_task_create("wifi link stats", 100, 2048, (main_t)_link_sampler, NULL);
+		if (g_link.tid < 0) {
+			NET_LOGE(TAG, "wifi link stats task create %d\n", errno);
+			sem_destroy(&g_link.wake);
+			return;
+		}
+	}
+	sem_post(&g_link.wake);
+}
+
+static void _link_stop(void)
+{
+	uint32_t now = _link_now();
+
+	LOCK_LINK;
+	if (g_link.running) {
+		if (g_link.powersave) {
+			g_link.ps_time += now - g_link.ps_start;
+		}
+		g_link.duration = now - g_link.connected;
+		g_link.running = false;
+	}
+	UNLOCK_LINK;
+}
+
+/**
+ * Public
+ */
+void wifimgr_link_set_state(wifimgr_state_e state)
+{
+	if (state == WIFIMGR_STA_CONNECTED) {
+		_link_start();
+	} else if (state != WIFIMGR_SCANNING) {
+		_link_stop();
+	}
+}
+
+void wifimgr_link_set_powermode(bool on)
+{
+	uint32_t now = _link_now();
+
+	LOCK_LINK;
+	if (g_link.running && g_link.powersave != on) {
+		if (g_link.powersave) {
+			g_link.ps_time += now - g_link.ps_start;
+		}
+		g_link.ps_start = now;
+	}
+	g_link.powersave = on;
+	UNLOCK_LINK;
+}
+
+wifi_manager_result_e wifimgr_link_get_stats(wifi_manager_link_stats_s *stats)
+{
+	uint32_t now = _link_now();
+	uint16_t n;
+	uint16_t idx;
+
+	LOCK_LINK;
+	stats->interval = CONFIG_WIFIMGR_LINK_STATS_INTERVAL;
+	stats->connected_time = g_link.running ? now - g_link.connected : g_link.duration;
+	stats->powersave_time = g_link.ps_time;
+	if (g_link.running && g_link.powersave) {
+		stats->powersave_time += now - g_link.ps_start;
+	}
+	memcpy(stats->retry_hist, g_link.retry_hist, sizeof(stats->retry_hist));
+	memcpy(stats->rate_hist, g_link.rate_hist, sizeof(stats->rate_hist));
+
+	n = g_link.count;
+	if (stats->samples == NULL || n > stats->max_samples) {
+		n = stats->samples ? stats->max_samples : 0;
+	}
+	/* The last n samples, the oldest first */
+	idx = (g_link.head + CONFIG_WIFIMGR_LINK_STATS_SAMPLES - n) % CONFIG_WIFIMGR_LINK_STATS_SAMPLES;
+	for (int i = 0; i < n; i++) {
+		stats->samples[i] = g_link.sample[idx];
+		idx = (idx + 1) % CONFIG_WIFIMGR_LINK_STATS_SAMPLES;
+	}
+	stats->nsamples = n;
+	UNLOCK_LINK;
+
+	return WIFI_MANAGER_SUCCESS;
+}
@@ -1,6 +1,6 @@
 /****************************************************************************
  *
- * Copyright 2023 Samsung Electronics All Rights Reserved.
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,45 +15,24 @@
  * language governing permissions and limitations under the License.
  *
  ****************************************************************************/
-
 #pragma once
 
-#include <stdlib.h>
-#include "stdio.h"
-#include "stdint.h"
-#include "sys/types.h"
+#include <stdbool.h>
+#include <wifi_manager/wifi_manager.h>
+#include "wifi_manager_state.h"
 
-namespace aifw {
+#ifdef CONFIG_WIFIMGR_LINK_STATS
+#define WIFIMGR_LINK_STATE(s) wifimgr_link_set_state(s)
+#define WIFIMGR_LINK_POWERMODE(on) wifimgr_link_set_powermode(on)
 
-/**
- * @class AIDataBufferNode
- * @brief Interface class for necessary fields of an AIDataBuffer node.
+/*
+ * Sampling starts when the state becomes WIFIMGR_STA_CONNECTED and stops
+ * when the station leaves it, except for scanning.
  */
-class AIDataBufferNode
-{
-public:
-	bool mIsEmpty;
-	float *mData;
-	AIDataBufferNode *mPrev;
-	AIDataBufferNode *mNext;
-
-	/**
-	 * @brief Construct the AIDataBufferNode class instance.
-	 */
-	AIDataBufferNode(uint16_t rowSize) :
-		mIsEmpty(true), mData(NULL), mPrev(NULL), mNext(NULL)
-	{
-		mData = (float *)calloc(rowSize, sizeof(float));
-	}
-
-	/**
-	 * @brief AIDataBufferNode destructor.
-	 */
-	~AIDataBufferNode()
-	{
-		free(mData);
-	}
-};
-
-} // namespace aifw
-
+void wifimgr_link_set_state(wifimgr_state_e state);
+void wifimgr_link_set_powermode(bool on);
+wifi_manager_result_e wifimgr_link_get_stats(wifi_manager_link_stats_s *stats);
+#else
+#define WIFIMGR_LINK_STATE(s)
+#define WIFIMGR_LINK_POWERMODE(on)
+#endif
@@ -186,3 +186,14 @@ trwifi_result_e wifi_utils_get_info(trwifi_info *wifi_info)
 	}
 	return res;
 }
+
+trwifi_result_e wifi_utils_get_signal_quality(trwifi_signal_quality *quality)
+{
+	trwifi_result_e res = TRWIFI_SUCCESS;
+	lwnl_msg msg = {WU_INTF_NAME, {LWNL_REQ_WIFI_GET_SIGNAL_QUALITY},
+					sizeof(trwifi_signal_quality), (void *)quality, (void *)&res};
+	if (_send_msg(&msg) < 0) {
+		return TRWIFI_FAIL;
+	}
+	return res;
+}
@@ -29,3 +29,4 @@ trwifi_result_e wifi_utils_stop_softap(void);
 trwifi_result_e wifi_utils_set_autoconnect(uint8_t check);
 trwifi_result_e wifi_utils_ioctl(trwifi_msg_s *dmsg);
 trwifi_result_e wifi_utils_scan_multi_aps(void *arg);
+trwifi_result_e wifi_utils_get_signal_quality(trwifi_signal_quality *quality);
@@ -0,0 +1,268 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <pthread.h>
+#include <tinyara/net/netlog.h>
+#include <wifi_manager/wifi_manager.h>
+#include "wifi_manager_scan_cache.h"
+
+#define LOCK_SCAN_CACHE pthread_mutex_lock(&g_scan_cache.lock)
+#define UNLOCK_SCAN_CACHE pthread_mutex_unlock(&g_scan_cache.lock)
+#define TAG "[WM]"
+
+#ifdef CLOCK_MONOTONIC
+#define SCAN_CACHE_CLOCK CLOCK_MONOTONIC
+#else
+#define SCAN_CACHE_CLOCK CLOCK_REALTIME
+#endif
+
+struct wifimgr_scan_entry {
+	wifi_manager_scan_info_s info;
+	uint32_t seen; // seconds, time of the last scan which found the AP
+	uint32_t gen;  // generation of the scan which added or changed the AP
+	uint32_t scan; // generation of the last scan which found the AP
+	bool used;
+};
+
+struct wifimgr_scan_cache {
+	struct wifimgr_scan_entry entry[CONFIG_WIFIMGR_SCAN_CACHE_SIZE];
+	uint32_t gen;	   // generation of the last scan
+	unsigned int channel; // scope of the requested scan
+	bool partial;
+	wifi_manager_scan_report_e report;
+	pthread_mutex_t lock;
+};
+
+static struct wifimgr_scan_cache g_scan_cache = {
+	.report = WIFI_MANAGER_SCAN_REPORT_ALL,
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static uint32_t _scan_cache_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(SCAN_CACHE_CLOCK, &ts);
+	return (uint32_t)ts.tv_sec;
+}
+
+static struct wifimgr_scan_entry *_scan_cache_find(const char *bssid)
+{
+	for (int i = 0; i < CONFIG_WIFIMGR_SCAN_CACHE_SIZE; i++) {
+		struct wifimgr_scan_entry *e = &g_scan_cache.entry[i];
+		if (e->used && strcasecmp(e->info.bssid, bssid) == 0) {
+			return e;
+		}
+	}
+	return NULL;
+}
+
+/* A free entry, or else the one which was seen the longest time ago */
+static struct wifimgr_scan_entry *_scan_cache_alloc(void)
+{
+	struct wifimgr_scan_entry *oldest = NULL;
+
+	for (int i = 0; i < CONFIG_WIFIMGR_SCAN_CACHE_SIZE; i++) {
+		struct wifimgr_scan_entry *e = &g_scan_cache.entry[i];
+		if (!e->used) {
+			return e;
+		}
+		if (!oldest || (int32_t)(e->seen - oldest->seen) < 0) {
+			oldest = e;
+		}
+	}
+	return oldest;
+}
+
+static bool _scan_cache_changed(wifi_manager_scan_info_s *old, wifi_manager_scan_info_s *new)
+{
+	int delta = old->rssi - new->rssi;
+
+	if (delta < 0) {
+		delta = -delta;
+	}
+	return delta >= CONFIG_WIFIMGR_SCAN_CACHE_RSSI_DELTA
+		   || old->channel != new->channel
+		   || old->phy_mode != new->phy_mode
+		   || old->ap_auth_type != new->ap_auth_type
+		   || old->ap_crypto_type != new->ap_crypto_type
+		   || strcmp(old->ssid, new->ssid) != 0;
+}
+
+static bool _scan_cache_match(struct wifimgr_scan_entry *e, wifi_manager_scan_filter_s *filter, uint32_t now)
+{
+	if (!filter) {
+		return true;
+	}
+	if (filter->ssid[0] != '\0' && strcmp(e->info.ssid, filter->ssid) != 0) {
+		return false;
+	}
+	if (filter->bssid[0] != '\0' && strcasecmp(e->info.bssid, filter->bssid) != 0) {
+		return false;
+	}
+	if (e->info.rssi < filter->rssi_threshold) {
+		return false;
+	}
+	if (filter->max_age != 0 && now - e->seen > filter->max_age) {
+		return false;
+	}
+	if (filter->changed_since != 0 && (int32_t)(e->gen - filter->changed_since) <= 0) {
+		return false;
+	}
+	return true;
+}
+
+/* this function is protected by LOCK_SCAN_CACHE */
+static wifi_manager_result_e _scan_cache_copy(wifi_manager_scan_filter_s *filter, wifi_manager_scan_info_s **list)
+{
+	wifi_manager_scan_info_s *cur = NULL, *prev = NULL;
+	uint32_t now = _scan_cache_now();
+
+	*list = NULL;
+	for (int i = 0; i < CONFIG_WIFIMGR_SCAN_CACHE_SIZE; i++) {
+		struct wifimgr_scan_entry *e = &g_scan_cache.entry[i];
+		if (!e->used || !_scan_cache_match(e, filter, now)) {
+			continue;
+		}
+		cur = (wifi_manager_scan_info_s *)malloc(sizeof(wifi_manager_scan_info_s));
+		if (!cur) {
+			wifimgr_scan_cache_free(*list);
+			*list = NULL;
+			return WIFI_MANAGER_FAIL;
+		}
+		memcpy(cur, &e->info, sizeof(wifi_manager_scan_info_s));
+		cur->next = NULL;
+		if (!prev) {
+			*list = cur;
+		} else {
+			prev->next = cur;
+		}
+		prev = cur;
+	}
+	return WIFI_MANAGER_SUCCESS;
+}
+
+/*
+ * Public functions
+ */
+void wifimgr_scan_cache_set_scope(unsigned int channel, bool partial)
+{
+	LOCK_SCAN_CACHE;
+	g_scan_cache.channel = channel;
+	g_scan_cache.partial = partial;
+	UNLOCK_SCAN_CACHE;
+}
+
+wifi_manager_result_e wifimgr_scan_cache_update(wifi_manager_scan_info_s *list, wifi_manager_scan_info_s **changes)
+{
+	wifi_manager_result_e res = WIFI_MANAGER_SUCCESS;
+	wifi_manager_scan_filter_s filter;
+	uint32_t now = _scan_cache_now();
+	uint32_t prev_gen;
+
+	LOCK_SCAN_CACHE;
+	prev_gen = g_scan_cache.gen;
+	g_scan_cache.gen++;
+	if (g_scan_cache.gen == 0) {
+		/* 0 means all APs in wifi_manager_scan_filter_s */
+		g_scan_cache.gen++;
+	}
+
+	for (wifi_manager_scan_info_s *iter = list; iter; iter = iter->next) {
+		struct wifimgr_scan_entry *e = _scan_cache_find(iter->bssid);
+		if (!e) {
+			e = _scan_cache_alloc();
+			e->used = true;
+			e->gen = g_scan_cache.gen;
+		} else if (_scan_cache_changed(&e->info, iter)) {
+			e->gen = g_scan_cache.gen;
+		}
+		memcpy(&e->info, iter, sizeof(wifi_manager_scan_info_s));
+		e->info.next = NULL;
+		e->seen = now;
+		e->scan = g_scan_cache.gen;
+	}
+
+	/* The APs which the scan should have found are gone */
+	if (!g_scan_cache.partial) {
+		for (int i = 0; i < CONFIG_WIFIMGR_SCAN_CACHE_SIZE; i++) {
+			struct wifimgr_scan_entry *e = &g_scan_cache.entry[i];
+			if (e->used && e->scan != g_scan_cache.gen
+				&& (g_scan_cache.channel == 0 || g_scan_cache.channel == e->info.channel)) {
+				NET_LOGV(TAG, "scan cache: %s is gone\n", e->info.bssid);
+				e->used = false;
+			}
+		}
+	}
+	/* a scan which wasn't requested through wifi manager is seen as a full one */
+	g_scan_cache.channel = 0;
+	g_scan_cache.partial = false;
+
+	if (changes) {
+		memset(&filter, 0, sizeof(wifi_manager_scan_filter_s));
+		filter.rssi_threshold = INT8_MIN;
+		filter.changed_since = prev_gen;
+		res = _scan_cache_copy(&filter, changes);
+	}
+	UNLOCK_SCAN_CACHE;
+
+	return res;
+}
+
+wifi_manager_result_e wifimgr_scan_cache_get(wifi_manager_scan_filter_s *filter, wifi_manager_scan_info_s **list, uint32_t *generation)
+{
+	wifi_manager_result_e res;
+
+	LOCK_SCAN_CACHE;
+	res = _scan_cache_copy(filter, list);
+	if (generation) {
+		*generation = g_scan_cache.gen;
+	}
+	UNLOCK_SCAN_CACHE;
+
+	return res;
+}
+
+void wifimgr_scan_cache_set_report(wifi_manager_scan_report_e mode)
+{
+	LOCK_SCAN_CACHE;
+	g_scan_cache.report = mode;
+	UNLOCK_SCAN_CACHE;
+}
+
+wifi_manager_scan_report_e wifimgr_scan_cache_get_report(void)
+{
+	return g_scan_cache.report;
+}
+
+void wifimgr_scan_cache_free(wifi_manager_scan_info_s *list)
+{
+	wifi_manager_scan_info_s *iter = list, *prev = NULL;
+	while (iter) {
+		prev = iter;
+		iter = iter->next;
+		free(prev);
+	}
+}
@@ -0,0 +1,43 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#pragma once
+
+#include <stdbool.h>
+#include <wifi_manager/wifi_manager.h>
+
+#ifdef CONFIG_WIFIMGR_SCAN_CACHE
+#define WIFIMGR_SCAN_CACHE_SCOPE(channel, partial) wifimgr_scan_cache_set_scope(channel, partial)
+
+/*
+ * The scan which is requested: APs of the cache on the channel (0 for all
+ * channels) which the scan doesn't find are removed, unless the scan is
+ * partial, i.e. it looks for specific SSIDs.
+ */
+void wifimgr_scan_cache_set_scope(unsigned int channel, bool partial);
+/*
+ * Merge the result of the scan and return, in changes, a copy of the APs
+ * it added or changed. changes may be NULL.
+ */
+wifi_manager_result_e wifimgr_scan_cache_update(wifi_manager_scan_info_s *list, wifi_manager_scan_info_s **changes);
+wifi_manager_result_e wifimgr_scan_cache_get(wifi_manager_scan_filter_s *filter, wifi_manager_scan_info_s **list, uint32_t *generation);
+void wifimgr_scan_cache_set_report(wifi_manager_scan_report_e mode);
+wifi_manager_scan_report_e wifimgr_scan_cache_get_report(void);
+void wifimgr_scan_cache_free(wifi_manager_scan_info_s *list);
+#else
+#define WIFIMGR_SCAN_CACHE_SCOPE(channel, partial)
+#endif
@@ -37,6 +37,9 @@
 #include "wifi_manager_state.h"
 #include "wifi_manager_info.h"
 #include "wifi_manager_lwnl.h"
+#include "wifi_manager_scan_cache.h"
+#include "wifi_manager_fastconn.h"
+#include "wifi_manager_linkstats.h"
 
 /*  Setting MACRO */
 static inline void WIFIMGR_SET_SSID(char *s)
@@ -153,6 +156,7 @@ static inline void WIFIMGR_SET_STATE(wifimgr_state_e s)
 	wifimgr_info_msg_s wmsg;
 	wmsg.state = s;
 	wifimgr_set_info(WIFIMGR_STATE, &wmsg);
+	WIFIMGR_LINK_STATE(s);
 }
 
 static inline char *wifimgr_get_state_str(int state)
@@ -234,10 +238,14 @@ wifi_manager_result_e _wifimgr_connect_ap(wifi_manager_ap_config_s *config)
 	util_config.ap_auth_type = wifimgr_convert2trwifi_auth(config->ap_auth_type);
 	util_config.ap_crypto_type = wifimgr_convert2trwifi_crypto(config->ap_crypto_type);
 
+	WIFIMGR_FAST_APPLY(&util_config);
+
 	trwifi_result_e wres = wifi_utils_connect_ap(&util_config, NULL);
 	if (wres == TRWIFI_ALREADY_CONNECTED) {
+		WIFIMGR_FAST_DONE();
 		return WIFI_MANAGER_ALREADY_CONNECTED;
 	} else if (wres != TRWIFI_SUCCESS) {
+		WIFIMGR_FAST_DONE();
 		WIFIADD_ERR_RECORD(ERR_WIFIMGR_CONNECT_FAIL);
 		return WIFI_MANAGER_FAIL;
 	}
@@ -301,6 +309,7 @@ wifi_manager_result_e _wifimgr_stop_softap(void)
 wifi_manager_result_e _wifimgr_scan(wifi_manager_scan_config_s *config)
 {
 	if (!config) {
+		WIFIMGR_SCAN_CACHE_SCOPE(0, false);
 		WIFIMGR_CHECK_UTILRESULT(wifi_utils_scan_ap(NULL), TAG,
 								 "request scan to wifi utils is fail");
 		return WIFI_MANAGER_SUCCESS;
@@ -316,6 +325,7 @@ wifi_manager_result_e _wifimgr_scan(wifi_manager_scan_config_s *config)
 		uconf.channel = config->channel;
 	}
 
+	WIFIMGR_SCAN_CACHE_SCOPE(config->channel, config->ssid_length > 0);
 	WIFIMGR_CHECK_UTILRESULT(wifi_utils_scan_ap((void *)&uconf), TAG,
 							 "request scan is fail");
 	return WIFI_MANAGER_SUCCESS;
@@ -323,6 +333,8 @@ wifi_manager_result_e _wifimgr_scan(wifi_manager_scan_config_s *config)
 
 static wifi_manager_result_e _wifimgr_scan_multi_aps(wifi_manager_scan_multi_configs_s *configs)
 {
+	/* APs not found by a scan of specific SSIDs only are kept */
+	WIFIMGR_SCAN_CACHE_SCOPE(0, configs && !configs->scan_all);
 	if (!configs) {
 		WIFIMGR_CHECK_UTILRESULT(wifi_utils_scan_multi_aps(NULL), TAG,
 								 "request scan multi aps to wifi utils is fail");
@@ -470,18 +482,27 @@ wifi_manager_result_e _handler_on_connecting_state(wifimgr_msg_s *msg)
 		wifi_manager_result_e wret;
 		wret = dhcpc_get_ipaddr();
 		if (wret != WIFI_MANAGER_SUCCESS) {
+			WIFIMGR_FAST_DONE();
 			WIFIMGR_CHECK_RESULT(_wifimgr_disconnect_ap(), (TAG, "critical error: DHCP failure\n"), WIFI_MANAGER_FAIL);
 			WIFIMGR_SET_SUBSTATE(WIFIMGR_DISCONN_INTERNAL_ERROR, NULL);
 			WIFIMGR_SET_STATE(WIFIMGR_STA_DISCONNECTING);
 			return wret;
 		}
 #endif
+		WIFIMGR_FAST_UPDATE((trwifi_cbk_msg_s *)msg->param);
+		WIFIMGR_FAST_DONE();
 		wifimgr_call_cb(CB_STA_CONNECTED, msg->param);
 		WIFIMGR_SET_STATE(WIFIMGR_STA_CONNECTED);
 	} else if (msg->event == WIFIMGR_EVT_STA_CONNECT_FAILED) {
+		if (WIFIMGR_FAST_RETRY() == WIFI_MANAGER_SUCCESS) {
+			/* still connecting */
+			return WIFI_MANAGER_SUCCESS;
+		}
+		WIFIMGR_FAST_DONE();
 		wifimgr_call_cb(CB_STA_CONNECT_FAILED, msg->param);
 		WIFIMGR_SET_STATE(WIFIMGR_STA_DISCONNECTED);
 	} else if (msg->event == WIFIMGR_CMD_DEINIT) {
+		WIFIMGR_FAST_DONE();
 		WIFIMGR_SET_SUBSTATE(WIFIMGR_DISCONN_DEINIT, msg->signal);
 		WIFIMGR_SET_STATE(WIFIMGR_STA_DISCONNECTING);
 	} else {
@@ -632,6 +653,9 @@ wifi_manager_result_e _handler_set_powermode(wifimgr_msg_s *msg)
 	}
 	trwifi_msg_s tmsg = {TRWIFI_MSG_SET_POWERMODE, (void *)(&imode)};
 	trwifi_result_e res = wifi_utils_ioctl(&tmsg);
+	if (res == TRWIFI_SUCCESS) {
+		WIFIMGR_LINK_POWERMODE(mode == WIFI_MANAGER_POWERMODE_ENABLE);
+	}
 	return wifimgr_convert2wifimgr_res(res);
 }
 
@@ -0,0 +1,88 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <fixedmath.h>
+
+/****************************************************************************
+ * Global Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ub16sqrt
+ *
+ * Description:
+ *   Square root, within 0.51 of the last bit of the exact root, by the
+ *   digit by digit method in 32 bits: the integer half of the root first,
+ *   then the fraction half after a shift of the remainder.
+ *
+ ****************************************************************************/
+
+ub16_t ub16sqrt(ub16_t a)
+{
+	uint32_t root = 0;
+	uint32_t rem = a;
+	uint32_t bit = (uint32_t)1 << 30;
+	int pass;
+
+	while (bit > rem) {
+		bit >>= 2;
+	}
+
+	for (pass = 0; pass < 2; pass++) {
+		while (bit != 0) {
+			if (rem >= root + bit) {
+				rem -= root + bit;
+				root = (root >> 1) + bit;
+			} else {
+				root >>= 1;
+			}
+
+			bit >>= 2;
+		}
+
+		if (pass == 0) {
+			/* Shift in 16 more bits of the root, the remainder may not
+			 * fit in 32 bits after the shift: then take half a bit of
+			 * the root out of it first.
+			 */
+
+			if (rem > 0xffff) {
+				rem -= root;
+				rem = (rem << 16) - 0x8000;
+				root = (root << 16) + 0x8000;
+			} else {
+				rem <<= 16;
+				root <<= 16;
+			}
+
+			bit = (uint32_t)1 << 14;
+		}
+	}
+
+	/* Round the last bit */
+
+	if (rem > root) {
+		root++;
+	}
+
+	return root;
+}
@@ -60,6 +60,7 @@
 #include <tinyara/config.h>
 
 #include <sys/types.h>
+#include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <limits.h>
@@ -220,6 +221,14 @@ void lib_skipspace(const char **pptr);
 
 bool lib_isbasedigit(int ch, int base, int *value);
 
+/* Defined in lib_decdigits.c */
+
+int lib_decdigits(FAR const char *ptr, int maxdigits, FAR uint32_t *value);
+
+/* Defined in lib_decmant.c */
+
+int lib_decmant(FAR const char **pptr, FAR uint64_t *mant, FAR int *exponent);
+
 /* Defined in lib_checkbase.c */
 
 int lib_checkbase(int base, const char **pptr);
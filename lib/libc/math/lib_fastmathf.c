@@ -0,0 +1,356 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/************************************************************************
+ * libc/math/lib_fastmathf.c
+ *
+ * Reduced precision float functions for signal processing, inference
+ * post-processing and graphics, and their array versions.  They keep a
+ * relative error of a few ulp on the usual ranges, and trade errno,
+ * subnormal results and the large arguments of the trigonometry for
+ * speed:
+ *
+ *   - expf_fast() returns 0 below -87.3, where the results would be
+ *     subnormal.
+ *   - sinf_fast(), cosf_fast() and sincosf_fast() lose the precision of
+ *     the result with |x| above 2^13, as their argument reduction is done
+ *     in float.
+ *
+ * The polynomials are evaluated with fused multiply-adds on the cores
+ * which have them.
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Included Files
+ ************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <math.h>
+
+#ifdef CONFIG_LIBM_FASTMATH
+
+/************************************************************************
+ * Pre-processor Definitions
+ ************************************************************************/
+
+#ifdef __FP_FAST_FMAF
+#define FMAF(a, b, c)      __builtin_fmaf(a, b, c)
+#else
+#define FMAF(a, b, c)      ((a) * (b) + (c))
+#endif
+
+#define LOG2E_F            1.44269504089f
+#define LN2HI_F            6.9314575195e-01f	/* 0x3f317200 */
+#define LN2LO_F            1.4286067653e-06f	/* 0x35bfbe8e */
+#define EXP_MAX_F          88.7228393555f
+#define EXP_MIN_F          -87.3365478516f
+
+#define TWO_OVER_PI_F      0.636619772368f
+#define PIO2_1_F           1.5703125f			/* 8 bits of pi/2 */
+#define PIO2_2_F           4.8375129699707031e-04f	/* 12 more bits */
+#define PIO2_3_F           7.5497901264e-08f
+
+#define SQRT_HALF_F        0.707106781187f
+
+/* Round to the nearest integer, for |x| < 2^22 */
+
+#define ROUNDF_MAGIC       12582912.0f			/* 1.5 * 2^23 */
+
+/************************************************************************
+ * Private Types
+ ************************************************************************/
+
+union fastmath_bits_u {
+	float f;
+	uint32_t u;
+};
+
+/************************************************************************
+ * Private Functions
+ ************************************************************************/
+
+static inline float fast_expf(float x)
+{
+	union fastmath_bits_u scale;
+	float k;
+	float r;
+	float p;
+
+	if (!(x < EXP_MAX_F)) {
+		return x != x ? x : INFINITY;
+	}
+
+	if (x < EXP_MIN_F) {
+		return 0.0f;
+	}
+
+	/* x = k * ln2 + r, |r| <= ln2 / 2 */
+
+	k = (FMAF(x, LOG2E_F, ROUNDF_MAGIC)) - ROUNDF_MAGIC;
+	r = FMAF(k, -LN2HI_F, x);
+	r = FMAF(k, -LN2LO_F, r);
+
+	/* exp(r) by its Taylor series to r^6 */
+
+	p = FMAF(r, 1.0f / 720.0f, 1.0f / 120.0f);
+	p = FMAF(p, r, 1.0f / 24.0f);
+	p = FMAF(p, r, 1.0f / 6.0f);
+	p = FMAF(p, r, 0.5f);
+	p = FMAF(p, r, 1.0f);
+	p = FMAF(p, r, 1.0f);
+
+	/* 2^k built in the exponent, in two steps at the top of the range */
+
+	if (k > 127.0f) {
+		p *= 2.0f;
+		k -= 1.0f;
+	}
+
+	scale.u = (uint32_t)((int32_t)k + 127) << 23;
+	return p * scale.f;
+}
+
+static inline float fast_logf(float x)
+{
+	union fastmath_bits_u bits;
+	float f;
+	float s;
+	float s2;
+	float p;
+	int32_t e;
+
+	bits.f = x;
+	if (bits.u - 0x00800000 >= 0x7f000000) {
+		/* Zero, subnormal, negative, infinite or NaN */
+
+		if ((bits.u << 1) == 0) {
+			return -INFINITY;
+		}
+
+		if (bits.u >= 0x7f800000) {
+			return x < 0.0f ? NAN : x;
+		}
+
+		/* Subnormal, scaled by 2^23 */
+
+		bits.f = x * 8388608.0f;
+		e = -23;
+	} else {
+		e = 0;
+	}
+
+	/* x = 2^e * m, sqrt(1/2) <= m < sqrt(2) */
+
+	e += (int32_t)(bits.u >> 23) - 127;
+	bits.u = (bits.u & 0x007fffff) | 0x3f800000;
+	if (bits.f > 2.0f * SQRT_HALF_F) {
+		bits.f *= 0.5f;
+		e++;
+	}
+
+	/* log(m) = 2 * atanh(s), s = (m - 1) / (m + 1), |s| < 0.172 */
+
+	f = bits.f - 1.0f;
+	s = f / (bits.f + 1.0f);
+	s2 = s * s;
+	p = FMAF(s2, 2.0f / 7.0f, 2.0f / 5.0f);
+	p = FMAF(p, s2, 2.0f / 3.0f);
+	p = FMAF(p, s2, 2.0f);
+
+	return FMAF((float)e, LN2HI_F, FMAF((float)e, LN2LO_F, p * s));
+}
+
+/* sin(r) and cos(r) for |r| <= pi/4, with the coefficients of the
+ * minimax polynomials of FreeBSD's __kernel_sindf() and __kernel_cosdf().
+ */
+
+static inline float fast_sinpoly(float r)
+{
+	float r2 = r * r;
+	float p;
+
+	p = FMAF(r2, 2.718311493989822e-6f, -1.9839334836096632e-4f);
+	p = FMAF(p, r2, 8.3333293858894186e-3f);
+	p = FMAF(p, r2, -1.6666666641626524e-1f);
+	return FMAF(p * r2, r, r);
+}
+
+static inline float fast_cospoly(float r)
+{
+	float r2 = r * r;
+	float p;
+
+	p = FMAF(r2, 2.4390448796277409e-5f, -1.3886763774609929e-3f);
+	p = FMAF(p, r2, 4.1666623323739063e-2f);
+	p = FMAF(p, r2, -4.9999999725103100e-1f);
+	return FMAF(p, r2, 1.0f);
+}
+
+/* x = q * pi/2 + r, |r| <= pi/4 */
+
+static inline float fast_reduce(float x, FAR int *quadrant)
+{
+	float k;
+	float r;
+
+	k = FMAF(x, TWO_OVER_PI_F, ROUNDF_MAGIC) - ROUNDF_MAGIC;
+	r = FMAF(k, -PIO2_1_F, x);
+	r = FMAF(k, -PIO2_2_F, r);
+	r = FMAF(k, -PIO2_3_F, r);
+
+	*quadrant = (int)k;
+	return r;
+}
+
+static inline void fast_sincosf(float x, FAR float *sinx, FAR float *cosx)
+{
+	float s;
+	float c;
+	float t;
+	int q;
+
+	if (!(fabsf(x) < 4194304.0f)) {
+		/* NaN and infinite give NaN, larger values have no fraction of
+		 * pi/2 left in float.
+		 */
+
+		if (x != x || fabsf(x) == INFINITY) {
+			*sinx = *cosx = NAN;
+			return;
+		}
+
+		x = fmodf(x, 6.283185307f);
+	}
+
+	x = fast_reduce(x, &q);
+	s = fast_sinpoly(x);
+	c = fast_cospoly(x);
+
+	if (q & 1) {
+		t = s;
+		s = c;
+		c = -t;
+	}
+
+	if (q & 2) {
+		s = -s;
+		c = -c;
+	}
+
+	*sinx = s;
+	*cosx = c;
+}
+
+static inline float fast_sinf(float x)
+{
+	float s;
+	float c;
+
+	fast_sincosf(x, &s, &c);
+	return s;
+}
+
+static inline float fast_cosf(float x)
+{
+	float s;
+	float c;
+
+	fast_sincosf(x, &s, &c);
+	return c;
+}
+
+/************************************************************************
+ * Public Functions
+ ************************************************************************/
+
+float expf_fast(float x)
+{
+	return fast_expf(x);
+}
+
+float logf_fast(float x)
+{
+	return fast_logf(x);
+}
+
+float sinf_fast(float x)
+{
+	return fast_sinf(x);
+}
+
+float cosf_fast(float x)
+{
+	return fast_cosf(x);
+}
+
+void sincosf_fast(float x, FAR float *sinx, FAR float *cosx)
+{
+	fast_sincosf(x, sinx, cosx);
+}
+
+/* The array versions, where y may be x */
+
+void vexpf(FAR float *y, FAR const float *x, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		y[i] = fast_expf(x[i]);
+	}
+}
+
+void vlogf(FAR float *y, FAR const float *x, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		y[i] = fast_logf(x[i]);
+	}
+}
+
+void vsinf(FAR float *y, FAR const float *x, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		y[i] = fast_sinf(x[i]);
+	}
+}
+
+void vcosf(FAR float *y, FAR const float *x, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		y[i] = fast_cosf(x[i]);
+	}
+}
+
+void vsincosf(FAR float *sinx, FAR float *cosx, FAR const float *x, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		fast_sincosf(x[i], &sinx[i], &cosx[i]);
+	}
+}
+
+#endif /* CONFIG_LIBM_FASTMATH */
@@ -61,7 +61,6 @@
 double sqrt(double x)
 {
 	double y;
-	double y1;
 
 	/* Filter out invalid/trivial inputs */
 
@@ -70,6 +69,12 @@ double sqrt(double x)
 		return NAN;
 	}
 
+#if defined(__ARM_FP) && (__ARM_FP & 8)
+	/* The FPU square root is exact and handles NaN, infinity and zero */
+
+	__asm__("vsqrt.f64 %P0, %P1" : "=w"(y) : "w"(x));
+	return y;
+#else
 	if (isnan(x)) {
 		return NAN;
 	}
@@ -100,7 +105,8 @@ double sqrt(double x)
 	 */
 
 	if (y * y < x - 1.0 || y * y > x + 1.0) {
-		y1 = -1.0;
+		double y1 = -1.0;
+
 		while (y != y1) {
 			y1 = y;
 			y = 0.5 * (y + x / y);
@@ -108,5 +114,6 @@ double sqrt(double x)
 	}
 
 	return y;
+#endif
 }
 #endif
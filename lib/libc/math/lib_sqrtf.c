@@ -58,7 +58,6 @@
 float sqrtf(float x)
 {
 	float y;
-	float y1;
 
 	/* Filter out invalid/trivial inputs */
 
@@ -67,6 +66,12 @@ float sqrtf(float x)
 		return NAN;
 	}
 
+#if defined(__ARM_FP) && (__ARM_FP & 4)
+	/* The FPU square root is exact and handles NaN, infinity and zero */
+
+	__asm__("vsqrt.f32 %0, %1" : "=t"(y) : "t"(x));
+	return y;
+#else
 	if (isnan(x)) {
 		return NAN;
 	}
@@ -97,7 +102,8 @@ float sqrtf(float x)
 	 */
 
 	if (y * y < x - 1.0 || y * y > x + 1.0) {
-		y1 = -1.0;
+		float y1 = -1.0;
+
 		while (y != y1) {
 			y1 = y;
 			y = 0.5 * (y + x / y);
@@ -105,4 +111,5 @@ float sqrtf(float x)
 	}
 
 	return y;
+#endif
 }
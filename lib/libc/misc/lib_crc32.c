@@ -64,6 +64,12 @@
 #include <stdint.h>
 #include <crc32.h>
 
+/************************************************************************************************
+ * Pre-processor Definitions
+ ************************************************************************************************/
+
+#define CRC32_POLY  0xedb88320	/* Reflected polynomial, bit 31 is x^0 */
+
 /************************************************************************************************
  * Private Data
  ************************************************************************************************/
@@ -103,6 +109,30 @@ static const uint32_t crc32_tab[] = {
 	0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 };
 
+/************************************************************************************************
+ * Private Functions
+ ************************************************************************************************/
+
+/* Multiply the polynomials 'a' and 'b' modulo the CRC polynomial */
+
+static uint32_t crc32_multmodp(uint32_t a, uint32_t b)
+{
+	uint32_t m = (uint32_t)1 << 31;
+	uint32_t p = 0;
+
+	for (;;) {
+		if (a & m) {
+			p ^= b;
+			if ((a & (m - 1)) == 0) {
+				break;
+			}
+		}
+		m >>= 1;
+		b = (b & 1) ? (b >> 1) ^ CRC32_POLY : b >> 1;
+	}
+	return p;
+}
+
 /************************************************************************************************
  * Public Functions
  ************************************************************************************************/
@@ -137,3 +167,32 @@ uint32_t crc32(FAR const uint8_t *src, size_t len)
 {
 	return crc32part(src, len, 0);
 }
+
+/************************************************************************************************
+ * Name: crc32combine
+ *
+ * Description:
+ *   Return the CRC of two parts from the CRC of each part.  The CRC of the first part is
+ *   multiplied by x^(8 * len2), as if the zeroes of the second part were added to it.
+ *
+ ************************************************************************************************/
+
+uint32_t crc32combine(uint32_t crc1, uint32_t crc2, size_t len2)
+{
+	uint32_t xn = (uint32_t)1 << 30;	/* x^1, squared to x^8, x^16, ... */
+	uint32_t p = (uint32_t)1 << 31;		/* x^0 */
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		xn = crc32_multmodp(xn, xn);
+	}
+	while (len2 > 0) {
+		if (len2 & 1) {
+			p = crc32_multmodp(xn, p);
+		}
+		xn = crc32_multmodp(xn, xn);
+		len2 >>= 1;
+	}
+
+	return crc32_multmodp(p, crc1) ^ crc2;
+}
@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <sys/time.h>
+#include <time.h>
+#include <errno.h>
+#include <syscall.h>
+
+#include <tinyara/clock.h>
+#include <tinyara/vdso.h>
+
+/* The kernel has its own getpid(), clock(), clock_gettime() and
+ * gettimeofday(), this file only replaces their system call proxies in the
+ * user-space library.
+ */
+
+#if defined(CONFIG_LIB_SYSCALL_VDSO) && !defined(__KERNEL__)
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* Written by the kernel through the userspace header of the binary */
+
+struct vdso_data_s g_vdso;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Copy a consistent snapshot of the page.  The kernel writes it from the
+ * tick interrupt, which may come between two reads of the fields.
+ */
+
+static void vdso_read(FAR struct vdso_data_s *data)
+{
+	FAR volatile struct vdso_data_s *vdso = &g_vdso;
+	uint32_t seq;
+
+	do {
+		seq = vdso->seq;
+		data->pid = vdso->pid;
+		data->systimer = vdso->systimer;
+		data->basetime.tv_sec = vdso->basetime.tv_sec;
+		data->basetime.tv_nsec = vdso->basetime.tv_nsec;
+	} while (seq != vdso->seq);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: getpid
+ *
+ * Description:
+ *   Return the PID of the calling thread from the vDSO page.  The page is
+ *   only empty before the first switch to a thread of the binary, which
+ *   cannot have called this yet, but the system call is kept for it.
+ *
+ ****************************************************************************/
+
+pid_t getpid(void)
+{
+	pid_t pid = g_vdso.pid;
+
+	if (pid > 0) {
+		return pid;
+	}
+
+	return (pid_t)sys_call0((unsigned int)SYS_getpid);
+}
+
+/****************************************************************************
+ * Name: clock
+ ****************************************************************************/
+
+clock_t clock(void)
+{
+	struct vdso_data_s data;
+
+	vdso_read(&data);
+	return data.systimer;
+}
+
+/****************************************************************************
+ * Name: clock_gettime
+ *
+ * Description:
+ *   CLOCK_REALTIME and CLOCK_MONOTONIC from the system timer and the base
+ *   time of the vDSO page, computed as in the kernel by clock_systimespec()
+ *   and clock_gettime().  The other clocks take the system call.
+ *
+ ****************************************************************************/
+
+int clock_gettime(clockid_t clock_id, FAR struct timespec *tp)
+{
+	struct vdso_data_s data;
+#if defined(CONFIG_HAVE_LONG_LONG) && (CONFIG_USEC_PER_TICK % 1000) != 0
+	uint64_t usecs;
+	uint64_t secs;
+#else
+	clock_t msecs;
+	clock_t secs;
+#endif
+
+	if (tp == NULL || (clock_id != CLOCK_REALTIME
+#ifdef CONFIG_CLOCK_MONOTONIC
+					   && clock_id != CLOCK_MONOTONIC
+#endif
+					  )) {
+		return (int)sys_call2((unsigned int)SYS_clock_gettime, (uintptr_t)clock_id, (uintptr_t)tp);
+	}
+
+	vdso_read(&data);
+
+#if defined(CONFIG_HAVE_LONG_LONG) && (CONFIG_USEC_PER_TICK % 1000) != 0
+	usecs = TICK2USEC((uint64_t)data.systimer);
+	secs = usecs / USEC_PER_SEC;
+	tp->tv_sec = (time_t)secs;
+	tp->tv_nsec = (long)((usecs - secs * USEC_PER_SEC) * NSEC_PER_USEC);
+#else
+	msecs = TICK2MSEC(data.systimer);
+	secs = msecs / MSEC_PER_SEC;
+	tp->tv_sec = (time_t)secs;
+	tp->tv_nsec = (long)((msecs - secs * MSEC_PER_SEC) * NSEC_PER_MSEC);
+#endif
+
+	if (clock_id == CLOCK_REALTIME) {
+		tp->tv_sec += (uint32_t)data.basetime.tv_sec;
+		tp->tv_nsec += (uint32_t)data.basetime.tv_nsec;
+		if (tp->tv_nsec >= NSEC_PER_SEC) {
+			tp->tv_sec += tp->tv_nsec / NSEC_PER_SEC;
+			tp->tv_nsec %= NSEC_PER_SEC;
+		}
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: gettimeofday
+ ****************************************************************************/
+
+int gettimeofday(struct timeval *tv, FAR struct timezone *tz)
+{
+	struct timespec ts;
+
+	if (tv == NULL) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	tv->tv_sec = ts.tv_sec;
+	tv->tv_usec = ts.tv_nsec / NSEC_PER_USEC;
+	return OK;
+}
+
+#endif							/* CONFIG_LIB_SYSCALL_VDSO && !__KERNEL__ */
@@ -0,0 +1,125 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <errno.h>
+#include <syscall.h>
+
+#include <tinyara/pthread.h>
+
+/* The kernel has its own pthread_mutex_lock() and friends, this file only
+ * replaces their system call proxies in the user-space library.
+ */
+
+#if defined(CONFIG_PTHREAD_MUTEX_FASTPATH) && !defined(__KERNEL__)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* The count of the semaphore underlying a mutex is 1 when it is unlocked,
+ * 0 when it is locked and -n when it is locked with n waiters.  Those are
+ * the states the kernel expects, so an uncontended mutex can be locked by
+ * moving the count from 1 to 0 and unlocked by moving it back from 0 to 1.
+ *
+ * The kernel updates the count in a critical section, which cannot be
+ * interleaved with user space on a single CPU, and the exclusive monitor
+ * is cleared on exception entry.  The compare-and-swap is a strong one: an
+ * interrupted exclusive store is retried with a fresh load of the count,
+ * so it fails only if the count is not 'from', and only then does the
+ * caller fall back to the system call.  A weak one could make trylock
+ * report EBUSY on a free mutex.
+ */
+
+static inline bool pthread_mutex_setcount(FAR pthread_mutex_t *mutex, int16_t from, int16_t to)
+{
+	return __atomic_compare_exchange_n(&mutex->sem.semcount, &from, to, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_mutex_lock
+ *
+ * Description:
+ *   Lock the mutex in user space if it is free, otherwise enter the kernel
+ *   to wait for it.  See os/kernel/pthread/pthread_mutexlock.c.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_lock(FAR pthread_mutex_t *mutex)
+{
+	if (mutex != NULL && pthread_mutex_isfast(mutex) && pthread_mutex_setcount(mutex, 1, 0)) {
+		return OK;
+	}
+
+	return (int)sys_call1((unsigned int)SYS_pthread_mutex_lock, (uintptr_t)mutex);
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_trylock
+ *
+ * Description:
+ *   Lock the mutex in user space if it is free.  A taken fast mutex
+ *   returns EBUSY without entering the kernel.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_trylock(FAR pthread_mutex_t *mutex)
+{
+	if (mutex != NULL && pthread_mutex_isfast(mutex)) {
+		return pthread_mutex_setcount(mutex, 1, 0) ? OK : EBUSY;
+	}
+
+	return (int)sys_call1((unsigned int)SYS_pthread_mutex_trylock, (uintptr_t)mutex);
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_unlock
+ *
+ * Description:
+ *   Unlock the mutex in user space if nobody waits for it, otherwise enter
+ *   the kernel to wake up the next holder.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
+{
+	if (mutex != NULL && pthread_mutex_isfast(mutex)) {
+		/* The kernel records the holder when it locked the mutex itself */
+
+		mutex->pid = -1;
+		if (pthread_mutex_setcount(mutex, 0, 1)) {
+			return OK;
+		}
+	}
+
+	return (int)sys_call1((unsigned int)SYS_pthread_mutex_unlock, (uintptr_t)mutex);
+}
+
+#endif							/* CONFIG_PTHREAD_MUTEX_FASTPATH && !__KERNEL__ */
@@ -125,6 +125,11 @@ int sem_init(FAR sem_t *sem, int pshared, unsigned int value)
 #ifdef SAVE_SEM_HOLDER
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
 		sem->hhead = NULL;
+#ifdef SEM_INLINE_HOLDER
+		sem->holder.flink = NULL;
+		sem->holder.htcb = NULL;
+		sem->holder.counts = 0;
+#endif
 #else
 		sem->holder.htcb = NULL;
 		sem->holder.counts = 0;
@@ -58,6 +58,7 @@
 #include <sys/types.h>
 
 #include "lib_dtoa_engine.h"
+#include "lib_ultoa_invert.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -71,8 +72,8 @@
 #define SUBSTITUTE(a) PASTE(a)
 #define MIN_MANT      (SUBSTITUTE(DBL_DIG))
 #define MAX_MANT      (10.0 * MIN_MANT)
-#define MIN_MANT_INT  ((uint64_t)MIN_MANT)
 #define MIN_MANT_EXP  DBL_DIG
+#define MANT_GROUPS   ((MIN_MANT_EXP + 8) / 8)
 
 #define MAX(a, b)     ((a) > (b) ? (a) : (b))
 #define MIN(a, b)     ((a) < (b) ? (a) : (b))
@@ -148,17 +149,24 @@ int __dtoa_engine(double_t x, FAR struct dtoa_s *dtoa, int max_digits, int max_d
 			exp++;
 		}
 
-		/* Now convert mantissa to decimal. */
+		/* Now convert mantissa to decimal, by groups of 8 digits in 32 bits
+		 * instead of a 64 bit division per digit.  The digits come least
+		 * significant first, the master one at index MIN_MANT_EXP.
+		 */
 
 		uint64_t mant = (uint64_t) x;
-		uint64_t decimal = MIN_MANT_INT;
+		char digits[8 * MANT_GROUPS];
+		FAR char *p = digits;
+
+		for (i = 0; i < MANT_GROUPS - 1; i++) {
+			p = __ultoa_dec32((uint32_t)(mant % 100000000), p, 8);
+			mant /= 100000000;
+		}
 
-		/* Compute digits */
+		__ultoa_dec32((uint32_t)mant, p, 8);
 
 		for (i = 0; i < max_digits; i++) {
-			dtoa->digits[i] = mant / decimal + '0';
-			mant %= decimal;
-			decimal /= 10;
+			dtoa->digits[i] = digits[MIN_MANT_EXP - i];
 		}
 	}
 
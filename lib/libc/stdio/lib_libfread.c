@@ -154,11 +154,18 @@ ssize_t lib_fread(FAR void *ptr, size_t count, FAR FILE *stream)
 		while (count > 0) {
 			/* Is there readable data in the buffer? */
 
-			while ((count > 0) && (stream->fs_bufpos < stream->fs_bufread)) {
-				/* Yes, copy a byte into the user buffer */
+			if (stream->fs_bufpos < stream->fs_bufread) {
+				/* Yes, copy as much as needed into the user buffer */
 
-				*dest++ = *stream->fs_bufpos++;
-				count--;
+				size_t gulp_size = stream->fs_bufread - stream->fs_bufpos;
+				if (gulp_size > count) {
+					gulp_size = count;
+				}
+
+				memcpy(dest, stream->fs_bufpos, gulp_size);
+				stream->fs_bufpos += gulp_size;
+				dest += gulp_size;
+				count -= gulp_size;
 			}
 
 			/* The buffer is empty OR we have already supplied the number of
@@ -181,11 +188,13 @@ ssize_t lib_fread(FAR void *ptr, size_t count, FAR FILE *stream)
 
 				/* Will the number of bytes that we need to read fit into
 				 * the buffer space that is available? If the read size is
-				 * larger than the buffer, then read some of the data
-				 * directly into the user's buffer.
+				 * as large as the buffer, then read the data directly into
+				 * the user's buffer: the read-ahead would not save a read,
+				 * only add a copy.  The buffer size given to setvbuf() so
+				 * sets both the read-ahead and the limit of the copies.
 				 */
 
-				if (count > buffer_available) {
+				if (count >= buffer_available) {
 					bytes_read = read(stream->fs_fd, dest, count);
 					if (bytes_read < 0) {
 						/* An error occurred on the read.  The error code is
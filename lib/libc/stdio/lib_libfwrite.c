@@ -59,6 +59,7 @@
 #include <sys/types.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -107,7 +108,6 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
 	FAR const unsigned char *start = ptr;
 	FAR const unsigned char *src = ptr;
 	ssize_t ret = ERROR;
-	unsigned char *dest;
 
 	/* Make sure that writing to this stream is allowed */
 
@@ -129,13 +129,29 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
 		goto errout_with_semaphore;
 	}
 
-	/* Loop until all of the bytes have been buffered */
+	/* Loop until all of the bytes have been buffered or written */
 
 	while (count > 0) {
 		/* Determine the number of bytes left in the buffer */
 
 		size_t gulp_size = stream->fs_bufend - stream->fs_bufpos;
 
+		/* With an empty buffer, data that would fill it is written directly
+		 * from the user buffer.  That saves a copy of the large writes, and
+		 * is all that an unbuffered (_IONBF) stream does.
+		 */
+
+		if (stream->fs_bufpos == stream->fs_bufstart && count >= gulp_size) {
+			ssize_t bytes_written = write(stream->fs_fd, src, count);
+			if (bytes_written < 0) {
+				goto errout_with_semaphore;
+			}
+
+			src += bytes_written;
+			count -= bytes_written;
+			continue;
+		}
+
 		/* Will the user data fit into the amount of buffer space
 		 * that we have left?
 		 */
@@ -146,23 +162,19 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
 			gulp_size = count;
 		}
 
-		/* Adjust the number of bytes remaining to be transferred
-		 * on the next pass through the loop (might be zero).
+		/* Transfer the data into the buffer and adjust the number of
+		 * bytes remaining to be transferred on the next pass through the
+		 * loop (might be zero).
 		 */
 
+		memcpy(stream->fs_bufpos, src, gulp_size);
+		stream->fs_bufpos += gulp_size;
+		src += gulp_size;
 		count -= gulp_size;
 
-		/* Transfer the data into the buffer */
-
-		for (dest = stream->fs_bufpos; gulp_size > 0; gulp_size--) {
-			*dest++ = *src++;
-		}
-
-		stream->fs_bufpos = dest;
-
 		/* Is the buffer full? */
 
-		if (dest >= stream->fs_bufend) {
+		if (stream->fs_bufpos >= stream->fs_bufend) {
 			/* Flush the buffered data to the IO stream */
 
 			int bytes_buffered = lib_fflush(stream, false);
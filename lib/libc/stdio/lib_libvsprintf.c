@@ -215,6 +215,45 @@ static int vsprintf_internal(FAR struct lib_outstream_s *stream, FAR struct arg
 #endif
 		}
 
+		/* Fast path of the bare %s, %d, %u and %x, most of the conversions
+		 * of the logs and of the protocol texts: no flag, width, precision
+		 * or length to parse and no padding to compute.
+		 */
+
+#ifdef CONFIG_LIBC_NUMBERED_ARGS
+		if (stream != NULL)
+#endif
+		{
+			if (c == 's') {
+				pnt = va_arg(ap, FAR char *);
+				if (pnt == NULL) {
+					pnt = g_nullstring;
+				}
+
+				while (*pnt) {
+					putc(*pnt++, stream);
+				}
+
+				continue;
+			}
+
+			if (c == 'd' || c == 'u' || c == 'x') {
+				unsigned int x = va_arg(ap, unsigned int);
+
+				if (c == 'd' && (int)x < 0) {
+					putc('-', stream);
+					x = -x;
+				}
+
+				c = __ultoa_invert(x, (FAR char *)buf, c == 'x' ? 16 : 10) - (FAR char *)buf;
+				while (c) {
+					putc(buf[--c], stream);
+				}
+
+				continue;
+			}
+		}
+
 		flags = 0;
 		width = 0;
 		prec = 0;
@@ -92,6 +92,12 @@
  * by the setvbuf() function. The contents of the array at any time are
  * unspecified.
  *
+ * The size is also the read-ahead of the stream and the limit of its
+ * copies: fread() fills the buffer with reads of that size, and fread() or
+ * fwrite() of at least that size go directly between the file and the user
+ * memory.  A stream of large records, such as a media file or a model,
+ * may so be given a buffer of the size of its small reads only.
+ *
  * Input Parameters:
  *   stream - the stream to flush
  *   buffer - the user allocate buffer. If NULL, will allocates a buffer of
@@ -54,12 +54,74 @@
  * Included Files
  ****************************************************************************/
 
+#include <stdint.h>
+
 #include "lib_ultoa_invert.h"
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The decimal digits of 0 to 99, so that one division gives two digits */
+
+static const char g_digits2[200] = {
+	'0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+	'1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+	'2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+	'3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+	'4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+	'5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+	'6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+	'7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+	'8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+	'9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
+};
+
+static const char g_xdigits[2][16] = {
+	{ '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' },
+	{ '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' }
+};
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: __ultoa_dec32
+ *
+ * Description:
+ *   The decimal digits of a 32 bit value, at least ndigits with leading
+ *   zeros, in the reverse order as __ultoa_invert().
+ *
+ ****************************************************************************/
+
+FAR char *__ultoa_dec32(uint32_t val, FAR char *str, int ndigits)
+{
+	FAR const char *pair;
+	FAR char *end = str + ndigits;
+
+	while (val >= 100) {
+		pair = &g_digits2[2 * (val % 100)];
+		val /= 100;
+		*str++ = pair[1];
+		*str++ = pair[0];
+	}
+
+	if (val >= 10) {
+		pair = &g_digits2[2 * val];
+		*str++ = pair[1];
+		*str++ = pair[0];
+	} else {
+		*str++ = '0' + val;
+	}
+
+	while (str < end) {
+		*str++ = '0';
+	}
+
+	return str;
+}
+
 #ifdef CONFIG_LIBC_LONG_LONG
 FAR char *__ultoa_invert(unsigned long long val, FAR char *str, int base)
 #else
@@ -72,6 +134,32 @@ FAR char *__ultoa_invert(unsigned long val, FAR char *str, int base)
 		upper = 1;
 		base &= ~XTOA_UPPER;
 	}
+
+	/* Base 10 by 8 digit groups in 32 bits, then by digit pairs, so that a
+	 * 64 bit value costs at most two 64 bit divisions.  The powers of 2 are
+	 * shifted out.
+	 */
+
+	if (base == 10) {
+		while (val > UINT32_MAX) {
+			str = __ultoa_dec32((uint32_t)(val % 100000000), str, 8);
+			val /= 100000000;
+		}
+
+		return __ultoa_dec32((uint32_t)val, str, 1);
+	}
+
+	if (base == 16 || base == 8) {
+		int shift = base == 16 ? 4 : 3;
+
+		do {
+			*str++ = g_xdigits[upper][val & (base - 1)];
+			val >>= shift;
+		} while (val);
+
+		return str;
+	}
+
 	do {
 		int v;
 
@@ -60,6 +60,8 @@
 #include <tinyara/config.h>
 #include <tinyara/compiler.h>
 
+#include <stdint.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -89,4 +91,8 @@ FAR char *__ultoa_invert(unsigned long long val, FAR char *str, int base);
 FAR char *__ultoa_invert(unsigned long val, FAR char *str, int base);
 #endif
 
+/* Decimal digits of a 32 bit value, with leading zeros up to 'ndigits'. */
+
+FAR char *__ultoa_dec32(uint32_t val, FAR char *str, int ndigits);
+
 #endif							/* __LIBS_LIBC_STDIO_LIB_ULTOA_INVERT_H */
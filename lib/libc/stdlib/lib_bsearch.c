@@ -105,47 +105,38 @@
  *   the array, or a null pointer if no match is found. If two or more
  *   members compare equal, which member is returned is unspecified.
  *
- * Notes from the NetBSD version:
- *   The code below is a bit sneaky.  After a comparison fails, we divide
- *   the work in half by moving either left or right. If 'lim' is odd,
- *   moving left simply involves halving 'lim': e.g., when 'lim' is 5 we
- *   look at item 2, so we change 'lim' to 2 so that we will look at items
- *   0 & 1.  If 'lim' is even, the same applies.  If 'lim' is odd, moving
- *   right again involes halving 'lim', this time moving the base up one
- *   item past 'middle': e.g., when 'lim' is 5 we change base to item 3 and
- *   make 'lim' 2 so that we will look at items 3 and 4.  If 'lim' is
- *   even, however, we have to shrink it by one before halving: e.g.,
- *   when 'lim' is 4, we still looked at item 2, so we have to make 'lim'
- *   3, then halve, obtaining 1, so that we will only look at item 3.
+ * Notes:
+ *   The search halves the region without testing for a match: the
+ *   comparison only selects the lower limit of the next region, which the
+ *   compiler makes a conditional move instead of a branch that the core
+ *   mispredicts half of the time.  The last remaining element is compared
+ *   once more for equality.  That is ceil(log2(nel)) + 1 comparisons for
+ *   any key.
  *
  ****************************************************************************/
 
 FAR void *bsearch(FAR const void *key, FAR const void *base, size_t nel, size_t width, CODE int (*compar)(FAR const void *, FAR const void *))
 {
-	FAR const void *middle;		/* Current entry being tested */
-	FAR const char *lower;		/* The lower limit of the search region */
-	size_t lim;					/* The number of elements in the region */
-	int cmp;					/* Boolean comparison result */
+	FAR const char *middle;		/* Current entry being tested */
+	FAR const char *lower;		/* The first entry of the search region */
+	size_t half;				/* Half of the number of entries */
 
 	DEBUGASSERT(key != NULL);
 	DEBUGASSERT(base != NULL || nel == 0);
 	DEBUGASSERT(compar != NULL);
 
-	for (lim = nel, lower = (const char *)base; lim != 0; lim >>= 1) {
-		middle = lower + (lim >> 1) * width;
-		cmp = (*compar)(key, middle);
+	if (nel == 0) {
+		return NULL;
+	}
 
-		if (cmp == 0) {
-			return (FAR void *)middle;
-		}
+	for (lower = (FAR const char *)base; nel > 1; nel -= half) {
+		half = nel >> 1;
+		middle = lower + half * width;
 
-		if (cmp > 0) {
-			/* key > middle: move right (else move left) */
+		/* key >= middle: the region starts at middle */
 
-			lower = (FAR const char *)middle + width;
-			lim--;
-		}
+		lower = (*compar)(key, middle) >= 0 ? middle : lower;
 	}
 
-	return NULL;
+	return (*compar)(key, lower) == 0 ? (FAR void *)lower : NULL;
 }
@@ -0,0 +1,157 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+
+#include "lib_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Significant digits kept in the 64 bit mantissa, 10^19 < 2^64 */
+
+#define DECMANT_MAXDIGITS  19
+
+#define IS_DIGIT(c)        ((unsigned char)((c) - '0') < 10)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const uint32_t g_pow10[10] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Append the digits at *pptr to the mantissa, while it has room for them.
+ * Return the number of digits appended.
+ */
+
+static int lib_decmant_append(FAR const char **pptr, FAR uint64_t *mant, FAR int *nsig)
+{
+	uint32_t value;
+	int total = 0;
+	int room;
+	int max;
+	int n;
+
+	while ((room = DECMANT_MAXDIGITS - *nsig) > 0) {
+		max = room < 9 ? room : 9;
+		n = lib_decdigits(*pptr, max, &value);
+		if (n == 0) {
+			break;
+		}
+
+		*mant = *mant * g_pow10[n] + value;
+		*nsig += n;
+		*pptr += n;
+		total += n;
+
+		/* The run of digits ended */
+
+		if (n < max) {
+			break;
+		}
+	}
+
+	return total;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lib_decmant
+ *
+ * Description:
+ *   Scan the digits and the optional fraction of a decimal floating point
+ *   number, for strtod() and strtof(), without a floating point operation.
+ *   The value is *mant * 10^*exponent, where the mantissa keeps the 19 first
+ *   significant digits; the next ones are only skipped.
+ *
+ * Returned Value:
+ *   The number of digits scanned, 0 if there is no number.  *pptr is after
+ *   the last one.
+ *
+ ****************************************************************************/
+
+int lib_decmant(FAR const char **pptr, FAR uint64_t *mant, FAR int *exponent)
+{
+	FAR const char *p = *pptr;
+	int num_digits = 0;
+	int nsig = 0;
+	int n;
+
+	*mant = 0;
+	*exponent = 0;
+
+	/* Leading zeros are not significant */
+
+	while (*p == '0') {
+		p++;
+		num_digits++;
+	}
+
+	/* Integer part: the digits after the mantissa scale it up */
+
+	num_digits += lib_decmant_append(&p, mant, &nsig);
+	while (IS_DIGIT(*p)) {
+		p++;
+		num_digits++;
+		(*exponent)++;
+	}
+
+	/* Fraction: the leading zeros and the digits of the mantissa scale it
+	 * down, the digits after the mantissa are dropped.
+	 */
+
+	if (*p == '.') {
+		p++;
+
+		if (nsig == 0) {
+			while (*p == '0') {
+				p++;
+				num_digits++;
+				(*exponent)--;
+			}
+		}
+
+		n = lib_decmant_append(&p, mant, &nsig);
+		num_digits += n;
+		*exponent -= n;
+
+		while (IS_DIGIT(*p)) {
+			p++;
+			num_digits++;
+		}
+	}
+
+	*pptr = p;
+	return num_digits;
+}
@@ -64,166 +64,369 @@
 #include <tinyara/config.h>
 
 #include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 /****************************************************************************
  * Preprocessor Definitions
  ****************************************************************************/
 
-#define min(a, b)  (a) < (b) ? a : b
+/* Ranges up to this many elements are insertion sorted */
 
-#define swapcode(TYPE, parmi, parmj, n) \
-	do { \
-		long i = (n) / sizeof(TYPE); \
-		register TYPE *pi = (TYPE *)(parmi); \
-		register TYPE *pj = (TYPE *)(parmj); \
-		do { \
-			register TYPE  t = *pi; \
-			*pi++ = *pj; \
-			*pj++ = t; \
-		} while (--i > 0); \
-	} while (0)
+#define QSORT_INSERTION_MAX     12
 
-#define SWAPINIT(a, size) \
-	swaptype = ((char *)a - (char *)0) % sizeof(long) || \
-	size % sizeof(long) ? 2 : size == sizeof(long) ? 0 : 1;
+/* Above this many elements, the pivot is the median of 3 medians of 3 */
 
-#define swap(a, b) \
-	if (swaptype == 0) { \
-		long t = *(long *)(a); \
-		*(long *)(a) = *(long *)(b); \
-		*(long *)(b) = t; \
-	} else { \
-		swapfunc(a, b, size, swaptype); \
-	}
+#define QSORT_NINTHER_MIN       128
+
+/* Moves allowed to the insertion sort of a range that looks sorted */
 
-#define vecswap(a, b, n) if ((n) > 0) swapfunc(a, b, n, swaptype)
+#define QSORT_PARTIAL_MOVES     8
+
+#define ELEM(a, i)              ((FAR char *)(a) + (size_t)(i) * ctx->size)
 
 /****************************************************************************
- * Private Function Prototypes
+ * Private Types
  ****************************************************************************/
 
-static inline void swapfunc(char *a, char *b, int n, int swaptype);
-static inline char *med3(char *a, char *b, char *c, int (*compar)(const void *, const void *));
+struct qsort_ctx_s {
+	size_t size;				/* Size of the elements */
+	bool wordswap;				/* Elements and base are made of longs */
+	CODE int (*compar)(FAR const void *, FAR const void *);
+};
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
-static inline void swapfunc(char *a, char *b, int n, int swaptype)
+static void qsort_swap(FAR const struct qsort_ctx_s *ctx, FAR char *a, FAR char *b)
 {
-	if (swaptype <= 1) {
-		swapcode(long, a, b, n);
+	size_t n = ctx->size;
+
+	if (ctx->wordswap) {
+		FAR long *pa = (FAR long *)a;
+		FAR long *pb = (FAR long *)b;
+		long t;
+
+		for (n /= sizeof(long); n > 0; n--) {
+			t = *pa;
+			*pa++ = *pb;
+			*pb++ = t;
+		}
 	} else {
-		swapcode(char, a, b, n);
+		char t;
+
+		for (; n > 0; n--) {
+			t = *a;
+			*a++ = *b;
+			*b++ = t;
+		}
 	}
 }
-static inline char *med3(char *a, char *b, char *c, int (*compar)(const void *, const void *))
+
+/* Order a and b, then a, b and c */
+
+static void qsort_sort2(FAR const struct qsort_ctx_s *ctx, FAR char *a, FAR char *b)
 {
-	return compar(a, b) < 0 ? (compar(b, c) < 0 ? b : (compar(a, c) < 0 ? c : a))
-		   : (compar(b, c) > 0 ? b : (compar(a, c) < 0 ? a : c));
+	if (ctx->compar(b, a) < 0) {
+		qsort_swap(ctx, a, b);
+	}
 }
 
-/****************************************************************************
- * Public Function
- ****************************************************************************/
+static void qsort_sort3(FAR const struct qsort_ctx_s *ctx, FAR char *a, FAR char *b, FAR char *c)
+{
+	qsort_sort2(ctx, a, b);
+	qsort_sort2(ctx, b, c);
+	qsort_sort2(ctx, a, b);
+}
 
-/****************************************************************************
- * Name: qsort
- *
- * Description:
- *   Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
- *
- ****************************************************************************/
+static void qsort_insertion(FAR const struct qsort_ctx_s *ctx, FAR char *base, size_t nmemb)
+{
+	size_t i;
+	size_t j;
 
-void qsort(void *base, size_t nmemb, size_t size, int (*compar)(const void *, const void *))
+	for (i = 1; i < nmemb; i++) {
+		for (j = i; j > 0 && ctx->compar(ELEM(base, j - 1), ELEM(base, j)) > 0; j--) {
+			qsort_swap(ctx, ELEM(base, j - 1), ELEM(base, j));
+		}
+	}
+}
+
+/* Insertion sort that gives up after QSORT_PARTIAL_MOVES moves.  Return
+ * true if the range is sorted.
+ */
+
+static bool qsort_partial_insertion(FAR const struct qsort_ctx_s *ctx, FAR char *base, size_t nmemb)
 {
-	char *pa, *pb, *pc, *pd, *pl, *pm, *pn;
-	int d, r, swaptype, swap_cnt;
-
-loop:
-	SWAPINIT(base, size);
-	swap_cnt = 0;
-	if (nmemb < 7) {
-		for (pm = (char *)base + size; pm < (char *)base + nmemb * size; pm += size) {
-			for (pl = pm; pl > (char *)base && compar(pl - size, pl) > 0; pl -= size) {
-				swap(pl, pl - size);
-			}
+	size_t moves = 0;
+	size_t i;
+	size_t j;
+
+	for (i = 1; i < nmemb; i++) {
+		for (j = i; j > 0 && ctx->compar(ELEM(base, j - 1), ELEM(base, j)) > 0; j--) {
+			qsort_swap(ctx, ELEM(base, j - 1), ELEM(base, j));
+			moves++;
+		}
+
+		if (moves > QSORT_PARTIAL_MOVES) {
+			return false;
 		}
-		return;
 	}
 
-	pm = (char *)base + (nmemb / 2) * size;
-	if (nmemb > 7) {
-		pl = base;
-		pn = (char *)base + (nmemb - 1) * size;
-		if (nmemb > 40) {
-			d = (nmemb / 8) * size;
-			pl = med3(pl, pl + d, pl + 2 * d, compar);
-			pm = med3(pm - d, pm, pm + d, compar);
-			pn = med3(pn - 2 * d, pn - d, pn, compar);
+	return true;
+}
+
+static void qsort_siftdown(FAR const struct qsort_ctx_s *ctx, FAR char *base, size_t root, size_t nmemb)
+{
+	size_t child;
+
+	while ((child = 2 * root + 1) < nmemb) {
+		if (child + 1 < nmemb && ctx->compar(ELEM(base, child), ELEM(base, child + 1)) < 0) {
+			child++;
 		}
-		pm = med3(pl, pm, pn, compar);
+
+		if (ctx->compar(ELEM(base, root), ELEM(base, child)) >= 0) {
+			return;
+		}
+
+		qsort_swap(ctx, ELEM(base, root), ELEM(base, child));
+		root = child;
 	}
-	swap(base, pm);
-	pa = pb = (char *)base + size;
+}
 
-	pc = pd = (char *)base + (nmemb - 1) * size;
-	for (;;) {
-		while (pb <= pc && (r = compar(pb, base)) <= 0) {
-			if (r == 0) {
-				swap_cnt = 1;
-				swap(pa, pb);
-				pa += size;
-			}
-			pb += size;
+/* The fallback of the ranges that keep getting bad pivots: O(n log n) in
+ * any case and without recursion.
+ */
+
+static void qsort_heapsort(FAR const struct qsort_ctx_s *ctx, FAR char *base, size_t nmemb)
+{
+	size_t i;
+
+	for (i = nmemb / 2; i > 0; i--) {
+		qsort_siftdown(ctx, base, i - 1, nmemb);
+	}
+
+	for (i = nmemb - 1; i > 0; i--) {
+		qsort_swap(ctx, base, ELEM(base, i));
+		qsort_siftdown(ctx, base, 0, i);
+	}
+}
+
+/* Partition around the pivot in base[0], the elements equal to it going to
+ * the right.  The median of 3 guarantees an element not less than the pivot
+ * at the end, so the scans need no bound check.  Return the final position
+ * of the pivot, and if no element had to be swapped.
+ */
+
+static size_t qsort_partition_right(FAR const struct qsort_ctx_s *ctx, FAR char *base, size_t nmemb, FAR bool *partitioned)
+{
+	FAR char *pivot = base;
+	size_t first = 1;
+	size_t last = nmemb;
+
+	while (ctx->compar(ELEM(base, first), pivot) < 0) {
+		first++;
+	}
+
+	if (first == 1) {
+		while (first < last && ctx->compar(ELEM(base, --last), pivot) >= 0) {
 		}
-		while (pb <= pc && (r = compar(pc, base)) >= 0) {
-			if (r == 0) {
-				swap_cnt = 1;
-				swap(pc, pd);
-				pd -= size;
-			}
-			pc -= size;
+	} else {
+		while (ctx->compar(ELEM(base, --last), pivot) >= 0) {
 		}
+	}
 
-		if (pb > pc) {
-			break;
+	*partitioned = first >= last;
+
+	while (first < last) {
+		qsort_swap(ctx, ELEM(base, first), ELEM(base, last));
+		while (ctx->compar(ELEM(base, ++first), pivot) < 0) {
+		}
+		while (ctx->compar(ELEM(base, --last), pivot) >= 0) {
+		}
+	}
+
+	first--;
+	if (first != 0) {
+		qsort_swap(ctx, base, ELEM(base, first));
+	}
+
+	return first;
+}
+
+/* Partition around the pivot in base[0], the elements equal to it going to
+ * the left.  Used when the pivot equals the element before the range, that
+ * is when the range starts with many equal elements: they are all done.
+ */
+
+static size_t qsort_partition_left(FAR const struct qsort_ctx_s *ctx, FAR char *base, size_t nmemb)
+{
+	FAR char *pivot = base;
+	size_t first = 0;
+	size_t last = nmemb;
+
+	while (ctx->compar(pivot, ELEM(base, --last)) < 0) {
+	}
+
+	if (last + 1 == nmemb) {
+		while (first < last && ctx->compar(pivot, ELEM(base, ++first)) >= 0) {
+		}
+	} else {
+		while (ctx->compar(pivot, ELEM(base, ++first)) >= 0) {
+		}
+	}
+
+	while (first < last) {
+		qsort_swap(ctx, ELEM(base, first), ELEM(base, last));
+		while (ctx->compar(pivot, ELEM(base, --last)) < 0) {
 		}
+		while (ctx->compar(pivot, ELEM(base, ++first)) >= 0) {
+		}
+	}
 
-		swap(pb, pc);
-		swap_cnt = 1;
-		pb += size;
-		pc -= size;
+	if (last != 0) {
+		qsort_swap(ctx, base, ELEM(base, last));
 	}
 
-	if (swap_cnt == 0) {
-		/* Switch to insertion sort */
+	return last;
+}
+
+static void qsort_loop(FAR const struct qsort_ctx_s *ctx, FAR char *base, size_t nmemb, int bad_allowed, bool leftmost)
+{
+	FAR char *right;
+	size_t pivot;
+	size_t lsize;
+	size_t rsize;
+	size_t half;
+	bool partitioned;
+
+	for (;;) {
+		if (nmemb < QSORT_INSERTION_MAX) {
+			qsort_insertion(ctx, base, nmemb);
+			return;
+		}
+
+		/* Choose the pivot and move it to base[0] */
+
+		half = nmemb / 2;
+		if (nmemb > QSORT_NINTHER_MIN) {
+			qsort_sort3(ctx, base, ELEM(base, half), ELEM(base, nmemb - 1));
+			qsort_sort3(ctx, ELEM(base, 1), ELEM(base, half - 1), ELEM(base, nmemb - 2));
+			qsort_sort3(ctx, ELEM(base, 2), ELEM(base, half + 1), ELEM(base, nmemb - 3));
+			qsort_sort3(ctx, ELEM(base, half - 1), ELEM(base, half), ELEM(base, half + 1));
+			qsort_swap(ctx, base, ELEM(base, half));
+		} else {
+			qsort_sort3(ctx, ELEM(base, half), base, ELEM(base, nmemb - 1));
+		}
 
-		for (pm = (char *)base + size; pm < (char *)base + nmemb * size; pm += size) {
-			for (pl = pm; pl > (char *)base && compar(pl - size, pl) > 0; pl -= size) {
-				swap(pl, pl - size);
+		/* The element before the range is not greater than any element of
+		 * it.  If it equals the pivot, the elements equal to the pivot are
+		 * put first and skipped.
+		 */
+
+		if (!leftmost && ctx->compar(base - ctx->size, base) >= 0) {
+			pivot = qsort_partition_left(ctx, base, nmemb);
+			base = ELEM(base, pivot + 1);
+			nmemb -= pivot + 1;
+			continue;
+		}
+
+		pivot = qsort_partition_right(ctx, base, nmemb, &partitioned);
+		lsize = pivot;
+		rsize = nmemb - pivot - 1;
+		right = ELEM(base, pivot + 1);
+
+		if (lsize < nmemb / 8 || rsize < nmemb / 8) {
+			/* Unbalanced: after log2(n) of them, switch to the heap sort,
+			 * else break the patterns around the pivot.
+			 */
+
+			if (--bad_allowed == 0) {
+				qsort_heapsort(ctx, base, nmemb);
+				return;
+			}
+
+			if (lsize >= QSORT_INSERTION_MAX) {
+				qsort_swap(ctx, base, ELEM(base, lsize / 4));
+				qsort_swap(ctx, ELEM(base, pivot - 1), ELEM(base, pivot - lsize / 4));
+				if (lsize > QSORT_NINTHER_MIN) {
+					qsort_swap(ctx, ELEM(base, 1), ELEM(base, lsize / 4 + 1));
+					qsort_swap(ctx, ELEM(base, 2), ELEM(base, lsize / 4 + 2));
+					qsort_swap(ctx, ELEM(base, pivot - 2), ELEM(base, pivot - (lsize / 4 + 1)));
+					qsort_swap(ctx, ELEM(base, pivot - 3), ELEM(base, pivot - (lsize / 4 + 2)));
+				}
 			}
+
+			if (rsize >= QSORT_INSERTION_MAX) {
+				qsort_swap(ctx, right, ELEM(right, rsize / 4));
+				qsort_swap(ctx, ELEM(right, rsize - 1), ELEM(right, rsize - rsize / 4));
+				if (rsize > QSORT_NINTHER_MIN) {
+					qsort_swap(ctx, ELEM(right, 1), ELEM(right, rsize / 4 + 1));
+					qsort_swap(ctx, ELEM(right, 2), ELEM(right, rsize / 4 + 2));
+					qsort_swap(ctx, ELEM(right, rsize - 2), ELEM(right, rsize - (rsize / 4 + 1)));
+					qsort_swap(ctx, ELEM(right, rsize - 3), ELEM(right, rsize - (rsize / 4 + 2)));
+				}
+			}
+		} else if (partitioned && qsort_partial_insertion(ctx, base, lsize) && qsort_partial_insertion(ctx, right, rsize)) {
+			/* Both sides were already sorted */
+
+			return;
 		}
 
-		return;
+		/* Recurse into the smaller side and iterate on the larger one, so
+		 * that the stack depth is at most log2(n).
+		 */
+
+		if (lsize < rsize) {
+			qsort_loop(ctx, base, lsize, bad_allowed, leftmost);
+			base = right;
+			nmemb = rsize;
+			leftmost = false;
+		} else {
+			qsort_loop(ctx, right, rsize, bad_allowed, false);
+			nmemb = lsize;
+		}
 	}
+}
 
-	pn = (char *)base + nmemb * size;
-	r = min(pa - (char *)base, pb - pa);
-	vecswap(base, pb - r, r);
-	r = min(pd - pc, pn - pd - size);
-	vecswap(pb, pn - r, r);
+/****************************************************************************
+ * Public Function
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: qsort
+ *
+ * Description:
+ *   Pattern-defeating quicksort (pdqsort, Orson Peters): a quicksort with
+ *   median of 3 or ninther pivots, that
+ *   - insertion sorts the small ranges,
+ *   - finishes the ranges that are already sorted in linear time,
+ *   - skips the elements equal to a previous pivot, for many duplicates,
+ *   - shuffles the ranges that give unbalanced partitions, and heap sorts
+ *     them after log2(n) bad partitions, for O(n log n) in any case.
+ *   The recursion is bounded to log2(n) levels.
+ *
+ ****************************************************************************/
 
-	if ((r = pb - pa) > size) {
-		qsort(base, r / size, size, compar);
+void qsort(void *base, size_t nmemb, size_t size, int (*compar)(const void *, const void *))
+{
+	struct qsort_ctx_s ctxs;
+	FAR struct qsort_ctx_s *ctx = &ctxs;
+	int log2n = 0;
+	size_t n;
+
+	if (nmemb < 2 || size == 0) {
+		return;
 	}
 
-	if ((r = pd - pc) > size) {
-		/* Iterate rather than recurse to save stack space */
+	ctx->size = size;
+	ctx->compar = compar;
+	ctx->wordswap = ((uintptr_t)base % sizeof(long)) == 0 && (size % sizeof(long)) == 0;
 
-		base = pn - r;
-		nmemb = r / size;
-		goto loop;
+	for (n = nmemb; n > 1; n >>= 1) {
+		log2n++;
 	}
+
+	qsort_loop(ctx, (FAR char *)base, nmemb, log2n, true);
 }
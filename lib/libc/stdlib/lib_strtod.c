@@ -59,8 +59,11 @@
 
 #include <stdlib.h>
 #include <ctype.h>
+#include <stdint.h>
 #include <errno.h>
 
+#include "lib_internal.h"
+
 #ifdef CONFIG_HAVE_DOUBLE
 
 /****************************************************************************
@@ -82,6 +85,17 @@
 #define __DBL_MAX_EXP__ (1024)
 #endif
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The powers of 10 that are exact in a double */
+
+static const double g_pow10[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -113,7 +127,7 @@ double strtod(const char *str, char **endptr)
 	double p10;
 	int n;
 	int num_digits;
-	int num_decimals;
+	uint64_t mant;
 	const double infinite = 1.0 / 0.0;
 
 	/* Skip leading whitespace */
@@ -132,33 +146,9 @@ double strtod(const char *str, char **endptr)
 		p++;
 	}
 
-	number = 0.;
-	exponent = 0;
-	num_digits = 0;
-	num_decimals = 0;
+	/* Process the string of digits and the decimal part, in integers */
 
-	/* Process string of digits */
-
-	while (isdigit(*p)) {
-		number = number * 10. + (*p - '0');
-		p++;
-		num_digits++;
-	}
-
-	/* Process decimal part */
-
-	if (*p == '.') {
-		p++;
-
-		while (isdigit(*p)) {
-			number = number * 10. + (*p - '0');
-			p++;
-			num_digits++;
-			num_decimals++;
-		}
-
-		exponent -= num_decimals;
-	}
+	num_digits = lib_decmant((FAR const char **)&p, &mant, &exponent);
 
 	if (num_digits == 0) {
 		set_errno(ERANGE);
@@ -167,6 +157,7 @@ double strtod(const char *str, char **endptr)
 
 	/* Correct for sign */
 
+	number = (double)mant;
 	if (negative) {
 		number = -number;
 	}
@@ -188,7 +179,9 @@ double strtod(const char *str, char **endptr)
 
 		n = 0;
 		while (isdigit(*p)) {
-			n = n * 10 + (*p - '0');
+			if (n < 100000) {
+				n = n * 10 + (*p - '0');
+			}
 			p++;
 		}
 
@@ -199,6 +192,21 @@ double strtod(const char *str, char **endptr)
 		}
 	}
 
+	/* An exact mantissa scaled by an exact power of 10 is one correctly
+	 * rounded operation (Clinger's fast path): most of the values of the
+	 * JSON and CSV texts.
+	 */
+
+	if (mant <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+		if (exponent < 0) {
+			number /= g_pow10[-exponent];
+		} else {
+			number *= g_pow10[exponent];
+		}
+
+		goto out;
+	}
+
 	if (exponent < __DBL_MIN_EXP__ || exponent > __DBL_MAX_EXP__) {
 		set_errno(ERANGE);
 		return infinite;
@@ -227,6 +235,7 @@ double strtod(const char *str, char **endptr)
 		set_errno(ERANGE);
 	}
 
+out:
 	if (endptr) {
 		*endptr = p;
 	}
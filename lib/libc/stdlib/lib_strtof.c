@@ -63,8 +63,11 @@
 
 #include <stdlib.h>
 #include <ctype.h>
+#include <stdint.h>
 #include <errno.h>
 
+#include "lib_internal.h"
+
 /****************************************************************************
  * Pre-processor definitions
  ****************************************************************************/
@@ -84,6 +87,16 @@
 #define __FLT_MAX_EXP__ (128)
 #endif
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The powers of 10 that are exact in a float */
+
+static const float g_pow10f[11] = {
+	1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F, 1e6F, 1e7F, 1e8F, 1e9F, 1e10F
+};
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -115,7 +128,7 @@ float strtof(FAR const char *str, FAR char **endptr)
 	float p10;
 	int n;
 	int num_digits;
-	int num_decimals;
+	uint64_t mant;
 	const float infinite = 1.0F / 0.0F;
 
 	/* Skip leading whitespace */
@@ -136,33 +149,9 @@ float strtof(FAR const char *str, FAR char **endptr)
 		break;
 	}
 
-	number = 0.0F;
-	exponent = 0;
-	num_digits = 0;
-	num_decimals = 0;
-
-	/* Process string of digits */
-
-	while (isdigit(*p)) {
-		number = number * 10.0F + (float)(*p - '0');
-		p++;
-		num_digits++;
-	}
-
-	/* Process decimal part */
-
-	if (*p == '.') {
-		p++;
-
-		while (isdigit(*p)) {
-			number = number * 10.0F + (float)(*p - '0');
-			p++;
-			num_digits++;
-			num_decimals++;
-		}
+	/* Process the string of digits and the decimal part, in integers */
 
-		exponent -= num_decimals;
-	}
+	num_digits = lib_decmant((FAR const char **)&p, &mant, &exponent);
 
 	if (num_digits == 0) {
 		set_errno(ERANGE);
@@ -172,6 +161,7 @@ float strtof(FAR const char *str, FAR char **endptr)
 
 	/* Correct for sign */
 
+	number = (float)mant;
 	if (negative) {
 		number = -number;
 	}
@@ -195,7 +185,9 @@ float strtof(FAR const char *str, FAR char **endptr)
 
 		n = 0;
 		while (isdigit(*p)) {
-			n = n * 10 + (*p - '0');
+			if (n < 100000) {
+				n = n * 10 + (*p - '0');
+			}
 			p++;
 		}
 
@@ -206,6 +198,21 @@ float strtof(FAR const char *str, FAR char **endptr)
 		}
 	}
 
+	/* An exact mantissa scaled by an exact power of 10 is one correctly
+	 * rounded operation (Clinger's fast path): most of the values of the
+	 * JSON and CSV texts.
+	 */
+
+	if (mant <= (1UL << 24) && exponent >= -10 && exponent <= 10) {
+		if (exponent < 0) {
+			number /= g_pow10f[-exponent];
+		} else {
+			number *= g_pow10f[exponent];
+		}
+
+		goto errout;
+	}
+
 	if (exponent < __FLT_MIN_EXP__ || exponent > __FLT_MAX_EXP__) {
 		set_errno(ERANGE);
 		number = infinite;
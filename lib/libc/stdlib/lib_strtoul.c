@@ -57,6 +57,7 @@
 #include <tinyara/config.h>
 
 #include <stdlib.h>
+#include <stdint.h>
 #include <errno.h>
 
 #include "lib_internal.h"
@@ -105,6 +106,38 @@ unsigned long strtoul(const char *nptr, char **endptr, int base)
 			return 0;
 		}
 
+		/* Decimal digits by groups of up to 9 in 32 bits, as long as they
+		 * cannot overflow, then one by one with the overflow check.
+		 */
+
+		if (base == 10) {
+			uint32_t value32;
+			int n;
+
+			n = lib_decdigits(nptr, 9, &value32);
+			accum = value32;
+			nptr += n;
+
+			if (n == 9) {
+				while (lib_isbasedigit(*nptr, 10, &value)) {
+					if (accum > (ULONG_MAX - value) / 10) {
+						set_errno(ERANGE);
+						accum = ULONG_MAX;
+						break;
+					}
+
+					accum = accum * 10 + value;
+					nptr++;
+				}
+			}
+
+			if (endptr) {
+				*endptr = (char *)nptr;
+			}
+
+			return accum;
+		}
+
 		/* Accumulate each "digit" */
 
 		while (lib_isbasedigit(*nptr, base, &value)) {
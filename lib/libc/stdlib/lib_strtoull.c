@@ -58,6 +58,7 @@
 #include <tinyara/compiler.h>
 
 #include <stdlib.h>
+#include <stdint.h>
 #include <errno.h>
 
 #include "lib_internal.h"
@@ -107,6 +108,48 @@ unsigned long long strtoull(const char *nptr, char **endptr, int base)
 			return 0;
 		}
 
+		/* Decimal digits by two groups of up to 9 in 32 bits, 18 digits
+		 * cannot overflow, then one by one with the overflow check.
+		 */
+
+		if (base == 10) {
+			uint32_t value32;
+			int n;
+
+			n = lib_decdigits(nptr, 9, &value32);
+			accum = value32;
+			nptr += n;
+
+			if (n == 9) {
+				n = lib_decdigits(nptr, 9, &value32);
+				for (value = n; value > 0; value--) {
+					accum *= 10;
+				}
+
+				accum += value32;
+				nptr += n;
+			}
+
+			if (n == 9) {
+				while (lib_isbasedigit(*nptr, 10, &value)) {
+					if (accum > (ULLONG_MAX - value) / 10) {
+						set_errno(ERANGE);
+						accum = ULLONG_MAX;
+						break;
+					}
+
+					accum = accum * 10 + value;
+					nptr++;
+				}
+			}
+
+			if (endptr) {
+				*endptr = (char *)nptr;
+			}
+
+			return accum;
+		}
+
 		/* Accumulate each "digit" */
 
 		while (lib_isbasedigit(*nptr, base, &value)) {
@@ -118,7 +161,7 @@ unsigned long long strtoull(const char *nptr, char **endptr, int base)
 
 			if (accum < prev) {
 				set_errno(ERANGE);
-				accum = 0;
+				accum = ULLONG_MAX;
 				break;
 			}
 		}
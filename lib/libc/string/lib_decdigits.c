@@ -0,0 +1,80 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+
+#include "lib_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define IS_DIGIT(c)  ((unsigned char)((c) - '0') < 10)
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lib_decdigits
+ *
+ * Description:
+ *   Convert the run of decimal digits at ptr, up to maxdigits of them (at
+ *   most 9, so that the value fits 32 bits).  Groups of four digits are
+ *   converted in one word: the first multiply makes the two 2-digit values
+ *   and the second one their 4-digit value.  The bytes are only read up to
+ *   the first non digit one, never after the end of the string.
+ *
+ * Returned Value:
+ *   The number of digits converted, and their value in *value.
+ *
+ ****************************************************************************/
+
+int lib_decdigits(FAR const char *ptr, int maxdigits, FAR uint32_t *value)
+{
+	uint32_t accum = 0;
+	uint32_t word;
+	int n = 0;
+
+	while (n + 4 <= maxdigits && IS_DIGIT(ptr[n]) && IS_DIGIT(ptr[n + 1]) && IS_DIGIT(ptr[n + 2]) && IS_DIGIT(ptr[n + 3])) {
+		/* The first digit in the low byte, whatever the endianness */
+
+		word = (uint32_t)(unsigned char)ptr[n] | (uint32_t)(unsigned char)ptr[n + 1] << 8 |
+			   (uint32_t)(unsigned char)ptr[n + 2] << 16 | (uint32_t)(unsigned char)ptr[n + 3] << 24;
+		word -= 0x30303030;
+		word = (word * 10 + (word >> 8)) & 0x00ff00ff;
+		word = (word * (1 + (100 << 16))) >> 16;
+
+		accum = accum * 10000 + word;
+		n += 4;
+	}
+
+	while (n < maxdigits && IS_DIGIT(ptr[n])) {
+		accum = accum * 10 + (ptr[n] - '0');
+		n++;
+	}
+
+	*value = accum;
+	return n;
+}
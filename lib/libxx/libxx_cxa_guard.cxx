@@ -54,12 +54,70 @@
 // Included Files
 //***************************************************************************
 
+#include <tinyara/config.h>
+
+#include <cstdint>
+#include <semaphore.h>
+#include <errno.h>
+#include <assert.h>
+
 #include "libxx_cxa_guard.hxx"
 
+//***************************************************************************
+// Pre-processor Definitions
+//***************************************************************************
+
+// The first byte of the guard tells that the object is constructed, bit 0
+// for the ARM EABI, and the second one that a thread is constructing it.
+// The code of the compiler only tests the first byte before the call of
+// __cxa_guard_acquire(), so the objects already constructed cost one load.
+
+#define GUARD_DONE(g)     ((FAR volatile uint8_t *)(g))[0]
+#define GUARD_PENDING(g)  ((FAR volatile uint8_t *)(g))[1]
+
 //***************************************************************************
 // Private Data
 //***************************************************************************
 
+// The lock of the pending flags, and the threads waiting for the end of a
+// construction in another thread, whatever the guard.
+
+static sem_t g_guardsem = SEM_INITIALIZER(1);
+static sem_t g_guardwait = SEM_INITIALIZER(0);
+static int g_guardwaiters;
+
+//***************************************************************************
+// Private Functions
+//***************************************************************************
+
+static void libxx_guard_wait(FAR sem_t *sem)
+{
+  while (sem_wait(sem) != OK)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+// Clear the pending flag, mark the object constructed or not and wake up
+// the waiting threads, which check their guard again.
+
+static void libxx_guard_finish(FAR __guard *g, uint8_t done)
+{
+  int nwaiters;
+
+  libxx_guard_wait(&g_guardsem);
+  GUARD_PENDING(g) = 0;
+  __atomic_store_n(&GUARD_DONE(g), done, __ATOMIC_RELEASE);
+  nwaiters = g_guardwaiters;
+  g_guardwaiters = 0;
+  sem_post(&g_guardsem);
+
+  while (nwaiters-- > 0)
+    {
+      sem_post(&g_guardwait);
+    }
+}
+
 //***************************************************************************
 // Public Functions
 //***************************************************************************
@@ -68,15 +126,44 @@ extern "C"
 {
   //*************************************************************************
   // Name: __cxa_guard_acquire
+  //
+  // Description:
+  //   Return 1 if the caller must construct the object.  A thread that finds
+  //   the construction in progress in another thread blocks until its end.
+  //
   //*************************************************************************
 
   int __cxa_guard_acquire(FAR __guard *g)
   {
-#ifdef __ARM_EABI__
-    return !(*g & 1);
-#else
-    return !*(char *)g;
-#endif
+    if (__atomic_load_n(&GUARD_DONE(g), __ATOMIC_ACQUIRE) & 1)
+      {
+        return 0;
+      }
+
+    libxx_guard_wait(&g_guardsem);
+    for (; ; )
+      {
+        if (GUARD_DONE(g) & 1)
+          {
+            sem_post(&g_guardsem);
+            return 0;
+          }
+
+        if (!GUARD_PENDING(g))
+          {
+            GUARD_PENDING(g) = 1;
+            sem_post(&g_guardsem);
+            return 1;
+          }
+
+        // The posts of g_guardwait are counted, a wake up between the
+        // release of g_guardsem and the wait is not lost
+
+        g_guardwaiters++;
+        sem_post(&g_guardsem);
+        libxx_guard_wait(&g_guardwait);
+        libxx_guard_wait(&g_guardsem);
+      }
   }
 
   //*************************************************************************
@@ -85,18 +172,19 @@ extern "C"
 
   void __cxa_guard_release(FAR __guard *g)
   {
-#ifdef __ARM_EABI__
-    *g = 1;
-#else
-    *(char *)g = 1;
-#endif
+    libxx_guard_finish(g, 1);
   }
 
   //*************************************************************************
   // Name: __cxa_guard_abort
+  //
+  // Description:
+  //   The constructor threw, the next caller tries again.
+  //
   //*************************************************************************
 
-  void __cxa_guard_abort(FAR __guard *)
+  void __cxa_guard_abort(FAR __guard *g)
   {
+    libxx_guard_finish(g, 0);
   }
 }
@@ -76,5 +76,12 @@
 
 void operator delete[](void *ptr)
 {
+#ifdef CONFIG_LIBXX_POOL
+  if (libxx_pool_free(ptr, 0))
+  {
+    return;
+  }
+#endif
+
   lib_free(ptr);
 }
@@ -0,0 +1,51 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+//***************************************************************************
+// libxx/libxx_deletea_sized.cxx
+//
+// C++14 sized deallocation of the arrays, see libxx_delete_sized.cxx.
+//
+//***************************************************************************
+
+//***************************************************************************
+// Included Files
+//***************************************************************************
+
+#include <tinyara/config.h>
+
+#include "libxx_internal.hxx"
+
+//***************************************************************************
+// Operators
+//***************************************************************************
+
+//***************************************************************************
+// Name: delete[]
+//***************************************************************************
+
+void operator delete[](void *ptr, libxx_size_t nbytes)
+{
+#ifdef CONFIG_LIBXX_POOL
+  if (libxx_pool_free(ptr, nbytes))
+  {
+    return;
+  }
+#endif
+
+  lib_free(ptr);
+}
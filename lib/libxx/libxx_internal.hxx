@@ -76,12 +76,22 @@
 #  define lib_zalloc(s)    kmm_zalloc(s)
 #  define lib_realloc(p,s) kmm_realloc(p,s)
 #  define lib_free(p)      kmm_free(p)
+#  define lib_memalign(a,s) kmm_memalign(a,s)
 #else
 #  include <cstdlib>
 #  define lib_malloc(s)    malloc(s)
 #  define lib_zalloc(s)    zalloc(s)
 #  define lib_realloc(p,s) realloc(p,s)
 #  define lib_free(p)      free(p)
+#  define lib_memalign(a,s) memalign(a,s)
+#endif
+
+// The size_t of the operators, see the note of libxx_new.cxx
+
+#ifdef CONFIG_CXX_NEWLONG
+typedef unsigned long libxx_size_t;
+#else
+typedef unsigned int libxx_size_t;
 #endif
 
 //***************************************************************************
@@ -102,4 +112,14 @@ extern "C" FAR void *__dso_handle;
 
 extern "C" int __cxa_atexit(__cxa_exitfunc_t func, void *arg, void *dso_handle);
 
+#ifdef CONFIG_LIBXX_POOL
+// Small objects pool of libxx_pool.cxx.  libxx_pool_alloc() returns NULL if
+// the size is too large or the pool is full, then the heap is used.
+// libxx_pool_free() returns false if the memory is not from the pool.  The
+// size is the one given to new, or 0 if it is not known.
+
+FAR void *libxx_pool_alloc(libxx_size_t nbytes);
+bool libxx_pool_free(FAR void *ptr, libxx_size_t nbytes);
+#endif
+
 #endif // __LIBXX_LIBXX_INTERNAL_HXX
@@ -101,9 +101,23 @@ void *operator new(unsigned int nbytes)
     nbytes = 1;
   }
 
+#ifdef CONFIG_LIBXX_POOL
+  // Small objects come from the pool
+
+  void *alloc = libxx_pool_alloc(nbytes);
+  if (alloc != NULL)
+  {
+    return alloc;
+  }
+
+  // Perform the allocation
+
+  alloc = lib_malloc(nbytes);
+#else
   // Perform the allocation
 
   void *alloc = lib_malloc(nbytes);
+#endif
 
 #ifdef CONFIG_DEBUG
   if (alloc == 0)
@@ -0,0 +1,123 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+//***************************************************************************
+// libxx/libxx_new_aligned.cxx
+//
+// C++17 allocation of the over-aligned types, with memalign().  Types
+// aligned to at most 8 bytes still use the pool.
+//
+//***************************************************************************
+
+//***************************************************************************
+// Included Files
+//***************************************************************************
+
+#include <tinyara/config.h>
+#include <cstddef>
+#include <new>
+#include <debug.h>
+
+#include "libxx_internal.hxx"
+
+#ifdef __cpp_aligned_new
+
+//***************************************************************************
+// Private Functions
+//***************************************************************************
+
+static void *libxx_alloc_aligned(libxx_size_t nbytes, std::size_t align)
+{
+  // We have to allocate something
+
+  if (nbytes < 1)
+  {
+    nbytes = 1;
+  }
+
+#ifdef CONFIG_LIBXX_POOL
+  // The blocks of the pool are all aligned to 8 bytes
+
+  if (align <= 8)
+  {
+    void *alloc = libxx_pool_alloc(nbytes);
+    if (alloc != NULL)
+    {
+      return alloc;
+    }
+  }
+#endif
+
+  void *alloc = lib_memalign(align, nbytes);
+
+#ifdef CONFIG_DEBUG
+  if (alloc == 0)
+  {
+    dbg("Failed to allocate %u bytes aligned to %u\n", (unsigned int)nbytes, (unsigned int)align);
+  }
+#endif
+
+  return alloc;
+}
+
+static void libxx_free_aligned(void *ptr, libxx_size_t nbytes)
+{
+#ifdef CONFIG_LIBXX_POOL
+  if (libxx_pool_free(ptr, nbytes))
+  {
+    return;
+  }
+#endif
+
+  lib_free(ptr);
+}
+
+//***************************************************************************
+// Operators
+//***************************************************************************
+
+void *operator new(libxx_size_t nbytes, std::align_val_t align)
+{
+  return libxx_alloc_aligned(nbytes, static_cast<std::size_t>(align));
+}
+
+void *operator new[](libxx_size_t nbytes, std::align_val_t align)
+{
+  return libxx_alloc_aligned(nbytes, static_cast<std::size_t>(align));
+}
+
+void operator delete(void *ptr, std::align_val_t align)
+{
+  libxx_free_aligned(ptr, 0);
+}
+
+void operator delete[](void *ptr, std::align_val_t align)
+{
+  libxx_free_aligned(ptr, 0);
+}
+
+void operator delete(void *ptr, libxx_size_t nbytes, std::align_val_t align)
+{
+  libxx_free_aligned(ptr, nbytes);
+}
+
+void operator delete[](void *ptr, libxx_size_t nbytes, std::align_val_t align)
+{
+  libxx_free_aligned(ptr, nbytes);
+}
+
+#endif // __cpp_aligned_new
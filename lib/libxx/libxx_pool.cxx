@@ -0,0 +1,285 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+//***************************************************************************
+// libxx/libxx_pool.cxx
+//
+// Pool of the small C++ objects, shared_ptr control blocks and
+// std::function targets.  A static arena is cut in pages of
+// LIBXX_POOL_PAGESIZE bytes, and each page in use holds the blocks of one
+// size class.  The page of a block comes from its address, so neither the
+// allocation nor the release needs a block header or a search:
+//
+//   - A size class keeps the list of its pages with free blocks.  The
+//     allocation takes a block from the first one, or a page from the free
+//     pages, or a never used page of the arena.
+//   - The release puts the block back on the free list of its page.  A page
+//     whose blocks are all free goes back to the free pages, for any class.
+//
+//***************************************************************************
+
+//***************************************************************************
+// Included Files
+//***************************************************************************
+
+#include <tinyara/config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <semaphore.h>
+#include <errno.h>
+#include <assert.h>
+
+#include "libxx_internal.hxx"
+
+#ifdef CONFIG_LIBXX_POOL
+
+//***************************************************************************
+// Definitions
+//***************************************************************************
+
+#define LIBXX_POOL_PAGESIZE  256
+#define LIBXX_POOL_NPAGES    (CONFIG_LIBXX_POOL_SIZE / LIBXX_POOL_PAGESIZE)
+#define LIBXX_POOL_NCLASSES  8
+#define LIBXX_POOL_MAXSIZE   128
+#define LIBXX_POOL_NONE      (-1)
+
+//***************************************************************************
+// Private Types
+//***************************************************************************
+
+struct libxx_page_s
+{
+  FAR void *freelist;          // Free blocks of the page
+  int16_t next;                // Next page of the class or of the free pages
+  int16_t prev;                // Previous page of the class
+  uint8_t sclass;              // Size class of the blocks
+  uint8_t used;                // Number of blocks in use
+};
+
+//***************************************************************************
+// Private Data
+//***************************************************************************
+
+static const uint8_t g_classsize[LIBXX_POOL_NCLASSES] =
+{
+  8, 16, 24, 32, 48, 64, 96, 128
+};
+
+// Size class of the sizes, by 8 byte steps: (nbytes + 7) / 8
+
+static const uint8_t g_sizeclass[LIBXX_POOL_MAXSIZE / 8 + 1] =
+{
+  0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7
+};
+
+static uint64_t g_arena[CONFIG_LIBXX_POOL_SIZE / sizeof(uint64_t)];
+static struct libxx_page_s g_pages[LIBXX_POOL_NPAGES];
+static int16_t g_partial[LIBXX_POOL_NCLASSES] =
+{
+  LIBXX_POOL_NONE, LIBXX_POOL_NONE, LIBXX_POOL_NONE, LIBXX_POOL_NONE,
+  LIBXX_POOL_NONE, LIBXX_POOL_NONE, LIBXX_POOL_NONE, LIBXX_POOL_NONE
+};
+static int16_t g_freepages = LIBXX_POOL_NONE;
+static int16_t g_nfresh;
+static sem_t g_poolsem = SEM_INITIALIZER(1);
+
+//***************************************************************************
+// Private Functions
+//***************************************************************************
+
+static void libxx_pool_lock(void)
+{
+  while (sem_wait(&g_poolsem) != OK)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+static void libxx_pool_unlock(void)
+{
+  sem_post(&g_poolsem);
+}
+
+static void libxx_pool_link(int sclass, int page)
+{
+  g_pages[page].prev = LIBXX_POOL_NONE;
+  g_pages[page].next = g_partial[sclass];
+  if (g_partial[sclass] != LIBXX_POOL_NONE)
+    {
+      g_pages[g_partial[sclass]].prev = page;
+    }
+
+  g_partial[sclass] = page;
+}
+
+static void libxx_pool_unlink(int sclass, int page)
+{
+  FAR struct libxx_page_s *pg = &g_pages[page];
+
+  if (pg->prev != LIBXX_POOL_NONE)
+    {
+      g_pages[pg->prev].next = pg->next;
+    }
+  else
+    {
+      g_partial[sclass] = pg->next;
+    }
+
+  if (pg->next != LIBXX_POOL_NONE)
+    {
+      g_pages[pg->next].prev = pg->prev;
+    }
+}
+
+// Give a free page to the class and thread its blocks
+
+static int libxx_pool_newpage(int sclass)
+{
+  FAR uint8_t *block;
+  size_t bsize = g_classsize[sclass];
+  size_t offset;
+  int page;
+
+  if (g_freepages != LIBXX_POOL_NONE)
+    {
+      page = g_freepages;
+      g_freepages = g_pages[page].next;
+    }
+  else if (g_nfresh < LIBXX_POOL_NPAGES)
+    {
+      page = g_nfresh++;
+    }
+  else
+    {
+      return LIBXX_POOL_NONE;
+    }
+
+  block = (FAR uint8_t *)g_arena + page * LIBXX_POOL_PAGESIZE;
+  g_pages[page].freelist = NULL;
+  for (offset = (LIBXX_POOL_PAGESIZE / bsize - 1) * bsize; ; offset -= bsize)
+    {
+      *(FAR void **)(block + offset) = g_pages[page].freelist;
+      g_pages[page].freelist = block + offset;
+      if (offset == 0)
+        {
+          break;
+        }
+    }
+
+  g_pages[page].sclass = sclass;
+  g_pages[page].used = 0;
+  libxx_pool_link(sclass, page);
+  return page;
+}
+
+//***************************************************************************
+// Public Functions
+//***************************************************************************
+
+//***************************************************************************
+// Name: libxx_pool_alloc
+//***************************************************************************
+
+FAR void *libxx_pool_alloc(libxx_size_t nbytes)
+{
+  FAR struct libxx_page_s *pg;
+  FAR void *block;
+  int sclass;
+  int page;
+
+  if (nbytes == 0 || nbytes > LIBXX_POOL_MAXSIZE)
+    {
+      return NULL;
+    }
+
+  sclass = g_sizeclass[(nbytes + 7) >> 3];
+
+  libxx_pool_lock();
+  page = g_partial[sclass];
+  if (page == LIBXX_POOL_NONE)
+    {
+      page = libxx_pool_newpage(sclass);
+      if (page == LIBXX_POOL_NONE)
+        {
+          libxx_pool_unlock();
+          return NULL;
+        }
+    }
+
+  pg = &g_pages[page];
+  block = pg->freelist;
+  pg->freelist = *(FAR void **)block;
+  pg->used++;
+
+  // A full page leaves the list of the class
+
+  if (pg->freelist == NULL)
+    {
+      libxx_pool_unlink(sclass, page);
+    }
+
+  libxx_pool_unlock();
+  return block;
+}
+
+//***************************************************************************
+// Name: libxx_pool_free
+//***************************************************************************
+
+bool libxx_pool_free(FAR void *ptr, libxx_size_t nbytes)
+{
+  FAR struct libxx_page_s *pg;
+  uintptr_t offset = (uintptr_t)ptr - (uintptr_t)g_arena;
+  int page;
+
+  if (offset >= sizeof(g_arena))
+    {
+      return false;
+    }
+
+  page = offset / LIBXX_POOL_PAGESIZE;
+  pg = &g_pages[page];
+
+  // With the size of a sized delete, the class is known without the page
+
+  DEBUGASSERT(nbytes == 0 || g_sizeclass[(nbytes + 7) >> 3] == pg->sclass);
+  DEBUGASSERT(pg->used > 0 && (offset % LIBXX_POOL_PAGESIZE) % g_classsize[pg->sclass] == 0);
+
+  libxx_pool_lock();
+  if (pg->freelist == NULL)
+    {
+      libxx_pool_link(pg->sclass, page);
+    }
+
+  *(FAR void **)ptr = pg->freelist;
+  pg->freelist = ptr;
+
+  // A page without blocks in use can serve any class
+
+  if (--pg->used == 0)
+    {
+      libxx_pool_unlink(pg->sclass, page);
+      pg->next = g_freepages;
+      g_freepages = page;
+    }
+
+  libxx_pool_unlock();
+  return true;
+}
+
+#endif // CONFIG_LIBXX_POOL
@@ -181,7 +181,9 @@ struct netdev* amebad_register_dev(int sizeof_priv)
 	struct netdev_config config;
 	config.ops = &nops;
 	config.flag = NM_FLAG_ETHARP | NM_FLAG_ETHERNET | NM_FLAG_BROADCAST | NM_FLAG_IGMP;
+	config.offload = 0;
 	config.mtu = CONFIG_NET_ETH_MTU; // is it right that vendor decides MTU size??
+	config.rx_reserve = 0;
 	config.hwaddr_len = IFHWADDRLEN;
 
 	config.is_default = 1;
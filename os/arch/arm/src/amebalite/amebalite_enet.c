@@ -183,7 +183,14 @@ struct netdev* amebalite_register_dev(int sizeof_priv)
 	struct netdev_config config;
 	config.ops = &nops;
 	config.flag = NM_FLAG_ETHARP | NM_FLAG_ETHERNET | NM_FLAG_BROADCAST | NM_FLAG_IGMP;
+#ifdef CONFIG_AMEBALITE_WIFI_CSUM_OFFLOAD
+	config.offload = NM_OFFLOAD_TX_CSUM_IP | NM_OFFLOAD_TX_CSUM_TCP | NM_OFFLOAD_TX_CSUM_UDP |
+					 NM_OFFLOAD_RX_CSUM_IP | NM_OFFLOAD_RX_CSUM_TCP | NM_OFFLOAD_RX_CSUM_UDP;
+#else
+	config.offload = 0;
+#endif
 	config.mtu = CONFIG_NET_ETH_MTU; // is it right that vendor decides MTU size??
+	config.rx_reserve = 0;
 	config.hwaddr_len = IFHWADDRLEN;
 
 	config.is_default = 1;
@@ -83,6 +83,9 @@
 #include "up_internal.h"
 
 #include "serial_api.h"
+#ifdef CONFIG_SERIAL_DMA
+#include "serial_ex_api.h"
+#endif
 #include "PinNames.h"
 #include "objects.h"
 #include "ameba_uart.h"
@@ -267,6 +270,18 @@ static void rtl8730e_up_send(struct uart_dev_s *dev, int ch);
 static void rtl8730e_up_txint(struct uart_dev_s *dev, bool enable);
 static bool rtl8730e_up_txready(struct uart_dev_s *dev);
 static bool rtl8730e_up_txempty(struct uart_dev_s *dev);
+#ifdef CONFIG_SERIAL_DMA
+static void rtl8730e_up_dma_send(struct uart_dev_s *dev);
+static void rtl8730e_up_dma_receive(struct uart_dev_s *dev);
+static void rtl8730e_up_dma_txavail(struct uart_dev_s *dev);
+static void rtl8730e_up_dma_rxfree(struct uart_dev_s *dev);
+static void rtl8730e_up_dma_txdone(uint32_t id);
+static void rtl8730e_up_dma_rxdone(uint32_t id);
+static void rtl8730e_up_dma_rxidle(struct uart_dev_s *dev);
+#endif
+#ifdef CONFIG_PM
+static void rtl8730e_up_pm_active(bool active);
+#endif
 
 /****************************************************************************
  * Private Data
@@ -309,20 +324,65 @@ static const struct uart_ops_s g_uart_ops = {
 	.txempty = rtl8730e_up_txempty,
 };
 
+#ifdef CONFIG_SERIAL_DMA
+/* UART0~3 with CONFIG_UARTn_DMA move data with the GDMA. The log uart has no DMA. */
+static const struct uart_ops_s g_uart_dma_ops = {
+	.setup = rtl8730e_up_setup,
+	.shutdown = rtl8730e_up_shutdown,
+	.attach = rtl8730e_up_attach,
+	.detach = rtl8730e_up_detach,
+	.ioctl = rtl8730e_up_ioctl,
+	.receive = rtl8730e_up_receive,
+	.rxint = rtl8730e_up_rxint,
+	.rxavailable = rtl8730e_up_rxavailable,
+#ifdef CONFIG_SERIAL_IFLOWCONTROL
+	.rxflowcontrol = NULL,
+#endif
+	.send = rtl8730e_up_send,
+	.txint = rtl8730e_up_txint,
+	.txready = rtl8730e_up_txready,
+	.txempty = rtl8730e_up_txempty,
+	.dmasend = rtl8730e_up_dma_send,
+	.dmareceive = rtl8730e_up_dma_receive,
+	.dmatxavail = rtl8730e_up_dma_txavail,
+	.dmarxfree = rtl8730e_up_dma_rxfree,
+};
+#endif
+
 #ifdef CONFIG_RTL8730E_UART0
+#ifdef CONFIG_UART0_DMA
+/* The GDMA invalidates the D-cache lines of the RX buffer, keep them to itself */
+static char g_uart0rxbuffer[CACHE_LINE_ALIGMENT(CONFIG_UART0_RXBUFSIZE)] __attribute__((aligned(CACHE_LINE_SIZE)));
+#else
 static char g_uart0rxbuffer[CONFIG_UART0_RXBUFSIZE];
+#endif
 static char g_uart0txbuffer[CONFIG_UART0_TXBUFSIZE];
 #endif
 #ifdef CONFIG_RTL8730E_UART1
+#ifdef CONFIG_UART1_DMA
+/* The GDMA invalidates the D-cache lines of the RX buffer, keep them to itself */
+static char g_uart1rxbuffer[CACHE_LINE_ALIGMENT(CONFIG_UART1_RXBUFSIZE)] __attribute__((aligned(CACHE_LINE_SIZE)));
+#else
 static char g_uart1rxbuffer[CONFIG_UART1_RXBUFSIZE];
+#endif
 static char g_uart1txbuffer[CONFIG_UART1_TXBUFSIZE];
 #endif
 #ifdef CONFIG_RTL8730E_UART2
+#ifdef CONFIG_UART2_DMA
+/* The GDMA invalidates the D-cache lines of the RX buffer, keep them to itself */
+static char g_uart2rxbuffer[CACHE_LINE_ALIGMENT(CONFIG_UART2_RXBUFSIZE)] __attribute__((aligned(CACHE_LINE_SIZE)));
+#else
 static char g_uart2rxbuffer[CONFIG_UART2_RXBUFSIZE];
+#endif
 static char g_uart2txbuffer[CONFIG_UART2_TXBUFSIZE];
 #endif
 #ifdef CONFIG_RTL8730E_UART3
+#ifdef CONFIG_UART3_DMA
+/* The GDMA invalidates the D-cache lines of the RX buffer, keep them to itself */
+static char g_uart3rxbuffer[CACHE_LINE_ALIGMENT(CONFIG_UART3_RXBUFSIZE)] __attribute__((aligned(CACHE_LINE_SIZE)));
+#else
 static char g_uart3rxbuffer[CONFIG_UART3_RXBUFSIZE];
+#endif
 static char g_uart3txbuffer[CONFIG_UART3_TXBUFSIZE];
 #endif
 #ifdef CONFIG_RTL8730E_UART4
@@ -365,7 +425,11 @@ static uart_dev_t g_uart0port = {
 		.size = CONFIG_UART0_TXBUFSIZE,
 		.buffer = g_uart0txbuffer,
 	},
+#ifdef CONFIG_UART0_DMA
+	.ops = &g_uart_dma_ops,
+#else
 	.ops = &g_uart_ops,
+#endif
 	.priv = &g_uart0priv,
 };
 #endif
@@ -405,7 +469,11 @@ static uart_dev_t g_uart1port = {
 		.size = CONFIG_UART1_TXBUFSIZE,
 		.buffer = g_uart1txbuffer,
 	},
+#ifdef CONFIG_UART1_DMA
+	.ops = &g_uart_dma_ops,
+#else
 	.ops = &g_uart_ops,
+#endif
 	.priv = &g_uart1priv,
 };
 #endif
@@ -441,7 +509,11 @@ static uart_dev_t g_uart2port = {
 		.size = CONFIG_UART2_TXBUFSIZE,
 		.buffer = g_uart2txbuffer,
 	},
+#ifdef CONFIG_UART2_DMA
+	.ops = &g_uart_dma_ops,
+#else
 	.ops = &g_uart_ops,
+#endif
 	.priv = &g_uart2priv,
 };
 #endif
@@ -473,7 +545,11 @@ static uart_dev_t g_uart3port = {
 		.size = CONFIG_UART3_TXBUFSIZE,
 		.buffer = g_uart3txbuffer,
 	},
+#ifdef CONFIG_UART3_DMA
+	.ops = &g_uart_dma_ops,
+#else
 	.ops = &g_uart_ops,
+#endif
 	.priv = &g_uart3priv,
 };
 #endif
@@ -848,6 +924,12 @@ static int rtl8730e_up_setup(struct uart_dev_s *dev)
 		serial_init((serial_t *) sdrv[uart_index_get(priv->tx)], priv->tx, priv->rx);
 		serial_baud(sdrv[uart_index_get(priv->tx)], priv->baud);
 		serial_format(sdrv[uart_index_get(priv->tx)], priv->bits, priv->parity, priv->stopbit);
+#ifdef CONFIG_SERIAL_DMA
+		if (uart_txdma(dev)) {
+			serial_send_comp_handler(sdrv[uart_index_get(priv->tx)], (void *)rtl8730e_up_dma_txdone, (uint32_t)dev);
+			serial_recv_comp_handler(sdrv[uart_index_get(priv->tx)], (void *)rtl8730e_up_dma_rxdone, (uint32_t)dev);
+		}
+#endif
 
 #if defined(CONFIG_SERIAL_IFLOWCONTROL) || defined(CONFIG_SERIAL_OFLOWCONTROL)
 		if ((uart_index_get(priv->tx) == 0) || (uart_index_get(priv->tx) == 1) || (uart_index_get(priv->tx) == 2)) {
@@ -891,6 +973,14 @@ static void rtl8730e_up_shutdown(struct uart_dev_s *dev)
 	struct rtl8730e_up_dev_s *priv = (struct rtl8730e_up_dev_s *)dev->priv;
 	DEBUGASSERT(priv);
 	DEBUGASSERT(sdrv[uart_index_get(priv->tx)]);
+#ifdef CONFIG_SERIAL_DMA
+	if (uart_txdma(dev)) {
+		serial_send_stream_abort(sdrv[uart_index_get(priv->tx)]);
+		serial_recv_stream_abort(sdrv[uart_index_get(priv->tx)]);
+		dev->dmatx.length = 0;
+		dev->dmarx.length = 0;
+	}
+#endif
 	serial_free(sdrv[uart_index_get(priv->tx)]);
 	rtw_free(sdrv[uart_index_get(priv->tx)]);
 	sdrv[uart_index_get(priv->tx)] = NULL;
@@ -917,7 +1007,14 @@ void rtl8730e_uart_irq(uint32_t id, SerialIrq event)
 	struct rtl8730e_up_dev_s *priv = (struct rtl8730e_up_dev_s *)dev->priv;
 
 	if (event == RxIrq) {
-		uart_recvchars(dev);
+#ifdef CONFIG_SERIAL_DMA
+		if (uart_rxdma(dev)) {
+			rtl8730e_up_dma_rxidle(dev);
+		} else
+#endif
+		{
+			uart_recvchars(dev);
+		}
 	}
 	if (event == TxIrq) {
 		priv->tx_level = TX_FIFO_MAX;
@@ -1020,6 +1117,12 @@ static int rtl8730e_up_ioctl(FAR struct uart_dev_s *dev, int cmd, unsigned long
 		rtl8730e_up_attach(dev);
 		rtl8730e_up_txint(dev, priv->txint_enable);
 		rtl8730e_up_rxint(dev, priv->rxint_enable);
+#ifdef CONFIG_SERIAL_DMA
+		if (uart_txdma(dev)) {
+			rtl8730e_up_dma_txavail(dev);
+			rtl8730e_up_dma_rxfree(dev);
+		}
+#endif
 		break;
 
 	case TIOCLOOPBACK:
@@ -1072,6 +1175,16 @@ static void rtl8730e_up_rxint(struct uart_dev_s *dev, bool enable)
 	struct rtl8730e_up_dev_s *priv = (struct rtl8730e_up_dev_s *)dev->priv;
 	DEBUGASSERT(priv);
 	priv->rxint_enable = enable;
+#ifdef CONFIG_SERIAL_DMA
+	if (uart_rxdma(dev)) {
+		/* The GDMA takes the received data. Only the RX timeout is used, it is
+		 * raised by the bytes left in the FIFO below the DMA burst size when the
+		 * line becomes idle at the end of a message.
+		 */
+		UART_INTConfig(UART_DEV_TABLE[uart_index_get(priv->tx)].UARTx, RUART_BIT_ETOI, enable ? ENABLE : DISABLE);
+		return;
+	}
+#endif
 	serial_irq_set(sdrv[uart_index_get(priv->tx)], RxIrq, enable);	// 1= ENABLE
 }
 
@@ -1121,12 +1234,12 @@ static void rtl8730e_up_txint(struct uart_dev_s *dev, bool enable)
 	DEBUGASSERT(priv);
 	priv->txint_enable = enable;
 #ifdef CONFIG_PM
-	irqstate_t flags = enter_critical_section();
-	if (uart_active_state != enable) {	/* State has changed */
-		bsp_pm_domain_control(BSP_UART_DRV, enable);
-		uart_active_state = enable;
-	}
-	leave_critical_section(flags);
+#ifdef CONFIG_SERIAL_DMA
+	/* A running TX DMA transfer keeps the domain active */
+	rtl8730e_up_pm_active(enable || dev->dmatx.length != 0);
+#else
+	rtl8730e_up_pm_active(enable);
+#endif
 #endif
 	serial_irq_set(sdrv[uart_index_get(priv->tx)], TxIrq, enable);
 	if (enable)
@@ -1165,6 +1278,194 @@ static bool rtl8730e_up_txempty(struct uart_dev_s *dev)
 	return (serial_tx_empty(sdrv[uart_index_get(priv->tx)]));
 }
 
+#ifdef CONFIG_PM
+/****************************************************************************
+ * Name: rtl8730e_up_pm_active
+ *
+ * Description:
+ *   Keep the UART domain active while data is sent
+ *
+ ****************************************************************************/
+
+static void rtl8730e_up_pm_active(bool active)
+{
+	irqstate_t flags = enter_critical_section();
+	if (uart_active_state != active) {	/* State has changed */
+		bsp_pm_domain_control(BSP_UART_DRV, active);
+		uart_active_state = active;
+	}
+	leave_critical_section(flags);
+}
+#endif
+
+#ifdef CONFIG_SERIAL_DMA
+/****************************************************************************
+ * Name: rtl8730e_up_dma_send
+ *
+ * Description:
+ *   Start the GDMA transfer of dev->dmatx. Only the first segment is sent,
+ *   the completion starts the next one.
+ *
+ ****************************************************************************/
+
+static void rtl8730e_up_dma_send(struct uart_dev_s *dev)
+{
+	struct rtl8730e_up_dev_s *priv = (struct rtl8730e_up_dev_s *)dev->priv;
+	DEBUGASSERT(priv);
+
+#ifdef CONFIG_PM
+	rtl8730e_up_pm_active(true);
+#endif
+	if (serial_send_stream_dma(sdrv[uart_index_get(priv->tx)], dev->dmatx.buffer, dev->dmatx.length) != HAL_OK) {
+		/* No GDMA channel is free, send with the TX interrupt instead */
+		dev->dmatx.length = 0;
+		rtl8730e_up_txint(dev, true);
+	}
+}
+
+/****************************************************************************
+ * Name: rtl8730e_up_dma_txavail
+ *
+ * Description:
+ *   Start a TX transfer if none is running
+ *
+ ****************************************************************************/
+
+static void rtl8730e_up_dma_txavail(struct uart_dev_s *dev)
+{
+	struct rtl8730e_up_dev_s *priv = (struct rtl8730e_up_dev_s *)dev->priv;
+	irqstate_t flags;
+	DEBUGASSERT(priv);
+
+	flags = enter_critical_section();
+	/* The TX interrupt drains the buffer itself after a failed transfer */
+	if (dev->dmatx.length == 0 && !priv->txint_enable) {
+		uart_xmitchars_dma(dev);
+	}
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: rtl8730e_up_dma_txdone
+ *
+ * Description:
+ *   GDMA TX completion, called from the interrupt with the uart_dev_s as id
+ *
+ ****************************************************************************/
+
+static void rtl8730e_up_dma_txdone(uint32_t id)
+{
+	struct uart_dev_s *dev = (struct uart_dev_s *)id;
+	struct rtl8730e_up_dev_s *priv = (struct rtl8730e_up_dev_s *)dev->priv;
+	DEBUGASSERT(priv);
+
+	dev->dmatx.nbytes = dev->dmatx.length;
+	uart_xmitchars_done(dev);
+	uart_xmitchars_dma(dev);
+#ifdef CONFIG_PM
+	if (dev->dmatx.length == 0 && !priv->txint_enable) {
+		rtl8730e_up_pm_active(false);
+	}
+#endif
+}
+
+/****************************************************************************
+ * Name: rtl8730e_up_dma_receive
+ *
+ * Description:
+ *   Start the GDMA transfer into dev->dmarx. Only the first segment is used,
+ *   the completion or the idle line starts the next one.
+ *
+ ****************************************************************************/
+
+static void rtl8730e_up_dma_receive(struct uart_dev_s *dev)
+{
+	struct rtl8730e_up_dev_s *priv = (struct rtl8730e_up_dev_s *)dev->priv;
+	DEBUGASSERT(priv);
+
+	if (serial_recv_stream_dma(sdrv[uart_index_get(priv->tx)], dev->dmarx.buffer, dev->dmarx.length) != HAL_OK) {
+		/* No GDMA channel is free, the RX timeout reads the FIFO instead */
+		dev->dmarx.length = 0;
+	}
+
+	/* serial_recv_stream_dma() masks the RX interrupts, take the timeout back */
+	if (priv->rxint_enable) {
+		UART_INTConfig(UART_DEV_TABLE[uart_index_get(priv->tx)].UARTx, RUART_BIT_ETOI, ENABLE);
+	}
+}
+
+/****************************************************************************
+ * Name: rtl8730e_up_dma_rxfree
+ *
+ * Description:
+ *   Start an RX transfer if none is running
+ *
+ ****************************************************************************/
+
+static void rtl8730e_up_dma_rxfree(struct uart_dev_s *dev)
+{
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	if (dev->dmarx.length == 0) {
+		uart_recvchars_dma(dev);
+	}
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: rtl8730e_up_dma_rxdone
+ *
+ * Description:
+ *   GDMA RX completion, called from the interrupt with the uart_dev_s as id
+ *   when the whole segment is filled
+ *
+ ****************************************************************************/
+
+static void rtl8730e_up_dma_rxdone(uint32_t id)
+{
+	struct uart_dev_s *dev = (struct uart_dev_s *)id;
+
+	dev->dmarx.nbytes = dev->dmarx.length;
+	uart_recvchars_done(dev);
+	uart_recvchars_dma(dev);
+}
+
+/****************************************************************************
+ * Name: rtl8730e_up_dma_rxidle
+ *
+ * Description:
+ *   RX timeout of a DMA port. The line is idle, so the running transfer is
+ *   stopped and the bytes received so far are given to the upper half.
+ *
+ ****************************************************************************/
+
+static void rtl8730e_up_dma_rxidle(struct uart_dev_s *dev)
+{
+	struct rtl8730e_up_dev_s *priv = (struct rtl8730e_up_dev_s *)dev->priv;
+	int32_t nbytes;
+	DEBUGASSERT(priv);
+
+	if (dev->dmarx.length == 0) {
+		/* No transfer is running, the buffer is full or no GDMA channel was free */
+		uart_recvchars(dev);
+		return;
+	}
+
+	nbytes = serial_recv_stream_abort(sdrv[uart_index_get(priv->tx)]);
+	if (nbytes < 0) {
+		nbytes = 0;
+	}
+	if (nbytes > 0) {
+		DCache_Invalidate((u32)dev->dmarx.buffer, nbytes);
+	}
+
+	dev->dmarx.nbytes = nbytes;
+	uart_recvchars_done(dev);
+	uart_recvchars_dma(dev);
+}
+#endif
+
 /****************************************************************************
  * Name: rtk_loguart/uart_suspend/resume
  *
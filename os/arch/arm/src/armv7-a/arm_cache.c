@@ -41,11 +41,44 @@
 
 #include <tinyara/config.h>
 #include <tinyara/irq.h>
+#include <tinyara/arch.h>
 
 #include "cp15_cacheops.h"
 #include "barriers.h"
 #include "l2cc.h"
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* The smallest D cache line, from the DMinLine field of the Cache Type
+ * Register, as in the cp15_*_dcache() loops.
+ */
+
+static inline uintptr_t arm_dcache_linesize(void)
+{
+	uint32_t ctr;
+
+	__asm__ __volatile__("\tmrc p15, 0, %0, c0, c0, 1\n" : "=r"(ctr));	/* CTR */
+	return 4 << ((ctr >> 16) & 0xf);
+}
+
+/* Total size of the regions, to choose between the lines and the whole
+ * cache.
+ */
+
+static size_t arm_dcache_ranges_size(FAR const struct dcache_range_s *ranges, int nranges)
+{
+	size_t size = 0;
+	int i;
+
+	for (i = 0; i < nranges; i++) {
+		size += ranges[i].end - ranges[i].start;
+	}
+
+	return size;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -150,7 +183,7 @@ void up_invalidate_icache_all(void)
 
 void up_clean_dcache(uintptr_t start, uintptr_t end)
 {
-	if (cp15_cache_size() < (end - start)) {
+	if ((end - start) < cp15_cache_size()) {
 		cp15_clean_dcache(start, end);
 	} else {
 		cp15_clean_dcache_all();
@@ -211,7 +244,7 @@ void up_clean_dcache_all(void)
 
 void up_flush_dcache(uintptr_t start, uintptr_t end)
 {
-	if (cp15_cache_size() < (end - start)) {
+	if ((end - start) < cp15_cache_size()) {
 		cp15_flush_dcache(start, end);
 	} else {
 		cp15_flush_dcache_all();
@@ -248,6 +281,138 @@ void up_flush_dcache_all(void)
 	l2cc_flush_all();
 }
 
+/****************************************************************************
+ * Name: up_clean_dcache_ranges
+ *
+ * Description:
+ *   Clean the data cache within each region, with one barrier at the end.
+ *
+ * Input Parameters:
+ *   ranges  - The regions
+ *   nranges - The number of regions
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void up_clean_dcache_ranges(FAR const struct dcache_range_s *ranges, int nranges)
+{
+	uintptr_t linesize;
+	uintptr_t addr;
+	int i;
+
+	if (arm_dcache_ranges_size(ranges, nranges) < cp15_cache_size()) {
+		linesize = arm_dcache_linesize();
+		for (i = 0; i < nranges; i++) {
+			for (addr = ranges[i].start & ~(linesize - 1); addr < ranges[i].end; addr += linesize) {
+				cp15_clean_dcache_bymva(addr);
+			}
+		}
+
+		ARM_DSB();
+	} else {
+		cp15_clean_dcache_all();
+	}
+
+	for (i = 0; i < nranges; i++) {
+		l2cc_clean(ranges[i].start, ranges[i].end);
+	}
+}
+
+/****************************************************************************
+ * Name: up_invalidate_dcache_ranges
+ *
+ * Description:
+ *   Invalidate the data cache within each region, with one barrier at the
+ *   end.  The whole cache is never invalidated, as it would lose the data
+ *   of the other regions.
+ *
+ * Input Parameters:
+ *   ranges  - The regions
+ *   nranges - The number of regions
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void up_invalidate_dcache_ranges(FAR const struct dcache_range_s *ranges, int nranges)
+{
+	uintptr_t linesize;
+	uintptr_t start;
+	uintptr_t end;
+	uintptr_t addr;
+	int i;
+
+	linesize = arm_dcache_linesize();
+	for (i = 0; i < nranges; i++) {
+		/* As in cp15_invalidate_dcache(), the lines shared with the data
+		 * around the region are cleaned first.
+		 */
+
+		start = ranges[i].start & ~(linesize - 1);
+		end = ranges[i].end & ~(linesize - 1);
+		if (start != ranges[i].start) {
+			cp15_cleaninvalidate_dcacheline_bymva(start);
+		}
+
+		if (end != ranges[i].end) {
+			cp15_cleaninvalidate_dcacheline_bymva(end);
+		}
+
+		for (addr = start; addr < end; addr += linesize) {
+			cp15_invalidate_dcacheline_bymva(addr);
+		}
+	}
+
+	ARM_DSB();
+
+	for (i = 0; i < nranges; i++) {
+		l2cc_invalidate(ranges[i].start, ranges[i].end);
+	}
+}
+
+/****************************************************************************
+ * Name: up_flush_dcache_ranges
+ *
+ * Description:
+ *   Flush the data cache within each region by cleaning and invalidating
+ *   the D cache, with one barrier at the end.
+ *
+ * Input Parameters:
+ *   ranges  - The regions
+ *   nranges - The number of regions
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void up_flush_dcache_ranges(FAR const struct dcache_range_s *ranges, int nranges)
+{
+	uintptr_t linesize;
+	uintptr_t addr;
+	int i;
+
+	if (arm_dcache_ranges_size(ranges, nranges) < cp15_cache_size()) {
+		linesize = arm_dcache_linesize();
+		for (i = 0; i < nranges; i++) {
+			for (addr = ranges[i].start & ~(linesize - 1); addr < ranges[i].end; addr += linesize) {
+				cp15_cleaninvalidate_dcacheline_bymva(addr);
+			}
+		}
+
+		ARM_DSB();
+	} else {
+		cp15_flush_dcache_all();
+	}
+
+	for (i = 0; i < nranges; i++) {
+		l2cc_flush(ranges[i].start, ranges[i].end);
+	}
+}
+
 /****************************************************************************
  * Name: up_enable_icache
  *
@@ -422,8 +422,10 @@ int up_cpu_resume(int cpu)
  * Name: up_cpu_pause_all
  *
  * Description:
- *   pause all the CPUs other than the current cpu. Internally, it calls
- *   up_cpu_pause() api to stop all the CPU's.
+ *   pause all the CPUs other than the current cpu.  The CPUs are paused
+ *   together: the spinlocks of all of them are taken, one SGI2 is sent to
+ *   the set of them, and then they are waited for, so that the pauses
+ *   overlap instead of following each other.
  *
  * Returned Value:
  *   None
@@ -432,11 +434,38 @@ int up_cpu_resume(int cpu)
 
 void up_cpu_pause_all(void)
 {
-	int me = sched_getcpu();
-	for (int cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
-		if (cpu != me) {
-			/* Pause the CPU */
-			up_cpu_pause(cpu);
+	unsigned int cpuset = 0;
+	int me = this_cpu();
+	int cpu;
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		/* As in up_cpu_pause(), a CPU with a pause pending or done is not
+		 * sent another request.
+		 */
+
+		if (cpu == me || up_cpu_pausereq(cpu) || up_is_cpu_paused(cpu)) {
+			continue;
+		}
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION
+		sched_note_cpu_pause(this_task(), cpu);
+#endif
+
+		spin_lock(&g_cpu_wait[cpu]);
+		spin_lock(&g_cpu_paused[cpu]);
+		cpuset |= (1 << cpu);
+	}
+
+	if (cpuset == 0) {
+		return;
+	}
+
+	arm_cpu_sgi(GIC_IRQ_SGI2, cpuset);
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		if ((cpuset & (1 << cpu)) != 0) {
+			spin_lock(&g_cpu_paused[cpu]);
+			spin_unlock(&g_cpu_paused[cpu]);
 		}
 	}
 }
@@ -445,7 +474,8 @@ void up_cpu_pause_all(void)
  * Name: up_cpu_resume_all
  *
  * Description:
- *   Resume all the CPUs which were paused earlier.
+ *   Resume all the CPUs which were paused earlier.  All of them are
+ *   released before any is waited for.
  *
  * Returned Value:
  *   None
@@ -454,11 +484,23 @@ void up_cpu_pause_all(void)
 
 void up_cpu_resume_all(void)
 {
-	int me = sched_getcpu();
-	for (int cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+	int me = this_cpu();
+	int cpu;
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		if (cpu != me) {
+#ifdef CONFIG_SCHED_INSTRUMENTATION
+			sched_note_cpu_resume(this_task(), cpu);
+#endif
+			DEBUGASSERT(spin_is_locked(&g_cpu_wait[cpu]) && !spin_is_locked(&g_cpu_paused[cpu]));
+			spin_unlock(&g_cpu_wait[cpu]);
+		}
+	}
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
 		if (cpu != me) {
-			/* Resume the CPU */
-			up_cpu_resume(cpu);
+			spin_lock(&g_cpu_resumed[cpu]);
+			spin_unlock(&g_cpu_resumed[cpu]);
 		}
 	}
 }
@@ -39,6 +39,8 @@
  * Included Files
  ****************************************************************************/
 
+#include <tinyara/config.h>
+
 #include <tinyara/arch.h>
 #include <tinyara/clock.h>
 
@@ -51,6 +53,20 @@
 
 static uint32_t g_cpu_freq;
 
+#ifdef CONFIG_PERF_EVENTS
+/* The common events of the PMU counted per thread, by event counter */
+
+static const uint8_t g_perf_event[2] = {
+	0x03,						/* L1 D cache refill */
+	0x01						/* L1 I cache refill */
+};
+
+static const char *const g_perf_event_name[2] = {
+	"l1d_refill",
+	"l1i_refill"
+};
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -77,7 +93,11 @@ static uint32_t g_cpu_freq;
 
 void up_perf_init(void *arg)
 {
-	g_cpu_freq = (uint32_t)(uintptr_t) arg;
+	/* A known frequency is not forgotten by a later call without one */
+
+	if (arg != NULL) {
+		g_cpu_freq = (uint32_t)(uintptr_t) arg;
+	}
 
 	cp15_pmu_uer(PMUER_UME);
 	cp15_pmu_pmcr(PMCR_E);
@@ -102,3 +122,43 @@ void up_perf_convert(uint32_t elapsed, struct timespec *ts)
 	left = elapsed - ts->tv_sec * g_cpu_freq;
 	ts->tv_nsec = NSEC_PER_SEC * (uint64_t)left / g_cpu_freq;
 }
+
+/****************************************************************************
+ * Name: up_perf_events_*
+ *
+ * Description:
+ *   The event counters 0 and 1 of the PMU of the calling CPU, 32 bits wide.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PERF_EVENTS
+uint32_t up_perf_events_start(void)
+{
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		cp15_pmu_wrecsr(i);
+		cp15_pmu_wretsr(g_perf_event[i]);
+	}
+
+	cp15_pmu_uer(PMUER_UME);
+	cp15_pmu_pmcr(PMCR_E);
+	cp15_pmu_cesr((1 << 0) | (1 << 1));
+	return 0xffffffff;
+}
+
+void up_perf_events_read(FAR uint32_t *counts)
+{
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		cp15_pmu_wrecsr(i);
+		counts[i] = cp15_pmu_rdecr();
+	}
+}
+
+FAR const char *up_perf_events_name(int event)
+{
+	return g_perf_event_name[event];
+}
+#endif
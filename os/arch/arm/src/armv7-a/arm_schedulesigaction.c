@@ -163,6 +163,14 @@ void up_schedule_sigaction(struct tcb_s *tcb, sig_deliver_t sigdeliver)
 
 				CURRENT_REGS[REG_SP] = (uint32_t)CURRENT_REGS + (uint32_t)XCPTCONTEXT_SIZE;
 
+#ifdef CONFIG_ARMV7A_LAZYFPU
+				/* The interrupt did not save the floating point registers,
+				 * the trampoline starts with the live FPSCR of the task.
+				 */
+
+				__asm__ __volatile__("vmrs %0, fpscr" : "=r"(CURRENT_REGS[REG_FPSCR]));
+#endif
+
 				/* Then set up to vector to the trampoline with interrupts
 				 * disabled
 				 */
@@ -939,7 +939,7 @@ static inline void cp15_clean_ucache_bymva(unsigned int setway)
 static inline void cp15_cleaninvalidate_dcacheline_bymva(unsigned int va)
 {
 	__asm__ __volatile__(
-		"\tmcr p15, 0, r0, c7, c14, 1\n" /* DCCIMVAC */
+		"\tmcr p15, 0, %0, c7, c14, 1\n" /* DCCIMVAC */
 		:
 		: "r" (va)
 		: "memory"
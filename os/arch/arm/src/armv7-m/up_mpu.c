@@ -79,6 +79,14 @@
  * Private Data
  ****************************************************************************/
 
+/* The base and attribute values last written by up_mpu_set_register(), by
+ * region.  Every context switch to an app task sets its app and stack
+ * regions, which mostly hold these values already between the tasks of
+ * one binary.
+ */
+
+static uint32_t g_mpu_shadow[CONFIG_ARMV7M_MPU_NREGIONS][2];
+
 /* These sets represent the set of disabled memory sub-regions.  A bit set
  * corresponds to a disabled sub-region; the LS bit corresponds to the first
  * region.
@@ -372,11 +380,24 @@ void mpu_get_register_config_value(uint32_t *regs, uint32_t region, uintptr_t ba
  ****************************************************************************/
 void up_mpu_set_register(uint32_t *mpu_regs)
 {
+	uint32_t region = mpu_regs[MPU_REG_RNR];
+
 	/* We update MPU registers only if there is non zero value of
 	 * base address (This ensures valid MPU settings)
 	 */
 	if (mpu_regs[MPU_REG_RBAR]) {
-		putreg32(mpu_regs[MPU_REG_RNR], MPU_RNR);
+		/* Skip the region if the MPU holds these values already */
+
+		if (region < CONFIG_ARMV7M_MPU_NREGIONS) {
+			if (g_mpu_shadow[region][0] == mpu_regs[MPU_REG_RBAR] && g_mpu_shadow[region][1] == mpu_regs[MPU_REG_RASR]) {
+				return;
+			}
+
+			g_mpu_shadow[region][0] = mpu_regs[MPU_REG_RBAR];
+			g_mpu_shadow[region][1] = mpu_regs[MPU_REG_RASR];
+		}
+
+		putreg32(region, MPU_RNR);
 		putreg32(mpu_regs[MPU_REG_RBAR], MPU_RBAR);
 		putreg32(mpu_regs[MPU_REG_RASR], MPU_RASR);
 	}
@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * arch/arm/src/armv7-m/up_perf.c
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <time.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/clock.h>
+
+#include "up_arch.h"
+#include "nvic.h"
+#include "dwt.h"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static uint32_t g_cpu_freq;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: up_perf_*
+ *
+ * Description:
+ *   The counter is the DWT cycle counter, which runs at the core clock.
+ *   Like the core clock, it stops while the core sleeps in WFI.
+ *
+ ****************************************************************************/
+
+void up_perf_init(FAR void *arg)
+{
+	/* Several subsystems start the counter, not all of them knowing its
+	 * frequency: a known frequency is not forgotten.
+	 */
+
+	if (arg != NULL) {
+		g_cpu_freq = (uint32_t)(uintptr_t)arg;
+	}
+
+	/* Enable the trace and debug blocks, then the cycle counter.  A counter
+	 * already running, started by the boot profile or the boot loader,
+	 * keeps its count.
+	 */
+
+	modifyreg32(NVIC_DEMCR, 0, NVIC_DEMCR_TRCENA);
+	if ((getreg32(DWT_CTRL) & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+		putreg32(0, DWT_CYCCNT);
+		modifyreg32(DWT_CTRL, 0, DWT_CTRL_CYCCNTENA_Msk);
+	}
+}
+
+uint32_t up_perf_getfreq(void)
+{
+	return g_cpu_freq;
+}
+
+uint32_t up_perf_gettime(void)
+{
+	return getreg32(DWT_CYCCNT);
+}
+
+void up_perf_convert(uint32_t elapsed, FAR struct timespec *ts)
+{
+	uint32_t left;
+
+	ts->tv_sec = elapsed / g_cpu_freq;
+	left = elapsed - ts->tv_sec * g_cpu_freq;
+	ts->tv_nsec = NSEC_PER_SEC * (uint64_t)left / g_cpu_freq;
+}
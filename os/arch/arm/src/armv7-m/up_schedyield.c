@@ -83,6 +83,7 @@ void up_schedyield(void)
 
 		/* Remove the TCB from the ready-to-run list */
 
+		sched_rtrindex_remove(rtcb, (FAR dq_queue_t *)&g_readytorun);
 		dq_rem((FAR dq_entry_t *)rtcb, (FAR dq_queue_t *)&g_readytorun);
 
 		/* Add the task in the correct location in the prioritized
@@ -92,6 +92,10 @@ int g_irq_nums[3] = {0}; /* Array to store the last three interrupt numbers */
 
 uint32_t *up_doirq(int irq, uint32_t *regs)
 {
+	/* Time the latency to the handler from here */
+
+	IRQ_TIMING_ENTRY();
+
 	/* Store the last three interrupt numbers for reference during assert */
 	g_irq_nums[2] = g_irq_nums[1];
 	g_irq_nums[1] = g_irq_nums[0];
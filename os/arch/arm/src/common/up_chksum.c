@@ -0,0 +1,292 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * arch/arm/src/common/up_chksum.c
+ *
+ * Internet checksum (RFC 1071) for the network stack.
+ *
+ * The bulk of the data is summed as 32-bit words with ADCS, which keeps the
+ * carries in the carry flag, 16 bytes per iteration. Cores with NEON sum
+ * 32 bytes per iteration with VPADAL instead. The head and the tail that
+ * are not word aligned are summed as 16-bit words in C.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <tinyara/arch.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_NEON) && defined(CONFIG_ARCH_FPU)
+#include <arm_neon.h>
+#define CHKSUM_NEON 1
+#endif
+
+#ifdef CONFIG_ARCH_CHKSUM
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define FOLD_U32(u)          (((u) >> 16) + ((u) & 0xffffUL))
+#define SWAP_BYTES_IN_U16(w) ((((w) & 0xff) << 8) | (((w) & 0xff00) >> 8))
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Add 'nblocks' blocks of 16 bytes at the word aligned 'pl' to 'sum'.
+ * TEQ with #0 and SUB leave the carry flag alone. The two final additions
+ * fold the last carry, including the one of 0xffffffff + 1.
+ */
+
+static uint32_t chksum_blocks(uint32_t sum, const uint32_t *pl, int nblocks)
+{
+	uint32_t a, b, c, d;
+
+	__asm__ volatile(
+		"	adds	%[sum], %[sum], #0\n"
+		"1:	ldr	%[a], [%[pl]], #4\n"
+		"	ldr	%[b], [%[pl]], #4\n"
+		"	ldr	%[c], [%[pl]], #4\n"
+		"	ldr	%[d], [%[pl]], #4\n"
+		"	adcs	%[sum], %[sum], %[a]\n"
+		"	adcs	%[sum], %[sum], %[b]\n"
+		"	adcs	%[sum], %[sum], %[c]\n"
+		"	adcs	%[sum], %[sum], %[d]\n"
+		"	sub	%[n], %[n], #1\n"
+		"	teq	%[n], #0\n"
+		"	bne	1b\n"
+		"	adcs	%[sum], %[sum], #0\n"
+		"	adc	%[sum], %[sum], #0\n"
+		: [sum] "+r"(sum), [pl] "+r"(pl), [n] "+r"(nblocks),
+		  [a] "=&r"(a), [b] "=&r"(b), [c] "=&r"(c), [d] "=&r"(d)
+		:
+		: "cc", "memory");
+
+	return sum;
+}
+
+/* Same as chksum_blocks(), storing the words to 'pd' as they are summed */
+
+static uint32_t chksum_copy_blocks(uint32_t sum, uint32_t *pd, const uint32_t *pl, int nblocks)
+{
+	uint32_t a, b, c, d;
+
+	__asm__ volatile(
+		"	adds	%[sum], %[sum], #0\n"
+		"1:	ldr	%[a], [%[pl]], #4\n"
+		"	ldr	%[b], [%[pl]], #4\n"
+		"	ldr	%[c], [%[pl]], #4\n"
+		"	ldr	%[d], [%[pl]], #4\n"
+		"	str	%[a], [%[pd]], #4\n"
+		"	str	%[b], [%[pd]], #4\n"
+		"	str	%[c], [%[pd]], #4\n"
+		"	str	%[d], [%[pd]], #4\n"
+		"	adcs	%[sum], %[sum], %[a]\n"
+		"	adcs	%[sum], %[sum], %[b]\n"
+		"	adcs	%[sum], %[sum], %[c]\n"
+		"	adcs	%[sum], %[sum], %[d]\n"
+		"	sub	%[n], %[n], #1\n"
+		"	teq	%[n], #0\n"
+		"	bne	1b\n"
+		"	adcs	%[sum], %[sum], #0\n"
+		"	adc	%[sum], %[sum], #0\n"
+		: [sum] "+r"(sum), [pd] "+r"(pd), [pl] "+r"(pl), [n] "+r"(nblocks),
+		  [a] "=&r"(a), [b] "=&r"(b), [c] "=&r"(c), [d] "=&r"(d)
+		:
+		: "cc", "memory");
+
+	return sum;
+}
+
+#ifdef CHKSUM_NEON
+/* Add 'nblocks' blocks of 32 bytes at the word aligned 'pl' to 'sum'. Each
+ * 32-bit lane takes four 16-bit words per block, so it cannot overflow for
+ * the lengths of a packet.
+ */
+
+static uint32_t chksum_blocks_neon(uint32_t sum, const uint32_t *pl, int nblocks)
+{
+	const uint16_t *ps = (const uint16_t *)pl;
+	uint32x4_t acc = vdupq_n_u32(0);
+	uint64x2_t acc64;
+	uint64_t total;
+
+	while (nblocks-- > 0) {
+		acc = vpadalq_u16(acc, vld1q_u16(ps));
+		acc = vpadalq_u16(acc, vld1q_u16(ps + 8));
+		ps += 16;
+	}
+
+	acc64 = vpaddlq_u32(acc);
+	total = vgetq_lane_u64(acc64, 0) + vgetq_lane_u64(acc64, 1) + sum;
+	total = (total >> 32) + (total & 0xffffffffULL);
+	total = (total >> 32) + (total & 0xffffffffULL);
+
+	return (uint32_t)total;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: up_chksum
+ *
+ * Description:
+ *   Return the Internet checksum of 'len' bytes at 'dataptr', in host
+ *   order and not inverted. 'dataptr' may be at any address. 'len' is at
+ *   most 65535.
+ *
+ ****************************************************************************/
+
+uint16_t up_chksum(const void *dataptr, int len)
+{
+	const uint8_t *pb = (const uint8_t *)dataptr;
+	const uint16_t *ps;
+	const uint32_t *pl;
+	uint16_t t = 0;
+	uint32_t sum = 0;
+	int nblocks;
+	/* starts at odd byte address? */
+	int odd = ((uintptr_t)pb & 1);
+
+	if (odd && len > 0) {
+		((uint8_t *)&t)[1] = *pb++;
+		len--;
+	}
+
+	ps = (const uint16_t *)(const void *)pb;
+
+	if (((uintptr_t)ps & 3) && len > 1) {
+		sum += *ps++;
+		len -= 2;
+	}
+
+	pl = (const uint32_t *)(const void *)ps;
+
+#ifdef CHKSUM_NEON
+	nblocks = len >> 5;
+	if (nblocks > 0) {
+		sum = chksum_blocks_neon(sum, pl, nblocks);
+		pl += nblocks * 8;
+		len &= 31;
+	}
+#endif
+
+	nblocks = len >> 4;
+	if (nblocks > 0) {
+		sum = chksum_blocks(sum, pl, nblocks);
+		pl += nblocks * 4;
+		len &= 15;
+	}
+
+	/* make room in upper bits */
+	sum = FOLD_U32(sum);
+
+	ps = (const uint16_t *)pl;
+
+	/* 16-bit aligned word remaining? */
+	while (len > 1) {
+		sum += *ps++;
+		len -= 2;
+	}
+
+	/* dangling tail byte remaining? */
+	if (len > 0) {
+		((uint8_t *)&t)[0] = *(const uint8_t *)ps;
+	}
+
+	sum += t;
+
+	sum = FOLD_U32(sum);
+	sum = FOLD_U32(sum);
+
+	if (odd) {
+		sum = SWAP_BYTES_IN_U16(sum);
+	}
+
+	return (uint16_t)sum;
+}
+
+/****************************************************************************
+ * Name: up_chksum_copy
+ *
+ * Description:
+ *   Copy 'len' bytes from 'src' to 'dst' and return their checksum as
+ *   up_chksum() does. When both buffers have the same word alignment, the
+ *   words are copied as they are summed, so the data is read once.
+ *
+ ****************************************************************************/
+
+uint16_t up_chksum_copy(void *dst, const void *src, uint16_t len)
+{
+	uint8_t *pd = (uint8_t *)dst;
+	const uint8_t *ps = (const uint8_t *)src;
+	uint32_t sum;
+	uint32_t body;
+	int head;
+	int nblocks;
+
+	if ((((uintptr_t)pd ^ (uintptr_t)ps) & 3) != 0 || len < 32) {
+		memcpy(dst, src, len);
+		return up_chksum(dst, len);
+	}
+
+	head = (4 - ((uintptr_t)ps & 3)) & 3;
+	memcpy(pd, ps, head);
+	sum = up_chksum(pd, head);
+	pd += head;
+	ps += head;
+	len -= head;
+
+	nblocks = len >> 4;
+	body = chksum_copy_blocks(0, (uint32_t *)pd, (const uint32_t *)ps, nblocks);
+	pd += nblocks * 16;
+	ps += nblocks * 16;
+	len &= 15;
+
+	memcpy(pd, ps, len);
+	body = FOLD_U32(body);
+	body += up_chksum(pd, len);
+	body = FOLD_U32(body);
+	body = FOLD_U32(body);
+
+	/* After an odd head, the bytes of the rest are at the other position
+	 * of the 16-bit words.
+	 */
+
+	if (head & 1) {
+		body = SWAP_BYTES_IN_U16(body);
+	}
+
+	sum += body;
+	sum = FOLD_U32(sum);
+	sum = FOLD_U32(sum);
+
+	return (uint16_t)sum;
+}
+
+#endif							/* CONFIG_ARCH_CHKSUM */
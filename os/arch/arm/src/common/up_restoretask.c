@@ -37,6 +37,12 @@
 #include "mpu.h"
 #endif
 #include <tinyara/arch.h>
+#ifdef CONFIG_TTRACE_FAST
+#include <tinyara/ttrace.h>
+#endif
+#ifdef CONFIG_PERF_EVENTS
+#include <tinyara/perf.h>
+#endif
 
 #include "up_internal.h"
 #include "sched/sched.h"
@@ -110,6 +116,31 @@ void up_restoretask(struct tcb_s *tcb)
 		tcb->is_active = true;
 #endif
 
+#ifdef CONFIG_SCHED_LATENCY
+		/* Account for the time the task waited to run since its wakeup */
+		sched_latency_resume(tcb);
+#endif
+
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+		/* Charge the cycles run so far and make tcb the owner of the next */
+		sched_cycles_switch(tcb);
+#endif
+
+#ifdef CONFIG_PERF_EVENTS
+		/* The same for the hardware events of CONFIG_PERF_EVENTS */
+		perf_events_switch(tcb);
+#endif
+
+#ifdef CONFIG_LIB_SYSCALL_VDSO
+		/* Give the PID and the time to the library of the task */
+		sched_vdso_update(tcb);
+#endif
+
+#ifdef CONFIG_TTRACE_FAST
+		/* Record the switch in the trace ring of this CPU */
+		ttrace_fast_switch(tcb);
+#endif
+
 #ifdef CONFIG_ARMV8M_TRUSTZONE
 		if (tcb->tz_context) {
 			TZ_LoadContext_S(tcb->tz_context);
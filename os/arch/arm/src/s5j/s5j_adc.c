@@ -85,6 +85,15 @@ struct s5j_dev_s {
 
 	struct work_s work;	/* Supports the IRQ handling */
 	uint8_t chanlist[S5J_ADC_MAX_CHANNELS];
+
+#ifdef CONFIG_ADC_SCAN
+	FAR uint16_t *scanbuf;	/* Scan buffer of the upper half, NULL if no scan runs */
+	size_t scansize;	/* Number of samples in scanbuf */
+	size_t scanpos;		/* Next sample written in scanbuf */
+	uint8_t nscanch;	/* Number of channels per scan */
+	uint8_t scancur;	/* Index of the channel being converted */
+	uint8_t scanch[CONFIG_ADC_SCAN_NCHANNELS];
+#endif
 };
 
 /****************************************************************************
@@ -107,14 +116,64 @@ struct s5j_dev_s {
  *   None
  *
  ****************************************************************************/
+#ifdef CONFIG_ADC_SCAN
+/****************************************************************************
+ * Name: adc_scansample
+ *
+ * Description:
+ *   Store the sample of a scan and hand each filled half of the scan buffer
+ *   to the upper half, then convert the next channel of the scan.
+ *
+ ****************************************************************************/
+static void adc_scansample(struct s5j_dev_s *priv, uint16_t sample)
+{
+	size_t half = priv->scansize / 2;
+
+	priv->scanbuf[priv->scanpos++] = sample;
+	if (priv->scanpos == half) {
+		priv->cb->au_receive_block(priv->dev, priv->scanbuf, half);
+	} else if (priv->scanpos == priv->scansize) {
+		priv->cb->au_receive_block(priv->dev, &priv->scanbuf[half], half);
+		priv->scanpos = 0;
+	}
+
+	/* The scan may have been stopped by the upper half */
+	if (priv->scanbuf == NULL) {
+		return;
+	}
+
+	if (++priv->scancur >= priv->nscanch) {
+		priv->scancur = 0;
+	}
+
+	modifyreg32(S5J_ADC_CON2, ADC_CON2_ACHSEL_MASK,
+				priv->scanch[priv->scancur]);
+	modifyreg32(S5J_ADC_CON1, 0, ADC_CON1_STCEN_ENABLE);
+}
+#endif
+
 static void adc_conversion(void *arg)
 {
 	uint16_t sample;
 	struct s5j_dev_s *priv = (struct s5j_dev_s *)arg;
+#ifdef CONFIG_ADC_SCAN
+	irqstate_t flags;
+#endif
 
 	/* Read the ADC sample and pass it to the upper-half */
 	sample = getreg32(S5J_ADC_DAT) & ADC_DAT_ADCDAT_MASK;
 
+#ifdef CONFIG_ADC_SCAN
+	/* The scan may be stopped and its buffer freed at any time */
+	flags = irqsave();
+	if (priv->scanbuf != NULL) {
+		adc_scansample(priv, sample);
+		irqrestore(flags);
+		return;
+	}
+	irqrestore(flags);
+#endif
+
 	if (priv->cb != NULL) {
 		DEBUGASSERT(priv->cb->au_receive != NULL);
 		priv->cb->au_receive(priv->dev,
@@ -417,6 +476,83 @@ static int adc_ioctl(FAR struct adc_dev_s *dev, int cmd, unsigned long arg)
 	return ret;
 }
 
+#ifdef CONFIG_ADC_SCAN
+/****************************************************************************
+ * Name: adc_scanstart
+ *
+ * Description:
+ *   Start a continuous scan.  The ADC has no conversion timer, so the scan
+ *   runs back to back and only as_rate 0 is supported.
+ *
+ * Input Parameters:
+ *   dev      - pointer to device structure used by the driver
+ *   scan     - channels of the scan
+ *   buffer   - scan buffer of the upper half
+ *   nsamples - number of samples in buffer, both halves
+ *
+ * Returned Value:
+ *   int - errno
+ *
+ ****************************************************************************/
+static int adc_scanstart(FAR struct adc_dev_s *dev,
+			 FAR const struct adc_scan_s *scan,
+			 FAR uint16_t *buffer, size_t nsamples)
+{
+	FAR struct s5j_dev_s *priv = (FAR struct s5j_dev_s *)dev->ad_priv;
+	irqstate_t flags;
+	int i;
+	int j;
+
+	if (scan->as_rate != 0) {
+		return -EINVAL;
+	}
+
+	/* Only the channels given to s5j_adc_initialize() can be scanned */
+	for (i = 0; i < scan->as_nchannels; i++) {
+		for (j = 0; j < priv->cchannels &&
+					priv->chanlist[j] != scan->as_channels[i]; j++);
+
+		if (j >= priv->cchannels) {
+			return -ENODEV;
+		}
+	}
+
+	flags = irqsave();
+	memcpy(priv->scanch, scan->as_channels, scan->as_nchannels);
+	priv->nscanch  = scan->as_nchannels;
+	priv->scancur  = 0;
+	priv->scanpos  = 0;
+	priv->scansize = nsamples;
+	priv->scanbuf  = buffer;
+
+	modifyreg32(S5J_ADC_CON2, ADC_CON2_ACHSEL_MASK, priv->scanch[0]);
+	putreg32(ADC_INT_ENABLE, S5J_ADC_INT);
+	adc_startconv(priv, true);
+	irqrestore(flags);
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: adc_scanstop
+ *
+ * Description:
+ *   Stop the continuous scan and go back to the configured channels.
+ *
+ ****************************************************************************/
+static void adc_scanstop(FAR struct adc_dev_s *dev)
+{
+	FAR struct s5j_dev_s *priv = (FAR struct s5j_dev_s *)dev->ad_priv;
+	irqstate_t flags;
+
+	flags = irqsave();
+	priv->scanbuf = NULL;
+	adc_startconv(priv, false);
+	adc_set_ch(dev, 0);
+	irqrestore(flags);
+}
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -427,6 +563,10 @@ static const struct adc_ops_s g_adcops = {
 	.ao_shutdown	= adc_shutdown,
 	.ao_rxint	= adc_rxint,
 	.ao_ioctl	= adc_ioctl,
+#ifdef CONFIG_ADC_SCAN
+	.ao_scanstart	= adc_scanstart,
+	.ao_scanstop	= adc_scanstop,
+#endif
 };
 
 static struct s5j_dev_s g_adcpriv = {
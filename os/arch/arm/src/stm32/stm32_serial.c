@@ -167,6 +167,38 @@
 #error "UART8 DMA channel not defined (DMAMAP_UART8_RX)"
 #endif
 
+#if defined(CONFIG_USART1_TXDMA) && !defined(DMAMAP_USART1_TX)
+#error "USART1 TX DMA channel not defined (DMAMAP_USART1_TX)"
+#endif
+
+#if defined(CONFIG_USART2_TXDMA) && !defined(DMAMAP_USART2_TX)
+#error "USART2 TX DMA channel not defined (DMAMAP_USART2_TX)"
+#endif
+
+#if defined(CONFIG_USART3_TXDMA) && !defined(DMAMAP_USART3_TX)
+#error "USART3 TX DMA channel not defined (DMAMAP_USART3_TX)"
+#endif
+
+#if defined(CONFIG_UART4_TXDMA) && !defined(DMAMAP_UART4_TX)
+#error "UART4 TX DMA channel not defined (DMAMAP_UART4_TX)"
+#endif
+
+#if defined(CONFIG_UART5_TXDMA) && !defined(DMAMAP_UART5_TX)
+#error "UART5 TX DMA channel not defined (DMAMAP_UART5_TX)"
+#endif
+
+#if defined(CONFIG_USART6_TXDMA) && !defined(DMAMAP_USART6_TX)
+#error "USART6 TX DMA channel not defined (DMAMAP_USART6_TX)"
+#endif
+
+#if defined(CONFIG_UART7_TXDMA) && !defined(DMAMAP_UART7_TX)
+#error "UART7 TX DMA channel not defined (DMAMAP_UART7_TX)"
+#endif
+
+#if defined(CONFIG_UART8_TXDMA) && !defined(DMAMAP_UART8_TX)
+#error "UART8 TX DMA channel not defined (DMAMAP_UART8_TX)"
+#endif
+
 #elif defined(CONFIG_STM32_STM32L15XX) || defined(CONFIG_STM32_STM32F10XX) || \
 	  defined(CONFIG_STM32_STM32F30XX)
 
@@ -190,6 +222,11 @@
 #define DMAMAP_USART3_RX  DMACHAN_USART3_RX
 #define DMAMAP_UART4_RX   DMACHAN_UART4_RX
 
+#define DMAMAP_USART1_TX  DMACHAN_USART1_TX
+#define DMAMAP_USART2_TX  DMACHAN_USART2_TX
+#define DMAMAP_USART3_TX  DMACHAN_USART3_TX
+#define DMAMAP_UART4_TX   DMACHAN_UART4_TX
+
 #endif
 
 /* The DMA buffer size when using RX DMA to emulate a FIFO.
@@ -246,6 +283,26 @@
 	 CONFIG_USART_DMAPRIO)
 #endif
 
+/* TX DMA control word, one shot from the TX buffer */
+
+#if defined(CONFIG_STM32_STM32F20XX) || defined(CONFIG_STM32_STM32F40XX)
+#define SERIAL_TXDMA_CONTROL_WORD    \
+	(DMA_SCR_DIR_M2P       | \
+	 DMA_SCR_MINC          | \
+	 DMA_SCR_PSIZE_8BITS   | \
+	 DMA_SCR_MSIZE_8BITS   | \
+	 CONFIG_USART_DMAPRIO  | \
+	 DMA_SCR_PBURST_SINGLE | \
+	 DMA_SCR_MBURST_SINGLE)
+#else
+#define SERIAL_TXDMA_CONTROL_WORD    \
+	(DMA_CCR_DIR           | \
+	 DMA_CCR_MINC          | \
+	 DMA_CCR_PSIZE_8BITS   | \
+	 DMA_CCR_MSIZE_8BITS   | \
+	 CONFIG_USART_DMAPRIO)
+#endif
+
 #endif
 
 #ifdef USE_SERIALDRIVER
@@ -303,6 +360,9 @@ struct up_dev_s {
 #ifdef SERIAL_HAVE_DMA
 	const unsigned int rxdma_channel;	/* DMA channel assigned */
 #endif
+#ifdef SERIAL_HAVE_TXDMA
+	const unsigned int txdma_channel;	/* TX DMA channel assigned */
+#endif
 
 	int (*const vector)(int irq, void *context);	/* Interrupt handler */
 
@@ -315,6 +375,12 @@ struct up_dev_s {
 	char *const rxfifo;			/* Receive DMA buffer */
 #endif
 
+	/* TX DMA state */
+
+#ifdef SERIAL_HAVE_TXDMA
+	DMA_HANDLE txdma;			/* currently-open transmit DMA stream */
+#endif
+
 #ifdef HAVE_RS485
 	const uint32_t rs485_dir_gpio;	/* U[S]ART RS-485 DIR GPIO pin configuration */
 	const bool rs485_dir_polarity;	/* U[S]ART RS-485 DIR pin state for TX enabled */
@@ -354,6 +420,12 @@ static bool up_dma_rxavailable(struct uart_dev_s *dev);
 static void up_dma_rxcallback(DMA_HANDLE handle, uint8_t status, void *arg);
 #endif
 
+#ifdef SERIAL_HAVE_TXDMA
+static void up_dma_send(struct uart_dev_s *dev);
+static void up_dma_txavail(struct uart_dev_s *dev);
+static void up_dma_txcallback(DMA_HANDLE handle, uint8_t status, void *arg);
+#endif
+
 #ifdef CONFIG_PM
 static void up_pm_notify(struct pm_callback_s *cb, enum pm_state_e pmstate);
 static int up_pm_prepare(struct pm_callback_s *cb, enum pm_state_e pmstate);
@@ -428,6 +500,32 @@ static const struct uart_ops_s g_uart_dma_ops = {
 };
 #endif
 
+/* The RX side stays on the DMA FIFO emulation, only TX goes through the
+ * DMA methods of the serial upper half.
+ */
+
+#ifdef SERIAL_HAVE_TXDMA
+static const struct uart_ops_s g_uart_txdma_ops = {
+	.setup = up_dma_setup,
+	.shutdown = up_dma_shutdown,
+	.attach = up_attach,
+	.detach = up_detach,
+	.ioctl = up_ioctl,
+	.receive = up_dma_receive,
+	.rxint = up_dma_rxint,
+	.rxavailable = up_dma_rxavailable,
+#ifdef CONFIG_SERIAL_IFLOWCONTROL
+	.rxflowcontrol = up_rxflowcontrol,
+#endif
+	.send = up_send,
+	.txint = up_txint,
+	.txready = up_txready,
+	.txempty = up_txready,
+	.dmasend = up_dma_send,
+	.dmatxavail = up_dma_txavail,
+};
+#endif
+
 /* I/O buffers */
 
 #ifdef CONFIG_STM32_USART1
@@ -510,7 +608,9 @@ static struct up_dev_s g_usart1priv = {
 			.size = CONFIG_USART1_TXBUFSIZE,
 			.buffer = g_usart1txbuffer,
 		},
-#ifdef CONFIG_USART1_RXDMA
+#if defined(CONFIG_USART1_TXDMA)
+		.ops = &g_uart_txdma_ops,
+#elif defined(CONFIG_USART1_RXDMA)
 		.ops = &g_uart_dma_ops,
 #else
 		.ops = &g_uart_ops,
@@ -538,6 +638,9 @@ static struct up_dev_s g_usart1priv = {
 #ifdef CONFIG_USART1_RXDMA
 	.rxdma_channel = DMAMAP_USART1_RX,
 	.rxfifo = g_usart1rxfifo,
+#endif
+#ifdef CONFIG_USART1_TXDMA
+	.txdma_channel = DMAMAP_USART1_TX,
 #endif
 	.vector = up_interrupt_usart1,
 
@@ -568,7 +671,9 @@ static struct up_dev_s g_usart2priv = {
 			.size = CONFIG_USART2_TXBUFSIZE,
 			.buffer = g_usart2txbuffer,
 		},
-#ifdef CONFIG_USART2_RXDMA
+#if defined(CONFIG_USART2_TXDMA)
+		.ops = &g_uart_txdma_ops,
+#elif defined(CONFIG_USART2_RXDMA)
 		.ops = &g_uart_dma_ops,
 #else
 		.ops = &g_uart_ops,
@@ -596,6 +701,9 @@ static struct up_dev_s g_usart2priv = {
 #ifdef CONFIG_USART2_RXDMA
 	.rxdma_channel = DMAMAP_USART2_RX,
 	.rxfifo = g_usart2rxfifo,
+#endif
+#ifdef CONFIG_USART2_TXDMA
+	.txdma_channel = DMAMAP_USART2_TX,
 #endif
 	.vector = up_interrupt_usart2,
 
@@ -626,7 +734,9 @@ static struct up_dev_s g_usart3priv = {
 			.size = CONFIG_USART3_TXBUFSIZE,
 			.buffer = g_usart3txbuffer,
 		},
-#ifdef CONFIG_USART3_RXDMA
+#if defined(CONFIG_USART3_TXDMA)
+		.ops = &g_uart_txdma_ops,
+#elif defined(CONFIG_USART3_RXDMA)
 		.ops = &g_uart_dma_ops,
 #else
 		.ops = &g_uart_ops,
@@ -654,6 +764,9 @@ static struct up_dev_s g_usart3priv = {
 #ifdef CONFIG_USART3_RXDMA
 	.rxdma_channel = DMAMAP_USART3_RX,
 	.rxfifo = g_usart3rxfifo,
+#endif
+#ifdef CONFIG_USART3_TXDMA
+	.txdma_channel = DMAMAP_USART3_TX,
 #endif
 	.vector = up_interrupt_usart3,
 
@@ -684,7 +797,9 @@ static struct up_dev_s g_uart4priv = {
 			.size = CONFIG_UART4_TXBUFSIZE,
 			.buffer = g_uart4txbuffer,
 		},
-#ifdef CONFIG_UART4_RXDMA
+#if defined(CONFIG_UART4_TXDMA)
+		.ops = &g_uart_txdma_ops,
+#elif defined(CONFIG_UART4_RXDMA)
 		.ops = &g_uart_dma_ops,
 #else
 		.ops = &g_uart_ops,
@@ -716,6 +831,9 @@ static struct up_dev_s g_uart4priv = {
 #ifdef CONFIG_UART4_RXDMA
 	.rxdma_channel = DMAMAP_UART4_RX,
 	.rxfifo = g_uart4rxfifo,
+#endif
+#ifdef CONFIG_UART4_TXDMA
+	.txdma_channel = DMAMAP_UART4_TX,
 #endif
 	.vector = up_interrupt_uart4,
 
@@ -746,7 +864,9 @@ static struct up_dev_s g_uart5priv = {
 			.size = CONFIG_UART5_TXBUFSIZE,
 			.buffer = g_uart5txbuffer,
 		},
-#ifdef CONFIG_UART5_RXDMA
+#if defined(CONFIG_UART5_TXDMA)
+		.ops = &g_uart_txdma_ops,
+#elif defined(CONFIG_UART5_RXDMA)
 		.ops = &g_uart_dma_ops,
 #else
 		.ops = &g_uart_ops,
@@ -778,6 +898,9 @@ static struct up_dev_s g_uart5priv = {
 #ifdef CONFIG_UART5_RXDMA
 	.rxdma_channel = DMAMAP_UART5_RX,
 	.rxfifo = g_uart5rxfifo,
+#endif
+#ifdef CONFIG_UART5_TXDMA
+	.txdma_channel = DMAMAP_UART5_TX,
 #endif
 	.vector = up_interrupt_uart5,
 
@@ -808,7 +931,9 @@ static struct up_dev_s g_usart6priv = {
 			.size = CONFIG_USART6_TXBUFSIZE,
 			.buffer = g_usart6txbuffer,
 		},
-#ifdef CONFIG_USART6_RXDMA
+#if defined(CONFIG_USART6_TXDMA)
+		.ops = &g_uart_txdma_ops,
+#elif defined(CONFIG_USART6_RXDMA)
 		.ops = &g_uart_dma_ops,
 #else
 		.ops = &g_uart_ops,
@@ -836,6 +961,9 @@ static struct up_dev_s g_usart6priv = {
 #ifdef CONFIG_USART6_RXDMA
 	.rxdma_channel = DMAMAP_USART6_RX,
 	.rxfifo = g_usart6rxfifo,
+#endif
+#ifdef CONFIG_USART6_TXDMA
+	.txdma_channel = DMAMAP_USART6_TX,
 #endif
 	.vector = up_interrupt_usart6,
 
@@ -866,7 +994,9 @@ static struct up_dev_s g_uart7priv = {
 			.size = CONFIG_UART7_TXBUFSIZE,
 			.buffer = g_uart7txbuffer,
 		},
-#ifdef CONFIG_UART7_RXDMA
+#if defined(CONFIG_UART7_TXDMA)
+		.ops = &g_uart_txdma_ops,
+#elif defined(CONFIG_UART7_RXDMA)
 		.ops = &g_uart_dma_ops,
 #else
 		.ops = &g_uart_ops,
@@ -894,6 +1024,9 @@ static struct up_dev_s g_uart7priv = {
 #ifdef CONFIG_UART7_RXDMA
 	.rxdma_channel = DMAMAP_UART7_RX,
 	.rxfifo = g_uart7rxfifo,
+#endif
+#ifdef CONFIG_UART7_TXDMA
+	.txdma_channel = DMAMAP_UART7_TX,
 #endif
 	.vector = up_interrupt_uart7,
 
@@ -924,7 +1057,9 @@ static struct up_dev_s g_uart8priv = {
 			.size = CONFIG_UART8_TXBUFSIZE,
 			.buffer = g_uart8txbuffer,
 		},
-#ifdef CONFIG_UART8_RXDMA
+#if defined(CONFIG_UART8_TXDMA)
+		.ops = &g_uart_txdma_ops,
+#elif defined(CONFIG_UART8_RXDMA)
 		.ops = &g_uart_dma_ops,
 #else
 		.ops = &g_uart_ops,
@@ -952,6 +1087,9 @@ static struct up_dev_s g_uart8priv = {
 #ifdef CONFIG_UART8_RXDMA
 	.rxdma_channel = DMAMAP_UART8_RX,
 	.rxfifo = g_uart8rxfifo,
+#endif
+#ifdef CONFIG_UART8_TXDMA
+	.txdma_channel = DMAMAP_UART8_TX,
 #endif
 	.vector = up_interrupt_uart8,
 
@@ -1064,7 +1202,7 @@ static inline void up_disableusartint(struct up_dev_s *priv, uint16_t *ie)
 		 *
 		 * Enable             Status          Meaning                        Usage
 		 * ------------------ --------------- ------------------------------ ----------
-		 * USART_CR1_IDLEIE   USART_SR_IDLE   Idle Line Detected             (not used)
+		 * USART_CR1_IDLEIE   USART_SR_IDLE   Idle Line Detected             (used only for RX DMA)
 		 * USART_CR1_RXNEIE   USART_SR_RXNE   Received Data Ready to be Read
 		 * "              "   USART_SR_ORE    Overrun Error Detected
 		 * USART_CR1_TCIE     USART_SR_TC     Transmission Complete          (used only for RS-485)
@@ -1516,6 +1654,20 @@ static int up_dma_setup(struct uart_dev_s *dev)
 
 	stm32_dmastart(priv->rxdma, up_dma_rxcallback, (void *)priv, true);
 
+#ifdef SERIAL_HAVE_TXDMA
+	/* Acquire the TX DMA channel and enable transmit DMA for the UART.  The
+	 * transfers are started by up_dma_send().
+	 */
+
+	if (uart_txdma(dev)) {
+		priv->txdma = stm32_dmachannel(priv->txdma_channel);
+
+		regval = up_serialin(priv, STM32_USART_CR3_OFFSET);
+		regval |= USART_CR3_DMAT;
+		up_serialout(priv, STM32_USART_CR3_OFFSET, regval);
+	}
+#endif
+
 	return OK;
 }
 #endif
@@ -1604,6 +1756,15 @@ static void up_dma_shutdown(struct uart_dev_s *dev)
 
 	stm32_dmafree(priv->rxdma);
 	priv->rxdma = NULL;
+
+#ifdef SERIAL_HAVE_TXDMA
+	if (priv->txdma != NULL) {
+		stm32_dmastop(priv->txdma);
+		stm32_dmafree(priv->txdma);
+		priv->txdma = NULL;
+		dev->dmatx.length = 0;
+	}
+#endif
 }
 #endif
 
@@ -1690,7 +1851,7 @@ static int up_interrupt_common(struct up_dev_s *priv)
 		 *
 		 * Enable             Status          Meaning                         Usage
 		 * ------------------ --------------- ------------------------------- ----------
-		 * USART_CR1_IDLEIE   USART_SR_IDLE   Idle Line Detected              (not used)
+		 * USART_CR1_IDLEIE   USART_SR_IDLE   Idle Line Detected              (used only for RX DMA)
 		 * USART_CR1_RXNEIE   USART_SR_RXNE   Received Data Ready to be Read
 		 * "              "   USART_SR_ORE    Overrun Error Detected
 		 * USART_CR1_TCIE     USART_SR_TC     Transmission Complete           (used only for RS-485)
@@ -1756,6 +1917,24 @@ static int up_interrupt_common(struct up_dev_s *priv)
 #endif
 		}
 
+#ifdef SERIAL_HAVE_DMA
+		/* The line became idle at the end of a message.  Pass the bytes in the
+		 * RX DMA FIFO to the serial stack now, rather than at the next half or
+		 * full FIFO event.
+		 */
+
+		if ((priv->sr & USART_SR_IDLE) != 0 && (priv->ie & USART_CR1_IDLEIE) != 0) {
+#ifdef CONFIG_STM32_STM32F30XX
+			up_serialout(priv, STM32_USART_ICR_OFFSET, USART_ICR_IDLECF);
+#else
+			/* IDLE is cleared by the read of SR above and then of DR */
+
+			(void)up_serialin(priv, STM32_USART_RDR_OFFSET);
+#endif
+			up_dma_rxcallback(priv->rxdma, 0, priv);
+		}
+#endif
+
 		/* Handle outgoing, transmit bytes */
 
 		if ((priv->sr & USART_SR_TXE) != 0 && (priv->ie & USART_CR1_TXEIE) != 0) {
@@ -2162,16 +2341,24 @@ static int up_dma_receive(struct uart_dev_s *dev, unsigned int *status)
 static void up_dma_rxint(struct uart_dev_s *dev, bool enable)
 {
 	struct up_dev_s *priv = (struct up_dev_s *)dev->priv;
+	irqstate_t flags;
 
 	/* En/disable DMA reception.
 	 *
 	 * Note that it is not safe to check for available bytes and immediately
 	 * pass them to uart_recvchars as that could potentially recurse back
-	 * to us again.  Instead, bytes must wait until the next up_dma_poll or
-	 * DMA event.
+	 * to us again.  Instead, bytes must wait until the next up_dma_poll,
+	 * DMA event or idle line interrupt.
 	 */
 
+	flags = irqsave();
 	priv->rxenable = enable;
+	if (enable) {
+		up_restoreusartint(priv, priv->ie | USART_CR1_IDLEIE);
+	} else {
+		up_restoreusartint(priv, priv->ie & ~USART_CR1_IDLEIE);
+	}
+	irqrestore(flags);
 }
 #endif
 
@@ -2369,6 +2556,66 @@ static void up_dma_rxcallback(DMA_HANDLE handle, uint8_t status, void *arg)
 }
 #endif
 
+/****************************************************************************
+ * Name: up_dma_send
+ *
+ * Description:
+ *   Start the TX DMA transfer of dev->dmatx.  Only the first segment is
+ *   sent, the rest of the buffer goes with the next transfer.
+ *
+ ****************************************************************************/
+
+#ifdef SERIAL_HAVE_TXDMA
+static void up_dma_send(struct uart_dev_s *dev)
+{
+	struct up_dev_s *priv = (struct up_dev_s *)dev->priv;
+
+	stm32_dmasetup(priv->txdma, priv->usartbase + STM32_USART_TDR_OFFSET, (uint32_t)dev->dmatx.buffer, dev->dmatx.length, SERIAL_TXDMA_CONTROL_WORD);
+	stm32_dmastart(priv->txdma, up_dma_txcallback, (void *)priv, false);
+}
+#endif
+
+/****************************************************************************
+ * Name: up_dma_txavail
+ *
+ * Description:
+ *   Start a TX DMA transfer of the new data if none is running.
+ *
+ ****************************************************************************/
+
+#ifdef SERIAL_HAVE_TXDMA
+static void up_dma_txavail(struct uart_dev_s *dev)
+{
+	irqstate_t flags;
+
+	flags = irqsave();
+	if (dev->dmatx.length == 0) {
+		uart_xmitchars_dma(dev);
+	}
+	irqrestore(flags);
+}
+#endif
+
+/****************************************************************************
+ * Name: up_dma_txcallback
+ *
+ * Description:
+ *   The TX DMA transfer completed.  Report it to the serial stack and send
+ *   what was added to the buffer in the meantime.
+ *
+ ****************************************************************************/
+
+#ifdef SERIAL_HAVE_TXDMA
+static void up_dma_txcallback(DMA_HANDLE handle, uint8_t status, void *arg)
+{
+	struct up_dev_s *priv = (struct up_dev_s *)arg;
+
+	priv->dev.dmatx.nbytes = priv->dev.dmatx.length;
+	uart_xmitchars_done(&priv->dev);
+	uart_xmitchars_dma(&priv->dev);
+}
+#endif
+
 /****************************************************************************
  * Name: up_pm_notify
  *
@@ -259,6 +259,40 @@
 #undef CONFIG_UART8_RXDMA
 #endif
 
+/* TX DMA uses the DMA mode of the port */
+
+#ifndef CONFIG_USART1_RXDMA
+#undef CONFIG_USART1_TXDMA
+#endif
+
+#ifndef CONFIG_USART2_RXDMA
+#undef CONFIG_USART2_TXDMA
+#endif
+
+#ifndef CONFIG_USART3_RXDMA
+#undef CONFIG_USART3_TXDMA
+#endif
+
+#ifndef CONFIG_UART4_RXDMA
+#undef CONFIG_UART4_TXDMA
+#endif
+
+#ifndef CONFIG_UART5_RXDMA
+#undef CONFIG_UART5_TXDMA
+#endif
+
+#ifndef CONFIG_USART6_RXDMA
+#undef CONFIG_USART6_TXDMA
+#endif
+
+#ifndef CONFIG_UART7_RXDMA
+#undef CONFIG_UART7_TXDMA
+#endif
+
+#ifndef CONFIG_UART8_RXDMA
+#undef CONFIG_UART8_TXDMA
+#endif
+
 /* Is DMA available on any (enabled) USART? */
 
 #undef SERIAL_HAVE_DMA
@@ -269,6 +303,16 @@
 #define SERIAL_HAVE_DMA 1
 #endif
 
+/* Is TX DMA used on any (enabled) USART? */
+
+#undef SERIAL_HAVE_TXDMA
+#if defined(CONFIG_USART1_TXDMA) || defined(CONFIG_USART2_TXDMA) || \
+	defined(CONFIG_USART3_TXDMA) || defined(CONFIG_UART4_TXDMA)  || \
+	defined(CONFIG_UART5_TXDMA)  || defined(CONFIG_USART6_TXDMA) || \
+	defined(CONFIG_UART7_TXDMA)  || defined(CONFIG_UART8_TXDMA)
+#define SERIAL_HAVE_TXDMA 1
+#endif
+
 /* Is DMA used on the console UART? */
 
 #undef SERIAL_HAVE_CONSOLE_DMA
@@ -320,10 +364,18 @@
 #define HAVE_RS485 1
 #endif
 
+/* The idle line interrupt flushes the RX DMA FIFO at the end of a message */
+
+#ifdef SERIAL_HAVE_DMA
+#define USART_CR1_DMA_INTS     USART_CR1_IDLEIE
+#else
+#define USART_CR1_DMA_INTS     0
+#endif
+
 #ifdef HAVE_RS485
-#define USART_CR1_USED_INTS    (USART_CR1_RXNEIE | USART_CR1_TXEIE | USART_CR1_PEIE | USART_CR1_TCIE)
+#define USART_CR1_USED_INTS    (USART_CR1_RXNEIE | USART_CR1_TXEIE | USART_CR1_PEIE | USART_CR1_TCIE | USART_CR1_DMA_INTS)
 #else
-#define USART_CR1_USED_INTS    (USART_CR1_RXNEIE | USART_CR1_TXEIE | USART_CR1_PEIE)
+#define USART_CR1_USED_INTS    (USART_CR1_RXNEIE | USART_CR1_TXEIE | USART_CR1_PEIE | USART_CR1_DMA_INTS)
 #endif
 
 /************************************************************************************
@@ -53,6 +53,11 @@ static inline void binfmt_set_mpu(struct binary_s *binp)
 	mpu_get_register_config_value(&regs[3], nregion - 2, (uintptr_t)binp->sections[BIN_RO], binp->sizes[BIN_RO], true, false);
 	/* Complete RAM partition will be configured as RW region */
 	mpu_get_register_config_value(&regs[6], nregion - 1, (uintptr_t)binp->sections[BIN_DATA], binp->ramsize, false, false);
+#elif defined(CONFIG_XIP_ELF)
+	/* Text runs from the flash partition, which is RO and executable */
+	mpu_get_register_config_value(&regs[0], nregion - 2, (uintptr_t)binp->flash_region_start, binp->flash_region_end - binp->flash_region_start, true, true);
+	/* RAM partition is RW, and executable only for the functions copied from flash */
+	mpu_get_register_config_value(&regs[3], nregion - 1, (uintptr_t)binp->ram_region_start, binp->ram_region_end - binp->ram_region_start, false, binp->sizes[BIN_RAMTEXT] > 0);
 #else
 	/* Complete RAM partition will be configured as RW region */
 	mpu_get_register_config_value(&regs[0], nregion - 1, (uintptr_t)binp->ramstart, binp->ramsize, false, true);
@@ -112,7 +117,7 @@ void binfmt_arch_deinit_mem_protect(struct binary_s *binp)
 #ifdef CONFIG_SUPPORT_COMMON_BINARY
 	if (binp->islibrary) {
 #if defined(CONFIG_ARM_MPU)
-#ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
+#if defined(CONFIG_OPTIMIZE_APP_RELOAD_TIME) || defined(CONFIG_XIP_ELF)
 		for (int i = 0; i < MPU_REG_NUMBER * NUM_APP_REGIONS; i += MPU_REG_NUMBER) {
 			up_mpu_disable_region(&binp->cmn_mpu_regs[i]);
 		}
@@ -140,6 +140,9 @@ int binfmt_exit(FAR struct binary_s *bin)
 		/* Free the RAM partition into which this app was loaded */
 		kmm_free((void *)bin->ramstart);
 		bin->ramstart = 0;
+#ifdef CONFIG_BINFMT_RELOAD_RO_BACKUP
+		kmm_free(bin->ro_backup);
+#endif
 		kmm_free(bin);
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
 	}
@@ -45,12 +45,95 @@
 #ifdef CONFIG_BINFMT_ENABLE
 
 #include <tinyara/mm/mm.h>
+#ifdef CONFIG_BINFMT_RELOAD_CHECK_RO
+#include <tinyara/arch.h>
+#include <crc32.h>
+#endif
 
 #ifdef CONFIG_SUPPORT_COMMON_BINARY
 struct binary_s *g_lib_binp;
 uint32_t *g_umm_app_id;
 #endif
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BINFMT_RELOAD_CHECK_RO
+static uint32_t binfmt_ro_crc(FAR struct binary_s *bin)
+{
+	uint32_t crc;
+
+	crc = crc32part((FAR const uint8_t *)bin->sections[BIN_TEXT], bin->sizes[BIN_TEXT], 0);
+	return crc32part((FAR const uint8_t *)bin->sections[BIN_RO], bin->sizes[BIN_RO], crc);
+}
+
+/****************************************************************************
+ * Name: binfmt_save_ro
+ *
+ * Description:
+ *   Keep the CRC, and a copy if configured, of the read-only sections of a
+ *   binary just loaded, which include the backup of its data section.
+ *
+ ****************************************************************************/
+
+static void binfmt_save_ro(FAR struct binary_s *bin)
+{
+	bin->ro_crc = binfmt_ro_crc(bin);
+
+#ifdef CONFIG_BINFMT_RELOAD_RO_BACKUP
+	bin->ro_backup = (FAR uint8_t *)kmm_malloc_at(CONFIG_BINFMT_RELOAD_RO_BACKUP_HEAP, bin->sizes[BIN_TEXT] + bin->sizes[BIN_RO]);
+	if (!bin->ro_backup) {
+		/* Corrupted sections are then loaded again from flash */
+
+		berr("[%s] No memory for copy of ro sections (size = %u)\n", bin->bin_name, bin->sizes[BIN_TEXT] + bin->sizes[BIN_RO]);
+		return;
+	}
+
+	memcpy(bin->ro_backup, (FAR const void *)bin->sections[BIN_TEXT], bin->sizes[BIN_TEXT]);
+	memcpy(bin->ro_backup + bin->sizes[BIN_TEXT], (FAR const void *)bin->sections[BIN_RO], bin->sizes[BIN_RO]);
+#endif
+}
+
+/****************************************************************************
+ * Name: binfmt_check_ro
+ *
+ * Description:
+ *   Check the read-only sections of a binary to be reloaded, and restore
+ *   them from their copy when they are corrupted.
+ *
+ * Returned Value:
+ *   OK if the sections can be reused, -EIO if they must be loaded again.
+ *
+ ****************************************************************************/
+
+static int binfmt_check_ro(FAR struct binary_s *bin)
+{
+	if (binfmt_ro_crc(bin) == bin->ro_crc) {
+		return OK;
+	}
+
+	berr("[%s] text or ro section corrupted\n", bin->bin_name);
+
+#ifdef CONFIG_BINFMT_RELOAD_RO_BACKUP
+	if (bin->ro_backup) {
+		memcpy((FAR void *)bin->sections[BIN_TEXT], bin->ro_backup, bin->sizes[BIN_TEXT]);
+		memcpy((FAR void *)bin->sections[BIN_RO], bin->ro_backup + bin->sizes[BIN_TEXT], bin->sizes[BIN_RO]);
+#ifdef CONFIG_ARCH_HAVE_COHERENT_DCACHE
+		up_coherent_dcache(bin->sections[BIN_TEXT], bin->sizes[BIN_TEXT]);
+#endif
+		if (binfmt_ro_crc(bin) == bin->ro_crc) {
+			return OK;
+		}
+
+		berr("[%s] copy of ro sections corrupted\n", bin->bin_name);
+	}
+#endif
+
+	return -EIO;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -101,6 +184,20 @@ int load_binary(int binary_idx, FAR const char *filename, load_attr_t *load_attr
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
 	bin = load_attr->binp;
 
+#ifdef CONFIG_BINFMT_RELOAD_CHECK_RO
+	/* Sections which can not be reused are freed, and the binary is loaded
+	 * from its partition as for the first time.
+	 */
+
+	if (bin && binfmt_check_ro(bin) < 0) {
+		bin->reload = false;
+		binfmt_exit(bin);
+		BIN_LOADINFO(binary_idx) = NULL;
+		load_attr->binp = NULL;
+		bin = NULL;
+	}
+#endif
+
 	/* If we find a non-null value for bin, it means that
 	 * we are in a reload scenario.
 	 */
@@ -137,6 +234,10 @@ int load_binary(int binary_idx, FAR const char *filename, load_attr_t *load_attr
 				bin->filelen = load_attr->bin_size;
 				bin->offset = load_attr->offset;
 				bin->bin_ver = load_attr->bin_ver;
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+				bin->crc_header = load_attr->crc_header;
+				bin->crc_hash = load_attr->crc_hash;
+#endif
 #ifdef CONFIG_HAVE_CXX
 				bin->run_library_ctors = true;
 #endif
@@ -158,6 +259,10 @@ int load_binary(int binary_idx, FAR const char *filename, load_attr_t *load_attr
 				bin->bin_name = load_attr->bin_name;
 #endif
 				bin->ramsize = load_attr->ram_size;
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+				bin->crc_header = load_attr->crc_header;
+				bin->crc_hash = load_attr->crc_hash;
+#endif
 			}
 		}
 
@@ -177,6 +282,9 @@ int load_binary(int binary_idx, FAR const char *filename, load_attr_t *load_attr
 		}
 
 		memcpy((void *)bin->data_backup, (const void *)bin->sections[BIN_DATA], bin->sizes[BIN_DATA]);
+#ifdef CONFIG_BINFMT_RELOAD_CHECK_RO
+		binfmt_save_ro(bin);
+#endif
 	}
 #endif
 
@@ -223,6 +331,11 @@ int load_binary(int binary_idx, FAR const char *filename, load_attr_t *load_attr
 errout_with_unload:
 	(void)unload_module(bin);
 errout_with_bin:
+#ifdef CONFIG_BINFMT_RELOAD_RO_BACKUP
+	if (bin) {
+		kmm_free(bin->ro_backup);
+	}
+#endif
 	kmm_free(bin);
 #ifdef CONFIG_SUPPORT_COMMON_BINARY
 	g_lib_binp = NULL;
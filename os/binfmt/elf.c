@@ -240,6 +240,16 @@ static int elf_loadbinary(FAR struct binary_s *binp)
 		goto errout_with_load;
 	}
 
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+	/* Reject the binary before it starts if its CRC does not match */
+
+	ret = elf_verifycrc(&loadinfo);
+	if (ret != 0) {
+		berr("Failed to verify CRC of program binary: %d\n", ret);
+		goto errout_with_load;
+	}
+#endif
+
 
 	binp->entrypt = (main_t)((uint32_t)loadinfo.binp->sections[BIN_TEXT] + loadinfo.ehdr.e_entry);
 	if (binp->stacksize == 0) {
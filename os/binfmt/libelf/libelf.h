@@ -69,6 +69,34 @@
 #include <tinyara/binary_manager.h>
 #endif
 
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+#ifdef CONFIG_ELF_PREBUILT_SYMHASH
+/* The exported symbols of the common binary, from its ELF_SYMHASH_SECTNAME
+ * section made by tools/mksymhash.py.  Symbols are in the order of their
+ * bucket, those of bucket b are from buckets[b] to buckets[b + 1].
+ */
+
+#define ELF_SYMHASH_SECTNAME ".symhash"
+
+struct elf_symhash_s {
+	uint32_t nbuckets;
+	uint32_t nsyms;
+	FAR const uint32_t *buckets;	/* First symbol of each bucket, then nsyms */
+	FAR const uint32_t *hashes;		/* Hash of each symbol */
+	FAR uint32_t *values;			/* Address of each symbol */
+	FAR uint8_t *data;				/* The section as read */
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+extern struct elf_symhash_s g_elf_libsymhash;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -106,6 +134,23 @@ int elf_verifyheader(FAR const Elf32_Ehdr *header);
 
 int elf_read(FAR struct elf_loadinfo_s *loadinfo, FAR uint8_t *buffer, size_t readsize, off_t offset);
 
+/****************************************************************************
+ * Name: elf_verifycrc
+ *
+ * Description:
+ *   Check the CRC of the binary header and the ELF file, continued over
+ *   the data read by elf_read() while loading.
+ *
+ * Returned Value:
+ *   0 (OK) is returned on success and a negated errno is returned on
+ *   failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+int elf_verifycrc(FAR struct elf_loadinfo_s *loadinfo);
+#endif
+
 /****************************************************************************
  * Name: elf_loadshdrs
  *
@@ -242,6 +287,39 @@ int elf_symvalue(FAR struct elf_loadinfo_s *loadinfo, FAR Elf32_Sym *sym, FAR co
 
 int elf_symname(FAR struct elf_loadinfo_s *loadinfo, FAR const Elf32_Sym *sym);
 
+#ifdef CONFIG_ELF_PREBUILT_SYMHASH
+/****************************************************************************
+ * Name: elf_loadsymhash
+ *
+ * Description:
+ *   Read the exported symbols of the common binary being loaded from its
+ *   ELF_SYMHASH_SECTNAME section to g_elf_libsymhash.
+ *
+ * Returned Value:
+ *   0 (OK) is returned on success and a negated errno is returned on
+ *   failure.
+ *
+ *   ENOENT - The binary has no such section
+ *   EINVAL - The section is corrupted
+ *
+ ****************************************************************************/
+
+int elf_loadsymhash(FAR struct elf_loadinfo_s *loadinfo);
+
+/****************************************************************************
+ * Name: elf_findsymhash
+ *
+ * Description:
+ *   Look up the address of the exported symbol 'name'.
+ *
+ * Returned Value:
+ *   The address of the symbol, or 0 if it is not exported.
+ *
+ ****************************************************************************/
+
+uint32_t elf_findsymhash(FAR const struct elf_symhash_s *symhash, FAR const char *name);
+#endif
+
 /****************************************************************************
  * Name: elf_freebuffers
  *
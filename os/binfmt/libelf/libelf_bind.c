@@ -384,13 +384,32 @@ int elf_bind(FAR struct elf_loadinfo_s *loadinfo, FAR const struct symtab_s *exp
 	elf_readstrtab(loadinfo);
 
 	if (loadinfo->binp->islibrary) {
+#ifdef CONFIG_ELF_PREBUILT_SYMHASH
+		/* The table made at build time saves reading every symbol and
+		 * its name; a binary without it is read as before.
+		 */
+
+		ret = elf_loadsymhash(loadinfo);
+		if (ret == -ENOENT) {
+			ret = export_library_symtab(loadinfo);
+		}
+#else
 		ret = export_library_symtab(loadinfo);
+#endif
 		if (ret < 0) {
 			goto ret_err;
 		}
 	} else {
-		exports = (struct symtab_s *)g_lib_symhash;
-		nexports = g_num_lib_syms;
+#ifdef CONFIG_ELF_PREBUILT_SYMHASH
+		if (g_elf_libsymhash.data != NULL) {
+			exports = (FAR const struct symtab_s *)&g_elf_libsymhash;
+			nexports = g_elf_libsymhash.nsyms;
+		} else
+#endif
+		{
+			exports = (struct symtab_s *)g_lib_symhash;
+			nexports = g_num_lib_syms;
+		}
 	}
 #endif
 
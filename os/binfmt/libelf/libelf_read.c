@@ -66,6 +66,12 @@
 #include <tinyara/fs/fs.h>
 #include <tinyara/binfmt/elf.h>
 
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+#include <crc32.h>
+#include <tinyara/arch.h>
+#include <tinyara/kmalloc.h>
+#endif
+
 #ifdef CONFIG_COMPRESSED_BINARY
 #include <tinyara/binfmt/compression/compress_read.h>
 #endif
@@ -76,6 +82,18 @@
 
 #undef ELF_DUMP_READDATA		/* Define to dump all file data read */
 
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+#ifdef CONFIG_ARCH_CRC32
+#define elf_crc32part(s, l, c)  up_crc32part(s, l, c)
+#else
+#define elf_crc32part(s, l, c)  crc32part(s, l, c)
+#endif
+
+/* Buffer for the parts of the file the loader did not read */
+
+#define ELF_CRC_BUFSIZE         1024
+#endif
+
 /****************************************************************************
  * Private Constant Data
  ****************************************************************************/
@@ -109,23 +127,14 @@ static inline void elf_dumpreaddata(FAR char *buffer, int buflen)
 #endif
 
 /****************************************************************************
- * Public Functions
- ****************************************************************************/
-
-/****************************************************************************
- * Name: elf_read
+ * Name: elf_readdata
  *
  * Description:
- *   Read 'readsize' bytes from the object file at 'offset'.  The data is
- *   read into 'buffer'.
- *
- * Returned Value:
- *   0 (OK) is returned on success and a negated errno is returned on
- *   failure.
+ *   Read 'readsize' bytes from the object file at 'offset'.
  *
  ****************************************************************************/
 
-int elf_read(FAR struct elf_loadinfo_s *loadinfo, FAR uint8_t *buffer, size_t readsize, off_t offset)
+static int elf_readdata(FAR struct elf_loadinfo_s *loadinfo, FAR uint8_t *buffer, size_t readsize, off_t offset)
 {
 	ssize_t nbytes;				/* Number of bytes read */
 #if !defined(CONFIG_COMPRESSED_BINARY)
@@ -182,3 +191,187 @@ int elf_read(FAR struct elf_loadinfo_s *loadinfo, FAR uint8_t *buffer, size_t re
 	elf_dumpreaddata(buffer, readsize);
 	return OK;
 }
+
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+/****************************************************************************
+ * Name: elf_mergecrc
+ *
+ * Description:
+ *   Merge the part 'idx' of the file with the next one when they meet.
+ *
+ ****************************************************************************/
+
+static void elf_mergecrc(FAR struct elf_loadinfo_s *loadinfo, int idx)
+{
+	FAR struct elf_crcseg_s *seg = &loadinfo->crcseg[idx];
+
+	if (idx + 1 >= loadinfo->ncrcseg || seg->end != seg[1].start) {
+		return;
+	}
+
+	seg->crc = crc32combine(seg->crc, seg[1].crc, seg[1].end - seg[1].start);
+	seg->end = seg[1].end;
+	loadinfo->ncrcseg--;
+	memmove(&seg[1], &seg[2], (loadinfo->ncrcseg - idx - 1) * sizeof(struct elf_crcseg_s));
+}
+
+/****************************************************************************
+ * Name: elf_updatecrc
+ *
+ * Description:
+ *   Add the data read at 'offset' of the file to the CRC of the part of
+ *   the file it continues, or start a new part with it.  Bytes already in
+ *   a part are not added again.  When all parts are in use, the data is
+ *   dropped and elf_verifycrc() reads it again.
+ *
+ ****************************************************************************/
+
+static void elf_updatecrc(FAR struct elf_loadinfo_s *loadinfo, FAR const uint8_t *buffer, size_t readsize, off_t offset)
+{
+	FAR struct elf_crcseg_s *seg;
+	off_t end = offset + readsize;
+	off_t limit;
+	int i;
+
+	for (i = 0; i < loadinfo->ncrcseg; i++) {
+		seg = &loadinfo->crcseg[i];
+		if (offset < seg->start) {
+			break;
+		}
+		if (offset <= seg->end) {
+			/* Continue this part up to the next one */
+
+			limit = i + 1 < loadinfo->ncrcseg ? seg[1].start : loadinfo->filelen;
+			end = end < limit ? end : limit;
+			if (end > seg->end) {
+				seg->crc = elf_crc32part(buffer + (seg->end - offset), end - seg->end, seg->crc);
+				seg->end = end;
+				elf_mergecrc(loadinfo, i);
+			}
+			return;
+		}
+	}
+
+	if (loadinfo->ncrcseg == ELF_CRC_NSEGMENTS) {
+		return;
+	}
+
+	limit = i < loadinfo->ncrcseg ? loadinfo->crcseg[i].start : loadinfo->filelen;
+	end = end < limit ? end : limit;
+	if (end <= offset) {
+		return;
+	}
+
+	seg = &loadinfo->crcseg[i];
+	memmove(&seg[1], seg, (loadinfo->ncrcseg - i) * sizeof(struct elf_crcseg_s));
+	loadinfo->ncrcseg++;
+	seg->start = offset;
+	seg->end = end;
+	seg->crc = elf_crc32part(buffer, end - offset, 0);
+	elf_mergecrc(loadinfo, i);
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: elf_read
+ *
+ * Description:
+ *   Read 'readsize' bytes from the object file at 'offset'.  The data is
+ *   read into 'buffer'.  With CONFIG_ELF_CRC_ON_LOAD, it is added to the
+ *   CRC checked by elf_verifycrc().
+ *
+ * Returned Value:
+ *   0 (OK) is returned on success and a negated errno is returned on
+ *   failure.
+ *
+ ****************************************************************************/
+
+int elf_read(FAR struct elf_loadinfo_s *loadinfo, FAR uint8_t *buffer, size_t readsize, off_t offset)
+{
+	int ret;
+
+	ret = elf_readdata(loadinfo, buffer, readsize, offset);
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+	if (ret == OK) {
+		elf_updatecrc(loadinfo, buffer, readsize, offset);
+	}
+#endif
+	return ret;
+}
+
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+/****************************************************************************
+ * Name: elf_verifycrc
+ *
+ * Description:
+ *   Check the CRC of the header and the whole file against the one of the
+ *   binary header.  The parts of the file read by the loader are combined
+ *   in order with the parts it did not read, which are read here.
+ *
+ * Returned Value:
+ *   0 (OK) is returned on success and a negated errno is returned on
+ *   failure.
+ *
+ *   -EINVAL : The CRC does not match
+ *
+ ****************************************************************************/
+
+int elf_verifycrc(FAR struct elf_loadinfo_s *loadinfo)
+{
+	FAR struct elf_crcseg_s *seg;
+	FAR uint8_t *buffer;
+	uint32_t crc;
+	off_t pos;
+	off_t end;
+	size_t readsize;
+	int ret;
+	int i;
+
+	buffer = (FAR uint8_t *)kmm_malloc(ELF_CRC_BUFSIZE);
+	if (!buffer) {
+		berr("Failed to allocate buffer for CRC\n");
+		return -ENOMEM;
+	}
+
+	crc = loadinfo->binp->crc_header;
+	pos = 0;
+	for (i = 0; i <= loadinfo->ncrcseg; i++) {
+		seg = &loadinfo->crcseg[i];
+		end = i < loadinfo->ncrcseg ? seg->start : loadinfo->filelen;
+
+		/* Read the bytes before this part */
+
+		while (pos < end) {
+			readsize = end - pos < ELF_CRC_BUFSIZE ? end - pos : ELF_CRC_BUFSIZE;
+			ret = elf_readdata(loadinfo, buffer, readsize, pos);
+			if (ret < 0) {
+				goto errout;
+			}
+			crc = elf_crc32part(buffer, readsize, crc);
+			pos += readsize;
+		}
+
+		if (i < loadinfo->ncrcseg) {
+			crc = crc32combine(crc, seg->crc, seg->end - seg->start);
+			pos = seg->end;
+		}
+	}
+
+	binfo("CRC of %d parts read while loading\n", loadinfo->ncrcseg);
+
+	if (crc != loadinfo->binp->crc_hash) {
+		berr("CRC mismatch : %u != %u\n", crc, loadinfo->binp->crc_hash);
+		ret = -EINVAL;
+	} else {
+		ret = OK;
+	}
+
+errout:
+	kmm_free(buffer);
+	return ret;
+}
+#endif
@@ -333,7 +333,14 @@ int elf_symvalue(FAR struct elf_loadinfo_s *loadinfo, FAR Elf32_Sym *sym, FAR co
 			return -ENOENT;
 		}
 
-		sym->st_value = (uint32_t)hashmap_get((struct hashmap_s *)exports, hashmap_get_hashval(loadinfo->iobuffer));
+#ifdef CONFIG_ELF_PREBUILT_SYMHASH
+		if (exports == (FAR const struct symtab_s *)&g_elf_libsymhash) {
+			sym->st_value = elf_findsymhash(&g_elf_libsymhash, (FAR const char *)loadinfo->iobuffer);
+		} else
+#endif
+		{
+			sym->st_value = (uint32_t)hashmap_get((struct hashmap_s *)exports, hashmap_get_hashval(loadinfo->iobuffer));
+		}
 
 		if (!sym->st_value) {
 			berr("SHN_UNDEF: Exported symbol \"%s\" not found\n", loadinfo->iobuffer);
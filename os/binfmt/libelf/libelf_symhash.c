@@ -0,0 +1,200 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/binfmt/elf.h>
+#include <tinyara/kmalloc.h>
+
+#include "libelf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Layout of the section, in little-endian words:
+ *
+ *   magic, nbuckets, nsyms
+ *   buckets[nbuckets + 1] - index of the first symbol of each bucket, the
+ *                           last one is nsyms
+ *   hashes[nsyms]      - hash of each symbol
+ *   values[nsyms]      - value of the symbol in its section
+ *   shndx[nsyms]       - section of the symbol, in half-words
+ */
+
+#define ELF_SYMHASH_MAGIC   0x484d5953	/* "SYMH" */
+#define ELF_SYMHASH_HDRLEN  (3 * sizeof(uint32_t))
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+struct elf_symhash_s g_elf_libsymhash;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* The hash of the GNU hash section, also that of hashmap_get_hashval() */
+
+static uint32_t elf_symhash_hash(FAR const char *name)
+{
+	FAR const uint8_t *ptr = (FAR const uint8_t *)name;
+	uint32_t hash = 5381;
+
+	while (*ptr != '\0') {
+		hash = (hash << 5) + hash + *ptr++;
+	}
+
+	return hash;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: elf_loadsymhash
+ ****************************************************************************/
+
+int elf_loadsymhash(FAR struct elf_loadinfo_s *loadinfo)
+{
+	FAR struct elf_symhash_s *symhash = &g_elf_libsymhash;
+	FAR const Elf32_Shdr *shdr;
+	FAR const uint32_t *words;
+	FAR const uint16_t *shndx;
+	uint32_t nbuckets;
+	uint32_t nsyms;
+	uint32_t i;
+	int ret;
+
+	/* A reloaded common binary replaces the symbols of the previous one */
+
+	if (symhash->data != NULL) {
+		kmm_free(symhash->data);
+		memset(symhash, 0, sizeof(struct elf_symhash_s));
+	}
+
+	ret = elf_findsection(loadinfo, ELF_SYMHASH_SECTNAME);
+	if (ret < 0) {
+		return ret;
+	}
+
+	shdr = &loadinfo->shdr[ret];
+	if (shdr->sh_size < ELF_SYMHASH_HDRLEN) {
+		berr("ERROR: %s too small: %u\n", ELF_SYMHASH_SECTNAME, shdr->sh_size);
+		return -EINVAL;
+	}
+
+	symhash->data = (FAR uint8_t *)kmm_malloc(shdr->sh_size);
+	if (!symhash->data) {
+		berr("ERROR: Failed to allocate %s: %u\n", ELF_SYMHASH_SECTNAME, shdr->sh_size);
+		return -ENOMEM;
+	}
+
+	ret = elf_read(loadinfo, symhash->data, shdr->sh_size, shdr->sh_offset);
+	if (ret < 0) {
+		berr("ERROR: Failed to read %s: %d\n", ELF_SYMHASH_SECTNAME, ret);
+		goto errout;
+	}
+
+	/* Check the sizes before any index of the section is used */
+
+	ret = -EINVAL;
+	words = (FAR const uint32_t *)symhash->data;
+	nbuckets = words[1];
+	nsyms = words[2];
+	if (words[0] != ELF_SYMHASH_MAGIC || nbuckets == 0 || nbuckets >= shdr->sh_size / 4 || nsyms > shdr->sh_size / 10 || ELF_SYMHASH_HDRLEN + 4 * (nbuckets + 1) + 10 * nsyms > shdr->sh_size) {
+		berr("ERROR: Bad %s\n", ELF_SYMHASH_SECTNAME);
+		goto errout;
+	}
+
+	symhash->nbuckets = nbuckets;
+	symhash->nsyms = nsyms;
+	symhash->buckets = &words[3];
+	symhash->hashes = &words[4 + nbuckets];
+	symhash->values = (FAR uint32_t *)&words[4 + nbuckets + nsyms];
+	shndx = (FAR const uint16_t *)&words[4 + nbuckets + 2 * nsyms];
+
+	for (i = 0; i < nbuckets; i++) {
+		if (symhash->buckets[i] > symhash->buckets[i + 1] || symhash->buckets[i + 1] > nsyms) {
+			berr("ERROR: Bad bucket %u of %s\n", i, ELF_SYMHASH_SECTNAME);
+			goto errout;
+		}
+	}
+
+	/* Relocate the values to the sections as loaded, as elf_symvalue()
+	 * does for the symbols of the symbol table.
+	 */
+
+	for (i = 0; i < nsyms; i++) {
+		if (shndx[i] == SHN_ABS) {
+			continue;
+		}
+
+		if (shndx[i] == SHN_UNDEF || shndx[i] >= loadinfo->ehdr.e_shnum) {
+			berr("ERROR: Bad section %u of symbol %u in %s\n", shndx[i], i, ELF_SYMHASH_SECTNAME);
+			goto errout;
+		}
+
+		symhash->values[i] += loadinfo->shdr[shndx[i]].sh_addr;
+	}
+
+	binfo("Exported symbols = %u in %u buckets\n", nsyms, nbuckets);
+	return OK;
+
+errout:
+	kmm_free(symhash->data);
+	memset(symhash, 0, sizeof(struct elf_symhash_s));
+	return ret;
+}
+
+/****************************************************************************
+ * Name: elf_findsymhash
+ ****************************************************************************/
+
+uint32_t elf_findsymhash(FAR const struct elf_symhash_s *symhash, FAR const char *name)
+{
+	uint32_t bucket;
+	uint32_t hash;
+	uint32_t i;
+
+	hash = elf_symhash_hash(name);
+	bucket = hash % symhash->nbuckets;
+
+	/* Names are not kept.  The tool fails on two names with the same hash,
+	 * so that a hash names one symbol.
+	 */
+
+	for (i = symhash->buckets[bucket]; i < symhash->buckets[bucket + 1]; i++) {
+		if (symhash->hashes[i] == hash) {
+			return symhash->values[i];
+		}
+	}
+
+	return 0;
+}
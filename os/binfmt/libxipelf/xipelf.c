@@ -113,23 +113,33 @@ static int xipelf_loadbinary(FAR struct binary_s *binp)
 	binp->register_exidx = uspace.register_exidx;
 #endif
 
-	/* zero out the bss... */
-	for (uint8_t *bss = uspace.bss_start; bss < (uint8_t *)uspace.bss_end; bss++) {
-		*bss = 0x00;
-	}
+	/* Text stays in flash, only bss, data and hot functions take ram */
 
+	/* zero out the bss... */
 	binp->sections[BIN_BSS] = (uint32_t)uspace.bss_start;
 	binp->sizes[BIN_BSS] = uspace.bss_end - uspace.bss_start;
+	memset(uspace.bss_start, 0, binp->sizes[BIN_BSS]);
 
 	/* copy the data... */
-	uint8_t *orig_data = uspace.data_start_in_flash;
-	for (uint8_t *data = uspace.data_start_in_ram; data < (uint8_t *)uspace.data_end_in_ram; data++) {
-		*data = *orig_data;
-		orig_data++;
-	}
-	
 	binp->sections[BIN_DATA] = (uint32_t)uspace.data_start_in_ram;
 	binp->sizes[BIN_DATA] = uspace.data_end_in_ram - uspace.data_start_in_ram;
+	memcpy(uspace.data_start_in_ram, uspace.data_start_in_flash, binp->sizes[BIN_DATA]);
+
+	/* copy the hot functions, which are linked to run from ram */
+#ifdef CONFIG_XIP_ELF_RAMTEXT
+	binp->sections[BIN_RAMTEXT] = (uint32_t)uspace.ramtext_start_in_ram;
+	binp->sizes[BIN_RAMTEXT] = uspace.ramtext_end_in_ram - uspace.ramtext_start_in_ram;
+	if (binp->sizes[BIN_RAMTEXT] > 0) {
+		memcpy(uspace.ramtext_start_in_ram, uspace.ramtext_start_in_flash, binp->sizes[BIN_RAMTEXT]);
+#ifdef CONFIG_ARCH_HAVE_COHERENT_DCACHE
+		up_coherent_dcache(binp->sections[BIN_RAMTEXT], binp->sizes[BIN_RAMTEXT]);
+#endif
+		binfo("[%s] ramtext start addr =  0x%x  size = %u\n", binp->bin_name, binp->sections[BIN_RAMTEXT], binp->sizes[BIN_RAMTEXT]);
+	}
+#else
+	binp->sections[BIN_RAMTEXT] = 0;
+	binp->sizes[BIN_RAMTEXT] = 0;
+#endif
 
 	/* all the required setup is done, lets just populate them in binp structure */
 
@@ -61,6 +61,7 @@
 
 #include <tinyara/gpio.h>
 #include <tinyara/board.h>
+#include <tinyara/drvinit.h>
 #ifdef CONFIG_HWCONFIG
 #include <tinyara/prodconfig.h>
 #include <sys/types.h>
@@ -166,9 +167,11 @@ static void board_spi_initialize(void)
  * Name: board_audio_initialize
  *
  * Description:
- *  Initialize all audio related
+ *  Initialize all audio related.  The codec scripts are long, so this is
+ *  deferred to the init workers with CONFIG_DRIVER_DEFERRED_INIT; opens of
+ *  the pcm devices wait for it.
  ****************************************************************************/
-static void board_audio_initialize(void)
+static int board_audio_initialize(void)
 {
 #if defined(CONFIG_AUDIO_ALC5658)
 	s5j_alc5658_initialize(0);
@@ -178,8 +181,19 @@ static void board_audio_initialize(void)
 	alc5658_i2c_initialize();
 	i2schar_devinit();
 #endif
+	return OK;
 }
 
+static struct drvinit_s g_audio_drvinit = {
+	.name = "audio",
+#if defined(CONFIG_AUDIO_I2SCHAR) && !defined(CONFIG_AUDIO_ALC5658) && !defined(CONFIG_AUDIO_ALC5658CHAR)
+	.path = "/dev/i2schar0",
+#else
+	.path = "/dev/pcmC0",
+#endif
+	.init = board_audio_initialize,
+};
+
 static void board_wdt_initialize(void)
 {
 #ifdef CONFIG_S5J_WATCHDOG
@@ -310,7 +324,7 @@ void board_initialize(void)
 	board_gpio_initialize();
 	board_i2c_initialize();
 	board_spi_initialize();
-	board_audio_initialize();
+	drvinit_register(&g_audio_drvinit);
 	board_sensor_initialize();
 	board_wdt_initialize();
 
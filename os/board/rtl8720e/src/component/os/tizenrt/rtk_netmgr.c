@@ -494,6 +494,11 @@ trwifi_result_e wifi_netmgr_utils_connect_ap(struct netdev *dev, trwifi_ap_confi
 	}
 
 	ap_channel = 0xffff;
+	/* channel the AP was last found on, known by the caller. The scan list
+	 * below is more recent if it has the AP */
+	if (ap_connect_config->channel != 0) {
+		ap_channel = ap_connect_config->channel;
+	}
 
 	rtw_mutex_get(&scanlistbusy);
 	if (scan_number) {
@@ -394,6 +394,46 @@ trble_result_e rtw_ble_client_conn_param_update(trble_conn_handle *conn_handle,
 	return TRBLE_SUCCESS; 
 }
 
+trble_result_e rtw_ble_set_data_len(trble_data_len *data_len)
+{
+#if defined(RTK_BLE_4_2_DATA_LEN_EXT_SUPPORT) && RTK_BLE_4_2_DATA_LEN_EXT_SUPPORT
+	rtk_bt_le_set_datalen_param_t param;
+
+	param.conn_handle = data_len->conn_handle;
+	param.max_tx_octets = data_len->tx_octets;
+	param.max_tx_time = data_len->tx_time;
+
+	if (rtk_bt_le_gap_set_data_len(&param) != RTK_BT_OK) {
+		dbg("set data len fail \n");
+		return TRBLE_FAIL;
+	}
+	return TRBLE_SUCCESS;
+#else
+	return TRBLE_UNSUPPORTED;
+#endif
+}
+
+trble_result_e rtw_ble_set_phy(trble_phy *phy)
+{
+#if defined(RTK_BLE_5_0_SET_PHYS_SUPPORT) && RTK_BLE_5_0_SET_PHYS_SUPPORT
+	rtk_bt_le_set_phy_param_t param;
+
+	param.conn_handle = phy->conn_handle;
+	param.all_phys = 0;
+	param.tx_phys = phy->tx_phys;
+	param.rx_phys = phy->rx_phys;
+	param.phy_options = 0;
+
+	if (rtk_bt_le_gap_set_phy(&param) != RTK_BT_OK) {
+		dbg("set phy fail \n");
+		return TRBLE_FAIL;
+	}
+	return TRBLE_SUCCESS;
+#else
+	return TRBLE_UNSUPPORTED;
+#endif
+}
+
 trble_result_e rtw_ble_client_read_connected_device_list(trble_connected_list* out_connected_list)
 { 
     if (out_connected_list == NULL)
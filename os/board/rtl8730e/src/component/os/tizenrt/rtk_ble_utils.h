@@ -27,6 +27,8 @@ extern trble_result_e rtw_ble_combo_set_server_config(trble_server_init_config*
 #elif defined(CONFIG_AMEBALITE_BLE_CENTRAL)
 extern trble_result_e rtw_ble_client_init(trble_client_init_config* init_parm);
 extern trble_result_e rtw_ble_client_deinit(void);
+extern trble_result_e rtw_ble_set_data_len(trble_data_len *data_len);
+extern trble_result_e rtw_ble_set_phy(trble_phy *phy);
 #elif defined(CONFIG_AMEBALITE_BLE_PERIPHERAL)
 extern trble_result_e rtw_ble_server_init(trble_server_init_config* init_parm);
 extern trble_result_e rtw_ble_server_deinit(void);
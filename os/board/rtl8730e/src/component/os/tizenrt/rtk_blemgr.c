@@ -351,6 +351,11 @@ trble_result_e trble_netmgr_ioctl(struct bledev *dev, trble_msg_s *msg)
 		// temporary remove
 		// ret = rtw_ble_get_version(version);
 	}
+	else if (msg->cmd == TRBLE_MSG_SET_DATA_LEN) {
+		ret = rtw_ble_set_data_len((trble_data_len *)msg->data);
+	} else if (msg->cmd == TRBLE_MSG_SET_PHY) {
+		ret = rtw_ble_set_phy((trble_phy *)msg->data);
+	}
 	return ret;
 }
 
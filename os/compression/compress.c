@@ -20,6 +20,7 @@
  * Included Files
  ****************************************************************************/
 #include <tinyara/config.h>
+#include <tinyara/kmalloc.h>
 #include <sys/types.h>
 #include <debug.h>
 #include <errno.h>
@@ -31,10 +32,46 @@
 #include <tinyara/lzma/LzmaLib.h>
 #elif CONFIG_COMPRESSION_TYPE == MINIZ
 #include <miniz/miniz.h>
+#elif CONFIG_COMPRESSION_TYPE == LZ4
+#include <tinyara/lz4/lz4.h>
 #else
 #error "Wrong compression type, please check CONFIG_COMPRESSION_TYPE"
 #endif
 
+#if defined(CONFIG_COMPRESSION_LZ4) && CONFIG_COMPRESSION_TYPE != LZ4
+#include <tinyara/lz4/lz4.h>
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+#if defined(CONFIG_COMPRESSION_LZ4) || CONFIG_COMPRESSION_TYPE == LZ4
+/****************************************************************************
+ * Name: decompress_block_lz4
+ *
+ * Description:
+ *   Decompress LZ4 block in 'read_buffer' of size into 'out_buffer' of
+ *   writesize, and set writesize to the decompressed size
+ ****************************************************************************/
+static int decompress_block_lz4(unsigned char *out_buffer, long unsigned int *writesize, unsigned char *read_buffer, long unsigned int *size)
+{
+	int ret;
+
+	ret = lz4_decompress_block(read_buffer, *size, out_buffer, *writesize);
+	if (ret < 0) {
+		bcmpdbg("Failure to decompress LZ4 block of size %lu\n", *size);
+		return -EINVAL;
+	}
+	*writesize = ret;
+
+	return OK;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
 /****************************************************************************
  * Name: allocate compress buffer
  *
@@ -50,6 +87,9 @@ unsigned char *allocate_compress_buffer(int offset, unsigned int size)
 
 #if CONFIG_COMPRESSION_TYPE == LZMA
 	propsSize = LZMA_PROPS_SIZE;
+#elif CONFIG_COMPRESSION_TYPE == LZ4
+	/* Data which does not compress grows a little */
+	propsSize = LZ4_COMPRESSBOUND(size) - size;
 #endif
 
 	unsigned char *out_buffer = (unsigned char *)kmm_malloc(size + propsSize + offset);
@@ -83,6 +123,19 @@ int compress_block(unsigned char *out_buffer, long unsigned int *writesize, unsi
 		if (ret > 0)
 			ret = -ret;
 	}
+#elif CONFIG_COMPRESSION_TYPE == LZ4
+	void *state = kmm_malloc(LZ4_STATE_SIZE);
+	if (state == NULL) {
+		return -ENOMEM;
+	}
+	ret = lz4_compress_block(read_buffer, size, out_buffer, *writesize, state);
+	kmm_free(state);
+	if (ret < 0) {
+		dbg("Failure to compress with LZ4, out buffer of %lu too small\n", *writesize);
+		return -ENOMEM;
+	}
+	*writesize = ret;
+	ret = OK;
 #endif
 	return ret;
 }
@@ -129,6 +182,33 @@ int decompress_block(unsigned char *out_buffer, long unsigned int *writesize, un
 			ret = ENOMEM;
 		}
 	}	
+#elif CONFIG_COMPRESSION_TYPE == LZ4
+	ret = decompress_block_lz4(out_buffer, writesize, read_buffer, size);
 #endif
 	return ret;
 }
+
+/****************************************************************************
+ * Name: decompress_block_format
+ *
+ * Description:
+ *   Decompress block in 'read_buffer' with the decompressor of 'format'
+ *
+ * Returned Value:
+ *   Non-negative value on Success.
+ *   Negative value on Failure.
+ ****************************************************************************/
+int decompress_block_format(int format, unsigned char *out_buffer, long unsigned int *writesize, unsigned char *read_buffer, long unsigned int *size)
+{
+	if (format == CONFIG_COMPRESSION_TYPE) {
+		return decompress_block(out_buffer, writesize, read_buffer, size);
+	}
+#ifdef CONFIG_COMPRESSION_LZ4
+	if (format == COMPRESSION_TYPE_LZ4) {
+		return decompress_block_lz4(out_buffer, writesize, read_buffer, size);
+	}
+#endif
+
+	bcmpdbg("Compression format %d not supported\n", format);
+	return -ENOTSUP;
+}
@@ -23,12 +23,16 @@
 #include <tinyara/kmalloc.h>
 #include <sys/types.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <unistd.h>
 #include <string.h>
 #include <debug.h>
 #include <errno.h>
+#include <sched.h>
+#include <semaphore.h>
 
 #include <tinyara/fs/fs.h>
+#include <tinyara/kthread.h>
 #include <tinyara/binfmt/compression/compress_read.h>
 
 #if CONFIG_COMPRESSION_TYPE == LZMA
@@ -36,6 +40,9 @@
 #elif CONFIG_COMPRESSION_TYPE == MINIZ
 #include <miniz/miniz.h>
 #endif
+#if defined(CONFIG_COMPRESSION_LZ4) || CONFIG_COMPRESSION_TYPE == LZ4
+#include <tinyara/lz4/lz4.h>
+#endif
 
 /****************************************************************************
  * Private Declarations
@@ -44,6 +51,35 @@
 static struct s_header *compression_header;
 static struct s_buffer buffers;
 
+/* Blocks of one compress_read(), which the caller and the helper thread
+ * take one after the other.
+ */
+struct compress_job_s {
+	int filfd;
+	uint16_t binary_header_size;
+	FAR uint8_t *buffer;
+	off_t offset;
+	off_t end;					/* Offset after the last byte to read */
+	int next_block;
+	int last_block;
+	int result;					/* OK, or the first error */
+};
+
+static struct compress_job_s compress_job;
+
+#ifdef CONFIG_COMPRESSION_PIPELINE
+/* While a thread decompresses a block, the other one reads the next block
+ * from the file, and decompresses it on another CPU with SMP.
+ */
+static struct s_buffer helper_buffers;
+static sem_t compress_job_lock = SEM_INITIALIZER(1);
+static sem_t compress_file_lock = SEM_INITIALIZER(1);
+static sem_t compress_helper_start = SEM_INITIALIZER(0);
+static sem_t compress_helper_done = SEM_INITIALIZER(0);
+static pid_t compress_helper_pid = -1;
+static volatile bool compress_helper_exit;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -230,6 +266,209 @@ static off_t compress_read_block(int filfd, uint16_t binary_header_size, FAR uin
 	return nbytes;
 }
 
+/****************************************************************************
+ * Name: compress_lock / compress_unlock
+ ****************************************************************************/
+#ifdef CONFIG_COMPRESSION_PIPELINE
+static void compress_lock(FAR sem_t *sem)
+{
+	while (sem_wait(sem) < 0) {
+		DEBUGASSERT(get_errno() == EINTR);
+	}
+}
+
+static void compress_unlock(FAR sem_t *sem)
+{
+	sem_post(sem);
+}
+#else
+#define compress_lock(sem)
+#define compress_unlock(sem)
+#endif
+
+/****************************************************************************
+ * Name: compress_job_block
+ *
+ * Description:
+ *   Read and decompress 'index' block of the job, then write its part in
+ *   the buffer of the job.  A block entirely in the buffer is decompressed
+ *   right into it, without going through out_buffer of 'bufs'.
+ *
+ * Returned Value:
+ *   OK (0) on Success
+ *   Negative value on Failure
+ ****************************************************************************/
+static int compress_job_block(FAR struct s_buffer *bufs, int index)
+{
+	FAR struct compress_job_s *job = &compress_job;
+	off_t block_start;
+	off_t block_end;
+	off_t copy_start;
+	off_t copy_end;
+	int block_readsize;
+	int ret;
+	FAR uint8_t *out;
+	long unsigned int writesize;
+	long unsigned int size;
+
+	block_start = (off_t)index * compression_header->blocksize;
+	block_end = block_start + compression_header->blocksize;
+	if (block_end > compression_header->binary_size) {
+		block_end = compression_header->binary_size;
+	}
+	copy_start = block_start > job->offset ? block_start : job->offset;
+	copy_end = block_end < job->end ? block_end : job->end;
+
+	/* Read compressed 'index' block into read_buffer, one thread at a time */
+	compress_lock(&compress_file_lock);
+	block_readsize = compress_read_block(job->filfd, job->binary_header_size, bufs->read_buffer, index);
+	compress_unlock(&compress_file_lock);
+	if (block_readsize < 0) {
+		bcmpdbg("Read for compressed block %d failed\n", index);
+		return block_readsize;
+	}
+
+	if (copy_start == block_start && copy_end == block_end) {
+		out = &job->buffer[block_start - job->offset];
+		writesize = block_end - block_start;
+	} else {
+		out = bufs->out_buffer;
+		writesize = compression_header->blocksize;
+	}
+	size = block_readsize;
+
+	/* Decompress block in read_buffer */
+	ret = decompress_block_format(compression_header->compression_format, out, &writesize, bufs->read_buffer, &size);
+	if (ret < 0) {
+		bcmpdbg("Failed to decompress %d block of this binary\n", index);
+		return ret;
+	}
+
+	if (out == bufs->out_buffer) {
+		memcpy(&job->buffer[copy_start - job->offset], &bufs->out_buffer[copy_start - block_start], copy_end - copy_start);
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: compress_job_run
+ *
+ * Description:
+ *   Take the blocks of the job one by one until there are no more, or one
+ *   of them failed.
+ ****************************************************************************/
+static void compress_job_run(FAR struct s_buffer *bufs)
+{
+	int index;
+	int ret;
+
+	while (true) {
+		compress_lock(&compress_job_lock);
+		index = compress_job.next_block++;
+		ret = compress_job.result;
+		compress_unlock(&compress_job_lock);
+
+		if (index > compress_job.last_block || ret < 0) {
+			break;
+		}
+
+		ret = compress_job_block(bufs, index);
+		if (ret < 0) {
+			compress_lock(&compress_job_lock);
+			if (compress_job.result == OK) {
+				compress_job.result = ret;
+			}
+			compress_unlock(&compress_job_lock);
+		}
+	}
+}
+
+#ifdef CONFIG_COMPRESSION_PIPELINE
+/****************************************************************************
+ * Name: compress_helper
+ *
+ * Description:
+ *   Thread taking blocks of the jobs along with the callers of
+ *   compress_read(), from compress_init() to compress_uninit().
+ ****************************************************************************/
+static int compress_helper(int argc, char *argv[])
+{
+	while (true) {
+		compress_lock(&compress_helper_start);
+		if (compress_helper_exit) {
+			break;
+		}
+		compress_job_run(&helper_buffers);
+		sem_post(&compress_helper_done);
+	}
+
+	sem_post(&compress_helper_done);
+	return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: compress_alloc_buffers
+ *
+ * Description:
+ *   Allocate the read and out buffers of a thread decompressing blocks
+ ****************************************************************************/
+static int compress_alloc_buffers(FAR struct s_buffer *bufs)
+{
+	size_t readsize;
+
+	/* The format is the one of the binary, which may differ from the type built */
+	switch (compression_header->compression_format) {
+#if CONFIG_COMPRESSION_TYPE == LZMA
+	case COMPRESSION_TYPE_LZMA:
+		readsize = compression_header->blocksize + LZMA_PROPS_SIZE;
+		break;
+#elif CONFIG_COMPRESSION_TYPE == MINIZ
+	case COMPRESSION_TYPE_MINIZ:
+		readsize = compressBound(compression_header->blocksize);
+		break;
+#endif
+#if defined(CONFIG_COMPRESSION_LZ4) || CONFIG_COMPRESSION_TYPE == LZ4
+	case COMPRESSION_TYPE_LZ4:
+		readsize = LZ4_COMPRESSBOUND(compression_header->blocksize);
+		break;
+#endif
+	default:
+		bcmpdbg("Compression format %d of the binary not supported\n", compression_header->compression_format);
+		return -ENOTSUP;
+	}
+
+	bufs->read_buffer = (unsigned char *)kmm_malloc(readsize);
+	if (bufs->read_buffer == NULL) {
+		return -ENOMEM;
+	}
+	bufs->out_buffer = (unsigned char *)kmm_malloc(compression_header->blocksize);
+	if (bufs->out_buffer == NULL) {
+		kmm_free(bufs->read_buffer);
+		bufs->read_buffer = NULL;
+		return -ENOMEM;
+	}
+
+	return OK;
+}
+
+static void compress_free_buffers(FAR struct s_buffer *bufs)
+{
+	if (bufs->read_buffer) {
+		kmm_free(bufs->read_buffer);
+		bufs->read_buffer = NULL;
+	}
+	if (bufs->out_buffer) {
+		kmm_free(bufs->out_buffer);
+		bufs->out_buffer = NULL;
+	}
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
 /****************************************************************************
  * Name: compress_read
  *
@@ -237,7 +476,8 @@ static off_t compress_read_block(int filfd, uint16_t binary_header_size, FAR uin
  *   Read bytes from the compressed file using 'offset' and 'readsize' info
  *   provided for uncompressed file.  The data is read into 'buffer'. Offset
  *   value here is offset from start of uncompressed binary (excluding binary
- *   header).
+ *   header).  With CONFIG_COMPRESSION_PIPELINE, the blocks are shared with
+ *   the helper thread.
  *
  * Returned Value:
  *   Number of bytes read into buffer on Success
@@ -248,90 +488,42 @@ int compress_read(int filfd, uint16_t binary_header_size, FAR uint8_t *buffer, s
 	int first_block;
 	int last_block;
 	int no_blocks;
-	int index;
-	int ret;
-	int actual_offset;			/* Offset from start of uncompressed file */
-	int block_size_to_write;	/* Size to write into buffer from decompressed block */
-	int buffer_index;
-	int blocksize;
-	int block_readsize;
-#if CONFIG_COMPRESSION_TYPE == LZMA
-	unsigned int writesize;
-	unsigned int size;
-#elif CONFIG_COMPRESSION_TYPE == MINIZ
-	long unsigned int writesize;
-	long unsigned int size;
-#endif
 
 	/* Setting first block, end block and number of blocks to read and decompressed */
-	blocksize = compression_header->blocksize;
 	compress_blocks_to_read(&first_block, &last_block, &no_blocks, offset, readsize);
 	if (first_block < 0 || no_blocks < 0) {
 		bcmpdbg("Incorrect first_block, no_blocks info\n");
-		buffer_index = ERROR;
-		goto error_compress_read;
-	}
-
-	index = first_block;
-	buffer_index = 0;
-	/* Actual Offset in uncompressed file is same as Offset passed to this function */
-	actual_offset = offset;
-
-	/* Reading and decompressing blocks from first_block to last_block. Then writing to buffer. */
-	for (; index < first_block + no_blocks; index++) {
-		/* Read compressed 'index' block into read_buffer */
-		block_readsize = compress_read_block(filfd, binary_header_size, buffers.read_buffer, index);
-		if (block_readsize < 0) {
-			bcmpdbg("Read for compressed block %d failed\n", index);
-			buffer_index = block_readsize;
-			goto error_compress_read;
-		}
+		return ERROR;
+	}
 
-#if CONFIG_COMPRESSION_TYPE == LZMA
-		size = (unsigned int)block_readsize;
-#elif CONFIG_COMPRESSION_TYPE == MINIZ
-		size = (long unsigned int)block_readsize;
+	compress_job.filfd = filfd;
+	compress_job.binary_header_size = binary_header_size;
+	compress_job.buffer = buffer;
+	compress_job.offset = offset;
+	compress_job.end = offset + readsize;
+	if (compress_job.end > compression_header->binary_size) {
+		compress_job.end = compression_header->binary_size;
+	}
+	compress_job.next_block = first_block;
+	compress_job.last_block = last_block;
+	compress_job.result = OK;
+
+#ifdef CONFIG_COMPRESSION_PIPELINE
+	if (compress_helper_pid > 0 && no_blocks > 1) {
+		sem_post(&compress_helper_start);
+		compress_job_run(&buffers);
+		compress_lock(&compress_helper_done);
+	} else
 #endif
-		writesize = compression_header->blocksize; 
-		/* Decompress block in read_buffer to out_buffer */
-		ret = decompress_block(buffers.out_buffer, &writesize, buffers.read_buffer, &size);
-		if (ret == ERROR) {
-			bcmpdbg("Failed to decompress %d block of this binary\n", index);
-			buffer_index = ret;
-			goto error_compress_read;
-		}
+	{
+		compress_job_run(&buffers);
+	}
 
-		if (index == first_block) {
-			/*
-			 * Read appropriate number of bytes to buffer from this block using readsize and offset info.
-			 * If start_offset + readsize < end_offset, write from start_offset to start_offset + readsize.
-			 * Otherwise, write from start_offset to end_offset into buffer.
-			 */
-			block_size_to_write = ((index + 1) * blocksize - 1 > actual_offset + readsize - 1 ? readsize : (index + 1) * blocksize - actual_offset);
-			memcpy(&buffer[buffer_index], &buffers.out_buffer[actual_offset - (index * blocksize)], block_size_to_write);
-			buffer_index += block_size_to_write;
-		} else if (index == last_block) {
-			/*
-			 * Read appropriate number of bytes to buffer from this block using readsize and offset info.
-			 * Calculate end_offset (Offset of last byte to write from this block).
-			 * Write from start_offset to end_offset from this block into buffer.
-			 */
-			block_size_to_write = actual_offset + readsize - (index * blocksize);
-			memcpy(&buffer[buffer_index], &buffers.out_buffer[0], block_size_to_write);
-			buffer_index += block_size_to_write;
-		} else {
-			/*
-			 * This is not the first or last block. This is intermediary block.
-			 * So, write entire block into buffer.
-			 */
-			block_size_to_write = blocksize;
-			memcpy(&buffer[buffer_index], &buffers.out_buffer[0], block_size_to_write);
-			buffer_index += block_size_to_write;
-		}
+	if (compress_job.result < 0) {
+		return compress_job.result;
 	}
 
-error_compress_read:
-	return buffer_index;
+	return compress_job.end - offset;
 }
 
 /****************************************************************************
@@ -358,30 +550,20 @@ int compress_init(int filfd, uint16_t offset, off_t *filelen)
 	/* Assign file length as that of uncompressed file */
 	*filelen = compression_header->binary_size;
 
-#if CONFIG_COMPRESSION_TYPE == LZMA
-	/* Allocating memory for read and out buffer to be used for LZMA decompression */
-	if (compression_header->compression_format == COMPRESSION_TYPE_LZMA) {
-		buffers.read_buffer = (unsigned char *)kmm_malloc(compression_header->blocksize + LZMA_PROPS_SIZE);
-		if (buffers.read_buffer == NULL) {
-			return -ENOMEM;
-		}
-		buffers.out_buffer = (unsigned char *)kmm_malloc(compression_header->blocksize);
-		if (buffers.out_buffer == NULL) {
-			kmm_free(buffers.read_buffer);
-			return -ENOMEM;
-		}
+	/* Allocating memory for read and out buffer to be used for decompression */
+	ret = compress_alloc_buffers(&buffers);
+	if (ret != OK) {
+		goto error_compress_init;
 	}
-#elif CONFIG_COMPRESSION_TYPE == MINIZ
-	/* Allocating memory for read and out buffer to be used for Miniz decompression */
-	if (compression_header->compression_format == COMPRESSION_TYPE_MINIZ) {
-		buffers.read_buffer = (unsigned char *)kmm_malloc(compressBound(compression_header->blocksize));
-		if (buffers.read_buffer == NULL) {
-			return -ENOMEM;
-		}
-		buffers.out_buffer = (unsigned char *)kmm_malloc(compression_header->blocksize);
-		if (buffers.out_buffer == NULL) {
-			kmm_free(buffers.read_buffer);
-			return -ENOMEM;
+
+#ifdef CONFIG_COMPRESSION_PIPELINE
+	/* Without the helper, the caller decompresses all of the blocks */
+	if (compress_alloc_buffers(&helper_buffers) == OK) {
+		compress_helper_exit = false;
+		compress_helper_pid = kernel_thread("compress", CONFIG_COMPRESSION_PIPELINE_PRIORITY, CONFIG_COMPRESSION_PIPELINE_STACKSIZE, compress_helper, NULL);
+		if (compress_helper_pid < 0) {
+			bcmpdbg("Failed to start the helper thread: %d\n", compress_helper_pid);
+			compress_free_buffers(&helper_buffers);
 		}
 	}
 #endif
@@ -401,20 +583,20 @@ error_compress_init:
  ****************************************************************************/
 void compress_uninit(void)
 {
-#if CONFIG_COMPRESSION_TYPE == LZMA || CONFIG_COMPRESSION_TYPE == MINIZ
-	/* Freeing memory allocated to read_buffer and out_buffer for file decompression */
-	if (compression_header->compression_format == COMPRESSION_TYPE_LZMA || compression_header->compression_format == COMPRESSION_TYPE_MINIZ) {
-		if (buffers.read_buffer) {
-			kmm_free(buffers.read_buffer);
-			buffers.read_buffer = NULL;
-		}
-		if (buffers.out_buffer) {
-			kmm_free(buffers.out_buffer);
-			buffers.out_buffer = NULL;
-		}
+#ifdef CONFIG_COMPRESSION_PIPELINE
+	if (compress_helper_pid > 0) {
+		/* Wait for the helper to leave before its buffers are freed */
+		compress_helper_exit = true;
+		sem_post(&compress_helper_start);
+		compress_lock(&compress_helper_done);
+		compress_helper_pid = -1;
+		compress_free_buffers(&helper_buffers);
 	}
 #endif
 
+	/* Freeing memory allocated to read_buffer and out_buffer for file decompression */
+	compress_free_buffers(&buffers);
+
 	kmm_free(compression_header);
 	compression_header = NULL;
 }
@@ -0,0 +1,249 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <stdint.h>
+#include <string.h>
+
+#include <tinyara/lz4/lz4.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define LZ4_MINMATCH            4
+#define LZ4_MAX_OFFSET          65535
+#define LZ4_LASTLITERALS        5	/* A block ends with literals */
+#define LZ4_MFLIMIT             12	/* No match starts in the last bytes */
+#define LZ4_RUN_MASK            15
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static uint32_t lz4_read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint32_t lz4_hash(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+static uint8_t *lz4_put_length(uint8_t *op, int len)
+{
+	while (len >= 255) {
+		*op++ = 255;
+		len -= 255;
+	}
+	*op++ = (uint8_t)len;
+	return op;
+}
+
+/* Write literals followed by a match, or the last literals if 'matchlen' is 0 */
+static uint8_t *lz4_put_sequence(uint8_t *op, uint8_t *oend, const uint8_t *literals, int litlen, int offset, int matchlen)
+{
+	uint8_t *token;
+
+	if (op + 1 + litlen / 255 + 1 + litlen + 2 + matchlen / 255 + 1 > oend) {
+		return NULL;
+	}
+
+	token = op++;
+	*token = (litlen >= LZ4_RUN_MASK ? LZ4_RUN_MASK : litlen) << 4;
+	if (litlen >= LZ4_RUN_MASK) {
+		op = lz4_put_length(op, litlen - LZ4_RUN_MASK);
+	}
+	memcpy(op, literals, litlen);
+	op += litlen;
+
+	if (matchlen == 0) {
+		return op;
+	}
+
+	*op++ = offset & 0xff;
+	*op++ = offset >> 8;
+	matchlen -= LZ4_MINMATCH;
+	*token |= matchlen >= LZ4_RUN_MASK ? LZ4_RUN_MASK : matchlen;
+	if (matchlen >= LZ4_RUN_MASK) {
+		op = lz4_put_length(op, matchlen - LZ4_RUN_MASK);
+	}
+	return op;
+}
+
+/* Add the bytes after a run of 15 to a length, -1 past the end of input */
+static int lz4_get_length(const uint8_t **ip, const uint8_t *iend, int len)
+{
+	uint8_t b;
+
+	do {
+		if (*ip >= iend) {
+			return -1;
+		}
+		b = *(*ip)++;
+		len += b;
+	} while (b == 255);
+
+	return len;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lz4_compress_block
+ *
+ * Description:
+ *   Greedy compression, with a table of the last position of each hash of
+ *   4 bytes.  It is made for the host tools, where the ratio is worth more
+ *   than the speed.
+ ****************************************************************************/
+int lz4_compress_block(const uint8_t *src, int srclen, uint8_t *dst, int dstlen, void *state)
+{
+	uint32_t *table = (uint32_t *)state;
+	const uint8_t *ip = src;
+	const uint8_t *anchor = src;
+	const uint8_t *end = src + srclen;
+	const uint8_t *mflimit = end - LZ4_MFLIMIT;
+	const uint8_t *matchlimit = end - LZ4_LASTLITERALS;
+	const uint8_t *ref;
+	uint8_t *op = dst;
+	uint8_t *oend = dst + dstlen;
+	uint32_t h;
+	int len;
+
+	if (srclen > LZ4_MFLIMIT) {
+		memset(table, 0, LZ4_STATE_SIZE);
+		ip++;
+
+		while (ip <= mflimit) {
+			h = lz4_hash(lz4_read32(ip));
+			ref = src + table[h];
+			table[h] = ip - src;
+			if (ref >= ip || ip - ref > LZ4_MAX_OFFSET || lz4_read32(ref) != lz4_read32(ip)) {
+				ip++;
+				continue;
+			}
+
+			/* Take the bytes before too, which would be literals */
+			while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+				ip--;
+				ref--;
+			}
+			len = LZ4_MINMATCH;
+			while (ip + len < matchlimit && ip[len] == ref[len]) {
+				len++;
+			}
+
+			op = lz4_put_sequence(op, oend, anchor, ip - anchor, ip - ref, len);
+			if (op == NULL) {
+				return -1;
+			}
+			ip += len;
+			anchor = ip;
+
+			if (ip <= mflimit) {
+				table[lz4_hash(lz4_read32(ip - 2))] = ip - 2 - src;
+			}
+		}
+	}
+
+	op = lz4_put_sequence(op, oend, anchor, end - anchor, 0, 0);
+	if (op == NULL) {
+		return -1;
+	}
+
+	return op - dst;
+}
+
+/****************************************************************************
+ * Name: lz4_decompress_block
+ *
+ * Description:
+ *   All lengths and offsets are checked against both buffers before any
+ *   copy.
+ ****************************************************************************/
+int lz4_decompress_block(const uint8_t *src, int srclen, uint8_t *dst, int dstlen)
+{
+	const uint8_t *ip = src;
+	const uint8_t *iend = src + srclen;
+	const uint8_t *ref;
+	uint8_t *op = dst;
+	uint8_t *oend = dst + dstlen;
+	uint8_t token;
+	int offset;
+	int len;
+
+	while (ip < iend) {
+		token = *ip++;
+
+		/* Literals */
+		len = token >> 4;
+		if (len == LZ4_RUN_MASK) {
+			len = lz4_get_length(&ip, iend, len);
+		}
+		if (len < 0 || len > iend - ip || len > oend - op) {
+			return -1;
+		}
+		memcpy(op, ip, len);
+		op += len;
+		ip += len;
+
+		/* The last sequence has no match */
+		if (ip == iend) {
+			break;
+		}
+
+		/* Match */
+		if (iend - ip < 2) {
+			return -1;
+		}
+		offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if (offset == 0 || offset > op - dst) {
+			return -1;
+		}
+
+		len = token & LZ4_RUN_MASK;
+		if (len == LZ4_RUN_MASK) {
+			len = lz4_get_length(&ip, iend, len);
+		}
+		if (len < 0 || len + LZ4_MINMATCH > oend - op) {
+			return -1;
+		}
+		len += LZ4_MINMATCH;
+
+		ref = op - offset;
+		if (offset >= len) {
+			memcpy(op, ref, len);
+			op += len;
+		} else {
+			/* The match overlaps what it writes, a repeated pattern */
+			while (len-- > 0) {
+				*op++ = *ref++;
+			}
+		}
+	}
+
+	return op - dst;
+}
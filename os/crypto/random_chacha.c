@@ -0,0 +1,269 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * crypto/random_chacha.c
+ *
+ * Per-CPU ChaCha20 generators in front of the entropy pool, for getrandom()
+ * without the lock and the BLAKE2s hashing of the pool on each request.
+ *
+ * Each CPU keeps a ChaCha20 key, seeded from the pool and reseeded every
+ * CONFIG_CRYPTO_RANDOM_CHACHA_RESEED_SEC seconds, at up_rngreseed(), and
+ * when the pool has gathered much new entropy.  A request takes one block
+ * of the key with the interrupts disabled: its first half replaces the key
+ * (fast key erasure), so that the earlier output can not be recovered from
+ * the state, and its second half is the output of a short request, or the
+ * key of a ChaCha20 stream generated for a longer one, with the interrupts
+ * enabled.  The bytes of the second half not asked for serve the next short
+ * requests.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/clock.h>
+
+#include "random_pool.h"
+
+#ifdef CONFIG_CRYPTO_RANDOM_CHACHA
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+#define ROTL_32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define CHACHA_QR(a, b, c, d) \
+	do { \
+		a += b; d ^= a; d = ROTL_32(d, 16); \
+		c += d; b ^= c; b = ROTL_32(b, 12); \
+		a += b; d ^= a; d = ROTL_32(d, 8); \
+		c += d; b ^= c; b = ROTL_32(b, 7); \
+	} while (0)
+
+#define CHACHA_KEYWORDS   8
+#define CHACHA_BLOCKWORDS 16
+#define CHACHA_KEYBYTES   (CHACHA_KEYWORDS * 4)
+#define CHACHA_BLOCKBYTES (CHACHA_BLOCKWORDS * 4)
+
+#define RESEED_TICKS      SEC2TICK(CONFIG_CRYPTO_RANDOM_CHACHA_RESEED_SEC)
+
+#ifdef CONFIG_SMP
+#define RNG_NCPUS         CONFIG_SMP_NCPUS
+#define RNG_CPU()         up_cpu_index()
+#else
+#define RNG_NCPUS         1
+#define RNG_CPU()         0
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct chacha_rng_s {
+	uint32_t key[CHACHA_KEYWORDS];
+	uint8_t buf[CHACHA_KEYBYTES];	/* Output, the last 'avail' bytes unused */
+	uint8_t avail;
+	uint32_t generation;		/* g_chacha_generation at the seed */
+	clock_t seedtime;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct chacha_rng_s g_chacha[RNG_NCPUS];
+
+/* A generator whose generation differs is reseeded.  The generators start
+ * at 0, so that they are seeded at their first use.
+ */
+
+static volatile uint32_t g_chacha_generation = 1;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void chacha20_block(FAR const uint32_t *key, uint32_t counter, FAR uint32_t *out)
+{
+	uint32_t x[CHACHA_BLOCKWORDS];
+	int i;
+
+	/* "expand 32-byte k", the key, the block counter and a zero nonce */
+
+	out[0] = 0x61707865;
+	out[1] = 0x3320646e;
+	out[2] = 0x79622d32;
+	out[3] = 0x6b206574;
+	memcpy(&out[4], key, CHACHA_KEYBYTES);
+	out[12] = counter;
+	out[13] = 0;
+	out[14] = 0;
+	out[15] = 0;
+
+	memcpy(x, out, sizeof(x));
+
+	for (i = 0; i < 10; i++) {
+		CHACHA_QR(x[0], x[4], x[8], x[12]);
+		CHACHA_QR(x[1], x[5], x[9], x[13]);
+		CHACHA_QR(x[2], x[6], x[10], x[14]);
+		CHACHA_QR(x[3], x[7], x[11], x[15]);
+		CHACHA_QR(x[0], x[5], x[10], x[15]);
+		CHACHA_QR(x[1], x[6], x[11], x[12]);
+		CHACHA_QR(x[2], x[7], x[8], x[13]);
+		CHACHA_QR(x[3], x[4], x[9], x[14]);
+	}
+
+	for (i = 0; i < CHACHA_BLOCKWORDS; i++) {
+		out[i] += x[i];
+	}
+}
+
+/* Clear secrets, in a way the compiler does not remove */
+
+static void chacha_zeroize(FAR void *buf, size_t len)
+{
+	FAR volatile uint8_t *p = (FAR volatile uint8_t *)buf;
+
+	while (len-- > 0) {
+		*p++ = 0;
+	}
+}
+
+/* Reseed the generator of the running CPU if it is due.  The seed is mixed
+ * into the key, so that a reseed never loses the entropy already there.
+ */
+
+static void chacha_check_seed(void)
+{
+	FAR struct chacha_rng_s *rng;
+	uint32_t seed[CHACHA_KEYWORDS];
+	irqstate_t flags;
+	int i;
+
+	rng = &g_chacha[RNG_CPU()];
+	if (rng->generation == g_chacha_generation && clock_systimer() - rng->seedtime < RESEED_TICKS) {
+		return;
+	}
+
+	rng_pool_getbytes(seed, sizeof(seed));
+
+	/* The task may have moved to another CPU meanwhile, which is then
+	 * reseeded instead.
+	 */
+
+	flags = irqsave();
+	rng = &g_chacha[RNG_CPU()];
+	for (i = 0; i < CHACHA_KEYWORDS; i++) {
+		rng->key[i] ^= seed[i];
+	}
+
+	rng->avail = 0;
+	rng->generation = g_chacha_generation;
+	rng->seedtime = clock_systimer();
+	irqrestore(flags);
+
+	chacha_zeroize(seed, sizeof(seed));
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+void rng_chacha_getbytes(FAR void *bytes, size_t nbytes)
+{
+	FAR struct chacha_rng_s *rng;
+	FAR uint8_t *out = (FAR uint8_t *)bytes;
+	uint32_t block[CHACHA_BLOCKWORDS];
+	uint32_t key[CHACHA_KEYWORDS];
+	irqstate_t flags;
+	uint32_t counter;
+	size_t len;
+
+	if (nbytes == 0) {
+		return;
+	}
+
+	chacha_check_seed();
+
+	flags = irqsave();
+	rng = &g_chacha[RNG_CPU()];
+
+	/* Serve a short request from the bytes left by the previous one */
+
+	if (nbytes <= rng->avail) {
+		len = CHACHA_KEYBYTES - rng->avail;
+		memcpy(out, &rng->buf[len], nbytes);
+		chacha_zeroize(&rng->buf[len], nbytes);
+		rng->avail -= nbytes;
+		irqrestore(flags);
+		return;
+	}
+
+	chacha20_block(rng->key, 0, block);
+	memcpy(rng->key, block, CHACHA_KEYBYTES);
+
+	if (nbytes <= CHACHA_KEYBYTES) {
+		memcpy(out, &block[CHACHA_KEYWORDS], nbytes);
+		memcpy(rng->buf, &block[CHACHA_KEYWORDS], CHACHA_KEYBYTES);
+		chacha_zeroize(rng->buf, nbytes);
+		rng->avail = CHACHA_KEYBYTES - nbytes;
+		irqrestore(flags);
+
+		chacha_zeroize(block, sizeof(block));
+		return;
+	}
+
+	memcpy(key, &block[CHACHA_KEYWORDS], CHACHA_KEYBYTES);
+	irqrestore(flags);
+
+	/* A longer request is a stream of its own key */
+
+	for (counter = 0; nbytes > 0; counter++) {
+		chacha20_block(key, counter, block);
+		len = MIN(nbytes, CHACHA_BLOCKBYTES);
+		memcpy(out, block, len);
+		out += len;
+		nbytes -= len;
+	}
+
+	chacha_zeroize(block, sizeof(block));
+	chacha_zeroize(key, sizeof(key));
+}
+
+void rng_chacha_reseed(void)
+{
+	if (++g_chacha_generation == 0) {
+		g_chacha_generation = 1;
+	}
+}
+
+#endif							/* CONFIG_CRYPTO_RANDOM_CHACHA */
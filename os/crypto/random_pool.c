@@ -71,6 +71,8 @@
 
 #include <tinyara/crypto/blake2s.h>
 
+#include "random_pool.h"
+
 /****************************************************************************
  * Definitions
  ****************************************************************************/
@@ -461,6 +463,16 @@ void up_rngaddentropy(enum rnd_source_t type, FAR const uint32_t *buf, size_t n)
 	if (n > 0) {
 		addentropy(buf, n, new_inc);
 	}
+
+#ifdef CONFIG_CRYPTO_RANDOM_CHACHA
+	/* Pass the new entropy on to the generators of the CPUs, which reseed
+	 * the pool as they take their seeds.
+	 */
+
+	if (g_rng.rd_newentr >= MAX_SEED_NEW_ENTROPY_WORDS) {
+		rng_chacha_reseed();
+	}
+#endif
 }
 
 /****************************************************************************
@@ -482,6 +494,10 @@ void up_rngreseed(void)
 	}
 
 	sem_post(&g_rng.rd_sem);
+
+#ifdef CONFIG_CRYPTO_RANDOM_CHACHA
+	rng_chacha_reseed();
+#endif
 }
 
 /****************************************************************************
@@ -497,6 +513,24 @@ void up_randompool_initialize(void)
 	rng_init();
 }
 
+/****************************************************************************
+ * Name: rng_pool_getbytes
+ *
+ * Description:
+ *   Output of the BLAKE2Xs generator, under the lock of the pool.
+ *
+ ****************************************************************************/
+
+void rng_pool_getbytes(FAR void *bytes, size_t nbytes)
+{
+	while (sem_wait(&g_rng.rd_sem) != 0) {
+		assert(errno == EINTR);
+	}
+
+	rng_buf_internal(bytes, nbytes);
+	sem_post(&g_rng.rd_sem);
+}
+
 /****************************************************************************
  * Name: getrandom
  *
@@ -519,10 +553,9 @@ void up_randompool_initialize(void)
 
 void getrandom(FAR void *bytes, size_t nbytes)
 {
-	while (sem_wait(&g_rng.rd_sem) != 0) {
-		assert(errno == EINTR);
-	}
-
-	rng_buf_internal(bytes, nbytes);
-	sem_post(&g_rng.rd_sem);
+#ifdef CONFIG_CRYPTO_RANDOM_CHACHA
+	rng_chacha_getbytes(bytes, nbytes);
+#else
+	rng_pool_getbytes(bytes, nbytes);
+#endif
 }
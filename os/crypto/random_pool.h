@@ -0,0 +1,68 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __CRYPTO_RANDOM_POOL_H
+#define __CRYPTO_RANDOM_POOL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stddef.h>
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: rng_pool_getbytes
+ *
+ * Description:
+ *   Output of the BLAKE2Xs generator of the entropy pool, under its lock.
+ *
+ ****************************************************************************/
+
+void rng_pool_getbytes(FAR void *bytes, size_t nbytes);
+
+#ifdef CONFIG_CRYPTO_RANDOM_CHACHA
+/****************************************************************************
+ * Name: rng_chacha_getbytes
+ *
+ * Description:
+ *   Output of the ChaCha20 generator of the running CPU, which is seeded
+ *   from rng_pool_getbytes().
+ *
+ ****************************************************************************/
+
+void rng_chacha_getbytes(FAR void *bytes, size_t nbytes);
+
+/****************************************************************************
+ * Name: rng_chacha_reseed
+ *
+ * Description:
+ *   Have the generators of all the CPUs reseeded at their next use.  May be
+ *   called from interrupt handlers.
+ *
+ ****************************************************************************/
+
+void rng_chacha_reseed(void);
+#endif
+
+#endif /* __CRYPTO_RANDOM_POOL_H */
@@ -77,6 +77,11 @@
 #include <tinyara/arch.h>
 #include <tinyara/semaphore.h>
 #include <tinyara/analog/adc.h>
+#ifdef CONFIG_ADC_SCAN
+#include <time.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/analog/ioctl.h>
+#endif
 
 #include <tinyara/irq.h>
 
@@ -91,6 +96,11 @@ static int     adc_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
 static int     adc_receive(FAR struct adc_dev_s *dev, uint8_t ch,
 			   int32_t data);
 static void    adc_notify(FAR struct adc_dev_s *dev);
+#ifdef CONFIG_ADC_SCAN
+static void    adc_receive_block(FAR struct adc_dev_s *dev,
+				 FAR const uint16_t *samples, size_t nsamples);
+static void    adc_scanstop(FAR struct adc_dev_s *dev);
+#endif
 #ifndef CONFIG_DISABLE_POLL
 static int     adc_poll(FAR struct file *filep, struct pollfd *fds, bool setup);
 #endif
@@ -111,7 +121,10 @@ static const struct file_operations g_adc_fops = {
 };
 
 static const struct adc_callback_s g_adc_callback = {
-	adc_receive	/* au_receive */
+	adc_receive,		/* au_receive */
+#ifdef CONFIG_ADC_SCAN
+	adc_receive_block,	/* au_receive_block */
+#endif
 };
 
 /****************************************************************************
@@ -229,6 +242,10 @@ static int adc_close(FAR struct file *filep)
 			/* There are no more references to the port */
 			dev->ad_ocount = 0;
 
+#ifdef CONFIG_ADC_SCAN
+			adc_scanstop(dev);
+#endif
+
 			/* Free the IRQ and disable the ADC device */
 			flags = enter_critical_section(); /* Disable interrupts */
 			dev->ad_ops->ao_shutdown(dev); /* Disable the ADC */
@@ -241,6 +258,191 @@ static int adc_close(FAR struct file *filep)
 	return ret;
 }
 
+#ifdef CONFIG_ADC_SCAN
+/****************************************************************************
+ * Name: adc_timestamp
+ *
+ * Description:
+ *   Return the current time in microseconds.
+ *
+ ****************************************************************************/
+static uint64_t adc_timestamp(void)
+{
+	struct timespec ts;
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+	clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: adc_scanstart
+ *
+ * Description:
+ *   Allocate the scan buffer and the block ring, and start the scan of the
+ *   lower half.
+ *
+ ****************************************************************************/
+static int adc_scanstart(FAR struct adc_dev_s *dev,
+			 FAR const struct adc_scan_s *scan)
+{
+	FAR uint16_t *scanbuf;
+	FAR struct adc_block_s *blocks;
+	irqstate_t flags;
+	size_t nsamples;
+	int ret;
+
+	if (scan == NULL || scan->as_nchannels == 0 ||
+		scan->as_nchannels > CONFIG_ADC_SCAN_NCHANNELS ||
+		scan->as_nchannels > CONFIG_ADC_SCAN_BLOCKSIZE) {
+		return -EINVAL;
+	}
+
+	if (dev->ad_ops->ao_scanstart == NULL || dev->ad_ops->ao_scanstop == NULL) {
+		return -ENOSYS;
+	}
+
+	if (dev->ad_scanch > 0) {
+		return -EBUSY;
+	}
+
+	/* One half of the scan buffer fills one block with whole scans */
+
+	nsamples = (CONFIG_ADC_SCAN_BLOCKSIZE / scan->as_nchannels) * scan->as_nchannels;
+
+	scanbuf = (FAR uint16_t *)kmm_malloc(2 * nsamples * sizeof(uint16_t));
+	if (scanbuf == NULL) {
+		return -ENOMEM;
+	}
+
+	blocks = (FAR struct adc_block_s *)kmm_malloc(CONFIG_ADC_SCAN_NBLOCKS * sizeof(struct adc_block_s));
+	if (blocks == NULL) {
+		kmm_free(scanbuf);
+		return -ENOMEM;
+	}
+
+	flags = enter_critical_section();
+	dev->ad_scanbuf = scanbuf;
+	dev->ad_blocks = blocks;
+	dev->ad_bhead = 0;
+	dev->ad_bcount = 0;
+	dev->ad_lastscan = adc_timestamp();
+	dev->ad_scanch = scan->as_nchannels;
+
+	ret = dev->ad_ops->ao_scanstart(dev, scan, scanbuf, 2 * nsamples);
+	if (ret < 0) {
+		dev->ad_scanch = 0;
+		dev->ad_scanbuf = NULL;
+		dev->ad_blocks = NULL;
+	}
+	leave_critical_section(flags);
+
+	if (ret < 0) {
+		avdbg("ERROR: Failed to start the scan: %d\n", ret);
+		kmm_free(blocks);
+		kmm_free(scanbuf);
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: adc_scanstop
+ *
+ * Description:
+ *   Stop the scan of the lower half and wake up the readers.  The blocks
+ *   which were not read are dropped.
+ *
+ ****************************************************************************/
+static void adc_scanstop(FAR struct adc_dev_s *dev)
+{
+	FAR uint16_t *scanbuf;
+	FAR struct adc_block_s *blocks;
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	if (dev->ad_scanch == 0) {
+		leave_critical_section(flags);
+		return;
+	}
+
+	dev->ad_ops->ao_scanstop(dev);
+
+	scanbuf = dev->ad_scanbuf;
+	blocks = dev->ad_blocks;
+	dev->ad_scanch = 0;
+	dev->ad_scanbuf = NULL;
+	dev->ad_blocks = NULL;
+	dev->ad_bcount = 0;
+
+	/* A reader waiting for a block returns 0 */
+
+	adc_notify(dev);
+	leave_critical_section(flags);
+
+	kmm_free(blocks);
+	kmm_free(scanbuf);
+}
+
+/****************************************************************************
+ * Name: adc_readblocks
+ *
+ * Description:
+ *   read() while a scan runs.  Copy as many whole blocks as fit in the user
+ *   buffer, oldest first.
+ *
+ ****************************************************************************/
+static ssize_t adc_readblocks(FAR struct file *filep, FAR char *buffer,
+			      size_t buflen)
+{
+	FAR struct inode     *inode = filep->f_inode;
+	FAR struct adc_dev_s *dev   = inode->i_private;
+	irqstate_t            flags;
+	ssize_t               nread = 0;
+	int                   ret;
+
+	if (buflen < sizeof(struct adc_block_s)) {
+		return -EINVAL;
+	}
+
+	flags = enter_critical_section();
+	while (dev->ad_bcount == 0) {
+		/* The scan was stopped while waiting */
+		if (dev->ad_scanch == 0) {
+			goto return_with_irqdisabled;
+		}
+
+		if (filep->f_oflags & O_NONBLOCK) {
+			nread = -EAGAIN;
+			goto return_with_irqdisabled;
+		}
+
+		dev->ad_nrxwaiters++;
+		ret = sem_wait(&dev->ad_recv.af_sem);
+		dev->ad_nrxwaiters--;
+		if (ret < 0) {
+			nread = -errno;
+			goto return_with_irqdisabled;
+		}
+	}
+
+	while (dev->ad_bcount > 0 && nread + sizeof(struct adc_block_s) <= buflen) {
+		memcpy(&buffer[nread], &dev->ad_blocks[dev->ad_bhead], sizeof(struct adc_block_s));
+		nread += sizeof(struct adc_block_s);
+
+		dev->ad_bhead = (dev->ad_bhead + 1) % CONFIG_ADC_SCAN_NBLOCKS;
+		dev->ad_bcount--;
+	}
+
+return_with_irqdisabled:
+	leave_critical_section(flags);
+	return nread;
+}
+#endif /* CONFIG_ADC_SCAN */
+
 /****************************************************************************
  * Name: adc_read
  ****************************************************************************/
@@ -256,6 +458,12 @@ static ssize_t adc_read(FAR struct file *filep, FAR char *buffer,
 
 	avdbg("buflen: %d\n", (int)buflen);
 
+#ifdef CONFIG_ADC_SCAN
+	if (dev->ad_scanch > 0) {
+		return adc_readblocks(filep, buffer, buflen);
+	}
+#endif
+
 	if (buflen % 5 == 0)
 		msglen = 5;
 	else if (buflen % 4 == 0)
@@ -370,6 +578,18 @@ static int adc_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 	FAR struct adc_dev_s *dev = inode->i_private;
 	int ret;
 
+#ifdef CONFIG_ADC_SCAN
+	switch (cmd) {
+	case ANIOC_SCAN_START:
+		return adc_scanstart(dev, (FAR const struct adc_scan_s *)((uintptr_t)arg));
+	case ANIOC_SCAN_STOP:
+		adc_scanstop(dev);
+		return OK;
+	default:
+		break;
+	}
+#endif
+
 	ret = dev->ad_ops->ao_ioctl(dev, cmd, arg);
 	return ret;
 }
@@ -409,6 +629,59 @@ static int adc_receive(FAR struct adc_dev_s *dev, uint8_t ch, int32_t data)
 	return errcode;
 }
 
+#ifdef CONFIG_ADC_SCAN
+/****************************************************************************
+ * Name: adc_receive_block
+ *
+ * Description:
+ *   Queue a filled half of the scan buffer as a block.  The scans of the
+ *   block are spread evenly since the last scan of the previous block.
+ *   If the ring is full, the oldest block is dropped.
+ *
+ ****************************************************************************/
+static void adc_receive_block(FAR struct adc_dev_s *dev,
+			      FAR const uint16_t *samples, size_t nsamples)
+{
+	FAR struct adc_block_s *block;
+	irqstate_t flags;
+	uint64_t now;
+	size_t nscans;
+
+	now = adc_timestamp();
+
+	flags = enter_critical_section();
+	if (dev->ad_scanch == 0 || nsamples == 0 || nsamples > CONFIG_ADC_SCAN_BLOCKSIZE) {
+		leave_critical_section(flags);
+		return;
+	}
+
+	if (dev->ad_bcount == CONFIG_ADC_SCAN_NBLOCKS) {
+		dev->ad_bhead = (dev->ad_bhead + 1) % CONFIG_ADC_SCAN_NBLOCKS;
+		dev->ad_bcount--;
+
+		block = &dev->ad_blocks[dev->ad_bhead];
+		if (block->ab_overrun < UINT8_MAX) {
+			block->ab_overrun++;
+		}
+	}
+
+	block = &dev->ad_blocks[(dev->ad_bhead + dev->ad_bcount) % CONFIG_ADC_SCAN_NBLOCKS];
+	nscans = nsamples / dev->ad_scanch;
+	block->ab_period = (uint32_t)((now - dev->ad_lastscan) / nscans);
+	block->ab_timestamp = dev->ad_lastscan + block->ab_period;
+	block->ab_nsamples = nsamples;
+	block->ab_nchannels = dev->ad_scanch;
+	block->ab_overrun = 0;
+	memcpy(block->ab_data, samples, nsamples * sizeof(uint16_t));
+
+	dev->ad_bcount++;
+	dev->ad_lastscan = now;
+
+	adc_notify(dev);
+	leave_critical_section(flags);
+}
+#endif
+
 /****************************************************************************
  * Name: adc_pollnotify
  ****************************************************************************/
@@ -509,6 +782,11 @@ static int adc_poll(FAR struct file *filep, struct pollfd *fds, bool setup)
 		if (dev->ad_recv.af_head != dev->ad_recv.af_tail) {
 			adc_pollnotify(dev, POLLIN);
 		}
+#ifdef CONFIG_ADC_SCAN
+		if (dev->ad_bcount > 0) {
+			adc_pollnotify(dev, POLLIN);
+		}
+#endif
 	} else if (fds->priv) {
 		/* This is a request to tear down the poll. */
 
@@ -550,6 +828,10 @@ int adc_register(FAR const char *path, FAR struct adc_dev_s *dev)
 
 	/* Initialize the ADC device structure */
 	dev->ad_ocount = 0;
+#ifdef CONFIG_ADC_SCAN
+	dev->ad_scanch = 0;
+	dev->ad_bcount = 0;
+#endif
 
 	/* Initialize semaphores */
 	sem_init(&dev->ad_recv.af_sem, 0, 0);
@@ -607,7 +607,13 @@ static int syu645b_start(FAR struct audio_lowerhalf_s *dev)
 	}
 #endif
 	/* Exit reduced power modes of operation */
-	/* REVISIT */
+#ifdef CONFIG_PM_QOS
+	/* The amplifier is muted in PM_SLEEP, so no wakeup latency is tolerated
+	 * while streaming. The constraint lasts until stop, instead of a timed
+	 * suspend for each buffer.
+	 */
+	pm_qos_request(pm_domain_register("AUDIO"), PM_QOS_LATENCY, 0);
+#endif
 
 ub_start_withsem:
 
@@ -645,7 +651,9 @@ static int syu645b_stop(FAR struct audio_lowerhalf_s *dev)
 	syu645b_givesem(&priv->devsem);
 
 	/* Enter into a reduced power usage mode */
-	/* REVISIT: */
+#ifdef CONFIG_PM_QOS
+	pm_qos_release(pm_domain_register("AUDIO"), PM_QOS_LATENCY);
+#endif
 
 	return OK;
 }
@@ -769,7 +777,7 @@ static int syu645b_enqueuebuffer(FAR struct audio_lowerhalf_s *dev, FAR struct a
 	 * and adding 10 ms as an offset for timeout */
 	timeout = (CONFIG_SYU645B_BUFFER_SIZE * CONFIG_SYU645B_NUM_BUFFERS * BYTE_TO_BIT_FACTOR * SEC_TO_MSEC_FACTOR) / (priv->samprate * priv->nchannels * priv->bpsamp) + I2S_TIMEOUT_OFFSET_MS;
 
-#ifdef CONFIG_PM
+#if defined(CONFIG_PM) && !defined(CONFIG_PM_QOS)
 	pm_timedsuspend(pm_domain_register("AUDIO"), timeout);
 #endif
 	ret = I2S_SEND(priv->i2s, apb, syu645b_txcallback, priv, timeout);
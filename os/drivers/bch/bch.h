@@ -62,6 +62,10 @@
 #include <stdbool.h>
 #include <semaphore.h>
 #include <tinyara/fs/fs.h>
+#include <tinyara/fs/bcache.h>
+#if defined(CONFIG_BCH_ENCRYPTION)
+#include <mbedtls/aes.h>
+#endif
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -83,9 +87,14 @@ struct bchlib_s {
 	bool readonly;				/* true: Only read operations are supported */
 	bool unlinked;				/* true: The driver has been unlinked */
 	FAR uint8_t *buffer;		/* One sector buffer */
+	FAR uint8_t *dmbase;		/* Sector 0 of a device in memory, see BIOC_DIRECTMAP */
 
 #if defined(CONFIG_BCH_ENCRYPTION)
 	uint8_t key[CONFIG_BCH_ENCRYPTION_KEY_SIZE];	/* Encryption key */
+	struct bch_cipher_s cipher;	/* Cipher backend, no crypt() for the software one */
+	mbedtls_aes_xts_context xts_enc;	/* Software backend, encryption */
+	mbedtls_aes_xts_context xts_dec;	/* Software backend, decryption */
+	FAR uint8_t *cryptbuf;		/* CONFIG_BCH_ENCRYPTION_NSECTORS encrypted sectors */
 #endif
 };
 
@@ -108,6 +117,12 @@ EXTERN const struct file_operations bch_fops;
 EXTERN void bchlib_semtake(FAR struct bchlib_s *bch);
 EXTERN int  bchlib_flushsector(FAR struct bchlib_s *bch);
 EXTERN int  bchlib_readsector(FAR struct bchlib_s *bch, size_t sector);
+#if defined(CONFIG_BCH_ENCRYPTION)
+EXTERN int  bchlib_cipher_setup(FAR struct bchlib_s *bch);
+EXTERN void bchlib_cipher_teardown(FAR struct bchlib_s *bch);
+EXTERN int  bchlib_setkey(FAR struct bchlib_s *bch, FAR const uint8_t *key);
+EXTERN int  bchlib_crypt(FAR struct bchlib_s *bch, FAR uint8_t *dst, FAR const uint8_t *src, size_t sector, size_t nsectors, bool encrypt);
+#endif
 
 #undef EXTERN
 #if defined(__cplusplus)
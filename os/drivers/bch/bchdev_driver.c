@@ -158,6 +158,7 @@ static int bch_close(FAR struct file *filep)
 	/* Flush any dirty pages remaining in the cache */
 	bchlib_semtake(bch);
 	(void)bchlib_flushsector(bch);
+	(void)bcache_flush(bch->inode);
 
 	/*
 	 * Decrement the reference count (I don't use bchlib_decref() because I
@@ -334,8 +335,27 @@ static int bch_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 #ifdef CONFIG_BCH_ENCRYPTION
 	/* Is this a request to set the encryption key? */
 	else if (cmd == DIOC_SETKEY) {
-			memcpy(bch->key, (FAR void *)arg, CONFIG_BCH_ENCRYPTION_KEY_SIZE);
-			ret = OK;
+		/* The cached sector is read again with the new key */
+		bchlib_semtake(bch);
+		(void)bchlib_flushsector(bch);
+		bch->sector = (size_t)-1;
+		ret = bchlib_setkey(bch, (FAR const uint8_t *)arg);
+		bchlib_semgive(bch);
+	}
+	/* Or to install a cipher backend? */
+	else if (cmd == DIOC_SETCIPHER) {
+		FAR const struct bch_cipher_s *cipher = (FAR const struct bch_cipher_s *)((uintptr_t)arg);
+
+		bchlib_semtake(bch);
+		(void)bchlib_flushsector(bch);
+		bch->sector = (size_t)-1;
+		if (cipher) {
+			bch->cipher = *cipher;
+		} else {
+			memset(&bch->cipher, 0, sizeof(struct bch_cipher_s));
+		}
+		bchlib_semgive(bch);
+		ret = OK;
 	}
 #endif
 	/* Otherwise, pass the IOCTL command on to the contained block driver */
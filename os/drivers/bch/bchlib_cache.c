@@ -63,57 +63,6 @@
 
 #include "bch.h"
 
-#if defined(CONFIG_BCH_ENCRYPTION)
-#  include <crypto/crypto.h>
-#endif
-
-/****************************************************************************
- * Private Functions
- ****************************************************************************/
-
-/****************************************************************************
- * Name: bch_xor
- ****************************************************************************/
-#if defined(CONFIG_BCH_ENCRYPTION)
-static void bch_xor(uint32_t *R, uint32_t *A, uint32_t *B)
-{
-	R[0] = A[0] ^ B[0];
-	R[1] = A[1] ^ B[1];
-	R[2] = A[2] ^ B[2];
-	R[3] = A[3] ^ B[3];
-}
-#endif
-
-/****************************************************************************
- * Name: bch_cypher
- ****************************************************************************/
-#if defined(CONFIG_BCH_ENCRYPTION)
-static int bch_cypher(FAR struct bchlib_s *bch, int encrypt)
-{
-	int blocks = bch->sectsize / 16;
-	FAR uint32_t *buffer = (FAR uint32_t *)bch->buffer;
-	int i;
-
-	for (i = 0; i < blocks; i++, buffer += 16 / sizeof(uint32_t)) {
-		uint32_t T[4];
-		uint32_t X[4] = {
-			bch->sector, 0, 0, i
-		};
-
-		aes_cypher(X, X, 16, NULL, bch->key, CONFIG_BCH_ENCRYPTION_KEY_SIZE,
-						AES_MODE_ECB, CYPHER_ENCRYPT);
-
-		/* Xor-Encrypt-Xor */
-		bch_xor(T, X, buffer);
-		aes_cypher(T, T, 16, NULL, bch->key, CONFIG_BCH_ENCRYPTION_KEY_SIZE,
-						AES_MODE_ECB, encrypt);
-		bch_xor(buffer, X, T);
-	}
-
-	return OK;
-}
-#endif
-
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -140,24 +89,21 @@ int bchlib_flushsector(FAR struct bchlib_s *bch)
 		inode = bch->inode;
 
 #if defined(CONFIG_BCH_ENCRYPTION)
-		/* Encrypt data as necessary */
-		bch_cypher(bch, CYPHER_ENCRYPT);
-#endif
+		/* Write the encrypted copy, the buffer stays in plain text */
+		ret = bchlib_crypt(bch, bch->cryptbuf, bch->buffer, bch->sector, 1, true);
+		if (ret < 0) {
+			return (int)ret;
+		}
 
+		ret = bcache_write(inode, bch->cryptbuf, bch->sector, 1);
+#else
 		/* Write the sector to the media */
-		ret = inode->u.i_bops->write(inode, bch->buffer, bch->sector, 1);
+		ret = bcache_write(inode, bch->buffer, bch->sector, 1);
+#endif
 		if (ret < 0) {
 			fdbg("Write failed: %d\n");
 		}
 
-#if defined(CONFIG_BCH_ENCRYPTION)
-		/*
-		 * Computation overhead to save memory for extra sector buffer
-		 * TODO: Add configuration switch for extra sector buffer
-		 */
-		bch_cypher(bch, CYPHER_DECRYPT);
-#endif
-
 		/* The sector is now in sync with the media */
 		bch->dirty = false;
 	}
@@ -186,14 +132,19 @@ int bchlib_readsector(FAR struct bchlib_s *bch, size_t sector)
 		(void)bchlib_flushsector(bch);
 		bch->sector = (size_t)-1;
 
-		ret = inode->u.i_bops->read(inode, bch->buffer, sector, 1);
+		ret = bcache_read(inode, bch->buffer, sector, 1);
 		if (ret < 0) {
 			fdbg("Read failed: %d\n");
 		}
-		bch->sector = sector;
 #if defined(CONFIG_BCH_ENCRYPTION)
-		bch_cypher(bch, CYPHER_DECRYPT);
+		else {
+			ret = bchlib_crypt(bch, bch->buffer, bch->buffer, sector, 1, false);
+			if (ret < 0) {
+				return (int)ret;
+			}
+		}
 #endif
+		bch->sector = sector;
 	}
 	return (int)ret;
 }
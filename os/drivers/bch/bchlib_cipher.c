@@ -0,0 +1,327 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#ifdef CONFIG_BCH_ENCRYPTION_SE
+#include <tinyara/security_hal.h>
+#endif
+
+#include "bch.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define BCH_XTS_BLOCK		16
+#define BCH_XTS_KEYBITS		(CONFIG_BCH_ENCRYPTION_KEY_SIZE * 8)
+
+#ifdef CONFIG_BCH_ENCRYPTION_SE
+/* Tweaks computed by one request to the engine */
+#define BCH_SE_NTWEAKS		8
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bch_tweak
+ *
+ * Description:
+ *   The XTS data unit number of a sector, 128 bits little endian.
+ *
+ ****************************************************************************/
+static void bch_tweak(FAR uint8_t *tweak, size_t sector)
+{
+	int i;
+
+	memset(tweak, 0, BCH_XTS_BLOCK);
+	for (i = 0; i < sizeof(size_t); i++) {
+		tweak[i] = (uint8_t)(sector >> (8 * i));
+	}
+}
+
+#ifdef CONFIG_BCH_ENCRYPTION_SE
+/****************************************************************************
+ * Name: bch_xts_double
+ *
+ * Description:
+ *   Multiply the tweak by alpha in GF(2^128), for the next block.
+ *
+ ****************************************************************************/
+static void bch_xts_double(FAR uint8_t *tweak)
+{
+	uint8_t carry = tweak[BCH_XTS_BLOCK - 1] >> 7;
+	int i;
+
+	for (i = BCH_XTS_BLOCK - 1; i > 0; i--) {
+		tweak[i] = (tweak[i] << 1) | (tweak[i - 1] >> 7);
+	}
+	tweak[0] = (tweak[0] << 1) ^ (carry ? 0x87 : 0);
+}
+
+/****************************************************************************
+ * Name: bch_xts_xor
+ *
+ * Description:
+ *   Xor every block of the sectors with its tweak, from the encrypted data
+ *   unit numbers of the sectors.
+ *
+ ****************************************************************************/
+static void bch_xts_xor(FAR uint8_t *dst, FAR const uint8_t *src, FAR uint8_t (*tweaks)[BCH_XTS_BLOCK], size_t nsectors, uint32_t sectsize)
+{
+	uint8_t tweak[BCH_XTS_BLOCK];
+	uint32_t offset;
+	int i;
+
+	while (nsectors-- > 0) {
+		memcpy(tweak, *tweaks++, BCH_XTS_BLOCK);
+		for (offset = 0; offset < sectsize; offset += BCH_XTS_BLOCK) {
+			for (i = 0; i < BCH_XTS_BLOCK; i++) {
+				dst[i] = src[i] ^ tweak[i];
+			}
+			bch_xts_double(tweak);
+			dst += BCH_XTS_BLOCK;
+			src += BCH_XTS_BLOCK;
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: bch_se_ecb
+ *
+ * Description:
+ *   One AES-ECB request to the security HAL, in place.
+ *
+ ****************************************************************************/
+static int bch_se_ecb(FAR struct bch_secipher_s *se, uint32_t key_idx, FAR uint8_t *buffer, uint32_t len, bool encrypt)
+{
+	hal_aes_param param;
+	hal_data in;
+	hal_data out;
+	int ret;
+
+	memset(&param, 0, sizeof(param));
+	param.mode = HAL_AES_ECB_NOPAD;
+
+	memset(&in, 0, sizeof(in));
+	in.data = buffer;
+	in.data_len = len;
+	out = in;
+
+	if (encrypt) {
+		ret = se->ops->aes_encrypt(&in, &param, key_idx, &out);
+	} else {
+		ret = se->ops->aes_decrypt(&in, &param, key_idx, &out);
+	}
+
+	if (ret != HAL_SUCCESS || out.data_len != len) {
+		fdbg("ERROR: AES-ECB of %u bytes failed: %d\n", len, ret);
+		return -EIO;
+	}
+
+	return OK;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bchlib_cipher_setup
+ *
+ * Description:
+ *   Allocate the bounce buffer and set up the software backend with the
+ *   all zero key, until DIOC_SETKEY.
+ *
+ ****************************************************************************/
+int bchlib_cipher_setup(FAR struct bchlib_s *bch)
+{
+	if (bch->sectsize % BCH_XTS_BLOCK != 0) {
+		fdbg("ERROR: Sector size %u is not a multiple of the AES block\n", bch->sectsize);
+		return -EINVAL;
+	}
+
+	bch->cryptbuf = (FAR uint8_t *)kmm_malloc(bch->sectsize * CONFIG_BCH_ENCRYPTION_NSECTORS);
+	if (!bch->cryptbuf) {
+		fdbg("ERROR: Failed to allocate cipher buffer\n");
+		return -ENOMEM;
+	}
+
+	mbedtls_aes_xts_init(&bch->xts_enc);
+	mbedtls_aes_xts_init(&bch->xts_dec);
+	return bchlib_setkey(bch, bch->key);
+}
+
+/****************************************************************************
+ * Name: bchlib_cipher_teardown
+ ****************************************************************************/
+void bchlib_cipher_teardown(FAR struct bchlib_s *bch)
+{
+	mbedtls_aes_xts_free(&bch->xts_enc);
+	mbedtls_aes_xts_free(&bch->xts_dec);
+	memset(bch->key, 0, CONFIG_BCH_ENCRYPTION_KEY_SIZE);
+
+	if (bch->cryptbuf) {
+		kmm_free(bch->cryptbuf);
+		bch->cryptbuf = NULL;
+	}
+}
+
+/****************************************************************************
+ * Name: bchlib_setkey
+ *
+ * Description:
+ *   Set the XTS key of the software backend.
+ *
+ * Assumptions:
+ *   Caller must assume mutual exclusion
+ *
+ ****************************************************************************/
+int bchlib_setkey(FAR struct bchlib_s *bch, FAR const uint8_t *key)
+{
+	if (key != bch->key) {
+		memcpy(bch->key, key, CONFIG_BCH_ENCRYPTION_KEY_SIZE);
+	}
+
+	if (mbedtls_aes_xts_setkey_enc(&bch->xts_enc, bch->key, BCH_XTS_KEYBITS) != 0 ||
+		mbedtls_aes_xts_setkey_dec(&bch->xts_dec, bch->key, BCH_XTS_KEYBITS) != 0) {
+		fdbg("ERROR: Invalid XTS key size %d\n", CONFIG_BCH_ENCRYPTION_KEY_SIZE);
+		return -EINVAL;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: bchlib_crypt
+ *
+ * Description:
+ *   Encrypt or decrypt contiguous sectors from src into dst, which may be
+ *   the same buffer, with the installed backend.
+ *
+ * Assumptions:
+ *   Caller must assume mutual exclusion
+ *
+ ****************************************************************************/
+int bchlib_crypt(FAR struct bchlib_s *bch, FAR uint8_t *dst, FAR const uint8_t *src, size_t sector, size_t nsectors, bool encrypt)
+{
+	uint8_t tweak[BCH_XTS_BLOCK];
+	int ret;
+
+	if (bch->cipher.crypt) {
+		return bch->cipher.crypt(bch->cipher.priv, dst, src, sector, nsectors, bch->sectsize, encrypt);
+	}
+
+	while (nsectors-- > 0) {
+		bch_tweak(tweak, sector++);
+		if (encrypt) {
+			ret = mbedtls_aes_crypt_xts(&bch->xts_enc, MBEDTLS_AES_ENCRYPT, bch->sectsize, tweak, src, dst);
+		} else {
+			ret = mbedtls_aes_crypt_xts(&bch->xts_dec, MBEDTLS_AES_DECRYPT, bch->sectsize, tweak, src, dst);
+		}
+
+		if (ret != 0) {
+			fdbg("ERROR: XTS failed: %d\n", ret);
+			return -EIO;
+		}
+
+		dst += bch->sectsize;
+		src += bch->sectsize;
+	}
+
+	return OK;
+}
+
+#ifdef CONFIG_BCH_ENCRYPTION_SE
+/****************************************************************************
+ * Name: bch_secipher_crypt
+ *
+ * Description:
+ *   AES-XTS on the AES-ECB of a security HAL.  For each batch of sectors, the
+ *   data unit numbers are encrypted with the tweak key in one request, the
+ *   data xored with the tweaks are encrypted or decrypted with the data key
+ *   in another one, and xored with the tweaks again.  See
+ *   include/tinyara/fs/fs.h.
+ *
+ ****************************************************************************/
+int bch_secipher_crypt(FAR void *priv, FAR uint8_t *dst, FAR const uint8_t *src, size_t sector, size_t nsectors, uint32_t sectsize, bool encrypt)
+{
+	FAR struct bch_secipher_s *se = (FAR struct bch_secipher_s *)priv;
+	uint8_t tweaks[BCH_SE_NTWEAKS][BCH_XTS_BLOCK];
+	size_t nbatch;
+	size_t i;
+	int ret;
+
+	if (!se || !se->ops || !se->ops->aes_encrypt || !se->ops->aes_decrypt) {
+		return -EINVAL;
+	}
+
+	nbatch = CONFIG_BCH_ENCRYPTION_SE_BATCH / sectsize;
+	if (nbatch == 0) {
+		fdbg("ERROR: Sector size %u is larger than a HAL request\n", sectsize);
+		return -EINVAL;
+	}
+
+	if (nbatch > BCH_SE_NTWEAKS) {
+		nbatch = BCH_SE_NTWEAKS;
+	}
+
+	while (nsectors > 0) {
+		if (nbatch > nsectors) {
+			nbatch = nsectors;
+		}
+
+		for (i = 0; i < nbatch; i++) {
+			bch_tweak(tweaks[i], sector + i);
+		}
+
+		ret = bch_se_ecb(se, se->tweak_idx, (FAR uint8_t *)tweaks, nbatch * BCH_XTS_BLOCK, true);
+		if (ret < 0) {
+			return ret;
+		}
+
+		bch_xts_xor(dst, src, tweaks, nbatch, sectsize);
+		ret = bch_se_ecb(se, se->key_idx, dst, nbatch * sectsize, encrypt);
+		if (ret < 0) {
+			return ret;
+		}
+		bch_xts_xor(dst, dst, tweaks, nbatch, sectsize);
+
+		sector += nbatch;
+		nsectors -= nbatch;
+		dst += nbatch * sectsize;
+		src += nbatch * sectsize;
+	}
+
+	return OK;
+}
+#endif
@@ -121,6 +121,16 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset, size_t le
 		return 0;
 	}
 
+	/* A device in memory is read with one copy */
+	if (bch->dmbase) {
+		if (offset + len > bch->nsectors * bch->sectsize) {
+			len = bch->nsectors * bch->sectsize - offset;
+		}
+
+		memcpy(buffer, &bch->dmbase[offset], len);
+		return len;
+	}
+
 	/* Read the initial partial sector */
 
 	bytesread = 0;
@@ -159,13 +169,22 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset, size_t le
 			nsectors = bch->nsectors - sector;
 		}
 
-		ret = bch->inode->u.i_bops->read(bch->inode, (FAR uint8_t *)buffer,
+		ret = bcache_read(bch->inode, (FAR uint8_t *)buffer,
 						sector, nsectors);
 		if (ret < 0) {
 			fdbg("ERROR: Read failed: %d\n");
 			return ret;
 		}
 
+#if defined(CONFIG_BCH_ENCRYPTION)
+		/* Decrypt all of the sectors in one request to the cipher */
+		ret = bchlib_crypt(bch, (FAR uint8_t *)buffer, (FAR const uint8_t *)buffer,
+						sector, nsectors, false);
+		if (ret < 0) {
+			return ret;
+		}
+#endif
+
 		/* Adjust pointers and counts */
 		sector    += nsectors;
 		nbytes     = nsectors * bch->sectsize;
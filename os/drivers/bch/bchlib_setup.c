@@ -67,6 +67,7 @@
 
 #include <tinyara/kmalloc.h>
 #include <tinyara/fs/fs.h>
+#include <tinyara/fs/ioctl.h>
 
 #include "bch.h"
 
@@ -139,6 +140,26 @@ int bchlib_setup(const char *blkdev, bool readonly, FAR void **handle)
 		goto errout_with_bch;
 	}
 
+#if defined(CONFIG_BCH_ENCRYPTION)
+	ret = bchlib_cipher_setup(bch);
+	if (ret < 0) {
+		bchlib_cipher_teardown(bch);
+		kmm_free(bch->buffer);
+		goto errout_with_bch;
+	}
+#endif
+
+#if !defined(CONFIG_BCH_ENCRYPTION)
+	/* A device in memory is copied directly, without the sector buffer */
+	if (bch->inode->u.i_bops->ioctl &&
+		bch->inode->u.i_bops->ioctl(bch->inode, BIOC_DIRECTMAP, (unsigned long)((uintptr_t)&bch->dmbase)) != OK) {
+		bch->dmbase = NULL;
+	}
+#endif
+
+	/* Share the block cache with the other users of the device, if any */
+	(void)bcache_attach(bch->inode);
+
 	*handle = bch;
 	return OK;
 
@@ -89,10 +89,15 @@ int bchlib_teardown(FAR void *handle)
 
 	/* Flush any pending data to the block driver */
 	bchlib_flushsector(bch);
+	(void)bcache_detach(bch->inode);
 
 	/* Close the block driver */
 	(void)close_blockdriver(bch->inode);
 
+#if defined(CONFIG_BCH_ENCRYPTION)
+	bchlib_cipher_teardown(bch);
+#endif
+
 	/* Free the BCH state structure */
 	if (bch->buffer) {
 		kmm_free(bch->buffer);
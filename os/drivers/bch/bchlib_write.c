@@ -67,6 +67,49 @@
 
 #include "bch.h"
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bchlib_writecrypt
+ *
+ * Description:
+ *   Encrypt contiguous sectors into the cipher buffer and write them, up to
+ *   CONFIG_BCH_ENCRYPTION_NSECTORS at a time.
+ *
+ ****************************************************************************/
+#if defined(CONFIG_BCH_ENCRYPTION)
+static int bchlib_writecrypt(FAR struct bchlib_s *bch, FAR const char *buffer, size_t sector, size_t nsectors)
+{
+	size_t nbatch;
+	int    ret;
+
+	while (nsectors > 0) {
+		nbatch = nsectors;
+		if (nbatch > CONFIG_BCH_ENCRYPTION_NSECTORS) {
+			nbatch = CONFIG_BCH_ENCRYPTION_NSECTORS;
+		}
+
+		ret = bchlib_crypt(bch, bch->cryptbuf, (FAR const uint8_t *)buffer, sector, nbatch, true);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = bcache_write(bch->inode, bch->cryptbuf, sector, nbatch);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buffer   += nbatch * bch->sectsize;
+		sector   += nbatch;
+		nsectors -= nbatch;
+	}
+
+	return OK;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -107,6 +150,16 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, si
 		return -EFBIG;
 	}
 
+	/* A device in memory is written with one copy */
+	if (bch->dmbase) {
+		if (offset + len > bch->nsectors * bch->sectsize) {
+			len = bch->nsectors * bch->sectsize - offset;
+		}
+
+		memcpy(&bch->dmbase[offset], buffer, len);
+		return len;
+	}
+
 	/* Write the initial partial sector */
 
 	byteswritten = 0;
@@ -146,9 +199,14 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, si
 			nsectors = bch->nsectors - sector;
 		}
 
+#if defined(CONFIG_BCH_ENCRYPTION)
+		/* Encrypt and write the contiguous sectors by batches */
+		ret = bchlib_writecrypt(bch, buffer, sector, nsectors);
+#else
 		/* Write the contiguous sectors */
-		ret = bch->inode->u.i_bops->write(bch->inode, (FAR uint8_t *)buffer,
+		ret = bcache_write(bch->inode, (FAR uint8_t *)buffer,
 				sector, nsectors);
+#endif
 		if (ret < 0) {
 			fdbg("ERROR: Write failed: %d\n", ret);
 			return ret;
@@ -101,7 +101,7 @@ static int comp_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 		ret = compress_block(comp_info->output_buffer, &comp_info->output_size, comp_info->input_buffer, comp_info->input_size);
 		break;
 	case COMPIOC_GET_COMP_TYPE:
-		/* CONFIG_COMPRESSION_TYPE 1 for LZMA and 2 for MINIZ */
+		/* CONFIG_COMPRESSION_TYPE 1 for LZMA, 2 for MINIZ and 3 for LZ4 */
 		ret = CONFIG_COMPRESSION_TYPE;
 		break;
 	case COMPIOC_GET_COMP_NAME:
@@ -112,6 +112,9 @@ static int comp_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 			case MINIZ_TYPE:
 				memcpy((char *)arg, MINIZ_NAME, COMP_NAME_SIZE);
 				break;
+			case LZ4_TYPE:
+				memcpy((char *)arg, LZ4_NAME, sizeof(LZ4_NAME));
+				break;
 		}
 		ret = OK;
 		break;
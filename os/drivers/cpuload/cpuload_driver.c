@@ -100,6 +100,18 @@ static int cpuload_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 			ret = OK;
 		}
 		break;
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	case CPULOADIOC_GETCYCLES:
+		if (arg != 0) {
+			sched_get_cycles((FAR struct cpuload_cycles_s *)arg);
+			ret = OK;
+		}
+		break;
+	case CPULOADIOC_RESETCYCLES:
+		sched_reset_cycles();
+		ret = OK;
+		break;
+#endif
 	default:
 		break;
 	}
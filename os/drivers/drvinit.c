@@ -0,0 +1,275 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdbool.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+#include <semaphore.h>
+
+#include <tinyara/kthread.h>
+#include <tinyara/bootprof.h>
+#include <tinyara/drvinit.h>
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static FAR struct drvinit_s *g_drvinit_head;	/* Drivers by priority */
+static volatile int g_drvinit_npending;			/* Drivers not done */
+static int g_drvinit_nrunning;					/* Inits running */
+static bool g_drvinit_started;
+
+/* g_drvinit_lock protects the list.  Workers and open() waiting for an init
+ * wait on g_drvinit_change, which is posted once per waiter when an init is
+ * done.
+ */
+
+static sem_t g_drvinit_lock = SEM_INITIALIZER(1);
+static sem_t g_drvinit_change = SEM_INITIALIZER(0);
+static int g_drvinit_nwaiters;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void drvinit_semtake(FAR sem_t *sem)
+{
+	while (sem_wait(sem) < 0) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+/* Called with g_drvinit_lock held, which is released while waiting */
+
+static void drvinit_waitchange(void)
+{
+	g_drvinit_nwaiters++;
+	sem_post(&g_drvinit_lock);
+	drvinit_semtake(&g_drvinit_change);
+	drvinit_semtake(&g_drvinit_lock);
+}
+
+static void drvinit_setdone(FAR struct drvinit_s *drv, int result)
+{
+	drv->state = DRVINIT_DONE;
+	drv->result = result;
+	g_drvinit_npending--;
+
+	while (g_drvinit_nwaiters > 0) {
+		g_drvinit_nwaiters--;
+		sem_post(&g_drvinit_change);
+	}
+}
+
+static bool drvinit_isready(FAR struct drvinit_s *drv)
+{
+	FAR const char *const *dep;
+	FAR struct drvinit_s *other;
+
+	if (drv->depends == NULL) {
+		return true;
+	}
+
+	for (dep = drv->depends; *dep != NULL; dep++) {
+		for (other = g_drvinit_head; other != NULL; other = other->flink) {
+			if (strcmp(other->name, *dep) == 0) {
+				break;
+			}
+		}
+
+		/* A dependency not registered is initialized by the board already */
+
+		if (other != NULL && other->state != DRVINIT_DONE) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/****************************************************************************
+ * Name: drvinit_worker
+ *
+ * Description:
+ *   Run the init of the ready driver of highest priority until none is
+ *   left.  Drivers which can never be ready, by a cycle of dependencies,
+ *   fail with -EDEADLK.
+ *
+ ****************************************************************************/
+
+static int drvinit_worker(int argc, FAR char *argv[])
+{
+	FAR struct drvinit_s *drv;
+	int ret;
+
+	drvinit_semtake(&g_drvinit_lock);
+	while (g_drvinit_npending > 0) {
+		for (drv = g_drvinit_head; drv != NULL; drv = drv->flink) {
+			if (drv->state == DRVINIT_PENDING && drvinit_isready(drv)) {
+				break;
+			}
+		}
+
+		if (drv != NULL) {
+			drv->state = DRVINIT_RUNNING;
+			drv->pid = getpid();
+			g_drvinit_nrunning++;
+			sem_post(&g_drvinit_lock);
+
+			ret = drv->init();
+			if (ret < 0) {
+				dbg("Failed to initialize %s: %d\n", drv->name, ret);
+			}
+			bootprof_mark("init %s", drv->name);
+
+			drvinit_semtake(&g_drvinit_lock);
+			g_drvinit_nrunning--;
+			drvinit_setdone(drv, ret);
+		} else if (g_drvinit_nrunning > 0) {
+			drvinit_waitchange();
+		} else {
+			for (drv = g_drvinit_head; drv != NULL; drv = drv->flink) {
+				if (drv->state == DRVINIT_PENDING) {
+					dbg("Cycle of dependencies of %s\n", drv->name);
+					drvinit_setdone(drv, -EDEADLK);
+				}
+			}
+		}
+	}
+	sem_post(&g_drvinit_lock);
+
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: drvinit_register
+ ****************************************************************************/
+
+int drvinit_register(FAR struct drvinit_s *drv)
+{
+	FAR struct drvinit_s *prev;
+	FAR struct drvinit_s *next;
+
+	DEBUGASSERT(drv != NULL && drv->name != NULL && drv->init != NULL);
+
+	drvinit_semtake(&g_drvinit_lock);
+	if (g_drvinit_started) {
+		sem_post(&g_drvinit_lock);
+		return -EBUSY;
+	}
+
+	drv->state = DRVINIT_PENDING;
+	drv->pid = -1;
+	drv->result = 0;
+
+	/* Drivers of the same priority keep the order of registration */
+
+	prev = NULL;
+	for (next = g_drvinit_head; next != NULL && next->priority >= drv->priority; next = next->flink) {
+		prev = next;
+	}
+
+	drv->flink = next;
+	if (prev != NULL) {
+		prev->flink = drv;
+	} else {
+		g_drvinit_head = drv;
+	}
+	g_drvinit_npending++;
+	sem_post(&g_drvinit_lock);
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: drvinit_start
+ ****************************************************************************/
+
+void drvinit_start(void)
+{
+	int nthreads;
+	int i;
+
+	drvinit_semtake(&g_drvinit_lock);
+	g_drvinit_started = true;
+	nthreads = g_drvinit_npending;
+	sem_post(&g_drvinit_lock);
+
+	if (nthreads > CONFIG_DRIVER_DEFERRED_INIT_NTHREADS) {
+		nthreads = CONFIG_DRIVER_DEFERRED_INIT_NTHREADS;
+	}
+
+	for (i = 0; i < nthreads; i++) {
+		if (kernel_thread("drvinit", CONFIG_DRIVER_DEFERRED_INIT_PRIORITY, CONFIG_DRIVER_DEFERRED_INIT_STACKSIZE, drvinit_worker, NULL) < 0) {
+			dbg("Failed to start drvinit worker %d\n", i);
+			break;
+		}
+	}
+
+	/* Without any worker, the drivers are initialized here */
+
+	if (i == 0 && nthreads > 0) {
+		drvinit_worker(0, NULL);
+	}
+}
+
+/****************************************************************************
+ * Name: drvinit_wait
+ ****************************************************************************/
+
+void drvinit_wait(FAR const char *path)
+{
+	FAR struct drvinit_s *drv;
+	pid_t me;
+
+	if (g_drvinit_npending == 0) {
+		return;
+	}
+
+	me = getpid();
+	drvinit_semtake(&g_drvinit_lock);
+	for (;;) {
+		for (drv = g_drvinit_head; drv != NULL; drv = drv->flink) {
+			/* The init itself may open its devices */
+
+			if (drv->state != DRVINIT_DONE && drv->path != NULL && drv->pid != me && strncmp(path, drv->path, strlen(drv->path)) == 0) {
+				break;
+			}
+		}
+
+		if (drv == NULL) {
+			break;
+		}
+
+		drvinit_waitchange();
+	}
+	sem_post(&g_drvinit_lock);
+}
@@ -27,6 +27,9 @@
 #include <poll.h>
 #include <errno.h>
 #include <debug.h>
+#ifdef CONFIG_GPIO_EVENTS
+#include <time.h>
+#endif
 
 #include <tinyara/kmalloc.h>
 #include <tinyara/gpio.h>
@@ -105,6 +108,14 @@ struct gpio_open_s {
 	 */
 	FAR struct pollfd *go_fds[CONFIG_GPIO_NPOLLWAITERS];
 #endif
+
+#ifdef CONFIG_GPIO_EVENTS
+	/* Edges selected by the poll events, time stamped in the interrupt */
+	struct gpio_event_s go_events[CONFIG_GPIO_NEVENTS];
+	uint16_t go_evhead;	/* Next event written */
+	uint16_t go_evcount;	/* Number of events queued */
+	uint16_t go_evdropped;	/* Events lost since the last GPIOIOC_GET_EVENTS */
+#endif
 };
 
 /****************************************************************************
@@ -143,6 +154,49 @@ static inline void gpio_givesem(sem_t *sem)
 	sem_post(sem);
 }
 
+#ifdef CONFIG_GPIO_EVENTS
+/****************************************************************************
+ * Name: gpio_timestamp
+ *
+ * Description:
+ *    Return the current time in microseconds
+ *
+ ****************************************************************************/
+static uint64_t gpio_timestamp(void)
+{
+	struct timespec ts;
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+	clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: gpio_addevent
+ *
+ * Description:
+ *    Queue an edge for GPIOIOC_GET_EVENTS, dropping the oldest one if the
+ *    queue is full.  Called with interrupts disabled.
+ *
+ ****************************************************************************/
+static void gpio_addevent(FAR struct gpio_open_s *opriv, uint64_t timestamp, bool value)
+{
+	FAR struct gpio_event_s *event = &opriv->go_events[opriv->go_evhead];
+
+	event->timestamp = timestamp;
+	event->value = value;
+	opriv->go_evhead = (opriv->go_evhead + 1) % CONFIG_GPIO_NEVENTS;
+	if (opriv->go_evcount < CONFIG_GPIO_NEVENTS) {
+		opriv->go_evcount++;
+	} else {
+		opriv->go_evdropped++;
+	}
+}
+#endif
+
 static void gpio_sample(FAR struct gpio_upperhalf_s *priv)
 {
 	FAR struct gpio_lowerhalf_s *lower;
@@ -154,6 +208,9 @@ static void gpio_sample(FAR struct gpio_upperhalf_s *priv)
 #ifndef CONFIG_DISABLE_POLL
 	int i;
 #endif
+#ifdef CONFIG_GPIO_EVENTS
+	uint64_t timestamp = 0;
+#endif
 
 	DEBUGASSERT(priv && priv->gu_lower);
 	lower = priv->gu_lower;
@@ -172,6 +229,11 @@ static void gpio_sample(FAR struct gpio_upperhalf_s *priv)
 	change  = sample ^ priv->gu_sample;
 	rising  = (change && sample);
 	falling = (change && !sample);
+#ifdef CONFIG_GPIO_EVENTS
+	if (change) {
+		timestamp = gpio_timestamp();
+	}
+#endif
 
 	/* Visit each opened reference to the device */
 	for (opriv = priv->gu_open; opriv; opriv = opriv->go_flink) {
@@ -179,6 +241,9 @@ static void gpio_sample(FAR struct gpio_upperhalf_s *priv)
 		/* Have any poll events occurred? */
 		if ((rising  & opriv->go_pollevents.gp_rising) != 0 ||
 			(falling & opriv->go_pollevents.gp_falling) != 0) {
+#ifdef CONFIG_GPIO_EVENTS
+			gpio_addevent(opriv, timestamp, sample);
+#endif
 			for (i = 0; i < CONFIG_GPIO_NPOLLWAITERS; i++) {
 				FAR struct pollfd *fds = opriv->go_fds[i];
 				if (fds) {
@@ -428,6 +493,10 @@ static int gpio_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 			/* Save the poll events */
 			opriv->go_pollevents.gp_rising  = pollevents->gp_rising;
 			opriv->go_pollevents.gp_falling = pollevents->gp_falling;
+#ifdef CONFIG_GPIO_EVENTS
+			opriv->go_evcount = 0;
+			opriv->go_evdropped = 0;
+#endif
 
 			/* Enable/disable interrupt handling */
 			gpio_enable(priv);
@@ -437,6 +506,36 @@ static int gpio_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 	}
 #endif /* CONFIG_DISABLE_POLL */
 
+#ifdef CONFIG_GPIO_EVENTS
+	case GPIOIOC_GET_EVENTS: {
+		FAR struct gpio_events_s *events =
+			(FAR struct gpio_events_s *)((uintptr_t)arg);
+		irqstate_t flags;
+		int tail;
+		int i;
+
+		if (events == NULL || events->events == NULL || events->nevents < 0) {
+			ret = -EINVAL;
+			break;
+		}
+
+		/* Take the events oldest first */
+		flags = enter_critical_section();
+		tail = (opriv->go_evhead + CONFIG_GPIO_NEVENTS - opriv->go_evcount) % CONFIG_GPIO_NEVENTS;
+		for (i = 0; i < events->nevents && opriv->go_evcount > 0; i++) {
+			events->events[i] = opriv->go_events[tail];
+			tail = (tail + 1) % CONFIG_GPIO_NEVENTS;
+			opriv->go_evcount--;
+		}
+		events->ndropped = opriv->go_evdropped;
+		opriv->go_evdropped = 0;
+		leave_critical_section(flags);
+
+		ret = i;
+		break;
+	}
+#endif /* CONFIG_GPIO_EVENTS */
+
 #ifndef CONFIG_DISABLE_SIGNALS
 	case GPIOIOC_REGISTER: {
 		FAR struct gpio_notify_s *notify =
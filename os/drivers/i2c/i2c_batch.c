@@ -0,0 +1,240 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <errno.h>
+#include <debug.h>
+#include <queue.h>
+
+#include <tinyara/irq.h>
+#include <tinyara/i2c.h>
+#ifdef CONFIG_I2C_ASYNC
+#include <tinyara/wqueue.h>
+#endif
+
+#if defined(CONFIG_I2C_TRANSFER) && defined(CONFIG_I2C_BATCH)
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+#ifdef CONFIG_I2C_ASYNC
+/* The requests of all buses, in the order they were queued */
+
+static sq_queue_t g_i2c_requests;
+static struct work_s g_i2c_work;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2c_batch_nmsgs
+ *
+ * Description:
+ *   Return the number of messages of the transaction.  A transaction without
+ *   data is sent as an empty write, which probes the device.
+ *
+ ****************************************************************************/
+
+static int i2c_batch_nmsgs(FAR struct i2c_trans_s *trans)
+{
+	if (trans->rbuflen > 0 && trans->wbuflen > 0) {
+		return 2;
+	}
+	return 1;
+}
+
+/****************************************************************************
+ * Name: i2c_batch_msgs
+ *
+ * Description:
+ *   Format the messages of the transaction, like i2c_writeread(), and
+ *   return their number.
+ *
+ ****************************************************************************/
+
+static int i2c_batch_msgs(FAR struct i2c_trans_s *trans, FAR struct i2c_msg_s *msg)
+{
+	FAR const struct i2c_config_s *config = trans->config;
+	unsigned int flags;
+	int nmsgs = 0;
+
+	DEBUGASSERT(config->addrlen == 10 || config->addrlen == 7);
+	flags = (config->addrlen == 10) ? I2C_M_TEN : 0;
+
+	if (trans->wbuflen > 0 || trans->rbuflen <= 0) {
+		msg[nmsgs].addr = config->address;
+		msg[nmsgs].flags = flags;
+		msg[nmsgs].buffer = (FAR uint8_t *)trans->wbuffer;	/* Override const */
+		msg[nmsgs].length = trans->wbuflen > 0 ? trans->wbuflen : 0;
+		nmsgs++;
+	}
+
+	if (trans->rbuflen > 0) {
+		msg[nmsgs].addr = config->address;
+		msg[nmsgs].flags = (flags | I2C_M_READ);
+		msg[nmsgs].buffer = trans->rbuffer;
+		msg[nmsgs].length = trans->rbuflen;
+		nmsgs++;
+	}
+
+	return nmsgs;
+}
+
+#ifdef CONFIG_I2C_ASYNC
+/****************************************************************************
+ * Name: i2c_async_worker
+ *
+ * Description:
+ *   Perform the queued requests until the queue is empty
+ *
+ ****************************************************************************/
+
+static void i2c_async_worker(FAR void *arg)
+{
+	FAR struct i2c_request_s *req;
+	irqstate_t flags;
+	int ret;
+
+	for (;;) {
+		flags = enter_critical_section();
+		req = (FAR struct i2c_request_s *)sq_remfirst(&g_i2c_requests);
+		leave_critical_section(flags);
+
+		if (req == NULL) {
+			break;
+		}
+
+		ret = i2c_transfer_batch(req->dev, req->trans, req->ntrans);
+		if (req->callback) {
+			req->callback(req->arg, ret);
+		}
+	}
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2c_transfer_batch
+ *
+ * Description:
+ *   See include/tinyara/i2c.h
+ *
+ ****************************************************************************/
+
+int i2c_transfer_batch(FAR struct i2c_dev_s *dev, FAR struct i2c_trans_s *trans, int ntrans)
+{
+	struct i2c_msg_s msgs[CONFIG_I2C_BATCH_NMSGS];
+	uint32_t frequency = 0;
+	int first;
+	int last;
+	int index;
+	int nmsgs;
+	int result;
+	int ret = OK;
+
+	if (dev == NULL || trans == NULL || ntrans < 0) {
+		return -EINVAL;
+	}
+
+	for (first = 0; first < ntrans; first = last) {
+		/* Join the following transactions at the same frequency */
+
+		nmsgs = 0;
+		for (last = first; last < ntrans; last++) {
+			if (last > first && (trans[last].config->frequency != trans[first].config->frequency || nmsgs + i2c_batch_nmsgs(&trans[last]) > CONFIG_I2C_BATCH_NMSGS)) {
+				break;
+			}
+			nmsgs += i2c_batch_msgs(&trans[last], &msgs[nmsgs]);
+		}
+
+		if (frequency != trans[first].config->frequency) {
+			frequency = trans[first].config->frequency;
+			I2C_SETFREQUENCY(dev, frequency);
+		}
+
+		result = I2C_TRANSFER(dev, msgs, nmsgs);
+		if (result < 0 && last - first > 1) {
+			/* Find out which transactions failed */
+
+			i2cinfo("batch of %d failed %d, retry one by one\n", last - first, result);
+			for (index = first; index < last; index++) {
+				nmsgs = i2c_batch_msgs(&trans[index], msgs);
+				result = I2C_TRANSFER(dev, msgs, nmsgs);
+				trans[index].result = result < 0 ? result : OK;
+			}
+		} else {
+			for (index = first; index < last; index++) {
+				trans[index].result = result < 0 ? result : OK;
+			}
+		}
+
+		for (index = first; index < last && ret == OK; index++) {
+			ret = trans[index].result;
+		}
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_I2C_ASYNC
+/****************************************************************************
+ * Name: i2c_transfer_async
+ *
+ * Description:
+ *   See include/tinyara/i2c.h
+ *
+ ****************************************************************************/
+
+int i2c_transfer_async(FAR struct i2c_request_s *req)
+{
+	irqstate_t flags;
+	int ret = OK;
+
+	if (req == NULL || req->dev == NULL || (req->trans == NULL && req->ntrans > 0)) {
+		return -EINVAL;
+	}
+
+	flags = enter_critical_section();
+	sq_addlast((FAR sq_entry_t *)req, &g_i2c_requests);
+
+	/* The worker drains the whole queue, so it is queued only when idle */
+
+	if (work_available(&g_i2c_work)) {
+		ret = work_queue(LPWORK, &g_i2c_work, i2c_async_worker, NULL, 0);
+		if (ret != OK) {
+			sq_rem((FAR sq_entry_t *)req, &g_i2c_requests);
+		}
+	}
+	leave_critical_section(flags);
+
+	return ret;
+}
+#endif
+
+#endif /* CONFIG_I2C_TRANSFER && CONFIG_I2C_BATCH */
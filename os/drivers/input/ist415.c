@@ -51,6 +51,7 @@
 #include <unistd.h>
 
 #include <tinyara/config.h>
+#include <tinyara/clock.h>
 #include <tinyara/i2c.h>
 #include <tinyara/irq.h>
 #include <tinyara/wdog.h>
@@ -110,6 +111,7 @@ static void ist415_forced_release(struct ist415_dev_s *dev)
 	struct touch_sample_s data;
 
 	data.npoints = 0;
+	data.timestamp = TICK2USEC(clock_systimer());
 	for (int i = 0; i < TOUCH_MAX_POINTS; i++) {
 		if (dev->touched[i] == true) {
 			ist415vdbg("Forced touch release: %d\n", i);
@@ -221,6 +223,7 @@ static int ist415_process_event(struct ist415_dev_s *dev)
 		}
 	}
 	data.npoints = 0;
+	data.timestamp = TICK2USEC(dev->irq_time);
 	for (int i = 0; i < (left_e + 1); i++) {
 		eid = (touch_event + (i * EVENT_PACKET_SIZE))[0] & 0x3;
 		if (eid == EID_COORD) {
@@ -326,6 +329,7 @@ static int ist415_process_event(struct ist415_dev_s *dev)
 					pdata.point[0].pressure = 0;
 					pdata.point[0].flags = TOUCH_DOWN;
 					pdata.npoints = 1;
+					pdata.timestamp = data.timestamp;
 					touch_report(dev->upper, &pdata);
 					pdata.point[0].flags = TOUCH_UP;
 					touch_report(dev->upper, &pdata);
@@ -752,6 +756,9 @@ static void touch_interrupt(struct ist415_config_s *config)
 	int ret;
 	struct ist415_dev_s *dev = (struct ist415_dev_s *)config->upper;
 
+	/* The events are read later by the thread, they happened now */
+	dev->irq_time = clock_systimer();
+
 	ret = sem_getvalue(&dev->wait_irq, &sem_cnt);
 	if (ret == OK && sem_cnt < 1) {
 		sem_post(&dev->wait_irq);
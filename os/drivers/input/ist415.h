@@ -425,6 +425,7 @@ struct ist415_dev_s {
 
 	bool touched[TOUCH_MAX_POINTS];
 	bool irq_working;
+	clock_t irq_time;			/* Time of the last interrupt, the time of its events */
 	bool event_mode;
 
 	uint8_t alive_retry;
@@ -49,6 +49,7 @@
 #include <errno.h>
 #include <debug.h>
 #include <fcntl.h>
+#include <tinyara/clock.h>
 #include <tinyara/fs/fs.h>
 #include <tinyara/fs/ioctl.h>
 #include <tinyara/input/touchscreen.h>
@@ -334,6 +335,36 @@ static int touch_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 	return ret;
 }
 
+#if defined(CONFIG_TOUCH_COALESCE_MOVES)
+
+/****************************************************************************
+ * Name: touch_is_same_move
+ *
+ * Description:
+ *   Check if two samples are moves only, of the same points.
+ *
+ ****************************************************************************/
+
+static bool touch_is_same_move(FAR const struct touch_sample_s *prev, FAR const struct touch_sample_s *next)
+{
+	int i;
+
+	if (prev->npoints != next->npoints || next->npoints == 0) {
+		return false;
+	}
+
+	for (i = 0; i < next->npoints; i++) {
+		if (prev->point[i].id != next->point[i].id ||
+			(prev->point[i].flags & (TOUCH_DOWN | TOUCH_MOVE | TOUCH_UP)) != TOUCH_MOVE ||
+			(next->point[i].flags & (TOUCH_DOWN | TOUCH_MOVE | TOUCH_UP)) != TOUCH_MOVE) {
+			return false;
+		}
+	}
+
+	return true;
+}
+#endif
+
 #if !defined(CONFIG_DISABLE_POLL)
 
 /****************************************************************************
@@ -431,6 +462,9 @@ void touch_report(struct touchscreen_s *dev, struct touch_sample_s *data)
 {
 	struct touch_sample_buffer_s *tp_buf;
 	int nexthead;
+#if defined(CONFIG_TOUCH_COALESCE_MOVES)
+	int last;
+#endif
 	int semcount;
 	int ret;
 
@@ -443,8 +477,27 @@ void touch_report(struct touchscreen_s *dev, struct touch_sample_s *data)
 		return;
 	}
 
+	if (data->timestamp == 0) {
+		data->timestamp = TICK2USEC(clock_systimer());
+	}
+
 	touch_semtake(&tp_buf->sem, false);
 
+#if defined(CONFIG_TOUCH_COALESCE_MOVES)
+	/* The newest unread sample is replaced by a move following it, the
+	 * reader needs the latest position and its time only.
+	 */
+
+	if (tp_buf->head != tp_buf->tail) {
+		last = (tp_buf->head == 0 ? tp_buf->size : tp_buf->head) - 1;
+		if (touch_is_same_move(&tp_buf->buffer[last], data)) {
+			memcpy(&tp_buf->buffer[last], data, sizeof(struct touch_sample_s));
+			touch_semgive(&tp_buf->sem);
+			return;
+		}
+	}
+#endif
+
 	nexthead = tp_buf->head + 1;
 	if (nexthead >= tp_buf->size) {
 		nexthead = 0;
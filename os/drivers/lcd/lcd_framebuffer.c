@@ -57,10 +57,18 @@
 #include <tinyara/config.h>
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 #include <errno.h>
 #include <debug.h>
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+#include <semaphore.h>
+#include <sched.h>
+#include <tinyara/clock.h>
+#include <tinyara/irq.h>
+#include <tinyara/kthread.h>
+#endif
 
 #include <tinyara/board.h>
 #include <tinyara/kmalloc.h>
@@ -94,6 +102,16 @@ struct lcdfb_dev_s {
 	fb_coord_t yres;                  /* Vertical resolution in pixel rows */
 	fb_coord_t stride;                /* Width of a row in bytes */
 	uint8_t display;                  /* Display number */
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+	FAR uint8_t *flushmem;            /* Area being transferred, rows packed */
+	struct nxgl_rect_s flushrect;     /* Clipped area in flushmem */
+	sem_t flushsem;                   /* Posted when flushmem is to be sent */
+	sem_t donesem;                    /* Posted when flushmem is free again */
+	pid_t flushpid;                   /* Thread sending flushmem */
+	clock_t reqtime;                  /* When the transfer was requested */
+	uint64_t total_us;                /* Sum of the frame times */
+	struct fb_framestats_s stats;     /* Frame counters */
+#endif
 };
 
 /****************************************************************************
@@ -114,6 +132,18 @@ static int lcdfb_getvideoinfo(FAR struct fb_vtable_s *vtable,
 static int lcdfb_getplaneinfo(FAR struct fb_vtable_s *vtable, int planeno,
 			FAR struct fb_planeinfo_s *pinfo);
 
+/* The following are provided only if the framebuffer is double buffered */
+
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+#ifdef CONFIG_FB_SYNC
+static int lcdfb_waitforvsync(FAR struct fb_vtable_s *vtable);
+#endif
+#ifdef CONFIG_FB_FRAMESTATS
+static int lcdfb_getframestats(FAR struct fb_vtable_s *vtable,
+			FAR struct fb_framestats_s *stats);
+#endif
+#endif
+
 /* The following is provided only if the video hardware supports RGB color
  * mapping
  */
@@ -178,6 +208,128 @@ static FAR struct lcdfb_dev_s *lcdfb_find(int display)
 	return NULL;
 }
 
+/****************************************************************************
+ * Name: lcdfb_flush_thread
+ *
+ * Description:
+ *   Send the area copied to flushmem to the LCD, on the vertical sync of
+ *   the panel if it signals one, while the next frame is drawn.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+static int lcdfb_flush_thread(int argc, char **argv)
+{
+	FAR struct lcdfb_dev_s *priv;
+	FAR struct lcd_planeinfo_s *pinfo;
+	FAR struct nxgl_rect_s *rect;
+	FAR uint8_t *run;
+	fb_coord_t row;
+	irqstate_t flags;
+	uint32_t elapsed;
+	int bytespl;
+	int ret;
+
+	DEBUGASSERT(argc == 2);
+	priv = (FAR struct lcdfb_dev_s *)strtoul(argv[1], NULL, 16);
+	pinfo = &priv->pinfo;
+	rect = &priv->flushrect;
+
+	while (true) {
+		while (sem_wait(&priv->flushsem) != OK) {
+			ASSERT(get_errno() == EINTR);
+		}
+
+		if (pinfo->waitvsync) {
+			ret = pinfo->waitvsync();
+			if (ret < 0) {
+				gdbg("ERROR: LCD waitvsync failed: %d\n", ret);
+			}
+		}
+
+		if (pinfo->putdma) {
+			ret = pinfo->putdma(rect->pt1.y, rect->pt1.x, rect->pt2.y, rect->pt2.x, priv->flushmem);
+		} else {
+			bytespl = ((rect->pt2.x - rect->pt1.x + 1) * pinfo->bpp + 7) >> 3;
+			run = priv->flushmem;
+			ret = OK;
+			for (row = rect->pt1.y; row <= rect->pt2.y && ret >= 0; row++) {
+				ret = pinfo->putrun(priv->lcd, row, rect->pt1.x, run, rect->pt2.x - rect->pt1.x + 1);
+				run += bytespl;
+			}
+		}
+		if (ret < 0) {
+			gdbg("ERROR: LCD transfer failed: %d\n", ret);
+		}
+
+		elapsed = TICK2USEC(clock_systimer() - priv->reqtime);
+		flags = enter_critical_section();
+		priv->stats.frames++;
+		priv->stats.last_us = elapsed;
+		if (elapsed > priv->stats.max_us) {
+			priv->stats.max_us = elapsed;
+		}
+		priv->total_us += elapsed;
+		leave_critical_section(flags);
+
+		sem_post(&priv->donesem);
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: lcdfb_post
+ *
+ * Description:
+ *   Copy a clipped area of the framebuffer to flushmem and let the flush
+ *   thread send it.  Only the copy is done by the caller, unless the
+ *   previous transfer is still running.
+ *
+ ****************************************************************************/
+
+static int lcdfb_post(FAR struct lcdfb_dev_s *priv, fb_coord_t startx,
+			fb_coord_t starty, fb_coord_t endx, fb_coord_t endy)
+{
+	FAR struct lcd_planeinfo_s *pinfo = &priv->pinfo;
+	FAR uint8_t *run;
+	FAR uint8_t *dest;
+	fb_coord_t row;
+	int bytespl;
+
+	/* The frame drawn meanwhile missed the transfer slot it was drawn for */
+
+	if (sem_trywait(&priv->donesem) != OK) {
+		priv->stats.dropped++;
+		while (sem_wait(&priv->donesem) != OK) {
+			ASSERT(get_errno() == EINTR);
+		}
+	}
+
+	bytespl = ((endx - startx + 1) * pinfo->bpp + 7) >> 3;
+	run = priv->fbmem + starty * priv->stride + ((startx * pinfo->bpp + 7) >> 3);
+	dest = priv->flushmem;
+	if (bytespl == priv->stride) {
+		memcpy(dest, run, (endy - starty + 1) * bytespl);
+	} else {
+		for (row = starty; row <= endy; row++) {
+			memcpy(dest, run, bytespl);
+			dest += bytespl;
+			run += priv->stride;
+		}
+	}
+
+	priv->flushrect.pt1.x = startx;
+	priv->flushrect.pt1.y = starty;
+	priv->flushrect.pt2.x = endx;
+	priv->flushrect.pt2.y = endy;
+	priv->reqtime = clock_systimer();
+
+	sem_post(&priv->flushsem);
+	return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: lcdfb_update
  *
@@ -240,6 +392,10 @@ static int lcdfb_update(FAR struct lcdfb_dev_s *priv,
 
 	width = endx - startx + 1;
 
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+	return lcdfb_post(priv, startx, starty, endx, endy);
+#endif
+
 #ifdef CONFIG_LCD_DMA_SUPPORT
 	if (pinfo->putdma) {
 		if (width == priv->xres) {
@@ -372,6 +528,55 @@ static int lcdfb_getplaneinfo(FAR struct fb_vtable_s *vtable, int planeno,
 	return ret;
 }
 
+/****************************************************************************
+ * Name: lcdfb_waitforvsync
+ *
+ * Description:
+ *   Wait until the last update is on the display.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_LCD_FRAMEBUFFER_DOUBLE) && defined(CONFIG_FB_SYNC)
+static int lcdfb_waitforvsync(FAR struct fb_vtable_s *vtable)
+{
+	FAR struct lcdfb_dev_s *priv = (FAR struct lcdfb_dev_s *)vtable;
+
+	DEBUGASSERT(priv != NULL);
+
+	while (sem_wait(&priv->donesem) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+	sem_post(&priv->donesem);
+
+	return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: lcdfb_getframestats
+ ****************************************************************************/
+
+#if defined(CONFIG_LCD_FRAMEBUFFER_DOUBLE) && defined(CONFIG_FB_FRAMESTATS)
+static int lcdfb_getframestats(FAR struct fb_vtable_s *vtable,
+				FAR struct fb_framestats_s *stats)
+{
+	FAR struct lcdfb_dev_s *priv = (FAR struct lcdfb_dev_s *)vtable;
+	irqstate_t flags;
+
+	DEBUGASSERT(priv != NULL);
+	if (stats == NULL) {
+		return -EINVAL;
+	}
+
+	flags = enter_critical_section();
+	*stats = priv->stats;
+	stats->avg_us = stats->frames ? (uint32_t)(priv->total_us / stats->frames) : 0;
+	leave_critical_section(flags);
+
+	return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: lcdfb_getcmap
  ****************************************************************************/
@@ -527,6 +732,10 @@ int up_fbinitialize(int display)
 	FAR struct lcd_dev_s *lcd;
 	struct fb_videoinfo_s vinfo;
 	struct nxgl_rect_s rect;
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+	FAR char *flush_argv[2];
+	char flush_arg[9];                /* Address of the state, in hex */
+#endif
 	int ret;
 
 	gvdbg("display=%d\n", display);
@@ -554,6 +763,14 @@ int up_fbinitialize(int display)
 	priv->vtable.getcursor    = lcdfb_getcursor,
 	priv->vtable.setcursor    = lcdfb_setcursor,
 #endif
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+#ifdef CONFIG_FB_SYNC
+	priv->vtable.waitforvsync = lcdfb_waitforvsync,
+#endif
+#ifdef CONFIG_FB_FRAMESTATS
+	priv->vtable.getframestats = lcdfb_getframestats,
+#endif
+#endif
 
 #ifdef  CONFIG_LCD_EXTERNINIT
 	/* Use external graphics driver initialization */
@@ -615,6 +832,30 @@ int up_fbinitialize(int display)
 		goto errout_with_lcd;
 	}
 
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+	/* Allocate the second buffer and start the thread sending it */
+
+	priv->flushmem = (FAR uint8_t *)kmm_malloc(priv->fblen);
+	if (priv->flushmem == NULL) {
+		gdbg("ERROR: Failed to allocate flush buffer memory\n");
+		ret = -ENOMEM;
+		goto errout_with_fbmem;
+	}
+
+	sem_init(&priv->flushsem, 0, 0);
+	sem_init(&priv->donesem, 0, 1);
+
+	itoa((int)priv, flush_arg, 16);
+	flush_argv[0] = flush_arg;
+	flush_argv[1] = NULL;
+	priv->flushpid = kernel_thread("lcdfb_flush", CONFIG_LCD_FRAMEBUFFER_FLUSH_PRIORITY, CONFIG_LCD_FRAMEBUFFER_FLUSH_STACKSIZE, lcdfb_flush_thread, (FAR char *const *)flush_argv);
+	if (priv->flushpid < 0) {
+		gdbg("ERROR: Failed to start flush thread: %d\n", priv->flushpid);
+		ret = priv->flushpid;
+		goto errout_with_flushmem;
+	}
+#endif
+
 	/* Add the state structure to the list of framebuffer interfaces */
 
 	priv->flink = g_lcdfb;
@@ -637,6 +878,16 @@ int up_fbinitialize(int display)
 	(void)priv->lcd->setpower(priv->lcd, ((3*CONFIG_LCD_MAXPOWER + 3)/4));
 	return OK;
 
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+errout_with_flushmem:
+	sem_destroy(&priv->flushsem);
+	sem_destroy(&priv->donesem);
+	kmm_free(priv->flushmem);
+
+errout_with_fbmem:
+	kmm_free(priv->fbmem);
+#endif
+
 errout_with_lcd:
 #ifndef CONFIG_LCD_EXTERNINIT
 	board_lcd_uninitialize();
@@ -725,6 +976,18 @@ void up_fbuninitialize(int display)
 			board_lcd_uninitialize();
 #endif
 
+#ifdef CONFIG_LCD_FRAMEBUFFER_DOUBLE
+			/* Let the last transfer end before stopping its thread */
+
+			while (sem_wait(&priv->donesem) != OK) {
+				ASSERT(get_errno() == EINTR);
+			}
+			task_delete(priv->flushpid);
+			sem_destroy(&priv->flushsem);
+			sem_destroy(&priv->donesem);
+			kmm_free(priv->flushmem);
+#endif
+
 			/* Free the frame buffer allocation */
 
 			kmm_free(priv->fbmem);
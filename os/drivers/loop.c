@@ -75,6 +75,7 @@
 
 #include <tinyara/kmalloc.h>
 #include <tinyara/fs/fs.h>
+#include <tinyara/fs/ioctl.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -97,6 +98,7 @@ struct loop_struct_s {
 	bool writeenabled;			/* true: can write to device */
 #endif
 	int fd;						/* Descriptor of char device/file */
+	FAR uint8_t *mapbase;		/* First sector in memory, if the file is mapped */
 };
 
 /****************************************************************************
@@ -111,6 +113,7 @@ static ssize_t loop_read(FAR struct inode *inode, FAR unsigned char *buffer, siz
 static ssize_t loop_write(FAR struct inode *inode, FAR const unsigned char *buffer, size_t start_sector, unsigned int nsectors);
 #endif
 static int loop_geometry(FAR struct inode *inode, FAR struct geometry *geometry);
+static int loop_ioctl(FAR struct inode *inode, int cmd, unsigned long arg);
 
 /****************************************************************************
  * Private Data
@@ -126,7 +129,7 @@ static const struct block_operations g_bops = {
 	NULL,						/* write    */
 #endif
 	loop_geometry,				/* geometry */
-	NULL						/* ioctl    */
+	loop_ioctl					/* ioctl    */
 };
 
 /****************************************************************************
@@ -246,6 +249,13 @@ static ssize_t loop_read(FAR struct inode *inode, FAR unsigned char *buffer, siz
 		return -EIO;
 	}
 
+	/* A file mapped to memory is copied directly */
+
+	if (dev->mapbase) {
+		memcpy(buffer, &dev->mapbase[start_sector * dev->sectsize], nsectors * dev->sectsize);
+		return nsectors;
+	}
+
 	/* Calculate the offset to read the sectors and seek to the position */
 
 	offset = start_sector * dev->sectsize + dev->offset;
@@ -288,6 +298,17 @@ static ssize_t loop_write(FAR struct inode *inode, FAR const unsigned char *buff
 	DEBUGASSERT(inode && inode->i_private);
 	dev = (FAR struct loop_struct_s *)inode->i_private;
 
+	/* A file mapped to memory is copied directly */
+
+	if (dev->mapbase) {
+		if (start_sector + nsectors > dev->nsectors) {
+			return -EFBIG;
+		}
+
+		memcpy(&dev->mapbase[start_sector * dev->sectsize], buffer, nsectors * dev->sectsize);
+		return nsectors;
+	}
+
 	/* Calculate the offset to write the sectors and seek to the position */
 
 	offset = start_sector * dev->sectsize + dev->offset;
@@ -341,6 +362,33 @@ static int loop_geometry(FAR struct inode *inode, FAR struct geometry *geometry)
 	return -EINVAL;
 }
 
+/****************************************************************************
+ * Name: loop_ioctl
+ *
+ * Description: Return the memory address of a mapped file
+ *
+ ****************************************************************************/
+
+static int loop_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
+{
+	FAR struct loop_struct_s *dev;
+	FAR void **ppv = (FAR void **)((uintptr_t)arg);
+
+	DEBUGASSERT(inode && inode->i_private);
+	dev = (FAR struct loop_struct_s *)inode->i_private;
+
+	if (cmd == BIOC_DIRECTMAP && ppv) {
+		if (!dev->mapbase) {
+			return -ENODEV;
+		}
+
+		*ppv = (FAR void *)dev->mapbase;
+		return OK;
+	}
+
+	return -ENOTTY;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -418,7 +466,7 @@ int losetup(FAR const char *devname, FAR const char *filename, uint16_t sectsize
 	{
 		/* If that fails, then try to open the device read-only */
 
-		dev->fd = open(filename, O_RDWR);
+		dev->fd = open(filename, O_RDONLY);
 		if (dev->fd < 0) {
 			dbg("Failed to open %s: %d\n", filename, get_errno());
 			ret = -get_errno();
@@ -426,6 +474,17 @@ int losetup(FAR const char *devname, FAR const char *filename, uint16_t sectsize
 		}
 	}
 
+	/* Files that are contiguous in memory (tmpfs, XIP romfs) are accessed
+	 * directly instead of with lseek(), read() and write().
+	 */
+
+	if (ioctl(dev->fd, FIOC_MMAP, (unsigned long)((uintptr_t)&dev->mapbase)) == OK && dev->mapbase) {
+		dev->mapbase += offset;
+		fvdbg("%s mapped at %p\n", filename, dev->mapbase);
+	} else {
+		dev->mapbase = NULL;
+	}
+
 	/* Inode private data will be reference to the loop device structure */
 
 	ret = register_blockdriver(devname, &g_bops, 0, dev);
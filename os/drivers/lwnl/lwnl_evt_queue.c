@@ -18,11 +18,11 @@
 
 #include <tinyara/config.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <net/if.h>
 #include <pthread.h>
 #include <debug.h>
-#include <queue.h>
 #include <tinyara/kmalloc.h>
 #include <tinyara/net/if/wifi.h>
 #include "lwnl_evt_queue.h"
@@ -37,21 +37,45 @@
 		sem_post(&g_wm_sem);					\
 	} while (0)
 
-#define CONTAINER_OF(ptr, type, member)									\
-			((type *)((char *)(ptr) - (size_t)(&((type *)0)->member)))
-
-#define LWQ_GET_EVT(ptr)\
-	CONTAINER_OF(ptr, struct lwnl_event, entry)
-
 #define LWQ_EVENT_HEADER (sizeof(lwnl_cb_status) + sizeof(uint32_t))
 
 #define TAG "[LWQ]"
 
+#ifndef CONFIG_LWNL_EVENT_RING_SIZE
+#define CONFIG_LWNL_EVENT_RING_SIZE 16
+#endif
+
+#ifndef CONFIG_LWNL_EVENT_DATA_SIZE
+#define CONFIG_LWNL_EVENT_DATA_SIZE 80
+#endif
+
+#if (CONFIG_LWNL_EVENT_RING_SIZE & (CONFIG_LWNL_EVENT_RING_SIZE - 1)) != 0
+#error "CONFIG_LWNL_EVENT_RING_SIZE must be a power of 2"
+#endif
+
+#define LWQ_RING_MASK (CONFIG_LWNL_EVENT_RING_SIZE - 1)
+#define LWQ_SLOT(ring, seq) (&(ring)->slot[(seq) & LWQ_RING_MASK])
+
+/* check_header of a listener whose event was overwritten between the
+ * header and the data */
+#define LWQ_DATA_LOST -1
+
+/* Payloads up to CONFIG_LWNL_EVENT_DATA_SIZE are copied into the slot.
+ * data points to buf then, or to a buffer of the heap the slot owns. */
 struct lwnl_event {
 	lwnl_cb_data data;
-	int8_t refs;
-	sq_entry_t entry;
+	char buf[CONFIG_LWNL_EVENT_DATA_SIZE];
+};
+
+/* Events of a device type. Every listener of the type reads them in order
+ * from its own cursor, so an event is written once for all of them. head
+ * is the sequence number of the next event; the slots from head - SIZE to
+ * head - 1 hold the last events. */
+struct lwnl_ring {
+	struct lwnl_event slot[CONFIG_LWNL_EVENT_RING_SIZE];
+	uint32_t head;
 };
+
 /*  every filep has own lwnl_filep. their relation is 1:1 */
 struct lwnl_filep {
 	struct file *filep; // file index
@@ -59,88 +83,53 @@ struct lwnl_filep {
 	 * because a caller doesn't know how many data to read at first time.
 	 * So filep read event type and data length at first then it read rest of data if
 	 * data length isn't 0.
-	 * A queue which belong to the filep has to store context to return data in second read().
-	 * check_header stores the context of queue status because lwnl_filep is dedicated to filep.
-	 * lwnl_event are shared to filep so it can't be used to store context.
+	 * The cursor stays on the event between the two read() so that
+	 * check_header stores the context of the second read().
 	 * check_header 0: initial state. if there is data to send then assign 1
-	 * check_header 1: there is data to send. */
+	 * check_header 1: there is data to send.
+	 * check_header LWQ_DATA_LOST: the event was overwritten before its data was read */
 	int8_t check_header;
 	lwnl_dev_type type; // queue for wi-fi or ble
-	sq_queue_t queue;
-	uint32_t queue_size;
+	uint32_t tail; // sequence number of the next event to read
+	uint32_t lost; // events overwritten before they were read
 };
 
-/* protect g_filep_list and g_connected*/
+/* protect g_filep_list, g_ring and g_connected */
 static sem_t g_wm_sem;
 /* both data should be protected by LWQ_LOCK */
 static struct lwnl_filep g_filep_list[LWNL_NPOLLWAITERS];
-static sq_queue_t g_event_queue[LWNL_DEV_TYPE_MAX];
+static struct lwnl_ring g_ring[LWNL_DEV_TYPE_MAX];
 /* inserted event has to know how many fd wait */
 static int g_connected[LWNL_DEV_TYPE_MAX] = {0, };
-static int g_totalevt = 0; /*  debugging */
 
-static void _lwnl_remove_event_filep(struct lwnl_filep *lfp)
+static void _lwnl_release_data(struct lwnl_event *evt)
 {
-	sq_queue_t *queue = &lfp->queue;
-	if (queue->head == queue->tail) {
-		queue->head = queue->tail = NULL;
-	} else {
-		queue->head = queue->head->flink;
+	if (evt->data.data && evt->data.data != evt->buf) {
+		kmm_free(evt->data.data);
 	}
-	lfp->queue_size--;
+	evt->data.data = NULL;
+	evt->data.data_len = 0;
 }
 
-static int _lwnl_update_event_filep(struct lwnl_event *evt)
+/* this function is protected by LWQ_LOCK.
+ * The slot of the oldest event is reused: listeners which didn't read it
+ * yet skip it. */
+static void _lwnl_make_room(struct lwnl_ring *ring, lwnl_dev_type dtype)
 {
-	int check = 0;
-	uint32_t refs = 0;
-	LWNL_LOGI(TAG, "%p\ttotal evt %d", evt, g_totalevt);
-	LWQ_LOCK;
-	lwnl_dev_type dtype = evt->data.status.type;
+	uint32_t oldest = ring->head - CONFIG_LWNL_EVENT_RING_SIZE;
+
 	for (int i = 0; i < LWNL_NPOLLWAITERS; i++) {
-		if (g_filep_list[i].filep && g_filep_list[i].type == dtype) {
-			check = 1;
-			if (g_filep_list[i].queue.head == NULL) {
-				g_filep_list[i].queue.head = &evt->entry;
-				g_filep_list[i].queue.tail = &evt->entry;
-			} else {
-				g_filep_list[i].queue.tail = &evt->entry;
+		struct lwnl_filep *fp = &g_filep_list[i];
+		if (fp->filep && fp->type == dtype && fp->tail == oldest) {
+			fp->tail++;
+			fp->lost++;
+			if (fp->check_header == 1) {
+				fp->check_header = LWQ_DATA_LOST;
 			}
-			g_filep_list[i].queue_size++;
-			refs++;
+			LWNL_LOGE(TAG, "fp %p lost an event (total %u)", fp->filep, fp->lost);
 		}
 	}
-	evt->refs = g_connected[dtype];
-	if (check == 1) {
-		g_totalevt++;
-	}
-	LWQ_UNLOCK;
-	return 0;
-}
-
-/* this function is protected by LWQ_LOCK */
-static int _lwnl_remove_event(struct lwnl_event *evt)
-{
-	LWNL_ENTER(TAG);
-	evt->refs--;
-	LWNL_LOGI(TAG, "refs(%d) (%p) (%p)",
-			evt->refs, evt, evt->data.data);
-	if (evt->refs > 0) {
-		return 0;
-	}
-
-	// it's not refered.
-	LWNL_LOGI(TAG, "remove_event");
-	lwnl_dev_type dtype = evt->data.status.type;
-	sq_rem(&evt->entry, &g_event_queue[dtype]);
-	if (evt->data.data) {
-		kmm_free(evt->data.data);
-		evt->data.data = NULL;
-	}
-	kmm_free(evt);
-	g_totalevt--;
-
-	return 0;
+	_lwnl_release_data(LWQ_SLOT(ring, oldest));
 }
 
 /**
@@ -149,20 +138,24 @@ static int _lwnl_remove_event(struct lwnl_event *evt)
 void lwnl_queue_initialize(void)
 {
 	LWNL_ENTER(TAG);
+	if (sem_init(&g_wm_sem, 0, 1) != 0) {
+		LWNL_LOGE(TAG, "fail to init semaphore %d", errno);
+	}
+
 	LWQ_LOCK;
 	for (int i = 0; i < LWNL_NPOLLWAITERS; i++) {
 		g_filep_list[i].filep = NULL;
 		g_filep_list[i].check_header = 0;
-		sq_init(&g_filep_list[i].queue);
+		g_filep_list[i].tail = 0;
+		g_filep_list[i].lost = 0;
 	}
 
 	for (int i = 0; i < LWNL_DEV_TYPE_MAX; i++) {
 		g_connected[i] = 0;
-		sq_init(&g_event_queue[i]);
-	}
-
-	if (sem_init(&g_wm_sem, 0, 1) != 0) {
-		LWNL_LOGE(TAG, "fail to init semaphore %d", errno);
+		for (int j = 0; j < CONFIG_LWNL_EVENT_RING_SIZE; j++) {
+			_lwnl_release_data(&g_ring[i].slot[j]);
+		}
+		g_ring[i].head = 0;
 	}
 	LWQ_UNLOCK;
 }
@@ -171,40 +164,57 @@ int lwnl_add_event(lwnl_cb_status type, void *buffer, int32_t buf_len)
 {
 	LWNL_LOGI(TAG, "--> dev %d type %d buffer %p len (%d)",
 			  type.type, type.evt, buffer, buf_len);
-	struct lwnl_event *evt = (struct lwnl_event *)kmm_malloc(sizeof(struct lwnl_event));
-	if (!evt) {
-		LWNL_LOGE(TAG, "fail to alloc lwnl event");
-		return -1;
+	struct lwnl_ring *ring = &g_ring[type.type];
+	struct lwnl_event *evt;
+
+	LWQ_LOCK;
+	if (g_connected[type.type] == 0) {
+		/* nobody would read it */
+		LWQ_UNLOCK;
+		if (buffer && buf_len < 0) {
+			kmm_free(buffer);
+		}
+		return 0;
+	}
+
+	if (buffer && buf_len > CONFIG_LWNL_EVENT_DATA_SIZE) {
+		/* allocate before a slot is taken, so that a failure loses nothing */
+		char *output = kmm_malloc(buf_len);
+		if (!output) {
+			LWQ_UNLOCK;
+			LWNL_LOGE(TAG, "fail to alloc buffer");
+			return -3;
+		}
+		memcpy(output, buffer, buf_len);
+		buffer = output;
+		buf_len = -buf_len;
+	}
+
+	for (int i = 0; i < LWNL_NPOLLWAITERS; i++) {
+		struct lwnl_filep *fp = &g_filep_list[i];
+		if (fp->filep && fp->type == type.type &&
+			ring->head - fp->tail == CONFIG_LWNL_EVENT_RING_SIZE) {
+			_lwnl_make_room(ring, type.type);
+			break;
+		}
 	}
-	evt->refs = 0;
+
+	evt = LWQ_SLOT(ring, ring->head);
+	_lwnl_release_data(evt);
 	evt->data.status = type;
-	evt->data.data = NULL;
-	evt->data.data_len = 0;
 	if (buffer) {
 		if (buf_len < 0) {
 			evt->data.data = buffer;
 			evt->data.data_len = -(buf_len);
 		} else {
-			char *output = kmm_malloc(buf_len);
-			if (!output) {
-				LWNL_LOGE(TAG, "fail to alloc buffer");
-				kmm_free(evt);
-				return -3;
-			}
-			memcpy(output, buffer, buf_len);
-			evt->data.data = output;
+			memcpy(evt->buf, buffer, buf_len);
+			evt->data.data = evt->buf;
 			evt->data.data_len = buf_len;
 		}
 	}
-	sq_addlast(&evt->entry, &g_event_queue[type.type]);
-	if (_lwnl_update_event_filep(evt) < 0) {
-		LWNL_LOGE(TAG, "fail to update event");
-		if (evt->data.data) {
-			kmm_free(evt->data.data);
-		}
-		kmm_free(evt);
-		return -2;
-	}
+	ring->head++;
+	LWQ_UNLOCK;
+
 	return 0;
 }
 
@@ -220,14 +230,21 @@ int lwnl_get_event(struct file *filep, char *buf, int len)
 		return -1;
 	}
 
-	if (sq_empty(&fp->queue)) {
+	if (fp->check_header == LWQ_DATA_LOST) {
+		fp->check_header = 0;
+		LWQ_UNLOCK;
+		LWNL_LOGE(TAG, "event was overwritten before its data was read");
+		return -1;
+	}
+
+	struct lwnl_ring *ring = &g_ring[fp->type];
+	if (fp->tail == ring->head) {
 		LWQ_UNLOCK;
 		LWNL_LOGE(TAG, "filep doesn't have item");
 		return 0;
 	}
 
-	struct lwnl_event *evt = LWQ_GET_EVT(sq_peek(&fp->queue));
-	assert(evt != NULL);
+	struct lwnl_event *evt = LWQ_SLOT(ring, fp->tail);
 	LWNL_LOGI(TAG, "event %p check %d fp %p", evt, fp->check_header, filep);
 	if (fp->check_header == 0) {
 		if (len < LWQ_EVENT_HEADER) {
@@ -255,8 +272,7 @@ int lwnl_get_event(struct file *filep, char *buf, int len)
 		written = evt->data.data_len;
 	}
 	LWNL_LOGI(TAG, " remove_item (%p) in fp (%p)", evt, filep);
-	_lwnl_remove_event_filep(fp);
-	_lwnl_remove_event(evt);
+	fp->tail++;
 
 	LWQ_UNLOCK;
 	return written;
@@ -272,8 +288,10 @@ int lwnl_add_listener(struct file *filep, lwnl_dev_type type)
 			g_filep_list[i].filep = filep;
 			filep->f_priv = (void *)&g_filep_list[i];
 			g_filep_list[i].type = type;
-			sq_init(&g_filep_list[i].queue);
-			g_filep_list[i].queue_size = 0;
+			g_filep_list[i].check_header = 0;
+			/* a listener gets the events posted after it was added */
+			g_filep_list[i].tail = g_ring[type].head;
+			g_filep_list[i].lost = 0;
 			g_connected[type]++;
 			LWQ_UNLOCK;
 			return 0;
@@ -286,8 +304,7 @@ int lwnl_add_listener(struct file *filep, lwnl_dev_type type)
 
 int lwnl_remove_listener(struct file *filep)
 {
-	LWNL_LOGI(TAG, "remove listener filep %p %d %d",
-			filep, g_totalevt, LWNL_NPOLLWAITERS);
+	LWNL_LOGI(TAG, "remove listener filep %p %d", filep, LWNL_NPOLLWAITERS);
 	LWQ_LOCK;
 	struct lwnl_filep *llfp = (struct lwnl_filep *)filep->f_priv;
 	if (!llfp) {
@@ -297,16 +314,10 @@ int lwnl_remove_listener(struct file *filep)
 		return 0;
 	}
 
-	sq_entry_t *entry = NULL;
-	while ((entry = sq_peek(&llfp->queue)) != NULL) {
-		struct lwnl_event *evt = LWQ_GET_EVT(entry);
-		LWNL_LOGI(TAG, "remove evt %p in fp %p", evt, filep);
-		_lwnl_remove_event_filep(llfp);
-		_lwnl_remove_event(evt);
-	}
+	/* the events it didn't read stay in the ring until they are overwritten */
 	g_connected[llfp->type]--;
 	llfp->check_header = 0;
-	llfp->queue_size = 0;
+	llfp->lost = 0;
 	filep->f_priv = llfp->filep = NULL;
 
 	LWQ_UNLOCK;
@@ -322,21 +333,19 @@ lwnl_dev_type lwnl_get_dev_type(struct file *filep)
 	return LWNL_DEV_TYPE_MAX; // unknown
 }
 
-/* Description: if filep has event then it return 1 else return 0 */
+/* Description: if filep has event then it return 1 else return 0.
+ * It doesn't take LWQ_LOCK: head only grows, so a stale value at worst
+ * misses an event being added, and lwnl_postmsg() wakes the poll for it. */
 int lwnl_check_queue(struct file *filep)
 {
-	int res = 0;
 	LWNL_ENTER(TAG);
-	LWQ_LOCK;
 	struct lwnl_filep *llfp = (struct lwnl_filep *)filep->f_priv;
 	if (!llfp) {
 		LWNL_LOGE(TAG, "llfp is null\n", llfp);
-		goto done;
+		return 0;
 	}
-	if (!sq_empty(&llfp->queue)) {
-		res = 1;
+	if (llfp->check_header == LWQ_DATA_LOST) {
+		return 1;
 	}
-done:
-	LWQ_UNLOCK;
-	return res;
+	return llfp->tail != *(volatile uint32_t *)&g_ring[llfp->type].head;
 }
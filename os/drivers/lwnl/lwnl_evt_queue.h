@@ -25,7 +25,7 @@
 #define LWNL_NPOLLWAITERS 10
 
 struct lwnl_event;
-struct lwnl_queue;
+struct lwnl_ring;
 
 void lwnl_queue_initialize(void);
 int lwnl_add_listener(struct file *filep, lwnl_dev_type type);
@@ -0,0 +1,309 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <semaphore.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/fs/fs.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/npu.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define NPU_DEVNAME_LEN     16
+
+/****************************************************************************
+ * Private Type Definitions
+ ****************************************************************************/
+
+/* This structure describes the state of the upper half driver */
+
+struct npu_upperhalf_s {
+	sem_t exclsem;		/* Serializes the ioctls */
+	sem_t donesem;		/* Posted by the completion callback */
+	volatile bool busy;	/* An invoke is running */
+	FAR struct file *owner;	/* File which started the invoke */
+	volatile int result;	/* Result of the last invoke */
+
+	/* The contained lower-half driver */
+
+	FAR struct npu_lowerhalf_s *lower;
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+static void npu_completed(FAR void *arg, int result);
+static int npu_close(FAR struct file *filep);
+static ssize_t npu_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t npu_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+static int npu_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static const struct file_operations g_npuops = {
+	NULL,			/* open */
+	npu_close,		/* close */
+	npu_read,		/* read */
+	npu_write,		/* write */
+	NULL,			/* seek */
+	npu_ioctl		/* ioctl */
+#ifndef CONFIG_DISABLE_POLL
+	, NULL			/* poll */
+#endif
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+	, NULL			/* unlink */
+#endif
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void npu_takesem(FAR sem_t *sem)
+{
+	while (sem_wait(sem) != OK) {
+		/* The only case that an error should occur here is if the wait
+		 * was awakened by a signal.
+		 */
+
+		DEBUGASSERT(get_errno() == EINTR);
+	}
+}
+
+/****************************************************************************
+ * Name: npu_completed
+ *
+ * Description:
+ *   Completion callback of the lower half, called at the end of an invoke,
+ *   possibly from an interrupt handler.
+ *
+ ****************************************************************************/
+
+static void npu_completed(FAR void *arg, int result)
+{
+	FAR struct npu_upperhalf_s *upper = (FAR struct npu_upperhalf_s *)arg;
+
+	upper->result = result;
+	upper->busy = false;
+	sem_post(&upper->donesem);
+}
+
+/****************************************************************************
+ * Name: npu_wait
+ *
+ * Description:
+ *   Sleep until the end of the running invoke, if any, and return its
+ *   result.
+ *
+ ****************************************************************************/
+
+static int npu_wait(FAR struct npu_upperhalf_s *upper)
+{
+	int value;
+
+	/* donesem counts the invokes completed and not waited for yet */
+
+	sem_getvalue(&upper->donesem, &value);
+	if (!upper->busy && value <= 0) {
+		return upper->result;
+	}
+	npu_takesem(&upper->donesem);
+	return upper->result;
+}
+
+/****************************************************************************
+ * Name: npu_close
+ *
+ * Description:
+ *   Abort the invoke started through this file, so that the buffers of the
+ *   caller are not written once it is gone.
+ *
+ ****************************************************************************/
+
+static int npu_close(FAR struct file *filep)
+{
+	FAR struct inode *inode = filep->f_inode;
+	FAR struct npu_upperhalf_s *upper = inode->i_private;
+	FAR struct npu_lowerhalf_s *lower = upper->lower;
+
+	npu_takesem(&upper->exclsem);
+	if (upper->busy && upper->owner == filep) {
+		if (lower->ops->cancel && lower->ops->cancel(lower) == OK) {
+			upper->busy = false;
+			upper->result = -ECANCELED;
+		} else {
+			(void)npu_wait(upper);
+		}
+	}
+	sem_post(&upper->exclsem);
+	return OK;
+}
+
+static ssize_t npu_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	return 0;
+}
+
+static ssize_t npu_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	return 0;
+}
+
+/****************************************************************************
+ * Name: npu_ioctl
+ *
+ * Description:
+ *   The standard ioctl method, see tinyara/npu.h for the commands.
+ *
+ ****************************************************************************/
+
+static int npu_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
+{
+	FAR struct inode *inode = filep->f_inode;
+	FAR struct npu_upperhalf_s *upper = inode->i_private;
+	FAR struct npu_lowerhalf_s *lower = upper->lower;
+	int ret;
+
+	/* Waiting must not hold exclsem, or nothing could be loaded meanwhile */
+
+	if (cmd == NPUIOC_WAIT) {
+		return npu_wait(upper);
+	}
+
+	npu_takesem(&upper->exclsem);
+
+	switch (cmd) {
+	case NPUIOC_GETINFO:
+		ret = lower->ops->getinfo(lower, (FAR struct npu_info_s *)((uintptr_t)arg));
+		break;
+
+	case NPUIOC_LOAD:
+		ret = lower->ops->load(lower, (FAR struct npu_model_s *)((uintptr_t)arg));
+		break;
+
+	case NPUIOC_UNLOAD:
+		ret = upper->busy ? -EBUSY : lower->ops->unload(lower, (int)arg);
+		break;
+
+	case NPUIOC_GETTENSOR:
+		ret = lower->ops->gettensor(lower, (FAR struct npu_tensor_s *)((uintptr_t)arg));
+		break;
+
+	case NPUIOC_INVOKE: {
+		int value;
+
+		if (upper->busy) {
+			ret = -EBUSY;
+			break;
+		}
+
+		/* Forget a completion which was never waited for */
+
+		while (sem_getvalue(&upper->donesem, &value) == OK && value > 0) {
+			sem_trywait(&upper->donesem);
+		}
+
+		upper->busy = true;
+		upper->owner = filep;
+		upper->result = OK;
+		ret = lower->ops->invoke(lower, (FAR const struct npu_invoke_s *)((uintptr_t)arg));
+		if (ret != OK) {
+			upper->busy = false;
+			upper->result = ret;
+		}
+		break;
+	}
+
+	case NPUIOC_RESET:
+		if (upper->busy) {
+			ret = -EBUSY;
+		} else if (lower->ops->reset) {
+			ret = lower->ops->reset(lower, (int)arg);
+		} else {
+			ret = OK;
+		}
+		break;
+
+	default:
+		ret = -ENOTTY;
+		break;
+	}
+
+	sem_post(&upper->exclsem);
+	return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: npu_register
+ *
+ * Description:
+ *   Register the lower half of an accelerator as /dev/npuN.
+ *
+ ****************************************************************************/
+
+int npu_register(int minor, FAR struct npu_lowerhalf_s *lower)
+{
+	FAR struct npu_upperhalf_s *upper;
+	char devname[NPU_DEVNAME_LEN];
+	int ret;
+
+	DEBUGASSERT(lower && lower->ops && lower->ops->invoke && lower->ops->setcallback);
+
+	upper = (FAR struct npu_upperhalf_s *)kmm_zalloc(sizeof(struct npu_upperhalf_s));
+	if (!upper) {
+		dbg("ERROR: Allocation failed\n");
+		return -ENOMEM;
+	}
+
+	sem_init(&upper->exclsem, 0, 1);
+	sem_init(&upper->donesem, 0, 0);
+	upper->lower = lower;
+	lower->ops->setcallback(lower, npu_completed, upper);
+
+	snprintf(devname, NPU_DEVNAME_LEN, NPU_DEVNAME_FMT, minor);
+	ret = register_driver(devname, &g_npuops, 0666, upper);
+	if (ret < 0) {
+		dbg("ERROR: register_driver %s failed: %d\n", devname, ret);
+		lower->ops->setcallback(lower, NULL, NULL);
+		sem_destroy(&upper->exclsem);
+		sem_destroy(&upper->donesem);
+		kmm_free(upper);
+		return ret;
+	}
+
+	vdbg("Registered %s\n", devname);
+	return OK;
+}
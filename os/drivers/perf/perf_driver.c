@@ -0,0 +1,118 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <errno.h>
+
+#include <sys/types.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/ioctl.h>
+#include <tinyara/perf.h>
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+static int perf_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
+static ssize_t perf_read(FAR struct file *filep, FAR char *buffer, size_t len);
+static ssize_t perf_write(FAR struct file *filep, FAR const char *buffer, size_t len);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static const struct file_operations perf_fops = {
+	0,                          /* open */
+	0,                          /* close */
+	perf_read,                  /* read */
+	perf_write,                 /* write */
+	0,                          /* seek */
+	perf_ioctl                  /* ioctl */
+#ifndef CONFIG_DISABLE_POLL
+	, 0                         /* poll */
+#endif
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static ssize_t perf_read(FAR struct file *filep, FAR char *buffer, size_t len)
+{
+	return 0;
+}
+
+static ssize_t perf_write(FAR struct file *filep, FAR const char *buffer, size_t len)
+{
+	return 0;
+}
+
+/************************************************************************************
+ * Name: perf_ioctl
+ *
+ * Description: The ioctl method for the performance metrics.  PERFIOC_SNAPSHOT
+ *   and PERFIOC_TASKS return the number of entries copied.
+ *
+ ************************************************************************************/
+static int perf_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
+{
+	FAR struct perf_snapshot_s *snapshot;
+	FAR struct perf_tasks_s *tasks;
+	int ret;
+
+	ret = -EINVAL;
+
+	switch (cmd) {
+	case PERFIOC_SNAPSHOT:
+		snapshot = (FAR struct perf_snapshot_s *)arg;
+		if (snapshot != NULL && snapshot->values != NULL && snapshot->nvalues > 0) {
+			ret = perf_snapshot(snapshot->values, snapshot->nvalues);
+		}
+		break;
+	case PERFIOC_TASKS:
+		tasks = (FAR struct perf_tasks_s *)arg;
+		if (tasks != NULL && tasks->tasks != NULL && tasks->ntasks > 0) {
+			ret = perf_get_tasks(tasks);
+		}
+		break;
+	case PERFIOC_RESET:
+		perf_reset();
+		ret = OK;
+		break;
+	default:
+		break;
+	}
+	return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: perf_drv_register
+ *
+ * Description:
+ *   Register the performance metrics driver path, PERF_DRVPATH
+ *
+ ****************************************************************************/
+
+void perf_drv_register(void)
+{
+	(void)register_driver(PERF_DRVPATH, &perf_fops, 0666, NULL);
+}
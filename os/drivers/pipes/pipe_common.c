@@ -63,6 +63,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include <sched.h>
 #include <semaphore.h>
 #include <fcntl.h>
@@ -153,6 +154,149 @@ static void pipecommon_pollnotify(FAR struct pipe_dev_s *dev, pollevent_t events
 #define pipecommon_pollnotify(dev, event)
 #endif
 
+/****************************************************************************
+ * Name: pipecommon_wakeup
+ *
+ * Description:
+ *   Wake up all the readers or writers waiting on sem.
+ *
+ ****************************************************************************/
+
+static void pipecommon_wakeup(FAR sem_t *sem)
+{
+	int sval;
+
+	while (sem_getvalue(sem, &sval) == 0 && sval < 0) {
+		sem_post(sem);
+	}
+}
+
+/****************************************************************************
+ * Name: pipecommon_rdsegment and pipecommon_wrsegment
+ *
+ * Description:
+ *   Return the number of bytes which can be read at d_rdndx, or written at
+ *   d_wrndx, in one piece up to the end of the buffer.  One byte of the
+ *   buffer stays free to tell a full pipe from an empty one.
+ *
+ ****************************************************************************/
+
+static size_t pipecommon_rdsegment(FAR struct pipe_dev_s *dev)
+{
+	if (dev->d_wrndx >= dev->d_rdndx) {
+		return dev->d_wrndx - dev->d_rdndx;
+	}
+
+	return CONFIG_DEV_PIPE_SIZE - dev->d_rdndx;
+}
+
+static size_t pipecommon_wrsegment(FAR struct pipe_dev_s *dev)
+{
+	if (dev->d_rdndx > dev->d_wrndx) {
+		return dev->d_rdndx - dev->d_wrndx - 1;
+	}
+
+	return CONFIG_DEV_PIPE_SIZE - dev->d_wrndx - (dev->d_rdndx == 0 ? 1 : 0);
+}
+
+static void pipecommon_rdadvance(FAR struct pipe_dev_s *dev, size_t n)
+{
+	dev->d_rdndx += n;
+	if (dev->d_rdndx >= CONFIG_DEV_PIPE_SIZE) {
+		dev->d_rdndx = 0;
+	}
+}
+
+static void pipecommon_wradvance(FAR struct pipe_dev_s *dev, size_t n)
+{
+	dev->d_wrndx += n;
+	if (dev->d_wrndx >= CONFIG_DEV_PIPE_SIZE) {
+		dev->d_wrndx = 0;
+	}
+}
+
+/****************************************************************************
+ * Name: pipecommon_waitdata
+ *
+ * Description:
+ *   Wait until the pipe has data, with d_bfsem held.  If rdwait is given,
+ *   a writer may copy the data to the buffer of the reader directly
+ *   instead.
+ *
+ * Return Value:
+ *   1 if the pipe has data, d_bfsem is still held.  Otherwise d_bfsem is
+ *   released and 0 is returned at end of file or if the data was copied to
+ *   rdwait (see rdwait->nread), or a negative value on failure.
+ *
+ ****************************************************************************/
+
+static int pipecommon_waitdata(FAR struct file *filep, FAR struct pipe_dev_s *dev, FAR struct pipe_rdwait_s *rdwait)
+{
+	int ret;
+
+	while (dev->d_wrndx == dev->d_rdndx) {
+		/* If O_NONBLOCK was set, then return EGAIN */
+
+		if (filep->f_oflags & O_NONBLOCK) {
+			sem_post(&dev->d_bfsem);
+			return -EAGAIN;
+		}
+
+		/* If there are no writers on the pipe, then return end of file */
+
+		if (dev->d_nwriters <= 0) {
+			sem_post(&dev->d_bfsem);
+			return 0;
+		}
+
+#ifdef CONFIG_DEV_PIPE_DIRECT_READ
+		/* Let the next writer copy to the buffer, if no other reader does */
+
+		if (rdwait != NULL && dev->d_rdwait == NULL) {
+			dev->d_rdwait = rdwait;
+		}
+#endif
+
+		/* Otherwise, wait for something to be written to the pipe */
+
+		sched_lock();
+		sem_post(&dev->d_bfsem);
+		ret = sem_wait(&dev->d_rdsem);
+		sched_unlock();
+
+#ifdef CONFIG_DEV_PIPE_DIRECT_READ
+		if (rdwait != NULL) {
+			/* No writer may use the buffer once the read returns, so the
+			 * lock is taken even if the wait failed.
+			 */
+
+			pipecommon_semtake(&dev->d_bfsem);
+			if (dev->d_rdwait == rdwait) {
+				dev->d_rdwait = NULL;
+			}
+
+			if (rdwait->nread > 0) {
+				sem_post(&dev->d_bfsem);
+				return 0;
+			}
+
+			if (ret < 0) {
+				sem_post(&dev->d_bfsem);
+				return ERROR;
+			}
+
+			continue;
+		}
+#endif
+
+		if (ret < 0 || sem_wait(&dev->d_bfsem) < 0) {
+			return ERROR;
+		}
+	}
+
+	return 1;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -207,7 +351,6 @@ int pipecommon_open(FAR struct file *filep)
 {
 	struct inode *inode = filep->f_inode;
 	struct pipe_dev_s *dev = inode->i_private;
-	int sval;
 	int ret;
 
 	DEBUGASSERT(dev);
@@ -250,9 +393,7 @@ int pipecommon_open(FAR struct file *filep)
 		 */
 
 		if (dev->d_nwriters == 1) {
-			while (sem_getvalue(&dev->d_rdsem, &sval) == 0 && sval < 0) {
-				sem_post(&dev->d_rdsem);
-			}
+			pipecommon_wakeup(&dev->d_rdsem);
 		}
 	}
 
@@ -304,7 +445,6 @@ int pipecommon_close(FAR struct file *filep)
 {
 	struct inode *inode = filep->f_inode;
 	struct pipe_dev_s *dev = inode->i_private;
-	int sval;
 #ifndef CONFIG_DISABLE_POLL
 	int i;
 #endif
@@ -348,9 +488,7 @@ int pipecommon_close(FAR struct file *filep)
 			 */
 
 			if (--dev->d_nwriters <= 0) {
-				while (sem_getvalue(&dev->d_rdsem, &sval) == 0 && sval < 0) {
-					sem_post(&dev->d_rdsem);
-				}
+				pipecommon_wakeup(&dev->d_rdsem);
 			}
 		}
 	}
@@ -400,8 +538,9 @@ ssize_t pipecommon_read(FAR struct file *filep, FAR char *buffer, size_t len)
 #ifdef CONFIG_DEV_PIPEDUMP
 	FAR uint8_t *start = (uint8_t *)buffer;
 #endif
+	struct pipe_rdwait_s rdwait;
 	ssize_t nread = 0;
-	int sval;
+	size_t n;
 	int ret;
 
 	DEBUGASSERT(dev);
@@ -418,49 +557,30 @@ ssize_t pipecommon_read(FAR struct file *filep, FAR char *buffer, size_t len)
 
 	/* If the pipe is empty, then wait for something to be written to it */
 
-	while (dev->d_wrndx == dev->d_rdndx) {
-		/* If O_NONBLOCK was set, then return EGAIN */
-
-		if (filep->f_oflags & O_NONBLOCK) {
-			sem_post(&dev->d_bfsem);
-			return -EAGAIN;
-		}
-
-		/* If there are no writers on the pipe, then return end of file */
-
-		if (dev->d_nwriters <= 0) {
-			sem_post(&dev->d_bfsem);
-			return 0;
-		}
-
-		/* Otherwise, wait for something to be written to the pipe */
-
-		sched_lock();
-		sem_post(&dev->d_bfsem);
-		ret = sem_wait(&dev->d_rdsem);
-		sched_unlock();
-
-		if (ret < 0 || sem_wait(&dev->d_bfsem) < 0) {
-			return ERROR;
-		}
+	rdwait.buffer = buffer;
+	rdwait.len = len;
+	rdwait.nread = 0;
+	ret = pipecommon_waitdata(filep, dev, &rdwait);
+	if (ret <= 0) {
+		return ret < 0 ? ret : rdwait.nread;
 	}
 
 	/* Then return whatever is available in the pipe (which is at least one byte) */
 
 	nread = 0;
-	while (nread < len && dev->d_wrndx != dev->d_rdndx) {
-		*buffer++ = dev->d_buffer[dev->d_rdndx];
-		if (++dev->d_rdndx >= CONFIG_DEV_PIPE_SIZE) {
-			dev->d_rdndx = 0;
+	while (nread < len && (n = pipecommon_rdsegment(dev)) > 0) {
+		if (n > len - nread) {
+			n = len - nread;
 		}
-		nread++;
+
+		memcpy(buffer + nread, &dev->d_buffer[dev->d_rdndx], n);
+		pipecommon_rdadvance(dev, n);
+		nread += n;
 	}
 
 	/* Notify all waiting writers that bytes have been removed from the buffer */
 
-	while (sem_getvalue(&dev->d_wrsem, &sval) == 0 && sval < 0) {
-		sem_post(&dev->d_wrsem);
-	}
+	pipecommon_wakeup(&dev->d_wrsem);
 
 	/* Notify all poll/select waiters that they can write to the FIFO */
 
@@ -479,10 +599,12 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer, size_t
 {
 	struct inode *inode = filep->f_inode;
 	struct pipe_dev_s *dev = inode->i_private;
+#ifdef CONFIG_DEV_PIPE_DIRECT_READ
+	FAR struct pipe_rdwait_s *rdwait;
+#endif
 	ssize_t nwritten = 0;
 	ssize_t last;
-	int nxtwrndx;
-	int sval;
+	size_t n;
 
 	DEBUGASSERT(dev);
 	pipe_dumpbuffer("To PIPE:", (uint8_t *)buffer, len);
@@ -510,73 +632,83 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer, size_t
 		return ERROR;
 	}
 
-	/* Loop until all of the bytes have been written */
+#ifdef CONFIG_DEV_PIPE_DIRECT_READ
+	/* If a reader waits on the empty pipe, copy to its buffer directly */
 
-	last = 0;
-	for (;;) {
-		/* Calculate the write index AFTER the next byte is written */
+	if (dev->d_rdwait != NULL && dev->d_wrndx == dev->d_rdndx) {
+		rdwait = dev->d_rdwait;
+		nwritten = len < rdwait->len ? len : rdwait->len;
+		memcpy(rdwait->buffer, buffer, nwritten);
+		rdwait->nread = nwritten;
+		dev->d_rdwait = NULL;
 
-		nxtwrndx = dev->d_wrndx + 1;
-		if (nxtwrndx >= CONFIG_DEV_PIPE_SIZE) {
-			nxtwrndx = 0;
+		pipecommon_wakeup(&dev->d_rdsem);
+		if (nwritten >= len) {
+			sem_post(&dev->d_bfsem);
+			return len;
 		}
+	}
+#endif
 
-		/* Would the next write overflow the circular buffer? */
+	/* Loop until all of the bytes have been written */
 
-		if (nxtwrndx != dev->d_rdndx) {
-			/* No... copy the byte */
+	last = nwritten;
+	for (;;) {
+		/* Copy as much as fits, in up to two pieces if it wraps around */
 
-			dev->d_buffer[dev->d_wrndx] = *buffer++;
-			dev->d_wrndx = nxtwrndx;
+		while (nwritten < len && (n = pipecommon_wrsegment(dev)) > 0) {
+			if (n > len - nwritten) {
+				n = len - nwritten;
+			}
 
-			/* Is the write complete? */
+			memcpy(&dev->d_buffer[dev->d_wrndx], buffer + nwritten, n);
+			pipecommon_wradvance(dev, n);
+			nwritten += n;
+		}
 
-			if (++nwritten >= len) {
-				/* Yes.. Notify all of the waiting readers that more data is available */
+		/* Is the write complete? */
 
-				while (sem_getvalue(&dev->d_rdsem, &sval) == 0 && sval < 0) {
-					sem_post(&dev->d_rdsem);
-				}
+		if (nwritten >= len) {
+			/* Yes.. Notify all of the waiting readers that more data is available */
 
-				/* Notify all poll/select waiters that they can write to the FIFO */
+			pipecommon_wakeup(&dev->d_rdsem);
 
-				pipecommon_pollnotify(dev, POLLIN);
+			/* Notify all poll/select waiters that they can write to the FIFO */
 
-				/* Return the number of bytes written */
+			pipecommon_pollnotify(dev, POLLIN);
 
-				sem_post(&dev->d_bfsem);
-				return len;
-			}
-		} else {
-			/* There is not enough room for the next byte. Was anything written in this pass? */
+			/* Return the number of bytes written */
 
-			if (last < nwritten) {
-				/* Yes.. Notify all of the waiting readers that more data is available */
+			sem_post(&dev->d_bfsem);
+			return len;
+		}
 
-				while (sem_getvalue(&dev->d_rdsem, &sval) == 0 && sval < 0) {
-					sem_post(&dev->d_rdsem);
-				}
-			}
-			last = nwritten;
+		/* There is not enough room for the next byte. Was anything written in this pass? */
 
-			/* If O_NONBLOCK was set, then return partial bytes written or EGAIN */
+		if (last < nwritten) {
+			/* Yes.. Notify all of the waiting readers that more data is available */
 
-			if (filep->f_oflags & O_NONBLOCK) {
-				if (nwritten == 0) {
-					nwritten = -EAGAIN;
-				}
-				sem_post(&dev->d_bfsem);
-				return nwritten;
-			}
+			pipecommon_wakeup(&dev->d_rdsem);
+		}
+		last = nwritten;
 
-			/* There is more to be written.. wait for data to be removed from the pipe */
+		/* If O_NONBLOCK was set, then return partial bytes written or EGAIN */
 
-			sched_lock();
+		if (filep->f_oflags & O_NONBLOCK) {
+			if (nwritten == 0) {
+				nwritten = -EAGAIN;
+			}
 			sem_post(&dev->d_bfsem);
-			pipecommon_semtake(&dev->d_wrsem);
-			sched_unlock();
-			pipecommon_semtake(&dev->d_bfsem);
+			return nwritten;
 		}
+
+		/* There is more to be written.. wait for data to be removed from the pipe */
+
+		sched_lock();
+		sem_post(&dev->d_bfsem);
+		pipecommon_semtake(&dev->d_wrsem);
+		sched_unlock();
+		pipecommon_semtake(&dev->d_bfsem);
 	}
 }
 
@@ -675,6 +807,132 @@ errout:
 }
 #endif
 
+/****************************************************************************
+ * Name: pipecommon_spliceout
+ *
+ * Description:
+ *   Write the data of the pipe to the file or socket sp->fd, straight from
+ *   the buffer of the pipe.  The pipe stays locked while it is written.
+ *
+ ****************************************************************************/
+
+static int pipecommon_spliceout(FAR struct file *filep, FAR struct pipe_dev_s *dev, FAR struct pipe_splice_s *sp)
+{
+	size_t nmoved = 0;
+	size_t n;
+	ssize_t nwritten = 0;
+	int ret;
+
+	if ((filep->f_oflags & O_RDOK) == 0) {
+		return -EBADF;
+	}
+
+	if (sem_wait(&dev->d_bfsem) < 0) {
+		return ERROR;
+	}
+
+	ret = pipecommon_waitdata(filep, dev, NULL);
+	if (ret <= 0) {
+		return ret;
+	}
+
+	while (nmoved < sp->len && (n = pipecommon_rdsegment(dev)) > 0) {
+		if (n > sp->len - nmoved) {
+			n = sp->len - nmoved;
+		}
+
+		nwritten = write(sp->fd, &dev->d_buffer[dev->d_rdndx], n);
+		if (nwritten <= 0) {
+			break;
+		}
+
+		pipecommon_rdadvance(dev, nwritten);
+		nmoved += nwritten;
+		if ((size_t)nwritten < n) {
+			break;
+		}
+	}
+
+	if (nmoved > 0) {
+		pipecommon_wakeup(&dev->d_wrsem);
+		pipecommon_pollnotify(dev, POLLOUT);
+		ret = nmoved;
+	} else {
+		ret = nwritten < 0 ? -get_errno() : 0;
+	}
+
+	sem_post(&dev->d_bfsem);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: pipecommon_splicein
+ *
+ * Description:
+ *   Read from the file or socket sp->fd into the pipe, straight to the
+ *   buffer of the pipe.  The pipe stays locked while it is read.
+ *
+ ****************************************************************************/
+
+static int pipecommon_splicein(FAR struct file *filep, FAR struct pipe_dev_s *dev, FAR struct pipe_splice_s *sp)
+{
+	size_t nmoved = 0;
+	size_t n;
+	ssize_t nread = 0;
+	int ret;
+
+	if ((filep->f_oflags & O_WROK) == 0) {
+		return -EBADF;
+	}
+
+	if (sem_wait(&dev->d_bfsem) < 0) {
+		return ERROR;
+	}
+
+	/* Wait for room in the pipe */
+
+	while (pipecommon_wrsegment(dev) == 0) {
+		if (filep->f_oflags & O_NONBLOCK) {
+			sem_post(&dev->d_bfsem);
+			return -EAGAIN;
+		}
+
+		sched_lock();
+		sem_post(&dev->d_bfsem);
+		pipecommon_semtake(&dev->d_wrsem);
+		sched_unlock();
+		pipecommon_semtake(&dev->d_bfsem);
+	}
+
+	while (nmoved < sp->len && (n = pipecommon_wrsegment(dev)) > 0) {
+		if (n > sp->len - nmoved) {
+			n = sp->len - nmoved;
+		}
+
+		nread = read(sp->fd, &dev->d_buffer[dev->d_wrndx], n);
+		if (nread <= 0) {
+			break;
+		}
+
+		pipecommon_wradvance(dev, nread);
+		nmoved += nread;
+		if ((size_t)nread < n) {
+			break;
+		}
+	}
+
+	if (nmoved > 0) {
+		pipecommon_wakeup(&dev->d_rdsem);
+		pipecommon_pollnotify(dev, POLLIN);
+		ret = nmoved;
+	} else {
+		ret = nread < 0 ? -get_errno() : 0;
+	}
+
+	sem_post(&dev->d_bfsem);
+	return ret;
+}
+
 /****************************************************************************
  * Name: pipecommon_ioctl
  ****************************************************************************/
@@ -684,8 +942,6 @@ int pipecommon_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 	FAR struct inode *inode = filep->f_inode;
 	FAR struct pipe_dev_s *dev = inode->i_private;
 
-	/* Only one command supported */
-
 	if (cmd == PIPEIOC_POLICY) {
 		if (arg != 0) {
 			PIPE_POLICY_1(dev->d_flags);
@@ -696,6 +952,31 @@ int pipecommon_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 		return OK;
 	}
 
+	if (cmd == PIPEIOC_SPLICEOUT || cmd == PIPEIOC_SPLICEIN) {
+		FAR struct pipe_splice_s *sp = (FAR struct pipe_splice_s *)((uintptr_t)arg);
+		FAR struct file *other;
+
+		if (sp == NULL) {
+			return -EINVAL;
+		}
+
+		/* The pipe is locked while the other file is accessed */
+
+		if (fs_getfilep(sp->fd, &other) == OK && other->f_inode == inode) {
+			return -EINVAL;
+		}
+
+		if (sp->len == 0) {
+			return 0;
+		}
+
+		if (cmd == PIPEIOC_SPLICEOUT) {
+			return pipecommon_spliceout(filep, dev, sp);
+		}
+
+		return pipecommon_splicein(filep, dev, sp);
+	}
+
 	return -ENOTTY;
 }
 
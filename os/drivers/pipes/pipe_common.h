@@ -111,6 +111,14 @@ typedef uint16_t pipe_ndx_t;	/* 16-bit index */
 typedef uint8_t pipe_ndx_t;		/*  8-bit index */
 #endif
 
+/* A reader waiting on an empty pipe.  A writer copies to its buffer directly */
+
+struct pipe_rdwait_s {
+	FAR char *buffer;			/* Buffer of the reader */
+	size_t len;					/* Size of the buffer */
+	size_t nread;				/* Number of bytes written to it */
+};
+
 /* This structure represents the state of one pipe.  A reference to this
  * structure is retained in the i_private field of the inode whenthe pipe/fifo
  * device is registered.
@@ -127,6 +135,9 @@ struct pipe_dev_s {
 	uint8_t d_pipeno;			/* Pipe minor number */
 	uint8_t d_flags;			/* See PIPE_FLAG_* definitions */
 	uint8_t *d_buffer;			/* Buffer allocated when device opened */
+#ifdef CONFIG_DEV_PIPE_DIRECT_READ
+	FAR struct pipe_rdwait_s *d_rdwait;	/* Reader waiting for data, if any */
+#endif
 
 	/* The following is a list if poll structures of threads waiting for
 	 * driver events. The 'struct pollfd' reference for each open is also
@@ -0,0 +1,513 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <errno.h>
+#include <debug.h>
+#include <time.h>
+#include <semaphore.h>
+
+#include <tinyara/fs/fs.h>
+#include <tinyara/irq.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/semaphore.h>
+#include <tinyara/sensors/sensor.h>
+
+#ifdef CONFIG_SENSOR_UPPERHALF
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define SENSOR_CLOCK CLOCK_MONOTONIC
+#else
+#define SENSOR_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct sensor_upperhalf_s {
+	FAR struct sensor_lowerhalf_s *lower;	/* The lower half */
+	sem_t exclsem;				/* Exclusive access to the device */
+	sem_t readsem;				/* Readers wait here for samples */
+	int nwaiters;				/* Number of readers waiting */
+	int crefs;					/* Number of opens */
+	bool active;				/* Sampling is started */
+	uint32_t interval;			/* Sample interval in microseconds */
+	uint32_t batch;				/* Samples per wakeup */
+	uint32_t overruns;			/* Samples dropped from the ring */
+	FAR struct sensor_sample_s *ring;	/* The samples, head is the next one written */
+	uint16_t size;				/* Size of the ring in samples */
+	uint16_t head;
+	uint16_t count;				/* Number of samples in the ring */
+#ifndef CONFIG_DISABLE_POLL
+	FAR struct pollfd *fds[CONFIG_SENSOR_NPOLLWAITERS];
+#endif
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int sensor_open(FAR struct file *filep);
+static int sensor_close(FAR struct file *filep);
+static ssize_t sensor_read(FAR struct file *filep, FAR char *buffer, size_t len);
+static int sensor_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
+#ifndef CONFIG_DISABLE_POLL
+static int sensor_poll(FAR struct file *filep, FAR struct pollfd *fds, bool setup);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct file_operations g_sensor_fops = {
+	sensor_open,				/* open */
+	sensor_close,				/* close */
+	sensor_read,				/* read */
+	0,							/* write */
+	0,							/* seek */
+	sensor_ioctl,				/* ioctl */
+#ifndef CONFIG_DISABLE_POLL
+	sensor_poll					/* poll */
+#endif
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sensor_takesem
+ ****************************************************************************/
+
+static int sensor_takesem(FAR sem_t *sem)
+{
+	if (sem_wait(sem) < 0) {
+		/* EINTR is the only error that we expect */
+		int errcode = get_errno();
+		DEBUGASSERT(errcode == EINTR);
+		return -errcode;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: sensor_pollnotify
+ *
+ * Description:
+ *   Wake up the poll waiters.  Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+#ifndef CONFIG_DISABLE_POLL
+static void sensor_pollnotify(FAR struct sensor_upperhalf_s *upper)
+{
+	FAR struct pollfd *fds;
+	int i;
+
+	for (i = 0; i < CONFIG_SENSOR_NPOLLWAITERS; i++) {
+		fds = upper->fds[i];
+		if (fds) {
+			fds->revents |= (fds->events & POLLIN);
+			if (fds->revents != 0) {
+				sem_post(fds->sem);
+			}
+		}
+	}
+}
+#endif
+
+/****************************************************************************
+ * Name: sensor_open
+ ****************************************************************************/
+
+static int sensor_open(FAR struct file *filep)
+{
+	FAR struct sensor_upperhalf_s *upper = filep->f_inode->i_private;
+	int ret;
+
+	ret = sensor_takesem(&upper->exclsem);
+	if (ret < 0) {
+		return ret;
+	}
+
+	upper->crefs++;
+
+	sem_post(&upper->exclsem);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: sensor_close
+ *
+ * Description:
+ *   The last close stops sampling and drops the samples left in the ring.
+ *
+ ****************************************************************************/
+
+static int sensor_close(FAR struct file *filep)
+{
+	FAR struct sensor_upperhalf_s *upper = filep->f_inode->i_private;
+	irqstate_t flags;
+	int ret;
+
+	ret = sensor_takesem(&upper->exclsem);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (--upper->crefs == 0) {
+		if (upper->active) {
+			upper->lower->ops->activate(upper->lower, false);
+			upper->active = false;
+		}
+
+		flags = enter_critical_section();
+		upper->count = 0;
+		upper->overruns = 0;
+		leave_critical_section(flags);
+	}
+
+	sem_post(&upper->exclsem);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: sensor_read
+ *
+ * Description:
+ *   Copy whole samples, oldest first.  Wait for the next batch if the ring
+ *   is empty, unless O_NONBLOCK.
+ *
+ ****************************************************************************/
+
+static ssize_t sensor_read(FAR struct file *filep, FAR char *buffer, size_t len)
+{
+	FAR struct sensor_upperhalf_s *upper = filep->f_inode->i_private;
+	FAR struct sensor_sample_s *samples = (FAR struct sensor_sample_s *)buffer;
+	irqstate_t flags;
+	uint16_t tail;
+	size_t nsamples;
+	size_t ncopy;
+	ssize_t ret;
+
+	nsamples = len / sizeof(struct sensor_sample_s);
+	if (buffer == NULL || nsamples == 0) {
+		return -EINVAL;
+	}
+
+	flags = enter_critical_section();
+	while (upper->count == 0) {
+		if (filep->f_oflags & O_NONBLOCK) {
+			ret = -EAGAIN;
+			goto errout;
+		}
+
+		upper->nwaiters++;
+		ret = sensor_takesem(&upper->readsem);
+		if (ret < 0) {
+			upper->nwaiters--;
+			goto errout;
+		}
+	}
+
+	/* Copy in at most two pieces, the ring may wrap */
+
+	if (nsamples > upper->count) {
+		nsamples = upper->count;
+	}
+
+	tail = (upper->head + upper->size - upper->count) % upper->size;
+	ncopy = upper->size - tail;
+	if (ncopy > nsamples) {
+		ncopy = nsamples;
+	}
+
+	memcpy(samples, &upper->ring[tail], ncopy * sizeof(struct sensor_sample_s));
+	if (ncopy < nsamples) {
+		memcpy(&samples[ncopy], upper->ring, (nsamples - ncopy) * sizeof(struct sensor_sample_s));
+	}
+
+	upper->count -= nsamples;
+	ret = nsamples * sizeof(struct sensor_sample_s);
+
+errout:
+	leave_critical_section(flags);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: sensor_ioctl
+ ****************************************************************************/
+
+static int sensor_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
+{
+	FAR struct sensor_upperhalf_s *upper = filep->f_inode->i_private;
+	FAR struct sensor_lowerhalf_s *lower = upper->lower;
+	FAR uint32_t *value = (FAR uint32_t *)arg;
+	int ret;
+
+	ret = sensor_takesem(&upper->exclsem);
+	if (ret < 0) {
+		return ret;
+	}
+
+	switch (cmd) {
+	case SNIOC_ACTIVATE:
+		if (upper->active != (arg != 0)) {
+			ret = lower->ops->activate(lower, arg != 0);
+			if (ret == OK) {
+				upper->active = (arg != 0);
+			}
+		}
+		break;
+
+	case SNIOC_SET_INTERVAL:
+		if (value == NULL || *value == 0) {
+			ret = -EINVAL;
+		} else if (lower->ops->set_interval == NULL) {
+			ret = -ENOTTY;
+		} else {
+			ret = lower->ops->set_interval(lower, value);
+			if (ret == OK) {
+				upper->interval = *value;
+			}
+		}
+		break;
+
+	case SNIOC_BATCH:
+		if (value == NULL || *value == 0) {
+			ret = -EINVAL;
+			break;
+		}
+
+		/* A batch is never more than the FIFO or the ring holds */
+
+		if (*value > lower->fifo_depth) {
+			*value = lower->fifo_depth > 0 ? lower->fifo_depth : 1;
+		}
+		if (*value > upper->size) {
+			*value = upper->size;
+		}
+
+		if (lower->fifo_depth > 0 && lower->ops->set_watermark) {
+			ret = lower->ops->set_watermark(lower, value);
+		}
+		if (ret == OK) {
+			upper->batch = *value;
+		}
+		break;
+
+	case SNIOC_GET_INFO: {
+		FAR struct sensor_info_s *info = (FAR struct sensor_info_s *)arg;
+
+		if (info == NULL) {
+			ret = -EINVAL;
+			break;
+		}
+		info->nvalues = lower->nvalues;
+		info->fifo_depth = lower->fifo_depth;
+		info->interval = upper->interval;
+		info->batch = upper->batch;
+		info->overruns = upper->overruns;
+		break;
+	}
+
+	default:
+		ret = -ENOTTY;
+		break;
+	}
+
+	sem_post(&upper->exclsem);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: sensor_poll
+ ****************************************************************************/
+
+#ifndef CONFIG_DISABLE_POLL
+static int sensor_poll(FAR struct file *filep, FAR struct pollfd *fds, bool setup)
+{
+	FAR struct sensor_upperhalf_s *upper = filep->f_inode->i_private;
+	irqstate_t flags;
+	int ret;
+	int i;
+
+	ret = sensor_takesem(&upper->exclsem);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (setup) {
+		for (i = 0; i < CONFIG_SENSOR_NPOLLWAITERS; i++) {
+			if (!upper->fds[i]) {
+				upper->fds[i] = fds;
+				fds->priv = &upper->fds[i];
+				break;
+			}
+		}
+
+		if (i >= CONFIG_SENSOR_NPOLLWAITERS) {
+			fds->priv = NULL;
+			ret = -EBUSY;
+			goto errout;
+		}
+
+		/* Samples may be there already */
+
+		flags = enter_critical_section();
+		if (upper->count > 0) {
+			sensor_pollnotify(upper);
+		}
+		leave_critical_section(flags);
+	} else if (fds->priv) {
+		FAR struct pollfd **slot = (FAR struct pollfd **)fds->priv;
+
+		*slot = NULL;
+		fds->priv = NULL;
+	}
+
+errout:
+	sem_post(&upper->exclsem);
+	return ret;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sensor_timestamp
+ ****************************************************************************/
+
+uint64_t sensor_timestamp(void)
+{
+	struct timespec ts;
+
+	clock_gettime(SENSOR_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: sensor_push
+ ****************************************************************************/
+
+void sensor_push(FAR struct sensor_lowerhalf_s *lower, uint64_t timestamp, FAR const float *values, int nsamples)
+{
+	FAR struct sensor_upperhalf_s *upper;
+	FAR struct sensor_sample_s *sample;
+	irqstate_t flags;
+	uint64_t age;
+	int i;
+
+	if (lower == NULL || lower->upper == NULL || values == NULL || nsamples <= 0) {
+		return;
+	}
+	upper = (FAR struct sensor_upperhalf_s *)lower->upper;
+
+	flags = enter_critical_section();
+	for (i = 0; i < nsamples; i++) {
+		sample = &upper->ring[upper->head];
+
+		age = (uint64_t)(nsamples - 1 - i) * upper->interval;
+		sample->timestamp = timestamp > age ? timestamp - age : 0;
+		memcpy(sample->value, &values[i * lower->nvalues], lower->nvalues * sizeof(float));
+
+		upper->head = (upper->head + 1) % upper->size;
+		if (upper->count < upper->size) {
+			upper->count++;
+		} else {
+			upper->overruns++;
+		}
+	}
+
+	/* One wakeup for the whole batch */
+
+	while (upper->nwaiters > 0) {
+		upper->nwaiters--;
+		sem_post(&upper->readsem);
+	}
+#ifndef CONFIG_DISABLE_POLL
+	sensor_pollnotify(upper);
+#endif
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: sensor_register
+ ****************************************************************************/
+
+int sensor_register(FAR const char *path, FAR struct sensor_lowerhalf_s *lower, int nsamples)
+{
+	FAR struct sensor_upperhalf_s *upper;
+	int ret;
+
+	if (path == NULL || lower == NULL || lower->ops == NULL || lower->ops->activate == NULL || lower->nvalues == 0 || lower->nvalues > CONFIG_SENSOR_NVALUES || nsamples <= 0 || nsamples > UINT16_MAX) {
+		sndbg("ERROR: invalid sensor\n");
+		return -EINVAL;
+	}
+
+	upper = (FAR struct sensor_upperhalf_s *)kmm_zalloc(sizeof(struct sensor_upperhalf_s));
+	if (upper == NULL) {
+		return -ENOMEM;
+	}
+
+	upper->ring = (FAR struct sensor_sample_s *)kmm_malloc(nsamples * sizeof(struct sensor_sample_s));
+	if (upper->ring == NULL) {
+		kmm_free(upper);
+		return -ENOMEM;
+	}
+
+	upper->lower = lower;
+	upper->size = nsamples;
+	upper->batch = 1;
+	sem_init(&upper->exclsem, 0, 1);
+	sem_init(&upper->readsem, 0, 0);
+	sem_setprotocol(&upper->readsem, SEM_PRIO_NONE);
+	lower->upper = upper;
+
+	ret = register_driver(path, &g_sensor_fops, 0666, upper);
+	if (ret < 0) {
+		sndbg("ERROR: failed to register driver %s. (ret=%d)\n", path, ret);
+		lower->upper = NULL;
+		sem_destroy(&upper->exclsem);
+		sem_destroy(&upper->readsem);
+		kmm_free(upper->ring);
+		kmm_free(upper);
+	}
+
+	return ret;
+}
+
+#endif /* CONFIG_SENSOR_UPPERHALF */
@@ -337,9 +337,19 @@ static int uart_putxmitchar(FAR uart_dev_t *dev, int ch, bool oktoblock)
 				 */
 
 				dev->xmitwaiting = true;
-				uart_enabletxint(dev);
-				ret = uart_takesem(&dev->xmitsem, true);
-				uart_disabletxint(dev);
+#ifdef CONFIG_SERIAL_DMA
+				if (uart_txdma(dev)) {
+					/* The TX DMA transfer frees the space instead */
+
+					uart_dmatxavail(dev);
+					ret = uart_takesem(&dev->xmitsem, true);
+				} else
+#endif
+				{
+					uart_enabletxint(dev);
+					ret = uart_takesem(&dev->xmitsem, true);
+					uart_disabletxint(dev);
+				}
 			}
 
 			leave_critical_section(flags);
@@ -572,7 +582,14 @@ static ssize_t uart_write(FAR struct file *filep, FAR const char *buffer, size_t
 	}
 
 	if (dev->xmit.head != dev->xmit.tail) {
-		uart_enabletxint(dev);
+#ifdef CONFIG_SERIAL_DMA
+		if (uart_txdma(dev)) {
+			uart_dmatxavail(dev);
+		} else
+#endif
+		{
+			uart_enabletxint(dev);
+		}
 	}
 
 #ifdef CONFIG_PM
@@ -741,6 +758,13 @@ static ssize_t uart_read(FAR struct file *filep, FAR char *buffer, size_t buflen
 		/* Otherwise we are going to have to wait for data to arrive */
 
 		else {
+#ifdef CONFIG_SERIAL_DMA
+			/* The RX DMA transfer may have stopped on a full buffer */
+
+			if (uart_rxdma(dev)) {
+				uart_dmarxfree(dev);
+			}
+#endif
 			/* Disable Rx interrupts and test again... */
 
 			uart_disablerxint(dev);
@@ -856,6 +880,14 @@ static ssize_t uart_read(FAR struct file *filep, FAR char *buffer, size_t buflen
 #endif
 #endif
 
+#ifdef CONFIG_SERIAL_DMA
+	/* Let the RX DMA use the space freed by this read */
+
+	if (uart_rxdma(dev) && recvd > 0) {
+		uart_dmarxfree(dev);
+	}
+#endif
+
 	uart_givesem(&dev->recv.sem);
 	return recvd;
 }
@@ -929,6 +961,11 @@ static int uart_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 				dev->recv.tail = dev->recv.head;
 #ifdef CONFIG_SERIAL_IFLOWCONTROL
 				uart_rxflowcontrol(dev, 0, false);
+#endif
+#ifdef CONFIG_SERIAL_DMA
+				if (uart_rxdma(dev)) {
+					uart_dmarxfree(dev);
+				}
 #endif
 					uart_givesem(&dev->recv.sem);
 					ret = OK;
@@ -1332,6 +1369,13 @@ static int uart_open(FAR struct file *filep)
 		/* Enable the RX interrupt */
 
 		uart_enablerxint(dev);
+#ifdef CONFIG_SERIAL_DMA
+		/* Start the first RX DMA transfer into the empty buffer */
+
+		if (uart_rxdma(dev)) {
+			uart_dmarxfree(dev);
+		}
+#endif
 		leave_critical_section(flags);
 	}
 
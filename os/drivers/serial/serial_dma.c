@@ -0,0 +1,217 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/************************************************************************************
+ * Included Files
+ ************************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <debug.h>
+#include <tinyara/serial/serial.h>
+
+#ifdef CONFIG_SERIAL_DMA
+
+/************************************************************************************
+ * Private Functions
+ ************************************************************************************/
+
+#ifdef CONFIG_SERIAL_IFLOWCONTROL
+/************************************************************************************
+ * Name: uart_dmarxflowcontrol
+ *
+ * Description:
+ *   Give the lower half the chance to activate RX flow control before a new RX
+ *   transfer, in the same cases as uart_recvchars().  Return true if it did, then
+ *   no transfer is started.
+ *
+ ************************************************************************************/
+
+static bool uart_dmarxflowcontrol(FAR uart_dev_t *dev)
+{
+	FAR struct uart_buffer_s *rxbuf = &dev->recv;
+	unsigned int nbuffered;
+
+	if (rxbuf->head >= rxbuf->tail) {
+		nbuffered = rxbuf->head - rxbuf->tail;
+	} else {
+		nbuffered = rxbuf->size - rxbuf->tail + rxbuf->head;
+	}
+
+#ifdef CONFIG_SERIAL_IFLOWCONTROL_WATERMARKS
+	if (nbuffered >= (CONFIG_SERIAL_IFLOWCONTROL_UPPER_WATERMARK * rxbuf->size) / 100) {
+		return uart_rxflowcontrol(dev, nbuffered, true);
+	}
+#else
+	if (nbuffered >= rxbuf->size - 1) {
+		return uart_rxflowcontrol(dev, rxbuf->size, true);
+	}
+#endif
+
+	return false;
+}
+#endif
+
+/************************************************************************************
+ * Public Functions
+ ************************************************************************************/
+
+/************************************************************************************
+ * Name: uart_xmitchars_dma
+ *
+ * Description:
+ *   Describe the pending data of the xmit buffer in dev->dmatx and start its
+ *   transfer with the dmasend() method.
+ *
+ ************************************************************************************/
+
+void uart_xmitchars_dma(FAR uart_dev_t *dev)
+{
+	FAR struct uart_dmaxfer_s *xfer = &dev->dmatx;
+	int16_t head = dev->xmit.head;
+	int16_t tail = dev->xmit.tail;
+
+	if (head == tail) {
+		return;
+	}
+
+	xfer->buffer = &dev->xmit.buffer[tail];
+	if (tail < head) {
+		xfer->length = head - tail;
+		xfer->nbuffer = NULL;
+		xfer->nlength = 0;
+	} else {
+		xfer->length = dev->xmit.size - tail;
+		xfer->nbuffer = dev->xmit.buffer;
+		xfer->nlength = head;
+	}
+	xfer->nbytes = 0;
+
+	uart_dmasend(dev);
+}
+
+/************************************************************************************
+ * Name: uart_xmitchars_done
+ *
+ * Description:
+ *   Remove the bytes sent by the TX DMA transfer from the xmit buffer.
+ *
+ ************************************************************************************/
+
+void uart_xmitchars_done(FAR uart_dev_t *dev)
+{
+	FAR struct uart_dmaxfer_s *xfer = &dev->dmatx;
+	size_t nbytes = xfer->nbytes;
+	size_t pending;
+
+	xfer->length = 0;
+	xfer->nlength = 0;
+	xfer->nbytes = 0;
+
+	/* TCFLSH may have dropped the pending data during the transfer */
+
+	pending = (dev->xmit.head - dev->xmit.tail + dev->xmit.size) % dev->xmit.size;
+	if (nbytes > pending) {
+		nbytes = pending;
+	}
+
+	if (nbytes == 0) {
+		return;
+	}
+
+	dev->xmit.tail = (dev->xmit.tail + nbytes) % dev->xmit.size;
+	dev->sent(dev);
+}
+
+/************************************************************************************
+ * Name: uart_recvchars_dma
+ *
+ * Description:
+ *   Describe the free space of the recv buffer in dev->dmarx and start the
+ *   transfer into it with the dmareceive() method.  One slot stays unused, as
+ *   head == tail means that the buffer is empty.
+ *
+ ************************************************************************************/
+
+void uart_recvchars_dma(FAR uart_dev_t *dev)
+{
+	FAR struct uart_dmaxfer_s *xfer = &dev->dmarx;
+	FAR struct uart_buffer_s *rxbuf = &dev->recv;
+	int16_t head = rxbuf->head;
+	int16_t tail = rxbuf->tail;
+
+#ifdef CONFIG_SERIAL_IFLOWCONTROL
+	if (uart_dmarxflowcontrol(dev)) {
+		return;
+	}
+#endif
+
+	xfer->buffer = &rxbuf->buffer[head];
+	if (tail > head) {
+		xfer->length = tail - head - 1;
+		xfer->nbuffer = NULL;
+		xfer->nlength = 0;
+	} else if (tail == 0) {
+		xfer->length = rxbuf->size - head - 1;
+		xfer->nbuffer = NULL;
+		xfer->nlength = 0;
+	} else {
+		xfer->length = rxbuf->size - head;
+		xfer->nbuffer = rxbuf->buffer;
+		xfer->nlength = tail - 1;
+	}
+	xfer->nbytes = 0;
+
+	/* The buffer is full, the next read() calls dmarxfree() */
+
+	if (xfer->length == 0) {
+		return;
+	}
+
+	uart_dmareceive(dev);
+}
+
+/************************************************************************************
+ * Name: uart_recvchars_done
+ *
+ * Description:
+ *   Add the bytes received by the RX DMA transfer to the recv buffer.
+ *
+ ************************************************************************************/
+
+void uart_recvchars_done(FAR uart_dev_t *dev)
+{
+	FAR struct uart_dmaxfer_s *xfer = &dev->dmarx;
+	FAR struct uart_buffer_s *rxbuf = &dev->recv;
+	size_t nbytes = xfer->nbytes;
+
+	xfer->length = 0;
+	xfer->nlength = 0;
+	xfer->nbytes = 0;
+
+	if (nbytes == 0) {
+		return;
+	}
+
+	rxbuf->head = (rxbuf->head + nbytes) % rxbuf->size;
+	dev->received(dev);
+}
+
+#endif /* CONFIG_SERIAL_DMA */
@@ -0,0 +1,199 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <errno.h>
+#include <debug.h>
+#include <queue.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/spi/spi.h>
+#ifdef CONFIG_SPI_ASYNC
+#include <tinyara/wqueue.h>
+#endif
+
+#ifdef CONFIG_SPI_TRANSFER
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+#ifdef CONFIG_SPI_ASYNC
+/* The requests of all buses, in the order they were queued */
+
+static sq_queue_t g_spi_requests;
+static struct work_s g_spi_work;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: spi_transfer_segments
+ *
+ * Description:
+ *   Exchange the segments one by one, for the lower halves without the
+ *   transfer method.
+ *
+ ****************************************************************************/
+
+static void spi_transfer_segments(FAR struct spi_dev_s *dev, FAR struct spi_sequence_s *seq)
+{
+	FAR struct spi_trans_s *trans;
+	bool selected = false;
+	int index;
+
+	for (index = 0; index < seq->ntrans; index++) {
+		trans = &seq->trans[index];
+
+		if (!selected) {
+			SPI_SELECT(dev, seq->devid, true);
+			selected = true;
+		}
+#ifdef CONFIG_SPI_CMDDATA
+		SPI_CMDDATA(dev, seq->devid, trans->cmd);
+#endif
+		SPI_EXCHANGE(dev, trans->txbuffer, trans->rxbuffer, trans->nwords);
+
+		if (trans->deselect || index == seq->ntrans - 1) {
+			SPI_SELECT(dev, seq->devid, false);
+			selected = false;
+		}
+
+		if (trans->delay > 0) {
+			up_udelay(trans->delay);
+		}
+	}
+}
+
+#ifdef CONFIG_SPI_ASYNC
+/****************************************************************************
+ * Name: spi_async_worker
+ *
+ * Description:
+ *   Transfer the queued requests until the queue is empty
+ *
+ ****************************************************************************/
+
+static void spi_async_worker(FAR void *arg)
+{
+	FAR struct spi_request_s *req;
+	irqstate_t flags;
+	int ret;
+
+	for (;;) {
+		flags = enter_critical_section();
+		req = (FAR struct spi_request_s *)sq_remfirst(&g_spi_requests);
+		leave_critical_section(flags);
+
+		if (req == NULL) {
+			break;
+		}
+
+		ret = spi_transfer(req->dev, req->seq);
+		if (ret != OK) {
+			spidbg("transfer failed %d\n", ret);
+		}
+		if (req->callback) {
+			req->callback(req->arg, ret);
+		}
+	}
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: spi_transfer
+ *
+ * Description:
+ *   See include/tinyara/spi/spi.h
+ *
+ ****************************************************************************/
+
+int spi_transfer(FAR struct spi_dev_s *dev, FAR struct spi_sequence_s *seq)
+{
+	int ret = OK;
+
+	if (dev == NULL || seq == NULL || seq->trans == NULL || seq->ntrans <= 0) {
+		return -EINVAL;
+	}
+
+	SPI_LOCK(dev, true);
+	SPI_SETMODE(dev, seq->mode);
+	SPI_SETBITS(dev, seq->nbits);
+	SPI_SETFREQUENCY(dev, seq->frequency);
+
+	if (dev->ops->transfer) {
+		ret = dev->ops->transfer(dev, seq);
+	} else {
+		spi_transfer_segments(dev, seq);
+	}
+
+	SPI_LOCK(dev, false);
+	return ret;
+}
+
+#ifdef CONFIG_SPI_ASYNC
+/****************************************************************************
+ * Name: spi_transfer_async
+ *
+ * Description:
+ *   See include/tinyara/spi/spi.h
+ *
+ ****************************************************************************/
+
+int spi_transfer_async(FAR struct spi_request_s *req)
+{
+	irqstate_t flags;
+	int ret = OK;
+
+	if (req == NULL || req->dev == NULL || req->seq == NULL) {
+		return -EINVAL;
+	}
+
+	flags = enter_critical_section();
+	sq_addlast((FAR sq_entry_t *)req, &g_spi_requests);
+
+	/* The worker drains the whole queue, so it is queued only when idle.
+	 * A worker which is running is already off the queue and is queued
+	 * again, then it finds this request or an empty queue.
+	 */
+
+	if (work_available(&g_spi_work)) {
+		ret = work_queue(LPWORK, &g_spi_work, spi_async_worker, NULL, 0);
+		if (ret != OK) {
+			sq_rem((FAR sq_entry_t *)req, &g_spi_requests);
+		}
+	}
+	leave_critical_section(flags);
+
+	return ret;
+}
+#endif
+
+#endif /* CONFIG_SPI_TRANSFER */
@@ -36,6 +36,10 @@
 #include <task_manager/task_manager.h>
 
 #include "sched/sched.h"
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+#include <tinyara/task_monitor.h>
+#include "task_monitor/task_monitor_internal.h"
+#endif
 #if defined(HAVE_TASK_GROUP) && !defined(CONFIG_DISABLE_PTHREAD)
 #include "group/group.h"
 #endif
@@ -309,6 +313,18 @@ static int taskmgr_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 		tm_set_exit_cb((tm_exit_cb_t)data->addr);
 		ret = OK;
 		break;
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+	case TMIOC_MONITOR_NOTIFY:
+		/* The events of the task monitor are signaled to data->pid */
+		ret = task_monitor_set_notifier(data->pid);
+		break;
+	case TMIOC_MONITOR_EVENT:
+		if (data->addr == NULL || task_monitor_get_event((struct task_monitor_event_s *)data->addr) != OK) {
+			return ERROR;
+		}
+		ret = OK;
+		break;
+#endif
 	default:
 		tmdbg("Unrecognized cmd: %d arg: %ld\n", cmd, arg);
 		break;
@@ -41,6 +41,7 @@
 #include <tinyara/fs/fs.h>
 #include <tinyara/arch.h>
 #include <tinyara/ringbuf.h>
+#include <tinyara/ttrace.h>
 
 #include <arch/irq.h>
 
@@ -57,6 +58,7 @@
 #define TTRACE_SET_BUFSIZE     'z'
 #define TTRACE_USED_BUFSIZE    'u'
 #define TTRACE_BUFFER          'b'
+#define TTRACE_EVENTS          'e'
 
 #define TTRACE_STATE_IDLE       0
 #define TTRACE_STATE_RUNNING    1
@@ -192,16 +194,22 @@ static int ttrace_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 	case TTRACE_START:
 		g_state = TTRACE_STATE_RUNNING;
 		priv->ttrace_head = 0;
+#ifdef CONFIG_TTRACE_FAST
+		ttrace_fast_start(g_selected_tag, g_ringbuf.is_overwritable);
+#endif
 		break;
 	case TTRACE_OVERWRITE:
 		g_ringbuf.is_overwritable = arg;
 		break;
 	case TTRACE_FINISH:
+#ifdef CONFIG_TTRACE_FAST
+		ttrace_fast_stop();
+#endif
 		g_selected_tag = 0;
 		g_state = TTRACE_STATE_IDLE;
 		break;
 	case TTRACE_INFO:
-		ttdbg("Available tags: apps libs lock ipc task\r\n");
+		ttdbg("Available tags: apps libs lock ipc task media irq\r\n");
 		ttdbg("State: %d\r\n", g_state);
 		ttdbg("Selected tags: %d\r\n", g_selected_tag);
 		ttdbg("Buffer index: %d\r\n", g_ringbuf.index);
@@ -227,6 +235,11 @@ static int ttrace_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 		}
 		ttdbg("used bufsize: %d\r\n", ret);
 		break;
+#ifdef CONFIG_TTRACE_FAST
+	case TTRACE_EVENTS:
+		ret = ttrace_fast_read((FAR struct ttrace_events_s *)arg);
+		break;
+#endif
 	case TTRACE_BUFFER:
 		ttdbg("Resize of trace buffer is not supported yet.\r\n");
 		ttdbg("Trace buffer size should be defined by menuconfig.\r\n");
@@ -255,6 +268,10 @@ static int ttrace_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 
 int ttrace_init(void)
 {
+#ifdef CONFIG_TTRACE_FAST
+	ttrace_fast_init();
+#endif
+
 	/* Register the syslog character driver */
 	return register_driver(CONFIG_TTRACE_DEVPATH, &g_ttracefops, 0666, &g_sysdev);
 }
@@ -0,0 +1,282 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sched.h>
+#include <errno.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/sched.h>
+#include <tinyara/ttrace.h>
+
+#include <arch/irq.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define TTRACE_FAST_EVENTS      CONFIG_TTRACE_FAST_EVENTS
+
+#ifdef CONFIG_SMP
+#define TTRACE_FAST_NCPUS       CONFIG_SMP_NCPUS
+#else
+#define TTRACE_FAST_NCPUS       1
+#endif
+
+#define TTRACE_IDTYPE(type, id) ((uint16_t)(((type) << 12) | ((id) & 0x0fff)))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Events of one CPU.  They are written with interrupts disabled on that
+ * CPU only, so a CPU never waits for another one to trace.
+ */
+
+struct ttrace_ring_s {
+	uint32_t start;         /* Time of the oldest event */
+	uint32_t last;          /* Time of the newest event */
+	uint16_t head;          /* Slot of the next event */
+	uint16_t count;         /* Events in the ring */
+	uint32_t dropped;       /* Events lost, ring full and not overwritable */
+	int16_t pid;            /* Task running on the CPU, -1 if not known */
+	struct ttrace_event_s events[TTRACE_FAST_EVENTS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct ttrace_ring_s g_ttrace_rings[TTRACE_FAST_NCPUS];
+static volatile int g_ttrace_tags;
+static bool g_ttrace_overwritable;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ttrace_fast_record
+ *
+ * Description:
+ *   Append an event to the ring of the current CPU.
+ *
+ ****************************************************************************/
+
+static int ttrace_fast_record(int tag, uint16_t idtype, int16_t pid, uint32_t arg)
+{
+	FAR struct ttrace_ring_s *ring;
+	FAR struct ttrace_event_s *event;
+	irqstate_t flags;
+	uint32_t now;
+
+	if (!(g_ttrace_tags & tag)) {
+		return TTRACE_INVALID;
+	}
+
+	flags = irqsave();
+	ring = &g_ttrace_rings[up_cpu_index()];
+	now = up_perf_gettime();
+
+	if (ring->count == 0) {
+		ring->start = now;
+		ring->last = now;
+	} else if (ring->count == TTRACE_FAST_EVENTS) {
+		if (!g_ttrace_overwritable) {
+			ring->dropped++;
+			irqrestore(flags);
+			return TTRACE_INVALID;
+		}
+
+		/* The oldest event is at head, the next one becomes the oldest */
+
+		ring->start += ring->events[(ring->head + 1) % TTRACE_FAST_EVENTS].delta;
+		ring->count--;
+	}
+
+	event = &ring->events[ring->head];
+	event->delta = now - ring->last;
+	event->idtype = idtype;
+	event->pid = pid;
+	event->arg = arg;
+
+	ring->last = now;
+	ring->head = (ring->head + 1) % TTRACE_FAST_EVENTS;
+	ring->count++;
+
+	irqrestore(flags);
+	return TTRACE_VALID;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ttrace_fast_init
+ *
+ * Description:
+ *   Start the counter which times the events, unless the cycle accounting
+ *   of the scheduler already did.
+ *
+ ****************************************************************************/
+
+void ttrace_fast_init(void)
+{
+	int cpu;
+
+#ifndef CONFIG_SCHED_CPULOAD_CYCLES
+	up_perf_init((FAR void *)CONFIG_TTRACE_FAST_FREQ);
+#endif
+
+	for (cpu = 0; cpu < TTRACE_FAST_NCPUS; cpu++) {
+		g_ttrace_rings[cpu].pid = -1;
+	}
+}
+
+/****************************************************************************
+ * Name: ttrace_fast_start
+ *
+ * Description:
+ *   Empty the rings and record the events of the tags given from now on.
+ *
+ ****************************************************************************/
+
+void ttrace_fast_start(int tags, bool overwritable)
+{
+	irqstate_t flags;
+	int cpu;
+
+	g_ttrace_tags = 0;
+
+	/* A record still running on another CPU only ever touches its ring */
+
+	flags = irqsave();
+	for (cpu = 0; cpu < TTRACE_FAST_NCPUS; cpu++) {
+		g_ttrace_rings[cpu].head = 0;
+		g_ttrace_rings[cpu].count = 0;
+		g_ttrace_rings[cpu].dropped = 0;
+	}
+	g_ttrace_overwritable = overwritable;
+	irqrestore(flags);
+
+	g_ttrace_tags = tags;
+}
+
+void ttrace_fast_stop(void)
+{
+	g_ttrace_tags = 0;
+}
+
+/****************************************************************************
+ * Name: ttrace_fast_read
+ *
+ * Description:
+ *   Copy the events of a CPU, oldest first, once tracing is stopped.
+ *
+ ****************************************************************************/
+
+int ttrace_fast_read(FAR struct ttrace_events_s *events)
+{
+	FAR struct ttrace_ring_s *ring;
+	int oldest;
+	int count;
+	int i;
+
+	if (g_ttrace_tags != 0) {
+		return -EBUSY;
+	}
+	if (events == NULL || events->cpu < 0 || events->cpu >= TTRACE_FAST_NCPUS || events->count < 0) {
+		return -EINVAL;
+	}
+
+	ring = &g_ttrace_rings[events->cpu];
+	count = events->count < ring->count ? events->count : ring->count;
+	oldest = (ring->head + TTRACE_FAST_EVENTS - ring->count) % TTRACE_FAST_EVENTS;
+	for (i = 0; i < count; i++) {
+		events->events[i] = ring->events[(oldest + i) % TTRACE_FAST_EVENTS];
+	}
+
+	/* The oldest event is at start, its delta is from an overwritten one */
+
+	if (count > 0) {
+		events->events[0].delta = 0;
+	}
+	events->count = count;
+	events->start = ring->start;
+	events->freq = up_perf_getfreq();
+	events->dropped = ring->dropped;
+	return TTRACE_VALID;
+}
+
+/****************************************************************************
+ * Name: ttrace_fast_switch
+ *
+ * Description:
+ *   Called by the context switch with the task about to run.
+ *
+ ****************************************************************************/
+
+void ttrace_fast_switch(FAR struct tcb_s *next)
+{
+	FAR struct ttrace_ring_s *ring = &g_ttrace_rings[up_cpu_index()];
+	int16_t prev = ring->pid;
+
+	ring->pid = next->pid;
+	(void)ttrace_fast_record(TTRACE_TAG_TASK, TTRACE_IDTYPE(TTRACE_EVENT_SWITCH, next->sched_priority), prev, next->pid);
+}
+
+/****************************************************************************
+ * Name: ttrace_fast_irq
+ *
+ * Description:
+ *   Called by the interrupt dispatch around the handler.
+ *
+ ****************************************************************************/
+
+void ttrace_fast_irq(int irq, bool enter)
+{
+	(void)ttrace_fast_record(TTRACE_TAG_IRQ, TTRACE_IDTYPE(enter ? TTRACE_EVENT_IRQ_ENTER : TTRACE_EVENT_IRQ_LEAVE, irq), g_ttrace_rings[up_cpu_index()].pid, 0);
+}
+
+/****************************************************************************
+ * Name: trace_event
+ *
+ * Description:
+ *   Record an event of the caller.  In the flat build, where the rings are
+ *   reachable by all, this is a function call with interrupts disabled for
+ *   a few instructions, instead of a write() to the driver.
+ *
+ ****************************************************************************/
+
+int trace_event(int tag, int type, uint16_t id, uint32_t arg)
+{
+	if (type < TTRACE_EVENT_BEGIN || type > TTRACE_EVENT_INSTANT) {
+		return TTRACE_INVALID;
+	}
+	return ttrace_fast_record(tag, TTRACE_IDTYPE(type, id), sched_self()->pid, arg);
+}
@@ -270,20 +270,32 @@ static uint16_t cdcacm_fillrequest(FAR struct cdcacm_dev_s *priv, uint8_t *reqbu
 	FAR struct uart_buffer_s *xmit = &serdev->xmit;
 	irqstate_t flags;
 	uint16_t nbytes = 0;
+	uint16_t n;
 
 	/* Disable interrupts */
 
 	flags = enter_critical_section();
 
-	/* Transfer bytes while we have bytes available and there is room in the request */
+	/* Transfer bytes while we have bytes available and there is room in the request.
+	 * The data is copied in up to two runs, before and after the wrap around.
+	 */
 
 	while (xmit->head != xmit->tail && nbytes < reqlen) {
-		*reqbuf++ = xmit->buffer[xmit->tail];
-		nbytes++;
+		if (xmit->head > xmit->tail) {
+			n = xmit->head - xmit->tail;
+		} else {
+			n = xmit->size - xmit->tail;
+		}
+
+		n = MIN(n, reqlen - nbytes);
+		memcpy(reqbuf, &xmit->buffer[xmit->tail], n);
+		reqbuf += n;
+		nbytes += n;
 
 		/* Increment the tail pointer */
 
-		if (++(xmit->tail) >= xmit->size) {
+		xmit->tail += n;
+		if (xmit->tail >= xmit->size) {
 			xmit->tail = 0;
 		}
 	}
@@ -405,8 +417,9 @@ static inline int cdcacm_recvpacket(FAR struct cdcacm_dev_s *priv, uint8_t *reqb
 	FAR uart_dev_t *serdev = &priv->serdev;
 	FAR struct uart_buffer_s *recv = &serdev->recv;
 	uint16_t currhead;
-	uint16_t nexthead;
+	uint16_t tail;
 	uint16_t nbytes = 0;
+	uint16_t n;
 
 	uvdbg("head=%d tail=%d nrdq=%d reqlen=%d\n", priv->serdev.recv.head, priv->serdev.recv.tail, priv->nrdq, reqlen);
 
@@ -423,16 +436,6 @@ static inline int cdcacm_recvpacket(FAR struct cdcacm_dev_s *priv, uint8_t *reqb
 		currhead = priv->rxhead;
 	}
 
-	/* Pre-calculate the head index and check for wrap around.  We need to do this
-	 * so that we can determine if the circular buffer will overrun BEFORE we
-	 * overrun the buffer!
-	 */
-
-	nexthead = currhead + 1;
-	if (nexthead >= recv->size) {
-		nexthead = 0;
-	}
-
 	/* Then copy data into the RX buffer until either: (1) all of the data has been
 	 * copied, or (2) the RX buffer is full.
 	 *
@@ -446,21 +449,36 @@ static inline int cdcacm_recvpacket(FAR struct cdcacm_dev_s *priv, uint8_t *reqb
 	 * to throttle a serial device.
 	 */
 
-	while (nexthead != recv->tail && nbytes < reqlen) {
-		/* Copy one byte to the head of the circular RX buffer */
+	while (nbytes < reqlen) {
+		/* Get the free space up to the tail or the end of the circular RX
+		 * buffer.  One slot stays unused, as head == tail means empty.
+		 */
 
-		recv->buffer[currhead] = *reqbuf++;
+		tail = recv->tail;
+		if (tail > currhead) {
+			n = tail - currhead - 1;
+		} else if (tail == 0) {
+			n = recv->size - currhead - 1;
+		} else {
+			n = recv->size - currhead;
+		}
+
+		if (n == 0) {
+			break;
+		}
 
-		/* Update counts and indices */
+		/* Copy the run to the head of the circular RX buffer */
 
-		currhead = nexthead;
-		nbytes++;
+		n = MIN(n, reqlen - nbytes);
+		memcpy(&recv->buffer[currhead], reqbuf, n);
+		reqbuf += n;
+		nbytes += n;
 
 		/* Increment the head index and check for wrap around */
 
-		nexthead = currhead + 1;
-		if (nexthead >= recv->size) {
-			nexthead = 0;
+		currhead += n;
+		if (currhead >= recv->size) {
+			currhead = 0;
 		}
 	}
 
@@ -1954,6 +1954,7 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
 	ssize_t nread;
 	uint8_t *src;
 	uint8_t *dest;
+	uint32_t nsectors;
 	int nbytes;
 	int ret;
 
@@ -1965,12 +1966,23 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
 	while (priv->u.xfrlen > 0 || priv->nsectbytes > 0) {
 		usbtrace(TRACE_CLASSSTATE(USBMSC_CLASSSTATE_CMDREAD), priv->u.xfrlen);
 
-		/* Is the I/O buffer empty? */
+		/* Check if there is a request in the wrreqlist that we will be able to
+		 * use for data transfer.
+		 */
 
-		if (priv->nsectbytes <= 0) {
-			/* Yes.. read the next sector */
+		privreq = (FAR struct usbmsc_req_s *)sq_peek(&priv->wrreqlist);
 
-			nread = USBMSC_DRVR_READ(lun, priv->iobuffer, priv->sector, 1);
+		/* If the I/O buffer and the request are empty and the request holds whole
+		 * sectors, read as many sectors as fit directly into the request buffer.
+		 * That reads ahead of the sector being sent in one block driver call and
+		 * saves the copy through iobuffer[].
+		 */
+
+		if (privreq && priv->nsectbytes <= 0 && priv->nreqbytes == 0 && CONFIG_USBMSC_BULKINREQLEN >= lun->sectorsize) {
+			req = privreq->req;
+			nsectors = MIN(priv->u.xfrlen, CONFIG_USBMSC_BULKINREQLEN / lun->sectorsize);
+
+			nread = USBMSC_DRVR_READ(lun, req->buf, priv->sector, nsectors);
 			if (nread < 0) {
 				usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDREADREADFAIL), -nread);
 				lun->sd = SCSI_KCQME_UNRRE1;
@@ -1978,45 +1990,57 @@ static int usbmsc_cmdreadstate(FAR struct usbmsc_dev_s *priv)
 				break;
 			}
 
-			priv->nsectbytes = lun->sectorsize;
-			priv->u.xfrlen--;
-			priv->sector++;
-		}
+			priv->nreqbytes = nsectors * lun->sectorsize;
+			priv->u.xfrlen -= nsectors;
+			priv->sector += nsectors;
+		} else {
+			/* Is the I/O buffer empty? */
 
-		/* Check if there is a request in the wrreqlist that we will be able to
-		 * use for data transfer.
-		 */
+			if (priv->nsectbytes <= 0) {
+				/* Yes.. read the next sector */
 
-		privreq = (FAR struct usbmsc_req_s *)sq_peek(&priv->wrreqlist);
+				nread = USBMSC_DRVR_READ(lun, priv->iobuffer, priv->sector, 1);
+				if (nread < 0) {
+					usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDREADREADFAIL), -nread);
+					lun->sd = SCSI_KCQME_UNRRE1;
+					lun->sdinfo = priv->sector;
+					break;
+				}
 
-		/* If there no request structures available, then just return an error.
-		 * This will cause us to remain in the CMDREAD state.  When a request is
-		 * returned, the worker thread will be awakened in the USBMSC_STATE_CMDREAD
-		 * and we will be called again.
-		 */
+				priv->nsectbytes = lun->sectorsize;
+				priv->u.xfrlen--;
+				priv->sector++;
+			}
 
-		if (!privreq) {
-			usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDREADWRRQEMPTY), 0);
-			priv->nreqbytes = 0;
-			return -ENOMEM;
-		}
+			/* If there no request structures available, then just return an error.
+			 * This will cause us to remain in the CMDREAD state.  When a request is
+			 * returned, the worker thread will be awakened in the USBMSC_STATE_CMDREAD
+			 * and we will be called again.
+			 */
 
-		req = privreq->req;
+			if (!privreq) {
+				usbtrace(TRACE_CLSERROR(USBMSC_TRACEERR_CMDREADWRRQEMPTY), 0);
+				priv->nreqbytes = 0;
+				return -ENOMEM;
+			}
 
-		/* Transfer all of the data that will (1) fit into the request buffer, OR (2)
-		 * all of the data available in the sector buffer.
-		 */
+			req = privreq->req;
 
-		src = &priv->iobuffer[lun->sectorsize - priv->nsectbytes];
-		dest = &req->buf[priv->nreqbytes];
+			/* Transfer all of the data that will (1) fit into the request buffer, OR (2)
+			 * all of the data available in the sector buffer.
+			 */
 
-		nbytes = MIN(CONFIG_USBMSC_BULKINREQLEN - priv->nreqbytes, priv->nsectbytes);
+			src = &priv->iobuffer[lun->sectorsize - priv->nsectbytes];
+			dest = &req->buf[priv->nreqbytes];
 
-		/* Copy the data from the sector buffer to the USB request and update counts */
+			nbytes = MIN(CONFIG_USBMSC_BULKINREQLEN - priv->nreqbytes, priv->nsectbytes);
 
-		memcpy(dest, src, nbytes);
-		priv->nreqbytes += nbytes;
-		priv->nsectbytes -= nbytes;
+			/* Copy the data from the sector buffer to the USB request and update counts */
+
+			memcpy(dest, src, nbytes);
+			priv->nreqbytes += nbytes;
+			priv->nsectbytes -= nbytes;
+		}
 
 		/* If (1) the request buffer is full OR (2) this is the final request full of data,
 		 * then submit the request
@@ -421,6 +421,18 @@ static int fb_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 	break;
 #endif
 
+#ifdef CONFIG_FB_FRAMESTATS
+	case FBIOGET_FRAMESTATS: { /* Get frame timing statistics */
+		FAR struct fb_framestats_s *stats =
+			(FAR struct fb_framestats_s *)((uintptr_t)arg);
+
+		DEBUGASSERT(stats != 0 && fb->vtable != NULL &&
+					fb->vtable->getframestats != NULL);
+		ret = fb->vtable->getframestats(fb->vtable, stats);
+	}
+	break;
+#endif
+
 #ifdef CONFIG_FB_OVERLAY
 	case FBIO_SELECT_OVERLAY: { /* Select video overlay */
 		struct fb_overlayinfo_s oinfo;
@@ -69,6 +69,8 @@
 #include <tinyara/arch.h>
 #include <tinyara/board.h>
 #include <tinyara/kmalloc.h>
+#include <tinyara/clock.h>
+#include <tinyara/fs/ioctl.h>
 
 #include <arch/board/board.h>
 
@@ -87,6 +89,13 @@
 
 #define VIDEO_REMAINING_CAPNUM_INFINITY (-1)
 
+/* Buffers of the driver start and end on cache lines, so the cache
+ * maintenance of the DMA of one buffer leaves the others alone.
+ */
+
+#define VIDEO_MMAP_ALIGN        CONFIG_VIDEO_MMAP_ALIGN
+#define VIDEO_MMAP_ALIGN_UP(n)  (((n) + VIDEO_MMAP_ALIGN - 1) & ~(VIDEO_MMAP_ALIGN - 1))
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -127,6 +136,17 @@ struct video_type_inf_s {
 	int32_t remaining_capnum;
 	video_wait_dma_t wait_dma;
 	video_framebuff_t bufinf;
+	struct v4l2_pix_format pix;         /* Format set by VIDIOC_S_FMT */
+	struct v4l2_process process;        /* pixelformat is 0 if the frames are not processed */
+	bool process_on_device;             /* The device captures processed frames */
+	FAR uint8_t *pool;                  /* Buffers of V4L2_MEMORY_MMAP */
+	uint16_t pool_count;
+	uint32_t pool_buflen;               /* Size of a buffer, the capture then the processed image */
+	uint32_t capture_len;               /* Size of the capture */
+	uint32_t process_len;               /* Size of the processed image */
+	uint16_t sequence;
+	struct v4l2_stream_stats stats;
+	uint64_t latency_total_us;
 };
 
 typedef struct video_type_inf_s video_type_inf_t;
@@ -172,6 +192,10 @@ static int video_reqbufs(FAR video_upperhalf_t *priv, FAR struct v4l2_requestbuf
 static int video_qbuf(FAR video_upperhalf_t *priv, FAR struct v4l2_buffer *buf);
 static int video_dqbuf(FAR video_upperhalf_t *priv, FAR struct v4l2_buffer *buf);
 static int video_cancel_dqbuf(FAR video_upperhalf_t *priv, enum v4l2_buf_type type);
+static int video_querybuf(FAR video_upperhalf_t *priv, FAR struct v4l2_buffer *buf);
+static int video_set_process(FAR video_upperhalf_t *priv, FAR struct v4l2_process *process);
+static int video_dqframe(FAR video_upperhalf_t *priv, FAR struct v4l2_frame *frame);
+static int video_get_stream_stats(FAR video_upperhalf_t *priv, FAR struct v4l2_stream_stats *stats);
 static int video_enum_fmt(FAR video_upperhalf_t *priv, FAR struct v4l2_fmtdesc *fmt);
 static int video_enum_framesizes(FAR video_upperhalf_t *priv, FAR struct v4l2_frmsizeenum *frmsize);
 static int video_set_fmt(FAR video_upperhalf_t *priv, FAR struct v4l2_format *fmt);
@@ -364,6 +388,9 @@ static void initialize_resources(FAR video_upperhalf_t *priv)
 static void cleanup_streamresources(FAR video_type_inf_t *type_inf)
 {
 	video_framebuff_uninit(&type_inf->bufinf);
+	if (type_inf->pool != NULL) {
+		kumm_free(type_inf->pool);
+	}
 	sem_destroy(&type_inf->wait_dma.dqbuf_wait_flg);
 	sem_destroy(&type_inf->lock_state);
 	memset(type_inf, 0, sizeof(video_type_inf_t));
@@ -398,6 +425,163 @@ static bool is_sem_waited(FAR sem_t *sem)
 	return ret;
 }
 
+static uint32_t video_bytes_per_pixel(uint32_t pixelformat)
+{
+	switch (pixelformat) {
+	case V4L2_PIX_FMT_UYVY:
+	case V4L2_PIX_FMT_YUY2:
+	case V4L2_PIX_FMT_RGB565:
+		return 2;
+	case V4L2_PIX_FMT_RGB24:
+		return 3;
+	case V4L2_PIX_FMT_GREY:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static void video_free_pool(FAR video_type_inf_t *type_inf)
+{
+	if (type_inf->pool != NULL) {
+		kumm_free(type_inf->pool);
+		type_inf->pool = NULL;
+	}
+	type_inf->pool_count = 0;
+}
+
+/* Allocate the buffers of V4L2_MEMORY_MMAP in one block, which is what
+ * mmap() maps.  A buffer holds the capture, then the image processed from it
+ * by the driver.
+ */
+
+static int video_alloc_pool(FAR video_type_inf_t *type_inf, uint32_t count)
+{
+	uint32_t capture_len;
+
+	video_free_pool(type_inf);
+
+	capture_len = type_inf->pix.sizeimage;
+	if (capture_len == 0) {
+		capture_len = type_inf->pix.width * type_inf->pix.height * video_bytes_per_pixel(type_inf->pix.pixelformat);
+	}
+
+	type_inf->process_len = 0;
+	if (type_inf->process.pixelformat != 0) {
+		type_inf->process_len = type_inf->process.width * type_inf->process.height * video_bytes_per_pixel(type_inf->process.pixelformat);
+		if (type_inf->process_on_device) {
+			capture_len = type_inf->process_len;
+		}
+	}
+
+	if (capture_len == 0 || count == 0) {
+		return -EINVAL;
+	}
+
+	type_inf->capture_len = capture_len;
+	type_inf->pool_buflen = VIDEO_MMAP_ALIGN_UP(capture_len);
+	if (type_inf->process.pixelformat != 0 && !type_inf->process_on_device) {
+		type_inf->pool_buflen += VIDEO_MMAP_ALIGN_UP(type_inf->process_len);
+	}
+
+	type_inf->pool = (FAR uint8_t *)kumm_memalign(VIDEO_MMAP_ALIGN, type_inf->pool_buflen * count);
+	if (type_inf->pool == NULL) {
+		videodbg("Failed to allocate %u buffers of %u bytes\n", count, type_inf->pool_buflen);
+		return -ENOMEM;
+	}
+	type_inf->pool_count = count;
+
+	return OK;
+}
+
+static uint8_t video_clip(int32_t value)
+{
+	return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+/* Read a pixel of a row of a UYVY, YUY2 or RGB565 frame */
+
+static void video_read_pixel(FAR const uint8_t *row, uint32_t x, uint32_t pixelformat, FAR uint8_t *rgb, FAR uint8_t *luma)
+{
+	FAR const uint8_t *pair;
+	uint16_t value;
+	int32_t y;
+	int32_t u;
+	int32_t v;
+
+	if (pixelformat == V4L2_PIX_FMT_RGB565) {
+		value = row[x * 2] | (row[x * 2 + 1] << 8);
+		rgb[0] = (value >> 8) & 0xf8;
+		rgb[1] = (value >> 3) & 0xfc;
+		rgb[2] = (value << 3) & 0xf8;
+		*luma = (77 * rgb[0] + 150 * rgb[1] + 29 * rgb[2]) >> 8;
+		return;
+	}
+
+	/* Two pixels share their chroma */
+
+	pair = row + (x & ~1) * 2;
+	if (pixelformat == V4L2_PIX_FMT_UYVY) {
+		u = pair[0];
+		y = pair[(x & 1) ? 3 : 1];
+		v = pair[2];
+	} else {
+		y = pair[(x & 1) ? 2 : 0];
+		u = pair[1];
+		v = pair[3];
+	}
+
+	/* ITU-R BT.601 */
+
+	*luma = y;
+	y = 298 * (y - 16) + 128;
+	u -= 128;
+	v -= 128;
+	rgb[0] = video_clip((y + 409 * v) >> 8);
+	rgb[1] = video_clip((y - 100 * u - 208 * v) >> 8);
+	rgb[2] = video_clip((y + 516 * u) >> 8);
+}
+
+/* Crop, scale by nearest pixels and convert a frame, for a device which
+ * does not do it itself.
+ */
+
+static void video_process_frame(FAR video_type_inf_t *type_inf, FAR const uint8_t *src, FAR uint8_t *dst)
+{
+	FAR struct v4l2_process *process = &type_inf->process;
+	FAR const uint8_t *row;
+	uint32_t stride = type_inf->pix.width * 2;
+	uint32_t step_x = (process->crop.width << 16) / process->width;
+	uint32_t step_y = (process->crop.height << 16) / process->height;
+	uint32_t x;
+	uint32_t y;
+	uint16_t value;
+	uint8_t rgb[3];
+	uint8_t luma;
+
+	for (y = 0; y < process->height; y++) {
+		row = src + (process->crop.top + ((y * step_y) >> 16)) * stride;
+		for (x = 0; x < process->width; x++) {
+			video_read_pixel(row, process->crop.left + ((x * step_x) >> 16), type_inf->pix.pixelformat, rgb, &luma);
+			switch (process->pixelformat) {
+			case V4L2_PIX_FMT_RGB24:
+				*dst++ = rgb[0];
+				*dst++ = rgb[1];
+				*dst++ = rgb[2];
+				break;
+			case V4L2_PIX_FMT_RGB565:
+				value = ((rgb[0] & 0xf8) << 8) | ((rgb[1] & 0xfc) << 3) | (rgb[2] >> 3);
+				*dst++ = value & 0xff;
+				*dst++ = value >> 8;
+				break;
+			default:
+				*dst++ = luma;
+				break;
+			}
+		}
+	}
+}
+
 static ssize_t video_open(FAR struct file *filep)
 {
 	FAR struct inode *inode = filep->f_inode;
@@ -464,6 +648,26 @@ static int video_reqbufs(FAR video_upperhalf_t *priv, FAR struct v4l2_requestbuf
 		return -EINVAL;
 	}
 
+	if (type_inf->state == VIDEO_STATE_DMA) {
+		return -EPERM;
+	}
+
+	if (reqbufs->memory == V4L2_MEMORY_MMAP) {
+		if (reqbufs->type != V4L2_BUF_TYPE_VIDEO_CAPTURE) {
+			return -EINVAL;
+		}
+		ret = video_alloc_pool(type_inf, reqbufs->count);
+		if (ret < 0) {
+			return ret;
+		}
+	} else {
+		video_free_pool(type_inf);
+	}
+
+	memset(&type_inf->stats, 0, sizeof(struct v4l2_stream_stats));
+	type_inf->latency_total_us = 0;
+	type_inf->sequence = 0;
+
 	flags = enter_critical_section();
 
 	if (type_inf->state == VIDEO_STATE_DMA) {
@@ -501,7 +705,11 @@ static int video_qbuf(FAR video_upperhalf_t *priv, FAR struct v4l2_buffer *buf)
 		return -EINVAL;
 	}
 
-	if (!is_bufsize_sufficient(priv, buf->length)) {
+	if (buf->memory == V4L2_MEMORY_MMAP) {
+		if (type_inf->pool == NULL || buf->index >= type_inf->pool_count) {
+			return -EINVAL;
+		}
+	} else if (!is_bufsize_sufficient(priv, buf->length)) {
 		return -EINVAL;
 	}
 
@@ -511,6 +719,10 @@ static int video_qbuf(FAR video_upperhalf_t *priv, FAR struct v4l2_buffer *buf)
 	}
 
 	memcpy(&container->buf, buf, sizeof(struct v4l2_buffer));
+	if (buf->memory == V4L2_MEMORY_MMAP) {
+		container->buf.m.userptr = (unsigned long)(type_inf->pool + buf->index * type_inf->pool_buflen);
+		container->buf.length = type_inf->capture_len;
+	}
 	video_framebuff_queue_container(&type_inf->bufinf, container);
 
 	video_lock(&type_inf->lock_state);
@@ -549,6 +761,7 @@ streamoff:
 static int video_dqbuf(FAR video_upperhalf_t *priv, FAR struct v4l2_buffer *buf)
 {
 	int ret = OK;
+	uint32_t elapsed;
 	irqstate_t flags;
 	FAR video_type_inf_t *type_inf;
 	FAR vbuf_container_t *container;
@@ -609,10 +822,29 @@ static int video_dqbuf(FAR video_upperhalf_t *priv, FAR struct v4l2_buffer *buf)
 		return -EIO;
 	}
 
+	elapsed = TICK2USEC(clock_systimer() - container->done_time);
+	type_inf->stats.dequeued++;
+	type_inf->latency_total_us += elapsed;
+	if (elapsed > type_inf->stats.latency_max_us) {
+		type_inf->stats.latency_max_us = elapsed;
+	}
+
 	memcpy(buf, &container->buf, sizeof(struct v4l2_buffer));
 
 	video_framebuff_free_container(&type_inf->bufinf, container);
 
+	if (buf->memory == V4L2_MEMORY_MMAP) {
+		/* The frame is in a buffer of the driver, the offset of mmap() stands for its address */
+
+		buf->m.offset = buf->index * type_inf->pool_buflen;
+		if (type_inf->process.pixelformat != 0 && !type_inf->process_on_device) {
+			video_process_frame(type_inf, type_inf->pool + buf->m.offset, type_inf->pool + buf->m.offset + VIDEO_MMAP_ALIGN_UP(type_inf->capture_len));
+			buf->m.offset += VIDEO_MMAP_ALIGN_UP(type_inf->capture_len);
+			buf->bytesused = type_inf->process_len;
+			buf->length = type_inf->process_len;
+		}
+	}
+
 	return OK;
 }
 
@@ -640,6 +872,147 @@ static int video_cancel_dqbuf(FAR video_upperhalf_t *priv, enum v4l2_buf_type ty
 	return OK;
 }
 
+static int video_querybuf(FAR video_upperhalf_t *priv, FAR struct v4l2_buffer *buf)
+{
+	FAR video_type_inf_t *type_inf;
+
+	if ((priv == NULL) || (buf == NULL)) {
+		return -EINVAL;
+	}
+
+	type_inf = get_video_type_inf(priv, buf->type);
+	if (type_inf == NULL || type_inf->pool == NULL || buf->index >= type_inf->pool_count) {
+		return -EINVAL;
+	}
+
+	buf->memory = V4L2_MEMORY_MMAP;
+	buf->m.offset = buf->index * type_inf->pool_buflen;
+	buf->length = type_inf->capture_len;
+
+	return OK;
+}
+
+static int video_set_process(FAR video_upperhalf_t *priv, FAR struct v4l2_process *process)
+{
+	FAR video_type_inf_t *type_inf;
+	FAR struct video_devops_s *video_devops;
+	int ret;
+
+	if ((priv == NULL) || (process == NULL)) {
+		return -EINVAL;
+	}
+
+	type_inf = get_video_type_inf(priv, process->type);
+	if (type_inf == NULL) {
+		return -EINVAL;
+	}
+
+	/* The size of the buffers depends on it */
+
+	if (type_inf->pool != NULL || type_inf->state != VIDEO_STATE_STREAMOFF) {
+		return -EBUSY;
+	}
+
+	memset(&type_inf->process, 0, sizeof(struct v4l2_process));
+	type_inf->process_on_device = false;
+	if (process->pixelformat == 0) {
+		return OK;
+	}
+
+	if (process->crop.width == 0 || process->crop.height == 0) {
+		process->crop.left = 0;
+		process->crop.top = 0;
+		process->crop.width = type_inf->pix.width;
+		process->crop.height = type_inf->pix.height;
+	}
+
+	if (type_inf->pix.pixelformat == V4L2_PIX_FMT_RGB24 || type_inf->pix.pixelformat == V4L2_PIX_FMT_GREY ||
+		video_bytes_per_pixel(type_inf->pix.pixelformat) == 0 || video_bytes_per_pixel(process->pixelformat) == 0 ||
+		process->pixelformat == V4L2_PIX_FMT_UYVY || process->pixelformat == V4L2_PIX_FMT_YUY2 ||
+		process->width == 0 || process->height == 0 || process->crop.left < 0 || process->crop.top < 0 ||
+		process->crop.left + process->crop.width > type_inf->pix.width ||
+		process->crop.top + process->crop.height > type_inf->pix.height) {
+		videodbg("Unable to process %ux%u frames to %ux%u\n", type_inf->pix.width, type_inf->pix.height, process->width, process->height);
+		return -EINVAL;
+	}
+
+	video_devops = priv->dev->ops;
+	if (video_devops->set_process != NULL) {
+		ret = video_devops->set_process(priv->dev, process);
+		if (ret == OK) {
+			type_inf->process_on_device = true;
+		} else if (ret != -ENOSYS) {
+			return ret;
+		}
+	}
+
+	memcpy(&type_inf->process, process, sizeof(struct v4l2_process));
+
+	return OK;
+}
+
+static int video_dqframe(FAR video_upperhalf_t *priv, FAR struct v4l2_frame *frame)
+{
+	FAR video_type_inf_t *type_inf;
+	struct v4l2_buffer buf;
+	int ret;
+
+	if ((priv == NULL) || (frame == NULL)) {
+		return -EINVAL;
+	}
+
+	type_inf = get_video_type_inf(priv, frame->type);
+	if (type_inf == NULL || type_inf->pool == NULL) {
+		return -EINVAL;
+	}
+
+	memset(&buf, 0, sizeof(struct v4l2_buffer));
+	buf.type = frame->type;
+	buf.memory = V4L2_MEMORY_MMAP;
+	ret = video_dqbuf(priv, &buf);
+	if (ret < 0) {
+		return ret;
+	}
+
+	frame->index = buf.index;
+	frame->sequence = buf.sequence;
+	frame->bytesused = buf.bytesused;
+	frame->data = type_inf->pool + buf.m.offset;
+	if (type_inf->process.pixelformat != 0) {
+		frame->width = type_inf->process.width;
+		frame->height = type_inf->process.height;
+		frame->pixelformat = type_inf->process.pixelformat;
+	} else {
+		frame->width = type_inf->pix.width;
+		frame->height = type_inf->pix.height;
+		frame->pixelformat = type_inf->pix.pixelformat;
+	}
+
+	return OK;
+}
+
+static int video_get_stream_stats(FAR video_upperhalf_t *priv, FAR struct v4l2_stream_stats *stats)
+{
+	FAR video_type_inf_t *type_inf;
+	irqstate_t flags;
+
+	if ((priv == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	type_inf = get_video_type_inf(priv, stats->type);
+	if (type_inf == NULL) {
+		return -EINVAL;
+	}
+
+	flags = enter_critical_section();
+	memcpy(stats, &type_inf->stats, sizeof(struct v4l2_stream_stats));
+	stats->latency_avg_us = stats->dequeued ? (uint32_t)(type_inf->latency_total_us / stats->dequeued) : 0;
+	leave_critical_section(flags);
+
+	return OK;
+}
+
 static int video_enum_fmt(FAR video_upperhalf_t *priv, FAR struct v4l2_fmtdesc *fmt)
 {
 	int ret;
@@ -703,6 +1076,7 @@ static int video_try_fmt(FAR video_upperhalf_t *priv, FAR struct v4l2_format *fm
 static int video_set_fmt(FAR video_upperhalf_t *priv, FAR struct v4l2_format *fmt)
 {
 	int ret;
+	FAR video_type_inf_t *type_inf;
 	FAR struct video_devops_s *video_devops;
 
 	if (priv == NULL) {
@@ -721,6 +1095,12 @@ static int video_set_fmt(FAR video_upperhalf_t *priv, FAR struct v4l2_format *fm
 	}
 
 	ret = video_devops->set_format(priv->dev, fmt);
+	if (ret == OK) {
+		type_inf = get_video_type_inf(priv, fmt->type);
+		if (type_inf != NULL) {
+			memcpy(&type_inf->pix, &fmt->fmt.pix, sizeof(struct v4l2_pix_format));
+		}
+	}
 
 	return ret;
 }
@@ -1181,6 +1561,27 @@ static ssize_t video_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 	case VIDIOC_CANCEL_DQBUF:
 		ret = video_cancel_dqbuf(priv, (FAR enum v4l2_buf_type)arg);
 		break;
+	case VIDIOC_QUERYBUF:
+		ret = video_querybuf(priv, (FAR struct v4l2_buffer *)arg);
+		break;
+	case VIDIOC_S_PROCESS:
+		ret = video_set_process(priv, (FAR struct v4l2_process *)arg);
+		break;
+	case VIDIOC_DQFRAME:
+		ret = video_dqframe(priv, (FAR struct v4l2_frame *)arg);
+		break;
+	case VIDIOC_G_STREAM_STATS:
+		ret = video_get_stream_stats(priv, (FAR struct v4l2_stream_stats *)arg);
+		break;
+	case FIOC_MMAP:
+		/* Only the buffers of the video stream can be mapped */
+
+		if (priv->video_inf.pool == NULL || arg == 0) {
+			ret = -EINVAL;
+		} else {
+			*(FAR void **)((uintptr_t)arg) = priv->video_inf.pool;
+		}
+		break;
 	case VIDIOC_STREAMON:
 		ret = video_streamon(priv, (FAR enum v4l2_buf_type *)arg);
 		break;
@@ -1373,8 +1774,15 @@ int video_common_notify_dma_done(uint8_t err_code, uint32_t buf_type, uint32_t d
 		return -EINVAL;
 	}
 
+	/* The lower half has made the buffer coherent with the cache before
+	 * it notifies.
+	 */
+
+	type_inf->bufinf.vbuf_dma->done_time = clock_systimer();
 	if (err_code == 0) {
 		type_inf->bufinf.vbuf_dma->buf.flags = 0;
+		type_inf->bufinf.vbuf_dma->buf.sequence = type_inf->sequence++;
+		type_inf->stats.frames++;
 		if (type_inf->remaining_capnum > 0) {
 			type_inf->remaining_capnum--;
 		}
@@ -1383,7 +1791,9 @@ int video_common_notify_dma_done(uint8_t err_code, uint32_t buf_type, uint32_t d
 	}
 
 	type_inf->bufinf.vbuf_dma->buf.bytesused = datasize;
-	video_framebuff_dma_done(&type_inf->bufinf);
+	if (video_framebuff_dma_done(&type_inf->bufinf)) {
+		type_inf->stats.dropped++;
+	}
 
 	if (is_sem_waited(&type_inf->wait_dma.dqbuf_wait_flg)) {
 		/* If waiting DMA done in DQBUF,
@@ -1412,6 +1822,7 @@ int video_common_notify_dma_done(uint8_t err_code, uint32_t buf_type, uint32_t d
 		if (!container) {
 			video_devops->cancel_dma(priv->dev);
 			type_inf->state = VIDEO_STATE_STREAMON;
+			type_inf->stats.starved++;
 		} else {
 			video_devops->set_buf(priv->dev, buf_type, container->buf.m.userptr, container->buf.length);
 		}
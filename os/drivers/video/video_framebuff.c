@@ -235,16 +235,23 @@ vbuf_container_t *video_framebuff_get_dma_container(video_framebuff_t *fbuf)
 	return ret;
 }
 
-void video_framebuff_dma_done(video_framebuff_t *fbuf)
+/* Returns true if the oldest frame not dequeued is given up to the next DMA */
+
+bool video_framebuff_dma_done(video_framebuff_t *fbuf)
 {
+	bool dropped = false;
+
 	fbuf->vbuf_dma = NULL;
 	if (fbuf->vbuf_next_dma) {
 		fbuf->vbuf_next_dma = fbuf->vbuf_next_dma->next;
 		if (fbuf->vbuf_next_dma == fbuf->vbuf_top) {	/* RING mode case. */
 			fbuf->vbuf_top = fbuf->vbuf_top->next;
 			fbuf->vbuf_tail = fbuf->vbuf_tail->next;
+			dropped = true;
 		}
 	}
+
+	return dropped;
 }
 
 void video_framebuff_change_mode(video_framebuff_t *fbuf, enum v4l2_buf_mode mode)
@@ -54,11 +54,14 @@
 #define __SPRESENSE_VIDEO_FRAMEBUFF_H__
 
 #include <video/video.h>
+#include <stdbool.h>
 #include <semaphore.h>
+#include <sys/types.h>
 #include <tinyara/irq.h>
 
 struct vbuf_container_s {
 	struct v4l2_buffer buf;		/* Buffer information */
+	clock_t done_time;			/* System time at the end of DMA */
 	struct vbuf_container_s *next;	/* pointer to next buffer */
 };
 typedef struct vbuf_container_s vbuf_container_t;
@@ -86,7 +89,7 @@ void video_framebuff_queue_container(video_framebuff_t *fbuf, vbuf_container_t *
 vbuf_container_t *video_framebuff_dq_valid_container(video_framebuff_t *fbuf);
 vbuf_container_t *video_framebuff_get_dma_container(video_framebuff_t *fbuf);
 vbuf_container_t *video_framebuff_pop_curr_container(video_framebuff_t *fbuf);
-void video_framebuff_dma_done(video_framebuff_t *fbuf);
+bool video_framebuff_dma_done(video_framebuff_t *fbuf);
 void video_framebuff_change_mode(video_framebuff_t *fbuf, enum v4l2_buf_mode mode);
 
 #endif							// __SPRESENSE_VIDEO_FRAMEBUFF_H__
@@ -420,7 +420,9 @@ int rtk_drv_initialize(void)
 	struct netdev_config nconfig;
 	nconfig.ops = &nops;
 	nconfig.flag = NM_FLAG_ETHARP | NM_FLAG_ETHERNET | NM_FLAG_BROADCAST | NM_FLAG_IGMP;
+	nconfig.offload = 0;
 	nconfig.mtu = CONFIG_NET_ETH_MTU; // is it right that vendor decides MTU size??
+	nconfig.rx_reserve = 0;
 	nconfig.hwaddr_len = IFHWADDRLEN;
 
 	nconfig.is_default = 1;
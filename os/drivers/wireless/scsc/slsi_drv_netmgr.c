@@ -808,7 +808,9 @@ struct netdev* slsidrv_register_dev(int sizeof_priv)
 	struct netdev_config nconfig;
 	nconfig.ops = &nops;
 	nconfig.flag = NM_FLAG_ETHARP | NM_FLAG_ETHERNET | NM_FLAG_BROADCAST | NM_FLAG_IGMP;
+	nconfig.offload = 0;
 	nconfig.mtu = CONFIG_NET_ETH_MTU; // is it right that vendor decides MTU size??
+	nconfig.rx_reserve = 0;
 	nconfig.hwaddr_len = IFHWADDRLEN;
 
 	nconfig.is_default = 1;
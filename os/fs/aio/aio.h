@@ -90,6 +90,32 @@
 #error AIO needs file and/or socket descriptors
 #endif
 
+/* The low priority work queue is boosted to the priority of the requester
+ * only when it runs the I/O.
+ */
+
+#if defined(CONFIG_PRIORITY_INHERITANCE) && !defined(CONFIG_FS_AIO_WORKERS)
+#define AIO_LPWORK_PRIOINHERIT
+#endif
+
+#ifdef CONFIG_FS_AIO_WORKERS
+#ifndef CONFIG_FS_AIO_NTHREADS
+#define CONFIG_FS_AIO_NTHREADS 2
+#endif
+
+#ifndef CONFIG_FS_AIO_PRIORITY
+#define CONFIG_FS_AIO_PRIORITY 100
+#endif
+
+#ifndef CONFIG_FS_AIO_STACKSIZE
+#define CONFIG_FS_AIO_STACKSIZE 2048
+#endif
+
+#ifndef CONFIG_FS_AIO_MERGESIZE
+#define CONFIG_FS_AIO_MERGESIZE 4096
+#endif
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -99,6 +125,7 @@
  */
 
 struct file;
+struct aio_devq_s;
 struct aio_container_s {
 	dq_entry_t aioc_link;		/* Supports a doubly linked list */
 	FAR struct aiocb *aioc_aiocbp;	/* The contained AIO control block */
@@ -109,6 +136,12 @@ struct aio_container_s {
 		FAR void *ptr;			/* Generic pointer to FAR data */
 	} u;
 	struct work_s aioc_work;	/* Used to defer I/O to the work thread */
+#ifdef CONFIG_FS_AIO_WORKERS
+	dq_entry_t aioc_qlink;		/* Supports the list of the device queue */
+	FAR struct aio_devq_s *aioc_devq;	/* Device queue, NULL once started */
+	worker_t aioc_worker;		/* Performs the I/O */
+#endif
+	uint8_t aioc_op;			/* LIO_READ, LIO_WRITE or LIO_NOP (fsync) */
 	pid_t aioc_pid;				/* ID of the waiting task */
 #ifdef CONFIG_PRIORITY_INHERITANCE
 	uint8_t aioc_prio;			/* Priority of the waiting task */
@@ -250,7 +283,8 @@ FAR struct aiocb *aioc_decant(FAR struct aio_container_s *aioc);
  * Name: aio_queue
  *
  * Description:
- *   Schedule the asynchronous I/O on the low priority work queue
+ *   Schedule the asynchronous I/O on the low priority work queue, or on the
+ *   queue of its device with CONFIG_FS_AIO_WORKERS
  *
  * Input Parameters:
  *   arg - Worker argument.  In this case, a pointer to an instance of
@@ -264,6 +298,25 @@ FAR struct aiocb *aioc_decant(FAR struct aio_container_s *aioc);
 
 int aio_queue(FAR struct aio_container_s *aioc, worker_t worker);
 
+/****************************************************************************
+ * Name: aio_dequeue
+ *
+ * Description:
+ *   Remove a queued asynchronous I/O before it is started.  The caller
+ *   holds the lock on the pending list.
+ *
+ * Input Parameters:
+ *   aioc - The AIO container to remove
+ *
+ * Returned Value:
+ *   Zero (OK) if the I/O was removed; -ENOENT if it is already running.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_AIO_WORKERS
+int aio_dequeue(FAR struct aio_container_s *aioc);
+#endif
+
 /****************************************************************************
  * Name: aio_signal
  *
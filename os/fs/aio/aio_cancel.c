@@ -170,17 +170,23 @@ int aio_cancel(int fildes, FAR struct aiocb *aiocbp)
 				 * first case.
 				 */
 
+#ifdef CONFIG_FS_AIO_WORKERS
+				status = aio_dequeue(aioc);
+#else
 				status = work_cancel(LPWORK, &aioc->aioc_work);
+#endif
 				if (status >= 0) {
 					aiocbp->aio_result = -ECANCELED;
 					ret = AIO_CANCELED;
+
+					/* Remove the container from the list of pending
+					 * transfers.  A started worker decants it itself.
+					 */
+
+					(void)aioc_decant(aioc);
 				} else {
 					ret = AIO_NOTCANCELED;
 				}
-
-				/* Remove the container from the list of pending transfers */
-
-				(void)aioc_decant(aioc);
 			}
 		}
 	} else {
@@ -205,15 +211,18 @@ int aio_cancel(int fildes, FAR struct aiocb *aiocbp)
 				 * first case.
 				 */
 
+#ifdef CONFIG_FS_AIO_WORKERS
+				status = aio_dequeue(aioc);
+#else
 				status = work_cancel(LPWORK, &aioc->aioc_work);
-
-				/* Remove the container from the list of pending transfers */
-
+#endif
 				next = (FAR struct aio_container_s *)aioc->aioc_link.flink;
-				aiocbp = aioc_decant(aioc);
-				DEBUGASSERT(aiocbp);
 
 				if (status >= 0) {
+					/* Remove the container from the list of pending transfers */
+
+					aiocbp = aioc_decant(aioc);
+					DEBUGASSERT(aiocbp);
 					aiocbp->aio_result = -ECANCELED;
 					if (ret != AIO_NOTCANCELED) {
 						ret = AIO_CANCELED;
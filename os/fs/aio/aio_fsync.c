@@ -110,7 +110,7 @@ static void aio_fsync_worker(FAR void *arg)
 	FAR struct aio_container_s *aioc = (FAR struct aio_container_s *)arg;
 	FAR struct aiocb *aiocbp;
 	pid_t pid;
-#ifdef CONFIG_PRIORITY_INHERITANCE
+#ifdef AIO_LPWORK_PRIOINHERIT
 	uint8_t prio;
 #endif
 	int ret;
@@ -122,7 +122,7 @@ static void aio_fsync_worker(FAR void *arg)
 
 	DEBUGASSERT(aioc && aioc->aioc_aiocbp);
 	pid = aioc->aioc_pid;
-#ifdef CONFIG_PRIORITY_INHERITANCE
+#ifdef AIO_LPWORK_PRIOINHERIT
 	prio = aioc->aioc_prio;
 #endif
 	aiocbp = aioc_decant(aioc);
@@ -143,7 +143,7 @@ static void aio_fsync_worker(FAR void *arg)
 
 	(void)aio_signal(pid, aiocbp);
 
-#ifdef CONFIG_PRIORITY_INHERITANCE
+#ifdef AIO_LPWORK_PRIOINHERIT
 	/* Restore the low priority worker thread default priority */
 
 	lpwork_restorepriority(prio);
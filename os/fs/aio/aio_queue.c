@@ -65,7 +65,7 @@
 
 #include "aio/aio.h"
 
-#ifdef CONFIG_FS_AIO
+#if defined(CONFIG_FS_AIO) && !defined(CONFIG_FS_AIO_WORKERS)
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -138,4 +138,4 @@ int aio_queue(FAR struct aio_container_s *aioc, worker_t worker)
 	return ret;
 }
 
-#endif							/* CONFIG_FS_AIO */
+#endif							/* CONFIG_FS_AIO && !CONFIG_FS_AIO_WORKERS */
@@ -110,7 +110,7 @@ static void aio_read_worker(FAR void *arg)
 	FAR struct aio_container_s *aioc = (FAR struct aio_container_s *)arg;
 	FAR struct aiocb *aiocbp;
 	pid_t pid;
-#ifdef CONFIG_PRIORITY_INHERITANCE
+#ifdef AIO_LPWORK_PRIOINHERIT
 	uint8_t prio;
 #endif
 	ssize_t nread = 0;
@@ -122,7 +122,7 @@ static void aio_read_worker(FAR void *arg)
 
 	DEBUGASSERT(aioc && aioc->aioc_aiocbp);
 	pid = aioc->aioc_pid;
-#ifdef CONFIG_PRIORITY_INHERITANCE
+#ifdef AIO_LPWORK_PRIOINHERIT
 	prio = aioc->aioc_prio;
 #endif
 	aiocbp = aioc_decant(aioc);
@@ -156,7 +156,7 @@ static void aio_read_worker(FAR void *arg)
 
 	(void)aio_signal(pid, aiocbp);
 
-#ifdef CONFIG_PRIORITY_INHERITANCE
+#ifdef AIO_LPWORK_PRIOINHERIT
 	/* Restore the low priority worker thread default priority */
 
 	lpwork_restorepriority(prio);
@@ -289,6 +289,7 @@ int aio_read(FAR struct aiocb *aiocbp)
 
 	/* Defer the work to the worker thread */
 
+	aioc->aioc_op = LIO_READ;
 	ret = aio_queue(aioc, aio_read_worker);
 	if (ret < 0) {
 		/* The result and the errno have already been set */
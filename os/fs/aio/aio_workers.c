@@ -0,0 +1,458 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/aio/aio_workers.c
+ *
+ * Dedicated threads for the asynchronous I/O.  Each request is queued on
+ * the queue of its device, the inode of the file or of its mountpoint.  A
+ * device queue with requests waits in a ready list until a thread takes
+ * it; the thread then serves the head of the queue, merged with the
+ * following requests of the same file at adjacent offsets, and puts the
+ * queue back at the end of the ready list if more requests are queued.
+ * The requests of one device are so performed in order, and those of
+ * different devices in parallel.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stddef.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <fcntl.h>
+#include <aio.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/fs/fs.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/kthread.h>
+
+#include "aio/aio.h"
+
+#if defined(CONFIG_FS_AIO) && defined(CONFIG_FS_AIO_WORKERS)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Maximum number of requests merged into one transfer */
+
+#define AIO_MERGE_MAXREQ    8
+
+/* There is at most one device queue per container, plus those of the
+ * devices being served whose requests have all been decanted.
+ */
+
+#define AIO_NDEVQ           (CONFIG_FS_NAIOC + CONFIG_FS_AIO_NTHREADS)
+
+#define AIO_QLINK2AIOC(e)   ((FAR struct aio_container_s *)((uintptr_t)(e) - offsetof(struct aio_container_s, aioc_qlink)))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct aio_devq_s {
+	dq_entry_t link;			/* Supports the ready list */
+	FAR struct inode *inode;	/* Device, NULL if the queue is free */
+	dq_queue_t pending;			/* Requests not started yet */
+	bool ready;					/* In the ready list */
+	bool busy;					/* A worker serves the device */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct aio_devq_s g_aio_devq[AIO_NDEVQ];
+
+/* Device queues with requests and no worker, and their count */
+
+static dq_queue_t g_aio_ready;
+static sem_t g_aio_readysem;
+
+static bool g_aio_started;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static FAR struct aio_devq_s *aio_getdevq(FAR struct inode *inode)
+{
+	FAR struct aio_devq_s *free = NULL;
+	int i;
+
+	for (i = 0; i < AIO_NDEVQ; i++) {
+		if (g_aio_devq[i].inode == inode) {
+			return &g_aio_devq[i];
+		}
+
+		if (g_aio_devq[i].inode == NULL && free == NULL) {
+			free = &g_aio_devq[i];
+		}
+	}
+
+	DEBUGASSERT(free != NULL);
+	free->inode = inode;
+	dq_init(&free->pending);
+	free->ready = false;
+	free->busy = false;
+	return free;
+}
+
+static void aio_setready(FAR struct aio_devq_s *devq)
+{
+	devq->ready = true;
+	dq_addlast(&devq->link, &g_aio_ready);
+	sem_post(&g_aio_readysem);
+}
+
+/****************************************************************************
+ * Name: aio_pick
+ *
+ * Description:
+ *   Remove from a device queue its first request, and the following ones
+ *   it can be merged with.  Called with the AIO lock held.
+ *
+ ****************************************************************************/
+
+static int aio_pick(FAR struct aio_devq_s *devq, FAR struct aio_container_s **batch, bool merge)
+{
+	FAR struct aio_container_s *head;
+	FAR struct aio_container_s *next;
+	FAR struct aiocb *aiocbp;
+	size_t total;
+	int n = 1;
+
+	head = AIO_QLINK2AIOC(dq_remfirst(&devq->pending));
+	head->aioc_devq = NULL;
+	batch[0] = head;
+
+	/* Appends go to the end of file whatever their offset */
+
+	if (!merge || head->aioc_op == LIO_NOP ||
+		(head->aioc_op == LIO_WRITE && (head->u.aioc_filep->f_oflags & O_APPEND) != 0)) {
+		return 1;
+	}
+
+	total = head->aioc_aiocbp->aio_nbytes;
+	while (n < AIO_MERGE_MAXREQ && total <= CONFIG_FS_AIO_MERGESIZE && devq->pending.head != NULL) {
+		next = AIO_QLINK2AIOC(devq->pending.head);
+		aiocbp = next->aioc_aiocbp;
+		if (next->u.aioc_filep != head->u.aioc_filep || next->aioc_op != head->aioc_op ||
+			aiocbp->aio_offset != head->aioc_aiocbp->aio_offset + (off_t)total ||
+			total + aiocbp->aio_nbytes > CONFIG_FS_AIO_MERGESIZE) {
+			break;
+		}
+
+		dq_rem(&next->aioc_qlink, &devq->pending);
+		next->aioc_devq = NULL;
+		batch[n++] = next;
+		total += aiocbp->aio_nbytes;
+	}
+
+	return n;
+}
+
+/****************************************************************************
+ * Name: aio_merged
+ *
+ * Description:
+ *   Perform adjacent reads or writes of a file as one transfer through the
+ *   merge buffer.  All the requests are completed before the first client
+ *   is signalled, so that a client waiting for several of them runs once.
+ *
+ ****************************************************************************/
+
+static void aio_merged(FAR struct aio_container_s **batch, int n, FAR uint8_t *buffer)
+{
+	FAR struct aiocb *aiocbps[AIO_MERGE_MAXREQ];
+	pid_t pids[AIO_MERGE_MAXREQ];
+	FAR struct file *filep;
+	uint8_t op;
+	size_t total = 0;
+	size_t pos;
+	size_t len;
+	ssize_t ret;
+	int errcode = 0;
+	int i;
+
+	/* Free the containers before starting the I/O, like the single request
+	 * workers.
+	 */
+
+	filep = batch[0]->u.aioc_filep;
+	op = batch[0]->aioc_op;
+	for (i = 0; i < n; i++) {
+		pids[i] = batch[i]->aioc_pid;
+		aiocbps[i] = aioc_decant(batch[i]);
+		if (op == LIO_WRITE) {
+			memcpy(&buffer[total], (FAR const void *)aiocbps[i]->aio_buf, aiocbps[i]->aio_nbytes);
+		}
+
+		total += aiocbps[i]->aio_nbytes;
+	}
+
+	if (op == LIO_READ) {
+		ret = file_pread(filep, buffer, total, aiocbps[0]->aio_offset);
+	} else {
+		ret = file_pwrite(filep, buffer, total, aiocbps[0]->aio_offset);
+	}
+
+	if (ret < 0) {
+		errcode = get_errno();
+		fdbg("ERROR: merged %s of %d requests failed: %d\n", op == LIO_READ ? "pread" : "pwrite", n, errcode);
+		DEBUGASSERT(errcode > 0);
+	}
+
+	/* A short transfer completes the first requests only */
+
+	for (i = 0, pos = 0; i < n; i++) {
+		if (ret < 0) {
+			aiocbps[i]->aio_result = -errcode;
+		} else {
+			len = (size_t)ret > pos ? (size_t)ret - pos : 0;
+			if (len > aiocbps[i]->aio_nbytes) {
+				len = aiocbps[i]->aio_nbytes;
+			}
+
+			if (op == LIO_READ) {
+				memcpy((FAR void *)aiocbps[i]->aio_buf, &buffer[pos], len);
+			}
+
+			aiocbps[i]->aio_result = len;
+		}
+
+		pos += aiocbps[i]->aio_nbytes;
+	}
+
+	for (i = 0; i < n; i++) {
+		(void)aio_signal(pids[i], aiocbps[i]);
+	}
+}
+
+/****************************************************************************
+ * Name: aio_worker
+ *
+ * Description:
+ *   Body of the AIO worker threads.
+ *
+ ****************************************************************************/
+
+static int aio_worker(int argc, char *argv[])
+{
+	FAR struct aio_container_s *batch[AIO_MERGE_MAXREQ];
+	FAR struct aio_devq_s *devq;
+	FAR uint8_t *buffer = NULL;
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	struct sched_param param;
+	uint8_t prio;
+	int i;
+#endif
+	int n;
+
+#if CONFIG_FS_AIO_MERGESIZE > 0
+	/* Without the buffer, the requests are performed one by one */
+
+	buffer = (FAR uint8_t *)kmm_malloc(CONFIG_FS_AIO_MERGESIZE);
+#endif
+
+	for (;;) {
+		while (sem_wait(&g_aio_readysem) < 0) {
+			DEBUGASSERT(get_errno() == EINTR);
+		}
+
+		aio_lock();
+
+		/* The queue may have been emptied by aio_cancel() */
+
+		devq = (FAR struct aio_devq_s *)dq_remfirst(&g_aio_ready);
+		if (devq == NULL) {
+			aio_unlock();
+			continue;
+		}
+
+		devq->ready = false;
+		devq->busy = true;
+		n = aio_pick(devq, batch, buffer != NULL);
+
+#ifdef CONFIG_PRIORITY_INHERITANCE
+		/* Run at the priority of the most important requester */
+
+		prio = CONFIG_FS_AIO_PRIORITY;
+		for (i = 0; i < n; i++) {
+			if (batch[i]->aioc_prio > prio) {
+				prio = batch[i]->aioc_prio;
+			}
+		}
+
+		if (prio != CONFIG_FS_AIO_PRIORITY) {
+			param.sched_priority = prio;
+			(void)sched_setparam(0, &param);
+		}
+#endif
+
+		aio_unlock();
+
+		if (n == 1) {
+			batch[0]->aioc_worker(batch[0]);
+		} else {
+			aio_merged(batch, n, buffer);
+		}
+
+#ifdef CONFIG_PRIORITY_INHERITANCE
+		if (prio != CONFIG_FS_AIO_PRIORITY) {
+			param.sched_priority = CONFIG_FS_AIO_PRIORITY;
+			(void)sched_setparam(0, &param);
+		}
+#endif
+
+		aio_lock();
+
+		devq->busy = false;
+		if (devq->pending.head != NULL) {
+			aio_setready(devq);
+		} else {
+			devq->inode = NULL;
+		}
+
+		aio_unlock();
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: aio_start
+ *
+ * Description:
+ *   Start the worker threads.  Called with the AIO lock held.
+ *
+ ****************************************************************************/
+
+static int aio_start(void)
+{
+	int nstarted = 0;
+	int i;
+
+	(void)sem_init(&g_aio_readysem, 0, 0);
+	dq_init(&g_aio_ready);
+
+	for (i = 0; i < CONFIG_FS_AIO_NTHREADS; i++) {
+		if (kernel_thread("aio", CONFIG_FS_AIO_PRIORITY, CONFIG_FS_AIO_STACKSIZE, aio_worker, NULL) > 0) {
+			nstarted++;
+		}
+	}
+
+	if (nstarted == 0) {
+		fdbg("ERROR: Failed to start the AIO workers\n");
+		sem_destroy(&g_aio_readysem);
+		return -ENOMEM;
+	}
+
+	g_aio_started = true;
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aio_queue
+ *
+ * Description:
+ *   Queue the asynchronous I/O on the queue of its device
+ *
+ * Input Parameters:
+ *   aioc   - The AIO container
+ *   worker - Performs the I/O when it is not merged
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  Otherwise, -1 is returned and the errno is set
+ *   appropriately.
+ *
+ ****************************************************************************/
+
+int aio_queue(FAR struct aio_container_s *aioc, worker_t worker)
+{
+	FAR struct aio_devq_s *devq;
+	int ret = OK;
+
+	aio_lock();
+
+	if (!g_aio_started) {
+		ret = aio_start();
+		if (ret < 0) {
+			aio_unlock();
+			aioc->aioc_aiocbp->aio_result = ret;
+			(void)aioc_decant(aioc);
+			set_errno(-ret);
+			return ERROR;
+		}
+	}
+
+	devq = aio_getdevq(aioc->u.aioc_filep->f_inode);
+	aioc->aioc_worker = worker;
+	aioc->aioc_devq = devq;
+	dq_addlast(&aioc->aioc_qlink, &devq->pending);
+
+	if (!devq->busy && !devq->ready) {
+		aio_setready(devq);
+	}
+
+	aio_unlock();
+	return OK;
+}
+
+/****************************************************************************
+ * Name: aio_dequeue
+ ****************************************************************************/
+
+int aio_dequeue(FAR struct aio_container_s *aioc)
+{
+	FAR struct aio_devq_s *devq = aioc->aioc_devq;
+
+	if (devq == NULL) {
+		return -ENOENT;
+	}
+
+	dq_rem(&aioc->aioc_qlink, &devq->pending);
+	aioc->aioc_devq = NULL;
+
+	if (devq->pending.head == NULL && devq->ready) {
+		dq_rem(&devq->link, &g_aio_ready);
+		devq->ready = false;
+		if (!devq->busy) {
+			devq->inode = NULL;
+		}
+	}
+
+	return OK;
+}
+
+#endif							/* CONFIG_FS_AIO && CONFIG_FS_AIO_WORKERS */
@@ -0,0 +1,709 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/bcache/fs_bcache.c
+ *
+ * A sector cache shared by the block drivers accessed by the file systems.
+ * A fixed pool of pages, one sector each, is allocated on the first attach
+ * and replaced least recently used first.  Writes are kept dirty in the
+ * pool and written back by the low priority work queue once they are
+ * CONFIG_FS_BCACHE_FLUSH_MS old, or on bcache_flush() and bcache_detach().
+ * Sequential reads fill a per-device read ahead window with a single
+ * transfer of CONFIG_FS_BCACHE_READAHEAD sectors.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/clock.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/wqueue.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/ioctl.h>
+#include <tinyara/fs/bcache.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FS_BCACHE_NPAGES
+#define CONFIG_FS_BCACHE_NPAGES 32
+#endif
+
+#ifndef CONFIG_FS_BCACHE_PAGESIZE
+#define CONFIG_FS_BCACHE_PAGESIZE 512
+#endif
+
+#ifndef CONFIG_FS_BCACHE_NDEVICES
+#define CONFIG_FS_BCACHE_NDEVICES 4
+#endif
+
+#ifndef CONFIG_FS_BCACHE_READAHEAD
+#define CONFIG_FS_BCACHE_READAHEAD 0
+#endif
+
+#ifndef CONFIG_FS_BCACHE_FLUSH_MS
+#define CONFIG_FS_BCACHE_FLUSH_MS 1000
+#endif
+
+/* Larger transfers go straight between the device and the caller, so that
+ * streaming a big file does not evict everything else from the pool.
+ */
+
+#define BCACHE_MAXCACHED    (CONFIG_FS_BCACHE_NPAGES >> 2)
+
+#define BCACHE_FLUSH_TICKS  MSEC2TICK(CONFIG_FS_BCACHE_FLUSH_MS)
+
+#define BCACHE_PAGEDATA(p)  (&g_bcache_data[((p) - g_bcache_pages) * CONFIG_FS_BCACHE_PAGESIZE])
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct bcache_dev_s {
+	FAR struct inode *inode;	/* Block driver, NULL if the slot is free */
+	uint8_t refs;				/* Number of attaches */
+	uint16_t sectsize;			/* Sector size of the device */
+	size_t nsectors;			/* Number of sectors of the device */
+	size_t nextsector;			/* Sector following the last read */
+#if CONFIG_FS_BCACHE_READAHEAD > 0
+	size_t rastart;				/* First sector of the read ahead window */
+	uint16_t racount;			/* Number of sectors in the window */
+	FAR uint8_t *rabuffer;		/* Read ahead window */
+#endif
+	struct bcache_stats_s stats;
+};
+
+struct bcache_page_s {
+	FAR struct bcache_dev_s *dev;	/* Owner of the page, NULL if free */
+	size_t sector;				/* Sector held by the page */
+	uint32_t lastuse;			/* For the least recently used replacement */
+	clock_t dirtied;			/* When the page became dirty */
+	bool dirty;					/* Newer than the device */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static sem_t g_bcache_sem = SEM_INITIALIZER(1);
+static struct bcache_dev_s g_bcache_devs[CONFIG_FS_BCACHE_NDEVICES];
+static struct bcache_page_s g_bcache_pages[CONFIG_FS_BCACHE_NPAGES];
+static FAR uint8_t *g_bcache_data;
+static uint32_t g_bcache_clock;
+#ifdef CONFIG_FS_BCACHE_WRITEBACK
+static struct work_s g_bcache_work;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void bcache_semtake(void)
+{
+	while (sem_wait(&g_bcache_sem) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+#define bcache_semgive() sem_post(&g_bcache_sem)
+
+static FAR struct bcache_dev_s *bcache_finddev(FAR struct inode *inode)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_FS_BCACHE_NDEVICES; i++) {
+		if (g_bcache_devs[i].inode == inode) {
+			return &g_bcache_devs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static FAR struct bcache_page_s *bcache_findpage(FAR struct bcache_dev_s *dev, size_t sector)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_FS_BCACHE_NPAGES; i++) {
+		if (g_bcache_pages[i].dev == dev && g_bcache_pages[i].sector == sector) {
+			return &g_bcache_pages[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int bcache_writeback(FAR struct bcache_page_s *page)
+{
+	FAR struct bcache_dev_s *dev = page->dev;
+	ssize_t ret;
+
+	ret = dev->inode->u.i_bops->write(dev->inode, BCACHE_PAGEDATA(page), page->sector, 1);
+	if (ret != 1) {
+		fdbg("ERROR: write back of sector %d failed: %d\n", page->sector, ret);
+		return ret < 0 ? (int)ret : -EIO;
+	}
+
+	page->dirty = false;
+	dev->stats.writebacks++;
+	return OK;
+}
+
+/* Return a page for a new sector: a free one, else the least recently used
+ * clean one, else the least recently used dirty one after writing it back.
+ */
+
+static FAR struct bcache_page_s *bcache_newpage(FAR struct bcache_dev_s *dev, size_t sector)
+{
+	FAR struct bcache_page_s *clean = NULL;
+	FAR struct bcache_page_s *dirty = NULL;
+	FAR struct bcache_page_s *page;
+	int i;
+
+	for (i = 0; i < CONFIG_FS_BCACHE_NPAGES; i++) {
+		page = &g_bcache_pages[i];
+		if (page->dev == NULL) {
+			clean = page;
+			break;
+		}
+
+		if (!page->dirty) {
+			if (clean == NULL || page->lastuse < clean->lastuse) {
+				clean = page;
+			}
+		} else if (dirty == NULL || page->lastuse < dirty->lastuse) {
+			dirty = page;
+		}
+	}
+
+	page = clean;
+	if (page == NULL) {
+		page = dirty;
+		if (bcache_writeback(page) < 0) {
+			return NULL;
+		}
+	}
+
+	page->dev = dev;
+	page->sector = sector;
+	page->dirty = false;
+	page->lastuse = ++g_bcache_clock;
+	return page;
+}
+
+#if CONFIG_FS_BCACHE_READAHEAD > 0
+static bool bcache_inwindow(FAR struct bcache_dev_s *dev, size_t sector)
+{
+	return sector >= dev->rastart && sector < dev->rastart + dev->racount;
+}
+
+/* Fill the read ahead window from 'sector' in one transfer.  The dirty
+ * pages of the window are newer than the device: they are copied over it,
+ * as the window serves their sectors once they are written back and
+ * evicted.
+ */
+
+static void bcache_readahead(FAR struct bcache_dev_s *dev, size_t sector)
+{
+	FAR struct bcache_page_s *page;
+	size_t count = CONFIG_FS_BCACHE_READAHEAD;
+	ssize_t ret;
+	int i;
+
+	if (dev->rabuffer == NULL || sector >= dev->nsectors || bcache_inwindow(dev, sector)) {
+		return;
+	}
+
+	if (sector + count > dev->nsectors) {
+		count = dev->nsectors - sector;
+	}
+
+	dev->racount = 0;
+	ret = dev->inode->u.i_bops->read(dev->inode, dev->rabuffer, sector, count);
+	if (ret > 0) {
+		dev->rastart = sector;
+		dev->racount = ret;
+		dev->stats.rasectors += ret;
+
+		for (i = 0; i < CONFIG_FS_BCACHE_NPAGES; i++) {
+			page = &g_bcache_pages[i];
+			if (page->dev == dev && page->dirty && bcache_inwindow(dev, page->sector)) {
+				memcpy(&dev->rabuffer[(page->sector - dev->rastart) * dev->sectsize], BCACHE_PAGEDATA(page), dev->sectsize);
+			}
+		}
+	}
+}
+
+/* Keep the window up to date with the sectors written */
+
+static void bcache_updatewindow(FAR struct bcache_dev_s *dev, FAR const uint8_t *buffer, size_t start, unsigned int nsectors)
+{
+	unsigned int i;
+
+	for (i = 0; i < nsectors; i++) {
+		if (bcache_inwindow(dev, start + i)) {
+			memcpy(&dev->rabuffer[(start + i - dev->rastart) * dev->sectsize], &buffer[i * dev->sectsize], dev->sectsize);
+		}
+	}
+}
+#else
+#define bcache_inwindow(d, s)               (false)
+#define bcache_readahead(d, s)
+#define bcache_updatewindow(d, b, s, n)
+#endif
+
+/* Drop all the pages of a device, which must have been flushed */
+
+static void bcache_droppages(FAR struct bcache_dev_s *dev)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_FS_BCACHE_NPAGES; i++) {
+		if (g_bcache_pages[i].dev == dev) {
+			g_bcache_pages[i].dev = NULL;
+			g_bcache_pages[i].dirty = false;
+		}
+	}
+}
+
+static int bcache_flushdev(FAR struct bcache_dev_s *dev)
+{
+	int ret = OK;
+	int i;
+
+	for (i = 0; i < CONFIG_FS_BCACHE_NPAGES; i++) {
+		if (g_bcache_pages[i].dev == dev && g_bcache_pages[i].dirty) {
+			int err = bcache_writeback(&g_bcache_pages[i]);
+			if (err < 0) {
+				ret = err;
+			}
+		}
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_FS_BCACHE_WRITEBACK
+/****************************************************************************
+ * Name: bcache_worker
+ *
+ * Description:
+ *   Write back the pages dirty for longer than the flush deadline, and run
+ *   again when the next one reaches it.
+ *
+ ****************************************************************************/
+
+static void bcache_worker(FAR void *arg)
+{
+	FAR struct bcache_page_s *page;
+	clock_t now;
+	clock_t age;
+	clock_t oldest = 0;
+	bool pending = false;
+	int i;
+
+	bcache_semtake();
+
+	now = clock_systimer();
+	for (i = 0; i < CONFIG_FS_BCACHE_NPAGES; i++) {
+		page = &g_bcache_pages[i];
+		if (page->dev == NULL || !page->dirty) {
+			continue;
+		}
+
+		age = now - page->dirtied;
+		if (age < BCACHE_FLUSH_TICKS || bcache_writeback(page) < 0) {
+			/* A failed write is retried at the next deadline */
+
+			if (age >= BCACHE_FLUSH_TICKS) {
+				page->dirtied = now;
+				age = 0;
+			}
+
+			if (!pending || age > oldest) {
+				oldest = age;
+			}
+
+			pending = true;
+		}
+	}
+
+	if (pending) {
+		work_queue(LPWORK, &g_bcache_work, bcache_worker, NULL, BCACHE_FLUSH_TICKS - oldest);
+	}
+
+	bcache_semgive();
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bcache_attach
+ ****************************************************************************/
+
+int bcache_attach(FAR struct inode *inode)
+{
+	FAR struct bcache_dev_s *dev;
+	struct geometry geo;
+	FAR void *base;
+	int ret;
+
+	DEBUGASSERT(inode && inode->u.i_bops);
+
+	if (!inode->u.i_bops->read || !inode->u.i_bops->geometry) {
+		return -EINVAL;
+	}
+
+	ret = inode->u.i_bops->geometry(inode, &geo);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (!geo.geo_available || geo.geo_sectorsize == 0 || geo.geo_sectorsize > CONFIG_FS_BCACHE_PAGESIZE) {
+		fvdbg("Sector size %d not cached\n", geo.geo_sectorsize);
+		return -EINVAL;
+	}
+
+	/* A copy of memory in the cache only costs another memcpy() */
+
+	if (inode->u.i_bops->ioctl && inode->u.i_bops->ioctl(inode, BIOC_DIRECTMAP, (unsigned long)((uintptr_t)&base)) == OK) {
+		fvdbg("Memory at %p not cached\n", base);
+		return -ENOSYS;
+	}
+
+	bcache_semtake();
+
+	dev = bcache_finddev(inode);
+	if (dev != NULL) {
+		dev->refs++;
+		goto out;
+	}
+
+	dev = bcache_finddev(NULL);
+	if (dev == NULL) {
+		ret = -ENOSPC;
+		goto out;
+	}
+
+	if (g_bcache_data == NULL) {
+		g_bcache_data = (FAR uint8_t *)kmm_malloc(CONFIG_FS_BCACHE_NPAGES * CONFIG_FS_BCACHE_PAGESIZE);
+		if (g_bcache_data == NULL) {
+			ret = -ENOMEM;
+			goto out;
+		}
+	}
+
+	memset(dev, 0, sizeof(struct bcache_dev_s));
+	dev->inode = inode;
+	dev->refs = 1;
+	dev->sectsize = geo.geo_sectorsize;
+	dev->nsectors = geo.geo_nsectors;
+	dev->nextsector = (size_t)-1;
+
+#if CONFIG_FS_BCACHE_READAHEAD > 0
+	/* Without the window, sequential reads are only cached page by page */
+
+	dev->rabuffer = (FAR uint8_t *)kmm_malloc(CONFIG_FS_BCACHE_READAHEAD * geo.geo_sectorsize);
+#endif
+
+out:
+	bcache_semgive();
+	return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_detach
+ ****************************************************************************/
+
+int bcache_detach(FAR struct inode *inode)
+{
+	FAR struct bcache_dev_s *dev;
+	int ret = OK;
+	int i;
+
+	bcache_semtake();
+
+	dev = bcache_finddev(inode);
+	if (dev == NULL) {
+		goto out;
+	}
+
+	ret = bcache_flushdev(dev);
+	if (--dev->refs > 0) {
+		goto out;
+	}
+
+	bcache_droppages(dev);
+#if CONFIG_FS_BCACHE_READAHEAD > 0
+	kmm_free(dev->rabuffer);
+#endif
+	memset(dev, 0, sizeof(struct bcache_dev_s));
+
+	/* Give the pool back once no device uses it */
+
+	for (i = 0; i < CONFIG_FS_BCACHE_NDEVICES; i++) {
+		if (g_bcache_devs[i].inode != NULL) {
+			goto out;
+		}
+	}
+
+#ifdef CONFIG_FS_BCACHE_WRITEBACK
+	work_cancel(LPWORK, &g_bcache_work);
+#endif
+	kmm_free(g_bcache_data);
+	g_bcache_data = NULL;
+
+out:
+	bcache_semgive();
+	return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_read
+ ****************************************************************************/
+
+ssize_t bcache_read(FAR struct inode *inode, FAR unsigned char *buffer, size_t start_sector, unsigned int nsectors)
+{
+	FAR struct bcache_dev_s *dev;
+	FAR struct bcache_page_s *page;
+	FAR uint8_t *dst;
+	bool sequential;
+	unsigned int i;
+	unsigned int j;
+	unsigned int n;
+	ssize_t ret;
+
+	bcache_semtake();
+
+	dev = bcache_finddev(inode);
+	if (dev == NULL) {
+		bcache_semgive();
+		return inode->u.i_bops->read(inode, buffer, start_sector, nsectors);
+	}
+
+	sequential = (start_sector == dev->nextsector);
+
+	for (i = 0; i < nsectors; ) {
+		dst = &buffer[i * dev->sectsize];
+
+		page = bcache_findpage(dev, start_sector + i);
+		if (page != NULL) {
+			memcpy(dst, BCACHE_PAGEDATA(page), dev->sectsize);
+			page->lastuse = ++g_bcache_clock;
+			dev->stats.hits++;
+			i++;
+			continue;
+		}
+
+#if CONFIG_FS_BCACHE_READAHEAD > 0
+		if (bcache_inwindow(dev, start_sector + i)) {
+			memcpy(dst, &dev->rabuffer[(start_sector + i - dev->rastart) * dev->sectsize], dev->sectsize);
+			dev->stats.hits++;
+			dev->stats.rahits++;
+			i++;
+			continue;
+		}
+#endif
+
+		/* Read the whole run of missing sectors in one transfer */
+
+		for (n = 1; i + n < nsectors; n++) {
+			if (bcache_inwindow(dev, start_sector + i + n) || bcache_findpage(dev, start_sector + i + n) != NULL) {
+				break;
+			}
+		}
+
+		ret = inode->u.i_bops->read(inode, dst, start_sector + i, n);
+		if (ret <= 0) {
+			bcache_semgive();
+			return i > 0 ? (ssize_t)i : ret;
+		}
+
+		dev->stats.misses += ret;
+		if (nsectors <= BCACHE_MAXCACHED) {
+			for (j = 0; j < (unsigned int)ret; j++) {
+				page = bcache_newpage(dev, start_sector + i + j);
+				if (page != NULL) {
+					memcpy(BCACHE_PAGEDATA(page), &dst[j * dev->sectsize], dev->sectsize);
+				}
+			}
+		}
+
+		i += ret;
+		if ((unsigned int)ret < n) {
+			break;
+		}
+	}
+
+	dev->nextsector = start_sector + i;
+	if (sequential && i == nsectors) {
+		bcache_readahead(dev, dev->nextsector);
+	}
+
+	bcache_semgive();
+	return i;
+}
+
+/****************************************************************************
+ * Name: bcache_write
+ ****************************************************************************/
+
+ssize_t bcache_write(FAR struct inode *inode, FAR const unsigned char *buffer, size_t start_sector, unsigned int nsectors)
+{
+	FAR struct bcache_dev_s *dev;
+	FAR struct bcache_page_s *page;
+	unsigned int i;
+	ssize_t ret;
+
+	bcache_semtake();
+
+	dev = bcache_finddev(inode);
+	if (dev == NULL) {
+		bcache_semgive();
+		return inode->u.i_bops->write(inode, buffer, start_sector, nsectors);
+	}
+
+	bcache_updatewindow(dev, buffer, start_sector, nsectors);
+
+#ifdef CONFIG_FS_BCACHE_WRITEBACK
+	if (nsectors <= BCACHE_MAXCACHED) {
+		for (i = 0; i < nsectors; i++) {
+			page = bcache_findpage(dev, start_sector + i);
+			if (page == NULL) {
+				page = bcache_newpage(dev, start_sector + i);
+				if (page == NULL) {
+					break;
+				}
+			}
+
+			memcpy(BCACHE_PAGEDATA(page), &buffer[i * dev->sectsize], dev->sectsize);
+			page->lastuse = ++g_bcache_clock;
+			if (!page->dirty) {
+				page->dirty = true;
+				page->dirtied = clock_systimer();
+			}
+
+			dev->stats.writes++;
+		}
+
+		if (i > 0 && work_available(&g_bcache_work)) {
+			work_queue(LPWORK, &g_bcache_work, bcache_worker, NULL, BCACHE_FLUSH_TICKS);
+		}
+
+		bcache_semgive();
+		return i > 0 ? (ssize_t)i : -EIO;
+	}
+#endif
+
+	/* Write through, the cached copies become clean */
+
+	ret = inode->u.i_bops->write(inode, buffer, start_sector, nsectors);
+	for (i = 0; ret > 0 && i < (unsigned int)ret; i++) {
+		page = bcache_findpage(dev, start_sector + i);
+		if (page == NULL && nsectors <= BCACHE_MAXCACHED) {
+			page = bcache_newpage(dev, start_sector + i);
+		}
+
+		if (page != NULL) {
+			memcpy(BCACHE_PAGEDATA(page), &buffer[i * dev->sectsize], dev->sectsize);
+			page->dirty = false;
+		}
+
+		dev->stats.writes++;
+	}
+
+	bcache_semgive();
+	return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_flush
+ ****************************************************************************/
+
+int bcache_flush(FAR struct inode *inode)
+{
+	FAR struct bcache_dev_s *dev;
+	int ret = OK;
+
+	bcache_semtake();
+
+	dev = bcache_finddev(inode);
+	if (dev != NULL) {
+		ret = bcache_flushdev(dev);
+	}
+
+	bcache_semgive();
+	return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_getstats
+ ****************************************************************************/
+
+int bcache_getstats(FAR struct inode *inode, FAR struct bcache_stats_s *stats)
+{
+	FAR struct bcache_dev_s *dev;
+	int ret = -ENOENT;
+
+	bcache_semtake();
+
+	dev = bcache_finddev(inode);
+	if (dev != NULL) {
+		memcpy(stats, &dev->stats, sizeof(struct bcache_stats_s));
+		ret = OK;
+	}
+
+	bcache_semgive();
+	return ret;
+}
+
+/****************************************************************************
+ * Name: bcache_foreach
+ ****************************************************************************/
+
+void bcache_foreach(bcache_handler_t handler, FAR void *arg)
+{
+	int i;
+
+	bcache_semtake();
+
+	for (i = 0; i < CONFIG_FS_BCACHE_NDEVICES; i++) {
+		if (g_bcache_devs[i].inode != NULL) {
+			handler(g_bcache_devs[i].inode, &g_bcache_devs[i].stats, arg);
+		}
+	}
+
+	bcache_semgive();
+}
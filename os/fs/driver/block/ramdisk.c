@@ -81,7 +81,7 @@
 #define RDFLAG_USER            (RDFLAG_WRENABLED | RDFLAG_FUNLINK)
 
 #define RDFLAG_IS_WRENABLED(f) (((f) & RDFLAG_WRENABLED) != 0)
-#define RDFLAG_IS_FUNLINK(f)   (((f) & RDFLAG_WRENABLED) != 0)
+#define RDFLAG_IS_FUNLINK(f)   (((f) & RDFLAG_FUNLINK) != 0)
 
 /* Flag set when the RAM disk block driver is unlink */
 
@@ -157,7 +157,7 @@ static void rd_destroy(FAR struct rd_struct_s *dev)
 	/* We we configured to free the RAM disk memory when unlinked? */
 
 #ifdef CONFIG_FS_WRITABLE
-	if (RDFLAG_IS_UNLINKED(dev->rd_flags)) {
+	if (RDFLAG_IS_FUNLINK(dev->rd_flags)) {
 		/* Yes.. do it */
 
 		kmm_free(dev->rd_buffer);
@@ -333,10 +333,10 @@ static int rd_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 
 	fvdbg("Entry\n");
 
-	/* Only one ioctl command is supported */
+	/* The disk is mapped to memory, both commands return its base */
 
 	DEBUGASSERT(inode && inode->i_private);
-	if (cmd == BIOC_XIPBASE && ppv) {
+	if ((cmd == BIOC_XIPBASE || cmd == BIOC_DIRECTMAP) && ppv) {
 		dev = (FAR struct rd_struct_s *)inode->i_private;
 		*ppv = (FAR void *)dev->rd_buffer;
 
@@ -72,6 +72,10 @@
 #include <crc8.h>
 #include <crc16.h>
 #include <crc32.h>
+#ifdef CONFIG_MTD_SMART_BGGC
+#include <semaphore.h>
+#include <assert.h>
+#endif
 #ifndef NXFUSE_HOST_BUILD
 #include <tinyara/irq.h>
 #endif
@@ -82,6 +86,10 @@
 #include <tinyara/fs/mtd.h>
 #include <tinyara/fs/smart_procfs.h>
 #include <tinyara/fs/smart.h>
+#ifdef CONFIG_MTD_SMART_BGGC
+#include <tinyara/clock.h>
+#include <tinyara/wqueue.h>
+#endif
 
 /****************************************************************************
  * Private Definitions
@@ -162,6 +170,58 @@
 #define  CONFIG_MTD_SMART_SECTOR_SIZE 1024
 #endif
 
+#ifndef CONFIG_MTD_SMART_SECTOR_CACHE_SIZE
+#define CONFIG_MTD_SMART_SECTOR_CACHE_SIZE 512
+#endif
+
+/* Cache birthdays are halved when the counter reaches this value */
+
+#define SMART_CACHE_BIRTH_LIMIT 0xF000
+
+/* Checkpoint region definitions.  The 'consumed' byte of the header is left
+ * erased while the checkpoint matches the device and is programmed before
+ * the device is next modified.
+ */
+
+#define SMART_CHECKPOINT_MAGIC      0x54504b43	/* "CKPT" */
+#define SMART_CHECKPOINT_VERSION    1
+#define SMART_CHECKPOINT_LIVE       CONFIG_SMARTFS_ERASEDSTATE
+#define SMART_CHECKPOINT_CONSUMED   (CONFIG_SMARTFS_ERASEDSTATE ^ 0xFF)
+
+/* Background garbage collection.  The watermarks are in erase blocks worth
+ * of free sectors.  A block is only collected in the background if at least
+ * a quarter of it is released, so that idle time is not spent copying data
+ * around for little gain.
+ */
+
+#ifdef CONFIG_MTD_SMART_BGGC
+#ifndef CONFIG_MTD_SMART_BGGC_LOWWATER
+#define CONFIG_MTD_SMART_BGGC_LOWWATER  4
+#endif
+
+#ifndef CONFIG_MTD_SMART_BGGC_HIGHWATER
+#define CONFIG_MTD_SMART_BGGC_HIGHWATER 8
+#endif
+
+#ifndef CONFIG_MTD_SMART_BGGC_IDLE_MS
+#define CONFIG_MTD_SMART_BGGC_IDLE_MS   200
+#endif
+
+#define SMART_BGGC_IDLE_TICKS       MSEC2TICK(CONFIG_MTD_SMART_BGGC_IDLE_MS)
+#define SMART_BGGC_MIN_RELEASED(d)  ((d)->availSectPerBlk >> 2)
+#endif
+
+/* Erase ahead.  The erase blocks emptied by a release are queued, and erased
+ * on the low priority work queue once the device is idle, instead of in the
+ * write path.  A block is erased in place when the queue is full.
+ */
+
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+#ifndef CONFIG_MTD_SMART_ERASEAHEAD_NBLOCKS
+#define CONFIG_MTD_SMART_ERASEAHEAD_NBLOCKS 4
+#endif
+#endif
+
 #ifndef offsetof
 #define offsetof(type, member) ((size_t)&(((type *)0)->member))
 #endif
@@ -322,6 +382,28 @@ struct smart_struct_s {
 	uint32_t njournalentries;		/* Total Number of Journal Entries */
 	FAR uint16_t *block_map;			/* Number of checkout journal in each of Journal block */
 #endif
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+	uint16_t checkpointblock;	/* First erase block of the checkpoint region */
+	uint16_t ncheckpointblocks;	/* Number of erase blocks of the checkpoint region */
+	uint32_t checkpointgen;		/* Generation of the last checkpoint seen or written */
+	bool checkpointlive;		/* The checkpoint on the flash matches the device */
+#endif
+#ifdef CONFIG_MTD_SMART_BGGC
+	sem_t exclsem;				/* Serializes the ioctls and the collector */
+	struct work_s gcwork;		/* Background garbage collection work */
+	clock_t gcactivity;			/* Time of the last modifying ioctl */
+	uint32_t gcruns;			/* Number of background collection runs */
+	uint32_t gcblocks;			/* Erase blocks collected in the background */
+	uint32_t gcsectors;			/* Sectors relocated in the background */
+	uint32_t gcticks;			/* Ticks spent collecting in the background */
+	uint32_t fgblocks;			/* Erase blocks collected in the write path */
+#endif
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+	struct work_s eawork;		/* Erase ahead work */
+	uint16_t eaqueue[CONFIG_MTD_SMART_ERASEAHEAD_NBLOCKS];	/* Emptied blocks waiting for the erase */
+	uint8_t eacount;			/* Number of blocks in eaqueue */
+	uint32_t eablocks;			/* Erase blocks erased ahead */
+#endif
 };
 
 #define SMART_WEARFLAGS_FORCE_REORG    0x01
@@ -334,6 +416,28 @@ struct smart_multiroot_device_s {
 };
 #endif
 
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+/* Checkpoint header, at the start of the checkpoint region.  It is followed
+ * by the sector map and the release and free counts, as laid out in RAM,
+ * then by a copy of the generation which catches a torn write.
+ */
+
+struct smart_checkpoint_s {
+	uint8_t consumed;			/* SMART_CHECKPOINT_LIVE until consumed */
+	uint8_t version;			/* SMART_CHECKPOINT_VERSION */
+	uint8_t namesize;			/* Length of filenames on the device */
+	uint8_t formatversion;		/* Format version on the device */
+	uint32_t magic;				/* SMART_CHECKPOINT_MAGIC */
+	uint32_t generation;		/* Incremented on each checkpoint written */
+	uint16_t totalsectors;		/* Geometry the checkpoint was taken with */
+	uint16_t neraseblocks;
+	uint16_t freesectors;		/* Total number of free sectors */
+	uint16_t releasesectors;	/* Total number of released sectors */
+	uint32_t length;			/* Length of the map and counts */
+	uint32_t crc;				/* CRC-32 of the header after 'consumed' and of the map and counts */
+};
+#endif
+
 /* Format 1 sector header definition */
 
 #if SMART_STATUS_VERSION == 1
@@ -462,6 +566,7 @@ static uint16_t smart_findfreephyssector(FAR struct smart_struct_s *dev, uint8_t
 static int smart_writesector(FAR struct smart_struct_s *dev, unsigned long arg);
 #endif
 static int smart_readsector(FAR struct smart_struct_s *dev, unsigned long arg);
+static int smart_readahead(FAR struct smart_struct_s *dev, unsigned long arg);
 #ifdef CONFIG_FS_WRITABLE
 static int smart_allocsector(FAR struct smart_struct_s *dev, unsigned long requested);
 #endif
@@ -475,6 +580,22 @@ static int smart_relocate_sector(FAR struct smart_struct_s *dev, uint16_t oldsec
 static int smart_validate_crc(FAR struct smart_struct_s *dev);
 static crc_t smart_calc_sector_crc(FAR struct smart_struct_s *dev);
 #endif
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+static int smart_checkpoint_load(FAR struct smart_struct_s *dev);
+static int smart_checkpoint_write(FAR struct smart_struct_s *dev);
+static int smart_checkpoint_invalidate(FAR struct smart_struct_s *dev);
+#endif
+#ifdef CONFIG_MTD_SMART_BGGC
+static void smart_semtake(FAR struct smart_struct_s *dev);
+static void smart_bggc_schedule(FAR struct smart_struct_s *dev);
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+static void smart_eraseahead(FAR struct smart_struct_s *dev, uint16_t block);
+static void smart_eraseahead_worker(FAR void *arg);
+#endif
+#else
+#define smart_semtake(d)
+#define smart_semgive(d)
+#endif
 #ifdef CONFIG_MTD_SMART_JOURNALING
 static int smart_journal_init(FAR struct smart_struct_s *dev);
 static int smart_journal_checkin(FAR struct smart_struct_s *dev, journal_log_t *log, uint32_t address, uint16_t psector, int type);
@@ -632,6 +753,24 @@ static void smart_free(FAR struct smart_struct_s *dev, FAR void *ptr)
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: smart_semtake / smart_semgive
+ *
+ * Description: Lock the device against the background garbage collector.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_SMART_BGGC
+static void smart_semtake(FAR struct smart_struct_s *dev)
+{
+	while (sem_wait(&dev->exclsem) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+#define smart_semgive(d) sem_post(&(d)->exclsem)
+#endif
+
 /****************************************************************************
  * Name: smart_open
  *
@@ -654,7 +793,40 @@ static int smart_open(FAR struct inode *inode)
 
 static int smart_close(FAR struct inode *inode)
 {
+#if defined(CONFIG_MTD_SMART_CHECKPOINT) || defined(CONFIG_MTD_SMART_BGGC)
+	FAR struct smart_struct_s *dev;
+#endif
+
 	fvdbg("Entry\n");
+
+#if defined(CONFIG_MTD_SMART_CHECKPOINT) || defined(CONFIG_MTD_SMART_BGGC)
+#ifdef CONFIG_SMARTFS_MULTI_ROOT_DIRS
+	dev = ((FAR struct smart_multiroot_device_s *)inode->i_private)->dev;
+#else
+	dev = (FAR struct smart_struct_s *)inode->i_private;
+#endif
+
+#ifdef CONFIG_MTD_SMART_BGGC
+	/* Nothing is written once the volume is unmounted. */
+
+	work_cancel(LPWORK, &dev->gcwork);
+#endif
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+	/* The emptied blocks are found again by the collection. */
+
+	work_cancel(LPWORK, &dev->eawork);
+	dev->eacount = 0;
+#endif
+
+	smart_semtake(dev);
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+	/* This is the clean unmount, save the state for a fast mount. */
+
+	(void)smart_checkpoint_write(dev);
+#endif
+	smart_semgive(dev);
+#endif
+
 	return OK;
 }
 
@@ -935,6 +1107,13 @@ static ssize_t smart_write(FAR struct inode *inode, FAR const unsigned char *buf
 
 	/* I think maybe we need to lock on a mutex here. */
 
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+	ret = smart_checkpoint_invalidate(dev);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
 	/* Get the aligned block. Here it is assumed that:
 	 *  (1) The number of R/W blocks per erase block is a power of 2, and
 	 *  (2) the erase begins with that same alignment.
@@ -1104,7 +1283,28 @@ static int smart_setsectorsize(FAR struct smart_struct_s *dev, uint16_t size)
 			dev->availSectPerBlk = dev->sectorsPerBlk;
 		}
 	}
-	
+
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+	/* The checkpoint region is reserved at the very end of the partition,
+	 * after the journal.  It is sized for the map and counts of the whole
+	 * partition, which is a little more than they will need.
+	 */
+
+	dev->ncheckpointblocks = 0;
+	dev->checkpointlive = false;
+	if (dev->erasesize != 0) {
+		allocsize = sizeof(struct smart_checkpoint_s) + sizeof(uint32_t) +
+					dev->neraseblocks * (dev->sectorsPerBlk * sizeof(uint16_t) + 2);
+		dev->ncheckpointblocks = (allocsize + erasesize - 1) / erasesize;
+		if (dev->ncheckpointblocks >= dev->neraseblocks) {
+			dev->ncheckpointblocks = 0;
+		}
+
+		dev->neraseblocks -= dev->ncheckpointblocks;
+		dev->checkpointblock = dev->neraseblocks;
+	}
+#endif
+
 #ifdef CONFIG_MTD_SMART_JOURNALING
 	/** Journal Sector is reserved at the last of smartfs partition, it doesn't use MTD Header.
 	  * We will use it as a contigous memory space...
@@ -1425,6 +1625,38 @@ static ssize_t smart_bytewrite(FAR struct smart_struct_s *dev, size_t offset, in
 	return ret;
 }
 
+/****************************************************************************
+ * Name: smart_cache_touch
+ *
+ * Description: Make a cache entry the most recently used one.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_SMART_MINIMIZE_RAM
+static void smart_cache_touch(FAR struct smart_struct_s *dev, uint16_t index)
+{
+	uint16_t x;
+
+	dev->sCache[index].birth = dev->cache_nextbirth++;
+
+	/* Keep the birthdays in range by halving the ages.  The order of the
+	 * entries is kept, except for the oldest ones which become equally old.
+	 */
+
+	if (dev->cache_nextbirth >= SMART_CACHE_BIRTH_LIMIT) {
+		for (x = 0; x < dev->cache_entries; x++) {
+			if (dev->sCache[x].birth >= SMART_CACHE_BIRTH_LIMIT / 2) {
+				dev->sCache[x].birth -= SMART_CACHE_BIRTH_LIMIT / 2;
+			} else {
+				dev->sCache[x].birth = 0;
+			}
+		}
+
+		dev->cache_nextbirth -= SMART_CACHE_BIRTH_LIMIT / 2;
+	}
+}
+#endif
+
 /****************************************************************************
  * Name: smart_add_sector_to_cache
  *
@@ -1432,9 +1664,9 @@ static ssize_t smart_bytewrite(FAR struct smart_struct_s *dev, size_t offset, in
  *              map cache.  The cache is used to minimize RAM by eliminating
  *              a one-to-one mapping of all logical sectors and only keeping
  *              a fixed number of mappings per the
- *              CONFIG_MTD_SMART_SECTOR_CACHE_SIZE parameter.  Sectors are
- *              automatically managed and removed based on the time since
- *              they were accessed last.
+ *              CONFIG_MTD_SMART_SECTOR_CACHE_SIZE parameter.  When the
+ *              cache is full, the least recently used entry is replaced.
+ *              The system sectors are never replaced.
  *
  ****************************************************************************/
 
@@ -1444,13 +1676,27 @@ static int smart_add_sector_to_cache(FAR struct smart_struct_s *dev, uint16_t lo
 	uint16_t index, x;
 	uint16_t oldest;
 
+	/* Refresh the entry if the sector is already cached */
+
+	for (x = 0; x < dev->cache_entries; x++) {
+		if (dev->sCache[x].logical == logical) {
+			dev->sCache[x].physical = physical;
+			smart_cache_touch(dev, x);
+			dev->cache_lastlog = logical;
+			dev->cache_lastphys = physical;
+			return x;
+		}
+	}
+
 	/* If we aren't full yet, just add the sector to the end of the list. */
 
 	index = 1;
 	if (dev->cache_entries < CONFIG_MTD_SMART_SECTOR_CACHE_SIZE) {
 		index = dev->cache_entries++;
 	} else {
-		/* Cache is full.  We must find the least accessed entry and replace it. */
+		/* Cache is full.  We must find the least recently used entry and
+		 * replace it.
+		 */
 
 		oldest = 0xFFFF;
 		for (x = 0; x < CONFIG_MTD_SMART_SECTOR_CACHE_SIZE; x++) {
@@ -1460,7 +1706,7 @@ static int smart_add_sector_to_cache(FAR struct smart_struct_s *dev, uint16_t lo
 				continue;
 			}
 
-			/* If the hit count is zero, then choose this entry. */
+			/* Choose the entry which was used the longest time ago. */
 
 			if (dev->sCache[x].birth < oldest) {
 				oldest = dev->sCache[x].birth;
@@ -1473,24 +1719,33 @@ static int smart_add_sector_to_cache(FAR struct smart_struct_s *dev, uint16_t lo
 
 	dev->sCache[index].logical = logical;
 	dev->sCache[index].physical = physical;
-	dev->sCache[index].birth = dev->cache_nextbirth++;
+	smart_cache_touch(dev, index);
 	dev->cache_lastlog = logical;
 	dev->cache_lastphys = physical;
 	if (dev->debuglevel > 1) {
 		dbg("Add Cache sector:  Log=%d, Phys=%d at index %d from line %d\n", logical, physical, index, line);
 	}
 
-	/* Test if the birthdays need to be adjusted. */
-
-	if (oldest >= CONFIG_MTD_SMART_SECTOR_CACHE_SIZE + 1024) {
-		for (x = 0; x < dev->cache_entries; x++) {
-			dev->sCache[x].birth -= 1024;
-		}
+	return index;
+}
+#endif
 
-		dev->cache_nextbirth -= 1024;
-	}
+/****************************************************************************
+ * Name: smart_block_has_live
+ *
+ * Description: Tell from the free and release counts of an erase block if
+ *              any of its sectors may still hold a logical sector.
+ *
+ ****************************************************************************/
 
-	return index;
+#ifdef CONFIG_MTD_SMART_MINIMIZE_RAM
+static bool smart_block_has_live(FAR struct smart_struct_s *dev, uint16_t block)
+{
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+	return smart_get_count(dev, dev->freecount, block) + smart_get_count(dev, dev->releasecount, block) < dev->availSectPerBlk;
+#else
+	return dev->freecount[block] + dev->releasecount[block] < dev->availSectPerBlk;
+#endif
 }
 #endif
 
@@ -1529,6 +1784,7 @@ static uint16_t smart_cache_lookup(FAR struct smart_struct_s *dev, uint16_t logi
 			/* Entry found in the cache.  Grab the physical mapping. */
 
 			physical = dev->sCache[x].physical;
+			smart_cache_touch(dev, x);
 			break;
 		}
 	}
@@ -1549,6 +1805,14 @@ static uint16_t smart_cache_lookup(FAR struct smart_struct_s *dev, uint16_t logi
 			/* Now scan across each erase block. */
 
 			for (block = 0; block < dev->neraseblocks; block++) {
+				/* Skip the erase blocks holding no live sector, their
+				 * headers are all free or released.
+				 */
+
+				if (!smart_block_has_live(dev, block)) {
+					continue;
+				}
+
 				/* Calculate the read address for this sector. */
 
 				readaddress = block * dev->erasesize + sector * CONFIG_MTD_SMART_SECTOR_SIZE;
@@ -1577,7 +1841,7 @@ static uint16_t smart_cache_lookup(FAR struct smart_struct_s *dev, uint16_t logi
 
 				/* Test if this sector has been release and skip it if it has. */
 
-				if (SECOR_IS_RELEASED(header)) {
+				if (SECTOR_IS_RELEASED(header)) {
 					continue;
 				}
 
@@ -1634,8 +1898,7 @@ static void smart_update_cache(FAR struct smart_struct_s *dev, uint16_t logical,
 			 */
 
 			if (physical == 0xFFFF) {
-				dev->sCache[x].logical = dev->sCache[dev->cache_entries - 1].logical;
-				dev->sCache[x].physical = dev->sCache[dev->cache_entries - 1].physical;
+				dev->sCache[x] = dev->sCache[dev->cache_entries - 1];
 				dev->cache_entries--;
 			}
 
@@ -1827,6 +2090,249 @@ static int smart_set_wear_level(FAR struct smart_struct_s *dev, uint16_t block,
 }
 #endif
 
+/****************************************************************************
+ * Name: smart_checkpoint_crc
+ *
+ * Description: Calculate the CRC of a checkpoint header and of the map and
+ *              counts following it.  The 'consumed' byte is left out since
+ *              it is programmed after the checkpoint is written.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+static uint32_t smart_checkpoint_crc(FAR const struct smart_checkpoint_s *ckpt, FAR const uint8_t *payload)
+{
+	uint32_t crc;
+
+	crc = crc32part((FAR const uint8_t *)ckpt + 1, offsetof(struct smart_checkpoint_s, crc) - 1, 0);
+	return crc32part(payload, ckpt->length, crc);
+}
+
+/****************************************************************************
+ * Name: smart_checkpoint_put
+ *
+ * Description: Append data to the checkpoint region.  The data is gathered
+ *              in the rwbuffer and written one sector at a time, 'pos' is
+ *              the offset in the region.  A NULL 'data' pads and writes the
+ *              last partial sector.
+ *
+ ****************************************************************************/
+
+static int smart_checkpoint_put(FAR struct smart_struct_s *dev, FAR uint32_t *pos, FAR const void *data, size_t len)
+{
+	uint32_t fill;
+	uint32_t nbytes;
+	off_t block;
+	int ret;
+
+	if (data == NULL) {
+		fill = *pos % dev->sectorsize;
+		if (fill == 0) {
+			return OK;
+		}
+
+		len = dev->sectorsize - fill;
+		memset(&dev->rwbuffer[fill], CONFIG_SMARTFS_ERASEDSTATE, len);
+	}
+
+	while (len > 0) {
+		fill = *pos % dev->sectorsize;
+		nbytes = dev->sectorsize - fill;
+		if (nbytes > len) {
+			nbytes = len;
+		}
+
+		if (data != NULL) {
+			memcpy(&dev->rwbuffer[fill], data, nbytes);
+			data = (FAR const uint8_t *)data + nbytes;
+		}
+
+		*pos += nbytes;
+		len -= nbytes;
+
+		if (fill + nbytes == dev->sectorsize) {
+			block = (dev->checkpointblock * dev->erasesize + *pos - dev->sectorsize) / dev->geo.blocksize;
+			ret = MTD_BWRITE(dev->mtd, block, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+			if (ret != dev->mtdBlksPerSector) {
+				fdbg("Error writing checkpoint at block %d\n", block);
+				return -EIO;
+			}
+		}
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: smart_checkpoint_write
+ *
+ * Description: Save the sector map, the free and release counts and the
+ *              format information in the checkpoint region.  Called on a
+ *              clean unmount or a flush, when no write is in progress.
+ *
+ ****************************************************************************/
+
+static int smart_checkpoint_write(FAR struct smart_struct_s *dev)
+{
+	struct smart_checkpoint_s ckpt;
+	uint32_t generation;
+	uint32_t pos = 0;
+	int ret;
+
+	if (dev->ncheckpointblocks == 0 || dev->checkpointlive || dev->formatstatus != SMART_FMT_STAT_FORMATTED) {
+		return OK;
+	}
+
+	ret = MTD_ERASE(dev->mtd, dev->checkpointblock, dev->ncheckpointblocks);
+	if (ret < 0) {
+		fdbg("Error %d erasing checkpoint\n", -ret);
+		return ret;
+	}
+
+	memset(&ckpt, 0, sizeof(struct smart_checkpoint_s));
+	ckpt.consumed = SMART_CHECKPOINT_LIVE;
+	ckpt.version = SMART_CHECKPOINT_VERSION;
+	ckpt.namesize = dev->namesize;
+	ckpt.formatversion = dev->formatversion;
+	ckpt.magic = SMART_CHECKPOINT_MAGIC;
+	ckpt.generation = dev->checkpointgen + 1;
+	ckpt.totalsectors = dev->totalsectors;
+	ckpt.neraseblocks = dev->neraseblocks;
+	ckpt.freesectors = dev->freesectors;
+	ckpt.releasesectors = dev->releasesectors;
+	ckpt.length = dev->totalsectors * sizeof(uint16_t) + (dev->neraseblocks << 1);
+	ckpt.crc = smart_checkpoint_crc(&ckpt, (FAR const uint8_t *)dev->sMap);
+	generation = ckpt.generation;
+
+	/* The sMap allocation also holds the release and free counts. */
+
+	ret = smart_checkpoint_put(dev, &pos, &ckpt, sizeof(struct smart_checkpoint_s));
+	if (ret == OK) {
+		ret = smart_checkpoint_put(dev, &pos, dev->sMap, ckpt.length);
+	}
+	if (ret == OK) {
+		ret = smart_checkpoint_put(dev, &pos, &generation, sizeof(uint32_t));
+	}
+	if (ret == OK) {
+		ret = smart_checkpoint_put(dev, &pos, NULL, 0);
+	}
+	if (ret < 0) {
+		return ret;
+	}
+
+	dev->checkpointgen = generation;
+	dev->checkpointlive = true;
+	fvdbg("Checkpoint %u written, %u bytes\n", generation, pos);
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: smart_checkpoint_load
+ *
+ * Description: Load the device state from the checkpoint region.  Returns
+ *              OK if the checkpoint is live and consistent with the device,
+ *              otherwise the caller must scan the device.
+ *
+ ****************************************************************************/
+
+static int smart_checkpoint_load(FAR struct smart_struct_s *dev)
+{
+	struct smart_checkpoint_s ckpt;
+	uint32_t address;
+	uint32_t generation;
+	int ret;
+
+	if (dev->ncheckpointblocks == 0) {
+		return -ENOENT;
+	}
+
+	address = dev->checkpointblock * dev->erasesize;
+	ret = MTD_READ(dev->mtd, address, sizeof(struct smart_checkpoint_s), (FAR uint8_t *)&ckpt);
+	if (ret != sizeof(struct smart_checkpoint_s) || ckpt.magic != SMART_CHECKPOINT_MAGIC) {
+		return -ENOENT;
+	}
+
+	/* Keep the generation counting up even when the checkpoint is unused. */
+
+	dev->checkpointgen = ckpt.generation;
+
+	if (ckpt.consumed != SMART_CHECKPOINT_LIVE || ckpt.version != SMART_CHECKPOINT_VERSION ||
+		ckpt.totalsectors != dev->totalsectors || ckpt.neraseblocks != dev->neraseblocks ||
+		ckpt.length != dev->totalsectors * sizeof(uint16_t) + (dev->neraseblocks << 1)) {
+		fvdbg("Checkpoint %u not usable\n", ckpt.generation);
+		return -ESTALE;
+	}
+
+	/* Read the map and counts straight into place.  The scan initializes
+	 * them again if the checkpoint turns out to be corrupted.
+	 */
+
+	address += sizeof(struct smart_checkpoint_s);
+	ret = MTD_READ(dev->mtd, address, ckpt.length, (FAR uint8_t *)dev->sMap);
+	if (ret != ckpt.length) {
+		return -EIO;
+	}
+
+	ret = MTD_READ(dev->mtd, address + ckpt.length, sizeof(uint32_t), (FAR uint8_t *)&generation);
+	if (ret != sizeof(uint32_t) || generation != ckpt.generation ||
+		smart_checkpoint_crc(&ckpt, (FAR const uint8_t *)dev->sMap) != ckpt.crc) {
+		fdbg("Checkpoint %u corrupted\n", ckpt.generation);
+		return -EBADMSG;
+	}
+
+	dev->formatstatus = SMART_FMT_STAT_FORMATTED;
+	dev->namesize = ckpt.namesize;
+	dev->formatversion = ckpt.formatversion;
+	dev->freesectors = ckpt.freesectors;
+	dev->releasesectors = ckpt.releasesectors;
+	dev->checkpointlive = true;
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: smart_checkpoint_invalidate
+ *
+ * Description: Mark the checkpoint consumed before the device is modified,
+ *              so that a later mount cannot load a stale state.  This is a
+ *              single byte program, the region is only erased when the next
+ *              checkpoint is written.
+ *
+ ****************************************************************************/
+
+static int smart_checkpoint_invalidate(FAR struct smart_struct_s *dev)
+{
+	uint8_t consumed = SMART_CHECKPOINT_CONSUMED;
+	size_t offset;
+	ssize_t ret;
+
+	if (!dev->checkpointlive) {
+		return OK;
+	}
+
+	/* Not through smart_bytewrite(), the region is not journaled. */
+
+	offset = dev->checkpointblock * dev->erasesize + offsetof(struct smart_checkpoint_s, consumed);
+#ifdef CONFIG_MTD_BYTE_WRITE
+	if (dev->mtd->write != NULL) {
+		ret = MTD_WRITE(dev->mtd, offset, 1, &consumed);
+	} else
+#endif
+	{
+		ret = smart_byte_to_block_write(dev, offset, 1, &consumed);
+	}
+
+	if (ret != 1) {
+		fdbg("Error %d consuming checkpoint\n", ret);
+		return ret < 0 ? ret : -EIO;
+	}
+
+	dev->checkpointlive = false;
+	return OK;
+}
+#endif							/* CONFIG_MTD_SMART_CHECKPOINT */
+
 /****************************************************************************
  * Name: smart_scan
  *
@@ -1870,6 +2376,14 @@ static int smart_scan(FAR struct smart_struct_s *dev)
 		goto err_out;
 	}
 
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+	/* Skip the scan if the device was cleanly unmounted. */
+
+	if (smart_checkpoint_load(dev) == OK) {
+		goto scan_done;
+	}
+#endif
+
 	/* Initialize the device variables. */
 
 	totalsectors = dev->totalsectors;
@@ -2240,7 +2754,11 @@ static int smart_scan(FAR struct smart_struct_s *dev)
 		/* Mark the logical sector as used in the bitmap */
 		dev->sBitMap[logicalsector >> 3] |= 1 << (logicalsector & 0x07);
 
-		if (logicalsector < SMART_FIRST_ALLOC_SECTOR) {
+		/* The system sectors are always cached.  The others fill the cache
+		 * while it has room, which saves the first lookups a flash scan.
+		 */
+
+		if (logicalsector < SMART_FIRST_ALLOC_SECTOR || dev->cache_entries < CONFIG_MTD_SMART_SECTOR_CACHE_SIZE) {
 			smart_add_sector_to_cache(dev, logicalsector, winner, __LINE__);
 		}
 #endif
@@ -2310,6 +2828,10 @@ static int smart_scan(FAR struct smart_struct_s *dev)
 #endif							/* CONFIG_MTD_SMART_CONVERT_WEAR_FORMAT */
 #endif							/* CONFIG_MTD_SMART_WEAR_LEVEL && SMART_STATUS_VERSION == 1 */
 
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+scan_done:
+#endif
+
 #ifdef CONFIG_MTD_SMART_WEAR_LEVEL
 	/* Read the wear leveling status bits. */
 
@@ -2329,6 +2851,10 @@ static int smart_scan(FAR struct smart_struct_s *dev)
 	fdbg("   Journal total:        %10d\n", dev->njournalentries);
 	fdbg("   Journal usage:        %10d\n", dev->journal_seq);
 #endif
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+	fdbg("   Checkpoint block:     %10d\n", dev->ncheckpointblocks);
+	fdbg("   Checkpoint loaded:    %10d\n", dev->checkpointlive);
+#endif
 #ifdef CONFIG_MTD_SMART_ALLOC_DEBUG
 	fdbg("   Allocations:\n");
 	for (sector = 0; sector < SMART_MAX_ALLOCS; sector++) {
@@ -3548,24 +4074,66 @@ retry:
 #if SMART_STATUS_VERSION == 1
 			((header.seq == 0xFF) && (header.crc8 == 0xFF)) &&
 #else
-			(header.seq == CONFIG_SMARTFS_ERASEDSTATE) &&
+			(header.seq == CONFIG_SMARTFS_ERASEDSTATE) &&
+#endif
+			(!(SECTOR_IS_COMMITTED(header)))) {
+				physicalsector = x;
+				dev->lastallocblock = allocblock;
+				break;
+		}
+	}
+
+	if (physicalsector == 0xFFFF) {
+		fdbg("Program bug!  Expected a free sector %d\n", allocblock);
+	}
+	if (physicalsector >= dev->totalsectors) {
+		fdbg("Program bug!  Selected sector too big!!!\n");
+	}
+
+	return physicalsector;
+}
+
+/****************************************************************************
+ * Name: smart_find_collect_block
+ *
+ * Description:  Find the erase block with the most released sectors, which
+ *               is the cheapest one to collect.  Returns 0xFFFF if no block
+ *               has released sectors.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_WRITABLE
+static uint16_t smart_find_collect_block(FAR struct smart_struct_s *dev, FAR uint16_t *released)
+{
+	uint16_t collectblock = 0xFFFF;
+	uint16_t releasemax = 0;
+	uint16_t count;
+	int x;
+
+	for (x = 0; x < dev->neraseblocks; x++) {
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+		/* Don't collect blocks that have been worn completely. */
+
+		if (smart_get_wear_level(dev, x) >= SMART_WEAR_REORG_THRESHOLD) {
+			continue;
+		}
+#endif
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+		count = smart_get_count(dev, dev->releasecount, x);
+#else
+		count = dev->releasecount[x];
 #endif
-			(!(SECTOR_IS_COMMITTED(header)))) {
-				physicalsector = x;
-				dev->lastallocblock = allocblock;
-				break;
+		if (count > releasemax) {
+			releasemax = count;
+			collectblock = x;
 		}
 	}
 
-	if (physicalsector == 0xFFFF) {
-		fdbg("Program bug!  Expected a free sector %d\n", allocblock);
-	}
-	if (physicalsector >= dev->totalsectors) {
-		fdbg("Program bug!  Selected sector too big!!!\n");
-	}
-
-	return physicalsector;
+	*released = releasemax;
+	return collectblock;
 }
+#endif							/* CONFIG_FS_WRITABLE */
 
 /****************************************************************************
  * Name: smart_garbagecollect
@@ -3582,11 +4150,7 @@ static int smart_garbagecollect(FAR struct smart_struct_s *dev)
 	uint16_t collectblock;
 	uint16_t releasemax;
 	bool collect = TRUE;
-	int x;
 	int ret;
-#ifdef CONFIG_MTD_SMART_PACK_COUNTS
-	uint8_t count;
-#endif
 
 	while (collect) {
 		collect = FALSE;
@@ -3610,32 +4174,7 @@ static int smart_garbagecollect(FAR struct smart_struct_s *dev)
 		if (collect) {
 			/* Find the block with the most released sectors. */
 
-			collectblock = 0xFFFF;
-			releasemax = 0;
-			for (x = 0; x < dev->neraseblocks; x++) {
-#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
-				/* Don't collect blocks that have been worn completely. */
-
-				if (smart_get_wear_level(dev, x) >= SMART_WEAR_REORG_THRESHOLD) {
-					continue;
-				}
-#endif
-
-#ifdef CONFIG_MTD_SMART_PACK_COUNTS
-				count = smart_get_count(dev, dev->releasecount, x);
-				if (count > releasemax) {
-					releasemax = count;
-					collectblock = x;
-				}
-#else
-				if (dev->releasecount[x] > releasemax) {
-					releasemax = dev->releasecount[x];
-					collectblock = x;
-				}
-#endif
-			}
-			//releasemax = smart_get_count(dev, dev->releasecount, collectblock);
-
+			collectblock = smart_find_collect_block(dev, &releasemax);
 			if (collectblock == 0xFFFF) {
 				/* Need to collect, but no sectors with released blocks! */
 
@@ -3667,11 +4206,224 @@ static int smart_garbagecollect(FAR struct smart_struct_s *dev)
 			if (ret != OK) {
 				return ret;
 			}
+
+#ifdef CONFIG_MTD_SMART_BGGC
+			dev->fgblocks++;
+#endif
 		}
 	}
 
 	return OK;
 }
+
+#ifdef CONFIG_MTD_SMART_BGGC
+/****************************************************************************
+ * Name: smart_bggc_worker
+ *
+ * Description:  Collect erase blocks on the low priority work queue while
+ *               the device is idle, until the free space gets back to the
+ *               high watermark.  The lock is released between two blocks,
+ *               and the run stops as soon as a modifying ioctl comes in, to
+ *               be resumed once the device is idle again.
+ *
+ ****************************************************************************/
+
+static void smart_bggc_worker(FAR void *arg)
+{
+	FAR struct smart_struct_s *dev = (FAR struct smart_struct_s *)arg;
+	uint16_t collectblock;
+	uint16_t released;
+	uint16_t moved;
+	clock_t activity;
+	clock_t start;
+	clock_t idle;
+	int ret;
+
+	smart_semtake(dev);
+
+	idle = clock_systimer() - dev->gcactivity;
+	if (idle < SMART_BGGC_IDLE_TICKS) {
+		/* Written to since we were queued, wait for the rest of the idle time. */
+
+		work_queue(LPWORK, &dev->gcwork, smart_bggc_worker, dev, SMART_BGGC_IDLE_TICKS - idle);
+		smart_semgive(dev);
+		return;
+	}
+
+	start = clock_systimer();
+	activity = dev->gcactivity;
+	dev->gcruns++;
+
+	while (dev->formatstatus == SMART_FMT_STAT_FORMATTED &&
+		   dev->freesectors < CONFIG_MTD_SMART_BGGC_HIGHWATER * dev->availSectPerBlk) {
+		collectblock = smart_find_collect_block(dev, &released);
+		if (collectblock == 0xFFFF || released < SMART_BGGC_MIN_RELEASED(dev)) {
+			break;
+		}
+
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+		if (smart_checkpoint_invalidate(dev) < 0) {
+			break;
+		}
+#endif
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+		moved = dev->availSectPerBlk - released - smart_get_count(dev, dev->freecount, collectblock);
+#else
+		moved = dev->availSectPerBlk - released - dev->freecount[collectblock];
+#endif
+
+		fvdbg("Background collecting block %d, released=%d\n", collectblock, released);
+		ret = smart_relocate_block(dev, collectblock);
+		if (ret != OK) {
+			fdbg("Error %d collecting block %d\n", ret, collectblock);
+			break;
+		}
+
+		dev->gcblocks++;
+		dev->gcsectors += moved;
+
+		/* Let a waiting writer in before the next block. */
+
+		smart_semgive(dev);
+		smart_semtake(dev);
+
+		if (dev->gcactivity != activity) {
+			work_queue(LPWORK, &dev->gcwork, smart_bggc_worker, dev, SMART_BGGC_IDLE_TICKS);
+			break;
+		}
+	}
+
+	dev->gcticks += clock_systimer() - start;
+	smart_semgive(dev);
+}
+
+/****************************************************************************
+ * Name: smart_bggc_schedule
+ *
+ * Description:  Note the activity of the device and queue the background
+ *               collection when the free space drops below the low
+ *               watermark.  Called with the device locked.
+ *
+ ****************************************************************************/
+
+static void smart_bggc_schedule(FAR struct smart_struct_s *dev)
+{
+	dev->gcactivity = clock_systimer();
+
+	if (dev->freesectors < CONFIG_MTD_SMART_BGGC_LOWWATER * dev->availSectPerBlk && work_available(&dev->gcwork)) {
+		work_queue(LPWORK, &dev->gcwork, smart_bggc_worker, dev, SMART_BGGC_IDLE_TICKS);
+	}
+
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+	if (dev->eacount > 0 && work_available(&dev->eawork)) {
+		work_queue(LPWORK, &dev->eawork, smart_eraseahead_worker, dev, SMART_BGGC_IDLE_TICKS);
+	}
+#endif
+}
+
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+/****************************************************************************
+ * Name: smart_eraseahead
+ *
+ * Description:  Queue the erase block if the release emptied it, so that it
+ *               is erased while the device is idle.  The block is erased in
+ *               place if the queue is full.  Called with the device locked.
+ *
+ ****************************************************************************/
+
+static void smart_eraseahead(FAR struct smart_struct_s *dev, uint16_t block)
+{
+	uint16_t freecount;
+	uint16_t releasecount;
+	int x;
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+	releasecount = smart_get_count(dev, dev->releasecount, block);
+	freecount = smart_get_count(dev, dev->freecount, block);
+#else
+	releasecount = dev->releasecount[block];
+	freecount = dev->freecount[block];
+#endif
+
+	if (freecount + releasecount != dev->availSectPerBlk || freecount >= 1) {
+		return;
+	}
+
+	for (x = 0; x < dev->eacount; x++) {
+		if (dev->eaqueue[x] == block) {
+			return;
+		}
+	}
+
+	if (dev->eacount == CONFIG_MTD_SMART_ERASEAHEAD_NBLOCKS) {
+		smart_erase_block_if_empty(dev, block, FALSE);
+		return;
+	}
+
+	dev->eaqueue[dev->eacount++] = block;
+}
+
+/****************************************************************************
+ * Name: smart_eraseahead_worker
+ *
+ * Description:  Erase the queued blocks on the low priority work queue once
+ *               the device is idle.  A queued block which was collected or
+ *               written since is left alone by smart_erase_block_if_empty().
+ *               The lock is released between two blocks, and the run stops
+ *               as soon as a modifying ioctl comes in.  The MTD driver may
+ *               return before the erase is complete, the next access then
+ *               waits for it.
+ *
+ ****************************************************************************/
+
+static void smart_eraseahead_worker(FAR void *arg)
+{
+	FAR struct smart_struct_s *dev = (FAR struct smart_struct_s *)arg;
+	clock_t activity;
+	clock_t idle;
+	uint16_t block;
+
+	smart_semtake(dev);
+
+	idle = clock_systimer() - dev->gcactivity;
+	if (idle < SMART_BGGC_IDLE_TICKS) {
+		work_queue(LPWORK, &dev->eawork, smart_eraseahead_worker, dev, SMART_BGGC_IDLE_TICKS - idle);
+		smart_semgive(dev);
+		return;
+	}
+
+	activity = dev->gcactivity;
+
+	while (dev->eacount > 0 && dev->formatstatus == SMART_FMT_STAT_FORMATTED) {
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+		if (smart_checkpoint_invalidate(dev) < 0) {
+			break;
+		}
+#endif
+
+		block = dev->eaqueue[--dev->eacount];
+		fvdbg("Erasing ahead block %d\n", block);
+		smart_erase_block_if_empty(dev, block, FALSE);
+		dev->eablocks++;
+
+		/* Let a waiting writer in before the next block. */
+
+		smart_semgive(dev);
+		smart_semtake(dev);
+
+		if (dev->gcactivity != activity) {
+			if (dev->eacount > 0) {
+				work_queue(LPWORK, &dev->eawork, smart_eraseahead_worker, dev, SMART_BGGC_IDLE_TICKS);
+			}
+			break;
+		}
+	}
+
+	smart_semgive(dev);
+}
+#endif							/* CONFIG_MTD_SMART_ERASEAHEAD */
+#endif							/* CONFIG_MTD_SMART_BGGC */
 #endif							/* CONFIG_FS_WRITABLE */
 
 /****************************************************************************
@@ -4339,7 +5091,11 @@ static int smart_writesector(FAR struct smart_struct_s *dev, unsigned long arg)
 
 		/* Test if releasing the sector created an empty erase block. */
 
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+		smart_eraseahead(dev, block);
+#else
 		smart_erase_block_if_empty(dev, block, FALSE);
+#endif
 
 		/* Since we performed a relocation, do garbage collection to
 		 * ensure we don't fill up our flash with released blocks.
@@ -4506,6 +5262,118 @@ static int smart_readsector(FAR struct smart_struct_s *dev, unsigned long arg)
 	return ret;
 }
 
+/****************************************************************************
+ * Name: smart_readahead_valid
+ *
+ * Description:  Check that a physical sector read by smart_readahead holds
+ *               the current copy of a logical sector and return it, or
+ *               0xFFFF if it does not.
+ *
+ ****************************************************************************/
+
+static uint16_t smart_readahead_valid(FAR struct smart_struct_s *dev, FAR uint8_t *slot, uint16_t physsector)
+{
+	FAR struct smart_sect_header_s *header;
+	uint16_t logsector;
+	uint16_t mapped;
+
+	header = (FAR struct smart_sect_header_s *)slot;
+	logsector = UINT8TOUINT16(header->logicalsector);
+	if (logsector >= dev->totalsectors || !SECTOR_IS_COMMITTED((*header)) || SECTOR_IS_RELEASED((*header))) {
+		return 0xFFFF;
+	}
+
+	/* An older copy of the sector may not be erased yet */
+
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
+	mapped = dev->sMap[logsector];
+#else
+	mapped = smart_cache_lookup(dev, logsector);
+#endif
+	if (mapped != physsector) {
+		return 0xFFFF;
+	}
+
+#if defined(CONFIG_MTD_SMART_ENABLE_CRC) && !defined(CONFIG_MTD_SMART_JOURNALING)
+#if SMART_STATUS_VERSION == 1
+	if ((header->status & SMART_STATUS_CRC) != (CONFIG_SMARTFS_ERASEDSTATE & SMART_STATUS_CRC))
+#endif
+	{
+		memcpy(dev->rwbuffer, slot, dev->sectorsize);
+		if (smart_validate_crc(dev) != OK) {
+			fdbg("Error validating physical sector %d logical sector %d CRC during read ahead\n", physsector, logsector);
+			return 0xFFFF;
+		}
+	}
+#endif
+
+	return logsector;
+}
+
+/****************************************************************************
+ * Name: smart_readahead
+ *
+ * Description:  Read a logical sector and the physical sectors following
+ *               it in the same erase block with a single MTD transfer.
+ *               Sectors written one after the other, like the chain of a
+ *               file written sequentially, are usually stored together.
+ *               Slots which do not hold the current copy of a logical
+ *               sector are reported as 0xFFFF.
+ *
+ ****************************************************************************/
+
+static int smart_readahead(FAR struct smart_struct_s *dev, unsigned long arg)
+{
+	FAR struct smart_readahead_s *req;
+	FAR uint8_t *slot;
+	uint16_t physsector;
+	uint16_t nsectors;
+	uint16_t x;
+	ssize_t ret;
+
+	req = (FAR struct smart_readahead_s *)arg;
+	if (req->logsector >= dev->totalsectors || req->nsectors == 0) {
+		return -EINVAL;
+	}
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
+	physsector = dev->sMap[req->logsector];
+#else
+	physsector = smart_cache_lookup(dev, req->logsector);
+#endif
+	if (physsector == 0xFFFF) {
+		fdbg("Logical sector %d not allocated\n", req->logsector);
+		return -EINVAL;
+	}
+
+	/* Stop at the end of the erase block */
+
+	nsectors = dev->sectorsPerBlk - (physsector % dev->sectorsPerBlk);
+	if (nsectors > req->nsectors) {
+		nsectors = req->nsectors;
+	}
+
+	ret = MTD_BREAD(dev->mtd, physsector * dev->mtdBlksPerSector, nsectors * dev->mtdBlksPerSector, req->buffer);
+	if (ret != nsectors * dev->mtdBlksPerSector) {
+		fdbg("Error reading phys sector %d\n", physsector);
+		return -EIO;
+	}
+
+	for (x = 0; x < nsectors; x++) {
+		slot = &req->buffer[x * dev->sectorsize];
+		req->logsectors[x] = smart_readahead_valid(dev, slot, physsector + x);
+		if (req->logsectors[x] != 0xFFFF) {
+			memmove(slot, &slot[sizeof(struct smart_sect_header_s)], dev->sectorsize - sizeof(struct smart_sect_header_s));
+		}
+	}
+
+	if (req->logsectors[0] != req->logsector) {
+		fdbg("Error in logical sector %d header, phys=%d\n", req->logsector, physsector);
+		return -EIO;
+	}
+
+	return nsectors;
+}
+
 /****************************************************************************
  * Name: smart_allocsector
  *
@@ -4809,7 +5677,11 @@ static inline int smart_freesector(FAR struct smart_struct_s *dev, unsigned long
 
 	/* If this block has only released blocks, then erase it. */
 
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+	smart_eraseahead(dev, block);
+#else
 	smart_erase_block_if_empty(dev, block, FALSE);
+#endif
 
 	return OK;
 }
@@ -4843,6 +5715,26 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 	dev = (FAR struct smart_struct_s *)inode->i_private;
 #endif
 
+	smart_semtake(dev);
+
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+	/* The checkpoint no longer describes the device once it is modified. */
+
+	switch (cmd) {
+	case BIOC_LLFORMAT:
+	case BIOC_ALLOCSECT:
+	case BIOC_FREESECT:
+	case BIOC_WRITESECT:
+	case BIOC_BULKERASE:
+	case BIOC_CORRUPTION:
+		ret = smart_checkpoint_invalidate(dev);
+		if (ret < 0) {
+			goto ok_out;
+		}
+		break;
+	}
+#endif
+
 	/* Process the ioctl's we care about first, pass any we don't respond
 	 * to directly to the underlying MTD device.
 	 */
@@ -4857,7 +5749,8 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 #ifdef CONFIG_DEBUG
 		if (arg == 0) {
 			fdbg("ERROR: BIOC_XIPBASE argument is NULL\n");
-			return -EINVAL;
+			ret = -EINVAL;
+			goto ok_out;
 		}
 #endif
 
@@ -4883,6 +5776,12 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 		ret = smart_readsector(dev, arg);
 		goto ok_out;
 
+	case BIOC_READAHEAD:
+
+		/* Read a logical sector and the sectors stored after it. */
+		ret = smart_readahead(dev, arg);
+		goto ok_out;
+
 #ifdef CONFIG_FS_WRITABLE
 	case BIOC_LLFORMAT:
 
@@ -4946,7 +5845,11 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 		sleep(1);
 		goto ok_out;
 	case BIOC_CORRUPTION :
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
 		sector = dev->sMap[SMART_FIRST_DIR_SECTOR];
+#else
+		sector = smart_cache_lookup(dev, SMART_FIRST_DIR_SECTOR);
+#endif
 		header = (FAR struct smart_sect_header_s *)dev->rwbuffer;
 		ret = MTD_BREAD(dev->mtd, sector * dev->mtdBlksPerSector, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
 		if (ret != dev->mtdBlksPerSector) {
@@ -4972,12 +5875,14 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 	case BIOC_FIBMAP:
 		sector = (uint16_t)arg;
 		if (sector >= dev->totalsectors) {
-			return -EINVAL;
+			ret = -EINVAL;
+			goto ok_out;
 		}
 
 		/* TODO Below should consider multi root mount point */
 		if (sector > SMART_FIRST_DIR_SECTOR && sector < SMART_FIRST_ALLOC_SECTOR) {
-			return 0xFFFF;
+			ret = 0xFFFF;
+			goto ok_out;
 		}
 
 #ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
@@ -5021,11 +5926,29 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 #endif
 #ifdef CONFIG_MTD_SMART_WEAR_LEVEL
 		procfs_data->uneven_wearcount = dev->uneven_wearcount;
+#endif
+#ifdef CONFIG_MTD_SMART_BGGC
+		procfs_data->gcruns = dev->gcruns;
+		procfs_data->gcblocks = dev->gcblocks;
+		procfs_data->gcsectors = dev->gcsectors;
+		procfs_data->gcmsec = TICK2MSEC(dev->gcticks);
+		procfs_data->fgblocks = dev->fgblocks;
+#endif
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+		procfs_data->eablocks = dev->eablocks;
 #endif
 		ret = OK;
 		goto ok_out;
 #endif
 
+	case BIOC_FLUSH:
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+		/* Save the state so that the next mount can skip the scan. */
+
+		ret = smart_checkpoint_write(dev);
+#endif
+		goto ok_out;
+
 	case BIOC_DEBUGCMD:
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
 		debug_data = (FAR struct mtd_smart_debug_data_s *)arg;
@@ -5062,6 +5985,17 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 	}
 
 ok_out:
+#ifdef CONFIG_MTD_SMART_BGGC
+	switch (cmd) {
+	case BIOC_ALLOCSECT:
+	case BIOC_FREESECT:
+	case BIOC_WRITESECT:
+		smart_bggc_schedule(dev);
+		break;
+	}
+#endif
+
+	smart_semgive(dev);
 	return ret;
 }
 
@@ -6028,6 +6962,24 @@ int smart_initialize(int minor, FAR struct mtd_dev_s *mtd, FAR const char *partn
 #ifdef CONFIG_MTD_SMART_JOURNALING
 		dev->block_map = NULL;
 #endif
+#ifdef CONFIG_MTD_SMART_CHECKPOINT
+		dev->checkpointgen = 0;
+#endif
+#ifdef CONFIG_MTD_SMART_BGGC
+		sem_init(&dev->exclsem, 0, 1);
+		memset(&dev->gcwork, 0, sizeof(struct work_s));
+		dev->gcactivity = 0;
+		dev->gcruns = 0;
+		dev->gcblocks = 0;
+		dev->gcsectors = 0;
+		dev->gcticks = 0;
+		dev->fgblocks = 0;
+#endif
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+		memset(&dev->eawork, 0, sizeof(struct work_s));
+		dev->eacount = 0;
+		dev->eablocks = 0;
+#endif
 
 		dev->sectorsize = 0;
 		ret = smart_setsectorsize(dev, CONFIG_MTD_SMART_SECTOR_SIZE);
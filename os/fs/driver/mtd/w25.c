@@ -69,6 +69,9 @@
 #include <debug.h>
 
 #include <tinyara/kmalloc.h>
+#ifdef CONFIG_W25_ERASE_SUSPEND
+#include <tinyara/arch.h>
+#endif
 #include <tinyara/fs/ioctl.h>
 #include <tinyara/spi/spi.h>
 #include <tinyara/fs/mtd.h>
@@ -119,6 +122,8 @@
 #define W25_RDMFID                 0x90	/* Read Manufacturer / Device            */
 #define W25_JEDEC_ID               0x9f	/* JEDEC ID read                         */
 #define W25_ADDR4BYTE              0xb7	/* 4-byte Address mode                   */
+#define W25_ERSUS                  0x75	/* Erase / Program Suspend               */
+#define W25_ERRES                  0x7a	/* Erase / Program Resume                */
 
 
 /* W25 Registers ********************************************************************/
@@ -210,6 +215,10 @@
 
 #define W25_DUMMY                  0xa5
 
+/* Time given to a resumed erase before it can be suspended again (tSUS) */
+
+#define W25_RESUME_USEC            20
+
 /* Chip Geometries ******************************************************************/
 /* All members of the family support uniform 4K-byte sectors and 256 byte pages */
 
@@ -265,6 +274,9 @@ struct w25_dev_s {
 	uint16_t nsectors;			/* Number of erase sectors */
 	uint8_t addr_len;           /* Address length */
 	uint8_t prev_instr;			/* Previous instruction given to W25 device */
+#ifdef CONFIG_W25_ERASE_SUSPEND
+	bool erasing;				/* A sector erase may be in progress */
+#endif
 
 #if defined(CONFIG_W25_SECTOR512) && !defined(CONFIG_W25_READONLY)
 	uint8_t flags;				/* Buffered sector flags */
@@ -291,6 +303,8 @@ static inline void w25_wrdi(FAR struct w25_dev_s *priv);
 static bool w25_is_erased(struct w25_dev_s *priv, off_t address, off_t size);
 static void w25_sectorerase(FAR struct w25_dev_s *priv, off_t offset);
 static inline int w25_chiperase(FAR struct w25_dev_s *priv);
+static bool w25_readbegin(FAR struct w25_dev_s *priv, off_t address);
+static void w25_readend(FAR struct w25_dev_s *priv, bool suspended);
 static void w25_byteread(FAR struct w25_dev_s *priv, FAR uint8_t *buffer, off_t address, size_t nbytes);
 #ifndef CONFIG_W25_READONLY
 static void w25_pagewrite(FAR struct w25_dev_s *priv, FAR const uint8_t *buffer, off_t address, size_t nbytes);
@@ -571,9 +585,73 @@ static uint8_t w25_waitwritecomplete(struct w25_dev_s *priv)
 		}
 	} while ((status & W25_SR_BUSY) != 0);
 
+#ifdef CONFIG_W25_ERASE_SUSPEND
+	priv->erasing = false;
+#endif
 	return status;
 }
 
+#ifdef CONFIG_W25_ERASE_SUSPEND
+/************************************************************************************
+ * Name: w25_erasesuspend
+ *
+ * Description:
+ *   Suspend the sector erase in progress, if any, so that the array can be read.
+ *   Returns true if the erase was suspended and must be resumed.
+ *
+ ************************************************************************************/
+
+static bool w25_erasesuspend(FAR struct w25_dev_s *priv)
+{
+	uint8_t status;
+
+	if (!priv->erasing) {
+		return false;
+	}
+
+	SPI_SELECT(priv->spi, SPIDEV_FLASH, true);
+	(void)SPI_SEND(priv->spi, W25_RDSR);
+	status = SPI_SEND(priv->spi, W25_DUMMY);
+	SPI_SELECT(priv->spi, SPIDEV_FLASH, false);
+
+	if ((status & W25_SR_BUSY) == 0) {
+		priv->erasing = false;
+		return false;
+	}
+
+	SPI_SELECT(priv->spi, SPIDEV_FLASH, true);
+	(void)SPI_SEND(priv->spi, W25_ERSUS);
+	SPI_SELECT(priv->spi, SPIDEV_FLASH, false);
+
+	/* BUSY is cleared once the erase is suspended, within tSUS */
+
+	do {
+		SPI_SELECT(priv->spi, SPIDEV_FLASH, true);
+		(void)SPI_SEND(priv->spi, W25_RDSR);
+		status = SPI_SEND(priv->spi, W25_DUMMY);
+		SPI_SELECT(priv->spi, SPIDEV_FLASH, false);
+	} while ((status & W25_SR_BUSY) != 0);
+
+	fvdbg("erase suspended\n");
+	return true;
+}
+
+/************************************************************************************
+ * Name: w25_eraseresume
+ ************************************************************************************/
+
+static void w25_eraseresume(FAR struct w25_dev_s *priv)
+{
+	SPI_SELECT(priv->spi, SPIDEV_FLASH, true);
+	(void)SPI_SEND(priv->spi, W25_ERRES);
+	SPI_SELECT(priv->spi, SPIDEV_FLASH, false);
+
+	/* The erase does not progress if it is suspended again right away */
+
+	up_udelay(W25_RESUME_USEC);
+}
+#endif
+
 /************************************************************************************
  * Name:  w25_wren
  ************************************************************************************/
@@ -622,6 +700,7 @@ static bool w25_is_erased(struct w25_dev_s *priv, off_t address, off_t size)
 	uint32_t erased_32;
 	unsigned int i;
 	uint32_t *buf;
+	bool suspended;
 
 	DEBUGASSERT((address % W25_PAGE_SIZE) == 0);
 	DEBUGASSERT((size % W25_PAGE_SIZE) == 0);
@@ -633,25 +712,28 @@ static bool w25_is_erased(struct w25_dev_s *priv, off_t address, off_t size)
 
 	memset(&erased_32, W25_ERASED_STATE, sizeof(erased_32));
 
-	/* Walk all pages in given area. */
+	/* Walk all pages in given area, in a single read command. */
+
+	suspended = w25_readbegin(priv, address);
 
 	while (npages) {
 		/* Check if all bytes of page is in erased state. */
 
-		w25_byteread(priv, (unsigned char *)buf, address, W25_PAGE_SIZE);
+		SPI_RECVBLOCK(priv->spi, buf, W25_PAGE_SIZE);
 
 		for (i = 0; i < W25_PAGE_SIZE / sizeof(uint32_t); i++) {
 			if (buf[i] != erased_32) {
 				/* Page not in erased state! */
+				w25_readend(priv, suspended);
 				kmm_free(buf);
 				return false;
 			}
 		}
 
-		address += W25_PAGE_SIZE;
 		npages--;
 	}
 
+	w25_readend(priv, suspended);
 	kmm_free(buf);
 	return true;
 }
@@ -715,6 +797,12 @@ static void w25_sectorerase(struct w25_dev_s *priv, off_t sector)
 	/* Deselect the FLASH */
 
 	SPI_SELECT(priv->spi, SPIDEV_FLASH, false);
+
+	/* Do not wait for the end of the erase, the next access does */
+
+#ifdef CONFIG_W25_ERASE_SUSPEND
+	priv->erasing = true;
+#endif
 }
 
 /************************************************************************************
@@ -750,16 +838,30 @@ static inline int w25_chiperase(struct w25_dev_s *priv)
 }
 
 /************************************************************************************
- * Name: w25_byteread
+ * Name: w25_readbegin
+ *
+ * Description:
+ *   Select the FLASH and send the read instruction at the address.  The data are
+ *   then clocked out with SPI_RECVBLOCK, for as many pages as needed, until
+ *   w25_readend().  Returns true if an erase was suspended for the read.
+ *
  ************************************************************************************/
 
-static void w25_byteread(FAR struct w25_dev_s *priv, FAR uint8_t *buffer, off_t address, size_t nbytes)
+static bool w25_readbegin(FAR struct w25_dev_s *priv, off_t address)
 {
-	fvdbg("address: %08lx nbytes: %d\n", (long)address, (int)nbytes);
+	bool suspended = false;
 
-	/* Wait for any preceding write or erase operation to complete. */
+#ifdef CONFIG_W25_ERASE_SUSPEND
+	/* Suspend a sector erase in progress instead of waiting for it */
 
-	(void)w25_waitwritecomplete(priv);
+	suspended = w25_erasesuspend(priv);
+	if (!suspended)
+#endif
+	{
+		/* Wait for any preceding write or erase operation to complete. */
+
+		(void)w25_waitwritecomplete(priv);
+	}
 
 	/* Make sure that writing is disabled */
 
@@ -803,13 +905,41 @@ static void w25_byteread(FAR struct w25_dev_s *priv, FAR uint8_t *buffer, off_t
 	(void)SPI_SEND(priv->spi, W25_DUMMY);
 #endif
 
-	/* Then read all of the requested bytes */
+	return suspended;
+}
 
-	SPI_RECVBLOCK(priv->spi, buffer, nbytes);
+/************************************************************************************
+ * Name: w25_readend
+ ************************************************************************************/
 
+static void w25_readend(FAR struct w25_dev_s *priv, bool suspended)
+{
 	/* Deselect the FLASH */
 
 	SPI_SELECT(priv->spi, SPIDEV_FLASH, false);
+
+#ifdef CONFIG_W25_ERASE_SUSPEND
+	if (suspended) {
+		w25_eraseresume(priv);
+	}
+#endif
+}
+
+/************************************************************************************
+ * Name: w25_byteread
+ ************************************************************************************/
+
+static void w25_byteread(FAR struct w25_dev_s *priv, FAR uint8_t *buffer, off_t address, size_t nbytes)
+{
+	bool suspended;
+
+	fvdbg("address: %08lx nbytes: %d\n", (long)address, (int)nbytes);
+
+	/* All of the requested bytes are read in a single burst */
+
+	suspended = w25_readbegin(priv, address);
+	SPI_RECVBLOCK(priv->spi, buffer, nbytes);
+	w25_readend(priv, suspended);
 }
 
 /************************************************************************************
@@ -849,7 +979,8 @@ static void w25_pagewrite(struct w25_dev_s *priv, FAR const uint8_t *buffer, off
 		if (priv->addr_len == 4) {
 			(void)SPI_SEND(priv->spi, (address >> 24) & 0xff);
 		}
-		(void)SPI_SEND(priv->spi, (address >> 16) & 0xff);
+
+		(void)SPI_SEND(priv->spi, (address >> 16) & 0xff);
 		(void)SPI_SEND(priv->spi, (address >> 8) & 0xff);
 		(void)SPI_SEND(priv->spi, address & 0xff);
 
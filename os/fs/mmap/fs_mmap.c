@@ -0,0 +1,195 @@
+/****************************************************************************
+ *
+ * Copyright 2017 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/mmap/fs_mmap.c
+ *
+ *   Copyright (C) 2008-2009, 2011-2014 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <stdint.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/ioctl.h>
+
+#include "inode/inode.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mmap
+ *
+ * Description:
+ *   Only a very limited form of mmap() is supported: the file system must
+ *   be able to return the address at which the file already resides in the
+ *   CPU address space through the FIOC_MMAP ioctl.  This is the case for
+ *   romfs images on directly addressable (XIP) media and for tmpfs files.
+ *   No copy of the data is made for romfs, and munmap() has nothing to
+ *   release.  The pointer into romfs stays valid while the image is
+ *   mounted.
+ *
+ *   tmpfs keeps file data in chunks: a file larger than one chunk is made
+ *   contiguous when it is first mapped, by copying it once into a single
+ *   block which then holds its data.  That block needs as much contiguous
+ *   heap as the file.
+ *
+ *   Restrictions:
+ *   - A tmpfs mapping is valid until the file is truncated to zero or
+ *     removed, or grows and is mapped again: the data then moves to a new
+ *     block.  Writes through write() within the mapped size are seen in
+ *     the mapping.
+ *   - MAP_FIXED and MAP_ANONYMOUS are not supported.
+ *   - MAP_PRIVATE with PROT_WRITE is not supported; there is no MMU with
+ *     which to implement copy-on-write.
+ *   - The 'start' argument is only a hint and is ignored.
+ *
+ * Input Parameters:
+ *   start  - A hint at where to map the memory (ignored)
+ *   length - The length of the mapping (must be non-zero)
+ *   prot   - PROT_NONE, or the bitwise OR of PROT_READ, PROT_WRITE and
+ *            PROT_EXEC
+ *   flags  - One of MAP_SHARED or MAP_PRIVATE
+ *   fd     - The file descriptor of the file to be mapped
+ *   offset - The offset into the file at which the mapping starts
+ *
+ * Returned Value:
+ *   On success, mmap() returns a pointer to the mapped area.  On error, the
+ *   value MAP_FAILED is returned, and errno is set appropriately:
+ *
+ *   EBADF
+ *     'fd' is not a valid file descriptor.
+ *   EINVAL
+ *     'length' is zero, 'offset' is negative or 'flags' contains neither
+ *     MAP_PRIVATE nor MAP_SHARED.
+ *   ENODEV
+ *     The underlying file system does not support memory mapping, or
+ *     the file does not reside in directly addressable memory.
+ *   ENOMEM
+ *     There is not enough contiguous memory to make the tmpfs file
+ *     contiguous.  The file is left as it was.
+ *   ENOSYS
+ *     One of the unsupported flag combinations listed above was requested.
+ *
+ ****************************************************************************/
+
+FAR void *mmap(FAR void *start, size_t length, int prot, int flags, int fd, off_t offset)
+{
+	FAR struct file *filep;
+	FAR uint8_t *addr;
+	int ret;
+
+	/* Check the arguments */
+
+	if (length == 0 || offset < 0) {
+		fdbg("ERROR: Invalid length %lu or offset %ld\n", (unsigned long)length, (long)offset);
+		ret = -EINVAL;
+		goto errout;
+	}
+
+	if ((flags & (MAP_PRIVATE | MAP_SHARED)) == 0) {
+		fdbg("ERROR: One of MAP_PRIVATE or MAP_SHARED must be set\n");
+		ret = -EINVAL;
+		goto errout;
+	}
+
+	if ((flags & (MAP_FIXED | MAP_ANONYMOUS)) != 0) {
+		fdbg("ERROR: Unsupported flags: %04x\n", flags);
+		ret = -ENOSYS;
+		goto errout;
+	}
+
+	if ((flags & MAP_PRIVATE) != 0 && (prot & PROT_WRITE) != 0) {
+		fdbg("ERROR: Copy-on-write mappings are not supported\n");
+		ret = -ENOSYS;
+		goto errout;
+	}
+
+	if ((unsigned int)fd >= CONFIG_NFILE_DESCRIPTORS) {
+		ret = -EBADF;
+		goto errout;
+	}
+
+	ret = fs_getfilep(fd, &filep);
+	if (ret < 0) {
+		goto errout;
+	}
+
+	/* Ask the file system where the file lives.  Only file systems that
+	 * can keep the whole file contiguous in the CPU address space implement
+	 * FIOC_MMAP; for everything else the ioctl fails and we report ENODEV.
+	 * A file system without the memory to do it reports ENOMEM.
+	 */
+
+	addr = NULL;
+	ret = file_ioctl(filep, FIOC_MMAP, (unsigned long)((uintptr_t)&addr));
+	if (ret < 0 || addr == NULL) {
+		fvdbg("File cannot be mapped: %d\n", ret);
+		if (ret != -ENOMEM) {
+			ret = -ENODEV;
+		}
+		goto errout;
+	}
+
+	/* Return the offset address */
+
+	return (FAR void *)(addr + offset);
+
+errout:
+	set_errno(-ret);
+	return MAP_FAILED;
+}
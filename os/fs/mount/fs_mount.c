@@ -63,6 +63,7 @@
 #include <debug.h>
 
 #include <tinyara/fs/fs.h>
+#include <tinyara/bootprof.h>
 
 #include "inode/inode.h"
 #include "driver/block/driver.h"
@@ -370,6 +371,7 @@ int mount(FAR const char *source, FAR const char *target, FAR const char *filesy
 	}
 #endif
 
+	bootprof_mark("mount %s", target);
 	return OK;
 
 	/* A lot of goto's!  But they make the error handling much simpler */
@@ -94,8 +94,17 @@
 
 extern const struct procfs_operations proc_operations;
 extern const struct procfs_operations cpuload_operations;
+extern const struct procfs_operations latency_operations;
+extern const struct procfs_operations holdtime_operations;
+extern const struct procfs_operations stackwm_operations;
+extern const struct procfs_operations perf_operations;
+extern const struct procfs_operations bootprof_operations;
+extern const struct procfs_operations netstats_operations;
 extern const struct procfs_operations uptime_operations;
 extern const struct procfs_operations version_operations;
+extern const struct procfs_operations mempool_operations;
+extern const struct procfs_operations bcache_operations;
+extern const struct procfs_operations tmpfs_procfsoperations;
 #if defined(CONFIG_LOG_DUMP)
 extern const struct procfs_operations logsave_operations;
 #endif
@@ -132,10 +141,43 @@ static const struct procfs_entry_s g_procfsentries[] = {
 	{"cpuload", &cpuload_operations},
 #endif
 
+#if defined(CONFIG_SCHED_LATENCY) && !defined(CONFIG_FS_PROCFS_EXCLUDE_LATENCY)
+	{"latency", &latency_operations},
+#endif
+
+#if defined(CONFIG_SCHED_HOLDTIME) && !defined(CONFIG_FS_PROCFS_EXCLUDE_HOLDTIME)
+	{"holdtime", &holdtime_operations},
+#endif
+
+#if defined(CONFIG_STACK_WATERMARK) && !defined(CONFIG_FS_PROCFS_EXCLUDE_STACKWM)
+	{"stackwm", &stackwm_operations},
+#endif
+
+#if defined(CONFIG_PERF_METRICS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_PERF)
+	{"perf**", &perf_operations},
+	{"perf/*", &perf_operations},
+#endif
+
+#if defined(CONFIG_BOOT_PROFILE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_BOOTPROF)
+	{"bootprof", &bootprof_operations},
+#endif
+
+#if defined(CONFIG_NET_STATS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_NETSTATS)
+	{"netstats", &netstats_operations},
+#endif
+
 #if defined(CONFIG_LOG_DUMP)
 	{"logsave", &logsave_operations},
 #endif
 
+#if defined(CONFIG_FS_BCACHE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_BCACHE)
+	{"bcache", &bcache_operations},
+#endif
+
+#if defined(CONFIG_FS_TMPFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_TMPFS)
+	{"tmpfs", &tmpfs_procfsoperations},
+#endif
+
 #if defined(CONFIG_FS_SMARTFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
 	{"fs/smartfs**", &smartfs_procfsoperations},
 #endif
@@ -144,6 +186,10 @@ static const struct procfs_entry_s g_procfsentries[] = {
 	{"irqs", &irqs_operations},
 #endif
 
+#if !defined(CONFIG_FS_PROCFS_EXCLUDE_MEMPOOL)
+	{"mempool", &mempool_operations},
+#endif
+
 #if defined(CONFIG_MTD) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MTD)
 	{"mtd", &mtd_procfsoperations},
 #endif
@@ -0,0 +1,308 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+#include <tinyara/fs/bcache.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_FS_BCACHE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_BCACHE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic.
+ */
+
+#define BCACHE_LINELEN 80
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct bcacheinfo_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	char line[BCACHE_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/* State of one read() while walking the cached devices */
+
+struct bcacheinfo_read_s {
+	FAR struct bcacheinfo_file_s *attr;
+	FAR char *buffer;			/* User buffer */
+	size_t buflen;				/* Size of the user buffer */
+	size_t totalsize;			/* Number of bytes copied to the user buffer */
+	off_t offset;				/* Number of bytes left to skip */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int bcacheinfo_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int bcacheinfo_close(FAR struct file *filep);
+static ssize_t bcacheinfo_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+
+static int bcacheinfo_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int bcacheinfo_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations bcache_operations = {
+	bcacheinfo_open,			/* open */
+	bcacheinfo_close,			/* close */
+	bcacheinfo_read,			/* read */
+	NULL,						/* write */
+
+	bcacheinfo_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	bcacheinfo_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bcacheinfo_copyline
+ ****************************************************************************/
+
+static void bcacheinfo_copyline(FAR struct bcacheinfo_read_s *info, size_t linesize)
+{
+	size_t copysize;
+
+	if (info->totalsize >= info->buflen) {
+		return;
+	}
+
+	copysize = procfs_memcpy(info->attr->line, linesize, info->buffer + info->totalsize, info->buflen - info->totalsize, &info->offset);
+	info->totalsize += copysize;
+}
+
+/****************************************************************************
+ * Name: bcacheinfo_readdev
+ ****************************************************************************/
+
+static void bcacheinfo_readdev(FAR struct inode *inode, FAR const struct bcache_stats_s *stats, FAR void *arg)
+{
+	FAR struct bcacheinfo_read_s *info = (FAR struct bcacheinfo_read_s *)arg;
+	uint32_t reads = stats->hits + stats->misses;
+	size_t linesize;
+
+	linesize = snprintf(info->attr->line, BCACHE_LINELEN, "%-10.10s %8lu %8lu %3u%% %8lu %8lu %8lu\n", inode->i_name, (unsigned long)stats->hits, (unsigned long)stats->misses, reads ? (unsigned int)((uint64_t)stats->hits * 100 / reads) : 0, (unsigned long)stats->rahits, (unsigned long)stats->writes, (unsigned long)stats->writebacks);
+	bcacheinfo_copyline(info, linesize);
+}
+
+/****************************************************************************
+ * Name: bcacheinfo_open
+ ****************************************************************************/
+
+static int bcacheinfo_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct bcacheinfo_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only.  Any attempt to open with any kind of write
+	 * access is not permitted.
+	 */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	/* "bcache" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "bcache") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct bcacheinfo_file_s *)kmm_zalloc(sizeof(struct bcacheinfo_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: bcacheinfo_close
+ ****************************************************************************/
+
+static int bcacheinfo_close(FAR struct file *filep)
+{
+	FAR struct bcacheinfo_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct bcacheinfo_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: bcacheinfo_read
+ ****************************************************************************/
+
+static ssize_t bcacheinfo_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	struct bcacheinfo_read_s info;
+	size_t linesize;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	info.attr = (FAR struct bcacheinfo_file_s *)filep->f_priv;
+	DEBUGASSERT(info.attr);
+
+	info.buffer = buffer;
+	info.buflen = buflen;
+	info.totalsize = 0;
+	info.offset = filep->f_pos;
+
+	/* One line per cached block driver below a header.  The counters are
+	 * sampled again on each read(), so a reader using small buffers may see
+	 * them change.
+	 */
+
+	linesize = snprintf(info.attr->line, BCACHE_LINELEN, "%-10s %8s %8s %4s %8s %8s %8s\n", "Device", "Hits", "Misses", "Rate", "RAHits", "Writes", "WBacks");
+	bcacheinfo_copyline(&info, linesize);
+
+	bcache_foreach(bcacheinfo_readdev, &info);
+
+	/* Update the file offset */
+
+	filep->f_pos += info.totalsize;
+	return info.totalsize;
+}
+
+/****************************************************************************
+ * Name: bcacheinfo_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int bcacheinfo_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct bcacheinfo_file_s *oldattr;
+	FAR struct bcacheinfo_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct bcacheinfo_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct bcacheinfo_file_s *)kmm_malloc(sizeof(struct bcacheinfo_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct bcacheinfo_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: bcacheinfo_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int bcacheinfo_stat(const char *relpath, struct stat *buf)
+{
+	/* "bcache" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "bcache") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "bcache" is the name for a read-only file */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_FS_PROCFS_EXCLUDE_BCACHE */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -0,0 +1,294 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/clock.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/bootprof.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_BOOT_PROFILE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_BOOTPROF)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic: the time, the time
+ * from the previous mark, the system time and the name.
+ */
+
+#define BOOTPROF_LINELEN (64 + BOOTPROF_NAMELEN)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct bootprof_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	char line[BOOTPROF_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int bootprof_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int bootprof_close(FAR struct file *filep);
+static ssize_t bootprof_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+
+static int bootprof_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int bootprof_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations bootprof_operations = {
+	bootprof_open,				/* open */
+	bootprof_close,				/* close */
+	bootprof_read,				/* read */
+	NULL,						/* write */
+
+	bootprof_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	bootprof_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bootprof_open
+ ****************************************************************************/
+
+static int bootprof_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct bootprof_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only.  Any attempt to open with any kind of write
+	 * access is not permitted.
+	 */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	/* "bootprof" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "bootprof") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct bootprof_file_s *)kmm_zalloc(sizeof(struct bootprof_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: bootprof_close
+ ****************************************************************************/
+
+static int bootprof_close(FAR struct file *filep)
+{
+	FAR struct bootprof_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct bootprof_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: bootprof_read
+ *
+ * Description:
+ *   One line per mark:
+ *
+ *     <usec> <usec from the previous mark> <system msec> <name>
+ *
+ *   The times are in cycles when the frequency of the counter is unknown.
+ *   Marks are only added, so lines already read stay the same.
+ *
+ ****************************************************************************/
+
+static ssize_t bootprof_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct bootprof_file_s *attr;
+	struct bootprof_mark_s mark;
+	uint64_t prev = 0;
+	uint64_t time;
+	uint64_t delta;
+	uint32_t freq;
+	size_t totalsize = 0;
+	size_t linesize;
+	off_t offset;
+	int i;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct bootprof_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	offset = filep->f_pos;
+	freq = up_perf_getfreq();
+
+	for (i = 0; totalsize < buflen && bootprof_get(i, &mark) == OK; i++) {
+		time = mark.cycles;
+		delta = mark.cycles - prev;
+		prev = mark.cycles;
+		if (freq != 0) {
+			time = time * USEC_PER_SEC / freq;
+			delta = delta * USEC_PER_SEC / freq;
+		}
+
+		linesize = snprintf(attr->line, BOOTPROF_LINELEN, "%10llu %10llu %8lu %s\n", (unsigned long long)time, (unsigned long long)delta, (unsigned long)TICK2MSEC(mark.ticks), mark.name);
+
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+	}
+
+	/* Update the file offset */
+
+	filep->f_pos += totalsize;
+	return totalsize;
+}
+
+/****************************************************************************
+ * Name: bootprof_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int bootprof_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct bootprof_file_s *oldattr;
+	FAR struct bootprof_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct bootprof_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct bootprof_file_s *)kmm_malloc(sizeof(struct bootprof_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct bootprof_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: bootprof_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int bootprof_stat(const char *relpath, struct stat *buf)
+{
+	/* "bootprof" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "bootprof") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "bootprof" is the name for a file, not a directory */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#endif							/* CONFIG_BOOT_PROFILE && !CONFIG_FS_PROCFS_EXCLUDE_BOOTPROF */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
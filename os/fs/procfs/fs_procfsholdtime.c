@@ -0,0 +1,333 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/sched.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_SCHED_HOLDTIME) && !defined(CONFIG_FS_PROCFS_EXCLUDE_HOLDTIME)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define HOLDTIME_LINELEN 80
+
+#define HOLDTIME_TITLE_FMT "%s, in cycles at %u Hz, %u holds of evicted sites\n"
+#define HOLDTIME_HEAD_FMT  " %10s | %10s | %10s | %7s | %10s\n"
+#define HOLDTIME_HEAD      "CALLER", "COUNT", "MAX", "MAX_PID", "AVG"
+#define HOLDTIME_LINE      " -----------|------------|------------|---------|-----------\n"
+#define HOLDTIME_SITE_FMT  " %10p | %10u | %10u | %7d | %10u\n"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The sites of one type of hold, as sampled at open() */
+
+struct holdtime_type_s {
+	int nsites;
+	uint32_t evicted;
+	struct sched_holdsite_s sites[CONFIG_SCHED_HOLDTIME_NSITES];
+};
+
+/* This structure describes one open "file" */
+
+struct holdtime_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	struct holdtime_type_s types[SCHED_HOLDTIME_NTYPES];
+	char line[HOLDTIME_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int holdtime_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int holdtime_close(FAR struct file *filep);
+static ssize_t holdtime_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t holdtime_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+
+static int holdtime_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int holdtime_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *const g_holdtime_names[SCHED_HOLDTIME_NTYPES] = {
+	"Critical sections",		/* SCHED_HOLDTIME_CSECTION */
+	"Scheduler locks"			/* SCHED_HOLDTIME_SCHEDLOCK */
+};
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations holdtime_operations = {
+	holdtime_open,				/* open */
+	holdtime_close,				/* close */
+	holdtime_read,				/* read */
+	holdtime_write,				/* write */
+
+	holdtime_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	holdtime_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: holdtime_open
+ ****************************************************************************/
+
+static int holdtime_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct holdtime_file_s *attr;
+	FAR struct holdtime_type_s *type;
+	int ndx;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* "holdtime" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "holdtime") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct holdtime_file_s *)kmm_zalloc(sizeof(struct holdtime_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Sample the sites now, so that successive reads with small buffers
+	 * see the same data.
+	 */
+
+	if ((oflags & O_RDONLY) != 0) {
+		for (ndx = 0; ndx < SCHED_HOLDTIME_NTYPES; ndx++) {
+			type = &attr->types[ndx];
+			type->nsites = sched_holdtime_get(ndx, type->sites, CONFIG_SCHED_HOLDTIME_NSITES, &type->evicted);
+		}
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: holdtime_close
+ ****************************************************************************/
+
+static int holdtime_close(FAR struct file *filep)
+{
+	FAR struct holdtime_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct holdtime_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: holdtime_read
+ *
+ * Description:
+ *   For the critical sections, then the scheduler locks, a title and one
+ *   line per call site, the longest hold first.
+ *
+ ****************************************************************************/
+
+static ssize_t holdtime_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct holdtime_file_s *attr;
+	FAR struct holdtime_type_s *type;
+	FAR struct sched_holdsite_s *site;
+	size_t totalsize = 0;
+	size_t linesize;
+	off_t offset;
+	int ndx;
+	int i;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct holdtime_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	offset = filep->f_pos;
+
+	for (ndx = 0; ndx < SCHED_HOLDTIME_NTYPES && totalsize < buflen; ndx++) {
+		type = &attr->types[ndx];
+
+		linesize = snprintf(attr->line, HOLDTIME_LINELEN, HOLDTIME_TITLE_FMT, g_holdtime_names[ndx], up_perf_getfreq(), type->evicted);
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+
+		linesize = snprintf(attr->line, HOLDTIME_LINELEN, HOLDTIME_HEAD_FMT, HOLDTIME_HEAD);
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+
+		linesize = snprintf(attr->line, HOLDTIME_LINELEN, HOLDTIME_LINE);
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+
+		for (i = 0; i < type->nsites && totalsize < buflen; i++) {
+			site = &type->sites[i];
+			linesize = snprintf(attr->line, HOLDTIME_LINELEN, HOLDTIME_SITE_FMT, site->caller, site->count, site->max, site->maxpid, (uint32_t)(site->total / site->count));
+			totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+		}
+
+		linesize = snprintf(attr->line, HOLDTIME_LINELEN, "\n");
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+	}
+
+	/* Update the file offset */
+
+	filep->f_pos += totalsize;
+	return totalsize;
+}
+
+/****************************************************************************
+ * Name: holdtime_write
+ *
+ * Description:
+ *   Writing anything forgets all the call sites.
+ *
+ ****************************************************************************/
+
+static ssize_t holdtime_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	sched_holdtime_clear();
+	return buflen;
+}
+
+/****************************************************************************
+ * Name: holdtime_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int holdtime_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct holdtime_file_s *oldattr;
+	FAR struct holdtime_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct holdtime_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct holdtime_file_s *)kmm_malloc(sizeof(struct holdtime_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct holdtime_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: holdtime_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int holdtime_stat(const char *relpath, struct stat *buf)
+{
+	/* "holdtime" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "holdtime") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "holdtime" is a file, read for the sites, written to reset them */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR | S_IWUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#endif							/* CONFIG_SCHED_HOLDTIME && !CONFIG_FS_PROCFS_EXCLUDE_HOLDTIME */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
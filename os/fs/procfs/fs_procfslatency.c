@@ -0,0 +1,339 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/sched.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_SCHED_LATENCY) && !defined(CONFIG_FS_PROCFS_EXCLUDE_LATENCY)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic: the pid, the count,
+ * the total, the max, the buckets and the name.
+ */
+
+#if CONFIG_TASK_NAME_SIZE > 0
+#define LATENCY_NAMELEN (CONFIG_TASK_NAME_SIZE + 1)
+#else
+#define LATENCY_NAMELEN 1
+#endif
+
+#define LATENCY_LINELEN (48 + 11 * SCHED_LATENCY_NBUCKETS + LATENCY_NAMELEN)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The histogram of one thread, as sampled at open() */
+
+struct latency_entry_s {
+	pid_t pid;
+	struct sched_latency_s latency;
+	char name[LATENCY_NAMELEN];
+};
+
+/* This structure describes one open "file" */
+
+struct latency_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	int nentries;				/* Number of valid entries[] */
+	struct latency_entry_s entries[CONFIG_MAX_TASKS];
+	char line[LATENCY_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int latency_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int latency_close(FAR struct file *filep);
+static ssize_t latency_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t latency_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+
+static int latency_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int latency_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations latency_operations = {
+	latency_open,				/* open */
+	latency_close,				/* close */
+	latency_read,				/* read */
+	latency_write,				/* write */
+
+	latency_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	latency_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: latency_snapshot
+ *
+ * Description:
+ *   sched_foreach() callback copying the histogram of one thread.  It runs
+ *   with interrupts disabled, so the lines are formatted later.
+ *
+ ****************************************************************************/
+
+static void latency_snapshot(FAR struct tcb_s *tcb, FAR void *arg)
+{
+	FAR struct latency_file_s *attr = (FAR struct latency_file_s *)arg;
+	FAR struct latency_entry_s *entry;
+
+	if (attr->nentries >= CONFIG_MAX_TASKS) {
+		return;
+	}
+
+	entry = &attr->entries[attr->nentries++];
+	entry->pid = tcb->pid;
+	memcpy(&entry->latency, &tcb->latency, sizeof(struct sched_latency_s));
+#if CONFIG_TASK_NAME_SIZE > 0
+	strncpy(entry->name, tcb->name, LATENCY_NAMELEN - 1);
+#endif
+}
+
+/****************************************************************************
+ * Name: latency_open
+ ****************************************************************************/
+
+static int latency_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct latency_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* "latency" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "latency") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct latency_file_s *)kmm_zalloc(sizeof(struct latency_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Sample all the histograms now, so that successive reads with small
+	 * buffers see the same data.
+	 */
+
+	if ((oflags & O_RDONLY) != 0) {
+		sched_foreach(latency_snapshot, attr);
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: latency_close
+ ****************************************************************************/
+
+static int latency_close(FAR struct file *filep)
+{
+	FAR struct latency_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct latency_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: latency_read
+ *
+ * Description:
+ *   One line per thread:
+ *
+ *     <pid> <count> <total usec> <max usec> <bucket 0> ... <bucket N-1> <name>
+ *
+ ****************************************************************************/
+
+static ssize_t latency_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct latency_file_s *attr;
+	FAR struct latency_entry_s *entry;
+	size_t totalsize = 0;
+	size_t linesize;
+	off_t offset;
+	int ndx;
+	int i;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct latency_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	offset = filep->f_pos;
+
+	for (i = 0; i < attr->nentries && totalsize < buflen; i++) {
+		entry = &attr->entries[i];
+
+		linesize = snprintf(attr->line, LATENCY_LINELEN, "%d %u %llu %u", entry->pid, entry->latency.count, (unsigned long long)entry->latency.total, entry->latency.max);
+		for (ndx = 0; ndx < SCHED_LATENCY_NBUCKETS; ndx++) {
+			linesize += snprintf(attr->line + linesize, LATENCY_LINELEN - linesize, " %u", entry->latency.bucket[ndx]);
+		}
+		linesize += snprintf(attr->line + linesize, LATENCY_LINELEN - linesize, " %s\n", entry->name);
+
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+	}
+
+	/* Update the file offset */
+
+	filep->f_pos += totalsize;
+	return totalsize;
+}
+
+/****************************************************************************
+ * Name: latency_write
+ *
+ * Description:
+ *   Writing anything resets the histograms of all the threads.
+ *
+ ****************************************************************************/
+
+static ssize_t latency_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	sched_latency_clear();
+	return buflen;
+}
+
+/****************************************************************************
+ * Name: latency_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int latency_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct latency_file_s *oldattr;
+	FAR struct latency_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct latency_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct latency_file_s *)kmm_malloc(sizeof(struct latency_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct latency_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: latency_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int latency_stat(const char *relpath, struct stat *buf)
+{
+	/* "latency" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "latency") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "latency" is a file, read for the histograms, written to reset them */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR | S_IWUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#endif							/* CONFIG_SCHED_LATENCY && !CONFIG_FS_PROCFS_EXCLUDE_LATENCY */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -0,0 +1,387 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+#include <tinyara/netmgr/netstats.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_NET_STATS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_NETSTATS)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic: a TCP connection.
+ */
+
+#define NETSTATS_LINELEN 160
+
+/* Lines before the devices: link, app, drop and the histogram bounds */
+
+#define NETSTATS_NHEADER 4
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct netstats_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	struct netstats st;			/* The statistics, as sampled at open() */
+	char line[NETSTATS_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int netstats_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int netstats_close(FAR struct file *filep);
+static ssize_t netstats_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t netstats_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+
+static int netstats_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int netstats_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const uint16_t g_netstats_bounds[NETSTATS_NBINS - 1] = NETSTATS_HIST_BOUNDS;
+
+/* In the order of enum tcp_state */
+
+static const char *const g_tcp_state[] = {
+	"CLOSED", "LISTEN", "SYN_SENT", "SYN_RCVD", "ESTABLISHED", "FIN_WAIT_1",
+	"FIN_WAIT_2", "CLOSE_WAIT", "CLOSING", "LAST_ACK", "TIME_WAIT"
+};
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations netstats_operations = {
+	netstats_open,				/* open */
+	netstats_close,				/* close */
+	netstats_read,				/* read */
+	netstats_write,				/* write */
+
+	netstats_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	netstats_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netstats_line
+ *
+ * Description:
+ *   Format the line 'ndx' of the file in attr->line and return its length,
+ *   0 past the last line.
+ *
+ ****************************************************************************/
+
+static size_t netstats_line(FAR struct netstats_file_s *attr, int ndx)
+{
+	FAR struct netstats *st = &attr->st;
+	FAR struct netstats_dev *dev;
+	FAR struct netstats_tcp *tcp;
+	FAR uint32_t *hist;
+	FAR uint8_t *lip;
+	FAR uint8_t *rip;
+	size_t linesize;
+	int i;
+
+	switch (ndx) {
+	case 0:
+		return snprintf(attr->line, NETSTATS_LINELEN, "link %u %u\n", st->link_recv_byte, st->link_recv_cnt);
+	case 1:
+		return snprintf(attr->line, NETSTATS_LINELEN, "app %u %u\n", st->app_recv_byte, st->app_recv_cnt);
+	case 2:
+		return snprintf(attr->line, NETSTATS_LINELEN, "drop pbuf %u mbox %u ooseq %u\n", st->drop_pbuf, st->drop_mbox, st->drop_ooseq);
+	case 3:
+		linesize = snprintf(attr->line, NETSTATS_LINELEN, "bins");
+		for (i = 0; i < NETSTATS_NBINS - 1; i++) {
+			linesize += snprintf(attr->line + linesize, NETSTATS_LINELEN - linesize, " <=%u", g_netstats_bounds[i]);
+		}
+		linesize += snprintf(attr->line + linesize, NETSTATS_LINELEN - linesize, " >%u\n", g_netstats_bounds[NETSTATS_NBINS - 2]);
+		return linesize;
+	default:
+		break;
+	}
+
+	/* Two lines per device, rx then tx */
+
+	ndx -= NETSTATS_NHEADER;
+	if (ndx < 2 * st->ndev) {
+		dev = &st->dev[ndx / 2];
+		hist = (ndx & 1) ? dev->tx : dev->rx;
+		linesize = snprintf(attr->line, NETSTATS_LINELEN, "%.*s %s", IFNAMSIZ, dev->ifname, (ndx & 1) ? "tx" : "rx");
+		for (i = 0; i < NETSTATS_NBINS; i++) {
+			linesize += snprintf(attr->line + linesize, NETSTATS_LINELEN - linesize, " %u", hist[i]);
+		}
+		linesize += snprintf(attr->line + linesize, NETSTATS_LINELEN - linesize, "\n");
+		return linesize;
+	}
+
+	ndx -= 2 * st->ndev;
+	if (ndx < st->ntcp) {
+		tcp = &st->tcp[ndx];
+		lip = (FAR uint8_t *)&tcp->local_ip;
+		rip = (FAR uint8_t *)&tcp->remote_ip;
+		return snprintf(attr->line, NETSTATS_LINELEN,
+						"tcp %u.%u.%u.%u:%u %u.%u.%u.%u:%u %s srtt %u rto %u cwnd %u ssthresh %u nrtx %u sndq %u\n",
+						lip[0], lip[1], lip[2], lip[3], tcp->local_port,
+						rip[0], rip[1], rip[2], rip[3], tcp->remote_port,
+						tcp->state < sizeof(g_tcp_state) / sizeof(g_tcp_state[0]) ? g_tcp_state[tcp->state] : "UNKNOWN",
+						tcp->srtt, tcp->rto, tcp->cwnd, tcp->ssthresh, tcp->nrtx, tcp->snd_queuelen);
+	}
+
+	return 0;
+}
+
+/****************************************************************************
+ * Name: netstats_open
+ ****************************************************************************/
+
+static int netstats_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct netstats_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* "netstats" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "netstats") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct netstats_file_s *)kmm_zalloc(sizeof(struct netstats_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Sample the statistics now, so that successive reads with small
+	 * buffers see the same data.
+	 */
+
+	if ((oflags & O_RDONLY) != 0 && netstats_get(&attr->st) < 0) {
+		fdbg("ERROR: Failed to get the statistics\n");
+		kmm_free(attr);
+		return -EIO;
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: netstats_close
+ ****************************************************************************/
+
+static int netstats_close(FAR struct file *filep)
+{
+	FAR struct netstats_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct netstats_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: netstats_read
+ *
+ * Description:
+ *   The counters of the network manager, then for each device the sizes of
+ *   the received and sent packets in the bins of the "bins" line, then one
+ *   line per TCP connection with the smoothed RTT and the RTO in ms:
+ *
+ *     link <bytes> <packets>
+ *     app <bytes> <packets>
+ *     drop pbuf <count> mbox <count> ooseq <count>
+ *     bins <=64 ... >1518
+ *     <ifname> rx <bin 0> ... <bin N-1>
+ *     <ifname> tx <bin 0> ... <bin N-1>
+ *     tcp <local> <remote> <state> srtt <ms> rto <ms> cwnd <bytes> ssthresh <bytes> nrtx <count> sndq <pbufs>
+ *
+ ****************************************************************************/
+
+static ssize_t netstats_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct netstats_file_s *attr;
+	size_t totalsize = 0;
+	size_t linesize;
+	off_t offset;
+	int ndx;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct netstats_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	offset = filep->f_pos;
+
+	for (ndx = 0; totalsize < buflen; ndx++) {
+		linesize = netstats_line(attr, ndx);
+		if (linesize == 0) {
+			break;
+		}
+
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+	}
+
+	/* Update the file offset */
+
+	filep->f_pos += totalsize;
+	return totalsize;
+}
+
+/****************************************************************************
+ * Name: netstats_write
+ *
+ * Description:
+ *   Writing anything resets the counters and the histograms.
+ *
+ ****************************************************************************/
+
+static ssize_t netstats_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	netstats_clear();
+	return buflen;
+}
+
+/****************************************************************************
+ * Name: netstats_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int netstats_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct netstats_file_s *oldattr;
+	FAR struct netstats_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct netstats_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct netstats_file_s *)kmm_malloc(sizeof(struct netstats_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct netstats_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: netstats_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int netstats_stat(const char *relpath, struct stat *buf)
+{
+	/* "netstats" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "netstats") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "netstats" is a file, read for the statistics, written to reset them */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR | S_IWUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#endif							/* CONFIG_NET_STATS && !CONFIG_FS_PROCFS_EXCLUDE_NETSTATS */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -0,0 +1,555 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/sched.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+#include <tinyara/fs/dirent.h>
+#include <tinyara/perf.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_PERF_METRICS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_PERF)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define PERF_LINELEN       (CONFIG_TASK_NAME_SIZE + 96)
+#define PERF_DIRNAME       "perf"
+
+/* The name of a task comes last, as it may have spaces */
+
+#define PERF_METRIC_FMT    "%-31s %-9s %lld"
+#define PERF_TASK_HEAD_FMT "%5s %20s %12s %12s %s\n"
+#define PERF_TASK_FMT      "%5d %20llu %12llu %12llu %s\n"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum perf_node_e {
+	PERF_LEVEL0 = 0,			/* The top-level directory */
+	PERF_METRICS,				/* The registered metrics */
+	PERF_TASKS					/* The counts of the threads */
+};
+
+struct perf_node_s {
+	FAR const char *relpath;	/* Relative path to the node */
+	FAR const char *name;		/* Terminal node segment name */
+	uint8_t nodetype;			/* Type of node (see enum perf_node_e) */
+	uint8_t dtype;				/* dirent type (see include/dirent.h) */
+};
+
+struct perf_dir_s {
+	struct procfs_dir_priv_s base;	/* Base directory private data */
+	FAR const struct perf_node_s *node;	/* Directory node description */
+};
+
+/* This structure describes one open "file".  The metrics or the threads
+ * are copied at open, so that successive reads with small buffers see the
+ * same data.
+ */
+
+struct perf_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	FAR const struct perf_node_s *node;	/* Describes the file node */
+	int nvalues;
+	FAR struct perf_value_s *values;
+	struct perf_tasks_s tasks;
+	char line[PERF_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int perf_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int perf_close(FAR struct file *filep);
+static ssize_t perf_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static int perf_opendir(FAR const char *relpath, FAR struct fs_dirent_s *dir);
+static int perf_closedir(FAR struct fs_dirent_s *dir);
+static int perf_readdir(FAR struct fs_dirent_s *dir);
+static int perf_rewinddir(FAR struct fs_dirent_s *dir);
+static int perf_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations perf_operations = {
+	perf_open,					/* open */
+	perf_close,					/* close */
+	perf_read,					/* read */
+	NULL,						/* write */
+
+	NULL,						/* dup */
+
+	perf_opendir,				/* opendir */
+	perf_closedir,				/* closedir */
+	perf_readdir,				/* readdir */
+	perf_rewinddir,				/* rewinddir */
+
+	perf_stat					/* stat */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* These structures provide information about every node */
+
+static const struct perf_node_s g_perf_level0 = {
+	"", "perf", (uint8_t)PERF_LEVEL0, DTYPE_DIRECTORY
+};
+
+static const struct perf_node_s g_perf_metrics = {
+	"metrics", "metrics", (uint8_t)PERF_METRICS, DTYPE_FILE
+};
+
+static const struct perf_node_s g_perf_tasks = {
+	"tasks", "tasks", (uint8_t)PERF_TASKS, DTYPE_FILE
+};
+
+/* This is the list of all nodes */
+
+static FAR const struct perf_node_s *const g_perf_nodeinfo[] = {
+	&g_perf_level0,
+	&g_perf_metrics,
+	&g_perf_tasks
+};
+
+#define PERF_NNODES (sizeof(g_perf_nodeinfo) / sizeof(FAR const struct perf_node_s *const))
+
+static FAR const struct perf_node_s *const g_perf_level0info[] = {
+	&g_perf_metrics,
+	&g_perf_tasks
+};
+
+#define PERF_NLEVEL0NODES (sizeof(g_perf_level0info) / sizeof(FAR const struct perf_node_s *const))
+
+static FAR const char *const g_perf_typename[] = {
+	"counter",
+	"gauge",
+	"histogram"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: perf_findnode
+ ****************************************************************************/
+
+static FAR const struct perf_node_s *perf_findnode(FAR const char *relpath)
+{
+	int i;
+
+	/* "perf" is the directory, "perf/<node>" one of its files */
+
+	if (strncmp(relpath, PERF_DIRNAME, strlen(PERF_DIRNAME)) != 0) {
+		fdbg("ERROR: Bad relpath: %s\n", relpath);
+		return NULL;
+	}
+
+	relpath += strlen(PERF_DIRNAME);
+	if (relpath[0] == '/') {
+		relpath++;
+	}
+
+	for (i = 0; i < PERF_NNODES; i++) {
+		if (strcmp(g_perf_nodeinfo[i]->relpath, relpath) == 0) {
+			return g_perf_nodeinfo[i];
+		}
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: perf_metrics_read
+ *
+ * Description:
+ *   One line per metric: its name, type and value, then for a histogram
+ *   the number of samples and the count of each bucket, by upper bound.
+ *   The value of a histogram is the sum of its samples.
+ *
+ ****************************************************************************/
+
+static size_t perf_metrics_read(FAR struct perf_file_s *attr, FAR char *buffer, size_t buflen, off_t offset)
+{
+	FAR struct perf_value_s *value;
+	size_t totalsize = 0;
+	size_t linesize;
+	int i;
+	int j;
+
+	for (i = 0; i < attr->nvalues && totalsize < buflen; i++) {
+		value = &attr->values[i];
+		linesize = snprintf(attr->line, PERF_LINELEN, PERF_METRIC_FMT, value->name, g_perf_typename[value->type], (long long)value->value);
+		if (value->type == PERF_TYPE_HISTOGRAM) {
+			linesize += snprintf(attr->line + linesize, PERF_LINELEN - linesize, " %u", (unsigned int)value->count);
+		}
+
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+
+		/* A bucket at a time, as the histograms may not fit in a line */
+
+		for (j = 0; j < value->nbuckets; j++) {
+			if (j < value->nbuckets - 1) {
+				linesize = snprintf(attr->line, PERF_LINELEN, " <=%u:%u", (unsigned int)value->bounds[j], (unsigned int)value->buckets[j]);
+			} else if (j > 0) {
+				linesize = snprintf(attr->line, PERF_LINELEN, " >%u:%u", (unsigned int)value->bounds[j - 1], (unsigned int)value->buckets[j]);
+			} else {
+				linesize = snprintf(attr->line, PERF_LINELEN, " all:%u", (unsigned int)value->buckets[j]);
+			}
+
+			totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+		}
+
+		totalsize += procfs_memcpy("\n", 1, buffer + totalsize, buflen - totalsize, &offset);
+	}
+
+	return totalsize;
+}
+
+/****************************************************************************
+ * Name: perf_tasks_read
+ *
+ * Description:
+ *   A heading with the names of the hardware events, then one line per
+ *   thread: its PID, cycles, events and name.
+ *
+ ****************************************************************************/
+
+static size_t perf_tasks_read(FAR struct perf_file_s *attr, FAR char *buffer, size_t buflen, off_t offset)
+{
+	FAR struct perf_tasks_s *tasks = &attr->tasks;
+	FAR struct perf_task_s *task;
+	size_t totalsize = 0;
+	size_t linesize;
+	int i;
+
+	linesize = snprintf(attr->line, PERF_LINELEN, PERF_TASK_HEAD_FMT, "PID", "CYCLES", tasks->event[0][0] != '\0' ? tasks->event[0] : "-", tasks->event[1][0] != '\0' ? tasks->event[1] : "-", "NAME");
+	totalsize += procfs_memcpy(attr->line, linesize, buffer, buflen, &offset);
+
+	for (i = 0; i < tasks->ntasks && totalsize < buflen; i++) {
+		task = &tasks->tasks[i];
+#if CONFIG_TASK_NAME_SIZE > 0
+		linesize = snprintf(attr->line, PERF_LINELEN, PERF_TASK_FMT, task->pid, (unsigned long long)task->cycles, (unsigned long long)task->events[0], (unsigned long long)task->events[1], task->name);
+#else
+		linesize = snprintf(attr->line, PERF_LINELEN, PERF_TASK_FMT, task->pid, (unsigned long long)task->cycles, (unsigned long long)task->events[0], (unsigned long long)task->events[1], "<noname>");
+#endif
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+	}
+
+	return totalsize;
+}
+
+/****************************************************************************
+ * Name: perf_open
+ ****************************************************************************/
+
+static int perf_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct perf_file_s *attr;
+	FAR const struct perf_node_s *node;
+	int nvalues;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only.  Any attempt to open with any kind of write
+	 * access is not permitted.
+	 */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	node = perf_findnode(relpath);
+	if (!node) {
+		fdbg("ERROR: Invalid path \"%s\"\n", relpath);
+		return -ENOENT;
+	}
+
+	if (!DIRENT_ISFILE(node->dtype)) {
+		fdbg("ERROR: Path \"%s\" is not a regular file\n", relpath);
+		return -EISDIR;
+	}
+
+	attr = (FAR struct perf_file_s *)kmm_zalloc(sizeof(struct perf_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file container\n");
+		return -ENOMEM;
+	}
+
+	attr->node = node;
+
+	if (node->nodetype == PERF_METRICS) {
+		nvalues = perf_snapshot(NULL, 0);
+		if (nvalues > 0) {
+			attr->values = (FAR struct perf_value_s *)kmm_malloc(nvalues * sizeof(struct perf_value_s));
+			if (!attr->values) {
+				kmm_free(attr);
+				return -ENOMEM;
+			}
+
+			attr->nvalues = perf_snapshot(attr->values, nvalues);
+		}
+	} else {
+		attr->tasks.tasks = (FAR struct perf_task_s *)kmm_malloc(CONFIG_MAX_TASKS * sizeof(struct perf_task_s));
+		if (!attr->tasks.tasks) {
+			kmm_free(attr);
+			return -ENOMEM;
+		}
+
+		attr->tasks.ntasks = CONFIG_MAX_TASKS;
+		attr->tasks.ntasks = perf_get_tasks(&attr->tasks);
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: perf_close
+ ****************************************************************************/
+
+static int perf_close(FAR struct file *filep)
+{
+	FAR struct perf_file_s *attr;
+
+	attr = (FAR struct perf_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	if (attr->values) {
+		kmm_free(attr->values);
+	}
+
+	if (attr->tasks.tasks) {
+		kmm_free(attr->tasks.tasks);
+	}
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: perf_read
+ ****************************************************************************/
+
+static ssize_t perf_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct perf_file_s *attr;
+	ssize_t ret;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	attr = (FAR struct perf_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	switch (attr->node->nodetype) {
+	case PERF_METRICS:
+		ret = perf_metrics_read(attr, buffer, buflen, filep->f_pos);
+		break;
+	case PERF_TASKS:
+		ret = perf_tasks_read(attr, buffer, buflen, filep->f_pos);
+		break;
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	/* Update the file offset */
+
+	if (ret > 0) {
+		filep->f_pos += ret;
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: perf_opendir
+ *
+ * Description:
+ *   Open a directory for read access
+ *
+ ****************************************************************************/
+
+static int perf_opendir(FAR const char *relpath, FAR struct fs_dirent_s *dir)
+{
+	FAR struct perf_dir_s *perf_dir;
+	FAR const struct perf_node_s *node;
+
+	fvdbg("relpath: \"%s\"\n", relpath ? relpath : "NULL");
+	DEBUGASSERT(relpath && dir && !dir->u.procfs);
+
+	node = perf_findnode(relpath);
+	if (!node) {
+		fdbg("ERROR: Invalid path \"%s\"\n", relpath);
+		return -ENOENT;
+	}
+
+	if (!DIRENT_ISDIRECTORY(node->dtype)) {
+		fdbg("ERROR: Path \"%s\" is not a regular directory\n", relpath);
+		return -ENOTDIR;
+	}
+
+	perf_dir = (FAR struct perf_dir_s *)kmm_zalloc(sizeof(struct perf_dir_s));
+	if (!perf_dir) {
+		fdbg("ERROR: Failed to allocate the directory structure\n");
+		return -ENOMEM;
+	}
+
+	perf_dir->base.level = 1;
+	perf_dir->base.nentries = PERF_NLEVEL0NODES;
+	perf_dir->base.index = 0;
+	perf_dir->node = node;
+
+	dir->u.procfs = (FAR void *)perf_dir;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: perf_closedir
+ *
+ * Description: Close the directory listing
+ *
+ ****************************************************************************/
+
+static int perf_closedir(FAR struct fs_dirent_s *dir)
+{
+	DEBUGASSERT(dir && dir->u.procfs);
+
+	kmm_free(dir->u.procfs);
+	dir->u.procfs = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: perf_readdir
+ *
+ * Description: Read the next directory entry
+ *
+ ****************************************************************************/
+
+static int perf_readdir(FAR struct fs_dirent_s *dir)
+{
+	FAR struct perf_dir_s *perf_dir;
+	FAR const struct perf_node_s *node;
+	unsigned int index;
+
+	DEBUGASSERT(dir && dir->u.procfs);
+	perf_dir = dir->u.procfs;
+
+	/* We signal the end of the directory by returning -ENOENT */
+
+	index = perf_dir->base.index;
+	if (index >= perf_dir->base.nentries) {
+		fvdbg("Entry %d: End of directory\n", index);
+		return -ENOENT;
+	}
+
+	node = g_perf_level0info[index];
+	dir->fd_dir.d_type = node->dtype;
+	strncpy(dir->fd_dir.d_name, node->name, NAME_MAX + 1);
+
+	perf_dir->base.index = index + 1;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: perf_rewinddir
+ *
+ * Description: Reset directory read to the first entry
+ *
+ ****************************************************************************/
+
+static int perf_rewinddir(FAR struct fs_dirent_s *dir)
+{
+	FAR struct perf_dir_s *priv;
+
+	DEBUGASSERT(dir && dir->u.procfs);
+	priv = dir->u.procfs;
+
+	priv->base.index = 0;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: perf_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int perf_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+	FAR const struct perf_node_s *node;
+
+	node = perf_findnode(relpath);
+	if (!node) {
+		fdbg("ERROR: Invalid path \"%s\"\n", relpath);
+		return -ENOENT;
+	}
+
+	if (node->dtype == DTYPE_FILE) {
+		buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	} else {
+		buf->st_mode = S_IFDIR | S_IROTH | S_IRGRP | S_IRUSR;
+	}
+
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_PERF_METRICS && !CONFIG_FS_PROCFS_EXCLUDE_PERF */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
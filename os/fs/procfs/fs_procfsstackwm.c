@@ -0,0 +1,298 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/sched.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_STACK_WATERMARK) && !defined(CONFIG_FS_PROCFS_EXCLUDE_STACKWM)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define STACKWM_LINELEN (CONFIG_TASK_NAME_SIZE + 40)
+
+/* The name comes last, as it may have spaces */
+
+#define STACKWM_HEAD_FMT   "%8s %8s %8s %s\n"
+#define STACKWM_HEAD       "STACK", "PEAK", "COUNT", "NAME"
+#define STACKWM_MARK_FMT   "%8u %8u %8u %s\n"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct stackwm_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	int nmarks;
+	struct stack_watermark_s marks[CONFIG_STACK_WATERMARK_NENTRIES];
+	char line[STACKWM_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int stackwm_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int stackwm_close(FAR struct file *filep);
+static ssize_t stackwm_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t stackwm_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+
+static int stackwm_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int stackwm_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations stackwm_operations = {
+	stackwm_open,				/* open */
+	stackwm_close,				/* close */
+	stackwm_read,				/* read */
+	stackwm_write,				/* write */
+
+	stackwm_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	stackwm_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: stackwm_open
+ ****************************************************************************/
+
+static int stackwm_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct stackwm_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* "stackwm" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "stackwm") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct stackwm_file_s *)kmm_zalloc(sizeof(struct stackwm_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Record the threads alive and take the marks now, so that successive
+	 * reads with small buffers see the same data.
+	 */
+
+	if ((oflags & O_RDONLY) != 0) {
+		stack_watermark_sample();
+		attr->nmarks = stack_watermark_get(attr->marks, CONFIG_STACK_WATERMARK_NENTRIES);
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: stackwm_close
+ ****************************************************************************/
+
+static int stackwm_close(FAR struct file *filep)
+{
+	FAR struct stackwm_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct stackwm_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: stackwm_read
+ *
+ * Description:
+ *   A heading, then one line per task name: the largest stack size, the
+ *   highest usage and the number of marks recorded, in bytes.
+ *
+ ****************************************************************************/
+
+static ssize_t stackwm_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct stackwm_file_s *attr;
+	FAR struct stack_watermark_s *mark;
+	size_t totalsize = 0;
+	size_t linesize;
+	off_t offset;
+	int i;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct stackwm_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	offset = filep->f_pos;
+
+	linesize = snprintf(attr->line, STACKWM_LINELEN, STACKWM_HEAD_FMT, STACKWM_HEAD);
+	totalsize += procfs_memcpy(attr->line, linesize, buffer, buflen, &offset);
+
+	for (i = 0; i < attr->nmarks && totalsize < buflen; i++) {
+		mark = &attr->marks[i];
+		linesize = snprintf(attr->line, STACKWM_LINELEN, STACKWM_MARK_FMT, (unsigned int)mark->stacksize, (unsigned int)mark->peak, (unsigned int)mark->count, mark->name);
+		totalsize += procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+	}
+
+	/* Update the file offset */
+
+	filep->f_pos += totalsize;
+	return totalsize;
+}
+
+/****************************************************************************
+ * Name: stackwm_write
+ *
+ * Description:
+ *   Writing anything forgets all the marks.
+ *
+ ****************************************************************************/
+
+static ssize_t stackwm_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	stack_watermark_clear();
+	return buflen;
+}
+
+/****************************************************************************
+ * Name: stackwm_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int stackwm_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct stackwm_file_s *oldattr;
+	FAR struct stackwm_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct stackwm_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct stackwm_file_s *)kmm_malloc(sizeof(struct stackwm_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct stackwm_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: stackwm_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int stackwm_stat(const char *relpath, struct stat *buf)
+{
+	/* "stackwm" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "stackwm") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "stackwm" is a file, read for the marks, written to reset them */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR | S_IWUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#endif							/* CONFIG_STACK_WATERMARK && !CONFIG_FS_PROCFS_EXCLUDE_STACKWM */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
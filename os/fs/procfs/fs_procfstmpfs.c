@@ -0,0 +1,290 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+#include <tinyara/fs/tmpfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_FS_TMPFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_TMPFS)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic.
+ */
+
+#define TMPFS_LINELEN 64
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct tmpfsinfo_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	char line[TMPFS_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int tmpfsinfo_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int tmpfsinfo_close(FAR struct file *filep);
+static ssize_t tmpfsinfo_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+
+static int tmpfsinfo_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int tmpfsinfo_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations tmpfs_procfsoperations = {
+	tmpfsinfo_open,			/* open */
+	tmpfsinfo_close,			/* close */
+	tmpfsinfo_read,			/* read */
+	NULL,						/* write */
+
+	tmpfsinfo_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	tmpfsinfo_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tmpfsinfo_open
+ ****************************************************************************/
+
+static int tmpfsinfo_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct tmpfsinfo_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only.  Any attempt to open with any kind of write
+	 * access is not permitted.
+	 */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	/* "tmpfs" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "tmpfs") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct tmpfsinfo_file_s *)kmm_zalloc(sizeof(struct tmpfsinfo_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: tmpfsinfo_close
+ ****************************************************************************/
+
+static int tmpfsinfo_close(FAR struct file *filep)
+{
+	FAR struct tmpfsinfo_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct tmpfsinfo_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: tmpfsinfo_read
+ ****************************************************************************/
+
+static ssize_t tmpfsinfo_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct tmpfsinfo_file_s *attr;
+	struct tmpfs_stats_s stats;
+	size_t linesize;
+	size_t copysize;
+	size_t totalsize;
+	off_t offset;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct tmpfsinfo_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	tmpfs_getstats(&stats);
+
+	totalsize = 0;
+	offset = filep->f_pos;
+
+	linesize = snprintf(attr->line, TMPFS_LINELEN, "%-12s %lu\n", "ChunkSize:", (unsigned long)stats.chunksize);
+	copysize = procfs_memcpy(attr->line, linesize, buffer, buflen, &offset);
+	totalsize += copysize;
+
+	if (totalsize < buflen) {
+		linesize = snprintf(attr->line, TMPFS_LINELEN, "%-12s %u (%u free)\n", "PoolChunks:", stats.poolchunks, stats.poolfree);
+		copysize = procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+		totalsize += copysize;
+	}
+
+	if (totalsize < buflen) {
+		linesize = snprintf(attr->line, TMPFS_LINELEN, "%-12s %lu (peak %lu)\n", "Used:", (unsigned long)stats.used, (unsigned long)stats.peak);
+		copysize = procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+		totalsize += copysize;
+	}
+
+	if (totalsize < buflen) {
+		linesize = snprintf(attr->line, TMPFS_LINELEN, "%-12s %lu\n", "FileData:", (unsigned long)stats.size);
+		copysize = procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+		totalsize += copysize;
+	}
+
+	if (totalsize < buflen) {
+		linesize = snprintf(attr->line, TMPFS_LINELEN, "%-12s %lu (%lu refused)\n", "Quota:", (unsigned long)stats.quota, (unsigned long)stats.nquota);
+		copysize = procfs_memcpy(attr->line, linesize, buffer + totalsize, buflen - totalsize, &offset);
+		totalsize += copysize;
+	}
+
+	/* Update the file offset */
+
+	filep->f_pos += totalsize;
+	return totalsize;
+}
+
+/****************************************************************************
+ * Name: tmpfsinfo_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int tmpfsinfo_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct tmpfsinfo_file_s *oldattr;
+	FAR struct tmpfsinfo_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct tmpfsinfo_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct tmpfsinfo_file_s *)kmm_malloc(sizeof(struct tmpfsinfo_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct tmpfsinfo_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: tmpfsinfo_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int tmpfsinfo_stat(const char *relpath, struct stat *buf)
+{
+	/* "tmpfs" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "tmpfs") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "tmpfs" is the name for a read-only file */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_FS_PROCFS_EXCLUDE_TMPFS */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -77,6 +77,7 @@
 #include <tinyara/fs/fs.h>
 #include <tinyara/fs/ioctl.h>
 #include <tinyara/fs/dirent.h>
+#include <tinyara/fs/bcache.h>
 
 #include "fs_romfs.h"
 
@@ -954,6 +955,12 @@ static int romfs_bind(FAR struct inode *blkdriver, FAR const void *data, FAR voi
 		goto errout_with_sem;
 	}
 
+	/* XIP images are read in place, others go through the block cache */
+
+	if (!rm->rm_xipbase) {
+		(void)bcache_attach(blkdriver);
+	}
+
 	/* Then complete the mount by getting the ROMFS configuratrion from
 	 * the ROMF header
 	 */
@@ -972,6 +979,7 @@ static int romfs_bind(FAR struct inode *blkdriver, FAR const void *data, FAR voi
 
 errout_with_buffer:
 	if (!rm->rm_xipbase) {
+		(void)bcache_detach(blkdriver);
 		kmm_free(rm->rm_buffer);
 	}
 
@@ -1016,6 +1024,10 @@ static int romfs_unbind(FAR void *handle, FAR struct inode **blkdriver)
 		if (rm->rm_blkdriver) {
 			struct inode *inode = rm->rm_blkdriver;
 			if (inode) {
+				if (!rm->rm_xipbase) {
+					(void)bcache_detach(inode);
+				}
+
 				if (inode->u.i_bops && inode->u.i_bops->close) {
 					(void)inode->u.i_bops->close(inode);
 				}
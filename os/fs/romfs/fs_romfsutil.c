@@ -71,6 +71,7 @@
 #include <tinyara/kmalloc.h>
 #include <tinyara/fs/ioctl.h>
 #include <tinyara/fs/dirent.h>
+#include <tinyara/fs/bcache.h>
 
 #include "fs_romfs.h"
 
@@ -405,7 +406,7 @@ int romfs_hwread(struct romfs_mountpt_s *rm, uint8_t *buffer, uint32_t sector, u
 
 		DEBUGASSERT(inode);
 		if (inode->u.i_bops && inode->u.i_bops->read) {
-			nsectorsread = inode->u.i_bops->read(inode, buffer, sector, nsectors);
+			nsectorsread = bcache_read(inode, buffer, sector, nsectors);
 
 			if (nsectorsread == (ssize_t)nsectors) {
 				ret = OK;
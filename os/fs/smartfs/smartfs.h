@@ -327,6 +327,15 @@ struct smartfs_ofile_s {
 								 * used field until the file is closed,
 								 * a seek, or more data is written that
 								 * causes the sector to change. */
+#ifdef CONFIG_SMARTFS_READAHEAD
+	FAR uint8_t *rabuffer;		/* Sectors read ahead, one per slot */
+	uint16_t ralogs[CONFIG_SMARTFS_READAHEAD_NSECTORS];	/* Logical sector of each slot */
+	uint8_t racount;			/* Number of slots read */
+	uint8_t rawindow;			/* Size of the next read ahead, 0 before the
+								 * first sequential read, 1 if disabled
+								 * until the next seek */
+	bool rachained;				/* currsector was reached by reading */
+#endif
 };
 
 /* This structure represents the overall mountpoint state.  An instance of this
@@ -334,6 +343,32 @@ struct smartfs_ofile_s {
  * mounted with a smartfs filesystem.
  */
 
+/* In-RAM index of the entries of a directory, to find an entry by name
+ * with a single sector read.  It lists the sectors of the directory chain
+ * and the location and name hash of each valid entry.
+ */
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+struct smartfs_dirindex_entry_s {
+	uint16_t hash;				/* Hash of the entry name */
+	uint16_t sector;			/* Directory sector holding the entry */
+	uint16_t offset;			/* Offset of the entry in the sector */
+};
+
+struct smartfs_dirindex_s {
+	bool inuse;					/* The slot describes a directory */
+	bool overflow;				/* Too many entries, use the linear search */
+	uint16_t dirsector;			/* First sector of the directory */
+	uint16_t nchain;			/* Number of sectors in the chain */
+	uint16_t maxchain;			/* Allocated size of 'chain' */
+	uint16_t nentries;			/* Number of valid entries */
+	uint16_t maxentries;		/* Allocated size of 'entries' */
+	uint32_t lastuse;			/* For the least recently used replacement */
+	FAR uint16_t *chain;		/* Sectors of the directory chain */
+	FAR struct smartfs_dirindex_entry_s *entries;
+};
+#endif
+
 struct smartfs_mountpt_s {
 #if defined(CONFIG_SMARTFS_MULTI_ROOT_DIRS) || defined(CONFIG_FS_PROCFS)
 	struct smartfs_mountpt_s *fs_next;	/* Pointer to next SMART filesystem */
@@ -353,6 +388,10 @@ struct smartfs_mountpt_s {
 #ifdef CONFIG_SMARTFS_ENTRY_TIMESTAMP
 	uint32_t entry_seq;
 #endif
+#ifdef CONFIG_SMARTFS_DIRINDEX
+	struct smartfs_dirindex_s fs_dirindex[CONFIG_SMARTFS_DIRINDEX_NDIRS];
+	uint32_t fs_dirindex_clock;	/* Incremented on each use of an index */
+#endif
 };
 
 
@@ -431,6 +470,17 @@ uint16_t get_used_byte_count(uint8_t *used);
 #endif
 int smartfs_sector_recovery(struct smartfs_mountpt_s *fs);
 
+#ifdef CONFIG_SMARTFS_DIRINDEX
+void smartfs_dirindex_drop(struct smartfs_mountpt_s *fs, uint16_t sector);
+void smartfs_dirindex_free(struct smartfs_mountpt_s *fs);
+#endif
+
+int smartfs_readfilesector(struct smartfs_mountpt_s *fs, struct smartfs_ofile_s *sf, FAR char **data);
+
+#ifdef CONFIG_SMARTFS_READAHEAD
+void smartfs_readahead_drop(struct smartfs_mountpt_s *fs, uint16_t firstsector);
+#endif
+
 struct file;					/* Forward references */
 struct inode;
 struct fs_dirent_s;
@@ -761,6 +761,12 @@ static size_t smartfs_status_read(FAR struct file *filep, FAR char *buffer, size
 		if (ret == OK) {
 			/* Format and return data in the buffer */
 			len = snprintf(buffer, buflen, "Total Sectors    %d\nFree Sectors     %d\n" "Released Sectors %d\n", procfs_data.totalsectors, procfs_data.freesectors, procfs_data.releasesectors);
+#ifdef CONFIG_MTD_SMART_BGGC
+			len += snprintf(&buffer[len], buflen - len, "GC Runs          %u\nGC Blocks        %u\n" "GC Sectors       %u\nGC Time (ms)     %u\n" "Write Path GC    %u\n", procfs_data.gcruns, procfs_data.gcblocks, procfs_data.gcsectors, procfs_data.gcmsec, procfs_data.fgblocks);
+#endif
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+			len += snprintf(&buffer[len], buflen - len, "Erased Ahead     %u\n", procfs_data.eablocks);
+#endif
 #ifdef CONFIG_DEBUG_FS
 			/* Calculate the sector utilization percentage */
 			if (procfs_data.blockerases == 0) {
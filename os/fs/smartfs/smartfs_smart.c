@@ -481,6 +481,11 @@ static int smartfs_close(FAR struct file *filep)
 		kmm_free(sf->buffer);
 	}
 #endif
+#ifdef CONFIG_SMARTFS_READAHEAD
+	if (sf->rabuffer) {
+		kmm_free(sf->rabuffer);
+	}
+#endif
 
 	kmm_free(sf);
 	filep->f_priv = NULL;
@@ -499,8 +504,8 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 	struct inode *inode;
 	struct smartfs_mountpt_s *fs;
 	struct smartfs_ofile_s *sf;
-	struct smart_read_write_s readwrite;
 	struct smartfs_chain_header_s *header;
+	FAR char *data;
 	int ret = OK;
 	uint32_t bytesread;
 	uint16_t bytestoread;
@@ -534,22 +539,20 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 			break;
 		}
 
-		/* Read the curent sector into our buffer */
+		/* Read the curent sector, or find it among the sectors read ahead */
 
-		smartfs_setbuffer(&readwrite, sf->currsector, 0, fs->fs_llformat.availbytes, (uint8_t *)fs->fs_rwbuffer);
-		ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long)&readwrite);
+		ret = smartfs_readfilesector(fs, sf, &data);
 		if (ret < 0) {
-			fdbg("Error reading sector %d data, ret : %d\n", readwrite.logsector, ret);
 			goto errout_with_semaphore;
 		}
 
 		/* Point header to the read data to get used byte count */
 
-		header = (struct smartfs_chain_header_s *)fs->fs_rwbuffer;
+		header = (struct smartfs_chain_header_s *)data;
 
 		/* Get number of used bytes in this sector */
 #ifdef CONFIG_SMARTFS_DYNAMIC_HEADER
-		bytesinsector = get_leftover_used_byte_count((uint8_t *)readwrite.buffer, get_used_byte_count((uint8_t *)header->used));
+		bytesinsector = get_leftover_used_byte_count((uint8_t *)data, get_used_byte_count((uint8_t *)header->used));
 #else
 		bytesinsector = SMARTFS_USED(header);
 
@@ -573,7 +576,7 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 		if (bytestoread > 0) {
 			/* Do incremental copy from this sector */
 
-			memcpy(&buffer[bytesread], &fs->fs_rwbuffer[sf->curroffset], bytestoread);
+			memcpy(&buffer[bytesread], &data[sf->curroffset], bytestoread);
 			bytesread += bytestoread;
 			sf->filepos += bytestoread;
 			sf->curroffset += bytestoread;
@@ -586,6 +589,9 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 
 			sf->currsector = SMARTFS_NEXTSECTOR(header);
 			sf->curroffset = sizeof(struct smartfs_chain_header_s);
+#ifdef CONFIG_SMARTFS_READAHEAD
+			sf->rachained = true;
+#endif
 		}
 	}
 
@@ -648,6 +654,11 @@ static ssize_t smartfs_write(FAR struct file *filep, const char *buffer, size_t
 		goto errout_with_semaphore;
 	}
 
+#ifdef CONFIG_SMARTFS_READAHEAD
+	smartfs_readahead_drop(fs, sf->entry.firstsector);
+	sf->rachained = false;
+#endif
+
 	header = (struct smartfs_chain_header_s *)fs->fs_rwbuffer;
 	byteswritten = 0;
 
@@ -1647,6 +1658,9 @@ int smartfs_rename(struct inode *mountpt, const char *oldrelpath, const char *ne
 			if (ret != OK) {
 				fdbg("Error writing new entry to sector %d, ret : %d\n", readwrite.logsector, ret);
 			}
+#ifdef CONFIG_SMARTFS_DIRINDEX
+			smartfs_dirindex_drop(fs, oldentry.dsector);
+#endif
 			/* Old entry doesn't have to be invalidated, directly go to end */
 			goto errout_with_semaphore;
 		}
@@ -148,6 +148,11 @@ extern size_t smart_sect_header_size;
 #endif
 
 #define SET_TO_REMAIN(v, n)		v[n >> 3] |= (1 << (7 - (n % 8)))
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+#define SMARTFS_DIRINDEX_INITCHAIN   4
+#define SMARTFS_DIRINDEX_INITENTRIES 16
+#endif
 #define SET_TO_USED(v, n)		v[n >> 3] &= ~(1 << (7 - (n % 8)))
 #define IS_SECTOR_REMAIN(v, n)	v[n >> 3] & (1 << (7 - (n % 8)))
 
@@ -547,6 +552,13 @@ off_t smartfs_seek_internal(struct smartfs_mountpt_s *fs, struct smartfs_ofile_s
 	if ((whence == SEEK_CUR) && (offset == 0)) {
 		return sf->filepos;
 	}
+#ifdef CONFIG_SMARTFS_READAHEAD
+
+	sf->rachained = false;
+	if (sf->rawindow == 1) {
+		sf->rawindow = 0;
+	}
+#endif
 
 	/* Before any further checks/operations, we need to make sure that the length of the file has been calculated */
 
@@ -687,6 +699,10 @@ int smartfs_sync_internal(struct smartfs_mountpt_s *fs, struct smartfs_ofile_s *
 
 #ifdef CONFIG_SMARTFS_USE_SECTOR_BUFFER
 	if (sf->bflags & SMARTFS_BFLAG_DIRTY) {
+#ifdef CONFIG_SMARTFS_READAHEAD
+		smartfs_readahead_drop(fs, sf->entry.firstsector);
+#endif
+
 		/* Update the header with the number of bytes written */
 
 		header = (struct smartfs_chain_header_s *)sf->buffer;
@@ -943,6 +959,10 @@ int smartfs_unmount(struct smartfs_mountpt_s *fs)
 	int found = FALSE;
 #endif
 
+#ifdef CONFIG_SMARTFS_DIRINDEX
+	smartfs_dirindex_free(fs);
+#endif
+
 #if defined(CONFIG_SMARTFS_MULTI_ROOT_DIRS) || \
 	(defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS))
 	/* Start at the head of the mounts and search for our entry.  Also
@@ -1106,6 +1126,444 @@ int smartfs_get_datalen(struct smartfs_mountpt_s *fs, uint16_t firstsector, uint
 	return OK;
 }
 
+/****************************************************************************
+ * Name: smartfs_readfilesector
+ *
+ * Description: Return in 'data' the content of sf->currsector for a file
+ *   read.  With read ahead, a sector reached by following the chain of the
+ *   file is served from the sectors read ahead, or read together with the
+ *   sectors stored after it.  Otherwise it is read in fs->fs_rwbuffer.
+ *
+ ****************************************************************************/
+
+int smartfs_readfilesector(struct smartfs_mountpt_s *fs, struct smartfs_ofile_s *sf, FAR char **data)
+{
+	struct smart_read_write_s readwrite;
+	int ret;
+#ifdef CONFIG_SMARTFS_READAHEAD
+	struct smart_readahead_s readahead;
+	struct smartfs_chain_header_s *header;
+	uint16_t nextsector;
+	int x;
+
+	for (x = 0; x < sf->racount; x++) {
+		if (sf->ralogs[x] == sf->currsector) {
+			*data = (FAR char *)&sf->rabuffer[x * fs->fs_llformat.sectorsize];
+			return OK;
+		}
+	}
+
+	if (sf->rachained && sf->rawindow != 1) {
+		/* The previous window was used up, read twice as much */
+
+		if (sf->rawindow == 0) {
+			sf->rawindow = 2;
+		} else if (sf->rawindow < CONFIG_SMARTFS_READAHEAD_NSECTORS / 2) {
+			sf->rawindow <<= 1;
+		} else {
+			sf->rawindow = CONFIG_SMARTFS_READAHEAD_NSECTORS;
+		}
+
+		if (sf->rabuffer == NULL) {
+			sf->rabuffer = (FAR uint8_t *)kmm_malloc(CONFIG_SMARTFS_READAHEAD_NSECTORS * fs->fs_llformat.sectorsize);
+		}
+
+		sf->racount = 0;
+		if (sf->rabuffer != NULL) {
+			readahead.logsector = sf->currsector;
+			readahead.nsectors = sf->rawindow;
+			readahead.logsectors = sf->ralogs;
+			readahead.buffer = sf->rabuffer;
+			ret = FS_IOCTL(fs, BIOC_READAHEAD, (unsigned long)&readahead);
+			if (ret > 0) {
+				sf->racount = ret;
+
+				/* Stop reading ahead a file whose sectors are not stored
+				 * together, the window would only cost bandwidth.
+				 */
+
+				header = (struct smartfs_chain_header_s *)sf->rabuffer;
+				nextsector = SMARTFS_NEXTSECTOR(header);
+				if (ret > 1 && nextsector != SMARTFS_ERASEDSTATE_16BIT && sf->ralogs[1] != nextsector) {
+					sf->rawindow = 1;
+				}
+
+				*data = (FAR char *)sf->rabuffer;
+				return OK;
+			}
+		}
+
+		/* No memory, or a driver without BIOC_READAHEAD */
+
+		sf->rawindow = 1;
+	}
+#endif
+
+	smartfs_setbuffer(&readwrite, sf->currsector, 0, fs->fs_llformat.availbytes, (uint8_t *)fs->fs_rwbuffer);
+	ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long)&readwrite);
+	if (ret < 0) {
+		fdbg("Error reading sector %d data, ret : %d\n", readwrite.logsector, ret);
+		return ret;
+	}
+
+	*data = fs->fs_rwbuffer;
+	return OK;
+}
+
+#ifdef CONFIG_SMARTFS_READAHEAD
+/****************************************************************************
+ * Name: smartfs_readahead_drop
+ *
+ * Description: Forget the sectors read ahead by the open files of a file
+ *   about to be modified.
+ *
+ ****************************************************************************/
+
+void smartfs_readahead_drop(struct smartfs_mountpt_s *fs, uint16_t firstsector)
+{
+	struct smartfs_ofile_s *sf;
+
+	for (sf = fs->fs_head; sf != NULL; sf = sf->fnext) {
+		if (sf->entry.firstsector == firstsector) {
+			sf->racount = 0;
+		}
+	}
+}
+#endif
+
+#ifdef CONFIG_SMARTFS_DIRINDEX
+/****************************************************************************
+ * Name: smartfs_dirindex_hash
+ *
+ * Description: FNV-1a hash of a name, limited to the name size of the
+ *   volume like the strncmp() of the lookup.
+ *
+ ****************************************************************************/
+
+static uint16_t smartfs_dirindex_hash(struct smartfs_mountpt_s *fs, const char *name)
+{
+	uint32_t hash = 2166136261u;
+	uint16_t len;
+
+	for (len = 0; len < fs->fs_llformat.namesize && name[len] != '\0'; len++) {
+		hash = (hash ^ (uint8_t)name[len]) * 16777619u;
+	}
+
+	return (uint16_t)(hash ^ (hash >> 16));
+}
+
+static void smartfs_dirindex_release(struct smartfs_dirindex_s *index)
+{
+	kmm_free(index->chain);
+	kmm_free(index->entries);
+	memset(index, 0, sizeof(struct smartfs_dirindex_s));
+}
+
+static bool smartfs_dirindex_inchain(struct smartfs_dirindex_s *index, uint16_t sector)
+{
+	uint16_t x;
+
+	for (x = 0; x < index->nchain; x++) {
+		if (index->chain[x] == sector) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Find the index of the directory whose chain holds the sector */
+
+static struct smartfs_dirindex_s *smartfs_dirindex_find(struct smartfs_mountpt_s *fs, uint16_t sector)
+{
+	int x;
+
+	for (x = 0; x < CONFIG_SMARTFS_DIRINDEX_NDIRS; x++) {
+		if (fs->fs_dirindex[x].inuse && !fs->fs_dirindex[x].overflow &&
+			smartfs_dirindex_inchain(&fs->fs_dirindex[x], sector)) {
+			return &fs->fs_dirindex[x];
+		}
+	}
+
+	return NULL;
+}
+
+static int smartfs_dirindex_addsector(struct smartfs_dirindex_s *index, uint16_t sector)
+{
+	FAR uint16_t *chain;
+	uint16_t size;
+
+	if (index->nchain == index->maxchain) {
+		size = index->maxchain ? index->maxchain << 1 : SMARTFS_DIRINDEX_INITCHAIN;
+		chain = (FAR uint16_t *)kmm_realloc(index->chain, size * sizeof(uint16_t));
+		if (chain == NULL) {
+			return -ENOMEM;
+		}
+
+		index->chain = chain;
+		index->maxchain = size;
+	}
+
+	index->chain[index->nchain++] = sector;
+	return OK;
+}
+
+static int smartfs_dirindex_addentry(struct smartfs_dirindex_s *index, uint16_t hash, uint16_t sector, uint16_t offset)
+{
+	FAR struct smartfs_dirindex_entry_s *entries;
+	uint16_t size;
+
+	if (index->nentries >= CONFIG_SMARTFS_DIRINDEX_MAXENTRIES) {
+		/* Keep the slot so that the directory is not indexed again on each
+		 * lookup, but search it linearly.
+		 */
+
+		kmm_free(index->chain);
+		kmm_free(index->entries);
+		index->chain = NULL;
+		index->entries = NULL;
+		index->nchain = index->maxchain = 0;
+		index->nentries = index->maxentries = 0;
+		index->overflow = true;
+		return OK;
+	}
+
+	if (index->nentries == index->maxentries) {
+		size = index->maxentries ? index->maxentries << 1 : SMARTFS_DIRINDEX_INITENTRIES;
+		if (size > CONFIG_SMARTFS_DIRINDEX_MAXENTRIES) {
+			size = CONFIG_SMARTFS_DIRINDEX_MAXENTRIES;
+		}
+
+		entries = (FAR struct smartfs_dirindex_entry_s *)kmm_realloc(index->entries, size * sizeof(struct smartfs_dirindex_entry_s));
+		if (entries == NULL) {
+			return -ENOMEM;
+		}
+
+		index->entries = entries;
+		index->maxentries = size;
+	}
+
+	index->entries[index->nentries].hash = hash;
+	index->entries[index->nentries].sector = sector;
+	index->entries[index->nentries].offset = offset;
+	index->nentries++;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: smartfs_dirindex_get
+ *
+ * Description: Return the index of a directory, building it from the
+ *   directory chain if it is not cached.  The least recently used index is
+ *   replaced.  Returns NULL if the directory must be searched linearly.
+ *
+ ****************************************************************************/
+
+static struct smartfs_dirindex_s *smartfs_dirindex_get(struct smartfs_mountpt_s *fs, uint16_t dirsector)
+{
+	struct smartfs_dirindex_s *index = NULL;
+	struct smartfs_chain_header_s *header;
+	struct smartfs_entry_header_s *entry;
+	struct smart_read_write_s readwrite;
+	uint16_t entrysize;
+	uint16_t sector;
+	uint16_t offset;
+	int ret;
+	int x;
+
+	for (x = 0; x < CONFIG_SMARTFS_DIRINDEX_NDIRS; x++) {
+		if (fs->fs_dirindex[x].inuse && fs->fs_dirindex[x].dirsector == dirsector) {
+			index = &fs->fs_dirindex[x];
+			index->lastuse = ++fs->fs_dirindex_clock;
+			return index->overflow ? NULL : index;
+		}
+
+		if (index == NULL || !fs->fs_dirindex[x].inuse ||
+			(index->inuse && fs->fs_dirindex[x].lastuse < index->lastuse)) {
+			index = &fs->fs_dirindex[x];
+		}
+	}
+
+	smartfs_dirindex_release(index);
+	index->inuse = true;
+	index->dirsector = dirsector;
+	index->lastuse = ++fs->fs_dirindex_clock;
+
+	entrysize = sizeof(struct smartfs_entry_header_s) + fs->fs_llformat.namesize;
+	sector = dirsector;
+	while (sector != SMARTFS_ERASEDSTATE_16BIT) {
+		if (index->nchain >= fs->fs_llformat.nsectors) {
+			/* A loop in the chain, let the linear search deal with it */
+
+			goto errout;
+		}
+
+		smartfs_setbuffer(&readwrite, sector, 0, fs->fs_llformat.availbytes, (uint8_t *)fs->fs_rwbuffer);
+		ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long)&readwrite);
+		if (ret < 0 || smartfs_dirindex_addsector(index, sector) < 0) {
+			goto errout;
+		}
+
+		offset = sizeof(struct smartfs_chain_header_s);
+		while (offset < readwrite.count) {
+			entry = (struct smartfs_entry_header_s *)&fs->fs_rwbuffer[offset];
+			if (ENTRY_VALID(entry)) {
+				if (smartfs_dirindex_addentry(index, smartfs_dirindex_hash(fs, entry->name), sector, offset) < 0) {
+					goto errout;
+				}
+
+				if (index->overflow) {
+					return NULL;
+				}
+			}
+
+			offset += entrysize;
+		}
+
+		header = (struct smartfs_chain_header_s *)fs->fs_rwbuffer;
+		sector = SMARTFS_NEXTSECTOR(header);
+	}
+
+	fvdbg("Indexed directory %d, %d sectors %d entries\n", dirsector, index->nchain, index->nentries);
+	return index;
+
+errout:
+	smartfs_dirindex_release(index);
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: smartfs_dirindex_next
+ *
+ * Description: Return the next sector of the directory that may hold an
+ *   entry with the hash, after the entry number '*cursor', or the erased
+ *   state if there is none.  A hash collision costs one more sector read.
+ *
+ ****************************************************************************/
+
+static uint16_t smartfs_dirindex_next(struct smartfs_dirindex_s *index, uint16_t hash, uint16_t *cursor, uint16_t cursector)
+{
+	while (*cursor < index->nentries) {
+		struct smartfs_dirindex_entry_s *entry = &index->entries[(*cursor)++];
+
+		if (entry->hash == hash && entry->sector != cursector) {
+			return entry->sector;
+		}
+	}
+
+	return SMARTFS_ERASEDSTATE_16BIT;
+}
+
+/****************************************************************************
+ * Name: smartfs_dirindex_add
+ *
+ * Description: Record an entry written to a directory.  'prevsector' is a
+ *   sector of the chain, the one the new sector is chained to if 'sector'
+ *   was just added to the chain.
+ *
+ ****************************************************************************/
+
+static void smartfs_dirindex_add(struct smartfs_mountpt_s *fs, uint16_t prevsector, uint16_t sector, uint16_t offset, const char *name)
+{
+	struct smartfs_dirindex_s *index;
+
+	uint16_t x;
+
+	index = smartfs_dirindex_find(fs, prevsector);
+	if (index == NULL) {
+		return;
+	}
+
+	for (x = 0; x < index->nentries; x++) {
+		if (index->entries[x].sector == sector && index->entries[x].offset == offset) {
+			/* The entry was rewritten in place, only its name may change */
+
+			index->entries[x].hash = smartfs_dirindex_hash(fs, name);
+			return;
+		}
+	}
+
+	if ((!smartfs_dirindex_inchain(index, sector) && smartfs_dirindex_addsector(index, sector) < 0) ||
+		smartfs_dirindex_addentry(index, smartfs_dirindex_hash(fs, name), sector, offset) < 0) {
+		/* An incomplete index would hide entries, drop it */
+
+		smartfs_dirindex_release(index);
+	}
+}
+
+/****************************************************************************
+ * Name: smartfs_dirindex_remove
+ *
+ * Description: Forget an entry invalidated in a directory, and the sector
+ *   itself if it was released from the chain.
+ *
+ ****************************************************************************/
+
+static void smartfs_dirindex_remove(struct smartfs_mountpt_s *fs, uint16_t sector, uint16_t offset, bool unchained)
+{
+	struct smartfs_dirindex_s *index;
+	uint16_t x;
+
+	index = smartfs_dirindex_find(fs, sector);
+	if (index == NULL) {
+		return;
+	}
+
+	for (x = 0; x < index->nentries; x++) {
+		if (index->entries[x].sector == sector && index->entries[x].offset == offset) {
+			index->entries[x] = index->entries[--index->nentries];
+			break;
+		}
+	}
+
+	if (unchained) {
+		for (x = 0; x < index->nchain; x++) {
+			if (index->chain[x] == sector) {
+				index->chain[x] = index->chain[--index->nchain];
+				break;
+			}
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: smartfs_dirindex_drop
+ *
+ * Description: Drop the index of the directory starting at, or chaining,
+ *   the sector.  Used when a directory is deleted or changed in a way the
+ *   index does not follow.
+ *
+ ****************************************************************************/
+
+void smartfs_dirindex_drop(struct smartfs_mountpt_s *fs, uint16_t sector)
+{
+	int x;
+
+	for (x = 0; x < CONFIG_SMARTFS_DIRINDEX_NDIRS; x++) {
+		if (fs->fs_dirindex[x].inuse && (fs->fs_dirindex[x].dirsector == sector ||
+			smartfs_dirindex_inchain(&fs->fs_dirindex[x], sector))) {
+			smartfs_dirindex_release(&fs->fs_dirindex[x]);
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: smartfs_dirindex_free
+ *
+ * Description: Free all the directory indexes of a volume.
+ *
+ ****************************************************************************/
+
+void smartfs_dirindex_free(struct smartfs_mountpt_s *fs)
+{
+	int x;
+
+	for (x = 0; x < CONFIG_SMARTFS_DIRINDEX_NDIRS; x++) {
+		smartfs_dirindex_release(&fs->fs_dirindex[x]);
+	}
+}
+#endif							/* CONFIG_SMARTFS_DIRINDEX */
+
 /****************************************************************************
  * Name: smartfs_finddirentry
  *
@@ -1137,6 +1595,11 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 #ifdef CONFIG_SMARTFS_DYNAMIC_HEADER
 	int used_value;
 #endif
+#ifdef CONFIG_SMARTFS_DIRINDEX
+	struct smartfs_dirindex_s *index;
+	uint16_t cursor = 0;
+	uint16_t hash = 0;
+#endif
 
 	/* Initialize directory level zero as the root sector */
 	direntry->dsector = 0xFFFF;
@@ -1224,6 +1687,20 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 
 			offset = 0xFFFF;
 
+#ifdef CONFIG_SMARTFS_DIRINDEX
+			/* With an index, only read the sectors holding an entry of the
+			 * same name hash instead of the whole chain.
+			 */
+
+			readwrite.count = 0;
+			index = smartfs_dirindex_get(fs, dirsector);
+			if (index != NULL) {
+				hash = smartfs_dirindex_hash(fs, fs->fs_workbuffer);
+				cursor = 0;
+				dirsector = smartfs_dirindex_next(index, hash, &cursor, SMARTFS_ERASEDSTATE_16BIT);
+			}
+#endif
+
 #if CONFIG_SMARTFS_ERASEDSTATE == 0xFF
 			while (dirsector != 0xFFFF)
 #else
@@ -1242,6 +1719,11 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 
 				header = (struct smartfs_chain_header_s *)fs->fs_rwbuffer;
 				dirsector = SMARTFS_NEXTSECTOR(header);
+#ifdef CONFIG_SMARTFS_DIRINDEX
+				if (index != NULL) {
+					dirsector = smartfs_dirindex_next(index, hash, &cursor, readwrite.logsector);
+				}
+#endif
 
 				/* Search for the entry */
 
@@ -1620,6 +2102,9 @@ int smartfs_writeentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s new_
 		}
 	}
 
+#ifdef CONFIG_SMARTFS_DIRINDEX
+	smartfs_dirindex_add(fs, new_entry.prev_parent, new_entry.dsector, offset, new_entry.name);
+#endif
 	ret = OK;
 
 errout:
@@ -1749,6 +2234,9 @@ int smartfs_invalidateentry(struct smartfs_mountpt_s *fs, uint16_t parentdirsect
 		return ret;
 	}
 
+#ifdef CONFIG_SMARTFS_DIRINDEX
+	smartfs_dirindex_remove(fs, parentdirsector, offset, false);
+#endif
 	return ret;
 }
 
@@ -1901,6 +2389,15 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *en
 		}
 	}
 
+#ifdef CONFIG_SMARTFS_DIRINDEX
+	/* Forget the entry, and the index of the entry itself if it is a
+	 * directory.
+	 */
+
+	smartfs_dirindex_remove(fs, entry->dsector, entry->doffset, !inactive_entry);
+	smartfs_dirindex_drop(fs, entry->firstsector);
+#endif
+
 	/* Now Free Chained sector from target entry */
 	nextsector = entry->firstsector;
 	header = (struct smartfs_chain_header_s *)fs->fs_rwbuffer;
@@ -2011,6 +2508,10 @@ int smartfs_shrinkfile(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs_ofil
 	struct smartfs_chain_header_s *chainheader;
 	uint16_t nextsector;
 
+#ifdef CONFIG_SMARTFS_READAHEAD
+	smartfs_readahead_drop(fs, sf->entry.firstsector);
+#endif
+
 	/* Seek till point 'length' of the file, file pointer lies at position of requested 'length' now */
 	smartfs_seek_internal(fs, sf, length, SEEK_SET);
 	sf->byteswritten = sf->curroffset - sizeof(struct smartfs_chain_header_s);
@@ -2084,6 +2585,9 @@ int smartfs_extendfile(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs_ofil
 		return OK;
 	}
 
+#ifdef CONFIG_SMARTFS_READAHEAD
+	smartfs_readahead_drop(fs, sf->entry.firstsector);
+#endif
 	smartfs_seek_internal(fs, sf, 0, SEEK_END);
 	length -= sf->entry.datalen;
 	data_len = SMARTFS_AVAIL_DATABYTES(fs);
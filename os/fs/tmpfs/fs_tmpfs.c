@@ -59,10 +59,12 @@
 #include <sys/stat.h>
 #include <sys/statfs.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #include <fcntl.h>
 #include <dirent.h>
 #include <semaphore.h>
+#include <sched.h>
 #include <errno.h>
 #include <assert.h>
 #include <debug.h>
@@ -72,6 +74,7 @@
 #include <tinyara/fs/fs.h>
 #include <tinyara/fs/dirent.h>
 #include <tinyara/fs/ioctl.h>
+#include <tinyara/fs/tmpfs.h>
 
 #include "fs_tmpfs.h"
 
@@ -83,10 +86,22 @@
 #  warning CONFIG_FS_TMPFS_DIRECTORY_FREEGUARD needs to be > ALLOCGUARD
 #endif
 
-#if CONFIG_FS_TMPFS_FILE_FREEGUARD <= CONFIG_FS_TMPFS_FILE_ALLOCGUARD
-#  warning CONFIG_FS_TMPFS_FILE_FREEGUARD needs to be > ALLOCGUARD
+#if (CONFIG_FS_TMPFS_CHUNKSIZE % 8) != 0
+#  error CONFIG_FS_TMPFS_CHUNKSIZE must be a multiple of 8
 #endif
 
+/* The array of chunk pointers of a file grows by this many entries */
+
+#define TMPFS_NSLOTS_GROW 8
+
+/* Is the chunk part of the preallocated pool? */
+
+#define TMPFS_POOL_SIZE \
+	((size_t)CONFIG_FS_TMPFS_POOL_NCHUNKS * CONFIG_FS_TMPFS_CHUNKSIZE)
+#define TMPFS_IN_POOL(c) \
+	(g_tmpfs_pool.tp_slab != NULL && (c) >= g_tmpfs_pool.tp_slab && \
+	 (c) < g_tmpfs_pool.tp_slab + TMPFS_POOL_SIZE)
+
 #define tmpfs_lock_file(tfo) \
 	(tmpfs_lock_object((FAR struct tmpfs_object_s *)tfo))
 #define tmpfs_lock_directory(tdo) \
@@ -108,7 +123,16 @@ static void tmpfs_unlock(FAR struct tmpfs_s *fs);
 static void tmpfs_lock_object(FAR struct tmpfs_object_s *to);
 static void tmpfs_unlock_object(FAR struct tmpfs_object_s *to);
 static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s **tdo, unsigned int nentries);
-static int tmpfs_realloc_file(FAR struct tmpfs_file_s **tfo, size_t newsize);
+static void tmpfs_pool_attach(void);
+static void tmpfs_pool_detach(void);
+static int tmpfs_alloc_chunk(FAR uint8_t **chunk);
+static void tmpfs_free_chunk(FAR uint8_t *chunk);
+static int tmpfs_get_chunk(FAR struct tmpfs_file_s *tfo, unsigned int n);
+static void tmpfs_put_chunk(FAR struct tmpfs_file_s *tfo, unsigned int n);
+static void tmpfs_unmap_file(FAR struct tmpfs_file_s *tfo);
+static int tmpfs_map_file(FAR struct tmpfs_file_s *tfo);
+static int tmpfs_resize_file(FAR struct tmpfs_file_s *tfo, size_t newsize);
+static void tmpfs_copy_file(FAR struct tmpfs_file_s *tfo, size_t pos, FAR uint8_t *buffer, size_t len, bool tofile);
 static void tmpfs_release_lockedobject(FAR struct tmpfs_object_s *to);
 static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo);
 static int tmpfs_find_dirent(FAR struct tmpfs_directory_s *tdo, FAR const char *name);
@@ -150,6 +174,18 @@ static int tmpfs_rename(FAR struct inode *mountpt, FAR const char *oldrelpath, F
 static void tmpfs_stat_common(FAR struct tmpfs_object_s *to, FAR struct stat *buf);
 static int tmpfs_stat(FAR struct inode *mountpt, FAR const char *relpath, FAR struct stat *buf);
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The chunk pool shared by all TMPFS instances */
+
+static struct tmpfs_pool_s g_tmpfs_pool;
+
+/* The address to which empty files are mapped */
+
+static uint8_t g_tmpfs_nodata;
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -341,67 +377,394 @@ static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s **tdo,
 }
 
 /****************************************************************************
- * Name: tmpfs_realloc_file
+ * Name: tmpfs_pool_attach
  ****************************************************************************/
 
-static int tmpfs_realloc_file(FAR struct tmpfs_file_s **tfo,
-		size_t newsize)
+static void tmpfs_pool_attach(void)
 {
-	FAR struct tmpfs_file_s *oldtfo = *tfo;
-	FAR struct tmpfs_file_s *newtfo;
-	size_t objsize;
-	size_t allocsize;
+#if CONFIG_FS_TMPFS_POOL_NCHUNKS > 0
+	FAR uint8_t *slab;
+	int i;
+#endif
 
-	/* Check if the current allocation is sufficent */
+	/* The pool is allocated when the first TMPFS is bound.  It may still
+	 * exist from an earlier mount if unlinked files held some of its chunks
+	 * at the last unbind.
+	 */
 
-	objsize = SIZEOF_TMPFS_FILE(newsize);
+	if (g_tmpfs_pool.tp_nmounts++ > 0 || g_tmpfs_pool.tp_slab != NULL) {
+		return;
+	}
 
-	/* Are we growing or shrinking the object? */
+#if CONFIG_FS_TMPFS_POOL_NCHUNKS > 0
+	/* All chunks come from the heap if the pool cannot be allocated */
 
-	if (objsize <= oldtfo->tfo_alloc) {
-		/* Shrinking ... Shrink unconditionally if the size is shrinking to
-		 * zero.
-		 */
+	slab = (FAR uint8_t *)kmm_malloc(TMPFS_POOL_SIZE);
+	if (slab == NULL) {
+		fdbg("ERROR: Failed to allocate the chunk pool\n");
+		return;
+	}
 
-		if (newsize > 0) {
-			/* Otherwise, don't realloc unless the object has shrunk by a
-			 * lot.
-			 */
+	sched_lock();
+	for (i = CONFIG_FS_TMPFS_POOL_NCHUNKS - 1; i >= 0; i--) {
+		FAR uint8_t *chunk = slab + i * CONFIG_FS_TMPFS_CHUNKSIZE;
 
-			if (oldtfo->tfo_alloc - objsize <= CONFIG_FS_TMPFS_FILE_FREEGUARD) {
-				/* Hasn't shrunk enough.. Return doing nothing for now */
+		*(FAR void **)chunk = g_tmpfs_pool.tp_freelist;
+		g_tmpfs_pool.tp_freelist = chunk;
+	}
 
-				oldtfo->tfo_size = newsize;
-				return OK;
-			}
-		}
+	g_tmpfs_pool.tp_nfree = CONFIG_FS_TMPFS_POOL_NCHUNKS;
+	g_tmpfs_pool.tp_slab  = slab;
+	sched_unlock();
+#endif
+}
+
+/****************************************************************************
+ * Name: tmpfs_pool_detach
+ ****************************************************************************/
+
+static void tmpfs_pool_detach(void)
+{
+	FAR uint8_t *slab = NULL;
+
+	DEBUGASSERT(g_tmpfs_pool.tp_nmounts > 0);
+
+	/* Free the pool after the last unbind, unless some of its chunks are
+	 * still held by unlinked files that are open.
+	 */
+
+	sched_lock();
+	if (--g_tmpfs_pool.tp_nmounts == 0 &&
+		g_tmpfs_pool.tp_nfree == CONFIG_FS_TMPFS_POOL_NCHUNKS) {
+		slab                     = g_tmpfs_pool.tp_slab;
+		g_tmpfs_pool.tp_slab     = NULL;
+		g_tmpfs_pool.tp_freelist = NULL;
+		g_tmpfs_pool.tp_nfree    = 0;
 	}
+	sched_unlock();
 
-	/* Added some additional amount to the new size to account frequent
-	 * reallocations.
+	if (slab != NULL) {
+		kmm_free(slab);
+	}
+}
+
+/****************************************************************************
+ * Name: tmpfs_alloc_chunk
+ ****************************************************************************/
+
+static int tmpfs_alloc_chunk(FAR uint8_t **chunk)
+{
+	/* Account for the chunk first so that concurrent writers cannot exceed
+	 * the quota together.
 	 */
 
-	allocsize = objsize + CONFIG_FS_TMPFS_FILE_ALLOCGUARD;
+	sched_lock();
+#if CONFIG_FS_TMPFS_QUOTA > 0
+	if (g_tmpfs_pool.tp_used + CONFIG_FS_TMPFS_CHUNKSIZE > CONFIG_FS_TMPFS_QUOTA) {
+		g_tmpfs_pool.tp_nquota++;
+		sched_unlock();
+		return -ENOSPC;
+	}
+#endif
+
+	g_tmpfs_pool.tp_used += CONFIG_FS_TMPFS_CHUNKSIZE;
+	if (g_tmpfs_pool.tp_used > g_tmpfs_pool.tp_peak) {
+		g_tmpfs_pool.tp_peak = g_tmpfs_pool.tp_used;
+	}
+
+	/* Prefer a free chunk of the pool */
 
-	/* Realloc the file object */
+	*chunk = (FAR uint8_t *)g_tmpfs_pool.tp_freelist;
+	if (*chunk != NULL) {
+		g_tmpfs_pool.tp_freelist = *(FAR void **)*chunk;
+		g_tmpfs_pool.tp_nfree--;
+	}
+	sched_unlock();
 
-	newtfo = (FAR struct tmpfs_file_s *)kmm_realloc(oldtfo, allocsize);
-	if (newtfo == NULL) {
+	if (*chunk == NULL) {
+		*chunk = (FAR uint8_t *)kmm_malloc(CONFIG_FS_TMPFS_CHUNKSIZE);
+		if (*chunk == NULL) {
+			sched_lock();
+			g_tmpfs_pool.tp_used -= CONFIG_FS_TMPFS_CHUNKSIZE;
+			sched_unlock();
+			return -ENOMEM;
+		}
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: tmpfs_free_chunk
+ ****************************************************************************/
+
+static void tmpfs_free_chunk(FAR uint8_t *chunk)
+{
+	sched_lock();
+	g_tmpfs_pool.tp_used -= CONFIG_FS_TMPFS_CHUNKSIZE;
+
+	/* Chunks of the pool go back to its free list, the others to the heap */
+
+	if (TMPFS_IN_POOL(chunk)) {
+		*(FAR void **)chunk = g_tmpfs_pool.tp_freelist;
+		g_tmpfs_pool.tp_freelist = chunk;
+		g_tmpfs_pool.tp_nfree++;
+		chunk = NULL;
+	}
+	sched_unlock();
+
+	if (chunk != NULL) {
+		kmm_free(chunk);
+	}
+}
+
+/****************************************************************************
+ * Name: tmpfs_get_chunk and tmpfs_put_chunk
+ *
+ * Description:
+ *   Give chunk 'n' to the file, or take it back.  The chunks in the mapped
+ *   block are only slots of that block.
+ *
+ ****************************************************************************/
+
+static int tmpfs_get_chunk(FAR struct tmpfs_file_s *tfo, unsigned int n)
+{
+	int ret;
+
+	if (n < tfo->tfo_nmapped) {
+		tfo->tfo_chunks[n] = tfo->tfo_map + n * CONFIG_FS_TMPFS_CHUNKSIZE;
+		return OK;
+	}
+
+	ret = tmpfs_alloc_chunk(&tfo->tfo_chunks[n]);
+	if (ret == OK) {
+		tfo->tfo_alloc += CONFIG_FS_TMPFS_CHUNKSIZE;
+	}
+
+	return ret;
+}
+
+static void tmpfs_put_chunk(FAR struct tmpfs_file_s *tfo, unsigned int n)
+{
+	if (n >= tfo->tfo_nmapped) {
+		tfo->tfo_alloc -= CONFIG_FS_TMPFS_CHUNKSIZE;
+		tmpfs_free_chunk(tfo->tfo_chunks[n]);
+	}
+}
+
+/****************************************************************************
+ * Name: tmpfs_unmap_file
+ *
+ * Description:
+ *   Free the mapped block of a file which holds no chunk of it anymore.
+ *
+ ****************************************************************************/
+
+static void tmpfs_unmap_file(FAR struct tmpfs_file_s *tfo)
+{
+	size_t size = tfo->tfo_nmapped * CONFIG_FS_TMPFS_CHUNKSIZE;
+
+	if (tfo->tfo_map == NULL) {
+		return;
+	}
+
+	kmm_free(tfo->tfo_map);
+	tfo->tfo_map     = NULL;
+	tfo->tfo_nmapped = 0;
+	tfo->tfo_alloc  -= size;
+
+	sched_lock();
+	g_tmpfs_pool.tp_used -= size;
+	sched_unlock();
+}
+
+/****************************************************************************
+ * Name: tmpfs_map_file
+ *
+ * Description:
+ *   Make the data of the file contiguous: its chunks are copied into one
+ *   block, which replaces them.  The block takes the memory the chunks
+ *   held in the quota.  A file grown since it was last mapped gets a new
+ *   block, and the earlier mappings are no longer valid.
+ *
+ ****************************************************************************/
+
+static int tmpfs_map_file(FAR struct tmpfs_file_s *tfo)
+{
+	FAR uint8_t *map;
+	size_t size;
+	unsigned int i;
+
+	/* A single chunk is contiguous already */
+
+	if (tfo->tfo_nchunks <= tfo->tfo_nmapped || (tfo->tfo_nchunks == 1 && tfo->tfo_nmapped == 0)) {
+		return OK;
+	}
+
+	size = tfo->tfo_nchunks * CONFIG_FS_TMPFS_CHUNKSIZE;
+	map  = (FAR uint8_t *)kmm_malloc(size);
+	if (map == NULL) {
 		return -ENOMEM;
 	}
-	/* Adjust the reference in the parent directory entry */
 
-	DEBUGASSERT(newtfo->tfo_dirent);
-	newtfo->tfo_dirent->tde_object = (FAR struct tmpfs_object_s *)newtfo;
+	for (i = 0; i < tfo->tfo_nchunks; i++) {
+		memcpy(map + i * CONFIG_FS_TMPFS_CHUNKSIZE, tfo->tfo_chunks[i], CONFIG_FS_TMPFS_CHUNKSIZE);
+		tmpfs_put_chunk(tfo, i);
+	}
+
+	tmpfs_unmap_file(tfo);
+
+	for (i = 0; i < tfo->tfo_nchunks; i++) {
+		tfo->tfo_chunks[i] = map + i * CONFIG_FS_TMPFS_CHUNKSIZE;
+	}
 
-	/* Return the new address of the reallocated file object */
+	tfo->tfo_map     = map;
+	tfo->tfo_nmapped = tfo->tfo_nchunks;
+	tfo->tfo_alloc  += size;
+
+	sched_lock();
+	g_tmpfs_pool.tp_used += size;
+	if (g_tmpfs_pool.tp_used > g_tmpfs_pool.tp_peak) {
+		g_tmpfs_pool.tp_peak = g_tmpfs_pool.tp_used;
+	}
+	sched_unlock();
 
-	newtfo->tfo_alloc = allocsize;
-	newtfo->tfo_size  = newsize;
-	*tfo              = newtfo;
 	return OK;
 }
 
+/****************************************************************************
+ * Name: tmpfs_resize_file
+ *
+ * Description:
+ *   Add or release chunks so that the file holds 'newsize' bytes.  The
+ *   content of added chunks is not initialized.  On failure the file is
+ *   left unchanged.  Resizing to zero cannot fail.
+ *
+ ****************************************************************************/
+
+static int tmpfs_resize_file(FAR struct tmpfs_file_s *tfo, size_t newsize)
+{
+	FAR uint8_t **slots;
+	size_t nchunks;
+	size_t nslots;
+	unsigned int oldchunks;
+	int ret;
+
+	nchunks = (newsize + CONFIG_FS_TMPFS_CHUNKSIZE - 1) / CONFIG_FS_TMPFS_CHUNKSIZE;
+	if (nchunks > UINT16_MAX) {
+		return -EFBIG;
+	}
+
+	/* Make room for the new chunk pointers.  The array grows in steps so
+	 * that a file growing by small writes does not reallocate it for each
+	 * chunk.
+	 */
+
+	if (nchunks > tfo->tfo_nslots) {
+		nslots = (nchunks + TMPFS_NSLOTS_GROW - 1) & ~(TMPFS_NSLOTS_GROW - 1);
+		if (nslots > UINT16_MAX) {
+			nslots = UINT16_MAX;
+		}
+
+		slots = (FAR uint8_t **)kmm_realloc(tfo->tfo_chunks, nslots * sizeof(FAR uint8_t *));
+		if (slots == NULL) {
+			return -ENOMEM;
+		}
+
+		tfo->tfo_alloc  += (nslots - tfo->tfo_nslots) * sizeof(FAR uint8_t *);
+		tfo->tfo_chunks  = slots;
+		tfo->tfo_nslots  = nslots;
+	}
+
+	/* Add the missing chunks */
+
+	oldchunks = tfo->tfo_nchunks;
+	while (tfo->tfo_nchunks < nchunks) {
+		ret = tmpfs_get_chunk(tfo, tfo->tfo_nchunks);
+		if (ret < 0) {
+			/* Give back what was added by this call */
+
+			while (tfo->tfo_nchunks > oldchunks) {
+				tfo->tfo_nchunks--;
+				tmpfs_put_chunk(tfo, tfo->tfo_nchunks);
+			}
+
+			return ret;
+		}
+
+		tfo->tfo_nchunks++;
+	}
+
+	/* Release the chunks beyond the new end of the file */
+
+	while (tfo->tfo_nchunks > nchunks) {
+		tfo->tfo_nchunks--;
+		tmpfs_put_chunk(tfo, tfo->tfo_nchunks);
+	}
+
+	if (nchunks == 0) {
+		tmpfs_unmap_file(tfo);
+	}
+
+	if (nchunks == 0 && tfo->tfo_chunks != NULL) {
+		kmm_free(tfo->tfo_chunks);
+		tfo->tfo_alloc  -= tfo->tfo_nslots * sizeof(FAR uint8_t *);
+		tfo->tfo_chunks  = NULL;
+		tfo->tfo_nslots  = 0;
+	}
+
+	sched_lock();
+	g_tmpfs_pool.tp_size = g_tmpfs_pool.tp_size - tfo->tfo_size + newsize;
+	sched_unlock();
+
+	tfo->tfo_size = newsize;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: tmpfs_copy_file
+ *
+ * Description:
+ *   Copy 'len' bytes between 'buffer' and the file data at 'pos', into the
+ *   file if 'tofile' is true and out of it otherwise.  A NULL 'buffer'
+ *   with 'tofile' zeroes the range.  The range must lie within the file.
+ *
+ ****************************************************************************/
+
+static void tmpfs_copy_file(FAR struct tmpfs_file_s *tfo, size_t pos,
+		FAR uint8_t *buffer, size_t len, bool tofile)
+{
+	FAR uint8_t *data;
+	size_t offset;
+	size_t ncopy;
+
+	DEBUGASSERT(pos + len <= tfo->tfo_size);
+
+	while (len > 0) {
+		offset = pos % CONFIG_FS_TMPFS_CHUNKSIZE;
+		data   = tfo->tfo_chunks[pos / CONFIG_FS_TMPFS_CHUNKSIZE] + offset;
+		ncopy  = CONFIG_FS_TMPFS_CHUNKSIZE - offset;
+		if (ncopy > len) {
+			ncopy = len;
+		}
+
+		if (!tofile) {
+			memcpy(buffer, data, ncopy);
+		} else if (buffer != NULL) {
+			memcpy(data, buffer, ncopy);
+		} else {
+			memset(data, 0, ncopy);
+		}
+
+		if (buffer != NULL) {
+			buffer += ncopy;
+		}
+
+		pos += ncopy;
+		len -= ncopy;
+	}
+}
+
 /****************************************************************************
  * Name: tmpfs_release_lockedobject
  ****************************************************************************/
@@ -433,6 +796,7 @@ static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo)
 	 */
 
 	if (tfo->tfo_refs == 1 && (tfo->tfo_flags & TFO_FLAG_UNLINKED) != 0) {
+		(void)tmpfs_resize_file(tfo, 0);
 		sem_destroy(&tfo->tfo_exclsem.ts_sem);
 		kmm_free(tfo);
 	}
@@ -571,12 +935,10 @@ static int tmpfs_add_dirent(FAR struct tmpfs_directory_s **tdo,
 static FAR struct tmpfs_file_s *tmpfs_alloc_file(void)
 {
 	FAR struct tmpfs_file_s *tfo;
-	size_t allocsize;
 
-	/* Create a new zero length file object */
+	/* Create a new zero length file object.  It has no data chunks yet. */
 
-	allocsize = SIZEOF_TMPFS_FILE(CONFIG_FS_TMPFS_FILE_ALLOCGUARD);
-	tfo = (FAR struct tmpfs_file_s *)kmm_malloc(allocsize);
+	tfo = (FAR struct tmpfs_file_s *)kmm_malloc(sizeof(struct tmpfs_file_s));
 	if (tfo == NULL) {
 		return NULL;
 	}
@@ -584,11 +946,16 @@ static FAR struct tmpfs_file_s *tmpfs_alloc_file(void)
 	 * locked with one reference count.
 	 */
 
-	tfo->tfo_alloc = allocsize;
-	tfo->tfo_type  = TMPFS_REGULAR;
-	tfo->tfo_refs  = 1;
-	tfo->tfo_flags = 0;
-	tfo->tfo_size  = 0;
+	tfo->tfo_alloc   = sizeof(struct tmpfs_file_s);
+	tfo->tfo_type    = TMPFS_REGULAR;
+	tfo->tfo_refs    = 1;
+	tfo->tfo_flags   = 0;
+	tfo->tfo_nchunks = 0;
+	tfo->tfo_nslots  = 0;
+	tfo->tfo_size    = 0;
+	tfo->tfo_chunks  = NULL;
+	tfo->tfo_map     = NULL;
+	tfo->tfo_nmapped = 0;
 
 	tfo->tfo_exclsem.ts_holder = getpid();
 	tfo->tfo_exclsem.ts_count  = 1;
@@ -1171,6 +1538,10 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
 			tfo->tfo_flags |= TFO_FLAG_UNLINKED;
 			return TMPFS_UNLINKED;
 		}
+
+		/* Release the file data */
+
+		(void)tmpfs_resize_file(tfo, 0);
 	}
 
 	/* Free the object now */
@@ -1316,7 +1687,7 @@ static int tmpfs_open(FAR struct file *filep, FAR const char *relpath,
 			 */
 
 			if (tfo->tfo_size > 0) {
-				ret = tmpfs_realloc_file(&tfo, 0);
+				ret = tmpfs_resize_file(tfo, 0);
 				if (ret < 0)
 					goto errout_with_filelock;
 			}
@@ -1420,6 +1791,7 @@ static int tmpfs_close(FAR struct file *filep)
 		 * have any other references.
 		 */
 
+		(void)tmpfs_resize_file(tfo, 0);
 		kmm_free(tfo);
 		return OK;
 	}
@@ -1460,14 +1832,16 @@ static ssize_t tmpfs_read(FAR struct file *filep, FAR char *buffer,
 	nread    = buflen;
 	endpos   = startpos + buflen;
 
-	if (endpos > tfo->tfo_size) {
+	if (startpos >= tfo->tfo_size) {
+		nread  = 0;
+	} else if (endpos > tfo->tfo_size) {
 		endpos = tfo->tfo_size;
 		nread  = endpos - startpos;
 	}
 
 	/* Copy data from the memory object to the user buffer */
 
-	memcpy(buffer, &tfo->tfo_data[startpos], nread);
+	tmpfs_copy_file(tfo, startpos, (FAR uint8_t *)buffer, nread, false);
 	filep->f_pos += nread;
 
 	/* Release the lock on the file */
@@ -1487,6 +1861,7 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
 	ssize_t nwritten;
 	off_t startpos;
 	off_t endpos;
+	size_t oldsize;
 	int ret;
 
 	fvdbg("filep: %p buffer: %p buflen: %lu\n",
@@ -1507,19 +1882,26 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
 	nwritten = buflen;
 	endpos   = startpos + buflen;
 
-	if (endpos > tfo->tfo_size) {
-		/* Reallocate the file to handle the write past the end of the file. */
+	oldsize  = tfo->tfo_size;
 
-		ret = tmpfs_realloc_file(&tfo, (size_t)endpos);
+	if (endpos > oldsize) {
+		/* Add chunks to handle the write past the end of the file. */
+
+		ret = tmpfs_resize_file(tfo, (size_t)endpos);
 		if (ret < 0) {
 			goto errout_with_lock;
 		}
-		filep->f_priv = tfo;
+
+		/* Zero the hole left by a write starting beyond the end of the file */
+
+		if (startpos > oldsize) {
+			tmpfs_copy_file(tfo, oldsize, NULL, startpos - oldsize, true);
+		}
 	}
 
-	/* Copy data from the memory object to the user buffer */
+	/* Copy data from the user buffer to the memory object */
 
-	memcpy(&tfo->tfo_data[startpos], buffer, nwritten);
+	tmpfs_copy_file(tfo, startpos, (FAR uint8_t *)buffer, nwritten, true);
 	filep->f_pos += nwritten;
 
 	/* Release the lock on the file */
@@ -1611,12 +1993,21 @@ static int tmpfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 	/* Only one ioctl command is supported */
 
 	if (cmd == FIOC_MMAP && ppv != NULL) {
-		/* Return the address on the media corresponding to the start of
-		 * the file.
+		int ret;
+
+		/* Return the address in memory corresponding to the start of the
+		 * file, once its data is contiguous.  An empty file has no data:
+		 * it maps to an address which is not to be accessed.
 		 */
 
-		*ppv = (FAR void *)tfo->tfo_data;
-		return OK;
+		tmpfs_lock_file(tfo);
+		ret = tmpfs_map_file(tfo);
+		if (ret == OK) {
+			*ppv = tfo->tfo_nchunks > 0 ? (FAR void *)tfo->tfo_chunks[0] : (FAR void *)&g_tmpfs_nodata;
+		}
+		tmpfs_unlock_file(tfo);
+
+		return ret;
 	}
 
 	fdbg("ERROR: Invalid cmd: %d\n", cmd);
@@ -1717,20 +2108,18 @@ static int tmpfs_truncate(FAR struct file *filep, off_t length)
 
 	oldsize = tfo->tfo_size;
 	if (oldsize != length) {
-		/* The size is changing.. up or down.  Reallocate the file memory. */
-		ret = tmpfs_realloc_file(&tfo, (size_t)length);
+		/* The size is changing.. up or down.  Add or release chunks. */
+		ret = tmpfs_resize_file(tfo, (size_t)length);
 		if (ret < 0) {
 			goto errout_with_lock;
 		}
 
-		filep->f_priv = tfo;
-
 		/* If the size has increased, then we need to zero the newly added
 		 * memory.
 		 */
 
 		if (length > oldsize) {
-		  memset(&tfo->tfo_data[oldsize], 0, length - oldsize);
+			tmpfs_copy_file(tfo, oldsize, NULL, length - oldsize, true);
 		}
 		ret = OK;
 	}
@@ -1926,6 +2315,8 @@ static int tmpfs_bind(FAR struct inode *blkdriver, FAR const void *data,
 		return -ENOMEM;
 	}
 
+	tmpfs_pool_attach();
+
 	fs->tfs_root.tde_object = (FAR struct tmpfs_object_s *)tdo;
 	fs->tfs_root.tde_name   = "";
 
@@ -1973,6 +2364,8 @@ static int tmpfs_unbind(FAR void *handle, FAR struct inode **blkdriver)
 
 	sem_destroy(&fs->tfs_exclsem.ts_sem);
 	kmm_free(fs);
+
+	tmpfs_pool_detach();
 	return ret;
 }
 
@@ -2019,6 +2412,7 @@ static int tmpfs_statfs(FAR struct inode *mountpt, FAR struct statfs *buf)
 
 	ret = tmpfs_foreach(tdo, tmpfs_statfs_callout, (FAR void *)&tmpbuf);
 	if (ret < 0) {
+		tmpfs_unlock(fs);
 		return -ECANCELED;
 	}
 	/* Return something for the file system description */
@@ -2037,6 +2431,15 @@ static int tmpfs_statfs(FAR struct inode *mountpt, FAR struct statfs *buf)
 	buf->f_files    = tmpbuf.tsf_files;
 	buf->f_ffree    = tmpbuf.tsf_ffree;
 
+#if CONFIG_FS_TMPFS_QUOTA > 0
+	/* With a quota, the size is known: report what is left of it as free */
+
+	buf->f_blocks   = CONFIG_FS_TMPFS_QUOTA / CONFIG_FS_TMPFS_BLOCKSIZE;
+	buf->f_bfree    = (CONFIG_FS_TMPFS_QUOTA - g_tmpfs_pool.tp_used) /
+		CONFIG_FS_TMPFS_BLOCKSIZE;
+	buf->f_bavail   = buf->f_bfree;
+#endif
+
 	/* Release the lock on the file system */
 
 	tmpfs_unlock(fs);
@@ -2116,6 +2519,7 @@ static int tmpfs_unlink(FAR struct inode *mountpt, FAR const char *relpath)
 	/* Otherwise we can free the object now */
 
 	else {
+		(void)tmpfs_resize_file(tfo, 0);
 		sem_destroy(&tfo->tfo_exclsem.ts_sem);
 		kmm_free(tfo);
 	}
@@ -2483,3 +2887,22 @@ errout_with_fslock:
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tmpfs_getstats
+ ****************************************************************************/
+
+void tmpfs_getstats(FAR struct tmpfs_stats_s *stats)
+{
+	DEBUGASSERT(stats != NULL);
+
+	sched_lock();
+	stats->chunksize  = CONFIG_FS_TMPFS_CHUNKSIZE;
+	stats->poolchunks = g_tmpfs_pool.tp_slab != NULL ? CONFIG_FS_TMPFS_POOL_NCHUNKS : 0;
+	stats->poolfree   = g_tmpfs_pool.tp_nfree;
+	stats->used       = g_tmpfs_pool.tp_used;
+	stats->peak       = g_tmpfs_pool.tp_peak;
+	stats->size       = g_tmpfs_pool.tp_size;
+	stats->quota      = CONFIG_FS_TMPFS_QUOTA;
+	stats->nquota     = g_tmpfs_pool.tp_nquota;
+	sched_unlock();
+}
@@ -158,6 +158,17 @@ struct tmpfs_directory_s {
  * state.  The file memory object also serves as the open file object,
  * saving an allocation.  This has the negative side effect that no per-
  * open state can be retained (such as open flags).
+ *
+ * The file data is held in fixed size chunks of CONFIG_FS_TMPFS_CHUNKSIZE
+ * bytes taken from the tmpfs chunk pool.  Byte 'pos' of the file is in
+ * chunk tfo_chunks[pos / CONFIG_FS_TMPFS_CHUNKSIZE].  Only the array of
+ * chunk pointers is ever reallocated, so the file object itself does not
+ * move when the file grows.
+ *
+ * A file is made contiguous for mmap() by copying its chunks into a single
+ * block, tfo_map.  The first tfo_nmapped chunk pointers then point into
+ * that block, and those slots are reused rather than reallocated as the
+ * file shrinks and grows again, until it is truncated to zero.
  */
 
 struct tmpfs_file_s {
@@ -166,18 +177,33 @@ struct tmpfs_file_s {
 	FAR struct tmpfs_dirent_s *tfo_dirent;
 	struct tmpfs_sem_s tfo_exclsem;
 
-	size_t   tfo_alloc;    /* Allocated size of the file object */
+	size_t   tfo_alloc;    /* Allocated size of the file object and its data */
 	uint8_t  tfo_type;     /* See enum tmpfs_objtype_e */
 	uint8_t  tfo_refs;     /* Reference count */
 
 	/* Remaining fields are unique to a directory object */
 
 	uint8_t  tfo_flags;    /* See TFO_FLAG_* definitions */
+	uint16_t tfo_nchunks;  /* Number of chunks holding file data */
+	uint16_t tfo_nslots;   /* Allocated entries in tfo_chunks[] */
 	size_t   tfo_size;     /* Valid file size */
-	uint8_t  tfo_data[1];  /* File data starts here */
+	FAR uint8_t **tfo_chunks; /* File data chunks */
+	FAR uint8_t *tfo_map;  /* Contiguous block of the mapped file, or NULL */
+	uint16_t tfo_nmapped;  /* Number of chunks in tfo_map */
 };
 
-#define SIZEOF_TMPFS_FILE(n) (sizeof(struct tmpfs_file_s) + (n) - 1)
+/* Pool of file data chunks shared by all TMPFS instances */
+
+struct tmpfs_pool_s {
+	FAR uint8_t *tp_slab;  /* Preallocated chunks (NULL if not allocated) */
+	FAR void *tp_freelist; /* Free chunks of the slab */
+	uint16_t tp_nfree;     /* Number of chunks in tp_freelist */
+	uint16_t tp_nmounts;   /* Number of bound TMPFS instances */
+	size_t   tp_used;      /* Memory held in chunks by files */
+	size_t   tp_peak;      /* Largest value of tp_used */
+	size_t   tp_size;      /* Sum of the sizes of all files */
+	uint32_t tp_nquota;    /* Chunk allocations refused by the quota */
+};
 
 /* This structure represents one instance of a TMPFS file system */
 
@@ -0,0 +1,241 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/vfs/fs_epoll.c
+ *
+ * An epoll descriptor is a file descriptor on an inode that has no name in
+ * the pseudo file system. The inode holds the instance created by the
+ * network stack, which keeps the interest list and the ready list. The
+ * inode is freed by inode_release() when its last descriptor is closed.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/epoll.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/cancelpt.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/net/net.h>
+
+#include "inode/inode.h"
+
+#ifdef CONFIG_NET_EPOLL
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int epoll_close(FAR struct file *filep);
+#ifndef CONFIG_DISABLE_POLL
+static int epoll_poll(FAR struct file *filep, FAR struct pollfd *fds, bool setup);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct file_operations g_epoll_fops = {
+	NULL,						/* open */
+	epoll_close,				/* close */
+	NULL,						/* read */
+	NULL,						/* write */
+	NULL,						/* seek */
+	NULL,						/* ioctl */
+#ifndef CONFIG_DISABLE_POLL
+	epoll_poll,					/* poll */
+#endif
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static int epoll_close(FAR struct file *filep)
+{
+	FAR struct inode *inode = filep->f_inode;
+
+	/* The instance lives as long as the inode: keep it while other
+	 * descriptors, dup()'ed or inherited, refer to it.
+	 */
+
+	if (inode->i_crefs <= 1) {
+		net_epoll_close(inode->i_private);
+		inode->i_private = NULL;
+	}
+
+	return OK;
+}
+
+#ifndef CONFIG_DISABLE_POLL
+static int epoll_poll(FAR struct file *filep, FAR struct pollfd *fds, bool setup)
+{
+	return net_epoll_poll(filep->f_inode->i_private, fds, setup);
+}
+#endif
+
+/* Return the instance of the epoll descriptor 'epfd', NULL with errno set
+ * if 'epfd' is not one.
+ */
+
+static FAR void *epoll_instance(int epfd)
+{
+	FAR struct file *filep;
+	int ret;
+
+	ret = fs_getfilep(epfd, &filep);
+	if (ret < 0) {
+		set_errno(-ret);
+		return NULL;
+	}
+
+	if (filep->f_inode == NULL) {
+		set_errno(EBADF);
+		return NULL;
+	}
+
+	if (filep->f_inode->u.i_ops != &g_epoll_fops) {
+		set_errno(EINVAL);
+		return NULL;
+	}
+
+	return filep->f_inode->i_private;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: epoll_create1
+ *
+ * Description:
+ *   Open an epoll instance. See sys/epoll.h.
+ *
+ ****************************************************************************/
+
+int epoll_create1(int flags)
+{
+	FAR struct inode *inode;
+	int fd;
+
+	if ((flags & ~EPOLL_CLOEXEC) != 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	inode = (FAR struct inode *)kmm_zalloc(sizeof(struct inode));
+	if (inode == NULL) {
+		set_errno(ENOMEM);
+		return ERROR;
+	}
+
+	inode->i_private = net_epoll_create();
+	if (inode->i_private == NULL) {
+		kmm_free(inode);
+		return ERROR;
+	}
+
+	/* A driver inode outside of the tree, deleted so that inode_release()
+	 * frees it with the last descriptor.
+	 */
+
+	INODE_SET_DRIVER(inode);
+	inode->i_flags |= FSNODEFLAG_DELETED;
+	inode->i_crefs = 1;
+	inode->u.i_ops = &g_epoll_fops;
+
+	fd = files_allocate(inode, O_RDWR, 0, 0);
+	if (fd < 0) {
+		net_epoll_close(inode->i_private);
+		kmm_free(inode);
+		set_errno(EMFILE);
+		return ERROR;
+	}
+
+	return fd;
+}
+
+int epoll_create(int size)
+{
+	if (size <= 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	return epoll_create1(0);
+}
+
+/****************************************************************************
+ * Name: epoll_ctl
+ *
+ * Description:
+ *   Add, modify or remove a socket in the interest list of an epoll
+ *   instance. See sys/epoll.h.
+ *
+ ****************************************************************************/
+
+int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *event)
+{
+	FAR void *ep;
+
+	ep = epoll_instance(epfd);
+	if (ep == NULL) {
+		return ERROR;
+	}
+
+	return net_epoll_ctl(ep, op, fd, event);
+}
+
+/****************************************************************************
+ * Name: epoll_wait
+ *
+ * Description:
+ *   Wait for events on an epoll instance. See sys/epoll.h.
+ *
+ ****************************************************************************/
+
+int epoll_wait(int epfd, FAR struct epoll_event *events, int maxevents, int timeout)
+{
+	FAR void *ep;
+	int ret;
+
+	/* epoll_wait() is a cancellation point */
+
+	(void)enter_cancellation_point();
+
+	ep = epoll_instance(epfd);
+	if (ep == NULL) {
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	ret = net_epoll_wait(ep, events, maxevents, timeout);
+	leave_cancellation_point();
+	return ret;
+}
+
+#endif							/* CONFIG_NET_EPOLL */
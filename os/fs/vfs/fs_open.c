@@ -67,6 +67,7 @@
 
 #include <tinyara/cancelpt.h>
 #include <tinyara/fs/fs.h>
+#include <tinyara/drvinit.h>
 
 #include "inode/inode.h"
 #include "driver/block/driver.h"
@@ -135,6 +136,10 @@ int vopen(FAR const char *path, int oflags, va_list ap)
 	}
 #endif
 
+	/* A device may still be initialized by a worker thread */
+
+	drvinit_wait(path);
+
 	/* Get an inode for this file */
 
 	inode = inode_find(path, &relpath);
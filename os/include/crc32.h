@@ -102,6 +102,19 @@ uint32_t crc32part(FAR const uint8_t *src, size_t len, uint32_t crc32val);
 
 uint32_t crc32(FAR const uint8_t *src, size_t len);
 
+/**
+ * @brief  Return the 32-bit CRC of two parts of data from the CRC of each part
+ *
+ * @details @b #include <crc32.h>
+ * @param[in] crc1 CRC of the first part
+ * @param[in] crc2 CRC of the second part, calculated from 0
+ * @param[in] len2 length of the second part
+ * @return The CRC of the first part followed by the second part.
+ * @since TizenRT v5.0
+ */
+
+uint32_t crc32combine(uint32_t crc1, uint32_t crc2, size_t len2);
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -143,24 +143,24 @@ int get_errno(void);
 /* C-99 style variadic macros are supported */
 
 #ifdef CONFIG_DEBUG
-/* Temporary LOGM macros to route all dbg messages.
- * Once LOGM is approved, each module should have its own index
- */
-#define LOGM_IDX (0)
+/* Index of the module for LOGM, see enum logm_logindex_e */
+#ifndef LOGM_IDX
+#define LOGM_IDX LOGM_UNKNOWN
+#endif
 
 #ifdef CONFIG_DEBUG_ERROR
 #ifdef CONFIG_LOGM
 #define dbg(format, ...) \
-	logm(LOGM_NORMAL, LOGM_IDX, LOGM_ERR, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_NORMAL, LOGM_IDX, LOGM_ERR, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
 
 #define dbg_noarg(format, ...) \
-	logm(LOGM_NORMAL, LOGM_IDX, LOGM_ERR, format, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_NORMAL, LOGM_IDX, LOGM_ERR, format, ##__VA_ARGS__)
 
 #define lldbg(format, ...) \
-	logm(LOGM_LOWPUT, LOGM_IDX, LOGM_ERR, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_LOWPUT, LOGM_IDX, LOGM_ERR, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
 
 #define lldbg_noarg(format, ...) \
-	logm(LOGM_LOWPUT, LOGM_IDX, LOGM_ERR, format, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_LOWPUT, LOGM_IDX, LOGM_ERR, format, ##__VA_ARGS__)
 
 #else
 /**
@@ -203,16 +203,16 @@ int get_errno(void);
 #ifdef CONFIG_DEBUG_WARN
 #ifdef CONFIG_LOGM
 #define wdbg(format, ...) \
-	logm(LOGM_NORMAL, LOGM_IDX, LOGM_WRN, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_NORMAL, LOGM_IDX, LOGM_WRN, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
 
 #define wdbg_noarg(format, ...) \
-	logm(LOGM_NORMAL, LOGM_IDX, LOGM_WRN, format, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_NORMAL, LOGM_IDX, LOGM_WRN, format, ##__VA_ARGS__)
 
 #define llwdbg(format, ...) \
-	logm(LOGM_LOWPUT, LOGM_IDX, LOGM_WRN, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_LOWPUT, LOGM_IDX, LOGM_WRN, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
 
 #define llwdbg_noarg(format, ...) \
-	logm(LOGM_LOWPUT, LOGM_IDX, LOGM_WRN, format, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_LOWPUT, LOGM_IDX, LOGM_WRN, format, ##__VA_ARGS__)
 
 #else
 /**
@@ -254,16 +254,16 @@ int get_errno(void);
 #ifdef CONFIG_DEBUG_VERBOSE
 #ifdef CONFIG_LOGM
 #define vdbg(format, ...) \
-	logm(LOGM_NORMAL, LOGM_IDX, LOGM_INF, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_NORMAL, LOGM_IDX, LOGM_INF, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
 
 #define vdbg_noarg(format, ...) \
-	logm(LOGM_NORMAL, LOGM_IDX, LOGM_INF, format, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_NORMAL, LOGM_IDX, LOGM_INF, format, ##__VA_ARGS__)
 
 #define llvdbg(format, ...) \
-	logm(LOGM_LOWPUT, LOGM_IDX, LOGM_INF, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_LOWPUT, LOGM_IDX, LOGM_INF, EXTRA_FMT format EXTRA_ARG, ##__VA_ARGS__)
 
 #define llvdbg_noarg(format, ...) \
-	logm(LOGM_LOWPUT, LOGM_IDX, LOGM_INF, format, ##__VA_ARGS__)
+	LOGM_PRINT(LOGM_LOWPUT, LOGM_IDX, LOGM_INF, format, ##__VA_ARGS__)
 
 #else
 /**
@@ -325,6 +325,16 @@ b16_t b16cos(b16_t rad);
  */
 b16_t b16atan2(b16_t y, b16_t x);
 
+/* Root Functions */
+/**
+ * @brief Square root of an unsigned b16 number
+ * @details @b #include <fixedmath.h>
+ * @param[in] a an unsigned b16 value
+ * @return the square root of a, within 0.51 of its last bit
+ * @since TizenRT v5.0
+ */
+ub16_t ub16sqrt(ub16_t a);
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
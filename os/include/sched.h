@@ -69,6 +69,7 @@
 
 #include <sys/types.h>
 #include <stdint.h>
+#include <time.h>
 #include <tinyara/sched.h>
 
 /********************************************************************************
@@ -85,7 +86,7 @@
 
 #define SCHED_FIFO     1		/* FIFO per priority scheduling policy */
 #define SCHED_RR       2		/* Round robin scheduling policy */
-#define SCHED_SPORADIC 3		/* Not supported */
+#define SCHED_SPORADIC 3		/* Sporadic server, with CONFIG_SCHED_SPORADIC */
 #define SCHED_OTHER    4		/* Not supported */
 
 
@@ -222,6 +223,12 @@
  */
 struct sched_param {
 	int sched_priority;
+#ifdef CONFIG_SCHED_SPORADIC
+	int sched_ss_low_priority;	/* Priority once the budget is used */
+	struct timespec sched_ss_repl_period;	/* Replenishment period */
+	struct timespec sched_ss_init_budget;	/* Budget of each period */
+	int sched_ss_max_repl;		/* Not used, the budget is replenished at once */
+#endif
 };
 
 /********************************************************************************
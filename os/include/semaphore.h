@@ -78,6 +78,15 @@
 #define SAVE_SEM_HOLDER 1
 #endif
 
+/* With CONFIG_SEM_INLINE_HOLDER, a semaphore keeps its first holder in the
+ * semaphore itself and only takes holders from the preallocated pool when
+ * it is held by several threads at once.  A mutex thus never uses the pool.
+ */
+
+#if defined(SAVE_SEM_HOLDER) && CONFIG_SEM_PREALLOCHOLDERS > 0 && defined(CONFIG_SEM_INLINE_HOLDER)
+#define SEM_INLINE_HOLDER 1
+#endif
+
 /* Bit definitions for the struct sem_s flags field */
 
 #define PRIOINHERIT_FLAGS_DISABLE (1 << 0) /* Bit 0: Priority inheritance
@@ -132,6 +141,9 @@ struct sem_s {
 #ifdef SAVE_SEM_HOLDER
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
 	FAR struct semholder_s *hhead;	/* List of holders of semaphore counts */
+#ifdef SEM_INLINE_HOLDER
+	struct semholder_s holder;	/* First holder, not in the list */
+#endif
 #else
 	struct semholder_s holder;	/* Single holder */
 #endif
@@ -152,13 +164,17 @@ typedef struct sem_s sem_t;
  */
 #ifdef SAVE_SEM_HOLDER
 #ifdef CONFIG_BINARY_MANAGER
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#if defined(SEM_INLINE_HOLDER)
+#define SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED, NULL, SEMHOLDER_INITIALIZER} /* flink, semcount, flags, hhead, holder */
+#elif CONFIG_SEM_PREALLOCHOLDERS > 0
 #define SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED, NULL} /* flink, semcount, flags, hhead */
 #else
 #define SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED, SEMHOLDER_INITIALIZER} /* flink, semcount, flags, holder */
 #endif
 #else // CONFIG_BINARY_MANAGER
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#if defined(SEM_INLINE_HOLDER)
+#define SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED, NULL, SEMHOLDER_INITIALIZER} /* semcount, flags, hhead, holder */
+#elif CONFIG_SEM_PREALLOCHOLDERS > 0
 #define SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED, NULL} /* semcount, flags, hhead */
 #else
 #define SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED, SEMHOLDER_INITIALIZER} /* semcount, flags, holder */
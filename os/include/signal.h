@@ -148,6 +148,13 @@
 
 /* The following are non-standard signal definitions */
 
+/* SIGTM_MONITOR is used by the Task Monitor to notify the Task Manager */
+#ifndef CONFIG_SIG_SIGTM_MONITOR
+#define SIGTM_MONITOR	13
+#else
+#define SIGTM_MONITOR	CONFIG_SIG_SIGTM_MONITOR
+#endif
+
 /* SIG_PREFERENCE is used for preference */
 #ifndef CONFIG_SIG_PREFERENCE
 #define SIG_PREFERENCE	14
@@ -123,6 +123,8 @@ struct mallinfo {
 								 * chunks handed out by malloc. */
 	int fordblks;				/* This is the total size of memory occupied
 								 * by free (not in use) chunks. */
+	int fragratio;				/* External fragmentation in percent,
+								 * 100 * (1 - mxordblk / fordblks) */
 
 };
 
@@ -0,0 +1,165 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * @defgroup EPOLL_KERNEL EPOLL
+ * @brief Provides APIs for socket event notification
+ * @ingroup KERNEL
+ *
+ * @{
+ */
+
+/// @file sys/epoll.h
+/// @brief I/O event notification for sockets
+
+#ifndef __INCLUDE_SYS_EPOLL_H
+#define __INCLUDE_SYS_EPOLL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <poll.h>
+
+#ifdef CONFIG_NET_EPOLL
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/* epoll_ctl() operations */
+
+#define EPOLL_CTL_ADD     1		/* Add a descriptor to the interest list */
+#define EPOLL_CTL_DEL     2		/* Remove a descriptor from the interest list */
+#define EPOLL_CTL_MOD     3		/* Change the events of a descriptor */
+
+/* Events. The lower bits have the values of the poll() events. */
+
+#define EPOLLIN           POLLIN
+#define EPOLLPRI          POLLPRI
+#define EPOLLOUT          POLLOUT
+#define EPOLLERR          POLLERR	/* Always reported */
+#define EPOLLHUP          POLLHUP	/* Always reported */
+#define EPOLLONESHOT      (1u << 30)	/* Disable the descriptor once reported */
+#define EPOLLET           (1u << 31)	/* Report state changes only */
+
+/* epoll_create1() flags */
+
+#define EPOLL_CLOEXEC     (1 << 0)	/* Accepted for compatibility, there is no exec() */
+
+/****************************************************************************
+ * Type Definitions
+ ****************************************************************************/
+
+typedef union epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} epoll_data_t;
+
+struct epoll_event {
+	uint32_t events;			/* Epoll events */
+	epoll_data_t data;			/* User data returned with the events */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/**
+ * @ingroup EPOLL_KERNEL
+ * @brief open an epoll instance
+ * @details @b #include <sys/epoll.h> \n
+ * SYSTEM CALL API \n
+ * The instance keeps its interest list between epoll_wait() calls and the
+ * network stack queues the descriptors that become ready, so the cost of a
+ * wait does not grow with the number of descriptors watched.
+ * Only socket descriptors can be added. The returned descriptor can itself
+ * be watched with poll() or select(), which report it readable while
+ * descriptors are ready.
+ * @param[in] size ignored, must be greater than zero
+ * @return On success, a file descriptor. On failure, -1 is returned and
+ *         errno is set.
+ * @since TizenRT v4.1
+ */
+EXTERN int epoll_create(int size);
+
+/**
+ * @ingroup EPOLL_KERNEL
+ * @brief open an epoll instance
+ * @details @b #include <sys/epoll.h> \n
+ * SYSTEM CALL API \n
+ * @param[in] flags 0 or EPOLL_CLOEXEC
+ * @return On success, a file descriptor. On failure, -1 is returned and
+ *         errno is set.
+ * @since TizenRT v4.1
+ */
+EXTERN int epoll_create1(int flags);
+
+/**
+ * @ingroup EPOLL_KERNEL
+ * @brief add, modify or remove a socket in the interest list of an epoll instance
+ * @details @b #include <sys/epoll.h> \n
+ * SYSTEM CALL API \n
+ * A socket is removed from the interest list when it is closed.
+ * @param[in] epfd the epoll instance
+ * @param[in] op EPOLL_CTL_ADD, EPOLL_CTL_MOD or EPOLL_CTL_DEL
+ * @param[in] fd the socket
+ * @param[in] event the events to watch and the data to report with them,
+ *            ignored by EPOLL_CTL_DEL
+ * @return On success, 0. On failure, -1 is returned and errno is set.
+ * @since TizenRT v4.1
+ */
+EXTERN int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *event);
+
+/**
+ * @ingroup EPOLL_KERNEL
+ * @brief wait for events on an epoll instance
+ * @details @b #include <sys/epoll.h> \n
+ * SYSTEM CALL API \n
+ * @param[in] epfd the epoll instance
+ * @param[out] events the ready descriptors
+ * @param[in] maxevents the size of events, greater than zero
+ * @param[in] timeout milliseconds to wait, -1 to wait forever
+ * @return the number of ready descriptors, 0 on timeout. On failure, -1 is
+ *         returned and errno is set.
+ * @since TizenRT v4.1
+ */
+EXTERN int epoll_wait(int epfd, FAR struct epoll_event *events, int maxevents, int timeout);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif							/* CONFIG_NET_EPOLL */
+
+#endif							/* __INCLUDE_SYS_EPOLL_H */
+/**
+ * @} */
@@ -104,6 +104,33 @@
  *
  *      int ppid;
  *      prctl(PR_GET_TGTASK, &ppid);
+ *
+ *  PR_SET_TIMERSLACK
+ *    Let the sleeps of the calling thread end up to arg1 (int) milliseconds
+ *    late, so that their wake-ups are batched with other timer events.
+ *    Periodic threads which do not need precise timing save wake-ups with
+ *    it.  Zero, the default, restores exact timing. As an example:
+ *
+ *      prctl(PR_SET_TIMERSLACK, 100);
+ *
+ *  PR_GET_TIMERSLACK
+ *    Return the timer slack of the calling thread in milliseconds through
+ *    arg1 (int *).
+ *
+ *  PR_BEGIN_PREFERENCE
+ *    Start a preference transaction of the calling thread. Keys it sets
+ *    from then on are kept until PR_COMMIT_PREFERENCE writes them together
+ *    and notifies their callbacks once, or PR_DISCARD_PREFERENCE drops them.
+ *
+ *      prctl(PR_BEGIN_PREFERENCE);
+ *
+ *  PR_MONITOR_SET_BUDGET
+ *    Give the calling thread a CPU budget in the task monitor: arg1 (int)
+ *    percent of the time of a CPU over each window, 0 to remove it.  A
+ *    thread over its budget is reported to the task manager.  As an
+ *    example:
+ *
+ *      prctl(PR_MONITOR_SET_BUDGET, 20);
  */
 
 /**
@@ -134,7 +161,13 @@ enum prctl_type_e {
 	PR_REBOOT_REASON_CLEAR,
 	PR_SET_SECURITY_LEVEL,
 	PR_GET_SECURITY_LEVEL,
-	PR_GET_TGTASK
+	PR_GET_TGTASK,
+	PR_SET_TIMERSLACK,
+	PR_GET_TIMERSLACK,
+	PR_BEGIN_PREFERENCE,
+	PR_COMMIT_PREFERENCE,
+	PR_DISCARD_PREFERENCE,
+	PR_MONITOR_SET_BUDGET
 };
 
 /****************************************************************************
@@ -143,6 +143,13 @@ struct msghdr {
 	int msg_flags;                 /* flags on received message */
 };
 
+struct mmsghdr {
+	struct msghdr msg_hdr;         /* message header */
+	unsigned int msg_len;          /* # bytes transmitted */
+};
+
+struct timespec;
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -376,6 +383,35 @@ ssize_t recvmsg(int sockfd, struct msghdr *msg, int flags);
 */
 ssize_t sendmsg(int sockfd, struct msghdr *msg, int flags);
 
+/**
+* @brief  receive multiple messages from a socket
+*
+* @details @b #include <sys/socket.h>\n
+* SYSTEM CALL API\n
+* @param[in] sockfd the file descriptor associated with the socket.
+* @param[inout] msgvec the messages to receive into; msg_len is set to the length of each.
+* @param[in] vlen the number of messages in msgvec.
+* @param[in] flags the type of message reception, MSG_WAITFORONE included.
+* @param[in] timeout null or the time after which no more messages are received, checked after each message.
+* @return On success, the number of messages received is returned. On failure, -1 is returned.
+* @since TizenRT v4.1
+*/
+int recvmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen, int flags, struct timespec *timeout);
+
+/**
+* @brief  send multiple messages on a socket
+*
+* @details @b #include <sys/socket.h>\n
+* SYSTEM CALL API\n
+* @param[in] sockfd the file descriptor associated with the socket.
+* @param[inout] msgvec the messages to send; msg_len is set to the length of each sent.
+* @param[in] vlen the number of messages in msgvec.
+* @param[in] flags the type of message transmission.
+* @return On success, the number of messages sent is returned. On failure, -1 is returned.
+* @since TizenRT v4.1
+*/
+int sendmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen, int flags);
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -480,16 +480,35 @@
 #define SYS_setsockopt                 (__SYS_network + 13)
 #define SYS_shutdown                   (__SYS_network + 14)
 #define SYS_socket                     (__SYS_network + 15)
-#define __SYS_prctl                    (__SYS_network + 16)
+#define SYS_recvmmsg                   (__SYS_network + 16)
+#define SYS_sendmmsg                   (__SYS_network + 17)
+#define __SYS_epoll                    (__SYS_network + 18)
 #else
-#define __SYS_prctl                    __SYS_network
+#define __SYS_epoll                    __SYS_network
+#endif
+
+/* The following are defined only if epoll() is supported */
+
+#ifdef CONFIG_NET_EPOLL
+#define SYS_epoll_create               (__SYS_epoll + 0)
+#define SYS_epoll_create1              (__SYS_epoll + 1)
+#define SYS_epoll_ctl                  (__SYS_epoll + 2)
+#define SYS_epoll_wait                 (__SYS_epoll + 3)
+#define __SYS_prctl                    (__SYS_epoll + 4)
+#else
+#define __SYS_prctl                    __SYS_epoll
 #endif
 
 #define SYS_prctl                      __SYS_prctl
 
 #define SYS_fin_wait                   SYS_prctl + 1
 
+#ifdef CONFIG_LIB_SYSCALL_BATCH
+#define SYS_syscall_batch              (SYS_fin_wait + 1)
+#define SYS_maxsyscall                 (SYS_fin_wait + 2)
+#else
 #define SYS_maxsyscall                 (SYS_fin_wait + 1)
+#endif
 
 /* Note that the reported number of system calls does *NOT* include the
  * architecture-specific system calls.  If the "real" total is required,
@@ -96,6 +96,23 @@
 #define CONFIG_ADC_NPOLLWAITERS 2
 #endif
 
+#ifdef CONFIG_ADC_SCAN
+#if !defined(CONFIG_ADC_SCAN_NCHANNELS)
+#define CONFIG_ADC_SCAN_NCHANNELS 8
+#endif
+
+#if !defined(CONFIG_ADC_SCAN_BLOCKSIZE)
+#define CONFIG_ADC_SCAN_BLOCKSIZE 256
+#endif
+
+#if !defined(CONFIG_ADC_SCAN_NBLOCKS)
+#define CONFIG_ADC_SCAN_NBLOCKS 4
+#elif CONFIG_ADC_SCAN_NBLOCKS > 255
+#undef  CONFIG_ADC_SCAN_NBLOCKS
+#define CONFIG_ADC_SCAN_NBLOCKS 255
+#endif
+#endif
+
 #define ADC_RESET(dev)         ((dev)->ad_ops->ao_reset((dev)))
 #define ADC_SETUP(dev)         ((dev)->ad_ops->ao_setup((dev)))
 #define ADC_SHUTDOWN(dev)      ((dev)->ad_ops->ao_shutdown((dev)))
@@ -125,6 +142,22 @@ struct adc_callback_s {
 
 	CODE int (*au_receive)(FAR struct adc_dev_s *dev, uint8_t ch,
 			       int32_t data);
+
+#ifdef CONFIG_ADC_SCAN
+	/*
+	 * This method is called from the lower half each time one half of the
+	 * scan buffer given to ao_scanstart() is filled.  The lower half goes
+	 * on with the other half while the upper half copies this one.
+	 *
+	 * Input Parameters:
+	 *   dev      - The ADC device structure
+	 *   samples  - The filled half of the scan buffer
+	 *   nsamples - The number of samples in it, a whole number of scans
+	 */
+
+	CODE void (*au_receive_block)(FAR struct adc_dev_s *dev,
+				      FAR const uint16_t *samples, size_t nsamples);
+#endif
 };
 
 /* This describes on ADC message */
@@ -134,6 +167,32 @@ struct adc_msg_s {
 	int32_t am_data;	/* ADC convert result (4 bytes) */
 } packed_struct;
 
+#ifdef CONFIG_ADC_SCAN
+/* A continuous scan, started with ANIOC_SCAN_START.  Each scan converts the
+ * channels in the order of as_channels[].
+ */
+
+struct adc_scan_s {
+	uint32_t as_rate;			/* Scans per second, 0 for as fast as the lower half goes */
+	uint8_t  as_nchannels;			/* Number of channels in as_channels[] */
+	uint8_t  as_channels[CONFIG_ADC_SCAN_NCHANNELS];
+};
+
+/* A block of scans, as returned by read() while a scan runs.  ab_data[]
+ * holds ab_nsamples raw samples, ab_nchannels consecutive samples per scan.
+ * The scans are evenly spaced by ab_period between two blocks.
+ */
+
+struct adc_block_s {
+	uint64_t ab_timestamp;			/* Time of the first scan in microseconds */
+	uint32_t ab_period;			/* Microseconds between two scans */
+	uint16_t ab_nsamples;			/* Number of samples in ab_data[] */
+	uint8_t  ab_nchannels;			/* Number of samples in one scan */
+	uint8_t  ab_overrun;			/* Blocks lost just before this one */
+	uint16_t ab_data[CONFIG_ADC_SCAN_BLOCKSIZE];
+};
+#endif
+
 /* This describes a FIFO of ADC messages */
 
 struct adc_fifo_s {
@@ -191,6 +250,22 @@ struct adc_ops_s {
 	/* All ioctl calls will be routed through this method */
 
 	CODE int (*ao_ioctl)(FAR struct adc_dev_s *dev, int cmd, unsigned long arg);
+
+#ifdef CONFIG_ADC_SCAN
+	/*
+	 * Start a continuous scan into buffer, used as a circular buffer of
+	 * two halves of nsamples / 2 samples each.  au_receive_block() is
+	 * called for each filled half.  NULL if the lower half cannot scan.
+	 */
+
+	CODE int (*ao_scanstart)(FAR struct adc_dev_s *dev,
+				 FAR const struct adc_scan_s *scan,
+				 FAR uint16_t *buffer, size_t nsamples);
+
+	/* Stop the scan.  No au_receive_block() call follows. */
+
+	CODE void (*ao_scanstop)(FAR struct adc_dev_s *dev);
+#endif
 };
 
 /*
@@ -221,6 +296,17 @@ struct adc_dev_s {
 	struct pollfd *fds[CONFIG_ADC_NPOLLWAITERS];
 #endif
 
+#ifdef CONFIG_ADC_SCAN
+	/* Continuous scan state */
+
+	FAR uint16_t           *ad_scanbuf;   /* Both halves of the lower half buffer */
+	FAR struct adc_block_s *ad_blocks;    /* Ring of CONFIG_ADC_SCAN_NBLOCKS blocks */
+	uint64_t          ad_lastscan;   /* Time of the last scan of the previous block */
+	uint8_t           ad_scanch;     /* Channels per scan, 0 if no scan runs */
+	uint8_t           ad_bhead;      /* Oldest block in ad_blocks[] */
+	uint8_t           ad_bcount;     /* Number of blocks in ad_blocks[] */
+#endif
+
 #endif /* CONFIG_ADC */
 
 	/* Fields provided by lower half ADC logic */
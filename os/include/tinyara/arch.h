@@ -146,6 +146,13 @@
 typedef CODE void (*sig_deliver_t)(FAR struct tcb_s *tcb);
 typedef CODE void (*phy_enable_t)(bool enable);
 
+/* A region of memory for the cache maintenance of a scatter-gather list */
+
+struct dcache_range_s {
+	uintptr_t start;			/* Virtual start address of the region */
+	uintptr_t end;				/* Virtual end address of the region + 1 */
+};
+
 /****************************************************************************
  * Public Variables
  ****************************************************************************/
@@ -1753,6 +1760,61 @@ int up_timer_cancel(FAR struct timespec *ts);
 int up_timer_start(FAR const struct timespec *ts);
 #endif
 
+/****************************************************************************
+ * Name: up_perf_*
+ *
+ * Description:
+ *   A free running counter of the current CPU, typically its cycle
+ *   counter, for fine grained time measurements.
+ *
+ *   up_perf_init() starts the counter.  'arg' is the frequency of the
+ *   counter in Hz, or zero if it is not known.  It may be called by
+ *   several subsystems: a zero frequency keeps the one given earlier.
+ *
+ *   up_perf_gettime() returns the current 32-bit count.  Only differences
+ *   of two readings are meaningful, and they are valid across a wrap around.
+ *
+ *   up_perf_getfreq() returns the last non-zero frequency given to
+ *   up_perf_init(), or zero.
+ *
+ *   up_perf_convert() converts an elapsed count to a time.  It requires a
+ *   known frequency.
+ *
+ *   Provided by platform-specific code: the DWT cycle counter on ARMv7-M
+ *   and ARMv8-M, the PMU cycle counter on ARMv7-A.  Needed by
+ *   CONFIG_SCHED_CPULOAD_CYCLES.
+ *
+ ****************************************************************************/
+
+void up_perf_init(FAR void *arg);
+uint32_t up_perf_gettime(void);
+uint32_t up_perf_getfreq(void);
+void up_perf_convert(uint32_t elapsed, FAR struct timespec *ts);
+
+/****************************************************************************
+ * Name: up_perf_events_*
+ *
+ * Description:
+ *   Two hardware event counters of the current CPU, for CONFIG_PERF_EVENTS.
+ *
+ *   up_perf_events_start() selects the events and starts the counters of
+ *   the calling CPU.  It returns the mask of the counter width: the
+ *   differences of two readings are valid in it.
+ *
+ *   up_perf_events_read() reads the two counts.
+ *
+ *   up_perf_events_name() returns the short name of an event, 0 or 1.
+ *
+ *   Provided by the ARMv7-A PMU code only.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PERF_EVENTS
+uint32_t up_perf_events_start(void);
+void up_perf_events_read(FAR uint32_t *counts);
+FAR const char *up_perf_events_name(int event);
+#endif
+
 /****************************************************************************
  * Name: up_romgetc
  *
@@ -1792,6 +1854,37 @@ char up_romgetc(FAR const char *ptr);
 #define up_romgetc(ptr) (*ptr)
 #endif
 
+/****************************************************************************
+ * Name: up_chksum and up_chksum_copy
+ *
+ * Description:
+ *   If CONFIG_ARCH_CHKSUM is defined, the architecture provides the
+ *   Internet checksum used by the network stack. up_chksum() returns the
+ *   checksum of 'len' bytes at 'dataptr', in host order and not inverted.
+ *   up_chksum_copy() copies 'len' bytes from 'src' to 'dst' and returns
+ *   their checksum in the same pass.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ARCH_CHKSUM
+uint16_t up_chksum(FAR const void *dataptr, int len);
+uint16_t up_chksum_copy(FAR void *dst, FAR const void *src, uint16_t len);
+#endif
+
+/****************************************************************************
+ * Name: up_crc32part
+ *
+ * Description:
+ *   If CONFIG_ARCH_CRC32 is defined, the architecture computes the CRC32
+ *   of binaries with its CRC engine.  It continues 'crc32val' over 'len'
+ *   bytes at 'src', with the same result as crc32part().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ARCH_CRC32
+uint32_t up_crc32part(FAR const uint8_t *src, size_t len, uint32_t crc32val);
+#endif
+
 /****************************************************************************
  * Name: up_mdelay and up_udelay
  *
@@ -2167,6 +2260,33 @@ size_t up_check_intstack_remain(void);
 #endif
 #endif
 
+/****************************************************************************
+ * Name: up_clean_dcache_ranges, up_invalidate_dcache_ranges and
+ *       up_flush_dcache_ranges
+ *
+ * Description:
+ *   The D cache maintenance of up_clean_dcache(), up_invalidate_dcache()
+ *   and up_flush_dcache() over the regions of a scatter-gather DMA, with
+ *   one barrier for all of them.  Cleaning or flushing regions larger in
+ *   all than the D cache operates on the whole cache instead.
+ *
+ * Input Parameters:
+ *   ranges  - The regions
+ *   nranges - The number of regions
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   As for the single region: the caller has exclusive access to the
+ *   regions.
+ *
+ ****************************************************************************/
+
+void up_clean_dcache_ranges(FAR const struct dcache_range_s *ranges, int nranges);
+void up_invalidate_dcache_ranges(FAR const struct dcache_range_s *ranges, int nranges);
+void up_flush_dcache_ranges(FAR const struct dcache_range_s *ranges, int nranges);
+
 /****************************************************************************
  * Name: up_rtc_initialize
  *
@@ -213,6 +213,10 @@ struct load_attr_s {
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
 	void *binp;			/* Binary info pointer */
 #endif
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+	uint32_t crc_header;		/* CRC of the header, continued over the ELF while loading */
+	uint32_t crc_hash;			/* Expected CRC of the header and the ELF */
+#endif
 };
 typedef struct load_attr_s load_attr_t;
 
@@ -85,6 +85,9 @@ enum {
 #endif
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
 	BIN_RO,
+#endif
+#ifdef CONFIG_XIP_ELF
+	BIN_RAMTEXT,				/* Functions of XIP text copied into RAM */
 #endif
 	BIN_DATA,
 	BIN_BSS,
@@ -121,6 +124,12 @@ struct binary_s {
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
 	uint32_t reload;			/* Indicate whether this binary will be reloaded */
 	uint32_t data_backup;			/* Start address of copy of data section */
+#ifdef CONFIG_BINFMT_RELOAD_CHECK_RO
+	uint32_t ro_crc;			/* CRC of text and ro sections after load */
+#endif
+#ifdef CONFIG_BINFMT_RELOAD_RO_BACKUP
+	FAR uint8_t *ro_backup;			/* Copy of text and ro sections, or NULL */
+#endif
 #endif
 #ifdef CONFIG_SUPPORT_COMMON_BINARY
 	uint8_t islibrary;			/* Is this bin object containing a library */
@@ -179,6 +188,10 @@ struct binary_s {
 #else
 	char *bin_name;                 /* Name of binary */
 #endif
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+	uint32_t crc_header;            /* CRC of the header, the ELF is checked from it */
+	uint32_t crc_hash;              /* Expected CRC of the header and the ELF */
+#endif
 #endif
 
 	/* Unload module callback */
@@ -100,10 +100,26 @@
 #define LIBELF_NALLOC      1
 #endif
 
+/* Parts of the file kept apart for the CRC on load, a section header table
+ * or a section read out of order starts a part.
+ */
+
+#define ELF_CRC_NSEGMENTS  8
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
 
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+/* A part of the ELF file which was read by the loader, with its CRC */
+
+struct elf_crcseg_s {
+	off_t start;				/* Offset of the first byte in the file */
+	off_t end;				/* Offset after the last byte */
+	uint32_t crc;				/* CRC of the bytes, from 0 */
+};
+#endif
+
 /* This struct provides a description of the currently loaded instantiation
  * of an ELF binary.
  */
@@ -129,6 +145,10 @@ struct elf_loadinfo_s {
 	uint16_t symtabidx;			/* Symbol table section index */
 	uint16_t strtabidx;			/* String table section index */
 	uint16_t buflen;			/* size of iobuffer[] */
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+	struct elf_crcseg_s crcseg[ELF_CRC_NSEGMENTS];	/* Parts of the file read, in order */
+	uint8_t ncrcseg;			/* Number of parts in crcseg[] */
+#endif
 
 	struct binary_s *binp;			/* Back pointer to binary object */
 };
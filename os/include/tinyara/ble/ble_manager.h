@@ -65,11 +65,13 @@ trble_result_e ble_drv_operation_enable_notification(trble_operation_handle *han
 trble_result_e ble_drv_operation_read(trble_operation_handle *handle, trble_data *out_data);
 trble_result_e ble_drv_operation_write(trble_operation_handle *handle, trble_data *in_data);
 trble_result_e ble_drv_operation_write_no_response(trble_operation_handle *handle, trble_data *in_data);
+trble_result_e ble_drv_operation_write_no_response_multi(trble_operation_handle *handle, trble_data *in_data, uint16_t count, uint16_t *sent);
 
 /*** Peripheral(Server) ***/
 trble_result_e ble_drv_set_server_config(trble_server_init_config *server_config);
 trble_result_e ble_drv_get_profile_count(uint16_t *count);
 trble_result_e ble_drv_charact_notify(trble_attr_handle attr_handle, trble_conn_handle con_handle, trble_data *data);
+trble_result_e ble_drv_charact_notify_multi(trble_attr_handle attr_handle, trble_conn_handle con_handle, trble_data *data, uint16_t count, uint16_t *sent);
 trble_result_e ble_drv_charact_indicate(trble_attr_handle attr_handle, trble_conn_handle con_handle, trble_data *data);
 trble_result_e ble_drv_attr_set_data(trble_attr_handle attr_handle, trble_data *data);
 trble_result_e ble_drv_attr_get_data(trble_attr_handle attr_handle, trble_data *data);
@@ -0,0 +1,123 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_BOOTPROF_H
+#define __INCLUDE_TINYARA_BOOTPROF_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* CONFIG_BOOT_PROFILE records the time of marks from os_start() on: the
+ * init steps of os_start() and os_bringup(), mounts, network start, binary
+ * loads and the first run of each task.  They are read in /proc/bootprof.
+ *
+ * CONFIG_BOOT_PROFILE_NMARKS - Marks recorded, later marks are dropped
+ * CONFIG_BOOT_PROFILE_FREQ   - Frequency of the cycle counter in Hz
+ */
+
+#ifndef CONFIG_BOOT_PROFILE_NMARKS
+#define CONFIG_BOOT_PROFILE_NMARKS  64
+#endif
+
+#ifndef CONFIG_BOOT_PROFILE_FREQ
+#define CONFIG_BOOT_PROFILE_FREQ    0
+#endif
+
+#define BOOTPROF_NAMELEN            24
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* A mark.  'cycles' counts from the start of the cycle counter, which stops
+ * while the core sleeps in WFI; 'ticks' is the system time, which goes on
+ * but only from the start of the system timer in up_initialize().
+ */
+
+struct bootprof_mark_s {
+	uint64_t cycles;
+	clock_t ticks;
+	char name[BOOTPROF_NAMELEN];
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+#ifdef CONFIG_BOOT_PROFILE
+/****************************************************************************
+ * Name: bootprof_init
+ *
+ * Description:
+ *   Start the cycle counter, first thing in os_start().  A counter already
+ *   started by the boot loader keeps its count.
+ *
+ ****************************************************************************/
+
+void bootprof_init(void);
+
+/****************************************************************************
+ * Name: bootprof_mark
+ *
+ * Description:
+ *   Record a mark named by the printf format 'fmt'.  It may be called from
+ *   any context, and by applications of a flat build.
+ *
+ ****************************************************************************/
+
+void bootprof_mark(FAR const char *fmt, ...);
+
+/****************************************************************************
+ * Name: bootprof_get
+ *
+ * Description:
+ *   Copy mark 'index' to 'mark'.
+ *
+ * Returned Value:
+ *   OK, or -ENOENT past the last mark.
+ *
+ ****************************************************************************/
+
+int bootprof_get(int index, FAR struct bootprof_mark_s *mark);
+#else
+#define bootprof_init()
+#define bootprof_mark(...)
+#endif
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __INCLUDE_TINYARA_BOOTPROF_H */
@@ -39,6 +39,9 @@
 
 #define MINIZ_TYPE		2
 #define MINIZ_NAME              "MINIZ"
+
+#define LZ4_TYPE		3
+#define LZ4_NAME                "LZ4"
 #define COMP_NAME_SIZE          6
 
 /****************************************************************************
@@ -49,7 +52,8 @@ enum compression_formats {
 	COMPRESSION_TYPE_NONE = 0,
 	COMPRESSION_TYPE_LZMA,
 	COMPRESSION_TYPE_MINIZ,
-	COMPRESSION_TYPE_MAX = COMPRESSION_TYPE_MINIZ,
+	COMPRESSION_TYPE_LZ4,
+	COMPRESSION_TYPE_MAX = COMPRESSION_TYPE_LZ4,
 };
 
 /* Compression header struct */
@@ -103,6 +107,21 @@ int compress_block(unsigned char *out_buffer, long unsigned int *writesize, unsi
  ****************************************************************************/
 int decompress_block(unsigned char *out_buffer, long unsigned int *writesize, unsigned char *read_buffer, long unsigned int *size);
 
+/****************************************************************************
+ * Name: decompress_block_format
+ *
+ * Description:
+ *   Decompress block in 'read_buffer' compressed with 'format', one of
+ *   compression_formats, as given by the header of a compressed binary.
+ *   LZ4 is supported along with CONFIG_COMPRESSION_TYPE when
+ *   CONFIG_COMPRESSION_LZ4 is enabled.
+ *
+ * Returned Value:
+ *   Non-negative value on Success.
+ *   Negative value on Failure.
+ ****************************************************************************/
+int decompress_block_format(int format, unsigned char *out_buffer, long unsigned int *writesize, unsigned char *read_buffer, long unsigned int *size);
+
 /****************************************************************************
  * Name: allocate compress buffer
  *
@@ -24,11 +24,42 @@
  ****************************************************************************/
 #include <tinyara/config.h>
 
+#include <stdint.h>
+#include <sys/types.h>
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+#include <tinyara/irq.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 #define CPULOAD_DRVPATH     "/dev/cpuload"
 
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+/* Exact CPU time returned by CPULOADIOC_GETCYCLES, in cycles of the counter
+ * since boot or the last CPULOADIOC_RESETCYCLES.  Slot i of pid[] and task[]
+ * is the thread in slot i of the PID hash table, pid[i] is -1 if the slot
+ * is free.  Cycles of the threads which exited are part of 'total' only.
+ */
+
+struct cpuload_cycles_s {
+	uint32_t freq;					/* Counter frequency in Hz, 0 if unknown */
+	uint64_t total;					/* Cycles accounted, all CPUs together */
+	uint64_t irq;					/* Of which in interrupt handlers */
+	pid_t pid[CONFIG_MAX_TASKS];	/* PID of each slot */
+	uint64_t task[CONFIG_MAX_TASKS];	/* Cycles of each thread */
+	uint64_t irqs[NR_IRQS];			/* Cycles of each interrupt */
+};
+#endif
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
 void cpuload_initialize(void);
 
 #ifdef __cplusplus
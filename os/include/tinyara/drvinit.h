@@ -0,0 +1,140 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_DRVINIT_H
+#define __INCLUDE_TINYARA_DRVINIT_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* CONFIG_DRIVER_DEFERRED_INIT runs the init of slow drivers, registered by
+ * the board, on worker threads once the scheduler runs instead of in
+ * board_initialize().  Without it, drvinit_register() runs the init at once.
+ */
+
+#ifndef CONFIG_DRIVER_DEFERRED_INIT_NTHREADS
+#define CONFIG_DRIVER_DEFERRED_INIT_NTHREADS    2
+#endif
+
+#ifndef CONFIG_DRIVER_DEFERRED_INIT_PRIORITY
+#define CONFIG_DRIVER_DEFERRED_INIT_PRIORITY    100
+#endif
+
+#ifndef CONFIG_DRIVER_DEFERRED_INIT_STACKSIZE
+#define CONFIG_DRIVER_DEFERRED_INIT_STACKSIZE   2048
+#endif
+
+/* Values of drvinit_s.state */
+
+#define DRVINIT_PENDING   0
+#define DRVINIT_RUNNING   1
+#define DRVINIT_DONE      2
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* A driver initialized later.  The board fills the first fields of a static
+ * instance, the others belong to the framework.
+ *
+ * Drivers with all their 'depends' done are initialized highest 'priority'
+ * first.  An open() of a path starting with 'path' waits for the init, so
+ * an init opening the device of another driver must name it in 'depends'.
+ */
+
+struct drvinit_s {
+	FAR const char *name;			/* Name, as used in 'depends' */
+	FAR const char *path;			/* Prefix of the devices registered, or NULL */
+	CODE int (*init)(void);			/* Initialization of the driver */
+	uint8_t priority;				/* Higher is initialized first */
+	FAR const char *const *depends;	/* NULL-terminated names, or NULL */
+
+	FAR struct drvinit_s *flink;	/* Next driver by priority */
+	uint8_t state;					/* See DRVINIT_* */
+	pid_t pid;						/* Worker running the init */
+	int result;						/* Returned by init */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+#ifdef CONFIG_DRIVER_DEFERRED_INIT
+/****************************************************************************
+ * Name: drvinit_register
+ *
+ * Description:
+ *   Add a driver to be initialized by drvinit_start(), from
+ *   board_initialize().
+ *
+ * Returned Value:
+ *   OK, or -EBUSY once the workers are started.
+ *
+ ****************************************************************************/
+
+int drvinit_register(FAR struct drvinit_s *drv);
+
+/****************************************************************************
+ * Name: drvinit_start
+ *
+ * Description:
+ *   Start the workers initializing the registered drivers.  Called by
+ *   os_bringup() after board_initialize().
+ *
+ ****************************************************************************/
+
+void drvinit_start(void);
+
+/****************************************************************************
+ * Name: drvinit_wait
+ *
+ * Description:
+ *   Wait for the init of the drivers of 'path'.  Called by open(), it returns
+ *   at once when no init is left.
+ *
+ ****************************************************************************/
+
+void drvinit_wait(FAR const char *path);
+#else
+#define drvinit_register(drv)   ((drv)->init())
+#define drvinit_start()
+#define drvinit_wait(path)
+#endif
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __INCLUDE_TINYARA_DRVINIT_H */
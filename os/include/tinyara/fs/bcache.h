@@ -0,0 +1,150 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_FS_BCACHE_H
+#define __INCLUDE_TINYARA_FS_BCACHE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+#include <tinyara/fs/fs.h>
+
+#ifdef CONFIG_FS_BCACHE
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Statistics of the cached accesses to one block driver */
+
+struct bcache_stats_s {
+	uint32_t hits;				/* Sectors read from the cache */
+	uint32_t misses;			/* Sectors read from the device */
+	uint32_t rasectors;			/* Sectors read ahead */
+	uint32_t rahits;			/* Read ahead sectors used */
+	uint32_t writes;			/* Sectors written to the cache */
+	uint32_t writebacks;		/* Dirty sectors written to the device */
+};
+
+typedef void (*bcache_handler_t)(FAR struct inode *inode, FAR const struct bcache_stats_s *stats, FAR void *arg);
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: bcache_attach
+ *
+ * Description:
+ *   Start caching the accesses made through bcache_read() and
+ *   bcache_write() to an opened block driver.  Attaches are counted, the
+ *   driver is cached until the last bcache_detach().  A driver that cannot
+ *   be cached (sector larger than a cache page, or no free device slot) is
+ *   accessed directly and -ENOSPC or -EINVAL is returned.
+ *
+ ****************************************************************************/
+
+int bcache_attach(FAR struct inode *inode);
+
+/****************************************************************************
+ * Name: bcache_detach
+ *
+ * Description:
+ *   Write back the dirty sectors of the block driver and, on the last
+ *   detach, drop its sectors from the cache.  Must be called before the
+ *   block driver is closed.
+ *
+ ****************************************************************************/
+
+int bcache_detach(FAR struct inode *inode);
+
+/****************************************************************************
+ * Name: bcache_read and bcache_write
+ *
+ * Description:
+ *   Same as the read and write block operations of the driver, through the
+ *   cache if the driver is attached.  Return the number of sectors
+ *   transferred or a negated errno.
+ *
+ ****************************************************************************/
+
+ssize_t bcache_read(FAR struct inode *inode, FAR unsigned char *buffer, size_t start_sector, unsigned int nsectors);
+ssize_t bcache_write(FAR struct inode *inode, FAR const unsigned char *buffer, size_t start_sector, unsigned int nsectors);
+
+/****************************************************************************
+ * Name: bcache_flush
+ *
+ * Description:
+ *   Write back the dirty sectors of the block driver now.
+ *
+ ****************************************************************************/
+
+int bcache_flush(FAR struct inode *inode);
+
+/****************************************************************************
+ * Name: bcache_getstats
+ *
+ * Description:
+ *   Return the statistics of an attached block driver.
+ *
+ ****************************************************************************/
+
+int bcache_getstats(FAR struct inode *inode, FAR struct bcache_stats_s *stats);
+
+/****************************************************************************
+ * Name: bcache_foreach
+ *
+ * Description:
+ *   Call 'handler' with the statistics of every attached block driver.
+ *   The cache is locked during the calls, the handler must not access it.
+ *
+ ****************************************************************************/
+
+void bcache_foreach(bcache_handler_t handler, FAR void *arg);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#else							/* CONFIG_FS_BCACHE */
+
+/* Without the cache, the accesses go straight to the driver */
+
+#define bcache_attach(i)            (-ENOSYS)
+#define bcache_detach(i)            (OK)
+#define bcache_read(i, b, s, n)     ((i)->u.i_bops->read((i), (b), (s), (n)))
+#define bcache_write(i, b, s, n)    ((i)->u.i_bops->write((i), (b), (s), (n)))
+#define bcache_flush(i)             (OK)
+
+#endif							/* CONFIG_FS_BCACHE */
+#endif							/* __INCLUDE_TINYARA_FS_BCACHE_H */
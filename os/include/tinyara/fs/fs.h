@@ -1153,6 +1153,45 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset, size_t le
 
 ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, size_t len);
 
+#ifdef CONFIG_BCH_ENCRYPTION
+/* drivers/bch/bchlib_cipher.c **********************************************/
+/* A cipher backend of the BCH driver, installed with the DIOC_SETCIPHER ioctl
+ * from kernel code.  crypt() encrypts or decrypts nsectors contiguous sectors
+ * of sectsize bytes from src into dst, which may be the same buffer.  The
+ * first one is the sector number 'sector', the tweak of AES-XTS.  It returns
+ * OK or a negated errno.
+ */
+
+struct bch_cipher_s {
+	CODE int (*crypt)(FAR void *priv, FAR uint8_t *dst, FAR const uint8_t *src, size_t sector, size_t nsectors, uint32_t sectsize, bool encrypt);
+	FAR void *priv;				/* Argument of crypt() */
+};
+
+#ifdef CONFIG_BCH_ENCRYPTION_SE
+/* The private data of bch_secipher_crypt(): the security HAL of the engine
+ * and the slots of the two XTS keys, used with HAL_AES_ECB_NOPAD.
+ */
+
+struct sec_ops_s;
+struct bch_secipher_s {
+	FAR struct sec_ops_s *ops;	/* Security HAL */
+	uint32_t key_idx;			/* Slot of the data key */
+	uint32_t tweak_idx;			/* Slot of the tweak key */
+};
+
+/****************************************************************************
+ * Name: bch_secipher_crypt
+ *
+ * Description:
+ *   AES-XTS on the AES-ECB of a security HAL, the crypt() method of a
+ *   struct bch_cipher_s whose priv is a struct bch_secipher_s.
+ *
+ ****************************************************************************/
+
+int bch_secipher_crypt(FAR void *priv, FAR uint8_t *dst, FAR const uint8_t *src, size_t sector, size_t nsectors, uint32_t sectsize, bool encrypt);
+#endif
+#endif
+
 /* drivers/pipes/pipe.c ***********************************************/
 /****************************************************************************
  * Name: pipe_initialize
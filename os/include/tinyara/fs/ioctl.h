@@ -57,6 +57,7 @@
  ****************************************************************************/
 
 #include <tinyara/config.h>
+#include <sys/types.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -108,6 +109,8 @@
 #define _MIPIDSIBASE    (0x3900) 	/* Mipidsi device ioctl commands */
 #define _CSIIOCBASE     (0x3a00) 	/* Wifi CSI ioctl commands */
 #define _SILENTRBCBASE  (0x3b00) 	/* Silent reboot ioctl commands */
+#define _NPUBASE        (0x3c00)	/* NPU ioctl commands */
+#define _PERFBASE       (0x3d00)	/* Performance metrics ioctl commands */
 
 
 /* boardctl() commands share the same number space */
@@ -188,6 +191,10 @@
 #define DIOC_SETKEY     _DIOC(0X0004)	/* IN:  Encryption key
 										 * OUT: None
 										 */
+#define DIOC_SETCIPHER  _DIOC(0x0005)	/* IN:  Cipher backend (struct bch_cipher_s *),
+										 *      NULL for the default one
+										 * OUT: None
+										 */
 
 /* TinyAra block driver ioctl definitions *************************************/
 
@@ -261,6 +268,23 @@
 										 *		to reveal physical sector.
 										 * OUT: Physical sector number align with
 										 *		logical sector number */
+#define BIOC_FLUSH      _BIOC(0x000E)	/* Save the driver state so that the next
+										 * mount can skip the media scan.
+										 * IN:	None
+										 * OUT: None (ioctl return value provides
+										 *		success/failure indication). */
+#define BIOC_READAHEAD  _BIOC(0x000F)	/* Read a logical sector and the sectors
+										 * stored physically after it in one
+										 * transfer.
+										 * IN:	Pointer to struct smart_readahead_s
+										 * OUT: Number of sectors read or error */
+#define BIOC_DIRECTMAP  _BIOC(0x0010)	/* Return the address of sector 0 of a
+										 * device whose sectors are linear in
+										 * memory, read by plain loads and, if
+										 * the geometry is write enabled,
+										 * written by plain stores.
+										 * IN:	Pointer to pointer to void
+										 * OUT: Address of sector 0 */
 #define BIOC_DEBUGCMD   _BIOC(0x00FF)	/* Send driver specific debug command /
 										 * data to the block device.
 										 * IN:  Pointer to a struct defined for
@@ -388,6 +412,12 @@
 											 *       (default)
 											 *     1=fre when empty
 											 * OUT: None */
+#define PIPEIOC_SPLICEOUT  _PIPEIOC(0x0002)	/* Move data from the pipe to a file
+											 * IN: struct pipe_splice_s *
+											 * OUT: Number of bytes moved */
+#define PIPEIOC_SPLICEIN   _PIPEIOC(0x0003)	/* Move data from a file to the pipe
+											 * IN: struct pipe_splice_s *
+											 * OUT: Number of bytes moved */
 /* RTC driver ioctl definitions *********************************************/
 /* (see include/tinyara/rtc.h */
 
@@ -457,6 +487,8 @@
 #if defined(HAVE_TASK_GROUP) && !defined(CONFIG_DISABLE_PTHREAD)
 #define TMIOC_PTHREAD_PARENT       _TMIOC(0x0009)
 #endif
+#define TMIOC_MONITOR_NOTIFY       _TMIOC(0x000a)
+#define TMIOC_MONITOR_EVENT        _TMIOC(0x000b)
 
 /* Mminfo driver ioctl definitions ******************************************/
 #define _MMINFOIOCVALID(c)   (_IOC_TYPE(c) == _MMINFOBASE)
@@ -497,6 +529,24 @@
 #define CPULOADIOC_START              _CPULOADIOC(0x0001)
 #define CPULOADIOC_STOP               _CPULOADIOC(0x0002)
 #define CPULOADIOC_GETVALUE           _CPULOADIOC(0x0003)
+#define CPULOADIOC_GETCYCLES          _CPULOADIOC(0x0004)
+#define CPULOADIOC_RESETCYCLES        _CPULOADIOC(0x0005)
+
+/* Performance metrics driver ioctl definitions *************************/
+/* (see tinyara/perf.h) */
+
+#define _PERFIOCVALID(c)      (_IOC_TYPE(c) == _PERFBASE)
+#define _PERFIOC(nr)          _IOC(_PERFBASE, nr)
+
+#define PERFIOC_SNAPSHOT      _PERFIOC(0x0001)	/* Arg: struct perf_snapshot_s * */
+#define PERFIOC_TASKS         _PERFIOC(0x0002)	/* Arg: struct perf_tasks_s * */
+#define PERFIOC_RESET         _PERFIOC(0x0003)	/* Arg: None */
+
+/* NPU driver ioctl definitions *******************************************/
+/* (see tinyara/npu.h) */
+
+#define _NPUIOCVALID(c)       (_IOC_TYPE(c) == _NPUBASE)
+#define _NPUIOC(nr)           _IOC(_NPUBASE, nr)
 
 /* Audio driver ioctl definitions *************************************/
 /* (see tinyara/audio/audio.h) */
@@ -508,6 +558,17 @@
  * Public Type Definitions
  ****************************************************************************/
 
+/* Argument of PIPEIOC_SPLICEOUT and PIPEIOC_SPLICEIN.  The data moves
+ * between the buffer of the pipe and the file or socket 'fd' without a
+ * buffer of the caller.  It moves up to 'len' bytes, as much as the pipe
+ * holds or has room for, waiting like read() and write() if it has none.
+ */
+
+struct pipe_splice_s {
+	int fd;						/* File or socket descriptor */
+	size_t len;					/* Maximum number of bytes to move */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
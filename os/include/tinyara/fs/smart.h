@@ -102,6 +102,20 @@ struct smart_read_write_s {
 	const uint8_t *buffer;		/* Pointer to the data to write */
 };
 
+/* The following defines a read of a logical sector together with the
+ * sectors following it on the media, see BIOC_READAHEAD.  Each slot of the
+ * buffer is one device sector; the data of a valid slot starts at the
+ * beginning of the slot, like the data returned by BIOC_READSECT.
+ */
+
+struct smart_readahead_s {
+	uint16_t logsector;			/* Logical sector of the first slot */
+	uint16_t nsectors;			/* Number of slots in the buffer */
+	uint16_t *logsectors;		/* OUT: Logical sector in each slot, 0xFFFF
+								 *      if the slot holds no valid data */
+	uint8_t *buffer;			/* nsectors slots of sectorsize bytes */
+};
+
 /* The following defines the procfs data exchange interface between the
  * SMART MTD and FS layers.
  */
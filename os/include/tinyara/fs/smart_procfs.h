@@ -113,6 +113,16 @@ struct mtd_smart_procfs_data_s {
 #ifdef CONFIG_MTD_SMART_WEAR_LEVEL
 	uint32_t uneven_wearcount;	/* Number of uneven block erases */
 #endif
+#ifdef CONFIG_MTD_SMART_BGGC
+	uint32_t gcruns;			/* Number of background collection runs */
+	uint32_t gcblocks;			/* Erase blocks collected in the background */
+	uint32_t gcsectors;			/* Sectors relocated in the background */
+	uint32_t gcmsec;			/* Time spent collecting in the background */
+	uint32_t fgblocks;			/* Erase blocks collected in the write path */
+#endif
+#ifdef CONFIG_MTD_SMART_ERASEAHEAD
+	uint32_t eablocks;			/* Erase blocks erased ahead */
+#endif
 };
 
 /* The following defines debug command data passed from the procfs layer to
@@ -0,0 +1,78 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_FS_TMPFS_H
+#define __INCLUDE_TINYARA_FS_TMPFS_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+#ifdef CONFIG_FS_TMPFS
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Memory used by the file data of all TMPFS instances */
+
+struct tmpfs_stats_s {
+	size_t chunksize;			/* Size of one file data chunk */
+	uint16_t poolchunks;		/* Chunks preallocated in the pool */
+	uint16_t poolfree;			/* Preallocated chunks not in use */
+	size_t used;				/* Memory held in chunks by files */
+	size_t peak;				/* Largest value of 'used' */
+	size_t size;				/* Sum of the sizes of all files */
+	size_t quota;				/* Limit of 'used', 0 if unlimited */
+	uint32_t nquota;			/* Allocations refused by the quota */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: tmpfs_getstats
+ *
+ * Description:
+ *   Return the memory use of the TMPFS file data.
+ *
+ ****************************************************************************/
+
+void tmpfs_getstats(FAR struct tmpfs_stats_s *stats);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif							/* CONFIG_FS_TMPFS */
+#endif							/* __INCLUDE_TINYARA_FS_TMPFS_H */
@@ -46,6 +46,7 @@
 #define GPIOIOC_POLLEVENTS		_GPIOIOC(0x0003)
 #define GPIOIOC_REGISTER		_GPIOIOC(0x0004)
 #define GPIOIOC_SET_INTERRUPT		_GPIOIOC(0x0005)
+#define GPIOIOC_GET_EVENTS		_GPIOIOC(0x0006)
 
 /****************************************************************************
  * Public Types
@@ -86,6 +87,26 @@ struct gpio_notify_s {
 	uint8_t gn_signo;
 };
 
+#ifdef CONFIG_GPIO_EVENTS
+/* An edge selected by GPIOIOC_POLLEVENTS, as GPIOIOC_GET_EVENTS returns it.
+ * The time is taken in the interrupt, so it does not include the latency
+ * of the reader.
+ */
+struct gpio_event_s {
+	uint64_t timestamp;	/* Time of the edge, microseconds since boot */
+	uint8_t value;		/* Level of the pin after the edge */
+};
+
+/* Argument of GPIOIOC_GET_EVENTS.  It takes up to nevents events, oldest
+ * first, and returns their number.  It does not wait, poll() for POLLIN.
+ */
+struct gpio_events_s {
+	FAR struct gpio_event_s *events;	/* Buffer of the events */
+	int nevents;		/* Size of the buffer in events */
+	int ndropped;		/* Set to the events lost since the last call */
+};
+#endif
+
 struct gpio_upperhalf_s;
 typedef CODE void (*gpio_handler_t)(FAR struct gpio_upperhalf_s *upper);
 
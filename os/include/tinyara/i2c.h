@@ -328,6 +328,43 @@ struct i2c_rdwr_ioctl_data_s {
 };
 #endif
 
+#ifdef CONFIG_I2C_BATCH
+/* One transaction of a batch: an optional write followed by an optional
+ * read with a repeated START, like i2c_writeread().  result is set by
+ * i2c_transfer_batch().
+ */
+
+struct i2c_trans_s {
+	FAR const struct i2c_config_s *config;	/* Device of the transaction */
+	FAR const uint8_t *wbuffer;	/* Data to write, NULL if none */
+	int wbuflen;				/* Number of bytes to write */
+	FAR uint8_t *rbuffer;		/* Buffer of the read data, NULL if none */
+	int rbuflen;				/* Number of bytes to read */
+	int result;					/* 0: success, <0: A negated errno */
+};
+
+#ifdef CONFIG_I2C_ASYNC
+/* The function called when a queued batch is finished.  result is the
+ * return value of i2c_transfer_batch().  It runs on the work queue thread.
+ */
+
+typedef void (*i2c_complete_t)(FAR void *arg, int result);
+
+/* A request of i2c_transfer_async().  It belongs to the caller and must not
+ * be changed or freed until the callback is called.
+ */
+
+struct i2c_request_s {
+	FAR struct i2c_request_s *flink;	/* Used by the request queue */
+	FAR struct i2c_dev_s *dev;	/* The I2C bus */
+	FAR struct i2c_trans_s *trans;	/* Array of ntrans transactions */
+	int ntrans;					/* Number of transactions */
+	i2c_complete_t callback;	/* Called when the batch is finished */
+	FAR void *arg;				/* Argument of the callback */
+};
+#endif
+#endif
+
 /* I2C private data.  This structure only defines the initial fields of the
  * structure visible to the I2C client.  The specific implementation may
  * add additional, device specific fields after the vtable.
@@ -467,6 +504,52 @@ int i2c_write(FAR struct i2c_dev_s *dev, FAR const struct i2c_config_s *config,
 int i2c_read(FAR struct i2c_dev_s *dev, FAR const struct i2c_config_s *config, FAR uint8_t *buffer, int buflen);
 #endif
 
+#ifdef CONFIG_I2C_BATCH
+/****************************************************************************
+ * Name: i2c_transfer_batch
+ *
+ * Description:
+ *   Perform many transactions, possibly to different devices, in as few
+ *   transfer() calls as possible.  Consecutive transactions at the same
+ *   frequency are sent as one message list, joined by repeated STARTs, so
+ *   the whole batch costs one bus lock and one wakeup per group instead of
+ *   one per transaction.  If a group fails, its transactions are retried
+ *   one by one so that a device which does not answer does not fail the
+ *   others.  The result of each transaction is left in trans[i].result.
+ *
+ * Input Parameters:
+ *   dev    - Device-specific state data
+ *   trans  - The transactions
+ *   ntrans - The number of transactions
+ *
+ * Returned Value:
+ *   0: all transactions succeeded, <0: the first negated errno
+ *
+ ****************************************************************************/
+
+int i2c_transfer_batch(FAR struct i2c_dev_s *dev, FAR struct i2c_trans_s *trans, int ntrans);
+
+#ifdef CONFIG_I2C_ASYNC
+/****************************************************************************
+ * Name: i2c_transfer_async
+ *
+ * Description:
+ *   Queue the batch of the request and return at once.  The batches are
+ *   performed in the order they were queued, on the low priority work
+ *   queue, and req->callback is called after each of them.
+ *
+ * Input Parameters:
+ *   req - The request.  It must stay valid until its callback is called.
+ *
+ * Returned Value:
+ *   0: the request is queued, <0: A negated errno
+ *
+ ****************************************************************************/
+
+int i2c_transfer_async(FAR struct i2c_request_s *req);
+#endif
+#endif
+
 #ifdef CONFIG_I2C_USERIO
 int i2c_uioregister(FAR const char *path, FAR struct i2c_dev_s *dev);
 #endif
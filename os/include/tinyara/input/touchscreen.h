@@ -171,6 +171,7 @@ struct touch_point_s {
  */
 struct touch_sample_s {
 	int npoints;                   /* The number of touch points in point[] */
+	uint32_t timestamp;            /* Time of the sample in microseconds, of the system timer */
 	struct touch_point_s point[TOUCH_MAX_POINTS]; /* Actual dimension is npoints */
 };
 
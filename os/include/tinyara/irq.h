@@ -79,6 +79,13 @@
 #endif
 
 #define NO_FIN_DATA -999
+
+/* Return values of the hard handler of a threaded interrupt */
+
+#ifdef CONFIG_IRQ_THREAD
+#define IRQ_HANDLED     0		/* Done, the thread is not run */
+#define IRQ_WAKE_THREAD 1		/* Run the handler of the thread */
+#endif
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -87,6 +94,12 @@
 
 #ifndef __ASSEMBLY__
 typedef int (*xcpt_t)(int irq, FAR void *context, FAR void *arg);
+
+/* Handler run by the thread of a threaded interrupt */
+
+#ifdef CONFIG_IRQ_THREAD
+typedef void (*irq_thread_t)(int irq, FAR void *arg);
+#endif
 #endif
 
 /* Now include architecture-specific types */
@@ -105,6 +118,23 @@ extern "C" {
 #define EXTERN extern
 #endif
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+/* Cycle count of up_perf_gettime() at the entry of the interrupt vector,
+ * taken by the architecture with IRQ_TIMING_ENTRY() and consumed by
+ * irq_dispatch() for the latency of the handler.  Zero if not taken.
+ */
+
+#ifdef CONFIG_SMP
+EXTERN volatile uint32_t g_irq_entry_cycles[CONFIG_SMP_NCPUS];
+#  define IRQ_TIMING_ENTRY() (g_irq_entry_cycles[up_cpu_index()] = up_perf_gettime() | 1)
+#else
+EXTERN volatile uint32_t g_irq_entry_cycles[1];
+#  define IRQ_TIMING_ENTRY() (g_irq_entry_cycles[0] = up_perf_gettime() | 1)
+#endif
+#else
+#  define IRQ_TIMING_ENTRY()
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -124,6 +154,49 @@ int irq_attach_withname(int irq, xcpt_t isr, FAR void *arg, const char *name);
 int irq_attach(int irq, xcpt_t isr, FAR void *arg);
 #endif
 
+#ifdef CONFIG_IRQ_THREAD
+/****************************************************************************
+ * Name: irq_attach_thread
+ *
+ * Description:
+ *   Attach a threaded interrupt: 'handler' runs in a kernel thread of the
+ *   interrupt, at 'priority', each time the interrupt wakes it.  Several
+ *   interrupts raised before the thread runs make one run.
+ *
+ *   'isr', called in the interrupt with 'arg', only acknowledges the device
+ *   and returns IRQ_WAKE_THREAD to run the handler, or IRQ_HANDLED.  If
+ *   'isr' is NULL, the interrupt is masked at the controller and the thread
+ *   unmasks it after the handler, for the devices which are acknowledged
+ *   by the handler.
+ *
+ * Input Parameters:
+ *   irq       - Interrupt number
+ *   isr       - Hard handler, or NULL
+ *   handler   - Handler of the thread
+ *   arg       - Argument of isr and handler
+ *   priority  - Priority of the thread
+ *   stacksize - Stack size of the thread, or 0 for
+ *               CONFIG_IRQ_THREAD_STACKSIZE
+ *
+ * Returned Value:
+ *   OK on success, or a negated errno.
+ *
+ ****************************************************************************/
+
+int irq_attach_thread(int irq, xcpt_t isr, irq_thread_t handler, FAR void *arg, int priority, int stacksize);
+
+/****************************************************************************
+ * Name: irq_detach_thread
+ *
+ * Description:
+ *   Detach a threaded interrupt.  Its thread exits after a run of the
+ *   handler in progress.
+ *
+ ****************************************************************************/
+
+int irq_detach_thread(int irq);
+#endif
+
 #ifdef CONFIG_DEBUG_IRQ_INFO
 
 /****************************************************************************
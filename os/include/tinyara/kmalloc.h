@@ -133,6 +133,8 @@ extern "C" {
 #define kmm_malloc(s)          umm_malloc(s)
 #define kmm_zalloc(s)          umm_zalloc(s)
 #define kmm_realloc(p, s)      umm_realloc(p, s)
+#define kmm_malloc_fast(s)     umm_malloc(s)
+#define kmm_malloc_bulk(s)     umm_malloc(s)
 
 #define kmm_memalign(a, s)     umm_memalign(a, s)
 #define kmm_free(p)            umm_free(p)
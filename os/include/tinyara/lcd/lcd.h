@@ -179,6 +179,13 @@ struct lcd_planeinfo_s {
 #ifdef CONFIG_LCD_DMA_SUPPORT
 	int (*putdma)(fb_coord_t row, fb_coord_t col, fb_coord_t row2,
 				fb_coord_t col2, FAR const uint8_t *buffer);
+
+	/* This method blocks until the panel signals its tearing effect (TE)
+	 * line or vertical blank, so that a transfer started right after it does
+	 * not tear.  It may be NULL if the panel has no such signal.
+	 */
+
+	int (*waitvsync)(void);
 #endif
 };
 
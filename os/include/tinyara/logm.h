@@ -26,7 +26,9 @@
 #ifndef __OS_INCLUDE_TINYARA_LOGM_H
 #define __OS_INCLUDE_TINYARA_LOGM_H
 
+#include <tinyara/config.h>
 #include <stdarg.h>
+#include <stdint.h>
 
 #define LOGM_DEF_PRIORITY (7)
 /* Log priority levels in logm */
@@ -46,7 +48,7 @@ enum logm_loglevel_e {
 enum logm_param_type_e {
 	LOGM_BUFSIZE,
 	LOGM_INTERVAL,
-	LOGM_PRIORITY
+	LOGM_PRIORITY		/* Level of all the modules */
 	/* This would grow later */
 };
 
@@ -56,12 +58,51 @@ enum logm_logflag_e {
 	LOGM_LOWPUT
 };
 
-/* Log index means where messages are from */
+/* Log index means where messages are from. The debug macros of a directory
+ * take the index given to it as LOGM_IDX by its Makefile.
+ */
 enum logm_logindex_e {
-	LOGM_UNKNOWN
-	/* Not supported yet. This would be updated later */
+	LOGM_UNKNOWN,
+	LOGM_KERNEL,
+	LOGM_MM,
+	LOGM_FS,
+	LOGM_NET,
+	LOGM_DRIVERS,
+	LOGM_IDX_MAX
 };
 
+/* Messages of a priority above CONFIG_LOGM_LEVEL are not compiled in */
+#ifdef CONFIG_LOGM_LEVEL
+#define LOGM_LEVEL CONFIG_LOGM_LEVEL
+#else
+#define LOGM_LEVEL LOGM_DBG
+#endif
+
+/* Priorities from 0 to priority, as a bitmap of g_logm_levels */
+#define LOGM_LEVEL_MASK(priority) ((uint8_t)((2 << (priority)) - 1))
+
+/* The run time levels are only seen where logm() runs */
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+#define LOGM_RUNTIME_ENABLED(indx, priority) (g_logm_levels[indx] & (1 << (priority)))
+#else
+#define LOGM_RUNTIME_ENABLED(indx, priority) (1)
+#endif
+
+#define LOGM_ENABLED(indx, priority) \
+	((priority) <= LOGM_LEVEL && LOGM_RUNTIME_ENABLED(indx, priority))
+
+/* logm() for a constant priority, removed at compile time below LOGM_LEVEL
+ * and tested against the level of the module before evaluating arguments.
+ */
+#define LOGM_PRINT(flag, indx, priority, fmt, ...) \
+	({ \
+		int __ret = 0; \
+		if (LOGM_ENABLED(indx, priority)) { \
+			__ret = logm(flag, indx, priority, fmt, ##__VA_ARGS__); \
+		} \
+		__ret; \
+	})
+
 #undef EXTERN
 #if defined(__cplusplus)
 #define EXTERN extern "C"
@@ -74,6 +115,11 @@ extern "C"
  * @cond
  * @internal
  */
+/* Priorities enabled per module, bit n for priority n */
+EXTERN uint8_t g_logm_levels[LOGM_IDX_MAX];
+/**
+ * @internal
+ */
 void logm_start(void);
 /**
  * @internal
@@ -91,6 +137,14 @@ int logm_set_values(enum logm_param_type_e type, int value);
  * @internal
  */
 int logm_get_values(enum logm_param_type_e type, int* value);
+/**
+ * @internal
+ */
+int logm_set_level(int indx, int priority);
+/**
+ * @internal
+ */
+int logm_get_level(int indx);
 /**
  * @endcond
  */
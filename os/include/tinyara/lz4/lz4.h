@@ -0,0 +1,71 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_LZ4_LZ4_H
+#define __INCLUDE_TINYARA_LZ4_LZ4_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Blocks are in the LZ4 block format, without the frame around them */
+
+#define LZ4_HASH_LOG            12
+#define LZ4_STATE_SIZE          (sizeof(uint32_t) << LZ4_HASH_LOG)
+
+/* Largest compressed size of 'size' bytes, when they do not compress */
+
+#define LZ4_COMPRESSBOUND(size) ((size) + ((size) / 255) + 16)
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lz4_compress_block
+ *
+ * Description:
+ *   Compress 'srclen' bytes of 'src' into 'dst' of 'dstlen' bytes.  'state'
+ *   is LZ4_STATE_SIZE bytes of the caller.
+ *
+ * Returned Value:
+ *   Size of the compressed block on Success
+ *   Negative value when it does not fit in 'dst'
+ ****************************************************************************/
+int lz4_compress_block(const uint8_t *src, int srclen, uint8_t *dst, int dstlen, void *state);
+
+/****************************************************************************
+ * Name: lz4_decompress_block
+ *
+ * Description:
+ *   Decompress the block of 'srclen' bytes in 'src' into 'dst' of 'dstlen'
+ *   bytes.  A corrupted block never writes out of 'dst'.
+ *
+ * Returned Value:
+ *   Size of the decompressed data on Success
+ *   Negative value on a corrupted block, or when 'dst' is too small
+ ****************************************************************************/
+int lz4_decompress_block(const uint8_t *src, int srclen, uint8_t *dst, int dstlen);
+
+#endif							/* __INCLUDE_TINYARA_LZ4_LZ4_H */
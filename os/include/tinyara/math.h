@@ -108,6 +108,7 @@
 #ifndef NXFUSE_HOST_BUILD
 #include <tinyara/compiler.h>
 #endif
+#include <sys/types.h>
 #include <fixedmath.h>
 
 /****************************************************************************
@@ -1670,6 +1671,24 @@ double      scalbn(double x, int n);
 long double scalbnl(long double x, int n);
 #endif
 
+#ifdef CONFIG_LIBM_FASTMATH
+/* Reduced precision functions, without errno, and their array versions,
+ * where y may be x.  See CONFIG_LIBM_FASTMATH.
+ */
+
+float       expf_fast(float x);
+float       logf_fast(float x);
+float       sinf_fast(float x);
+float       cosf_fast(float x);
+void        sincosf_fast(float x, FAR float *sinx, FAR float *cosx);
+
+void        vexpf(FAR float *y, FAR const float *x, size_t n);
+void        vlogf(FAR float *y, FAR const float *x, size_t n);
+void        vsinf(FAR float *y, FAR const float *x, size_t n);
+void        vcosf(FAR float *y, FAR const float *x, size_t n);
+void        vsincosf(FAR float *sinx, FAR float *cosx, FAR const float *x, size_t n);
+#endif
+
 #define FP_INFINITE     0
 #define FP_NAN          1
 #define FP_NORMAL       2
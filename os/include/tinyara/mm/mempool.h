@@ -0,0 +1,169 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_MM_MEMPOOL_H
+#define __INCLUDE_TINYARA_MM_MEMPOOL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <queue.h>
+#include <semaphore.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Flags of struct mempool_s */
+
+#define MEMPOOL_FLAG_IRQSAFE   (1 << 0)	/* Pool may be used from interrupt handlers */
+
+/* Objects are kept aligned to pointers so that the free list link fits */
+
+#define MEMPOOL_ALIGN_UP(s)    (((s) + sizeof(uintptr_t) - 1) & ~(sizeof(uintptr_t) - 1))
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* A fixed-block memory pool.
+ *
+ * Every object of a pool has the same size, so alloc and free just pop and
+ * push a singly linked free list.  The pool starts with 'ninitial' objects,
+ * carved out of 'storage' if the caller provides it or out of one kernel
+ * heap allocation otherwise.  When it runs dry, 'nexpand' more objects are
+ * taken from the kernel heap in one chunk, until the pool owns 'nmax'
+ * objects if 'nmax' is set.  Chunks are never returned, so the heap sees
+ * one long-lived allocation instead of many short-lived ones.
+ *
+ * The fields in the first part are set by the owner before calling
+ * mempool_initialize().  The rest is private to the pool.
+ */
+
+struct mempool_s {
+	size_t blocksize;			/* Size of one object in bytes */
+	uint16_t ninitial;			/* Number of objects created at initialization */
+	uint16_t nexpand;			/* Number of objects added when empty, 0 for a fixed pool */
+	uint16_t nreserve;			/* Number of objects reserved to interrupt handlers */
+	uint16_t nmax;				/* Largest number of objects to expand to, 0 for no limit */
+	uint8_t flags;				/* See MEMPOOL_FLAG_* definitions */
+	FAR void *storage;			/* Optional storage for the initial objects */
+
+	FAR const char *name;		/* Name reported through procfs */
+	FAR struct mempool_s *flink;	/* Link in the list of all pools */
+	sq_queue_t freelist;		/* Free objects */
+	sem_t exclsem;				/* Exclusive access to a pool which is not IRQ safe */
+	uint16_t ntotal;			/* Number of objects owned by the pool */
+	uint16_t nfree;				/* Number of objects in the free list */
+	uint16_t highwater;			/* Largest number of objects in use at a time */
+	uint32_t nfail;				/* Number of allocations which failed */
+};
+
+/* Snapshot of the usage of one pool, see mempool_foreach() */
+
+struct mempool_info_s {
+	FAR const char *name;
+	size_t blocksize;
+	uint16_t ntotal;
+	uint16_t nused;
+	uint16_t highwater;
+	uint32_t nfail;
+};
+
+typedef void (*mempool_handler_t)(FAR const struct mempool_info_s *info, FAR void *arg);
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+
+/****************************************************************************
+ * Name: mempool_initialize
+ *
+ * Description:
+ *   Set up a pool described by blocksize, ninitial, nexpand, nreserve,
+ *   nmax, flags and storage, and register it under 'name'.  'storage', if not
+ *   NULL, must hold ninitial objects of MEMPOOL_ALIGN_UP(blocksize) bytes.
+ *
+ * Returned Value:
+ *   OK on success; -EINVAL for a bad description or -ENOMEM if the initial
+ *   objects could not be allocated.
+ *
+ ****************************************************************************/
+
+int mempool_initialize(FAR struct mempool_s *pool, FAR const char *name);
+
+/****************************************************************************
+ * Name: mempool_alloc
+ *
+ * Description:
+ *   Take one object from the pool in O(1), expanding the pool from the kernel
+ *   heap if it is empty and expansion is allowed.  Interrupt handlers may
+ *   only use pools with MEMPOOL_FLAG_IRQSAFE; they never expand the pool
+ *   but may take the objects held in reserve for them.
+ *
+ * Returned Value:
+ *   The object, or NULL if the pool is exhausted.
+ *
+ ****************************************************************************/
+
+FAR void *mempool_alloc(FAR struct mempool_s *pool);
+
+/****************************************************************************
+ * Name: mempool_free
+ *
+ * Description:
+ *   Return an object taken by mempool_alloc() to its pool in O(1).
+ *
+ ****************************************************************************/
+
+void mempool_free(FAR struct mempool_s *pool, FAR void *blk);
+
+/****************************************************************************
+ * Name: mempool_foreach
+ *
+ * Description:
+ *   Call 'handler' with a snapshot of the usage of every registered pool.
+ *   It must be called from a task, not from an interrupt handler.
+ *
+ ****************************************************************************/
+
+void mempool_foreach(mempool_handler_t handler, FAR void *arg);
+
+#endif							/* CONFIG_BUILD_FLAT || __KERNEL__ */
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif							/* __INCLUDE_TINYARA_MM_MEMPOOL_H */
@@ -69,6 +69,12 @@
 #endif
 
 #include <tinyara/sched.h>
+#ifdef CONFIG_MM_PERCPU_CACHE
+#include <tinyara/spinlock.h>
+#endif
+#ifdef CONFIG_SCHED_WORKQUEUE
+#include <tinyara/wqueue.h>
+#endif
 /****************************************************************************
  * Pre-Processor Definitions
  ****************************************************************************/
@@ -170,6 +176,28 @@
 #define MM_MAX_CHUNK     (1 << MM_MAX_SHIFT)
 #define MM_NNODES        (MM_MAX_SHIFT - MM_MIN_SHIFT + 1)
 
+/* With CONFIG_MM_TLSF_INDEX, each power-of-two range of the nodelist is
+ * split again into MM_SLI_COUNT linear sub-lists (a two-level segregated
+ * fit index).  A pair of bitmaps tells which lists are not empty, so that a
+ * free chunk large enough for a request is found without walking a list.
+ */
+
+#ifdef CONFIG_MM_TLSF_INDEX
+#ifndef CONFIG_MM_TLSF_SLI_SHIFT
+#define CONFIG_MM_TLSF_SLI_SHIFT 2
+#endif
+#if CONFIG_MM_TLSF_SLI_SHIFT < 1 || CONFIG_MM_TLSF_SLI_SHIFT > 3
+#error "CONFIG_MM_TLSF_SLI_SHIFT must be between 1 and 3"
+#endif
+#define MM_SLI_SHIFT     CONFIG_MM_TLSF_SLI_SHIFT
+#define MM_SLI_COUNT     (1 << MM_SLI_SHIFT)
+#define MM_NLISTS        (MM_NNODES << MM_SLI_SHIFT)
+#define MM_NDX2FL(ndx)   ((ndx) >> MM_SLI_SHIFT)
+#else
+#define MM_NLISTS        MM_NNODES
+#define MM_NDX2FL(ndx)   (ndx)
+#endif
+
 #define MM_GRAN_MASK     (MM_MIN_CHUNK-1)
 #define MM_ALIGN_UP(a)   (((a) + MM_GRAN_MASK) & ~MM_GRAN_MASK)
 #define MM_ALIGN_DOWN(a) ((a) & ~MM_GRAN_MASK)
@@ -196,6 +224,7 @@
 #define HEAPINFO_DETAIL_SPECIFIC_HEAP 5
 #define HEAPINFO_INIT_PEAK 6
 #define HEAPINFO_DUMP_HEAP 7
+#define HEAPINFO_PROFILE 8
 #define HEAPINFO_PID_ALL -1
 
 #define HEAPINFO_INIT_INFO -1
@@ -335,10 +364,84 @@ struct mm_freenode_s {
 #define CHECK_FREENODE_SIZE \
 	DEBUGASSERT(sizeof(struct mm_freenode_s) == SIZEOF_MM_FREENODE)
 
+/* A free which could not take the MM semaphore is deferred by pushing the
+ * chunk on a lock-free list.  The node lives in the user area of the chunk,
+ * which is always large enough for the links of a free node.
+ */
+
 struct mm_delaynode_s
 {
 	FAR struct mm_delaynode_s *flink;
+	uint32_t stamp;				/* System tick when the free was deferred */
+};
+
+/* The deferred frees are returned to the heap by at most
+ * CONFIG_MM_DELAYLIST_BATCH chunks per MM semaphore hold, so that no task
+ * pays for a long list at once.
+ */
+
+#ifndef CONFIG_MM_DELAYLIST_BATCH
+#define CONFIG_MM_DELAYLIST_BATCH 16
+#endif
+
+/* With a low priority work queue the batches are drained there; otherwise
+ * mm_malloc() drains one batch per call.
+ */
+
+#if (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)) && defined(CONFIG_SCHED_LPWORK)
+#define MM_DELAYLIST_WORKER
+#endif
+
+struct mm_delaylist_stats_s {
+	uint32_t depth;				/* Frees waiting to be drained */
+	uint32_t maxdepth;			/* Largest depth seen */
+	uint32_t nqueued;			/* Frees deferred since boot */
+	uint32_t ndrained;			/* Frees drained since boot */
+	uint32_t maxlatency;		/* Longest wait of a deferred free in ticks */
+};
+
+#ifdef CONFIG_MM_PERCPU_CACHE
+/* Per-CPU small object cache.
+ *
+ * Each CPU keeps a magazine of already allocated chunks for a few small
+ * size classes.  The chunks stay marked as allocated in the heap, so a
+ * malloc/free pair that hits the magazine never touches the nodelist nor
+ * the MM semaphore.  A mark in the payload of a parked chunk catches a
+ * double free.  Magazines are refilled from and drained to the heap
+ * in batches of CONFIG_MM_PERCPU_CACHE_BATCH chunks.
+ */
+
+#ifndef CONFIG_MM_PERCPU_CACHE_DEPTH
+#define CONFIG_MM_PERCPU_CACHE_DEPTH 8
+#endif
+
+#ifndef CONFIG_MM_PERCPU_CACHE_BATCH
+#define CONFIG_MM_PERCPU_CACHE_BATCH 4
+#endif
+
+#define MM_CACHE_NCLASSES       4		/* 32, 64, 128 and 256 bytes */
+#define MM_CACHE_MIN_SHIFT      5
+#define MM_CACHE_CLASS_SIZE(c)  (1 << (MM_CACHE_MIN_SHIFT + (c)))
+#define MM_CACHE_CHUNK_SIZE(c)  MM_ALIGN_UP(MM_CACHE_CLASS_SIZE(c) + SIZEOF_MM_ALLOCNODE)
+
+struct mm_cache_magazine_s {
+	int count;
+	FAR struct mm_allocnode_s *chunk[CONFIG_MM_PERCPU_CACHE_DEPTH];
+};
+
+struct mm_cache_stats_s {
+	uint32_t alloc_hit;			/* malloc served from the magazine */
+	uint32_t alloc_miss;			/* malloc that needed a refill */
+	uint32_t free_hit;			/* free kept in the magazine */
+	uint32_t free_miss;			/* free that needed a drain */
+};
+
+struct mm_cache_s {
+	spinlock_t lock;			/* Only contended by mm_cache_flush() */
+	struct mm_cache_magazine_s mag[MM_CACHE_NCLASSES];
+	struct mm_cache_stats_s stats;
 };
+#endif
 
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 struct heapinfo_tcb_info_s {
@@ -371,6 +474,88 @@ extern struct heapinfo_group_info_s group_info[HEAPINFO_THREAD_NUM];
 
 #endif
 
+/* How mm_realloc() served the requests of a heap */
+
+struct mm_realloc_stats_s {
+	uint32_t nshrink;			/* Shrunk in place */
+	uint32_t nforward;			/* Grown into the next free chunk, no copy */
+	uint32_t nbackward;			/* Grown into the previous free chunk, data moved */
+	uint32_t ncopy;				/* New chunk allocated and data copied */
+};
+
+/* Fragmentation of a heap, see mm_fraginfo().  The free chunks are counted
+ * per power-of-two bucket of the nodelist, bucket 'n' holding the chunks
+ * from MM_MIN_CHUNK << n bytes up.
+ */
+
+struct mm_fraginfo_s {
+	size_t freebytes;			/* Total size of the free chunks */
+	size_t largest;				/* Size of the largest free chunk */
+	uint32_t nfree[MM_NNODES];	/* Number of free chunks per bucket */
+	int fragratio;				/* 100 * (1 - largest / freebytes) */
+};
+
+/* Low memory notification.
+ *
+ * A notifier fires once when an allocation leaves less than 'threshold'
+ * free bytes in its heap, and is armed again when the free memory comes
+ * back above the threshold plus 1/8 of it.  The callback runs in the task
+ * which allocated, with the MM semaphore held: it may free memory (to shed
+ * a cache, say) but must be short and must not wait for another task.
+ */
+
+struct mm_heap_s;
+typedef void (*mm_lowmem_callback_t)(FAR struct mm_heap_s *heap, size_t freebytes, FAR void *arg);
+
+struct mm_lowmem_s {
+	FAR struct mm_lowmem_s *flink;	/* Private to the heap */
+	bool fired;					/* Private to the heap */
+	size_t threshold;			/* Free bytes below which to notify */
+	mm_lowmem_callback_t callback;
+	FAR void *arg;
+};
+
+#ifdef CONFIG_MM_PROFILER
+/* Sampling allocation profiler.
+ *
+ * Every CONFIG_MM_PROFILER_RATE-th allocation of a heap is charged to the
+ * return address of its caller in a small open addressing hash table, so
+ * the call sites which allocate the most can be found at a fixed cost and
+ * without walking the heap.  The return address is only passed down to
+ * the allocator with CONFIG_DEBUG_MM_HEAPINFO.
+ */
+
+#ifndef CONFIG_DEBUG_MM_HEAPINFO
+#undef CONFIG_MM_PROFILER
+#endif
+#endif
+
+#ifdef CONFIG_MM_PROFILER
+#ifndef CONFIG_MM_PROFILER_RATE
+#define CONFIG_MM_PROFILER_RATE 16
+#endif
+
+#ifndef CONFIG_MM_PROFILER_NSITES
+#define CONFIG_MM_PROFILER_NSITES 64	/* Must be a power of two */
+#endif
+
+#ifndef CONFIG_MM_PROFILER_TOPN
+#define CONFIG_MM_PROFILER_TOPN 10
+#endif
+
+struct mm_profile_site_s {
+	mmaddress_t caller;			/* Return address of the call site, NULL if unused */
+	uint32_t nsamples;			/* Sampled allocations */
+	uint32_t nbytes;			/* Chunk bytes of the sampled allocations */
+};
+
+struct mm_profile_s {
+	uint32_t nallocs;			/* Allocations seen, sampled or not */
+	uint32_t ndropped;			/* Samples lost because the table was full */
+	struct mm_profile_site_s site[CONFIG_MM_PROFILER_NSITES];
+};
+#endif
+
 struct mm_alloc_fail_s {
 	uint32_t size;
 	uint32_t align;
@@ -417,14 +602,54 @@ struct mm_heap_s {
 	 * speed searches for free nodes.
 	 */
 
-	struct mm_freenode_s mm_nodelist[MM_NNODES + 1];
-	
+	struct mm_freenode_s mm_nodelist[MM_NLISTS + 1];
+
+	/* Free chunks in the nodelist, per power-of-two bucket and in total */
+
+	uint32_t mm_nfreechunks[MM_NNODES];
+	size_t mm_freebytes;
+
+	/* mm_realloc() counters */
+
+	struct mm_realloc_stats_s mm_reallocstats;
+
+	/* Registered low memory notifiers */
+
+	FAR struct mm_lowmem_s *mm_lowmem;
+
+#ifdef CONFIG_MM_TLSF_INDEX
+	/* Non-empty lists of the two-level index.  A bit may stay set after
+	 * its list is emptied; it is cleared by the next search that finds it.
+	 */
+
+	uint32_t mm_flbitmap;
+	uint8_t mm_slbitmap[MM_NNODES];
+#endif
+
 	/* Free delay list, for some situations where we can't do free
-	* immdiately.
-	*/
+	 * immediately.  Any CPU pushes on mm_delaylist without a lock; the
+	 * holder of the MM semaphore detaches it into mm_delaydrain and drains
+	 * that in batches.
+	 */
+
+	FAR struct mm_delaynode_s *mm_delaylist;
+	FAR struct mm_delaynode_s *mm_delaydrain;
+	struct mm_delaylist_stats_s mm_delaystats;
+#ifdef CONFIG_SCHED_WORKQUEUE
+	struct work_s mm_delaywork;	/* Drains the list on the low priority work queue */
+#endif
+
+#ifdef CONFIG_MM_PROFILER
+	/* Sampled allocations by call site */
+
+	struct mm_profile_s mm_profile;
+#endif
 
-	FAR struct mm_delaynode_s *mm_delaylist[CONFIG_SMP_NCPUS];
+#ifdef CONFIG_MM_PERCPU_CACHE
+	/* Per-CPU magazines of small allocated chunks */
 
+	struct mm_cache_s mm_cache[CONFIG_SMP_NCPUS];
+#endif
 };
 
 /****************************************************************************
@@ -692,6 +917,13 @@ void kmm_extend(FAR void *mem, size_t size, int region);
 struct mallinfo;				/* Forward reference */
 int mm_mallinfo(FAR struct mm_heap_s *heap, FAR struct mallinfo *info);
 int mm_mallinfo_aligned(FAR struct mm_heap_s *heap, FAR struct mallinfo *info, size_t align);
+int mm_fraginfo(FAR struct mm_heap_s *heap, FAR struct mm_fraginfo_s *info);
+
+/* Functions contained in mm_lowmem.c ***************************************/
+
+int mm_lowmem_register(FAR struct mm_heap_s *heap, FAR struct mm_lowmem_s *notifier);
+int mm_lowmem_unregister(FAR struct mm_heap_s *heap, FAR struct mm_lowmem_s *notifier);
+void mm_lowmem_check(FAR struct mm_heap_s *heap);
 
 /* Functions contained in kmm_mallinfo.c ************************************/
 
@@ -718,6 +950,43 @@ void mm_addfreechunk(FAR struct mm_heap_s *heap, FAR struct mm_freenode_s *node)
 /* Functions contained in mm_size2ndx.c.c ***********************************/
 
 int mm_size2ndx(size_t size);
+#ifdef CONFIG_MM_TLSF_INDEX
+int mm_size2ndx_search(size_t size);
+#endif
+
+/* Functions contained in mm_malloc.c and mm_free.c *************************/
+
+FAR struct mm_allocnode_s *mm_allocchunk(FAR struct mm_heap_s *heap, size_t size);
+void mm_freechunk(FAR struct mm_heap_s *heap, FAR struct mm_allocnode_s *node);
+
+/* Functions contained in mm_delaylist.c ************************************/
+
+void mm_delaylist_initialize(FAR struct mm_heap_s *heap);
+void mm_add_delaylist(FAR struct mm_heap_s *heap, FAR void *mem);
+int mm_drain_delaylist(FAR struct mm_heap_s *heap, int batch);
+void mm_delaylist_getstats(FAR struct mm_heap_s *heap, FAR struct mm_delaylist_stats_s *stats);
+
+/* Functions contained in mm_profile.c **************************************/
+
+#ifdef CONFIG_MM_PROFILER
+void mm_profile_initialize(FAR struct mm_heap_s *heap);
+void mm_profile_alloc(FAR struct mm_heap_s *heap, size_t size, mmaddress_t caller);
+void mm_profile_report(FAR struct mm_heap_s *heap);
+#endif
+
+/* Functions contained in mm_cache.c ****************************************/
+
+#ifdef CONFIG_MM_PERCPU_CACHE
+void mm_cache_initialize(FAR struct mm_heap_s *heap);
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+FAR void *mm_cache_alloc(FAR struct mm_heap_s *heap, size_t size, mmaddress_t caller_retaddr);
+#else
+FAR void *mm_cache_alloc(FAR struct mm_heap_s *heap, size_t size);
+#endif
+bool mm_cache_free(FAR struct mm_heap_s *heap, FAR void *mem);
+int mm_cache_flush(FAR struct mm_heap_s *heap);
+void mm_cache_getstats(FAR struct mm_heap_s *heap, int cpu, FAR struct mm_cache_stats_s *stats, FAR size_t *cached);
+#endif
 
 void mm_dump_node(struct mm_allocnode_s *node, char *node_type);
 void mm_dump_heap_region(uint32_t start, uint32_t end);
@@ -785,6 +1054,20 @@ int mm_check_heap_corruption(struct mm_heap_s *heap);
 #define HEAP_START_IDX 0
 #define HEAP_END_IDX   (CONFIG_KMM_NHEAPS - 1)
 
+/* Heaps tried first by the malloc_fast() and malloc_bulk() families */
+
+#ifndef CONFIG_RAM_MALLOC_FAST_INDEX
+#define CONFIG_RAM_MALLOC_FAST_INDEX HEAP_START_IDX
+#endif
+
+#ifndef CONFIG_RAM_MALLOC_BULK_INDEX
+#ifdef CONFIG_RAM_MALLOC_PRIOR_INDEX
+#define CONFIG_RAM_MALLOC_BULK_INDEX CONFIG_RAM_MALLOC_PRIOR_INDEX
+#else
+#define CONFIG_RAM_MALLOC_BULK_INDEX HEAP_END_IDX
+#endif
+#endif
+
 /* Function to manage the memory allocation failure case. */
 #if defined(CONFIG_APP_BINARY_SEPARATION) && !defined(__KERNEL__)
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
@@ -882,12 +1165,36 @@ void *realloc_at(int heap_index, void *oldmem, size_t size);
  * @since TizenRT v2.1 PRE
  */
 void *zalloc_at(int heap_index, size_t size);
+/**
+ * @brief Allocate memory preferably from the fast heap.
+ * @details @b #include <tinyara/mm/mm.h>\n
+ *   malloc_fast tries the heap of CONFIG_RAM_MALLOC_FAST_INDEX first and then
+ *   the other heaps. It is meant for latency-critical buffers.
+ * @param[in] size size (in bytes) of the memory region to be allocated
+ *
+ * @return On success, the address of the allocated memory is returned. On failure, NULL is returned.
+ * @since TizenRT v5.0
+ */
+void *malloc_fast(size_t size);
+/**
+ * @brief Allocate memory preferably from the bulk heap.
+ * @details @b #include <tinyara/mm/mm.h>\n
+ *   malloc_bulk tries the heap of CONFIG_RAM_MALLOC_BULK_INDEX first and then
+ *   the other heaps. It is meant for large buffers which are seldom touched.
+ * @param[in] size size (in bytes) of the memory region to be allocated
+ *
+ * @return On success, the address of the allocated memory is returned. On failure, NULL is returned.
+ * @since TizenRT v5.0
+ */
+void *malloc_bulk(size_t size);
 #else
 #define malloc_at(heap_index, size)              malloc(size)
 #define calloc_at(heap_index, n, elem_size)      calloc(n, elem_size)
 #define memalign_at(heap_index, alignment, size) memalign(alignment, size)
 #define realloc_at(heap_index, oldmem, size)     realloc(oldmem, size)
 #define zalloc_at(heap_index, size)              zalloc(size)
+#define malloc_fast(size)                        malloc(size)
+#define malloc_bulk(size)                        malloc(size)
 #endif
 
 #ifdef CONFIG_MEM_LEAK_CHECKER
@@ -952,12 +1259,16 @@ void *kmm_calloc_at(int heap_index, size_t n, size_t elem_size);
 void *kmm_memalign_at(int heap_index, size_t alignment, size_t size);
 void *kmm_realloc_at(int heap_index, void *oldmem, size_t size);
 void *kmm_zalloc_at(int heap_index, size_t size);
+void *kmm_malloc_fast(size_t size);
+void *kmm_malloc_bulk(size_t size);
 #else
 #define kmm_malloc_at(heap_index, size)              kmm_malloc(size)
 #define kmm_calloc_at(heap_index, n, elem_size)      kmm_calloc(n, elem_size)
 #define kmm_memalign_at(heap_index, alignment, size) kmm_memalign(alignment, size)
 #define kmm_realloc_at(heap_index, oldmem, size)     kmm_realloc(oldmem, size)
 #define kmm_zalloc_at(heap_index, size)              kmm_zalloc(size)
+#define kmm_malloc_fast(size)                        kmm_malloc(size)
+#define kmm_malloc_bulk(size)                        kmm_malloc(size)
 #endif
 #endif
 
@@ -63,6 +63,9 @@ enum mpu_region_usages_e {
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
 /* Separate three MPU regions (text, ro and rw) to optimize reloading time */
 #define NUM_APP_REGIONS     3
+#elif defined(CONFIG_XIP_ELF)
+/* A MPU region for the text in flash and one for the RAM partition */
+#define NUM_APP_REGIONS     2
 #else
 /* Just a MPU region for all of section data */
 #define NUM_APP_REGIONS     1
@@ -74,6 +74,20 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Messages of a priority below CONFIG_MQ_PRIO_BUCKETS - 1 are queued in
+ * constant time.  The higher priorities share the last bucket, where a
+ * message is still inserted by a search of the messages above it.  Each
+ * bucket costs a pointer in every message queue.  0 disables the buckets.
+ */
+
+#ifndef CONFIG_MQ_PRIO_BUCKETS
+#define CONFIG_MQ_PRIO_BUCKETS 8
+#endif
+
+#if CONFIG_MQ_PRIO_BUCKETS > 32
+#error "CONFIG_MQ_PRIO_BUCKETS must not be greater than 32"
+#endif
+
 /****************************************************************************
  * Global Type Declarations
  ****************************************************************************/
@@ -81,10 +95,15 @@
 /* This structure defines a message queue */
 
 struct mq_des;					/* forward reference */
+struct mqueue_msg_s;			/* forward reference */
 
 struct mqueue_inode_s {
 	FAR struct inode *inode;	/* Containing inode */
 	sq_queue_t msglist;			/* Prioritized message list */
+#if CONFIG_MQ_PRIO_BUCKETS > 0
+	uint32_t priomap;			/* Bit n is set if bucket n has messages */
+	FAR struct mqueue_msg_s *priotail[CONFIG_MQ_PRIO_BUCKETS];	/* Last message of each bucket */
+#endif
 	uint16_t maxmsgs;			/* Maximum number of messages in the queue */
 	uint16_t nmsgs;				/* Number of message in the queue */
 	int16_t nwaitnotfull;		/* Number tasks waiting for not full */
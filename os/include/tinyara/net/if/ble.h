@@ -149,6 +149,10 @@ typedef enum {
 	LWNL_REQ_BLE_SET_MULTI_RESP_DATA,
 	LWNL_REQ_BLE_START_MULTI_ADV,
 	LWNL_REQ_BLE_STOP_MULTI_ADV,
+
+	// Batched GATT operations
+	LWNL_REQ_BLE_OP_WRITE_NO_RESP_MULTI,
+	LWNL_REQ_BLE_CHARACT_NOTI_MULTI,
 	LWNL_REQ_BLE_UNKNOWN
 } lwnl_req_ble;
 
@@ -180,8 +184,27 @@ typedef enum {
 /*** BLE ioctl Message ***/
 typedef enum {
 	TRBLE_MSG_GET_VERSION,
+	TRBLE_MSG_SET_DATA_LEN,	/* data : trble_data_len * */
+	TRBLE_MSG_SET_PHY,		/* data : trble_phy * */
 } trble_ioctl_cmd;
 
+/* PHYs of TRBLE_MSG_SET_PHY, which can be combined */
+#define TRBLE_PHY_1M    0x01
+#define TRBLE_PHY_2M    0x02
+#define TRBLE_PHY_CODED 0x04
+
+typedef struct {
+	trble_conn_handle conn_handle;
+	uint16_t tx_octets;		/* largest payload of a link layer packet, 27 ~ 251 */
+	uint16_t tx_time;		/* largest time to send it in us, 328 ~ 17040 */
+} trble_data_len;
+
+typedef struct {
+	trble_conn_handle conn_handle;
+	uint8_t tx_phys;		/* preferred TRBLE_PHY_XXX */
+	uint8_t rx_phys;
+} trble_phy;
+
 typedef struct {
 	trble_ioctl_cmd cmd;
 	void *data;
@@ -202,6 +202,7 @@ typedef struct {
 	unsigned int passphrase_length;					/**<  ap passphrase length				 */
 	trwifi_ap_auth_type_e ap_auth_type;			 /**<  @ref trwifi_ap_auth_type		   */
 	trwifi_ap_crypto_type_e ap_crypto_type;		 /**<  @ref trwifi_ap_crypto_type	   */
+	unsigned int channel;							/**<  channel the AP was last found on, 0 if unknown. A driver may join on it without a full scan */
 } trwifi_ap_config_s;
 
 typedef struct {
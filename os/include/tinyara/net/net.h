@@ -443,6 +443,24 @@ int net_vfcntl(int sockfd, int cmd, va_list ap);
 
 int net_ioctl(int sockfd, int cmd, unsigned long arg);
 
+#ifdef CONFIG_NET_EPOLL
+/****************************************************************************
+ * Function: net_epoll_*
+ *
+ * Description:
+ *   The network stack part of epoll: fs/vfs/fs_epoll.c keeps the instance
+ *   returned by net_epoll_create() in the inode of the epoll descriptor.
+ *
+ ****************************************************************************/
+
+struct epoll_event;
+void *net_epoll_create(void);
+void net_epoll_close(void *ep);
+int net_epoll_ctl(void *ep, int op, int sd, struct epoll_event *ev);
+int net_epoll_wait(void *ep, struct epoll_event *events, int maxevents, int timeout);
+int net_epoll_poll(void *ep, struct pollfd *fds, bool setup);
+#endif
+
 /****************************************************************************
  * Function: netdev_foreach
  *
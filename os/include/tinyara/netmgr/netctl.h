@@ -20,6 +20,7 @@
 
 #if CONFIG_NET_LWIP
 #include <sys/types.h>
+#include <netinet/in.h>
 
 typedef enum {
 	GETADDRINFO,
@@ -59,6 +60,7 @@ struct lwip_dns_msg {
 struct lwip_dhcp_msg {
 	const char *intf;
 	const char *hostname;
+	struct in_addr addr; // DHCPCSTART: address of a previous lease to request, 0 for none
 };
 
 struct lwip_netmon_msg {
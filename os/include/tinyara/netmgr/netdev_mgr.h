@@ -41,6 +41,22 @@
  * Set by the netif driver in its init function. */
 #define NM_FLAG_MLD6         0x40U
 
+/** Checksum offloads of the device, set in netdev_config.offload.
+ * The stack leaves the checksums the device computes or verifies to it.
+ * Used with CONFIG_NET_NETDEV_CSUM_OFFLOAD only, ignored otherwise. */
+/** The device computes the IPv4 header checksum of sent packets */
+#define NM_OFFLOAD_TX_CSUM_IP   0x01U
+/** The device computes the TCP checksum of sent packets */
+#define NM_OFFLOAD_TX_CSUM_TCP  0x02U
+/** The device computes the UDP checksum of sent packets */
+#define NM_OFFLOAD_TX_CSUM_UDP  0x04U
+/** The device drops received IPv4 packets with a bad header checksum */
+#define NM_OFFLOAD_RX_CSUM_IP   0x10U
+/** The device drops received TCP segments with a bad checksum */
+#define NM_OFFLOAD_RX_CSUM_TCP  0x20U
+/** The device drops received UDP datagrams with a bad checksum */
+#define NM_OFFLOAD_RX_CSUM_UDP  0x40U
+
 typedef enum {
 	NM_LOOPBACK,
 	NM_WIFI,
@@ -81,11 +97,21 @@ struct nic_io_ops {
 	 */
 	int (*linkoutput)(struct netdev *dev, void *data, uint16_t len);
 	int (*igmp_mac_filter)(struct netdev *netif, const struct in_addr *group, netdev_mac_filter_action action);
+	/* DESC:
+	 * optional, it is called with low 1 when few of the receive buffers
+	 * reserved to the device are left (NET_NETDEV_RXPOOL), so the driver
+	 * can slow down its peer or stop refilling, and with low 0 once half
+	 * of them are free again.
+	 * It may run in the thread that frees a buffer, so it must not block.
+	 */
+	void (*rx_pressure)(struct netdev *dev, int low);
 };
 
 struct netdev_config {
 	struct nic_io_ops *ops;
 	int flag;
+	int offload; /* NM_OFFLOAD_XXX */
+	int rx_reserve; /* receive buffers reserved to the device, 0 for the default */
 	int mtu;
 	int hwaddr_len;
 	uint8_t hwaddr[NM_MAX_HWADDR_LEN];
@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+/*
+ * Network statistics
+ *
+ * netstats_get() samples the counters of the network manager, the packet
+ * size histograms of each network device and the state of the TCP
+ * connections. It is read through /proc/netstats and 'netmon netstats'.
+ */
+
+#include <tinyara/config.h>
+
+#ifdef CONFIG_NET_STATS
+#include <stdint.h>
+#include <net/if.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CONFIG_NETDEV_NUM
+#define CONFIG_NETDEV_NUM 3
+#endif
+
+/* Upper bounds of the bins of the packet size histograms, the last bin
+ * takes the larger packets.
+ */
+#define NETSTATS_HIST_BOUNDS {64, 128, 256, 512, 1024, 1518}
+#define NETSTATS_NBINS 7
+
+/* TCP connections sampled at most */
+#define NETSTATS_MAX_TCP 16
+
+struct netstats_dev {
+	char ifname[IFNAMSIZ];
+	uint32_t rx[NETSTATS_NBINS];
+	uint32_t tx[NETSTATS_NBINS];
+};
+
+struct netstats_tcp {
+	uint32_t local_ip;  // IPv4, network order, 0 for IPv6
+	uint16_t local_port;
+	uint32_t remote_ip;
+	uint16_t remote_port;
+	uint8_t state;      // enum tcp_state
+	uint32_t srtt;      // smoothed RTT in ms, 0 before the first sample
+	uint32_t rto;       // retransmission timeout in ms
+	uint32_t cwnd;
+	uint32_t ssthresh;
+	uint8_t nrtx;       // retransmissions of the current segment
+	uint16_t snd_queuelen;
+};
+
+struct netstats {
+	uint32_t link_recv_byte;
+	uint32_t link_recv_cnt;
+	uint32_t app_recv_byte;
+	uint32_t app_recv_cnt;
+
+	/* dropped packets by reason */
+	uint32_t drop_pbuf;   // no pbuf to copy a received frame to
+	uint32_t drop_mbox;   // the mailbox of the tcpip thread is full
+	uint32_t drop_ooseq;  // out-of-sequence TCP segments freed
+
+	int ndev;
+	struct netstats_dev dev[CONFIG_NETDEV_NUM];
+	int ntcp;
+	struct netstats_tcp tcp[NETSTATS_MAX_TCP];
+};
+
+int netstats_get(struct netstats *st);
+void netstats_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_NET_STATS */
@@ -0,0 +1,58 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+/*
+ * Zero-copy socket API
+ *
+ * recvfrom_zc() returns the pbuf chain the stack received the data in.
+ * The data is read by walking the chain (p->payload, p->len, p->next; the
+ * total is p->tot_len) and the chain is given back with recv_zc_release().
+ * Received pbufs that are held for long keep the stack from receiving more.
+ *
+ * sendto_zc() sends a datagram from the caller's buffer. The buffer must be
+ * left untouched until 'sent' is called. 'sent' runs once the stack and the
+ * network driver no longer reference it, possibly before sendto_zc()
+ * returns and from another thread, so it must not block. It is called if
+ * and only if sendto_zc() succeeds. Stream sockets copy the data and call
+ * 'sent' before returning.
+ */
+
+#include <tinyara/config.h>
+
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+#include <sys/types.h>
+#include <sys/socket.h>
+#include "lwip/pbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*zc_sent_t)(void *arg);
+
+ssize_t recvfrom_zc(int sockfd, struct pbuf **p, int flags, struct sockaddr *from, socklen_t *fromlen);
+void recv_zc_release(struct pbuf *p);
+ssize_t sendto_zc(int sockfd, const void *data, size_t size, int flags, const struct sockaddr *to, socklen_t tolen, zc_sent_t sent, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_NET_SOCKET_ZEROCOPY */
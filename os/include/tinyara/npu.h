@@ -0,0 +1,238 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_NPU_H
+#define __INCLUDE_TINYARA_NPU_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <tinyara/compiler.h>
+#include <tinyara/fs/ioctl.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef CONFIG_NPU
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define NPU_DEVNAME_FMT     "/dev/npu%d"
+#define NPU_NAME_LEN        16
+
+/* IOCTL Commands ***********************************************************/
+/* The NPU driver runs models on a neural network accelerator.  An invoke
+ * only starts the inference: the caller is free to do other work or to
+ * sleep in NPUIOC_WAIT while the accelerator runs, and the lower half
+ * reports the completion from its interrupt handler.  One invoke at a time
+ * runs on a device.
+ *
+ * NPUIOC_GETINFO   - Get the capabilities of the accelerator.
+ *                    Argument: A writeable pointer to struct npu_info_s.
+ * NPUIOC_LOAD      - Load a model.
+ *                    Argument: A pointer to struct npu_model_s, of which
+ *                    handle, ninputs and noutputs are set by the driver.
+ * NPUIOC_UNLOAD    - Unload a model.
+ *                    Argument: The handle of the model.
+ * NPUIOC_GETTENSOR - Get the type and size of an input or output.
+ *                    Argument: A pointer to struct npu_tensor_s, of which
+ *                    type, scale, zeropoint and count are set by the driver.
+ * NPUIOC_INVOKE    - Start an inference.
+ *                    Argument: A read-only pointer to struct npu_invoke_s.
+ *                    Returns -EBUSY while the previous invoke runs.
+ * NPUIOC_WAIT      - Wait for the end of the inference started last.
+ *                    Argument: Ignored.  Returns the result of the invoke.
+ * NPUIOC_RESET     - Clear the state kept by a model between invokes.
+ *                    Argument: The handle of the model.
+ */
+
+#define NPUIOC_GETINFO      _NPUIOC(0x0001)
+#define NPUIOC_LOAD         _NPUIOC(0x0002)
+#define NPUIOC_UNLOAD       _NPUIOC(0x0003)
+#define NPUIOC_GETTENSOR    _NPUIOC(0x0004)
+#define NPUIOC_INVOKE       _NPUIOC(0x0005)
+#define NPUIOC_WAIT         _NPUIOC(0x0006)
+#define NPUIOC_RESET        _NPUIOC(0x0007)
+
+/* Bit Settings *************************************************************/
+/* Model formats, for the formats field of struct npu_info_s and the format
+ * field of struct npu_model_s
+ */
+
+#define NPU_FORMAT_TFLITE   (1 << 0)	/* TensorFlow Lite flatbuffer */
+#define NPU_FORMAT_CIRCLE   (1 << 1)	/* Circle flatbuffer (ONE compiler) */
+#define NPU_FORMAT_VENDOR   (1 << 2)	/* Binary compiled for the accelerator */
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Element types of the inputs and outputs */
+
+enum npu_tensor_type_e {
+	NPU_TENSOR_FLOAT32 = 0,
+	NPU_TENSOR_INT8 = 1,
+	NPU_TENSOR_INT16 = 2
+};
+
+/* This is the type of the argument passed to the NPUIOC_GETINFO ioctl */
+
+struct npu_info_s {
+	char name[NPU_NAME_LEN];	/* Name of the accelerator */
+	uint8_t formats;		/* Model formats supported, NPU_FORMAT_* */
+	uint8_t maxmodels;		/* Models which may be loaded at once */
+	uint32_t memsize;		/* Memory for the models, in bytes */
+};
+
+/* This is the type of the argument passed to the NPUIOC_LOAD ioctl */
+
+struct npu_model_s {
+	FAR const void *data;		/* The model, which must outlive its load */
+	size_t size;			/* Size of the model, 0 if not known */
+	uint8_t format;			/* One of NPU_FORMAT_* */
+	int handle;			/* OUT: Handle of the model */
+	uint16_t ninputs;		/* OUT: Number of inputs */
+	uint16_t noutputs;		/* OUT: Number of outputs */
+};
+
+/* This is the type of the argument passed to the NPUIOC_GETTENSOR ioctl.
+ * A quantized value q stands for scale * (q - zeropoint).
+ */
+
+struct npu_tensor_s {
+	int handle;			/* Handle of the model */
+	bool output;			/* false for an input, true for an output */
+	uint16_t index;			/* Index of the input or output */
+	uint8_t type;			/* OUT: One of enum npu_tensor_type_e */
+	float scale;			/* OUT: Quantization scale */
+	int32_t zeropoint;		/* OUT: Quantization zero point */
+	uint32_t count;			/* OUT: Number of elements */
+};
+
+/* This is the type of the argument passed to the NPUIOC_INVOKE ioctl.  The
+ * buffers must stay valid until the end of the inference.
+ */
+
+struct npu_invoke_s {
+	int handle;			/* Handle of the model */
+	FAR void *const *inputs;	/* One buffer per input of the model */
+	FAR void *const *outputs;	/* One buffer per output of the model */
+};
+
+/* Completion callback given to the lower half, called once per invoke with
+ * OK or a negated errno value, possibly from an interrupt handler.
+ */
+
+typedef CODE void (*npu_callback_t)(FAR void *arg, int result);
+
+/* This structure provides the "lower-half" driver operations available to
+ * the "upper-half" driver.
+ */
+
+struct npu_lowerhalf_s;
+struct npu_ops_s {
+	/* Required methods ***************************************************/
+	/* Get the capabilities of the accelerator */
+
+	CODE int (*getinfo)(FAR struct npu_lowerhalf_s *lower, FAR struct npu_info_s *info);
+
+	/* Load a model, setting its handle and number of inputs and outputs */
+
+	CODE int (*load)(FAR struct npu_lowerhalf_s *lower, FAR struct npu_model_s *model);
+
+	/* Unload a model */
+
+	CODE int (*unload)(FAR struct npu_lowerhalf_s *lower, int handle);
+
+	/* Get the type and size of an input or output of a model */
+
+	CODE int (*gettensor)(FAR struct npu_lowerhalf_s *lower, FAR struct npu_tensor_s *tensor);
+
+	/* Start an inference and return, calling the callback at its end */
+
+	CODE int (*invoke)(FAR struct npu_lowerhalf_s *lower, FAR const struct npu_invoke_s *invoke);
+
+	/* Set the completion callback */
+
+	CODE void (*setcallback)(FAR struct npu_lowerhalf_s *lower, npu_callback_t callback, FAR void *arg);
+
+	/* Optional methods ***************************************************/
+	/* Clear the state kept by a model between invokes */
+
+	CODE int (*reset)(FAR struct npu_lowerhalf_s *lower, int handle);
+
+	/* Abort the running inference, without calling the callback */
+
+	CODE int (*cancel)(FAR struct npu_lowerhalf_s *lower);
+};
+
+/* This structure provides the publicly visible representation of the
+ * "lower-half" driver state structure.  "lower half" drivers will have an
+ * internal structure definition that will be cast-compatible with this
+ * structure definitions.
+ */
+
+struct npu_lowerhalf_s {
+	/* Publicly visible portion of the "lower-half" driver state structure. */
+
+	FAR const struct npu_ops_s *ops;	/* Lower half operations */
+
+	/* The remainder of the structure is used by the "lower-half" driver
+	 * for whatever state storage that it may need.
+	 */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: npu_register
+ *
+ * Description:
+ *   Register the lower half of an accelerator as /dev/npuN, to be called
+ *   by the board.
+ *
+ * Input parameters:
+ *   minor - N of /dev/npuN
+ *   lower - The lower half of the accelerator
+ *
+ * Returned Value:
+ *   OK on success, a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int npu_register(int minor, FAR struct npu_lowerhalf_s *lower);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_NPU */
+#endif /* __INCLUDE_TINYARA_NPU_H */
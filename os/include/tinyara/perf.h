@@ -0,0 +1,194 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_PERF_H
+#define __INCLUDE_TINYARA_PERF_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/* CONFIG_PERF_METRICS adds a registry of the performance metrics of the
+ * kernel subsystems: counters, gauges and histograms, named
+ * "<subsystem>.<metric>".  They are read as text from /proc/perf/metrics
+ * and all at once, in binary, with PERFIOC_SNAPSHOT of PERF_DRVPATH.
+ * CONFIG_PERF_MAX_BUCKETS bounds the buckets of a histogram.
+ *
+ * CONFIG_PERF_EVENTS counts two hardware events per thread, the L1 D and
+ * I cache refills, from the PMU event counters read at each context
+ * switch.  It needs an ARMv7-A PMU: the DWT event counters of Cortex-M are
+ * 8 bits wide and wrap unseen within a time slice, as their overflows only
+ * go to the trace port.  Events in interrupt handlers are charged to
+ * the interrupted thread.  They are read from /proc/perf/tasks, along with
+ * the cycles of CONFIG_SCHED_CPULOAD_CYCLES, and with PERFIOC_TASKS.
+ */
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#if defined(CONFIG_PERF_EVENTS) && !defined(CONFIG_PERF_METRICS)
+#error CONFIG_PERF_EVENTS requires CONFIG_PERF_METRICS
+#endif
+
+#if defined(CONFIG_PERF_EVENTS) && !defined(CONFIG_ARCH_ARMV7A_FAMILY)
+#error CONFIG_PERF_EVENTS requires the PMU of an ARMv7-A CPU
+#endif
+
+#define PERF_DRVPATH           "/dev/perf"
+
+#ifndef CONFIG_PERF_MAX_BUCKETS
+#define CONFIG_PERF_MAX_BUCKETS 8
+#endif
+
+#define PERF_NAME_SIZE         32	/* Name in a snapshot, with its NUL */
+#define PERF_NEVENTS           2	/* Hardware events counted per thread */
+#define PERF_EVENT_NAME_SIZE   16
+
+/* Static initializers of the metrics.  A histogram has one bucket more
+ * than bounds: bucket i counts the samples up to bounds[i], the last one
+ * the samples above all the bounds.
+ */
+
+#define PERF_COUNTER_INITIALIZER(n) \
+	{ NULL, (n), PERF_TYPE_COUNTER, 0, NULL, NULL, NULL, NULL, 0, 0 }
+#define PERF_GAUGE_INITIALIZER(n, r, a) \
+	{ NULL, (n), PERF_TYPE_GAUGE, 0, NULL, NULL, (r), (a), 0, 0 }
+#define PERF_HISTOGRAM_INITIALIZER(n, b, nb, k) \
+	{ NULL, (n), PERF_TYPE_HISTOGRAM, (nb), (b), (k), NULL, NULL, 0, 0 }
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+enum perf_type_e {
+	PERF_TYPE_COUNTER = 0,		/* Only grows, cleared by PERFIOC_RESET */
+	PERF_TYPE_GAUGE,			/* Current value, set or read on demand */
+	PERF_TYPE_HISTOGRAM			/* Samples by bucket, their count and sum */
+};
+
+struct perf_metric_s;
+typedef CODE int64_t (*perf_read_t)(FAR struct perf_metric_s *metric);
+
+/* A metric, allocated by its subsystem for as long as it is registered */
+
+struct perf_metric_s {
+	FAR struct perf_metric_s *flink;
+	FAR const char *name;
+	uint8_t type;				/* See enum perf_type_e */
+	uint8_t nbounds;			/* Histogram: number of bounds */
+	FAR const uint32_t *bounds;	/* Histogram: upper bounds, ascending */
+	FAR uint32_t *buckets;		/* Histogram: nbounds + 1 buckets */
+	perf_read_t read;			/* Gauge: value read on demand, or NULL */
+	FAR void *arg;				/* For the read function */
+	int64_t value;				/* Counter, gauge, or sum of the samples */
+	uint32_t count;				/* Histogram: number of samples */
+};
+
+/* One metric of PERFIOC_SNAPSHOT */
+
+struct perf_value_s {
+	char name[PERF_NAME_SIZE];
+	uint8_t type;
+	uint8_t nbuckets;			/* Histogram: buckets used */
+	int64_t value;
+	uint32_t count;
+	uint32_t bounds[CONFIG_PERF_MAX_BUCKETS - 1];
+	uint32_t buckets[CONFIG_PERF_MAX_BUCKETS];
+};
+
+/* Argument of PERFIOC_SNAPSHOT: room for 'nvalues' values.  The ioctl
+ * returns the number of metrics copied.
+ */
+
+struct perf_snapshot_s {
+	int nvalues;
+	FAR struct perf_value_s *values;
+};
+
+/* One thread of PERFIOC_TASKS, since boot or the last PERFIOC_RESET */
+
+struct perf_task_s {
+	pid_t pid;
+#if CONFIG_TASK_NAME_SIZE > 0
+	char name[CONFIG_TASK_NAME_SIZE + 1];
+#endif
+	uint64_t cycles;			/* With CONFIG_SCHED_CPULOAD_CYCLES, else 0 */
+	uint64_t events[PERF_NEVENTS];
+};
+
+/* Argument of PERFIOC_TASKS: room for 'ntasks' threads.  The ioctl returns
+ * the number of threads copied.
+ */
+
+struct perf_tasks_s {
+	uint32_t freq;				/* Cycle counter frequency, 0 if unknown */
+	char event[PERF_NEVENTS][PERF_EVENT_NAME_SIZE];
+	int ntasks;
+	FAR struct perf_task_s *tasks;
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+#ifdef CONFIG_PERF_METRICS
+void perf_initialize(void);
+
+/* Kernel interfaces of the subsystems */
+
+int perf_register(FAR struct perf_metric_s *metric);
+void perf_unregister(FAR struct perf_metric_s *metric);
+void perf_count(FAR struct perf_metric_s *metric, uint32_t n);
+void perf_set(FAR struct perf_metric_s *metric, int64_t value);
+void perf_observe(FAR struct perf_metric_s *metric, uint32_t sample);
+
+int perf_snapshot(FAR struct perf_value_s *values, int nvalues);
+int perf_get_tasks(FAR struct perf_tasks_s *tasks);
+void perf_reset(void);
+
+/* Register PERF_DRVPATH */
+
+void perf_drv_register(void);
+#endif
+
+#ifdef CONFIG_PERF_EVENTS
+struct tcb_s;
+void perf_events_switch(FAR struct tcb_s *tcb);
+void perf_events_clear(pid_t pid);
+#else
+#define perf_events_switch(tcb)
+#define perf_events_clear(pid)
+#endif
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __INCLUDE_TINYARA_PERF_H */
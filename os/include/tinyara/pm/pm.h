@@ -85,6 +85,7 @@
  ****************************************************************************/
 
 #include <tinyara/config.h>
+#include <stdint.h>
 #include <queue.h>
 #include <semaphore.h>
 #include <tinyara/clock.h>
@@ -137,6 +138,13 @@ typedef struct pm_domain_arg_s pm_domain_arg_t;
 /* Defines max length of device driver name for PM callback. */
 #define MAX_PM_CALLBACK_NAME    32
 
+/* Value of a latency constraint when the domain has none. */
+#define PM_QOS_LATENCY_NONE     UINT32_MAX
+
+/* Voltage frequency scaling levels of pm_dvfs(), 0 is the full frequency. */
+#define PM_DVFS_NLEVELS         4
+#define PM_DVFS_MAX_LEVEL       (PM_DVFS_NLEVELS - 1)
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -197,6 +205,18 @@ typedef enum {
 	PM_WAKEUP_SRC_COUNT,
 } pm_wakeup_reason_code_t;
 
+/* This enumeration provides the types of PM QoS constraints of a domain. */
+
+enum pm_qos_type_e {
+	PM_QOS_LATENCY,				/* The largest wakeup latency the domain tolerates, in
+								 * microseconds. PM does not enter a state which takes
+								 * longer to get back to normal operation.
+								 */
+	PM_QOS_THROUGHPUT,			/* The part of the full CPU frequency the domain needs,
+								 * in percent. The DVFS governor does not go slower.
+								 */
+};
+
 /* This structure contain pointers callback functions in the driver.  These
  * callback functions can be used to provide power management information
  * to the driver.
@@ -496,6 +516,57 @@ int pm_sleep(int milliseconds);
 
 int pm_timedsuspend(int domain_id, unsigned int milliseconds);
 
+#ifdef CONFIG_PM_QOS
+/****************************************************************************
+ * Name: pm_qos_request
+ *
+ * Description:
+ *   This function is called by a device driver to set a QoS constraint of
+ *   its domain, instead of holding the domain suspended. A latency
+ *   constraint lets the board sleep as long as waking up takes less than
+ *   the tolerated latency. A throughput constraint keeps the CPU frequency
+ *   high enough while the DVFS governor is running. A new request of the
+ *   same type replaces the previous one of the domain.
+ *
+ * Input Parameters:
+ *   domain_id - The domain ID of the PM activity
+ *   type      - PM_QOS_LATENCY or PM_QOS_THROUGHPUT
+ *   value     - The tolerated latency in microseconds, or the needed part
+ *               of the full frequency in percent (1 to 100)
+ *
+ * Returned Value:
+ *   0 - On Success
+ *  -1 - On Error
+ *
+ * Assumptions:
+ *   This function may be called from an interrupt handler.
+ *
+ ****************************************************************************/
+
+int pm_qos_request(int domain_id, enum pm_qos_type_e type, uint32_t value);
+
+/****************************************************************************
+ * Name: pm_qos_release
+ *
+ * Description:
+ *   This function removes the QoS constraint of this type from the domain.
+ *
+ * Input Parameters:
+ *   domain_id - The domain ID of the PM activity
+ *   type      - PM_QOS_LATENCY or PM_QOS_THROUGHPUT
+ *
+ * Returned Value:
+ *   0 - On Success
+ *  -1 - On Error
+ *
+ ****************************************************************************/
+
+int pm_qos_release(int domain_id, enum pm_qos_type_e type);
+#else
+#define pm_qos_request(domain_id, type, value)	(0)
+#define pm_qos_release(domain_id, type)	(0)
+#endif
+
 /****************************************************************************
  * Name: pm_suspendcount
  *
@@ -535,8 +606,59 @@ int pm_suspendcount(int domain_id);
  *
  ****************************************************************************/
 void pm_dvfs(int div_lvl);
+
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+/****************************************************************************
+ * Name: pm_dvfs_request
+ *
+ * Description:
+ *   This function is called by drivers with latency constraints, such as
+ *   audio or Wi-Fi, to keep the CPU at div_lvl or at a faster level while
+ *   the load governor is running. If the current level is slower, div_lvl
+ *   is applied at once. Requests are counted, each one should be released
+ *   by pm_dvfs_release() with the same level.
+ *
+ * Input Parameters:
+ *   div_lvl - the slowest voltage frequency scaling level allowed
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+void pm_dvfs_request(int div_lvl);
+
+/****************************************************************************
+ * Name: pm_dvfs_release
+ *
+ * Description:
+ *   This function releases a request of pm_dvfs_request().
+ *
+ * Input Parameters:
+ *   div_lvl - the level given to pm_dvfs_request()
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+void pm_dvfs_release(int div_lvl);
+
+/****************************************************************************
+ * Name: pm_dvfs_process_load
+ *
+ * Description:
+ *   This internal function is called by sched_process_cpuload() on each
+ *   tick to choose the voltage frequency scaling level from the CPU load.
+ *
+ ****************************************************************************/
+void pm_dvfs_process_load(void);
+#else
+#define pm_dvfs_request(div_lvl)
+#define pm_dvfs_release(div_lvl)
+#endif
 #else
 #define pm_dvfs(div_lvl)	(0)
+#define pm_dvfs_request(div_lvl)
+#define pm_dvfs_release(div_lvl)
 #endif
 
 #ifdef CONFIG_PM_METRICS
@@ -580,6 +702,8 @@ int pm_metrics(int milliseconds);
 #define pm_sleep(milliseconds)				usleep(milliseconds * USEC_PER_MSEC)
 #define pm_timedsuspend(domain_id, milliseconds)	(0)
 #define pm_suspendcount(domain_id)   (0)
+#define pm_qos_request(domain_id, type, value)	(0)
+#define pm_qos_release(domain_id, type)	(0)
 
 #endif							/* CONFIG_PM */
 
@@ -58,7 +58,9 @@
  ****************************************************************************/
 
 #include <tinyara/config.h>
+#include <stdbool.h>
 #include <pthread.h>
+#include <semaphore.h>
 #include <sched.h>
 
 /****************************************************************************
@@ -120,4 +122,45 @@ EXTERN const pthread_attr_t g_default_pthread_attr;
 }
 #endif
 
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_mutex_isfast
+ *
+ * Description:
+ *   Return true if the mutex may be locked and unlocked in user space by
+ *   CONFIG_PTHREAD_MUTEX_FASTPATH.  That is a mutex the kernel keeps no
+ *   state about while it is held: a non-robust NORMAL mutex whose
+ *   semaphore does not record its holders.  Such a mutex is never added
+ *   to the list of mutexes held by a thread and its pid is not maintained.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+static inline bool pthread_mutex_isfast(FAR const pthread_mutex_t *mutex)
+{
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+	if (mutex->type != PTHREAD_MUTEX_NORMAL) {
+		return false;
+	}
+#endif
+#ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
+	if ((mutex->flags & _PTHREAD_MFLAGS_ROBUST) != 0) {
+		return false;
+	}
+#endif
+#if defined(CONFIG_PRIORITY_INHERITANCE) && !defined(CONFIG_BINMGR_RECOVERY)
+	/* See sem_addholder_tcb(): holders are only saved with inheritance */
+
+	return (mutex->sem.flags & PRIOINHERIT_FLAGS_DISABLE) != 0;
+#elif defined(SAVE_SEM_HOLDER)
+	return false;
+#else
+	return true;
+#endif
+}
+#endif
+
 #endif							/* __INCLUDE_TINYARA_PTHREAD_H */
@@ -201,6 +201,23 @@
 #define MAX_PID_MASK	(CONFIG_MAX_TASKS - 1)
 #define PIDHASH(pid)	((pid) & MAX_PID_MASK)
 
+/* Wakeup latency histograms have one bucket per power of two microseconds:
+ * bucket n holds the samples in [2^(n-1), 2^n - 1] usec, bucket 0 holds
+ * zero and the last bucket holds everything above.
+ */
+
+#define SCHED_LATENCY_NBUCKETS	20
+
+/* The holds of the hold time profile, see CONFIG_SCHED_HOLDTIME */
+
+#define SCHED_HOLDTIME_CSECTION		0	/* enter_critical_section() */
+#define SCHED_HOLDTIME_SCHEDLOCK	1	/* sched_lock() */
+#define SCHED_HOLDTIME_NTYPES		2
+
+#ifndef CONFIG_SCHED_HOLDTIME_NSITES
+#define CONFIG_SCHED_HOLDTIME_NSITES	32
+#endif
+
 /********************************************************************************
  * Public Type Definitions
  ********************************************************************************/
@@ -294,6 +311,52 @@ struct child_status_s {
 };
 #endif
 
+/* struct sched_latency_s ********************************************************/
+/** @brief This structure holds the wakeup latency of one thread: the time from
+ * leaving a blocked state to actually running, see CONFIG_SCHED_LATENCY.
+ */
+#ifdef CONFIG_SCHED_LATENCY
+struct sched_latency_s {
+	bool waiting;				/* Made ready-to-run, not yet running  */
+	uint32_t readytime;			/* Time it was made ready-to-run (usec) */
+	uint32_t count;				/* Number of samples                   */
+	uint32_t max;				/* Worst latency (usec)                */
+	uint64_t total;				/* Sum of all the latencies (usec)     */
+	uint32_t bucket[SCHED_LATENCY_NBUCKETS];	/* log2 histogram      */
+};
+#endif
+
+/* struct sched_holdsite_s *******************************************************/
+/** @brief This structure holds the critical sections or the scheduler locks
+ * taken at one call site, in cycles of up_perf_gettime(), see
+ * CONFIG_SCHED_HOLDTIME.
+ */
+#ifdef CONFIG_SCHED_HOLDTIME
+struct sched_holdsite_s {
+	FAR void *caller;			/* Return address of the lock call     */
+	uint32_t count;				/* Number of holds                     */
+	uint32_t max;				/* Longest hold                        */
+	pid_t maxpid;				/* Thread of the longest hold          */
+	uint64_t total;				/* Sum of all the holds                */
+};
+#endif
+
+/* struct sporadic_s *************************************************************/
+/** @brief This structure holds the state of a SCHED_SPORADIC thread, see
+ * CONFIG_SCHED_SPORADIC.  The times are in system ticks.
+ */
+#ifdef CONFIG_SCHED_SPORADIC
+struct sporadic_s {
+	uint8_t hi_priority;		/* Priority while there is budget      */
+	uint8_t low_priority;		/* Priority once the budget is used    */
+	bool suspended;				/* At the low priority                 */
+	unsigned int budget;		/* Budget of each period               */
+	unsigned int period;		/* Replenishment period                */
+	unsigned int remaining;		/* Budget left in this period          */
+	FAR struct wdog_s *timer;	/* Start of the next period            */
+};
+#endif
+
 /* struct pthread_cleanup_s ******************************************************/
 /* This structure describes one element of the pthread cleanup stack */
 
@@ -595,8 +658,13 @@ struct tcb_s {
 
 #if CONFIG_RR_INTERVAL > 0
 	int timeslice;				/* RR timeslice interval remaining     */
+#endif
+#ifdef CONFIG_SCHED_SPORADIC
+	FAR struct sporadic_s *sporadic;	/* SCHED_SPORADIC state, or NULL     */
 #endif
 	FAR struct wdog_s *waitdog;	/* All timed waits used this wdog      */
+	uint16_t timer_slack;		/* Slack of sleeps in ticks, see       */
+								/* PR_SET_TIMERSLACK                   */
 
 	/* Stack-Related Fields ****************************************************** */
 
@@ -645,6 +713,11 @@ struct tcb_s {
 
 #ifndef CONFIG_DISABLE_MQUEUE
 	FAR struct mqueue_inode_s *msgwaitq;	/* Waiting for this message queue      */
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	FAR char *msgrcvbuf;		/* Buffer of the receive waiting on msgwaitq */
+	ssize_t msgrcvlen;			/* Length of a message sent to msgrcvbuf, or -1 */
+	int msgrcvprio;				/* Priority of that message            */
+#endif
 #endif
 
 	/* Library related fields **************************************************** */
@@ -685,6 +758,9 @@ struct tcb_s {
 #ifdef CONFIG_TASK_MONITOR
 	bool is_active;
 #endif
+#ifdef CONFIG_SCHED_LATENCY
+	struct sched_latency_s latency;	/* Wakeup-to-run latency histogram */
+#endif
 
 	int fin_data;			/* Irq notification Data to be handled */
 	int pending_fin_data;		/* Pended irq notification data */
@@ -799,6 +875,20 @@ struct stkmon_save_s {
 };
 
 void stkmon_copy_log(struct stkmon_save_s *dest_arr);
+
+#ifdef CONFIG_STACK_WATERMARK
+#ifndef CONFIG_STACK_WATERMARK_NENTRIES
+#define CONFIG_STACK_WATERMARK_NENTRIES 64
+#endif
+
+/* Highest stack usage of the threads of a name, see stack_watermark_get() */
+struct stack_watermark_s {
+	char name[CONFIG_TASK_NAME_SIZE + 1];
+	size_t stacksize;			/* Largest stack size of the threads */
+	size_t peak;				/* Highest stack usage */
+	uint32_t count;				/* Number of marks recorded */
+};
+#endif
 /* 
  * }
  * @endcond
@@ -900,6 +990,27 @@ void sched_clear_cpuload_snapshot(void);
 void sched_get_cpuload_snapshot(pid_t *result_addr);
 #endif
 
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+struct cpuload_cycles_s;
+void sched_get_cycles(FAR struct cpuload_cycles_s *cycles);
+void sched_reset_cycles(void);
+#endif
+
+#ifdef CONFIG_SCHED_LATENCY
+void sched_latency_clear(void);
+#endif
+
+#ifdef CONFIG_SCHED_HOLDTIME
+int sched_holdtime_get(int type, FAR struct sched_holdsite_s *sites, int nsites, FAR uint32_t *evicted);
+void sched_holdtime_clear(void);
+#endif
+
+#ifdef CONFIG_STACK_WATERMARK
+void stack_watermark_sample(void);
+int stack_watermark_get(FAR struct stack_watermark_s *marks, int nmarks);
+void stack_watermark_clear(void);
+#endif
+
 /********************************************************************************
  * Name: task_starthook
  *
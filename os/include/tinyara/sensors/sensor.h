@@ -0,0 +1,184 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_SENSORS_SENSOR_H
+#define __INCLUDE_TINYARA_SENSORS_SENSOR_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <tinyara/fs/ioctl.h>
+
+#ifdef CONFIG_SENSOR_UPPERHALF
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Sensor ioctl commands ****************************************************/
+
+/* Start (arg 1) or stop (arg 0) sampling */
+
+#define SNIOC_ACTIVATE            _SNIOC(0x0001)
+
+/* Set the sample interval in microseconds.  arg is a uint32_t *, set to the
+ * interval taken by the sensor.
+ */
+
+#define SNIOC_SET_INTERVAL        _SNIOC(0x0002)
+
+/* Set the number of samples per wakeup, the watermark of the hardware FIFO.
+ * arg is a uint32_t *, set to the number taken by the sensor.  It is 1 for
+ * sensors without a FIFO.
+ */
+
+#define SNIOC_BATCH               _SNIOC(0x0003)
+
+/* Get the state of the sensor.  arg is a struct sensor_info_s * */
+
+#define SNIOC_GET_INFO            _SNIOC(0x0004)
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* A sample as read() returns it.  Only the first nvalues of value[] are
+ * used, see struct sensor_info_s.
+ */
+
+struct sensor_sample_s {
+	uint64_t timestamp;			/* Time of the sample, microseconds since boot */
+	float value[CONFIG_SENSOR_NVALUES];	/* Values of the sample */
+};
+
+/* Argument of SNIOC_GET_INFO */
+
+struct sensor_info_s {
+	uint8_t nvalues;			/* Number of values per sample */
+	uint16_t fifo_depth;		/* Depth of the hardware FIFO, 0 if none */
+	uint32_t interval;			/* Sample interval in microseconds */
+	uint32_t batch;				/* Samples per wakeup */
+	uint32_t overruns;			/* Samples dropped because nobody read them */
+};
+
+/* The lower half of a sensor.  It reads the hardware FIFO when the
+ * watermark interrupt comes and gives the whole batch to sensor_push().
+ */
+
+struct sensor_lowerhalf_s;
+struct sensor_ops_s {
+	/* Required.  Start or stop sampling. */
+
+	int (*activate)(FAR struct sensor_lowerhalf_s *lower, bool enable);
+
+	/* Optional.  Set the sample interval in microseconds, rounded to one the
+	 * sensor supports and written back.
+	 */
+
+	int (*set_interval)(FAR struct sensor_lowerhalf_s *lower, FAR uint32_t *interval);
+
+	/* Optional.  Set the watermark of the hardware FIFO in samples, clamped
+	 * to the FIFO depth and written back.
+	 */
+
+	int (*set_watermark)(FAR struct sensor_lowerhalf_s *lower, FAR uint32_t *nsamples);
+};
+
+struct sensor_lowerhalf_s {
+	FAR const struct sensor_ops_s *ops;
+	uint8_t nvalues;			/* Number of values per sample, up to CONFIG_SENSOR_NVALUES */
+	uint16_t fifo_depth;		/* Depth of the hardware FIFO in samples, 0 if none */
+	FAR void *upper;			/* Set by sensor_register(), used by sensor_push() */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: sensor_timestamp
+ *
+ * Description:
+ *   Return the current time in microseconds since boot.  A lower half takes
+ *   it in the watermark interrupt and passes it to sensor_push().
+ *
+ ****************************************************************************/
+
+uint64_t sensor_timestamp(void);
+
+/****************************************************************************
+ * Name: sensor_push
+ *
+ * Description:
+ *   Add a batch of samples, read out of the hardware FIFO, to the ring of
+ *   the sensor and wake up the readers once.  The samples are time stamped
+ *   back from the time of the last one at the sample interval.  When the
+ *   ring is full the oldest samples are dropped.  It can be called from an
+ *   interrupt handler.
+ *
+ * Input Parameters:
+ *   lower     - The lower half
+ *   timestamp - Time of the last sample, from sensor_timestamp()
+ *   values    - nsamples * lower->nvalues values, oldest first
+ *   nsamples  - Number of samples
+ *
+ ****************************************************************************/
+
+void sensor_push(FAR struct sensor_lowerhalf_s *lower, uint64_t timestamp, FAR const float *values, int nsamples);
+
+/****************************************************************************
+ * Name: sensor_register
+ *
+ * Description:
+ *   Register the sensor as a character driver.  read() returns whole
+ *   struct sensor_sample_s, oldest first.
+ *
+ * Input Parameters:
+ *   path     - The full path of the driver, e.g. "/dev/sensor/accel0"
+ *   lower    - The lower half
+ *   nsamples - Size of the ring in samples, at least one batch
+ *
+ * Returned Value:
+ *   Zero is returned on success.  Otherwise, a negated errno value is
+ *   returned to indicate the nature of the failure.
+ *
+ ****************************************************************************/
+
+int sensor_register(FAR const char *path, FAR struct sensor_lowerhalf_s *lower, int nsamples);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_SENSOR_UPPERHALF */
+#endif /* __INCLUDE_TINYARA_SENSORS_SENSOR_H */
@@ -128,6 +128,15 @@
 	(dev->ops->rxflowcontrol && dev->ops->rxflowcontrol(dev, n, u))
 #endif
 
+#ifdef CONFIG_SERIAL_DMA
+#define uart_dmasend(dev)        dev->ops->dmasend(dev)
+#define uart_dmareceive(dev)     dev->ops->dmareceive(dev)
+#define uart_txdma(dev)          (dev->ops->dmatxavail != NULL)
+#define uart_rxdma(dev)          (dev->ops->dmarxfree != NULL)
+#define uart_dmatxavail(dev)     dev->ops->dmatxavail(dev)
+#define uart_dmarxfree(dev)      dev->ops->dmarxfree(dev)
+#endif
+
 /************************************************************************************
  * Public Types
  ************************************************************************************/
@@ -145,6 +154,23 @@ struct uart_buffer_s {
 	FAR char *buffer;			/* Pointer to the allocated buffer memory */
 };
 
+#ifdef CONFIG_SERIAL_DMA
+/* This structure describes one DMA transfer of the serial infrastructure.
+ * The part of the circular buffer may wrap around its end, so it is given
+ * as a first segment and an optional next segment from the start of the
+ * buffer.  The lower half sets 'nbytes' to the number of bytes which were
+ * transferred before it reports the completion.
+ */
+
+struct uart_dmaxfer_s {
+	FAR char *buffer;			/* First segment of the transfer */
+	size_t length;				/* Length of the first segment */
+	FAR char *nbuffer;			/* Next segment, NULL if there is none */
+	size_t nlength;				/* Length of the next segment */
+	size_t nbytes;				/* Bytes transferred, set by the lower half */
+};
+#endif
+
 /* This structure defines all of the operations providd by the architecture specific
  * logic.  All fields must be provided with non-NULL function pointers by the
  * caller of uart_register().
@@ -236,6 +262,26 @@ struct uart_ops_s {
 	 */
 
 	CODE bool(*txempty)(FAR struct uart_dev_s *dev);
+
+#ifdef CONFIG_SERIAL_DMA
+	/* The DMA methods are optional and may be NULL on a port without DMA.
+	 *
+	 * dmasend() and dmareceive() start the transfer described by dev->dmatx
+	 * and dev->dmarx.  They are called by uart_xmitchars_dma() and
+	 * uart_recvchars_dma().  When the transfer completes, or the RX line
+	 * becomes idle before the RX transfer is full, the lower half sets
+	 * 'nbytes' and calls uart_xmitchars_done() or uart_recvchars_done().
+	 *
+	 * dmatxavail() tells the lower half that there is new data in the TX
+	 * buffer and dmarxfree() tells it that the reader freed space in the RX
+	 * buffer.  The lower half starts a new transfer if it has none running.
+	 */
+
+	CODE void (*dmasend)(FAR struct uart_dev_s *dev);
+	CODE void (*dmareceive)(FAR struct uart_dev_s *dev);
+	CODE void (*dmatxavail)(FAR struct uart_dev_s *dev);
+	CODE void (*dmarxfree)(FAR struct uart_dev_s *dev);
+#endif
 };
 
 
@@ -290,6 +336,11 @@ struct uart_dev_s {
 	struct uart_buffer_s xmit;	/* Describes transmit buffer */
 	struct uart_buffer_s recv;	/* Describes receive buffer */
 
+#ifdef CONFIG_SERIAL_DMA
+	struct uart_dmaxfer_s dmatx;	/* Running TX DMA transfer */
+	struct uart_dmaxfer_s dmarx;	/* Running RX DMA transfer */
+#endif
+
 	FAR uart_data_callback_t received;
 	FAR uart_data_callback_t sent;
 
@@ -363,6 +414,57 @@ void uart_xmitchars(FAR uart_dev_t *dev);
 
 void uart_recvchars(FAR uart_dev_t *dev);
 
+#ifdef CONFIG_SERIAL_DMA
+/************************************************************************************
+ * Name: uart_xmitchars_dma
+ *
+ * Description:
+ *   Describe the pending data of the xmit buffer in dev->dmatx and start its
+ *   transfer with the dmasend() method.  Nothing is started if the buffer is
+ *   empty.  The lower half calls this when it has no TX transfer running.
+ *
+ ************************************************************************************/
+
+void uart_xmitchars_dma(FAR uart_dev_t *dev);
+
+/************************************************************************************
+ * Name: uart_xmitchars_done
+ *
+ * Description:
+ *   Called by the lower half when the TX DMA transfer completed.  The
+ *   dev->dmatx.nbytes bytes are removed from the xmit buffer and the waiting
+ *   writers are woken up.
+ *
+ ************************************************************************************/
+
+void uart_xmitchars_done(FAR uart_dev_t *dev);
+
+/************************************************************************************
+ * Name: uart_recvchars_dma
+ *
+ * Description:
+ *   Describe the free space of the recv buffer in dev->dmarx and start the
+ *   transfer into it with the dmareceive() method.  Nothing is started if
+ *   the buffer is full.  The lower half calls this when it has no RX
+ *   transfer running.
+ *
+ ************************************************************************************/
+
+void uart_recvchars_dma(FAR uart_dev_t *dev);
+
+/************************************************************************************
+ * Name: uart_recvchars_done
+ *
+ * Description:
+ *   Called by the lower half when the RX DMA transfer completed, or when the
+ *   line became idle and the transfer was stopped early.  The dev->dmarx.nbytes
+ *   bytes are added to the recv buffer and the waiting readers are woken up.
+ *
+ ************************************************************************************/
+
+void uart_recvchars_done(FAR uart_dev_t *dev);
+#endif
+
 
 /************************************************************************************
  * Name: uart_connected
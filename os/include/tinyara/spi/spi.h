@@ -410,6 +410,57 @@ struct spi_io_msg {
 	unsigned int length;
 };
 
+#ifdef CONFIG_SPI_TRANSFER
+/* One segment of a transfer sequence. The device stays selected between the
+ * segments unless deselect is set, so a command and its data can be sent as
+ * two segments without copying them into one buffer.
+ */
+
+struct spi_trans_s {
+	bool deselect;				/* De-select the device after this segment */
+#ifdef CONFIG_SPI_CMDDATA
+	bool cmd;					/* The segment is sent as command (see SPI_CMDDATA) */
+#endif
+	uint16_t delay;				/* Microseconds to wait after this segment */
+	size_t nwords;				/* Number of words to exchange */
+	FAR const void *txbuffer;	/* Words to send, NULL to send dummy words */
+	FAR void *rxbuffer;			/* Buffer of the received words, NULL to drop them */
+};
+
+/* A sequence of segments to one device, with the bus configuration. The bus
+ * is locked once for the whole sequence.
+ */
+
+struct spi_sequence_s {
+	enum spi_dev_e devid;		/* Device to select */
+	enum spi_mode_e mode;		/* SPI mode of the device */
+	int nbits;					/* Number of bits per word, see SPI_SETBITS */
+	uint32_t frequency;			/* SPI frequency of the device */
+	int ntrans;					/* Number of segments */
+	FAR struct spi_trans_s *trans;	/* Array of ntrans segments */
+};
+
+#ifdef CONFIG_SPI_ASYNC
+/* The function called when a queued sequence is finished. result is OK or a
+ * negated errno value. It runs on the work queue thread.
+ */
+
+typedef void (*spi_complete_t)(FAR void *arg, int result);
+
+/* A request of spi_transfer_async(). It belongs to the caller and must not
+ * be changed or freed until the callback is called.
+ */
+
+struct spi_request_s {
+	FAR struct spi_request_s *flink;	/* Used by the request queue */
+	FAR struct spi_dev_s *dev;	/* The SPI bus */
+	FAR struct spi_sequence_s *seq;	/* The sequence to transfer */
+	spi_complete_t callback;	/* Called when the sequence is finished */
+	FAR void *arg;				/* Argument of the callback */
+};
+#endif
+#endif
+
 /* The SPI vtable */
 
 struct spi_dev_s;
@@ -433,6 +484,13 @@ struct spi_ops_s {
 	void (*recvblock)(FAR struct spi_dev_s *dev, FAR void *buffer, size_t nwords);
 #endif
 	int (*registercallback)(FAR struct spi_dev_s *dev, spi_mediachange_t callback, void *arg);
+#ifdef CONFIG_SPI_TRANSFER
+	/* Optional. Transfer the whole sequence, e.g. as one chain of DMA
+	 * descriptors. The bus is locked and configured by the caller.
+	 */
+
+	int (*transfer)(FAR struct spi_dev_s *dev, FAR struct spi_sequence_s *seq);
+#endif
 };
 
 /* SPI private data.  This structure only defines the initial fields of the
@@ -497,6 +555,48 @@ FAR struct spi_dev_s *up_spiinitialize(int port);
 
 FAR int spi_uioregister(FAR int bus, FAR struct spi_dev_s *dev);
 
+#ifdef CONFIG_SPI_TRANSFER
+/****************************************************************************
+ * Name: spi_transfer
+ *
+ * Description:
+ *   Lock the bus, configure it for the device and exchange all segments of
+ *   the sequence, selecting and de-selecting the device as requested. The
+ *   device is always de-selected after the last segment.
+ *
+ * Input Parameters:
+ *   dev - Device-specific state data
+ *   seq - The sequence to transfer
+ *
+ * Returned Value:
+ *   OK on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int spi_transfer(FAR struct spi_dev_s *dev, FAR struct spi_sequence_s *seq);
+
+#ifdef CONFIG_SPI_ASYNC
+/****************************************************************************
+ * Name: spi_transfer_async
+ *
+ * Description:
+ *   Queue the sequence of the request and return at once. The sequences are
+ *   transferred in the order they were queued, on the low priority work
+ *   queue, and req->callback is called after each of them. The caller can
+ *   prepare the next data while the bus is busy.
+ *
+ * Input Parameters:
+ *   req - The request. It must stay valid until its callback is called.
+ *
+ * Returned Value:
+ *   OK if the request is queued; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int spi_transfer_async(FAR struct spi_request_s *req);
+#endif
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
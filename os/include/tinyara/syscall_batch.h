@@ -0,0 +1,107 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * include/tinyara/syscall_batch.h
+ *
+ * Batched system calls of CONFIG_LIB_SYSCALL_BATCH: an array of system
+ * calls run by the kernel in one trap, each through the stub its own trap
+ * would have called.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_SYSCALL_BATCH_H
+#define __INCLUDE_TINYARA_SYSCALL_BATCH_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+
+#ifdef CONFIG_LIB_SYSCALL_BATCH
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define SYSCALL_BATCH_MAXPARMS	6
+
+/* Flags of syscall_batch() */
+
+#define SYSCALL_BATCH_STOP		(1 << 0)	/* Stop at the first call which fails */
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* One system call of a batch.  nbr is a SYS_ number of sys/syscall.h and
+ * parm[] holds the arguments as a system call proxy would pass them.  The
+ * kernel sets result to the return value of the call, and errcode to the
+ * errno it left when it returned ERROR, or to 0.
+ */
+
+struct syscall_op_s {
+	unsigned int nbr;
+	uintptr_t parm[SYSCALL_BATCH_MAXPARMS];
+	uintptr_t result;
+	int errcode;
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: syscall_batch
+ *
+ * Description:
+ *   Run the system calls of ops in order, in one trap into the kernel.  A
+ *   call which blocks blocks the batch.  The calls which would leave the
+ *   calling context, as exit() or a nested syscall_batch(), are refused
+ *   with ENOSYS.
+ *
+ * Input Parameters:
+ *   ops   - The system calls, which receive their results
+ *   nops  - The number of system calls
+ *   flags - SYSCALL_BATCH_STOP or 0
+ *
+ * Returned Value:
+ *   The number of system calls run, which is nops unless
+ *   SYSCALL_BATCH_STOP stopped the batch after a failure.  ERROR with
+ *   errno EINVAL if ops is NULL.
+ *
+ ****************************************************************************/
+
+int syscall_batch(FAR struct syscall_op_s *ops, unsigned int nops, int flags);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_LIB_SYSCALL_BATCH */
+#endif /* __INCLUDE_TINYARA_SYSCALL_BATCH_H */
@@ -23,11 +23,39 @@
  * Included Files
  ****************************************************************************/
 
+#include <tinyara/config.h>
+#include <sys/types.h>
+#include <stdbool.h>
+
 #ifdef CONFIG_TASK_MONITOR
 
 int task_monitor_register(int interval);
 void task_monitor_update_status(void);
 
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+/* Events of the task monitor, broadcast by the task manager with a
+ * struct task_monitor_event_s as data.
+ */
+
+#define TASK_MONITOR_EVENT_DEADLINE_MISS 1	/* A monitored task missed its update */
+#define TASK_MONITOR_EVENT_OVERRUN       2	/* A task ran over its CPU budget */
+#define TASK_MONITOR_EVENT_OVERLOAD      3	/* The CPUs are busy over the limit */
+
+struct task_monitor_event_s {
+	int type;					/* TASK_MONITOR_EVENT_* */
+	pid_t pid;					/* The task, or -1 for an overload */
+	int load;					/* CPU time of the task in percent of a CPU, or of all
+							 * the CPUs busy for an overload */
+	bool throttled;				/* The priority of the task was lowered */
+};
+
+/* Give the calling task a budget of 'percent' of the time of a CPU over
+ * each CONFIG_TASK_MONITOR_BUDGET_WINDOW, 0 to remove it.
+ */
+
+int task_monitor_set_budget(int percent);
+#endif
+
 #ifdef __cplusplus
 #define EXTERN extern "C"
 extern "C" {
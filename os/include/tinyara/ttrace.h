@@ -56,6 +56,7 @@
 #define TTRACE_BUFFER              'b'
 #define TTRACE_DUMP                'd'
 #define TTRACE_PRINT               'p'
+#define TTRACE_EVENTS              'e'
 
 #define TTRACE_CODE_VARIABLE        0
 #define TTRACE_CODE_UNIQUE         (1 << 7)
@@ -75,6 +76,19 @@
 #define TTRACE_TAG_LOCK            (1 << 2)
 #define TTRACE_TAG_TASK            (1 << 3)
 #define TTRACE_TAG_IPC             (1 << 4)
+#define TTRACE_TAG_MEDIA           (1 << 5)
+#define TTRACE_TAG_IRQ             (1 << 6)
+
+/* Types of the events of the fast path, top 4 bits of their id field */
+#define TTRACE_EVENT_BEGIN          1  /* id, arg given by the caller */
+#define TTRACE_EVENT_END            2
+#define TTRACE_EVENT_INSTANT        3
+#define TTRACE_EVENT_SWITCH         4  /* pid: previous, arg: next pid */
+#define TTRACE_EVENT_IRQ_ENTER      5  /* id: irq */
+#define TTRACE_EVENT_IRQ_LEAVE      6
+
+#define TTRACE_EVENT_TYPE(idtype)  ((idtype) >> 12)
+#define TTRACE_EVENT_ID(idtype)    ((idtype) & 0x0fff)
 
 /****************************************************************************
  * Public Variables
@@ -90,6 +104,29 @@ struct sched_message {          // total 32B
 	char next_comm[TTRACE_COMM_BYTES];  // 12B
 };
 
+/* Event of the fast path, kept in the ring of the CPU it happened on.  The
+ * time is given as counts of up_perf_gettime() since the previous event of
+ * the ring.
+ */
+struct ttrace_event_s {      // total 12B
+	uint32_t delta;            // 4B
+	uint16_t idtype;           // 2B, type(4b) + id(12b)
+	int16_t pid;               // 2B
+	uint32_t arg;              // 4B
+};
+
+/* This is the type of the argument of the TTRACE_EVENTS ioctl, which copies
+ * the events of one CPU, oldest first.
+ */
+struct ttrace_events_s {
+	int cpu;                           // IN
+	FAR struct ttrace_event_s *events; // IN: Room for count events
+	int count;                         // IN/OUT: Events copied
+	uint32_t start;                    // OUT: Time of the first event
+	uint32_t freq;                     // OUT: Counts per second, 0 if unknown
+	uint32_t dropped;                  // OUT: Events lost, ring full
+};
+
 union trace_message {              // total 32B
 	char message[TTRACE_MSG_BYTES];  // 32B, message(256b)
 	struct sched_message sched_msg;  // 32B
@@ -162,12 +199,44 @@ int trace_end_uid(int tag);
  * @since TizenRT v1.1
  */
 int trace_sched(struct tcb_s *prev, struct tcb_s *next);
+
+#ifdef CONFIG_TTRACE_FAST
+/**
+ * @ingroup TTRACE_LIBC
+ * @brief records a compact event in the ring of the current CPU, without a system call
+ * @details @b #include <tinyara/ttrace.h>
+ * @param[in] tag number for tag
+ * @param[in] type TTRACE_EVENT_BEGIN, TTRACE_EVENT_END or TTRACE_EVENT_INSTANT
+ * @param[in] id id of the event, up to 0xfff
+ * @param[in] arg value recorded with the event
+ * @return On success, TTRACE_VALID is returned. On failure, TTRACE_INVALID is returned.
+ * @since TizenRT v4.1
+ */
+int trace_event(int tag, int type, uint16_t id, uint32_t arg);
+
+/* Kernel side of the fast path, called by the ttrace driver, the context
+ * switch and the interrupt dispatch.
+ */
+void ttrace_fast_init(void);
+void ttrace_fast_start(int tags, bool overwritable);
+void ttrace_fast_stop(void);
+int ttrace_fast_read(FAR struct ttrace_events_s *events);
+void ttrace_fast_switch(FAR struct tcb_s *next);
+void ttrace_fast_irq(int irq, bool enter);
+#else
+#define trace_event(tag, type, id, arg)
+#define ttrace_fast_switch(next)
+#define ttrace_fast_irq(irq, enter)
+#endif
 #else
 #define trace_begin(a, b, ...)
 #define trace_begin_uid(a, b)
 #define trace_end(a)
 #define trace_end_uid(a)
 #define trace_sched(a, b)
+#define trace_event(tag, type, id, arg)
+#define ttrace_fast_switch(next)
+#define ttrace_fast_irq(irq, enter)
 
 #if defined(__cplusplus)
 }
@@ -65,6 +65,7 @@
 #ifdef CONFIG_LIBCXX_EXCEPTION
 #include <unwind.h>
 #endif
+#include <tinyara/vdso.h>
 
 #ifdef CONFIG_BUILD_PROTECTED
 
@@ -109,6 +110,12 @@ struct userspace_s {
 	void * flash_end;
 	void * ram_start;
 	void * ram_end;
+#ifdef CONFIG_XIP_ELF_RAMTEXT
+	/* hot functions, linked to run from ram and copied there like data */
+	void * ramtext_start_in_ram;
+	void * ramtext_end_in_ram;
+	void * ramtext_start_in_flash;
+#endif
 	main_t entry;
 #ifdef CONFIG_LIBCXX_EXCEPTION
 	void * exidx_start;
@@ -116,6 +123,12 @@ struct userspace_s {
 	int (*register_exidx)(_Unwind_Ptr start, _Unwind_Ptr end, void * text_start, void * text_end, int bin_idx);
 #endif
 #endif
+
+#ifdef CONFIG_LIB_SYSCALL_VDSO
+	/* Page read by the library instead of the time and PID system calls */
+
+	FAR struct vdso_data_s *vdso;
+#endif
 };
 
 /****************************************************************************
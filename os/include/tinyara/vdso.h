@@ -0,0 +1,83 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * include/tinyara/vdso.h
+ *
+ * The page which CONFIG_LIB_SYSCALL_VDSO shares between the kernel and the
+ * user library of a binary.  The kernel writes it when a thread of the
+ * binary is switched in and at each tick while it runs; getpid(), clock()
+ * and clock_gettime() of the library read it instead of trapping.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_VDSO_H
+#define __INCLUDE_TINYARA_VDSO_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef CONFIG_LIB_SYSCALL_VDSO
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* The kernel changes seq at each update.  A reader which finds the same seq
+ * before and after reading the other fields got them from one update; as
+ * the kernel runs the update with interrupts disabled on a single CPU, it
+ * never sees a half written page.
+ */
+
+struct vdso_data_s {
+	uint32_t seq;
+	pid_t pid;					/* PID of the running thread */
+	clock_t systimer;			/* clock_systimer() */
+	struct timespec basetime;	/* Wall clock at systimer 0 */
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+#ifndef __KERNEL__
+/* The page of the binary, which its userspace header points to */
+
+EXTERN struct vdso_data_s g_vdso;
+#endif
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif							/* CONFIG_LIB_SYSCALL_VDSO */
+#endif							/* __INCLUDE_TINYARA_VDSO_H */
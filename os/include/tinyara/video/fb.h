@@ -303,6 +303,12 @@
 #endif
 #endif /* CONFIG_FB_OVERLAY */
 
+#ifdef CONFIG_FB_FRAMESTATS
+#define FBIOGET_FRAMESTATS  _FBIOC(0x0012)  /* Get frame timing statistics
+											* Argument: writable struct
+											*           fb_framestats_s */
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -360,6 +366,21 @@ struct fb_planeinfo_s {
 	uint8_t    bpp;         /* Bits per pixel */
 };
 
+#ifdef CONFIG_FB_FRAMESTATS
+/* This structure describes how the updates of the display keep up.  A frame
+ * time runs from the update request to the end of its transfer, so it
+ * includes the wait for the vertical sync.
+ */
+
+struct fb_framestats_s {
+	uint32_t   frames;      /* Updates transferred to the display */
+	uint32_t   dropped;     /* Updates which waited for the previous one */
+	uint32_t   last_us;     /* Time of the last frame in microseconds */
+	uint32_t   avg_us;      /* Average frame time in microseconds */
+	uint32_t   max_us;      /* Longest frame time in microseconds */
+};
+#endif
+
 #ifdef CONFIG_FB_OVERLAY
 /* This structure describes the transparency. */
 
@@ -540,6 +561,13 @@ struct fb_vtable_s {
 	int (*waitforvsync)(FAR struct fb_vtable_s *vtable);
 #endif
 
+#ifdef CONFIG_FB_FRAMESTATS
+	/* The following is provided only if the driver times its updates */
+
+	int (*getframestats)(FAR struct fb_vtable_s *vtable,
+						 FAR struct fb_framestats_s *stats);
+#endif
+
 #ifdef CONFIG_FB_OVERLAY
 	/* Get information about the video controller configuration and the
 	 * configuration of each overlay.
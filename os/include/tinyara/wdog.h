@@ -88,29 +88,25 @@
 /* Flag bits for the flags field of struct wdog_s */
 
 #define WDOGF_ACTIVE       (1 << 0)	/* Bit 0: 1=Watchdog is actively timing */
-#define WDOGF_ALLOCED      (1 << 1)	/* Bit 1: 0=Pre-allocated, 1=Allocated */
-#define WDOGF_STATIC       (1 << 2)	/* Bit 2: 0=[Pre-]allocated, 1=Static */
+#define WDOGF_STATIC       (1 << 2)	/* Bit 2: 0=From the pool, 1=Static */
 #define WDOGF_WAKEUP       (1 << 3)	/* Bit 3: 1=Watchdog is registered as a power management wakeup source */
 
 #define WDOG_SETACTIVE(w)  do { (w)->flags |= WDOGF_ACTIVE; } while (0)
-#define WDOG_SETALLOCED(w) do { (w)->flags |= WDOGF_ALLOCED; } while (0)
 #define WDOG_SETSTATIC(w)  do { (w)->flags |= WDOGF_STATIC; } while (0)
 #define WDOG_SETWAKEUP(w)  do { (w)->flags |= WDOGF_WAKEUP; } while (0)
 
 #define WDOG_CLRACTIVE(w)  do { (w)->flags &= ~WDOGF_ACTIVE; } while (0)
-#define WDOG_CLRALLOCED(w) do { (w)->flags &= ~WDOGF_ALLOCED; } while (0)
 #define WDOG_CLRSTATIC(w)  do { (w)->flags &= ~WDOGF_STATIC; } while (0)
 #define WDOG_CLRWAKEUP(w)  do { (w)->flags &= ~WDOGF_WAKEUP; } while (0)
 
 #define WDOG_ISACTIVE(w)   (((w)->flags & WDOGF_ACTIVE) != 0)
-#define WDOG_ISALLOCED(w)  (((w)->flags & WDOGF_ALLOCED) != 0)
 #define WDOG_ISSTATIC(w)   (((w)->flags & WDOGF_STATIC) != 0)
 #define WDOG_ISWAKEUP(w)   (((w)->flags & WDOGF_WAKEUP) != 0)
 
 /* Initialization of statically allocated timers ****************************/
 
 #define wd_static(w) \
-	do { (w)->next = NULL; (w)->flags = WDOGF_STATIC; } while (0)
+	do { (w)->next = NULL; (w)->flags = WDOGF_STATIC; (w)->slack = 0; } while (0)
 
 #ifdef CONFIG_PIC
 #define WDOG_INITIAILIZER { NULL, NULL, NULL, 0, WDOGF_STATIC, 0 }
@@ -156,10 +152,15 @@ struct wdog_s {
 #ifdef CONFIG_DEBUG
 	int pid;					/* The pid of process which creates wdog timer */
 #endif
-	int lag;					/* Timer associated with the delay */
+	int lag;					/* Timer associated with the delay (expiration tick of the timer wheel) */
 	uint8_t flags;				/* See WDOGF_* definitions above */
 	uint8_t argc;				/* The number of parameters to pass */
+	uint16_t slack;				/* Ticks the expiration may be deferred by, see wd_setslack() */
 	uint32_t parm[CONFIG_MAX_WDOGPARMS];
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+	FAR struct wdog_s *prev;	/* Previous watchdog in the slot of the timer wheel */
+	uint8_t slot;				/* Slot of the timer wheel holding the watchdog */
+#endif
 };
 
 /* Watchdog 'handle' */
@@ -186,6 +187,7 @@ int wd_delete(WDOG_ID wdog);
 int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...);
 int wd_cancel(WDOG_ID wdog);
 int wd_gettime(WDOG_ID wdog);
+int wd_setslack(WDOG_ID wdog, int slack);
 #ifdef CONFIG_SCHED_WAKEUPSOURCE
 int wd_setwakeupsource(WDOG_ID wdog);
 clock_t wd_getwakeupdelay(void);
@@ -85,6 +85,8 @@
  *   priority worker thread.  Default: 201
  * CONFIG_SCHED_HPWORKSTACKSIZE - The stack size allocated for the worker
  *   thread.  Default: 2048.
+ * CONFIG_SCHED_HPNTHREADS - The number of thread in the high-priority
+ *   queue's thread pool.  Default: 1
  * CONFIG_SIG_SIGWORK - The signal number that will be used to wake-up
  *   the worker thread.  Default: 17
  *
@@ -99,6 +101,10 @@
  * CONFIG_SCHED_LPWORKPRIOMAX - The maximum execution priority of the lower
  *   priority worker thread.  Default: 176
  *
+ * CONFIG_SCHED_WORKAFFINITY - On SMP, bind worker n of each kernel thread
+ *   pool to CPU n % CONFIG_SMP_NCPUS, and wake up the idle worker of the
+ *   CPU which queues the work first.
+ *
  * The user-mode work queue is only available in the protected or kernel
  * builds.  This those configurations, the user-mode work queue provides the
  * same (non-standard) facility for use by applications.
@@ -162,6 +168,10 @@
 #define CONFIG_SCHED_HPWORKSTACKSIZE CONFIG_IDLETHREAD_STACKSIZE
 #endif
 
+#ifndef CONFIG_SCHED_HPNTHREADS
+#define CONFIG_SCHED_HPNTHREADS 1
+#endif
+
 #endif							/* CONFIG_SCHED_HPWORK */
 
 /* Low priority kernel work queue configuration *****************************/
@@ -289,6 +299,14 @@ struct work_s {
 	clock_t delay;			/* Delay until work performed */
 };
 
+/* Describes one work of a batch queued by work_queue_many() */
+
+struct work_item_s {
+	FAR struct work_s *work;	/* The work structure to queue */
+	worker_t worker;			/* Work callback */
+	FAR void *arg;				/* Callback argument */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -392,6 +410,30 @@ int work_lpstart(void);
 
 int work_queue(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay);
 
+/****************************************************************************
+ * Name: work_queue_many
+ *
+ * Description:
+ *   Queue several work at once.  The queue is locked once and a worker is
+ *   woken up once for the whole batch, instead of once per work with
+ *   work_queue().  This suits drivers which post many small work together,
+ *   such as a burst of events.  The rules of work_queue() apply to each
+ *   work structure; the ones still in the queue are skipped.
+ *
+ * Input parameters:
+ *   qid    - The work queue ID
+ *   items  - The work structures to queue with their worker and argument
+ *   nitems - The number of entries in items
+ *   delay  - Delay (in clock ticks) from the time queue until the workers
+ *            are invoked. Zero means to perform the work immediately.
+ *
+ * Returned Value:
+ *   The number of work queued on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+int work_queue_many(int qid, FAR const struct work_item_s *items, int nitems, clock_t delay);
+
 /****************************************************************************
  * Name: work_cancel
  *
@@ -275,6 +275,44 @@ extern "C" {
 
 #define VIDIOC_CANCEL_DQBUF           _VIDIOC(0x0016)
 
+/**
+ * Query the offset and length of a buffer of the driver (V4L2_MEMORY_MMAP),
+ * to give to mmap()
+ *
+ * @param[in/out] arg
+ * Address pointing to struct #v4l2_buffer, with type and index set
+ */
+
+#define VIDIOC_QUERYBUF               _VIDIOC(0x0017)
+
+/**
+ * Set the crop, scale and format conversion of the frames of buffers of the
+ * driver (V4L2_MEMORY_MMAP). Set before VIDIOC_REQBUFS.
+ *
+ * @param[in] arg
+ * Address pointing to struct #v4l2_process
+ */
+
+#define VIDIOC_S_PROCESS              _VIDIOC(0x0018)
+
+/**
+ * Dequeue a filled buffer of the driver as a frame handle
+ *
+ * @param[in/out] arg
+ * Address pointing to struct #v4l2_frame, with type set
+ */
+
+#define VIDIOC_DQFRAME                _VIDIOC(0x0019)
+
+/**
+ * Get the frame counters of a stream
+ *
+ * @param[in/out] arg
+ * Address pointing to struct #v4l2_stream_stats, with type set
+ */
+
+#define VIDIOC_G_STREAM_STATS         _VIDIOC(0x001A)
+
 /** @} video_ioctl */
 
 /**
@@ -311,6 +349,14 @@ extern "C" {
 
 #define V4L2_PIX_FMT_RGB565 v4l2_fourcc('R', 'G', 'B', 'P')
 
+/** RGB888, 3 bytes in R, G, B order */
+
+#define V4L2_PIX_FMT_RGB24 v4l2_fourcc('R', 'G', 'B', '3')
+
+/** 8 bit luma */
+
+#define V4L2_PIX_FMT_GREY v4l2_fourcc('G', 'R', 'E', 'Y')
+
 /** JFIF JPEG */
 
 #define V4L2_PIX_FMT_JPEG v4l2_fourcc('J', 'P', 'E', 'G')
@@ -376,7 +422,9 @@ enum v4l2_buf_type {
 	V4L2_BUF_TYPE_STILL_CAPTURE = 0x81	   /**< single-planar still capture stream */
 };
 
-/** Memory I/O method. Currently, support only V4L2_MEMORY_USERPTR. */
+/** Memory I/O method. Currently, support only V4L2_MEMORY_USERPTR, and
+ *  V4L2_MEMORY_MMAP for V4L2_BUF_TYPE_VIDEO_CAPTURE.
+ */
 
 enum v4l2_memory {
 	V4L2_MEMORY_MMAP = 1,	 /**< memory mapping I/O */
@@ -763,6 +811,68 @@ struct v4l2_ext_controls {
 	struct v4l2_ext_control *controls; /**< each control information    */
 };
 
+/** @struct v4l2_rect
+ *  @brief  rectangle of an image
+ */
+
+struct v4l2_rect {
+	int32_t left;
+	int32_t top;
+	uint32_t width;
+	uint32_t height;
+};
+
+/** @struct v4l2_process
+ *  @brief  parameter of ioctl(VIDIOC_S_PROCESS). \n
+ *          The crop of each frame is scaled to width x height and converted
+ *          to pixelformat, by the device if it can, else by the driver when
+ *          the frame is dequeued. The frames of UYVY, YUY2 and RGB565 formats
+ *          convert to RGB24, RGB565 and GREY. pixelformat 0 disables it.
+ */
+
+struct v4l2_process {
+	uint32_t type;          /**< enum #v4l2_buf_type */
+	struct v4l2_rect crop;  /**< Rectangle of the frame, all 0 for the whole frame */
+	uint16_t width;         /**< Width of the processed image */
+	uint16_t height;        /**< Height of the processed image */
+	uint32_t pixelformat;   /**< Format of the processed image */
+};
+
+/** @struct v4l2_frame
+ *  @brief  parameter of ioctl(VIDIOC_DQFRAME). \n
+ *          A frame in a buffer of the driver, processed if VIDIOC_S_PROCESS
+ *          is set. The image is not copied, it can be given as it is to the
+ *          consumers, such as an image asset of araui or an AIProcessHandler
+ *          of aifw, and stays valid until the buffer is queued again with
+ *          VIDIOC_QBUF and index.
+ */
+
+struct v4l2_frame {
+	uint16_t type;          /**< enum #v4l2_buf_type */
+	uint16_t index;         /**< Buffer of the frame */
+	uint16_t sequence;      /**< Sequence number of the frame in the stream */
+	uint16_t width;         /**< Width of the image */
+	uint16_t height;        /**< Height of the image */
+	uint32_t pixelformat;   /**< Format of the image */
+	uint32_t bytesused;     /**< Size of the image */
+	void *data;             /**< First byte of the image */
+};
+
+/** @struct v4l2_stream_stats
+ *  @brief  parameter of ioctl(VIDIOC_G_STREAM_STATS). \n
+ *          Counted from VIDIOC_REQBUFS.
+ */
+
+struct v4l2_stream_stats {
+	uint32_t type;           /**< enum #v4l2_buf_type */
+	uint32_t frames;         /**< Frames captured */
+	uint32_t dequeued;       /**< Frames dequeued */
+	uint32_t dropped;        /**< Frames overwritten in ring mode before they were dequeued */
+	uint32_t starved;        /**< Times capture stopped as no buffer was queued */
+	uint32_t latency_avg_us; /**< Average time from the end of capture to the dequeue */
+	uint32_t latency_max_us; /**< Longest time from the end of capture to the dequeue */
+};
+
 /** @} video_datatypes */
 
 /****************************************************************************
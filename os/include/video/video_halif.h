@@ -80,6 +80,12 @@ struct video_devops_s {
 	CODE int (*get_ctrlvalue)(FAR void *video_priv, uint16_t ctrl_class, FAR struct v4l2_ext_control *control);
 	CODE int (*set_ctrlvalue)(FAR void *video_priv, uint16_t ctrl_class, FAR struct v4l2_ext_control *control);
 	CODE int (*refresh)(FAR void *video_priv);
+
+	/* Optional. Crop, scale and convert the frames on the device, so they are
+	 * captured processed. Returns -ENOSYS to leave it to the driver.
+	 */
+
+	CODE int (*set_process)(FAR void *video_priv, FAR struct v4l2_process *process);
 };
 
 /** @struct video lower half
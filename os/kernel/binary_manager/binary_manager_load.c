@@ -41,6 +41,8 @@
 #include <tinyara/sched.h>
 #include <tinyara/init.h>
 #include <tinyara/kthread.h>
+#include <tinyara/clock.h>
+#include <tinyara/bootprof.h>
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
 #include <tinyara/binfmt/binfmt.h>
 #endif
@@ -50,6 +52,9 @@
 #ifdef CONFIG_BINARY_SIGNING
 #include <tinyara/signature.h>
 #endif
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+#include <crc32.h>
+#endif
 
 #include "sched/sched.h"
 #include "task/task.h"
@@ -69,6 +74,41 @@ extern struct binary_s *g_lib_binp;
 #define BINARY_COMP_TYPE "[Un-compressed Binary]"
 #endif
 
+/* With CONFIG_ELF_CRC_ON_LOAD, the loader checks the CRC with the data it reads
+ * instead of reading the whole binary for the header check.
+ */
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+#define BINMGR_LOAD_CRC_CHECK false
+#else
+#define BINMGR_LOAD_CRC_CHECK true
+#endif
+
+#ifdef CONFIG_BINMGR_PARALLEL_LOADING
+/* Times of a binary loaded by loadingall_thread, in ticks since its start */
+struct binmgr_loadtime_s {
+	clock_t verified;		/* Signature, header and CRC checked */
+	clock_t locked;			/* Common library loaded and load lock taken */
+	clock_t loaded;			/* Loaded and started */
+	int result;
+};
+
+/* Loaders of all binaries run at once: signatures, headers and CRCs are
+ * checked concurrently, then load_binary() is called by one loader at a
+ * time because the ELF cache and the decompression state are shared.
+ * Waiting loaders take the lock by their priority.
+ */
+static bool g_binmgr_parallel;
+static clock_t g_binmgr_load_start;
+static int g_binmgr_nloaders;
+static struct binmgr_loadtime_s g_binmgr_loadtime[USER_BIN_COUNT + 1];
+static sem_t g_binmgr_load_sem = SEM_INITIALIZER(1);
+static sem_t g_binmgr_count_sem = SEM_INITIALIZER(1);
+#ifdef CONFIG_SUPPORT_COMMON_BINARY
+static sem_t g_binmgr_cmnlib_sem = SEM_INITIALIZER(0);
+static int g_binmgr_cmnlib_result;
+#endif
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -104,6 +144,85 @@ static uint8_t binary_manager_get_loader_priority(uint8_t load_priority)
 	return loader_priority;
 }
 
+#ifdef CONFIG_BINMGR_PARALLEL_LOADING
+static void binary_manager_sem_wait(sem_t *sem)
+{
+	while (sem_wait(sem) < 0) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+/****************************************************************************
+ * Name: binary_manager_load_lock
+ *
+ * Description:
+ *   With loaders running in parallel, this function waits for the common
+ *   library and for other loaders to finish load_binary().
+ *
+ ****************************************************************************/
+static int binary_manager_load_lock(int bin_idx)
+{
+	if (!g_binmgr_parallel) {
+		return OK;
+	}
+
+	g_binmgr_loadtime[bin_idx].verified = clock_systimer() - g_binmgr_load_start;
+
+#ifdef CONFIG_SUPPORT_COMMON_BINARY
+	if (bin_idx != BM_CMNLIB_IDX) {
+		/* Pass on the post of the common library to next user binary */
+		binary_manager_sem_wait(&g_binmgr_cmnlib_sem);
+		sem_post(&g_binmgr_cmnlib_sem);
+		if (g_binmgr_cmnlib_result != BINMGR_OK) {
+			bmdbg("Common library not loaded, skip %s\n", BIN_NAME(bin_idx));
+			return ERROR;
+		}
+	}
+#endif
+	binary_manager_sem_wait(&g_binmgr_load_sem);
+	g_binmgr_loadtime[bin_idx].locked = clock_systimer() - g_binmgr_load_start;
+
+	return OK;
+}
+
+static void binary_manager_load_unlock(int bin_idx)
+{
+	if (g_binmgr_parallel) {
+		g_binmgr_loadtime[bin_idx].loaded = clock_systimer() - g_binmgr_load_start;
+		sem_post(&g_binmgr_load_sem);
+	}
+}
+
+/****************************************************************************
+ * Name: binary_manager_load_report
+ *
+ * Description:
+ *   This function prints the time each binary took to be checked, to wait
+ *   and to be loaded, once all loaders have finished.
+ *
+ ****************************************************************************/
+static void binary_manager_load_report(void)
+{
+	int bin_idx;
+
+	bmdbg("Parallel loading : %u ms in total\n", TICK2MSEC(clock_systimer() - g_binmgr_load_start));
+	for (bin_idx = 0; bin_idx <= binary_manager_get_ucount(); bin_idx++) {
+#ifndef CONFIG_SUPPORT_COMMON_BINARY
+		if (bin_idx == BM_CMNLIB_IDX) {
+			continue;
+		}
+#endif
+		bmdbg("[%s] %s, verify %u ms, wait %u ms, load %u ms, ready at %u ms\n", BIN_NAME(bin_idx), g_binmgr_loadtime[bin_idx].result == BINMGR_OK ? "OK" : "FAIL",
+			TICK2MSEC(g_binmgr_loadtime[bin_idx].verified), TICK2MSEC(g_binmgr_loadtime[bin_idx].locked - g_binmgr_loadtime[bin_idx].verified),
+			TICK2MSEC(g_binmgr_loadtime[bin_idx].loaded - g_binmgr_loadtime[bin_idx].locked), TICK2MSEC(g_binmgr_loadtime[bin_idx].loaded));
+	}
+}
+
+#else
+#define binary_manager_load_lock(bin_idx)	(OK)
+#define binary_manager_load_unlock(bin_idx)
+#endif
+
 /****************************************************************************
  * Name: binary_manager_load_binary
  *
@@ -125,6 +244,7 @@ static int binary_manager_load_binary(int bin_idx, char *path, load_attr_t *load
 			strncpy(BIN_NAME(bin_idx), load_attr->bin_name, BIN_NAME_MAX);
 			bmdbg("Load success! [Name: %s] [Version: %d] [Partition: %s] [Text start : 0x%08x] %s\n", BIN_NAME(bin_idx), 
 					BIN_LOADVER(bin_idx), GET_PARTNAME(BIN_USEIDX(bin_idx)), elf_find_text_section_addr(bin_idx), BINARY_COMP_TYPE);
+			bootprof_mark("load %s", BIN_NAME(bin_idx));
 			return OK;
 		} else if (errno == ENOMEM) {
 			/* Sleep for a moment to get available memory */
@@ -221,12 +341,12 @@ static int binary_manager_load(int bin_idx)
 			snprintf(devpath, BINARY_PATH_LEN, BINMGR_DEVNAME_FMT, BIN_PARTNUM(bin_idx, (BIN_USEIDX(bin_idx))));
 #ifdef CONFIG_SUPPORT_COMMON_BINARY
 			if (bin_idx == BM_CMNLIB_IDX) {
-				ret = binary_manager_read_header(BINARY_COMMON, devpath, &common_header_data, true);
+				ret = binary_manager_read_header(BINARY_COMMON, devpath, &common_header_data, BINMGR_LOAD_CRC_CHECK);
 				BIN_VER(bin_idx, BIN_USEIDX(bin_idx)) = common_header_data.version;
 			} else
 #endif
 			{
-				ret = binary_manager_read_header(BINARY_USERAPP, devpath, &user_header_data, true);
+				ret = binary_manager_read_header(BINARY_USERAPP, devpath, &user_header_data, BINMGR_LOAD_CRC_CHECK);
 				BIN_VER(bin_idx, BIN_USEIDX(bin_idx)) = user_header_data.bin_ver;
 			}
 			if (ret == BINMGR_OK) {
@@ -253,6 +373,10 @@ static int binary_manager_load(int bin_idx)
 				load_attr.offset = CHECKSUM_SIZE + common_header_data.header_size;
 				load_attr.bin_size = common_header_data.bin_size;
 				load_attr.bin_ver = common_header_data.version;
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+				load_attr.crc_header = crc32part((uint8_t *)&common_header_data + CHECKSUM_SIZE, sizeof(common_header_data) - CHECKSUM_SIZE, 0);
+				load_attr.crc_hash = common_header_data.crc_hash;
+#endif
 #ifdef CONFIG_BINARY_SIGNING
 				load_attr.offset += USER_SIGN_PREPEND_SIZE;
 #endif
@@ -271,6 +395,10 @@ static int binary_manager_load(int bin_idx)
 				load_attr.offset += USER_SIGN_PREPEND_SIZE;
 #endif
 				load_attr.bin_ver = user_header_data.bin_ver;
+#ifdef CONFIG_ELF_CRC_ON_LOAD
+				load_attr.crc_header = crc32part((uint8_t *)&user_header_data + CHECKSUM_SIZE, sizeof(user_header_data) - CHECKSUM_SIZE, 0);
+				load_attr.crc_hash = user_header_data.crc_hash;
+#endif
 			}
 		}
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
@@ -280,7 +408,11 @@ static int binary_manager_load(int bin_idx)
 		load_attr.binp = binp;
 #endif
 
-		ret = binary_manager_load_binary(bin_idx, devpath, &load_attr);
+		ret = binary_manager_load_lock(bin_idx);
+		if (ret == OK) {
+			ret = binary_manager_load_binary(bin_idx, devpath, &load_attr);
+			binary_manager_load_unlock(bin_idx);
+		}
 		if (ret == OK) {
 #ifdef CONFIG_USE_BP
 			if (need_update_bp) {
@@ -467,6 +599,113 @@ static int loading_thread(int argc, char *argv[])
 	return binary_manager_load((int)atoi(argv[1]));
 }
 
+#ifdef CONFIG_BINMGR_PARALLEL_LOADING
+/****************************************************************************
+ * Name: parallel_loading_thread
+ *
+ * Description:
+ *   This thread loads a binary along with the loaders of other binaries.
+ *
+ ****************************************************************************/
+static int parallel_loading_thread(int argc, char *argv[])
+{
+	int ret;
+	int bin_idx;
+	bool last;
+
+	if (argc <= 1) {
+		bmdbg("Invalid arguments for loading, argc %d\n", argc);
+		return ERROR;
+	}
+
+	/* argv[1] binary index for loading */
+	bin_idx = (int)atoi(argv[1]);
+	ret = binary_manager_load(bin_idx);
+	g_binmgr_loadtime[bin_idx].result = ret;
+
+#ifdef CONFIG_SUPPORT_COMMON_BINARY
+	if (bin_idx == BM_CMNLIB_IDX) {
+		/* Let user binaries be loaded, or fail */
+		g_binmgr_cmnlib_result = ret;
+		sem_post(&g_binmgr_cmnlib_sem);
+	}
+#endif
+
+	binary_manager_sem_wait(&g_binmgr_count_sem);
+	last = (--g_binmgr_nloaders == 0);
+	if (last) {
+		g_binmgr_parallel = false;
+	}
+	sem_post(&g_binmgr_count_sem);
+
+	if (last) {
+		binary_manager_load_report();
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: binary_manager_load_parallel
+ *
+ * Description:
+ *   This function creates a loader for each binary, with the priority of
+ *   its loading priority.  The common library is loaded first.
+ *
+ ****************************************************************************/
+static int binary_manager_load_parallel(uint32_t bin_count)
+{
+	int ret;
+	int bin_idx;
+	int first_idx;
+	uint8_t loader_priority;
+	char data_str[4];
+	char *loading_data[LOADER_ARGC + 1];
+
+	first_idx = 1;
+#ifdef CONFIG_SUPPORT_COMMON_BINARY
+	first_idx = BM_CMNLIB_IDX;
+	g_binmgr_cmnlib_result = ERROR;
+	while (sem_trywait(&g_binmgr_cmnlib_sem) == OK);
+#endif
+	memset(g_binmgr_loadtime, 0, sizeof(g_binmgr_loadtime));
+	g_binmgr_load_start = clock_systimer();
+
+	/* Count loaders first so that the last one to finish is known */
+	g_binmgr_nloaders = bin_count - first_idx + 1;
+	g_binmgr_parallel = true;
+
+	for (bin_idx = first_idx; bin_idx <= bin_count; bin_idx++) {
+		loader_priority = LOADER_PRIORITY_HIGH;
+		if (bin_idx != BM_CMNLIB_IDX) {
+			loader_priority = binary_manager_get_loader_priority(BIN_LOAD_PRIORITY(bin_idx, BIN_USEIDX(bin_idx)));
+			if (loader_priority == 0) {
+				loader_priority = LOADER_PRIORITY_LOW;
+			}
+		}
+
+		loading_data[0] = itoa(bin_idx, data_str, 10);
+		loading_data[1] = NULL;
+		ret = kernel_thread(LOADER_NAME, loader_priority, LOADER_STACKSIZE, parallel_loading_thread, (char * const *)loading_data);
+		if (ret <= 0) {
+			bmdbg("Fail to create loading thread for binary idx %d, errno %d\n", bin_idx, errno);
+			g_binmgr_loadtime[bin_idx].result = ERROR;
+			binary_manager_sem_wait(&g_binmgr_count_sem);
+			g_binmgr_nloaders--;
+			sem_post(&g_binmgr_count_sem);
+#ifdef CONFIG_SUPPORT_COMMON_BINARY
+			if (bin_idx == BM_CMNLIB_IDX) {
+				/* User binaries started later fail without the common library */
+				sem_post(&g_binmgr_cmnlib_sem);
+			}
+#endif
+		}
+	}
+
+	return g_binmgr_nloaders > 0 ? g_binmgr_nloaders : BINMGR_OPERATION_FAIL;
+}
+#endif
+
 /****************************************************************************
  * Name: loadingall_thread
  *
@@ -492,6 +731,12 @@ static int loadingall_thread(int argc, char *argv[])
 	}
 #endif
 
+	bin_count = binary_manager_get_ucount();
+
+#ifdef CONFIG_BINMGR_PARALLEL_LOADING
+	return binary_manager_load_parallel(bin_count);
+#endif
+
 #ifdef CONFIG_SUPPORT_COMMON_BINARY
 	ret = binary_manager_load(BM_CMNLIB_IDX);
 	if (ret < 0) {
@@ -500,7 +745,6 @@ static int loadingall_thread(int argc, char *argv[])
 #endif
 
 	load_cnt = 0;
-	bin_count = binary_manager_get_ucount();
 
 	/* Load the binaries with high priority directly */
 	for (bin_idx = 1; bin_idx <= bin_count; bin_idx++) {
@@ -699,7 +943,9 @@ void binary_manager_release_binary_sem(int bin_idx)
 		bmdbg("g_sem_list is empty.\n");
 	} else {
 		do {
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#if defined(SEM_INLINE_HOLDER)
+			for (holder = &sem->holder; holder; holder = (holder == &sem->holder) ? sem->hhead : holder->flink)
+#elif CONFIG_SEM_PREALLOCHOLDERS > 0
 			for (holder = sem->hhead; holder; holder = holder->flink)
 #else
 			holder = &sem->holder;
@@ -75,6 +75,7 @@
 #include <tinyara/version.h>
 #endif
 
+#include "sched/sched.h"
 #include "clock/clock.h"
 
 /****************************************************************************
@@ -338,12 +339,14 @@ void clock_timer(void)
 	/* Increment the per-tick system counter */
 
 	g_system_timer++;
+	sched_vdso_update(this_task());
 }
 
 #ifdef CONFIG_SCHED_TICKSUPPRESS
 void clock_timer_nohz(clock_t ticks)
 {
 	g_system_timer += ticks;
+	sched_vdso_update(this_task());
 }
 #endif
 #endif
@@ -63,6 +63,7 @@
 
 #include <arch/irq.h>
 
+#include "sched/sched.h"
 #include "clock/clock.h"
 
 /************************************************************************
@@ -152,6 +153,10 @@ int clock_settime(clockid_t clock_id, FAR const struct timespec *tp)
 		g_basetime.tv_nsec -= bias.tv_nsec;
 		g_basetime.tv_sec  -= bias.tv_sec;
 
+		/* Other binaries get the new base time when they are switched in */
+
+		sched_vdso_update(this_task());
+
 		leave_critical_section(flags);
 
 		svdbg("basetime=(%ld,%lu) bias=(%ld,%lu)\n", (long)g_basetime.tv_sec, (unsigned long)g_basetime.tv_nsec, (long)bias.tv_sec, (unsigned long)bias.tv_nsec);
@@ -0,0 +1,127 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/clock.h>
+#ifdef CONFIG_SMP
+#include <tinyara/spinlock.h>
+#endif
+#include <tinyara/bootprof.h>
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct bootprof_mark_s g_bootprof[CONFIG_BOOT_PROFILE_NMARKS];
+static int g_bootprof_count;
+
+/* The counter is 32 bits, the time of a mark is summed from the previous
+ * one.  Marks must be less than a wrap of the counter apart.
+ */
+
+static uint32_t g_bootprof_last;
+static uint64_t g_bootprof_cycles;
+
+/* Marks begin before the IDLE task exists, interrupts and the spinlock are
+ * taken instead of a critical section.
+ */
+
+#ifdef CONFIG_SMP
+static volatile spinlock_t g_bootprof_lock = SP_UNLOCKED;
+#define bootprof_lock()     spin_lock(&g_bootprof_lock)
+#define bootprof_unlock()   spin_unlock(&g_bootprof_lock)
+#else
+#define bootprof_lock()
+#define bootprof_unlock()
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bootprof_init
+ ****************************************************************************/
+
+void bootprof_init(void)
+{
+	up_perf_init((FAR void *)CONFIG_BOOT_PROFILE_FREQ);
+	g_bootprof_last = up_perf_gettime();
+	g_bootprof_cycles = g_bootprof_last;
+}
+
+/****************************************************************************
+ * Name: bootprof_mark
+ ****************************************************************************/
+
+void bootprof_mark(FAR const char *fmt, ...)
+{
+	FAR struct bootprof_mark_s *mark;
+	irqstate_t flags;
+	uint32_t now;
+	va_list ap;
+
+	flags = irqsave();
+	bootprof_lock();
+	if (g_bootprof_count == CONFIG_BOOT_PROFILE_NMARKS) {
+		bootprof_unlock();
+		irqrestore(flags);
+		return;
+	}
+
+	now = up_perf_gettime();
+	g_bootprof_cycles += now - g_bootprof_last;
+	g_bootprof_last = now;
+
+	mark = &g_bootprof[g_bootprof_count];
+	mark->cycles = g_bootprof_cycles;
+	mark->ticks = clock_systimer();
+	mark->name[0] = '\0';
+	g_bootprof_count++;
+	bootprof_unlock();
+	irqrestore(flags);
+
+	va_start(ap, fmt);
+	vsnprintf(mark->name, BOOTPROF_NAMELEN, fmt, ap);
+	va_end(ap);
+}
+
+/****************************************************************************
+ * Name: bootprof_get
+ ****************************************************************************/
+
+int bootprof_get(int index, FAR struct bootprof_mark_s *mark)
+{
+	if (index < 0 || index >= g_bootprof_count) {
+		return -ENOENT;
+	}
+
+	memcpy(mark, &g_bootprof[index], sizeof(struct bootprof_mark_s));
+	return OK;
+}
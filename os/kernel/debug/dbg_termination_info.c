@@ -105,6 +105,10 @@ void dbg_save_termination_info(struct tcb_s *tcb)
 	stackinfo_save_terminated(tcb);
 #endif
 
+#ifdef CONFIG_STACK_WATERMARK
+	stack_watermark_record(tcb);
+#endif
+
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 	/* Deallocate heapinfo tcb infos in heap */
 	heapinfo_dealloc_tcbinfo(tcb->stack_alloc_ptr, tcb->pid);
@@ -34,6 +34,10 @@
 void stackinfo_save_terminated(struct tcb_s *tcb);
 #endif
 
+#ifdef CONFIG_STACK_WATERMARK
+void stack_watermark_record(FAR struct tcb_s *tcb);
+#endif
+
 void dbg_save_termination_info(struct tcb_s *tcb);
 
 #endif							/* __SCHED_DEBUG_DEBUG_H */
@@ -0,0 +1,200 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * kernel/debug/stack_watermark.c
+ *
+ * Stack high-water marks by task name, for sizing the stacks from the
+ * field: a thread is recorded when it exits and, for the threads alive,
+ * at stack_watermark_sample().  The threads of a name, like the workers
+ * created again and again, share one entry with the highest mark.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <string.h>
+#include <sched.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/sched.h>
+
+#include "sched/sched.h"
+#include "debug/debug.h"
+
+#ifdef CONFIG_STACK_WATERMARK
+
+/* The exiting threads are recorded by dbg_save_termination_info() */
+
+#ifndef CONFIG_DEBUG
+#error "CONFIG_STACK_WATERMARK requires CONFIG_DEBUG"
+#endif
+#ifndef CONFIG_STACK_COLORATION
+#error "CONFIG_STACK_WATERMARK requires CONFIG_STACK_COLORATION"
+#endif
+#if CONFIG_TASK_NAME_SIZE <= 0
+#error "CONFIG_STACK_WATERMARK requires CONFIG_TASK_NAME_SIZE"
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct stack_watermark_s g_stackwm[CONFIG_STACK_WATERMARK_NENTRIES];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void stack_watermark_add(FAR const char *name, size_t stacksize, size_t peak)
+{
+	FAR struct stack_watermark_s *mark;
+	irqstate_t flags;
+	int i;
+
+	flags = enter_critical_section();
+	for (i = 0; i < CONFIG_STACK_WATERMARK_NENTRIES; i++) {
+		mark = &g_stackwm[i];
+		if (mark->name[0] == '\0') {
+			strncpy(mark->name, name, CONFIG_TASK_NAME_SIZE);
+			break;
+		}
+
+		if (strncmp(mark->name, name, CONFIG_TASK_NAME_SIZE) == 0) {
+			break;
+		}
+	}
+
+	/* A full table keeps the names it has */
+
+	if (i < CONFIG_STACK_WATERMARK_NENTRIES) {
+		if (stacksize > mark->stacksize) {
+			mark->stacksize = stacksize;
+		}
+
+		if (peak > mark->peak) {
+			mark->peak = peak;
+		}
+
+		mark->count++;
+	}
+
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: stack_watermark_record
+ *
+ * Description:
+ *   Record the high-water mark of the stack of a thread.  The stack is
+ *   scanned with the interrupts enabled.
+ *
+ ****************************************************************************/
+
+void stack_watermark_record(FAR struct tcb_s *tcb)
+{
+	if (tcb->stack_alloc_ptr == NULL || tcb->name[0] == '\0') {
+		return;
+	}
+
+	stack_watermark_add(tcb->name, tcb->adj_stack_size, up_check_tcbstack(tcb));
+}
+
+/****************************************************************************
+ * Name: stack_watermark_sample
+ *
+ * Description:
+ *   Record the high-water marks of the threads alive.  The scheduler is
+ *   locked, so that none of them exits meanwhile.
+ *
+ ****************************************************************************/
+
+void stack_watermark_sample(void)
+{
+	FAR struct tcb_s *tcb;
+	int i;
+
+	sched_lock();
+	for (i = 0; i < CONFIG_MAX_TASKS; i++) {
+		tcb = g_pidhash[i].tcb;
+
+		/* The idle task has no stack of its own allocated */
+
+		if (tcb != NULL && tcb->pid != 0) {
+			stack_watermark_record(tcb);
+		}
+	}
+
+	sched_unlock();
+}
+
+/****************************************************************************
+ * Name: stack_watermark_get
+ *
+ * Description:
+ *   Copy the recorded marks.
+ *
+ * Returned Value:
+ *   The number of marks copied.
+ *
+ ****************************************************************************/
+
+int stack_watermark_get(FAR struct stack_watermark_s *marks, int nmarks)
+{
+	irqstate_t flags;
+	int count = 0;
+	int i;
+
+	flags = enter_critical_section();
+	for (i = 0; i < CONFIG_STACK_WATERMARK_NENTRIES && count < nmarks; i++) {
+		if (g_stackwm[i].name[0] != '\0') {
+			marks[count++] = g_stackwm[i];
+		}
+	}
+
+	leave_critical_section(flags);
+	return count;
+}
+
+/****************************************************************************
+ * Name: stack_watermark_clear
+ *
+ * Description:
+ *   Forget all the marks.
+ *
+ ****************************************************************************/
+
+void stack_watermark_clear(void)
+{
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	memset(g_stackwm, 0, sizeof(g_stackwm));
+	leave_critical_section(flags);
+}
+
+#endif							/* CONFIG_STACK_WATERMARK */
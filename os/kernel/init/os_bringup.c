@@ -69,6 +69,8 @@
 #include <tinyara/kthread.h>
 #include <tinyara/userspace.h>
 #include <tinyara/net/net.h>
+#include <tinyara/bootprof.h>
+#include <tinyara/drvinit.h>
 #ifdef CONFIG_SCHED_WORKQUEUE
 #include <tinyara/wqueue.h>
 #endif
@@ -78,6 +80,9 @@
 #ifdef CONFIG_SCHED_CPULOAD
 #include <tinyara/cpuload.h>
 #endif
+#ifdef CONFIG_PERF_METRICS
+#include <tinyara/perf.h>
+#endif
 #ifdef CONFIG_PRODCONFIG
 #include <tinyara/prodconfig.h>
 #endif
@@ -278,8 +283,13 @@ static inline void os_do_appstart(void)
 	 */
 
 	board_initialize();
+	bootprof_mark("board_initialize");
 #endif
 
+	/* Drivers deferred by the board are initialized from here on */
+
+	drvinit_start();
+
 #ifdef CONFIG_SE
 	se_initialize();
 #endif
@@ -296,12 +306,18 @@ static inline void os_do_appstart(void)
 	/* Initialize the network system & Create network task if required */
 
 	net_initialize();
+	bootprof_mark("net_initialize");
 #endif
 
 #ifdef CONFIG_SCHED_CPULOAD
 	cpuload_initialize();
 #endif
 
+#ifdef CONFIG_PERF_METRICS
+	perf_initialize();
+	perf_drv_register();
+#endif
+
 #ifdef CONFIG_TASK_MANAGER
 	task_manager_drv_register();
 #endif
@@ -73,6 +73,7 @@
 #include  <tinyara/init.h>
 #include  <tinyara/pm/pm.h>
 #include  <tinyara/mm/heap_regioninfo.h>
+#include  <tinyara/bootprof.h>
 #ifdef CONFIG_DEBUG_SYSTEM
 #include  <tinyara/debug/sysdbg.h>
 #endif
@@ -408,6 +409,11 @@ void os_start(void)
 {
 	int i;
 
+	/* Start the boot profile first, its first mark is the time to os_start */
+
+	bootprof_init();
+	bootprof_mark("os_start");
+
 	slldbg("Entry\n");
 
 	g_os_initstate = OSINIT_BOOT;
@@ -535,6 +541,7 @@ void os_start(void)
 		tasklist = TLIST_HEAD(TSTATE_TASK_RUNNING);
 #endif
 		dq_addfirst((FAR dq_entry_t *)&g_idletcb[i], tasklist);
+		sched_rtrindex_add(&g_idletcb[i].cmn);
 
 		/* Mark the idle task as the running task */
 
@@ -586,6 +593,7 @@ void os_start(void)
 #ifdef CONFIG_APP_BINARY_SEPARATION
 	mm_initialize_app_heap_q();
 #endif
+	bootprof_mark("mm_initialize");
 
  	/* Initialize the logic that determine unique process IDs. */
 
@@ -689,6 +697,7 @@ void os_start(void)
 	/* Initialize the file system (needed to support device drivers) */
 
 	fs_initialize();
+	bootprof_mark("fs_initialize");
 #endif
 
 	/* Initialize the POSIX timer facility (if included in the link) */
@@ -761,10 +770,18 @@ void os_start(void)
 	 */
 
 	up_initialize();
+	bootprof_mark("up_initialize");
+
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	/* Start the cycle counter used for exact CPU accounting */
+
+	sched_cycles_initialize();
+#endif
 
 	/* Auto-mount Arch-independent File Sysytems */
 
 	fs_auto_mount();
+	bootprof_mark("fs_auto_mount");
 
 #ifdef CONFIG_DRIVERS_OS_API_TEST
 	os_api_test_drv_register();
@@ -795,6 +812,7 @@ void os_start(void)
 
 	binfmt_initialize();
 #endif
+	bootprof_mark("lib_initialize");
 	g_os_initstate = OSINIT_HARDWARE;
 
 	/* Initialize stdio for the IDLE task of each CPU */
@@ -847,6 +865,7 @@ void os_start(void)
 #endif
 
 	g_os_initstate = OSINIT_OSREADY;
+	bootprof_mark("os_bringup");
 	DEBUGVERIFY(os_bringup());
 	g_os_initstate = OSINIT_IDLELOOP;
 
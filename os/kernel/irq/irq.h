@@ -71,10 +71,42 @@
 #define MAX_IRQNAME_SIZE 31
 #endif
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+#ifndef CONFIG_DEBUG_IRQ_INFO
+#error "CONFIG_DEBUG_IRQ_TIMING requires CONFIG_DEBUG_IRQ_INFO"
+#endif
+#ifndef CONFIG_IRQCOUNT
+#error "CONFIG_DEBUG_IRQ_TIMING requires CONFIG_IRQCOUNT"
+#endif
+
+/* The histograms count cycles by powers of two: bucket 0 the counts below
+ * 2^(IRQ_HIST_SHIFT + 1), bucket i those in [2^(i + IRQ_HIST_SHIFT),
+ * 2^(i + IRQ_HIST_SHIFT + 1)), and the last bucket all the larger ones.
+ */
+
+#define IRQ_HIST_SHIFT    5
+#define IRQ_HIST_NBUCKETS 14
+#endif
+
 /****************************************************************************
  * Public Type Declarations
  ****************************************************************************/
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+struct irq_hist_s {
+	uint32_t max;				/* Largest count of cycles */
+	uint16_t count[IRQ_HIST_NBUCKETS];	/* Saturated at UINT16_MAX */
+};
+
+/* Longest critical section of the tasks, with the caller which entered it */
+
+struct irq_csection_max_s {
+	uint32_t cycles;
+	FAR void *caller;
+	pid_t pid;
+};
+#endif
+
 struct irq {
 	xcpt_t handler;
 	FAR void *arg;
@@ -82,10 +114,18 @@ struct irq {
 	char irq_name[MAX_IRQNAME_SIZE + 1]; /* Includes the terminating Null */
 	size_t count;
 #endif
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+	struct irq_hist_s duration;	/* Cycles spent in the handler */
+	struct irq_hist_s latency;	/* Cycles from the vector entry to the handler */
+#endif
 };
 
 extern struct irq g_irqvector[NR_IRQS];
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+extern struct irq_csection_max_s g_irq_csection_max;
+#endif
+
 /****************************************************************************
  * Public Variables
  ****************************************************************************/
@@ -121,6 +161,29 @@ extern "C" {
 void weak_function irq_initialize(void);
 int irq_unexpected_isr(int irq, FAR void *context, FAR void *arg);
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+/****************************************************************************
+ * Name: irq_hist_add
+ *
+ * Description:
+ *   Count a number of cycles in a histogram.
+ *
+ ****************************************************************************/
+
+void irq_hist_add(FAR struct irq_hist_s *hist, uint32_t cycles);
+
+/****************************************************************************
+ * Name: irq_csection_timing
+ *
+ * Description:
+ *   Time the critical section of a task, from its outermost
+ *   enter_critical_section() to the matching leave_critical_section().
+ *
+ ****************************************************************************/
+
+void irq_csection_timing(FAR struct tcb_s *rtcb, bool enter, FAR void *caller);
+#endif
+
 #ifdef CONFIG_SMP
 /****************************************************************************
  * Name:  irq_cpu_locked
@@ -58,6 +58,27 @@ volatile cpu_set_t g_cpu_irqset;
 volatile uint8_t g_cpu_nestcount[CONFIG_SMP_NCPUS];
 #endif
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+struct irq_csection_max_s g_irq_csection_max;
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+/* Critical section being timed on each CPU.  A task which blocks inside
+ * its critical section lets the next one take the slot, so the time it is
+ * switched out is not counted.
+ */
+
+static struct {
+	FAR struct tcb_s *owner;
+	FAR void *caller;
+	uint32_t start;
+} g_csection_timing[CONFIG_SMP_NCPUS];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -376,6 +397,10 @@ try_again_in_irq:
 #ifdef CONFIG_SCHED_INSTRUMENTATION_CSECTION
 			sched_note_csection(rtcb, true);
 #endif
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+			irq_csection_timing(rtcb, true, __builtin_return_address(0));
+#endif
+			sched_holdtime_enter(SCHED_HOLDTIME_CSECTION, rtcb, __builtin_return_address(0));
 		}
 	}
 	}
@@ -413,6 +438,10 @@ irqstate_t enter_critical_section(void)
 #ifdef CONFIG_SCHED_INSTRUMENTATION_CSECTION
 			sched_note_csection(rtcb, true);
 #endif
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+			irq_csection_timing(rtcb, true, __builtin_return_address(0));
+#endif
+			sched_holdtime_enter(SCHED_HOLDTIME_CSECTION, rtcb, __builtin_return_address(0));
 		}
 	}
 
@@ -505,6 +534,10 @@ void leave_critical_section(irqstate_t flags)
 #ifdef CONFIG_SCHED_INSTRUMENTATION_CSECTION
 				sched_note_csection(rtcb, false);
 #endif
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+				irq_csection_timing(rtcb, false, NULL);
+#endif
+				sched_holdtime_leave(SCHED_HOLDTIME_CSECTION, rtcb);
 				/* Decrement our count on the lock.  If all CPUs have
 				 * released, then unlock the spinlock.
 				 */
@@ -581,6 +614,10 @@ void leave_critical_section(irqstate_t flags)
 #ifdef CONFIG_SCHED_INSTRUMENTATION_CSECTION
 			sched_note_csection(rtcb, false);
 #endif
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+			irq_csection_timing(rtcb, false, NULL);
+#endif
+			sched_holdtime_leave(SCHED_HOLDTIME_CSECTION, rtcb);
 		}
 	}
 
@@ -590,6 +627,44 @@ void leave_critical_section(irqstate_t flags)
 }
 #endif
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+/****************************************************************************
+ * Name: irq_csection_timing
+ *
+ * Description:
+ *   Time the critical section of a task, from its outermost
+ *   enter_critical_section() to the matching leave_critical_section(),
+ *   and keep the longest one.  Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void irq_csection_timing(FAR struct tcb_s *rtcb, bool enter, FAR void *caller)
+{
+	int cpu = this_cpu();
+	uint32_t elapsed;
+
+	if (enter) {
+		g_csection_timing[cpu].owner = rtcb;
+		g_csection_timing[cpu].caller = caller;
+		g_csection_timing[cpu].start = up_perf_gettime();
+		return;
+	}
+
+	if (g_csection_timing[cpu].owner != rtcb) {
+		return;
+	}
+
+	elapsed = up_perf_gettime() - g_csection_timing[cpu].start;
+	g_csection_timing[cpu].owner = NULL;
+
+	if (elapsed > g_irq_csection_max.cycles) {
+		g_irq_csection_max.cycles = elapsed;
+		g_irq_csection_max.caller = g_csection_timing[cpu].caller;
+		g_irq_csection_max.pid = rtcb->pid;
+	}
+}
+#endif
+
 /****************************************************************************
  * Name:  irq_cpu_locked
  *
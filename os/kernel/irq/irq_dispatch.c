@@ -61,11 +61,18 @@
 #include <tinyara/irq.h>
 
 #include "irq/irq.h"
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+#include "sched/sched.h"
+#endif
 
 #ifdef CONFIG_IRQ_SCHED_HISTORY
 #include <tinyara/debug/sysdbg.h>
 #endif
 
+#ifdef CONFIG_TTRACE_FAST
+#include <tinyara/ttrace.h>
+#endif
+
 /****************************************************************************
  * Definitions
  ****************************************************************************/
@@ -78,6 +85,14 @@
  * Global Variables
  ****************************************************************************/
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+#ifdef CONFIG_SMP
+volatile uint32_t g_irq_entry_cycles[CONFIG_SMP_NCPUS];
+#else
+volatile uint32_t g_irq_entry_cycles[1];
+#endif
+#endif
+
 /****************************************************************************
  * Private Variables
  ****************************************************************************/
@@ -90,6 +105,32 @@
  * Public Functions
  ****************************************************************************/
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+/****************************************************************************
+ * Name: irq_hist_add
+ ****************************************************************************/
+
+void irq_hist_add(FAR struct irq_hist_s *hist, uint32_t cycles)
+{
+	int bucket;
+
+	bucket = 31 - __builtin_clz(cycles | 1) - IRQ_HIST_SHIFT;
+	if (bucket < 0) {
+		bucket = 0;
+	} else if (bucket >= IRQ_HIST_NBUCKETS) {
+		bucket = IRQ_HIST_NBUCKETS - 1;
+	}
+
+	if (hist->count[bucket] < UINT16_MAX) {
+		hist->count[bucket]++;
+	}
+
+	if (cycles > hist->max) {
+		hist->max = cycles;
+	}
+}
+#endif
+
 /****************************************************************************
  * Name: irq_dispatch
  *
@@ -103,6 +144,13 @@ void irq_dispatch(int irq, FAR void *context)
 {
 	xcpt_t vector;
 	FAR void *arg;
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	int prev;
+#endif
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+	FAR volatile uint32_t *entry;
+	uint32_t start;
+#endif
 
 	/* Perform some sanity checks */
 
@@ -128,5 +176,36 @@ void irq_dispatch(int irq, FAR void *context)
 
 	/* Then dispatch to the interrupt handler */
 
+#ifdef CONFIG_TTRACE_FAST
+	ttrace_fast_irq(irq, true);
+#endif
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+#ifdef CONFIG_SMP
+	entry = &g_irq_entry_cycles[up_cpu_index()];
+#else
+	entry = &g_irq_entry_cycles[0];
+#endif
+	start = up_perf_gettime();
+	if (*entry != 0 && (unsigned)irq < NR_IRQS) {
+		irq_hist_add(&g_irqvector[irq].latency, start - *entry);
+	}
+	*entry = 0;
+#endif
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	/* Charge the cycles of the handler to the interrupt */
+
+	prev = sched_cycles_irqenter((unsigned)irq < NR_IRQS ? irq : -1);
+	vector(irq, context, arg);
+	sched_cycles_irqleave(prev);
+#else
 	vector(irq, context, arg);
+#endif
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+	if ((unsigned)irq < NR_IRQS) {
+		irq_hist_add(&g_irqvector[irq].duration, up_perf_gettime() - start);
+	}
+#endif
+#ifdef CONFIG_TTRACE_FAST
+	ttrace_fast_irq(irq, false);
+#endif
 }
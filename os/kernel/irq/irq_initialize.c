@@ -108,4 +108,11 @@ void irq_initialize(void)
 	for (i = 0; i < NR_IRQS; i++) {
 		g_irqvector[i].handler = irq_unexpected_isr;
 	}
+
+#if (defined(CONFIG_DEBUG_IRQ_TIMING) || defined(CONFIG_SCHED_HOLDTIME)) && \
+	!defined(CONFIG_SCHED_CPULOAD_CYCLES)
+	/* Start the cycle counter of the histograms and of the hold times */
+
+	up_perf_init(NULL);
+#endif
 }
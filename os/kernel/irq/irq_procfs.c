@@ -85,13 +85,26 @@
  * to handle the longest line generated by this logic.
  */
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+#define IRQS_LINELEN 128
+#else
 #define IRQS_LINELEN 64
+#endif
 
 #define IRQS_INFO_TITLE_FMT " %8s | %9s | %3s \n"
 #define IRQS_INFO_LINE " ---------|-----------|--------------\n"
 #define IRQS_INFO_TITLE "IRQ_NUM", "INT_COUNT", "ISR_NAME"
 #define IRQS_INFO_FMT " %8d | %9d | %s \n"
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+#define IRQS_TIMING_TITLE_FMT "\n %8s | %8s | %10s | %s %d cycles, x2 each\n"
+#define IRQS_TIMING_TITLE "IRQ_NUM", "TIMING", "MAX_CYCLES", "LOG2 HISTOGRAM, first bucket below", 2 << IRQ_HIST_SHIFT
+#define IRQS_TIMING_LINE " ---------|----------|------------|--------------\n"
+#define IRQS_TIMING_FMT " %8d | %8s | %10u |"
+#define IRQS_CSECTION_FMT "\n Longest critical section: %u cycles, entered at %p by pid %d\n"
+#define IRQS_FREQ_FMT " Cycle counter: %u Hz\n"
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -108,6 +121,10 @@ struct irqs_file_s {
  * Private Function Prototypes
  ****************************************************************************/
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+static size_t irqs_hist_line(FAR char *line, int irq, FAR const char *name, FAR const struct irq_hist_s *hist);
+#endif
+
 /* File system methods */
 
 static int irqs_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
@@ -151,6 +168,29 @@ const struct procfs_operations irqs_operations = {
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+/****************************************************************************
+ * Name: irqs_hist_line
+ ****************************************************************************/
+
+static size_t irqs_hist_line(FAR char *line, int irq, FAR const char *name, FAR const struct irq_hist_s *hist)
+{
+	size_t linesize;
+	int i;
+
+	linesize = snprintf(line, IRQS_LINELEN, IRQS_TIMING_FMT, irq, name, hist->max);
+	for (i = 0; i < IRQ_HIST_NBUCKETS && linesize < IRQS_LINELEN; i++) {
+		linesize += snprintf(line + linesize, IRQS_LINELEN - linesize, " %u", hist->count[i]);
+	}
+
+	if (linesize < IRQS_LINELEN) {
+		linesize += snprintf(line + linesize, IRQS_LINELEN - linesize, "\n");
+	}
+
+	return linesize < IRQS_LINELEN ? linesize : IRQS_LINELEN - 1;
+}
+#endif
+
 /****************************************************************************
  * Name: irqs_open
  ****************************************************************************/
@@ -266,6 +306,66 @@ static ssize_t irqs_read(FAR struct file *filep, FAR char *buffer, size_t buflen
 		}
 	}
 
+#ifdef CONFIG_DEBUG_IRQ_TIMING
+	linesize = snprintf(attr->line, IRQS_LINELEN, IRQS_TIMING_TITLE_FMT, IRQS_TIMING_TITLE);
+	copysize = procfs_memcpy(attr->line, linesize, buffer, buflen - totalsize, &offset);
+	totalsize += copysize;
+	buffer += copysize;
+
+	if (totalsize >= buflen) {
+		goto end;
+	}
+
+	linesize = snprintf(attr->line, IRQS_LINELEN, IRQS_TIMING_LINE);
+	copysize = procfs_memcpy(attr->line, linesize, buffer, buflen - totalsize, &offset);
+	totalsize += copysize;
+	buffer += copysize;
+
+	if (totalsize >= buflen) {
+		goto end;
+	}
+
+	for (irq_idx = 0; irq_idx < NR_IRQS; irq_idx++) {
+		if (g_irqvector[irq_idx].handler == NULL || g_irqvector[irq_idx].handler == irq_unexpected_isr) {
+			continue;
+		}
+
+		linesize = irqs_hist_line(attr->line, irq_idx, "duration", &g_irqvector[irq_idx].duration);
+		copysize = procfs_memcpy(attr->line, linesize, buffer, buflen - totalsize, &offset);
+		totalsize += copysize;
+		buffer += copysize;
+
+		if (totalsize >= buflen) {
+			goto end;
+		}
+
+		linesize = irqs_hist_line(attr->line, irq_idx, "latency", &g_irqvector[irq_idx].latency);
+		copysize = procfs_memcpy(attr->line, linesize, buffer, buflen - totalsize, &offset);
+		totalsize += copysize;
+		buffer += copysize;
+
+		if (totalsize >= buflen) {
+			goto end;
+		}
+	}
+
+	linesize = snprintf(attr->line, IRQS_LINELEN, IRQS_CSECTION_FMT, g_irq_csection_max.cycles, g_irq_csection_max.caller, g_irq_csection_max.pid);
+	copysize = procfs_memcpy(attr->line, linesize, buffer, buflen - totalsize, &offset);
+	totalsize += copysize;
+	buffer += copysize;
+
+	if (totalsize >= buflen) {
+		goto end;
+	}
+
+	if (up_perf_getfreq() != 0) {
+		linesize = snprintf(attr->line, IRQS_LINELEN, IRQS_FREQ_FMT, up_perf_getfreq());
+		copysize = procfs_memcpy(attr->line, linesize, buffer, buflen - totalsize, &offset);
+		totalsize += copysize;
+		buffer += copysize;
+	}
+#endif
+
 end:
 	/* Update the file position */	
 	if (totalsize > 0) {
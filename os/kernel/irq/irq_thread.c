@@ -0,0 +1,269 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * kernel/irq/irq_thread.c
+ *
+ * Threaded interrupts: the hard handler only acknowledges the device, and
+ * the work is done by a kernel thread of the interrupt, at the priority
+ * the driver chooses, instead of in the interrupt or in the shared work
+ * queues.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/kthread.h>
+
+#include "irq/irq.h"
+
+#ifdef CONFIG_IRQ_THREAD
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_IRQ_THREAD_STACKSIZE
+#define CONFIG_IRQ_THREAD_STACKSIZE 2048
+#endif
+
+#define IRQ_THREAD_NAMELEN 12
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct irq_thread_s {
+	int irq;
+	xcpt_t isr;					/* Hard handler, or NULL to mask the interrupt */
+	irq_thread_t handler;		/* Handler run by the thread */
+	FAR void *arg;
+	sem_t sem;					/* Posted to run the handler */
+	volatile bool pending;		/* The sem is posted, the handler not yet run */
+	volatile bool masked;		/* Masked by the hard handler, for the thread */
+	volatile bool stop;			/* Detached: the thread exits */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: irq_thread_isr
+ *
+ * Description:
+ *   The interrupt handler attached for a threaded interrupt.  Without a
+ *   hard handler, the interrupt stays masked at the controller until the
+ *   thread has run, as the device has not been acknowledged.
+ *
+ ****************************************************************************/
+
+static int irq_thread_isr(int irq, FAR void *context, FAR void *arg)
+{
+	FAR struct irq_thread_s *it = (FAR struct irq_thread_s *)arg;
+
+	if (it->isr != NULL) {
+		if (it->isr(irq, context, it->arg) != IRQ_WAKE_THREAD) {
+			return OK;
+		}
+	}
+#ifndef CONFIG_ARCH_NOINTC
+	else {
+		up_disable_irq(irq);
+		it->masked = true;
+	}
+#endif
+
+	/* Interrupts raised before the thread runs are served by that run */
+
+	if (!it->pending) {
+		it->pending = true;
+		sem_post(&it->sem);
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: irq_thread_main
+ *
+ * Description:
+ *   The kernel thread of a threaded interrupt.  argv[1] is the address of
+ *   its struct irq_thread_s, which the thread frees when it is detached.
+ *
+ ****************************************************************************/
+
+static int irq_thread_main(int argc, FAR char *argv[])
+{
+	FAR struct irq_thread_s *it;
+
+	DEBUGASSERT(argc > 1);
+	it = (FAR struct irq_thread_s *)strtoul(argv[1], NULL, 16);
+
+	for (;;) {
+		while (sem_wait(&it->sem) < 0) {
+			DEBUGASSERT(get_errno() == EINTR);
+		}
+
+		if (it->stop) {
+			break;
+		}
+
+		/* Clear before the run, so that an interrupt raised meanwhile
+		 * runs the handler again.
+		 */
+
+		it->pending = false;
+		it->handler(it->irq, it->arg);
+
+#ifndef CONFIG_ARCH_NOINTC
+		if (it->masked && !it->stop) {
+			it->masked = false;
+			up_enable_irq(it->irq);
+		}
+#endif
+	}
+
+	sem_destroy(&it->sem);
+	kmm_free(it);
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: irq_attach_thread
+ *
+ * Description:
+ *   Attach a threaded interrupt, see include/tinyara/irq.h.
+ *
+ ****************************************************************************/
+
+int irq_attach_thread(int irq, xcpt_t isr, irq_thread_t handler, FAR void *arg, int priority, int stacksize)
+{
+	FAR struct irq_thread_s *it;
+	char name[IRQ_THREAD_NAMELEN];
+	char addr[20];
+	FAR char *argv[2];
+	int ret;
+
+	if ((unsigned)irq >= NR_IRQS || handler == NULL) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_ARCH_NOINTC
+	/* The interrupt can not be masked until the thread runs */
+
+	if (isr == NULL) {
+		return -EINVAL;
+	}
+#endif
+
+	it = (FAR struct irq_thread_s *)kmm_zalloc(sizeof(struct irq_thread_s));
+	if (it == NULL) {
+		return -ENOMEM;
+	}
+
+	it->irq = irq;
+	it->isr = isr;
+	it->handler = handler;
+	it->arg = arg;
+
+	/* The semaphore is used for signaling and, hence, should not have
+	 * priority inheritance enabled.
+	 */
+
+	sem_init(&it->sem, 0, 0);
+	sem_setprotocol(&it->sem, SEM_PRIO_NONE);
+
+	ret = irq_attach(irq, irq_thread_isr, it);
+	if (ret != OK) {
+		sem_destroy(&it->sem);
+		kmm_free(it);
+		return -EINVAL;
+	}
+
+	snprintf(name, IRQ_THREAD_NAMELEN, "irq%d", irq);
+	snprintf(addr, sizeof(addr), "%lx", (unsigned long)(uintptr_t)it);
+	argv[0] = addr;
+	argv[1] = NULL;
+
+	ret = kernel_thread(name, priority, stacksize > 0 ? stacksize : CONFIG_IRQ_THREAD_STACKSIZE, irq_thread_main, argv);
+	if (ret < 0) {
+		ret = -get_errno();
+		irq_detach(irq);
+		sem_destroy(&it->sem);
+		kmm_free(it);
+		return ret;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: irq_detach_thread
+ *
+ * Description:
+ *   Detach a threaded interrupt.  Its thread exits after a run of the
+ *   handler which is in progress.
+ *
+ ****************************************************************************/
+
+int irq_detach_thread(int irq)
+{
+	FAR struct irq_thread_s *it;
+	irqstate_t flags;
+
+	if ((unsigned)irq >= NR_IRQS) {
+		return -EINVAL;
+	}
+
+	flags = enter_critical_section();
+	if (g_irqvector[irq].handler != irq_thread_isr) {
+		leave_critical_section(flags);
+		return -EINVAL;
+	}
+
+	it = (FAR struct irq_thread_s *)g_irqvector[irq].arg;
+	irq_detach(irq);
+
+	it->stop = true;
+	sem_post(&it->sem);
+	leave_critical_section(flags);
+
+	return OK;
+}
+
+#endif							/* CONFIG_IRQ_THREAD */
@@ -81,18 +81,12 @@ struct mq_des_block_s {
  * Public Variables
  ************************************************************************/
 
-/* The g_msgfree is a list of messages that are available for general
- * use.  The number of messages in this list is a system configuration
- * item.
+/* The g_msgpool is the pool of messages.  It holds the configured number
+ * of messages for general use plus the ones reserved for use by interrupt
+ * handlers.
  */
 
-sq_queue_t g_msgfree;
-
-/* The g_msgfreeInt is a list of messages that are reserved for use by
- * interrupt handlers.
- */
-
-sq_queue_t g_msgfreeirq;
+struct mempool_s g_msgpool;
 
 /* The g_desfree data structure is a list of message descriptors available
  * to the operating system for general use. The number of messages in the
@@ -105,18 +99,6 @@ sq_queue_t g_desfree;
  * Private Variables
  ************************************************************************/
 
-/* g_msgalloc is a pointer to the start of the allocated block of
- * messages.
- */
-
-static struct mqueue_msg_s *g_msgalloc;
-
-/* g_msgfreeirqalloc is a pointer to the start of the allocated block of
- * messages.
- */
-
-static struct mqueue_msg_s *g_msgfreeirqalloc;
-
 /* g_desalloc is a list of allocated block of message queue descriptors. */
 
 static sq_queue_t g_desalloc;
@@ -125,40 +107,6 @@ static sq_queue_t g_desalloc;
  * Private Functions
  ************************************************************************/
 
-/************************************************************************
- * Name: mq_msgblockalloc
- *
- * Description:
- *   Allocate a block of messages and place them on the free list.
- *
- * Inputs Parameters:
- *  queue
- *
- ************************************************************************/
-
-static struct mqueue_msg_s *mq_msgblockalloc(FAR sq_queue_t *queue, uint16_t nmsgs, uint8_t alloc_type)
-{
-	struct mqueue_msg_s *mqmsgblock;
-
-	/* The g_msgfree must be loaded at initialization time to hold the
-	 * configured number of messages.
-	 */
-
-	mqmsgblock = (FAR struct mqueue_msg_s *)kmm_malloc(sizeof(struct mqueue_msg_s) * nmsgs);
-
-	if (mqmsgblock) {
-		struct mqueue_msg_s *mqmsg = mqmsgblock;
-		int i;
-
-		for (i = 0; i < nmsgs; i++) {
-			mqmsg->type = alloc_type;
-			sq_addlast((FAR sq_entry_t *)mqmsg++, queue);
-		}
-	}
-
-	return mqmsgblock;
-}
-
 /************************************************************************
  * Public Functions
  ************************************************************************/
@@ -181,21 +129,20 @@ static struct mqueue_msg_s *mq_msgblockalloc(FAR sq_queue_t *queue, uint16_t nms
 
 void mq_initialize(void)
 {
-	/* Initialize the message free lists */
-
-	sq_init(&g_msgfree);
-	sq_init(&g_msgfreeirq);
 	sq_init(&g_desalloc);
 
-	/* Allocate a block of messages for general use */
-
-	g_msgalloc = mq_msgblockalloc(&g_msgfree, CONFIG_PREALLOC_MQ_MSGS, MQ_ALLOC_FIXED);
-
-	/* Allocate a block of messages for use exclusively by
-	 * interrupt handlers
+	/* Create the message pool with a block of messages for general use and
+	 * a block for use exclusively by interrupt handlers.  Tasks grow the
+	 * pool when the messages for general use run out.
 	 */
 
-	g_msgfreeirqalloc = mq_msgblockalloc(&g_msgfreeirq, NUM_INTERRUPT_MSGS, MQ_ALLOC_IRQ);
+	g_msgpool.blocksize = sizeof(struct mqueue_msg_s);
+	g_msgpool.ninitial = CONFIG_PREALLOC_MQ_MSGS + NUM_INTERRUPT_MSGS;
+	g_msgpool.nexpand = CONFIG_MQ_MSG_POOL_EXPAND;
+	g_msgpool.nreserve = NUM_INTERRUPT_MSGS;
+	g_msgpool.flags = MEMPOOL_FLAG_IRQSAFE;
+
+	(void)mempool_initialize(&g_msgpool, "mq_msg");
 
 	/* Allocate a block of message queue descriptors */
 
@@ -59,7 +59,6 @@
 #include <queue.h>
 
 #include <tinyara/arch.h>
-#include <tinyara/kmalloc.h>
 
 #include "mqueue/mqueue.h"
 
@@ -91,9 +90,8 @@
  * Name: mq_msgfree
  *
  * Description:
- *   The mq_msgfree function will return a message to the free pool of
- *   messages if it was a pre-allocated message. If the message was
- *   allocated dynamically it will be deallocated.
+ *   The mq_msgfree function will return a message to the pool of
+ *   messages.
  *
  * Inputs:
  *   mqmsg - message to free
@@ -105,44 +103,9 @@
 
 void mq_msgfree(FAR struct mqueue_msg_s *mqmsg)
 {
-	irqstate_t saved_state;
-
-	/* If this is a generally available pre-allocated message,
-	 * then just put it back in the free list.
-	 */
-
-	if (mqmsg->type == MQ_ALLOC_FIXED) {
-		/* Make sure we avoid concurrent access to the free
-		 * list from interrupt handlers.
-		 */
-
-		saved_state = enter_critical_section();
-		sq_addlast((FAR sq_entry_t *)mqmsg, &g_msgfree);
-		leave_critical_section(saved_state);
-	}
-
-	/* If this is a message pre-allocated for interrupts,
-	 * then put it back in the correct  free list.
-	 */
-
-	else if (mqmsg->type == MQ_ALLOC_IRQ) {
-		/* Make sure we avoid concurrent access to the free
-		 * list from interrupt handlers.
-		 */
-
-		saved_state = enter_critical_section();
-		sq_addlast((FAR sq_entry_t *)mqmsg, &g_msgfreeirq);
-		leave_critical_section(saved_state);
-	}
-
-	/* Otherwise, deallocate it.  Note:  interrupt handlers
-	 * will never deallocate messages because they will not
-	 * received them.
+	/* The pool makes sure we avoid concurrent access to the free list from
+	 * interrupt handlers.
 	 */
 
-	else if (mqmsg->type == MQ_ALLOC_DYN) {
-		sched_kfree(mqmsg);
-	} else {
-		PANIC();
-	}
+	mempool_free(&g_msgpool, mqmsg);
 }
@@ -175,6 +175,9 @@ FAR struct mqueue_msg_s *mq_waitreceive(mqd_t mqdes)
 	FAR struct tcb_s *rtcb;
 	FAR struct mqueue_inode_s *msgq;
 	FAR struct mqueue_msg_s *rcvmsg;
+#if CONFIG_MQ_PRIO_BUCKETS > 0
+	int bucket;
+#endif
 
 	/* mq_waitreceive() is not a cancellation point, but it is always called
 	 * from a cancellation point.
@@ -219,6 +222,14 @@ FAR struct mqueue_msg_s *mq_waitreceive(mqd_t mqdes)
 			if (get_errno() != OK) {
 				break;
 			}
+
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+			/* The message was copied directly to the buffer */
+
+			if (rtcb->msgrcvlen >= 0) {
+				break;
+			}
+#endif
 		} else {
 			/* The queue was empty, and the O_NONBLOCK flag was set for the
 			 * message queue description referred to by 'mqdes'.
@@ -235,6 +246,16 @@ FAR struct mqueue_msg_s *mq_waitreceive(mqd_t mqdes)
 
 	if (rcvmsg) {
 		msgq->nmsgs--;
+
+#if CONFIG_MQ_PRIO_BUCKETS > 0
+		/* The message was the head, so the bucket is empty if it was its last */
+
+		bucket = MQ_PRIO_BUCKET(rcvmsg->priority);
+		if (msgq->priotail[bucket] == rcvmsg) {
+			msgq->priotail[bucket] = NULL;
+			msgq->priomap &= ~((uint32_t)1 << bucket);
+		}
+#endif
 	}
 
 	leave_cancellation_point();
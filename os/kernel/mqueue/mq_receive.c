@@ -64,6 +64,7 @@
 #include <tinyara/arch.h>
 #include <tinyara/cancelpt.h>
 
+#include "sched/sched.h"
 #include "mqueue/mqueue.h"
 
 /************************************************************************
@@ -132,6 +133,9 @@
 
 ssize_t mq_receive(mqd_t mqdes, FAR char *msg, size_t msglen, FAR int *prio)
 {
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	FAR struct tcb_s *rtcb = this_task();
+#endif
 	FAR struct mqueue_msg_s *mqmsg;
 	irqstate_t saved_state;
 	ssize_t ret = ERROR;
@@ -167,7 +171,14 @@ ssize_t mq_receive(mqd_t mqdes, FAR char *msg, size_t msglen, FAR int *prio)
 
 	/* Get the message from the message queue */
 
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	rtcb->msgrcvbuf = msg;
+	rtcb->msgrcvlen = -1;
+#endif
 	mqmsg = mq_waitreceive(mqdes);
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	rtcb->msgrcvbuf = NULL;
+#endif
 	leave_critical_section(saved_state);
 
 	/* Check if we got a message from the message queue.  We might
@@ -182,6 +193,14 @@ ssize_t mq_receive(mqd_t mqdes, FAR char *msg, size_t msglen, FAR int *prio)
 	if (mqmsg) {
 		ret = mq_doreceive(mqdes, mqmsg, msg, prio);
 	}
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	if (mqmsg == NULL && rtcb->msgrcvlen >= 0) {
+		ret = rtcb->msgrcvlen;
+		if (prio) {
+			*prio = rtcb->msgrcvprio;
+		}
+	}
+#endif
 
 	leave_cancellation_point();
 	return ret;
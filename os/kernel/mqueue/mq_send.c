@@ -158,6 +158,15 @@ int mq_send(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio)
 
 	msgq = mqdes->msgq;
 
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	/* Hand the message over if a task waits for it */
+
+	if (mq_dohandoff(mqdes, msg, msglen, prio) == OK) {
+		leave_cancellation_point();
+		return OK;
+	}
+#endif
+
 	/* Allocate a message structure:
 	 * - Immediately if we are called from an interrupt handler.
 	 * - Immediately if the message queue is not full, or
@@ -96,6 +96,44 @@
  * Private Functions
  ****************************************************************************/
 
+#if CONFIG_MQ_PRIO_BUCKETS > 0
+/****************************************************************************
+ * Name: mq_msgprev
+ *
+ * Description:
+ *   Return the message after which a message of the given priority goes in
+ *   the message list, that is behind all the messages of equal or higher
+ *   priority.  The messages of a bucket are contiguous in the list, so it
+ *   is the last message of the lowest non-empty bucket above or equal to
+ *   its own.  Only in the last bucket, which holds several priorities, the
+ *   messages of higher priority are searched.
+ *
+ * Assumptions:
+ *   Interrupts are disabled.
+ *
+ ****************************************************************************/
+
+static FAR struct mqueue_msg_s *mq_msgprev(FAR struct mqueue_inode_s *msgq, int prio)
+{
+	FAR struct mqueue_msg_s *next;
+	FAR struct mqueue_msg_s *prev;
+	uint32_t mask;
+	int bucket = MQ_PRIO_BUCKET(prio);
+
+	if (bucket == CONFIG_MQ_PRIO_BUCKETS - 1) {
+		for (prev = NULL, next = (FAR struct mqueue_msg_s *)msgq->msglist.head; next && prio <= next->priority; prev = next, next = next->next) ;
+		return prev;
+	}
+
+	mask = msgq->priomap & ~(((uint32_t)1 << bucket) - 1);
+	if (mask == 0) {
+		return NULL;
+	}
+
+	return msgq->priotail[__builtin_ctz(mask)];
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -154,18 +192,15 @@ int mq_verifysend(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio)
  *
  * Description:
  *   The mq_msgalloc function will get a free message for use by the
- *   operating system.  The message will be allocated from the g_msgfree
- *   list.
+ *   operating system.  The message will be allocated from the g_msgpool.
  *
- *   If the list is empty AND the message is NOT being allocated from the
- *   interrupt level, then the message will be allocated.  If a message
- *   cannot be obtained, the operating system is dead and therefore cannot
- *   continue.
+ *   If the messages for general use are exhausted AND the message is NOT
+ *   being allocated from the interrupt level, then the pool is expanded
+ *   from the kernel heap.
  *
- *   If the list is empty AND the message IS being allocated from the
- *   interrupt level.  This function will attempt to get a message from
- *   the g_msgfreeirq list.  If this is unsuccessful, the calling interrupt
- *   handler will be notified.
+ *   If the message IS being allocated from the interrupt level, the
+ *   messages reserved for interrupt handlers may also be used.  If this is
+ *   unsuccessful, the calling interrupt handler will be notified.
  *
  * Inputs:
  *   None
@@ -181,50 +216,14 @@ int mq_verifysend(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio)
 FAR struct mqueue_msg_s *mq_msgalloc(void)
 {
 	FAR struct mqueue_msg_s *mqmsg;
-	irqstate_t saved_state;
 
-	/* If we were called from an interrupt handler, then try to get the message
-	 * from generally available list of messages. If this fails, then try the
-	 * list of messages reserved for interrupt handlers
+	/* The pool may be used from interrupt handlers.  They can take the
+	 * messages reserved for them but cannot grow the pool.
 	 */
 
-	if (up_interrupt_context()) {
-		/* Try the general free list */
-
-		mqmsg = (FAR struct mqueue_msg_s *)sq_remfirst(&g_msgfree);
-		if (!mqmsg) {
-			/* Try the free list reserved for interrupt handlers */
-
-			mqmsg = (FAR struct mqueue_msg_s *)sq_remfirst(&g_msgfreeirq);
-		}
-		if (!mqmsg) {
-			set_errno(EBUSY);
-		}
-	}
-
-	/* We were not called from an interrupt handler. */
-
-	else {
-		/* Try to get the message from the generally available free list.
-		 * Disable interrupts -- we might be called from an interrupt handler.
-		 */
-
-		saved_state = enter_critical_section();
-		mqmsg = (FAR struct mqueue_msg_s *)sq_remfirst(&g_msgfree);
-		leave_critical_section(saved_state);
-
-		/* If we cannot a message from the free list, then we will have to allocate one. */
-
-		if (!mqmsg) {
-			mqmsg = (FAR struct mqueue_msg_s *)kmm_malloc((sizeof(struct mqueue_msg_s)));
-
-			/* Check if we got an allocated message */
-			if (mqmsg) {
-				mqmsg->type = MQ_ALLOC_DYN;
-			} else {
-				set_errno(ENOMEM);
-			}
-		}
+	mqmsg = (FAR struct mqueue_msg_s *)mempool_alloc(&g_msgpool);
+	if (!mqmsg) {
+		set_errno(up_interrupt_context() ? EBUSY : ENOMEM);
 	}
 
 	return mqmsg;
@@ -330,6 +329,85 @@ int mq_waitsend(mqd_t mqdes)
 	return OK;
 }
 
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+/****************************************************************************
+ * Name: mq_dohandoff
+ *
+ * Description:
+ *   This is internal, common logic shared by both mq_send and mq_timesend.
+ *   If a task waits for the message queue (mqdes) to be non-empty, this
+ *   function copies the message (msg) directly to the buffer of its
+ *   receive and wakes it up.  The message does not go through the message
+ *   list, so no message is allocated and it is copied only once.
+ *
+ * Parameters:
+ *   mqdes - Message queue descriptor
+ *   msg - Message to send
+ *   msglen - The length of the message in bytes
+ *   prio - The priority of the message
+ *
+ * Return Value:
+ *   OK if the message was handed over.  ERROR if no task was waiting, then
+ *   the message must be sent with mq_dosend().  errno is not set.
+ *
+ * Assumptions/restrictions:
+ * - The caller has verified the input parameters using mq_verifysend().
+ * - Interrupts are enabled.
+ *
+ ****************************************************************************/
+
+int mq_dohandoff(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio)
+{
+	FAR struct tcb_s *btcb;
+	FAR struct mqueue_inode_s *msgq;
+	irqstate_t saved_state;
+
+	if (up_interrupt_context()) {
+		return ERROR;
+	}
+
+	msgq = mqdes->msgq;
+
+	/* The receiver cannot be deleted while it is copied to */
+
+	sched_lock();
+	saved_state = enter_critical_section();
+	if (msgq->nmsgs > 0 || msgq->nwaitnotempty == 0) {
+		leave_critical_section(saved_state);
+		sched_unlock();
+		return ERROR;
+	}
+
+	/* Take the highest priority task that is waiting for this queue to be
+	 * non-empty.  Without msgwaitq, mq_waitirq() leaves it blocked until it
+	 * has the message.
+	 */
+
+	for (btcb = (FAR struct tcb_s *)g_waitingformqnotempty.head; btcb && (btcb->msgwaitq != msgq || btcb->msgrcvbuf == NULL); btcb = btcb->flink) ;
+
+	if (btcb == NULL) {
+		leave_critical_section(saved_state);
+		sched_unlock();
+		return ERROR;
+	}
+
+	btcb->msgwaitq = NULL;
+	msgq->nwaitnotempty--;
+	leave_critical_section(saved_state);
+
+	memcpy(btcb->msgrcvbuf, msg, msglen);
+	btcb->msgrcvlen = msglen;
+	btcb->msgrcvprio = prio;
+
+	saved_state = enter_critical_section();
+	up_unblock_task(btcb);
+	leave_critical_section(saved_state);
+	sched_unlock();
+
+	return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: mq_dosend
  *
@@ -357,7 +435,11 @@ int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg,
 {
 	FAR struct tcb_s *btcb;
 	FAR struct mqueue_inode_s *msgq;
+#if CONFIG_MQ_PRIO_BUCKETS == 0
 	FAR struct mqueue_msg_s *next;
+#else
+	int bucket;
+#endif
 	FAR struct mqueue_msg_s *prev;
 	irqstate_t saved_state;
 
@@ -385,7 +467,11 @@ int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg,
 	 * message. Each is list is maintained in ascending priority order.
 	 */
 
+#if CONFIG_MQ_PRIO_BUCKETS > 0
+	prev = mq_msgprev(msgq, prio);
+#else
 	for (prev = NULL, next = (FAR struct mqueue_msg_s *)msgq->msglist.head; next && prio <= next->priority; prev = next, next = next->next) ;
+#endif
 
 	/* Add the message at the right place */
 
@@ -395,6 +481,18 @@ int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg,
 		sq_addfirst((FAR sq_entry_t *)mqmsg, &msgq->msglist);
 	}
 
+#if CONFIG_MQ_PRIO_BUCKETS > 0
+	/* The message is the last of its bucket unless a message of the same
+	 * bucket follows, which happens only in the last bucket.
+	 */
+
+	bucket = MQ_PRIO_BUCKET(prio);
+	if (mqmsg->next == NULL || MQ_PRIO_BUCKET(mqmsg->next->priority) != bucket) {
+		msgq->priotail[bucket] = mqmsg;
+	}
+	msgq->priomap |= (uint32_t)1 << bucket;
+#endif
+
 	/* Increment the count of messages in the queue */
 
 	msgq->nmsgs++;
@@ -291,7 +291,14 @@ ssize_t mq_timedreceive(mqd_t mqdes, FAR char *msg, size_t msglen, FAR int *prio
 
 	/* Get the message from the message queue */
 
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	rtcb->msgrcvbuf = msg;
+	rtcb->msgrcvlen = -1;
+#endif
 	mqmsg = mq_waitreceive(mqdes);
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	rtcb->msgrcvbuf = NULL;
+#endif
 
 	/* Stop the watchdog timer (this is not harmful in the case where
 	 * it was never started)
@@ -315,6 +322,14 @@ ssize_t mq_timedreceive(mqd_t mqdes, FAR char *msg, size_t msglen, FAR int *prio
 	if (mqmsg) {
 		ret = mq_doreceive(mqdes, mqmsg, msg, prio);
 	}
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	if (mqmsg == NULL && rtcb->msgrcvlen >= 0) {
+		ret = rtcb->msgrcvlen;
+		if (prio) {
+			*prio = rtcb->msgrcvprio;
+		}
+	}
+#endif
 
 	wd_delete(rtcb->waitdog);
 	rtcb->waitdog = NULL;
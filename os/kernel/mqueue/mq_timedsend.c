@@ -231,6 +231,15 @@ int mq_timedsend(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio, FAR
 
 	msgq = mqdes->msgq;
 
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+	/* Hand the message over if a task waits for it */
+
+	if (mq_dohandoff(mqdes, msg, msglen, prio) == OK) {
+		leave_cancellation_point();
+		return OK;
+	}
+#endif
+
 	/* Create a watchdog.  We will not actually need this watchdog
 	 * unless the queue is full, but we will reserve it up front
 	 * before we enter the following critical section.
@@ -128,6 +128,16 @@ void mq_waitirq(FAR struct tcb_s *wtcb, int errcode)
 		/* Get the message queue associated with the waiter from the TCB */
 
 		msgq = wtcb->msgwaitq;
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+		/* A message is being copied to the buffer of the task, which is
+		 * woken up with it.
+		 */
+
+		if (msgq == NULL) {
+			leave_critical_section(saved_state);
+			return;
+		}
+#endif
 		DEBUGASSERT(msgq);
 
 		wtcb->msgwaitq = NULL;
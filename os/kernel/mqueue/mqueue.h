@@ -69,6 +69,7 @@
 #include <signal.h>
 
 #include <tinyara/mqueue.h>
+#include <tinyara/mm/mempool.h>
 
 #if !defined(CONFIG_DISABLE_MQUEUE) && CONFIG_MQ_MAXMSGSIZE > 0
 
@@ -92,21 +93,38 @@
 
 #define NUM_INTERRUPT_MSGS   32
 
+/* This defines the number of messages added to the message pool when it
+ * runs out of free messages.
+ */
+
+#ifndef CONFIG_MQ_MSG_POOL_EXPAND
+#define CONFIG_MQ_MSG_POOL_EXPAND 4
+#endif
+
+/* With CONFIG_MQ_DIRECT_RECEIVE, a message sent while a task waits for the
+ * queue to be non-empty is copied directly to the buffer of its receive
+ * instead of through a message of the queue.  The sender writes to the
+ * memory of the receiver, which needs a flat build.
+ */
+
+#if defined(CONFIG_MQ_DIRECT_RECEIVE) && !defined(CONFIG_BUILD_FLAT)
+#error "CONFIG_MQ_DIRECT_RECEIVE needs CONFIG_BUILD_FLAT"
+#endif
+
+/* The bucket of a message priority in the message list of a queue */
+
+#if CONFIG_MQ_PRIO_BUCKETS > 0
+#define MQ_PRIO_BUCKET(prio) ((prio) < CONFIG_MQ_PRIO_BUCKETS - 1 ? (prio) : CONFIG_MQ_PRIO_BUCKETS - 1)
+#endif
+
 /****************************************************************************
  * Public Type Definitions
  ****************************************************************************/
 
-enum mqalloc_e {
-	MQ_ALLOC_FIXED = 0,			/* pre-allocated; never freed */
-	MQ_ALLOC_DYN,				/* dynamically allocated; free when unused */
-	MQ_ALLOC_IRQ				/* Preallocated, reserved for interrupt handling */
-};
-
 /* This structure describes one buffered POSIX message. */
 
 struct mqueue_msg_s {
 	FAR struct mqueue_msg_s *next;	/* Forward link to next message */
-	uint8_t type;					/* (Used to manage allocations) */
 	uint8_t priority;				/* priority of message */
 	size_t msglen;					/* Message data length */
 	char mail[MQ_MAX_BYTES];		/* Message data */
@@ -123,17 +141,12 @@ extern "C" {
 #define EXTERN extern
 #endif
 
-/* The g_msgfree is a list of messages that are available for general use.
- * The number of messages in this list is a system configuration item.
+/* The g_msgpool is the pool of messages.  It holds the configured number
+ * of messages for general use plus the ones reserved for use by interrupt
+ * handlers.
  */
 
-EXTERN sq_queue_t g_msgfree;
-
-/* The g_msgfreeInt is a list of messages that are reserved for use by
- * interrupt handlers.
- */
-
-EXTERN sq_queue_t g_msgfreeirq;
+EXTERN struct mempool_s g_msgpool;
 
 /* The g_desfree data structure is a list of message descriptors available
  * to the operating system for general use. The number of messages in the
@@ -173,6 +186,9 @@ int mq_verifysend(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio);
 FAR struct mqueue_msg_s *mq_msgalloc(void);
 int mq_waitsend(mqd_t mqdes);
 int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg, size_t msglen, int prio);
+#ifdef CONFIG_MQ_DIRECT_RECEIVE
+int mq_dohandoff(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio);
+#endif
 
 /* mq_release.c ************************************************************/
 
@@ -0,0 +1,363 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * kernel/perf/perf_metrics.c
+ *
+ * The registry of the performance metrics.  The subsystems register their
+ * metrics once and update them with perf_count(), perf_set() and
+ * perf_observe(), from any context.  The list is protected by a semaphore,
+ * as the gauges read on demand may wait, and the values by a spinlock.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <queue.h>
+#include <semaphore.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/clock.h>
+#include <tinyara/spinlock.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/mm/mm.h>
+#include <tinyara/perf.h>
+
+#include "sched/sched.h"
+#include "perf/perf.h"
+
+#ifdef CONFIG_PERF_METRICS
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int64_t perf_read_heap(FAR struct perf_metric_s *metric);
+static int64_t perf_read_tasks(FAR struct perf_metric_s *metric);
+static int64_t perf_read_uptime(FAR struct perf_metric_s *metric);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static sq_queue_t g_perf_metrics;
+static int g_perf_nmetrics;
+static sem_t g_perf_sem = SEM_INITIALIZER(1);
+static spinlock_t g_perf_lock;
+
+/* The metrics of the kernel itself */
+
+enum perf_heap_e {
+	PERF_HEAP_USED = 0,
+	PERF_HEAP_FREE,
+	PERF_HEAP_LARGEST
+};
+
+static struct perf_metric_s g_perf_builtin[] = {
+	PERF_GAUGE_INITIALIZER("mm.heap.used", perf_read_heap, (FAR void *)PERF_HEAP_USED),
+	PERF_GAUGE_INITIALIZER("mm.heap.free", perf_read_heap, (FAR void *)PERF_HEAP_FREE),
+	PERF_GAUGE_INITIALIZER("mm.heap.largest", perf_read_heap, (FAR void *)PERF_HEAP_LARGEST),
+	PERF_GAUGE_INITIALIZER("sched.tasks", perf_read_tasks, NULL),
+	PERF_GAUGE_INITIALIZER("clock.uptime_ms", perf_read_uptime, NULL),
+};
+
+#define PERF_NBUILTIN (sizeof(g_perf_builtin) / sizeof(g_perf_builtin[0]))
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void perf_lock(void)
+{
+	while (sem_wait(&g_perf_sem) < 0) {
+		DEBUGASSERT(get_errno() == EINTR);
+	}
+}
+
+static void perf_unlock(void)
+{
+	sem_post(&g_perf_sem);
+}
+
+/* The kernel heap, or the user heap of a flat build */
+
+static int64_t perf_read_heap(FAR struct perf_metric_s *metric)
+{
+	struct mallinfo mem;
+
+#ifdef CONFIG_MM_KERNEL_HEAP
+#ifdef CONFIG_CAN_PASS_STRUCTS
+	mem = kmm_mallinfo();
+#else
+	(void)kmm_mallinfo(&mem);
+#endif
+#else
+#ifdef CONFIG_CAN_PASS_STRUCTS
+	mem = kumm_mallinfo();
+#else
+	(void)kumm_mallinfo(&mem);
+#endif
+#endif
+
+	switch ((uintptr_t)metric->arg) {
+	case PERF_HEAP_USED:
+		return mem.uordblks;
+	case PERF_HEAP_FREE:
+		return mem.fordblks;
+	default:
+		return mem.mxordblk;
+	}
+}
+
+static int64_t perf_read_tasks(FAR struct perf_metric_s *metric)
+{
+	return g_alive_taskcount;
+}
+
+static int64_t perf_read_uptime(FAR struct perf_metric_s *metric)
+{
+	return (int64_t)TICK2MSEC((uint64_t)clock_systimer());
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: perf_register
+ *
+ * Description:
+ *   Add a metric to the registry.  Its value is kept: a subsystem may count
+ *   before it registers.
+ *
+ * Returned Value:
+ *   OK, -EINVAL for a metric without a name or a histogram with more than
+ *   CONFIG_PERF_MAX_BUCKETS buckets, or -EEXIST if it is registered.
+ *
+ ****************************************************************************/
+
+int perf_register(FAR struct perf_metric_s *metric)
+{
+	FAR sq_entry_t *entry;
+	int ret = OK;
+
+	if (metric == NULL || metric->name == NULL) {
+		return -EINVAL;
+	}
+
+	if (metric->type == PERF_TYPE_HISTOGRAM && (metric->buckets == NULL || metric->bounds == NULL || metric->nbounds + 1 > CONFIG_PERF_MAX_BUCKETS)) {
+		return -EINVAL;
+	}
+
+	perf_lock();
+	for (entry = sq_peek(&g_perf_metrics); entry != NULL; entry = sq_next(entry)) {
+		if (entry == (FAR sq_entry_t *)metric) {
+			ret = -EEXIST;
+			break;
+		}
+	}
+
+	if (ret == OK) {
+		sq_addlast((FAR sq_entry_t *)metric, &g_perf_metrics);
+		g_perf_nmetrics++;
+	}
+
+	perf_unlock();
+	return ret;
+}
+
+/****************************************************************************
+ * Name: perf_unregister
+ *
+ * Description:
+ *   Remove a metric from the registry, before its subsystem frees it.
+ *
+ ****************************************************************************/
+
+void perf_unregister(FAR struct perf_metric_s *metric)
+{
+	FAR sq_entry_t *entry;
+
+	perf_lock();
+	for (entry = sq_peek(&g_perf_metrics); entry != NULL; entry = sq_next(entry)) {
+		if (entry == (FAR sq_entry_t *)metric) {
+			sq_rem(entry, &g_perf_metrics);
+			g_perf_nmetrics--;
+			break;
+		}
+	}
+
+	perf_unlock();
+}
+
+/****************************************************************************
+ * Name: perf_count, perf_set and perf_observe
+ *
+ * Description:
+ *   Add to a counter, set a gauge, or add a sample to a histogram.  They
+ *   may be called from interrupt handlers.
+ *
+ ****************************************************************************/
+
+void perf_count(FAR struct perf_metric_s *metric, uint32_t n)
+{
+	irqstate_t flags;
+
+	flags = spin_lock_irqsave(&g_perf_lock);
+	metric->value += n;
+	spin_unlock_irqrestore(&g_perf_lock, flags);
+}
+
+void perf_set(FAR struct perf_metric_s *metric, int64_t value)
+{
+	irqstate_t flags;
+
+	flags = spin_lock_irqsave(&g_perf_lock);
+	metric->value = value;
+	spin_unlock_irqrestore(&g_perf_lock, flags);
+}
+
+void perf_observe(FAR struct perf_metric_s *metric, uint32_t sample)
+{
+	irqstate_t flags;
+	int i;
+
+	for (i = 0; i < metric->nbounds && sample > metric->bounds[i]; i++) {
+	}
+
+	flags = spin_lock_irqsave(&g_perf_lock);
+	metric->buckets[i]++;
+	metric->value += sample;
+	metric->count++;
+	spin_unlock_irqrestore(&g_perf_lock, flags);
+}
+
+/****************************************************************************
+ * Name: perf_snapshot
+ *
+ * Description:
+ *   Copy the metrics, in the order of their registration.  The gauges with
+ *   a read function are read now.
+ *
+ * Returned Value:
+ *   The number of metrics copied, or the number registered if 'values' is
+ *   NULL.
+ *
+ ****************************************************************************/
+
+int perf_snapshot(FAR struct perf_value_s *values, int nvalues)
+{
+	FAR struct perf_metric_s *metric;
+	FAR struct perf_value_s *value;
+	irqstate_t flags;
+	int count = 0;
+
+	if (values == NULL) {
+		return g_perf_nmetrics;
+	}
+
+	perf_lock();
+	for (metric = (FAR struct perf_metric_s *)sq_peek(&g_perf_metrics); metric != NULL && count < nvalues; metric = metric->flink) {
+		value = &values[count++];
+		memset(value, 0, sizeof(struct perf_value_s));
+		strncpy(value->name, metric->name, PERF_NAME_SIZE - 1);
+		value->type = metric->type;
+
+		if (metric->read != NULL) {
+			value->value = metric->read(metric);
+			continue;
+		}
+
+		flags = spin_lock_irqsave(&g_perf_lock);
+		value->value = metric->value;
+		value->count = metric->count;
+		if (metric->type == PERF_TYPE_HISTOGRAM) {
+			value->nbuckets = metric->nbounds + 1;
+			memcpy(value->bounds, metric->bounds, metric->nbounds * sizeof(uint32_t));
+			memcpy(value->buckets, metric->buckets, value->nbuckets * sizeof(uint32_t));
+		}
+
+		spin_unlock_irqrestore(&g_perf_lock, flags);
+	}
+
+	perf_unlock();
+	return count;
+}
+
+/****************************************************************************
+ * Name: perf_reset
+ *
+ * Description:
+ *   Clear the counters, the histograms and the counts of the threads.  The
+ *   gauges keep their values.
+ *
+ ****************************************************************************/
+
+void perf_reset(void)
+{
+	FAR struct perf_metric_s *metric;
+	irqstate_t flags;
+
+	perf_lock();
+	for (metric = (FAR struct perf_metric_s *)sq_peek(&g_perf_metrics); metric != NULL; metric = metric->flink) {
+		if (metric->type == PERF_TYPE_GAUGE) {
+			continue;
+		}
+
+		flags = spin_lock_irqsave(&g_perf_lock);
+		metric->value = 0;
+		metric->count = 0;
+		if (metric->type == PERF_TYPE_HISTOGRAM) {
+			memset(metric->buckets, 0, (metric->nbounds + 1) * sizeof(uint32_t));
+		}
+
+		spin_unlock_irqrestore(&g_perf_lock, flags);
+	}
+
+	perf_unlock();
+
+	perf_reset_tasks();
+}
+
+/****************************************************************************
+ * Name: perf_initialize
+ *
+ * Description:
+ *   Register the metrics of the kernel.
+ *
+ ****************************************************************************/
+
+void perf_initialize(void)
+{
+	int i;
+
+	for (i = 0; i < PERF_NBUILTIN; i++) {
+		(void)perf_register(&g_perf_builtin[i]);
+	}
+}
+
+#endif							/* CONFIG_PERF_METRICS */
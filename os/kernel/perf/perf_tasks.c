@@ -0,0 +1,229 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * kernel/perf/perf_tasks.c
+ *
+ * The counts of the threads: the hardware events of CONFIG_PERF_EVENTS,
+ * charged at each context switch like the cycles of
+ * CONFIG_SCHED_CPULOAD_CYCLES, and those cycles.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/sched.h>
+#include <tinyara/perf.h>
+
+#include "sched/sched.h"
+#include "perf/perf.h"
+
+#ifdef CONFIG_PERF_METRICS
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_SMP
+#define PERF_NCPUS         CONFIG_SMP_NCPUS
+#define PERF_CPU()         this_cpu()
+#else
+#define PERF_NCPUS         1
+#define PERF_CPU()         0
+#endif
+
+#ifdef CONFIG_PERF_EVENTS
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The events since 'last' belong to the thread in the PID hash slot 'slot' */
+
+struct perf_cpu_s {
+	bool started;
+	int16_t slot;
+	uint32_t last[PERF_NEVENTS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct perf_cpu_s g_perf_cpu[PERF_NCPUS];
+static uint32_t g_perf_mask;
+static uint64_t g_perf_events[CONFIG_MAX_TASKS][PERF_NEVENTS];
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: perf_events_switch
+ *
+ * Description:
+ *   Charge the events counted since the last switch to the outgoing thread
+ *   and make 'tcb' the owner of the following ones.  Called by the
+ *   architecture when it restores the context of 'tcb', with the
+ *   interrupts disabled.  The counters of a CPU are started at its first
+ *   switch.
+ *
+ ****************************************************************************/
+
+void perf_events_switch(FAR struct tcb_s *tcb)
+{
+	FAR struct perf_cpu_s *pc = &g_perf_cpu[PERF_CPU()];
+	uint32_t now[PERF_NEVENTS];
+	int i;
+
+	if (!pc->started) {
+		g_perf_mask = up_perf_events_start();
+		up_perf_events_read(pc->last);
+		pc->started = true;
+	} else {
+		up_perf_events_read(now);
+		for (i = 0; i < PERF_NEVENTS; i++) {
+			g_perf_events[pc->slot][i] += (now[i] - pc->last[i]) & g_perf_mask;
+			pc->last[i] = now[i];
+		}
+	}
+
+	pc->slot = PIDHASH(tcb->pid);
+}
+
+/****************************************************************************
+ * Name: perf_events_clear
+ *
+ * Description:
+ *   Forget the events of a thread which exits.
+ *
+ ****************************************************************************/
+
+void perf_events_clear(pid_t pid)
+{
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	memset(g_perf_events[PIDHASH(pid)], 0, sizeof(g_perf_events[0]));
+	leave_critical_section(flags);
+}
+
+#endif							/* CONFIG_PERF_EVENTS */
+
+/****************************************************************************
+ * Name: perf_get_tasks
+ *
+ * Description:
+ *   Copy the counts of the threads alive.  The thread running on the
+ *   calling CPU is brought up to date first.
+ *
+ * Returned Value:
+ *   The number of threads copied.
+ *
+ ****************************************************************************/
+
+int perf_get_tasks(FAR struct perf_tasks_s *tasks)
+{
+	FAR struct perf_task_s *task;
+	FAR struct tcb_s *tcb;
+	irqstate_t flags;
+	int count = 0;
+	int ndx;
+#if defined(CONFIG_PERF_EVENTS) || defined(CONFIG_SCHED_CPULOAD_CYCLES)
+	int i;
+#endif
+
+	memset(tasks->event, 0, sizeof(tasks->event));
+#ifdef CONFIG_PERF_EVENTS
+	for (i = 0; i < PERF_NEVENTS; i++) {
+		strncpy(tasks->event[i], up_perf_events_name(i), PERF_EVENT_NAME_SIZE - 1);
+	}
+#endif
+
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	tasks->freq = up_perf_getfreq();
+#else
+	tasks->freq = 0;
+#endif
+
+	flags = enter_critical_section();
+
+#ifdef CONFIG_PERF_EVENTS
+	perf_events_switch(this_task());
+#endif
+
+	for (ndx = 0; ndx < CONFIG_MAX_TASKS && count < tasks->ntasks; ndx++) {
+		tcb = g_pidhash[ndx].tcb;
+		if (tcb == NULL) {
+			continue;
+		}
+
+		task = &tasks->tasks[count++];
+		memset(task, 0, sizeof(struct perf_task_s));
+		task->pid = tcb->pid;
+#if CONFIG_TASK_NAME_SIZE > 0
+		strncpy(task->name, tcb->name, CONFIG_TASK_NAME_SIZE);
+#endif
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+		for (i = 0; i < PERF_NCPUS; i++) {
+			task->cycles += g_pidhash[ndx].cycles[i];
+		}
+#endif
+#ifdef CONFIG_PERF_EVENTS
+		memcpy(task->events, g_perf_events[ndx], sizeof(task->events));
+#endif
+	}
+
+	leave_critical_section(flags);
+	return count;
+}
+
+/****************************************************************************
+ * Name: perf_reset_tasks
+ *
+ * Description:
+ *   Clear the counts of the threads.  The cycles are those of the cpuload
+ *   driver, cleared for it as well.
+ *
+ ****************************************************************************/
+
+void perf_reset_tasks(void)
+{
+#ifdef CONFIG_PERF_EVENTS
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	memset(g_perf_events, 0, sizeof(g_perf_events));
+	leave_critical_section(flags);
+#endif
+
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	sched_reset_cycles();
+#endif
+}
+
+#endif							/* CONFIG_PERF_METRICS */
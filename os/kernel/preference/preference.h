@@ -27,15 +27,23 @@
 #include <tinyara/preference.h>
 
 int preference_write_key(preference_data_t *data);
+int preference_write_keys(preference_data_t *data, int count);
 int preference_read_key(preference_data_t *data);
 int preference_remove_key(int type, const char *key);
 int preference_remove_all_key(int type, const char *path);
 int preference_check_key(int type, const char *key, bool *result);
 #if !defined(CONFIG_DISABLE_MQUEUE) && !defined(CONFIG_DISABLE_SIGNAL)
 void preference_send_cb_msg(int type, const char *key);
+void preference_send_cb_msgs(preference_data_t *data, int count);
 #endif
 int preference_register_callback(preference_callback_t *data);
 int preference_unregister_callback(const char *key, int type);
 int preference_get_private_keypath(const char *key, char **path);
 void preference_clear_callbacks(pid_t pid);
+int preference_begin_transaction(void);
+bool preference_in_transaction(void);
+int preference_add_transaction(preference_data_t *data);
+int preference_commit_transaction(void);
+int preference_discard_transaction(void);
+void preference_clear_transaction(pid_t pid);
 #endif							/* __KERNEL_PREFERENCE_PREFERENCE_H */
@@ -32,6 +32,8 @@
 #include <sys/types.h>
 #include <tinyara/preference.h>
 
+#include "preference.h"
+
 struct key_cb_list_s {
 	struct key_cb_list_s *flink;
 	char *key;
@@ -68,24 +70,69 @@ static key_cb_list_t *preference_get_key_cb_list(int type, const char *key)
 	return ptr;
 }
 
-/****************************************************************************
- * Public Functions
- ****************************************************************************/
 #if !defined(CONFIG_DISABLE_MQUEUE) && !defined(CONFIG_DISABLE_SIGNAL)
-void preference_send_cb_msg(int type, const char *key)
+/* Queue a callback message for the task of 'node'. The key of the list is
+ * sent as it lives as long as the callback is registered.
+ */
+static int preference_queue_cb_msg(key_cb_list_t *list, key_cb_node_t *node)
 {
 	int ret;
 	mqd_t send_mq;
 	struct mq_attr attr;
 	char q_name[PREFERENCE_CBMQ_LEN];
-	key_cb_node_t *node;
-	key_cb_list_t *list;
 	preference_callback_t data;
 
 	attr.mq_msgsize = sizeof(preference_callback_t);
 	attr.mq_maxmsg = PREFERNENCE_CBMSG_MAX;
 	attr.mq_flags = 0;
 
+	/* Create message queue to receive notification messages */
+	data.key = list->key;
+	data.cb_func = node->cb_func;
+	data.cb_data = node->cb_data;
+	snprintf(q_name, PREFERENCE_CBMQ_LEN, "%s%d", PREFERENCE_CBMSG_MQ, node->pid);
+	send_mq = mq_open(q_name, O_WRONLY | O_CREAT, 0666, &attr);
+	if (send_mq == (mqd_t)ERROR) {
+		prefdbg("Failed to open mq '%s', errno %d\n", q_name, errno);
+		return ERROR;
+	}
+
+	/* Send callback message */
+	ret = mq_send(send_mq, (char *)&data, sizeof(preference_callback_t), 50);
+	mq_close(send_mq);
+	if (ret != OK) {
+		prefdbg("Failed to send mq %s, errno %d\n", q_name, errno);
+		mq_unlink(q_name);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+static int preference_signal_cb_task(int pid)
+{
+	char q_name[PREFERENCE_CBMQ_LEN];
+
+	if (kill(pid, SIG_PREFERENCE) != OK) {
+		prefdbg("Failed to send signal, pid %d errno %d\n", pid, errno);
+		snprintf(q_name, PREFERENCE_CBMQ_LEN, "%s%d", PREFERENCE_CBMSG_MQ, pid);
+		mq_unlink(q_name);
+		return ERROR;
+	}
+
+	return OK;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+#if !defined(CONFIG_DISABLE_MQUEUE) && !defined(CONFIG_DISABLE_SIGNAL)
+void preference_send_cb_msg(int type, const char *key)
+{
+	key_cb_node_t *node;
+	key_cb_list_t *list;
+
 	list = preference_get_key_cb_list(type, key);
 	if (!list) {
 		/* No registered callbacks for 'key' */
@@ -95,37 +142,67 @@ void preference_send_cb_msg(int type, const char *key)
 	/* Traverse through the list of callbacks */
 	node = (key_cb_node_t *)sq_peek(&list->cb_list);
 	while (node) {
-		/* Create message queue to receive notification messages */
-		data.key = key;
-		data.cb_func = node->cb_func;
-		data.cb_data = node->cb_data;
-		snprintf(q_name, PREFERENCE_CBMQ_LEN, "%s%d", PREFERENCE_CBMSG_MQ, node->pid);
-		send_mq = mq_open(q_name, O_WRONLY | O_CREAT, 0666, &attr);
-		if (send_mq == (mqd_t)ERROR) {
-			prefdbg("Failed to open mq '%s', errno %d\n", q_name, errno);
+		if (preference_queue_cb_msg(list, node) != OK || preference_signal_cb_task(node->pid) != OK) {
 			return;
 		}
+		node = (key_cb_node_t *)sq_next(node);
+	}
+}
 
-		/* Send callback message */
-		ret = mq_send(send_mq, (char *)&data, sizeof(preference_callback_t), 50);
-		mq_close(send_mq);
-		if (ret == OK) {
-			ret = kill(node->pid, SIG_PREFERENCE);
-			if (ret != OK) {
-				prefdbg("Failed to send signal, pid %d errno %d\n", node->pid, errno);
-				goto errout_with_unlink;
+/* Queue the callback messages of all 'count' keys first, then signal each
+ * task once. The signal handler drains its whole queue, so a task with
+ * callbacks on several of the keys runs them all from one signal.
+ */
+void preference_send_cb_msgs(preference_data_t *data, int count)
+{
+	int i;
+	int j;
+	int npids;
+	int *pids;
+	key_cb_node_t *node;
+	key_cb_list_t *list;
+
+	npids = 0;
+	for (i = 0; i < count; i++) {
+		list = preference_get_key_cb_list(data[i].type, data[i].key);
+		if (list == NULL) {
+			continue;
+		}
+		for (node = (key_cb_node_t *)sq_peek(&list->cb_list); node != NULL; node = (key_cb_node_t *)sq_next(node)) {
+			npids++;
+		}
+	}
+	if (npids == 0) {
+		return;
+	}
+
+	pids = (int *)PREFERENCE_ALLOC(sizeof(int) * npids);
+	if (pids == NULL) {
+		prefdbg("Failed to allocate pids\n");
+		return;
+	}
+
+	npids = 0;
+	for (i = 0; i < count; i++) {
+		list = preference_get_key_cb_list(data[i].type, data[i].key);
+		if (list == NULL) {
+			continue;
+		}
+		for (node = (key_cb_node_t *)sq_peek(&list->cb_list); node != NULL; node = (key_cb_node_t *)sq_next(node)) {
+			if (preference_queue_cb_msg(list, node) != OK) {
+				continue;
+			}
+			for (j = 0; j < npids && pids[j] != node->pid; j++);
+			if (j == npids) {
+				pids[npids++] = node->pid;
 			}
-		} else {
-			prefdbg("Failed to send mq %s, errno %d\n", q_name, errno);
-			goto errout_with_unlink;
 		}
-		node = (key_cb_node_t *)sq_next(node);
 	}
-	/* Successfully completed processing all callbacks */
-	return;
 
-errout_with_unlink:
-	mq_unlink(q_name);
+	for (j = 0; j < npids; j++) {
+		(void)preference_signal_cb_task(pids[j]);
+	}
+	PREFERENCE_FREE(pids);
 }
 #endif
 
@@ -0,0 +1,954 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/* Log structured backend of preference (CONFIG_PREFERENCE_LOG).
+ *
+ * The keys of a namespace, the private keys of an application or the shared
+ * keys of a directory, are records appended to one log file instead of a
+ * file each. A set appends the key with its value, a remove appends the key
+ * alone. The log is scanned once, when the namespace is first used, into a
+ * hash table of the keys in RAM which gives the offset of their last record.
+ *
+ * Each record is written with one write() and carries a CRC over all of it,
+ * so a record cut by a power loss fails its check and the scan drops it with
+ * everything after it: a change is either fully in the log or not at all.
+ *
+ * Records overwritten or removed are garbage. When it outweighs the live
+ * records, the live ones are copied to a new log which replaces the old one.
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <debug.h>
+#include <queue.h>
+#include <semaphore.h>
+#include <crc32.h>
+#include <sys/stat.h>
+#include <tinyara/preference.h>
+#if CONFIG_TASK_NAME_SIZE > 0
+#include <tinyara/sched.h>
+
+#include "sched/sched.h"
+#endif
+#include "preference.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define PREF_LOG_NAME         ".log"
+#define PREF_LOG_TMP_NAME     ".log.tmp"
+#define PREF_LOG_MAGIC        0x5046
+#define PREF_LOG_REMOVED      (-1)
+#define PREF_LOG_BATCH        (-2)
+#define PREF_LOG_BUCKETS      CONFIG_PREFERENCE_LOG_BUCKETS
+
+#define PREF_LOG_REC_SIZE(keylen, len) (sizeof(struct pref_log_rec_s) + (keylen) + (len))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Header of a record, followed by the key, without '\0', and the value.
+ * A batch has no key, its value is the records written together.
+ */
+struct pref_log_rec_s {
+	uint32_t crc;				/* Of the rest of the header, the key and the value */
+	uint16_t magic;
+	uint16_t keylen;
+	int32_t type;				/* Type of the value, PREF_LOG_REMOVED or PREF_LOG_BATCH */
+	int32_t len;				/* Length of the value */
+};
+
+struct pref_log_key_s {
+	struct pref_log_key_s *next;
+	off_t offset;				/* Of the last record of the key */
+	int type;
+	int len;
+	uint16_t keylen;
+	char key[1];
+};
+
+struct pref_log_ns_s {
+	struct pref_log_ns_s *flink;
+	char *path;					/* Log of the namespace */
+	off_t size;					/* End of the last record */
+	off_t garbage;				/* Bytes of records overwritten or removed */
+	struct pref_log_key_s *buckets[PREF_LOG_BUCKETS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static sq_queue_t g_pref_log_ns;	/* node type : struct pref_log_ns_s */
+static sem_t g_pref_log_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static void pref_log_lock(void)
+{
+	while (sem_wait(&g_pref_log_sem) < 0);
+}
+
+static void pref_log_unlock(void)
+{
+	sem_post(&g_pref_log_sem);
+}
+
+static struct pref_log_key_s **pref_log_bucket(struct pref_log_ns_s *ns, const char *key, uint16_t keylen)
+{
+	return &ns->buckets[crc32((FAR const uint8_t *)key, keylen) % PREF_LOG_BUCKETS];
+}
+
+static struct pref_log_key_s *pref_log_find(struct pref_log_ns_s *ns, const char *key, uint16_t keylen)
+{
+	struct pref_log_key_s *entry;
+
+	for (entry = *pref_log_bucket(ns, key, keylen); entry != NULL; entry = entry->next) {
+		if (entry->keylen == keylen && !memcmp(entry->key, key, keylen)) {
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+/* Make the index follow a record at offset, the garbage of the log grows by
+ * the record it replaces.
+ */
+static int pref_log_apply(struct pref_log_ns_s *ns, const char *key, uint16_t keylen, int type, int len, off_t offset)
+{
+	struct pref_log_key_s **prev;
+	struct pref_log_key_s *entry;
+
+	for (prev = pref_log_bucket(ns, key, keylen); *prev != NULL; prev = &(*prev)->next) {
+		if ((*prev)->keylen == keylen && !memcmp((*prev)->key, key, keylen)) {
+			break;
+		}
+	}
+	entry = *prev;
+
+	if (entry != NULL) {
+		ns->garbage += PREF_LOG_REC_SIZE(keylen, entry->len);
+	}
+
+	if (type == PREF_LOG_REMOVED) {
+		/* The remove itself is garbage once the key is gone */
+		ns->garbage += PREF_LOG_REC_SIZE(keylen, 0);
+		if (entry != NULL) {
+			*prev = entry->next;
+			PREFERENCE_FREE(entry);
+		}
+		return OK;
+	}
+
+	if (entry == NULL) {
+		entry = (struct pref_log_key_s *)PREFERENCE_ALLOC(sizeof(struct pref_log_key_s) + keylen);
+		if (entry == NULL) {
+			return PREFERENCE_OUT_OF_MEMORY;
+		}
+		memcpy(entry->key, key, keylen);
+		entry->key[keylen] = '\0';
+		entry->keylen = keylen;
+		entry->next = *prev;
+		*prev = entry;
+	}
+	entry->offset = offset;
+	entry->type = type;
+	entry->len = len;
+
+	return OK;
+}
+
+static void pref_log_release(struct pref_log_ns_s *ns)
+{
+	struct pref_log_key_s *entry;
+	int i;
+
+	sq_rem((FAR sq_entry_t *)ns, &g_pref_log_ns);
+	for (i = 0; i < PREF_LOG_BUCKETS; i++) {
+		while (ns->buckets[i] != NULL) {
+			entry = ns->buckets[i];
+			ns->buckets[i] = entry->next;
+			PREFERENCE_FREE(entry);
+		}
+	}
+	PREFERENCE_FREE(ns->path);
+	PREFERENCE_FREE(ns);
+}
+
+static char *pref_log_tmp_path(struct pref_log_ns_s *ns)
+{
+	char *tmp;
+	int len;
+
+	/* path ends with PREF_LOG_NAME, which the temporary name extends */
+	len = strlen(ns->path) - strlen(PREF_LOG_NAME);
+	if (PREFERENCE_ASPRINTF(&tmp, "%.*s%s", len, ns->path, PREF_LOG_TMP_NAME) < 0) {
+		return NULL;
+	}
+	return tmp;
+}
+
+/* Copy the live records to a new log and put it in place of the old one.
+ * A failure leaves the old log, and the namespace is scanned again by its
+ * next use.
+ */
+static int pref_log_compact(struct pref_log_ns_s *ns)
+{
+	struct pref_log_key_s *entry;
+	char *tmp;
+	uint8_t *buf;
+	size_t size;
+	off_t offset;
+	int src;
+	int dst;
+	int ret;
+	int i;
+
+	tmp = pref_log_tmp_path(ns);
+	if (tmp == NULL) {
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+
+	ret = PREFERENCE_IO_ERROR;
+	src = open(ns->path, O_RDONLY);
+	if (src < 0) {
+		prefdbg("Failed to open %s, errno %d\n", ns->path, errno);
+		goto errout_with_tmp;
+	}
+	dst = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (dst < 0) {
+		prefdbg("Failed to open %s, errno %d\n", tmp, errno);
+		close(src);
+		goto errout_with_tmp;
+	}
+
+	offset = 0;
+	for (i = 0; i < PREF_LOG_BUCKETS; i++) {
+		for (entry = ns->buckets[i]; entry != NULL; entry = entry->next) {
+			size = PREF_LOG_REC_SIZE(entry->keylen, entry->len);
+			buf = (uint8_t *)PREFERENCE_ALLOC(size);
+			if (buf == NULL) {
+				ret = PREFERENCE_OUT_OF_MEMORY;
+				goto errout_with_close;
+			}
+			if (lseek(src, entry->offset, SEEK_SET) != entry->offset || read(src, buf, size) != size || write(dst, buf, size) != size) {
+				prefdbg("Failed to copy record of %s, errno %d\n", entry->key, errno);
+				PREFERENCE_FREE(buf);
+				goto errout_with_close;
+			}
+			PREFERENCE_FREE(buf);
+			entry->offset = offset;
+			offset += size;
+		}
+	}
+	close(src);
+	close(dst);
+
+	/* A log missing with its temporary one present is completed by the scan */
+	if (unlink(ns->path) < 0 || rename(tmp, ns->path) < 0) {
+		prefdbg("Failed to replace %s, errno %d\n", ns->path, errno);
+		PREFERENCE_FREE(tmp);
+		pref_log_release(ns);
+		return PREFERENCE_IO_ERROR;
+	}
+	PREFERENCE_FREE(tmp);
+
+	prefvdbg("Compacted %s : %d bytes, %d bytes of garbage dropped\n", ns->path, (int)offset, (int)(ns->size - offset));
+	ns->size = offset;
+	ns->garbage = 0;
+
+	return OK;
+errout_with_close:
+	close(src);
+	close(dst);
+errout_with_tmp:
+	unlink(tmp);
+	PREFERENCE_FREE(tmp);
+	pref_log_release(ns);
+
+	return ret;
+}
+
+/* Apply the records of a batch read whole from the log at offset */
+static int pref_log_scan_batch(struct pref_log_ns_s *ns, uint8_t *batch, int len, off_t offset)
+{
+	struct pref_log_rec_s *rec;
+	int pos;
+	int ret;
+
+	for (pos = 0; pos < len; pos += PREF_LOG_REC_SIZE(rec->keylen, rec->len)) {
+		rec = (struct pref_log_rec_s *)(batch + pos);
+		if (len - pos < sizeof(struct pref_log_rec_s) || rec->keylen == 0 || rec->len < 0 || PREF_LOG_REC_SIZE(rec->keylen, rec->len) > len - pos) {
+			/* The batch is checked as a whole, so this is not a torn write */
+			prefdbg("Invalid record in batch at %d\n", (int)offset);
+			return PREFERENCE_INVALID_DATA;
+		}
+		ret = pref_log_apply(ns, (const char *)(rec + 1), rec->keylen, rec->type, rec->len, offset + pos);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+	return OK;
+}
+
+/* Read the records of a log into the index, up to the first invalid one */
+static int pref_log_scan(struct pref_log_ns_s *ns, int fd, bool *torn)
+{
+	struct pref_log_rec_s rec;
+	uint8_t buf[32];
+	uint8_t *batch;
+	uint32_t crc;
+	char *key;
+	int chunk;
+	int left;
+	int ret;
+
+	*torn = false;
+	key = NULL;
+	while (1) {
+		ret = read(fd, &rec, sizeof(rec));
+		if (ret == 0) {
+			break;
+		}
+		if (ret != sizeof(rec) || rec.magic != PREF_LOG_MAGIC || (rec.keylen == 0 && rec.type != PREF_LOG_BATCH) || rec.len < 0) {
+			*torn = true;
+			break;
+		}
+
+		if (rec.type == PREF_LOG_BATCH) {
+			/* A batch counts only if all of its records made it to the log */
+			batch = (uint8_t *)PREFERENCE_ALLOC(rec.len);
+			if (batch == NULL) {
+				return PREFERENCE_OUT_OF_MEMORY;
+			}
+			crc = crc32((FAR const uint8_t *)&rec.magic, sizeof(rec) - sizeof(uint32_t));
+			if (read(fd, batch, rec.len) != rec.len || crc32part(batch, rec.len, crc) != rec.crc) {
+				PREFERENCE_FREE(batch);
+				*torn = true;
+				break;
+			}
+			ret = pref_log_scan_batch(ns, batch, rec.len, ns->size + sizeof(rec));
+			PREFERENCE_FREE(batch);
+			if (ret < 0) {
+				return ret;
+			}
+			ns->garbage += sizeof(rec);
+			ns->size += PREF_LOG_REC_SIZE(0, rec.len);
+			continue;
+		}
+
+		key = (char *)PREFERENCE_ALLOC(rec.keylen);
+		if (key == NULL) {
+			return PREFERENCE_OUT_OF_MEMORY;
+		}
+		if (read(fd, key, rec.keylen) != rec.keylen) {
+			*torn = true;
+			break;
+		}
+		crc = crc32((FAR const uint8_t *)&rec.magic, sizeof(rec) - sizeof(uint32_t));
+		crc = crc32part((FAR const uint8_t *)key, rec.keylen, crc);
+
+		/* The value is checked, not kept, it is read again by a get */
+		for (left = rec.len; left > 0; left -= chunk) {
+			chunk = left < sizeof(buf) ? left : sizeof(buf);
+			if (read(fd, buf, chunk) != chunk) {
+				break;
+			}
+			crc = crc32part(buf, chunk, crc);
+		}
+		if (left > 0 || crc != rec.crc) {
+			*torn = true;
+			break;
+		}
+
+		ret = pref_log_apply(ns, key, rec.keylen, rec.type, rec.len, ns->size);
+		PREFERENCE_FREE(key);
+		key = NULL;
+		if (ret < 0) {
+			return ret;
+		}
+		ns->size += PREF_LOG_REC_SIZE(rec.keylen, rec.len);
+	}
+	PREFERENCE_FREE(key);
+
+	return OK;
+}
+
+/* Find the namespace of a log, scanning the log the first time */
+static int pref_log_load(char *path, struct pref_log_ns_s **result)
+{
+	struct pref_log_ns_s *ns;
+	char *tmp;
+	bool torn;
+	int errval;
+	int fd;
+	int ret;
+
+	for (ns = (struct pref_log_ns_s *)sq_peek(&g_pref_log_ns); ns != NULL; ns = (struct pref_log_ns_s *)sq_next(ns)) {
+		if (!strcmp(ns->path, path)) {
+			PREFERENCE_FREE(path);
+			*result = ns;
+			return OK;
+		}
+	}
+
+	ns = (struct pref_log_ns_s *)PREFERENCE_ALLOC(sizeof(struct pref_log_ns_s));
+	if (ns == NULL) {
+		PREFERENCE_FREE(path);
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	memset(ns, 0, sizeof(struct pref_log_ns_s));
+	ns->path = path;
+	sq_addlast((FAR sq_entry_t *)ns, &g_pref_log_ns);
+
+	tmp = pref_log_tmp_path(ns);
+	if (tmp == NULL) {
+		pref_log_release(ns);
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	fd = open(ns->path, O_RDONLY);
+	errval = (fd < 0) ? errno : OK;
+	if (errval == ENOENT && rename(tmp, ns->path) == OK) {
+		/* A compaction removed the log and stopped before renaming the new one */
+		fd = open(ns->path, O_RDONLY);
+		errval = (fd < 0) ? errno : OK;
+	} else if (fd >= 0) {
+		/* A compaction stopped before removing the log, the new one is partial */
+		unlink(tmp);
+	}
+	PREFERENCE_FREE(tmp);
+
+	if (fd < 0) {
+		if (errval != ENOENT) {
+			prefdbg("Failed to open %s, errno %d\n", ns->path, errval);
+			pref_log_release(ns);
+			return PREFERENCE_IO_ERROR;
+		}
+		*result = ns;
+		return OK;
+	}
+
+	ret = pref_log_scan(ns, fd, &torn);
+	close(fd);
+	if (ret < 0) {
+		pref_log_release(ns);
+		return ret;
+	}
+	prefvdbg("Loaded %s : %d bytes, %d bytes of garbage\n", ns->path, (int)ns->size, (int)ns->garbage);
+
+	/* Records are appended at the end of the file, not after the last valid
+	 * one, so a torn tail is dropped before anything is added.
+	 */
+	if (torn) {
+		prefdbg("Dropped torn records at %d of %s\n", (int)ns->size, ns->path);
+		ret = pref_log_compact(ns);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	*result = ns;
+	return OK;
+}
+
+/* Get the log of the namespace of a key and the name of the key in it.
+ * Private keys of an application share one log, shared keys one per
+ * directory.
+ */
+static int pref_log_get_ns(int type, const char *key, struct pref_log_ns_s **ns, const char **name)
+{
+	const char *slash;
+	char *path;
+	int ret;
+#if CONFIG_TASK_NAME_SIZE > 0
+	struct tcb_s *tcb;
+#endif
+
+	if (type == PRIVATE_PREFERENCE) {
+#if CONFIG_TASK_NAME_SIZE > 0
+		tcb = this_task();
+		if (!tcb->group) {
+			prefdbg("Failed to get group\n");
+			return PREFERENCE_OPERATION_FAIL;
+		}
+		ret = PREFERENCE_ASPRINTF(&path, "%s/%s/%s", PREF_PRIVATE_PATH, tcb->group->tg_name, PREF_LOG_NAME);
+		*name = key;
+#else
+		prefdbg("Not supported private preference\n");
+		return PREFERENCE_NOT_SUPPORTED;
+#endif
+	} else {
+		slash = strrchr(key, '/');
+		if (slash != NULL) {
+			ret = PREFERENCE_ASPRINTF(&path, "%s/%.*s/%s", PREF_SHARED_PATH, (int)(slash - key), key, PREF_LOG_NAME);
+			*name = slash + 1;
+		} else {
+			ret = PREFERENCE_ASPRINTF(&path, "%s/%s", PREF_SHARED_PATH, PREF_LOG_NAME);
+			*name = key;
+		}
+	}
+	if (ret < 0) {
+		prefdbg("Failed to allocate path\n");
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	if (**name == '\0' || strlen(*name) > UINT16_MAX) {
+		PREFERENCE_FREE(path);
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	return pref_log_load(path, ns);
+}
+
+/* Make the directories of a log, the first time a key is set in it */
+static int pref_log_mkdirs(char *path)
+{
+	char *ptr;
+	int ret;
+
+	for (ptr = path + strlen(PREF_PATH) + 1; *ptr != '\0'; ptr++) {
+		if (*ptr != '/') {
+			continue;
+		}
+		*ptr = '\0';
+		ret = mkdir(path, 0777);
+		*ptr = '/';
+		if (ret < 0 && errno != EEXIST) {
+			prefdbg("mkdir fail, %d\n", errno);
+			return PREFERENCE_IO_ERROR;
+		}
+	}
+	return OK;
+}
+
+/* Fill a record at buf, returning its size */
+static size_t pref_log_put_rec(uint8_t *buf, const char *key, uint16_t keylen, int type, const void *value, int len)
+{
+	struct pref_log_rec_s *rec = (struct pref_log_rec_s *)buf;
+	size_t size;
+
+	size = PREF_LOG_REC_SIZE(keylen, len);
+	rec->magic = PREF_LOG_MAGIC;
+	rec->keylen = keylen;
+	rec->type = type;
+	rec->len = len;
+	memcpy(rec + 1, key, keylen);
+	if (len > 0) {
+		memcpy((uint8_t *)(rec + 1) + keylen, value, len);
+	}
+	rec->crc = crc32((FAR const uint8_t *)&rec->magic, size - sizeof(uint32_t));
+
+	return size;
+}
+
+/* Append records to the log in one write */
+static int pref_log_write(struct pref_log_ns_s *ns, const void *buf, size_t size)
+{
+	int fd;
+	int ret;
+
+	fd = open(ns->path, O_WRONLY | O_CREAT | O_APPEND, 0666);
+	if (fd < 0 && errno == ENOENT && pref_log_mkdirs(ns->path) == OK) {
+		fd = open(ns->path, O_WRONLY | O_CREAT | O_APPEND, 0666);
+	}
+	if (fd < 0) {
+		prefdbg("open fail %d\n", errno);
+		return PREFERENCE_IO_ERROR;
+	}
+	ret = write(fd, buf, size);
+	close(fd);
+
+	if (ret != size) {
+		/* The partial record is dropped by the next scan */
+		prefdbg("Failed to write %s, errno %d\n", ns->path, errno);
+		pref_log_release(ns);
+		return PREFERENCE_IO_ERROR;
+	}
+	return OK;
+}
+
+static void pref_log_grown(struct pref_log_ns_s *ns, size_t size)
+{
+	ns->size += size;
+	if (ns->size >= CONFIG_PREFERENCE_LOG_COMPACT_SIZE && ns->garbage > ns->size - ns->garbage) {
+		/* The records are in the log already, a failed compaction loses nothing */
+		(void)pref_log_compact(ns);
+	}
+}
+
+static int pref_log_append(struct pref_log_ns_s *ns, const char *key, int type, const void *value, int len)
+{
+	uint8_t *buf;
+	uint16_t keylen;
+	size_t size;
+	int ret;
+
+	keylen = strlen(key);
+	buf = (uint8_t *)PREFERENCE_ALLOC(PREF_LOG_REC_SIZE(keylen, len));
+	if (buf == NULL) {
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	size = pref_log_put_rec(buf, key, keylen, type, value, len);
+	ret = pref_log_write(ns, buf, size);
+	PREFERENCE_FREE(buf);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = pref_log_apply(ns, key, keylen, type, len, ns->size);
+	if (ret < 0) {
+		pref_log_release(ns);
+		return ret;
+	}
+	pref_log_grown(ns, size);
+
+	return OK;
+}
+
+/* Append the keys of data whose namespace is ns as one batch, which a scan
+ * applies whole or not at all.
+ */
+static int pref_log_append_batch(struct pref_log_ns_s *ns, preference_data_t *data, struct pref_log_ns_s **nss, const char **names, int count)
+{
+	struct pref_log_rec_s *batch;
+	uint8_t *buf;
+	size_t size;
+	size_t pos;
+	int ret;
+	int i;
+
+	size = sizeof(struct pref_log_rec_s);
+	for (i = 0; i < count; i++) {
+		if (nss[i] == ns) {
+			size += PREF_LOG_REC_SIZE(strlen(names[i]), data[i].attr.len);
+		}
+	}
+	buf = (uint8_t *)PREFERENCE_ALLOC(size);
+	if (buf == NULL) {
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+
+	pos = sizeof(struct pref_log_rec_s);
+	for (i = 0; i < count; i++) {
+		if (nss[i] == ns) {
+			pos += pref_log_put_rec(buf + pos, names[i], strlen(names[i]), data[i].attr.type, data[i].value, data[i].attr.len);
+		}
+	}
+	batch = (struct pref_log_rec_s *)buf;
+	batch->magic = PREF_LOG_MAGIC;
+	batch->keylen = 0;
+	batch->type = PREF_LOG_BATCH;
+	batch->len = size - sizeof(struct pref_log_rec_s);
+	batch->crc = crc32((FAR const uint8_t *)&batch->magic, size - sizeof(uint32_t));
+
+	ret = pref_log_write(ns, buf, size);
+	if (ret == OK) {
+		ret = pref_log_scan_batch(ns, buf + sizeof(struct pref_log_rec_s), batch->len, ns->size + sizeof(struct pref_log_rec_s));
+		if (ret < 0) {
+			pref_log_release(ns);
+		}
+	}
+	PREFERENCE_FREE(buf);
+	if (ret < 0) {
+		return ret;
+	}
+	ns->garbage += sizeof(struct pref_log_rec_s);
+	pref_log_grown(ns, size);
+
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+int preference_write_key(preference_data_t *data)
+{
+	struct pref_log_ns_s *ns;
+	const char *name;
+	uint32_t crc_value;
+	int ret;
+
+	if (data == NULL || data->key == NULL || (data->type != PRIVATE_PREFERENCE && data->type != SHARED_PREFERENCE) || data->attr.type < 0 || data->attr.len < 0) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	/* Checksum of the value as the file of a key holds it */
+	crc_value = crc32((uint8_t *)&data->attr.type, sizeof(value_attr_t) - sizeof(uint32_t));
+	data->attr.crc = crc32part((uint8_t *)data->value, data->attr.len, crc_value);
+
+	/* Keys set in a transaction are written on its commit */
+	if (preference_in_transaction()) {
+		return preference_add_transaction(data);
+	}
+
+	pref_log_lock();
+	ret = pref_log_get_ns(data->type, data->key, &ns, &name);
+	if (ret == OK) {
+		ret = pref_log_append(ns, name, data->attr.type, data->value, data->attr.len);
+	}
+	pref_log_unlock();
+
+	if (ret == OK) {
+		prefvdbg("Write Key Success : %s, len = %d\n", data->key, data->attr.len);
+#if !defined(CONFIG_DISABLE_MQUEUE) && !defined(CONFIG_DISABLE_SIGNAL)
+		/* Execute callback if registered cb is existing */
+		preference_send_cb_msg(data->type, data->key);
+#endif
+	}
+
+	return ret;
+}
+
+/* Write the keys of a transaction with one batch per namespace. A batch is
+ * kept whole or dropped whole, the batches of different namespaces are not
+ * atomic together.
+ */
+int preference_write_keys(preference_data_t *data, int count)
+{
+	struct pref_log_ns_s **nss;
+	const char **names;
+	uint32_t crc_value;
+	int ret;
+	int i;
+	int j;
+
+	nss = (struct pref_log_ns_s **)PREFERENCE_ALLOC((sizeof(struct pref_log_ns_s *) + sizeof(const char *)) * count);
+	if (nss == NULL) {
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	names = (const char **)(nss + count);
+
+	for (i = 0; i < count; i++) {
+		crc_value = crc32((uint8_t *)&data[i].attr.type, sizeof(value_attr_t) - sizeof(uint32_t));
+		data[i].attr.crc = crc32part((uint8_t *)data[i].value, data[i].attr.len, crc_value);
+	}
+
+	pref_log_lock();
+	for (i = 0; i < count; i++) {
+		ret = pref_log_get_ns(data[i].type, data[i].key, &nss[i], &names[i]);
+		if (ret < 0) {
+			prefdbg("Failed to get log of %s, %d\n", data[i].key, ret);
+			goto errout;
+		}
+	}
+	for (i = 0; i < count; i++) {
+		for (j = 0; j < i && nss[j] != nss[i]; j++);
+		if (j < i) {
+			/* Written with the batch of an earlier key */
+			continue;
+		}
+		ret = pref_log_append_batch(nss[i], data, nss, names, count);
+		if (ret < 0) {
+			prefdbg("Failed to write batch of %s, %d\n", data[i].key, ret);
+			goto errout;
+		}
+	}
+	ret = OK;
+errout:
+	pref_log_unlock();
+	PREFERENCE_FREE(nss);
+
+	return ret;
+}
+
+int preference_read_key(preference_data_t *data)
+{
+	struct pref_log_ns_s *ns;
+	struct pref_log_key_s *entry;
+	struct pref_log_rec_s *rec;
+	const char *name;
+	size_t size;
+	uint32_t crc;
+	int fd;
+	int ret;
+
+	if (data == NULL || data->key == NULL || (data->type != PRIVATE_PREFERENCE && data->type != SHARED_PREFERENCE)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	pref_log_lock();
+	ret = pref_log_get_ns(data->type, data->key, &ns, &name);
+	if (ret < 0) {
+		goto errout;
+	}
+
+	entry = pref_log_find(ns, name, strlen(name));
+	if (entry == NULL) {
+		ret = PREFERENCE_KEY_NOT_EXIST;
+		goto errout;
+	}
+	if (entry->type != data->attr.type) {
+		prefdbg("Invalid type. request type:%d, read type:%d\n", data->attr.type, entry->type);
+		ret = PREFERENCE_INVALID_PARAMETER;
+		goto errout;
+	}
+
+	/* The whole record is read to check it again, flash may have changed */
+	size = PREF_LOG_REC_SIZE(entry->keylen, entry->len);
+	rec = (struct pref_log_rec_s *)PREFERENCE_ALLOC(size);
+	if (rec == NULL) {
+		ret = PREFERENCE_OUT_OF_MEMORY;
+		goto errout;
+	}
+	fd = open(ns->path, O_RDONLY);
+	if (fd < 0) {
+		prefdbg("Failed to open %s, errno %d\n", ns->path, errno);
+		ret = PREFERENCE_IO_ERROR;
+		goto errout_with_rec;
+	}
+	ret = (lseek(fd, entry->offset, SEEK_SET) == entry->offset) ? read(fd, rec, size) : -1;
+	close(fd);
+	if (ret != size) {
+		prefdbg("Failed to read key value, errno %d\n", errno);
+		ret = PREFERENCE_IO_ERROR;
+		goto errout_with_rec;
+	}
+	crc = crc32((FAR const uint8_t *)&rec->magic, size - sizeof(uint32_t));
+	if (crc != rec->crc) {
+		prefdbg("Invalid checksum, read crc : %u, calculated crc : %u\n", rec->crc, crc);
+		ret = PREFERENCE_INVALID_DATA;
+		goto errout_with_rec;
+	}
+
+	data->value = PREFERENCE_ALLOC(entry->len);
+	if (data->value == NULL) {
+		ret = PREFERENCE_OUT_OF_MEMORY;
+		goto errout_with_rec;
+	}
+	memcpy(data->value, (uint8_t *)(rec + 1) + entry->keylen, entry->len);
+	data->attr.len = entry->len;
+	PREFERENCE_FREE(rec);
+	pref_log_unlock();
+
+	prefvdbg("Read key Success!\n");
+	return OK;
+errout_with_rec:
+	PREFERENCE_FREE(rec);
+errout:
+	pref_log_unlock();
+
+	return ret;
+}
+
+int preference_remove_key(int type, const char *key)
+{
+	struct pref_log_ns_s *ns;
+	const char *name;
+	int ret;
+
+	if (key == NULL || (type != PRIVATE_PREFERENCE && type != SHARED_PREFERENCE)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	pref_log_lock();
+	ret = pref_log_get_ns(type, key, &ns, &name);
+	if (ret == OK) {
+		if (pref_log_find(ns, name, strlen(name)) == NULL) {
+			prefdbg("key is not exist : %s\n", key);
+			ret = PREFERENCE_KEY_NOT_EXIST;
+		} else {
+			ret = pref_log_append(ns, name, PREF_LOG_REMOVED, NULL, 0);
+		}
+	}
+	pref_log_unlock();
+
+	return ret;
+}
+
+int preference_remove_all_key(int type, const char *path)
+{
+	struct pref_log_ns_s *ns;
+	char *log_path;
+	int ret;
+#if CONFIG_TASK_NAME_SIZE > 0
+	struct tcb_s *tcb;
+#endif
+
+	if ((type != PRIVATE_PREFERENCE && type != SHARED_PREFERENCE) || (type == SHARED_PREFERENCE && path == NULL)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	if (type == PRIVATE_PREFERENCE) {
+#if CONFIG_TASK_NAME_SIZE > 0
+		tcb = this_task();
+		if (!tcb->group) {
+			prefdbg("Failed to get group\n");
+			return PREFERENCE_OPERATION_FAIL;
+		}
+		ret = PREFERENCE_ASPRINTF(&log_path, "%s/%s/%s", PREF_PRIVATE_PATH, tcb->group->tg_name, PREF_LOG_NAME);
+#else
+		prefdbg("Not supported private preference\n");
+		return PREFERENCE_NOT_SUPPORTED;
+#endif
+	} else {
+		ret = PREFERENCE_ASPRINTF(&log_path, "%s/%s/%s", PREF_SHARED_PATH, path, PREF_LOG_NAME);
+	}
+	if (ret < 0) {
+		prefdbg("Failed to allocate path\n");
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+
+	/* All the keys go at once with the log */
+	pref_log_lock();
+	ret = pref_log_load(log_path, &ns);
+	if (ret == OK) {
+		if (unlink(ns->path) < 0) {
+			ret = (errno == ENOENT) ? PREFERENCE_PATH_NOT_FOUND : PREFERENCE_IO_ERROR;
+			prefdbg("Failed to remove %s, %d\n", ns->path, errno);
+		}
+		pref_log_release(ns);
+	}
+	pref_log_unlock();
+
+	return ret;
+}
+
+int preference_check_key(int type, const char *key, bool *result)
+{
+	struct pref_log_ns_s *ns;
+	const char *name;
+	int ret;
+
+	if (key == NULL || result == NULL || (type != PRIVATE_PREFERENCE && type != SHARED_PREFERENCE)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	pref_log_lock();
+	ret = pref_log_get_ns(type, key, &ns, &name);
+	if (ret == OK) {
+		*result = (pref_log_find(ns, name, strlen(name)) != NULL);
+	}
+	pref_log_unlock();
+
+	return ret;
+}
@@ -0,0 +1,233 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sys/types.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <debug.h>
+#include <queue.h>
+#include <semaphore.h>
+#include <tinyara/preference.h>
+
+#include "preference.h"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Keys set by a thread between preference_begin() and preference_commit() */
+struct pref_trans_s {
+	struct pref_trans_s *flink;
+	pid_t pid;
+	int count;
+	sq_queue_t keys;			/* node type : struct pref_trans_key_s */
+};
+
+struct pref_trans_key_s {
+	struct pref_trans_key_s *flink;
+	preference_data_t data;		/* value and key follow the node */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static sq_queue_t g_pref_trans;	/* node type : struct pref_trans_s */
+static sem_t g_pref_trans_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static struct pref_trans_s *preference_get_transaction(pid_t pid, bool remove)
+{
+	struct pref_trans_s *trans;
+
+	while (sem_wait(&g_pref_trans_sem) < 0);
+	trans = (struct pref_trans_s *)sq_peek(&g_pref_trans);
+	while (trans != NULL && trans->pid != pid) {
+		trans = (struct pref_trans_s *)sq_next(trans);
+	}
+	if (trans != NULL && remove) {
+		sq_rem((FAR sq_entry_t *)trans, &g_pref_trans);
+	}
+	sem_post(&g_pref_trans_sem);
+
+	return trans;
+}
+
+static void preference_free_transaction(struct pref_trans_s *trans)
+{
+	struct pref_trans_key_s *node;
+
+	while ((node = (struct pref_trans_key_s *)sq_remfirst(&trans->keys)) != NULL) {
+		PREFERENCE_FREE(node);
+	}
+	PREFERENCE_FREE(trans);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+int preference_begin_transaction(void)
+{
+	struct pref_trans_s *trans;
+
+	if (preference_get_transaction(getpid(), false) != NULL) {
+		prefdbg("Transaction already begun\n");
+		return PREFERENCE_OPERATION_FAIL;
+	}
+
+	trans = (struct pref_trans_s *)PREFERENCE_ALLOC(sizeof(struct pref_trans_s));
+	if (trans == NULL) {
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	trans->pid = getpid();
+	trans->count = 0;
+	sq_init(&trans->keys);
+
+	while (sem_wait(&g_pref_trans_sem) < 0);
+	sq_addlast((FAR sq_entry_t *)trans, &g_pref_trans);
+	sem_post(&g_pref_trans_sem);
+
+	return OK;
+}
+
+bool preference_in_transaction(void)
+{
+	return preference_get_transaction(getpid(), false) != NULL;
+}
+
+/* Keep a copy of a key set in the transaction of the caller. A key set
+ * again replaces its previous value, so it is written and notified once.
+ */
+int preference_add_transaction(preference_data_t *data)
+{
+	struct pref_trans_s *trans;
+	struct pref_trans_key_s *node;
+	struct pref_trans_key_s *prev;
+	int keylen;
+
+	if (data == NULL || data->key == NULL || (data->type != PRIVATE_PREFERENCE && data->type != SHARED_PREFERENCE) || data->attr.len < 0) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	trans = preference_get_transaction(getpid(), false);
+	if (trans == NULL) {
+		return PREFERENCE_OPERATION_FAIL;
+	}
+
+	/* The key and the value follow the node in one allocation */
+	keylen = strlen(data->key) + 1;
+	node = (struct pref_trans_key_s *)PREFERENCE_ALLOC(sizeof(struct pref_trans_key_s) + data->attr.len + keylen);
+	if (node == NULL) {
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	node->data.type = data->type;
+	node->data.attr = data->attr;
+	node->data.value = node + 1;
+	memcpy(node->data.value, data->value, data->attr.len);
+	node->data.key = (const char *)node->data.value + data->attr.len;
+	memcpy((char *)node->data.key, data->key, keylen);
+
+	prev = (struct pref_trans_key_s *)sq_peek(&trans->keys);
+	while (prev != NULL && (prev->data.type != data->type || strcmp(prev->data.key, data->key))) {
+		prev = (struct pref_trans_key_s *)sq_next(prev);
+	}
+	if (prev != NULL) {
+		sq_rem((FAR sq_entry_t *)prev, &trans->keys);
+		PREFERENCE_FREE(prev);
+		trans->count--;
+	}
+	sq_addlast((FAR sq_entry_t *)node, &trans->keys);
+	trans->count++;
+
+	return OK;
+}
+
+/* Write the keys of the transaction of the caller together, then notify
+ * the callbacks of all of them at once.
+ */
+int preference_commit_transaction(void)
+{
+	struct pref_trans_s *trans;
+	struct pref_trans_key_s *node;
+	preference_data_t *data;
+	int ret;
+	int i;
+
+	trans = preference_get_transaction(getpid(), true);
+	if (trans == NULL) {
+		prefdbg("No transaction begun\n");
+		return PREFERENCE_OPERATION_FAIL;
+	}
+	if (trans->count == 0) {
+		preference_free_transaction(trans);
+		return OK;
+	}
+
+	data = (preference_data_t *)PREFERENCE_ALLOC(sizeof(preference_data_t) * trans->count);
+	if (data == NULL) {
+		preference_free_transaction(trans);
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	i = 0;
+	for (node = (struct pref_trans_key_s *)sq_peek(&trans->keys); node != NULL; node = (struct pref_trans_key_s *)sq_next(node)) {
+		data[i++] = node->data;
+	}
+
+	ret = preference_write_keys(data, trans->count);
+#if !defined(CONFIG_DISABLE_MQUEUE) && !defined(CONFIG_DISABLE_SIGNAL)
+	if (ret == OK) {
+		preference_send_cb_msgs(data, trans->count);
+	}
+#endif
+	prefvdbg("Committed %d keys, ret %d\n", trans->count, ret);
+
+	PREFERENCE_FREE(data);
+	preference_free_transaction(trans);
+
+	return ret;
+}
+
+int preference_discard_transaction(void)
+{
+	struct pref_trans_s *trans;
+
+	trans = preference_get_transaction(getpid(), true);
+	if (trans == NULL) {
+		prefdbg("No transaction begun\n");
+		return PREFERENCE_OPERATION_FAIL;
+	}
+	preference_free_transaction(trans);
+
+	return OK;
+}
+
+void preference_clear_transaction(pid_t pid)
+{
+	struct pref_trans_s *trans;
+
+	trans = preference_get_transaction(pid, true);
+	if (trans != NULL) {
+		preference_free_transaction(trans);
+	}
+}
@@ -33,6 +33,7 @@
 
 #include "sched/sched.h"
 #endif
+#include "preference.h"
 
 /****************************************************************************
  * Private Functions
@@ -150,19 +151,11 @@ errout_with_close:
 	return PREFERENCE_IO_ERROR;
 }
 
-/****************************************************************************
- * Public Functions
- ****************************************************************************/
-int preference_write_key(preference_data_t *data)
+static int preference_write_one(preference_data_t *data)
 {
 	int ret;
 	char *path;
 
-	if (data == NULL || data->key == NULL || (data->type != PRIVATE_PREFERENCE && data->type != SHARED_PREFERENCE)) {
-		prefdbg("Invalid parameter\n");
-		return PREFERENCE_INVALID_PARAMETER;
-	}
-
 	if (data->type == PRIVATE_PREFERENCE) {
 #if CONFIG_TASK_NAME_SIZE > 0
 		ret = preference_private_setup();
@@ -193,7 +186,27 @@ int preference_write_key(preference_data_t *data)
 	}
 	prefvdbg("Preference key path = %s\n", path);
 
-	ret = preference_write_fs_key(path, data);
+	return preference_write_fs_key(path, data);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+int preference_write_key(preference_data_t *data)
+{
+	int ret;
+
+	if (data == NULL || data->key == NULL || (data->type != PRIVATE_PREFERENCE && data->type != SHARED_PREFERENCE)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	/* Keys set in a transaction are written on its commit */
+	if (preference_in_transaction()) {
+		return preference_add_transaction(data);
+	}
+
+	ret = preference_write_one(data);
 #if !defined(CONFIG_DISABLE_MQUEUE) && !defined(CONFIG_DISABLE_SIGNAL)
 	if (ret == OK) {
 		/* Execute callback if registered cb is existing */
@@ -203,3 +216,22 @@ int preference_write_key(preference_data_t *data)
 
 	return ret;
 }
+
+/* Each key is a file of its own here, so the keys are written one by one and
+ * the first failure stops the others.
+ */
+int preference_write_keys(preference_data_t *data, int count)
+{
+	int ret;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		ret = preference_write_one(&data[i]);
+		if (ret < 0) {
+			prefdbg("Failed to write %s, %d\n", data[i].key, ret);
+			return ret;
+		}
+	}
+
+	return OK;
+}
@@ -66,11 +66,24 @@
 #include <sched.h>
 
 #include <tinyara/compiler.h>
+#include <tinyara/pthread.h>
 
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* True if the thread 'me' holds the mutex.  The holder of a mutex locked
+ * by the user-space fast path is not known, so such a mutex only needs to
+ * be locked.
+ */
+
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+#define pthread_mutex_isheld(m, me) \
+	((m)->pid == (me) || (pthread_mutex_isfast(m) && (m)->sem.semcount < 1))
+#else
+#define pthread_mutex_isheld(m, me) ((m)->pid == (me))
+#endif
+
 /****************************************************************************
  * Public Type Declarations
  ****************************************************************************/
@@ -220,7 +220,7 @@ int pthread_cond_timedwait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex,
 
 	/* Make sure that the caller holds the mutex */
 
-	else if (mutex->pid != mypid) {
+	else if (!pthread_mutex_isheld(mutex, mypid)) {
 		ret = EPERM;
 	}
 
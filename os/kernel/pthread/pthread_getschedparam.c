@@ -102,10 +102,11 @@
  *   thread. It will not reflect any temporary adjustments to its priority
  *   (such as might result of any priority inheritance, for example).
  *
- *   The policy parameter may have the value SCHED_FIFO, or SCHED_RR
- *   (SCHED_OTHER and SCHED_SPORADIC, in particular, are not supported).
- *   The SCHED_FIFO and SCHED_RR policies will have a single scheduling
- *   parameter, sched_priority.
+ *   The policy parameter may have the value SCHED_FIFO, SCHED_RR, or
+ *   SCHED_SPORADIC with CONFIG_SCHED_SPORADIC (SCHED_OTHER is not
+ *   supported).  The SCHED_FIFO and SCHED_RR policies will have a single
+ *   scheduling parameter, sched_priority.  SCHED_SPORADIC also has the
+ *   sched_ss_* parameters.
 *
  * Parameters:
  *   thread - The ID of thread whose scheduling parameters will be queried.
@@ -92,6 +92,14 @@ static void pthread_mutex_add(FAR struct pthread_mutex_s *mutex)
 
 	DEBUGASSERT(mutex->flink == NULL);
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+	/* A mutex that user space may lock on its own is never on the list */
+
+	if (pthread_mutex_isfast(mutex)) {
+		return;
+	}
+#endif
+
 	/* Add the mutex to the list of mutexes held by this task */
 
 	flags = enter_critical_section();
@@ -247,6 +255,14 @@ int pthread_mutex_give(FAR struct pthread_mutex_s *mutex)
 		FAR struct pthread_tcb_s *rtcb = (FAR struct pthread_tcb_s *)this_task();
 		irqstate_t flags;
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		/* See pthread_mutex_add() */
+
+		if (pthread_mutex_isfast(mutex)) {
+			return pthread_sem_give(&mutex->sem);
+		}
+#endif
+
 		flags = enter_critical_section();
 
 		/* Remove the mutex from the list of mutexes held by this task */
@@ -85,6 +85,61 @@
 #error "Max number of tasks(CONFIG_MAX_TASKS) should be power of 2"
 #endif
 
+/* CONFIG_SCHED_READYTORUN_INDEX keeps the tail of each priority of the
+ * g_readytorun list and a bitmap of the non-empty priorities, so that a task
+ * is made ready in constant time instead of walking the list.  The list
+ * itself is unchanged: its head is still the running task.  It costs one
+ * pointer per priority level.
+ */
+
+#if defined(CONFIG_SCHED_READYTORUN_INDEX) && defined(CONFIG_SMP)
+#error "CONFIG_SCHED_READYTORUN_INDEX is not supported with CONFIG_SMP"
+#endif
+
+/* CONFIG_SCHED_LATENCY records, per thread, the time from leaving a blocked
+ * state to being switched in, in a log2 histogram read from /proc/latency.
+ * The sample is taken by the architecture from its context switch path with
+ * sched_latency_resume(): the ARM ports do it in up_restoretask().  Time is
+ * read with up_timer_gettime() on tickless builds, otherwise it is only as
+ * fine as the system tick.
+ */
+
+/* CONFIG_SCHED_HOLDTIME profiles the critical sections and the scheduler
+ * locks of the tasks, from the outermost enter_critical_section() or
+ * sched_lock() to the matching leave.  The holds are counted per call site
+ * in a table of CONFIG_SCHED_HOLDTIME_NSITES entries which keeps the sites
+ * of the longest holds, read from /proc/holdtime.  Time is read with
+ * up_perf_gettime().  The critical sections need CONFIG_IRQCOUNT, without
+ * which enter_critical_section() is irqsave().  A task which blocks gives
+ * up its holds, as the other tasks run meanwhile.
+ */
+
+/* CONFIG_SCHED_CPULOAD_CYCLES charges the exact CPU time to threads and
+ * interrupts by reading the cycle counter of up_perf_gettime() at each
+ * context switch and around each interrupt handler.  It is read with
+ * CPULOADIOC_GETCYCLES of the cpuload driver.  The counter of most cores
+ * stops in WFI, so the shares are of the time the CPU was not asleep.
+ * CONFIG_SCHED_CPULOAD_CYCLES_FREQ gives the counter frequency to
+ * up_perf_init(), or 0 to let the architecture find it.
+ */
+
+#if defined(CONFIG_SCHED_CPULOAD_CYCLES) && !defined(CONFIG_SCHED_CPULOAD)
+#error "CONFIG_SCHED_CPULOAD_CYCLES requires CONFIG_SCHED_CPULOAD"
+#endif
+
+/* CONFIG_SCHED_SPORADIC adds the SCHED_SPORADIC policy: a thread runs at
+ * its priority for sched_ss_init_budget of CPU time in each
+ * sched_ss_repl_period and at sched_ss_low_priority for the rest of the
+ * period.  The budget is charged by the system timer, so it is as fine as
+ * the tick, and given back in full at the start of each period.
+ */
+
+/* CONFIG_LIB_SYSCALL_VDSO copies the PID and the time into the vDSO page of
+ * the binary of the running thread, see include/tinyara/vdso.h.  The ARM
+ * ports call sched_vdso_update() from up_restoretask(), and clock_timer()
+ * for the thread the tick interrupted.
+ */
+
 /* These are macros to access the current CPU and the current task on a CPU.
  * These macros are intended to support a future SMP implementation.
  */
@@ -138,7 +193,9 @@ struct pidhash_s {
 	pid_t pid;					/* The full PID value */
 #ifdef CONFIG_SCHED_CPULOAD
 	uint32_t ticks[CONFIG_SMP_NCPUS][SCHED_NCPULOAD];     /* Number of ticks of thread in specific cpu */
-
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	uint64_t cycles[CONFIG_SMP_NCPUS];	/* Cycles run by the thread on each cpu */
+#endif
 #endif
 };
 
@@ -369,6 +426,14 @@ int sched_reprioritize(FAR struct tcb_s *tcb, int sched_priority);
 		sched_setpriority(tcb, sched_priority)
 #endif
 
+#ifdef CONFIG_SCHED_SPORADIC
+int  sched_sporadic_start(FAR struct tcb_s *tcb, FAR const struct sched_param *param);
+void sched_sporadic_stop(FAR struct tcb_s *tcb);
+int  sched_sporadic_reprioritize(FAR struct tcb_s *tcb, int priority);
+void sched_sporadic_getparam(FAR struct tcb_s *tcb, FAR struct sched_param *param);
+unsigned int sched_process_sporadic(FAR struct tcb_s *tcb, unsigned int ticks, bool noswitches);
+#endif
+
 #ifdef CONFIG_SCHED_TICKLESS
 unsigned int sched_timer_cancel(void);
 void sched_timer_resume(void);
@@ -386,6 +451,40 @@ void weak_function sched_process_cpuload(void);
 void sched_clear_cpuload(pid_t pid);
 #endif
 
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+void sched_cycles_initialize(void);
+void sched_cycles_switch(FAR struct tcb_s *tcb);
+int  sched_cycles_irqenter(int irq);
+void sched_cycles_irqleave(int prev);
+void sched_clear_cycles(pid_t pid);
+#endif
+
+#ifdef CONFIG_LIB_SYSCALL_VDSO
+void sched_vdso_update(FAR struct tcb_s *tcb);
+#else
+#  define sched_vdso_update(tcb)
+#endif
+
+#ifdef CONFIG_SCHED_LATENCY
+void sched_latency_ready(FAR struct tcb_s *tcb);
+void sched_latency_resume(FAR struct tcb_s *tcb);
+#  define sched_latency_cancel(tcb) ((tcb)->latency.waiting = false)
+#else
+#  define sched_latency_ready(tcb)
+#  define sched_latency_resume(tcb)
+#  define sched_latency_cancel(tcb)
+#endif
+
+#ifdef CONFIG_SCHED_HOLDTIME
+void sched_holdtime_enter(int type, FAR struct tcb_s *rtcb, FAR void *caller);
+void sched_holdtime_leave(int type, FAR struct tcb_s *rtcb);
+void sched_holdtime_cancel(FAR struct tcb_s *tcb);
+#else
+#  define sched_holdtime_enter(type, rtcb, caller)
+#  define sched_holdtime_leave(type, rtcb)
+#  define sched_holdtime_cancel(tcb)
+#endif
+
 #ifdef CONFIG_SMP
 FAR struct tcb_s *this_task(void);
 
@@ -401,6 +500,15 @@ int  sched_pause_cpu(FAR struct tcb_s *tcb);
 #  define sched_islocked_tcb(tcb) ((tcb)->lockcount > 0)
 #endif
 
+#ifdef CONFIG_SCHED_READYTORUN_INDEX
+FAR struct tcb_s *sched_rtrindex_prev(uint8_t sched_priority);
+void sched_rtrindex_add(FAR struct tcb_s *tcb);
+void sched_rtrindex_remove(FAR struct tcb_s *tcb, FAR dq_queue_t *list);
+#else
+#  define sched_rtrindex_add(tcb)
+#  define sched_rtrindex_remove(tcb, list)
+#endif
+
 bool sched_verifytcb(FAR struct tcb_s *tcb);
 int sched_releasetcb(FAR struct tcb_s *tcb, uint8_t ttype);
 
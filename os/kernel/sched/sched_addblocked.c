@@ -129,4 +129,14 @@ void sched_addblocked(FAR struct tcb_s *btcb, tstate_t task_state)
 	/* Make sure the TCB's state corresponds to the list */
 
 	btcb->task_state = task_state;
+
+	/* Drop the wakeup stamp of a TCB which blocks again before running */
+
+	sched_latency_cancel(btcb);
+
+	/* A task blocking in a critical section or with the scheduler locked
+	 * lets the others run: its hold ends here.
+	 */
+
+	sched_holdtime_cancel(btcb);
 }
@@ -123,11 +123,23 @@ bool sched_addprioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list)
 
 	ASSERT(sched_priority >= SCHED_PRIORITY_MIN);
 
-	/* Search the list to find the location to insert the new Tcb.
-	 * Each is list is maintained in ascending sched_priority order.
+#ifdef CONFIG_SCHED_READYTORUN_INDEX
+	/* The ready-to-run list is indexed by priority, the new tcb goes just
+	 * after the last task of equal or higher priority.
 	 */
 
-	for (next = (FAR struct tcb_s *)list->head; (next && sched_priority <= next->sched_priority); next = next->flink) ;
+	if (list == (FAR dq_queue_t *)&g_readytorun) {
+		prev = sched_rtrindex_prev(sched_priority);
+		next = prev ? prev->flink : (FAR struct tcb_s *)list->head;
+	} else
+#endif
+	{
+		/* Search the list to find the location to insert the new Tcb.
+		 * Each is list is maintained in ascending sched_priority order.
+		 */
+
+		for (next = (FAR struct tcb_s *)list->head; (next && sched_priority <= next->sched_priority); next = next->flink) ;
+	}
 
 	/* Add the tcb to the spot found in the list.  Check if the tcb
 	 * goes at the end of the list. NOTE:  This could only happen if list
@@ -176,5 +188,9 @@ bool sched_addprioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list)
 		}
 	}
 
+	if (list == (FAR dq_queue_t *)&g_readytorun) {
+		sched_rtrindex_add(tcb);
+	}
+
 	return ret;
 }
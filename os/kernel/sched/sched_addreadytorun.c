@@ -171,6 +171,7 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 	FAR dq_queue_t *tasklist;
 	bool switched;
 	bool doswitch;
+	bool pause;
 	int task_state;
 	int cpu;
 
@@ -253,10 +254,15 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 		doswitch = false;
 	} else {
 		/* (task_state == TSTATE_TASK_ASSIGNED || task_state == TSTATE_TASK_RUNNING) */
-		/* If we are modifying some assigned task list other than our own, we
-		 * will need to stop that CPU.
+		/* If we are changing the running task of another CPU, we will need
+		 * to stop that CPU.  An assigned task goes behind the running one:
+		 * the other CPU only walks its list in the critical section, which
+		 * we hold, and will find the task at its next scheduling point, so
+		 * that it is not interrupted for it.
 		 */
-		if (cpu != me) {
+
+		pause = (cpu != me && task_state == TSTATE_TASK_RUNNING);
+		if (pause) {
 			DEBUGVERIFY(up_cpu_pause(cpu));
 		}
 
@@ -355,8 +361,11 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 
 		/* All done, restart the other CPU (if it was paused). */
 
-		if (cpu != me) {
+		if (pause) {
 			DEBUGVERIFY(up_cpu_resume(cpu));
+		}
+
+		if (cpu != me) {
 			doswitch = false;
 		}
 	}
@@ -64,6 +64,9 @@
 #include <tinyara/clock.h>
 #include <tinyara/sched.h>
 #include <tinyara/kmalloc.h>
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+#include <tinyara/pm/pm.h>
+#endif
 #include <arch/irq.h>
 
 #include "sched/sched.h"
@@ -309,6 +312,12 @@ void weak_function sched_process_cpuload(void)
 		}
 	}
 
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+	/* Let the DVFS governor follow the load of this tick */
+
+	pm_dvfs_process_load();
+#endif
+
 	leave_critical_section(flags);
 }
 #endif
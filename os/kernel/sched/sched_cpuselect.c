@@ -48,7 +48,8 @@
  *
  * Description:
  *   Return the index to the CPU with the lowest priority running task,
- *   possibly its IDLE task.
+ *   possibly its IDLE task.  When several CPUs qualify, the current CPU is
+ *   preferred: placing the task there does not need to pause another CPU.
  *
  * Input Parameters:
  *   affinity - The set of CPUs on which the thread is permitted to run.
@@ -64,11 +65,15 @@
 int sched_select_cpu(cpu_set_t affinity)
 {
 	uint16_t minprio;
+	int idle_cpu;
 	int cpu;
+	int me;
 	int i;
 
 	minprio = SCHED_PRIORITY_MAX + 1;
+	idle_cpu = IMPOSSIBLE_CPU;
 	cpu = IMPOSSIBLE_CPU;
+	me = this_cpu();
 
 	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
 		/* Is the thread permitted to run on this CPU? */
@@ -86,8 +91,14 @@ int sched_select_cpu(cpu_set_t affinity)
 				 */
 
 				DEBUGASSERT(rtcb->sched_priority == 0);
-				return i;
-			} else if (rtcb->sched_priority < minprio) {
+				if (i == me) {
+					return i;
+				}
+
+				if (idle_cpu == IMPOSSIBLE_CPU) {
+					idle_cpu = i;
+				}
+			} else if (rtcb->sched_priority < minprio || (rtcb->sched_priority == minprio && i == me)) {
 				DEBUGASSERT(rtcb->sched_priority > 0);
 				minprio = rtcb->sched_priority;
 				cpu = i;
@@ -95,6 +106,10 @@ int sched_select_cpu(cpu_set_t affinity)
 		}
 	}
 
+	if (idle_cpu != IMPOSSIBLE_CPU) {
+		return idle_cpu;
+	}
+
 	DEBUGASSERT(cpu != IMPOSSIBLE_CPU);
 	return cpu;
 }
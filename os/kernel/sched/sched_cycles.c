@@ -0,0 +1,263 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/cpuload.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_SCHED_CPULOAD_CYCLES_FREQ
+#define CONFIG_SCHED_CPULOAD_CYCLES_FREQ 0
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Accounting state of one CPU.  The cycles elapsed since 'last' belong to
+ * the interrupt 'irq' if it is not -1, otherwise to the thread in the PID
+ * hash slot 'slot'.
+ */
+
+struct cpucycles_s {
+	bool started;
+	int16_t irq;
+	int16_t slot;
+	uint32_t last;
+	uint64_t total;
+	uint64_t irqtotal;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct cpucycles_s g_cpucycles[CONFIG_SMP_NCPUS];
+
+/* An interrupt line is handled by one CPU at a time, so one table is
+ * shared by all of them.
+ */
+
+static uint64_t g_irqcycles[NR_IRQS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Charge the cycles elapsed on 'cpu' to its current owner.  Interrupts are
+ * disabled.
+ */
+
+static void sched_cycles_account(int cpu)
+{
+	FAR struct cpucycles_s *cc = &g_cpucycles[cpu];
+	uint32_t now = up_perf_gettime();
+	uint32_t elapsed;
+
+	if (!cc->started) {
+		cc->started = true;
+		cc->irq = -1;
+		cc->slot = PIDHASH(current_task(cpu)->pid);
+		cc->last = now;
+		return;
+	}
+
+	elapsed = now - cc->last;
+	cc->last = now;
+	cc->total += elapsed;
+
+	if (cc->irq >= 0) {
+		g_irqcycles[cc->irq] += elapsed;
+		cc->irqtotal += elapsed;
+	} else {
+		g_pidhash[cc->slot].cycles[cpu] += elapsed;
+	}
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_cycles_initialize
+ *
+ * Description:
+ *   Start the cycle counter.  Accounting on a CPU begins with its first
+ *   context switch or interrupt.
+ *
+ ****************************************************************************/
+
+void sched_cycles_initialize(void)
+{
+	up_perf_init((FAR void *)CONFIG_SCHED_CPULOAD_CYCLES_FREQ);
+}
+
+/****************************************************************************
+ * Name: sched_cycles_switch
+ *
+ * Description:
+ *   Charge the outgoing thread (or the interrupt which switches context)
+ *   and make 'tcb' the owner of the following cycles.  Called by the
+ *   architecture when it restores the context of 'tcb'.
+ *
+ ****************************************************************************/
+
+void sched_cycles_switch(FAR struct tcb_s *tcb)
+{
+	int cpu = this_cpu();
+
+	sched_cycles_account(cpu);
+	g_cpucycles[cpu].slot = PIDHASH(tcb->pid);
+}
+
+/****************************************************************************
+ * Name: sched_cycles_irqenter / sched_cycles_irqleave
+ *
+ * Description:
+ *   Bracket the handler of 'irq'.  sched_cycles_irqenter() returns the
+ *   previous owner of the CPU, the interrupted interrupt when they nest,
+ *   which must be given back to sched_cycles_irqleave().
+ *
+ ****************************************************************************/
+
+int sched_cycles_irqenter(int irq)
+{
+	int cpu = this_cpu();
+	int prev = g_cpucycles[cpu].irq;
+
+	sched_cycles_account(cpu);
+	g_cpucycles[cpu].irq = irq;
+	return prev;
+}
+
+void sched_cycles_irqleave(int prev)
+{
+	int cpu = this_cpu();
+
+	sched_cycles_account(cpu);
+	g_cpucycles[cpu].irq = prev;
+}
+
+/****************************************************************************
+ * Name: sched_clear_cycles
+ *
+ * Description:
+ *   Forget the cycles of a thread which exits.  They stay in the totals.
+ *
+ ****************************************************************************/
+
+void sched_clear_cycles(pid_t pid)
+{
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	memset(g_pidhash[PIDHASH(pid)].cycles, 0, sizeof(g_pidhash[0].cycles));
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: sched_get_cycles
+ *
+ * Description:
+ *   Return the cycles of all threads and interrupts.  The running thread
+ *   of the calling CPU is brought up to date first.
+ *
+ ****************************************************************************/
+
+void sched_get_cycles(FAR struct cpuload_cycles_s *cycles)
+{
+	irqstate_t flags;
+	int ndx;
+	int cpu;
+
+	flags = enter_critical_section();
+
+	sched_cycles_account(this_cpu());
+
+	cycles->freq = up_perf_getfreq();
+	cycles->total = 0;
+	cycles->irq = 0;
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		cycles->total += g_cpucycles[cpu].total;
+		cycles->irq += g_cpucycles[cpu].irqtotal;
+	}
+
+	for (ndx = 0; ndx < CONFIG_MAX_TASKS; ndx++) {
+		cycles->pid[ndx] = g_pidhash[ndx].tcb ? g_pidhash[ndx].pid : -1;
+		cycles->task[ndx] = 0;
+		for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+			cycles->task[ndx] += g_pidhash[ndx].cycles[cpu];
+		}
+	}
+
+	memcpy(cycles->irqs, g_irqcycles, sizeof(g_irqcycles));
+
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: sched_reset_cycles
+ *
+ * Description:
+ *   Start a new measurement: clear all the counts.  The owners of the CPUs
+ *   are kept.
+ *
+ ****************************************************************************/
+
+void sched_reset_cycles(void)
+{
+	irqstate_t flags;
+	int ndx;
+	int cpu;
+
+	flags = enter_critical_section();
+
+	sched_cycles_account(this_cpu());
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		g_cpucycles[cpu].total = 0;
+		g_cpucycles[cpu].irqtotal = 0;
+	}
+
+	for (ndx = 0; ndx < CONFIG_MAX_TASKS; ndx++) {
+		memset(g_pidhash[ndx].cycles, 0, sizeof(g_pidhash[0].cycles));
+	}
+
+	memset(g_irqcycles, 0, sizeof(g_irqcycles));
+
+	leave_critical_section(flags);
+}
+
+#endif							/* CONFIG_SCHED_CPULOAD_CYCLES */
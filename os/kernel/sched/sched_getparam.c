@@ -129,6 +129,11 @@ int sched_getparam(pid_t pid, struct sched_param *param)
 	if ((pid == 0) || (pid == rtcb->pid)) {
 		/* Return the priority if the calling task. */
 		param->sched_priority = (int)rtcb->sched_priority;
+#ifdef CONFIG_SCHED_SPORADIC
+		if ((rtcb->flags & TCB_FLAG_POLICY_MASK) == TCB_FLAG_SCHED_SPORADIC) {
+			sched_sporadic_getparam(rtcb, param);
+		}
+#endif
 	}
 
 	/* Ths pid is not for the calling task, we will have to look it up */
@@ -146,6 +151,11 @@ int sched_getparam(pid_t pid, struct sched_param *param)
 			/* Return the priority of the task */
 
 			param->sched_priority = (int)tcb->sched_priority;
+#ifdef CONFIG_SCHED_SPORADIC
+			if ((tcb->flags & TCB_FLAG_POLICY_MASK) == TCB_FLAG_SCHED_SPORADIC) {
+				sched_sporadic_getparam(tcb, param);
+			}
+#endif
 		}
 
 		sched_unlock();
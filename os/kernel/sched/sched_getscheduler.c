@@ -131,6 +131,11 @@ int sched_getscheduler(pid_t pid)
 		set_errno(ESRCH);
 		return ERROR;
 	}
+#ifdef CONFIG_SCHED_SPORADIC
+	else if ((tcb->flags & TCB_FLAG_POLICY_MASK) == TCB_FLAG_SCHED_SPORADIC) {
+		return SCHED_SPORADIC;
+	}
+#endif
 #if CONFIG_RR_INTERVAL > 0
 	else if ((tcb->flags & TCB_FLAG_ROUND_ROBIN) != 0) {
 		return SCHED_RR;
@@ -0,0 +1,286 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/spinlock.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_HOLDTIME
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#if (CONFIG_SCHED_HOLDTIME_NSITES & (CONFIG_SCHED_HOLDTIME_NSITES - 1)) != 0
+#error "CONFIG_SCHED_HOLDTIME_NSITES must be a power of two"
+#endif
+
+/* A call site is looked for in the HOLDTIME_NPROBES entries following its
+ * hash.  When all of them are taken by other sites, the one with the
+ * shortest maximum gives its place to a longer hold, so that the table
+ * keeps the worst sites at a bounded cost.
+ */
+
+#define HOLDTIME_NPROBES	4
+#define HOLDTIME_HASH(c)	(((uintptr_t)(c) >> 1) & (CONFIG_SCHED_HOLDTIME_NSITES - 1))
+#define HOLDTIME_NEXT(i)	(((i) + 1) & (CONFIG_SCHED_HOLDTIME_NSITES - 1))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The hold in progress on a CPU */
+
+struct holdtime_slot_s {
+	FAR struct tcb_s *owner;
+	FAR void *caller;
+	uint32_t start;
+};
+
+struct holdtime_table_s {
+	struct sched_holdsite_s site[CONFIG_SCHED_HOLDTIME_NSITES];
+	uint32_t evicted;			/* Holds counted by the evicted sites */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct holdtime_slot_s g_holdslot[SCHED_HOLDTIME_NTYPES][CONFIG_SMP_NCPUS];
+static struct holdtime_table_s g_holdtime[SCHED_HOLDTIME_NTYPES];
+static spinlock_t g_holdtime_lock;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void holdtime_record(FAR struct holdtime_table_s *table, FAR void *caller, pid_t pid, uint32_t elapsed)
+{
+	FAR struct sched_holdsite_s *site = NULL;
+	FAR struct sched_holdsite_s *entry;
+	int ndx = HOLDTIME_HASH(caller);
+	int i;
+
+	for (i = 0; i < HOLDTIME_NPROBES; i++, ndx = HOLDTIME_NEXT(ndx)) {
+		entry = &table->site[ndx];
+		if (entry->caller == caller) {
+			site = entry;
+			break;
+		}
+
+		if (entry->caller == NULL) {
+			site = entry;
+			site->caller = caller;
+			break;
+		}
+
+		if (site == NULL || entry->max < site->max) {
+			site = entry;
+		}
+	}
+
+	if (site->caller != caller) {
+		/* No room: a hold shorter than all the probed sites is left out */
+
+		if (elapsed <= site->max) {
+			table->evicted++;
+			return;
+		}
+
+		table->evicted += site->count;
+		memset(site, 0, sizeof(struct sched_holdsite_s));
+		site->caller = caller;
+	}
+
+	site->count++;
+	site->total += elapsed;
+	if (elapsed > site->max) {
+		site->max = elapsed;
+		site->maxpid = pid;
+	}
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_holdtime_enter
+ *
+ * Description:
+ *   Start timing the outermost critical section or scheduler lock of the
+ *   running task.  'caller' is the return address of
+ *   enter_critical_section() or sched_lock().
+ *
+ * Assumptions:
+ *   Called with interrupts or pre-emption disabled.
+ *
+ ****************************************************************************/
+
+void sched_holdtime_enter(int type, FAR struct tcb_s *rtcb, FAR void *caller)
+{
+	FAR struct holdtime_slot_s *slot = &g_holdslot[type][this_cpu()];
+
+	slot->owner = rtcb;
+	slot->caller = caller;
+	slot->start = up_perf_gettime();
+}
+
+/****************************************************************************
+ * Name: sched_holdtime_leave
+ *
+ * Description:
+ *   Count the hold which the running task ends in the table of its call
+ *   site.  A hold which was given up by sched_holdtime_cancel() is not
+ *   counted.
+ *
+ ****************************************************************************/
+
+void sched_holdtime_leave(int type, FAR struct tcb_s *rtcb)
+{
+	FAR struct holdtime_slot_s *slot = &g_holdslot[type][this_cpu()];
+	irqstate_t flags;
+	uint32_t elapsed;
+
+	if (slot->owner != rtcb) {
+		return;
+	}
+
+	elapsed = up_perf_gettime() - slot->start;
+	slot->owner = NULL;
+
+	flags = spin_lock_irqsave(&g_holdtime_lock);
+	holdtime_record(&g_holdtime[type], slot->caller, rtcb->pid, elapsed);
+	spin_unlock_irqrestore(&g_holdtime_lock, flags);
+}
+
+/****************************************************************************
+ * Name: sched_holdtime_cancel
+ *
+ * Description:
+ *   Drop the holds of a task which blocks: the CPU goes to other tasks,
+ *   so the time until it runs again is not a hold.
+ *
+ ****************************************************************************/
+
+void sched_holdtime_cancel(FAR struct tcb_s *tcb)
+{
+	int type;
+	int cpu;
+
+	for (type = 0; type < SCHED_HOLDTIME_NTYPES; type++) {
+		for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+			if (g_holdslot[type][cpu].owner == tcb) {
+				g_holdslot[type][cpu].owner = NULL;
+			}
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: sched_holdtime_get
+ *
+ * Description:
+ *   Copy the call sites of a type of hold, the longest maximum first.
+ *
+ * Input Parameters:
+ *   type    - SCHED_HOLDTIME_CSECTION or SCHED_HOLDTIME_SCHEDLOCK
+ *   sites   - Receives the sites
+ *   nsites  - Size of sites
+ *   evicted - Receives the number of holds counted by sites which were
+ *             evicted from the table, or NULL
+ *
+ * Returned Value:
+ *   The number of sites copied.
+ *
+ ****************************************************************************/
+
+int sched_holdtime_get(int type, FAR struct sched_holdsite_s *sites, int nsites, FAR uint32_t *evicted)
+{
+	struct sched_holdsite_s site;
+	irqstate_t flags;
+	int count = 0;
+	int i;
+	int j;
+
+	if (type < 0 || type >= SCHED_HOLDTIME_NTYPES) {
+		return 0;
+	}
+
+	/* Insertion sort of the sites into the caller's array */
+
+	for (i = 0; i < CONFIG_SCHED_HOLDTIME_NSITES; i++) {
+		flags = spin_lock_irqsave(&g_holdtime_lock);
+		site = g_holdtime[type].site[i];
+		spin_unlock_irqrestore(&g_holdtime_lock, flags);
+
+		if (site.caller == NULL) {
+			continue;
+		}
+
+		for (j = count; j > 0 && sites[j - 1].max < site.max; j--) {
+			if (j < nsites) {
+				sites[j] = sites[j - 1];
+			}
+		}
+
+		if (j < nsites) {
+			sites[j] = site;
+			if (count < nsites) {
+				count++;
+			}
+		}
+	}
+
+	if (evicted != NULL) {
+		*evicted = g_holdtime[type].evicted;
+	}
+
+	return count;
+}
+
+/****************************************************************************
+ * Name: sched_holdtime_clear
+ *
+ * Description:
+ *   Forget all the call sites.
+ *
+ ****************************************************************************/
+
+void sched_holdtime_clear(void)
+{
+	irqstate_t flags;
+
+	flags = spin_lock_irqsave(&g_holdtime_lock);
+	memset(g_holdtime, 0, sizeof(g_holdtime));
+	spin_unlock_irqrestore(&g_holdtime_lock, flags);
+}
+
+#endif							/* CONFIG_SCHED_HOLDTIME */
@@ -0,0 +1,145 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/clock.h>
+#include <tinyara/irq.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_LATENCY
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Return a free running time in microseconds.  Only differences are used,
+ * which stay valid when the 32-bit value wraps around.
+ */
+
+static inline uint32_t sched_latency_now(void)
+{
+#ifdef CONFIG_SCHED_TICKLESS
+	struct timespec ts;
+
+	up_timer_gettime(&ts);
+	return (uint32_t)ts.tv_sec * USEC_PER_SEC + (uint32_t)ts.tv_nsec / NSEC_PER_USEC;
+#else
+	return (uint32_t)clock_systimer() * USEC_PER_TICK;
+#endif
+}
+
+static void sched_latency_clearone(FAR struct tcb_s *tcb, FAR void *arg)
+{
+	bool waiting = tcb->latency.waiting;
+	uint32_t readytime = tcb->latency.readytime;
+
+	/* Keep a pending sample, the thread is still on its way to run */
+
+	memset(&tcb->latency, 0, sizeof(struct sched_latency_s));
+	tcb->latency.waiting = waiting;
+	tcb->latency.readytime = readytime;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_latency_ready
+ *
+ * Description:
+ *   Stamp a thread which leaves a blocked state.  Its next switch in will
+ *   record the elapsed time.
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+void sched_latency_ready(FAR struct tcb_s *tcb)
+{
+	tcb->latency.readytime = sched_latency_now();
+	tcb->latency.waiting = true;
+}
+
+/****************************************************************************
+ * Name: sched_latency_resume
+ *
+ * Description:
+ *   Called by the architecture when 'tcb' is about to be switched in.  If
+ *   the thread was stamped by sched_latency_ready(), account for the time it
+ *   spent ready-to-run.  A thread resumed after a preemption has no stamp:
+ *   only wakeups are measured.
+ *
+ * Assumptions:
+ *   Called from the context switch path, with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void sched_latency_resume(FAR struct tcb_s *tcb)
+{
+	FAR struct sched_latency_s *latency = &tcb->latency;
+	uint32_t elapsed;
+	int ndx;
+
+	if (!latency->waiting) {
+		return;
+	}
+
+	latency->waiting = false;
+	elapsed = sched_latency_now() - latency->readytime;
+
+	ndx = elapsed ? 32 - __builtin_clz(elapsed) : 0;
+	if (ndx >= SCHED_LATENCY_NBUCKETS) {
+		ndx = SCHED_LATENCY_NBUCKETS - 1;
+	}
+
+	latency->bucket[ndx]++;
+	latency->count++;
+	latency->total += elapsed;
+	if (elapsed > latency->max) {
+		latency->max = elapsed;
+	}
+}
+
+/****************************************************************************
+ * Name: sched_latency_clear
+ *
+ * Description:
+ *   Reset the latency histograms of all the threads.
+ *
+ ****************************************************************************/
+
+void sched_latency_clear(void)
+{
+	sched_foreach(sched_latency_clearone, NULL);
+}
+
+#endif							/* CONFIG_SCHED_LATENCY */
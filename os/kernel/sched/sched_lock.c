@@ -234,7 +234,9 @@ int sched_lock(void)
 		 * operations on this thread (on any CPU)
 		 */
 
-		rtcb->lockcount++;
+		if (++rtcb->lockcount == 1) {
+			sched_holdtime_enter(SCHED_HOLDTIME_SCHEDLOCK, rtcb, __builtin_return_address(0));
+		}
 
 		/* Move any tasks in the ready-to-run list to the pending task list
 		 * where they will not be available to run until the scheduler is
@@ -263,7 +265,9 @@ int sched_lock(void)
 
 	if (rtcb && !up_interrupt_context()) {
 		ASSERT(rtcb->lockcount < MAX_LOCK_COUNT);
-		rtcb->lockcount++;
+		if (++rtcb->lockcount == 1) {
+			sched_holdtime_enter(SCHED_HOLDTIME_SCHEDLOCK, rtcb, __builtin_return_address(0));
+		}
 	}
 
 	return OK;
@@ -172,6 +172,10 @@ bool sched_mergepending(void)
 			pndtcb->task_state = TSTATE_TASK_READYTORUN;
 		}
 
+		/* pndtcb is behind all the tasks of equal priority */
+
+		sched_rtrindex_add(pndtcb);
+
 		/* Set up for the next time through */
 
 		rtrtcb = pndtcb;
@@ -203,36 +207,29 @@ bool sched_mergepending(void)
 
 	me = this_cpu();
 	if (!sched_islocked_global() && !irq_cpu_locked(me)) {
-		/* Find the CPU that is executing the lowest priority task */
-
-		ptcb = (FAR struct tcb_s *)dq_peek((FAR dq_queue_t *)&g_pendingtasks);
-		if (ptcb == NULL) {
-			/* The pending task list is empty */
-
-			goto errout;
-		}
+		/* Start every pending task which has a higher priority than the
+		 * lowest priority task running on a CPU of its affinity mask.  The
+		 * CPU is selected for each task: a task that cannot run because its
+		 * affinity excludes the CPUs running low priority tasks must not
+		 * keep the following pending tasks from starting on them.
+		 */
 
-		cpu  = sched_select_cpu(ALL_CPUS); /* REVISIT:  Maybe ptcb->affinity */
-		rtcb = current_task(cpu);
+		for (ptcb = (FAR struct tcb_s *)g_pendingtasks.head; ptcb != NULL; ptcb = tcb) {
+			tcb = ptcb->flink;
 
-		/* Loop while there is a higher priority task in the pending task list
-		 * than in the lowest executing task.
-		 *
-		 * Normally, this loop should execute no more than CONFIG_SMP_NCPUS
-		 * times.  That number could be larger, however, if the CPU affinity
-		 * sets do not include all CPUs. In that case, the excess TCBs will
-		 * end up in the g_readytorun list.
-		 */
+			cpu  = sched_select_cpu(ptcb->affinity);
+			rtcb = current_task(cpu);
+			if (ptcb->sched_priority <= rtcb->sched_priority) {
+				continue;
+			}
 
-		while (ptcb->sched_priority > rtcb->sched_priority) {
 			/* Remove the task from the pending task list */
 
-			tcb = (FAR struct tcb_s *)
-			dq_remfirst((FAR dq_queue_t *)&g_pendingtasks);
+			dq_rem((FAR dq_entry_t *)ptcb, (FAR dq_queue_t *)&g_pendingtasks);
 
 			/* Add the pending task to the correct ready-to-run list. */
 
-			ret |= sched_addreadytorun(tcb);
+			ret |= sched_addreadytorun(ptcb);
 
 			/* This operation could cause the scheduler to become locked.
 			 * Check if that happened.
@@ -254,23 +251,11 @@ bool sched_mergepending(void)
 
 				goto errout;
 			}
-
-			/* Set up for the next time through the loop */
-
-			ptcb = (FAR struct tcb_s *)
-			dq_peek((FAR dq_queue_t *)&g_pendingtasks);
-			if (ptcb == NULL) {
-				/* The pending task list is empty */
-
-				goto errout;
-			}
-
-			cpu  = sched_select_cpu(ALL_CPUS); /* REVISIT:  Maybe ptcb->affinity */
-			rtcb = current_task(cpu);
 		}
 
 		/* No more pending tasks can be made running.  Move any remaining
-		 * tasks in the pending task list to the ready-to-run task list.
+		 * tasks in the pending task list to the ready-to-run task list,
+		 * where the CPUs of their affinity pick them when they are free.
 		 */
 
 		sched_merge_prioritized((FAR dq_queue_t *)&g_pendingtasks, \
@@ -58,7 +58,7 @@
 #include <tinyara/compiler.h>
 #include <time.h>
 
-#if CONFIG_RR_INTERVAL > 0
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
 #include <sched.h>
 #include <tinyara/arch.h>
 #include <tinyara/ttrace.h>
@@ -159,7 +159,35 @@ static inline void sched_process_timeslice(int cpu)
 	}
 }
 #else
-#define sched_process_timeslice()
+#define sched_process_timeslice(cpu)
+#endif
+
+/************************************************************************
+ * Name:  sched_process_cpu
+ *
+ * Description:
+ *   Charge the tick to the task running on a CPU: to its budget if it
+ *   is sporadic, and to its time slice if it is round robin.
+ *
+ ************************************************************************/
+
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
+static inline void sched_process_cpu(int cpu)
+{
+#ifdef CONFIG_SCHED_SPORADIC
+	FAR struct tcb_s *rtcb = current_task(cpu);
+
+	(void)sched_process_sporadic(rtcb, 1, false);
+
+	/* The task dropped to its low priority has run its tick */
+
+	if (current_task(cpu) != rtcb) {
+		return;
+	}
+#endif
+
+	sched_process_timeslice(cpu);
+}
 #endif
 
 
@@ -200,14 +228,14 @@ static inline void sched_process_scheduler(void)
 
 	for (i = 0; i < CONFIG_SMP_NCPUS; i++)
 	  {
-	    sched_process_timeslice(i);
+	    sched_process_cpu(i);
 	  }
 
 
 #else
 	/* Perform scheduler operations on the single CPUs */
 
-	sched_process_timeslice(0);
+	sched_process_cpu(0);
 #endif
 	leave_critical_section(flags);
 
@@ -62,6 +62,7 @@
 
 #include <tinyara/arch.h>
 #include <tinyara/sched.h>
+#include <tinyara/perf.h>
 
 #include "sched/sched.h"
 #include "group/group.h"
@@ -97,6 +98,12 @@ static void sched_releasepid(pid_t pid)
 	 * for all threads and reset the load count on this defunct thread
 	 */
 	sched_clear_cpuload(pid);
+#endif
+#ifdef CONFIG_SCHED_CPULOAD_CYCLES
+	sched_clear_cycles(pid);
+#endif
+#ifdef CONFIG_PERF_EVENTS
+	perf_events_clear(pid);
 #endif
 	/* Decrement the alive task count as task is exiting */
 	g_alive_taskcount--;
@@ -157,6 +164,12 @@ int sched_releasetcb(FAR struct tcb_s *tcb, uint8_t ttype)
 			sched_releasepid(tcb->pid);
 		}
 
+#ifdef CONFIG_SCHED_SPORADIC
+		/* Stop the replenishments of a sporadic thread */
+
+		sched_sporadic_stop(tcb);
+#endif
+
 		/* Delete the thread's stack if one has been allocated */
 
 		if (tcb->stack_alloc_ptr) {
@@ -123,4 +123,8 @@ void sched_removeblocked(FAR struct tcb_s *btcb)
 	 */
 
 	btcb->task_state = TSTATE_TASK_INVALID;
+
+	/* The wakeup latency runs from now until the TCB is switched in */
+
+	sched_latency_ready(btcb);
 }
@@ -57,15 +57,6 @@
 
 void sched_resume_scheduler(FAR struct tcb_s *tcb)
 {
-#ifdef CONFIG_SCHED_SPORADIC
-  if ((tcb->flags & TCB_FLAG_POLICY_MASK) == TCB_FLAG_SCHED_SPORADIC)
-    {
-      /* Reset the replenishment cycle if it is appropriate to do so */
-
-      DEBUGVERIFY(sched_resume_sporadic(tcb));
-    }
-#endif
-
   /* Indicate the task has been resumed */
 
 #ifdef CONFIG_SCHED_CRITMONITOR
@@ -0,0 +1,174 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <queue.h>
+#include <assert.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_READYTORUN_INDEX
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* One bit per priority, grouped in 32-bit words, and one bit per non-empty
+ * word in g_rtrgroup, so that a lookup is two count-trailing-zeros at most.
+ */
+
+#define RTR_NWORDS              ((SCHED_PRIORITY_MAX >> 5) + 1)
+#define RTR_WORD(prio)          ((prio) >> 5)
+#define RTR_BIT(prio)           ((uint32_t)1 << ((prio) & 31))
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+/* The last TCB of each priority in g_readytorun.  The TCBs of a priority are
+ * contiguous in the list and run in FIFO order, so inserting a TCB only needs
+ * the tail of the lowest non-empty priority above or equal to its own.
+ */
+
+static FAR struct tcb_s *g_rtrtail[SCHED_PRIORITY_MAX + 1];
+static uint32_t g_rtrmap[RTR_NWORDS];
+static uint32_t g_rtrgroup;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_rtrindex_prev
+ *
+ * Description:
+ *   Return the TCB after which a task of the given priority goes in the
+ *   g_readytorun list, that is behind all the tasks of equal or higher
+ *   priority.
+ *
+ * Inputs:
+ *   sched_priority - The priority of the task to insert
+ *
+ * Return Value:
+ *   The TCB to insert after, or NULL if the task goes at the head of the
+ *   list.
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+FAR struct tcb_s *sched_rtrindex_prev(uint8_t sched_priority)
+{
+	uint32_t mask;
+	int word = RTR_WORD(sched_priority);
+
+	mask = g_rtrmap[word] & ~(RTR_BIT(sched_priority) - 1);
+	if (mask == 0) {
+		/* Look for the next non-empty word of higher priorities */
+
+		mask = g_rtrgroup & ~((2u << word) - 1);
+		if (mask == 0) {
+			return NULL;
+		}
+
+		word = __builtin_ctz(mask);
+		mask = g_rtrmap[word];
+	}
+
+	return g_rtrtail[(word << 5) + __builtin_ctz(mask)];
+}
+
+/****************************************************************************
+ * Name: sched_rtrindex_add
+ *
+ * Description:
+ *   Account a TCB which was just inserted into g_readytorun.
+ *
+ * Inputs:
+ *   tcb - The TCB in the g_readytorun list
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+void sched_rtrindex_add(FAR struct tcb_s *tcb)
+{
+	FAR struct tcb_s *next = (FAR struct tcb_s *)tcb->flink;
+	uint8_t prio = tcb->sched_priority;
+
+	/* If a task of the same priority follows, it is already the tail */
+
+	if (next == NULL || next->sched_priority != prio) {
+		g_rtrtail[prio] = tcb;
+	}
+
+	g_rtrmap[RTR_WORD(prio)] |= RTR_BIT(prio);
+	g_rtrgroup |= (uint32_t)1 << RTR_WORD(prio);
+}
+
+/****************************************************************************
+ * Name: sched_rtrindex_remove
+ *
+ * Description:
+ *   Forget a TCB which is about to be removed from a task list.  Nothing is
+ *   done if the list is not g_readytorun, so that the callers which remove
+ *   a TCB from whatever list it is in do not need to check.
+ *
+ * Inputs:
+ *   tcb  - The TCB, which is still in the list
+ *   list - The list which it is removed from
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+void sched_rtrindex_remove(FAR struct tcb_s *tcb, FAR dq_queue_t *list)
+{
+	FAR struct tcb_s *prev;
+	uint8_t prio = tcb->sched_priority;
+
+	if (list != (FAR dq_queue_t *)&g_readytorun || g_rtrtail[prio] != tcb) {
+		return;
+	}
+
+	prev = (FAR struct tcb_s *)tcb->blink;
+	if (prev != NULL && prev->sched_priority == prio) {
+		g_rtrtail[prio] = prev;
+		return;
+	}
+
+	/* This was the only task of its priority */
+
+	g_rtrtail[prio] = NULL;
+	g_rtrmap[RTR_WORD(prio)] &= ~RTR_BIT(prio);
+	if (g_rtrmap[RTR_WORD(prio)] == 0) {
+		g_rtrgroup &= ~((uint32_t)1 << RTR_WORD(prio));
+	}
+}
+
+#endif /* CONFIG_SCHED_READYTORUN_INDEX */
@@ -236,7 +236,9 @@ int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority)
 				} while (sched_priority < ntcb->sched_priority);
 
 				/* Change the task priority */
+				sched_rtrindex_remove(tcb, (FAR dq_queue_t *)&g_readytorun);
 				tcb->sched_priority = (uint8_t)sched_priority;
+				sched_rtrindex_add(tcb);
 
 			} else {
 				up_reprioritize_rtr(tcb, (uint8_t)sched_priority);
@@ -248,7 +250,9 @@ int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority)
 		else {
 			/* Change the task priority */
 
+			sched_rtrindex_remove(tcb, (FAR dq_queue_t *)&g_readytorun);
 			tcb->sched_priority = (uint8_t)sched_priority;
+			sched_rtrindex_add(tcb);
 		}
 		break;
 
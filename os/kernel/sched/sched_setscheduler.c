@@ -106,10 +106,12 @@
  * Inputs:
  *   pid - the task ID of the task to modify.  If pid is zero, the calling
  *      task is modified.
- *   policy - Scheduling policy requested (either SCHED_FIFO or SCHED_RR)
+ *   policy - Scheduling policy requested (SCHED_FIFO, SCHED_RR or
+ *      SCHED_SPORADIC)
  *   param - A structure whose member sched_priority is the new priority.
  *      The range of valid priority numbers is from SCHED_PRIORITY_MIN
- *      through SCHED_PRIORITY_MAX.
+ *      through SCHED_PRIORITY_MAX.  SCHED_SPORADIC also takes the
+ *      sched_ss_* members.
  *
  * Return Value:
  *   On success, sched_setscheduler() returns OK (zero).  On error, ERROR
@@ -132,12 +134,16 @@ int sched_setscheduler(pid_t pid, int policy, const struct sched_param *param)
 
 	/* Check for supported scheduling policy */
 
+	switch (policy) {
+	case SCHED_FIFO:
 #if CONFIG_RR_INTERVAL > 0
-	if (policy != SCHED_FIFO && policy != SCHED_RR)
-#else
-	if (policy != SCHED_FIFO)
+	case SCHED_RR:
 #endif
-	{
+#ifdef CONFIG_SCHED_SPORADIC
+	case SCHED_SPORADIC:
+#endif
+		break;
+	default:
 		set_errno(EINVAL);
 		return ERROR;
 	}
@@ -162,6 +168,24 @@ int sched_setscheduler(pid_t pid, int policy, const struct sched_param *param)
 
 	sched_lock();
 
+#ifdef CONFIG_SCHED_SPORADIC
+	if (policy == SCHED_SPORADIC) {
+		/* The priority is set with the budget */
+
+		ret = sched_sporadic_start(tcb, param);
+		sched_unlock();
+		if (ret < 0) {
+			set_errno(-ret);
+			return ERROR;
+		}
+		return OK;
+	}
+
+	/* Leaving the sporadic policy, if the thread had it */
+
+	sched_sporadic_stop(tcb);
+#endif
+
 #if CONFIG_RR_INTERVAL > 0
 	/* Further, disable timer interrupts while we set up scheduling policy. */
 
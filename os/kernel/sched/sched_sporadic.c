@@ -0,0 +1,327 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * kernel/sched/sched_sporadic.c
+ *
+ * SCHED_SPORADIC: a thread runs at its priority for a budget of CPU time in
+ * each replenishment period, and at its low priority for the rest of the
+ * period.  The budget is charged by the system timer, to the thread running
+ * on each CPU, and given back in full at the start of each period by a
+ * watchdog.  A thread which has used its budget thus still uses the CPU
+ * time the higher priority threads leave, without delaying them by more
+ * than its budget in a period.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sched.h>
+#include <errno.h>
+#include <assert.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/wdog.h>
+
+#include "sched/sched.h"
+#include "clock/clock.h"
+
+#ifdef CONFIG_SCHED_SPORADIC
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Change the priority of the thread, keeping a boost by priority
+ * inheritance: only the priority it returns to is changed then.
+ */
+
+static void sporadic_set_priority(FAR struct tcb_s *tcb, int priority)
+{
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	if (tcb->sched_priority > tcb->base_priority) {
+		tcb->base_priority = (uint8_t)priority;
+		if (priority > tcb->sched_priority) {
+			(void)sched_setpriority(tcb, priority);
+		}
+		return;
+	}
+
+	tcb->base_priority = (uint8_t)priority;
+#endif
+	(void)sched_setpriority(tcb, priority);
+}
+
+/* The watchdog of the period: the budget is given back, and the thread
+ * returns to its priority.
+ */
+
+static void sporadic_replenish(int argc, uint32_t arg1, ...)
+{
+	FAR struct tcb_s *tcb = (FAR struct tcb_s *)arg1;
+	FAR struct sporadic_s *sporadic = tcb->sporadic;
+	irqstate_t flags;
+
+	DEBUGASSERT(sporadic != NULL);
+
+	flags = enter_critical_section();
+
+	sporadic->remaining = sporadic->budget;
+	(void)wd_start(sporadic->timer, sporadic->period, (wdentry_t)sporadic_replenish, 1, (uint32_t)tcb);
+
+	if (sporadic->suspended) {
+		sporadic->suspended = false;
+		sporadic_set_priority(tcb, sporadic->hi_priority);
+	}
+
+	leave_critical_section(flags);
+}
+
+static int sporadic_ticks(FAR const struct timespec *ts)
+{
+	int ticks;
+
+	if (ts->tv_sec < 0 || ts->tv_nsec < 0 || ts->tv_nsec >= NSEC_PER_SEC) {
+		return 0;
+	}
+
+	if (clock_time2ticks(ts, &ticks) != OK) {
+		return 0;
+	}
+
+	return ticks;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_sporadic_start
+ *
+ * Description:
+ *   Set the sporadic parameters of a thread and start its first period with
+ *   the full budget, at its priority.  The thread may be sporadic already.
+ *
+ * Input Parameters:
+ *   tcb   - The thread
+ *   param - sched_priority, sched_ss_low_priority, sched_ss_repl_period and
+ *           sched_ss_init_budget.  sched_ss_max_repl is not used, as the
+ *           budget is given back at once each period.
+ *
+ * Returned Value:
+ *   OK, or a negated errno.
+ *
+ * Assumptions:
+ *   The scheduler is locked.
+ *
+ ****************************************************************************/
+
+int sched_sporadic_start(FAR struct tcb_s *tcb, FAR const struct sched_param *param)
+{
+	FAR struct sporadic_s *sporadic;
+	irqstate_t flags;
+	int budget;
+	int period;
+
+	if (param->sched_priority < SCHED_PRIORITY_MIN || param->sched_priority > SCHED_PRIORITY_MAX || param->sched_ss_low_priority < SCHED_PRIORITY_MIN || param->sched_ss_low_priority > param->sched_priority) {
+		return -EINVAL;
+	}
+
+	budget = sporadic_ticks(&param->sched_ss_init_budget);
+	period = sporadic_ticks(&param->sched_ss_repl_period);
+	if (budget <= 0 || period < budget) {
+		return -EINVAL;
+	}
+
+	sporadic = tcb->sporadic;
+	if (sporadic == NULL) {
+		sporadic = (FAR struct sporadic_s *)kmm_zalloc(sizeof(struct sporadic_s));
+		if (sporadic == NULL) {
+			return -ENOMEM;
+		}
+
+		sporadic->timer = wd_create();
+		if (sporadic->timer == NULL) {
+			kmm_free(sporadic);
+			return -ENOMEM;
+		}
+	}
+
+	flags = enter_critical_section();
+
+	sporadic->hi_priority = (uint8_t)param->sched_priority;
+	sporadic->low_priority = (uint8_t)param->sched_ss_low_priority;
+	sporadic->budget = budget;
+	sporadic->period = period;
+	sporadic->remaining = budget;
+	sporadic->suspended = false;
+
+	tcb->sporadic = sporadic;
+	tcb->flags &= ~TCB_FLAG_POLICY_MASK;
+	tcb->flags |= TCB_FLAG_SCHED_SPORADIC;
+
+	(void)wd_start(sporadic->timer, period, (wdentry_t)sporadic_replenish, 1, (uint32_t)tcb);
+
+	leave_critical_section(flags);
+
+	return sched_reprioritize(tcb, param->sched_priority) == OK ? OK : -EINVAL;
+}
+
+/****************************************************************************
+ * Name: sched_sporadic_stop
+ *
+ * Description:
+ *   Free the sporadic state of a thread, which leaves the policy or exits.
+ *   The thread keeps the priority it has.
+ *
+ ****************************************************************************/
+
+void sched_sporadic_stop(FAR struct tcb_s *tcb)
+{
+	FAR struct sporadic_s *sporadic;
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	sporadic = tcb->sporadic;
+	tcb->sporadic = NULL;
+	if ((tcb->flags & TCB_FLAG_POLICY_MASK) == TCB_FLAG_SCHED_SPORADIC) {
+		tcb->flags &= ~TCB_FLAG_POLICY_MASK;
+	}
+	leave_critical_section(flags);
+
+	/* It may be called by sched_releasetcb() in the critical section */
+
+	if (sporadic != NULL) {
+		(void)wd_delete(sporadic->timer);
+		sched_kfree(sporadic);
+	}
+}
+
+/****************************************************************************
+ * Name: sched_sporadic_reprioritize
+ *
+ * Description:
+ *   sched_setparam() of a sporadic thread: the new priority is the one of
+ *   the budget, taken at once unless the budget is used.
+ *
+ ****************************************************************************/
+
+int sched_sporadic_reprioritize(FAR struct tcb_s *tcb, int priority)
+{
+	FAR struct sporadic_s *sporadic = tcb->sporadic;
+	irqstate_t flags;
+
+	if (priority < sporadic->low_priority || priority > SCHED_PRIORITY_MAX) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	flags = enter_critical_section();
+	sporadic->hi_priority = (uint8_t)priority;
+	if (sporadic->suspended) {
+		leave_critical_section(flags);
+		return OK;
+	}
+	leave_critical_section(flags);
+
+	return sched_reprioritize(tcb, priority);
+}
+
+/****************************************************************************
+ * Name: sched_sporadic_getparam
+ *
+ * Description:
+ *   The sporadic parameters of a thread, for sched_getparam().
+ *
+ ****************************************************************************/
+
+void sched_sporadic_getparam(FAR struct tcb_s *tcb, FAR struct sched_param *param)
+{
+	FAR struct sporadic_s *sporadic = tcb->sporadic;
+
+	param->sched_priority = sporadic->hi_priority;
+	param->sched_ss_low_priority = sporadic->low_priority;
+	(void)clock_ticks2time(sporadic->period, &param->sched_ss_repl_period);
+	(void)clock_ticks2time(sporadic->budget, &param->sched_ss_init_budget);
+	param->sched_ss_max_repl = 1;
+}
+
+/****************************************************************************
+ * Name: sched_process_sporadic
+ *
+ * Description:
+ *   Charge the ticks elapsed to the budget of the running thread, from the
+ *   system timer.  At the end of the budget, the thread drops to its low
+ *   priority, once the scheduler is unlocked.
+ *
+ * Input Parameters:
+ *   tcb        - The thread running on the CPU
+ *   ticks      - The ticks elapsed
+ *   noswitches - True: no context switch can be done now
+ *
+ * Returned Value:
+ *   The ticks left of the budget, or 0 if the thread is not sporadic or has
+ *   used its budget.  1 means that the priority is to be dropped as soon as
+ *   it can be.
+ *
+ * Assumptions:
+ *   In the critical section.
+ *
+ ****************************************************************************/
+
+unsigned int sched_process_sporadic(FAR struct tcb_s *tcb, unsigned int ticks, bool noswitches)
+{
+	FAR struct sporadic_s *sporadic = tcb->sporadic;
+
+	if ((tcb->flags & TCB_FLAG_POLICY_MASK) != TCB_FLAG_SCHED_SPORADIC || sporadic == NULL || sporadic->suspended) {
+		return 0;
+	}
+
+	sporadic->remaining -= MIN(sporadic->remaining, ticks);
+	if (sporadic->remaining > 0) {
+		return sporadic->remaining;
+	}
+
+	/* As for the round robin time slice, a thread which locked the
+	 * scheduler keeps the CPU until it unlocks it.
+	 */
+
+	if (tcb->lockcount > 0 || noswitches) {
+		return 1;
+	}
+
+	sporadic->suspended = true;
+	sporadic_set_priority(tcb, sporadic->low_priority);
+	return 0;
+}
+
+#endif							/* CONFIG_SCHED_SPORADIC */
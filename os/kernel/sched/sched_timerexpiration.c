@@ -61,7 +61,7 @@
 #include <assert.h>
 #include <debug.h>
 
-#if CONFIG_RR_INTERVAL > 0
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
 #include <sched.h>
 #include <tinyara/arch.h>
 #endif
@@ -395,15 +395,46 @@ static unsigned int sched_process_timeslice(int cpu, unsigned int ticks, bool no
  *
  ****************************************************************************/
 #if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
+static uint32_t sched_process_cpu(int cpu, uint32_t ticks, bool noswitches)
+{
+	uint32_t ret = 0;
+#ifdef CONFIG_SCHED_SPORADIC
+	FAR struct tcb_s *rtcb = current_task(cpu);
+	uint32_t budget;
+
+	budget = sched_process_sporadic(rtcb, ticks, noswitches);
+	if (current_task(cpu) != rtcb) {
+		/* The ticks were run by the task which dropped to its low
+		 * priority, not by the new one.
+		 */
+
+		ticks = 0;
+		budget = sched_process_sporadic(current_task(cpu), 0, noswitches);
+	}
+#endif
+
+#if CONFIG_RR_INTERVAL > 0
+	ret = sched_process_timeslice(cpu, ticks, noswitches);
+#endif
+
+#ifdef CONFIG_SCHED_SPORADIC
+	if (budget > 0 && (ret == 0 || budget < ret)) {
+		ret = budget;
+	}
+#endif
+
+	return ret;
+}
+
 static uint32_t sched_process_scheduler(uint32_t ticks, bool noswitches)
 {
 	irqstate_t flags;
-	flags = enter_critical_section();
-
+	uint32_t ret;
 #ifdef CONFIG_SMP
 	uint32_t minslice = UINT32_MAX;
 	uint32_t timeslice;
 	int i;
+#endif
 
 	/* If we are running on a single CPU architecture, then we know interrupts
 	 * are disabled and there is no need to explicitly call
@@ -413,26 +444,27 @@ static uint32_t sched_process_scheduler(uint32_t ticks, bool noswitches)
 	 * TCB that we are manipulating.
 	 */
 
+	flags = enter_critical_section();
+
+#ifdef CONFIG_SMP
 	/* Perform scheduler operations on all CPUs */
 
-	for (i = 0; i < CONFIG_SMP_NCPUS; i++)
-	{
-		timeslice = sched_process_timeslice(i, ticks, noswitches);
-		if (timeslice > 0 && timeslice < minslice)
-		{
+	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+		timeslice = sched_process_cpu(i, ticks, noswitches);
+		if (timeslice > 0 && timeslice < minslice) {
 			minslice = timeslice;
 		}
 	}
 
-	return minslice < UINT32_MAX ? minslice : 0;
-
+	ret = minslice < UINT32_MAX ? minslice : 0;
 #else
 	/* Perform scheduler operations on the single CPUs */
 
-	return sched_process_timeslice(0, ticks, noswitches);
+	ret = sched_process_cpu(0, ticks, noswitches);
 #endif
-	leave_critical_section(flags);
 
+	leave_critical_section(flags);
+	return ret;
 }
 #else
 #define sched_process_scheduler(t,n) (0)
@@ -456,7 +488,7 @@ static uint32_t sched_process_scheduler(uint32_t ticks, bool noswitches)
 
 static unsigned int sched_timer_process(unsigned int ticks, bool noswitches)
 {
-#if CONFIG_RR_INTERVAL > 0
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
 	unsigned int cmptime = UINT_MAX;
 #endif
 	unsigned int rettime = 0;
@@ -466,14 +498,14 @@ static unsigned int sched_timer_process(unsigned int ticks, bool noswitches)
 
 	tmp = wd_timer(ticks);
 	if (tmp > 0) {
-#if CONFIG_RR_INTERVAL > 0
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
 		cmptime = tmp;
 #endif
 		rettime = tmp;
 	}
-#if CONFIG_RR_INTERVAL > 0
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
 	/* Check if the currently executing task has exceeded its
-	 * timeslice.
+	 * timeslice or its sporadic budget.
 	 */
 
 	tmp = sched_process_scheduler(ticks, noswitches);
@@ -142,6 +142,7 @@ int sched_unlock(void)
 		if (rtcb->lockcount <= 0) {
 			/* Set the lock count to zero */
 			rtcb->lockcount = 0;
+			sched_holdtime_leave(SCHED_HOLDTIME_SCHEDLOCK, rtcb);
 
 			/* The lockcount has decremented to zero and we need to perform
 			 * release our hold on the lock.
@@ -243,6 +244,7 @@ int sched_unlock(void)
 
 		if (rtcb->lockcount <= 0) {
 			rtcb->lockcount = 0;
+			sched_holdtime_leave(SCHED_HOLDTIME_SCHEDLOCK, rtcb);
 
 			/* Release any ready-to-run tasks that have collected in
 			 * g_pendingtasks.
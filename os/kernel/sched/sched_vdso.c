@@ -0,0 +1,70 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <time.h>
+
+#include <tinyara/clock.h>
+#include <tinyara/userspace.h>
+#include <tinyara/vdso.h>
+
+#include "sched/sched.h"
+#include "clock/clock.h"
+
+#ifdef CONFIG_LIB_SYSCALL_VDSO
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_vdso_update
+ *
+ * Description:
+ *   Write the PID of tcb and the time into the vDSO page of its binary.
+ *   Called with interrupts disabled when tcb is switched in, at each tick
+ *   for the running thread and when the wall clock is set.  Kernel threads
+ *   have no page.
+ *
+ ****************************************************************************/
+
+void sched_vdso_update(FAR struct tcb_s *tcb)
+{
+	FAR struct vdso_data_s *vdso;
+
+	if (tcb == NULL || tcb->uspace == 0) {
+		return;
+	}
+
+	vdso = ((FAR struct userspace_s *)tcb->uspace)->vdso;
+	if (vdso == NULL) {
+		return;
+	}
+
+	vdso->pid = tcb->pid;
+	vdso->systimer = g_system_timer;
+	vdso->basetime = g_basetime;
+	vdso->seq++;
+}
+
+#endif							/* CONFIG_LIB_SYSCALL_VDSO */
@@ -61,6 +61,9 @@
 #include <assert.h>
 #include <debug.h>
 #include <tinyara/arch.h>
+#ifdef CONFIG_SEM_ADAPTIVE_SPIN
+#include <tinyara/spinlock.h>
+#endif
 
 #include "sched/sched.h"
 #include "semaphore/semaphore.h"
@@ -113,7 +116,19 @@ static inline FAR struct semholder_s *sem_allocholder(sem_t *sem)
 	 * used to implement mutexes.
 	 */
 
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#if defined(SEM_INLINE_HOLDER)
+	if (!sem->holder.htcb) {
+		pholder = &sem->holder;
+		pholder->counts = 0;
+	} else if ((pholder = g_freeholders) != NULL) {
+		/* The semaphore is held by several threads, use the pool */
+
+		g_freeholders = pholder->flink;
+		pholder->flink = sem->hhead;
+		sem->hhead = pholder;
+		pholder->counts = 0;
+	}
+#elif CONFIG_SEM_PREALLOCHOLDERS > 0
 	pholder = g_freeholders;
 	if (pholder) {
 		/* Remove the holder from the free list an put it into the semaphore's
@@ -173,6 +188,12 @@ void sem_freeholder(sem_t *sem, FAR struct semholder_s *pholder)
 	pholder->counts = 0;
 
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef SEM_INLINE_HOLDER
+	if (pholder == &sem->holder) {
+		return;
+	}
+#endif
+
 	/* Search the list for the matching holder */
 
 	for (prev = NULL, curr = sem->hhead; curr && curr != pholder; prev = curr, curr = curr->flink) ;
@@ -206,6 +227,14 @@ static int sem_foreachholder(FAR sem_t *sem, holderhandler_t handler, FAR void *
 #endif
 	int ret = 0;
 
+#ifdef SEM_INLINE_HOLDER
+	/* The "built-in" holder comes first, then those taken from the pool */
+
+	if (sem->holder.htcb) {
+		ret = handler(&sem->holder, sem, arg);
+	}
+#endif
+
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
 	for (pholder = sem->hhead; pholder && ret == 0; pholder = next)
 #else
@@ -688,6 +717,30 @@ static inline void sem_restorebaseprio_task(FAR struct tcb_s *stcb, FAR struct t
 }
 #endif
 
+/****************************************************************************
+ * Name: sem_spinholder
+ ****************************************************************************/
+
+#ifdef CONFIG_SEM_ADAPTIVE_SPIN
+static int sem_spinholder(FAR struct semholder_s *pholder, FAR sem_t *sem, FAR void *arg)
+{
+	FAR struct tcb_s **htcb = (FAR struct tcb_s **)arg;
+
+	if (pholder->counts > 0) {
+		if (*htcb != NULL) {
+			/* More than one holder, the semaphore is not used as a lock */
+
+			*htcb = NULL;
+			return 1;
+		}
+
+		*htcb = pholder->htcb;
+	}
+
+	return 0;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -755,6 +808,13 @@ void sem_destroyholder(FAR sem_t *sem)
 	 */
 
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef SEM_INLINE_HOLDER
+	if (sem->holder.htcb) {
+		sdbg("Semaphore destroyed with holder\n");
+		sem->holder.htcb = NULL;
+	}
+#endif
+
 	if (sem->hhead) {
 		sdbg("Semaphore destroyed with holders\n");
 		(void)sem_foreachholder(sem, sem_recoverholders, NULL);
@@ -780,6 +840,12 @@ struct semholder_s *sem_findholder(sem_t *sem, FAR struct tcb_s *htcb)
 	 * semaphore
 	 */
 
+#ifdef SEM_INLINE_HOLDER
+	if (sem->holder.htcb == htcb) {
+		return &sem->holder;
+	}
+#endif
+
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
 	for (pholder = sem->hhead; pholder; pholder = pholder->flink)
 #else
@@ -1028,6 +1094,68 @@ void sem_canceled(FAR struct tcb_s *stcb, FAR sem_t *sem)
 }
 #endif
 
+/****************************************************************************
+ * Name: sem_spinwait
+ *
+ * Description:
+ *   Called from sem_wait() before it blocks.  If the semaphore has a
+ *   single holder, running on another CPU, it is likely to be released
+ *   sooner than two context switches would take, so spin until then.  Give
+ *   up, and let the caller block, when the holder stops running or after
+ *   CONFIG_SEM_ADAPTIVE_SPIN_LOOPS polls.
+ *
+ * Parameters:
+ *   sem - A reference to the semaphore to be taken
+ *
+ * Return Value:
+ *   None.  The caller still has to take the semaphore, which is only
+ *   likely to be available.
+ *
+ * Assumptions:
+ *   Not called from within a critical section, which would keep the
+ *   holder from releasing the semaphore.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SEM_ADAPTIVE_SPIN
+void sem_spinwait(FAR sem_t *sem)
+{
+	FAR volatile struct tcb_s *htcb = NULL;
+	FAR volatile sem_t *vsem = sem;
+	irqstate_t flags;
+	int loops;
+
+	if (vsem->semcount > 0 || (sem->flags & FLAGS_SIGSEM) != 0) {
+		return;
+	}
+
+#ifdef CONFIG_IRQCOUNT
+	if (this_task()->irqcount > 0) {
+		return;
+	}
+#endif
+
+	flags = enter_critical_section();
+	(void)sem_foreachholder(sem, sem_spinholder, (FAR void *)&htcb);
+	if (htcb != NULL && (htcb->task_state != TSTATE_TASK_RUNNING || htcb->cpu == this_cpu())) {
+		htcb = NULL;
+	}
+	leave_critical_section(flags);
+
+	/* The holder is polled without the critical section held, a stale
+	 * reading only ends the spin early or late.
+	 */
+
+	for (loops = 0; htcb != NULL && loops < CONFIG_SEM_ADAPTIVE_SPIN_LOOPS; loops++) {
+		if (vsem->semcount > 0 || htcb->task_state != TSTATE_TASK_RUNNING) {
+			break;
+		}
+
+		SP_DSB();
+	}
+}
+#endif
+
 /****************************************************************************
  * Name: sem_enumholders
  *
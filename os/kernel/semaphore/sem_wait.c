@@ -135,6 +135,11 @@ int sem_wait(FAR sem_t *sem)
 	DEBUGASSERT(sem != NULL && up_interrupt_context() == false);
 #endif
 
+	/* On SMP, a lock held by a thread running on another CPU may be worth
+	 * waiting for without blocking.
+	 */
+	sem_spinwait(sem);
+
 	/* The following operations must be performed with interrupts
 	 * disabled because sem_post() may be called from an interrupt
 	 * handler.
@@ -70,6 +70,25 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* CONFIG_SEM_ADAPTIVE_SPIN makes sem_wait() spin for a while before it
+ * blocks, as long as the holder of the semaphore is running on another
+ * CPU.  A lock held briefly, like the pthread mutexes of the network and
+ * media paths, is then handed over without two context switches.  The
+ * holder is only known when the holders of the semaphores are kept.
+ */
+
+#ifdef CONFIG_SEM_ADAPTIVE_SPIN
+#if !defined(CONFIG_SMP) || !defined(SAVE_SEM_HOLDER)
+#error "CONFIG_SEM_ADAPTIVE_SPIN needs CONFIG_SMP and CONFIG_PRIORITY_INHERITANCE or CONFIG_BINARY_MANAGER"
+#endif
+
+/* Polls of the semaphore before blocking anyway */
+
+#ifndef CONFIG_SEM_ADAPTIVE_SPIN_LOOPS
+#define CONFIG_SEM_ADAPTIVE_SPIN_LOOPS 1000
+#endif
+#endif
+
 /****************************************************************************
  * Public Type Declarations
  ****************************************************************************/
@@ -125,7 +144,13 @@ void sem_canceled(FAR struct tcb_s *stcb, FAR sem_t *sem);
 #else
 #define sem_canceled(stcb, sem)
 #endif
+#ifdef CONFIG_SEM_ADAPTIVE_SPIN
+void sem_spinwait(FAR sem_t *sem);
+#else
+#define sem_spinwait(sem)
+#endif
 #else
+#define sem_spinwait(sem)
 #define sem_initholders()
 #define sem_destroyholder(sem)
 #define sem_addholder(sem)
@@ -299,7 +299,13 @@ int sigtimedwait(FAR const sigset_t *set, FAR struct siginfo *info, FAR const st
 				wdparm_t wdparm;
 				wdparm.pvarg = (FAR void *)rtcb;
 
-				/* Start the watchdog */
+				/* Start the watchdog, late by up to the slack of the
+				 * thread if another timer event can absorb it.
+				 */
+
+				if (rtcb->timer_slack > 0) {
+					(void)wd_setslack(rtcb->waitdog, rtcb->timer_slack);
+				}
 
 				wd_start(rtcb->waitdog, waitticks, (wdentry_t)sig_timeout, 1, wdparm.dwarg);
 
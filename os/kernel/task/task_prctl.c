@@ -58,11 +58,13 @@
 
 #include <sys/prctl.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <string.h>
 #include <errno.h>
 #include <debug.h>
 
 #include <tinyara/sched.h>
+#include <tinyara/clock.h>
 #include <tinyara/ttrace.h>
 
 #ifdef CONFIG_PREFERENCE
@@ -282,6 +284,19 @@ int prctl(int option, ...)
 		tcb->is_active = true;
 	}
 	break;
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+	case PR_MONITOR_SET_BUDGET:
+	{
+		int percent = va_arg(ap, int);
+		int ret;
+		ret = task_monitor_budget_register(getpid(), percent);
+		if (ret < 0) {
+			err = -ret;
+			goto errout;
+		}
+	}
+	break;
+#endif
 #endif
 #ifdef CONFIG_PREFERENCE
 	case PR_SET_PREFERENCE:
@@ -357,6 +372,15 @@ int prctl(int option, ...)
 		va_end(ap);
 		return ret;
 	}
+	case PR_BEGIN_PREFERENCE:
+		va_end(ap);
+		return preference_begin_transaction();
+	case PR_COMMIT_PREFERENCE:
+		va_end(ap);
+		return preference_commit_transaction();
+	case PR_DISCARD_PREFERENCE:
+		va_end(ap);
+		return preference_discard_transaction();
 #endif
 #ifdef CONFIG_MEM_LEAK_CHECKER
 	case PR_MEM_LEAK_CHECKER:
@@ -433,6 +457,32 @@ int prctl(int option, ...)
 		va_end(ap);
 		return OK;
 	}
+	case PR_SET_TIMERSLACK:
+	{
+		int msec = va_arg(ap, int);
+		clock_t ticks;
+
+		if (msec < 0) {
+			err = EINVAL;
+			goto errout;
+		}
+
+		ticks = MSEC2TICK(msec);
+		this_task()->timer_slack = ticks > UINT16_MAX ? UINT16_MAX : (uint16_t)ticks;
+	}
+	break;
+	case PR_GET_TIMERSLACK:
+	{
+		int *msec = va_arg(ap, int *);
+
+		if (!msec) {
+			err = EFAULT;
+			goto errout;
+		}
+
+		*msec = TICK2MSEC(this_task()->timer_slack);
+	}
+	break;
 	default:
 		sdbg("Unrecognized option: %d\n", option);
 		err = EINVAL;
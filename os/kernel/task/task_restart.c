@@ -217,6 +217,7 @@ int task_restart(pid_t pid)
 		FAR dq_queue_t *tasklist = TLIST_HEAD(tcb->cmn.task_state, tcb->cmn.cpu);
 		dq_rem((FAR dq_entry_t *)tcb, tasklist);
 #else
+		sched_rtrindex_remove(&tcb->cmn, (dq_queue_t *)g_tasklisttable[tcb->cmn.task_state].list);
 		dq_rem((FAR dq_entry_t *)tcb, (dq_queue_t *)g_tasklisttable[tcb->cmn.task_state].list);
 #endif
 		tcb->cmn.task_state = TSTATE_TASK_INVALID;
@@ -63,6 +63,7 @@
 #include <tinyara/arch.h>
 #include <tinyara/sched.h>
 #include <tinyara/ttrace.h>
+#include <tinyara/bootprof.h>
 
 #ifdef CONFIG_TASK_MANAGER
 #include <tinyara/task_manager_drv.h>
@@ -139,6 +140,12 @@ void task_start(void)
 	trace_begin(TTRACE_TAG_TASK, "task_start");
 	DEBUGASSERT((tcb->cmn.flags & TCB_FLAG_TTYPE_MASK) != TCB_FLAG_TTYPE_PTHREAD);
 
+#if CONFIG_TASK_NAME_SIZE > 0
+	bootprof_mark("start %s", tcb->cmn.name);
+#else
+	bootprof_mark("start %d", tcb->cmn.pid);
+#endif
+
 	/* Execute the start hook if one has been registered */
 
 #ifdef CONFIG_SCHED_STARTHOOK
@@ -208,6 +208,7 @@ int task_terminate(pid_t pid, bool nonblocking)
 
 	/* Remove the task from the task list */
 
+	sched_rtrindex_remove(dtcb, tasklist);
 	dq_rem((FAR dq_entry_t *)dtcb, tasklist);
 
 	/* At this point, the TCB should no longer be accessible to the system */
@@ -249,6 +250,7 @@ int task_terminate(pid_t pid, bool nonblocking)
 #endif
 #ifdef CONFIG_PREFERENCE
 	preference_clear_callbacks(pid);
+	preference_clear_transaction(pid);
 #endif
 
 	/* Perform common task termination logic (flushing streams, calling
@@ -138,6 +138,7 @@ int task_terminate_unloaded(FAR struct tcb_s *tcb)
 	sig_cleanup(tcb);
 
 	saved_state = enter_critical_section();
+	sched_rtrindex_remove(tcb, (dq_queue_t *)g_tasklisttable[tcb->task_state].list);
 	dq_rem((FAR dq_entry_t *)tcb, (dq_queue_t *)g_tasklisttable[tcb->task_state].list);
 	leave_critical_section(saved_state);
 
@@ -147,6 +148,7 @@ int task_terminate_unloaded(FAR struct tcb_s *tcb)
 #endif
 #ifdef CONFIG_PREFERENCE
 	preference_clear_callbacks(tcb->pid);
+	preference_clear_transaction(tcb->pid);
 #endif
 	tcb->flags |= TCB_FLAG_EXIT_PROCESSING;
 
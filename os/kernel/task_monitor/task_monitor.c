@@ -24,9 +24,19 @@
 #include <sched.h>
 #include <queue.h>
 #include <semaphore.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
 
 #include <sys/boardctl.h>
+#include <sys/prctl.h>
 #include <tinyara/sched.h>
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+#include <tinyara/irq.h>
+#include <tinyara/cpuload.h>
+#include <tinyara/task_monitor.h>
+#endif
 #ifdef CONFIG_SYSTEM_REBOOT_REASON
 #include <tinyara/reboot_reason.h>
 #include <arch/reboot_reason.h>
@@ -34,11 +44,295 @@
 
 #include "task_monitor_internal.h"
 
+/* The checks may run a little late to share a wake-up with other timers */
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+#define TASK_MONITOR_TIMER_SLACK_MS (CONFIG_TASK_MONITOR_BUDGET_WINDOW / 10)
+#else
+#define TASK_MONITOR_TIMER_SLACK_MS (CONFIG_TASK_MONITOR_INTERVAL * 100)
+#endif
+
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+#if CONFIG_TASK_MONITOR_BUDGET_WINDOW <= 0 || CONFIG_TASK_MONITOR_BUDGET_WINDOW > CONFIG_TASK_MONITOR_INTERVAL * 1000
+#error "CONFIG_TASK_MONITOR_BUDGET_WINDOW must be within CONFIG_TASK_MONITOR_INTERVAL"
+#endif
+
+#define TASK_MONITOR_NEVENTS 8
+
+/* CPU budget of the task in a PID hash slot */
+
+struct task_monitor_budget_s {
+	pid_t pid;
+	uint8_t percent;			/* Budget, 0 for none */
+	uint8_t strikes;			/* Windows over budget in a row */
+	bool throttled;
+	int priority;				/* Priority before the throttle */
+};
+#endif
+
 static task_monitor_node_t g_monitored_tasks_list[CONFIG_MAX_TASKS];
 static task_monitor_node_queue_t g_que_list[TASK_MONITOR_CHECK_TIME];
 static int g_monitor_cnt;
 static sem_t g_stop_sem;
 
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+static struct task_monitor_budget_s g_budgets[CONFIG_MAX_TASKS];
+static int g_budget_cnt;
+
+/* The cycle counts at the start of the window.  g_cycles, read at its end,
+ * is large with the counts of the interrupts, hence not on the stack.
+ */
+
+static struct cpuload_cycles_s g_cycles;
+static pid_t g_last_pid[CONFIG_MAX_TASKS];
+static uint64_t g_last_task[CONFIG_MAX_TASKS];
+static uint64_t g_last_total;
+static bool g_last_valid;
+static bool g_overloaded;
+
+/* Events not yet taken by the notifier, which is signaled when the first
+ * is queued: it takes them all.
+ */
+
+static struct task_monitor_event_s g_events[TASK_MONITOR_NEVENTS];
+static uint8_t g_event_head;
+static uint8_t g_event_cnt;
+static pid_t g_notifier;
+#endif
+
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+static void task_monitor_post_event(int type, pid_t pid, int load, bool throttled)
+{
+	FAR struct task_monitor_event_s *event;
+	irqstate_t flags;
+	bool notify;
+	pid_t notifier;
+
+	flags = enter_critical_section();
+
+	/* A full queue drops the oldest event */
+
+	if (g_event_cnt == TASK_MONITOR_NEVENTS) {
+		g_event_head = (g_event_head + 1) % TASK_MONITOR_NEVENTS;
+		g_event_cnt--;
+	}
+
+	event = &g_events[(g_event_head + g_event_cnt) % TASK_MONITOR_NEVENTS];
+	event->type = type;
+	event->pid = pid;
+	event->load = load;
+	event->throttled = throttled;
+
+	notify = (g_event_cnt++ == 0);
+	notifier = g_notifier;
+	leave_critical_section(flags);
+
+	if (notify && notifier > 0) {
+#ifdef CONFIG_CAN_PASS_STRUCTS
+		union sigval value;
+
+		value.sival_int = type;
+		(void)sigqueue(notifier, SIGTM_MONITOR, value);
+#else
+		(void)sigqueue(notifier, SIGTM_MONITOR, (FAR void *)(uintptr_t)type);
+#endif
+	}
+}
+
+static void task_monitor_restore(int slot)
+{
+	struct sched_param param;
+
+	if (g_budgets[slot].throttled) {
+		param.sched_priority = g_budgets[slot].priority;
+		(void)sched_setparam(g_budgets[slot].pid, &param);
+		g_budgets[slot].throttled = false;
+	}
+}
+
+/* Measure the CPU time of the tasks over the window which ends, and report
+ * the tasks over their budget and an overload.
+ */
+
+static void task_monitor_check_budgets(void)
+{
+	FAR struct task_monitor_budget_s *budget;
+	struct sched_param param;
+	uint64_t total;
+	uint64_t delta;
+	uint64_t idle;
+	int load;
+	int slot;
+
+	sched_get_cycles(&g_cycles);
+
+	/* The counts go back when sched_reset_cycles() clears them */
+
+	total = g_cycles.total >= g_last_total ? g_cycles.total - g_last_total : g_cycles.total;
+	idle = 0;
+
+	for (slot = 0; slot < CONFIG_MAX_TASKS; slot++) {
+		if (g_cycles.pid[slot] != g_last_pid[slot] || g_cycles.task[slot] < g_last_task[slot]) {
+			delta = g_cycles.task[slot];
+		} else {
+			delta = g_cycles.task[slot] - g_last_task[slot];
+		}
+
+		g_last_pid[slot] = g_cycles.pid[slot];
+		g_last_task[slot] = g_cycles.task[slot];
+
+		if (!g_last_valid || total == 0 || g_cycles.pid[slot] < 0) {
+			continue;
+		}
+
+		/* The idle tasks are PIDs 0 to CONFIG_SMP_NCPUS - 1 */
+
+		if (g_cycles.pid[slot] < CONFIG_SMP_NCPUS) {
+			idle += delta;
+			continue;
+		}
+
+		budget = &g_budgets[slot];
+		if (budget->percent == 0 || budget->pid != g_cycles.pid[slot]) {
+			continue;
+		}
+
+		/* In percent of one CPU, 'total' being the time of all of them */
+
+		load = (int)(delta * 100 * CONFIG_SMP_NCPUS / total);
+		if (load <= budget->percent) {
+			budget->strikes = 0;
+			task_monitor_restore(slot);
+			continue;
+		}
+
+		if (budget->strikes < CONFIG_TASK_MONITOR_BUDGET_STRIKES) {
+			if (++budget->strikes < CONFIG_TASK_MONITOR_BUDGET_STRIKES) {
+				continue;
+			}
+
+			/* Reported once, when it reaches the strikes */
+
+#if CONFIG_TASK_MONITOR_THROTTLE_PRIORITY > 0
+			if (!budget->throttled && sched_getparam(budget->pid, &param) == OK && param.sched_priority > CONFIG_TASK_MONITOR_THROTTLE_PRIORITY) {
+				budget->priority = param.sched_priority;
+				param.sched_priority = CONFIG_TASK_MONITOR_THROTTLE_PRIORITY;
+				if (sched_setparam(budget->pid, &param) == OK) {
+					budget->throttled = true;
+				}
+			}
+#else
+			(void)param;
+#endif
+			task_monitor_post_event(TASK_MONITOR_EVENT_OVERRUN, budget->pid, load, budget->throttled);
+		}
+	}
+
+#if CONFIG_TASK_MONITOR_OVERLOAD_PERCENT > 0
+	/* Reported when it starts */
+
+	if (g_last_valid && total > 0) {
+		load = idle < total ? (int)((total - idle) * 100 / total) : 0;
+		if (load <= CONFIG_TASK_MONITOR_OVERLOAD_PERCENT) {
+			g_overloaded = false;
+		} else if (!g_overloaded) {
+			g_overloaded = true;
+			task_monitor_post_event(TASK_MONITOR_EVENT_OVERLOAD, -1, load, false);
+		}
+	}
+#endif
+
+	g_last_total = g_cycles.total;
+	g_last_valid = true;
+}
+
+/* Whether the monitor has anything to do */
+
+static bool task_monitor_busy(void)
+{
+	if (g_monitor_cnt > 0 || g_budget_cnt > 0) {
+		return true;
+	}
+
+#if CONFIG_TASK_MONITOR_OVERLOAD_PERCENT > 0
+	return g_notifier > 0;
+#else
+	return false;
+#endif
+}
+
+int task_monitor_budget_register(int pid, int percent)
+{
+	FAR struct task_monitor_budget_s *budget;
+	int hash_pid;
+
+	if (percent < 0 || percent > 100) {
+		return -EINVAL;
+	}
+
+	hash_pid = PIDHASH(pid);
+	budget = &g_budgets[hash_pid];
+
+	/* A slot left by an exited task */
+
+	if (budget->percent != 0 && budget->pid != pid) {
+		budget->percent = 0;
+		budget->throttled = false;
+		g_budget_cnt--;
+	}
+
+	if (percent == 0) {
+		if (budget->percent != 0) {
+			task_monitor_restore(hash_pid);
+			budget->percent = 0;
+			g_budget_cnt--;
+		}
+		return OK;
+	}
+
+	if (budget->percent == 0) {
+		budget->pid = pid;
+		budget->strikes = 0;
+		budget->throttled = false;
+		if (++g_budget_cnt == 1 && g_monitor_cnt == 0) {
+			sem_post(&g_stop_sem);
+		}
+	}
+
+	budget->percent = percent;
+	return OK;
+}
+
+int task_monitor_set_notifier(int pid)
+{
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	g_notifier = pid;
+	leave_critical_section(flags);
+
+	sem_post(&g_stop_sem);
+	return OK;
+}
+
+int task_monitor_get_event(FAR struct task_monitor_event_s *event)
+{
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	if (g_event_cnt == 0) {
+		leave_critical_section(flags);
+		return -ENOENT;
+	}
+
+	*event = g_events[g_event_head];
+	g_event_head = (g_event_head + 1) % TASK_MONITOR_NEVENTS;
+	g_event_cnt--;
+	leave_critical_section(flags);
+
+	return OK;
+}
+#endif
+
 int task_monitor_register_list(int pid, int interval)
 {
 	if (interval < CONFIG_TASK_MONITOR_INTERVAL || CONFIG_TASK_MONITOR_MAX_INTERVAL < interval) {
@@ -53,6 +347,7 @@ int task_monitor_register_list(int pid, int interval)
 	}
 
 	g_monitored_tasks_list[hash_pid].pid = pid;
+	g_monitored_tasks_list[hash_pid].missed = false;
 	if (interval % CONFIG_TASK_MONITOR_INTERVAL == 0) {
 		g_monitored_tasks_list[hash_pid].interval = interval / CONFIG_TASK_MONITOR_INTERVAL;
 	} else {
@@ -66,7 +361,11 @@ int task_monitor_register_list(int pid, int interval)
 	dq_addlast((FAR dq_entry_t *)&g_monitored_tasks_list[hash_pid], &g_que_list[g_monitored_tasks_list[hash_pid].interval - 1].q);
 
 	g_monitor_cnt++;
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+	if (g_monitor_cnt == 1 && g_budget_cnt == 0) {
+#else
 	if (g_monitor_cnt == 1) {
+#endif
 		sem_post(&g_stop_sem);
 	}
 	return OK;
@@ -78,6 +377,14 @@ void task_monitor_unregester_list(int pid)
 	int interval;
 	hash_pid = PIDHASH(pid);
 
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+	if (g_budgets[hash_pid].percent != 0 && g_budgets[hash_pid].pid == pid) {
+		g_budgets[hash_pid].percent = 0;
+		g_budgets[hash_pid].throttled = false;
+		g_budget_cnt--;
+	}
+#endif
+
 	if (g_monitored_tasks_list[hash_pid].interval == 0) {
 		/* Not registered. */
 		return;
@@ -109,6 +416,7 @@ static void task_monitor_init(void)
 		g_monitored_tasks_list[pid_idx].blink = NULL;
 		g_monitored_tasks_list[pid_idx].pid = 0;
 		g_monitored_tasks_list[pid_idx].interval = 0;
+		g_monitored_tasks_list[pid_idx].missed = false;
 	}
 
 	g_monitor_cnt = 0;
@@ -122,11 +430,46 @@ int task_monitor(int argc, char *argv[])
 	int time_idx;
 	struct tcb_s *tcb;
 	task_monitor_node_t *next_mon_node;
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+	struct timespec window;
+	int elapsed_ms = 0;
+#endif
 
 	task_monitor_init();
+	(void)prctl(PR_SET_TIMERSLACK, TASK_MONITOR_TIMER_SLACK_MS);
 
 	while (1) {
 
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+		if (!task_monitor_busy()) {
+			while (sem_wait(&g_stop_sem) < 0);
+
+			/* The first window after the wait only takes the counts */
+
+			g_last_valid = false;
+		}
+
+		/* The budgets are checked each window and the alive status each
+		 * CONFIG_TASK_MONITOR_INTERVAL, counted in windows.
+		 */
+
+		window.tv_sec = CONFIG_TASK_MONITOR_BUDGET_WINDOW / 1000;
+		window.tv_nsec = (CONFIG_TASK_MONITOR_BUDGET_WINDOW % 1000) * 1000000;
+		if (nanosleep(&window, NULL) < 0) {
+			/* Wake up because of signal.
+			 * In this case, reset the window again.
+			 */
+			continue;
+		}
+
+		task_monitor_check_budgets();
+
+		elapsed_ms += CONFIG_TASK_MONITOR_BUDGET_WINDOW;
+		if (elapsed_ms < CONFIG_TASK_MONITOR_INTERVAL * 1000) {
+			continue;
+		}
+		elapsed_ms = 0;
+#else
 		if (g_monitor_cnt == 0) {
 			/* if g_monitor_cnt is 0,
 			 * task_monitor is not working.
@@ -140,6 +483,7 @@ int task_monitor(int argc, char *argv[])
 			 */
 			continue;
 		}
+#endif
 
 		/* Check if registered tasks/pthread is alive or not.
 		 * If one of them is not alive, task monitor resets the system.
@@ -155,6 +499,17 @@ int task_monitor(int argc, char *argv[])
 					tcb = sched_gettcb(next_mon_node->pid);
 
 					if (tcb == NULL || tcb->is_active == false) {
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+						/* With a listener, the first miss is reported and
+						 * the task has one more interval to recover.
+						 */
+						if (tcb != NULL && g_notifier > 0 && !next_mon_node->missed) {
+							next_mon_node->missed = true;
+							task_monitor_post_event(TASK_MONITOR_EVENT_DEADLINE_MISS, next_mon_node->pid, 0, false);
+							next_mon_node = (task_monitor_node_t *)dq_next(next_mon_node);
+							continue;
+						}
+#endif
 						/* Invalid operation and
 						*  There is not alive task/pthread.
 						*  System will be reset.
@@ -166,6 +521,7 @@ int task_monitor(int argc, char *argv[])
 					} else {
 						/* Reset the registered task's/pthread's active flag. */
 						tcb->is_active = false;
+						next_mon_node->missed = false;
 					}
 					next_mon_node = (task_monitor_node_t *)dq_next(next_mon_node);
 				}
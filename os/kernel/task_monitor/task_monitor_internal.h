@@ -23,6 +23,7 @@
  * Included Files
  ****************************************************************************/
 #include <queue.h>
+#include <stdbool.h>
 
 #ifdef CONFIG_TASK_MONITOR
 
@@ -33,6 +34,7 @@ struct task_monitor_node_s {
 	FAR struct task_monitor_node_s *blink;
 	int pid;				/* tcb's pid */
 	int interval;
+	bool missed;			/* The last check found it inactive */
 };
 
 typedef struct task_monitor_node_s task_monitor_node_t;
@@ -50,5 +52,11 @@ typedef struct task_monitor_node_queue_s task_monitor_node_queue_t;
 int task_monitor(int argc, char *argv[]);
 int task_monitor_register_list(int pid, int interval);
 void task_monitor_unregester_list(int pid);
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+struct task_monitor_event_s;
+int task_monitor_budget_register(int pid, int percent);
+int task_monitor_set_notifier(int pid);
+int task_monitor_get_event(FAR struct task_monitor_event_s *event);
+#endif
 #endif							/* CONFIG_TASK_MONITOR */
 #endif							/* __SCHED_TASK_MONITOR_TASK_MONITOR_INTERNAL_H */
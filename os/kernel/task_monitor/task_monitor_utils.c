@@ -18,6 +18,7 @@
 /****************************************************************************
  * Included Files
  ****************************************************************************/
+#include <tinyara/config.h>
 #include <sys/prctl.h>
 #include <sys/types.h>
 
@@ -30,3 +31,10 @@ void task_monitor_update_status(void)
 {
 	prctl(PR_MONITOR_UPDATE, NULL);
 }
+
+#ifdef CONFIG_TASK_MONITOR_BUDGET
+int task_monitor_set_budget(int percent)
+{
+	return prctl(PR_MONITOR_SET_BUDGET, percent);
+}
+#endif
@@ -108,8 +108,12 @@
 
 int wd_cancel(WDOG_ID wdog)
 {
+#ifndef CONFIG_WDOG_TIMER_WHEEL
 	FAR struct wdog_s *curr;
 	FAR struct wdog_s *prev;
+#elif defined(CONFIG_SCHED_TICKLESS)
+	bool first;
+#endif
 	irqstate_t state;
 	int ret = ERROR;
 
@@ -124,6 +128,21 @@ int wd_cancel(WDOG_ID wdog)
 	 */
 
 	if (wdog && WDOG_ISACTIVE(wdog)) {
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+		/* The interval timer is reassessed when the next expiration is
+		 * cancelled, as when the head of the list is.
+		 */
+
+#ifdef CONFIG_SCHED_TICKLESS
+		first = (wd_wheel_remaining(wdog) == wd_wheel_nextdelay());
+#endif
+		wd_wheel_remove(wdog);
+#ifdef CONFIG_SCHED_TICKLESS
+		if (first) {
+			sched_timer_reassess();
+		}
+#endif
+#else
 		/* Search the g_wdactivelist for the target FCB.  We can't use sq_rem
 		 * to do this because there are additional operations that need to be
 		 * done.
@@ -168,6 +187,7 @@ int wd_cancel(WDOG_ID wdog)
 
 			sched_timer_reassess();
 		}
+#endif
 
 		/* Mark the watchdog inactive */
 
@@ -61,7 +61,7 @@
 
 #include <tinyara/arch.h>
 #include <tinyara/wdog.h>
-#include <tinyara/kmalloc.h>
+#include <tinyara/mm/mempool.h>
 
 #include "wdog/wdog.h"
 
@@ -110,63 +110,21 @@
 WDOG_ID wd_create(void)
 {
 	FAR struct wdog_s *wdog;
-	irqstate_t state;
 
-	/* These actions must be atomic with respect to other tasks and also with
-	 * respect to interrupt handlers that may be allocating or freeing watchdog
-	 * timers.
+	/* The pool is safe to use from interrupt handlers.  It lets them take
+	 * the timers in reserve and grows from the heap only for tasks.
 	 */
 
-	state = enter_critical_section();
+	wdog = (FAR struct wdog_s *)mempool_alloc(&g_wdfreepool);
 
-	/* If we are in an interrupt handler -OR- if the number of pre-allocated
-	 * timer structures exceeds the reserve, then take the next timer from
-	 * the head of the free list.
-	 */
-
-	if (g_wdnfree > CONFIG_WDOG_INTRESERVE || up_interrupt_context()) {
-		/* Remove the watchdog timer from the free list and decrement the
-		 * count of free timers all with interrupts disabled.
-		 */
-
-		wdog = (FAR struct wdog_s *)sq_remfirst(&g_wdfreelist);
-
-		/* Did we get one? */
-
-		if (wdog) {
-			DEBUGASSERT(g_wdnfree > 0);
-			g_wdnfree--;
-
-			/* Yes.. Clear the forward link and all flags */
-
-			wdog->next = NULL;
-			wdog->flags = 0;
-		} else {
-			/* If wdog is Null, g_wdnfree must be zero, else assert */
-			DEBUGASSERT(g_wdnfree == 0);
-		}
-		leave_critical_section(state);
-	}
-
-	/* We are in a normal tasking context AND there are not enough unreserved,
-	 * pre-allocated watchdog timers.  We need to allocate one from the kernel
-	 * heap.
-	 */
-
-	else {
-		/* We do not require that interrupts be disabled to do this. */
-
-		leave_critical_section(state);
-		wdog = (FAR struct wdog_s *)kmm_malloc(sizeof(struct wdog_s));
-
-		/* Did we get one? */
+	/* Did we get one? */
 
-		if (wdog) {
-			/* Yes.. Clear the forward link and set the allocated flag */
+	if (wdog) {
+		/* Yes.. Clear the forward link and all flags */
 
-			wdog->next = NULL;
-			wdog->flags = WDOGF_ALLOCED;
-		}
+		wdog->next = NULL;
+		wdog->flags = 0;
+		wdog->slack = 0;
 	}
 
 	return (WDOG_ID)wdog;
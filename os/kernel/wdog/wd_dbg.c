@@ -53,21 +53,15 @@ static inline void wd_dump(struct wdog_s *wdog)
 
 void wd_corruption_dbg(struct wdog_s *wdog)
 {
-	uint32_t wd_node;
 	lldbg("WDOG INFO\n");
 	wd_dump(wdog);
 
 	if (mm_get_heap(wdog)) {
+		/* Wdog struct is in a chunk which the wdog pool took from the heap.
+		 * It has no heap node of its own, so there are no neighbours to show.
+		 */
 
-#ifdef CONFIG_DEBUG_MM_HEAPINFO
-		// Wdog struct is in heap
-		lldbg("WDOG is in HEAP. Print neighbour heap nodes\n");
-		wd_node = (uint32_t)wdog - SIZEOF_MM_ALLOCNODE;
-		lldbg("PREV WDOG INFO\n");
-		mm_dump_node((struct mm_allocnode_s *)(wd_node - (((struct mm_allocnode_s *)wd_node)->preceding & ~MM_ALLOC_BIT)), "PREV HEAP NODE");
-		lldbg("NEXT WDOG INFO\n");
-		mm_dump_node((struct mm_allocnode_s *)(wd_node + ((struct mm_allocnode_s *)wd_node)->size), "NEXT HEAP NODE");
-#endif
+		lldbg("WDOG is in HEAP, in an expansion of the wdog pool\n");
 
 	} else if (wd_is_prealloc(wdog)) {
 		// Wdog struct is from prealloc list
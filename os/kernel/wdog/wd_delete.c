@@ -62,7 +62,7 @@
 
 #include <tinyara/arch.h>
 #include <tinyara/wdog.h>
-#include <tinyara/kmalloc.h>
+#include <tinyara/mm/mempool.h>
 
 #include "wdog/wdog.h"
 
@@ -130,43 +130,16 @@ int wd_delete(WDOG_ID wdog)
 		wd_cancel(wdog);
 	}
 
-	/* Did this watchdog come from the pool of pre-allocated timers?  Or, was
-	 * it allocated from the heap?
+	/* Return the timer to the pool.  This function should not be called for
+	 * statically allocated timers, but there is no guarantee of that as
+	 * wd_delete is a global function, so they are just left alone.
 	 */
 
-	if (WDOG_ISALLOCED(wdog)) {
-		/* It was allocated from the heap.  Use sched_kfree() to release the
-		 * memory.  If the timer was released from an interrupt handler,
-		 * sched_kfree() will defer the actual deallocation of the memory
-		 * until a more appropriate time.
-		 *
-		 * We don't need interrupts disabled to do this.
-		 */
-
-		leave_critical_section(state);
-		sched_kfree(wdog);
+	if (!WDOG_ISSTATIC(wdog)) {
+		mempool_free(&g_wdfreepool, wdog);
 	}
 
-	/* This was a pre-allocated timer.  This function should not be called for
-	 * statically allocated timers.
-	 */
-
-	else if (!WDOG_ISSTATIC(wdog)) {
-		/* Put the timer back on the free list and increment the count of free
-		 * timers, all with interrupts disabled.
-		 */
-
-		sq_addlast((FAR sq_entry_t *)wdog, &g_wdfreelist);
-		g_wdnfree++;
-		DEBUGASSERT(g_wdnfree <= CONFIG_PREALLOC_WDOGS);
-		leave_critical_section(state);
-	} else {
-		/* There is no guarantee that, this API is not called for statically
-		 * allocated timers as wd_delete is a global function. So restore the
-		 * irq properly so that it does not break the system */
-
-		leave_critical_section(state);
-	}
+	leave_critical_section(state);
 
 	/* Return success */
 
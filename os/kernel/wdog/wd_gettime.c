@@ -110,6 +110,12 @@ int wd_gettime(WDOG_ID wdog)
 
 	flags = enter_critical_section();
 	if (wdog && WDOG_ISACTIVE(wdog)) {
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+		int delay = wd_wheel_remaining(wdog);
+
+		leave_critical_section(flags);
+		return delay;
+#else
 		/* Traverse the watchdog list accumulating lag times until we find the wdog
 		 * that we are looking for
 		 */
@@ -124,6 +130,7 @@ int wd_gettime(WDOG_ID wdog)
 				return delay;
 			}
 		}
+#endif
 	}
 
 	leave_critical_section(flags);
@@ -150,6 +157,10 @@ int wd_gettime(WDOG_ID wdog)
 
 int wd_getdelay(void)
 {
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+	return wd_wheel_nextdelay();
+#else
 	return (g_wdactivelist.head) ? ((FAR struct wdog_s *)g_wdactivelist.head)->lag : 0;
+#endif
 }
 #endif
@@ -67,6 +67,15 @@
 
 clock_t wd_getwakeupdelay(void)
 {
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+	clock_t delay;
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	delay = wd_wheel_wakeupdelay();
+	leave_critical_section(flags);
+	return delay;
+#else
 	clock_t delay = 0;
 	struct wdog_s *curr;
 	irqstate_t flags;
@@ -82,4 +91,5 @@ clock_t wd_getwakeupdelay(void)
 
 	leave_critical_section(flags);
 	return 0;
+#endif
 }
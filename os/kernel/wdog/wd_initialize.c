@@ -56,8 +56,11 @@
 
 #include <tinyara/config.h>
 
+#include <string.h>
 #include <queue.h>
 
+#include <tinyara/mm/mempool.h>
+
 #include "wdog/wdog.h"
 
 /************************************************************************
@@ -72,32 +75,33 @@
  * Public Variables
  ************************************************************************/
 
-/* The g_wdfreelist data structure is a singly linked list of watchdogs
- * available to the system for delayed function use.
+/* The g_wdfreepool is the pool of watchdogs available to the system for
+ * delayed function use.
  */
 
-sq_queue_t g_wdfreelist;
+struct mempool_s g_wdfreepool;
+
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+/* The g_wdwheel holds the active watchdogs in the slots of their
+ * expiration time.
+ */
 
+struct wd_wheel_s g_wdwheel;
+#else
 /* The g_wdactivelist data structure is a singly linked list ordered by
  * watchdog expiration time. When watchdog timers expire,the functions on
  * this linked list are removed and the function is called.
  */
 
 sq_queue_t g_wdactivelist;
-
-/* This is the number of free, pre-allocated watchdog structures in the
- * g_wdfreelist.  This value is used to enforce a reserve for interrupt
- * handlers.
- */
-
-uint16_t g_wdnfree;
+#endif
 
 /************************************************************************
  * Private Data
  ************************************************************************/
 
-/* g_wdpool is a list of pre-allocated watchdogs. The number of watchdogs
-* in the pool is a configuration item.
+/* g_wdpool is the storage of the pre-allocated watchdogs of g_wdfreepool.
+ * The number of watchdogs in the pool is a configuration item.
  */
 
 static struct wdog_s g_wdpool[CONFIG_PREALLOC_WDOGS];
@@ -161,23 +165,25 @@ bool wd_is_prealloc(WDOG_ID wdog)
 
 void wd_initialize(void)
 {
-	FAR struct wdog_s *wdog = g_wdpool;
-	int i;
-
 	/* Initialize watchdog lists */
 
-	sq_init(&g_wdfreelist);
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+	memset(&g_wdwheel, 0, sizeof(struct wd_wheel_s));
+#else
 	sq_init(&g_wdactivelist);
+#endif
 
-	/* The g_wdfreelist must be loaded at initialization time to hold the
-	 * configured number of watchdogs.
+	/* The pool starts with the pre-allocated watchdogs and grows from the
+	 * heap when they run out.  CONFIG_WDOG_INTRESERVE of them are kept for
+	 * interrupt handlers, which cannot grow the pool.
 	 */
 
-	for (i = 0; i < CONFIG_PREALLOC_WDOGS; i++) {
-		sq_addlast((FAR sq_entry_t *)wdog++, &g_wdfreelist);
-	}
-
-	/* All watchdogs are free */
+	g_wdfreepool.blocksize = sizeof(struct wdog_s);
+	g_wdfreepool.ninitial = CONFIG_PREALLOC_WDOGS;
+	g_wdfreepool.nexpand = CONFIG_WDOG_POOL_EXPAND;
+	g_wdfreepool.nreserve = CONFIG_WDOG_INTRESERVE;
+	g_wdfreepool.flags = MEMPOOL_FLAG_IRQSAFE;
+	g_wdfreepool.storage = g_wdpool;
 
-	g_wdnfree = CONFIG_PREALLOC_WDOGS;
+	(void)mempool_initialize(&g_wdfreepool, "wdog");
 }
@@ -0,0 +1,63 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <tinyara/wdog.h>
+#include <errno.h>
+#include <stdint.h>
+
+#include "wdog/wdog.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_setslack
+ *
+ * Description:
+ *   The wd_setslack function lets wd_start() defer the expiration of the
+ *   watchdog by up to 'slack' ticks, so that it expires together with
+ *   another watchdog instead of waking the CPU on its own.  The watchdog
+ *   never expires earlier than requested.  A slack of zero, the default,
+ *   makes it expire exactly on time.
+ *
+ *   The slack applies from the next wd_start().
+ *
+ * Parameters:
+ *   wdog  - ID of the watchdog.
+ *   slack - The acceptable delay in clock ticks.
+ *
+ * Return Value:
+ *   Returns OK or ERROR
+ *
+ ****************************************************************************/
+
+int wd_setslack(WDOG_ID wdog, int slack)
+{
+	if (!wdog || slack < 0 || slack > UINT16_MAX) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	wdog->slack = (uint16_t)slack;
+	return OK;
+}
@@ -128,6 +128,7 @@ typedef void (*wdentry4_t)(int argc, uint32_t arg1, uint32_t arg2, uint32_t arg3
  *
  ****************************************************************************/
 
+#ifndef CONFIG_WDOG_TIMER_WHEEL
 static inline void wd_expiration(void)
 {
 	FAR struct wdog_s *wdog;
@@ -152,52 +153,117 @@ static inline void wd_expiration(void)
 				((FAR struct wdog_s *)g_wdactivelist.head)->lag += wdog->lag;
 			}
 
-			/* Indicate that the watchdog is no longer active. */
+			/* Execute the watchdog function */
 
-			WDOG_CLRACTIVE(wdog);
+			wd_dispatch(wdog);
+		}
+	}
+}
 
-			/* Execute the watchdog function */
+/****************************************************************************
+ * Name: wd_coalesce
+ *
+ * Description:
+ *   Find the earliest expiration already in the timer queue within
+ *   [delay, delay + slack], so that the new watchdog is batched with it
+ *   into one timer event.
+ *
+ * Parameters:
+ *   delay - The requested delay, relative to now
+ *   slack - The acceptable deferral of the expiration
+ *
+ * Return Value:
+ *   The delay to use, which is never less than the requested one.
+ *
+ * Assumptions:
+ *   Called from within a critical section.
+ *
+ ****************************************************************************/
 
-			up_setpicbase(wdog->picbase);
-			switch (wdog->argc) {
-			default:
-				wd_corruption_dbg(wdog);
-				DEBUGPANIC();
-				break;
+static int wd_coalesce(int delay, int slack)
+{
+	FAR struct wdog_s *curr;
+	int32_t now = 0;
+
+	for (curr = (FAR struct wdog_s *)g_wdactivelist.head; curr; curr = curr->next) {
+		now += curr->lag;
+		if (now >= delay) {
+			/* The first expiration not before the requested one */
+
+			if (now - delay <= slack) {
+				return now;
+			}
+			break;
+		}
+	}
+
+	return delay;
+}
+#endif							/* !CONFIG_WDOG_TIMER_WHEEL */
 
-			case 0:
-				(*((wdentry0_t)(wdog->func)))(0);
-				break;
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_dispatch
+ *
+ * Description:
+ *   Mark an expired watchdog inactive and call its function.
+ *
+ * Parameters:
+ *   wdog - The watchdog, already removed from the timer queue
+ *
+ * Return Value:
+ *   None
+ *
+ * Assumptions:
+ *   Called from interrupt handler logic with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void wd_dispatch(FAR struct wdog_s *wdog)
+{
+	/* Indicate that the watchdog is no longer active. */
+
+	WDOG_CLRACTIVE(wdog);
+
+	/* Execute the watchdog function */
+
+	up_setpicbase(wdog->picbase);
+	switch (wdog->argc) {
+	default:
+		wd_corruption_dbg(wdog);
+		DEBUGPANIC();
+		break;
+
+	case 0:
+		(*((wdentry0_t)(wdog->func)))(0);
+		break;
 
 #if CONFIG_MAX_WDOGPARMS > 0
-			case 1:
-				(*((wdentry1_t)(wdog->func)))(1, wdog->parm[0]);
-				break;
+	case 1:
+		(*((wdentry1_t)(wdog->func)))(1, wdog->parm[0]);
+		break;
 #endif
 #if CONFIG_MAX_WDOGPARMS > 1
-			case 2:
-				(*((wdentry2_t)(wdog->func)))(2, wdog->parm[0], wdog->parm[1]);
-				break;
+	case 2:
+		(*((wdentry2_t)(wdog->func)))(2, wdog->parm[0], wdog->parm[1]);
+		break;
 #endif
 #if CONFIG_MAX_WDOGPARMS > 2
-			case 3:
-				(*((wdentry3_t)(wdog->func)))(3, wdog->parm[0], wdog->parm[1], wdog->parm[2]);
-				break;
+	case 3:
+		(*((wdentry3_t)(wdog->func)))(3, wdog->parm[0], wdog->parm[1], wdog->parm[2]);
+		break;
 #endif
 #if CONFIG_MAX_WDOGPARMS > 3
-			case 4:
-				(*((wdentry4_t)(wdog->func)))(4, wdog->parm[0], wdog->parm[1], wdog->parm[2], wdog->parm[3]);
-				break;
+	case 4:
+		(*((wdentry4_t)(wdog->func)))(4, wdog->parm[0], wdog->parm[1], wdog->parm[2], wdog->parm[3]);
+		break;
 #endif
-			}
-		}
 	}
 }
 
-/****************************************************************************
- * Public Functions
- ****************************************************************************/
-
 /****************************************************************************
  * Name: wd_start
  *
@@ -234,10 +300,12 @@ static inline void wd_expiration(void)
 int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 {
 	va_list ap;
+#ifndef CONFIG_WDOG_TIMER_WHEEL
 	FAR struct wdog_s *curr;
 	FAR struct wdog_s *prev;
 	FAR struct wdog_s *next;
 	int32_t now;
+#endif
 	irqstate_t state;
 	int i;
 
@@ -298,6 +366,21 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 	(void)sched_timer_cancel();
 #endif
 
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+	if (wdog->slack > 0) {
+		delay = wd_wheel_coalesce(delay, wdog->slack);
+	}
+
+	wd_wheel_insert(wdog, delay);
+#else
+	/* A watchdog with slack expires together with another one if possible.
+	 * It then goes behind it in the queue, with a zero lag.
+	 */
+
+	if (wdog->slack > 0) {
+		delay = wd_coalesce(delay, wdog->slack);
+	}
+
 	/* Do the easy case first -- when the watchdog timer queue is empty. */
 
 	if (g_wdactivelist.head == NULL) {
@@ -369,9 +452,13 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 		}
 	}
 
-	/* Put the lag into the watchdog structure and mark it as active. */
+	/* Put the lag into the watchdog structure */
 
 	wdog->lag = delay;
+#endif
+
+	/* Mark the watchdog as active. */
+
 	WDOG_SETACTIVE(wdog);
 
 #ifdef CONFIG_SCHED_TICKLESS
@@ -412,6 +499,7 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
  *
  ****************************************************************************/
 
+#ifndef CONFIG_WDOG_TIMER_WHEEL
 #ifdef CONFIG_SCHED_TICKLESS
 unsigned int wd_timer(int ticks)
 {
@@ -491,3 +579,4 @@ void wd_timer_nohz(clock_t ticks)
 	}
 }
 #endif
+#endif							/* !CONFIG_WDOG_TIMER_WHEEL */
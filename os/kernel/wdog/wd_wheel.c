@@ -0,0 +1,439 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/wdog.h>
+
+#include "sched/sched.h"
+#include "wdog/wdog.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define WD_WHEEL_SHIFT(level)  ((level) * WD_WHEEL_BITS)
+#define WD_WHEEL_HEAD(n)       (&g_wdwheel.slot[(n)])
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Rotate the map of a level so that bit n is the n-th slot from 'index' */
+
+static inline uint32_t wd_wheel_rotate(uint32_t map, int index)
+{
+	return index ? (map >> index) | (map << (WD_WHEEL_SIZE - index)) : map;
+}
+
+/* Append a watchdog to the list of a slot */
+
+static void wd_wheel_append(FAR struct wdog_s *wdog, int slot)
+{
+	FAR struct wdog_s **head = WD_WHEEL_HEAD(slot);
+	FAR struct wdog_s *tail;
+
+	if (*head == NULL) {
+		wdog->next = wdog;
+		wdog->prev = wdog;
+		*head = wdog;
+	} else {
+		tail = (*head)->prev;
+		wdog->next = *head;
+		wdog->prev = tail;
+		tail->next = wdog;
+		(*head)->prev = wdog;
+	}
+
+	wdog->slot = (uint8_t)slot;
+}
+
+/* Remove a watchdog from the list of its slot */
+
+static void wd_wheel_unlink(FAR struct wdog_s *wdog)
+{
+	FAR struct wdog_s **head = WD_WHEEL_HEAD(wdog->slot);
+
+	if (wdog->next == wdog) {
+		*head = NULL;
+		if (wdog->slot < WD_WHEEL_NSLOTS) {
+			g_wdwheel.map[wdog->slot >> WD_WHEEL_BITS] &= ~(1u << (wdog->slot & WD_WHEEL_MASK));
+		}
+	} else {
+		wdog->prev->next = wdog->next;
+		wdog->next->prev = wdog->prev;
+		if (*head == wdog) {
+			*head = wdog->next;
+		}
+	}
+}
+
+/* Put a watchdog in the slot of its expiration, at the lowest level whose
+ * slots, starting from the current one, reach it.
+ */
+
+static void wd_wheel_link(FAR struct wdog_s *wdog)
+{
+	uint32_t expiry = (uint32_t)wdog->lag;
+	uint32_t delta = expiry - g_wdwheel.base;
+	int level = 0;
+	int index;
+
+	if (delta >= WD_WHEEL_RANGE) {
+		/* Parked in the last slot in range, it is put back when this slot
+		 * moves down and goes on until its time is in range.
+		 */
+
+		delta = WD_WHEEL_RANGE - 1;
+		expiry = g_wdwheel.base + delta;
+	}
+
+	while (delta >= ((uint32_t)WD_WHEEL_SIZE << WD_WHEEL_SHIFT(level))) {
+		level++;
+	}
+
+	index = (expiry >> WD_WHEEL_SHIFT(level)) & WD_WHEEL_MASK;
+	wd_wheel_append(wdog, (level << WD_WHEEL_BITS) + index);
+	g_wdwheel.map[level] |= 1u << index;
+}
+
+/* Move the watchdogs of a slot to the levels below */
+
+static void wd_wheel_cascade(int level, int index)
+{
+	FAR struct wdog_s **head = WD_WHEEL_HEAD((level << WD_WHEEL_BITS) + index);
+	FAR struct wdog_s *wdog;
+	FAR struct wdog_s *next;
+
+	if (*head == NULL) {
+		return;
+	}
+
+	wdog = *head;
+	wdog->prev->next = NULL;
+	*head = NULL;
+	g_wdwheel.map[level] &= ~(1u << index);
+
+	for (; wdog; wdog = next) {
+		next = wdog->next;
+		wd_wheel_link(wdog);
+	}
+}
+
+/* Process the tick g_wdwheel.base */
+
+static void wd_wheel_tick(void)
+{
+	FAR struct wdog_s **expired = WD_WHEEL_HEAD(WD_WHEEL_EXPIRED);
+	FAR struct wdog_s *wdog;
+	uint32_t base = g_wdwheel.base;
+	int index = base & WD_WHEEL_MASK;
+	int level;
+
+	/* A new period of a level begins, bring its slot down */
+
+	for (level = 1; level < WD_WHEEL_LEVELS; level++) {
+		if ((base & ((1u << WD_WHEEL_SHIFT(level)) - 1)) != 0) {
+			break;
+		}
+
+		wd_wheel_cascade(level, (base >> WD_WHEEL_SHIFT(level)) & WD_WHEEL_MASK);
+	}
+
+	g_wdwheel.base = base + 1;
+
+	if (g_wdwheel.slot[index] == NULL) {
+		return;
+	}
+
+	/* The expired watchdogs keep a list of their own until they run, so
+	 * that one of them may still cancel another, and a restarted one will
+	 * not be found again in this slot.
+	 */
+
+	*expired = g_wdwheel.slot[index];
+	g_wdwheel.slot[index] = NULL;
+	g_wdwheel.map[0] &= ~(1u << index);
+
+	wdog = *expired;
+	do {
+		wdog->slot = WD_WHEEL_EXPIRED;
+		wdog = wdog->next;
+	} while (wdog != *expired);
+
+	while (*expired) {
+		wdog = *expired;
+		wd_wheel_unlink(wdog);
+		wdog->next = NULL;
+		wd_dispatch(wdog);
+	}
+}
+
+/* Process the ticks up to now, skipping the empty slots of the level 0 up
+ * to the end of its period, where the next cascade takes place.  The
+ * watchdogs restarted by the expired ones are relative to now, not to the
+ * tick being processed.
+ */
+
+static void wd_wheel_advance(void)
+{
+	uint32_t pending;
+	uint32_t ticks;
+	uint32_t step;
+	int index;
+	int level;
+
+	while ((ticks = g_wdwheel.now - g_wdwheel.base) > 0) {
+		for (pending = 0, level = 0; level < WD_WHEEL_LEVELS; level++) {
+			pending |= g_wdwheel.map[level];
+		}
+
+		if (pending == 0) {
+			g_wdwheel.base = g_wdwheel.now;
+			return;
+		}
+
+		index = g_wdwheel.base & WD_WHEEL_MASK;
+		if (index != 0 && (g_wdwheel.map[0] & (1u << index)) == 0) {
+			pending = g_wdwheel.map[0] >> index;
+			step = pending ? __builtin_ctz(pending) : WD_WHEEL_SIZE - index;
+			if (step > ticks) {
+				step = ticks;
+			}
+
+			g_wdwheel.base += step;
+			continue;
+		}
+
+		wd_wheel_tick();
+	}
+}
+
+/* Delta from the base of the earliest expiration of a slot */
+
+static uint32_t wd_wheel_slotmin(int slot, uint32_t best)
+{
+	FAR struct wdog_s *head = g_wdwheel.slot[slot];
+	FAR struct wdog_s *wdog = head;
+	uint32_t delta;
+
+	do {
+		delta = (uint32_t)wdog->lag - g_wdwheel.base;
+		if (delta < best) {
+			best = delta;
+		}
+		wdog = wdog->next;
+	} while (wdog != head);
+
+	return best;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+void wd_wheel_insert(FAR struct wdog_s *wdog, int delay)
+{
+	DEBUGASSERT(delay > 0);
+
+	wdog->lag = (int)(g_wdwheel.now + (uint32_t)delay - 1);
+	wd_wheel_link(wdog);
+}
+
+void wd_wheel_remove(FAR struct wdog_s *wdog)
+{
+	wd_wheel_unlink(wdog);
+}
+
+int wd_wheel_remaining(FAR struct wdog_s *wdog)
+{
+	int32_t remaining = (int32_t)((uint32_t)wdog->lag - g_wdwheel.now) + 1;
+
+	return remaining > 0 ? remaining : 0;
+}
+
+int wd_wheel_nextdelay(void)
+{
+	uint32_t best = UINT32_MAX;
+	uint32_t map;
+	uint32_t start;
+	int32_t delay;
+	int level;
+	int index;
+	int shift;
+	int dist;
+
+	/* The slots of level 0 are single ticks of the next WD_WHEEL_SIZE ones */
+
+	map = g_wdwheel.map[0];
+	if (map != 0) {
+		best = __builtin_ctz(wd_wheel_rotate(map, g_wdwheel.base & WD_WHEEL_MASK));
+	}
+
+	/* In the upper levels, the current slot holds the watchdogs of the next
+	 * round or not yet moved down, so it is always searched.  The others
+	 * are searched in order as long as their period begins before the best
+	 * expiration found, which is only the first one but for the watchdogs
+	 * parked beyond the range of the wheel.
+	 */
+
+	for (level = 1; level < WD_WHEEL_LEVELS; level++) {
+		map = g_wdwheel.map[level];
+		if (map == 0) {
+			continue;
+		}
+
+		shift = WD_WHEEL_SHIFT(level);
+		index = (g_wdwheel.base >> shift) & WD_WHEEL_MASK;
+
+		if (map & (1u << index)) {
+			best = wd_wheel_slotmin((level << WD_WHEEL_BITS) + index, best);
+		}
+
+		for (map = wd_wheel_rotate(map, index) & ~1u; map != 0; map &= map - 1) {
+			dist = __builtin_ctz(map);
+			start = (((g_wdwheel.base >> shift) + dist) << shift) - g_wdwheel.base;
+			if (start >= best) {
+				break;
+			}
+
+			best = wd_wheel_slotmin((level << WD_WHEEL_BITS) + ((index + dist) & WD_WHEEL_MASK), best);
+		}
+	}
+
+	if (best == UINT32_MAX) {
+		return 0;
+	}
+
+	delay = (int32_t)(g_wdwheel.base + best - g_wdwheel.now) + 1;
+	return delay > 0 ? delay : 0;
+}
+
+int wd_wheel_coalesce(int delay, int slack)
+{
+	uint32_t first = g_wdwheel.now - g_wdwheel.base + (uint32_t)delay - 1;
+	uint32_t granule = 1;
+	uint32_t expiry;
+	uint32_t map;
+
+	if (delay > INT32_MAX - slack) {
+		return delay;
+	}
+
+	/* Expire in the same tick as watchdogs of the level 0, if one is in
+	 * [delay, delay + slack]
+	 */
+
+	map = g_wdwheel.map[0];
+	if (first < WD_WHEEL_SIZE && map != 0) {
+		map = wd_wheel_rotate(map, g_wdwheel.base & WD_WHEEL_MASK) & ~((1u << first) - 1);
+		if (map != 0 && __builtin_ctz(map) - first <= (uint32_t)slack) {
+			return delay + (__builtin_ctz(map) - first);
+		}
+	}
+
+	/* Otherwise round the expiration up to the largest period of a level
+	 * within the slack, so that the watchdogs started at different times
+	 * still meet.
+	 */
+
+	while (granule < (WD_WHEEL_RANGE >> WD_WHEEL_BITS) && (granule << WD_WHEEL_BITS) - 1 <= (uint32_t)slack) {
+		granule <<= WD_WHEEL_BITS;
+	}
+
+	if (granule > 1) {
+		expiry = g_wdwheel.base + first;
+		delay += ((expiry + granule - 1) & ~(granule - 1)) - expiry;
+	}
+
+	return delay;
+}
+
+#ifdef CONFIG_SCHED_WAKEUPSOURCE
+clock_t wd_wheel_wakeupdelay(void)
+{
+	FAR struct wdog_s *wdog;
+	uint32_t best = UINT32_MAX;
+	int slot;
+
+	for (slot = 0; slot < WD_WHEEL_NSLOTS; slot++) {
+		wdog = g_wdwheel.slot[slot];
+		if (wdog == NULL) {
+			continue;
+		}
+
+		do {
+			if (WDOG_ISWAKEUP(wdog) && (uint32_t)wdog->lag - g_wdwheel.base < best) {
+				best = (uint32_t)wdog->lag - g_wdwheel.base;
+			}
+			wdog = wdog->next;
+		} while (wdog != g_wdwheel.slot[slot]);
+	}
+
+	if (best == UINT32_MAX || best + 1 <= g_wdwheel.now - g_wdwheel.base) {
+		return 0;
+	}
+
+	return (clock_t)(g_wdwheel.base + best - g_wdwheel.now + 1);
+}
+#endif
+
+/****************************************************************************
+ * Name: wd_timer
+ *
+ * Description:
+ *   The timer wheel version of wd_timer(), see wdog.h.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_TICKLESS
+unsigned int wd_timer(int ticks)
+{
+	if (ticks > 0) {
+		g_wdwheel.now += (uint32_t)ticks;
+		wd_wheel_advance();
+	}
+
+	return (unsigned int)wd_wheel_nextdelay();
+}
+#else
+void wd_timer(void)
+{
+	g_wdwheel.now++;
+	wd_wheel_advance();
+}
+#endif
+
+#ifdef CONFIG_SCHED_TICKSUPPRESS
+void wd_timer_nohz(clock_t ticks)
+{
+	/* The watchdogs due in the meantime expire when the next wd_timer is
+	 * called.
+	 */
+
+	g_wdwheel.now += (uint32_t)ticks;
+}
+#endif
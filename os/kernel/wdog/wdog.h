@@ -64,15 +64,59 @@
 
 #include <tinyara/compiler.h>
 #include <tinyara/wdog.h>
+#include <tinyara/mm/mempool.h>
 
 /************************************************************************
  * Pre-processor Definitions
  ************************************************************************/
 
+/* Number of watchdogs added to the pool when the pre-allocated ones are
+ * exhausted.
+ */
+
+#ifndef CONFIG_WDOG_POOL_EXPAND
+#define CONFIG_WDOG_POOL_EXPAND 4
+#endif
+
+/* CONFIG_WDOG_TIMER_WHEEL keeps the active watchdogs in a hierarchical
+ * timer wheel instead of the list sorted by expiration time, making
+ * wd_start() and wd_cancel() O(1) whatever the number of active watchdogs.
+ * Level n of the wheel has WD_WHEEL_SIZE slots of WD_WHEEL_SIZE^n ticks;
+ * the watchdogs of a slot move down one level when its period begins.
+ */
+
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+#define WD_WHEEL_BITS      5
+#define WD_WHEEL_SIZE      (1 << WD_WHEEL_BITS)
+#define WD_WHEEL_MASK      (WD_WHEEL_SIZE - 1)
+#define WD_WHEEL_LEVELS    5
+#define WD_WHEEL_NSLOTS    (WD_WHEEL_LEVELS * WD_WHEEL_SIZE)
+
+/* Delays beyond the range of the wheel are parked in its last level */
+
+#define WD_WHEEL_RANGE     (1u << (WD_WHEEL_BITS * WD_WHEEL_LEVELS))
+
+/* Slot index of the watchdogs being expired, after the slots of the wheel */
+
+#define WD_WHEEL_EXPIRED   WD_WHEEL_NSLOTS
+#endif
+
 /************************************************************************
  * Public Type Declarations
  ************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+struct wd_wheel_s {
+	uint32_t now;				/* Current tick */
+	uint32_t base;				/* Next tick to be processed, up to now */
+	uint32_t map[WD_WHEEL_LEVELS];	/* Bit n set if slot n of the level is not empty */
+
+	/* Circular lists of watchdogs, the head's prev being the tail */
+
+	FAR struct wdog_s *slot[WD_WHEEL_NSLOTS + 1];
+};
+#endif
+
 /************************************************************************
  * Public Variables
  ************************************************************************/
@@ -84,25 +128,26 @@ extern "C" {
 #define EXTERN extern
 #endif
 
-/* The g_wdfreelist data structure is a singly linked list of watchdogs
- * available to the system for delayed function use.
+/* The g_wdfreepool is the pool of watchdogs available to the system for
+ * delayed function use.
  */
 
-extern sq_queue_t g_wdfreelist;
+extern struct mempool_s g_wdfreepool;
+
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+/* The g_wdwheel holds the active watchdogs in the slots of their
+ * expiration time.
+ */
 
+extern struct wd_wheel_s g_wdwheel;
+#else
 /* The g_wdactivelist data structure is a singly linked list ordered by
  * watchdog expiration time. When watchdog timers expire,the functions on
  * this linked list are removed and the function is called.
  */
 
 extern sq_queue_t g_wdactivelist;
-
-/* This is the number of free, pre-allocated watchdog structures in the
- * g_wdfreelist.  This value is used to enforce a reserve for interrupt
- * handlers.
- */
-
-extern uint16_t g_wdnfree;
+#endif
 
 /************************************************************************
  * Public Function Prototypes
@@ -206,6 +251,51 @@ void wd_corruption_dbg(struct wdog_s *wdog);
 struct tcb_s;
 void wd_recover(FAR struct tcb_s *tcb);
 
+/****************************************************************************
+ * Name: wd_dispatch
+ *
+ * Description:
+ *   Mark an expired watchdog inactive and call its function.
+ *
+ * Assumptions:
+ *   Called from interrupt handler logic with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void wd_dispatch(FAR struct wdog_s *wdog);
+
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+/****************************************************************************
+ * Name: wd_wheel_*
+ *
+ * Description:
+ *   The timer wheel behind wd_start(), wd_cancel() and wd_gettime().
+ *   Delays are counted as by the list: a watchdog with a delay of n ticks
+ *   expires on the n-th call of wd_timer().
+ *
+ *   wd_wheel_insert()    - Queue a watchdog expiring after 'delay' ticks
+ *   wd_wheel_remove()    - Dequeue an active watchdog
+ *   wd_wheel_remaining() - Ticks before an active watchdog expires
+ *   wd_wheel_nextdelay() - Ticks before the next expiration, 0 if none
+ *   wd_wheel_coalesce()  - Defer a delay by up to 'slack' ticks to batch
+ *                          it with other expirations
+ *   wd_wheel_wakeupdelay() - Ticks before the next wakeup source expires
+ *
+ * Assumptions:
+ *   Called from within a critical section.
+ *
+ ****************************************************************************/
+
+void wd_wheel_insert(FAR struct wdog_s *wdog, int delay);
+void wd_wheel_remove(FAR struct wdog_s *wdog);
+int wd_wheel_remaining(FAR struct wdog_s *wdog);
+int wd_wheel_nextdelay(void);
+int wd_wheel_coalesce(int delay, int slack);
+#ifdef CONFIG_SCHED_WAKEUPSOURCE
+clock_t wd_wheel_wakeupdelay(void);
+#endif
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
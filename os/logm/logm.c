@@ -58,10 +58,16 @@ static void logm_flush(struct lib_outstream_s *stream)
 {
 	sched_lock();
 
+#ifdef CONFIG_LOGM_BINARY
+	if (g_logm_rsvbuf) {
+		logm_binary_flush(stream);
+	}
+#else
 	while (g_logm_head != g_logm_tail) {
 		stream->put(stream, g_logm_rsvbuf[g_logm_head]);
 		g_logm_head = (g_logm_head + 1) % logm_bufsize;
 	}
+#endif
 
 	if (LOGM_STATUS(LOGM_BUFFER_OVERFLOW)) {
 		LOGM_STATUS_CLEAR(LOGM_BUFFER_OVERFLOW);
@@ -87,6 +93,10 @@ int logm_internal(int flag, int indx, int priority, const char *fmt, va_list ap)
 	if (LOGM_STATUS(LOGM_READY) && !LOGM_STATUS(LOGM_BUFFER_RESIZE_REQ) \
 		&& flag == LOGM_NORMAL && !up_interrupt_context()) {
 
+#ifdef CONFIG_LOGM_BINARY
+		/* Formatted later by logm_task, without disabling interrupts */
+		return logm_binary_record(priority, fmt, ap);
+#endif
 		flags = enter_critical_section();
 
 		if (LOGM_STATUS(LOGM_BUFFER_OVERFLOW)) {
@@ -132,7 +142,12 @@ int logm(int flag, int indx, int priority, const char *fmt, ...)
 	va_list ap;
 	int ret;
 
-	/* LOGIC for initial test here */
+	/* Callers which did not go through LOGM_PRINT() */
+
+	if (indx < 0 || indx >= LOGM_IDX_MAX || priority < LOGM_EMR || priority > LOGM_DBG ||
+		!(g_logm_levels[indx] & (1 << priority))) {
+		return 0;
+	}
 
 	va_start(ap, fmt);
 	ret = logm_internal(flag, indx, priority, fmt, ap);
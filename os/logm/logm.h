@@ -20,6 +20,7 @@
 
 #include <tinyara/config.h>
 #include <stdint.h>
+#include <stdarg.h>
 
 /****************************************************************************
  * Preprocessor Definitions
@@ -39,6 +40,9 @@
 #define LOGM_PRINT_INTERVAL        (1000)
 #endif
 
+/* Largest record of CONFIG_LOGM_BINARY, arguments beyond it are dropped */
+#define LOGM_BIN_RECORD_MAX        (128)
+
 #ifndef BIT
 #define BIT(x) (1 << (x))
 #endif
@@ -74,12 +78,21 @@ EXTERN int logm_bufsize;
 EXTERN uint8_t logm_status;
 EXTERN volatile int new_logm_bufsize;
 EXTERN volatile int logm_print_interval;
+#ifdef CONFIG_LOGM_BINARY
+EXTERN volatile int g_logm_writers;
+#endif
 
 /************************************************************************************
  * Private Function Prototypes
  ************************************************************************************/
 int logm_task(int argc, char *argv[]);
 void logm_register_tashcmds(void);
+#ifdef CONFIG_LOGM_BINARY
+struct lib_outstream_s;
+void logm_binary_init(void);
+int logm_binary_record(int priority, const char *fmt, va_list ap);
+void logm_binary_flush(struct lib_outstream_s *stream);
+#endif
 
 #undef EXTERN
 #if defined(__cplusplus)
@@ -0,0 +1,579 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/* Binary logging: logm_internal() only copies the format pointer, a
+ * timestamp and the arguments into the buffer, and the logm task formats
+ * them when it flushes the buffer.
+ *
+ * A record is a header word, then the format pointer, the tick count and
+ * the arguments, each padded to 4 bytes.  The header word is written last,
+ * and 0 means that the record is reserved but not written yet.  Records do
+ * not wrap around the end of the buffer, a padding record fills the end
+ * instead.
+ *
+ * With SMP, each CPU writes into a ring of its own part of the buffer, so
+ * the cores do not contend on one tail, and records also carry a sequence
+ * number, by which the logm task merges the rings.
+ */
+
+#include <tinyara/config.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sched.h>
+#include <arch/irq.h>
+#include <tinyara/clock.h>
+#include <tinyara/sched.h>
+#include <tinyara/streams.h>
+#include "logm.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Header word: size in bytes, type and priority */
+#define LOGM_BIN_HDR(size, type, prio) ((uint32_t)(size) | ((uint32_t)(type) << 16) | ((uint32_t)(prio) << 24))
+#define LOGM_BIN_SIZE(hdr)  ((hdr) & 0xffff)
+#define LOGM_BIN_TYPE(hdr)  (((hdr) >> 16) & 0xff)
+
+#define LOGM_BIN_MSG        BIT(0)
+#define LOGM_BIN_PAD        BIT(1)
+#define LOGM_BIN_FMTCOPY    BIT(2)	/* The format follows the tick count */
+
+#define LOGM_BIN_ALIGN(n)   (((n) + 3) & ~3)
+
+#ifdef CONFIG_SMP
+#define LOGM_BIN_NRINGS     CONFIG_SMP_NCPUS
+/* Offset of the arguments, after the sequence number */
+#define LOGM_BIN_ARGS       16
+#else
+#define LOGM_BIN_NRINGS     1
+#define LOGM_BIN_ARGS       12
+#endif
+
+#define LOGM_BIN_SPEC_MAX   24
+
+/* Classes of the argument of a conversion */
+
+enum logm_arg_e {
+	LOGM_ARG_NONE,
+	LOGM_ARG_INT,
+	LOGM_ARG_LONG,
+	LOGM_ARG_LLONG,
+	LOGM_ARG_DOUBLE,
+	LOGM_ARG_PTR,
+	LOGM_ARG_STR,
+	LOGM_ARG_COUNT				/* %n, consumed but not recorded */
+};
+
+/* Part of g_logm_rsvbuf written by one CPU */
+
+struct logm_ring_s {
+	char *buf;
+	int size;					/* Multiple of 4 */
+	int head;
+	int tail;
+	int dropped;				/* Messages dropped since the last flush */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static struct logm_ring_s g_logm_rings[LOGM_BIN_NRINGS];
+#if LOGM_BIN_NRINGS > 1
+static uint32_t g_logm_seq;
+#endif
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+/* Writers between their reservation and the end of their copy */
+volatile int g_logm_writers;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Parse the conversion specification following a '%'.  Returns the end of
+ * the specification, with the number of '*' in width and precision.
+ */
+static const char *logm_binary_parse(const char *fmt, int *nstars, int *class)
+{
+	int longs = 0;
+
+	*nstars = 0;
+	while (*fmt && strchr("-+ #0'", *fmt)) {
+		fmt++;
+	}
+	while ((*fmt >= '0' && *fmt <= '9') || *fmt == '.' || *fmt == '*') {
+		if (*fmt++ == '*') {
+			(*nstars)++;
+		}
+	}
+	for (; *fmt && strchr("hlzjtqL", *fmt); fmt++) {
+		if (*fmt == 'l') {
+			longs++;
+		} else if (*fmt == 'z' || *fmt == 't') {
+			longs = 1;
+		} else if (*fmt != 'h') {
+			longs = 2;
+		}
+	}
+
+	switch (*fmt) {
+	case 'd':
+	case 'i':
+	case 'o':
+	case 'u':
+	case 'x':
+	case 'X':
+	case 'c':
+		*class = longs == 0 ? LOGM_ARG_INT : longs == 1 ? LOGM_ARG_LONG : LOGM_ARG_LLONG;
+		break;
+	case 'f':
+	case 'F':
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+	case 'a':
+	case 'A':
+		*class = LOGM_ARG_DOUBLE;
+		break;
+	case 'p':
+		*class = LOGM_ARG_PTR;
+		break;
+	case 's':
+		*class = LOGM_ARG_STR;
+		break;
+	case 'n':
+		*class = LOGM_ARG_COUNT;
+		break;
+	default:
+		*class = LOGM_ARG_NONE;
+		break;
+	}
+	return *fmt ? fmt + 1 : fmt;
+}
+
+/* Copy a string into the record, truncated to fit, and return its padded size */
+static int logm_binary_putstr(uint8_t *dst, int room, const char *str, int maxlen)
+{
+	int len;
+
+	if (!str) {
+		str = "(null)";
+	}
+	len = strnlen(str, maxlen);
+	if (len + 1 > room) {
+		len = room - 1;
+	}
+	memcpy(dst, str, len);
+	dst[len] = '\0';
+	return LOGM_BIN_ALIGN(len + 1);
+}
+
+/* Build the record of a message in rec, returning its size */
+static int logm_binary_encode(uint32_t *rec, int priority, const char *fmt, va_list ap)
+{
+	uint8_t *pos = (uint8_t *)rec + LOGM_BIN_ARGS;
+	uint8_t *end = (uint8_t *)rec + LOGM_BIN_RECORD_MAX;
+	uint8_t type = LOGM_BIN_MSG;
+	FAR struct tcb_s *tcb = sched_self();
+	int nstars;
+	int class;
+	int i;
+
+	rec[1] = (uint32_t)(uintptr_t)fmt;
+	rec[2] = (uint32_t)clock_systimer();
+
+	/* A format built on the stack of the caller is gone once it is flushed */
+
+	if (tcb && (uintptr_t)fmt >= (uintptr_t)tcb->stack_alloc_ptr && (uintptr_t)fmt < (uintptr_t)tcb->stack_alloc_ptr + tcb->adj_stack_size) {
+		type |= LOGM_BIN_FMTCOPY;
+		pos += logm_binary_putstr(pos, end - pos, fmt, LOGM_BIN_RECORD_MAX);
+	}
+
+	while (*fmt) {
+		if (*fmt++ != '%') {
+			continue;
+		}
+		fmt = logm_binary_parse(fmt, &nstars, &class);
+		for (i = 0; i < nstars; i++) {
+			int star = va_arg(ap, int);
+			if (pos + sizeof(int) <= end) {
+				memcpy(pos, &star, sizeof(int));
+			}
+			pos += sizeof(int);
+		}
+
+		switch (class) {
+		case LOGM_ARG_INT: {
+			int value = va_arg(ap, int);
+			if (pos + sizeof(value) <= end) {
+				memcpy(pos, &value, sizeof(value));
+			}
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			break;
+		}
+		case LOGM_ARG_LONG: {
+			long value = va_arg(ap, long);
+			if (pos + sizeof(value) <= end) {
+				memcpy(pos, &value, sizeof(value));
+			}
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			break;
+		}
+		case LOGM_ARG_LLONG: {
+			long long value = va_arg(ap, long long);
+			if (pos + sizeof(value) <= end) {
+				memcpy(pos, &value, sizeof(value));
+			}
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			break;
+		}
+		case LOGM_ARG_DOUBLE: {
+			double value = va_arg(ap, double);
+			if (pos + sizeof(value) <= end) {
+				memcpy(pos, &value, sizeof(value));
+			}
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			break;
+		}
+		case LOGM_ARG_PTR: {
+			void *value = va_arg(ap, void *);
+			if (pos + sizeof(value) <= end) {
+				memcpy(pos, &value, sizeof(value));
+			}
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			break;
+		}
+		case LOGM_ARG_STR: {
+			const char *value = va_arg(ap, const char *);
+			if (pos < end) {
+				pos += logm_binary_putstr(pos, end - pos, value, CONFIG_LOGM_BINARY_STRLEN);
+			}
+			break;
+		}
+		case LOGM_ARG_COUNT:
+			(void)va_arg(ap, int *);
+			break;
+		default:
+			break;
+		}
+
+		/* Arguments which do not fit are left out, the decoder prints the
+		 * rest of the format as is.
+		 */
+
+		if (pos > end) {
+			pos = end;
+			break;
+		}
+	}
+
+	rec[0] = LOGM_BIN_HDR(pos - (uint8_t *)rec, type, priority);
+	return pos - (uint8_t *)rec;
+}
+
+/* Reserve size bytes at the tail of a ring, returning their offset */
+static int logm_binary_reserve(struct logm_ring_s *ring, int size)
+{
+	int bufsize = ring->size;
+	int tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+	int head;
+	int pos;
+	int pad;
+	int next;
+
+	do {
+		head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+		pos = tail + size > bufsize ? 0 : tail;
+		pad = pos == tail ? 0 : bufsize - tail;
+
+		/* One word stays free, head == tail means empty */
+
+		if ((tail - head + bufsize) % bufsize + pad + size + 4 > bufsize) {
+			return ERROR;
+		}
+		next = (pos + size) % bufsize;
+	} while (!__atomic_compare_exchange_n(&ring->tail, &tail, next, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+	if (pad) {
+		__atomic_store_n((uint32_t *)&ring->buf[tail], LOGM_BIN_HDR(pad, LOGM_BIN_PAD, 0), __ATOMIC_RELEASE);
+	}
+	return pos;
+}
+
+/* Print a record, see logm_binary_encode() */
+static void logm_binary_decode(FAR struct lib_outstream_s *stream, const uint8_t *rec, int size)
+{
+	const uint8_t *pos = rec + LOGM_BIN_ARGS;
+	const uint8_t *end = rec + size;
+	const char *fmt;
+	const char *conv = NULL;
+	char spec[LOGM_BIN_SPEC_MAX];
+	int nstars;
+	int class;
+	int len;
+	int i;
+	uint32_t word;
+
+	memcpy(&word, rec + 4, sizeof(word));
+	fmt = (const char *)(uintptr_t)word;
+	if (LOGM_BIN_TYPE(*(const uint32_t *)rec) & LOGM_BIN_FMTCOPY) {
+		fmt = (const char *)pos;
+		pos += LOGM_BIN_ALIGN(strlen(fmt) + 1);
+	}
+
+#ifdef CONFIG_LOGM_TIMESTAMP
+	memcpy(&word, rec + 8, sizeof(word));
+	(void)lib_sprintf(stream, "[%4d.%4d] ", (int)(word / TICK_PER_SEC), (int)(TICK2USEC(word % TICK_PER_SEC) / 100));
+#endif
+
+	while (*fmt) {
+		const char *start = fmt;
+
+		if (*fmt != '%') {
+			stream->put(stream, *fmt++);
+			continue;
+		}
+		conv = fmt;
+		fmt = logm_binary_parse(fmt + 1, &nstars, &class);
+		if (class == LOGM_ARG_NONE) {
+			/* %% or an unknown conversion */
+			stream->put(stream, fmt[-1]);
+			continue;
+		}
+
+		/* Rebuild the specification, with the '*' replaced by their values */
+
+		len = 0;
+		for (; start < fmt && len < LOGM_BIN_SPEC_MAX - 12; start++) {
+			if (*start != '*') {
+				spec[len++] = *start;
+				continue;
+			}
+			if (pos + sizeof(int) > end) {
+				break;
+			}
+			memcpy(&i, pos, sizeof(int));
+			pos += sizeof(int);
+			len += snprintf(&spec[len], 12, "%d", i);
+		}
+		spec[len] = '\0';
+		if (start < fmt) {
+			goto truncated;
+		}
+
+		switch (class) {
+		case LOGM_ARG_INT: {
+			int value;
+			if (pos + sizeof(value) > end) {
+				goto truncated;
+			}
+			memcpy(&value, pos, sizeof(value));
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			(void)lib_sprintf(stream, spec, value);
+			break;
+		}
+		case LOGM_ARG_LONG: {
+			long value;
+			if (pos + sizeof(value) > end) {
+				goto truncated;
+			}
+			memcpy(&value, pos, sizeof(value));
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			(void)lib_sprintf(stream, spec, value);
+			break;
+		}
+		case LOGM_ARG_LLONG: {
+			long long value;
+			if (pos + sizeof(value) > end) {
+				goto truncated;
+			}
+			memcpy(&value, pos, sizeof(value));
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			(void)lib_sprintf(stream, spec, value);
+			break;
+		}
+		case LOGM_ARG_DOUBLE: {
+			double value;
+			if (pos + sizeof(value) > end) {
+				goto truncated;
+			}
+			memcpy(&value, pos, sizeof(value));
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			(void)lib_sprintf(stream, spec, value);
+			break;
+		}
+		case LOGM_ARG_PTR: {
+			void *value;
+			if (pos + sizeof(value) > end) {
+				goto truncated;
+			}
+			memcpy(&value, pos, sizeof(value));
+			pos += LOGM_BIN_ALIGN(sizeof(value));
+			(void)lib_sprintf(stream, spec, value);
+			break;
+		}
+		case LOGM_ARG_STR:
+			if (pos >= end) {
+				goto truncated;
+			}
+			(void)lib_sprintf(stream, spec, (const char *)pos);
+			pos += LOGM_BIN_ALIGN(strlen((const char *)pos) + 1);
+			break;
+		default:
+			break;
+		}
+	}
+	return;
+
+truncated:
+	/* The arguments left did not fit in the record */
+	(void)lib_sprintf(stream, "%s", conv);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/* Record a message, returns its size in the buffer, 0 if it is dropped */
+int logm_binary_record(int priority, const char *fmt, va_list ap)
+{
+	uint32_t rec[LOGM_BIN_RECORD_MAX / 4];
+	struct logm_ring_s *ring;
+	int size;
+	int pos;
+
+	/* Parse the format and copy the arguments before taking any space */
+
+	size = logm_binary_encode(rec, priority, fmt, ap);
+
+	__atomic_add_fetch(&g_logm_writers, 1, __ATOMIC_ACQUIRE);
+
+	/* The task may move to another CPU meanwhile, the reservation stays
+	 * atomic, the ring of the CPU is only the likely uncontended one.
+	 */
+
+	ring = &g_logm_rings[up_cpu_index()];
+	if (LOGM_STATUS(LOGM_BUFFER_RESIZE_REQ) || (pos = logm_binary_reserve(ring, size)) < 0) {
+		__atomic_sub_fetch(&g_logm_writers, 1, __ATOMIC_RELEASE);
+		__atomic_add_fetch(&ring->dropped, 1, __ATOMIC_RELAXED);
+		return 0;
+	}
+#if LOGM_BIN_NRINGS > 1
+	/* Taken once the space is reserved: a record of a smaller sequence
+	 * number is either written or seen as reserved by logm_binary_flush().
+	 */
+
+	rec[3] = __atomic_fetch_add(&g_logm_seq, 1, __ATOMIC_RELAXED);
+#endif
+	memcpy(&ring->buf[pos + 4], &rec[1], size - 4);
+	__atomic_store_n((uint32_t *)&ring->buf[pos], rec[0], __ATOMIC_RELEASE);
+	__atomic_sub_fetch(&g_logm_writers, 1, __ATOMIC_RELEASE);
+	return size;
+}
+
+/* Split the buffer between the CPUs, once it is allocated or resized */
+void logm_binary_init(void)
+{
+	int size = (logm_bufsize / LOGM_BIN_NRINGS) & ~3;
+	int i;
+
+	for (i = 0; i < LOGM_BIN_NRINGS; i++) {
+		g_logm_rings[i].buf = &g_logm_rsvbuf[i * size];
+		g_logm_rings[i].size = size;
+		g_logm_rings[i].head = 0;
+		g_logm_rings[i].tail = 0;
+		g_logm_rings[i].dropped = 0;
+	}
+}
+
+/* Oldest record written at the head of the rings, NULL if there is none
+ * or if a record is still being written, to keep the order.
+ */
+static struct logm_ring_s *logm_binary_oldest(void)
+{
+	struct logm_ring_s *oldest = NULL;
+	struct logm_ring_s *ring;
+	uint32_t hdr;
+	int i;
+#if LOGM_BIN_NRINGS > 1
+	uint32_t seq;
+	uint32_t oldest_seq = 0;
+#endif
+
+	for (i = 0; i < LOGM_BIN_NRINGS; i++) {
+		ring = &g_logm_rings[i];
+		if (ring->head == __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)) {
+			continue;
+		}
+		hdr = __atomic_load_n((uint32_t *)&ring->buf[ring->head], __ATOMIC_ACQUIRE);
+		if (hdr == 0) {
+			/* Reserved, still being written */
+			return NULL;
+		}
+		if (LOGM_BIN_TYPE(hdr) & LOGM_BIN_PAD) {
+			/* Nothing to order, take it first */
+			return ring;
+		}
+#if LOGM_BIN_NRINGS > 1
+		memcpy(&seq, &ring->buf[ring->head + 12], sizeof(seq));
+		if (oldest && (int32_t)(seq - oldest_seq) >= 0) {
+			continue;
+		}
+		oldest_seq = seq;
+#endif
+		oldest = ring;
+	}
+	return oldest;
+}
+
+/* Print the records written so far */
+void logm_binary_flush(FAR struct lib_outstream_s *stream)
+{
+	struct logm_ring_s *ring;
+	uint32_t hdr;
+	int dropped;
+	int i;
+
+	while ((ring = logm_binary_oldest()) != NULL) {
+		hdr = *(uint32_t *)&ring->buf[ring->head];
+		if (LOGM_BIN_TYPE(hdr) & LOGM_BIN_MSG) {
+			logm_binary_decode(stream, (const uint8_t *)&ring->buf[ring->head], LOGM_BIN_SIZE(hdr));
+		}
+
+		/* Writers find zeroes where they reserve */
+
+		memset(&ring->buf[ring->head], 0, LOGM_BIN_SIZE(hdr));
+		__atomic_store_n(&ring->head, (ring->head + LOGM_BIN_SIZE(hdr)) % ring->size, __ATOMIC_RELEASE);
+	}
+
+	for (i = 0; i < LOGM_BIN_NRINGS; i++) {
+		dropped = __atomic_exchange_n(&g_logm_rings[i].dropped, 0, __ATOMIC_RELAXED);
+		if (dropped > 0) {
+#ifdef CONFIG_SMP
+			(void)lib_sprintf(stream, "\n[LOGM BUFFER OVERFLOW] %d messages are dropped on CPU%d\n", dropped, i);
+#else
+			(void)lib_sprintf(stream, "\n[LOGM BUFFER OVERFLOW] %d messages are dropped\n", dropped);
+#endif
+		}
+	}
+}
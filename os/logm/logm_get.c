@@ -29,9 +29,29 @@ int logm_get_values(enum logm_param_type_e type, int *value)
 	case LOGM_INTERVAL:
 		*value = (int)(logm_print_interval / 1000);
 		break;
+	case LOGM_PRIORITY:
+		*value = logm_get_level(LOGM_UNKNOWN);
+		break;
 	default:
 		break;
 	}
 
 	return 0;					// for now, to keep compiler happy
 }
+
+/* Highest priority enabled for a module, LOGM_OFF if none */
+int logm_get_level(int indx)
+{
+	int priority;
+
+	if (indx < 0 || indx >= LOGM_IDX_MAX) {
+		return -1;
+	}
+
+	for (priority = LOGM_DBG; priority >= LOGM_EMR; priority--) {
+		if (g_logm_levels[indx] & (1 << priority)) {
+			return priority;
+		}
+	}
+	return LOGM_OFF;
+}
@@ -20,15 +20,22 @@
 #include <string.h>
 #include <stdint.h>
 #include <sys/types.h>
+#include <sys/prctl.h>
 #include <arch/irq.h>
 #include <tinyara/logm.h>
 #include <tinyara/config.h>
 #include <tinyara/kmalloc.h>
+#ifdef CONFIG_LOGM_BINARY
+#include <tinyara/streams.h>
+#endif
 #include "logm.h"
 #ifdef CONFIG_LOGM_TEST
 #include "logm_test.h"
 #endif
 
+/* The buffer may be flushed a little late to share a wake-up with other timers */
+#define LOGM_TIMER_SLACK_MS (LOGM_PRINT_INTERVAL / 10)
+
 uint8_t logm_status;
 int logm_bufsize = LOGM_BUFFER_SIZE;
 char * g_logm_rsvbuf = NULL;
@@ -58,6 +65,10 @@ static int logm_change_bufsize(int buflen)
 	g_logm_dropmsg_count = 0;
 	g_logm_overflow_offset = -1;
 
+#ifdef CONFIG_LOGM_BINARY
+	logm_binary_init();
+#endif
+
 	LOGM_STATUS_CLEAR(LOGM_BUFFER_RESIZE_REQ);
 
 	return OK;
@@ -66,9 +77,17 @@ static int logm_change_bufsize(int buflen)
 int logm_task(int argc, char *argv[])
 {
 	irqstate_t flags;
+#ifdef CONFIG_LOGM_BINARY
+	struct lib_stdoutstream_s strm;
+#endif
 
 	g_logm_rsvbuf = (char *)kmm_malloc(logm_bufsize);
 	memset(g_logm_rsvbuf, 0, logm_bufsize);
+#ifdef CONFIG_LOGM_BINARY
+	logm_binary_init();
+#endif
+
+	(void)prctl(PR_SET_TIMERSLACK, LOGM_TIMER_SLACK_MS);
 
 	/* Now logm is ready */
 	LOGM_STATUS_SET(LOGM_READY);
@@ -78,6 +97,10 @@ int logm_task(int argc, char *argv[])
 #endif
 
 	while (1) {
+#ifdef CONFIG_LOGM_BINARY
+		lib_stdoutstream(&strm, stdout);
+		logm_binary_flush(&strm.public);
+#else
 		while (g_logm_head != g_logm_tail) {
 			fputc(g_logm_rsvbuf[g_logm_head], stdout);
 			g_logm_head = (g_logm_head + 1) % logm_bufsize;
@@ -89,8 +112,15 @@ int logm_task(int argc, char *argv[])
 				g_logm_overflow_offset = -1;
 			}
 		}
+#endif
 
 		if (LOGM_STATUS(LOGM_BUFFER_RESIZE_REQ)) {
+#ifdef CONFIG_LOGM_BINARY
+			/* Writers stop reserving once the request is set, wait for the last ones */
+			while (__atomic_load_n(&g_logm_writers, __ATOMIC_ACQUIRE) != 0) {
+				usleep(1000);
+			}
+#endif
 			flags = enter_critical_section();
 			if (logm_change_bufsize(new_logm_bufsize) != OK) {
 				fprintf(stdout, "\n[LOGM] Failed to change buffer size\n");
@@ -20,10 +20,17 @@
 
 volatile int new_logm_bufsize = 0;
 
+/* All the priorities up to LOGM_DEF_PRIORITY, for each module */
+uint8_t g_logm_levels[LOGM_IDX_MAX] = {
+	[0 ... LOGM_IDX_MAX - 1] = LOGM_LEVEL_MASK(LOGM_DEF_PRIORITY)
+};
+
 /* This will be moved to upper layer or changed for protected build  */
 /* for setparam types, refer logm_param_type_e  */
 int logm_set_values(enum logm_param_type_e type, int value)
 {
+	int indx;
+
 	switch (type) {
 	case LOGM_BUFSIZE:
 		/* Buffer size should be adjusted to multiples of 4 */
@@ -32,9 +39,25 @@ int logm_set_values(enum logm_param_type_e type, int value)
 	case LOGM_INTERVAL:
 		logm_print_interval = value * 1000;
 		break;
+	case LOGM_PRIORITY:
+		for (indx = 0; indx < LOGM_IDX_MAX; indx++) {
+			logm_set_level(indx, value);
+		}
+		break;
 	default:
 		break;
 	}
 
 	return 0;					// for now, to keep compiler happy
 }
+
+/* Enable the messages of a module up to priority, LOGM_OFF disables all */
+int logm_set_level(int indx, int priority)
+{
+	if (indx < 0 || indx >= LOGM_IDX_MAX || priority < LOGM_EMR || priority > LOGM_OFF) {
+		return -1;
+	}
+
+	g_logm_levels[indx] = priority == LOGM_OFF ? 0 : LOGM_LEVEL_MASK(priority);
+	return 0;
+}
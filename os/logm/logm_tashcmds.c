@@ -25,6 +25,11 @@
 
 static int logm_tash(int argc, char **args);
 
+/* Names of enum logm_logindex_e */
+static const char *const logm_modules[LOGM_IDX_MAX] = {
+	"unknown", "kernel", "mm", "fs", "net", "drivers"
+};
+
 const static tash_cmdlist_t logm_tashmds[] = {
 	{"logm", logm_tash, TASH_EXECMD_SYNC},
 	{NULL, NULL, 0}
@@ -38,20 +43,47 @@ void logm_register_tashcmds(void)
 static void logm_usage(void)
 {
 	fprintf(stdout, "[LOGM USAGE]\n");
-	fprintf(stdout, "usage: logm [-b <BUFSIZE>] [-i <TIME>]\n");
+	fprintf(stdout, "usage: logm [-b <BUFSIZE>] [-i <TIME>] [-l [<MODULE>:]<LEVEL>]\n");
 
 	fprintf(stdout, "options:\n");
 	fprintf(stdout, "    -b BUFSIZE\n");
 	fprintf(stdout, "        Set logm buffer size (bytes)\n");
 	fprintf(stdout, "    -i TIME\n");
 	fprintf(stdout, "        Set buffer flusing interval (ms)\n");
+	fprintf(stdout, "    -l [MODULE:]LEVEL\n");
+	fprintf(stdout, "        Print messages of priority 0 (emergency) to LEVEL (7, debug), 8 for none,\n");
+	fprintf(stdout, "        of all the modules or of MODULE only (unknown, kernel, mm, fs, net, drivers)\n");
+
+}
+
+/* Set the level of "LEVEL" or "MODULE:LEVEL" */
+static int logm_set_levels(const char *arg)
+{
+	const char *sep = strchr(arg, ':');
+	int level;
+	int indx;
+
+	if (!sep) {
+		level = atoi(arg);
+		if (level < LOGM_EMR || level > LOGM_OFF) {
+			return -1;
+		}
+		return logm_set_values(LOGM_PRIORITY, level);
+	}
 
+	for (indx = 0; indx < LOGM_IDX_MAX; indx++) {
+		if (strlen(logm_modules[indx]) == (size_t)(sep - arg) && !strncmp(arg, logm_modules[indx], sep - arg)) {
+			return logm_set_level(indx, atoi(sep + 1));
+		}
+	}
+	return -1;
 }
 
 static void logm_info(void)
 {
 	int bufsize;
 	int interval;
+	int indx;
 
 	logm_get_values(LOGM_BUFSIZE, &bufsize);
 	logm_get_values(LOGM_INTERVAL, &interval);
@@ -59,6 +91,11 @@ static void logm_info(void)
 	fprintf(stdout, "[LOGM CONFIGURATIONS]\n");
 	fprintf(stdout, "  Buffer size : %d (bytes)\n", bufsize);
 	fprintf(stdout, "  Flusing interval : %d (ms)\n", interval);
+	fprintf(stdout, "  Levels (compiled up to %d) :", LOGM_LEVEL);
+	for (indx = 0; indx < LOGM_IDX_MAX; indx++) {
+		fprintf(stdout, " %s %d", logm_modules[indx], logm_get_level(indx));
+	}
+	fprintf(stdout, "\n");
 }
 
 static int logm_tash(int argc, char **args)
@@ -82,8 +119,9 @@ static int logm_tash(int argc, char **args)
 	/*
 	 * -b [bufsize] : set buffer size (bytes)
 	 * -i [time] : set buffer flushing interval (ms)
+	 * -l [module:]level : set the level of all or one module
 	 */
-	while ((opt = getopt(argc, args, "b:i:")) != -1) {
+	while ((opt = getopt(argc, args, "b:i:l:")) != -1) {
 		switch (opt) {
 		case 'b':
 			/* TASH>> logm -b 10240 */
@@ -100,6 +138,13 @@ static int logm_tash(int argc, char **args)
 				logm_set_values(LOGM_INTERVAL, atoi(optarg));
 			}
 			break;
+		case 'l':
+			/* TASH>> logm -l fs:3 */
+			/* prints errors and above only from the file system */
+			if (optarg == NULL || logm_set_levels(optarg) != 0) {
+				logm_usage();
+			}
+			break;
 		default:
 			logm_usage();
 			return 0;
@@ -108,6 +108,52 @@ static void *kheap_malloc(size_t size)
 	return NULL;
 }
 
+#if CONFIG_KMM_NHEAPS > 1
+/* Like kheap_malloc(), but the heap of index 'prefer' is tried first */
+
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+static void *kheap_malloc_prefer(size_t size, int prefer, mmaddress_t caller_retaddr)
+#else
+static void *kheap_malloc_prefer(size_t size, int prefer)
+#endif
+{
+	int heap_idx;
+	void *ret;
+	struct mm_heap_s *kheap = kmm_get_baseheap();
+
+	ret = mm_malloc(&kheap[prefer], size
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+			, caller_retaddr
+#endif
+			);
+	if (ret != NULL) {
+		return ret;
+	}
+
+	for (heap_idx = HEAP_START_IDX; heap_idx <= HEAP_END_IDX; heap_idx++) {
+		if (heap_idx == prefer) {
+			continue;
+		}
+
+		ret = mm_malloc(&kheap[heap_idx], size
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+				, caller_retaddr
+#endif
+				);
+		if (ret != NULL) {
+			return ret;
+		}
+	}
+
+	mm_manage_alloc_fail(kheap, HEAP_START_IDX, HEAP_END_IDX, size, 0, KERNEL_HEAP
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+			, caller_retaddr
+#endif
+			);
+	return NULL;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -161,6 +207,72 @@ void *kmm_malloc_at(int heap_index, size_t size)
 	}
 	return ret;
 }
+
+/************************************************************************
+ * Name: kmm_malloc_fast
+ *
+ * Description:
+ *   Allocate kernel memory preferably from the fast heap,
+ *   CONFIG_RAM_MALLOC_FAST_INDEX.  The other kernel heaps are used when
+ *   it is full.
+ *
+ * Parameters:
+ *   size - Size (in bytes) of the memory region to be allocated.
+ *
+ * Return Value:
+ *   The address of the allocated memory (NULL on failure to allocate)
+ *
+ ************************************************************************/
+
+void *kmm_malloc_fast(size_t size)
+{
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	mmaddress_t caller_retaddr = 0;
+	ARCH_GET_RET_ADDRESS(caller_retaddr)
+#endif
+	if (size == 0) {
+		return NULL;
+	}
+
+	return kheap_malloc_prefer(size, CONFIG_RAM_MALLOC_FAST_INDEX
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+			, caller_retaddr
+#endif
+			);
+}
+
+/************************************************************************
+ * Name: kmm_malloc_bulk
+ *
+ * Description:
+ *   Allocate kernel memory preferably from the bulk heap,
+ *   CONFIG_RAM_MALLOC_BULK_INDEX.  The other kernel heaps are used when
+ *   it is full.
+ *
+ * Parameters:
+ *   size - Size (in bytes) of the memory region to be allocated.
+ *
+ * Return Value:
+ *   The address of the allocated memory (NULL on failure to allocate)
+ *
+ ************************************************************************/
+
+void *kmm_malloc_bulk(size_t size)
+{
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	mmaddress_t caller_retaddr = 0;
+	ARCH_GET_RET_ADDRESS(caller_retaddr)
+#endif
+	if (size == 0) {
+		return NULL;
+	}
+
+	return kheap_malloc_prefer(size, CONFIG_RAM_MALLOC_BULK_INDEX
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+			, caller_retaddr
+#endif
+			);
+}
 #endif
 
 /************************************************************************
@@ -0,0 +1,284 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/mm/mempool.h>
+
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* All pools, newest first.  Pools are never unregistered, so the list can
+ * be walked without holding a lock.
+ */
+
+static FAR struct mempool_s *g_mempools;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static irqstate_t mempool_lock(FAR struct mempool_s *pool)
+{
+	int ret;
+
+	if (pool->flags & MEMPOOL_FLAG_IRQSAFE) {
+		return enter_critical_section();
+	}
+
+	/* Continue waiting if we are awakened by a signal */
+
+	do {
+		ret = sem_wait(&pool->exclsem);
+		if (ret < 0) {
+			DEBUGASSERT(errno == EINTR);
+		}
+	} while (ret < 0);
+
+	return 0;
+}
+
+static void mempool_unlock(FAR struct mempool_s *pool, irqstate_t flags)
+{
+	if (pool->flags & MEMPOOL_FLAG_IRQSAFE) {
+		leave_critical_section(flags);
+	} else {
+		sem_post(&pool->exclsem);
+	}
+}
+
+/* Put 'nblocks' objects starting at 'base' on the free list.  The caller
+ * holds the pool lock, or owns the pool during initialization.
+ */
+
+static void mempool_addblocks(FAR struct mempool_s *pool, FAR uint8_t *base, uint16_t nblocks)
+{
+	uint16_t i;
+
+	for (i = 0; i < nblocks; i++) {
+		sq_addfirst((FAR sq_entry_t *)base, &pool->freelist);
+		base += pool->blocksize;
+	}
+
+	pool->ntotal += nblocks;
+	pool->nfree += nblocks;
+}
+
+/* Grow the pool by a chunk of 'nexpand' objects from the kernel heap, up
+ * to 'nmax' objects
+ */
+
+static int mempool_expand(FAR struct mempool_s *pool)
+{
+	FAR uint8_t *chunk;
+	irqstate_t flags;
+
+	if ((uint32_t)pool->ntotal + pool->nexpand > (pool->nmax > 0 ? pool->nmax : UINT16_MAX)) {
+		return -ENOMEM;
+	}
+
+	chunk = (FAR uint8_t *)kmm_malloc(pool->blocksize * pool->nexpand);
+	if (!chunk) {
+		mdbg("Failed to expand pool %s\n", pool->name);
+		return -ENOMEM;
+	}
+
+	flags = mempool_lock(pool);
+	mempool_addblocks(pool, chunk, pool->nexpand);
+	mempool_unlock(pool, flags);
+
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mempool_initialize
+ ****************************************************************************/
+
+int mempool_initialize(FAR struct mempool_s *pool, FAR const char *name)
+{
+	FAR uint8_t *base;
+	irqstate_t flags;
+
+	if (!pool || pool->blocksize == 0 || pool->nreserve > pool->ninitial) {
+		return -EINVAL;
+	}
+
+	if (pool->nmax > 0 && pool->ninitial > pool->nmax) {
+		return -EINVAL;
+	}
+
+	/* Only interrupt handlers can use the reserve */
+
+	if (pool->nreserve > 0 && !(pool->flags & MEMPOOL_FLAG_IRQSAFE)) {
+		return -EINVAL;
+	}
+
+	if (pool->blocksize < sizeof(sq_entry_t)) {
+		pool->blocksize = sizeof(sq_entry_t);
+	}
+
+	pool->blocksize = MEMPOOL_ALIGN_UP(pool->blocksize);
+	pool->name = name;
+	pool->ntotal = 0;
+	pool->nfree = 0;
+	pool->highwater = 0;
+	pool->nfail = 0;
+	sq_init(&pool->freelist);
+
+	if (!(pool->flags & MEMPOOL_FLAG_IRQSAFE)) {
+		sem_init(&pool->exclsem, 0, 1);
+	}
+
+	base = (FAR uint8_t *)pool->storage;
+	if (!base && pool->ninitial > 0) {
+		base = (FAR uint8_t *)kmm_malloc(pool->blocksize * pool->ninitial);
+		if (!base) {
+			mdbg("Failed to allocate %u objects for pool %s\n", pool->ninitial, name);
+			return -ENOMEM;
+		}
+	}
+
+	mempool_addblocks(pool, base, pool->ninitial);
+
+	flags = enter_critical_section();
+	pool->flink = g_mempools;
+	g_mempools = pool;
+	leave_critical_section(flags);
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: mempool_alloc
+ ****************************************************************************/
+
+FAR void *mempool_alloc(FAR struct mempool_s *pool)
+{
+	FAR sq_entry_t *blk;
+	irqstate_t flags;
+	bool isr = up_interrupt_context();
+	bool expanded = false;
+	uint16_t nused;
+
+	DEBUGASSERT(pool && (!isr || (pool->flags & MEMPOOL_FLAG_IRQSAFE)));
+
+	for (;;) {
+		flags = mempool_lock(pool);
+
+		if (pool->nfree > (isr ? 0 : pool->nreserve)) {
+			blk = sq_remfirst(&pool->freelist);
+			pool->nfree--;
+
+			nused = pool->ntotal - pool->nfree;
+			if (nused > pool->highwater) {
+				pool->highwater = nused;
+			}
+
+			mempool_unlock(pool, flags);
+			return (FAR void *)blk;
+		}
+
+		/* Interrupt handlers cannot take the heap, and a task tries to grow
+		 * the pool only once since the new objects could be taken by others.
+		 */
+
+		if (isr || pool->nexpand == 0 || expanded) {
+			pool->nfail++;
+			mempool_unlock(pool, flags);
+			return NULL;
+		}
+
+		mempool_unlock(pool, flags);
+
+		if (mempool_expand(pool) < 0) {
+			flags = mempool_lock(pool);
+			pool->nfail++;
+			mempool_unlock(pool, flags);
+			return NULL;
+		}
+
+		expanded = true;
+	}
+}
+
+/****************************************************************************
+ * Name: mempool_free
+ ****************************************************************************/
+
+void mempool_free(FAR struct mempool_s *pool, FAR void *blk)
+{
+	irqstate_t flags;
+
+	DEBUGASSERT(pool && blk);
+	DEBUGASSERT(!up_interrupt_context() || (pool->flags & MEMPOOL_FLAG_IRQSAFE));
+
+	flags = mempool_lock(pool);
+	sq_addfirst((FAR sq_entry_t *)blk, &pool->freelist);
+	pool->nfree++;
+	DEBUGASSERT(pool->nfree <= pool->ntotal);
+	mempool_unlock(pool, flags);
+}
+
+/****************************************************************************
+ * Name: mempool_foreach
+ ****************************************************************************/
+
+void mempool_foreach(mempool_handler_t handler, FAR void *arg)
+{
+	FAR struct mempool_s *pool;
+	struct mempool_info_s info;
+	irqstate_t flags;
+
+	DEBUGASSERT(handler);
+
+	for (pool = g_mempools; pool; pool = pool->flink) {
+		/* Snapshot the counters, then report them with interrupts enabled */
+
+		flags = enter_critical_section();
+		info.name = pool->name;
+		info.blocksize = pool->blocksize;
+		info.ntotal = pool->ntotal;
+		info.nused = pool->ntotal - pool->nfree;
+		info.highwater = pool->highwater;
+		info.nfail = pool->nfail;
+		leave_critical_section(flags);
+
+		handler(&info, arg);
+	}
+}
+
+#endif							/* CONFIG_BUILD_FLAT || __KERNEL__ */
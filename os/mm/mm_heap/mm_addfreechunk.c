@@ -58,6 +58,8 @@
 
 #include <tinyara/mm/mm.h>
 
+#include "mm_node.h"
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -88,9 +90,21 @@ void mm_addfreechunk(FAR struct mm_heap_s *heap, FAR struct mm_freenode_s *node)
 
 	int ndx = mm_size2ndx(node->size);
 
+#ifdef CONFIG_MM_TLSF_INDEX
+	/* Lists of the two-level index are not sorted, just put the new free
+	 * node at the head and mark the list as non-empty.
+	 */
+
+	prev = &heap->mm_nodelist[ndx];
+	next = prev->flink;
+
+	heap->mm_flbitmap |= (uint32_t)1 << MM_NDX2FL(ndx);
+	heap->mm_slbitmap[MM_NDX2FL(ndx)] |= 1 << (ndx & (MM_SLI_COUNT - 1));
+#else
 	/* Now put the new free node in a descending order */
 
 	for (prev = &heap->mm_nodelist[ndx], next = prev->flink; next && next->size > node->size; prev = next, next = next->flink) ;
+#endif
 
 	/* Does it go in mid next or at the end? */
 
@@ -103,4 +117,6 @@ void mm_addfreechunk(FAR struct mm_heap_s *heap, FAR struct mm_freenode_s *node)
 
 		next->blink = node;
 	}
+
+	mm_freecount_add(heap, node->size);
 }
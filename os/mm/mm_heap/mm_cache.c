@@ -0,0 +1,496 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <string.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/spinlock.h>
+#include <tinyara/mm/mm.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MM_CACHE_THIS_CPU (-1)
+
+/* Parked chunks stay marked as allocated in the heap, so the first word of
+ * their payload carries this mark to tell them apart from chunks in use.
+ */
+
+#define MM_CACHE_PARKED   0xcac4ed00
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+/* Convert a request size into the smallest size class which can hold it */
+
+static inline int mm_cache_alloc_class(size_t size)
+{
+	size_t chunksize = MM_ALIGN_UP(size + SIZEOF_MM_ALLOCNODE);
+	int cls;
+
+	for (cls = 0; cls < MM_CACHE_NCLASSES; cls++) {
+		if (chunksize <= MM_CACHE_CHUNK_SIZE(cls)) {
+			return cls;
+		}
+	}
+
+	return -1;
+}
+
+/* Only chunks that exactly match a size class can be parked in a magazine */
+
+static inline int mm_cache_free_class(size_t chunksize)
+{
+	int cls;
+
+	for (cls = 0; cls < MM_CACHE_NCLASSES; cls++) {
+		if (chunksize == MM_CACHE_CHUNK_SIZE(cls)) {
+			return cls;
+		}
+	}
+
+	return -1;
+}
+
+static inline void mm_cache_setmark(FAR struct mm_allocnode_s *node, uint32_t mark)
+{
+	memcpy((FAR char *)node + SIZEOF_MM_ALLOCNODE, &mark, sizeof(mark));
+}
+
+static inline bool mm_cache_marked(FAR struct mm_allocnode_s *node)
+{
+	uint32_t mark;
+
+	memcpy(&mark, (FAR char *)node + SIZEOF_MM_ALLOCNODE, sizeof(mark));
+	return mark == MM_CACHE_PARKED;
+}
+
+/* The magazine of a CPU is touched only with local interrupts disabled, so
+ * the owner can never be preempted or migrated in the middle of an update.
+ * The spinlock is there only to serialize against mm_cache_flush() running
+ * on another CPU, so it is practically never contended.
+ */
+
+static inline FAR struct mm_cache_s *mm_cache_lock(FAR struct mm_heap_s *heap, int cpu, FAR irqstate_t *flags)
+{
+	FAR struct mm_cache_s *cache;
+
+	*flags = irqsave();
+
+	if (cpu == MM_CACHE_THIS_CPU) {
+		cpu = up_cpu_index();
+	}
+
+	cache = &heap->mm_cache[cpu];
+#ifdef CONFIG_SMP
+	spin_lock(&cache->lock);
+#endif
+	return cache;
+}
+
+static inline void mm_cache_unlock(FAR struct mm_cache_s *cache, irqstate_t flags)
+{
+#ifdef CONFIG_SMP
+	spin_unlock(&cache->lock);
+#endif
+	irqrestore(flags);
+}
+
+/* Return a batch of chunks to the nodelist with a single semaphore hold */
+
+static void mm_cache_release(FAR struct mm_heap_s *heap, FAR struct mm_allocnode_s **chunk, int nchunks)
+{
+	int i;
+
+	mm_takesemaphore(heap);
+
+	for (i = 0; i < nchunks; i++) {
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+		heapinfo_update_total_size(heap, (-1) * chunk[i]->size, chunk[i]->pid);
+#endif
+		mm_cache_setmark(chunk[i], 0);
+		mm_freechunk(heap, chunk[i]);
+	}
+
+	mm_givesemaphore(heap);
+}
+
+/* Take a batch of chunks of the given class from the nodelist with a single
+ * semaphore hold.  The first one is returned to the caller and the rest are
+ * parked in the magazine of the current CPU.
+ */
+
+static FAR struct mm_allocnode_s *mm_cache_refill(FAR struct mm_heap_s *heap, int cls)
+{
+	FAR struct mm_allocnode_s *chunk[CONFIG_MM_PERCPU_CACHE_BATCH];
+	FAR struct mm_cache_magazine_s *mag;
+	FAR struct mm_cache_s *cache;
+	irqstate_t flags;
+	int nchunks;
+	int i;
+
+	if (!mm_takesemaphore(heap)) {
+		return NULL;
+	}
+
+	for (nchunks = 0; nchunks < CONFIG_MM_PERCPU_CACHE_BATCH; nchunks++) {
+		chunk[nchunks] = mm_allocchunk(heap, MM_CACHE_CHUNK_SIZE(cls));
+		if (!chunk[nchunks]) {
+			break;
+		}
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+		/* Chunks owned by the cache are accounted as allocated */
+
+		heapinfo_update_node(chunk[nchunks], (mmaddress_t)0);
+		heapinfo_update_total_size(heap, chunk[nchunks]->size, chunk[nchunks]->pid);
+#endif
+	}
+
+	mm_givesemaphore(heap);
+
+	if (nchunks == 0) {
+		return NULL;
+	}
+
+	/* The payload of a chunk fresh from the nodelist is stale data */
+
+	mm_cache_setmark(chunk[0], 0);
+
+	cache = mm_cache_lock(heap, MM_CACHE_THIS_CPU, &flags);
+	mag = &cache->mag[cls];
+	for (i = 1; i < nchunks && mag->count < CONFIG_MM_PERCPU_CACHE_DEPTH; i++) {
+		mm_cache_setmark(chunk[i], MM_CACHE_PARKED);
+		mag->chunk[mag->count++] = chunk[i];
+	}
+	mm_cache_unlock(cache, flags);
+
+	/* Someone else may have filled the magazine in the meantime */
+
+	if (i < nchunks) {
+		mm_cache_release(heap, &chunk[i], nchunks - i);
+	}
+
+	return chunk[0];
+}
+
+/* A chunk carrying the mark is parked only if a magazine holds it, the mark
+ * alone could be user data.
+ */
+
+static bool mm_cache_parked(FAR struct mm_heap_s *heap, FAR struct mm_allocnode_s *node, int cls)
+{
+	FAR struct mm_cache_magazine_s *mag;
+	FAR struct mm_cache_s *cache;
+	irqstate_t flags;
+	bool parked = false;
+	int cpu;
+	int i;
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS && !parked; cpu++) {
+		cache = mm_cache_lock(heap, cpu, &flags);
+		mag = &cache->mag[cls];
+		for (i = 0; i < mag->count; i++) {
+			if (mag->chunk[i] == node) {
+				parked = true;
+				break;
+			}
+		}
+		mm_cache_unlock(cache, flags);
+	}
+
+	return parked;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_cache_initialize
+ *
+ * Description:
+ *   Initialize the per-CPU magazines of the selected heap.
+ *
+ ****************************************************************************/
+void mm_cache_initialize(FAR struct mm_heap_s *heap)
+{
+	int cpu;
+
+	memset(heap->mm_cache, 0, sizeof(heap->mm_cache));
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+#ifdef CONFIG_SMP
+		spin_initialize(&heap->mm_cache[cpu].lock, SP_UNLOCKED);
+#endif
+	}
+}
+
+/****************************************************************************
+ * Name: mm_cache_alloc
+ *
+ * Description:
+ *   Allocate a small chunk from the magazine of the current CPU, refilling
+ *   it from the heap in a batch when it is empty.
+ *
+ * Return Value:
+ *   The address of the allocated memory, or NULL if the request is not a
+ *   small one or the heap could not provide a chunk for the size class.
+ *
+ ****************************************************************************/
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+FAR void *mm_cache_alloc(FAR struct mm_heap_s *heap, size_t size, mmaddress_t caller_retaddr)
+#else
+FAR void *mm_cache_alloc(FAR struct mm_heap_s *heap, size_t size)
+#endif
+{
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+	FAR struct mm_allocnode_s *node = NULL;
+	FAR struct mm_cache_magazine_s *mag;
+	FAR struct mm_cache_s *cache;
+	irqstate_t flags;
+	int cls;
+
+	cls = mm_cache_alloc_class(size);
+	if (cls < 0) {
+		return NULL;
+	}
+
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	/* Owner bookkeeping needs the MM semaphore, leave the interrupt
+	 * context to the normal path.
+	 */
+
+	if (up_interrupt_context()) {
+		return NULL;
+	}
+#endif
+
+	cache = mm_cache_lock(heap, MM_CACHE_THIS_CPU, &flags);
+	mag = &cache->mag[cls];
+	if (mag->count > 0) {
+		node = mag->chunk[--mag->count];
+		cache->stats.alloc_hit++;
+	} else {
+		cache->stats.alloc_miss++;
+	}
+	mm_cache_unlock(cache, flags);
+
+	if (!node) {
+		node = mm_cache_refill(heap, cls);
+		if (!node) {
+			return NULL;
+		}
+	} else {
+		mm_cache_setmark(node, 0);
+	}
+
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	mm_takesemaphore(heap);
+	heapinfo_update_node(node, caller_retaddr);
+	heapinfo_add_size(heap, node->pid, node->size);
+	mm_givesemaphore(heap);
+#endif
+
+	mvdbg("Allocated %p from cache, size %u\n", (FAR char *)node + SIZEOF_MM_ALLOCNODE, node->size);
+	return (FAR void *)((FAR char *)node + SIZEOF_MM_ALLOCNODE);
+#else
+	return NULL;
+#endif
+}
+
+/****************************************************************************
+ * Name: mm_cache_free
+ *
+ * Description:
+ *   Park a small chunk in the magazine of the current CPU.  When the
+ *   magazine is full, a batch of older chunks is returned to the heap.
+ *
+ * Return Value:
+ *   true if the chunk was consumed by the cache, false if the caller has to
+ *   release it through the normal path.
+ *
+ ****************************************************************************/
+bool mm_cache_free(FAR struct mm_heap_s *heap, FAR void *mem)
+{
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+	FAR struct mm_allocnode_s *victim[CONFIG_MM_PERCPU_CACHE_BATCH];
+	FAR struct mm_allocnode_s *node;
+	FAR struct mm_cache_magazine_s *mag;
+	FAR struct mm_cache_s *cache;
+	irqstate_t flags;
+	int nvictims = 0;
+	int cls;
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	pid_t pid;
+#endif
+
+	node = (FAR struct mm_allocnode_s *)((FAR char *)mem - SIZEOF_MM_ALLOCNODE);
+
+	/* Let the normal path report invalid and double frees */
+
+	if ((node->preceding & MM_ALLOC_BIT) == 0) {
+		return false;
+	}
+
+	cls = mm_cache_free_class(node->size);
+	if (cls < 0) {
+		return false;
+	}
+
+	/* Handing a parked chunk to the normal path would free it while it is
+	 * still in the magazine, so reject it here.
+	 */
+
+	if (mm_cache_marked(node) && mm_cache_parked(heap, node, cls)) {
+		mdbg("Attempt for double freeing a pointer %p\n", mem);
+		return true;
+	}
+
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	if (up_interrupt_context()) {
+		return false;
+	}
+
+	/* The chunk may be handed out again as soon as it is in the magazine */
+
+	pid = node->pid;
+#endif
+
+	cache = mm_cache_lock(heap, MM_CACHE_THIS_CPU, &flags);
+	mag = &cache->mag[cls];
+	if (mag->count >= CONFIG_MM_PERCPU_CACHE_DEPTH) {
+		if (up_interrupt_context()) {
+			/* Draining needs the MM semaphore */
+
+			mm_cache_unlock(cache, flags);
+			return false;
+		}
+
+		while (nvictims < CONFIG_MM_PERCPU_CACHE_BATCH && mag->count > 0) {
+			victim[nvictims++] = mag->chunk[--mag->count];
+		}
+
+		cache->stats.free_miss++;
+	} else {
+		cache->stats.free_hit++;
+	}
+
+	mm_cache_setmark(node, MM_CACHE_PARKED);
+	mag->chunk[mag->count++] = node;
+	mm_cache_unlock(cache, flags);
+
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	mm_takesemaphore(heap);
+	heapinfo_subtract_size(heap, pid, MM_CACHE_CHUNK_SIZE(cls));
+	mm_givesemaphore(heap);
+#endif
+
+	if (nvictims > 0) {
+		mm_cache_release(heap, victim, nvictims);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+/****************************************************************************
+ * Name: mm_cache_flush
+ *
+ * Description:
+ *   Return every chunk parked in the magazines of all CPUs to the heap.
+ *   This is used when an allocation cannot be satisfied from the nodelist.
+ *
+ * Return Value:
+ *   The number of chunks returned to the heap.
+ *
+ ****************************************************************************/
+int mm_cache_flush(FAR struct mm_heap_s *heap)
+{
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+	FAR struct mm_allocnode_s *chunk[CONFIG_MM_PERCPU_CACHE_DEPTH];
+	FAR struct mm_cache_magazine_s *mag;
+	FAR struct mm_cache_s *cache;
+	irqstate_t flags;
+	int nchunks;
+	int total = 0;
+	int cpu;
+	int cls;
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		for (cls = 0; cls < MM_CACHE_NCLASSES; cls++) {
+			cache = mm_cache_lock(heap, cpu, &flags);
+			mag = &cache->mag[cls];
+			nchunks = mag->count;
+			memcpy(chunk, mag->chunk, nchunks * sizeof(FAR struct mm_allocnode_s *));
+			mag->count = 0;
+			mm_cache_unlock(cache, flags);
+
+			if (nchunks > 0) {
+				mm_cache_release(heap, chunk, nchunks);
+				total += nchunks;
+			}
+		}
+	}
+
+	if (total > 0) {
+		mvdbg("Flushed %d chunks from the per-CPU cache\n", total);
+	}
+
+	return total;
+#else
+	return 0;
+#endif
+}
+
+/****************************************************************************
+ * Name: mm_cache_getstats
+ *
+ * Description:
+ *   Get the hit/miss counters of the magazines of one CPU and the amount of
+ *   memory currently parked in them.  The values are a snapshot taken
+ *   without locking.
+ *
+ ****************************************************************************/
+void mm_cache_getstats(FAR struct mm_heap_s *heap, int cpu, FAR struct mm_cache_stats_s *stats, FAR size_t *cached)
+{
+	FAR struct mm_cache_s *cache;
+	int cls;
+
+	DEBUGASSERT(stats && cached && cpu >= 0 && cpu < CONFIG_SMP_NCPUS);
+
+	cache = &heap->mm_cache[cpu];
+	*stats = cache->stats;
+	*cached = 0;
+	for (cls = 0; cls < MM_CACHE_NCLASSES; cls++) {
+		*cached += cache->mag[cls].count * MM_CACHE_CHUNK_SIZE(cls);
+	}
+}
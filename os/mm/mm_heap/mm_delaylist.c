@@ -0,0 +1,208 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/clock.h>
+#include <tinyara/mm/mm.h>
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+static inline bool mm_delaylist_pending(FAR struct mm_heap_s *heap)
+{
+	return heap->mm_delaydrain != NULL || __atomic_load_n(&heap->mm_delaylist, __ATOMIC_RELAXED) != NULL;
+}
+
+#ifdef MM_DELAYLIST_WORKER
+/* Drain one batch on the low priority work queue and come back for the next
+ * one, so that other work can run in between.
+ */
+
+static void mm_delaylist_worker(FAR void *arg)
+{
+	FAR struct mm_heap_s *heap = (FAR struct mm_heap_s *)arg;
+	bool pending;
+
+	if (!mm_takesemaphore(heap)) {
+		return;
+	}
+
+	(void)mm_drain_delaylist(heap, CONFIG_MM_DELAYLIST_BATCH);
+	pending = mm_delaylist_pending(heap);
+	mm_givesemaphore(heap);
+
+	if (pending) {
+		(void)work_queue(LPWORK, &heap->mm_delaywork, mm_delaylist_worker, heap, 0);
+	}
+}
+#endif
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_delaylist_initialize
+ *
+ * Description:
+ *   Start with an empty delay list and cleared counters.
+ *
+ ****************************************************************************/
+void mm_delaylist_initialize(FAR struct mm_heap_s *heap)
+{
+	heap->mm_delaylist = NULL;
+	heap->mm_delaydrain = NULL;
+	memset(&heap->mm_delaystats, 0, sizeof(struct mm_delaylist_stats_s));
+#ifdef CONFIG_SCHED_WORKQUEUE
+	memset(&heap->mm_delaywork, 0, sizeof(struct work_s));
+#endif
+}
+
+/****************************************************************************
+ * Name: mm_add_delaylist
+ *
+ * Description:
+ *   Defer the free of 'mem' because the MM semaphore cannot be taken, as in
+ *   an interrupt handler on SMP.  This never blocks nor disables interrupts:
+ *   the chunk is pushed on the list with a compare-and-swap, so any number
+ *   of CPUs may push at the same time.  The single consumer always detaches
+ *   the whole list, never one node, so a push cannot meet the ABA problem.
+ *
+ ****************************************************************************/
+void mm_add_delaylist(FAR struct mm_heap_s *heap, FAR void *mem)
+{
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+	FAR struct mm_delaynode_s *node = (FAR struct mm_delaynode_s *)mem;
+	FAR struct mm_delaylist_stats_s *stats = &heap->mm_delaystats;
+	uint32_t depth;
+
+	node->stamp = (uint32_t)clock_systimer();
+	node->flink = __atomic_load_n(&heap->mm_delaylist, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&heap->mm_delaylist, &node->flink, node, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+		/* node->flink was reloaded with the current head, try again */
+	}
+
+	/* The peak may miss a concurrent push on another CPU, which is fine for
+	 * a statistic.
+	 */
+
+	depth = __atomic_add_fetch(&stats->depth, 1, __ATOMIC_RELAXED);
+	if (depth > stats->maxdepth) {
+		stats->maxdepth = depth;
+	}
+
+	__atomic_add_fetch(&stats->nqueued, 1, __ATOMIC_RELAXED);
+
+#ifdef MM_DELAYLIST_WORKER
+	/* Let the worker drain it.  Queueing work is allowed from interrupt
+	 * handlers and returns -EALREADY if the worker is already pending.
+	 */
+
+	if (work_available(&heap->mm_delaywork)) {
+		(void)work_queue(LPWORK, &heap->mm_delaywork, mm_delaylist_worker, heap, 0);
+	}
+#endif
+#endif
+}
+
+/****************************************************************************
+ * Name: mm_drain_delaylist
+ *
+ * Description:
+ *   Return up to 'batch' deferred frees to the heap, or all of them if
+ *   'batch' is zero or negative.  The caller must hold the MM semaphore,
+ *   which also makes it the only consumer of the list.
+ *
+ * Returned Value:
+ *   The number of chunks freed.
+ *
+ ****************************************************************************/
+int mm_drain_delaylist(FAR struct mm_heap_s *heap, int batch)
+{
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+	FAR struct mm_delaylist_stats_s *stats = &heap->mm_delaystats;
+	FAR struct mm_delaynode_s *node;
+	uint32_t latency;
+	uint32_t now;
+	int ndrained = 0;
+
+	if (!mm_delaylist_pending(heap)) {
+		return 0;
+	}
+
+	now = (uint32_t)clock_systimer();
+
+	while (batch <= 0 || ndrained < batch) {
+		if (!heap->mm_delaydrain) {
+			/* Detach everything pushed so far, new pushes start over */
+
+			heap->mm_delaydrain = __atomic_exchange_n(&heap->mm_delaylist, NULL, __ATOMIC_ACQUIRE);
+			if (!heap->mm_delaydrain) {
+				break;
+			}
+		}
+
+		node = heap->mm_delaydrain;
+		heap->mm_delaydrain = node->flink;
+
+		latency = now - node->stamp;
+		if (latency > stats->maxlatency) {
+			stats->maxlatency = latency;
+		}
+
+		/* The MM semaphore is already held, mm_free() only counts it again */
+
+		mm_free(heap, node);
+		ndrained++;
+	}
+
+	__atomic_sub_fetch(&stats->depth, ndrained, __ATOMIC_RELAXED);
+	stats->ndrained += ndrained;
+
+	return ndrained;
+#else
+	return 0;
+#endif
+}
+
+/****************************************************************************
+ * Name: mm_delaylist_getstats
+ *
+ * Description:
+ *   Get the counters of the delay list.  The values are a snapshot taken
+ *   without locking.
+ *
+ ****************************************************************************/
+void mm_delaylist_getstats(FAR struct mm_heap_s *heap, FAR struct mm_delaylist_stats_s *stats)
+{
+	DEBUGASSERT(stats);
+
+	*stats = heap->mm_delaystats;
+}
@@ -72,28 +72,74 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Private Functions
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_freechunk
+ *
+ * Description:
+ *   Return an allocated chunk to the nodelist, merging it with adjacent
+ *   free chunks if possible.  The caller must hold the MM semaphore.
+ *
  ****************************************************************************/
-static void mm_add_delaylist(FAR struct mm_heap_s *heap, FAR void *mem)
+void mm_freechunk(FAR struct mm_heap_s *heap, FAR struct mm_allocnode_s *chunk)
 {
-#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
-	FAR struct mm_delaynode_s *tmp = mem;
-	irqstate_t flags;
+	FAR struct mm_freenode_s *node = (FAR struct mm_freenode_s *)chunk;
+	FAR struct mm_freenode_s *prev;
+	FAR struct mm_freenode_s *next;
 
-	/* Delay the deallocation until a more appropriate time. */
+	node->preceding &= ~MM_ALLOC_BIT;
 
-	flags = enter_critical_section();
+	/* Check if the following node is free and, if so, merge it */
 
-	tmp->flink = heap->mm_delaylist[up_cpu_index()];
-	heap->mm_delaylist[up_cpu_index()] = tmp;
+	next = (FAR struct mm_freenode_s *)((char *)node + node->size);
+	if ((next->preceding & MM_ALLOC_BIT) == 0) {
+		FAR struct mm_allocnode_s *andbeyond;
 
-	leave_critical_section(flags);
-#endif
-}
+		/* Get the node following the next node (which will
+		 * become the new next node). We know that we can never
+		 * index past the tail chunk because it is always allocated.
+		 */
 
-/****************************************************************************
- * Public Functions
- ****************************************************************************/
+		andbeyond = (FAR struct mm_allocnode_s *)((char *)next + next->size);
+
+		/* Remove the next node.  There must be a predecessor,
+		 * but there may not be a successor node.
+		 */
+
+		REMOVE_NODE_FROM_LIST(heap, next);
+
+		/* Then merge the two chunks */
+
+		node->size          += next->size;
+		andbeyond->preceding = node->size | (andbeyond->preceding & MM_ALLOC_BIT);
+		next                 = (FAR struct mm_freenode_s *)andbeyond;
+	}
+
+	/* Check if the preceding node is also free and, if so, merge
+	 * it with this node
+	 */
+
+	prev = (FAR struct mm_freenode_s *)((char *)node - node->preceding);
+	if ((prev->preceding & MM_ALLOC_BIT) == 0) {
+		/* Remove the node.  There must be a predecessor, but there may
+		 * not be a successor node.
+		 */
+
+		REMOVE_NODE_FROM_LIST(heap, prev);
+
+		/* Then merge the two chunks */
+
+		prev->size     += node->size;
+		next->preceding = prev->size | (next->preceding & MM_ALLOC_BIT);
+		node            = prev;
+	}
+
+	/* Add the merged node to the nodelist */
+
+	mm_addfreechunk(heap, node);
+}
 
 /****************************************************************************
  * Name: mm_free
@@ -105,9 +151,7 @@ static void mm_add_delaylist(FAR struct mm_heap_s *heap, FAR void *mem)
  ****************************************************************************/
 void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
 {
-	FAR struct mm_freenode_s *node;
-	FAR struct mm_freenode_s *prev;
-	FAR struct mm_freenode_s *next;
+	FAR struct mm_allocnode_s *node;
 
 	mvdbg("Freeing %p\n", mem);
 
@@ -125,6 +169,14 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
 		return;
 	}
 
+#ifdef CONFIG_MM_PERCPU_CACHE
+	/* Small chunks go back to the magazine of this CPU if there is room */
+
+	if (mm_cache_free(heap, mem)) {
+		return;
+	}
+#endif
+
 	/* We need to hold the MM semaphore while we muck with the
 	 * nodelist.
 	 */
@@ -141,7 +193,7 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
 
 	/* Map the memory chunk into a free node */
 
-	node = (FAR struct mm_freenode_s *)((char *)mem - SIZEOF_MM_ALLOCNODE);
+	node = (FAR struct mm_allocnode_s *)((char *)mem - SIZEOF_MM_ALLOCNODE);
 	
 	if ((node->preceding & MM_ALLOC_BIT) != MM_ALLOC_BIT) {
 		/* There are 3 cases of logical error scenarios
@@ -158,58 +210,10 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
 		return;
 	}
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
-	heapinfo_subtract_size(heap, ((struct mm_allocnode_s *)node)->pid, ((struct mm_allocnode_s *)node)->size);
-	heapinfo_update_total_size(heap, ((-1) * ((struct mm_allocnode_s *)node)->size), ((struct mm_allocnode_s *)node)->pid);
+	heapinfo_subtract_size(heap, node->pid, node->size);
+	heapinfo_update_total_size(heap, ((-1) * node->size), node->pid);
 #endif
-	node->preceding &= ~MM_ALLOC_BIT;
-
-	/* Check if the following node is free and, if so, merge it */
-
-	next = (FAR struct mm_freenode_s *)((char *)node + node->size);
-	if ((next->preceding & MM_ALLOC_BIT) == 0) {
-		FAR struct mm_allocnode_s *andbeyond;
-
-		/* Get the node following the next node (which will
-		 * become the new next node). We know that we can never
-		 * index past the tail chunk because it is always allocated.
-		 */
-
-		andbeyond = (FAR struct mm_allocnode_s *)((char *)next + next->size);
-
-		/* Remove the next node.  There must be a predecessor,
-		 * but there may not be a successor node.
-		 */
-
-		REMOVE_NODE_FROM_LIST(next);
 
-		/* Then merge the two chunks */
-
-		node->size          += next->size;
-		andbeyond->preceding = node->size | (andbeyond->preceding & MM_ALLOC_BIT);
-		next                 = (FAR struct mm_freenode_s *)andbeyond;
-	}
-
-	/* Check if the preceding node is also free and, if so, merge
-	 * it with this node
-	 */
-
-	prev = (FAR struct mm_freenode_s *)((char *)node - node->preceding);
-	if ((prev->preceding & MM_ALLOC_BIT) == 0) {
-		/* Remove the node.  There must be a predecessor, but there may
-		 * not be a successor node.
-		 */
-
-		REMOVE_NODE_FROM_LIST(prev);
-
-		/* Then merge the two chunks */
-
-		prev->size     += node->size;
-		next->preceding = prev->size | (next->preceding & MM_ALLOC_BIT);
-		node            = prev;
-	}
-
-	/* Add the merged node to the nodelist */
-
-	mm_addfreechunk(heap, node);
+	mm_freechunk(heap, node);
 	mm_givesemaphore(heap);
 }
@@ -38,6 +38,21 @@ static size_t mm_get_largest_freesize_from_specific_heap(struct mm_heap_s *heap)
 	struct mm_freenode_s *fnode;
 	int nodelist_idx = 0;
 
+#ifdef CONFIG_MM_TLSF_INDEX
+	/* The lists of the two-level index are not sorted,
+	 * so the highest non-empty list is walked to find the largest node.
+	 */
+	for (nodelist_idx = MM_NLISTS - 1; nodelist_idx >= 0; --nodelist_idx) {
+		for (fnode = heap->mm_nodelist[nodelist_idx].flink; fnode; fnode = fnode->flink) {
+			if (largest_size < fnode->size) {
+				largest_size = fnode->size;
+			}
+		}
+		if (largest_size > 0) {
+			break;
+		}
+	}
+#else
 	/* Free nodes are sorted in a descending order,
 	 * so the first node in each nodelist is the largest within its nodelist.
 	 */
@@ -49,6 +64,7 @@ static size_t mm_get_largest_freesize_from_specific_heap(struct mm_heap_s *heap)
 			break;
 		}
 	}
+#endif
 	return largest_size;
 }
 
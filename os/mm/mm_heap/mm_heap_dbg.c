@@ -88,7 +88,7 @@ void mm_dump_heap_free_node_list(struct mm_heap_s *heap)
 	heap_dbg("Dump heap free node list\n");
 	heap_dbg("[ndx], [HEAD]: [FREE NODES(SIZE)]\n");
 	heap_dbg("#########################################################################################\n");
-	for (uint8_t ndx = 0; ndx < MM_NNODES; ndx++) {
+	for (uint8_t ndx = 0; ndx < MM_NLISTS; ndx++) {
 		heap_dbg("%3d, %08x:", ndx, &heap->mm_nodelist[ndx]);
 		for (node = heap->mm_nodelist[ndx].flink; node; node = node->flink) {
 			heap_dbg(" %08x(%d)", node, node->size);
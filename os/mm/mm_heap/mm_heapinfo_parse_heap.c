@@ -128,6 +128,20 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 #define region 0
 #endif
 
+	/* Usage of each region, reported below the heap summary */
+	size_t region_used[CONFIG_KMM_REGIONS];
+	size_t region_free[CONFIG_KMM_REGIONS];
+	size_t region_largest[CONFIG_KMM_REGIONS];
+	int ridx;
+
+	struct mm_delaylist_stats_s delay_stats;
+
+#ifdef CONFIG_MM_PERCPU_CACHE
+	struct mm_cache_stats_s cache_stats;
+	size_t cache_size;
+	int cpu;
+#endif
+
 #ifdef CONFIG_DEBUG_CHECK_FRAGMENTATION
 	int ndx;
 	int nodelist_cnt[MM_NNODES] = {0, };
@@ -135,6 +149,15 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 	FAR struct mm_freenode_s *fnode;
 #endif
 
+#ifdef CONFIG_MM_PROFILER
+	if (mode == HEAPINFO_PROFILE) {
+		/* The profile is printed on its own, without walking the heap */
+
+		mm_profile_report(heap);
+		return;
+	}
+#endif
+
 	ASSERT(mm_check_heap_corruption(heap) == OK);
 
 #ifdef CONFIG_WATCHDOG
@@ -163,6 +186,11 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 		nonsched_list[nonsched_idx] = HEAPINFO_NONSCHED;
 		nonsched_size[nonsched_idx] = 0;
 	}
+	for (ridx = 0; ridx < CONFIG_KMM_REGIONS; ridx++) {
+		region_used[ridx] = 0;
+		region_free[ridx] = 0;
+		region_largest[ridx] = 0;
+	}
 
 	/* Visit each region */
 
@@ -190,6 +218,16 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 		for (node = heap->mm_heapstart[region]; node < heap->mm_heapend[region]; node = (struct mm_allocnode_s *)((char *)node + node->size)) {
 			ASSERT(node->size);
 
+			/* Account the node to the usage of its region */
+			if ((node->preceding & MM_ALLOC_BIT) != 0) {
+				region_used[region] += node->size;
+			} else {
+				region_free[region] += node->size;
+				if (node->size > region_largest[region]) {
+					region_largest[region] = node->size;
+				}
+			}
+
 			/* Check if the node corresponds to an allocated memory chunk */
 			if ((pid == HEAPINFO_PID_ALL || node->pid == pid) && (node->preceding & MM_ALLOC_BIT) != 0) {
 				if (mode == HEAPINFO_DETAIL_ALL || mode == HEAPINFO_DETAIL_PID || mode == HEAPINFO_DETAIL_SPECIFIC_HEAP) {
@@ -266,12 +304,27 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 	heap_dbg("  - Free (Current)              : %u (%d%%)\n", fordblks, (size_t)((uint64_t)fordblks * 100 / heap_size));
 	heap_dbg("  - Reserved                    : %u\n", SIZEOF_MM_ALLOCNODE * 2);
 
+	heap_dbg("\n< Regions >\n");
+	heap_dbg(" Region |   Start    |   Size   |   Used   |   Free   | Largest\n");
+	heap_dbg("--------|------------|----------|----------|----------|----------\n");
+#if CONFIG_KMM_REGIONS > 1
+	for (ridx = 0; ridx < heap->mm_nregions; ridx++)
+#else
+	ridx = 0;
+#endif
+	{
+		heap_dbg(" %6d | 0x%8x | %8u | %8u | %8u | %8u\n", ridx, heap->mm_heapstart[ridx],
+			(size_t)heap->mm_heapend[ridx] - (size_t)heap->mm_heapstart[ridx] + SIZEOF_MM_ALLOCNODE,
+			region_used[ridx], region_free[ridx], region_largest[ridx]);
+	}
+
 	heap_dbg("\n****************************************************************\n");
 	heap_dbg("     Details of Heap Usages (Size in Bytes)\n");
 	heap_dbg("****************************************************************\n");
 	heap_dbg("< Free >\n");
 	heap_dbg("  - Number of Free Node               : %d\n", ordblks);
 	heap_dbg("  - Largest Free Node Size            : %u\n", mxordblk);
+	heap_dbg("  - External Fragmentation            : %d%%\n", fordblks > 0 ? 100 - (int)((uint64_t)mxordblk * 100 / fordblks) : 0);
 	heap_dbg("\n< Allocation >\n");
 	heap_dbg("  - Current Size (Alive Allocation) = (1) + (2) + (3)\n");
 	heap_dbg("     . by Dead Threads (*) (1)        : %u\n", nonsched_resource);
@@ -284,15 +337,38 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 	heap_dbg("(**) Only Idle task has a separate stack region,\n");
 	heap_dbg("  rest are all allocated on the heap region.\n");
 
+#ifdef CONFIG_MM_PERCPU_CACHE
+	heap_dbg("\n< Per-CPU Small Object Cache >\n");
+	heap_dbg(" CPU |  Cached  | Alloc Hit  | Alloc Miss |  Free Hit  | Free Miss\n");
+	heap_dbg("-----|----------|------------|------------|------------|-----------\n");
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		mm_cache_getstats(heap, cpu, &cache_stats, &cache_size);
+		heap_dbg(" %3d | %8u | %10u | %10u | %10u | %10u\n", cpu, cache_size,
+			cache_stats.alloc_hit, cache_stats.alloc_miss, cache_stats.free_hit, cache_stats.free_miss);
+	}
+	heap_dbg("** Cached chunks are counted as allocated memory above.\n");
+#endif
+
+	heap_dbg("\n< Realloc >\n");
+	heap_dbg("  - Shrunk in Place                   : %u\n", heap->mm_reallocstats.nshrink);
+	heap_dbg("  - Grown in Place (Forward/Backward) : %u / %u\n", heap->mm_reallocstats.nforward, heap->mm_reallocstats.nbackward);
+	heap_dbg("  - Moved by Copy                     : %u\n", heap->mm_reallocstats.ncopy);
+
+	mm_delaylist_getstats(heap, &delay_stats);
+	heap_dbg("\n< Deferred Free >\n");
+	heap_dbg("  - Pending (Peak)                    : %u (%u)\n", delay_stats.depth, delay_stats.maxdepth);
+	heap_dbg("  - Deferred / Drained                : %u / %u\n", delay_stats.nqueued, delay_stats.ndrained);
+	heap_dbg("  - Longest Wait                      : %u ticks\n", delay_stats.maxlatency);
+
 #ifdef CONFIG_DEBUG_CHECK_FRAGMENTATION
 	heap_dbg("\nAvailable fragmented memory segments in heap memory\n");
 
 	DEBUGVERIFY(mm_takesemaphore(heap));
 
-	for (ndx = 0; ndx < MM_NNODES; ++ndx) {
+	for (ndx = 0; ndx < MM_NLISTS; ++ndx) {
 		for (fnode = heap->mm_nodelist[ndx].flink; fnode && fnode->size; fnode = fnode->flink) {
-			++nodelist_cnt[ndx];
-			nodelist_size[ndx] += fnode->size;
+			++nodelist_cnt[MM_NDX2FL(ndx)];
+			nodelist_size[MM_NDX2FL(ndx)] += fnode->size;
 		}
 	}
 
@@ -227,7 +227,9 @@ int mm_addregion(FAR struct mm_heap_s *heap, FAR void *heapstart, size_t heapsiz
 int mm_initialize(FAR struct mm_heap_s *heap, FAR void *heapstart, size_t heapsize)
 {
 	int ret;
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
 	int i;
+#endif
 
 	mlldbg("Heap: start=%p size=%u\n", heapstart, heapsize);
 
@@ -251,13 +253,29 @@ int mm_initialize(FAR struct mm_heap_s *heap, FAR void *heapstart, size_t heapsi
 
 	/* Initialize the node array */
 
-	memset(heap->mm_nodelist, 0, sizeof(struct mm_freenode_s) * (MM_NNODES + 1));
+	memset(heap->mm_nodelist, 0, sizeof(struct mm_freenode_s) * (MM_NLISTS + 1));
+#ifdef CONFIG_MM_TLSF_INDEX
+	heap->mm_flbitmap = 0;
+	memset(heap->mm_slbitmap, 0, sizeof(heap->mm_slbitmap));
+#endif
+	memset(heap->mm_nfreechunks, 0, sizeof(heap->mm_nfreechunks));
+	heap->mm_freebytes = 0;
+	heap->mm_lowmem = NULL;
+	memset(&heap->mm_reallocstats, 0, sizeof(heap->mm_reallocstats));
 
-	/* Initialize delay list to NULL for all cpus */
+	/* Start with an empty delay list */
 
-	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
-		heap->mm_delaylist[i] = NULL;
-	}
+	mm_delaylist_initialize(heap);
+
+#ifdef CONFIG_MM_PROFILER
+	mm_profile_initialize(heap);
+#endif
+
+#ifdef CONFIG_MM_PERCPU_CACHE
+	/* Start with empty per-CPU magazines */
+
+	mm_cache_initialize(heap);
+#endif
 
 	/* Initialize the malloc semaphore to one (to support one-at-
 	 * a-time access to private data sets).
@@ -0,0 +1,128 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/mm/mm.h>
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_lowmem_register
+ *
+ * Description:
+ *   Add a low memory notifier to a heap.  The caller fills 'threshold',
+ *   'callback' and 'arg' and keeps the structure until it is unregistered.
+ *   If the heap is already below the threshold, the notifier fires on the
+ *   next allocation.
+ *
+ ****************************************************************************/
+int mm_lowmem_register(FAR struct mm_heap_s *heap, FAR struct mm_lowmem_s *notifier)
+{
+	if (!heap || !notifier || !notifier->callback) {
+		return -EINVAL;
+	}
+
+	DEBUGVERIFY(mm_takesemaphore(heap));
+
+	notifier->fired = false;
+	notifier->flink = heap->mm_lowmem;
+	heap->mm_lowmem = notifier;
+
+	mm_givesemaphore(heap);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: mm_lowmem_unregister
+ *
+ * Description:
+ *   Remove a low memory notifier from a heap.
+ *
+ ****************************************************************************/
+int mm_lowmem_unregister(FAR struct mm_heap_s *heap, FAR struct mm_lowmem_s *notifier)
+{
+	FAR struct mm_lowmem_s **link;
+	int ret = -ENOENT;
+
+	if (!heap || !notifier) {
+		return -EINVAL;
+	}
+
+	DEBUGVERIFY(mm_takesemaphore(heap));
+
+	for (link = &heap->mm_lowmem; *link; link = &(*link)->flink) {
+		if (*link == notifier) {
+			*link = notifier->flink;
+			ret = OK;
+			break;
+		}
+	}
+
+	mm_givesemaphore(heap);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: mm_lowmem_check
+ *
+ * Description:
+ *   Compare the free memory of the heap with the thresholds of its
+ *   notifiers after an allocation, firing and re-arming them.  It costs a
+ *   single test when no notifier is registered.
+ *
+ ****************************************************************************/
+void mm_lowmem_check(FAR struct mm_heap_s *heap)
+{
+	FAR struct mm_lowmem_s *notifier;
+	size_t freebytes;
+
+	if (!heap->mm_lowmem) {
+		return;
+	}
+
+	if (!mm_takesemaphore(heap)) {
+		return;
+	}
+
+	for (notifier = heap->mm_lowmem; notifier; notifier = notifier->flink) {
+		freebytes = heap->mm_freebytes;
+		if (!notifier->fired && freebytes < notifier->threshold) {
+			/* Set it first so that an allocation by the callback does
+			 * not fire it again.
+			 */
+
+			notifier->fired = true;
+			mvdbg("Low memory: %u bytes free, threshold %u\n", freebytes, notifier->threshold);
+			notifier->callback(heap, freebytes, notifier->arg);
+		} else if (notifier->fired && freebytes >= notifier->threshold + (notifier->threshold >> 3)) {
+			notifier->fired = false;
+		}
+	}
+
+	mm_givesemaphore(heap);
+}
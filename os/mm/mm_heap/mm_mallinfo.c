@@ -59,6 +59,7 @@
 #include <assert.h>
 #include <debug.h>
 #include <unistd.h>
+#include <string.h>
 #include <tinyara/mm/mm.h>
 #include <tinyara/sched.h>
 
@@ -73,6 +74,69 @@
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
+
+/* Find the largest free chunk from the free chunk counters.  Only the lists
+ * of the highest non-empty bucket are visited.  The caller holds the MM
+ * semaphore.
+ */
+
+static size_t mm_largest_freechunk(FAR struct mm_heap_s *heap)
+{
+	FAR struct mm_freenode_s *node;
+	size_t largest = 0;
+	int bucket;
+	int ndx;
+
+	for (bucket = MM_NNODES - 1; bucket >= 0 && heap->mm_nfreechunks[bucket] == 0; bucket--) ;
+
+	if (bucket < 0) {
+		return 0;
+	}
+
+	for (ndx = 0; ndx < MM_NLISTS; ndx++) {
+		if (MM_NDX2FL(ndx) != bucket) {
+			continue;
+		}
+
+#ifdef CONFIG_MM_TLSF_INDEX
+		for (node = heap->mm_nodelist[ndx].flink; node; node = node->flink) {
+			if (node->size > largest) {
+				largest = node->size;
+			}
+		}
+#else
+		/* The list is sorted in a descending order */
+
+		node = heap->mm_nodelist[ndx].flink;
+		if (node && node->size > largest) {
+			largest = node->size;
+		}
+#endif
+	}
+
+	return largest;
+}
+
+/* Store the figures of one heap, or add them to those of the previous heaps */
+
+static void mm_mallinfo_update(FAR struct mallinfo *info, size_t arena, int ordblks, size_t mxordblk, size_t uordblks, size_t fordblks)
+{
+#if CONFIG_KMM_NHEAPS > 1
+	info->arena    += arena;
+	info->ordblks  += ordblks;
+	info->mxordblk = (info->mxordblk > mxordblk) ? info->mxordblk : mxordblk;
+	info->uordblks += uordblks;
+	info->fordblks += fordblks;
+#else
+	info->arena    = arena;
+	info->ordblks  = ordblks;
+	info->mxordblk = mxordblk;
+	info->uordblks = uordblks;
+	info->fordblks = fordblks;
+#endif
+	info->fragratio = info->fordblks > 0 ? 100 - (int)((uint64_t)info->mxordblk * 100 / info->fordblks) : 0;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -155,19 +219,7 @@ int mm_mallinfo_aligned(FAR struct mm_heap_s *heap, FAR struct mallinfo *info, s
 
 	DEBUGASSERT(uordblks + fordblks == heap->mm_heapsize);
 
-#if CONFIG_KMM_NHEAPS > 1
-	info->arena    += heap->mm_heapsize;
-	info->ordblks  += ordblks;
-	info->mxordblk = (info->mxordblk > mxordblk) ? info->mxordblk : mxordblk;
-	info->uordblks += uordblks;
-	info->fordblks += fordblks;
-#else
-	info->arena    = heap->mm_heapsize;
-	info->ordblks  = ordblks;
-	info->mxordblk = mxordblk;
-	info->uordblks = uordblks;
-	info->fordblks = fordblks;
-#endif
+	mm_mallinfo_update(info, heap->mm_heapsize, ordblks, mxordblk, uordblks, fordblks);
 	return OK;
 }
 
@@ -175,11 +227,51 @@ int mm_mallinfo_aligned(FAR struct mm_heap_s *heap, FAR struct mallinfo *info, s
  * Name: mm_mallinfo
  *
  * Description:
- *   mallinfo returns a copy of updated current heap information.
+ *   mallinfo returns a copy of updated current heap information.  It is
+ *   built from the free chunk counters without walking the heap.
  *
  ****************************************************************************/
 
 int mm_mallinfo(FAR struct mm_heap_s *heap, FAR struct mallinfo *info)
 {
-	return mm_mallinfo_aligned(heap, info, 0);
+	struct mm_fraginfo_s frag;
+	int ordblks = 0;
+	int bucket;
+
+	DEBUGASSERT(info);
+
+	mm_fraginfo(heap, &frag);
+	for (bucket = 0; bucket < MM_NNODES; bucket++) {
+		ordblks += frag.nfree[bucket];
+	}
+
+	mm_mallinfo_update(info, heap->mm_heapsize, ordblks, frag.largest, heap->mm_heapsize - frag.freebytes, frag.freebytes);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: mm_fraginfo
+ *
+ * Description:
+ *   Get the free chunk counts per bucket, the largest free chunk and the
+ *   external fragmentation of a heap.  A ratio of 0 means all the free
+ *   memory is in one chunk, and it gets close to 100 as the free memory
+ *   is split into many small chunks.
+ *
+ ****************************************************************************/
+
+int mm_fraginfo(FAR struct mm_heap_s *heap, FAR struct mm_fraginfo_s *info)
+{
+	DEBUGASSERT(info);
+
+	DEBUGVERIFY(mm_takesemaphore(heap));
+
+	memcpy(info->nfree, heap->mm_nfreechunks, sizeof(info->nfree));
+	info->freebytes = heap->mm_freebytes;
+	info->largest = mm_largest_freechunk(heap);
+
+	mm_givesemaphore(heap);
+
+	info->fragratio = info->freebytes > 0 ? 100 - (int)((uint64_t)info->largest * 100 / info->freebytes) : 0;
+	return OK;
 }
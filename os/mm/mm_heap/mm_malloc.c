@@ -90,87 +90,98 @@
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
-static void mm_free_delaylist(FAR struct mm_heap_s *heap)
+#ifdef CONFIG_MM_TLSF_INDEX
+/****************************************************************************
+ * Name: mm_findchunk
+ *
+ * Description:
+ *  Find a free chunk of at least 'size' bytes with the bitmaps of the
+ *  two-level index.  The head of the first non-empty list at or above the
+ *  rounded up request always fits, so no list is walked except the last
+ *  one, which also holds every chunk beyond MM_MAX_CHUNK.
+ *
+ *  The bit of a list emptied by REMOVE_NODE_FROM_LIST is cleared here when
+ *  it is met, so a search visits at most MM_NLISTS lists.
+ *
+ ****************************************************************************/
+static FAR struct mm_freenode_s *mm_findchunk(FAR struct mm_heap_s *heap, size_t size)
 {
-#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
-	FAR struct mm_delaynode_s *tmp;
-	irqstate_t flags;
+	FAR struct mm_freenode_s *node;
+	uint32_t flmap;
+	uint32_t slmap;
+	int ndx;
+	int fl;
+	int sl;
 
-	/* Move the delay list to local */
+	ndx = mm_size2ndx_search(size);
 
-	flags = enter_critical_section();
+	for (;;) {
+		fl = MM_NDX2FL(ndx);
+		sl = ndx & (MM_SLI_COUNT - 1);
 
-	tmp = heap->mm_delaylist[up_cpu_index()];
-	heap->mm_delaylist[up_cpu_index()] = NULL;
+		slmap = heap->mm_slbitmap[fl] & (~0U << sl);
+		if (!slmap) {
+			/* Nothing left in this range, go to the next non-empty one */
 
-	leave_critical_section(flags);
+			flmap = (fl + 1 < MM_NNODES) ? heap->mm_flbitmap & (~0U << (fl + 1)) : 0;
+			if (!flmap) {
+				return NULL;
+			}
 
-	/* Test if the delayed is empty */
+			fl = __builtin_ctz(flmap);
+			slmap = heap->mm_slbitmap[fl];
+		}
 
-	while (tmp)
-	{
-		FAR void *address;
+		sl = __builtin_ctz(slmap);
+		ndx = (fl << MM_SLI_SHIFT) + sl;
 
-		/* Get the first delayed deallocation */
+		node = heap->mm_nodelist[ndx].flink;
+		if (node) {
+			break;
+		}
 
-		address = tmp;
-		tmp = tmp->flink;
+		/* Stale bit, the list was emptied since the last search */
 
-		/* The address should always be non-NULL since that was checked in the
-		 * 'while' condition above.
-		 */
+		heap->mm_slbitmap[fl] &= ~(1 << sl);
+		if (!heap->mm_slbitmap[fl]) {
+			heap->mm_flbitmap &= ~((uint32_t)1 << fl);
+		}
+	}
 
-		mm_free(heap, address);
+	if (ndx == MM_NLISTS - 1) {
+		while (node && node->size < size) {
+			node = node->flink;
+		}
 	}
-#endif
+
+	return node;
 }
+#endif
 
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
 /****************************************************************************
- * Name: mm_malloc
+ * Name: mm_allocchunk
  *
  * Description:
- *  Find the smallest chunk that satisfies the request. Take the memory from
- *  that chunk, save the remaining, smaller chunk (if any).
- *
- *  8-byte alignment of the allocated data is assured.
+ *  Take the smallest free chunk that satisfies the request out of the
+ *  nodelist, saving the remaining, smaller chunk (if any).  'size' is the
+ *  whole chunk size (payload and header), already aligned.  The caller must
+ *  hold the MM semaphore.  The returned chunk is marked as allocated.
  *
  ****************************************************************************/
-#ifdef CONFIG_DEBUG_MM_HEAPINFO
-FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size, mmaddress_t caller_retaddr)
-#else
-FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
-#endif
+FAR struct mm_allocnode_s *mm_allocchunk(FAR struct mm_heap_s *heap, size_t size)
 {
 	FAR struct mm_freenode_s *node;
-	void *ret = NULL;
-	int ndx;
-
-
-	/* Free the delay list first */
-	mm_free_delaylist(heap);
-
-	/* Handle bad sizes */
-
-	if (size > MM_ALIGN_DOWN(MMSIZE_MAX) - SIZEOF_MM_ALLOCNODE) {
-		mdbg("Because of mm_allocnode, %u cannot be allocated. The maximum \
-			 allocable size is (MM_ALIGN_DOWN(MMSIZE_MAX) - SIZEOF_MM_ALLOCNODE) \
-			 : %u\n.", size, (MM_ALIGN_DOWN(MMSIZE_MAX) - SIZEOF_MM_ALLOCNODE));
+#ifdef CONFIG_MM_TLSF_INDEX
+	node = mm_findchunk(heap, size);
+	if (!node) {
 		return NULL;
 	}
-
-	/* Adjust the size to account for (1) the size of the allocated node and
-	 * (2) to make sure that it is an even multiple of our granule size.
-	 */
-
-	size = MM_ALIGN_UP(size + SIZEOF_MM_ALLOCNODE);
-
-	/* We need to hold the MM semaphore while we muck with the nodelist. */
-
-	mm_takesemaphore(heap);
+#else
+	int ndx;
 
 	/* Get the location in the node list to start the search
 	 * by converting the request size into a nodelist index.
@@ -195,6 +206,7 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 	if (!(node && node->size == size)) {
 		node = prev;
 	}
+#endif
 
 	/* If we found a node with non-zero size, then this is one to use. Since
 	 * the list is ordered, we know that is must be best fitting chunk
@@ -210,7 +222,7 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 		 * a successor node.
 		 */
 
-		REMOVE_NODE_FROM_LIST(node);
+		REMOVE_NODE_FROM_LIST(heap, node);
 
 		/* Check if we have to split the free node into one of the allocated
 		 * size and another smaller freenode.  In some cases, the remaining
@@ -249,11 +261,103 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 		/* Handle the case of an exact size match */
 
 		node->preceding |= MM_ALLOC_BIT;
+		return (FAR struct mm_allocnode_s *)node;
+	}
 
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: mm_malloc
+ *
+ * Description:
+ *  Find the smallest chunk that satisfies the request. Take the memory from
+ *  that chunk, save the remaining, smaller chunk (if any).
+ *
+ *  8-byte alignment of the allocated data is assured.
+ *
+ ****************************************************************************/
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size, mmaddress_t caller_retaddr)
+#else
+FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
+#endif
+{
+	FAR struct mm_allocnode_s *node;
+	void *ret = NULL;
+
+	/* Handle bad sizes */
+
+	if (size > MM_ALIGN_DOWN(MMSIZE_MAX) - SIZEOF_MM_ALLOCNODE) {
+		mdbg("Because of mm_allocnode, %u cannot be allocated. The maximum \
+			 allocable size is (MM_ALIGN_DOWN(MMSIZE_MAX) - SIZEOF_MM_ALLOCNODE) \
+			 : %u\n.", size, (MM_ALIGN_DOWN(MMSIZE_MAX) - SIZEOF_MM_ALLOCNODE));
+		return NULL;
+	}
+
+#ifdef CONFIG_MM_PERCPU_CACHE
+	/* Small requests are served from the magazine of this CPU first */
+
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	ret = mm_cache_alloc(heap, size, caller_retaddr);
+#else
+	ret = mm_cache_alloc(heap, size);
+#endif
+	if (ret) {
+#ifdef CONFIG_MM_PROFILER
+		node = (FAR struct mm_allocnode_s *)((char *)ret - SIZEOF_MM_ALLOCNODE);
+		mm_profile_alloc(heap, node->size, caller_retaddr);
+#endif
+		return ret;
+	}
+#endif
+
+	/* Adjust the size to account for (1) the size of the allocated node and
+	 * (2) to make sure that it is an even multiple of our granule size.
+	 */
+
+	size = MM_ALIGN_UP(size + SIZEOF_MM_ALLOCNODE);
+
+	/* We need to hold the MM semaphore while we muck with the nodelist. */
+
+	mm_takesemaphore(heap);
+
+#ifndef MM_DELAYLIST_WORKER
+	/* Without a worker to do it, each allocation returns one batch of the
+	 * deferred frees to the heap.
+	 */
+
+	(void)mm_drain_delaylist(heap, CONFIG_MM_DELAYLIST_BATCH);
+#endif
+
+	node = mm_allocchunk(heap, size);
+
+	/* Deferred frees may be exactly what is missing.  Drain all of them
+	 * and retry once.
+	 */
+
+	if (!node && mm_drain_delaylist(heap, 0) > 0) {
+		node = mm_allocchunk(heap, size);
+	}
+
+#ifdef CONFIG_MM_PERCPU_CACHE
+	/* Chunks parked in the magazines may be exactly what is missing.
+	 * Return all of them to the nodelist and retry once.
+	 */
+
+	if (!node && mm_cache_flush(heap) > 0) {
+		node = mm_allocchunk(heap, size);
+	}
+#endif
+
+	if (node) {
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
-		heapinfo_update_node((struct mm_allocnode_s *)node, caller_retaddr);
-		heapinfo_add_size(heap, ((struct mm_allocnode_s *)node)->pid, node->size);
-		heapinfo_update_total_size(heap, node->size, ((struct mm_allocnode_s *)node)->pid);
+		heapinfo_update_node(node, caller_retaddr);
+		heapinfo_add_size(heap, node->pid, node->size);
+		heapinfo_update_total_size(heap, node->size, node->pid);
+#endif
+#ifdef CONFIG_MM_PROFILER
+		mm_profile_alloc(heap, node->size, caller_retaddr);
 #endif
 		ret = (void *)((char *)node + SIZEOF_MM_ALLOCNODE);
 	}
@@ -266,6 +370,10 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 
 	if (ret) {
 		mvdbg("Allocated %p, size %u\n", ret, size);
+
+		/* Let the users of the heap shed memory before it runs out */
+
+		mm_lowmem_check(heap);
 	}
 
 	return ret;
@@ -160,8 +160,18 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment, size_t size)
 	 * If this list does not have free nodes whose size is large enough
 	 * to accommodate the requested size, it will fail due to no more space.
 	 */
-	for (; ndx < MM_NNODES; ndx++) {
+	for (; ndx < MM_NLISTS; ndx++) {
 		node = heap->mm_nodelist[ndx].flink;
+#ifdef CONFIG_MM_TLSF_INDEX
+		/* The lists of the two-level index are not sorted by size, so every
+		 * node of a non-empty list is a candidate.
+		 */
+
+		for ( ; node; node = node->flink) {
+			if (node->size < newsize) {
+				continue;
+			}
+#else
 		if (!(node && node->size >= newsize)) {
 			/* If the list at this index is empty or if the size of first node
 			 * in the list is less than the required size, then go to next index.
@@ -181,12 +191,13 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment, size_t size)
 
 		/* Now, traverse the list in reverse direction, towards bigger size nodes */
 		for ( ; node; node = node->blink) {
+#endif
 			/* Search the suitable aligned address in the same node. */
 			for (alignchunk = (FAR struct mm_allocnode_s *)(((size_t)node + SIZEOF_MM_ALLOCNODE + mask) & ~mask);
 				(uintptr_t)(alignchunk + alignment) < (uintptr_t)(node + node->size);
 				alignchunk = alignchunk + alignment) {
 
-				size_t alignsize = (size_t)alignchunk - (size_t)node + size;
+				size_t alignsize = (size_t)alignchunk - SIZEOF_MM_ALLOCNODE - (size_t)node + newsize;
 				size_t remainsize = (size_t)alignchunk - SIZEOF_MM_ALLOCNODE - (size_t)node;
 
 				/* We found a suitable node if node size is more than required size after alignment and
@@ -217,7 +228,7 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment, size_t size)
 		 * a successor node.
 		 */
 
-		REMOVE_NODE_FROM_LIST(node);
+		REMOVE_NODE_FROM_LIST(heap, node);
 
 		/* Check if there is free space at the beginning of the aligned chunk */
 		if ((size_t)newnode - (size_t)node >= SIZEOF_MM_FREENODE) {
@@ -253,12 +264,12 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment, size_t size)
 
 		/* Check if there is free space at the end of the aligned chunk */
 
-		if (node->size > size + SIZEOF_MM_ALLOCNODE) {
+		if (node->size > newsize) {
 			/* Shrink the chunk by that much -- remember, mm_shrinkchunk wants
 			 * internal chunk sizes that include SIZEOF_MM_ALLOCNODE, and not the
 			 * malloc-compatible sizes that we have.
 			 */
-			mm_shrinkchunk(heap, (FAR struct mm_allocnode_s *)node, size + SIZEOF_MM_ALLOCNODE);
+			mm_shrinkchunk(heap, (FAR struct mm_allocnode_s *)node, newsize);
 		}
 
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
@@ -266,6 +277,9 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment, size_t size)
 		heapinfo_add_size(heap, ((struct mm_allocnode_s *)node)->pid, node->size);
 		heapinfo_update_total_size(heap, node->size, ((struct mm_allocnode_s *)node)->pid);
 #endif
+#ifdef CONFIG_MM_PROFILER
+		mm_profile_alloc(heap, node->size, caller_retaddr);
+#endif
 
 		ret = (void *)alignchunk;
 	}
@@ -278,6 +292,10 @@ FAR void *mm_memalign(FAR struct mm_heap_s *heap, size_t alignment, size_t size)
 
 	if (ret) {
 		mvdbg("Allocated %p, size %u\n", ret, size);
+
+		/* Let the users of the heap shed memory before it runs out */
+
+		mm_lowmem_check(heap);
 	}
 
 	return ret;
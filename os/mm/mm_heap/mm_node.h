@@ -25,19 +25,44 @@
 
 #include <assert.h>
 
+#include <tinyara/mm/mm.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
-#define REMOVE_NODE_FROM_LIST(node)				\
+#define REMOVE_NODE_FROM_LIST(heap, node)			\
 	do {							\
 		DEBUGASSERT((node)->blink);			\
 		(node)->blink->flink = (node)->flink;		\
 		if ((node)->flink) {				\
 			(node)->flink->blink = (node)->blink;	\
 		}						\
+		mm_freecount_sub(heap, (node)->size);		\
 	} while (0)
 
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/* Keep the free chunk counters of mm_fraginfo() up to date.  Every chunk
+ * entering the nodelist goes through mm_addfreechunk() and every chunk
+ * leaving it through REMOVE_NODE_FROM_LIST(), always with the size it had
+ * in the list.
+ */
+
+static inline void mm_freecount_add(FAR struct mm_heap_s *heap, size_t size)
+{
+	heap->mm_nfreechunks[MM_NDX2FL(mm_size2ndx(size))]++;
+	heap->mm_freebytes += size;
+}
+
+static inline void mm_freecount_sub(FAR struct mm_heap_s *heap, size_t size)
+{
+	heap->mm_nfreechunks[MM_NDX2FL(mm_size2ndx(size))]--;
+	heap->mm_freebytes -= size;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -0,0 +1,173 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <debug.h>
+
+#include <tinyara/mm/mm.h>
+
+#ifdef CONFIG_MM_PROFILER
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MM_PROFILE_MASK (CONFIG_MM_PROFILER_NSITES - 1)
+
+#if (CONFIG_MM_PROFILER_NSITES & MM_PROFILE_MASK) != 0
+#error "CONFIG_MM_PROFILER_NSITES must be a power of two"
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static inline uint32_t mm_profile_hash(mmaddress_t caller)
+{
+	/* Fibonacci hashing, the low bits of code addresses are poorly spread */
+
+	return (((uint32_t)(uintptr_t)caller * 2654435761u) >> 16) & MM_PROFILE_MASK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_profile_initialize
+ *
+ * Description:
+ *   Clear the allocation profile of a heap.
+ *
+ ****************************************************************************/
+void mm_profile_initialize(FAR struct mm_heap_s *heap)
+{
+	memset(&heap->mm_profile, 0, sizeof(struct mm_profile_s));
+}
+
+/****************************************************************************
+ * Name: mm_profile_alloc
+ *
+ * Description:
+ *   Account one successful allocation of a 'size' bytes chunk for
+ *   'caller'.  Only every CONFIG_MM_PROFILER_RATE-th call takes the MM
+ *   semaphore to update the table, the others cost one atomic increment.
+ *
+ ****************************************************************************/
+void mm_profile_alloc(FAR struct mm_heap_s *heap, size_t size, mmaddress_t caller)
+{
+	FAR struct mm_profile_s *prof = &heap->mm_profile;
+	FAR struct mm_profile_site_s *site;
+	uint32_t ndx;
+	int i;
+
+	if (__atomic_add_fetch(&prof->nallocs, 1, __ATOMIC_RELAXED) % CONFIG_MM_PROFILER_RATE != 0) {
+		return;
+	}
+
+	/* A sample is simply skipped where the semaphore cannot be taken */
+
+	if (!mm_takesemaphore(heap)) {
+		return;
+	}
+
+	ndx = mm_profile_hash(caller);
+	for (i = 0; i < CONFIG_MM_PROFILER_NSITES; i++) {
+		site = &prof->site[(ndx + i) & MM_PROFILE_MASK];
+		if (site->caller == caller || site->caller == NULL) {
+			site->caller = caller;
+			site->nsamples++;
+			site->nbytes += size;
+			mm_givesemaphore(heap);
+			return;
+		}
+	}
+
+	prof->ndropped++;
+	mm_givesemaphore(heap);
+}
+
+/****************************************************************************
+ * Name: mm_profile_report
+ *
+ * Description:
+ *   Print the CONFIG_MM_PROFILER_TOPN call sites which allocated the most
+ *   bytes.  Counts are scaled back by the sampling rate, so they are
+ *   estimates.
+ *
+ ****************************************************************************/
+void mm_profile_report(FAR struct mm_heap_s *heap)
+{
+	FAR struct mm_profile_s *prof = &heap->mm_profile;
+	struct mm_profile_site_s top[CONFIG_MM_PROFILER_TOPN];
+	uint32_t nallocs;
+	uint32_t ndropped;
+	int ntop = 0;
+	int i;
+	int j;
+
+	/* Keep the largest sites sorted by bytes while scanning the table */
+
+	DEBUGVERIFY(mm_takesemaphore(heap));
+
+	for (i = 0; i < CONFIG_MM_PROFILER_NSITES; i++) {
+		FAR struct mm_profile_site_s *site = &prof->site[i];
+
+		if (site->caller == NULL) {
+			continue;
+		}
+
+		if (ntop == CONFIG_MM_PROFILER_TOPN) {
+			if (site->nbytes <= top[ntop - 1].nbytes) {
+				continue;
+			}
+
+			ntop--;
+		}
+
+		for (j = ntop; j > 0 && top[j - 1].nbytes < site->nbytes; j--) {
+			top[j] = top[j - 1];
+		}
+
+		top[j] = *site;
+		ntop++;
+	}
+
+	nallocs = prof->nallocs;
+	ndropped = prof->ndropped;
+	mm_givesemaphore(heap);
+
+	heap_dbg("\n< Allocation Profile (1 of %d allocations sampled) >\n", CONFIG_MM_PROFILER_RATE);
+	heap_dbg("  - Allocations                       : %u\n", nallocs);
+	heap_dbg("  - Samples Dropped (Table Full)      : %u\n", ndropped);
+	heap_dbg(" Rank |   Caller   |  Est.Count |  Est.Bytes | Avg Size\n");
+	heap_dbg("------|------------|------------|------------|---------\n");
+	for (i = 0; i < ntop; i++) {
+		heap_dbg(" %4d | 0x%8x | %10u | %10u | %8u\n", i + 1, top[i].caller,
+			top[i].nsamples * CONFIG_MM_PROFILER_RATE, top[i].nbytes * CONFIG_MM_PROFILER_RATE,
+			top[i].nbytes / top[i].nsamples);
+	}
+}
+
+#endif							/* CONFIG_MM_PROFILER */
@@ -91,9 +91,10 @@
  *  If the request is for more space and the current allocation can be
  *  extended, it will be extended by:
  *
- *     (1) Taking the additional space from the following free chunk, or
- *     (2) Taking the additional space from the preceding free chunk.
- *     (3) Or both
+ *     (1) Taking the additional space from the following free chunk, which
+ *         needs no copy, or
+ *     (2) Taking what the following free chunk lacks from the preceding
+ *         free chunk, and moving the data down with memmove
  *
  *  If the request is for more space but the current chunk cannot be
  *  extended, then malloc a new buffer, copy the data into the new buffer,
@@ -167,6 +168,7 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 #endif
 
 			mm_shrinkchunk(heap, oldnode, newsize);
+			heap->mm_reallocstats.nshrink++;
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 			/* update the chunk to realloc task information */
 			heapinfo_update_node(oldnode, caller_retaddr);
@@ -202,8 +204,9 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 
 	if (nextsize + prevsize + oldsize >= newsize) {
 		size_t needed   = newsize - oldsize;
-		size_t takeprev = 0;
-		size_t takenext = 0;
+		size_t payload  = oldsize - SIZEOF_MM_ALLOCNODE;
+		size_t takeprev;
+		size_t takenext;
 
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 		/* modify the current allocated size of old node */
@@ -211,51 +214,13 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 		heapinfo_update_total_size(heap, (-1) * oldsize, oldnode->pid);
 #endif
 
-		/* Check if we can extend into the previous chunk and if the
-		 * previous chunk is smaller than the next chunk.
+		/* Growing forward leaves the data in place, so take as much as
+		 * possible from the next chunk and only the rest from the previous
+		 * one, which costs a move of the data.
 		 */
 
-		if (prevsize > 0 && (nextsize >= prevsize || nextsize < 1)) {
-			/* Can we get everything we need from the previous chunk? */
-
-			if (needed > prevsize) {
-				/* No, take the whole previous chunk and get the
-				 * rest that we need from the next chunk.
-				 */
-
-				takeprev = prevsize;
-				takenext = needed - prevsize;
-			} else {
-				/* Yes, take what we need from the previous chunk */
-
-				takeprev = needed;
-				takenext = 0;
-			}
-
-			needed = 0;
-		}
-
-		/* Check if we can extend into the next chunk and if we still need
-		 * more memory.
-		 */
-
-		if (nextsize > 0 && needed) {
-			/* Can we get everything we need from the next chunk? */
-
-			if (needed > nextsize) {
-				/* No, take the whole next chunk and get the rest that we
-				 * need from the previous chunk.
-				 */
-
-				takeprev = needed - nextsize;
-				takenext = nextsize;
-			} else {
-				/* Yes, take what we need from the previous chunk */
-
-				takeprev = 0;
-				takenext = needed;
-			}
-		}
+		takenext = (needed > nextsize) ? nextsize : needed;
+		takeprev = needed - takenext;
 
 		/* Extend into the previous free chunk */
 
@@ -267,7 +232,7 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 			 * there may not be a successor node.
 			 */
 
-			REMOVE_NODE_FROM_LIST(prev);
+			REMOVE_NODE_FROM_LIST(heap, prev);
 
 			/* Extend the node into the previous free chunk */
 			/* Did we consume the entire preceding chunk? */
@@ -297,12 +262,15 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 			oldnode = newnode;
 			oldsize = newnode->size;
 
-			/* Now we have to move the user contents 'down' in memory.  memcpy should
-			 * should be save for this.
+			/* Now we have to move the user contents 'down' in memory.  The
+			 * two ranges overlap whenever less than the old chunk was taken.
 			 */
 
 			newmem = (FAR void *)((FAR char *)newnode + SIZEOF_MM_ALLOCNODE);
-			memcpy(newmem, oldmem, oldsize - SIZEOF_MM_ALLOCNODE);
+			memmove(newmem, oldmem, payload);
+			heap->mm_reallocstats.nbackward++;
+		} else {
+			heap->mm_reallocstats.nforward++;
 		}
 
 		/* Extend into the next free chunk */
@@ -321,7 +289,7 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 			 * may not be a successor node.
 			 */
 
-			REMOVE_NODE_FROM_LIST(next);
+			REMOVE_NODE_FROM_LIST(heap, next);
 
 			/* Extend the node into the next chunk */
 			/* Did we consume the entire preceding chunk? */
@@ -355,6 +323,7 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 #endif
 
 		mm_givesemaphore(heap);
+		mm_lowmem_check(heap);
 		return newmem;
 	}
 
@@ -366,6 +335,7 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 		/* Allocate a new block.  On failure, realloc must return NULL but
 		 * leave the original memory in place.
 		 */
+		heap->mm_reallocstats.ncopy++;
 		mm_givesemaphore(heap);
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 		newmem = (FAR void *)mm_malloc(heap, size, caller_retaddr);
@@ -66,6 +66,56 @@
  * Public Functions
  ****************************************************************************/
 
+#ifdef CONFIG_MM_TLSF_INDEX
+/****************************************************************************
+ * Name: mm_size2ndx
+ *
+ * Description:
+ *    Convert the size to the index of the two-level nodelist holding chunks
+ *    of that size.  The first level is the power-of-two range of the size
+ *    and the second level is one of MM_SLI_COUNT linear slices of it.
+ *    Every size beyond MM_MAX_CHUNK goes to the last list.
+ *
+ ****************************************************************************/
+
+int mm_size2ndx(size_t size)
+{
+	int fl;
+	int sl;
+
+	if ((size >> MM_MAX_SHIFT) >= 2) {
+		return MM_NLISTS - 1;
+	}
+
+	fl = (31 - __builtin_clz(size | MM_MIN_CHUNK)) - MM_MIN_SHIFT;
+	sl = (size >> (fl + MM_MIN_SHIFT - MM_SLI_SHIFT)) & (MM_SLI_COUNT - 1);
+
+	return (fl << MM_SLI_SHIFT) + sl;
+}
+
+/****************************************************************************
+ * Name: mm_size2ndx_search
+ *
+ * Description:
+ *    Convert the size to the first nodelist index where every chunk is at
+ *    least 'size' bytes, by rounding the size up to the next slice.  The
+ *    last list is the only exception since it is not bounded.
+ *
+ ****************************************************************************/
+
+int mm_size2ndx_search(size_t size)
+{
+	int shift = (31 - __builtin_clz(size | MM_MIN_CHUNK)) - MM_SLI_SHIFT;
+
+	/* Slices of at most MM_MIN_CHUNK bytes hold a single chunk size */
+
+	if (shift > MM_MIN_SHIFT) {
+		size += (1 << shift) - 1;
+	}
+
+	return mm_size2ndx(size);
+}
+#else
 /****************************************************************************
  * Name: mm_size2ndx
  *
@@ -104,3 +154,4 @@ int mm_size2ndx(size_t size)
 		return ndx;
 	}
 }
+#endif
@@ -64,6 +64,15 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#if CONFIG_KMM_NHEAPS > 1
+#if CONFIG_RAM_MALLOC_FAST_INDEX < HEAP_START_IDX || CONFIG_RAM_MALLOC_FAST_INDEX > HEAP_END_IDX
+#error "CONFIG_RAM_MALLOC_FAST_INDEX is not a valid heap index"
+#endif
+#if CONFIG_RAM_MALLOC_BULK_INDEX < HEAP_START_IDX || CONFIG_RAM_MALLOC_BULK_INDEX > HEAP_END_IDX
+#error "CONFIG_RAM_MALLOC_BULK_INDEX is not a valid heap index"
+#endif
+#endif
+
 /****************************************************************************
  * Type Definitions
  ****************************************************************************/
@@ -131,6 +140,128 @@ void *malloc_at(int heap_index, size_t size)
 	}
 	return ret;
 }
+
+/************************************************************************
+ * Name: heap_malloc_prefer
+ *
+ * Description:
+ *   Try to alloc memory from the preferred heap first, and then from
+ *   the other heaps in index order.
+ *
+ * Parameters:
+ *   size - Size (in bytes) of the memory region to be allocated.
+ *   prefer - Index of the heap tried first
+ *   caller_retaddr - caller function return address, used only for DEBUG_MM_HEAPINFO
+ * Return Value:
+ *   The address of the allocated memory (NULL on failure to allocate)
+ *
+ ************************************************************************/
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+static void *heap_malloc_prefer(size_t size, int prefer, mmaddress_t caller_retaddr)
+#else
+static void *heap_malloc_prefer(size_t size, int prefer)
+#endif
+{
+	int heap_idx;
+	void *ret;
+
+	ret = mm_malloc(&BASE_HEAP[prefer], size
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+			, caller_retaddr
+#endif
+			);
+	if (ret != NULL) {
+		return ret;
+	}
+
+	for (heap_idx = HEAP_START_IDX; heap_idx <= HEAP_END_IDX; heap_idx++) {
+		if (heap_idx == prefer) {
+			continue;
+		}
+
+		ret = mm_malloc(&BASE_HEAP[heap_idx], size
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+				, caller_retaddr
+#endif
+				);
+		if (ret != NULL) {
+			return ret;
+		}
+	}
+
+	mm_manage_alloc_fail(BASE_HEAP, HEAP_START_IDX, HEAP_END_IDX, size, 0, USER_HEAP
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+			, caller_retaddr
+#endif
+			);
+	return NULL;
+}
+
+/************************************************************************
+ * Name: malloc_fast
+ *
+ * Description:
+ *   Allocate memory preferably from the fast heap,
+ *   CONFIG_RAM_MALLOC_FAST_INDEX.  The other heaps are used when
+ *   it is full.
+ *
+ * Parameters:
+ *   size - Size (in bytes) of the memory region to be allocated.
+ *
+ * Return Value:
+ *   The address of the allocated memory (NULL on failure to allocate)
+ *
+ ************************************************************************/
+
+void *malloc_fast(size_t size)
+{
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	mmaddress_t caller_retaddr = 0;
+	ARCH_GET_RET_ADDRESS(caller_retaddr)
+#endif
+	if (size == 0) {
+		return NULL;
+	}
+
+	return heap_malloc_prefer(size, CONFIG_RAM_MALLOC_FAST_INDEX
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+			, caller_retaddr
+#endif
+			);
+}
+
+/************************************************************************
+ * Name: malloc_bulk
+ *
+ * Description:
+ *   Allocate memory preferably from the bulk heap,
+ *   CONFIG_RAM_MALLOC_BULK_INDEX.  The other heaps are used when
+ *   it is full.
+ *
+ * Parameters:
+ *   size - Size (in bytes) of the memory region to be allocated.
+ *
+ * Return Value:
+ *   The address of the allocated memory (NULL on failure to allocate)
+ *
+ ************************************************************************/
+
+void *malloc_bulk(size_t size)
+{
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+	mmaddress_t caller_retaddr = 0;
+	ARCH_GET_RET_ADDRESS(caller_retaddr)
+#endif
+	if (size == 0) {
+		return NULL;
+	}
+
+	return heap_malloc_prefer(size, CONFIG_RAM_MALLOC_BULK_INDEX
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+			, caller_retaddr
+#endif
+			);
+}
 #endif
 
 #ifndef CONFIG_BUILD_KERNEL
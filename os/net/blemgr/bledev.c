@@ -432,6 +432,36 @@ int bledev_handle(struct bledev *dev, lwnl_req cmd, void *data, uint32_t data_le
 		TRBLE_DRV_CALL(ret, dev, op_wrtie_no_resp, (dev, handle, buf));
 	}
 	break;
+	case LWNL_REQ_BLE_OP_WRITE_NO_RESP_MULTI:
+	{
+		trble_operation_handle *handle = NULL;
+		trble_data *buf = NULL;
+		uint16_t count = 0;
+		uint16_t *sent = NULL;
+
+		lwnl_msg_params param = { 0, };
+		if (data != NULL) {
+			memcpy(&param, data, data_len);
+		} else {
+			return TRBLE_INVALID_ARGS;
+		}
+		handle = (trble_operation_handle *)param.param[0];
+		buf = (trble_data *)param.param[1];
+		count = *(uint16_t *)param.param[2];
+		sent = (uint16_t *)param.param[3];
+
+		/* The buffers of the caller are given to the driver as they are,
+		 * and the batch stops at the first one the driver can't queue.
+		 */
+		for (*sent = 0; *sent < count; (*sent)++) {
+			ret = TRBLE_FAIL;
+			TRBLE_DRV_CALL(ret, dev, op_wrtie_no_resp, (dev, handle, &buf[*sent]));
+			if (ret != TRBLE_SUCCESS) {
+				break;
+			}
+		}
+	}
+	break;
 	case LWNL_REQ_BLE_GET_READ_WRITE_PENDING_CNT:
 	{
 		trble_operation_handle *handle = NULL;
@@ -491,6 +521,35 @@ int bledev_handle(struct bledev *dev, lwnl_req cmd, void *data, uint32_t data_le
 		TRBLE_DRV_CALL(ret, dev, charact_noti, (dev, attr_handle, con_handle, buf));
 	}
 	break;
+	case LWNL_REQ_BLE_CHARACT_NOTI_MULTI:
+	{
+		trble_attr_handle attr_handle = 0;
+		trble_conn_handle con_handle = 0;
+		trble_data *buf = NULL;
+		uint16_t count = 0;
+		uint16_t *sent = NULL;
+
+		lwnl_msg_params param = { 0, };
+		if (data != NULL) {
+			memcpy(&param, data, data_len);
+		} else {
+			return TRBLE_INVALID_ARGS;
+		}
+		attr_handle = *(trble_attr_handle *)param.param[0];
+		con_handle = *(trble_conn_handle *)param.param[1];
+		buf = (trble_data *)param.param[2];
+		count = *(uint16_t *)param.param[3];
+		sent = (uint16_t *)param.param[4];
+
+		for (*sent = 0; *sent < count; (*sent)++) {
+			ret = TRBLE_FAIL;
+			TRBLE_DRV_CALL(ret, dev, charact_noti, (dev, attr_handle, con_handle, &buf[*sent]));
+			if (ret != TRBLE_SUCCESS) {
+				break;
+			}
+		}
+	}
+	break;
 	case LWNL_REQ_BLE_CHARACT_INDI:
 	{
 		trble_attr_handle attr_handle = 0;
@@ -701,6 +701,40 @@ err_t netconn_send(struct netconn *conn, struct netbuf *buf)
 	return err;
 }
 
+/**
+ * @ingroup netconn_udp
+ * Send several netbufs over a UDP or RAW netconn in a single call into
+ * the stack. Sending stops at the first netbuf that cannot be sent.
+ *
+ * @param conn the UDP or RAW netconn over which to send data
+ * @param bufs the netbufs to send, each with its destination
+ * @param count the number of netbufs
+ * @param sent the number of netbufs sent
+ * @return ERR_OK if all netbufs were sent, the error of the first one that
+ *         could not be sent otherwise
+ */
+err_t netconn_sendm(struct netconn *conn, struct netbuf **bufs, u16_t count, u16_t *sent)
+{
+	API_MSG_VAR_DECLARE(msg);
+	err_t err;
+
+	LWIP_ERROR("netconn_sendm: invalid conn", (conn != NULL), return ERR_ARG;);
+	LWIP_ERROR("netconn_sendm: invalid bufs", (bufs != NULL && count > 0 && sent != NULL), return ERR_ARG;);
+
+	LWIP_DEBUGF(API_LIB_DEBUG, ("netconn_sendm: sending %" U16_F " netbufs\n", count));
+
+	API_MSG_VAR_ALLOC(msg);
+	API_MSG_VAR_REF(msg).conn = conn;
+	API_MSG_VAR_REF(msg).msg.bm.bufs = bufs;
+	API_MSG_VAR_REF(msg).msg.bm.count = count;
+	API_MSG_VAR_REF(msg).msg.bm.sent = 0;
+	err = netconn_apimsg(lwip_netconn_do_sendm, &API_MSG_VAR_REF(msg));
+	*sent = API_MSG_VAR_REF(msg).msg.bm.sent;
+	API_MSG_VAR_FREE(msg);
+
+	return err;
+}
+
 /**
  * Send data over a TCP netconn.
  *
@@ -62,6 +62,7 @@
 #include "lwip/ip_addr.h"
 #include "lwip/api.h"
 #include "lwip/dns.h"
+#include "lwip/priv/tcpip_priv.h"
 
 #include <string.h>				/* memset */
 #include <stdlib.h>				/* atoi */
@@ -258,6 +259,39 @@ void lwip_freeaddrinfo(struct addrinfo *ai)
 	}
 }
 
+/** helper struct for the non-blocking lookup of lwip_getaddrinfo */
+struct netdb_dns_call {
+	struct tcpip_api_call_data call;
+	const char *name;
+	ip_addr_t *addr;
+	u8_t dns_addrtype;
+};
+
+static err_t netdb_do_gethostbyname_nb(struct tcpip_api_call_data *m)
+{
+	struct netdb_dns_call *msg = (struct netdb_dns_call *)(void *)m;
+
+	/* without callback, dns only queues the query if it is not cached */
+	return dns_gethostbyname_addrtype(msg->name, msg->addr, NULL, NULL, msg->dns_addrtype);
+}
+
+/**
+ * Look a name up in the DNS table without waiting for the DNS server
+ *
+ * @return ERR_OK if the address is cached, ERR_INPROGRESS if a query is
+ *         pending, another error if the name cannot be resolved
+ */
+static err_t netdb_gethostbyname_nb(const char *name, ip_addr_t *addr, u8_t dns_addrtype)
+{
+	struct netdb_dns_call msg;
+
+	msg.name = name;
+	msg.addr = addr;
+	msg.dns_addrtype = dns_addrtype;
+
+	return tcpip_api_call(netdb_do_gethostbyname_nb, &msg.call);
+}
+
 /**
  * Translates the name of a service location (for example, a host name) and/or
  * a service name and returns a set of socket addresses and associated
@@ -277,6 +311,10 @@ void lwip_freeaddrinfo(struct addrinfo *ai)
  * @param res pointer to a pointer where to store the result (set to NULL on failure)
  * @return 0 on success, non-zero on failure
  *
+ * With AI_NONBLOCK in hints, EAI_AGAIN is returned instead of waiting for
+ * the DNS server when the name is not cached: call again with the same name
+ * to get the answer once it came.
+ *
  * @todo: implement AI_V4MAPPED, AI_ADDRCONFIG
  */
 int lwip_getaddrinfo(const char *nodename, const char *servname, const struct addrinfo *hints, struct addrinfo **res)
@@ -344,8 +382,17 @@ int lwip_getaddrinfo(const char *nodename, const char *servname, const struct ad
 			} else if (ai_family == AF_INET6) {
 				type = NETCONN_DNS_IPV6;
 			}
+#else							/* LWIP_IPV4 && LWIP_IPV6 */
+			u8_t type = LWIP_DNS_ADDRTYPE_DEFAULT;
 #endif							/* LWIP_IPV4 && LWIP_IPV6 */
-			err = netconn_gethostbyname_addrtype(nodename, &addr, type);
+			if ((hints != NULL) && (hints->ai_flags & AI_NONBLOCK)) {
+				err = netdb_gethostbyname_nb(nodename, &addr, type);
+				if (err == ERR_INPROGRESS) {
+					return EAI_AGAIN;
+				}
+			} else {
+				err = netconn_gethostbyname_addrtype(nodename, &addr, type);
+			}
 			if (err != ERR_OK) {
 				return EAI_FAIL;
 			}
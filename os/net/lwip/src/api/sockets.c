@@ -103,6 +103,10 @@
 #include <tinyara/clock.h>
 #endif
 
+#if LWIP_SOCKET_EPOLL
+#include <sys/epoll.h>
+#endif
+
 /* If the netconn API is not required publicly, then we include the necessary
    files here to get the implementation */
 #if !LWIP_NETCONN
@@ -185,6 +189,9 @@ static void sockaddr_to_ipaddr_port(const struct sockaddr *sockaddr, ip_addr_t *
 				SOCK_ADDR_TYPE_MATCH(name, sock))
 #define IS_SOCK_ADDR_ALIGNED(name)      ((((mem_ptr_t)(name)) % 4) == 0)
 
+/* Datagrams lwip_sendmmsg() hands to the stack per tcpip_thread call */
+#define LWIP_SENDMMSG_BATCH 8
+
 #define LWIP_SOCKOPT_CHECK_OPTLEN(optlen, opttype) do { if ((optlen) < sizeof(opttype)) { return EINVAL; } } while (0)
 #define LWIP_SOCKOPT_CHECK_OPTLEN_CONN(sock, optlen, opttype) do { \
 		LWIP_SOCKOPT_CHECK_OPTLEN(optlen, opttype); \
@@ -334,6 +341,9 @@ static volatile int select_cb_ctr;
 
 /* Forward delcaration of some functions */
 static void event_callback(struct netconn *conn, enum netconn_evt evt, u16_t len);
+#if LWIP_SOCKET_EPOLL
+static void lwip_epoll_release_sock(struct lwip_sock *sock);
+#endif
 #if !LWIP_TCPIP_CORE_LOCKING
 static void lwip_getsockopt_callback(void *arg);
 static void lwip_setsockopt_callback(void *arg);
@@ -527,6 +537,10 @@ void free_socket(struct lwip_sock *sock, int is_tcp)
 	sock->lastoffset = 0;
 	sock->err = 0;
 
+#if LWIP_SOCKET_EPOLL
+	lwip_epoll_release_sock(sock);
+#endif
+
 	/* Protect socket array */
 	SYS_ARCH_SET(sock->conn, NULL);
 	kmm_free(sock);
@@ -833,6 +847,43 @@ int lwip_listen(int s, int backlog)
 	return 0;
 }
 
+/**
+ * Fill in the source address of received data: the peer of a TCP socket,
+ * the sender of the netbuf 'buf' otherwise.
+ */
+static void lwip_recv_fromaddr(struct lwip_sock *sock, void *buf, struct sockaddr *from, socklen_t *fromlen)
+{
+	u16_t port;
+	ip_addr_t tmpaddr;
+	ip_addr_t *fromaddr;
+	union sockaddr_aligned saddr;
+
+	if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+		fromaddr = &tmpaddr;
+		netconn_getaddr(sock->conn, fromaddr, &port, 0);
+	} else {
+		port = netbuf_fromport((struct netbuf *)buf);
+		fromaddr = netbuf_fromaddr((struct netbuf *)buf);
+	}
+
+#if LWIP_IPV4 && LWIP_IPV6
+	/* Dual-stack: Map IPv4 addresses to IPv4 mapped IPv6 */
+	if (NETCONNTYPE_ISIPV6(netconn_type(sock->conn)) && IP_IS_V4(fromaddr)) {
+		ip4_2_ipv4_mapped_ipv6(ip_2_ip6(fromaddr), ip_2_ip4(fromaddr));
+		IP_SET_TYPE(fromaddr, IPADDR_TYPE_V6);
+	}
+#endif							/* LWIP_IPV4 && LWIP_IPV6 */
+
+	IPADDR_PORT_TO_SOCKADDR(&saddr, fromaddr, port);
+	LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recv_fromaddr: addr="));
+	ip_addr_debug_print(SOCKETS_DEBUG, fromaddr);
+	LWIP_DEBUGF(SOCKETS_DEBUG, (" port=%" U16_F "\n", port));
+	if (*fromlen > saddr.sa.sa_len) {
+		*fromlen = saddr.sa.sa_len;
+	}
+	MEMCPY(from, &saddr, *fromlen);
+}
+
 int lwip_recvfrom(int s, void *mem, size_t len, int flags, struct sockaddr *from, socklen_t *fromlen)
 {
 	struct lwip_sock *sock;
@@ -935,37 +986,8 @@ int lwip_recvfrom(int s, void *mem, size_t len, int flags, struct sockaddr *from
 		}
 
 		/* Check to see from where the data was. */
-		if (done) {
-			if (from && fromlen) {
-				u16_t port;
-				ip_addr_t tmpaddr;
-				ip_addr_t *fromaddr;
-				union sockaddr_aligned saddr;
-				LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvfrom(%d): addr=", s));
-				if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
-					fromaddr = &tmpaddr;
-					netconn_getaddr(sock->conn, fromaddr, &port, 0);
-				} else {
-					port = netbuf_fromport((struct netbuf *)buf);
-					fromaddr = netbuf_fromaddr((struct netbuf *)buf);
-				}
-
-#if LWIP_IPV4 && LWIP_IPV6
-				/* Dual-stack: Map IPv4 addresses to IPv4 mapped IPv6 */
-				if (NETCONNTYPE_ISIPV6(netconn_type(sock->conn)) && IP_IS_V4(fromaddr)) {
-					ip4_2_ipv4_mapped_ipv6(ip_2_ip6(fromaddr), ip_2_ip4(fromaddr));
-					IP_SET_TYPE(fromaddr, IPADDR_TYPE_V6);
-				}
-#endif							/* LWIP_IPV4 && LWIP_IPV6 */
-
-				IPADDR_PORT_TO_SOCKADDR(&saddr, fromaddr, port);
-				ip_addr_debug_print(SOCKETS_DEBUG, fromaddr);
-				LWIP_DEBUGF(SOCKETS_DEBUG, (" port=%" U16_F " len=%d\n", port, off));
-				if (*fromlen > saddr.sa.sa_len) {
-					*fromlen = saddr.sa.sa_len;
-				}
-				MEMCPY(from, &saddr, *fromlen);
-			}
+		if (done && from && fromlen) {
+			lwip_recv_fromaddr(sock, buf, from, fromlen);
 		}
 
 		/* If we don't peek the incoming message... */
@@ -1006,6 +1028,337 @@ int lwip_recv(int s, void *mem, size_t len, int flags)
 	return lwip_recvfrom(s, mem, len, flags, NULL, NULL);
 }
 
+/**
+ * Receive one datagram into the IO vectors of 'msg'. A datagram that does
+ * not fit is truncated and MSG_TRUNC is set in msg->msg_flags.
+ *
+ * @return the number of bytes received, -1 on error
+ */
+static int lwip_recvmsg_dgram(struct lwip_sock *sock, struct msghdr *msg, int flags)
+{
+	struct netbuf *buf;
+	u16_t buflen;
+	u16_t copied = 0;
+	err_t err;
+	int i;
+
+	if (sock->lastdata) {
+		buf = (struct netbuf *)sock->lastdata;
+	} else {
+		if (((flags & MSG_DONTWAIT) || netconn_is_nonblocking(sock->conn)) && (sock->rcvevent <= 0)) {
+			set_errno(EWOULDBLOCK);
+			return -1;
+		}
+		err = netconn_recv(sock->conn, &buf);
+		if (err != ERR_OK) {
+			sock_set_errno(sock, err_to_errno(err));
+			return -1;
+		}
+		sock->lastdata = buf;
+	}
+
+	buflen = buf->p->tot_len;
+	for (i = 0; i < msg->msg_iovlen && copied < buflen; i++) {
+		size_t len = buflen - copied;
+		if (len > msg->msg_iov[i].iov_len) {
+			len = msg->msg_iov[i].iov_len;
+		}
+		pbuf_copy_partial(buf->p, msg->msg_iov[i].iov_base, (u16_t)len, copied);
+		copied += (u16_t)len;
+	}
+
+	msg->msg_flags = (copied < buflen) ? MSG_TRUNC : 0;
+	msg->msg_controllen = 0;
+	if (msg->msg_name && msg->msg_namelen > 0) {
+		lwip_recv_fromaddr(sock, buf, (struct sockaddr *)msg->msg_name, &msg->msg_namelen);
+	}
+
+	if ((flags & MSG_PEEK) == 0) {
+		sock->lastdata = NULL;
+		sock->lastoffset = 0;
+		netbuf_delete(buf);
+	}
+
+	return copied;
+}
+
+/**
+ * Receive up to 'vlen' messages. MSG_WAITFORONE makes the call nonblocking
+ * once a message has been received. 'timeout', if not NULL, is checked after
+ * each message, so it bounds the whole call only while messages keep coming.
+ * Stream sockets read into the first IO vector of each message, as recvmsg()
+ * does.
+ *
+ * @return the number of messages received, -1 if none were
+ */
+int lwip_recvmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags, struct timespec *timeout)
+{
+	struct lwip_sock *sock;
+	struct msghdr *msg;
+	unsigned int count = 0;
+	u32_t start = 0;
+	u32_t limit = 0;
+	u8_t stream;
+	int ret;
+
+	sock = get_socket_by_pid(s, getpid());
+	if (!sock) {
+		return -1;
+	}
+
+	LWIP_ERROR("lwip_recvmmsg: invalid msgvec", (msgvec != NULL && vlen > 0), sock_set_errno(sock, err_to_errno(ERR_ARG)); return -1;);
+
+	if (timeout) {
+		start = sys_now();
+		limit = (u32_t)timeout->tv_sec * 1000 + (u32_t)(timeout->tv_nsec / 1000000);
+	}
+	stream = (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP);
+
+	while (count < vlen) {
+		msg = &msgvec[count].msg_hdr;
+		if (msg->msg_iov == NULL || msg->msg_iovlen <= 0) {
+			if (count == 0) {
+				sock_set_errno(sock, err_to_errno(ERR_ARG));
+			}
+			break;
+		}
+
+		if (stream) {
+			msg->msg_flags = 0;
+			msg->msg_controllen = 0;
+			ret = lwip_recvfrom(s, msg->msg_iov[0].iov_base, msg->msg_iov[0].iov_len, flags & ~MSG_WAITFORONE, (struct sockaddr *)msg->msg_name, msg->msg_name ? &msg->msg_namelen : NULL);
+		} else {
+			ret = lwip_recvmsg_dgram(sock, msg, flags);
+		}
+		if (ret < 0) {
+			break;
+		}
+		msgvec[count++].msg_len = ret;
+
+		if (stream && ret == 0) {
+			/* peer closed the connection */
+			break;
+		}
+		if (flags & MSG_WAITFORONE) {
+			flags |= MSG_DONTWAIT;
+		}
+		if (timeout && (u32_t)(sys_now() - start) >= limit) {
+			break;
+		}
+	}
+
+	if (count == 0) {
+		return -1;
+	}
+	sock_set_errno(sock, 0);
+	return (int)count;
+}
+
+#if LWIP_SOCKET_ZEROCOPY
+/**
+ * Receive without copying: hand the caller the pbuf chain holding the
+ * received data instead of copying it out. A TCP socket returns everything
+ * received so far (at least one segment), a datagram socket one datagram.
+ * The caller owns the chain and must give it back with pbuf_free().
+ *
+ * MSG_PEEK is not supported.
+ *
+ * @return the number of bytes in *p, 0 if the peer closed the connection,
+ *         -1 on error
+ */
+int lwip_recvfrom_pbuf(int s, struct pbuf **p, int flags, struct sockaddr *from, socklen_t *fromlen)
+{
+	struct lwip_sock *sock;
+	struct pbuf *q;
+	void *buf = NULL;
+	u16_t off;
+	err_t err;
+
+	LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvfrom_pbuf(%d, 0x%x)\n", s, flags));
+	sock = get_socket_by_pid(s, getpid());
+	if (!sock) {
+		return -1;
+	}
+
+	if (p == NULL || (flags & MSG_PEEK) != 0) {
+		sock_set_errno(sock, EINVAL);
+		return -1;
+	}
+
+	if (sock->lastdata) {
+		/* What a copying receive left over comes first */
+		buf = sock->lastdata;
+		off = sock->lastoffset;
+		sock->lastdata = NULL;
+		sock->lastoffset = 0;
+	} else {
+		if (((flags & MSG_DONTWAIT) || netconn_is_nonblocking(sock->conn)) && (sock->rcvevent <= 0)) {
+			LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvfrom_pbuf(%d): returning EWOULDBLOCK\n", s));
+			set_errno(EWOULDBLOCK);
+			return -1;
+		}
+
+		if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+			err = netconn_recv_tcp_pbuf(sock->conn, (struct pbuf **)&buf);
+		} else {
+			err = netconn_recv(sock->conn, (struct netbuf **)&buf);
+		}
+
+		if (err != ERR_OK) {
+			sock_set_errno(sock, err_to_errno(err));
+			if (err == ERR_CLSD) {
+				sock->conn->last_err = ERR_OK;
+				return 0;
+			}
+			return -1;
+		}
+		off = 0;
+	}
+
+	if (from && fromlen) {
+		lwip_recv_fromaddr(sock, buf, from, fromlen);
+	}
+
+	if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+		q = (struct pbuf *)buf;
+
+		/* Drop the bytes already copied out: release the pbufs consumed
+		 * as a whole, then hide the rest of the offset in the first one.
+		 */
+		while (off >= q->len) {
+			struct pbuf *next = q->next;
+
+			off -= q->len;
+			q->next = NULL;
+			q->tot_len = q->len;
+			pbuf_free(q);
+			q = next;
+		}
+		if (off > 0) {
+			pbuf_header(q, -(s16_t)off);
+		}
+	} else {
+		/* Keep the data, release the netbuf */
+		q = ((struct netbuf *)buf)->p;
+		((struct netbuf *)buf)->p = NULL;
+		netbuf_delete((struct netbuf *)buf);
+	}
+
+	*p = q;
+	sock_set_errno(sock, 0);
+	return q->tot_len;
+}
+
+#if LWIP_SUPPORT_CUSTOM_PBUF && !LWIP_NETIF_TX_SINGLE_PBUF
+struct lwip_ref_pbuf {
+	struct pbuf_custom pc;
+	lwip_sent_fn sent;
+	void *arg;
+};
+
+static void lwip_ref_pbuf_free(struct pbuf *p)
+{
+	struct lwip_ref_pbuf *rp = (struct lwip_ref_pbuf *)p;
+
+	if (rp->sent) {
+		rp->sent(rp->arg);
+	}
+	mem_free(rp);
+}
+#endif
+
+/**
+ * Send without copying: the datagram is sent from the caller's buffer
+ * through a PBUF_REF custom pbuf. 'sent' is called with 'arg' when the
+ * stack and the driver no longer reference the buffer, which may be before
+ * this function returns, and from any thread: it must not block. It is
+ * called exactly once if and only if this function succeeds.
+ *
+ * A TCP segment is kept for retransmission until it is acknowledged, which
+ * only the retransmission queue knows, so stream sockets (and netifs that
+ * need LWIP_NETIF_TX_SINGLE_PBUF) copy the data and call 'sent' before
+ * returning.
+ *
+ * @return the number of bytes sent, -1 on error
+ */
+int lwip_sendto_ref(int s, const void *data, size_t size, int flags, const struct sockaddr *to, socklen_t tolen, lwip_sent_fn sent, void *arg)
+{
+	struct lwip_sock *sock;
+#if LWIP_SUPPORT_CUSTOM_PBUF && !LWIP_NETIF_TX_SINGLE_PBUF
+	struct lwip_ref_pbuf *rp;
+	struct netbuf buf;
+	u16_t remote_port;
+	err_t err;
+#endif
+	int ret;
+
+	sock = get_socket_by_pid(s, getpid());
+	if (!sock) {
+		return -1;
+	}
+
+#if LWIP_SUPPORT_CUSTOM_PBUF && !LWIP_NETIF_TX_SINGLE_PBUF
+	if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_TCP) {
+		LWIP_ERROR("lwip_sendto_ref: invalid address", (((to == NULL) && (tolen == 0)) || (IS_SOCK_ADDR_LEN_VALID(tolen) && IS_SOCK_ADDR_TYPE_VALID(to) && IS_SOCK_ADDR_ALIGNED(to))), sock_set_errno(sock, err_to_errno(ERR_ARG)); return -1;);
+		if (size > 0xffff) {
+			sock_set_errno(sock, EMSGSIZE);
+			return -1;
+		}
+
+		rp = (struct lwip_ref_pbuf *)mem_malloc(sizeof(struct lwip_ref_pbuf));
+		if (rp == NULL) {
+			sock_set_errno(sock, ENOMEM);
+			return -1;
+		}
+		rp->pc.custom_free_function = lwip_ref_pbuf_free;
+		rp->sent = sent;
+		rp->arg = arg;
+
+		memset(&buf, 0, sizeof(buf));
+		buf.p = buf.ptr = pbuf_alloced_custom(PBUF_RAW, (u16_t)size, PBUF_REF, &rp->pc, (void *)data, (u16_t)size);
+		if (buf.p == NULL) {
+			mem_free(rp);
+			sock_set_errno(sock, ENOMEM);
+			return -1;
+		}
+		if (to) {
+			SOCKADDR_TO_IPADDR_PORT(to, &buf.addr, remote_port);
+		} else {
+			remote_port = 0;
+			ip_addr_set_any(NETCONNTYPE_ISIPV6(netconn_type(sock->conn)), &buf.addr);
+		}
+		netbuf_fromport(&buf) = remote_port;
+
+#if LWIP_IPV4 && LWIP_IPV6
+		/* Dual-stack: Unmap IPv4 mapped IPv6 addresses */
+		if (IP_IS_V6_VAL(buf.addr) && ip6_addr_isipv4mappedipv6(ip_2_ip6(&buf.addr))) {
+			unmap_ipv4_mapped_ipv6(ip_2_ip4(&buf.addr), ip_2_ip6(&buf.addr));
+			IP_SET_TYPE_VAL(buf.addr, IPADDR_TYPE_V4);
+		}
+#endif							/* LWIP_IPV4 && LWIP_IPV6 */
+
+		err = netconn_send(sock->conn, &buf);
+		if (err != ERR_OK) {
+			/* The caller keeps its buffer and is not called back */
+			rp->sent = NULL;
+		}
+
+		/* Drop our reference, 'sent' runs here unless the driver still holds one */
+		netbuf_free(&buf);
+
+		sock_set_errno(sock, err_to_errno(err));
+		return (err == ERR_OK ? (int)size : -1);
+	}
+#endif
+
+	ret = lwip_sendto(s, data, size, flags, to, tolen);
+	if (ret >= 0 && sent) {
+		sent(arg);
+	}
+	return ret;
+}
+#endif							/* LWIP_SOCKET_ZEROCOPY */
+
 int lwip_send(int s, const void *data, size_t size, int flags)
 {
 	struct lwip_sock *sock;
@@ -1038,11 +1391,111 @@ int lwip_send(int s, const void *data, size_t size, int flags)
 	return (err == ERR_OK ? (int)written : -1);
 }
 
+#if LWIP_UDP || LWIP_RAW
+/**
+ * Build the netbuf for the datagram described by 'msg': its destination
+ * and a pbuf chain referencing the IO vectors (a copy of them with
+ * LWIP_NETIF_TX_SINGLE_PBUF). The IO vectors must stay valid until the
+ * netbuf is deleted.
+ *
+ * @param nbuf the new netbuf, to be freed with netbuf_delete()
+ * @param size the length of the datagram
+ */
+static err_t lwip_msghdr_to_netbuf(const struct msghdr *msg, struct netbuf **nbuf, int *size)
+{
+	struct netbuf *chain_buf;
+	err_t err = ERR_OK;
+	int len = 0;
+	int i;
+
+	LWIP_ERROR("lwip_msghdr_to_netbuf: invalid msghdr iov", (msg->msg_iov != NULL && msg->msg_iovlen != 0), return ERR_ARG;);
+	LWIP_ERROR("lwip_msghdr_to_netbuf: invalid msghdr name", (((msg->msg_name == NULL) && (msg->msg_namelen == 0)) || IS_SOCK_ADDR_LEN_VALID(msg->msg_namelen)), return ERR_ARG;);
+
+	/* initialize chain buffer with destination */
+	chain_buf = netbuf_new();
+	if (!chain_buf) {
+		return ERR_MEM;
+	}
+	if (msg->msg_name) {
+		u16_t remote_port;
+		SOCKADDR_TO_IPADDR_PORT((const struct sockaddr *)msg->msg_name, &chain_buf->addr, remote_port);
+		netbuf_fromport(chain_buf) = remote_port;
+	}
+#if LWIP_NETIF_TX_SINGLE_PBUF
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		len += msg->msg_iov[i].iov_len;
+	}
+	/* Allocate a new netbuf and copy the data into it. */
+	if (netbuf_alloc(chain_buf, (u16_t) len) == NULL) {
+		err = ERR_MEM;
+	} else {
+		/* flatten the IO vectors */
+		size_t offset = 0;
+		for (i = 0; i < msg->msg_iovlen; i++) {
+			MEMCPY(&((u8_t *) chain_buf->p->payload)[offset], msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+			offset += msg->msg_iov[i].iov_len;
+		}
+#if LWIP_CHECKSUM_ON_COPY
+		{
+			/* This can be improved by using LWIP_CHKSUM_COPY() and aggregating the checksum for each IO vector */
+			u16_t chksum = ~inet_chksum_pbuf(chain_buf->p);
+			netbuf_set_chksum(chain_buf, chksum);
+		}
+#endif							/* LWIP_CHECKSUM_ON_COPY */
+		err = ERR_OK;
+	}
+#else							/* LWIP_NETIF_TX_SINGLE_PBUF */
+	/* create a chained netbuf from the IO vectors. NOTE: we assemble a pbuf chain
+	   manually to avoid having to allocate, chain, and delete a netbuf for each iov */
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, 0, PBUF_REF);
+		if (p == NULL) {
+			err = ERR_MEM;	/* let netbuf_delete() cleanup chain_buf */
+			break;
+		}
+		p->payload = msg->msg_iov[i].iov_base;
+		LWIP_ASSERT("iov_len < u16_t", msg->msg_iov[i].iov_len <= 0xFFFF);
+		p->len = p->tot_len = (u16_t) msg->msg_iov[i].iov_len;
+		/* netbuf empty, add new pbuf */
+		if (chain_buf->p == NULL) {
+			chain_buf->p = chain_buf->ptr = p;
+			/* add pbuf to existing pbuf chain */
+		} else {
+			pbuf_cat(chain_buf->p, p);
+		}
+	}
+	/* save size of total chain */
+	if (err == ERR_OK) {
+		len = netbuf_len(chain_buf);
+	}
+#endif							/* LWIP_NETIF_TX_SINGLE_PBUF */
+
+	if (err != ERR_OK) {
+		netbuf_delete(chain_buf);
+		return err;
+	}
+
+#if LWIP_IPV4 && LWIP_IPV6
+	/* Dual-stack: Unmap IPv4 mapped IPv6 addresses */
+	if (IP_IS_V6_VAL(chain_buf->addr) && ip6_addr_isipv4mappedipv6(ip_2_ip6(&chain_buf->addr))) {
+		unmap_ipv4_mapped_ipv6(ip_2_ip4(&chain_buf->addr), ip_2_ip6(&chain_buf->addr));
+		IP_SET_TYPE_VAL(chain_buf->addr, IPADDR_TYPE_V4);
+	}
+#endif							/* LWIP_IPV4 && LWIP_IPV6 */
+
+	*nbuf = chain_buf;
+	*size = len;
+	return ERR_OK;
+}
+#endif							/* LWIP_UDP || LWIP_RAW */
+
+
+
 int lwip_sendmsg(int s, const struct msghdr *msg, int flags)
 {
 	struct lwip_sock *sock;
-	int i;
 #if LWIP_TCP
+	int i;
 	u8_t write_flags;
 	size_t written;
 #endif
@@ -1102,86 +1555,99 @@ int lwip_sendmsg(int s, const struct msghdr *msg, int flags)
 		struct netbuf *chain_buf;
 
 		LWIP_UNUSED_ARG(flags);
-		LWIP_ERROR("lwip_sendmsg: invalid msghdr name", (((msg->msg_name == NULL) && (msg->msg_namelen == 0)) || IS_SOCK_ADDR_LEN_VALID(msg->msg_namelen)), sock_set_errno(sock, err_to_errno(ERR_ARG)); return -1;);
+		err = lwip_msghdr_to_netbuf(msg, &chain_buf, &size);
+		if (err == ERR_OK) {
+			/* send the data */
+			err = netconn_send(sock->conn, chain_buf);
 
-		/* initialize chain buffer with destination */
-		chain_buf = netbuf_new();
-		if (!chain_buf) {
-			sock_set_errno(sock, err_to_errno(ERR_MEM));
-			return -1;
+			/* deallocated the buffer */
+			netbuf_delete(chain_buf);
 		}
-		if (msg->msg_name) {
-			u16_t remote_port;
-			SOCKADDR_TO_IPADDR_PORT((const struct sockaddr *)msg->msg_name, &chain_buf->addr, remote_port);
-			netbuf_fromport(chain_buf) = remote_port;
-		}
-#if LWIP_NETIF_TX_SINGLE_PBUF
-		for (i = 0; i < msg->msg_iovlen; i++) {
-			size += msg->msg_iov[i].iov_len;
-		}
-		/* Allocate a new netbuf and copy the data into it. */
-		if (netbuf_alloc(chain_buf, (u16_t) size) == NULL) {
-			err = ERR_MEM;
-		} else {
-			/* flatten the IO vectors */
-			size_t offset = 0;
-			for (i = 0; i < msg->msg_iovlen; i++) {
-				MEMCPY(&((u8_t *) chain_buf->p->payload)[offset], msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
-				offset += msg->msg_iov[i].iov_len;
-			}
-#if LWIP_CHECKSUM_ON_COPY
-			{
-				/* This can be improved by using LWIP_CHKSUM_COPY() and aggregating the checksum for each IO vector */
-				u16_t chksum = ~inet_chksum_pbuf(chain_buf->p);
-				netbuf_set_chksum(chain_buf, chksum);
-			}
-#endif							/* LWIP_CHECKSUM_ON_COPY */
-			err = ERR_OK;
-		}
-#else							/* LWIP_NETIF_TX_SINGLE_PBUF */
-		/* create a chained netbuf from the IO vectors. NOTE: we assemble a pbuf chain
-		   manually to avoid having to allocate, chain, and delete a netbuf for each iov */
-		for (i = 0; i < msg->msg_iovlen; i++) {
-			struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, 0, PBUF_REF);
-			if (p == NULL) {
-				err = ERR_MEM;	/* let netbuf_delete() cleanup chain_buf */
+
+		sock_set_errno(sock, err_to_errno(err));
+		return (err == ERR_OK ? size : -1);
+	}
+#else							/* LWIP_UDP || LWIP_RAW */
+	sock_set_errno(sock, err_to_errno(ERR_ARG));
+	return -1;
+#endif							/* LWIP_UDP || LWIP_RAW */
+}
+
+/**
+ * Send up to 'vlen' messages. Datagrams are handed to the stack in batches
+ * of LWIP_SENDMMSG_BATCH, one tcpip_thread call per batch; stream sockets
+ * send the messages one at a time. Sending stops at the first message that
+ * fails.
+ *
+ * @return the number of messages sent, -1 if none were
+ */
+int lwip_sendmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+	struct lwip_sock *sock;
+	unsigned int count = 0;
+	int ret;
+
+	sock = get_socket_by_pid(s, getpid());
+	if (!sock) {
+		return -1;
+	}
+
+	LWIP_ERROR("lwip_sendmmsg: invalid msgvec", (msgvec != NULL && vlen > 0), sock_set_errno(sock, err_to_errno(ERR_ARG)); return -1;);
+
+	if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+		while (count < vlen) {
+			ret = lwip_sendmsg(s, &msgvec[count].msg_hdr, flags);
+			if (ret < 0) {
 				break;
 			}
-			p->payload = msg->msg_iov[i].iov_base;
-			LWIP_ASSERT("iov_len < u16_t", msg->msg_iov[i].iov_len <= 0xFFFF);
-			p->len = p->tot_len = (u16_t) msg->msg_iov[i].iov_len;
-			/* netbuf empty, add new pbuf */
-			if (chain_buf->p == NULL) {
-				chain_buf->p = chain_buf->ptr = p;
-				/* add pbuf to existing pbuf chain */
-			} else {
-				pbuf_cat(chain_buf->p, p);
-			}
-		}
-		/* save size of total chain */
-		if (err == ERR_OK) {
-			size = netbuf_len(chain_buf);
+			msgvec[count++].msg_len = ret;
 		}
-#endif							/* LWIP_NETIF_TX_SINGLE_PBUF */
+		return (count > 0 ? (int)count : -1);
+	}
+	/* else, UDP and RAW NETCONNs */
+#if LWIP_UDP || LWIP_RAW
+	{
+		struct netbuf *bufs[LWIP_SENDMMSG_BATCH];
+		int sizes[LWIP_SENDMMSG_BATCH];
+		u16_t nbufs;
+		u16_t sent;
+		u16_t i;
+		err_t serr;
+		err_t err = ERR_OK;
 
-		if (err == ERR_OK) {
-#if LWIP_IPV4 && LWIP_IPV6
-			/* Dual-stack: Unmap IPv4 mapped IPv6 addresses */
-			if (IP_IS_V6_VAL(chain_buf->addr) && ip6_addr_isipv4mappedipv6(ip_2_ip6(&chain_buf->addr))) {
-				unmap_ipv4_mapped_ipv6(ip_2_ip4(&chain_buf->addr), ip_2_ip6(&chain_buf->addr));
-				IP_SET_TYPE_VAL(chain_buf->addr, IPADDR_TYPE_V4);
+		LWIP_UNUSED_ARG(flags);
+		LWIP_UNUSED_ARG(ret);
+		while (count < vlen && err == ERR_OK) {
+			for (nbufs = 0; nbufs < LWIP_SENDMMSG_BATCH && count + nbufs < vlen; nbufs++) {
+				err = lwip_msghdr_to_netbuf(&msgvec[count + nbufs].msg_hdr, &bufs[nbufs], &sizes[nbufs]);
+				if (err != ERR_OK) {
+					break;
+				}
+			}
+			if (nbufs == 0) {
+				break;
 			}
-#endif							/* LWIP_IPV4 && LWIP_IPV6 */
 
-			/* send the data */
-			err = netconn_send(sock->conn, chain_buf);
+			sent = 0;
+			serr = netconn_sendm(sock->conn, bufs, nbufs, &sent);
+			if (serr != ERR_OK) {
+				err = serr;
+			}
+			for (i = 0; i < nbufs; i++) {
+				if (i < sent) {
+					msgvec[count + i].msg_len = sizes[i];
+				}
+				netbuf_delete(bufs[i]);
+			}
+			count += sent;
 		}
 
-		/* deallocated the buffer */
-		netbuf_delete(chain_buf);
-
-		sock_set_errno(sock, err_to_errno(err));
-		return (err == ERR_OK ? size : -1);
+		if (count == 0) {
+			sock_set_errno(sock, err_to_errno(err));
+			return -1;
+		}
+		sock_set_errno(sock, 0);
+		return (int)count;
 	}
 #else							/* LWIP_UDP || LWIP_RAW */
 	sock_set_errno(sock, err_to_errno(ERR_ARG));
@@ -1822,6 +2288,419 @@ int lwip_poll(int fd, struct pollfd *fds, bool setup)
 
 #endif							/*LWIP_SELECT */
 
+#if LWIP_SOCKET_EPOLL
+/****************************************************************************
+ * epoll
+ *
+ * An epoll instance keeps an item for each socket it watches. The items of
+ * a socket are chained on sock->epoll_items so that event_callback() can
+ * queue them on the ready list of their instance, which lwip_epoll_wait()
+ * drains. Waiting thus costs the number of ready sockets, not the number
+ * of sockets watched.
+ *
+ * The lists are protected with SYS_ARCH_PROTECT, as event_callback() runs
+ * in tcpip_thread. When a socket is freed, its items lose their socket and
+ * are queued on the ready list, where lwip_epoll_wait() frees them. Items
+ * removed while on the ready list are freed the same way.
+ ****************************************************************************/
+
+struct lwip_epoll_item {
+	struct lwip_epoll_item *next;		/* items of the instance */
+	struct lwip_epoll_item *prev;
+	struct lwip_epoll_item *sock_next;	/* items watching the same socket */
+	struct lwip_epoll_item *ready_next;	/* ready list of the instance */
+	struct lwip_epoll *ep;
+	struct lwip_sock *sock;				/* NULL once the socket is freed */
+	int s;
+	u32_t events;
+	epoll_data_t data;
+	u8_t ready;							/* on the ready list */
+	u8_t disabled;						/* EPOLLONESHOT item reported */
+};
+
+struct lwip_epoll {
+	struct lwip_epoll_item *items;
+	struct lwip_epoll_item *ready_head;
+	struct lwip_epoll_item *ready_tail;
+	sys_sem_t sem;						/* signalled when the ready list fills */
+	int waiting;						/* lwip_epoll_wait() calls blocked on sem */
+	struct pollfd *fds[LWIP_EPOLL_NPOLLWAITERS];
+};
+
+/* Events of 'sock' as reported to epoll. Called with SYS_ARCH protected. */
+static u32_t lwip_epoll_revents(struct lwip_sock *sock)
+{
+	u32_t revents = 0;
+
+	if (sock->lastdata != NULL || sock->rcvevent > 0) {
+		revents |= EPOLLIN;
+	}
+	if (sock->sendevent != 0) {
+		revents |= EPOLLOUT;
+	}
+	if (sock->errevent != 0) {
+		revents |= EPOLLERR;
+	}
+
+	return revents;
+}
+
+/* Queue 'item' on the ready list. Called with SYS_ARCH protected. */
+static void lwip_epoll_enqueue(struct lwip_epoll_item *item)
+{
+	struct lwip_epoll *ep = item->ep;
+	int i;
+
+	item->ready = 1;
+	item->ready_next = NULL;
+	if (ep->ready_tail != NULL) {
+		ep->ready_tail->ready_next = item;
+		ep->ready_tail = item;
+		return;
+	}
+
+	/* The ready list was empty: wake up the waiters */
+	ep->ready_head = ep->ready_tail = item;
+	if (ep->waiting > 0) {
+		sys_sem_signal(&ep->sem);
+	}
+	for (i = 0; i < LWIP_EPOLL_NPOLLWAITERS; i++) {
+		if (ep->fds[i] != NULL && (ep->fds[i]->events & POLLIN)) {
+			ep->fds[i]->revents |= POLLIN;
+			sys_sem_signal(ep->fds[i]->sem);
+		}
+	}
+}
+
+/* Queue the items of 'sock' whose events occurred. Called from
+ * event_callback() with SYS_ARCH protected.
+ */
+static void lwip_epoll_notify(struct lwip_sock *sock)
+{
+	struct lwip_epoll_item *item;
+	u32_t revents = lwip_epoll_revents(sock);
+
+	for (item = sock->epoll_items; item != NULL; item = item->sock_next) {
+		if (!item->ready && !item->disabled && (revents & (item->events | EPOLLERR | EPOLLHUP))) {
+			lwip_epoll_enqueue(item);
+		}
+	}
+}
+
+/* Detach the items of 'sock', which is being freed */
+static void lwip_epoll_release_sock(struct lwip_sock *sock)
+{
+	struct lwip_epoll_item *item;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	while ((item = sock->epoll_items) != NULL) {
+		sock->epoll_items = item->sock_next;
+		item->sock_next = NULL;
+		item->sock = NULL;
+		if (!item->ready) {
+			lwip_epoll_enqueue(item);
+		}
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/* Unlink 'item' from the items of its instance. Called with SYS_ARCH protected. */
+static void lwip_epoll_unlink(struct lwip_epoll_item *item)
+{
+	if (item->next != NULL) {
+		item->next->prev = item->prev;
+	}
+	if (item->prev != NULL) {
+		item->prev->next = item->next;
+	} else {
+		item->ep->items = item->next;
+	}
+	item->next = item->prev = NULL;
+}
+
+struct lwip_epoll *lwip_epoll_create(void)
+{
+	struct lwip_epoll *ep;
+
+	ep = (struct lwip_epoll *)mem_malloc(sizeof(struct lwip_epoll));
+	if (ep == NULL) {
+		set_errno(ENOMEM);
+		return NULL;
+	}
+	memset(ep, 0, sizeof(struct lwip_epoll));
+
+	if (sys_sem_new(&ep->sem, 0) != ERR_OK) {
+		mem_free(ep);
+		set_errno(ENOMEM);
+		return NULL;
+	}
+
+	return ep;
+}
+
+void lwip_epoll_close(struct lwip_epoll *ep)
+{
+	struct lwip_epoll_item *item;
+	struct lwip_epoll_item **pp;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	for (;;) {
+		SYS_ARCH_PROTECT(lev);
+		item = ep->items;
+		if (item == NULL) {
+			SYS_ARCH_UNPROTECT(lev);
+			break;
+		}
+		lwip_epoll_unlink(item);
+		if (item->sock != NULL) {
+			for (pp = &item->sock->epoll_items; *pp != NULL; pp = &(*pp)->sock_next) {
+				if (*pp == item) {
+					*pp = item->sock_next;
+					break;
+				}
+			}
+		}
+		SYS_ARCH_UNPROTECT(lev);
+		mem_free(item);
+	}
+
+	sys_sem_free(&ep->sem);
+	mem_free(ep);
+}
+
+int lwip_epoll_ctl(struct lwip_epoll *ep, int op, int s, struct epoll_event *ev)
+{
+	struct lwip_sock *sock;
+	struct lwip_epoll_item *item;
+	struct lwip_epoll_item *newitem = NULL;
+	struct lwip_epoll_item **pp;
+	int err = 0;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	sock = get_socket_by_pid(s, getpid());
+	if (!sock) {
+		return -1;
+	}
+
+	if (op != EPOLL_CTL_DEL && ev == NULL) {
+		set_errno(EFAULT);
+		return -1;
+	}
+
+	if (op == EPOLL_CTL_ADD) {
+		newitem = (struct lwip_epoll_item *)mem_malloc(sizeof(struct lwip_epoll_item));
+		if (newitem == NULL) {
+			set_errno(ENOMEM);
+			return -1;
+		}
+		memset(newitem, 0, sizeof(struct lwip_epoll_item));
+		newitem->ep = ep;
+		newitem->sock = sock;
+		newitem->s = s;
+		newitem->events = ev->events;
+		newitem->data = ev->data;
+	}
+
+	SYS_ARCH_PROTECT(lev);
+	for (item = sock->epoll_items; item != NULL; item = item->sock_next) {
+		if (item->ep == ep && item->s == s) {
+			break;
+		}
+	}
+
+	switch (op) {
+	case EPOLL_CTL_ADD:
+		if (item != NULL) {
+			err = EEXIST;
+			break;
+		}
+		newitem->next = ep->items;
+		if (ep->items != NULL) {
+			ep->items->prev = newitem;
+		}
+		ep->items = newitem;
+		newitem->sock_next = sock->epoll_items;
+		sock->epoll_items = newitem;
+		if (lwip_epoll_revents(sock) & (newitem->events | EPOLLERR | EPOLLHUP)) {
+			lwip_epoll_enqueue(newitem);
+		}
+		newitem = NULL;
+		break;
+
+	case EPOLL_CTL_MOD:
+		if (item == NULL) {
+			err = ENOENT;
+			break;
+		}
+		item->events = ev->events;
+		item->data = ev->data;
+		item->disabled = 0;
+		if (!item->ready && (lwip_epoll_revents(sock) & (item->events | EPOLLERR | EPOLLHUP))) {
+			lwip_epoll_enqueue(item);
+		}
+		break;
+
+	case EPOLL_CTL_DEL:
+		if (item == NULL) {
+			err = ENOENT;
+			break;
+		}
+		for (pp = &sock->epoll_items; *pp != item; pp = &(*pp)->sock_next) ;
+		*pp = item->sock_next;
+		item->sock_next = NULL;
+		item->sock = NULL;
+		if (!item->ready) {
+			lwip_epoll_unlink(item);
+			newitem = item;		/* freed below */
+		}
+		/* else lwip_epoll_wait() frees it */
+		break;
+
+	default:
+		err = EINVAL;
+		break;
+	}
+	SYS_ARCH_UNPROTECT(lev);
+
+	if (newitem != NULL) {
+		mem_free(newitem);
+	}
+	if (err != 0) {
+		set_errno(err);
+		return -1;
+	}
+	return 0;
+}
+
+/* Report up to 'maxevents' ready items. Level-triggered items that are
+ * still ready go back to the end of the ready list, items of freed sockets
+ * are freed.
+ */
+static int lwip_epoll_collect(struct lwip_epoll *ep, struct epoll_event *events, int maxevents)
+{
+	struct lwip_epoll_item *item;
+	struct lwip_epoll_item *last;
+	struct lwip_epoll_item *dead = NULL;
+	u32_t revents;
+	int n = 0;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	last = ep->ready_tail;
+	while (n < maxevents && (item = ep->ready_head) != NULL) {
+		ep->ready_head = item->ready_next;
+		if (ep->ready_head == NULL) {
+			ep->ready_tail = NULL;
+		}
+		item->ready = 0;
+
+		if (item->sock == NULL) {
+			lwip_epoll_unlink(item);
+			item->ready_next = dead;
+			dead = item;
+		} else if (!item->disabled) {
+			revents = lwip_epoll_revents(item->sock) & (item->events | EPOLLERR | EPOLLHUP);
+			if (revents != 0) {
+				events[n].events = revents;
+				events[n].data = item->data;
+				n++;
+				if (item->events & EPOLLONESHOT) {
+					item->disabled = 1;
+				} else if (!(item->events & EPOLLET)) {
+					lwip_epoll_enqueue(item);
+				}
+			}
+		}
+
+		if (item == last) {
+			break;
+		}
+	}
+	SYS_ARCH_UNPROTECT(lev);
+
+	while (dead != NULL) {
+		item = dead;
+		dead = item->ready_next;
+		mem_free(item);
+	}
+
+	return n;
+}
+
+int lwip_epoll_wait(struct lwip_epoll *ep, struct epoll_event *events, int maxevents, int timeout)
+{
+	u32_t start = sys_now();
+	u32_t elapsed;
+	u32_t wait;
+	int n;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if (events == NULL || maxevents <= 0) {
+		set_errno(EINVAL);
+		return -1;
+	}
+
+	for (;;) {
+		n = lwip_epoll_collect(ep, events, maxevents);
+		if (n > 0 || timeout == 0) {
+			return n;
+		}
+
+		if (timeout < 0) {
+			wait = 0;			/* forever */
+		} else {
+			elapsed = sys_now() - start;
+			if (elapsed >= (u32_t)timeout) {
+				return 0;
+			}
+			wait = (u32_t)timeout - elapsed;
+		}
+
+		SYS_ARCH_PROTECT(lev);
+		if (ep->ready_head != NULL) {
+			SYS_ARCH_UNPROTECT(lev);
+			continue;
+		}
+		ep->waiting++;
+		SYS_ARCH_UNPROTECT(lev);
+
+		sys_arch_sem_wait(&ep->sem, wait);
+
+		SYS_ARCH_PROTECT(lev);
+		ep->waiting--;
+		SYS_ARCH_UNPROTECT(lev);
+	}
+}
+
+int lwip_epoll_poll(struct lwip_epoll *ep, struct pollfd *fds, bool setup)
+{
+	int ret = -EBUSY;
+	int i;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	for (i = 0; i < LWIP_EPOLL_NPOLLWAITERS; i++) {
+		if (setup && ep->fds[i] == NULL) {
+			ep->fds[i] = fds;
+			if (ep->ready_head != NULL && (fds->events & POLLIN)) {
+				fds->revents |= POLLIN;
+				sys_sem_signal(fds->sem);
+			}
+			ret = 0;
+			break;
+		} else if (!setup && ep->fds[i] == fds) {
+			ep->fds[i] = NULL;
+			ret = 0;
+			break;
+		}
+	}
+	SYS_ARCH_UNPROTECT(lev);
+
+	return ret;
+}
+#endif							/* LWIP_SOCKET_EPOLL */
+
 /**
  * Callback registered in the netconn layer for each socket-netconn.
  * Processes receive events (data available) and wakes up tasks waiting for select.
@@ -1886,6 +2765,12 @@ static void event_callback(struct netconn *conn, enum netconn_evt evt, u16_t len
 		break;
 	}
 
+#if LWIP_SOCKET_EPOLL
+	if (sock->epoll_items != NULL) {
+		lwip_epoll_notify(sock);
+	}
+#endif
+
 	if (sock->select_waiting == 0) {
 		/* none is waiting for this socket, no need to check select_cb_list */
 		SYS_ARCH_UNPROTECT(lev);
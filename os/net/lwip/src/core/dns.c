@@ -132,6 +132,15 @@ static u16_t dns_txid;
 #define DNS_MAX_RETRIES           4
 #endif
 
+#if LWIP_DNS_CACHE
+#if (DNS_HASH_SIZE & (DNS_HASH_SIZE - 1)) != 0
+#error DNS_HASH_SIZE must be a power of 2
+#endif
+#if DNS_TABLE_SIZE > 255
+#error DNS_TABLE_SIZE must be at most 255 with LWIP_DNS_CACHE
+#endif
+#endif							/* LWIP_DNS_CACHE */
+
 /** DNS resource record max. TTL (one week as default) */
 #ifndef DNS_MAX_TTL
 #define DNS_MAX_TTL               604800
@@ -236,6 +245,12 @@ typedef enum {
 	DNS_STATE_DONE = 3
 } dns_state_enum_t;
 
+#if LWIP_DNS_CACHE
+/* DNS table entry flags */
+#define DNS_ENTRY_FAILED   0x01	/* DONE: the name could not be resolved */
+#define DNS_ENTRY_PREFETCH 0x02	/* NEW/ASKING: ipaddr still holds the previous answer */
+#endif
+
 /** DNS table entry */
 struct dns_table_entry {
 	u32_t ttl;
@@ -256,6 +271,11 @@ struct dns_table_entry {
 #if LWIP_DNS_SUPPORT_MDNS_QUERIES
 	u8_t is_mdns;
 #endif
+#if LWIP_DNS_CACHE
+	u8_t next;					/* next entry of the hash bucket + 1, 0 at the end */
+	u8_t flags;
+	u8_t hits;					/* lookups since the name was resolved */
+#endif
 };
 
 /** DNS request table entry: used when dns_gehostbyname cannot answer the
@@ -303,7 +323,9 @@ static err_t dns_lookup_local(const char *hostname, ip_addr_t *addr LWIP_DNS_ADD
 /* forward declarations */
 static void dns_recv(void *s, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr, u16_t port);
 static void dns_check_entries(void);
+static void dns_check_entry(u8_t i);
 static void dns_call_found(u8_t idx, ip_addr_t *addr);
+static void dns_query_failed(u8_t idx, u8_t cache_failure);
 
 /*-----------------------------------------------------------------------------
  * Globals
@@ -318,6 +340,10 @@ static u8_t dns_seqno;
 static struct dns_table_entry dns_table[DNS_TABLE_SIZE];
 static struct dns_req_entry dns_requests[DNS_MAX_REQUESTS];
 static ip_addr_t dns_servers[DNS_MAX_SERVERS];
+#if LWIP_DNS_CACHE
+/* first entry of each bucket + 1, 0 if empty, so zero initialization works */
+static u8_t dns_hash[DNS_HASH_SIZE];
+#endif
 
 #if LWIP_IPV4
 const ip_addr_t dns_mquery_v4group = DNS_MQUERY_IPV4_GROUP_INIT;
@@ -582,6 +608,54 @@ err_t dns_local_addhost(const char *hostname, const ip_addr_t *addr)
 #endif							/* DNS_LOCAL_HOSTLIST_IS_DYNAMIC */
 #endif							/* DNS_LOCAL_HOSTLIST */
 
+#if LWIP_DNS_CACHE
+/* Names are compared case-insensitively, so they are hashed the same way */
+static u8_t dns_hash_name(const char *name)
+{
+	u32_t h = 2166136261UL;
+
+	while (*name) {
+		char c = *name++;
+		if ((c >= 'A') && (c <= 'Z')) {
+			c = (char)(c + ('a' - 'A'));
+		}
+		h = (h ^ (u8_t)c) * 16777619UL;
+	}
+
+	return (u8_t)(h & (DNS_HASH_SIZE - 1));
+}
+
+/* Entries are put in the bucket of their name when it is set and only
+ * removed when the entry is reused for another name, whatever its state */
+static void dns_hash_add(u8_t idx)
+{
+	u8_t bucket = dns_hash_name(dns_table[idx].name);
+
+	dns_table[idx].next = dns_hash[bucket];
+	dns_hash[bucket] = (u8_t)(idx + 1);
+}
+
+static void dns_hash_remove(u8_t idx)
+{
+	u8_t *link;
+
+	if (dns_table[idx].name[0] == 0) {
+		/* never named, not in any bucket */
+		return;
+	}
+
+	link = &dns_hash[dns_hash_name(dns_table[idx].name)];
+	while (*link != 0) {
+		if (*link == idx + 1) {
+			*link = dns_table[idx].next;
+			break;
+		}
+		link = &dns_table[*link - 1].next;
+	}
+	dns_table[idx].next = 0;
+}
+#endif							/* LWIP_DNS_CACHE */
+
 /**
  * Look up a hostname in the array of known hostnames.
  *
@@ -594,7 +668,8 @@ err_t dns_local_addhost(const char *hostname, const ip_addr_t *addr)
  * @param addr the hostname's IP address, as u32_t (instead of ip_addr_t to
  *         better check for failure: != IPADDR_NONE) or IPADDR_NONE if the hostname
  *         was not found in the cached dns_table.
- * @return ERR_OK if found, ERR_ARG if not found
+ * @return ERR_OK if found, ERR_ARG if not found, ERR_VAL if the name recently
+ *         failed to resolve (LWIP_DNS_CACHE only)
  */
 static err_t dns_lookup(const char *name, ip_addr_t *addr LWIP_DNS_ADDRTYPE_ARG(u8_t dns_addrtype))
 {
@@ -612,6 +687,37 @@ static err_t dns_lookup(const char *name, ip_addr_t *addr LWIP_DNS_ADDRTYPE_ARG(
 	}
 #endif							/* DNS_LOOKUP_LOCAL_EXTERN */
 
+#if LWIP_DNS_CACHE
+	for (i = dns_hash[dns_hash_name(name)]; i != 0; i = dns_table[i - 1].next) {
+		struct dns_table_entry *entry = &dns_table[i - 1];
+
+		if (lwip_strnicmp(name, entry->name, sizeof(entry->name)) != 0) {
+			continue;
+		}
+		if ((entry->state == DNS_STATE_DONE) && (entry->flags & DNS_ENTRY_FAILED)) {
+#if LWIP_IPV4 && LWIP_IPV6
+			if (LWIP_DNS_ADDRTYPE_IS_IPV6(entry->reqaddrtype) != LWIP_DNS_ADDRTYPE_IS_IPV6(dns_addrtype)) {
+				continue;
+			}
+#endif							/* LWIP_IPV4 && LWIP_IPV6 */
+			LWIP_DEBUGF(DNS_DEBUG, ("dns_lookup: \"%s\": failed recently\n", name));
+			return ERR_VAL;
+		}
+		/* a name being prefetched keeps its previous answer */
+		if (((entry->state == DNS_STATE_DONE) || (entry->flags & DNS_ENTRY_PREFETCH)) && LWIP_DNS_ADDRTYPE_MATCH_IP(dns_addrtype, entry->ipaddr)) {
+			LWIP_DEBUGF(DNS_DEBUG, ("dns_lookup: \"%s\": found = ", name));
+			ip_addr_debug_print(DNS_DEBUG, &(entry->ipaddr));
+			LWIP_DEBUGF(DNS_DEBUG, ("\n"));
+			if (addr) {
+				ip_addr_copy(*addr, entry->ipaddr);
+			}
+			if (entry->hits < 0xFF) {
+				entry->hits++;
+			}
+			return ERR_OK;
+		}
+	}
+#else							/* LWIP_DNS_CACHE */
 	/* Walk through name list, return entry if found. If not, return NULL. */
 	for (i = 0; i < DNS_TABLE_SIZE; ++i) {
 		if ((dns_table[i].state == DNS_STATE_DONE) && (lwip_strnicmp(name, dns_table[i].name, sizeof(dns_table[i].name)) == 0) && LWIP_DNS_ADDRTYPE_MATCH_IP(dns_addrtype, dns_table[i].ipaddr)) {
@@ -624,6 +730,7 @@ static err_t dns_lookup(const char *name, ip_addr_t *addr LWIP_DNS_ADDRTYPE_ARG(
 			return ERR_OK;
 		}
 	}
+#endif							/* LWIP_DNS_CACHE */
 
 	return ERR_ARG;
 }
@@ -741,10 +848,8 @@ static err_t dns_send(u8_t idx)
 #endif
 	   ) {
 		/* DNS server not valid anymore, e.g. PPP netif has been shut down */
-		/* call specified callback function if provided */
-		dns_call_found(idx, NULL);
-		/* flush this entry */
-		entry->state = DNS_STATE_UNUSED;
+		/* call specified callback function if provided and flush this entry */
+		dns_query_failed(idx, 0);
 		return ERR_OK;
 	}
 
@@ -978,6 +1083,70 @@ again:
 	return txid;
 }
 
+/**
+ * A query failed or could not be sent: call the callback of the entry and
+ * flush it. With LWIP_DNS_CACHE, a prefetched name keeps its previous answer
+ * until it expires, and a failure of the server is remembered for
+ * DNS_NEG_TTL seconds if cache_failure is set.
+ *
+ * @param idx dns table index of the entry
+ * @param cache_failure 1 if the server failed to resolve the name
+ */
+static void dns_query_failed(u8_t idx, u8_t cache_failure)
+{
+	struct dns_table_entry *entry = &dns_table[idx];
+
+	dns_call_found(idx, NULL);
+
+#if LWIP_DNS_CACHE
+	if (entry->flags & DNS_ENTRY_PREFETCH) {
+		entry->flags &= (u8_t)~DNS_ENTRY_PREFETCH;
+		entry->hits = 0;
+		entry->state = (entry->ttl > 0) ? DNS_STATE_DONE : DNS_STATE_UNUSED;
+		return;
+	}
+#if DNS_NEG_TTL > 0
+	if (cache_failure) {
+		LWIP_DEBUGF(DNS_DEBUG, ("dns_query_failed: \"%s\": cached for %d s\n", entry->name, DNS_NEG_TTL));
+		ip_addr_set_zero(&entry->ipaddr);
+		entry->flags = DNS_ENTRY_FAILED;
+		entry->ttl = DNS_NEG_TTL;
+		entry->state = DNS_STATE_DONE;
+		return;
+	}
+#endif							/* DNS_NEG_TTL > 0 */
+#endif							/* LWIP_DNS_CACHE */
+	LWIP_UNUSED_ARG(cache_failure);
+
+	entry->state = DNS_STATE_UNUSED;
+}
+
+#if LWIP_DNS_CACHE && (DNS_PREFETCH_TIME > 0)
+/**
+ * Ask again a name used since it was resolved before it expires. Lookups
+ * keep getting the previous answer until the new one comes.
+ *
+ * @param idx dns table index of the entry, in DNS_STATE_DONE
+ */
+static void dns_prefetch(u8_t idx)
+{
+	struct dns_table_entry *entry = &dns_table[idx];
+
+	LWIP_DEBUGF(DNS_DEBUG, ("dns_prefetch: \"%s\"\n", entry->name));
+
+#if ((LWIP_DNS_SECURE & LWIP_DNS_SECURE_RAND_SRC_PORT) != 0)
+	entry->pcb_idx = dns_alloc_pcb();
+	if (entry->pcb_idx >= DNS_MAX_SOURCE_PORTS) {
+		/* no prefetch, the name just expires */
+		return;
+	}
+#endif
+	entry->flags |= DNS_ENTRY_PREFETCH;
+	entry->state = DNS_STATE_NEW;
+	dns_check_entry(idx);
+}
+#endif							/* LWIP_DNS_CACHE && (DNS_PREFETCH_TIME > 0) */
+
 /**
  * dns_check_entry() - see if entry has not yet been queried and, if so, sends out a query.
  * Check an entry in the dns_table:
@@ -1010,6 +1179,12 @@ static void dns_check_entry(u8_t i)
 		}
 		break;
 	case DNS_STATE_ASKING:
+#if LWIP_DNS_CACHE
+		/* the previous answer of a prefetched name keeps expiring */
+		if ((entry->flags & DNS_ENTRY_PREFETCH) && (entry->ttl > 0)) {
+			entry->ttl--;
+		}
+#endif							/* LWIP_DNS_CACHE */
 		if (--entry->tmr == 0) {
 			if (++entry->retries == DNS_MAX_RETRIES) {
 				if ((entry->server_idx + 1 < DNS_MAX_SERVERS) && !ip_addr_isany_val(dns_servers[entry->server_idx + 1])
@@ -1023,10 +1198,8 @@ static void dns_check_entry(u8_t i)
 					entry->retries = 0;
 				} else {
 					LWIP_DEBUGF(DNS_DEBUG, ("dns_check_entry: \"%s\": timeout\n", entry->name));
-					/* call specified callback function if provided */
-					dns_call_found(i, NULL);
-					/* flush this entry */
-					entry->state = DNS_STATE_UNUSED;
+					/* call specified callback function if provided and flush this entry */
+					dns_query_failed(i, 1);
 					break;
 				}
 			} else {
@@ -1048,6 +1221,11 @@ static void dns_check_entry(u8_t i)
 			/* flush this entry, there cannot be any related pending entries in this state */
 			entry->state = DNS_STATE_UNUSED;
 		}
+#if LWIP_DNS_CACHE && (DNS_PREFETCH_TIME > 0)
+		else if ((entry->ttl == DNS_PREFETCH_TIME) && (entry->hits > 0) && !(entry->flags & DNS_ENTRY_FAILED)) {
+			dns_prefetch(i);
+		}
+#endif							/* LWIP_DNS_CACHE && (DNS_PREFETCH_TIME > 0) */
 		break;
 	case DNS_STATE_UNUSED:
 		/* nothing to do */
@@ -1078,6 +1256,10 @@ static void dns_correct_response(u8_t idx, u32_t ttl)
 	struct dns_table_entry *entry = &dns_table[idx];
 
 	entry->state = DNS_STATE_DONE;
+#if LWIP_DNS_CACHE
+	entry->flags = 0;
+	entry->hits = 0;
+#endif
 
 	LWIP_DEBUGF(DNS_DEBUG, ("dns_recv: \"%s\": response = ", entry->name));
 	ip_addr_debug_print(DNS_DEBUG, (&(entry->ipaddr)));
@@ -1261,8 +1443,7 @@ static void dns_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_ad
 				}
 				/* call callback to indicate error, clean up memory and return */
 				pbuf_free(p);
-				dns_call_found(i, NULL);
-				dns_table[i].state = DNS_STATE_UNUSED;
+				dns_query_failed(i, 1);
 				return;
 			}
 		}
@@ -1293,6 +1474,23 @@ static err_t dns_enqueue(const char *name, size_t hostnamelen, dns_found_callbac
 
 #if ((LWIP_DNS_SECURE & LWIP_DNS_SECURE_NO_MULTIPLE_OUTSTANDING) != 0)
 	u8_t r;
+#endif
+
+	/* a query without callback, i.e. a non-blocking caller polling for the
+	 * answer, does not need another entry while the name is being asked */
+	if (found == NULL) {
+		for (i = 0; i < DNS_TABLE_SIZE; i++) {
+			if (((dns_table[i].state == DNS_STATE_NEW) || (dns_table[i].state == DNS_STATE_ASKING)) &&
+#if LWIP_IPV4 && LWIP_IPV6
+				(dns_table[i].reqaddrtype == dns_addrtype) &&
+#endif							/* LWIP_IPV4 && LWIP_IPV6 */
+				(lwip_strnicmp(name, dns_table[i].name, sizeof(dns_table[i].name)) == 0)) {
+				return ERR_INPROGRESS;
+			}
+		}
+	}
+
+#if ((LWIP_DNS_SECURE & LWIP_DNS_SECURE_NO_MULTIPLE_OUTSTANDING) != 0)
 	/* check for duplicate entries */
 	for (i = 0; i < DNS_TABLE_SIZE; i++) {
 		if ((dns_table[i].state == DNS_STATE_ASKING) && (lwip_strnicmp(name, dns_table[i].name, sizeof(dns_table[i].name)) == 0)) {
@@ -1375,6 +1573,11 @@ static err_t dns_enqueue(const char *name, size_t hostnamelen, dns_found_callbac
 	LWIP_DEBUGF(DNS_DEBUG, ("dns_enqueue: \"%s\": use DNS entry %" U16_F "\n", name, (u16_t)(i)));
 
 	/* fill the entry */
+#if LWIP_DNS_CACHE
+	dns_hash_remove(i);
+	entry->flags = 0;
+	entry->hits = 0;
+#endif
 	entry->state = DNS_STATE_NEW;
 	entry->seqno = dns_seqno;
 	LWIP_DNS_SET_ADDRTYPE(entry->reqaddrtype, dns_addrtype);
@@ -1384,6 +1587,9 @@ static err_t dns_enqueue(const char *name, size_t hostnamelen, dns_found_callbac
 	namelen = LWIP_MIN(hostnamelen, DNS_MAX_NAME_LENGTH - 1);
 	MEMCPY(entry->name, name, namelen);
 	entry->name[namelen] = 0;
+#if LWIP_DNS_CACHE
+	dns_hash_add(i);
+#endif
 
 #if ((LWIP_DNS_SECURE & LWIP_DNS_SECURE_RAND_SRC_PORT) != 0)
 	entry->pcb_idx = dns_alloc_pcb();
@@ -1420,6 +1626,11 @@ static err_t dns_enqueue(const char *name, size_t hostnamelen, dns_found_callbac
  * - ERR_INPROGRESS enqueue a request to be sent to the DNS server
  *   for resolution if no errors are present.
  * - ERR_ARG: dns client not initialized or invalid hostname
+ * - ERR_VAL: no DNS server, or the name failed to resolve less than
+ *   DNS_NEG_TTL seconds ago (LWIP_DNS_CACHE)
+ *
+ * found may be NULL to poll for the answer: calling again with the same name
+ * returns ERR_INPROGRESS until the answer is in the table.
  *
  * @param hostname the hostname that is to be queried
  * @param addr pointer to a ip_addr_t where to store the address if it is already
@@ -1450,6 +1661,7 @@ err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr, dns_found_callbac
 err_t dns_gethostbyname_addrtype(const char *hostname, ip_addr_t *addr, dns_found_callback found, void *callback_arg, u8_t dns_addrtype)
 {
 	size_t hostnamelen;
+	err_t err;
 #if LWIP_DNS_SUPPORT_MDNS_QUERIES
 	u8_t is_mdns;
 #endif
@@ -1484,9 +1696,10 @@ err_t dns_gethostbyname_addrtype(const char *hostname, ip_addr_t *addr, dns_foun
 			return ERR_OK;
 		}
 	}
-	/* already have this address cached? */
-	if (dns_lookup(hostname, addr LWIP_DNS_ADDRTYPE_ARG(dns_addrtype)) == ERR_OK) {
-		return ERR_OK;
+	/* already have this address cached? ERR_VAL if the name failed recently */
+	err = dns_lookup(hostname, addr LWIP_DNS_ADDRTYPE_ARG(dns_addrtype));
+	if (err != ERR_ARG) {
+		return err;
 	}
 #if LWIP_IPV4 && LWIP_IPV6
 	if ((dns_addrtype == LWIP_DNS_ADDRTYPE_IPV4_IPV6) || (dns_addrtype == LWIP_DNS_ADDRTYPE_IPV6_IPV4)) {
@@ -1497,8 +1710,9 @@ err_t dns_gethostbyname_addrtype(const char *hostname, ip_addr_t *addr, dns_foun
 		} else {
 			fallback = LWIP_DNS_ADDRTYPE_IPV4;
 		}
-		if (dns_lookup(hostname, addr LWIP_DNS_ADDRTYPE_ARG(fallback)) == ERR_OK) {
-			return ERR_OK;
+		err = dns_lookup(hostname, addr LWIP_DNS_ADDRTYPE_ARG(fallback));
+		if (err != ERR_ARG) {
+			return err;
 		}
 	}
 #else							/* LWIP_IPV4 && LWIP_IPV6 */
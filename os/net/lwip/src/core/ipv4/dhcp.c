@@ -734,20 +734,8 @@ int dhcp_sethostname(struct netif *netif, void *arg)
 }
 #endif
 
-/**
- * @ingroup dhcp4
- * Start DHCP negotiation for a network interface.
- *
- * If no DHCP client instance was attached to this interface,
- * a new client is created first. If a DHCP client instance
- * was already present, it restarts negotiation.
- *
- * @param netif The lwIP network interface
- * @return lwIP error code
- * - ERR_OK - No error
- * - ERR_MEM - Out of memory
- */
-err_t dhcp_start(struct netif *netif)
+/* Start DHCP negotiation, with the address of a previous lease if addr isn't NULL */
+static err_t dhcp_start_addr(struct netif *netif, const ip4_addr_t *addr)
 {
 	struct dhcp *dhcp;
 	err_t result;
@@ -798,16 +786,25 @@ err_t dhcp_start(struct netif *netif)
 	}
 	dhcp->pcb_allocated = 1;
 
+	if (addr != NULL) {
+		ip4_addr_copy(dhcp->offered_ip_addr, *addr);
+	}
+
 #if LWIP_DHCP_CHECK_LINK_UP
 	if (!netif_is_link_up(netif)) {
-		/* set state INIT and wait for dhcp_network_changed() to call dhcp_discover() */
-		dhcp_set_state(dhcp, DHCP_STATE_INIT);
+		/* set state INIT (or REBOOTING) and wait for dhcp_network_changed() to call
+		 * dhcp_discover() (or dhcp_reboot()) */
+		dhcp_set_state(dhcp, addr != NULL ? DHCP_STATE_REBOOTING : DHCP_STATE_INIT);
 		return ERR_OK;
 	}
 #endif /* LWIP_DHCP_CHECK_LINK_UP */
 
 	/* (re)start the DHCP negotiation */
-	result = dhcp_discover(netif);
+	if (addr != NULL) {
+		result = dhcp_reboot(netif);
+	} else {
+		result = dhcp_discover(netif);
+	}
 	if (result != ERR_OK) {
 		/* free resources allocated above */
 		dhcp_stop(netif);
@@ -816,6 +813,41 @@ err_t dhcp_start(struct netif *netif)
 	return result;
 }
 
+/**
+ * @ingroup dhcp4
+ * Start DHCP negotiation for a network interface.
+ *
+ * If no DHCP client instance was attached to this interface,
+ * a new client is created first. If a DHCP client instance
+ * was already present, it restarts negotiation.
+ *
+ * @param netif The lwIP network interface
+ * @return lwIP error code
+ * - ERR_OK - No error
+ * - ERR_MEM - Out of memory
+ */
+err_t dhcp_start(struct netif *netif)
+{
+	return dhcp_start_addr(netif, NULL);
+}
+
+/**
+ * @ingroup dhcp4
+ * Start DHCP negotiation in the INIT-REBOOT state (RFC 2131, 3.2): the
+ * address of a previous lease is requested at once, without discovering
+ * the servers. If the server refuses it or doesn't answer, the client
+ * falls back to discovering.
+ *
+ * @param netif The lwIP network interface
+ * @param arg The address of the previous lease (const ip4_addr_t *)
+ * @return lwIP error code
+ */
+err_t dhcp_start_reboot(struct netif *netif, void *arg)
+{
+	LWIP_ERROR("arg != NULL", (arg != NULL), return ERR_ARG;);
+	return dhcp_start_addr(netif, (const ip4_addr_t *)arg);
+}
+
 /**
  * @ingroup dhcp4
  * Inform a DHCP server of our manual configuration.
@@ -116,10 +116,10 @@ void *mem_trim(void *mem, mem_size_t size)
 #define mem_clib_free kmm_free
 #endif
 #ifndef mem_clib_malloc
-#define mem_clib_malloc kmm_malloc
+#define mem_clib_malloc kmm_malloc_fast
 #endif
 #ifndef mem_clib_calloc
-#define mem_clib_calloc kmm_malloc
+#define mem_clib_calloc kmm_malloc_fast
 #endif
 
 #if LWIP_STATS && MEM_STATS
@@ -111,6 +111,9 @@ void pbuf_free_ooseq(void)
 			LWIP_DEBUGF(PBUF_DEBUG | LWIP_DBG_TRACE, ("pbuf_free_ooseq: freeing out-of-sequence pbufs\n"));
 			tcp_segs_free(pcb->ooseq);
 			pcb->ooseq = NULL;
+#ifdef LWIP_HOOK_TCP_OOSEQ_FREE
+			LWIP_HOOK_TCP_OOSEQ_FREE(pcb);
+#endif
 			return;
 		}
 	}
@@ -330,6 +333,15 @@ struct pbuf *pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type)
 	return p;
 }
 
+/**
+ * Reclaim the out-of-sequence TCP segments as when PBUF_POOL runs empty.
+ * For the owners of other pools of received pbufs, like the network drivers.
+ */
+void pbuf_pool_exhausted(void)
+{
+	PBUF_POOL_IS_EMPTY();
+}
+
 #if LWIP_SUPPORT_CUSTOM_PBUF
 /** Initialize a custom pbuf (already allocated).
  *
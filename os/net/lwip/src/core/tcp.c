@@ -1075,6 +1075,9 @@ tcp_slowtmr_start:
 			tcp_segs_free(pcb->ooseq);
 			pcb->ooseq = NULL;
 			LWIP_DEBUGF(TCP_CWND_DEBUG, ("tcp_slowtmr: dropping OOSEQ queued data\n"));
+#ifdef LWIP_HOOK_TCP_OOSEQ_FREE
+			LWIP_HOOK_TCP_OOSEQ_FREE(pcb);
+#endif
 		}
 #endif							/* TCP_QUEUE_OOSEQ */
 
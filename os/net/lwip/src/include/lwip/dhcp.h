@@ -128,6 +128,20 @@ void dhcp_cleanup(struct netif *netif);
 */
 err_t dhcp_start(struct netif *netif);
 
+/**
+ * @brief Start DHCP negotiation in the INIT-REBOOT state
+ *
+ * @details @b #include <lwip/dhcp.h>
+ *	The address of a previous lease is requested without discovering the
+ *	servers first. The client falls back to discovering if it is refused.
+ *
+ * @param netif The lwIP network interface
+ * @param arg The address of the previous lease (const ip4_addr_t *)
+ * @return lwIP error code
+ * @since TizenRT v4.1
+*/
+err_t dhcp_start_reboot(struct netif *netif, void *arg);
+
 /// @cond
 /** enforce early lease renewal (not needed normally)*/
 err_t dhcp_renew(struct netif *netif);
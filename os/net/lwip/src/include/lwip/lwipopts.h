@@ -803,6 +803,16 @@
 #define LWIP_COMPAT_MUTEX	CONFIG_NET_COMPAT_MUTEX
 #endif
 
+/* With core locking, the socket calls of every application thread take
+ * lock_tcpip_core instead of waiting for tcpip_thread. Unless configured
+ * otherwise, make it a pthread mutex rather than a binary semaphore, so
+ * that it has an owner and a low priority holder is boosted by the
+ * priority inheritance of the mutex.
+ */
+#if defined(CONFIG_NET_TCPIP_CORE_LOCKING) && !defined(LWIP_COMPAT_MUTEX)
+#define LWIP_COMPAT_MUTEX	0
+#endif
+
 #ifdef CONFIG_NET_SYS_LIGHTWEIGHT_PROT
 #define SYS_LIGHTWEIGHT_PROT	CONFIG_NET_SYS_LIGHTWEIGHT_PROT
 #endif
@@ -1204,6 +1214,13 @@
 #endif
 #endif /* CONFIG_NET_DNS_LOCAL_HOSTLIST */
 
+#ifdef CONFIG_NET_DNS_CACHE
+#define LWIP_DNS_CACHE 1
+#define DNS_HASH_SIZE CONFIG_NET_DNS_CACHE_HASH_SIZE
+#define DNS_PREFETCH_TIME CONFIG_NET_DNS_PREFETCH_TIME
+#define DNS_NEG_TTL CONFIG_NET_DNS_NEG_TTL
+#endif
+
 #endif /* LWIP_DNS */
 /* ---------- End of DNS options ---------*/
 
@@ -1217,6 +1234,44 @@
 #define LWIP_NETIF_TX_SINGLE_PBUF             1
 #endif
 
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+#define LWIP_SOCKET_ZEROCOPY                  1
+/* lwip_sendto_ref() frees the application buffer through a custom pbuf */
+#define LWIP_SUPPORT_CUSTOM_PBUF              1
+#endif
+
+#ifdef CONFIG_NET_EPOLL
+#define LWIP_SOCKET_EPOLL                     1
+#endif
+
+#ifdef CONFIG_NET_NETDEV_RXPOOL
+/* Received frames are put in custom pbufs of the pools of their devices */
+#define LWIP_SUPPORT_CUSTOM_PBUF              1
+#endif
+
+#ifdef CONFIG_NET_NETDEV_CSUM_OFFLOAD
+/* netdev_config.offload turns off the checksums a device handles */
+#define LWIP_CHECKSUM_CTRL_PER_NETIF          1
+#endif
+
+#ifdef CONFIG_ARCH_CHKSUM
+/* Checksums of the architecture, see up_chksum() in <tinyara/arch.h>.
+ * Data copied from sockets is summed as it is copied.
+ */
+#include <stdint.h>
+uint16_t up_chksum(const void *dataptr, int len);
+uint16_t up_chksum_copy(void *dst, const void *src, uint16_t len);
+#define LWIP_CHKSUM                           up_chksum
+#define LWIP_CHKSUM_COPY(dst, src, len)       up_chksum_copy(dst, src, len)
+#define LWIP_CHECKSUM_ON_COPY                 1
+#endif
+
+#ifdef CONFIG_NET_STATS
+/* Dropped out-of-sequence segments are counted by the network manager */
+void netstats_ooseq_freed(void);
+#define LWIP_HOOK_TCP_OOSEQ_FREE(pcb)         netstats_ooseq_freed()
+#endif
+
 /*  ---------------Mandatory ---------------- */
 #define LWIP_DHCP_TCPIP_THREAD 1
 #endif							/* __LWIP_LWIPOPTS_H__ */
@@ -87,6 +87,7 @@ extern "C" {
 #define EAI_FAIL        202
 #define EAI_MEMORY      203
 #define EAI_FAMILY      204
+#define EAI_AGAIN       205
 
 #define HOST_NOT_FOUND  210
 #define NO_DATA         211
@@ -103,6 +104,9 @@ extern "C" {
 #define AI_V4MAPPED     0x10
 #define AI_ALL          0x20
 #define AI_ADDRCONFIG   0x40
+/* TizenRT: return EAI_AGAIN instead of waiting for the DNS server, call
+ * again with the same name until the answer is cached */
+#define AI_NONBLOCK     0x80
 #endif							/* LWIP_DNS_API_DEFINE_FLAGS */
 
 #if LWIP_DNS_API_DECLARE_STRUCTS
@@ -130,6 +130,8 @@ err_t netifapi_netif_common(struct netif *netif, netifapi_void_fn voidfunc, neti
 /** @ingroup netifapi_dhcp4 */
 #define netifapi_dhcp_start(n)        netifapi_netif_common(n, NULL, dhcp_start)
 /** @ingroup netifapi_dhcp4 */
+#define netifapi_dhcp_start_reboot(n, addr) netifapi_netif_common_arg(n, NULL, dhcp_start_reboot, addr)
+/** @ingroup netifapi_dhcp4 */
 #define netifapi_dhcp_stop(n)         netifapi_netif_common(n, dhcp_stop, NULL)
 /** @ingroup netifapi_dhcp4 */
 #define netifapi_dhcp_inform(n)       netifapi_netif_common(n, dhcp_inform, NULL)
@@ -150,6 +152,8 @@ err_t netifapi_netif_common(struct netif *netif, netifapi_void_fn voidfunc, neti
 /** @ingroup netifapi_dhcp4 */
 #define netifapi_dhcp_start(n)        dhcp_start(n)
 /** @ingroup netifapi_dhcp4 */
+#define netifapi_dhcp_start_reboot(n, addr) dhcp_start_reboot(n, addr)
+/** @ingroup netifapi_dhcp4 */
 #define netifapi_dhcp_stop(n)         dhcp_stop(n)
 /** @ingroup netifapi_dhcp4 */
 #define netifapi_dhcp_inform(n)       dhcp_inform(n)
@@ -1058,6 +1058,29 @@
 #ifndef LWIP_DNS_SUPPORT_MDNS_QUERIES
 #define LWIP_DNS_SUPPORT_MDNS_QUERIES  0
 #endif
+
+/** LWIP_DNS_CACHE==1: Find names of the DNS table through a hash table,
+ * prefetch the names in use before they expire and remember failed names. */
+#ifndef LWIP_DNS_CACHE
+#define LWIP_DNS_CACHE                  0
+#endif
+
+/** Number of buckets of the hash table, a power of 2 */
+#ifndef DNS_HASH_SIZE
+#define DNS_HASH_SIZE                   16
+#endif
+
+/** Seconds before the expiry of a name used since it was resolved at which
+ * it is asked again. 0 disables the prefetch. */
+#ifndef DNS_PREFETCH_TIME
+#define DNS_PREFETCH_TIME               30
+#endif
+
+/** Seconds a name which could not be resolved is failed without asking
+ * the server again. 0 disables the negative caching. */
+#ifndef DNS_NEG_TTL
+#define DNS_NEG_TTL                     30
+#endif
 /**
  * @}
  */
@@ -1746,6 +1769,32 @@
 #define LWIP_POSIX_SOCKETS_IO_NAMES     1
 #endif
 
+/**
+ * LWIP_SOCKET_ZEROCOPY==1: Enable lwip_recvfrom_pbuf(), which hands the
+ * received pbufs to the application, and lwip_sendto_ref(), which sends
+ * datagrams from application buffers. (only used if you use sockets.c)
+ */
+#ifndef LWIP_SOCKET_ZEROCOPY
+#define LWIP_SOCKET_ZEROCOPY            0
+#endif
+
+/**
+ * LWIP_SOCKET_EPOLL==1: Enable the lwip_epoll_*() functions, event
+ * notification through persistent interest lists and a ready list filled
+ * by the socket event callback. (only used if you use sockets.c)
+ */
+#ifndef LWIP_SOCKET_EPOLL
+#define LWIP_SOCKET_EPOLL               0
+#endif
+
+/**
+ * LWIP_EPOLL_NPOLLWAITERS==n: The number of poll() calls that can watch
+ * an epoll instance at the same time.
+ */
+#ifndef LWIP_EPOLL_NPOLLWAITERS
+#define LWIP_EPOLL_NPOLLWAITERS         2
+#endif
+
 /**
  * LWIP_SOCKET_OFFSET==n: Increases the file descriptor number created by LwIP with n.
  * This can be useful when there are multiple APIs which create file descriptors.
@@ -2596,6 +2645,16 @@
 #define LWIP_HOOK_MEMP_AVAILABLE(memp_t_type)
 #endif
 
+/**
+ * LWIP_HOOK_TCP_OOSEQ_FREE(pcb):
+ * - called when the out-of-sequence segments queued on 'pcb' are dropped,
+ *   from pbuf_free_ooseq() when the pbuf pool runs out and from
+ *   tcp_slowtmr() when they were kept for too long
+ */
+#ifdef __DOXYGEN__
+#define LWIP_HOOK_TCP_OOSEQ_FREE(pcb)
+#endif
+
 /**
  * LWIP_HOOK_UNKNOWN_ETH_PROTOCOL(pbuf, netif):
  * Called from ethernet_input() when an unknown eth type is encountered.
@@ -238,6 +238,7 @@ struct pbuf_test_args {
 #define pbuf_init()
 
 struct pbuf *pbuf_alloc(pbuf_layer l, u16_t length, pbuf_type type);
+void pbuf_pool_exhausted(void);
 #if LWIP_SUPPORT_CUSTOM_PBUF
 struct pbuf *pbuf_alloced_custom(pbuf_layer l, u16_t length, pbuf_type type, struct pbuf_custom *p, void *payload_mem, u16_t payload_mem_len);
 #endif							/* LWIP_SUPPORT_CUSTOM_PBUF */
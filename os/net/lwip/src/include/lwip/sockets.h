@@ -169,6 +169,7 @@ struct lwip_setgetsockopt_data {
 #endif /* IOV_MAX */
 
 struct msghdr;
+struct mmsghdr;
 
 /* struct msghdr->msg_flags bit field values */
 #define MSG_TRUNC   0x04
@@ -289,6 +290,7 @@ struct linger {
 #define MSG_OOB        0x04		/* Unimplemented: Requests out-of-band data. The significance and semantics of out-of-band data are protocol-specific */
 #define MSG_DONTWAIT   0x08		/* Nonblocking i/o for this operation only */
 #define MSG_MORE       0x10		/* Sender will send more */
+#define MSG_WAITFORONE 0x20		/* recvmmsg(): nonblocking once a message has been received */
 
 /*
  * Options for level IPPROTO_IP
@@ -495,6 +497,10 @@ struct lwip_sock {
 	u8_t err;
 	/** counter of how many threads are waiting for this socket using select */
 	SELWAIT_T select_waiting;
+#if LWIP_SOCKET_EPOLL
+	/** epoll instances watching this socket, set by lwip_epoll_ctl() */
+	struct lwip_epoll_item *epoll_items;
+#endif
 	u32_t pid;
 	u8_t pname[CONFIG_TASK_NAME_SIZE];
 };
@@ -519,7 +525,26 @@ int lwip_read(int s, void *mem, size_t len);
 int lwip_recvfrom(int s, void *mem, size_t len, int flags, struct sockaddr *from, socklen_t * fromlen);
 int lwip_send(int s, const void *dataptr, size_t size, int flags);
 int lwip_sendmsg(int s, const struct msghdr *message, int flags);
+int lwip_recvmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags, struct timespec *timeout);
+int lwip_sendmmsg(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags);
 int lwip_sendto(int s, const void *dataptr, size_t size, int flags, const struct sockaddr *to, socklen_t tolen);
+#if LWIP_SOCKET_ZEROCOPY
+struct pbuf;
+/** Called when the buffer given to lwip_sendto_ref() may be reused */
+typedef void (*lwip_sent_fn)(void *arg);
+int lwip_recvfrom_pbuf(int s, struct pbuf **p, int flags, struct sockaddr *from, socklen_t * fromlen);
+int lwip_sendto_ref(int s, const void *dataptr, size_t size, int flags, const struct sockaddr *to, socklen_t tolen, lwip_sent_fn sent, void *arg);
+#endif							/* LWIP_SOCKET_ZEROCOPY */
+#if LWIP_SOCKET_EPOLL
+struct lwip_epoll;
+struct epoll_event;
+struct pollfd;
+struct lwip_epoll *lwip_epoll_create(void);
+void lwip_epoll_close(struct lwip_epoll *ep);
+int lwip_epoll_ctl(struct lwip_epoll *ep, int op, int s, struct epoll_event *ev);
+int lwip_epoll_wait(struct lwip_epoll *ep, struct epoll_event *events, int maxevents, int timeout);
+int lwip_epoll_poll(struct lwip_epoll *ep, struct pollfd *fds, bool setup);
+#endif							/* LWIP_SOCKET_EPOLL */
 int lwip_socket(int domain, int type, int protocol);
 int lwip_write(int s, const void *dataptr, size_t size);
 int lwip_writev(int s, const struct iovec *iov, int iovcnt);
@@ -577,19 +577,30 @@ void sys_init(void)
 /* Create a new mutex*/
 err_t sys_mutex_new(sys_mutex_t *mutex)
 {
+	pthread_mutexattr_t attr;
 	int status = 0;
 
-	if (NULL == mutex) {
-		mutex = (pthread_mutex_t *)kmm_malloc(sizeof(pthread_mutex_t));
-	}
 	if (mutex == NULL) {
 #if SYS_STATS
 		SYS_STATS_INC(mutex.err);
 #endif							/* SYS_STATS */
-		return ERR_MEM;
+		return ERR_VAL;
 	}
-	status = pthread_mutex_init(mutex, NULL);
+
+	/* lock_tcpip_core is taken by application threads of any priority
+	 * when LWIP_TCPIP_CORE_LOCKING is enabled, so never let a low
+	 * priority holder be preempted indefinitely.
+	 */
+	pthread_mutexattr_init(&attr);
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+#endif
+	status = pthread_mutex_init(mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
 	if (status) {
+#if SYS_STATS
+		SYS_STATS_INC(mutex.err);
+#endif							/* SYS_STATS */
 		return ERR_MEM;
 	}
 #if SYS_STATS
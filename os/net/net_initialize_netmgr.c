@@ -18,6 +18,7 @@
 
 #include <tinyara/config.h>
 #include <tinyara/kmalloc.h>
+#include <tinyara/bootprof.h>
 #include <net/if.h>
 #include <tinyara/lwnl/lwnl.h>
 #include "netmgr/netstack.h"
@@ -119,6 +120,7 @@ void net_initialize(void)
 		NET_LOGKE(TAG, "!!!start stack fail!!!\n");
 		assert(0);
 	}
+	bootprof_mark("netstack");
 	if (trwifi_run_handler() != 0) {
 		NET_LOGKE(TAG, "!!!start event handler fail!!!\n");
 		assert(0);
@@ -190,6 +190,104 @@ ssize_t sendmsg(int sockfd, struct msghdr *msg, int flags)
 	NETSTACK_CALL_BYFD(sockfd, sendmsg, (sockfd, msg, flags));
 }
 
+/****************************************************************************
+ * Function: recvmmsg
+ *
+ * Description:
+ *	 Receive up to vlen messages with a single call. A network stack that
+ *	 supports it takes all of them from the socket without returning to
+ *	 the caller in between.
+ *
+ * Parameters:
+ *	 sockfd	  Socket descriptor of socket
+ *	 msgvec	  Messages to receive into
+ *	 vlen	  Number of messages in msgvec
+ *	 flags	  Receive flags
+ *	 timeout  Time after which no more messages are taken, or NULL
+ *
+ * Returned Value:
+ *	The number of messages received, msgvec[i].msg_len holding the length
+ *	of each. -1 if no message could be received, errno being set.
+ *
+ ****************************************************************************/
+int recvmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen, int flags, struct timespec *timeout)
+{
+	/* Treat as a cancellation point */
+	(void)enter_cancellation_point();
+	int res = -1;
+	NETSTACK_CALL_BYFD_RET(sockfd, recvmmsg, (sockfd, msgvec, vlen, flags, timeout), res);
+#ifdef CONFIG_NET_STATS
+	for (int i = 0; i < res; i++) {
+		NETMGR_STATS_ADD(g_app_recv_byte, msgvec[i].msg_len);
+		NETMGR_STATS_INC(g_app_recv_cnt);
+	}
+#endif
+	leave_cancellation_point();
+	return res;
+}
+
+/****************************************************************************
+ * Function: sendmmsg
+ *
+ * Description:
+ *	 Send up to vlen messages with a single call. Datagram sockets hand
+ *	 them to the network stack in batches.
+ *
+ * Parameters:
+ *	 sockfd	  Socket descriptor of socket
+ *	 msgvec	  Messages to send
+ *	 vlen	  Number of messages in msgvec
+ *	 flags	  Send flags
+ *
+ * Returned Value:
+ *	The number of messages sent, msgvec[i].msg_len holding the length of
+ *	each. -1 if no message could be sent, errno being set.
+ *
+ ****************************************************************************/
+int sendmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+	/* Treat as a cancellation point */
+	(void)enter_cancellation_point();
+	int res = -1;
+	NETSTACK_CALL_BYFD_RET(sockfd, sendmmsg, (sockfd, msgvec, vlen, flags), res);
+	leave_cancellation_point();
+	return res;
+}
+
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+ssize_t recvfrom_zc(int sockfd, struct pbuf **p, int flags, struct sockaddr *from, socklen_t *fromlen)
+{
+	/* Treat as a cancellation point */
+	(void)enter_cancellation_point();
+	int res = -1;
+	NETSTACK_CALL_BYFD_RET(sockfd, recvfrom_zc, (sockfd, p, flags, from, fromlen), res);
+	if (res > 0) {
+		NETMGR_STATS_ADD(g_app_recv_byte, res);
+		NETMGR_STATS_INC(g_app_recv_cnt);
+	}
+	leave_cancellation_point();
+	return res;
+}
+
+void recv_zc_release(struct pbuf *p)
+{
+	struct netstack *stk = get_netstack(TR_SOCKET);
+	if (p && stk && stk->ops->release_zc) {
+		stk->ops->release_zc(p);
+	}
+}
+
+ssize_t sendto_zc(int sockfd, const void *data, size_t size, int flags, const struct sockaddr *to, socklen_t tolen, zc_sent_t sent, void *arg)
+{
+	/* Treat as a cancellation point */
+	(void)enter_cancellation_point();
+	int res = -1;
+	NETSTACK_CALL_BYFD_RET(sockfd, sendto_zc, (sockfd, data, size, flags, to, tolen, sent, arg), res);
+	leave_cancellation_point();
+	return res;
+}
+#endif
+
 int socket(int domain, int type, int protocol)
 {
 	struct netstack *stk = NULL;
@@ -426,3 +426,77 @@ void net_releaselist(FAR struct socketlist *list)
 	/* Destroy the semaphore */
 	sem_destroy(&list->sl_sem);
 }
+
+#ifdef CONFIG_NET_EPOLL
+/****************************************************************************
+ * Name: net_epoll_create
+ *
+ * Description:
+ *   Create the network stack part of an epoll instance. Only sockets of the
+ *   TCP/IP stack can be watched.
+ *
+ * Returned Value:
+ *   The instance, NULL on error with errno set appropriately.
+ *
+ ****************************************************************************/
+
+void *net_epoll_create(void)
+{
+	struct netstack *stk = get_netstack(TR_SOCKET);
+	if (!stk || !stk->ops->epoll_create) {
+		set_errno(ENOSYS);
+		return NULL;
+	}
+	return stk->ops->epoll_create();
+}
+
+void net_epoll_close(void *ep)
+{
+	struct netstack *stk = get_netstack(TR_SOCKET);
+	if (stk && stk->ops->epoll_close) {
+		stk->ops->epoll_close(ep);
+	}
+}
+
+/****************************************************************************
+ * Name: net_epoll_ctl
+ *
+ * Returned Value:
+ *   0 on success; -1 on error with errno set appropriately. EPERM if 'sd'
+ *   is not a socket of the TCP/IP stack.
+ *
+ ****************************************************************************/
+
+int net_epoll_ctl(void *ep, int op, int sd, struct epoll_event *ev)
+{
+	struct netstack *stk = get_netstack(TR_SOCKET);
+	if (!stk || get_netstack_byfd(sd) != stk) {
+		set_errno(EPERM);
+		return -1;
+	}
+	NETSTACK_CALL(stk, epoll_ctl, (ep, op, sd, ev));
+}
+
+int net_epoll_wait(void *ep, struct epoll_event *events, int maxevents, int timeout)
+{
+	struct netstack *stk = get_netstack(TR_SOCKET);
+	NETSTACK_CALL(stk, epoll_wait, (ep, events, maxevents, timeout));
+}
+
+/****************************************************************************
+ * Name: net_epoll_poll
+ *
+ * Returned Value:
+ *   0 on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int net_epoll_poll(void *ep, struct pollfd *fds, bool setup)
+{
+	struct netstack *stk = get_netstack(TR_SOCKET);
+	if (!stk || !stk->ops->epoll_poll) {
+		return -ENOSYS;
+	}
+	return stk->ops->epoll_poll(ep, fds, setup);
+}
+#endif
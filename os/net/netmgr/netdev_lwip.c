@@ -36,6 +36,7 @@
 #include "lwip/netifapi.h"
 #include "lwip/snmp.h"
 #include "lwip/igmp.h"
+#include "lwip/tcpip.h"
 #include "netdev_mgr_internal.h"
 #include <tinyara/net/netlog.h>
 
@@ -278,6 +279,7 @@ static err_t lwip_linkoutput(struct netif *nic, struct pbuf *buf)
 {
 	struct netdev *dev = LW_GETND(nic);
 
+	NETMGR_STATS_HIST(ND_NETOPS(dev, hist).tx, buf->tot_len);
 	int res = ND_NETOPS(dev, linkoutput)(dev, (void *)buf, 0);
 	if (res < 0) {
 		NET_LOGKE(TAG, "linkoutput fail\n");
@@ -297,6 +299,7 @@ static int lwip_input(struct netdev *dev, void *frame_ptr, uint16_t len)
 
 	struct pbuf *p = (struct pbuf *)frame_ptr;
 	struct eth_hdr *ethhdr = p->payload;
+	NETMGR_STATS_HIST(ND_NETOPS(dev, hist).rx, p->tot_len);
 
 	switch (htons(ethhdr->type)) {
 	case ETHTYPE_IP:
@@ -338,6 +341,7 @@ static err_t lwip_linkoutput(struct netif *nic, struct pbuf *buf)
 		tbuf = tbuf->next;
 	}
 
+	NETMGR_STATS_HIST(ND_NETOPS(dev, hist).tx, offset);
 	int res = ND_NETOPS(dev, linkoutput)(dev, dev->tx_buf, offset);
 	if (res < 0) {
 		NET_LOGKE(TAG, "linkoutput fail\n");
@@ -359,16 +363,22 @@ static int lwip_input(struct netdev *dev, void *frame_ptr, uint16_t len)
 	}
 	struct netif *netif = GET_NETIF_FROM_NETDEV(dev);
 	/* We allocate a pbuf chain of pbufs from the pool. */
+#ifdef CONFIG_NET_NETDEV_RXPOOL
+	p = nm_rxpool_alloc(dev, len);
+#else
 	p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+#endif
 
 	if (!p) {
 		NET_LOGKE(TAG, "pbuf alloc\n");
 		LWIP_DEBUGF(NETIF_DEBUG, ("mem error\n"));
 		LINK_STATS_INC(link.memerr);
 		LINK_STATS_INC(link.drop);
+		NETMGR_STATS_INC(g_link_drop_pbuf);
 		return -1;
 	}
 	LWIP_DEBUGF(NETIF_DEBUG, ("processing pbufs\n"));
+	NETMGR_STATS_HIST(ND_NETOPS(dev, hist).rx, len);
 
 	/* We iterate over the pbuf chain until we have read the entire packet into the pbuf. */
 	for (q = p; q != NULL; q = q->next) {
@@ -393,6 +403,7 @@ static int lwip_input(struct netdev *dev, void *frame_ptr, uint16_t len)
 			NET_LOGKE(TAG, "input processing\n");
 			LWIP_DEBUGF(NETIF_DEBUG, ("input processing error\n"));
 			LINK_STATS_INC(link.err);
+			NETMGR_STATS_INC(g_link_recv_err);
 			pbuf_free(p);
 		} else {
 			LINK_STATS_INC(link.recv);
@@ -492,7 +503,9 @@ static int lwip_set_ip6addr(struct netdev *dev, struct sockaddr_storage *addr, i
 	}
 
 	if (type == NETDEV_IP) {
+		LOCK_TCPIP_CORE();
 		_netif_setip6addr(ni, addr);
+		UNLOCK_TCPIP_CORE();
 	} else if (type == NETDEV_GW) {
 		/*  ToDo it's not supported to set ipv6 gateway */
 		_convert_ip6addr_ntol(&ni->gw, (struct sockaddr_in6 *)addr);
@@ -686,11 +699,13 @@ static int lwip_softup(struct netdev *dev)
 	}
 
 	/* Below logic is not processed by lwIP thread.
-	 * So it can cause conflict to lwIP thread later.
+	 * So it can cause conflict to lwIP thread later unless
+	 * LWIP_TCPIP_CORE_LOCKING is enabled.
 	 * But now there are no APIs that can manage IPv6 auto-config.
 	 * this will be handled carefully later.
 	 */
 #ifdef CONFIG_NET_IPv6
+	LOCK_TCPIP_CORE();
 	/* IPV6 auto configuration : Link-Local address */
 	NET_LOGKV(TAG, "IPV6 link local address auto config\n");
 #ifdef CONFIG_NET_IPv6_AUTOCONFIG
@@ -714,6 +729,7 @@ static int lwip_softup(struct netdev *dev)
 			 PP_HTONL(solicit_addr.addr[0]), PP_HTONL(solicit_addr.addr[1]),
 			 PP_HTONL(solicit_addr.addr[2]), PP_HTONL(solicit_addr.addr[3]));
 #endif /* CONFIG_NET_IPv6_MLD */
+	UNLOCK_TCPIP_CORE();
 #endif /* CONFIG_NET_IPv6 */
 	return 0;
 }
@@ -755,16 +771,55 @@ static int lwip_joingroup(struct netdev *dev, struct in_addr *addr)
 {
 	struct netif *ni = GET_NETIF_FROM_NETDEV(dev);
 	struct ip4_addr a4 = {.addr = addr->s_addr};
-	return igmp_joingroup(ip_2_ip4(&(ni->ip_addr)), &a4);
+	err_t res;
+
+	LOCK_TCPIP_CORE();
+	res = igmp_joingroup(ip_2_ip4(&(ni->ip_addr)), &a4);
+	UNLOCK_TCPIP_CORE();
+	return res;
 }
 
 static int lwip_leavegroup(struct netdev *dev, struct in_addr *addr)
 {
 	struct netif *ni = GET_NETIF_FROM_NETDEV(dev);
 	struct ip4_addr a4 = {.addr = addr->s_addr};
-	return igmp_leavegroup(ip_2_ip4(&(ni->ip_addr)), &a4);
+	err_t res;
+
+	LOCK_TCPIP_CORE();
+	res = igmp_leavegroup(ip_2_ip4(&(ni->ip_addr)), &a4);
+	UNLOCK_TCPIP_CORE();
+	return res;
 }
 
+#if LWIP_CHECKSUM_CTRL_PER_NETIF
+/* Keep the checksums the device doesn't handle in software */
+static u16_t _lwip_checksum_ctrl(int offload)
+{
+	u16_t chksum_flags = NETIF_CHECKSUM_ENABLE_ALL;
+
+	if (offload & NM_OFFLOAD_TX_CSUM_IP) {
+		chksum_flags &= ~NETIF_CHECKSUM_GEN_IP;
+	}
+	if (offload & NM_OFFLOAD_TX_CSUM_TCP) {
+		chksum_flags &= ~NETIF_CHECKSUM_GEN_TCP;
+	}
+	if (offload & NM_OFFLOAD_TX_CSUM_UDP) {
+		chksum_flags &= ~NETIF_CHECKSUM_GEN_UDP;
+	}
+	if (offload & NM_OFFLOAD_RX_CSUM_IP) {
+		chksum_flags &= ~NETIF_CHECKSUM_CHECK_IP;
+	}
+	if (offload & NM_OFFLOAD_RX_CSUM_TCP) {
+		chksum_flags &= ~NETIF_CHECKSUM_CHECK_TCP;
+	}
+	if (offload & NM_OFFLOAD_RX_CSUM_UDP) {
+		chksum_flags &= ~NETIF_CHECKSUM_CHECK_UDP;
+	}
+
+	return chksum_flags;
+}
+#endif
+
 static int lwip_init_nic(struct netdev *dev, struct nic_config *config)
 {
 	if (!dev) {
@@ -788,6 +843,14 @@ static int lwip_init_nic(struct netdev *dev, struct nic_config *config)
 	}
 	((struct netdev_ops *)dev->ops)->linkoutput = config->io_ops.linkoutput;
 	((struct netdev_ops *)dev->ops)->igmp_mac_filter = config->io_ops.igmp_mac_filter;
+#ifdef CONFIG_NET_NETDEV_RXPOOL
+	if (nm_rxpool_init(dev, config->rx_reserve, config->mtu, config->io_ops.rx_pressure) < 0) {
+		NET_LOGKE(TAG, "rx pool fail\n");
+		kmm_free(rnetif);
+		((struct netdev_ops *)dev->ops)->nic = NULL;
+		return -1;
+	}
+#endif
 
 	nic->mtu = CONFIG_NET_ETH_MTU;
 	nic->hwaddr_len = config->hwaddr_len;
@@ -827,6 +890,9 @@ static int lwip_init_nic(struct netdev *dev, struct nic_config *config)
 #if LWIP_IPV6_MLD
 	nic->flags |= NETIF_FLAG_MLD6;
 #endif
+#if LWIP_CHECKSUM_CTRL_PER_NETIF
+	NETIF_SET_CHECKSUM_CTRL(nic, _lwip_checksum_ctrl(config->offload));
+#endif
 
 	return 0;
 }
@@ -888,7 +954,7 @@ static int lwip_get_stats(struct netdev *dev, void *arg)
 
 struct netdev_ops *get_netdev_ops_lwip(void)
 {
-	struct netdev_ops *netdev_ops = (struct netdev_ops *)kmm_malloc(sizeof(struct netdev_ops));
+	struct netdev_ops *netdev_ops = (struct netdev_ops *)kmm_zalloc(sizeof(struct netdev_ops));
 	if (!netdev_ops) {
 		NET_LOGKE(TAG, "alloc netdev_ops fail\n");
 		return NULL;
@@ -153,6 +153,8 @@ struct netdev *nm_register(struct netdev_config *config)
 	}
 	struct nic_config nconfig;
 	nconfig.flag = config->flag;
+	nconfig.offload = config->offload;
+	nconfig.rx_reserve = config->rx_reserve;
 	/*  Hardware address */
 	nconfig.mtu = config->mtu;
 	nconfig.hwaddr_len = config->hwaddr_len;
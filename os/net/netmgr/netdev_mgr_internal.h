@@ -17,6 +17,8 @@
  ****************************************************************************/
 #pragma once
 
+#include "netdev_stats.h"
+
 #define NETDEV_IP 1
 #define NETDEV_GW 2
 #define NETDEV_NETMASK 3
@@ -32,6 +34,8 @@
 
 struct nic_config {
 	int flag;
+	int offload;
+	int rx_reserve;
 	int mtu;
 	int hwaddr_len;
 	/*	Device address */
@@ -86,8 +90,21 @@ struct netdev_ops {
 #endif
 	/*  NIC stack specific */
 	void *nic;
+#ifdef CONFIG_NET_STATS
+	struct netdev_hist hist;
+#endif
+#ifdef CONFIG_NET_NETDEV_RXPOOL
+	struct netdev_rxpool *rxpool;
+#endif
 };
 
+#ifdef CONFIG_NET_NETDEV_RXPOOL
+/* Receive buffer pools, see netdev_rxpool.c */
+struct pbuf;
+int nm_rxpool_init(struct netdev *dev, int reserve, int mtu, void (*rx_pressure)(struct netdev *dev, int low));
+struct pbuf *nm_rxpool_alloc(struct netdev *dev, uint16_t len);
+#endif
+
 // integrate it to non-netmgr version, it's duplicated to netdev_callback_t
 typedef int (*tr_netdev_callback_t)(struct netdev *dev, void *arg);
 
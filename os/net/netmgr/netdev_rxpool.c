@@ -0,0 +1,229 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/*
+ * Receive buffer pools
+ *
+ * Frames copied from the drivers are put in pbufs of a pool of their
+ * device instead of PBUF_POOL, so that a busy device cannot take the
+ * buffers of the others. When its pool is empty, a device takes buffers
+ * from a shared pool which grows from the heap up to a limit, and past
+ * that the frame is dropped.
+ * The driver is told through rx_pressure() when few of its buffers are
+ * left, and lwIP is asked to free out-of-sequence TCP segments when a
+ * device runs out of buffers, as it does when PBUF_POOL is empty.
+ */
+
+#include <tinyara/config.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <netinet/in.h>
+#include <net/if.h>
+#include <ifaddrs.h>
+#include <tinyara/irq.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/mm/mempool.h>
+#include <tinyara/netmgr/netdev_mgr.h>
+#include <tinyara/net/netlog.h>
+#include "lwip/opt.h"
+#include "lwip/pbuf.h"
+#include "netdev_mgr_internal.h"
+
+#define TAG "[NETMGR]"
+
+/* Ethernet header with a VLAN tag */
+#define RXPOOL_LINK_HLEN 18
+
+/* Room for the pbuf in front of the frame */
+#define RXPOOL_HLEN LWIP_MEM_ALIGN_SIZE(sizeof(struct netdev_rxbuf))
+
+struct netdev_rxpool {
+	struct mempool_s pool;
+	struct netdev *dev;
+	void (*rx_pressure)(struct netdev *dev, int low);
+	uint16_t framesize;
+	uint16_t nfree;
+	uint16_t lowat; // buffers left at which the driver is told to slow down
+	uint8_t low;
+};
+
+struct netdev_rxbuf {
+	struct pbuf_custom pc;
+	struct netdev_rxpool *rxp; // NULL for the shared pool
+};
+
+static struct mempool_s g_rxpool_shared;
+static uint16_t g_rxpool_shared_framesize;
+
+/*
+ * Update the free buffers of 'rxp' by 'n' and return the state to report
+ * to the driver: 1 for low, 0 for recovered, -1 for no change.
+ */
+static int _rxpool_update(struct netdev_rxpool *rxp, int n)
+{
+	irqstate_t flags;
+	int report = -1;
+
+	flags = enter_critical_section();
+	rxp->nfree += n;
+	if (!rxp->low && rxp->nfree <= rxp->lowat) {
+		rxp->low = 1;
+		report = 1;
+	} else if (rxp->low && rxp->nfree >= rxp->pool.ninitial / 2) {
+		rxp->low = 0;
+		report = 0;
+	}
+	leave_critical_section(flags);
+
+	return report;
+}
+
+static void _rxpool_free(struct pbuf *p)
+{
+	struct netdev_rxbuf *rb = (struct netdev_rxbuf *)p;
+	struct netdev_rxpool *rxp = rb->rxp;
+
+	if (!rxp) {
+		mempool_free(&g_rxpool_shared, rb);
+		return;
+	}
+
+	mempool_free(&rxp->pool, rb);
+	int report = _rxpool_update(rxp, 1);
+	if (report == 0 && rxp->rx_pressure) {
+		rxp->rx_pressure(rxp->dev, 0);
+	}
+}
+
+static int _rxpool_init_shared(void)
+{
+	int res;
+
+	g_rxpool_shared_framesize = CONFIG_NET_ETH_MTU + RXPOOL_LINK_HLEN;
+	g_rxpool_shared.blocksize = RXPOOL_HLEN + g_rxpool_shared_framesize;
+	g_rxpool_shared.ninitial = 0;
+	g_rxpool_shared.nexpand = CONFIG_NET_NETDEV_RXPOOL_SHARED_EXPAND;
+	g_rxpool_shared.nmax = CONFIG_NET_NETDEV_RXPOOL_SHARED_MAX;
+	g_rxpool_shared.flags = MEMPOOL_FLAG_IRQSAFE;
+
+	res = mempool_initialize(&g_rxpool_shared, "netrx");
+	if (res < 0) {
+		NET_LOGKE(TAG, "init shared rx pool fail %d\n", res);
+		return -1;
+	}
+
+	return 0;
+}
+
+int nm_rxpool_init(struct netdev *dev, int reserve, int mtu, void (*rx_pressure)(struct netdev *dev, int low))
+{
+	static int shared_init = 0;
+	struct netdev_rxpool *rxp;
+	int res;
+
+	if (!shared_init) {
+		if (_rxpool_init_shared() < 0) {
+			return -1;
+		}
+		shared_init = 1;
+	}
+
+	if (reserve <= 0) {
+		reserve = CONFIG_NET_NETDEV_RXPOOL_RESERVE;
+	}
+
+	rxp = (struct netdev_rxpool *)kmm_zalloc(sizeof(struct netdev_rxpool));
+	if (!rxp) {
+		NET_LOGKE(TAG, "alloc rx pool fail\n");
+		return -1;
+	}
+
+	rxp->dev = dev;
+	rxp->rx_pressure = rx_pressure;
+	rxp->framesize = mtu + RXPOOL_LINK_HLEN;
+	rxp->nfree = reserve;
+	rxp->lowat = reserve / 4;
+	rxp->pool.blocksize = RXPOOL_HLEN + rxp->framesize;
+	rxp->pool.ninitial = reserve;
+	rxp->pool.flags = MEMPOOL_FLAG_IRQSAFE;
+
+	/* The pool lives as long as the device, like its name */
+	res = mempool_initialize(&rxp->pool, dev->ifname);
+	if (res < 0) {
+		NET_LOGKE(TAG, "init rx pool of %s fail %d\n", dev->ifname, res);
+		kmm_free(rxp);
+		return -1;
+	}
+
+	ND_NETOPS(dev, rxpool) = rxp;
+
+	return 0;
+}
+
+/*
+ * Return a pbuf for a received frame of 'len' bytes, NULL if the device
+ * and the shared pool are out of buffers. Frames larger than the buffers
+ * are put in PBUF_POOL.
+ */
+struct pbuf *nm_rxpool_alloc(struct netdev *dev, uint16_t len)
+{
+	struct netdev_rxpool *rxp = ND_NETOPS(dev, rxpool);
+	struct netdev_rxbuf *rb = NULL;
+	uint16_t size = 0;
+
+	if (!rxp || len > rxp->framesize) {
+		if (len > g_rxpool_shared_framesize) {
+			return pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+		}
+	} else {
+		rb = (struct netdev_rxbuf *)mempool_alloc(&rxp->pool);
+		if (rb) {
+			rb->rxp = rxp;
+			size = rxp->framesize;
+			int report = _rxpool_update(rxp, -1);
+			if (report == 1 && rxp->rx_pressure) {
+				rxp->rx_pressure(dev, 1);
+			}
+		}
+	}
+
+	if (!rb && len <= g_rxpool_shared_framesize) {
+		rb = (struct netdev_rxbuf *)mempool_alloc(&g_rxpool_shared);
+		if (rb) {
+			rb->rxp = NULL;
+			size = g_rxpool_shared_framesize;
+		}
+	}
+
+	if (!rb) {
+		pbuf_pool_exhausted();
+		return NULL;
+	}
+
+	rb->pc.custom_free_function = _rxpool_free;
+
+	/* PBUF_POOL, so that lwIP moves the payload over the headers as it
+	 * does for the other received pbufs
+	 */
+	struct pbuf *p = pbuf_alloced_custom(PBUF_RAW, len, PBUF_POOL, &rb->pc, (uint8_t *)rb + RXPOOL_HLEN, size);
+	if (!p) {
+		_rxpool_free((struct pbuf *)rb);
+	}
+
+	return p;
+}
@@ -17,20 +17,155 @@
  ****************************************************************************/
 
 #include <tinyara/config.h>
+#include <stdint.h>
+#include <string.h>
 #include <debug.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <ifaddrs.h>
+#include <tinyara/netmgr/netdev_mgr.h>
+#include <tinyara/netmgr/netstats.h>
 #include <tinyara/net/netlog.h>
+#include "lwip/opt.h"
+#include "lwip/tcp.h"
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/priv/tcpip_priv.h"
+#include "netdev_mgr_internal.h"
 #define TAG "[NETMGR]"
 
 uint32_t g_link_recv_byte = 0;
 uint32_t g_link_recv_cnt = 0;
 uint32_t g_link_recv_err = 0;
+uint32_t g_link_drop_pbuf = 0;
+uint32_t g_tcp_drop_ooseq = 0;
 
 uint32_t g_app_recv_byte = 0;
 uint32_t g_app_recv_cnt = 0;
 
+static const uint16_t g_hist_bounds[NETSTATS_NBINS - 1] = NETSTATS_HIST_BOUNDS;
+
+#if LWIP_TCP
+struct netstats_tcp_call {
+	struct tcpip_api_call_data call;
+	struct netstats *st;
+};
+
+/* It runs in the tcpip thread, or holding its lock, to walk the PCBs */
+static err_t _netstats_get_tcp(struct tcpip_api_call_data *call)
+{
+	struct netstats *st = ((struct netstats_tcp_call *)call)->st;
+	struct tcp_pcb *pcb;
+
+	st->ntcp = 0;
+	for (pcb = tcp_active_pcbs; pcb != NULL && st->ntcp < NETSTATS_MAX_TCP; pcb = pcb->next) {
+		struct netstats_tcp *t = &st->tcp[st->ntcp++];
+		t->local_ip = IP_IS_V4(&pcb->local_ip) ? ip4_addr_get_u32(ip_2_ip4(&pcb->local_ip)) : 0;
+		t->local_port = pcb->local_port;
+		t->remote_ip = IP_IS_V4(&pcb->remote_ip) ? ip4_addr_get_u32(ip_2_ip4(&pcb->remote_ip)) : 0;
+		t->remote_port = pcb->remote_port;
+		t->state = pcb->state;
+		/* sa keeps 8 times the average in ticks of the slow timer */
+		t->srtt = (uint32_t)(pcb->sa >> 3) * TCP_SLOW_INTERVAL;
+		t->rto = (uint32_t)pcb->rto * TCP_SLOW_INTERVAL;
+		t->cwnd = pcb->cwnd;
+		t->ssthresh = pcb->ssthresh;
+		t->nrtx = pcb->nrtx;
+		t->snd_queuelen = pcb->snd_queuelen;
+	}
+
+	return ERR_OK;
+}
+#endif
+
+static int _netstats_get_dev(struct netdev *dev, void *arg)
+{
+	struct netstats *st = (struct netstats *)arg;
+	struct netdev_ops *ops = (struct netdev_ops *)dev->ops;
+
+	if (st->ndev == CONFIG_NETDEV_NUM || !ops) {
+		return 0;
+	}
+	struct netstats_dev *d = &st->dev[st->ndev++];
+	strncpy(d->ifname, dev->ifname, IFNAMSIZ);
+	memcpy(d->rx, ops->hist.rx, sizeof(d->rx));
+	memcpy(d->tx, ops->hist.tx, sizeof(d->tx));
+
+	return 0;
+}
+
+static int _netstats_clear_dev(struct netdev *dev, void *arg)
+{
+	struct netdev_ops *ops = (struct netdev_ops *)dev->ops;
+
+	if (ops) {
+		memset(&ops->hist, 0, sizeof(ops->hist));
+	}
+
+	return 0;
+}
+
+void netstats_hist_add(uint32_t *hist, uint32_t len)
+{
+	int i;
+
+	for (i = 0; i < NETSTATS_NBINS - 1; i++) {
+		if (len <= g_hist_bounds[i]) {
+			break;
+		}
+	}
+	hist[i]++;
+}
+
+/* Called by lwIP through LWIP_HOOK_TCP_OOSEQ_FREE */
+void netstats_ooseq_freed(void)
+{
+	g_tcp_drop_ooseq++;
+}
+
+int netstats_get(struct netstats *st)
+{
+	memset(st, 0, sizeof(struct netstats));
+
+	st->link_recv_byte = g_link_recv_byte;
+	st->link_recv_cnt = g_link_recv_cnt;
+	st->app_recv_byte = g_app_recv_byte;
+	st->app_recv_cnt = g_app_recv_cnt;
+	st->drop_pbuf = g_link_drop_pbuf;
+	st->drop_mbox = g_link_recv_err;
+	st->drop_ooseq = g_tcp_drop_ooseq;
+
+	nm_foreach(_netstats_get_dev, st);
+
+#if LWIP_TCP
+	struct netstats_tcp_call msg;
+	msg.st = st;
+	if (tcpip_api_call(_netstats_get_tcp, &msg.call) != ERR_OK) {
+		NET_LOGKE(TAG, "get tcp stats fail\n");
+		return -1;
+	}
+#endif
+
+	return 0;
+}
+
+void netstats_clear(void)
+{
+	g_link_recv_byte = 0;
+	g_link_recv_cnt = 0;
+	g_link_recv_err = 0;
+	g_link_drop_pbuf = 0;
+	g_tcp_drop_ooseq = 0;
+	g_app_recv_byte = 0;
+	g_app_recv_cnt = 0;
+
+	nm_foreach(_netstats_clear_dev, NULL);
+}
+
 void netstats_display(void)
 {
 	NET_LOGK(TAG, "[driver] total recv %u\t%u\n", g_link_recv_byte, g_link_recv_cnt);
 	NET_LOGK(TAG, "[driver] mbox err %u\n", g_link_recv_err);
+	NET_LOGK(TAG, "[driver] pbuf err %u\n", g_link_drop_pbuf);
+	NET_LOGK(TAG, "[tcp] ooseq freed %u\n", g_tcp_drop_ooseq);
 	NET_LOGK(TAG, "[app] total recv %u\t%u\n", g_app_recv_byte, g_app_recv_cnt);
 }
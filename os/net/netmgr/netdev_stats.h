@@ -19,26 +19,40 @@
 #pragma once
 
 #ifdef CONFIG_NET_STATS
+#include <tinyara/netmgr/netstats.h>
 
 extern uint32_t g_link_recv_byte;
 extern uint32_t g_link_recv_cnt;
-extern uint32_t g_link_recv_err;
+extern uint32_t g_link_recv_err; // the mailbox of the tcpip thread is full
+extern uint32_t g_link_drop_pbuf;
+extern uint32_t g_tcp_drop_ooseq;
 
 extern uint32_t g_app_recv_byte;
 extern uint32_t g_app_recv_cnt;
 
+/* packet size histograms of a network device */
+struct netdev_hist {
+	uint32_t rx[NETSTATS_NBINS];
+	uint32_t tx[NETSTATS_NBINS];
+};
+
 #define NETMGR_STATS_ADD(x, y) \
 	do {                       \
 		x += y;                \
 	} while (0)
 
 #define NETMGR_STATS_INC(x) x++;
+
+#define NETMGR_STATS_HIST(hist, len) netstats_hist_add(hist, len)
+
+void netstats_hist_add(uint32_t *hist, uint32_t len);
 void netstats_display(void);
 
 #else
 
 #define NETMGR_STATS_ADD(x, y)
 #define NETMGR_STATS_INC(x)
+#define NETMGR_STATS_HIST(hist, len)
 
 #define netstats_display(...)
 
@@ -122,7 +122,7 @@ static void _netdev_set_ipv4addr(FAR struct netif *dev,
 	netifapi_netif_set_up(dev);
 }
 
-int _netdev_dhcpc_start(const char *intf)
+int _netdev_dhcpc_start(const char *intf, struct in_addr *addr)
 {
 	NET_LOGKV(TAG, "LWIP DHCPC started (%s)\n", intf);
 	struct netif *cnif;
@@ -144,7 +144,16 @@ int _netdev_dhcpc_start(const char *intf)
 
 	_netdev_set_ipv4addr(cnif, &l_ip, &l_netmask, &l_gw);
 
-	err_t res = netifapi_dhcp_start(cnif);
+	err_t res;
+	if (addr->s_addr != INADDR_ANY) {
+		/* verify a previous lease instead of discovering the servers */
+		ip4_addr_t lease;
+		ip4_addr_set_u32(&lease, addr->s_addr);
+		NET_LOGKV(TAG, "DHCP client requests previous lease %s\n", inet_ntoa(*addr));
+		res = netifapi_dhcp_start_reboot(cnif, (void *)&lease);
+	} else {
+		res = netifapi_dhcp_start(cnif);
+	}
 	if (res) {
 		NET_LOGKE(TAG, "DHCP client start failed %d\n", res);
 		return ERROR;
@@ -415,7 +424,7 @@ static int lwip_func_ioctl(int s, int cmd, void *arg)
 #if defined(CONFIG_NET_LWIP_DHCP)
 #if defined(CONFIG_LWIP_DHCPC)
 	case DHCPCSTART:
-		req->req_res = _netdev_dhcpc_start((const char *)req->msg.dhcp.intf);
+		req->req_res = _netdev_dhcpc_start((const char *)req->msg.dhcp.intf, &req->msg.dhcp.addr);
 		if (req->req_res != OK) {
 			NET_LOGKE(TAG, "Start DHCP clent failed %d\n", req->req_res);
 			goto errout;
@@ -20,6 +20,12 @@
 #define _NETMGR_NETSTACK_H__
 
 #include <net/if.h>
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+#include <tinyara/netmgr/zerocopy.h>
+#endif
+#ifdef CONFIG_NET_EPOLL
+#include <sys/epoll.h>
+#endif
 
 #define NETSTACK_CALL(stk, method, arg)			\
 	do {										\
@@ -89,6 +95,20 @@ struct netstack_ops {
 	int (*getstats)(void *arg);
 	void (*initlist)(struct socketlist *list);
 	void (*releaselist)(struct socketlist *list);
+	int (*recvmmsg)(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags, struct timespec *timeout);
+	int (*sendmmsg)(int s, struct mmsghdr *msgvec, unsigned int vlen, int flags);
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+	ssize_t (*recvfrom_zc)(int s, struct pbuf **p, int flags, struct sockaddr *from, socklen_t *fromlen);
+	ssize_t (*sendto_zc)(int s, const void *data, size_t size, int flags, const struct sockaddr *to, socklen_t tolen, zc_sent_t sent, void *arg);
+	void (*release_zc)(struct pbuf *p);
+#endif
+#ifdef CONFIG_NET_EPOLL
+	void *(*epoll_create)(void);
+	void (*epoll_close)(void *ep);
+	int (*epoll_ctl)(void *ep, int op, int s, struct epoll_event *ev);
+	int (*epoll_wait)(void *ep, struct epoll_event *events, int maxevents, int timeout);
+	int (*epoll_poll)(void *ep, struct pollfd *fds, bool setup);
+#endif
 };
 
 struct netstack {
@@ -41,6 +41,7 @@
 #include "lwip/ip_addr.h"
 #include "lwip/udp.h"
 #include "lwip/tcp.h"
+#include "lwip/priv/tcp_priv.h"
 #include "lwip/raw.h"
 #include "lwip/ip.h"
 #include "lwip/ip6.h"
@@ -206,7 +207,7 @@ static inline void _get_tcp_info(int fd, struct lwip_sock *lsock, netmgr_logger_
 		   _convert_tcp_state(lsock->conn->pcb.tcp->state));
 #ifdef CONFIG_NET_IPv6
 	if (lsock->conn->type & NETCONN_TYPE_IPV6) {
-		netlogger_debug_msg(logger, IPV6_ADDR_FORMAT "\t%d\t" IPV6_ADDR_FORMAT "\t%d\n",
+		netlogger_debug_msg(logger, IPV6_ADDR_FORMAT "\t%d\t" IPV6_ADDR_FORMAT "\t%d\t",
 			   IP6_ADDR_BLOCK1(ip_2_ip6(&addr)),
 			   IP6_ADDR_BLOCK2(ip_2_ip6(&addr)),
 			   IP6_ADDR_BLOCK3(ip_2_ip6(&addr)),
@@ -228,7 +229,7 @@ static inline void _get_tcp_info(int fd, struct lwip_sock *lsock, netmgr_logger_
 	} else
 #endif
 	{
-		netlogger_debug_msg(logger, IPV4_ADDR_FORMAT "\t%d\t" IPV4_ADDR_FORMAT "\t%d\n",
+		netlogger_debug_msg(logger, IPV4_ADDR_FORMAT "\t%d\t" IPV4_ADDR_FORMAT "\t%d\t",
 			   ip4_addr1(ip_2_ip4(&addr)),
 			   ip4_addr2(ip_2_ip4(&addr)),
 			   ip4_addr3(ip_2_ip4(&addr)),
@@ -240,6 +241,13 @@ static inline void _get_tcp_info(int fd, struct lwip_sock *lsock, netmgr_logger_
 			   ip4_addr4(ip_2_ip4(&raddr)),
 			   rport);
 	}
+
+	/* sa keeps 8 times the smoothed RTT, both it and rto are in ticks of the slow timer */
+	struct tcp_pcb *tpcb = lsock->conn->pcb.tcp;
+	netlogger_debug_msg(logger, "%d\t%d\t%u\t%u\t%d\n",
+		   (tpcb->sa >> 3) * TCP_SLOW_INTERVAL,
+		   tpcb->rto * TCP_SLOW_INTERVAL,
+		   (unsigned int)tpcb->cwnd, (unsigned int)tpcb->ssthresh, tpcb->nrtx);
 }
 
 static void _get_udp_info(int fd, struct lwip_sock *lsock, netmgr_logger_p logger)
@@ -647,6 +655,60 @@ static ssize_t lwip_ns_sendmsg(int sockfd, struct msghdr *msg, int flags)
 	return sendto(sockfd, buf, len, flags, to, (socklen_t)*addrlen);
 }
 
+static int lwip_ns_recvmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen, int flags, struct timespec *timeout)
+{
+	return lwip_recvmmsg(sockfd, msgvec, vlen, flags, timeout);
+}
+
+static int lwip_ns_sendmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+	return lwip_sendmmsg(sockfd, msgvec, vlen, flags);
+}
+
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+static ssize_t lwip_ns_recvfrom_zc(int s, struct pbuf **p, int flags, struct sockaddr *from, socklen_t *fromlen)
+{
+	return lwip_recvfrom_pbuf(s, p, flags, from, fromlen);
+}
+
+static ssize_t lwip_ns_sendto_zc(int s, const void *data, size_t size, int flags, const struct sockaddr *to, socklen_t tolen, zc_sent_t sent, void *arg)
+{
+	return lwip_sendto_ref(s, data, size, flags, to, tolen, sent, arg);
+}
+
+static void lwip_ns_release_zc(struct pbuf *p)
+{
+	pbuf_free(p);
+}
+#endif
+
+#ifdef CONFIG_NET_EPOLL
+static void *lwip_ns_epoll_create(void)
+{
+	return lwip_epoll_create();
+}
+
+static void lwip_ns_epoll_close(void *ep)
+{
+	lwip_epoll_close((struct lwip_epoll *)ep);
+}
+
+static int lwip_ns_epoll_ctl(void *ep, int op, int s, struct epoll_event *ev)
+{
+	return lwip_epoll_ctl((struct lwip_epoll *)ep, op, s, ev);
+}
+
+static int lwip_ns_epoll_wait(void *ep, struct epoll_event *events, int maxevents, int timeout)
+{
+	return lwip_epoll_wait((struct lwip_epoll *)ep, events, maxevents, timeout);
+}
+
+static int lwip_ns_epoll_poll(void *ep, struct pollfd *fds, bool setup)
+{
+	return lwip_epoll_poll((struct lwip_epoll *)ep, fds, setup);
+}
+#endif
+
 static int lwip_ns_init(void *data)
 {
 	lwip_init();
@@ -801,7 +863,22 @@ struct netstack_ops g_lwip_stack_ops = {
 #endif
 	lwip_ns_getstats,
 	lwip_ns_initlist,
-	lwip_ns_releaselist};
+	lwip_ns_releaselist,
+	lwip_ns_recvmmsg,
+	lwip_ns_sendmmsg,
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+	lwip_ns_recvfrom_zc,
+	lwip_ns_sendto_zc,
+	lwip_ns_release_zc,
+#endif
+#ifdef CONFIG_NET_EPOLL
+	lwip_ns_epoll_create,
+	lwip_ns_epoll_close,
+	lwip_ns_epoll_ctl,
+	lwip_ns_epoll_wait,
+	lwip_ns_epoll_poll,
+#endif
+};
 
 struct netstack g_lwip_stack = {&g_lwip_stack_ops, NULL};
 
@@ -15,6 +15,11 @@
  * language governing permissions and limitations under the License.
  *
  ****************************************************************************/
+/*
+ * Operations of the AF_UNIX stack. The stack itself, net/local, is not
+ * part of this tree and NET_LOCAL has no Kconfig entry, so this table is
+ * only built by ports which provide it. get_netstack() never returns it.
+ */
 #include <tinyara/config.h>
 #include <sys/socket.h>
 #include <sys/types.h>
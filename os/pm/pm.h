@@ -138,6 +138,16 @@ struct pm_global_s {
 
 	/* Indicates Board is Ready to State Change */
 	bool is_running;
+
+#ifdef CONFIG_PM_QOS
+	/* QoS constraints of each domain: the tolerated wakeup latency in
+	 * microseconds (PM_QOS_LATENCY_NONE if none), and the needed part of
+	 * the full CPU frequency in percent (0 if none).
+	 */
+
+	uint32_t qos_latency[CONFIG_PM_NDOMAINS];
+	uint8_t qos_throughput[CONFIG_PM_NDOMAINS];
+#endif
 };
 
 /****************************************************************************
@@ -260,6 +270,89 @@ int pm_changestate(enum pm_state_e newstate);
 void pm_wakehandler(clock_t missing_tick, pm_wakeup_reason_code_t wakeup_src);
 #endif
 
+#ifdef CONFIG_PM_QOS
+/****************************************************************************
+ * Name: pm_qos_latency
+ *
+ * Description:
+ *   This function is called inside pm_checkstate to get the smallest wakeup
+ *   latency tolerated by the domains.
+ *
+ * Input parameters:
+ *   None
+ *
+ * Returned value:
+ *   The latency in microseconds, or PM_QOS_LATENCY_NONE.
+ *
+ ****************************************************************************/
+
+uint32_t pm_qos_latency(void);
+#endif
+
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+/* Statistics of the load governor of DVFS */
+
+struct pm_dvfs_stats_s {
+	int level;									/* Current frequency scaling level */
+	uint32_t transitions;						/* Number of level changes */
+	uint16_t requests[PM_DVFS_NLEVELS];			/* Number of requests to stay at each level or faster */
+	uint32_t level_ticks[PM_DVFS_NLEVELS];		/* Time (in ticks) spent at each level */
+};
+
+/****************************************************************************
+ * Name: pm_dvfs_get_stats
+ *
+ * Description:
+ *   This function is called by the PM procfs to read the statistics of the
+ *   load governor of DVFS.
+ *
+ * Input parameters:
+ *   stats - the location to return the statistics.
+ *
+ * Returned value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pm_dvfs_get_stats(FAR struct pm_dvfs_stats_s *stats);
+#endif
+
+#ifdef CONFIG_PM_IDLE_GOVERNOR
+/****************************************************************************
+ * Name: pm_governor_update
+ *
+ * Description:
+ *   This function is called inside pm_wakehandler to learn the interval
+ *   between the wakeups by each source.
+ *
+ * Input parameters:
+ *   wakeup_src - the wakeup reason code.
+ *
+ * Returned value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pm_governor_update(pm_wakeup_reason_code_t wakeup_src);
+
+/****************************************************************************
+ * Name: pm_governor_predict
+ *
+ * Description:
+ *   This function is called inside pm_idle to predict the time until the
+ *   next wakeup by an interrupt.
+ *
+ * Input parameters:
+ *   None
+ *
+ * Returned value:
+ *   The predicted idle time in ticks, or 0 if there is no prediction.
+ *
+ ****************************************************************************/
+
+clock_t pm_governor_predict(void);
+#endif
+
 #ifdef CONFIG_PM_METRICS
 /****************************************************************************
  * Name: pm_metrics_update_domain
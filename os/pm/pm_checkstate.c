@@ -120,6 +120,12 @@ enum pm_state_e pm_checkstate(void)
 				break;
 			}
 		}
+#ifdef CONFIG_PM_QOS
+		/* A domain does not tolerate the time to wake up from sleep */
+		if (newstate == PM_SLEEP && pm_qos_latency() < CONFIG_PM_SLEEP_EXIT_LATENCY_US) {
+			newstate = PM_STANDBY;
+		}
+#endif
 	}
 
 	leave_critical_section(flags);
@@ -57,9 +57,15 @@
 #include <tinyara/config.h>
 #include <stdint.h>
 #include <assert.h>
+#include <debug.h>
 #include <tinyara/pm/pm.h>
+#include <tinyara/irq.h>
+#include <tinyara/arch.h>
 
 #include "pm.h"
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+#include "../kernel/sched/sched.h"
+#endif
 
 #ifdef CONFIG_PM_DVFS
 
@@ -67,6 +73,19 @@
  * Private Data
  ****************************************************************************/
 
+struct pm_dvfs_s {
+	uint8_t level;									/* Current frequency scaling level */
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+	uint16_t window;								/* Ticks sampled in the current window */
+	uint16_t busy[CONFIG_SMP_NCPUS];				/* Ticks each CPU was not idle in the window */
+	uint16_t requests[PM_DVFS_NLEVELS];				/* Number of requests to stay at each level or faster */
+	uint32_t level_ticks[PM_DVFS_NLEVELS];			/* Time (in ticks) spent at each level */
+	uint32_t transitions;							/* Number of level changes */
+#endif
+};
+
+static struct pm_dvfs_s g_pm_dvfs;
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -95,7 +114,7 @@
 
 void pm_dvfs(int div_lvl)
 {
-	DEBUGASSERT(div_lvl >= 0 && div_lvl <= 3);
+	DEBUGASSERT(div_lvl >= 0 && div_lvl <= PM_DVFS_MAX_LEVEL);
 	/* Only affects active mode power consumption
 	 * 0 -> 1.2GHz
 	 * 1 -> 600MHz
@@ -104,7 +123,178 @@ void pm_dvfs(int div_lvl)
 	 */
 	/* Placed in os/arch/arm/src/amebasmart/amebasmart_pmc.c, can be invoked directly */
 	up_set_dvfs(div_lvl);
+	g_pm_dvfs.level = div_lvl;
 	return;
 }
 
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+/****************************************************************************
+ * Name: pm_dvfs_limit
+ *
+ * Description:
+ *   Return the slowest level allowed by the requests of pm_dvfs_request().
+ *
+ ****************************************************************************/
+
+static int pm_dvfs_limit(void)
+{
+	int div_lvl;
+
+	for (div_lvl = 0; div_lvl < PM_DVFS_MAX_LEVEL; div_lvl++) {
+		if (g_pm_dvfs.requests[div_lvl] > 0) {
+			break;
+		}
+	}
+	return div_lvl;
+}
+
+/****************************************************************************
+ * Name: pm_dvfs_apply
+ ****************************************************************************/
+
+static void pm_dvfs_apply(int div_lvl)
+{
+	int limit = pm_dvfs_limit();
+
+	if (div_lvl > limit) {
+		div_lvl = limit;
+	}
+	if (div_lvl != g_pm_dvfs.level) {
+		pmllvdbg("dvfs level %d -> %d\n", g_pm_dvfs.level, div_lvl);
+		pm_dvfs(div_lvl);
+		g_pm_dvfs.transitions++;
+	}
+}
+
+/****************************************************************************
+ * Name: pm_dvfs_process_load
+ *
+ * Description:
+ *   This function is called by sched_process_cpuload on each tick. It counts
+ *   the ticks each CPU was busy, and at the end of every
+ *   CONFIG_PM_DVFS_SAMPLE_TICKS ticks picks the level from the load of the
+ *   busiest CPU: the full frequency at once above
+ *   CONFIG_PM_DVFS_UP_THRESHOLD percent, one level slower below
+ *   CONFIG_PM_DVFS_DOWN_THRESHOLD percent. A running task with a priority of
+ *   CONFIG_PM_DVFS_BOOST_PRIORITY or more gets the full frequency on the
+ *   tick it is seen.
+ *
+ * Assumptions:
+ *   Called from the timer interrupt with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void pm_dvfs_process_load(void)
+{
+	FAR struct tcb_s *rtcb;
+	int cpu;
+	int load;
+	int div_lvl;
+	bool boost = false;
+
+	g_pm_dvfs.level_ticks[g_pm_dvfs.level]++;
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		rtcb = current_task(cpu);
+		/* The IDLE task of each CPU has the CPU index as pid */
+		if (rtcb->pid != cpu) {
+			g_pm_dvfs.busy[cpu]++;
+			if (rtcb->sched_priority >= CONFIG_PM_DVFS_BOOST_PRIORITY) {
+				boost = true;
+			}
+		}
+	}
+
+	if (boost && g_pm_dvfs.level != 0) {
+		pm_dvfs_apply(0);
+	}
+
+	if (++g_pm_dvfs.window < CONFIG_PM_DVFS_SAMPLE_TICKS) {
+		return;
+	}
+
+	load = 0;
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		if (g_pm_dvfs.busy[cpu] > load) {
+			load = g_pm_dvfs.busy[cpu];
+		}
+		g_pm_dvfs.busy[cpu] = 0;
+	}
+	load = load * 100 / g_pm_dvfs.window;
+	g_pm_dvfs.window = 0;
+
+	div_lvl = g_pm_dvfs.level;
+	if (load >= CONFIG_PM_DVFS_UP_THRESHOLD) {
+		div_lvl = 0;
+	} else if (load < CONFIG_PM_DVFS_DOWN_THRESHOLD && div_lvl < PM_DVFS_MAX_LEVEL) {
+		div_lvl++;
+	}
+	pm_dvfs_apply(div_lvl);
+}
+
+/****************************************************************************
+ * Name: pm_dvfs_request
+ *
+ * Description:
+ *   Keep the level at div_lvl or faster until pm_dvfs_release(div_lvl).
+ *   A slower level is left at once.
+ *
+ ****************************************************************************/
+
+void pm_dvfs_request(int div_lvl)
+{
+	irqstate_t flags;
+
+	DEBUGASSERT(div_lvl >= 0 && div_lvl <= PM_DVFS_MAX_LEVEL);
+	flags = enter_critical_section();
+	g_pm_dvfs.requests[div_lvl]++;
+	pm_dvfs_apply(g_pm_dvfs.level);
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: pm_dvfs_release
+ *
+ * Description:
+ *   Release a request of pm_dvfs_request(div_lvl). The governor lowers the
+ *   frequency again when the load allows it.
+ *
+ ****************************************************************************/
+
+void pm_dvfs_release(int div_lvl)
+{
+	irqstate_t flags;
+
+	DEBUGASSERT(div_lvl >= 0 && div_lvl <= PM_DVFS_MAX_LEVEL);
+	flags = enter_critical_section();
+	if (g_pm_dvfs.requests[div_lvl] > 0) {
+		g_pm_dvfs.requests[div_lvl]--;
+	}
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: pm_dvfs_get_stats
+ *
+ * Description:
+ *   Copy the current level, the requests and the time spent at each level.
+ *
+ ****************************************************************************/
+
+void pm_dvfs_get_stats(FAR struct pm_dvfs_stats_s *stats)
+{
+	irqstate_t flags;
+	int div_lvl;
+
+	flags = enter_critical_section();
+	stats->level = g_pm_dvfs.level;
+	stats->transitions = g_pm_dvfs.transitions;
+	for (div_lvl = 0; div_lvl < PM_DVFS_NLEVELS; div_lvl++) {
+		stats->requests[div_lvl] = g_pm_dvfs.requests[div_lvl];
+		stats->level_ticks[div_lvl] = g_pm_dvfs.level_ticks[div_lvl];
+	}
+	leave_critical_section(flags);
+}
+#endif /* CONFIG_PM_DVFS_GOVERNOR */
+
 #endif /* CONFIG_PM_DVFS */
@@ -0,0 +1,147 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <debug.h>
+#include <tinyara/clock.h>
+
+#include "pm.h"
+
+#ifdef CONFIG_PM_IDLE_GOVERNOR
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The mean interval of a source moves by 1/2^PM_GOVERNOR_SHIFT of the
+ * difference with each new interval.
+ */
+
+#define PM_GOVERNOR_SHIFT 2
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The wakeup history of the board. The hardware timer is not kept, as
+ * the next timer wakeup is known from the watchdog list.
+ */
+
+struct pm_wakehistory_s {
+	clock_t last[PM_WAKEUP_SRC_COUNT];		/* Time stamp of the last wakeup by the source */
+	clock_t interval[PM_WAKEUP_SRC_COUNT];	/* Mean interval between its wakeups, 0 if not known yet */
+};
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+static struct pm_wakehistory_s g_pm_wakehistory;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pm_governor_update
+ *
+ * Description:
+ *   This function is called inside pm_wakehandler, after the missed ticks
+ *   were corrected. It updates the mean interval between the wakeups by
+ *   the source.
+ *
+ * Input parameters:
+ *   wakeup_src - the wakeup reason code.
+ *
+ * Returned value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pm_governor_update(pm_wakeup_reason_code_t wakeup_src)
+{
+	struct pm_wakehistory_s *history = &g_pm_wakehistory;
+	clock_t now;
+	clock_t sample;
+
+	if (wakeup_src == PM_WAKEUP_HW_TIMER || wakeup_src >= PM_WAKEUP_SRC_COUNT) {
+		return;
+	}
+
+	now = clock_systimer();
+	if (history->last[wakeup_src] != 0) {
+		sample = now - history->last[wakeup_src];
+		if (history->interval[wakeup_src] == 0) {
+			history->interval[wakeup_src] = sample;
+		} else if (sample > history->interval[wakeup_src]) {
+			history->interval[wakeup_src] += (sample - history->interval[wakeup_src]) >> PM_GOVERNOR_SHIFT;
+		} else {
+			history->interval[wakeup_src] -= (history->interval[wakeup_src] - sample) >> PM_GOVERNOR_SHIFT;
+		}
+	}
+	history->last[wakeup_src] = now;
+}
+
+/****************************************************************************
+ * Name: pm_governor_predict
+ *
+ * Description:
+ *   This function is called inside pm_idle. It predicts the time until the
+ *   next wakeup by an interrupt, from the mean interval of each source. A
+ *   source which is already later than its mean interval is not counted.
+ *
+ * Input parameters:
+ *   None
+ *
+ * Returned value:
+ *   The predicted idle time in ticks, or 0 if there is no prediction.
+ *
+ ****************************************************************************/
+
+clock_t pm_governor_predict(void)
+{
+	struct pm_wakehistory_s *history = &g_pm_wakehistory;
+	clock_t now;
+	clock_t elapsed;
+	clock_t remain;
+	clock_t predict = 0;
+	int index;
+
+	now = clock_systimer();
+	for (index = 0; index < PM_WAKEUP_SRC_COUNT; index++) {
+		if (history->interval[index] == 0) {
+			continue;
+		}
+		elapsed = now - history->last[index];
+		if (elapsed >= history->interval[index]) {
+			continue;
+		}
+		remain = history->interval[index] - elapsed;
+		if (predict == 0 || remain < predict) {
+			predict = remain;
+		}
+	}
+
+	return predict;
+}
+
+#endif /* CONFIG_PM_IDLE_GOVERNOR */
@@ -77,6 +77,9 @@ void pm_idle(void)
 #ifdef CONFIG_PM_TIMEDWAKEUP
 	clock_t delay = 0;
 #endif
+#ifdef CONFIG_PM_IDLE_GOVERNOR
+	clock_t predict;
+#endif
 #ifdef CONFIG_SMP
 	int cpu;
 	int gated_cpu_count = 0;
@@ -104,11 +107,21 @@ void pm_idle(void)
 		/* get wakeup timer */
 		if (newstate == PM_SLEEP) {
 			delay = wd_getwakeupdelay();
-			if ((delay > 0) && (delay < MSEC2TICK(CONFIG_PM_SLEEP_ENTRY_WAIT_MS))) {
+			if ((delay > 0) && (delay < MSEC2TICK(CONFIG_PM_SLEEP_ENTRY_WAIT_MS) + USEC2TICK(CONFIG_PM_SLEEP_EXIT_LATENCY_US))) {
 				pmvdbg("Wdog Timer Delay: %ldms is less than SLEEP_ENTRY_WAIT: %ldms\n", TICK2MSEC(delay), CONFIG_PM_SLEEP_ENTRY_WAIT_MS);
 				goto EXIT;
 			}
 		}
+#endif
+#ifdef CONFIG_PM_IDLE_GOVERNOR
+		/* An interrupt is expected before sleep pays off, stay in STANDBY */
+		if (newstate == PM_SLEEP) {
+			predict = pm_governor_predict();
+			if ((predict > 0) && (predict < MSEC2TICK(CONFIG_PM_SLEEP_ENTRY_WAIT_MS) + USEC2TICK(CONFIG_PM_SLEEP_EXIT_LATENCY_US))) {
+				pmvdbg("Predicted idle: %ldms is less than SLEEP_ENTRY_WAIT + EXIT_LATENCY\n", TICK2MSEC(predict));
+				newstate = PM_STANDBY;
+			}
+		}
 #endif
 		/* Perform state-dependent logic here */
 		/* For SMP case, we need to check secondary core status
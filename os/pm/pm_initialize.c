@@ -123,8 +123,19 @@ void pm_start(void) {
 
 void pm_initialize(void)
 {
+#ifdef CONFIG_PM_QOS
+	int index;
+#endif
+
 	sem_init(&g_pmglobals.regsem, 0, 1);
 
+#ifdef CONFIG_PM_QOS
+	/* No domain has a latency constraint yet */
+	for (index = 0; index < CONFIG_PM_NDOMAINS; index++) {
+		g_pmglobals.qos_latency[index] = PM_QOS_LATENCY_NONE;
+	}
+#endif
+
 	/* Register Special Domains, which are specific to Kernel*/
 	DEBUGASSERT(pm_domain_register("IDLE") == PM_IDLE_DOMAIN);
 	DEBUGASSERT(pm_domain_register("SCREEN") == PM_LCD_DOMAIN);
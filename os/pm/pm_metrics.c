@@ -35,6 +35,7 @@ typedef struct pm_metric_domain_s pm_metric_domain_t;
 struct pm_metric_state_s {
 	clock_t stime;						  /* Last PM change state time stamp */
 	uint32_t state_accum_ticks[PM_COUNT]; /* PM State Time (in ticks)*/
+	uint32_t state_counts[PM_COUNT];	  /* Number of times PM was in the state */
 };
 
 typedef struct pm_metric_state_s pm_metric_state_t;
@@ -43,6 +44,8 @@ struct pm_metric_s {
 	pm_metric_domain_t domain_metrics;				 /* The domain metrics */
 	pm_metric_state_t state_metrics;				 /* The power management state metrics */
 	uint32_t board_sleep_ticks;						 /* The amount of time (in ticks) board was in sleep */
+	uint32_t board_sleep_counts;					 /* Number of times board was in sleep */
+	uint32_t short_sleep_counts;					 /* Number of sleeps shorter than the sleep entry wait */
 	uint32_t wakeup_src_counts[PM_WAKEUP_SRC_COUNT]; /* It counts the frequency of wakeup sources */
 	uint32_t total_try_ticks;						 /* Total duration of time pm tries to make board sleep */
 };
@@ -52,6 +55,11 @@ typedef struct pm_metric_s pm_metric_t;
 static pm_metric_t *g_pm_metrics;
 static bool g_pm_metrics_running = false;
 
+static int pm_residency(uint32_t ticks, uint32_t counts)
+{
+	return counts ? TICK2MSEC(ticks / counts) : 0;
+}
+
 static void pm_print_metrics(double total_time, int n_domains)
 {
 	int index;
@@ -83,15 +91,22 @@ static void pm_print_metrics(double total_time, int n_domains)
 	}
 	pmdbg("\n");
 	pmdbg("\n");
-	pmdbg(" BOARD STATE | PM STATE |          TIME          \n");
-	pmdbg("-------------|----------|------------------------\n");
+	pmdbg(" BOARD STATE | PM STATE |          TIME          | COUNTS | AVG RESIDENCY [5] \n");
+	pmdbg("-------------|----------|------------------------|--------|-------------------\n");
 	for (pm_state = PM_NORMAL; pm_state < PM_SLEEP; pm_state++) {
-		pmdbg(" %11s | %8s | %10dms (%6.2f%%) \n", ((pm_state == PM_NORMAL) ? "WAKEUP" : ""), pm_state_name[pm_state], TICK2MSEC(g_pm_metrics->state_metrics.state_accum_ticks[pm_state]),
-			((double)g_pm_metrics->state_metrics.state_accum_ticks[pm_state]) * 100.0 / total_time);
+		pmdbg(" %11s | %8s | %10dms (%6.2f%%) | %6d | %15dms \n", ((pm_state == PM_NORMAL) ? "WAKEUP" : ""), pm_state_name[pm_state], TICK2MSEC(g_pm_metrics->state_metrics.state_accum_ticks[pm_state]),
+			((double)g_pm_metrics->state_metrics.state_accum_ticks[pm_state]) * 100.0 / total_time, g_pm_metrics->state_metrics.state_counts[pm_state],
+			pm_residency(g_pm_metrics->state_metrics.state_accum_ticks[pm_state], g_pm_metrics->state_metrics.state_counts[pm_state]));
 	}
-	pmdbg("-------------|----------|------------------------\n");
-	pmdbg(" %11s | %8s | %10dms (%6.2f%%) \n", "SLEEP", pm_state_name[PM_SLEEP], TICK2MSEC(g_pm_metrics->board_sleep_ticks),
-		  ((double)g_pm_metrics->board_sleep_ticks) * 100.0 / total_time);
+	pmdbg("-------------|----------|------------------------|--------|-------------------\n");
+	pmdbg(" %11s | %8s | %10dms (%6.2f%%) | %6d | %15dms \n", "SLEEP", pm_state_name[PM_SLEEP], TICK2MSEC(g_pm_metrics->board_sleep_ticks),
+		  ((double)g_pm_metrics->board_sleep_ticks) * 100.0 / total_time, g_pm_metrics->board_sleep_counts,
+		  pm_residency(g_pm_metrics->board_sleep_ticks, g_pm_metrics->board_sleep_counts));
+	pmdbg("\n");
+	pmdbg("*[5] = average time of a stay in the state.\n");
+#ifdef CONFIG_PM_TIMEDWAKEUP
+	pmdbg("SLEEPS SHORTER THAN SLEEP ENTRY WAIT (%dms) = %d\n", CONFIG_PM_SLEEP_ENTRY_WAIT_MS, g_pm_metrics->short_sleep_counts);
+#endif
 }
 /************************************************************************************
  * Public Functions
@@ -194,7 +209,7 @@ void pm_metrics_update_idle(void)
  *
  * Description:
  *   This function is called inside pm_changestate. Before changing state, it counts
- *   amount of time (in ticks) was in that state.
+ *   amount of time (in ticks) was in that state and the number of stays in it.
  *
  * Input parameters:
  *   None
@@ -209,6 +224,7 @@ void pm_metrics_update_changestate(void)
 	if (g_pm_metrics_running) {
 		now = clock_systimer();
 		g_pm_metrics->state_metrics.state_accum_ticks[g_pmglobals.state] += now - g_pm_metrics->state_metrics.stime;
+		g_pm_metrics->state_metrics.state_counts[g_pmglobals.state]++;
 		g_pm_metrics->state_metrics.stime = now;
 	}
 }
@@ -219,7 +235,7 @@ void pm_metrics_update_changestate(void)
  * Description:
  *   This function is called inside pm_wakehandler. It counts the frequency of wakeup
  *   sources, which are waking up the board. It also checks the amount of time board
- *   was in sleep.
+ *   was in sleep and how many times, short sleeps are counted apart.
  *
  * Input parameters:
  *   missing_tick - the amount of time the board was in sleep.
@@ -234,6 +250,12 @@ void pm_metrics_update_wakehandler(clock_t missing_tick, pm_wakeup_reason_code_t
 	if (g_pm_metrics_running) {
 		g_pm_metrics->wakeup_src_counts[wakeup_src]++;
 		g_pm_metrics->board_sleep_ticks += missing_tick;
+		g_pm_metrics->board_sleep_counts++;
+#ifdef CONFIG_PM_TIMEDWAKEUP
+		if (missing_tick < MSEC2TICK(CONFIG_PM_SLEEP_ENTRY_WAIT_MS)) {
+			g_pm_metrics->short_sleep_counts++;
+		}
+#endif
 	}
 }
 
@@ -323,6 +345,7 @@ int pm_metrics(int milliseconds)
 	}
 	n_domains = index;
 	g_pm_metrics->state_metrics.state_accum_ticks[g_pmglobals.state] += end_time - g_pm_metrics->state_metrics.stime;
+	g_pm_metrics->state_metrics.state_counts[g_pmglobals.state]++;
 	leave_critical_section(flags);
 	/* Show PM Metrics Results */
 	pm_print_metrics((double)(end_time - start_time), n_domains);
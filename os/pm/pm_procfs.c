@@ -135,6 +135,13 @@ static int power_stat(const char *relpath, FAR struct stat *buf);
 #define POWER_DOMAINS "domains"
 #define POWER_STATE   "state"
 #define POWER_INFO    "info"
+#define POWER_DVFS    "dvfs"
+
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+#define POWER_NENTRIES 3
+#else
+#define POWER_NENTRIES 2
+#endif
 
 /*
  * Level 1 : /proc/power
@@ -182,6 +189,14 @@ static void power_read_domain_info(int domain_id, void (*readprint)(const char *
 	readprint("%-15s : %d\n", "Domain ID", domain_id);
 	readprint("%-15s : %s\n", "Domain Name", pm_domain_map[domain_id]);
 	readprint("%-15s : %d\n", "Suspend Count", g_pmglobals.suspend_count[domain_id]);
+#ifdef CONFIG_PM_QOS
+	if (g_pmglobals.qos_latency[domain_id] != PM_QOS_LATENCY_NONE) {
+		readprint("%-15s : %uus\n", "QoS Latency", g_pmglobals.qos_latency[domain_id]);
+	}
+	if (g_pmglobals.qos_throughput[domain_id] != 0) {
+		readprint("%-15s : %d%%\n", "QoS Throughput", g_pmglobals.qos_throughput[domain_id]);
+	}
+#endif
 }
 
 static void power_read_domains(void (*readprint)(const char *, ...))
@@ -201,6 +216,22 @@ static void power_read_state(void (*readprint)(const char *, ...))
 		readprint("%s %s\n", (pm_state == g_pmglobals.state) ? "*" : " ", pm_state_name[pm_state]);
 	}
 }
+
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+static void power_read_dvfs(void (*readprint)(const char *, ...))
+{
+	struct pm_dvfs_stats_s stats;
+	int div_lvl;
+
+	pm_dvfs_get_stats(&stats);
+	readprint("   LEVEL |      TIME      | REQUESTS \n");
+	readprint("---------|----------------|----------\n");
+	for (div_lvl = 0; div_lvl < PM_DVFS_NLEVELS; div_lvl++) {
+		readprint(" %s %6d | %12ums | %8d \n", (div_lvl == stats.level) ? "*" : " ", div_lvl, TICK2MSEC(stats.level_ticks[div_lvl]), stats.requests[div_lvl]);
+	}
+	readprint("%-15s : %u\n", "Transitions", stats.transitions);
+}
+#endif
 /****************************************************************************
  * Name: power_find_dirref
  *
@@ -237,7 +268,7 @@ static int power_find_dirref(FAR const char *relpath, FAR struct power_dir_s *di
 		if (str[0] == '\0') {
 			dir->base.level = POWER_LEVEL_1;
 			dir->base.index = 0;
-			dir->base.nentries = 2;
+			dir->base.nentries = POWER_NENTRIES;
 			dir->dtype = DTYPE_DIRECTORY;
 			return OK;
 		}
@@ -279,6 +310,15 @@ static int power_find_dirref(FAR const char *relpath, FAR struct power_dir_s *di
 			dir->base.nentries = 0;
 			dir->dtype = DTYPE_FILE;
 			return OK;
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+		/* Check relpath has "dvfs" mount point, told apart from "state" by its index */
+		} else if (checkStart(POWER_DVFS, false) == OK) {
+			dir->base.level = POWER_LEVEL_2;
+			dir->base.index = 1;
+			dir->base.nentries = 0;
+			dir->dtype = DTYPE_FILE;
+			return OK;
+#endif
 		}
 	}
 	fdbg("Invalid Path : Failed to find path %s \n", relpath);
@@ -392,6 +432,11 @@ static ssize_t power_read(FAR struct file *filep, FAR char *buffer, size_t bufle
 	/* Read the content of "power/state" */
 	} else if ((priv->dir.base.level == POWER_LEVEL_2) && (priv->dir.base.index == 0)) {
 		power_read_state(readprint);
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+	/* Read the content of "power/dvfs" */
+	} else if ((priv->dir.base.level == POWER_LEVEL_2) && (priv->dir.base.index == 1)) {
+		power_read_dvfs(readprint);
+#endif
 	}
 	/* Indicate we have already provided all the data */
 	filep->f_pos += totalsize;
@@ -559,6 +604,13 @@ static int power_readdir(struct fs_dirent_s *dir)
 			snprintf(dir->fd_dir.d_name, sizeof(dir->fd_dir.d_name), POWER_STATE);
 			powerdir->base.index++;
 			break;
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+		case 2:
+			dir->fd_dir.d_type = DTYPE_FILE;
+			snprintf(dir->fd_dir.d_name, sizeof(dir->fd_dir.d_name), POWER_DVFS);
+			powerdir->base.index++;
+			break;
+#endif
 		}
 		break;
 	/* List the content of "domains" directory */
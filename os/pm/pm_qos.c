@@ -0,0 +1,161 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <errno.h>
+
+#include <tinyara/pm/pm.h>
+#include <tinyara/irq.h>
+
+#include "pm.h"
+
+#ifdef CONFIG_PM_QOS
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+/****************************************************************************
+ * Name: pm_qos_dvfs_level
+ *
+ * Description:
+ *   Return the slowest DVFS level which still gives the percent of the full
+ *   frequency. Level n divides the clock by n + 1.
+ *
+ ****************************************************************************/
+
+static int pm_qos_dvfs_level(int percent)
+{
+	int div_lvl = 100 / percent - 1;
+
+	return div_lvl > PM_DVFS_MAX_LEVEL ? PM_DVFS_MAX_LEVEL : div_lvl;
+}
+#endif
+
+/****************************************************************************
+ * Name: pm_qos_set
+ ****************************************************************************/
+
+static int pm_qos_set(int domain_id, enum pm_qos_type_e type, uint32_t value)
+{
+	irqstate_t flags;
+	int ret;
+
+	flags = enter_critical_section();
+	ret = pm_check_domain(domain_id);
+	if (ret != OK) {
+		goto errout;
+	}
+
+	switch (type) {
+	case PM_QOS_LATENCY:
+		g_pmglobals.qos_latency[domain_id] = value;
+		break;
+	case PM_QOS_THROUGHPUT:
+#ifdef CONFIG_PM_DVFS_GOVERNOR
+		/* The throughput is kept as a request on the DVFS governor */
+		if (value != 0) {
+			pm_dvfs_request(pm_qos_dvfs_level(value));
+		}
+		if (g_pmglobals.qos_throughput[domain_id] != 0) {
+			pm_dvfs_release(pm_qos_dvfs_level(g_pmglobals.qos_throughput[domain_id]));
+		}
+#endif
+		g_pmglobals.qos_throughput[domain_id] = value;
+		break;
+	default:
+		ret = ERROR;
+		set_errno(EINVAL);
+		break;
+	}
+
+errout:
+	leave_critical_section(flags);
+	return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pm_qos_request
+ *
+ * Description:
+ *   Set the constraint of the domain, replacing the previous one of this
+ *   type. See include/tinyara/pm/pm.h.
+ *
+ ****************************************************************************/
+
+int pm_qos_request(int domain_id, enum pm_qos_type_e type, uint32_t value)
+{
+	if ((type == PM_QOS_LATENCY && value == PM_QOS_LATENCY_NONE) || (type == PM_QOS_THROUGHPUT && (value == 0 || value > 100))) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	return pm_qos_set(domain_id, type, value);
+}
+
+/****************************************************************************
+ * Name: pm_qos_release
+ *
+ * Description:
+ *   Remove the constraint of this type from the domain.
+ *
+ ****************************************************************************/
+
+int pm_qos_release(int domain_id, enum pm_qos_type_e type)
+{
+	return pm_qos_set(domain_id, type, type == PM_QOS_LATENCY ? PM_QOS_LATENCY_NONE : 0);
+}
+
+/****************************************************************************
+ * Name: pm_qos_latency
+ *
+ * Description:
+ *   Return the smallest wakeup latency tolerated by the domains, in
+ *   microseconds, or PM_QOS_LATENCY_NONE.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+uint32_t pm_qos_latency(void)
+{
+	uint32_t latency = PM_QOS_LATENCY_NONE;
+	int index;
+
+	for (index = 0; index < CONFIG_PM_NDOMAINS; index++) {
+		if (g_pmglobals.qos_latency[index] < latency) {
+			latency = g_pmglobals.qos_latency[index];
+		}
+	}
+
+	return latency;
+}
+
+#endif /* CONFIG_PM_QOS */
@@ -76,6 +76,10 @@ void pm_wakehandler(clock_t missing_tick, pm_wakeup_reason_code_t wakeup_src)
 		 */
 		wd_timer_nohz(missing_tick);
 	}
+#endif
+#ifdef CONFIG_PM_IDLE_GOVERNOR
+	/* Learn from the wakeup once the ticks were corrected */
+	pm_governor_update(wakeup_src);
 #endif
 	/* After wakeup change PM State to STANDBY and reset the time slice */
 	pm_changestate(PM_STANDBY);
@@ -0,0 +1,127 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * syscall/syscall_batch.c
+ *
+ * The kernel side of syscall_batch().  Each system call of the batch goes
+ * through g_stublookup[] as the SVCall dispatcher would send it, so the
+ * calls see their arguments as if they had trapped one by one.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <syscall.h>
+
+#include <tinyara/syscall_batch.h>
+
+#if defined(CONFIG_LIB_SYSCALL_BATCH) && defined(__KERNEL__)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The stubs take between zero and six parameters after the number.  Extra
+ * arguments are harmless with the ARM calling convention, which is how the
+ * SVCall dispatcher calls them too.
+ */
+
+typedef uintptr_t (*syscall_stub_t)(int nbr, uintptr_t parm1, uintptr_t parm2,
+									uintptr_t parm3, uintptr_t parm4,
+									uintptr_t parm5, uintptr_t parm6);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* The calls which do not return to the batch, or which must not run
+ * inside another system call.
+ */
+
+static bool syscall_batch_refused(unsigned int nbr)
+{
+	switch (nbr) {
+	case SYS__exit:
+	case SYS_exit:
+	case SYS_up_assert:
+#ifdef SYS_vfork
+	case SYS_vfork:
+#endif
+#ifdef SYS_pthread_exit
+	case SYS_pthread_exit:
+#endif
+	case SYS_syscall_batch:
+		return true;
+	default:
+		return nbr < CONFIG_SYS_RESERVED || nbr >= SYS_maxsyscall;
+	}
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syscall_batch
+ *
+ * Description:
+ *   See include/tinyara/syscall_batch.h
+ *
+ ****************************************************************************/
+
+int syscall_batch(FAR struct syscall_op_s *ops, unsigned int nops, int flags)
+{
+	FAR struct syscall_op_s *op;
+	syscall_stub_t stub;
+	unsigned int i;
+
+	if (ops == NULL && nops > 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	for (i = 0; i < nops; i++) {
+		op = &ops[i];
+
+		if (syscall_batch_refused(op->nbr)) {
+			op->result = (uintptr_t)ERROR;
+			op->errcode = ENOSYS;
+		} else {
+			stub = (syscall_stub_t)g_stublookup[op->nbr - CONFIG_SYS_RESERVED];
+			op->result = stub((int)op->nbr, op->parm[0], op->parm[1], op->parm[2],
+							  op->parm[3], op->parm[4], op->parm[5]);
+			op->errcode = (int)op->result == ERROR ? get_errno() : 0;
+		}
+
+		if (op->errcode != 0 && (flags & SYSCALL_BATCH_STOP) != 0) {
+			return i + 1;
+		}
+	}
+
+	return nops;
+}
+
+#endif /* CONFIG_LIB_SYSCALL_BATCH && __KERNEL__ */
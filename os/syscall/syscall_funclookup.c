@@ -103,6 +103,7 @@
 
 #include <tinyara/errno.h>
 #include <tinyara/clock.h>
+#include <tinyara/syscall_batch.h>
 
 /****************************************************************************
  * Pre-processor Definitions
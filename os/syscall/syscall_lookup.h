@@ -230,7 +230,7 @@ SYSCALL_LOOKUP(lseek,                   3, STUB_lseek)
 #if defined(CONFIG_PIPES)
 SYSCALL_LOOKUP(mkfifo,                  2, STUB_mkfifo)
 #endif
-SYSCALL_LOOKUP(mmap,                    6, NULL)
+SYSCALL_LOOKUP(mmap,                    6, STUB_mmap)
 SYSCALL_LOOKUP(open,                    6, STUB_open)
 SYSCALL_LOOKUP(opendir,                 1, STUB_opendir)
 #if defined(CONFIG_PIPES)
@@ -350,6 +350,17 @@ SYSCALL_LOOKUP(sendto,                  6, STUB_sendto)
 SYSCALL_LOOKUP(setsockopt,              5, STUB_setsockopt)
 SYSCALL_LOOKUP(shutdown,                2, STUB_shutdown)
 SYSCALL_LOOKUP(socket,                  3, STUB_socket)
+SYSCALL_LOOKUP(recvmmsg,                5, STUB_recvmmsg)
+SYSCALL_LOOKUP(sendmmsg,                4, STUB_sendmmsg)
+#endif
+
+/* The following are defined only if epoll() is supported */
+
+#ifdef CONFIG_NET_EPOLL
+SYSCALL_LOOKUP(epoll_create,            1, STUB_epoll_create)
+SYSCALL_LOOKUP(epoll_create1,           1, STUB_epoll_create1)
+SYSCALL_LOOKUP(epoll_ctl,               4, STUB_epoll_ctl)
+SYSCALL_LOOKUP(epoll_wait,              4, STUB_epoll_wait)
 #endif
 
 /* The following is defined only if CONFIG_TASK_NAME_SIZE > 0 */
@@ -360,6 +371,10 @@ SYSCALL_LOOKUP(prctl,                   5, STUB_prctl)
 
 SYSCALL_LOOKUP(fin_wait,		0, STUB_fin_wait)
 
+#ifdef CONFIG_LIB_SYSCALL_BATCH
+SYSCALL_LOOKUP(syscall_batch,           3, STUB_syscall_batch)
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -35,6 +35,7 @@
 #elif CONFIG_COMPRESSION_TYPE == MINIZ
 #include "miniz/miniz.h"
 #endif
+#include <tinyara/lz4/lz4.h>
 
 /****************************************************************************
  * Private Functions
@@ -42,6 +43,7 @@
 static void show_usage(const char *progname)
 {
 	fprintf(stderr, "USAGE: %s <block size> <compression format> <uncompressed file name> <compressed file name>\n", progname);
+	fprintf(stderr, "  compression format: %d for CONFIG_COMPRESSION_TYPE, or %d for LZ4\n", CONFIG_COMPRESSION_TYPE, COMPRESSION_TYPE_LZ4);
 	exit(COMP_USAGE_ERROR);
 }
 
@@ -60,6 +62,7 @@ static void compress_file(int block_size, int type, char *in_file, char *out_fil
 	unsigned long int writesize = block_size;
 	unsigned char *read_buf = NULL;
 	unsigned char *out_buf = NULL;
+	void *lz4_state = NULL;
 	unsigned char *tptr;
 	struct s_header *phdr = NULL;
 #if CONFIG_COMPRESSION_TYPE == LZMA
@@ -90,19 +93,29 @@ static void compress_file(int block_size, int type, char *in_file, char *out_fil
 		goto error;
 	}
 
+	if (type == COMPRESSION_TYPE_LZ4) {
+		/* LZ4 is built in whatever CONFIG_COMPRESSION_TYPE is */
+		out_buf = (unsigned char *)malloc(LZ4_COMPRESSBOUND(block_size));
+		lz4_state = malloc(LZ4_STATE_SIZE);
+		if (!out_buf || !lz4_state) {
+			printf("Failed to allocate memory for out_buf\n");
+			goto error;
+		}
+	} else {
 #if CONFIG_COMPRESSION_TYPE == LZMA
-	out_buf = (unsigned char *)malloc(block_size + LZMA_PROPS_SIZE);
-	if (!out_buf) {
-		printf("Failed to allocate memory for out_buf\n");
-		goto error;
-	}
+		out_buf = (unsigned char *)malloc(block_size + LZMA_PROPS_SIZE);
+		if (!out_buf) {
+			printf("Failed to allocate memory for out_buf\n");
+			goto error;
+		}
 #elif CONFIG_COMPRESSION_TYPE == MINIZ
-	out_buf = (unsigned char *)malloc(compressBound(block_size));
-	if (!out_buf) {
-		printf("Failed to allocate memory for out_buf\n");
-		goto error;
-	}
+		out_buf = (unsigned char *)malloc(compressBound(block_size));
+		if (!out_buf) {
+			printf("Failed to allocate memory for out_buf\n");
+			goto error;
+		}
 #endif
+	}
 
 	sections = buf.st_size / block_size;
 	if (buf.st_size % block_size) {
@@ -157,6 +170,16 @@ static void compress_file(int block_size, int type, char *in_file, char *out_fil
 				tptr += nbytes;
 			}
 		}
+		if (type == COMPRESSION_TYPE_LZ4) {
+			/* LZ4 Compression for data in read_buf into out_buf */
+			ret = lz4_compress_block(read_buf, (block_size - readsize), out_buf, LZ4_COMPRESSBOUND(block_size), lz4_state);
+			if (ret < 0) {
+				printf("LZ4 Compress failed, ret = %d\n", ret);
+				goto error;
+			}
+			writesize = ret;
+			printf("==> lz4_compress %d writesize %lu\n", index, writesize);
+		} else {
 #if CONFIG_COMPRESSION_TYPE == LZMA
 		/* LZMA Compression for data in read_buf into out_buf */
 		writesize = block_size;
@@ -181,6 +204,7 @@ static void compress_file(int block_size, int type, char *in_file, char *out_fil
 		printf("Set CONFIG_COMPRESSION_TYPE to %d, then generate mkcompressimg again for this type", CONFIG_COMPRESSION_TYPE);
 		exit(COMP_NOT_SUPPORTED);
 #endif
+		}
 		phdr->secoff[index + 1] = phdr->secoff[index] + writesize;
 
 		/* Write out_buf to output file */
@@ -243,6 +267,9 @@ error:
 	if (out_buf) {
 		free(out_buf);
 	}
+	if (lz4_state) {
+		free(lz4_state);
+	}
 	if (in_fd > 0) {
 		close(in_fd);
 	}
@@ -271,7 +298,7 @@ int main(int argc, char *argv[])	//Main defined
 
 	comp_format = atoi(argv[2]);
 
-	if (comp_format <= COMPRESSION_TYPE_NONE || comp_format > COMPRESSION_TYPE_MAX) {
+	if (comp_format != CONFIG_COMPRESSION_TYPE && comp_format != COMPRESSION_TYPE_LZ4) {
 		fprintf(stderr, "Compression Mode %d not supported\n", comp_format);
 		exit(COMP_NOT_SUPPORTED);
 	}
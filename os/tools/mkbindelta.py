@@ -0,0 +1,222 @@
+#!/usr/bin/env python
+###########################################################################
+#
+# Copyright 2025 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+
+# Makes the patch of a delta update (CONFIG_BINMGR_DELTA_UPDATE) from the
+# binary running on the device to a new one.  Both are images as written to
+# the partitions, with their binary header.
+#
+# The patch is in the format read by binary_manager_patch_write() in
+# framework/src/binary_manager/binary_manager_patch.c.  Parts of the new
+# binary found in the old one are stored as the difference of their bytes,
+# which is mostly zeros when code moved, and the rest as it is.
+#
+# usage: mkbindelta.py old.bin new.bin patch.bin
+#        mkbindelta.py --apply old.bin patch.bin new.bin
+
+from __future__ import print_function
+import optparse
+import struct
+import sys
+import zlib
+
+MAGIC = b"BMDF"
+VERSION = 1
+BLOCK = 8           # Bytes of a match looked up in the old binary
+SLACK = 32          # Mismatches more than matches which end a match
+MIN_ZEROS = 4       # Shorter runs of zeros stay in the diff literals
+
+
+def crc32(data):
+    return zlib.crc32(data) & 0xffffffff
+
+
+def put_varint(out, value):
+    while value >= 0x80:
+        out.append((value & 0x7f) | 0x80)
+        value >>= 7
+    out.append(value)
+
+
+def get_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7f) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def zigzag(value):
+    return (value << 1) if value >= 0 else ((-value << 1) - 1)
+
+
+def extend(old, new, opos, npos, step, limit):
+    """Returns the length of the approximate match of old and new from
+    opos and npos, going forward or backward by step"""
+    score = best = length = k = 0
+    while k < limit:
+        o = opos + k * step
+        n = npos + k * step
+        if o < 0 or o >= len(old) or n < 0 or n >= len(new):
+            break
+        score += 1 if old[o] == new[n] else -1
+        k += 1
+        if score > best:
+            best = score
+            length = k
+        elif score < best - SLACK:
+            break
+    return length
+
+
+def put_diff(out, old, new, opos, npos, length):
+    diff = bytearray((new[npos + i] - old[opos + i]) & 0xff for i in range(length))
+    i = 0
+    while i < length:
+        zeros = i
+        while zeros < length and diff[zeros] == 0:
+            zeros += 1
+        # Literals run up to the next MIN_ZEROS zeros or to the end
+        end = zeros
+        while end < length:
+            if diff[end] != 0:
+                end += 1
+                continue
+            run = end
+            while run < length and diff[run] == 0 and run - end < MIN_ZEROS:
+                run += 1
+            if run - end >= MIN_ZEROS or run == length:
+                break
+            end = run
+        put_varint(out, zeros - i)
+        put_varint(out, end - zeros)
+        out += diff[zeros:end]
+        i = end
+
+
+def make_patch(old, new):
+    index = {}
+    for i in range(len(old) - BLOCK, -1, -1):
+        index[bytes(old[i:i + BLOCK])] = i
+
+    out = bytearray(MAGIC + struct.pack("<B3xIIII", VERSION, len(old), crc32(old), len(new), crc32(new)))
+
+    # Record in progress: its diff is new[dstart:dend] against old[ostart:],
+    # and its extra runs from dend to the next match
+    ostart = dstart = dend = 0
+    offset = 0
+    i = 0
+    while i + BLOCK <= len(new):
+        key = bytes(new[i:i + BLOCK])
+        opos = i + offset
+        if not (0 <= opos <= len(old) - BLOCK and old[opos:opos + BLOCK] == key):
+            opos = index.get(key)
+            if opos is None:
+                i += 1
+                continue
+        length = extend(old, new, opos, i, 1, len(new))
+        back = extend(old, new, opos - 1, i - 1, -1, i - dend)
+        opos -= back
+        npos = i - back
+
+        # The previous record ends where this match starts
+        put_varint(out, dend - dstart)
+        put_varint(out, npos - dend)
+        put_varint(out, zigzag(opos - (ostart + dend - dstart)))
+        put_diff(out, old, new, ostart, dstart, dend - dstart)
+        out += new[dend:npos]
+
+        ostart = opos
+        dstart = npos
+        dend = i = npos + back + length
+        offset = opos - npos
+
+    put_varint(out, dend - dstart)
+    put_varint(out, len(new) - dend)
+    put_varint(out, 0)
+    put_diff(out, old, new, ostart, dstart, dend - dstart)
+    out += new[dend:]
+    return out
+
+
+def apply_patch(old, patch):
+    """Applies a patch as the device does, to check it"""
+    version, old_size, old_crc, new_size, new_crc = struct.unpack("<B3xIIII", patch[4:24])
+    if patch[:4] != MAGIC or version != VERSION:
+        raise ValueError("not a binary patch")
+    if old_size != len(old) or old_crc != crc32(old):
+        raise ValueError("patch is not made from this binary")
+    new = bytearray()
+    pos = 24
+    opos = 0
+    while len(new) < new_size:
+        dlen, pos = get_varint(patch, pos)
+        elen, pos = get_varint(patch, pos)
+        seek, pos = get_varint(patch, pos)
+        while dlen > 0:
+            zeros, pos = get_varint(patch, pos)
+            new += old[opos:opos + zeros]
+            opos += zeros
+            nlit, pos = get_varint(patch, pos)
+            new += bytearray((old[opos + k] + patch[pos + k]) & 0xff for k in range(nlit))
+            opos += nlit
+            pos += nlit
+            dlen -= zeros + nlit
+        new += patch[pos:pos + elen]
+        pos += elen
+        opos += (seek >> 1) ^ -(seek & 1)
+    if len(new) != new_size or crc32(new) != new_crc:
+        raise ValueError("CRC of the new binary does not match")
+    return new
+
+
+def main():
+    parser = optparse.OptionParser(usage="%prog old.bin new.bin patch.bin\n       %prog --apply old.bin patch.bin new.bin")
+    parser.add_option("--apply", action="store_true", default=False, help="apply a patch instead of making it")
+    options, args = parser.parse_args()
+    if len(args) != 3:
+        parser.print_help()
+        return 1
+
+    with open(args[0], "rb") as f:
+        old = bytearray(f.read())
+    with open(args[1], "rb") as f:
+        data = bytearray(f.read())
+
+    if options.apply:
+        out = apply_patch(old, data)
+    else:
+        out = make_patch(old, data)
+        # Never write a patch which does not give the new binary
+        if apply_patch(old, out) != data:
+            print("patch does not give %s" % args[1], file=sys.stderr)
+            return 1
+
+    with open(args[2], "wb") as f:
+        f.write(out)
+    if not options.apply:
+        print("%s: %d bytes, %d%% of %s" % (args[2], len(out), len(out) * 100 // max(len(data), 1), args[1]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
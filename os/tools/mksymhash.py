@@ -0,0 +1,154 @@
+#!/usr/bin/env python
+###########################################################################
+#
+# Copyright 2025 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+
+# Adds the .symhash section (CONFIG_ELF_PREBUILT_SYMHASH) to the ELF of the
+# common binary: its exported symbols hashed in buckets in the style of a
+# GNU hash section, read by elf_loadsymhash() in os/binfmt/libelf/libelf_symhash.c.
+# Run it on the common binary ELF after it is linked, before it is
+# stripped and given its binary header.  Symbols refer to sections by index:
+# stripping removes only sections after the loaded ones, which keeps them.
+#
+# The names are not kept in the section, so two exported names with the
+# same hash are an error.
+#
+# usage: mksymhash.py [--objcopy objcopy] [-o section.bin] common.elf
+
+from __future__ import print_function
+import optparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+SECTNAME = ".symhash"
+MAGIC = 0x484d5953      # "SYMH"
+
+SHT_SYMTAB = 2
+SHN_UNDEF = 0
+SHN_ABS = 0xfff1
+SHN_COMMON = 0xfff2
+STB_GLOBAL = 1
+STB_WEAK = 2
+
+
+def symhash(name):
+    h = 5381
+    for c in bytearray(name):
+        h = (h * 33 + c) & 0xffffffff
+    return h
+
+
+def read_exports(path):
+    """Returns (name, value, shndx) of the global symbols defined by an
+    ELF32 little-endian file"""
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF" or bytearray(elf)[4] != 1 or bytearray(elf)[5] != 1:
+        raise ValueError("%s is not a little-endian ELF32 file" % path)
+
+    shoff, = struct.unpack_from("<I", elf, 32)
+    shentsize, shnum = struct.unpack_from("<HH", elf, 46)
+    shdrs = [struct.unpack_from("<IIIIIIIIII", elf, shoff + i * shentsize) for i in range(shnum)]
+
+    exports = []
+    for shdr in shdrs:
+        if shdr[1] != SHT_SYMTAB:
+            continue
+        strtab = shdrs[shdr[6]]
+        for off in range(shdr[4], shdr[4] + shdr[5], 16):
+            st_name, st_value, st_size, st_info, st_other, st_shndx = struct.unpack_from("<IIIBBH", elf, off)
+            if (st_info >> 4) not in (STB_GLOBAL, STB_WEAK) or st_shndx in (SHN_UNDEF, SHN_COMMON):
+                continue
+            if st_shndx == SHN_ABS and st_value == 0:
+                continue
+            start = strtab[4] + st_name
+            name = elf[start:elf.index(b"\0", start)]
+            exports.append((name, st_value, st_shndx))
+    return exports
+
+
+def make_section(exports):
+    names = {}
+    for name, value, shndx in exports:
+        h = symhash(name)
+        if h in names and names[h] != name:
+            raise ValueError("%s and %s have the same hash" % (names[h].decode(), name.decode()))
+        names[h] = name
+
+    # A weak symbol may be defined twice, the first one is kept
+    seen = set()
+    syms = []
+    for name, value, shndx in exports:
+        if name not in seen:
+            seen.add(name)
+            syms.append((symhash(name), value, shndx))
+
+    nbuckets = max(1, len(syms) // 2)
+    syms.sort(key=lambda s: s[0] % nbuckets)
+
+    # The symbols of bucket b are from buckets[b] to buckets[b + 1]
+    buckets = [0] * (nbuckets + 1)
+    for h, value, shndx in syms:
+        buckets[h % nbuckets + 1] += 1
+    for b in range(nbuckets):
+        buckets[b + 1] += buckets[b]
+
+    out = bytearray(struct.pack("<III", MAGIC, nbuckets, len(syms)))
+    out += struct.pack("<%dI" % (nbuckets + 1), *buckets)
+    out += struct.pack("<%dI" % len(syms), *[s[0] for s in syms])
+    out += struct.pack("<%dI" % len(syms), *[s[1] for s in syms])
+    out += struct.pack("<%dH" % len(syms), *[s[2] for s in syms])
+    if len(out) % 4:
+        out += b"\0" * (4 - len(out) % 4)
+    return out
+
+
+def main():
+    parser = optparse.OptionParser(usage="%prog [options] common.elf")
+    parser.add_option("--objcopy", dest="objcopy", default="arm-none-eabi-objcopy", help="objcopy of the toolchain")
+    parser.add_option("-o", dest="output", help="write the section to a file instead of adding it to the ELF")
+    options, args = parser.parse_args()
+    if len(args) != 1:
+        parser.print_help()
+        return 1
+
+    try:
+        section = make_section(read_exports(args[0]))
+    except ValueError as e:
+        print("mksymhash.py: %s" % e, file=sys.stderr)
+        return 1
+
+    if options.output:
+        with open(options.output, "wb") as f:
+            f.write(section)
+    else:
+        fd, tmp = tempfile.mkstemp()
+        try:
+            os.write(fd, section)
+            os.close(fd)
+            subprocess.check_call([options.objcopy, "--remove-section", SECTNAME, "--add-section", "%s=%s" % (SECTNAME, tmp), args[0]])
+        finally:
+            os.remove(tmp)
+    print("%s: %s of %d bytes" % (args[0], SECTNAME, len(section)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,149 @@
+#!/usr/bin/env python
+############################################################################
+#
+# Copyright 2025 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+############################################################################
+#
+# Generates the operator resolver of the AI Framework for TFLM from the
+# .tflite models a product ships, so that only their operators get
+# registered and linked:
+#
+#   mktflmresolver.py <tfmicro dir> <output header> <model.tflite>...
+#
+# The operators are read from the operator_codes of each model, and matched
+# with the Add<Op>() methods of MicroMutableOpResolver of <tfmicro dir>.
+
+from __future__ import print_function
+import os
+import re
+import sys
+import struct
+
+RESOLVER_HEADER = 'tensorflow/lite/micro/micro_mutable_op_resolver.h'
+SCHEMA_HEADER = 'tensorflow/lite/schema/schema_generated.h'
+
+# Fields of the Model and OperatorCode tables of the tflite schema
+MODEL_OPERATOR_CODES = 1
+OPCODE_DEPRECATED_BUILTIN_CODE = 0
+OPCODE_CUSTOM_CODE = 1
+OPCODE_BUILTIN_CODE = 3
+
+def read_file(path, mode='r'):
+    with open(path, mode) as f:
+        return f.read()
+
+def get_builtin_codes(tfmicro_dir):
+    # BuiltinOperator_FULLY_CONNECTED = 9, ...
+    schema = read_file(os.path.join(tfmicro_dir, SCHEMA_HEADER))
+    codes = {}
+    for name, value in re.findall(r'\bBuiltinOperator_(\w+) = (-?\d+)', schema):
+        if name not in ('MIN', 'MAX'):
+            codes[int(value)] = name
+    return codes
+
+def get_add_methods(tfmicro_dir):
+    # TfLiteStatus AddFullyConnected(...) { return AddBuiltin(BuiltinOperator_FULLY_CONNECTED, ...
+    resolver = read_file(os.path.join(tfmicro_dir, RESOLVER_HEADER))
+    methods = {}
+    for method, name in re.findall(r'TfLiteStatus (Add\w+)\([^{]*\{\s*return AddBuiltin\(\s*BuiltinOperator_(\w+)', resolver):
+        methods[name] = method
+    return methods
+
+class Table:
+    def __init__(self, buf, pos):
+        self.buf = buf
+        self.pos = pos
+        vtable = pos - struct.unpack_from('<i', buf, pos)[0]
+        self.vtable = vtable
+        self.vtable_size = struct.unpack_from('<H', buf, vtable)[0]
+
+    def field(self, index):
+        offset = 4 + 2 * index
+        if offset >= self.vtable_size:
+            return 0
+        field = struct.unpack_from('<H', self.buf, self.vtable + offset)[0]
+        return self.pos + field if field else 0
+
+    def scalar(self, index, fmt, default=0):
+        pos = self.field(index)
+        return struct.unpack_from(fmt, self.buf, pos)[0] if pos else default
+
+    def indirect(self, index):
+        pos = self.field(index)
+        return pos + struct.unpack_from('<I', self.buf, pos)[0] if pos else 0
+
+    def tables(self, index):
+        vector = self.indirect(index)
+        if not vector:
+            return []
+        count = struct.unpack_from('<I', self.buf, vector)[0]
+        result = []
+        for i in range(count):
+            element = vector + 4 + 4 * i
+            result.append(Table(self.buf, element + struct.unpack_from('<I', self.buf, element)[0]))
+        return result
+
+def get_model_ops(path, codes):
+    buf = read_file(path, 'rb')
+    if len(buf) < 8 or buf[4:8] != b'TFL3':
+        sys.exit('%s is not a tflite model' % path)
+
+    model = Table(buf, struct.unpack_from('<I', buf, 0)[0])
+    ops = set()
+    for opcode in model.tables(MODEL_OPERATOR_CODES):
+        # Old models only have the deprecated 8 bit code, new ones both
+        code = max(opcode.scalar(OPCODE_DEPRECATED_BUILTIN_CODE, '<b'), opcode.scalar(OPCODE_BUILTIN_CODE, '<i'))
+        name = codes.get(code)
+        if name is None:
+            sys.exit('%s uses an unknown builtin operator %d' % (path, code))
+        if name == 'CUSTOM':
+            sys.exit('%s uses a custom operator, which has to be registered by the application' % path)
+        ops.add(name)
+    return ops
+
+def main():
+    if len(sys.argv) < 4:
+        sys.exit('Usage: %s <tfmicro dir> <output header> <model.tflite>...' % sys.argv[0])
+
+    tfmicro_dir = sys.argv[1]
+    output = sys.argv[2]
+    codes = get_builtin_codes(tfmicro_dir)
+    methods = get_add_methods(tfmicro_dir)
+
+    ops = set()
+    for model in sys.argv[3:]:
+        ops |= get_model_ops(model, codes)
+
+    lines = []
+    for op in sorted(ops):
+        if op not in methods:
+            sys.exit('Operator %s is not supported by TFLM' % op)
+        lines.append('\t\t(resolver).%s(); \\\n' % methods[op])
+
+    header = '/* Generated by mktflmresolver.py from %s, do not edit */\n\n' % ' '.join(os.path.basename(m) for m in sys.argv[3:])
+    header += '#define AIFW_TFLM_OP_COUNT %d\n\n' % max(len(ops), 1)
+    header += '#define AIFW_TFLM_ADD_OPS(resolver) \\\n\tdo { \\\n'
+    header += ''.join(lines)
+    header += '\t} while (0)\n'
+
+    # Keep the header untouched if nothing changed, not to rebuild TFLM.cpp
+    if os.path.exists(output) and read_file(output) == header:
+        return
+    with open(output, 'w') as f:
+        f.write(header)
+
+if __name__ == '__main__':
+    main()
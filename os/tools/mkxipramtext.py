@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+###########################################################################
+#
+# Copyright 2025 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+
+# Writes the input sections of .ramtext for an XIP app
+# (CONFIG_XIP_ELF_RAMTEXT) from a profile of the app.
+#
+# The profile has lines of "<count> <function>", e.g. samples of a profiler.
+# Functions are taken hottest first while their size, read from the app ELF
+# built with -ffunction-sections, fits in the budget.  The output is included
+# in the .ramtext output section of the app linker script:
+#
+#   .ramtext : {
+#       _sramtext = . ;
+#       INCLUDE app1_ramtext.ld
+#       _eramtext = . ;
+#   } > usram AT > uflash
+#   _sramtext_flash = LOADADDR(.ramtext);
+#
+# usage: mkxipramtext.py [-b budget] [--nm nm] profile app.elf app_ramtext.ld
+
+from __future__ import print_function
+import optparse
+import subprocess
+import sys
+
+
+def read_profile(path):
+    counts = {}
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) < 2 or line.startswith("#"):
+                continue
+            try:
+                count = float(fields[0])
+            except ValueError:
+                continue
+            counts[fields[1]] = counts.get(fields[1], 0) + count
+    return sorted(counts.items(), key=lambda c: -c[1])
+
+
+def read_sizes(nm, elf):
+    """Returns the size of each function of the ELF"""
+    sizes = {}
+    out = subprocess.check_output([nm, "-S", "--defined-only", elf]).decode()
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[2] in ("T", "t"):
+            sizes[fields[3]] = int(fields[1], 16)
+    return sizes
+
+
+def main():
+    parser = optparse.OptionParser(usage="%prog [options] profile app.elf app_ramtext.ld")
+    parser.add_option("-b", "--budget", dest="budget", type="int", default=4096,
+                      help="bytes of RAM for the functions, default 4096")
+    parser.add_option("--nm", dest="nm", default="arm-none-eabi-nm", help="nm of the toolchain")
+    options, args = parser.parse_args()
+    if len(args) != 3:
+        parser.print_help()
+        return 1
+
+    sizes = read_sizes(options.nm, args[1])
+    used = 0
+    chosen = []
+    for name, count in read_profile(args[0]):
+        if name not in sizes:
+            print("%s: not a function of %s, skipped" % (name, args[1]), file=sys.stderr)
+            continue
+        # Thumb functions are aligned on 4 bytes in the section
+        size = (sizes[name] + 3) & ~3
+        if used + size > options.budget:
+            continue
+        used += size
+        chosen.append(name)
+
+    with open(args[2], "w") as f:
+        f.write("/* Auto-generated by mkxipramtext.py, %d bytes */\n" % used)
+        for name in chosen:
+            f.write("*(.text.%s)\n" % name)
+    print("%s: %d functions, %d of %d bytes" % (args[2], len(chosen), used, options.budget))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
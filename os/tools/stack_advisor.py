@@ -0,0 +1,150 @@
+#!/usr/bin/env python
+###########################################################################
+#
+# Copyright 2025 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+#
+# Proposes the stack sizes of the threads from their high-water marks, as
+# read from /proc/stackwm or merged by the stack monitor into
+# CONFIG_STACKMONITOR_WATERMARK_FILE on the devices:
+#
+#      STACK     PEAK    COUNT NAME
+#       4076      876       12 tash
+#
+# The highest peak of each name over all the files, plus the margin, is
+# rounded up to the alignment.
+#
+#Example: stack_advisor.py -c .config -m 25 dev1_stackwm.txt dev2_stackwm.txt
+
+from __future__ import print_function
+from optparse import OptionParser
+import sys
+import re
+
+# Thread name -> config of its stack size.  The names are matched by
+# prefix, as the kernel truncates them to CONFIG_TASK_NAME_SIZE.
+STACK_CONFIGS = [
+    ("logm", "CONFIG_LOGM_TASK_STACKSIZE"),
+    ("hpwork", "CONFIG_SCHED_HPWORKSTACKSIZE"),
+    ("lpwork", "CONFIG_SCHED_LPWORKSTACKSIZE"),
+    ("AppBringUp", "CONFIG_BOARD_INITTHREAD_STACKSIZE"),
+    ("StackMonitor", "CONFIG_STACKMONITOR_STACKSIZE"),
+    ("PlayerWorker", "CONFIG_MEDIA_PLAYER_STACKSIZE"),
+    ("PlayerObserverWorker", "CONFIG_MEDIA_PLAYER_OBSERVER_STACKSIZE"),
+    ("RecorderWorker", "CONFIG_MEDIA_RECORDER_STACKSIZE"),
+    ("RecorderObserverWorker", "CONFIG_MEDIA_RECORDER_OBSERVER_STACKSIZE"),
+    ("FocusManagerWorker", "CONFIG_FOCUS_MANAGER_STACKSIZE"),
+    ("HttpSourceDownloader", "CONFIG_HTTPSOURCE_DOWNLOAD_STACKSIZE"),
+    ("AudioMixer", "CONFIG_AUDIO_MIXER_STACKSIZE"),
+    ("InputHandler", "CONFIG_INPUT_DATASOURCE_STACKSIZE"),
+    ("OutputHandler", "CONFIG_OUTPUT_DATASOURCE_STACKSIZE"),
+    ("SpeechDetectorWorker", "CONFIG_SPEECH_DETECTOR_STACKSIZE"),
+    ("SpeechDetectorListenerWorker", "CONFIG_SPEECH_DETECTOR_LISTENER_STACKSIZE"),
+]
+
+# Thread name -> source file, for the stack sizes which are not configs
+STACK_SOURCES = [
+    ("tash", "apps/shell/tash_main.c TASH_TASK_STACKSIZE"),
+    ("taskmonitor", "os/kernel/init/os_bringup.c"),
+    ("eventloop", "framework/src/eventloop/eventloop_task.c EVENTLOOP_STACK_SIZE"),
+    ("wifi msg handler", "framework/src/wifi_manager/wifi_manager_msghandler.c"),
+    ("wifi link stats", "framework/src/wifi_manager/wifi_manager_linkstats.c"),
+]
+
+parser = OptionParser(usage="usage: %prog [options] STACKWM_FILE...")
+parser.add_option("-c", "--config", dest="config",
+                  help=".config of the build, for the current sizes", metavar="CONFIG_FILE")
+parser.add_option("-m", "--margin", type="int", dest="margin", default=25,
+                  help="Margin over the peak, in percent. Default is 25.")
+parser.add_option("-a", "--align", type="int", dest="align", default=256,
+                  help="Alignment of the proposed sizes. Default is 256.")
+parser.add_option("-o", "--output", dest="output",
+                  help="Output written to this file. Default is stdout.", metavar="OUTPUT_FILE")
+
+(options, args) = parser.parse_args()
+if not args or options.align <= 0 or options.margin < 0:
+    parser.print_help()
+    sys.exit(1)
+
+if options.output:
+    sys.stdout = open(options.output, 'w')
+
+
+def lookup(table, name):
+    # The longest entry of which the name is a prefix, or the reverse
+    best = None
+    for key, value in table:
+        if key.startswith(name) or name.startswith(key):
+            if best is None or len(key) > len(best[0]):
+                best = (key, value)
+    return best[1] if best else None
+
+
+# name -> [stacksize, peak, count, devices]
+marks = {}
+mark_re = re.compile(r'^\s*(\d+)\s+(\d+)\s+(\d+)\s+(.+?)\s*$')
+for filename in args:
+    with open(filename, 'r') as infile:
+        for line in infile:
+            m = mark_re.match(line)
+            if not m:
+                continue
+            stacksize, peak, count = int(m.group(1)), int(m.group(2)), int(m.group(3))
+            name = m.group(4)
+            if name not in marks:
+                marks[name] = [0, 0, 0, 0]
+            mark = marks[name]
+            mark[0] = max(mark[0], stacksize)
+            mark[1] = max(mark[1], peak)
+            mark[2] += count
+            mark[3] += 1
+
+configs = {}
+if options.config:
+    config_re = re.compile(r'^(CONFIG_\w+)=(\d+)\s*$')
+    with open(options.config, 'r') as infile:
+        for line in infile:
+            m = config_re.match(line)
+            if m:
+                configs[m.group(1)] = int(m.group(2))
+
+print("Margin %d%%, aligned to %d bytes, from %d file(s)\n" % (options.margin, options.align, len(args)))
+print("%-24s %8s %8s %8s %8s  %s" % ("NAME", "STACK", "PEAK", "PROPOSED", "DELTA", "WHERE"))
+
+total = 0
+for name in sorted(marks):
+    stacksize, peak, count, devices = marks[name]
+    proposed = (peak * (100 + options.margin) + 99) // 100
+    proposed = (proposed + options.align - 1) // options.align * options.align
+
+    config = lookup(STACK_CONFIGS, name)
+    if config:
+        where = config
+        current = configs.get(config, stacksize)
+    else:
+        where = lookup(STACK_SOURCES, name) or "-"
+        current = stacksize
+
+    delta = proposed - current
+    total += delta
+    flag = ""
+    if peak >= stacksize:
+        flag = " OVERFLOW"
+    elif delta > 0:
+        flag = " GROW"
+    print("%-24s %8d %8d %8d %+8d  %s%s" % (name, current, peak, proposed, delta, where, flag))
+
+print("\nTotal change: %+d bytes" % total)
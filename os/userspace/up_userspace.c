@@ -57,6 +57,11 @@ extern uint32_t _ectors;
 extern uint32_t _eapp_flash;
 extern uint32_t _sapp_ram;
 extern uint32_t _eapp_ram;
+#ifdef CONFIG_XIP_ELF_RAMTEXT
+extern uint32_t _sramtext;
+extern uint32_t _eramtext;
+extern uint32_t _sramtext_flash;
+#endif
 
 extern int main(int argc, char **argv);
 
@@ -102,6 +107,11 @@ const struct userspace_s userspace __attribute__((section(".userspace"))) = {
 	.flash_end = &_eapp_flash,
 	.ram_start = &_sapp_ram,
 	.ram_end = &_eapp_ram,
+#ifdef CONFIG_XIP_ELF_RAMTEXT
+	.ramtext_start_in_ram = &_sramtext,
+	.ramtext_end_in_ram = &_eramtext,
+	.ramtext_start_in_flash = &_sramtext_flash,
+#endif
 #ifndef __COMMON_BINARY__
 	.entry = main,
 #endif
@@ -113,6 +123,9 @@ const struct userspace_s userspace __attribute__((section(".userspace"))) = {
 #endif
 #endif
 #endif
+#ifdef CONFIG_LIB_SYSCALL_VDSO
+	.vdso = &g_vdso,
+#endif
 };
 
 /****************************************************************************
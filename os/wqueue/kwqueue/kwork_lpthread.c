@@ -242,6 +242,7 @@ int work_lpstart(void)
 
 		lwq->worker[wndx].pid = (pid_t)pid;
 		lwq->worker[wndx].busy = true;
+		work_qbind((pid_t)pid, wndx);
 	}
 
 	sched_unlock();
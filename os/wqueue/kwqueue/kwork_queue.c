@@ -154,3 +154,57 @@ int work_queue(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg,
 			return -EINVAL;
 		}
 }
+
+/****************************************************************************
+ * Name: work_queue_many
+ *
+ * Description:
+ *   Queue a batch of kernel-mode work with one lock of the queue and one
+ *   signal to its workers.
+ *
+ * Input parameters:
+ *   qid    - The work queue ID (index)
+ *   items  - The work structures to queue with their worker and argument
+ *   nitems - The number of entries in items
+ *   delay  - Delay (in clock ticks) from the time queue until the workers
+ *            are invoked. Zero means to perform the work immediately.
+ *
+ * Returned Value:
+ *   The number of work queued on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+int work_queue_many(int qid, FAR const struct work_item_s *items, int nitems, clock_t delay)
+{
+	FAR struct wqueue_s *wqueue;
+	int nqueued;
+	int ret;
+
+#ifdef CONFIG_SCHED_HPWORK
+	if (qid == HPWORK) {
+		wqueue = (FAR struct wqueue_s *)get_hpwork();
+	} else
+#endif
+#ifdef CONFIG_SCHED_LPWORK
+	if (qid == LPWORK) {
+		wqueue = (FAR struct wqueue_s *)get_lpwork();
+	} else
+#endif
+	{
+		return -EINVAL;
+	}
+
+	if (items == NULL || nitems < 0) {
+		return -EINVAL;
+	}
+
+	nqueued = work_qqueue_many(wqueue, items, nitems, delay);
+	if (nqueued > 0) {
+		ret = work_signal(qid);
+		if (ret != OK) {
+			return ret;
+		}
+	}
+
+	return nqueued;
+}
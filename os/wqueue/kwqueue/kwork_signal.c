@@ -23,7 +23,9 @@
 #include <tinyara/config.h>
 
 #include <signal.h>
+#include <sched.h>
 #include <errno.h>
+#include <debug.h>
 
 #include <tinyara/wqueue.h>
 
@@ -32,6 +34,62 @@
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
+
+/****************************************************************************
+ * Name: work_qpick
+ *
+ * Description:
+ *   Select the worker of a thread pool to wake up: an idle one, preferably
+ *   bound to the calling CPU when CONFIG_SCHED_WORKAFFINITY is selected.
+ *
+ ****************************************************************************/
+
+int work_qpick(FAR struct wqueue_s *wqueue, int nworkers)
+{
+	int wndx;
+
+#ifdef CONFIG_SCHED_WORKAFFINITY
+	/* The workers of this CPU first, their cache is warm with its data */
+
+	for (wndx = sched_getcpu(); wndx >= 0 && wndx < nworkers; wndx += CONFIG_SMP_NCPUS) {
+		if (!wqueue->worker[wndx].busy) {
+			return wndx;
+		}
+	}
+#endif
+
+	for (wndx = 0; wndx < nworkers; wndx++) {
+		if (!wqueue->worker[wndx].busy) {
+			return wndx;
+		}
+	}
+
+	/* All of them are busy: signal worker 0 */
+
+	return 0;
+}
+
+#ifdef CONFIG_SCHED_WORKAFFINITY
+/****************************************************************************
+ * Name: work_qbind
+ *
+ * Description:
+ *   Bind worker 'wndx' of a pool to CPU wndx % CONFIG_SMP_NCPUS.
+ *
+ ****************************************************************************/
+
+void work_qbind(pid_t pid, int wndx)
+{
+	cpu_set_t cpuset;
+
+	CPU_ZERO(&cpuset);
+	CPU_SET(wndx % CONFIG_SMP_NCPUS, &cpuset);
+	if (sched_setaffinity(pid, sizeof(cpu_set_t), &cpuset) < 0) {
+		sdbg("Failed to bind worker %d to CPU %d: %d\n", pid, wndx % CONFIG_SMP_NCPUS, get_errno());
+	}
+}
+#endif
+
 /****************************************************************************
  * Name: work_signal
  *
@@ -55,33 +113,23 @@ int work_signal(int qid)
 #ifdef CONFIG_SCHED_HPWORK
 	if (qid == HPWORK) {
 		struct hp_wqueue_s *hwq = get_hpwork();
-		pid = hwq->worker[0].pid;
+
+		/* Use an IDLE worker thread, or worker thread 0 if all of them
+		 * are busy.
+		 */
+
+		pid = hwq->worker[work_qpick((FAR struct wqueue_s *)hwq, CONFIG_SCHED_HPNTHREADS)].pid;
 	} else
 #endif
 #ifdef CONFIG_SCHED_LPWORK
 	if (qid == LPWORK) {
-		int wndx;
-		int i;
 		struct lp_wqueue_s *lwq = get_lpwork();
 
-		/* Find an IDLE worker thread */
-
-		for (wndx = 0, i = 0; i < CONFIG_SCHED_LPNTHREADS; i++) {
-			/* Is this worker thread busy? */
-
-			if (!lwq->worker[i].busy) {
-				/* No.. select this thread */
-
-				wndx = i;
-				break;
-			}
-		}
-
 		/* Use the process ID of the IDLE worker thread (or the ID of worker
-			* thread 0 if all of the worker threads are busy).
-			*/
+		 * thread 0 if all of the worker threads are busy).
+		 */
 
-		pid = lwq->worker[wndx].pid;
+		pid = lwq->worker[work_qpick((FAR struct wqueue_s *)lwq, CONFIG_SCHED_LPNTHREADS)].pid;
 	} else
 #endif
 	{
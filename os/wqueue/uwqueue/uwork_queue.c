@@ -135,3 +135,42 @@ int work_queue(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg,
 		return -EINVAL;
 	}
 }
+
+/****************************************************************************
+ * Name: work_queue_many
+ *
+ * Description:
+ *   Queue a batch of user-mode work with one lock of the queue and one
+ *   signal to its worker.
+ *
+ * Input parameters:
+ *   qid    - The work queue ID (index)
+ *   items  - The work structures to queue with their worker and argument
+ *   nitems - The number of entries in items
+ *   delay  - Delay (in clock ticks) from the time queue until the workers
+ *            are invoked. Zero means to perform the work immediately.
+ *
+ * Returned Value:
+ *   The number of work queued on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+int work_queue_many(int qid, FAR const struct work_item_s *items, int nitems, clock_t delay)
+{
+	int nqueued;
+	int ret;
+
+	if (qid != USRWORK || items == NULL || nitems < 0) {
+		return -EINVAL;
+	}
+
+	nqueued = work_qqueue_many(get_usrwork(), items, nitems, delay);
+	if (nqueued > 0) {
+		ret = work_signal(USRWORK);
+		if (ret != OK) {
+			return ret;
+		}
+	}
+
+	return nqueued;
+}
@@ -87,6 +87,49 @@
  * Private Functions
  ****************************************************************************/
 
+/* Insert one work in the queue, sorted by expiry.  The queue is locked. */
+
+static int work_qinsert(FAR struct wqueue_s *wqueue, FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay, clock_t ctick)
+{
+	struct work_s *next_work = NULL;
+	struct work_s *cur_work;
+	clock_t elapsed;
+
+	/* check whether requested work is in queue list or not */
+	cur_work = (struct work_s *)wqueue->q.head;
+	while (cur_work != NULL) {
+		if (cur_work == work) {
+			return -EALREADY;
+		}
+
+		if (next_work == NULL) {
+			elapsed = ctick - cur_work->qtime;
+			if (cur_work->delay > elapsed && cur_work->delay - elapsed > delay) {
+				next_work = cur_work;
+			}
+		}
+
+		cur_work = (struct work_s *)cur_work->dq.flink;
+	}
+
+	work->worker = worker;		/* Work callback */
+	work->arg = arg;		/* Callback argument */
+	work->delay = delay;		/* Delay until work performed */
+	work->qtime = ctick;		/* Time work queued */
+
+	if (next_work) {
+		dq_addbefore((FAR dq_entry_t *)next_work, (FAR dq_entry_t *)work, &wqueue->q);
+	} else {
+		dq_addlast((FAR dq_entry_t *)work, &wqueue->q);
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
 /****************************************************************************
  * Name: work_qqueue
  *
@@ -120,10 +163,8 @@ int work_qqueue(FAR struct wqueue_s *wqueue, FAR struct work_s *work, worker_t w
 {
 	DEBUGASSERT(work != NULL);
 
-	struct work_s *next_work = NULL;
-	struct work_s *cur_work;
-	clock_t elapsed;
 	clock_t ctick;
+	int ret;
 	ctick = clock();
 
 #if defined(CONFIG_SCHED_USRWORK) && !defined(__KERNEL__)
@@ -133,43 +174,61 @@ int work_qqueue(FAR struct wqueue_s *wqueue, FAR struct work_s *work, worker_t w
 	flags = enter_critical_section();
 #endif
 
-	/* check whether requested work is in queue list or not */
-	cur_work = (struct work_s *)wqueue->q.head;
-	while (cur_work != NULL) {
-		if (cur_work == work) {
+	ret = work_qinsert(wqueue, work, worker, arg, delay, ctick);
+
 #if defined(CONFIG_SCHED_USRWORK) && !defined(__KERNEL__)
-			work_unlock();
+	work_unlock();
 #else
-			leave_critical_section(flags);
+	leave_critical_section(flags);
 #endif
-			return -EALREADY;
-		}
 
-		if (next_work == NULL) {
-			elapsed = ctick - cur_work->qtime;
-			if (cur_work->delay > elapsed && cur_work->delay - elapsed > delay) {
-				next_work = cur_work;
-			}
-		}
+	return ret;
+}
 
-		cur_work = (struct work_s *)cur_work->dq.flink;
-	}
+/****************************************************************************
+ * Name: work_qqueue_many
+ *
+ * Description:
+ *   Queue a batch of work with a single lock of the queue.  Work already
+ *   in the queue is skipped.
+ *
+ * Input parameters:
+ *   wqueue - The work queue
+ *   items  - The work to queue, with their worker and argument
+ *   nitems - The number of entries in items
+ *   delay  - Delay (in clock ticks) applied to all of them
+ *
+ * Returned Value:
+ *   The number of work queued.
+ *
+ ****************************************************************************/
 
-	work->worker = worker;		/* Work callback */
-	work->arg = arg;		/* Callback argument */
-	work->delay = delay;		/* Delay until work performed */
-	work->qtime = ctick;		/* Time work queued */
+int work_qqueue_many(FAR struct wqueue_s *wqueue, FAR const struct work_item_s *items, int nitems, clock_t delay)
+{
+	clock_t ctick;
+	int nqueued = 0;
+	int i;
+	ctick = clock();
 
-	if (next_work) {
-		dq_addbefore((FAR dq_entry_t *)next_work, (FAR dq_entry_t *)work, &wqueue->q);
-	} else {
-		dq_addlast((FAR dq_entry_t *)work, &wqueue->q);
+#if defined(CONFIG_SCHED_USRWORK) && !defined(__KERNEL__)
+	while (work_lock() < 0);
+#else
+	irqstate_t flags;
+	flags = enter_critical_section();
+#endif
+
+	for (i = 0; i < nitems; i++) {
+		DEBUGASSERT(items[i].work != NULL);
+		if (work_qinsert(wqueue, items[i].work, items[i].worker, items[i].arg, delay, ctick) == OK) {
+			nqueued++;
+		}
 	}
+
 #if defined(CONFIG_SCHED_USRWORK) && !defined(__KERNEL__)
 	work_unlock();
 #else
 	leave_critical_section(flags);
 #endif
 
-	return OK;
+	return nqueued;
 }
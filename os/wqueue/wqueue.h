@@ -93,7 +93,9 @@ struct wqueue_s {
 #ifdef CONFIG_SCHED_HPWORK
 struct hp_wqueue_s {
 	struct dq_queue_s q;		/* The queue of pending work */
-	struct worker_s worker[1];	/* Describes the single high priority worker */
+
+	/* Describes each thread in the high priority queue's thread pool */
+	struct worker_s worker[CONFIG_SCHED_HPNTHREADS];
 };
 #endif
 
@@ -228,6 +230,20 @@ int work_qcancel(FAR struct wqueue_s *wqueue, FAR struct work_s *work);
 
 int work_qqueue(FAR struct wqueue_s *wqueue, FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay);
 
+/****************************************************************************
+ * Name: work_qqueue_many
+ *
+ * Description:
+ *   Queue a batch of work with one lock of the queue.  Work already in the
+ *   queue is skipped.
+ *
+ * Returned Value:
+ *   The number of work queued.
+ *
+ ****************************************************************************/
+
+int work_qqueue_many(FAR struct wqueue_s *wqueue, FAR const struct work_item_s *items, int nitems, clock_t delay);
+
 /****************************************************************************
  * Name: work_process
  *
@@ -265,5 +281,37 @@ void work_process(FAR struct wqueue_s *wqueue, int wdx);
 
 int work_qsignal(pid_t pid);
 
+/****************************************************************************
+ * Name: work_qpick
+ *
+ * Description:
+ *   Select the worker of a thread pool to wake up: an idle one, preferably
+ *   bound to the calling CPU when CONFIG_SCHED_WORKAFFINITY is selected.
+ *
+ * Input parameters:
+ *   wqueue   - The work queue
+ *   nworkers - The number of threads of its pool
+ *
+ * Returned Value:
+ *   The index of the worker, 0 if all of them are busy.
+ *
+ ****************************************************************************/
+
+int work_qpick(FAR struct wqueue_s *wqueue, int nworkers);
+
+/****************************************************************************
+ * Name: work_qbind
+ *
+ * Description:
+ *   Bind worker 'wndx' of a pool to CPU wndx % CONFIG_SMP_NCPUS.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKAFFINITY
+void work_qbind(pid_t pid, int wndx);
+#else
+#define work_qbind(pid, wndx)
+#endif
+
 #endif							/* CONFIG_SCHED_WORKQUEUE */
 #endif							/* __OS_WQUEUE_WQUEUE_H */
@@ -18,6 +18,8 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include <png.h>
 
 typedef enum {
@@ -35,6 +37,13 @@ typedef enum {
 	UI_PIXEL_FORMAT_A8
 } ui_pixel_format_t;
 
+typedef enum {
+	UI_IMAGE_COMPRESSION_NONE,
+	UI_IMAGE_COMPRESSION_RLE,
+	UI_IMAGE_COMPRESSION_LZ4,
+	UI_IMAGE_COMPRESSION_PALETTE
+} ui_image_compression_t;
+
 typedef struct {
 	uint32_t id;
 	int32_t width;
@@ -42,38 +51,250 @@ typedef struct {
 	ui_pixel_format_t pf;
 	uint32_t header_size;
 	uint32_t data_size;
-	int32_t reserved[8];
+	uint32_t compression;
+	int32_t reserved[7];
 } __attribute__((packed)) ui_bitmap_data_t;
 
-static void convert_to_c(
+#define LZ4_MIN_MATCH    4
+#define LZ4_HASH_BITS    12
+
+static void put_u32(uint8_t *p, uint32_t value)
+{
+	p[0] = value & 0xff;
+	p[1] = (value >> 8) & 0xff;
+	p[2] = (value >> 16) & 0xff;
+	p[3] = (value >> 24) & 0xff;
+}
+
+static uint8_t *put_length(uint8_t *dst, int len)
+{
+	while (len >= 255) {
+		*dst++ = 255;
+		len -= 255;
+	}
+	*dst++ = len;
+	return dst;
+}
+
+/* Packets of a byte n then n + 1 pixels if n < 128, or a pixel repeated n - 127 times */
+static int rle_encode(const uint8_t *src, int width, int bpp, uint8_t *dst)
+{
+	uint8_t *out = dst;
+	int x = 0;
+
+	while (x < width) {
+		int run = 1;
+		while (x + run < width && run < 128 && !memcmp(src + x * bpp, src + (x + run) * bpp, bpp)) {
+			run++;
+		}
+		if (run > 1) {
+			*out++ = 0x80 | (run - 1);
+			memcpy(out, src + x * bpp, bpp);
+			out += bpp;
+			x += run;
+			continue;
+		}
+
+		/* Literals until the next run of 2 pixels */
+		int count = 1;
+		while (x + count < width && count < 128 &&
+			(x + count + 1 >= width || memcmp(src + (x + count) * bpp, src + (x + count + 1) * bpp, bpp))) {
+			count++;
+		}
+		*out++ = count - 1;
+		memcpy(out, src + x * bpp, count * bpp);
+		out += count * bpp;
+		x += count;
+	}
+
+	return out - dst;
+}
+
+/* A LZ4 block, with the matches found by a hash of 4 bytes */
+static int lz4_encode(const uint8_t *src, int len, uint8_t *dst)
+{
+	int table[1 << LZ4_HASH_BITS];
+	uint8_t *out = dst;
+	int anchor = 0;
+	int pos = 0;
+
+	memset(table, 0xff, sizeof(table));
+
+	/* The last match starts 12 bytes before the end and the last 5 bytes are literals */
+	while (pos + 12 <= len) {
+		uint32_t seq;
+		memcpy(&seq, src + pos, 4);
+		int hash = (seq * 2654435761u) >> (32 - LZ4_HASH_BITS);
+		int ref = table[hash];
+		table[hash] = pos;
+
+		if (ref < 0 || pos - ref > 0xffff || memcmp(src + ref, src + pos, LZ4_MIN_MATCH)) {
+			pos++;
+			continue;
+		}
+
+		int match = LZ4_MIN_MATCH;
+		while (pos + match < len - 5 && src[ref + match] == src[pos + match]) {
+			match++;
+		}
+
+		int literals = pos - anchor;
+		uint8_t *token = out++;
+		*token = (literals < 15 ? literals : 15) << 4;
+		if (literals >= 15) {
+			out = put_length(out, literals - 15);
+		}
+		memcpy(out, src + anchor, literals);
+		out += literals;
+
+		*out++ = (pos - ref) & 0xff;
+		*out++ = (pos - ref) >> 8;
+		*token |= (match - LZ4_MIN_MATCH < 15 ? match - LZ4_MIN_MATCH : 15);
+		if (match - LZ4_MIN_MATCH >= 15) {
+			out = put_length(out, match - LZ4_MIN_MATCH - 15);
+		}
+
+		pos += match;
+		anchor = pos;
+	}
+
+	int literals = len - anchor;
+	*out++ = (literals < 15 ? literals : 15) << 4;
+	if (literals >= 15) {
+		out = put_length(out, literals - 15);
+	}
+	memcpy(out, src + anchor, literals);
+	out += literals;
+
+	return out - dst;
+}
+
+/* Offsets of the (height + 1) rows, then the rows compressed one by one */
+static int compress_rows(png_bytep *row_pointers, int width, int height, int bpp, ui_image_compression_t compression, uint8_t *dst)
+{
+	uint8_t *rows = dst + (height + 1) * 4;
+	int offset = 0;
+
+	for (int y = 0; y < height; y++) {
+		put_u32(dst + y * 4, offset);
+		if (compression == UI_IMAGE_COMPRESSION_RLE) {
+			offset += rle_encode(row_pointers[y], width, bpp, rows + offset);
+		} else {
+			offset += lz4_encode(row_pointers[y], width * bpp, rows + offset);
+		}
+	}
+	put_u32(dst + height * 4, offset);
+
+	return (height + 1) * 4 + offset;
+}
+
+/* The number of colors, the colors, then an index per pixel. -1 over 256 colors */
+static int make_palette(png_bytep *row_pointers, int width, int height, int bpp, uint8_t *dst)
+{
+	uint8_t *palette = dst + 4;
+	uint8_t *index = palette + 256 * bpp;
+	int colors = 0;
+
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			const uint8_t *pixel = row_pointers[y] + x * bpp;
+			int i;
+			for (i = 0; i < colors; i++) {
+				if (!memcmp(palette + i * bpp, pixel, bpp)) {
+					break;
+				}
+			}
+			if (i == colors) {
+				if (colors == 256) {
+					return -1;
+				}
+				memcpy(palette + colors * bpp, pixel, bpp);
+				colors++;
+			}
+			*index++ = i;
+		}
+	}
+
+	put_u32(dst, colors);
+	/* The indexes follow the colors used, not the 256 slots */
+	memmove(palette + colors * bpp, palette + 256 * bpp, width * height);
+
+	return 4 + colors * bpp + width * height;
+}
+
+static int convert_to_c(
 	const char *c_filename, const char *var_name, png_bytep *row_pointers,
-	int width, int height, png_byte color_type, png_byte bit_depth) {
+	int width, int height, png_byte color_type, png_byte bit_depth, ui_image_compression_t compression) {
 
-	int data_size = 0;
+	int bytes_per_pixel;
+	ui_pixel_format_t pf;
 
-	FILE *fp = fopen(c_filename, "w");
+	if (bit_depth != 8) {
+		printf("Not supported bit depth %d\n", bit_depth);
+		return -1;
+	}
 
-	fprintf(fp, "#include <stdint.h>\n\n");
+	if (color_type == PNG_COLOR_TYPE_RGBA) {
+		bytes_per_pixel = 4;
+		pf = UI_PIXEL_FORMAT_RGBA8888;
+	} else if (color_type == PNG_COLOR_TYPE_RGB) {
+		bytes_per_pixel = 3;
+		pf = UI_PIXEL_FORMAT_RGB888;
+	} else {
+		printf("Not supported color type %d\n", color_type);
+		return -1;
+	}
+
+	/* The worst case of each encoding is a bit more than the raw pixels */
+	int raw_size = width * height * bytes_per_pixel;
+	uint8_t *data = (uint8_t *)malloc(raw_size * 2 + (height + 1) * 4 + 256 * bytes_per_pixel + 4);
+	if (!data) {
+		return -1;
+	}
 
-	if (color_type == 6) { // RGBA
-		data_size = width * height * (bit_depth / 8) * 4;
-	} else if (color_type == 2) { // RGB
-		data_size = width * height * (bit_depth / 8) * 3;
+	int data_size;
+	switch (compression) {
+	case UI_IMAGE_COMPRESSION_RLE:
+	case UI_IMAGE_COMPRESSION_LZ4:
+		data_size = compress_rows(row_pointers, width, height, bytes_per_pixel, compression, data);
+		break;
+	case UI_IMAGE_COMPRESSION_PALETTE:
+		data_size = make_palette(row_pointers, width, height, bytes_per_pixel, data);
+		if (data_size < 0) {
+			printf("More than 256 colors, a palette is not possible\n");
+			free(data);
+			return -1;
+		}
+		break;
+	default:
+		for (int y = 0; y < height; y++) {
+			memcpy(data + y * width * bytes_per_pixel, row_pointers[y], width * bytes_per_pixel);
+		}
+		data_size = raw_size;
+		break;
+	}
+
+	FILE *fp = fopen(c_filename, "w");
+	if (!fp) {
+		free(data);
+		return -1;
 	}
 
+	fprintf(fp, "#include <stdint.h>\n\n");
+
 	fprintf(fp, "const uint8_t %s[%lu] = {\n", var_name, data_size + sizeof(ui_bitmap_data_t));
 
 	ui_bitmap_data_t header = {
 		.id = 0x00,
 		.width = width,
 		.height = height,
-		.pf = 0x0a,
+		.pf = pf,
 		.header_size = sizeof(ui_bitmap_data_t),
-		.data_size = data_size
+		.data_size = data_size,
+		.compression = compression
 	};
 
-	header.reserved[0] = header.reserved[1] = header.reserved[2] = header.reserved[3] = 0x00;
-	header.reserved[4] = header.reserved[5] = header.reserved[6] = header.reserved[7] = 0x00;
+	memset(header.reserved, 0, sizeof(header.reserved));
 
 	uint8_t *hp = (uint8_t *)&header;
 
@@ -83,32 +304,52 @@ static void convert_to_c(
 	}
 	fprintf(fp, "\n");
 
-	int bytes_per_pixel = data_size / (width * height);
-
-	for (int y = 0; y < height; y++) {
-		fprintf(fp, "\t");
-		for (int x = 0; x < width; x++) {
-			for (int i = 0; i < bytes_per_pixel; i++) {
-				fprintf(fp, "0x%02x", row_pointers[y][x * bytes_per_pixel + i]);
-				if (y != (height - 1) || x != (width - 1) || i != (bytes_per_pixel - 1)) {
-					fprintf(fp, ",");
-				}
-			}
+	for (int i = 0; i < data_size; i++) {
+		if (i % 16 == 0) {
+			fprintf(fp, "\t");
+		}
+		fprintf(fp, "0x%02x", data[i]);
+		if (i != data_size - 1) {
+			fprintf(fp, ",");
+		}
+		if (i % 16 == 15 || i == data_size - 1) {
+			fprintf(fp, "\n");
 		}
-		fprintf(fp, "\n");
 	}
 
 	fprintf(fp, "};\n\n");
 
 	fclose(fp);
+	free(data);
+
+	printf("%s: %d bytes of pixels, %d bytes of data\n", var_name, raw_size, data_size);
+
+	return 0;
 }
 
 int main(int argc, char *argv[])
 {
-	if (argc < 4) {
-		printf("Usage: %s <png filename> <c filename> <variable name>\n", argv[0]);
+	ui_image_compression_t compression = UI_IMAGE_COMPRESSION_NONE;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "c:")) != -1) {
+		if (opt == 'c' && !strcmp(optarg, "rle")) {
+			compression = UI_IMAGE_COMPRESSION_RLE;
+		} else if (opt == 'c' && !strcmp(optarg, "lz4")) {
+			compression = UI_IMAGE_COMPRESSION_LZ4;
+		} else if (opt == 'c' && !strcmp(optarg, "palette")) {
+			compression = UI_IMAGE_COMPRESSION_PALETTE;
+		} else if (opt != 'c' || strcmp(optarg, "none")) {
+			argc = 0;
+			break;
+		}
+	}
+
+	if (argc - optind < 3) {
+		printf("Usage: %s [-c none|rle|lz4|palette] <png filename> <c filename> <variable name>\n", argv[0]);
 		return 0;
 	}
+	argv += optind - 1;
 
 	FILE *fp = fopen(argv[1], "r");
 	if (!fp) {
@@ -136,7 +377,7 @@ int main(int argc, char *argv[])
 
 	png_read_image(png, row_pointers);
 
-	convert_to_c(argv[2], argv[3], row_pointers, width, height, color_type, bit_depth);
+	convert_to_c(argv[2], argv[3], row_pointers, width, height, color_type, bit_depth, compression);
 
 	fclose(fp);
 
@@ -56,12 +56,14 @@ typedef struct {
 	ui_touch_event_t event;
 	int32_t x;
 	int32_t y;
+	uint32_t time;
 } ui_touch_queue_t;
 
 /****************************************************************************
  * Private Functions Declaration
  ****************************************************************************/
 static void _enqueue_touch_event(ui_touch_event_t type, int32_t x, int32_t y);
+static bool _dequeue_touch_event(ui_touch_sample_t *sample);
 
 /****************************************************************************
  * Private Variables
@@ -193,6 +195,82 @@ inline UI_DAL void ui_dal_put_pixel_rgb888(int32_t x, int32_t y, ui_color_t colo
 	bg->b = fg->b;
 }
 
+/* Clip a run of pixels to the screen, returning the number of pixels left
+ * and the number skipped at its start.
+ */
+static int32_t _clip_span(int32_t *x, int32_t y, int32_t count, int32_t *skip)
+{
+	*skip = 0;
+	if (y < 0 || y >= CONFIG_UI_DISPLAY_HEIGHT) {
+		return 0;
+	}
+	if (*x < 0) {
+		*skip = -(*x);
+		count -= *skip;
+		*x = 0;
+	}
+	if (*x + count > CONFIG_UI_DISPLAY_WIDTH) {
+		count = CONFIG_UI_DISPLAY_WIDTH - *x;
+	}
+	return count;
+}
+
+/* Blend kernel of the spans, opaque and transparent pixels skip the math */
+static inline void _blend_pixel(uint8_t *bg, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+	if (a == 255) {
+		bg[0] = r;
+		bg[1] = g;
+		bg[2] = b;
+	} else if (a != 0) {
+		bg[0] = ((r * a) + (bg[0] * (255 - a))) / 255;
+		bg[1] = ((g * a) + (bg[1] * (255 - a))) / 255;
+		bg[2] = ((b * a) + (bg[2] * (255 - a))) / 255;
+	}
+}
+
+UI_DAL void ui_dal_put_span_rgba8888(int32_t x, int32_t y, const uint8_t *pixels, int32_t count)
+{
+	uint8_t *bg;
+	int32_t skip;
+
+	count = _clip_span(&x, y, count, &skip);
+	pixels += skip * 4;
+	bg = &g_fb[BACK_PAGE][(y * CONFIG_UI_DISPLAY_WIDTH + x) * 3];
+
+	while (count-- > 0) {
+		_blend_pixel(bg, pixels[0], pixels[1], pixels[2], pixels[3]);
+		pixels += 4;
+		bg += 3;
+	}
+}
+
+UI_DAL void ui_dal_put_span_rgb888(int32_t x, int32_t y, const uint8_t *pixels, int32_t count)
+{
+	int32_t skip;
+
+	count = _clip_span(&x, y, count, &skip);
+	if (count > 0) {
+		memcpy(&g_fb[BACK_PAGE][(y * CONFIG_UI_DISPLAY_WIDTH + x) * 3], pixels + skip * 3, count * 3);
+	}
+}
+
+UI_DAL void ui_dal_put_span_a8(int32_t x, int32_t y, const uint8_t *alpha, int32_t count, ui_color_t color)
+{
+	uint8_t *bg;
+	int32_t skip;
+
+	count = _clip_span(&x, y, count, &skip);
+	alpha += skip;
+	bg = &g_fb[BACK_PAGE][(y * CONFIG_UI_DISPLAY_WIDTH + x) * 3];
+
+	/* The color is a fill color, 0xRRGGBB */
+	while (count-- > 0) {
+		_blend_pixel(bg, (color >> 16) & 0xff, (color >> 8) & 0xff, color & 0xff, *alpha++);
+		bg += 3;
+	}
+}
+
 UI_DAL ui_error_t ui_dal_set_viewport(int32_t x, int32_t y, int32_t width, int32_t height)
 {
 	g_viewport.x = x;
@@ -208,7 +286,23 @@ UI_DAL ui_rect_t ui_dal_get_viewport(void)
 	return g_viewport;
 }
 
-UI_DAL bool ui_dal_get_touch(bool *pressed, ui_coord_t *coord)
+UI_DAL int32_t ui_dal_get_touch_samples(ui_touch_sample_t *samples, int32_t count)
+{
+	int32_t i;
+
+	for (i = 0; i < count; i++) {
+		if (!_dequeue_touch_event(&samples[i])) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+/****************************************************************************
+ * Private Functions Implementation
+ ****************************************************************************/
+static bool _dequeue_touch_event(ui_touch_sample_t *sample)
 {
 	static ui_touch_event_t prev_touch_event = UI_TOUCH_EVENT_NONE;
 	static int dequeue_idx = 0;
@@ -232,9 +326,10 @@ UI_DAL bool ui_dal_get_touch(bool *pressed, ui_coord_t *coord)
 		}
 	}
 
-	*pressed = g_touch_queue[dequeue_idx].touch_press;
-	coord->x = g_touch_queue[dequeue_idx].x;
-	coord->y = g_touch_queue[dequeue_idx].y;
+	sample->pressed = g_touch_queue[dequeue_idx].touch_press;
+	sample->coord.x = g_touch_queue[dequeue_idx].x;
+	sample->coord.y = g_touch_queue[dequeue_idx].y;
+	sample->time = g_touch_queue[dequeue_idx].time;
 	prev_touch_event = g_touch_queue[dequeue_idx].event;
 	g_touch_queue[dequeue_idx].touch_press = -1;
 
@@ -246,9 +341,6 @@ UI_DAL bool ui_dal_get_touch(bool *pressed, ui_coord_t *coord)
 	return true;
 }
 
-/****************************************************************************
- * Private Functions Implementation
- ****************************************************************************/
 void set_key1_callback(void (*cb)(void))
 {
 	g_hotkey_cb[0] = cb;
@@ -380,6 +472,7 @@ static void _enqueue_touch_event(ui_touch_event_t type, int32_t x, int32_t y)
 	g_touch_queue[enqueue_idx].event = type;
 	g_touch_queue[enqueue_idx].x = x;
 	g_touch_queue[enqueue_idx].y = y;
+	g_touch_queue[enqueue_idx].time = SDL_GetTicks();
 
 	prev_touch_event = type;
 }
@@ -0,0 +1,253 @@
+/****************************************************************************
+ *
+ * Copyright 2025 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/*
+ * Rasterizes the glyphs of a set of characters of a TTF font at one size into
+ * a font atlas for ui_font_asset_set_atlas(), written as a C array.
+ * The glyphs are packed in rows, one pixel apart, so that a rotated or
+ * scaled glyph does not sample its neighbours.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb/stb_truetype.h>
+
+#define UI_FONT_ATLAS_MAGIC 0x41464955
+#define ATLAS_WIDTH         256
+#define ATLAS_PADDING       1
+#define DEFAULT_CHARS       " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~"
+
+/* Same layout as in framework/src/araui/include/ui_asset_internal.h */
+typedef struct {
+	uint32_t magic;
+	int32_t font_size;
+	int32_t width;
+	int32_t height;
+	uint32_t glyph_count;
+	uint32_t reserved;
+} ui_font_atlas_t;
+
+typedef struct {
+	uint32_t code;
+	uint16_t x;
+	uint16_t y;
+	uint16_t width;
+	uint16_t height;
+	int32_t y_offset;
+} ui_font_atlas_glyph_t;
+
+static int compare_code(const void *a, const void *b)
+{
+	uint32_t ca = ((const ui_font_atlas_glyph_t *)a)->code;
+	uint32_t cb = ((const ui_font_atlas_glyph_t *)b)->code;
+
+	return (ca > cb) - (ca < cb);
+}
+
+/* Decode the UTF-8 characters, without duplicates */
+static int decode_chars(const char *str, ui_font_atlas_glyph_t *glyphs, int max)
+{
+	const uint8_t *p = (const uint8_t *)str;
+	uint32_t code;
+	int count = 0;
+	int extra;
+	int i;
+
+	while (*p && count < max) {
+		if (*p < 0x80) {
+			code = *p++;
+			extra = 0;
+		} else if ((*p & 0xe0) == 0xc0) {
+			code = *p++ & 0x1f;
+			extra = 1;
+		} else if ((*p & 0xf0) == 0xe0) {
+			code = *p++ & 0x0f;
+			extra = 2;
+		} else {
+			code = *p++ & 0x07;
+			extra = 3;
+		}
+		while (extra-- > 0 && (*p & 0xc0) == 0x80) {
+			code = (code << 6) | (*p++ & 0x3f);
+		}
+
+		for (i = 0; i < count && glyphs[i].code != code; i++);
+		if (i == count) {
+			glyphs[count++].code = code;
+		}
+	}
+
+	qsort(glyphs, count, sizeof(ui_font_atlas_glyph_t), compare_code);
+	return count;
+}
+
+static uint8_t *read_file(const char *filename)
+{
+	FILE *fp;
+	long size;
+	uint8_t *buf;
+
+	fp = fopen(filename, "rb");
+	if (!fp) {
+		return NULL;
+	}
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	buf = (uint8_t *)malloc(size);
+	if (buf && fread(buf, 1, size, fp) != (size_t)size) {
+		free(buf);
+		buf = NULL;
+	}
+	fclose(fp);
+
+	return buf;
+}
+
+static void write_c(const char *c_filename, const char *var_name, const uint8_t *atlas, size_t size)
+{
+	FILE *fp;
+	size_t i;
+
+	fp = fopen(c_filename, "w");
+	if (!fp) {
+		printf("Failed to open %s\n", c_filename);
+		return;
+	}
+
+	fprintf(fp, "#include <stdint.h>\n\n");
+	fprintf(fp, "const uint8_t %s[%lu] __attribute__((aligned(4))) = {", var_name, (unsigned long)size);
+	for (i = 0; i < size; i++) {
+		if ((i % 16) == 0) {
+			fprintf(fp, "\n\t");
+		}
+		fprintf(fp, "0x%02x%s", atlas[i], (i != size - 1) ? "," : "");
+	}
+	fprintf(fp, "\n};\n\n");
+
+	fclose(fp);
+}
+
+int main(int argc, char *argv[])
+{
+	stbtt_fontinfo font;
+	ui_font_atlas_t header;
+	ui_font_atlas_glyph_t *glyphs;
+	uint8_t *ttf;
+	uint8_t *atlas;
+	uint8_t *texture;
+	const char *chars;
+	size_t table_size;
+	size_t size;
+	float scale;
+	int font_size;
+	int count;
+	int x;
+	int y;
+	int row_height;
+	int x1;
+	int y1;
+	int x2;
+	int y2;
+	int i;
+
+	if (argc < 5) {
+		printf("Usage: %s <ttf filename> <font size> <c filename> <variable name> [characters]\n", argv[0]);
+		printf("  characters: UTF-8 string of the characters to put in the atlas, printable ASCII by default\n");
+		return 0;
+	}
+
+	font_size = atoi(argv[2]);
+	chars = (argc > 5) ? argv[5] : DEFAULT_CHARS;
+
+	ttf = read_file(argv[1]);
+	if (!ttf || font_size <= 0 || !stbtt_InitFont(&font, ttf, 0)) {
+		printf("Failed to load %s\n", argv[1]);
+		return 1;
+	}
+
+	glyphs = (ui_font_atlas_glyph_t *)calloc(strlen(chars), sizeof(ui_font_atlas_glyph_t));
+	if (!glyphs) {
+		return 1;
+	}
+	count = decode_chars(chars, glyphs, strlen(chars));
+	scale = stbtt_ScaleForPixelHeight(&font, font_size);
+
+	/* Place the glyphs in rows of the texture */
+	x = ATLAS_PADDING;
+	y = ATLAS_PADDING;
+	row_height = 0;
+	for (i = 0; i < count; i++) {
+		stbtt_GetCodepointBitmapBox(&font, glyphs[i].code, scale, scale, &x1, &y1, &x2, &y2);
+		glyphs[i].width = x2 - x1;
+		glyphs[i].height = y2 - y1;
+		glyphs[i].y_offset = y1;
+		if (glyphs[i].width + 2 * ATLAS_PADDING > ATLAS_WIDTH) {
+			printf("Glyph 0x%x is wider than the atlas\n", glyphs[i].code);
+			return 1;
+		}
+		if (x + glyphs[i].width + ATLAS_PADDING > ATLAS_WIDTH) {
+			x = ATLAS_PADDING;
+			y += row_height + ATLAS_PADDING;
+			row_height = 0;
+		}
+		glyphs[i].x = x;
+		glyphs[i].y = y;
+		x += glyphs[i].width + ATLAS_PADDING;
+		if (glyphs[i].height > row_height) {
+			row_height = glyphs[i].height;
+		}
+	}
+
+	header.magic = UI_FONT_ATLAS_MAGIC;
+	header.font_size = font_size;
+	header.width = ATLAS_WIDTH;
+	header.height = y + row_height + ATLAS_PADDING;
+	header.glyph_count = count;
+	header.reserved = 0;
+
+	table_size = sizeof(header) + count * sizeof(ui_font_atlas_glyph_t);
+	size = table_size + header.width * header.height;
+	atlas = (uint8_t *)calloc(1, size);
+	if (!atlas) {
+		return 1;
+	}
+	memcpy(atlas, &header, sizeof(header));
+	memcpy(atlas + sizeof(header), glyphs, count * sizeof(ui_font_atlas_glyph_t));
+
+	texture = atlas + table_size;
+	for (i = 0; i < count; i++) {
+		if (glyphs[i].width > 0 && glyphs[i].height > 0) {
+			stbtt_MakeCodepointBitmap(&font, texture + glyphs[i].y * header.width + glyphs[i].x,
+				glyphs[i].width, glyphs[i].height, header.width, scale, scale, glyphs[i].code);
+		}
+	}
+
+	write_c(argv[3], argv[4], atlas, size);
+	printf("%s: %d glyphs of size %d, %dx%d texture, %lu bytes\n", argv[3], count, font_size,
+		header.width, header.height, (unsigned long)size);
+
+	free(atlas);
+	free(glyphs);
+	free(ttf);
+
+	return 0;
+}
@@ -0,0 +1,161 @@
+#!/usr/bin/env python
+###########################################################################
+#
+# Copyright 2025 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+
+# Converts the output of "ttrace -e" (CONFIG_TTRACE_FAST), captured from the
+# console, to the Chrome trace event format, which chrome://tracing and
+# ui.perfetto.dev open.
+#
+# Each CPU gets a track of the tasks it ran and one of the interrupts it
+# handled, and each task a track of the events it recorded with
+# trace_event().
+#
+# usage: ttrace_chrome.py [-n names] [-f freq] console.log trace.json
+#   names: lines of "<id> <name>" naming the ids given to trace_event()
+
+from __future__ import print_function
+import json
+import optparse
+import re
+import sys
+
+EVENT_BEGIN = 1
+EVENT_END = 2
+EVENT_INSTANT = 3
+EVENT_SWITCH = 4
+EVENT_IRQ_ENTER = 5
+EVENT_IRQ_LEAVE = 6
+
+PID_CPUS = 0
+PID_TASKS = 1
+# Interrupts of CPU n are on the thread TID_IRQS + n of PID_CPUS, apart from
+# its tasks, since switches happen inside of handlers
+TID_IRQS = 100
+
+HEADER = re.compile(r"ttrace_events cpu=(\d+) freq=(\d+) start=(\d+) dropped=(\d+) count=(\d+)")
+EVENT = re.compile(r"^(\d+) (\d+) (\d+) (-?\d+) (\d+)\s*$")
+
+
+def read_names(path):
+    names = {}
+    if path:
+        with open(path) as f:
+            for line in f:
+                fields = line.split(None, 1)
+                if len(fields) == 2:
+                    names[int(fields[0], 0)] = fields[1].strip()
+    return names
+
+
+def read_cpus(path):
+    """Returns a list of (cpu, freq, start, dropped, events) """
+    cpus = []
+    events = None
+    with open(path) as f:
+        for line in f:
+            m = HEADER.search(line)
+            if m:
+                cpu, freq, start, dropped, count = [int(v) for v in m.groups()]
+                events = []
+                cpus.append((cpu, freq, start, dropped, events))
+                continue
+            m = EVENT.match(line.strip())
+            if m and events is not None:
+                events.append([int(v) for v in m.groups()])
+    return cpus
+
+
+def task_slice(cpu, running, end):
+    pid, prio, begin = running
+    return {"ph": "X", "pid": PID_CPUS, "tid": cpu, "ts": begin, "dur": end - begin,
+            "name": "pid %d" % pid, "args": {"prio": prio}}
+
+
+def convert(cpus, names, freq):
+    out = []
+    # The counters of the CPUs are aligned on their first event
+    base = min([c[2] for c in cpus]) if cpus else 0
+
+    out.append({"ph": "M", "name": "process_name", "pid": PID_CPUS, "args": {"name": "CPUs"}})
+    out.append({"ph": "M", "name": "process_name", "pid": PID_TASKS, "args": {"name": "Tasks"}})
+
+    for cpu, cpufreq, start, dropped, events in cpus:
+        hz = freq or cpufreq
+        if not hz:
+            print("CPU%d: counter frequency unknown, times are in counts" % cpu, file=sys.stderr)
+            hz = 1000000
+        if dropped:
+            print("CPU%d: %d events dropped, ring full" % (cpu, dropped), file=sys.stderr)
+        out.append({"ph": "M", "name": "thread_name", "pid": PID_CPUS, "tid": cpu, "args": {"name": "CPU%d" % cpu}})
+        out.append({"ph": "M", "name": "thread_name", "pid": PID_CPUS, "tid": TID_IRQS + cpu,
+                    "args": {"name": "CPU%d irqs" % cpu}})
+
+        now = (start - base) & 0xffffffff
+        ts = 0
+        running = None
+        for delta, etype, eid, pid, arg in events:
+            now += delta
+            ts = now * 1000000.0 / hz
+            if etype == EVENT_SWITCH:
+                if running is not None:
+                    out.append(task_slice(cpu, running, ts))
+                running = (arg, eid, ts)
+            elif etype == EVENT_IRQ_ENTER:
+                out.append({"ph": "B", "pid": PID_CPUS, "tid": TID_IRQS + cpu, "ts": ts, "name": "irq %d" % eid})
+            elif etype == EVENT_IRQ_LEAVE:
+                out.append({"ph": "E", "pid": PID_CPUS, "tid": TID_IRQS + cpu, "ts": ts})
+            elif etype in (EVENT_BEGIN, EVENT_END, EVENT_INSTANT):
+                name = names.get(eid, "event %d" % eid)
+                ev = {"pid": PID_TASKS, "tid": pid, "ts": ts, "name": name, "args": {"arg": arg, "cpu": cpu}}
+                if etype == EVENT_BEGIN:
+                    ev["ph"] = "B"
+                elif etype == EVENT_END:
+                    ev["ph"] = "E"
+                else:
+                    ev["ph"] = "i"
+                    ev["s"] = "t"
+                out.append(ev)
+        if running is not None:
+            out.append(task_slice(cpu, running, ts))
+    return out
+
+
+def main():
+    parser = optparse.OptionParser(usage="%prog [options] console.log trace.json")
+    parser.add_option("-n", "--names", dest="names", help="file of '<id> <name>' lines for trace_event() ids")
+    parser.add_option("-f", "--freq", dest="freq", type="int", default=0,
+                      help="counter frequency in Hz, overrides the one of the target")
+    options, args = parser.parse_args()
+    if len(args) != 2:
+        parser.print_help()
+        return 1
+
+    cpus = read_cpus(args[0])
+    if not cpus:
+        print("No 'ttrace -e' output in %s" % args[0], file=sys.stderr)
+        return 1
+
+    with open(args[1], "w") as f:
+        json.dump({"traceEvents": convert(cpus, read_names(options.names), options.freq),
+                   "displayTimeUnit": "ns"}, f)
+    print("%s: %d CPUs, %d events" % (args[1], len(cpus), sum([len(c[4]) for c in cpus])))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())